@@ -0,0 +1,349 @@
+/* bench.cpp -- benchmark the compression and filter kernels
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2023 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2023 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+// "upx --benchmark FILE..." runs the hot kernels of UPX over a corpus of
+// real files: upx_compress() and upx_decompress() for every method and
+// level, upx_find_overlap(), the filter/unfilter/scan functions of every
+// filter and upx_adler32(). Every kernel is run repeatedly and the fastest
+// run is reported, so that the numbers are stable enough to compare two
+// builds, e.g. after updating one of the compression libraries.
+// "--benchmark=json" writes one JSON record per kernel instead of a table.
+
+#include "conf.h"
+#include "file.h"
+#include "filter.h"
+#include "util/membuffer.h"
+#include <chrono>
+
+/*************************************************************************
+// timing
+**************************************************************************/
+
+// NOTE: the TSC counts at a constant reference frequency, which is close
+// to but not exactly the actual core clock; returns 0 if not available
+static inline upx_uint64_t bench_cycles() noexcept {
+#if (ACC_ARCH_AMD64 || ACC_ARCH_I386) && (ACC_CC_MSC)
+    return __rdtsc();
+#elif (ACC_ARCH_AMD64 || ACC_ARCH_I386) && defined(__GNUC__)
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+namespace {
+
+struct BenchTime final {
+    double seconds = 0;      // fastest run
+    upx_uint64_t cycles = 0; // cycles of the fastest run
+    unsigned runs = 0;
+};
+
+// call setup() and fn() until the time budget is used up; only fn() is timed
+template <class Setup, class Fn>
+BenchTime bench_time(double budget, Setup &&setup, Fn &&fn) {
+    typedef std::chrono::steady_clock clock;
+    BenchTime t;
+    double total = 0;
+    do {
+        setup();
+        const upx_uint64_t c0 = bench_cycles();
+        const auto t0 = clock::now();
+        fn();
+        const auto t1 = clock::now();
+        const upx_uint64_t c1 = bench_cycles();
+        const double s = std::chrono::duration<double>(t1 - t0).count();
+        if (t.runs == 0 || s < t.seconds) {
+            t.seconds = s;
+            t.cycles = c1 - c0;
+        }
+        total += s;
+        t.runs += 1;
+    } while (total < budget && t.runs < 1000);
+    return t;
+}
+
+/*************************************************************************
+// Bench
+**************************************************************************/
+
+struct Bench final {
+    FILE *f = nullptr;    // output, or nullptr to only count results
+    bool json = false;    // else a text table
+    double budget = 0.25; // seconds per kernel
+    int method = 0;       // 0 means all methods
+    int level = 0;        // 0 means some representative levels
+    unsigned results = 0;
+
+    void run(const char *name, const byte *buf, unsigned u_len);
+    void header();
+    void footer();
+
+private:
+    void runMethod(const char *name, const byte *buf, unsigned u_len, int m, int l, byte *cbuf,
+                   byte *dbuf);
+    void runFilter(const char *name, const byte *buf, unsigned u_len, int id, byte *fbuf,
+                   byte *tbuf);
+    void report(const char *name, const char *kernel, const char *variant, unsigned u_len,
+                unsigned c_len, const BenchTime &t);
+};
+
+static const struct {
+    int method;
+    const char *name;
+} bench_methods[] = {
+    {M_NRV2B_LE32, "nrv2b"}, {M_NRV2D_LE32, "nrv2d"}, {M_NRV2E_LE32, "nrv2e"},
+    {M_LZMA, "lzma"},
+#if (WITH_ZSTD)
+    {M_ZSTD, "zstd"},
+#endif
+};
+
+static const int bench_levels[] = {1, 7, 9};
+
+static void bench_json_string(FILE *f, const char *s) {
+    fputc('"', f);
+    for (; *s; s++) {
+        const unsigned char c = (unsigned char) *s;
+        if (c == '"' || c == '\\')
+            fprintf(f, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(f, "\\u%04x", c);
+        else
+            fputc(c, f);
+    }
+    fputc('"', f);
+}
+
+void Bench::header() {
+    if (!f)
+        return;
+    if (json)
+        fprintf(f, "{\"upx_version\":\"%s\",\"results\":[", UPX_VERSION_STRING);
+    else
+        fprintf(f, "%-10s %-8s %10s %10s %7s %10s %8s  %s\n", "kernel", "variant", "u_len",
+                "c_len", "ratio", "MB/s", "cyc/B", "file");
+}
+
+void Bench::footer() {
+    if (f && json)
+        fprintf(f, "\n]}\n");
+    if (f)
+        fflush(f);
+}
+
+// MB/s and cycles/byte always refer to the uncompressed size
+void Bench::report(const char *name, const char *kernel, const char *variant, unsigned u_len,
+                   unsigned c_len, const BenchTime &t) {
+    results += 1;
+    if (!f)
+        return;
+    const double mbs = t.seconds > 0 ? u_len / t.seconds / 1e6 : 0;
+    const double cpb = u_len > 0 ? double(t.cycles) / u_len : 0;
+    const double ratio = u_len > 0 ? 100.0 * c_len / u_len : 0;
+    if (json) {
+        fprintf(f, "%s\n{\"file\":", results > 1 ? "," : "");
+        bench_json_string(f, name);
+        fprintf(f, ",\"kernel\":\"%s\",\"variant\":\"%s\",\"u_len\":%u", kernel, variant, u_len);
+        if (c_len)
+            fprintf(f, ",\"c_len\":%u,\"ratio\":%.4f", c_len, ratio / 100);
+        fprintf(f, ",\"runs\":%u,\"seconds\":%.9f,\"mb_per_s\":%.3f", t.runs, t.seconds, mbs);
+        if (t.cycles)
+            fprintf(f, ",\"cycles_per_byte\":%.3f", cpb);
+        fprintf(f, "}");
+    } else {
+        char r[16] = "-", c[16] = "-";
+        if (c_len)
+            snprintf(r, sizeof(r), "%6.2f%%", ratio);
+        if (t.cycles)
+            snprintf(c, sizeof(c), "%8.2f", cpb);
+        fprintf(f, "%-10s %-8s %10u %10u %7s %10.2f %8s  %s\n", kernel, variant, u_len, c_len, r,
+                mbs, c, name);
+    }
+}
+
+void Bench::run(const char *name, const byte *buf, unsigned u_len) {
+    {
+        unsigned adler = 0;
+        const BenchTime t =
+            bench_time(budget, [] {}, [&] { adler = upx_adler32(buf, u_len); });
+        report(name, "adler32", "-", u_len, 0, t);
+        UNUSED(adler);
+    }
+
+    MemBuffer cbuf(MemBuffer::getSizeForCompression(u_len));
+    MemBuffer dbuf(u_len);
+    for (const auto &bm : bench_methods) {
+        if (method > 0 && bm.method != method)
+            continue;
+        if (level > 0)
+            runMethod(name, buf, u_len, bm.method, level, cbuf, dbuf);
+        else
+            for (int l : bench_levels)
+                runMethod(name, buf, u_len, bm.method, l, cbuf, dbuf);
+    }
+
+    for (int id = 1; id <= 255; id++)
+        if (Filter::isValidFilter(id))
+            runFilter(name, buf, u_len, id, cbuf, dbuf);
+}
+
+void Bench::runMethod(const char *name, const byte *buf, unsigned u_len, int m, int l,
+                      byte *cbuf, byte *dbuf) {
+    const char *mname = "?";
+    for (const auto &bm : bench_methods)
+        if (bm.method == m)
+            mname = bm.name;
+    char variant[32];
+    snprintf(variant, sizeof(variant), "%s/%d", mname, l);
+
+    upx_compress_result_t cresult;
+    unsigned c_len = 0;
+    int r = UPX_E_OK;
+    BenchTime t = bench_time(
+        budget, [&] { c_len = 0; },
+        [&] { r = upx_compress(buf, u_len, cbuf, &c_len, nullptr, m, l, NULL_cconf, &cresult); });
+    if (r == UPX_E_OUT_OF_MEMORY)
+        throwOutOfMemoryException();
+    if (r != UPX_E_OK)
+        throwInternalError("benchmark compression failed");
+    report(name, "compress", variant, u_len, c_len, t);
+    if (c_len >= u_len)
+        return; // not compressible
+
+    unsigned d_len = 0;
+    t = bench_time(
+        budget, [&] { d_len = u_len; },
+        [&] { r = upx_decompress(cbuf, c_len, dbuf, &d_len, m, &cresult); });
+    if (r != UPX_E_OK || d_len != u_len || memcmp(buf, dbuf, u_len) != 0)
+        throwInternalError("benchmark decompression failed");
+    report(name, "decompress", variant, u_len, c_len, t);
+
+    unsigned src_off = 0;
+    t = bench_time(
+        budget, [&] { d_len = u_len; },
+        [&] { r = upx_find_overlap(cbuf, c_len, &d_len, &src_off, m, &cresult); });
+    if (r == UPX_E_OK) // not all methods support it
+        report(name, "overlap", variant, u_len, c_len, t);
+}
+
+void Bench::runFilter(const char *name, const byte *buf, unsigned u_len, int id, byte *fbuf,
+                      byte *tbuf) {
+    // level 1 skips the adler32 checksum, so that only the filter itself is timed
+    Filter ft(1);
+    bool ok = false;
+    try {
+        ft.init(id, 0);
+        memcpy(fbuf, buf, u_len);
+        ok = ft.filter(fbuf, u_len);
+    } catch (const Exception &) {
+        ok = false;
+    }
+    if (!ok)
+        return; // filter not applicable to this buffer
+    memcpy(tbuf, fbuf, u_len); // keep the filtered data for unfilter
+
+    char variant[32];
+    snprintf(variant, sizeof(variant), "0x%02x", id);
+    BenchTime t = bench_time(
+        budget,
+        [&] {
+            ft.init(id, 0);
+            memcpy(fbuf, buf, u_len);
+        },
+        [&] { ok = ft.filter(fbuf, u_len); });
+    report(name, "filter", variant, u_len, 0, t);
+
+    // ft still holds the parameters (cto etc.) of the last filter() run
+    t = bench_time(
+        budget, [&] { memcpy(fbuf, tbuf, u_len); }, [&] { ft.unfilter(fbuf, u_len); });
+    if (memcmp(buf, fbuf, u_len) != 0)
+        throwInternalError("benchmark unfilter failed");
+    report(name, "unfilter", variant, u_len, 0, t);
+
+    t = bench_time(budget, [&] { ft.init(id, 0); }, [&] { ok = ft.scan(buf, u_len); });
+    report(name, "scan", variant, u_len, 0, t);
+}
+
+} // namespace
+
+/*************************************************************************
+// main entry
+**************************************************************************/
+
+static void bench_file(Bench &b, const char *iname) {
+    InputFile fi;
+    fi.sopen(iname, O_RDONLY | O_BINARY, -1);
+    const upx_off_t size = fi.st_size();
+    if (size <= 0)
+        throwIOException("empty file -- skipped");
+    if (!mem_size_valid_bytes(size))
+        throwIOException("file is too large -- skipped");
+    MemBuffer buf(size);
+    fi.readx(buf, (int) size);
+    fi.closex();
+    b.run(iname, buf, (unsigned) size);
+    MemBuffer::releasePool();
+}
+
+int do_benchmark(int i, int argc, char *argv[]) {
+    Bench b;
+    b.f = stdout;
+    b.json = opt->benchmark.json;
+    b.method = opt->method > 0 ? opt->method : 0;
+    b.level = opt->level > 0 ? opt->level : 0;
+    b.header();
+    for (; i < argc; i++) {
+        try {
+            bench_file(b, argv[i]);
+        } catch (const Exception &e) {
+            printErr(argv[i], &e);
+            main_set_exit_code(EXIT_ERROR);
+        }
+    }
+    b.footer();
+    return 0;
+}
+
+/*************************************************************************
+//
+**************************************************************************/
+
+TEST_CASE("Bench") {
+    const unsigned u_len = 16384;
+    MemBuffer mb(u_len);
+    for (unsigned i = 0; i < u_len; i++) // compressible, with some e8 calls
+        mb[i] = (i % 7 == 0) ? 0xe8 : (byte) (i / 64);
+    Bench b;
+    b.budget = 0;
+    b.level = 1;
+    CHECK_NOTHROW(b.run("test", mb, u_len));
+    // adler32 + 3 kernels per method + at least the sub8 filters
+    CHECK(b.results >= 1 + 3 * 3 + 3 * 4);
+}
+
+/* vim:set ts=4 sw=4 et: */
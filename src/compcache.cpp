@@ -0,0 +1,564 @@
+/* compcache.cpp -- on-disk cache of compression results
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2023 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2023 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+// "upx --cache-dir=DIR" keeps the winner of each compressWithFilters()
+// search in DIR: method, filter, cto, overlap_overhead and the compressed
+// data. The file name is a hash of everything that determines the search:
+// the input bytes, the methods and filters to try, the level, the
+// compression runtime parameters, the executable format and the UPX version.
+// Packing an identical input again just filters it, decompresses the
+// cached data and compares it with the filtered input. Only if that
+// matches is the cached result used; otherwise the full search runs.
+// Any problem with the cache is silently ignored.
+
+#include "conf.h"
+#include "file.h"
+#include "filter.h"
+#include "packer.h"
+#include "ui.h"
+#include "util/membuffer.h"
+
+#if !defined(SH_DENYWR)
+#define SH_DENYWR (-1)
+#endif
+
+/*************************************************************************
+// cache key
+**************************************************************************/
+
+namespace {
+// 64-bit FNV-1a, fed with little endian words
+struct CacheHasher final {
+    upx_uint64_t h = 0xcbf29ce484222325ull;
+
+    void add64(upx_uint64_t v) {
+        h ^= v;
+        h *= 0x100000001b3ull;
+    }
+    void add32(unsigned v) { add64(v); }
+    void add(const void *buf, unsigned len) {
+        const byte *p = (const byte *) buf;
+        add32(len);
+        for (; len >= 8; p += 8, len -= 8)
+            add64(get_le64(p));
+        for (; len > 0; p++, len--)
+            add64(*p);
+    }
+    void add(const char *s) { add(s, (unsigned) strlen(s)); }
+
+    // field by field, as padding bytes are undefined
+    template <class T>
+    void addOpt(const T &v) {
+        add32(v.is_set);
+        add32(v.v);
+    }
+    void add(const lzma_compress_config_t &c) {
+        addOpt(c.pos_bits);
+        addOpt(c.lit_pos_bits);
+        addOpt(c.lit_context_bits);
+        addOpt(c.dict_size);
+        add32(c.fast_mode);
+        addOpt(c.num_fast_bytes);
+        add32(c.match_finder_cycles);
+        add32(c.max_num_probs);
+    }
+    void add(const ucl_compress_config_t &c) {
+        add32(c.bb_endian);
+        add32(c.bb_size);
+        add32(c.max_offset);
+        add32(c.max_match);
+        add32(c.s_level);
+        add32(c.h_level);
+        add32(c.p_level);
+        add32(c.c_flags);
+        add32(c.m_size);
+    }
+    void add(const zlib_compress_config_t &c) {
+        addOpt(c.mem_level);
+        addOpt(c.window_bits);
+        addOpt(c.strategy);
+    }
+};
+} // namespace
+
+void Packer::getCacheKey(CacheKey *key, const byte *i_ptr, unsigned i_len, unsigned f_off,
+                         unsigned f_len, const byte *hdr_ptr, unsigned hdr_len,
+                         const Filter *parm_ft, unsigned overlap_range,
+                         const upx_compress_config_t *cconf, const int *methods, int nmethods,
+                         const int *filters, int nfilters, int filter_strategy) const {
+    CacheHasher hp;
+    hp.add(UPX_VERSION_STRING);
+    hp.add32(getFormat());
+    hp.add32(getVersion());
+    hp.add32(ph.level);
+    hp.add32(opt->small);
+    hp.add(opt->crp.crp_lzma);
+    hp.add(opt->crp.crp_ucl);
+    hp.add(opt->crp.crp_zlib);
+    hp.add32(cconf != nullptr);
+    if (cconf != nullptr) {
+        hp.add(cconf->conf_lzma);
+        hp.add(cconf->conf_ucl);
+        hp.add(cconf->conf_zlib);
+        hp.add32(cconf->max_c_len);
+    }
+    hp.add(methods, sizeof(methods[0]) * nmethods);
+    hp.add(filters, sizeof(filters[0]) * nfilters);
+    hp.add32(filter_strategy);
+    hp.add32(parm_ft->addvalue);
+    hp.add32(overlap_range);
+    hp.add32(f_off);
+    hp.add32(f_len);
+    hp.add(hdr_ptr, hdr_ptr ? hdr_len : 0);
+    hp.add(i_ptr, i_len);
+    key->h[0] = hp.h;
+    key->h[1] = ((upx_uint64_t) i_len << 32) | upx_adler32(i_ptr, i_len);
+}
+
+static bool getCacheFileName(char *fn, size_t fn_size, const Packer::CacheKey &key) {
+    const char *dir = opt->cache_dir;
+    if (dir == nullptr || !dir[0] || strlen(dir) + 40 >= fn_size)
+        return false;
+    snprintf(fn, fn_size, "%s/%016llx%016llx.upx", dir, (unsigned long long) key.h[0],
+             (unsigned long long) key.h[1]);
+    return true;
+}
+
+/*************************************************************************
+// cache record
+//   "UPXCACHE", LE32 version, LE64 key[2]
+//   LE32 u_len, c_len, method, filter, filter_cto, overlap_overhead,
+//        max_offset_found, max_match_found, max_run_found,
+//        first_offset_found, adler32 of the compressed data
+//   LE32 compress_result: debug (4), result_lzma (8), result_ucl (16)
+//   compressed data
+**************************************************************************/
+
+namespace {
+struct CacheRecord final {
+    enum { VERSION = 1, NFIELDS = 11, NRESULTS = 4 + 8 + 16 };
+    enum { HEADER_SIZE = 8 + 4 + 16 + 4 * (NFIELDS + NRESULTS) };
+
+    unsigned u_len = 0;
+    unsigned c_len = 0;
+    unsigned method = 0;
+    unsigned filter = 0;
+    unsigned filter_cto = 0;
+    unsigned overlap_overhead = 0;
+    unsigned max_offset_found = 0;
+    unsigned max_match_found = 0;
+    unsigned max_run_found = 0;
+    unsigned first_offset_found = 0;
+    upx_compress_result_t compress_result;
+
+    CacheRecord() { compress_result.reset(); }
+
+    explicit CacheRecord(const PackHeader &ph)
+        : u_len(ph.u_len), c_len(ph.c_len), method(ph.method), filter(ph.filter),
+          filter_cto(ph.filter_cto), overlap_overhead(ph.overlap_overhead),
+          max_offset_found(ph.max_offset_found), max_match_found(ph.max_match_found),
+          max_run_found(ph.max_run_found), first_offset_found(ph.first_offset_found),
+          compress_result(ph.compress_result) {}
+
+    // the fields of a compress() result, see ph_rechain()
+    void toPackHeader(PackHeader &xph) const {
+        xph.u_len = u_len;
+        xph.c_len = c_len;
+        xph.method = method;
+        xph.filter = filter;
+        xph.filter_cto = filter_cto;
+        xph.overlap_overhead = overlap_overhead;
+        xph.max_offset_found = max_offset_found;
+        xph.max_match_found = max_match_found;
+        xph.max_run_found = max_run_found;
+        xph.first_offset_found = first_offset_found;
+        xph.compress_result = compress_result;
+    }
+
+    void encode(byte *p, const Packer::CacheKey &key, const byte *data) const {
+        memcpy(p, "UPXCACHE", 8);
+        set_le32(p + 8, VERSION);
+        set_le64(p + 12, key.h[0]);
+        set_le64(p + 20, key.h[1]);
+        p += 28;
+        const upx_compress_result_t &cr = compress_result;
+        const lzma_compress_result_t &lz = cr.result_lzma;
+        const unsigned fields[NFIELDS + 12] = {u_len,
+                                               c_len,
+                                               method,
+                                               filter,
+                                               filter_cto,
+                                               overlap_overhead,
+                                               max_offset_found,
+                                               max_match_found,
+                                               max_run_found,
+                                               first_offset_found,
+                                               upx_adler32(data, c_len),
+                                               (unsigned) cr.debug.method,
+                                               (unsigned) cr.debug.level,
+                                               cr.debug.u_len,
+                                               cr.debug.c_len,
+                                               lz.pos_bits,
+                                               lz.lit_pos_bits,
+                                               lz.lit_context_bits,
+                                               lz.dict_size,
+                                               lz.fast_mode,
+                                               lz.num_fast_bytes,
+                                               lz.match_finder_cycles,
+                                               lz.num_probs};
+        for (unsigned i = 0; i < NFIELDS + 12; i++, p += 4)
+            set_le32(p, fields[i]);
+        for (unsigned i = 0; i < 16; i++, p += 4)
+            set_le32(p, (unsigned) cr.result_ucl.result[i]);
+        memcpy(p, data, c_len);
+    }
+
+    // check a record of size "len"; returns the compressed data, or
+    // nullptr if the record is damaged or does not match
+    const byte *decode(const byte *p, upx_uint64_t len, const Packer::CacheKey &key,
+                       unsigned want_u_len) {
+        if (len < HEADER_SIZE || memcmp(p, "UPXCACHE", 8) != 0 || get_le32(p + 8) != VERSION ||
+            get_le64(p + 12) != key.h[0] || get_le64(p + 20) != key.h[1])
+            return nullptr;
+        p += 28;
+        u_len = get_le32(p);
+        c_len = get_le32(p + 4);
+        if (u_len != want_u_len || c_len == 0 || c_len >= u_len || len != HEADER_SIZE + c_len)
+            return nullptr;
+        const byte *const data = p + 4 * (NFIELDS + NRESULTS);
+        if (upx_adler32(data, c_len) != get_le32(p + 40))
+            return nullptr;
+        method = get_le32(p + 8);
+        filter = get_le32(p + 12);
+        filter_cto = get_le32(p + 16);
+        overlap_overhead = get_le32(p + 20);
+        max_offset_found = get_le32(p + 24);
+        max_match_found = get_le32(p + 28);
+        max_run_found = get_le32(p + 32);
+        first_offset_found = get_le32(p + 36);
+        p += 4 * NFIELDS;
+        upx_compress_result_t &cr = compress_result;
+        lzma_compress_result_t &lz = cr.result_lzma;
+        cr.reset();
+        cr.debug.method = get_le32(p);
+        cr.debug.level = get_le32(p + 4);
+        cr.debug.u_len = get_le32(p + 8);
+        cr.debug.c_len = get_le32(p + 12);
+        lz.pos_bits = get_le32(p + 16);
+        lz.lit_pos_bits = get_le32(p + 20);
+        lz.lit_context_bits = get_le32(p + 24);
+        lz.dict_size = get_le32(p + 28);
+        lz.fast_mode = get_le32(p + 32);
+        lz.num_fast_bytes = get_le32(p + 36);
+        lz.match_finder_cycles = get_le32(p + 40);
+        lz.num_probs = get_le32(p + 44);
+        for (unsigned i = 0; i < 16; i++)
+            cr.result_ucl.result[i] = get_le32(p + 48 + 4 * i);
+        return data;
+    }
+};
+} // namespace
+
+/*************************************************************************
+// lookup and store
+**************************************************************************/
+
+// quick check for runFilterTrials(); may get called from multiple threads
+bool Packer::probeCache(const CacheKey &key) const {
+    char fn[ACC_FN_PATH_MAX + 1];
+    if (!getCacheFileName(fn, sizeof(fn), key))
+        return false;
+    try {
+        InputFile f;
+        f.sopen(fn, O_RDONLY | O_BINARY, SH_DENYWR);
+        byte buf[CacheRecord::HEADER_SIZE];
+        if (f.st_size() <= CacheRecord::HEADER_SIZE || f.read(buf, sizeof(buf)) != sizeof(buf))
+            return false;
+        return memcmp(buf, "UPXCACHE", 8) == 0 && get_le64(buf + 12) == key.h[0] &&
+               get_le64(buf + 20) == key.h[1];
+    } catch (const Exception &) {
+        return false;
+    }
+}
+
+// On success this->ph, o_ptr[] and *parm_ft are set up as if
+// compressWithFilters() had found the cached result, and i_ptr[] is
+// unchanged; otherwise nothing is changed.
+bool Packer::loadFromCache(const CacheKey &key, byte *i_ptr, unsigned i_len, byte *o_ptr,
+                           byte *f_ptr, unsigned f_len, Filter *parm_ft) {
+    char fn[ACC_FN_PATH_MAX + 1];
+    if (!getCacheFileName(fn, sizeof(fn), key))
+        return false;
+    MemBuffer buf;
+    CacheRecord rec;
+    const byte *data = nullptr;
+    try {
+        InputFile f;
+        f.sopen(fn, O_RDONLY | O_BINARY, SH_DENYWR);
+        const upx_off_t len = f.st_size();
+        if (len <= CacheRecord::HEADER_SIZE || len > CacheRecord::HEADER_SIZE + upx_off_t(i_len))
+            return false;
+        buf.alloc((unsigned) len);
+        f.readx(buf, (int) len);
+        data = rec.decode(buf, len, key, i_len);
+    } catch (const Exception &) {
+        return false;
+    }
+    if (data == nullptr || !isValidCompressionMethod(forced_method(rec.method)) ||
+        !isValidFilter(rec.filter))
+        return false;
+
+    // filter exactly like compressWithFilters()
+    Filter ft = *parm_ft;
+    ft.init(rec.filter, parm_ft->addvalue);
+    optimizeFilter(&ft, f_ptr, f_len);
+    if (!ft.filter(f_ptr, f_len))
+        return false;
+    bool ok = (ft.id == 0 || ft.calls != 0) && ft.cto == rec.filter_cto;
+    if (ok) {
+        // verify the cached data
+        MemBuffer u_buf(i_len);
+        unsigned new_len = i_len;
+        try {
+            UiStats::Scope timer(uip->stats, UiStats::PH_VERIFY, i_len);
+            int r = upx_decompress(data, rec.c_len, u_buf, &new_len, forced_method(rec.method),
+                                   &rec.compress_result);
+            ok = (r == UPX_E_OK && new_len == i_len && memcmp(u_buf, i_ptr, i_len) == 0);
+        } catch (const Exception &) {
+            ok = false;
+        }
+    }
+    ok = ok && rec.overlap_overhead != 0 && rec.overlap_overhead <= i_len;
+    if (ok) {
+        memcpy(o_ptr, data, rec.c_len);
+        const PackHeader orig_ph = ph;
+        PackHeader xph = ph;
+        rec.toPackHeader(xph);
+        ph.method = xph.method;
+        ph.filter = xph.filter;
+        ph.filter_cto = ft.cto;
+        ph.n_mru = ft.n_mru;
+        ph.overlap_overhead = xph.overlap_overhead;
+        ph_rechain(ph, xph, true, i_ptr, o_ptr);
+        // do not trust the cached overlap_overhead; i_ptr[] is filtered
+        UiStats::Scope timer(uip->stats, UiStats::PH_OVERLAP, i_len);
+        ok = testOverlappingDecompression(o_ptr, i_ptr, ph.overlap_overhead);
+        if (!ok)
+            ph = orig_ph;
+    }
+    // unfilter with verify
+    ft.unfilter(f_ptr, f_len, true);
+    if (ok)
+        *parm_ft = ft;
+    return ok;
+}
+
+// this->ph and o_ptr[] hold the result of compressWithFilters()
+void Packer::storeInCache(const CacheKey &key, const byte *o_ptr) const {
+    char fn[ACC_FN_PATH_MAX + 1];
+    char tn[ACC_FN_PATH_MAX + 1];
+    if (!getCacheFileName(fn, sizeof(fn), key) || ph.c_len == 0 || ph.c_len >= ph.u_len)
+        return;
+    snprintf(tn, sizeof(tn), "%s.tmp", fn);
+    MemBuffer rec(CacheRecord::HEADER_SIZE + ph.c_len);
+    CacheRecord(ph).encode(rec, key, o_ptr);
+    // write a temporary file, then rename it so that readers never see a
+    // partial record; several upx processes may share the cache
+    bool created = false;
+    try {
+        OutputFile fo;
+        fo.sopen(tn, O_CREAT | O_EXCL | O_WRONLY | O_BINARY, SH_DENYWR, 0666);
+        created = true;
+        fo.write(rec, rec.getSize());
+        fo.closex();
+        FileBase::rename(tn, fn);
+    } catch (const Exception &) {
+        if (created)
+            (void) ::unlink(tn);
+    }
+}
+
+/*************************************************************************
+//
+**************************************************************************/
+
+TEST_CASE("CacheHasher") {
+    // the padding bytes must not matter
+    upx_compress_config_t a, b;
+    memset((void *) &a, 0, sizeof(a));
+    memset((void *) &b, 0xff, sizeof(b));
+    a.reset();
+    b.reset();
+    CacheHasher ha, hb;
+    ha.add(a.conf_lzma);
+    ha.add(a.conf_ucl);
+    ha.add(a.conf_zlib);
+    hb.add(b.conf_lzma);
+    hb.add(b.conf_ucl);
+    hb.add(b.conf_zlib);
+    CHECK(ha.h == hb.h);
+    b.conf_lzma.dict_size = 1u << 20;
+    CacheHasher hc;
+    hc.add(b.conf_lzma);
+    hc.add(b.conf_ucl);
+    hc.add(b.conf_zlib);
+    CHECK(ha.h != hc.h);
+}
+
+TEST_CASE("CacheRecord") {
+    Packer::CacheKey key;
+    key.h[0] = 0x0123456789abcdefull;
+    key.h[1] = 0xfedcba9876543210ull;
+    static const byte data[7] = {1, 2, 3, 4, 5, 6, 7};
+    CacheRecord x;
+    x.u_len = 100;
+    x.c_len = 7;
+    x.method = M_LZMA;
+    x.filter = 0x49;
+    x.filter_cto = 0x2a;
+    x.overlap_overhead = 123;
+    x.compress_result.result_lzma.lit_context_bits = 3;
+    x.compress_result.result_ucl.result[15] = 42;
+    MemBuffer rec(CacheRecord::HEADER_SIZE + 7);
+    x.encode(rec, key, data);
+
+    CacheRecord y;
+    const byte *p = y.decode(rec, rec.getSize(), key, 100);
+    CHECK((p != nullptr && memcmp(p, data, 7) == 0));
+    CHECK(y.c_len == 7);
+    CHECK(y.method == M_LZMA);
+    CHECK(y.filter == 0x49);
+    CHECK(y.filter_cto == 0x2a);
+    CHECK(y.overlap_overhead == 123);
+    CHECK(y.compress_result.result_lzma.lit_context_bits == 3);
+    CHECK(y.compress_result.result_ucl.result[15] == 42);
+    // wrong u_len, wrong key, truncated, corrupted
+    CHECK(y.decode(rec, rec.getSize(), key, 99) == nullptr);
+    Packer::CacheKey key2 = key;
+    key2.h[1] ^= 1;
+    CHECK(y.decode(rec, rec.getSize(), key2, 100) == nullptr);
+    CHECK(y.decode(rec, rec.getSize() - 1, key, 100) == nullptr);
+    rec[CacheRecord::HEADER_SIZE + 3] ^= 1;
+    CHECK(y.decode(rec, rec.getSize(), key, 100) == nullptr);
+}
+
+namespace {
+// just enough of a packer for compressWithFilters(); the loader is faked
+class TestCachePacker final : public Packer {
+public:
+    TestCachePacker() : Packer(nullptr) {
+        ph.method = M_NRV2B_LE32;
+        ph.level = 1;
+    }
+    virtual int getVersion() const override { return 13; }
+    virtual int getFormat() const override { return UPX_F_LINUX_ELF_i386; }
+    virtual const char *getName() const override { return "test"; }
+    virtual const char *getFullName(const Options *) const override { return "test"; }
+    virtual const int *getCompressionMethods(int, int) const override { return nullptr; }
+    virtual const int *getFilters() const override { return nullptr; }
+    virtual void pack(OutputFile *) override {}
+    virtual void unpack(OutputFile *) override {}
+    virtual bool canPack() override { return false; }
+    virtual int canUnpack() override { return false; }
+    virtual int getLoaderSize() const override { return 1024; }
+
+    // compress the first block of an extent with its header, as
+    // PackUnix::packExtent() does; returns the key of the cache record
+    CacheKey store(byte *buf, unsigned len, byte *hdr, unsigned hdr_len) {
+        MemBuffer o_buf;
+        o_buf.allocForCompression(len);
+        Filter ft(ph.level);
+        ft.addvalue = 0;
+        const Filter orig_ft = ft;
+        initHeader(len);
+        compressWithFilters(buf, len, o_buf, buf, len, hdr, hdr_len, &ft, 512, nullptr, 0, true);
+        // the search of compressWithFilters(): one method, no filter
+        int methods[1];
+        const int nmethods = prepareMethods(methods, ph.method, nullptr);
+        static const int filters[1] = {0};
+        CacheKey key;
+        getCacheKey(&key, buf, len, 0, len, hdr, hdr_len, &orig_ft, 512, nullptr, methods,
+                    nmethods, filters, 1, -1);
+        return key;
+    }
+    bool stored(const CacheKey &key) const { return probeCache(key); }
+    // the quick check of the block pipeline for the same block
+    bool probe(const byte *buf, unsigned len, const byte *hdr, unsigned hdr_len) {
+        FilterTrials fts;
+        initHeader(len);
+        fts.ph = ph;
+        Filter ft(ph.level);
+        ft.addvalue = 0;
+        ft.buf_len = len;
+        runFilterTrials(&fts, buf, len, 0, hdr, hdr_len, &ft, 512, nullptr, 0);
+        if (fts.exc)
+            std::rethrow_exception(fts.exc);
+        return fts.cached;
+    }
+
+protected:
+    virtual Linker *newLinker() const override { return nullptr; }
+    virtual void buildLoader(const Filter *) override {}
+
+    void initHeader(unsigned len) {
+        ph.u_len = ph.c_len = len;
+        ph.u_adler = ph.c_adler = 0;
+        ph.filter = ph.filter_cto = 0;
+        ph.overlap_overhead = 0;
+    }
+};
+} // namespace
+
+TEST_CASE("Packer::probeCache") {
+    // the block pipeline must find a first block which was stored together
+    // with its header by compressWithFilters()
+    Options *const saved_opt = opt;
+    Options local_options;
+    opt = &local_options;
+    opt->reset();
+    opt->verbose = 0;
+    opt->cache_dir = ".";
+    const unsigned len = 65536;
+    const unsigned hdr_len = 256;
+    MemBuffer buf(len);
+    MemBuffer hdr(hdr_len);
+    for (unsigned i = 0; i < len; i++)
+        buf[i] = (byte) "0123456789abcdef"[(i ^ (i >> 9)) & 15];
+    for (unsigned i = 0; i < hdr_len; i++)
+        hdr[i] = (byte) (i & 7);
+    TestCachePacker p;
+    const Packer::CacheKey key = p.store(buf, len, hdr, hdr_len);
+    CHECK(p.stored(key));
+    CHECK(p.probe(buf, len, hdr, hdr_len));
+    CHECK(!p.probe(buf, len, nullptr, 0));
+    char fn[ACC_FN_PATH_MAX + 1];
+    if (getCacheFileName(fn, sizeof(fn), key))
+        (void) ::unlink(fn);
+    opt = saved_opt;
+}
+
+/* vim:set ts=4 sw=4 et: */
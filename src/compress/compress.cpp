@@ -29,13 +29,185 @@
 #include "../util/membuffer.h"
 
 /*************************************************************************
+// adler32
 //
+// The SIMD versions process 32-byte blocks in chunks of at most NMAX
+// bytes, so that the 32-bit lane sums cannot overflow; the remaining
+// tail bytes are handled by the scalar UCL version. The results are
+// identical to upx_ucl_adler32().
 **************************************************************************/
 
+#if (ACC_ARCH_AMD64) || (ACC_ARCH_I386 && defined(__SSE2__))
+#define WITH_ADLER32_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__) && !(ACC_CC_MSC)
+// needs a runtime check of the cpu
+#define WITH_ADLER32_AVX2 1
+#include <immintrin.h>
+#endif
+#elif (ACC_ARCH_ARM64) && defined(__ARM_NEON)
+#define WITH_ADLER32_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if (WITH_ADLER32_SSE2 || WITH_ADLER32_NEON)
+#define ADLER32_BASE 65521u // largest prime smaller than 65536
+#define ADLER32_NMAX 5552u  // largest n such that 255n(n+1)/2 + (n+1)(BASE-1) <= 2^32-1
+#endif
+
+#if (WITH_ADLER32_SSE2)
+static unsigned adler32_sse2(const byte *buf, unsigned len, unsigned adler) {
+    unsigned s1 = adler & 0xffff;
+    unsigned s2 = adler >> 16;
+    unsigned blocks = len / 32;
+    len -= blocks * 32;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i tap1 = _mm_setr_epi16(32, 31, 30, 29, 28, 27, 26, 25);
+    const __m128i tap2 = _mm_setr_epi16(24, 23, 22, 21, 20, 19, 18, 17);
+    const __m128i tap3 = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+    const __m128i tap4 = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+    while (blocks) {
+        unsigned n = UPX_MIN(blocks, ADLER32_NMAX / 32);
+        blocks -= n;
+        __m128i v_ps = _mm_cvtsi32_si128((int) (s1 * n));
+        __m128i v_s1 = zero;
+        __m128i v_s2 = _mm_cvtsi32_si128((int) s2);
+        do {
+            const __m128i b1 = _mm_loadu_si128((const __m128i *) (const void *) buf);
+            const __m128i b2 = _mm_loadu_si128((const __m128i *) (const void *) (buf + 16));
+            v_ps = _mm_add_epi32(v_ps, v_s1);
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(b1, zero));
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(b2, zero));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpacklo_epi8(b1, zero), tap1));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpackhi_epi8(b1, zero), tap2));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpacklo_epi8(b2, zero), tap3));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpackhi_epi8(b2, zero), tap4));
+            buf += 32;
+        } while (--n);
+        v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+        // horizontal sums
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(1, 0, 3, 2)));
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(2, 3, 0, 1)));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(1, 0, 3, 2)));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(2, 3, 0, 1)));
+        s1 = (s1 + (unsigned) _mm_cvtsi128_si32(v_s1)) % ADLER32_BASE;
+        s2 = (unsigned) _mm_cvtsi128_si32(v_s2) % ADLER32_BASE;
+    }
+    adler = s1 | (s2 << 16);
+    return len ? upx_ucl_adler32(buf, len, adler) : adler;
+}
+#endif
+
+#if (WITH_ADLER32_AVX2)
+__attribute__((__target__("avx2"))) static unsigned adler32_avx2(const byte *buf, unsigned len,
+                                                                 unsigned adler) {
+    unsigned s1 = adler & 0xffff;
+    unsigned s2 = adler >> 16;
+    unsigned blocks = len / 32;
+    len -= blocks * 32;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i tap = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19,
+                                         18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+                                         2, 1);
+    while (blocks) {
+        unsigned n = UPX_MIN(blocks, ADLER32_NMAX / 32);
+        blocks -= n;
+        __m256i v_ps = _mm256_setr_epi32((int) (s1 * n), 0, 0, 0, 0, 0, 0, 0);
+        __m256i v_s1 = zero;
+        __m256i v_s2 = _mm256_setr_epi32((int) s2, 0, 0, 0, 0, 0, 0, 0);
+        do {
+            const __m256i b = _mm256_loadu_si256((const __m256i *) (const void *) buf);
+            v_ps = _mm256_add_epi32(v_ps, v_s1);
+            v_s1 = _mm256_add_epi32(v_s1, _mm256_sad_epu8(b, zero));
+            // the products are at most 255 * (32 + 31), so maddubs cannot saturate
+            v_s2 = _mm256_add_epi32(v_s2, _mm256_madd_epi16(_mm256_maddubs_epi16(b, tap), ones));
+            buf += 32;
+        } while (--n);
+        v_s2 = _mm256_add_epi32(v_s2, _mm256_slli_epi32(v_ps, 5));
+        // horizontal sums
+        __m128i h1 = _mm_add_epi32(_mm256_castsi256_si128(v_s1), _mm256_extracti128_si256(v_s1, 1));
+        __m128i h2 = _mm_add_epi32(_mm256_castsi256_si128(v_s2), _mm256_extracti128_si256(v_s2, 1));
+        h1 = _mm_add_epi32(h1, _mm_shuffle_epi32(h1, _MM_SHUFFLE(1, 0, 3, 2)));
+        h1 = _mm_add_epi32(h1, _mm_shuffle_epi32(h1, _MM_SHUFFLE(2, 3, 0, 1)));
+        h2 = _mm_add_epi32(h2, _mm_shuffle_epi32(h2, _MM_SHUFFLE(1, 0, 3, 2)));
+        h2 = _mm_add_epi32(h2, _mm_shuffle_epi32(h2, _MM_SHUFFLE(2, 3, 0, 1)));
+        s1 = (s1 + (unsigned) _mm_cvtsi128_si32(h1)) % ADLER32_BASE;
+        s2 = (unsigned) _mm_cvtsi128_si32(h2) % ADLER32_BASE;
+    }
+    adler = s1 | (s2 << 16);
+    return len ? upx_ucl_adler32(buf, len, adler) : adler;
+}
+#endif
+
+#if (WITH_ADLER32_NEON)
+static unsigned adler32_neon(const byte *buf, unsigned len, unsigned adler) {
+    static const upx_uint16_t taps[32] = {32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22,
+                                          21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+                                          10, 9,  8,  7,  6,  5,  4,  3,  2,  1};
+    unsigned s1 = adler & 0xffff;
+    unsigned s2 = adler >> 16;
+    unsigned blocks = len / 32;
+    len -= blocks * 32;
+    while (blocks) {
+        unsigned n = UPX_MIN(blocks, ADLER32_NMAX / 32);
+        blocks -= n;
+        uint32x4_t v_s2 = vsetq_lane_u32(s1 * n, vdupq_n_u32(0), 0);
+        uint32x4_t v_s1 = vdupq_n_u32(0);
+        // per-column byte sums; n * 255 fits into 16 bits
+        uint16x8_t col1 = vdupq_n_u16(0), col2 = col1, col3 = col1, col4 = col1;
+        do {
+            const uint8x16_t b1 = vld1q_u8(buf);
+            const uint8x16_t b2 = vld1q_u8(buf + 16);
+            v_s2 = vaddq_u32(v_s2, v_s1);
+            v_s1 = vpadalq_u16(v_s1, vpadalq_u8(vpaddlq_u8(b1), b2));
+            col1 = vaddw_u8(col1, vget_low_u8(b1));
+            col2 = vaddw_u8(col2, vget_high_u8(b1));
+            col3 = vaddw_u8(col3, vget_low_u8(b2));
+            col4 = vaddw_u8(col4, vget_high_u8(b2));
+            buf += 32;
+        } while (--n);
+        v_s2 = vshlq_n_u32(v_s2, 5);
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col1), vld1_u16(taps + 0));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col1), vld1_u16(taps + 4));
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col2), vld1_u16(taps + 8));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col2), vld1_u16(taps + 12));
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col3), vld1_u16(taps + 16));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col3), vld1_u16(taps + 20));
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col4), vld1_u16(taps + 24));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col4), vld1_u16(taps + 28));
+        s1 = (s1 + vaddvq_u32(v_s1)) % ADLER32_BASE;
+        s2 = (s2 + vaddvq_u32(v_s2)) % ADLER32_BASE;
+    }
+    adler = s1 | (s2 << 16);
+    return len ? upx_ucl_adler32(buf, len, adler) : adler;
+}
+#endif
+
+typedef unsigned (*adler32_func_t)(const byte *, unsigned, unsigned);
+
+static adler32_func_t adler32_select() noexcept {
+#if (WITH_ADLER32_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return adler32_avx2;
+#endif
+#if (WITH_ADLER32_SSE2)
+    return adler32_sse2;
+#elif (WITH_ADLER32_NEON)
+    return adler32_neon;
+#else
+    return nullptr;
+#endif
+}
+
 unsigned upx_adler32(const void *buf, unsigned len, unsigned adler) {
     if (len == 0)
         return adler;
     assert(buf != nullptr);
+    static const adler32_func_t simd_adler32 = adler32_select();
+    if (simd_adler32 != nullptr && len >= 64)
+        return simd_adler32((const byte *) buf, len, adler);
 #if 1
     return upx_ucl_adler32(buf, len, adler);
 #else
@@ -43,6 +215,27 @@ unsigned upx_adler32(const void *buf, unsigned len, unsigned adler) {
 #endif
 }
 
+// Return the adler32 of the concatenation of two buffers, given
+// adler1 of the first one and adler2 (started from 1) of the second one
+// with length len2. Same as adler32_combine() in zlib.
+unsigned upx_adler32_combine(unsigned adler1, unsigned adler2, unsigned len2) {
+    const unsigned base = 65521u;
+    const unsigned rem = len2 % base;
+    unsigned s1 = adler1 & 0xffff;
+    unsigned s2 = (rem * s1) % base; // cannot overflow: base * base < 2^32
+    s1 += (adler2 & 0xffff) + base - 1;
+    s2 += (adler1 >> 16) + (adler2 >> 16) + base - rem;
+    if (s1 >= base)
+        s1 -= base;
+    if (s1 >= base)
+        s1 -= base;
+    if (s2 >= 2 * base)
+        s2 -= 2 * base;
+    if (s2 >= base)
+        s2 -= base;
+    return (s2 << 16) | s1;
+}
+
 #if 0 // UNUSED
 unsigned upx_crc32(const void *buf, unsigned len, unsigned crc)
 {
@@ -205,4 +398,119 @@ int upx_test_overlap(const upx_bytep buf, const upx_bytep tbuf, unsigned src_off
     return r;
 }
 
+/*************************************************************************
+// single-pass overlap analysis: decode once and compute the smallest
+// src_off for an in-place decompression; see Packer::findOverlapOverhead()
+**************************************************************************/
+
+int upx_find_overlap(const upx_bytep src, unsigned src_len, unsigned *dst_len, unsigned *src_off,
+                     int method, const upx_compress_result_t *cresult) {
+    int r = UPX_E_ERROR; // not supported - caller must fall back to upx_test_overlap()
+
+    if (cresult && cresult->debug.method == 0)
+        cresult = nullptr;
+
+    assert(*dst_len > 0);
+    *src_off = 0;
+
+    if (__acc_cte(false)) {
+    }
+#if (WITH_LZMA)
+    else if (M_IS_LZMA(method))
+        r = upx_lzma_find_overlap(src, src_len, dst_len, src_off, method, cresult);
+#endif
+#if (WITH_UCL)
+    // NRV and UCL share the same bitstream format
+    else if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method))
+        r = upx_ucl_find_overlap(src, src_len, dst_len, src_off, method, cresult);
+#endif
+
+    return r;
+}
+
+/*************************************************************************
+//
+**************************************************************************/
+
+TEST_CASE("upx_adler32") {
+    MemBuffer mb(3 * 5552 + 100);
+    byte *const b = mb;
+    for (unsigned i = 0; i < mb.getSize(); i++)
+        b[i] = (byte) (i * 7 + (i >> 5));
+    for (unsigned len = 60; len < 140; len++)
+        for (unsigned off = 0; off < 4; off++)
+            CHECK(upx_adler32(b + off, len, 1) == upx_ucl_adler32(b + off, len, 1));
+    const unsigned n = mb.getSize() - 8;
+    CHECK(upx_adler32(b + 3, n, 1) == upx_ucl_adler32(b + 3, n, 1));
+    CHECK(upx_adler32(b, n, 0xfff0fff0) == upx_ucl_adler32(b, n, 0xfff0fff0));
+    memset(b, 0xff, mb.getSize()); // maximum lane sums
+    CHECK(upx_adler32(b, n, 0xfff0fff0) == upx_ucl_adler32(b, n, 0xfff0fff0));
+}
+
+TEST_CASE("upx_adler32_combine") {
+    byte b[1000];
+    for (unsigned i = 0; i < sizeof(b); i++)
+        b[i] = (byte) (i * 13 + (i >> 3));
+    for (unsigned len1 = 0; len1 <= sizeof(b); len1 += 111) {
+        const unsigned a1 = upx_adler32(b, len1);
+        const unsigned a2 = upx_adler32(b + len1, sizeof(b) - len1);
+        CHECK(upx_adler32_combine(a1, a2, sizeof(b) - len1) == upx_adler32(b, sizeof(b)));
+    }
+    memset(b, 0xff, sizeof(b));
+    const unsigned a = upx_adler32(b, 500);
+    CHECK(upx_adler32_combine(a, a, 500) == upx_adler32(b, 1000));
+}
+
+TEST_CASE("upx_compress max_c_len") {
+    // a --brute search with the best size so far as the output budget of
+    // each further candidate must find the same result as a full search
+    constexpr unsigned u_len = 32768;
+    MemBuffer u_buf(u_len);
+    for (unsigned i = 0; i < u_len; i++)
+        u_buf[i] = (byte) ((i % 251 < 60) ? i * 7 : (i >> 4) ^ (i % 13));
+    static const int methods[] = {
+#if (WITH_UCL) && !(WITH_NRV)
+        M_NRV2B_LE32, M_NRV2D_LE32, M_NRV2E_LE32,
+#endif
+#if (WITH_LZMA)
+        M_LZMA,
+#endif
+        0};
+    const unsigned o_size = MemBuffer::getSizeForCompression(u_len);
+    MemBuffer full(o_size), trial(o_size), best_full(o_size), best_trial(o_size);
+    unsigned best_full_len = 0, best_trial_len = 0;
+    int best_full_method = 0, best_trial_method = 0;
+    upx_compress_config_t cconf;
+    cconf.reset();
+    for (const int *m = methods; *m != 0; m++) {
+        unsigned c_len = o_size;
+        cconf.max_c_len = 0;
+        CHECK(upx_compress(u_buf, u_len, full, &c_len, nullptr, *m, 10, &cconf, nullptr) ==
+              UPX_E_OK);
+        unsigned t_len = o_size;
+        cconf.max_c_len = best_trial_len;
+        const int r = upx_compress(u_buf, u_len, trial, &t_len, nullptr, *m, 10, &cconf, nullptr);
+        if (best_trial_len != 0 && c_len > best_trial_len) {
+            CHECK(r == UPX_E_NOT_COMPRESSIBLE);
+        } else {
+            CHECK(r == UPX_E_OK);
+            CHECK(t_len == c_len);
+            CHECK(memcmp(trial, full, c_len) == 0);
+        }
+        if (best_full_len == 0 || c_len < best_full_len) {
+            best_full_len = c_len;
+            best_full_method = *m;
+            memcpy(best_full, full, c_len);
+        }
+        if (r == UPX_E_OK && (best_trial_len == 0 || t_len < best_trial_len)) {
+            best_trial_len = t_len;
+            best_trial_method = *m;
+            memcpy(best_trial, trial, t_len);
+        }
+    }
+    CHECK(best_trial_method == best_full_method);
+    CHECK(best_trial_len == best_full_len);
+    CHECK(memcmp(best_trial, best_full, best_full_len) == 0);
+}
+
 /* vim:set ts=4 sw=4 et: */
@@ -73,6 +73,10 @@ int upx_lzma_test_overlap  ( const upx_bytep buf,
                                    unsigned* dst_len,
                                    int method,
                              const upx_compress_result_t *cresult );
+int upx_lzma_find_overlap  ( const upx_bytep src, unsigned  src_len,
+                                   unsigned* dst_len, unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult );
 #endif
 
 
@@ -117,6 +121,10 @@ int upx_ucl_test_overlap   ( const upx_bytep buf,
                                    unsigned* dst_len,
                                    int method,
                              const upx_compress_result_t *cresult );
+int upx_ucl_find_overlap   ( const upx_bytep src, unsigned  src_len,
+                                   unsigned* dst_len, unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult );
 unsigned upx_ucl_adler32(const void *buf, unsigned len, unsigned adler);
 unsigned upx_ucl_crc32  (const void *buf, unsigned len, unsigned crc);
 #endif
@@ -285,11 +285,19 @@ struct ProgressInfo final : public ICompressProgressInfo, public CMyUnknownImp {
     MY_UNKNOWN_IMP
     STDMETHOD(SetRatioInfo)(const UInt64 *inSize, const UInt64 *outSize) override;
     upx_callback_p cb = nullptr;
+    unsigned max_c_len = 0; // see upx_compress_config_t
+    bool over_budget = false;
 };
 
 STDMETHODIMP ProgressInfo::SetRatioInfo(const UInt64 *inSize, const UInt64 *outSize) {
     if (cb && cb->nprogress)
         cb->nprogress(cb, (unsigned) *inSize, (unsigned) *outSize);
+    // the encoder reports every few KiB of input, so a candidate that
+    // cannot win gets stopped long before the end of the input
+    if (max_c_len != 0 && *outSize > max_c_len) {
+        over_budget = true;
+        return E_ABORT;
+    }
     return S_OK;
 }
 
@@ -328,6 +336,8 @@ int upx_lzma_compress(const upx_bytep src, unsigned src_len, upx_bytep dst, unsi
     MyLzma::ProgressInfo progress;
     progress.AddRef();
     progress.cb = cb; // progress.Init()
+    if (cconf_parm != nullptr)
+        progress.max_c_len = cconf_parm->max_c_len;
 
     NCompress::NLZMA::CEncoder enc;
     const PROPID propIDs[8] = {
@@ -388,6 +398,8 @@ int upx_lzma_compress(const upx_bytep src, unsigned src_len, upx_bytep dst, unsi
     assert(os.b_pos <= *dst_len);
     if (rh == E_OUTOFMEMORY)
         r = UPX_E_OUT_OF_MEMORY;
+    else if (progress.over_budget)
+        r = UPX_E_NOT_COMPRESSIBLE;
     else if (os.overflow) {
         assert(os.b_pos == *dst_len);
         // r = UPX_E_OUTPUT_OVERRUN;
@@ -395,6 +407,8 @@ int upx_lzma_compress(const upx_bytep src, unsigned src_len, upx_bytep dst, unsi
     } else if (rh == S_OK) {
         assert(is.b_pos == src_len);
         r = UPX_E_OK;
+        if (progress.max_c_len != 0 && os.b_pos > progress.max_c_len)
+            r = UPX_E_NOT_COMPRESSIBLE; // last block
     }
 
 error:
@@ -511,6 +525,242 @@ int upx_lzma_test_overlap(const upx_bytep buf, const upx_bytep tbuf, unsigned sr
     return UPX_E_OK;
 }
 
+/*************************************************************************
+// find_overlap - decode once and track the maximum distance between
+// the output position and the input position; this is the smallest
+// src_off at which in-place decompression never overwrites unread input
+**************************************************************************/
+
+namespace {
+struct LzmaOverlapDecoder {
+    // probability model layout - must match LzmaDecode.c
+    enum : unsigned {
+        P_IS_MATCH = 0,
+        P_IS_REP = 192,
+        P_IS_REP_G0 = 204,
+        P_IS_REP_G1 = 216,
+        P_IS_REP_G2 = 228,
+        P_IS_REP0_LONG = 240,
+        P_POS_SLOT = 432,
+        P_SPEC_POS = 688,
+        P_ALIGN = 802,
+        P_LEN_CODER = 818,
+        P_REP_LEN_CODER = 1332,
+        P_LITERAL = 1846,
+        // offsets within a length coder
+        P_LEN_CHOICE = 0,
+        P_LEN_CHOICE2 = 1,
+        P_LEN_LOW = 2,
+        P_LEN_MID = 130,
+        P_LEN_HIGH = 258,
+    };
+    const upx_bytep src;
+    unsigned src_len;
+    unsigned ip = 0;
+    unsigned range = 0xffffffff;
+    unsigned code = 0;
+    bool overrun = false;
+    CProb *probs = nullptr;
+
+    void normalize() {
+        if (range < (1u << 24)) {
+            if (ip >= src_len) {
+                overrun = true;
+                return;
+            }
+            range <<= 8;
+            code = (code << 8) | src[ip++];
+        }
+    }
+    unsigned bit(CProb *prob) {
+        normalize();
+        unsigned bound = (range >> 11) * *prob;
+        if (code < bound) {
+            range = bound;
+            *prob = (CProb) (*prob + ((2048 - *prob) >> 5));
+            return 0;
+        }
+        range -= bound;
+        code -= bound;
+        *prob = (CProb) (*prob - (*prob >> 5));
+        return 1;
+    }
+    unsigned bittree(CProb *p, unsigned nbits) {
+        unsigned m = 1;
+        for (unsigned i = 0; i < nbits; i++)
+            m = m * 2 + bit(p + m);
+        return m - (1u << nbits);
+    }
+    unsigned length(CProb *p, unsigned pos_state) {
+        if (bit(p + P_LEN_CHOICE) == 0)
+            return bittree(p + P_LEN_LOW + (pos_state << 3), 3);
+        if (bit(p + P_LEN_CHOICE2) == 0)
+            return 8 + bittree(p + P_LEN_MID + (pos_state << 3), 3);
+        return 16 + bittree(p + P_LEN_HIGH, 8);
+    }
+
+    int run(unsigned pb, unsigned lp, unsigned lc, upx_bytep dst, unsigned *dst_len,
+            unsigned *src_off) {
+        const unsigned out_size = *dst_len;
+        const unsigned nprobs = P_LITERAL + (LZMA_LIT_SIZE << (lc + lp));
+        for (unsigned i = 0; i < nprobs; i++)
+            probs[i] = 1024;
+        for (int i = 0; i < 5; i++) {
+            if (ip >= src_len)
+                return UPX_E_INPUT_OVERRUN;
+            code = (code << 8) | src[ip++];
+        }
+        unsigned now = 0, state = 0, max_dist = 0;
+        unsigned rep0 = 1, rep1 = 1, rep2 = 1, rep3 = 1;
+        byte prev = 0;
+        while (now < out_size) {
+            const unsigned pos_state = now & ((1u << pb) - 1);
+            if (bit(probs + P_IS_MATCH + (state << 4) + pos_state) == 0) {
+                CProb *p = probs + P_LITERAL +
+                           LZMA_LIT_SIZE * (((now & ((1u << lp) - 1)) << lc) + (prev >> (8 - lc)));
+                unsigned symbol = 1;
+                if (state >= 7) { // literal after match: use the match byte as context
+                    unsigned match_byte = dst[now - rep0];
+                    do {
+                        unsigned match_bit = (match_byte >> 7) & 1;
+                        match_byte <<= 1;
+                        unsigned b = bit(p + 0x100 + (match_bit << 8) + symbol);
+                        symbol = symbol * 2 + b;
+                        if (b != match_bit)
+                            break;
+                    } while (symbol < 0x100);
+                }
+                while (symbol < 0x100)
+                    symbol = symbol * 2 + bit(p + symbol);
+                if (overrun)
+                    return UPX_E_INPUT_OVERRUN;
+                dst[now++] = prev = (byte) symbol;
+                state = state < 4 ? 0 : (state < 10 ? state - 3 : state - 6);
+            } else {
+                CProb *len_probs;
+                if (bit(probs + P_IS_REP + state) == 0) {
+                    rep3 = rep2;
+                    rep2 = rep1;
+                    rep1 = rep0;
+                    state = state < 7 ? 0 : 3;
+                    len_probs = probs + P_LEN_CODER;
+                } else {
+                    if (bit(probs + P_IS_REP_G0 + state) == 0) {
+                        if (bit(probs + P_IS_REP0_LONG + (state << 4) + pos_state) == 0) {
+                            if (overrun)
+                                return UPX_E_INPUT_OVERRUN;
+                            if (now == 0)
+                                return UPX_E_LOOKBEHIND_OVERRUN;
+                            state = state < 7 ? 9 : 11;
+                            dst[now] = prev = dst[now - rep0];
+                            now += 1;
+                            if (now > ip && now - ip > max_dist)
+                                max_dist = now - ip;
+                            continue;
+                        }
+                    } else {
+                        unsigned dist;
+                        if (bit(probs + P_IS_REP_G1 + state) == 0)
+                            dist = rep1;
+                        else {
+                            if (bit(probs + P_IS_REP_G2 + state) == 0)
+                                dist = rep2;
+                            else {
+                                dist = rep3;
+                                rep3 = rep2;
+                            }
+                            rep2 = rep1;
+                        }
+                        rep1 = rep0;
+                        rep0 = dist;
+                    }
+                    state = state < 7 ? 8 : 11;
+                    len_probs = probs + P_REP_LEN_CODER;
+                }
+                unsigned len = length(len_probs, pos_state);
+                if (state < 4) {
+                    state += 7;
+                    unsigned pos_slot = bittree(probs + P_POS_SLOT + ((len < 4 ? len : 3) << 6), 6);
+                    if (pos_slot >= 4) {
+                        unsigned ndb = (pos_slot >> 1) - 1;
+                        CProb *p;
+                        rep0 = 2 | (pos_slot & 1);
+                        if (pos_slot < 14) {
+                            rep0 <<= ndb;
+                            p = probs + P_SPEC_POS + rep0 - pos_slot - 1;
+                        } else {
+                            for (ndb -= 4; ndb != 0; ndb--) { // direct bits
+                                normalize();
+                                range >>= 1;
+                                rep0 <<= 1;
+                                if (code >= range) {
+                                    code -= range;
+                                    rep0 |= 1;
+                                }
+                            }
+                            p = probs + P_ALIGN;
+                            rep0 <<= 4;
+                            ndb = 4;
+                        }
+                        for (unsigned i = 1, mi = 1; ndb != 0; ndb--, i <<= 1) {
+                            if (bit(p + mi) == 0)
+                                mi += mi;
+                            else {
+                                mi += mi + 1;
+                                rep0 |= i;
+                            }
+                        }
+                    } else
+                        rep0 = pos_slot;
+                    if (++rep0 == 0)
+                        break; // end marker
+                }
+                if (overrun)
+                    return UPX_E_INPUT_OVERRUN;
+                if (rep0 > now)
+                    return UPX_E_LOOKBEHIND_OVERRUN;
+                len += 2;
+                do {
+                    dst[now] = prev = dst[now - rep0];
+                    now += 1;
+                } while (--len != 0 && now < out_size);
+            }
+            // the input position does not move while copying a match
+            if (now > ip && now - ip > max_dist)
+                max_dist = now - ip;
+        }
+        normalize();
+        if (overrun)
+            return UPX_E_INPUT_OVERRUN;
+        *dst_len = now;
+        *src_off = max_dist;
+        return ip == src_len ? UPX_E_OK : UPX_E_INPUT_NOT_CONSUMED;
+    }
+};
+} // namespace
+
+int upx_lzma_find_overlap(const upx_bytep src, unsigned src_len, unsigned *dst_len,
+                          unsigned *src_off, int method, const upx_compress_result_t *cresult) {
+    assert(M_IS_LZMA(method));
+    UNUSED(cresult);
+
+    // decode UPX-style properties (2 bytes) - see upx_lzma_decompress()
+    if (src_len < 3)
+        return UPX_E_INPUT_OVERRUN;
+    const unsigned pb = src[0] & 7;
+    const unsigned lp = src[1] >> 4;
+    const unsigned lc = src[1] & 15;
+    if (pb >= 5 || lp >= 5 || lc >= 9 || (src[0] >> 3) != lc + lp)
+        return UPX_E_ERROR;
+
+    MemBuffer d(*dst_len);
+    MemBuffer p(sizeof(CProb) * (LzmaOverlapDecoder::P_LITERAL + (LZMA_LIT_SIZE << (lc + lp))));
+    LzmaOverlapDecoder dec{src, src_len};
+    dec.ip = 2; // the properties are part of the compressed data
+    dec.probs = (CProb *) p.getVoidPtr();
+    return dec.run(pb, lp, lc, raw_bytes(d, *dst_len), dst_len, src_off);
+}
+
 /*************************************************************************
 // misc
 **************************************************************************/
@@ -540,4 +790,18 @@ TEST_CASE("upx_lzma_decompress") {
     CHECK(r == UPX_E_OUTPUT_OVERRUN);
 }
 
+TEST_CASE("upx_lzma_find_overlap") {
+    const byte *c_data;
+    unsigned d_len, src_off;
+    int r;
+
+    c_data = (const byte *) "\x1a\x03\x00\x7f\xed\x3c\x00\x00\x00";
+    d_len = 16;
+    r = upx_lzma_find_overlap(c_data, 9, &d_len, &src_off, M_LZMA, nullptr);
+    CHECK((r == 0 && d_len == 16 && src_off == 7));
+    d_len = 16;
+    r = upx_lzma_find_overlap(c_data, 8, &d_len, &src_off, M_LZMA, nullptr);
+    CHECK(r == UPX_E_INPUT_OVERRUN);
+}
+
 /* vim:set ts=4 sw=4 et: */
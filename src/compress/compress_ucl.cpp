@@ -141,6 +141,11 @@ int upx_ucl_compress(const upx_bytep src, unsigned src_len, upx_bytep dst, unsig
     if (res[6] == 0)
         res[6] = 1;
 
+    // The UCL progress callback cannot stop the compressor, so the output
+    // budget only gets checked at the end; this still saves the caller
+    // the verification of a result that cannot be used.
+    if (r == UCL_E_OK && cconf_parm && cconf_parm->max_c_len && *dst_len > cconf_parm->max_c_len)
+        return UPX_E_NOT_COMPRESSIBLE;
     return convert_errno_from_ucl(r);
 }
 
@@ -236,6 +241,172 @@ int upx_ucl_test_overlap(const upx_bytep buf, const upx_bytep tbuf, unsigned src
     return convert_errno_from_ucl(r);
 }
 
+/*************************************************************************
+// find_overlap - decode once and track the maximum distance between
+// the output position and the input position; this is the smallest
+// src_off at which in-place decompression never overwrites unread input
+**************************************************************************/
+
+namespace {
+template <unsigned N_BITS>
+struct NrvOverlapDecoder {
+    const upx_bytep src;
+    unsigned src_len;
+    unsigned ilen = 0;
+    unsigned bb = 0;
+    unsigned bc = 0;
+    bool overrun = false;
+
+    unsigned getbyte() {
+        if (ilen >= src_len) {
+            overrun = true;
+            return 0;
+        }
+        return src[ilen++];
+    }
+    unsigned getbit() {
+        if (N_BITS == 8) {
+            bb = (bb & 0x7f) ? bb * 2 : getbyte() * 2 + 1;
+            return (bb >> 8) & 1;
+        }
+        if (bc == 0) {
+            bb = getbyte();
+            bb |= getbyte() << 8;
+            if (N_BITS == 32) {
+                bb |= getbyte() << 16;
+                bb |= getbyte() << 24;
+            }
+            bc = N_BITS;
+        }
+        return (bb >> --bc) & 1;
+    }
+
+    // variant: 'b', 'd' or 'e'
+    int run(int variant, unsigned *dst_len, unsigned *src_off) {
+        const unsigned oend = *dst_len;
+        unsigned olen = 0, last_m_off = 1, max_dist = 0;
+        for (;;) {
+            unsigned m_off, m_len;
+            while (getbit()) {
+                if (olen >= oend)
+                    return UPX_E_OUTPUT_OVERRUN;
+                (void) getbyte();
+                if (overrun)
+                    return UPX_E_INPUT_OVERRUN;
+                olen += 1;
+                if (olen > ilen && olen - ilen > max_dist)
+                    max_dist = olen - ilen;
+            }
+            m_off = 1;
+            if (variant == 'b') {
+                do {
+                    m_off = m_off * 2 + getbit();
+                    if (overrun || m_off > 0xffffff + 3)
+                        return UPX_E_INPUT_OVERRUN;
+                } while (!getbit());
+            } else {
+                for (;;) {
+                    m_off = m_off * 2 + getbit();
+                    if (overrun || m_off > 0xffffff + 3)
+                        return UPX_E_INPUT_OVERRUN;
+                    if (getbit())
+                        break;
+                    m_off = (m_off - 1) * 2 + getbit();
+                }
+            }
+            if (m_off == 2) {
+                m_off = last_m_off;
+                m_len = (variant == 'b') ? 0 : getbit();
+            } else {
+                m_off = (m_off - 3) * 256 + getbyte();
+                if (overrun)
+                    return UPX_E_INPUT_OVERRUN;
+                if (m_off == 0xffffffff)
+                    break; // EOF marker
+                m_len = 0;
+                if (variant != 'b') {
+                    m_len = (m_off ^ 0xffffffff) & 1;
+                    m_off >>= 1;
+                }
+                last_m_off = ++m_off;
+            }
+            if (variant == 'e' && m_len)
+                m_len = 1 + getbit();
+            else if (variant == 'e' && getbit())
+                m_len = 3 + getbit();
+            else {
+                if (variant == 'b')
+                    m_len = getbit();
+                if (variant != 'e')
+                    m_len = m_len * 2 + getbit();
+                if (m_len == 0) {
+                    m_len = 1;
+                    do {
+                        m_len = m_len * 2 + getbit();
+                        if (overrun || m_len >= oend)
+                            return UPX_E_INPUT_OVERRUN;
+                    } while (!getbit());
+                    m_len += (variant == 'e') ? 3 : 2;
+                }
+            }
+            m_len += (m_off > (variant == 'b' ? 0xd00u : 0x500u));
+            if (overrun)
+                return UPX_E_INPUT_OVERRUN;
+            if (m_off > olen)
+                return UPX_E_LOOKBEHIND_OVERRUN;
+            if (m_len + 1 > oend - olen)
+                return UPX_E_OUTPUT_OVERRUN;
+            olen += m_len + 1; // the input position does not move while copying
+            if (olen > ilen && olen - ilen > max_dist)
+                max_dist = olen - ilen;
+        }
+        *dst_len = olen;
+        *src_off = max_dist;
+        return ilen == src_len ? UPX_E_OK : UPX_E_INPUT_NOT_CONSUMED;
+    }
+};
+} // namespace
+
+int upx_ucl_find_overlap(const upx_bytep src, unsigned src_len, unsigned *dst_len,
+                         unsigned *src_off, int method, const upx_compress_result_t *cresult) {
+    int r;
+    switch (method) {
+    case M_NRV2B_8:
+        r = NrvOverlapDecoder<8>{src, src_len}.run('b', dst_len, src_off);
+        break;
+    case M_NRV2B_LE16:
+        r = NrvOverlapDecoder<16>{src, src_len}.run('b', dst_len, src_off);
+        break;
+    case M_NRV2B_LE32:
+        r = NrvOverlapDecoder<32>{src, src_len}.run('b', dst_len, src_off);
+        break;
+    case M_NRV2D_8:
+        r = NrvOverlapDecoder<8>{src, src_len}.run('d', dst_len, src_off);
+        break;
+    case M_NRV2D_LE16:
+        r = NrvOverlapDecoder<16>{src, src_len}.run('d', dst_len, src_off);
+        break;
+    case M_NRV2D_LE32:
+        r = NrvOverlapDecoder<32>{src, src_len}.run('d', dst_len, src_off);
+        break;
+    case M_NRV2E_8:
+        r = NrvOverlapDecoder<8>{src, src_len}.run('e', dst_len, src_off);
+        break;
+    case M_NRV2E_LE16:
+        r = NrvOverlapDecoder<16>{src, src_len}.run('e', dst_len, src_off);
+        break;
+    case M_NRV2E_LE32:
+        r = NrvOverlapDecoder<32>{src, src_len}.run('e', dst_len, src_off);
+        break;
+    default:
+        throwInternalError("unknown decompression method");
+        return UPX_E_ERROR;
+    }
+
+    UNUSED(cresult);
+    return r;
+}
+
 /*************************************************************************
 // misc
 **************************************************************************/
@@ -306,8 +477,13 @@ static bool check_ucl(const int method, const unsigned expected_c_len) {
     if (r == 0)
         return false;
 
+    unsigned x_len = u_len, src_off = 0;
+    r = upx_ucl_find_overlap(raw_index_bytes(c_buf, c_extra, c_len), c_len, &x_len, &src_off,
+                             method, nullptr);
+    if (r != 0 || x_len != u_len || src_off + c_len < u_len)
+        return false;
+
     // TODO: rewrite Packer::findOverlapOverhead() so that we can test it here
-    // unsigned x_len = d_len;
     // r = upx_ucl_test_overlap(c_buf, u_buf, c_extra, c_len, &x_len, method, nullptr);
     return true;
 }
@@ -363,4 +539,26 @@ TEST_CASE("upx_ucl_decompress") {
     CHECK(r == UPX_E_OUTPUT_OVERRUN);
 }
 
+TEST_CASE("upx_ucl_find_overlap") {
+    unsigned d_len, src_off;
+    int r;
+
+    d_len = 16;
+    r = upx_ucl_find_overlap((const byte *) "\x92\xff\x10\x00\x00\x00\x00\x00\x48\xff", 10,
+                             &d_len, &src_off, M_NRV2B_8, nullptr);
+    CHECK((r == 0 && d_len == 16 && src_off == 13));
+    d_len = 16;
+    r = upx_ucl_find_overlap((const byte *) "\x92\xff\x10\x92\x49\x24\x92\xa0\xff", 9, &d_len,
+                             &src_off, M_NRV2D_8, nullptr);
+    CHECK((r == 0 && d_len == 16 && src_off == 13));
+    d_len = 16;
+    r = upx_ucl_find_overlap((const byte *) "\x90\xff\xb0\x92\x49\x24\x92\xa0\xff", 8, &d_len,
+                             &src_off, M_NRV2E_8, nullptr);
+    CHECK(r == UPX_E_INPUT_OVERRUN);
+    d_len = 15;
+    r = upx_ucl_find_overlap((const byte *) "\x90\xff\xb0\x92\x49\x24\x92\xa0\xff", 9, &d_len,
+                             &src_off, M_NRV2E_8, nullptr);
+    CHECK(r == UPX_E_OUTPUT_OVERRUN);
+}
+
 /* vim:set ts=4 sw=4 et: */
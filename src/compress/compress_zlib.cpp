@@ -105,12 +105,22 @@ int upx_zlib_compress(const upx_bytep src, unsigned src_len, upx_bytep dst, unsi
     s.next_out = dst;
     s.avail_out = *dst_len;
     s.total_in = s.total_out = 0;
+    // output budget: deflate() stops when the output buffer is full
+    const bool limited = cconf_parm && cconf_parm->max_c_len && cconf_parm->max_c_len < *dst_len;
+    if (limited)
+        s.avail_out = cconf_parm->max_c_len + 1;
 
     zr = (int) deflateInit2(&s, level, Z_DEFLATED, 0 - (int) window_bits, mem_level, strategy);
     if (zr != Z_OK)
         goto error;
     assert(s.state->level == level);
     zr = deflate(&s, Z_FINISH);
+    if (zr == Z_OK && limited && s.avail_out == 0) {
+        // over budget
+        (void) deflateEnd(&s);
+        r = UPX_E_NOT_COMPRESSIBLE;
+        goto done;
+    }
     if (zr != Z_STREAM_END)
         goto error;
     zr = deflateEnd(&s);
@@ -127,6 +137,8 @@ done:
     if (r == UPX_E_OK) {
         if (s.avail_in != 0 || s.total_in != src_len)
             r = UPX_E_ERROR;
+        else if (limited && s.total_out > cconf_parm->max_c_len)
+            r = UPX_E_NOT_COMPRESSIBLE;
     }
     assert(s.total_in <= src_len);
     assert(s.total_out <= *dst_len);
@@ -260,6 +272,19 @@ static bool check_zlib(const int method, const int level, const unsigned expecte
     if (r != 0 || c_len != expected_c_len)
         return false;
 
+    // output budget
+    upx_compress_config_t cconf;
+    cconf.reset();
+    for (unsigned budget = c_len - 1; budget <= c_len; budget++) {
+        unsigned t_len = c_buf.getSize() - c_extra;
+        cconf.max_c_len = budget;
+        r = upx_zlib_compress(raw_bytes(u_buf, u_len), u_len,
+                              raw_index_bytes(c_buf, c_extra, t_len), &t_len, nullptr, method,
+                              level, &cconf, &cresult);
+        if (r != (budget < c_len ? UPX_E_NOT_COMPRESSIBLE : UPX_E_OK))
+            return false;
+    }
+
     d_len = d_buf.getSize();
     r = upx_zlib_decompress(raw_index_bytes(c_buf, c_extra, c_len), c_len, raw_bytes(d_buf, d_len),
                             &d_len, method, nullptr);
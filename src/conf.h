@@ -68,7 +68,7 @@ ACC_COMPILE_TIME_ASSERT_HEADER((char)(-1) == 255) // -funsigned-char
 #endif // UPX_CONFIG_DISABLE_WERROR
 #endif // UPX_CONFIG_DISABLE_WSTRICT
 
-// multithreading (UPX currently does not use multithreading)
+// multithreading (see opt->threads)
 #if (WITH_THREADS)
 #define upx_thread_local        thread_local
 #define upx_std_atomic(Type)    std::atomic<Type>
@@ -692,7 +692,13 @@ struct upx_compress_config_t
     ucl_compress_config_t   conf_ucl;
     zlib_compress_config_t  conf_zlib;
     zstd_compress_config_t  conf_zstd;
-    void reset() { conf_lzma.reset(); conf_ucl.reset(); conf_zlib.reset(); conf_zstd.reset(); }
+    // output budget: give up with UPX_E_NOT_COMPRESSIBLE as soon as the
+    // compressed size exceeds max_c_len; 0 means no limit
+    unsigned                max_c_len;
+    void reset() {
+        conf_lzma.reset(); conf_ucl.reset(); conf_zlib.reset(); conf_zstd.reset();
+        max_c_len = 0;
+    }
 };
 
 #define NULL_cconf  ((upx_compress_config_t *) nullptr)
@@ -791,6 +797,14 @@ void printUnhandledException(const char *iname, const std::exception *e);
 void printErr(const char *iname, const char *format, ...) attribute_format(2, 3);
 void printWarn(const char *iname, const char *format, ...) attribute_format(2, 3);
 
+// per-thread capture of console output, used by the parallel do_files() driver
+struct PrintCapture;
+PrintCapture *printCaptureBegin(); // capture all output of the current thread
+void printCaptureEnd();            // stop capturing for the current thread
+void printCaptureFlush(PrintCapture *pc); // print the captured output and free pc
+bool printCaptureActive();
+bool printCaptureAppend(FILE *f, const char *s); // returns false if not capturing
+
 void infoWarning(const char *format, ...) attribute_format(1, 2);
 void infoHeader(const char *format, ...) attribute_format(1, 2);
 void info(const char *format, ...) attribute_format(1, 2);
@@ -801,6 +815,9 @@ void infoWriting(const char *what, long size);
 void do_one_file(const char *iname, char *oname);
 int do_files(int i, int argc, char *argv[]);
 
+// bench.cpp
+int do_benchmark(int i, int argc, char *argv[]);
+
 // help.cpp
 extern const char gitrev[];
 void show_header();
@@ -811,6 +828,7 @@ void show_version(bool one_line=false);
 
 // compress/compress.cpp
 unsigned upx_adler32(const void *buf, unsigned len, unsigned adler=1);
+unsigned upx_adler32_combine(unsigned adler1, unsigned adler2, unsigned len2);
 unsigned upx_crc32  (const void *buf, unsigned len, unsigned crc=0);
 
 int upx_compress           ( const upx_bytep src, unsigned  src_len,
@@ -829,6 +847,10 @@ int upx_test_overlap       ( const upx_bytep buf,
                                    unsigned* dst_len,
                                    int method,
                              const upx_compress_result_t *cresult );
+int upx_find_overlap       ( const upx_bytep src, unsigned  src_len,
+                                   unsigned* dst_len, unsigned* src_off,
+                                   int method,
+                             const upx_compress_result_t *cresult );
 
 
 #include "util/snprintf.h"   // must get included first!
@@ -130,12 +130,29 @@ void con_fprintf(FILE *f, const char *format, ...) {
     upx_safe_vsnprintf(buf, sizeof(buf), format, args);
     va_end(args);
 
+    if (printCaptureAppend(f, buf))
+        return;
     if (con == me)
         init(f, -1, -1);
     assert(con != me);
     con->print0(f, buf);
 }
 
+#else
+
+void con_fprintf(FILE *f, const char *format, ...) {
+    va_list args;
+    char buf[80 * 25];
+
+    va_start(args, format);
+    upx_safe_vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+
+    if (printCaptureAppend(f, buf))
+        return;
+    fputs(buf, f);
+}
+
 #endif /* USE_CONSOLE */
 
 /* vim:set ts=4 sw=4 et: */
@@ -157,12 +157,13 @@ extern console_t console_ansi_mono;
 extern console_t console_ansi_color;
 extern console_t console_screen;
 
-#define con_fg(f, x) con->set_fg(f, x)
+// no colors while capturing output, see printCaptureBegin()
+#define con_fg(f, x) (printCaptureActive() ? -1 : con->set_fg(f, x))
 
 #else
 
 #define con_fg(f, x) 0
-#define con_fprintf fprintf
+void con_fprintf(FILE *f, const char *format, ...) attribute_format(2, 3);
 
 #endif /* USE_CONSOLE */
 
@@ -27,6 +27,10 @@
 
 #include "conf.h"
 #include "file.h"
+#include "ui.h"
+#if (HAVE_MMAP) && (HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#endif
 
 /*************************************************************************
 // static functions
@@ -164,6 +168,7 @@ InputFile::InputFile() {}
 
 void InputFile::sopen(const char *name, int flags, int shflags) {
     close();
+    unmap();
     _name = name;
     _flags = flags;
     _shflags = shflags;
@@ -208,6 +213,92 @@ upx_off_t InputFile::seek(upx_off_t off, int whence) {
 
 upx_off_t InputFile::st_size_orig() const { return _length_orig; }
 
+// Only a regular file whose size is still the one seen by open() gets
+// mapped. This cannot prevent a truncation after the mapping was made
+// (see file.h); the input must not be modified while upx runs anyway.
+bool InputFile::isMappable() const {
+#if (HAVE_MMAP) && (HAVE_SYS_MMAN_H)
+    struct stat now;
+    return isOpen() && S_ISREG(st.st_mode) && _length_orig > 0 &&
+           mem_size_valid_bytes(_length_orig) && ::fstat(_fd, &now) == 0 &&
+           S_ISREG(now.st_mode) && (upx_off_t) now.st_size == _length_orig;
+#else
+    return false;
+#endif
+}
+
+// The mapping is created lazily on the first request, and it is private
+// and read-only. Not mappable (pipes, empty files, no mmap() on this
+// platform): canView() returns false and callers use read().
+bool InputFile::canView() {
+    if (!_map_tried && isOpen()) {
+        _map_tried = true;
+#if (HAVE_MMAP) && (HAVE_SYS_MMAN_H)
+        if (isMappable()) {
+            void *p = ::mmap(nullptr, (size_t) _length_orig, PROT_READ, MAP_PRIVATE, _fd, 0);
+            if (p != MAP_FAILED)
+                _map = (const byte *) p;
+        }
+#endif
+    }
+    return _map != nullptr && isOpen();
+}
+
+SPAN_P(const byte) InputFile::view(upx_off_t off, int len) {
+    if (!canView() || len < 0 || off < 0)
+        throwIOException("bad view");
+    if (off > _length || len > _length - off)
+        throwEOFException();
+    const byte *p = _map + (_offset + off);
+    return SPAN_S_MAKE(const byte, p, len);
+}
+
+SPAN_P(const byte) InputFile::viewx(int len) {
+    const upx_off_t pos = tell();
+    SPAN_P_VAR(const byte, p, view(pos, len));
+    seek(pos + len, SEEK_SET);
+    return p;
+}
+
+// Like reading the whole file into a buffer, but only the pages which
+// get written are copied. A non-null "at" maps the file again at the same
+// address, which discards all changes; pointers into the image stay valid.
+// Returns nullptr if the file cannot be mapped, e.g. for an extent.
+byte *InputFile::mapImage(byte *at) {
+#if (HAVE_MMAP) && (HAVE_SYS_MMAN_H)
+    if (_offset == 0 && _length == _length_orig && isMappable()) {
+        void *p = ::mmap(at, (size_t) _length_orig, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | (at ? MAP_FIXED : 0), _fd, 0);
+        if (p != MAP_FAILED)
+            return (byte *) p;
+        if (at != nullptr) // the old mapping may be gone
+            throwIOException("mmap error", errno);
+    }
+#else
+    UNUSED(at);
+#endif
+    return nullptr;
+}
+
+void InputFile::unmapImage(byte *p, upx_off_t len) noexcept {
+#if (HAVE_MMAP) && (HAVE_SYS_MMAN_H)
+    if (p != nullptr)
+        (void) ::munmap(p, (size_t) len);
+#else
+    UNUSED(p);
+    UNUSED(len);
+#endif
+}
+
+void InputFile::unmap() noexcept {
+#if (HAVE_MMAP) && (HAVE_SYS_MMAN_H)
+    if (_map != nullptr)
+        (void) ::munmap(const_cast<byte *>(_map), (size_t) _length_orig);
+#endif
+    _map = nullptr;
+    _map_tried = false;
+}
+
 /*************************************************************************
 //
 **************************************************************************/
@@ -260,6 +351,7 @@ void OutputFile::write(SPAN_0(const void) buf, int len) {
     if (len == 0)
         return;
     mem_size_assert(1, len); // sanity check
+    UiStats::Scope timer(stats, UiStats::PH_WRITE, len);
     errno = 0;
 #if 0
     fprintf(stderr, "write %p %zd (%p) %d\n", buf.raw_ptr(), buf.raw_size_in_bytes(),
@@ -357,4 +449,93 @@ void OutputFile::dump(const char *name, SPAN_P(const void) buf, int len, int fla
     f.closex();
 }
 
+/*************************************************************************
+// test
+**************************************************************************/
+
+TEST_CASE("InputFile::view") {
+    const char *const name = "upx-test-view.tmp";
+    byte b[256];
+    for (unsigned i = 0; i < sizeof(b); i++)
+        b[i] = (byte) i;
+    OutputFile::dump(name, b, sizeof(b));
+    {
+        InputFile fi;
+        fi.open(name, O_RDONLY | O_BINARY);
+#if (HAVE_MMAP) && (HAVE_SYS_MMAN_H)
+        CHECK(fi.canView());
+#endif
+        if (fi.canView()) {
+            CHECK(fi.view(0, 256)[255] == 255);
+            CHECK_NOTHROW(fi.view(256, 0));
+            CHECK(fi.view(100, 10)[0] == 100);
+            CHECK_THROWS(fi.view(257, 0)); // off > _length
+            CHECK_THROWS(fi.view(200, 57)); // len > _length - off
+            CHECK_THROWS(fi.view(0, -1));
+            CHECK_THROWS(fi.view(-1, 1));
+            // viewx() advances the file position like readx()
+            fi.seek(16, SEEK_SET);
+            CHECK(fi.viewx(8)[0] == 16);
+            CHECK(fi.tell() == 24);
+            CHECK(fi.viewx(8)[7] == 31);
+            CHECK(fi.tell() == 32);
+            fi.seek(250, SEEK_SET);
+            CHECK_THROWS(fi.viewx(7));
+            CHECK(fi.tell() == 250);
+            // views are relative to the extent
+            fi.set_extent(64, 128);
+            CHECK(fi.view(0, 128)[0] == 64);
+            CHECK_THROWS(fi.view(0, 129));
+        }
+        fi.closex();
+        CHECK(!fi.canView()); // closed
+        CHECK_THROWS(fi.view(0, 1));
+    }
+    // an empty file cannot be mapped; callers fall back to read()
+    OutputFile::dump(name, b, 0);
+    {
+        InputFile fi;
+        fi.open(name, O_RDONLY | O_BINARY);
+        CHECK(!fi.canView());
+        CHECK_THROWS(fi.view(0, 0));
+        CHECK(fi.read(b, 1) == 0);
+        fi.closex();
+    }
+    FileBase::unlink(name);
+}
+
+TEST_CASE("InputFile::mapImage") {
+    const char *const name = "upx-test-image.tmp";
+    byte b[256];
+    for (unsigned i = 0; i < sizeof(b); i++)
+        b[i] = (byte) i;
+    OutputFile::dump(name, b, sizeof(b));
+    {
+        InputFile fi;
+        fi.open(name, O_RDONLY | O_BINARY);
+        byte *const p = fi.mapImage();
+#if (HAVE_MMAP) && (HAVE_SYS_MMAN_H)
+        CHECK(p != nullptr);
+#endif
+        if (p != nullptr) {
+            CHECK(p[255] == 255);
+            // copy-on-write: the file and its views are unchanged
+            p[0] = 7;
+            CHECK(fi.read(b, 1) == 1);
+            CHECK(b[0] == 0);
+            if (fi.canView())
+                CHECK(fi.view(0, 1)[0] == 0);
+            // mapping again at the same address discards the change
+            CHECK(fi.mapImage(p) == p);
+            CHECK(p[0] == 0);
+            InputFile::unmapImage(p, 256);
+        }
+        // an extent cannot be mapped as a whole file
+        fi.set_extent(64, 128);
+        CHECK(fi.mapImage() == nullptr);
+        fi.closex();
+    }
+    FileBase::unlink(name);
+}
+
 /* vim:set ts=4 sw=4 et: */
@@ -27,6 +27,8 @@
 
 #pragma once
 
+class UiStats;
+
 /*************************************************************************
 //
 **************************************************************************/
@@ -77,7 +79,7 @@ class InputFile final : public FileBase {
 
 public:
     InputFile();
-    virtual ~InputFile() {}
+    virtual ~InputFile() noexcept { unmap(); }
 
     void sopen(const char *name, int flags, int shflags);
     void open(const char *name, int flags) { sopen(name, flags, -1); }
@@ -85,11 +87,29 @@ public:
     int read(SPAN_P(void) buf, int len);
     int readx(SPAN_P(void) buf, int len);
 
+    // zero-copy read-only views over a memory mapping of the file;
+    // view() throws like readx() if [off, off+len) is out of range.
+    // NOTE: if the file gets truncated while it is mapped, an access to a
+    // view beyond the new end raises SIGBUS instead of a read error; so
+    // only regular files whose size did not change since open() are mapped.
+    bool canView();
+    SPAN_P(const byte) view(upx_off_t off, int len);
+    SPAN_P(const byte) viewx(int len); // like readx(), advances the file position
+
+    // a private, writable copy-on-write mapping of the whole file, see
+    // mapImage() in file.cpp; the mapping stays valid after close()
+    byte *mapImage(byte *at = nullptr);
+    static void unmapImage(byte *p, upx_off_t len) noexcept;
+
     virtual upx_off_t seek(upx_off_t off, int whence) override;
     upx_off_t st_size_orig() const;
 
 protected:
+    bool isMappable() const;
+    void unmap() noexcept;
     upx_off_t _length_orig = 0;
+    const byte *_map = nullptr; // mapping of [0, _length_orig)
+    bool _map_tried = false;
 };
 
 /*************************************************************************
@@ -117,6 +137,9 @@ public:
 
     upx_off_t getBytesWritten() const { return bytes_written; }
 
+    // timing of the writes for "--stats", see Packer::doPack()
+    UiStats *stats = nullptr;
+
     // FIXME - these won't work when using the '--stdout' option
     void rewrite(SPAN_P(const void) buf, int len);
 
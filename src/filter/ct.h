@@ -35,6 +35,9 @@
     byte *b = f->buf; \
     byte *b_end = b + f->buf_len - 3; \
     do { \
+        b = f->buf + ct_skip_e8e9(f->buf, (unsigned) (b - f->buf), (unsigned) (b_end - f->buf)); \
+        if (b >= b_end) \
+            break; \
         if (cond) \
         { \
             b += 1; \
@@ -214,6 +217,9 @@ static int s_ct16_e8e9_bswap_be(Filter *f)
     byte *b = f->buf; \
     byte *b_end = b + f->buf_len - 5; \
     do { \
+        b = f->buf + ct_skip_e8e9(f->buf, (unsigned) (b - f->buf), (unsigned) (b_end - f->buf)); \
+        if (b >= b_end) \
+            break; \
         if (cond) \
         { \
             b += 1; \
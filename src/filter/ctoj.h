@@ -58,6 +58,9 @@ static int F(Filter *f)
 
         for (ic = 0; ic < size - 5; ic++)
         {
+            ic = ct_skip_e8e9(b, ic, size - 5);
+            if (ic >= size - 5)
+                break;
             if (!COND(b,ic,lastcall))
                 continue;
             jc = get_le32(b+ic+1)+ic+1;
@@ -80,6 +83,9 @@ static int F(Filter *f)
 
     for (ic = 0; ic < size - 5; ic++)
     {
+        ic = ct_skip_e8e9(b, ic, size - 5);
+        if (ic >= size - 5)
+            break;
         if (!COND(b,ic,lastcall))
             continue;
         jc = get_le32(b+ic+1)+ic+1;
@@ -148,6 +154,10 @@ static int U(Filter *f)
     unsigned ic, jc;
 
     for (ic = 0; ic < size5; ic++)
+    {
+        ic = ct_skip_e8e9(b, ic, size5);
+        if (ic >= size5)
+            break;
         if (COND(b,ic,lastcall))
         {
             jc = get_be32(b+ic+1);
@@ -161,6 +171,7 @@ static int U(Filter *f)
             else
                 f->noncalls++;
         }
+    }
     return 0;
 }
 #endif
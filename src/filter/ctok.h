@@ -59,6 +59,9 @@ static int F(Filter *f)
 
         for (ic = 0; ic < size - 5; ic++)
         {
+            ic = ct_skip_ctok(b, ic, size - 5, id);
+            if (ic >= size - 5)
+                break;
             if (!COND(b,ic,lastcall,id))
                 continue;
             jc = get_le32(b+ic+1)+ic+1;
@@ -81,6 +84,9 @@ static int F(Filter *f)
 
     for (ic = 0; ic < size - 5; ic++)
     {
+        ic = ct_skip_ctok(b, ic, size - 5, id);
+        if (ic >= size - 5)
+            break;
         if (!COND(b,ic,lastcall,id))
             continue;
         jc = get_le32(b+ic+1)+ic+1;
@@ -151,6 +157,10 @@ static int U(Filter *f)
     unsigned ic, jc;
 
     for (ic = 0; ic < size5; ic++)
+    {
+        ic = ct_skip_ctok(b, ic, size5, id);
+        if (ic >= size5)
+            break;
         if (COND(b,ic,lastcall,id))
         {
             jc = get_be32(b+ic+1);
@@ -164,6 +174,7 @@ static int U(Filter *f)
             else
                 f->noncalls++;
         }
+    }
     return 0;
 }
 #endif
@@ -0,0 +1,159 @@
+/* ctscan.h -- calltrick util: fast scanning for call candidates
+
+   This file is part of the UPX executable compressor.
+
+   Copyright (C) 1996-2023 Markus Franz Xaver Johannes Oberhumer
+   Copyright (C) 1996-2023 Laszlo Molnar
+   All Rights Reserved.
+
+   UPX and the UCL library are free software; you can redistribute them
+   and/or modify them under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of
+   the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; see the file COPYING.
+   If not, write to the Free Software Foundation, Inc.,
+   59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+   Markus F.X.J. Oberhumer              Laszlo Molnar
+   <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+ */
+
+
+
+/*************************************************************************
+// ct_skip_e8e9(b, ic, end)
+// ct_skip_ctok(b, ic, end, id)
+//
+// Return a position "p" with ic <= p <= end such that no byte in
+// b[ic..p-1] can start a call: p is either the first position of an
+// 0xe8/0xe9 opcode, or a position close to "end" where the vector
+// loop gave up, or "end" itself. If the filter id converts jcc, the
+// ctok version also stops at every 0x80..0x8f (the second opcode
+// byte of a "0x0f 0x8x" jcc).
+//
+// The calltrick loops call this before testing their exact COND, so
+// they only skip bytes the COND would have rejected anyway; all the
+// filter results (calls, noncalls, lastcall, cto) are unchanged.
+**************************************************************************/
+
+#if (ACC_ARCH_AMD64) || (ACC_ARCH_I386 && defined(__SSE2__))
+#define WITH_CTSCAN_SSE2 1
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define WITH_CTSCAN_AVX2 1
+#include <immintrin.h>
+#endif
+#elif (ACC_ARCH_ARM64) && defined(__ARM_NEON)
+#define WITH_CTSCAN_NEON 1
+#include <arm_neon.h>
+#endif
+
+
+#if (WITH_CTSCAN_SSE2 || WITH_CTSCAN_NEON)
+static inline unsigned ct_ctz32(unsigned v)
+{
+#if (ACC_CC_MSC)
+    unsigned long r;
+    _BitScanForward(&r, v);
+    return (unsigned) r;
+#else
+    return (unsigned) __builtin_ctz(v);
+#endif
+}
+#endif
+
+#if (WITH_CTSCAN_NEON)
+// narrow a 0x00/0xff byte mask to 4 bits per byte
+static inline upx_uint64_t ct_neon_mask(uint8x16_t m)
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+}
+
+static inline unsigned ct_ctz64(upx_uint64_t v)
+{
+    return (unsigned) __builtin_ctzll(v);
+}
+#endif
+
+
+template <bool jcc>
+static inline unsigned ct_skip(const byte *b, unsigned ic, unsigned end)
+{
+#if (WITH_CTSCAN_AVX2)
+    const __m256i y01 = _mm256_set1_epi8(0x01);
+    const __m256i ye9 = _mm256_set1_epi8((char) 0xe9);
+    const __m256i yf0 = _mm256_set1_epi8((char) 0xf0);
+    const __m256i y80 = _mm256_set1_epi8((char) 0x80);
+    while (ic + 32 <= end)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i *) (b + ic));
+        // (v | 1) == 0xe9  <=>  v == 0xe8 || v == 0xe9
+        __m256i m = _mm256_cmpeq_epi8(_mm256_or_si256(v, y01), ye9);
+        if (jcc) // (v & 0xf0) == 0x80
+            m = _mm256_or_si256(m, _mm256_cmpeq_epi8(_mm256_and_si256(v, yf0), y80));
+        const unsigned mask = (unsigned) _mm256_movemask_epi8(m);
+        if (mask)
+            return ic + ct_ctz32(mask);
+        ic += 32;
+    }
+#endif
+#if (WITH_CTSCAN_SSE2)
+    const __m128i x01 = _mm_set1_epi8(0x01);
+    const __m128i xe9 = _mm_set1_epi8((char) 0xe9);
+    const __m128i xf0 = _mm_set1_epi8((char) 0xf0);
+    const __m128i x80 = _mm_set1_epi8((char) 0x80);
+    while (ic + 16 <= end)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i *) (b + ic));
+        __m128i m = _mm_cmpeq_epi8(_mm_or_si128(v, x01), xe9);
+        if (jcc)
+            m = _mm_or_si128(m, _mm_cmpeq_epi8(_mm_and_si128(v, xf0), x80));
+        const unsigned mask = (unsigned) _mm_movemask_epi8(m);
+        if (mask)
+            return ic + ct_ctz32(mask);
+        ic += 16;
+    }
+#elif (WITH_CTSCAN_NEON)
+    const uint8x16_t n01 = vdupq_n_u8(0x01);
+    const uint8x16_t ne9 = vdupq_n_u8(0xe9);
+    const uint8x16_t nf0 = vdupq_n_u8(0xf0);
+    const uint8x16_t n80 = vdupq_n_u8(0x80);
+    while (ic + 16 <= end)
+    {
+        const uint8x16_t v = vld1q_u8(b + ic);
+        uint8x16_t m = vceqq_u8(vorrq_u8(v, n01), ne9);
+        if (jcc)
+            m = vorrq_u8(m, vceqq_u8(vandq_u8(v, nf0), n80));
+        const upx_uint64_t mask = ct_neon_mask(m);
+        if (mask)
+            return ic + (ct_ctz64(mask) >> 2);
+        ic += 16;
+    }
+#else
+    UNUSED(b);
+#endif
+    // the caller's scalar loop handles the rest
+    return ic < end ? ic : end;
+}
+
+static inline unsigned ct_skip_e8e9(const byte *b, unsigned ic, unsigned end)
+{
+    return ct_skip<false>(b, ic, end);
+}
+
+// see COND in the ctok section of filter_impl.cpp
+static inline unsigned ct_skip_ctok(const byte *b, unsigned ic, unsigned end, unsigned id)
+{
+    if (9 <= (0xf & id))
+        return ct_skip<true>(b, ic, end);
+    return ct_skip<false>(b, ic, end);
+}
+
+/* vim:set ts=4 sw=4 et: */
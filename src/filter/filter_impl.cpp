@@ -46,6 +46,7 @@ umin(const unsigned a, const unsigned b)
 **************************************************************************/
 
 #include "getcto.h"
+#include "ctscan.h"
 
 
 /*************************************************************************
@@ -268,4 +269,32 @@ umin(const unsigned a, const unsigned b)
 
 /*static*/ const int FilterImpl::n_filters = TABLESIZE(filters);
 
+/*************************************************************************
+// test
+**************************************************************************/
+
+TEST_CASE("ct_skip") {
+    byte b[256];
+    for (unsigned i = 0; i < 256; i++)
+        b[i] = (byte) (i * 37 + 11);
+    for (unsigned id = 0x46; id <= 0x49; id += 3) {
+        const bool jcc = (id == 0x49);
+        for (unsigned ic = 0; ic < 200; ic++) {
+            const unsigned p = ct_skip_ctok(b, ic, 200, id);
+            CHECK((ic <= p && p <= 200));
+            unsigned x = ic;
+            while (x < p && !(b[x] == 0xe8 || b[x] == 0xe9 || (jcc && (b[x] & 0xf0) == 0x80)))
+                x++;
+            CHECK(x == p); // nothing skipped that could start a call
+        }
+    }
+    memset(b, 0, sizeof(b));
+    b[100] = 0xe9;
+    b[150] = 0x0f;
+    b[151] = 0x85;
+    CHECK(ct_skip_e8e9(b, 0, 240) <= 100);
+    CHECK(ct_skip_e8e9(b, 101, 240) <= 240);
+    CHECK(ct_skip_ctok(b, 101, 240, 0x49) <= 151);
+}
+
 /* vim:set ts=4 sw=4 et: */
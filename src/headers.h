@@ -72,7 +72,7 @@
 #include <new>
 #include <type_traits>
 
-// C++ multithreading (UPX currently does not use multithreading)
+// C++ multithreading (see opt->threads)
 #ifndef WITH_THREADS
 #define WITH_THREADS 0
 #endif
@@ -81,7 +81,9 @@
 #endif
 #if WITH_THREADS
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
+#include <thread>
 #endif
 
 // UPX vendor git submodule headers
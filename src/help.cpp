@@ -205,6 +205,15 @@ void show_help(int verbose) {
                     "  --lzma              try LZMA [slower but tighter than NRV]\n"
                     "  --brute             try all available compression methods & filters [slow]\n"
                     "  --ultra-brute       try even more compression variants [very slow]\n"
+                    "  --rank-filters=K    only compress with the K most promising filters\n"
+                    "  --rank-methods=K    only compress with the K most promising methods\n"
+                    "  --entropy-gate=N    store blocks of >= N/100 bits per byte, e.g. 799\n"
+                    "  --threads=N         use N threads for several files or compression trials\n"
+                    "  --memory-limit=N    keep the working memory below about N MiB\n"
+                    "                      (ET_DYN inputs still keep a whole-file image)\n"
+                    "  --cache-dir=DIR     reuse the compression results of unchanged inputs\n"
+                    "  --benchmark[=json]  measure the compression and filter kernels on FILES\n"
+                    "  --stats[=json]      print per-phase timings and counters to stderr\n"
                     "\n");
         fg = con_fg(f, FG_YELLOW);
         con_fprintf(f, "Backup options:\n");
@@ -40,9 +40,44 @@ static bool update_capacity(unsigned size, unsigned *capacity) {
     return true;
 }
 
+// FNV-1a
+static unsigned name_hash(const char *name) {
+    unsigned h = 0x811c9dc5;
+    for (; *name; name++)
+        h = (h ^ (uchar) *name) * 0x01000193;
+    return h;
+}
+
+// return the slot of name in index[], or the empty slot where it belongs
+template <class T>
+static unsigned *index_find(unsigned *index, unsigned mask, T *const *objs, const char *name) {
+    for (unsigned i = name_hash(name) & mask;; i = (i + 1) & mask) {
+        unsigned *slot = &index[i];
+        if (*slot == 0 || strcmp(objs[*slot - 1]->name, name) == 0)
+            return slot;
+    }
+}
+
+// add objs[n - 1] to index[], growing it to keep the load factor below 1/2
+template <class T>
+static void index_add(unsigned **index, unsigned *mask, T *const *objs, unsigned n) {
+    if (*index == nullptr || 2 * n > *mask + 1) {
+        unsigned capacity = (*index == nullptr) ? 64 : 2 * (*mask + 1);
+        while (2 * n > capacity)
+            capacity *= 2;
+        delete[] *index;
+        *index = new unsigned[capacity](); // zero-initialized
+        *mask = capacity - 1;
+        for (unsigned i = 0; i < n; i++)
+            *index_find(*index, *mask, objs, objs[i]->name) = i + 1;
+        return;
+    }
+    *index_find(*index, *mask, objs, objs[n - 1]->name) = n;
+}
+
 static void internal_error(const char *format, ...) attribute_format(1, 2);
 static void internal_error(const char *format, ...) {
-    static char buf[1024];
+    static upx_thread_local char buf[1024];
     va_list ap;
 
     va_start(ap, format);
@@ -117,9 +152,91 @@ ElfLinker::~ElfLinker() noexcept {
     for (ic = 0; ic < nrelocations; ic++)
         delete relocations[ic];
     free(relocations);
+    delete[] section_index;
+    delete[] symbol_index;
+}
+
+void ElfLinker::init(const void *pdata, int plen, unsigned pxtra) {
+    copyStub(getStubTemplate(pdata, plen));
+
+    output_capacity = (inputlen ? (inputlen + pxtra) : 0x4000);
+    assert(output_capacity <= (1 << 16)); // LE16 l_info.l_size
+    output = New(byte, output_capacity);
+    outputlen = 0;
+    NO_printf("\nElfLinker::init %d @%p\n", output_capacity, output);
+
+    if (nsections != 0)
+        addLoader("*UND*");
+}
+
+/*************************************************************************
+// stub cache
+//
+// Decompressing a stub and preprocessing its tables or listings happens
+// only once per process and stub. The parsed result is kept as an
+// immutable template, and init() copies its sections, symbols and
+// relocations.
+**************************************************************************/
+
+namespace {
+struct StubCacheEntry final {
+    const void *pdata;
+    int plen;
+    unsigned adler; // guards against a different stub at the same address
+    const ElfLinker *tmpl;
+    StubCacheEntry *next;
+};
+} // namespace
+
+static StubCacheEntry *stub_cache = nullptr; // never freed
+#if WITH_THREADS
+static std::mutex stub_cache_mutex;
+#endif
+
+/*static*/ const ElfLinker *ElfLinker::getStubTemplate(const void *pdata, int plen) {
+    const unsigned adler = upx_adler32(pdata, plen);
+#if WITH_THREADS
+    std::lock_guard<std::mutex> lock(stub_cache_mutex);
+#endif
+    for (const StubCacheEntry *e = stub_cache; e != nullptr; e = e->next)
+        if (e->pdata == pdata && e->plen == plen && e->adler == adler)
+            return e->tmpl;
+    ElfLinker *tmpl = new ElfLinker();
+    try {
+        tmpl->parseStub(pdata, plen);
+    } catch (...) {
+        delete tmpl;
+        throw;
+    }
+    stub_cache = new StubCacheEntry{pdata, plen, adler, tmpl, stub_cache};
+    return tmpl;
+}
+
+void ElfLinker::copyStub(const ElfLinker *tmpl) {
+    inputlen = tmpl->inputlen;
+    input = New(byte, inputlen + 1);
+    memcpy(input, tmpl->input, inputlen + 1);
+
+    unsigned ic;
+    for (ic = 0; ic < tmpl->nsections; ic++) {
+        const Section *sec = tmpl->sections[ic];
+        addSection(sec->name, sec->input, sec->size, sec->p2align);
+    }
+    for (ic = 0; ic < tmpl->nsymbols; ic++) {
+        const Symbol *sym = tmpl->symbols[ic];
+        addSymbol(sym->name, sym->section->name, sym->offset);
+    }
+    for (ic = 0; ic < tmpl->nrelocations; ic++) {
+        const Relocation *rel = tmpl->relocations[ic];
+        // rel->type points into the preprocessed input
+        const ptrdiff_t type_off = rel->type - (const char *) tmpl->input;
+        assert(type_off >= 0 && type_off < tmpl->inputlen);
+        addRelocation(rel->section->name, rel->offset, (const char *) input + type_off,
+                      rel->value->name, rel->add);
+    }
 }
 
-void ElfLinker::init(const void *pdata_v, int plen, unsigned pxtra) {
+void ElfLinker::parseStub(const void *pdata_v, int plen) {
     const byte *pdata = (const byte *) pdata_v;
     if (plen >= 16 && memcmp(pdata, "UPX#", 4) == 0) {
         // decompress pre-compressed stub-loader
@@ -155,11 +272,11 @@ void ElfLinker::init(const void *pdata_v, int plen, unsigned pxtra) {
     }
     input[inputlen] = 0; // NUL terminate
 
-    output_capacity = (inputlen ? (inputlen + pxtra) : 0x4000);
-    assert(output_capacity <= (1 << 16)); // LE16 l_info.l_size
-    output = New(byte, output_capacity);
-    outputlen = 0;
-    NO_printf("\nElfLinker::init %d @%p\n", output_capacity, output);
+    // tables pre-parsed at build time by src/stub/scripts/linktab.py
+    if (inputlen >= 12 && memcmp(input + inputlen - 8, "UPXLNK01", 8) == 0) {
+        preprocessTables(get_le32(input + inputlen - 12));
+        return;
+    }
 
     // FIXME: bad compare when either symbols or relocs are absent
     if ((int) strlen("Sections:\n"
@@ -181,7 +298,6 @@ void ElfLinker::init(const void *pdata_v, int plen, unsigned pxtra) {
             preprocessSymbols(psymbols, (prelocs ? prelocs : eof));
         if (prelocs)
             preprocessRelocations(prelocs, eof);
-        addLoader("*UND*");
     }
 }
 
@@ -297,19 +413,61 @@ void ElfLinker::preprocessRelocations(char *start, char const *end) {
     }
 }
 
+// see "write the tables" in src/stub/scripts/linktab.py
+void ElfLinker::preprocessTables(unsigned pos) {
+    const unsigned end = inputlen - 12; // start of the trailer
+    assert(pos <= end && end - pos >= 16);
+    const byte *p = input + pos;
+    const unsigned nsec = get_le32(p);
+    const unsigned nsym = get_le32(p + 4);
+    const unsigned nrel = get_le32(p + 8);
+    const unsigned strings_size = get_le32(p + 12);
+    p += 16;
+    assert(16 + 16ull * nsec + 12ull * nsym + 24ull * nrel + strings_size == end - pos);
+    char *const strings = (char *) input + end - strings_size;
+    assert(strings_size > 0 && strings[strings_size - 1] == 0);
+#define TABLE_STRING(off) (assert((off) < strings_size), strings + (off))
+
+    unsigned ic;
+    for (ic = 0; ic < nsec; ic++, p += 16) {
+        const unsigned offset = get_le32(p + 4), size = get_le32(p + 8);
+        assert((upx_uint64_t) offset + size <= pos);
+        addSection(TABLE_STRING(get_le32(p)), input + offset, size, get_le32(p + 12));
+    }
+    addSection("*ABS*", nullptr, 0, 0);
+    addSection("*UND*", nullptr, 0, 0);
+    for (ic = 0; ic < nsym; ic++, p += 12) {
+        const unsigned sec = get_le32(p + 4);
+        assert(sec < nsections);
+        addSymbol(TABLE_STRING(get_le32(p)), sections[sec]->name, get_le32(p + 8));
+    }
+    for (ic = 0; ic < nrel; ic++, p += 24) {
+        const unsigned sec = get_le32(p);
+        assert(sec < nsections);
+        addRelocation(sections[sec]->name, get_le32(p + 4), TABLE_STRING(get_le32(p + 8)),
+                      TABLE_STRING(get_le32(p + 12)), get_le64(p + 16));
+    }
+#undef TABLE_STRING
+    assert(p == (const byte *) strings);
+}
+
 ElfLinker::Section *ElfLinker::findSection(const char *name, bool fatal) const {
-    for (unsigned ic = 0; ic < nsections; ic++)
-        if (strcmp(sections[ic]->name, name) == 0)
-            return sections[ic];
+    if (section_index != nullptr) {
+        unsigned slot = *index_find(section_index, section_index_mask, sections, name);
+        if (slot != 0)
+            return sections[slot - 1];
+    }
     if (fatal)
         internal_error("unknown section %s\n", name);
     return nullptr;
 }
 
 ElfLinker::Symbol *ElfLinker::findSymbol(const char *name, bool fatal) const {
-    for (unsigned ic = 0; ic < nsymbols; ic++)
-        if (strcmp(symbols[ic]->name, name) == 0)
-            return symbols[ic];
+    if (symbol_index != nullptr) {
+        unsigned slot = *index_find(symbol_index, symbol_index_mask, symbols, name);
+        if (slot != 0)
+            return symbols[slot - 1];
+    }
     if (fatal)
         internal_error("unknown symbol %s\n", name);
     return nullptr;
@@ -330,6 +488,7 @@ ElfLinker::Section *ElfLinker::addSection(const char *sname, const void *sdata,
     assert(findSection(sname, false) == nullptr);
     Section *sec = new Section(sname, sdata, slen, p2align);
     sections[nsections++] = sec;
+    index_add(&section_index, &section_index_mask, sections, nsections);
     return sec;
 }
 
@@ -345,6 +504,7 @@ ElfLinker::Symbol *ElfLinker::addSymbol(const char *name, const char *section,
     assert(findSymbol(name, false) == nullptr);
     Symbol *sym = new Symbol(name, findSection(section), offset);
     symbols[nsymbols++] = sym;
+    index_add(&symbol_index, &symbol_index_mask, symbols, nsymbols);
     return sym;
 }
 
@@ -911,4 +1071,123 @@ void ElfLinkerX86::relocate1(const Relocation *rel, byte *location, upx_uint64_t
         super::relocate1(rel, location, value, type);
 }
 
+/*************************************************************************
+// test
+**************************************************************************/
+
+TEST_CASE("ElfLinker section index") {
+    ElfLinker linker;
+    char name[32];
+    for (unsigned i = 0; i < 500; i++) {
+        snprintf(name, sizeof(name), "SECT%u", i);
+        (void) linker.addSection(name, "0123456789", i % 10, 0);
+    }
+    bool ok = true;
+    for (unsigned i = 0; i < 500; i++) {
+        snprintf(name, sizeof(name), "SECT%u", i);
+        ok &= (linker.getSectionSize(name) == (int) (i % 10));
+    }
+    CHECK(ok);
+    CHECK_THROWS(linker.getSectionSize("SECT500"));
+}
+
+TEST_CASE("ElfLinker pre-parsed tables") {
+    // section "CODE" = 01 02 03, symbol "sym" = CODE+1, relocation CODE+0 R_X86_64_32 sym
+    static const byte stub[105] = {
+        0x01, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, //
+        0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+        0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+        0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, //
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, //
+        0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+        0x43, 0x4f, 0x44, 0x45, 0x00, 0x73, 0x79, 0x6d, 0x00, 0x52, 0x5f, 0x58, //
+        0x38, 0x36, 0x5f, 0x36, 0x34, 0x5f, 0x33, 0x32, 0x00, 0x04, 0x00, 0x00, //
+        0x00, 0x55, 0x50, 0x58, 0x4c, 0x4e, 0x4b, 0x30, 0x31,
+    };
+    ElfLinker linker;
+    linker.init(stub, (int) sizeof(stub));
+    CHECK(linker.getSectionSize("CODE") == 3);
+    CHECK(linker.getSectionSize("*UND*") == 0);
+    CHECK_THROWS(linker.getSectionSize("sym"));
+    linker.addLoader("CODE");
+    int llen = 0;
+    const byte *loader = linker.getLoader(&llen);
+    CHECK(llen == 3);
+    CHECK(memcmp(loader, stub, 3) == 0);
+}
+
+namespace {
+struct TestStubLinker final : public ElfLinker {
+    void parse(const void *pdata, int plen) { parseStub(pdata, plen); }
+
+    // same tables as x, with the relocation types pointing into the own input
+    bool sameTables(const TestStubLinker &x) const {
+        if (inputlen != x.inputlen || memcmp(input, x.input, inputlen + 1) != 0)
+            return false;
+        if (nsections != x.nsections || nsymbols != x.nsymbols || nrelocations != x.nrelocations)
+            return false;
+        unsigned ic;
+        for (ic = 0; ic < nsections; ic++) {
+            const Section *a = sections[ic], *b = x.sections[ic];
+            if (strcmp(a->name, b->name) != 0 || a->size != b->size || a->p2align != b->p2align ||
+                memcmp(a->input, b->input, a->size) != 0)
+                return false;
+        }
+        for (ic = 0; ic < nsymbols; ic++) {
+            const Symbol *a = symbols[ic], *b = x.symbols[ic];
+            if (strcmp(a->name, b->name) != 0 || strcmp(a->section->name, b->section->name) != 0 ||
+                a->offset != b->offset)
+                return false;
+        }
+        for (ic = 0; ic < nrelocations; ic++) {
+            const Relocation *a = relocations[ic], *b = x.relocations[ic];
+            if (strcmp(a->section->name, b->section->name) != 0 || a->offset != b->offset ||
+                strcmp(a->type, b->type) != 0 || strcmp(a->value->name, b->value->name) != 0 ||
+                a->add != b->add)
+                return false;
+            const char *const in = (const char *) input;
+            if (a->type < in || a->type >= in + inputlen)
+                return false;
+        }
+        return true;
+    }
+};
+} // namespace
+
+TEST_CASE("ElfLinker stub cache") {
+    static const char stub[] =
+        "ABCDEFGH\n"
+        "Sections:\n"
+        "Idx Name          Size      VMA       LMA       File off  Algn\n"
+        "  0 ENTRY         00000004  00000000  00000000  00000000  2**0\n"
+        "  1 CODE          00000004  00000000  00000000  00000004  2**2\n"
+        "SYMBOL TABLE:\n"
+        "00000010 g       *ABS*  00000000 ABSSYM\n"
+        "00000001 l       CODE   00000000 code1\n"
+        "00000000         *UND*  00000000 undef\n"
+        "RELOCATION RECORDS FOR [CODE]:\n"
+        "OFFSET   TYPE              VALUE\n"
+        "00000000 R_X86_64_32       code1+0x00000002\n"
+        "00000002 R_X86_64_PC8      undef-0x00000001\n";
+    const int plen = (int) sizeof(stub) - 1;
+    TestStubLinker fresh;
+    fresh.parse(stub, plen);
+    // the first init() parses the stub into the cache, the second one copies it
+    TestStubLinker first, second;
+    first.init(stub, plen);
+    second.init(stub, plen);
+    CHECK(first.sameTables(fresh));
+    CHECK(second.sameTables(fresh));
+    CHECK(second.sameTables(first));
+    CHECK(second.getSectionSize("ENTRY") == 4);
+    CHECK(second.getSectionSize("CODE") == 4);
+    second.addLoader("ENTRY");
+    second.addLoader("CODE");
+    int llen = 0;
+    const byte *loader = second.getLoader(&llen);
+    CHECK(llen == 8);
+    CHECK(memcmp(loader, stub, 8) == 0);
+    CHECK(second.getSymbolOffset("code1") == 4 + 1);
+}
+
 /* vim:set ts=4 sw=4 et: */
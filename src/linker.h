@@ -61,12 +61,23 @@ protected:
     unsigned nrelocations = 0;
     unsigned nrelocations_capacity = 0;
 
+    // open-addressing hash indices of sections[] and symbols[] by name;
+    // a slot holds (index + 1), or 0 if empty
+    unsigned *section_index = nullptr;
+    unsigned section_index_mask = 0;
+    unsigned *symbol_index = nullptr;
+    unsigned symbol_index_mask = 0;
+
     bool reloc_done = false;
 
 protected:
+    static const ElfLinker *getStubTemplate(const void *pdata, int plen);
+    void parseStub(const void *pdata, int plen);
+    void copyStub(const ElfLinker *tmpl);
     void preprocessSections(char *start, char const *end);
     void preprocessSymbols(char *start, char const *end);
     void preprocessRelocations(char *start, char const *end);
+    void preprocessTables(unsigned pos);
     Section *findSection(const char *name, bool fatal = true) const;
     Symbol *findSymbol(const char *name, bool fatal = true) const;
 
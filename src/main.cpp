@@ -103,7 +103,13 @@ static bool set_eec(int ec, int *eec) {
     return false;
 }
 
-bool main_set_exit_code(int ec) { return set_eec(ec, &exit_code); }
+bool main_set_exit_code(int ec) {
+#if WITH_THREADS
+    static std::mutex exit_code_mutex; // see do_files()
+    std::lock_guard<std::mutex> lock(exit_code_mutex);
+#endif
+    return set_eec(ec, &exit_code);
+}
 
 __acc_static_noinline void e_exit(int ec) {
     if (opt->debug.getopt_throw_instead_of_exit)
@@ -163,7 +169,7 @@ static void check_not_both(bool e1, bool e2, const char *c1, const char *c2) {
 static void check_options(int i, int argc) {
     assert(i <= argc);
 
-    if (opt->cmd != CMD_COMPRESS) {
+    if (opt->cmd != CMD_COMPRESS && opt->cmd != CMD_BENCHMARK) {
         // invalidate compression options
         opt->method = 0;
         opt->level = 0;
@@ -552,6 +558,40 @@ static int do_option(int optc, const char *arg) {
     case 525: // --exact
         opt->exact = true;
         break;
+    case 530: // --threads=
+        getoptvar(&opt->threads, 0, 256, arg);
+        break;
+    case 534: // --memory-limit=
+        getoptvar(&opt->memory_limit, 1u, 1024u * 1024, arg);
+        break;
+    case 535: // --cache-dir=
+        if (!mfx_optarg || !mfx_optarg[0])
+            e_optarg(arg);
+        opt->cache_dir = mfx_optarg;
+        break;
+    case 533: // --rank-filters=
+        getoptvar(&opt->rank_filters, 0, 255, arg);
+        break;
+    case 536: // --rank-methods=
+        getoptvar(&opt->rank_methods, 0, 255, arg);
+        break;
+    case 537: // --entropy-gate=
+        getoptvar(&opt->entropy_gate, 0, 800, arg);
+        break;
+    case 532: // --stats[=json]
+        opt->stats = 1;
+        if (mfx_optarg && strcmp(mfx_optarg, "json") == 0)
+            opt->stats = 2;
+        else if (mfx_optarg && mfx_optarg[0] && strcmp(mfx_optarg, "text") != 0)
+            e_optarg(arg);
+        break;
+    case 531: // --benchmark[=json]
+        set_cmd(CMD_BENCHMARK);
+        if (mfx_optarg && strcmp(mfx_optarg, "json") == 0)
+            opt->benchmark.json = true;
+        else if (mfx_optarg && mfx_optarg[0] && strcmp(mfx_optarg, "text") != 0)
+            e_optarg(arg);
+        break;
     // CRP - Compression Runtime Parameters (undocumented and subject to change)
     case 801:
         getoptvar(&opt->crp.crp_ucl.c_flags, 0, 3, arg);
@@ -777,6 +817,7 @@ int main_get_options(int argc, char **argv) {
         {"fast", 0x10, N, '1'},        // compress faster
         {"fileinfo", 0x10, N, 909},    // display info about file
         {"file-info", 0x10, N, 909},   // display info about file
+        {"benchmark", 0x12, N, 531},   // benchmark the kernels
         {"help", 0, N, 'h' + 256},     // give help
         {"license", 0, N, 'L'},        // display software license
         {"list", 0, N, 'l'},           // list compressed exe
@@ -845,10 +886,17 @@ int main_get_options(int argc, char **argv) {
         // compression settings
         {"all-filters", 0x10, N, 523},
         {"all-methods", 0x10, N, 524},
+        {"cache-dir", 0x31, N, 535}, // --cache-dir=
         {"exact", 0x10, N, 525},  // user requires byte-identical decompression
+        {"entropy-gate", 0x31, N, 537}, // --entropy-gate=
         {"filter", 0x31, N, 521}, // --filter=
+        {"memory-limit", 0x31, N, 534}, // --memory-limit=
         {"no-filter", 0x10, N, 522},
+        {"rank-filters", 0x31, N, 533}, // --rank-filters=
+        {"rank-methods", 0x31, N, 536}, // --rank-methods=
         {"small", 0x10, N, 520},
+        {"stats", 0x12, N, 532},   // --stats[=json]
+        {"threads", 0x31, N, 530}, // --threads=
         // CRP - Compression Runtime Parameters (undocumented and subject to change)
         {"crp-nrv-cf", 0x31, N, 801},
         {"crp-nrv-sl", 0x31, N, 802},
@@ -1010,7 +1058,13 @@ void main_get_envoptions() {
         {"color", 0x10, N, 514},
 
         // compression settings
-        {"exact", 0x10, N, 525}, // user requires byte-identical decompression
+        {"entropy-gate", 0x31, N, 537}, // --entropy-gate=
+        {"exact", 0x10, N, 525},        // user requires byte-identical decompression
+        {"memory-limit", 0x31, N, 534}, // --memory-limit=
+        {"rank-filters", 0x31, N, 533}, // --rank-filters=
+        {"rank-methods", 0x31, N, 536}, // --rank-methods=
+        {"stats", 0x12, N, 532},        // --stats[=json]
+        {"threads", 0x31, N, 530},      // --threads=
 
         // compression method
         {"nrv2b", 0x10, N, 702},   // --nrv2b
@@ -1219,6 +1273,8 @@ int upx_main(int argc, char *argv[]) {
         break;
     case CMD_FILEINFO:
         break;
+    case CMD_BENCHMARK:
+        break;
     case CMD_LICENSE:
         show_license();
         e_exit(EXIT_OK);
@@ -1251,7 +1307,10 @@ int upx_main(int argc, char *argv[]) {
 
     /* start work */
     set_term(stdout);
-    if (do_files(i, argc, argv) != 0)
+    if (opt->cmd == CMD_BENCHMARK) {
+        if (do_benchmark(i, argc, argv) != 0)
+            return exit_code;
+    } else if (do_files(i, argc, argv) != 0)
         return exit_code;
 
     if (gitrev[0]) {
@@ -33,7 +33,7 @@
 //
 **************************************************************************/
 
-static int pr_need_nl = 0;
+static upx_thread_local int pr_need_nl = 0;
 
 void printSetNl(int need_nl) { pr_need_nl = need_nl; }
 
@@ -47,6 +47,10 @@ void printClearLine(FILE *f) {
         msg[81] = 0;
     }
 
+    if (printCaptureActive()) { // nothing to clear
+        printSetNl(0);
+        return;
+    }
     fflush(stdout);
     fflush(stderr);
     if (f == nullptr)
@@ -57,6 +61,8 @@ void printClearLine(FILE *f) {
 }
 
 static void pr_print(bool c, const char *msg) {
+    if (printCaptureAppend(stderr, msg))
+        return;
     if (c && !opt->to_stdout)
         con_fprintf(stderr, "%s", msg);
     else
@@ -152,11 +158,83 @@ void printUnhandledException(const char *iname, const std::exception *e) {
     }
 }
 
+/*************************************************************************
+// capture
+**************************************************************************/
+
+// Captured output is stored as a sequence of chunks; each chunk is
+// one stream tag byte followed by a NUL-terminated string.
+struct PrintCapture final {
+    char *buf = nullptr;
+    size_t len = 0;
+    size_t capacity = 0;
+};
+
+static upx_thread_local PrintCapture *print_capture = nullptr;
+
+PrintCapture *printCaptureBegin() {
+    assert(print_capture == nullptr);
+    print_capture = new PrintCapture;
+    return print_capture;
+}
+
+void printCaptureEnd() { print_capture = nullptr; }
+
+bool printCaptureActive() { return print_capture != nullptr; }
+
+bool printCaptureAppend(FILE *f, const char *s) {
+    PrintCapture *const pc = print_capture;
+    if (pc == nullptr)
+        return false;
+    const size_t n = strlen(s);
+    if (pc->len + 1 + n + 1 > pc->capacity) {
+        size_t new_capacity = UPX_MAX(pc->len + 1 + n + 1, 2 * pc->capacity + 1024);
+        char *p = (char *) realloc(pc->buf, new_capacity);
+        if (p == nullptr)
+            throwOutOfMemoryException();
+        pc->buf = p;
+        pc->capacity = new_capacity;
+    }
+    pc->buf[pc->len++] = (f == stderr) ? 2 : 1;
+    memcpy(pc->buf + pc->len, s, n + 1);
+    pc->len += n + 1;
+    return true;
+}
+
+void printCaptureFlush(PrintCapture *pc) {
+    if (pc == nullptr)
+        return;
+    assert(pc != print_capture);
+    for (size_t i = 0; i < pc->len;) {
+        FILE *f = (pc->buf[i] == 2) ? stderr : stdout;
+        const char *s = pc->buf + i + 1;
+        con_fprintf(f, "%s", s);
+        i += 1 + strlen(s) + 1;
+    }
+    fflush(stdout);
+    fflush(stderr);
+    ::free(pc->buf);
+    delete pc;
+}
+
+TEST_CASE("printCapture") {
+    PrintCapture *pc = printCaptureBegin();
+    CHECK(printCaptureActive());
+    CHECK(printCaptureAppend(stdout, "a"));
+    CHECK(printCaptureAppend(stderr, ""));
+    CHECK(pc->len == 5);
+    printCaptureEnd();
+    CHECK(!printCaptureActive());
+    CHECK(!printCaptureAppend(stdout, "b"));
+    ::free(pc->buf);
+    delete pc;
+}
+
 /*************************************************************************
 // info
 **************************************************************************/
 
-static int info_header = 0;
+static upx_thread_local int info_header = 0;
 
 static void info_print(const char *msg) {
     if (opt->info_mode <= 0)
@@ -28,7 +28,7 @@
 #include "conf.h"
 
 static Options global_options;
-Options *opt = &global_options; // also see class PackMaster
+upx_thread_local Options *opt = &global_options; // also see class PackMaster
 
 #if WITH_THREADS
 std::mutex opt_lock_mutex;
@@ -47,6 +47,7 @@ void Options::reset() {
     o->method = M_NONE;
     o->level = -1;
     o->filter = FT_NONE;
+    o->threads = 1;
 
     o->backup = -1;
     o->overlay = -1;
@@ -159,6 +160,40 @@ TEST_CASE("getopt") {
         CHECK(opt->all_methods_use_lzma == -1);
         CHECK(opt->method == -1);
     }
+    SUBCASE("threads") {
+        const char *a[] = {a0, "--brute", "--threads=4", nullptr};
+        test_options(a);
+        CHECK(opt->all_methods);
+        CHECK(opt->threads == 4);
+    }
+    SUBCASE("rank-filters") {
+        const char *a[] = {a0, "--brute", "--rank-filters=3", nullptr};
+        test_options(a);
+        CHECK(opt->all_filters);
+        CHECK(opt->rank_filters == 3);
+    }
+    SUBCASE("rank-methods") {
+        const char *a[] = {a0, "--brute", "--rank-methods=2", nullptr};
+        test_options(a);
+        CHECK(opt->all_methods);
+        CHECK(opt->rank_methods == 2);
+    }
+    SUBCASE("entropy-gate") {
+        CHECK(opt->entropy_gate == 0);
+        const char *a[] = {a0, "--entropy-gate=799", nullptr};
+        test_options(a);
+        CHECK(opt->entropy_gate == 799);
+    }
+    SUBCASE("memory-limit") {
+        const char *a[] = {a0, "--memory-limit=64", nullptr};
+        test_options(a);
+        CHECK(opt->memory_limit == 64);
+    }
+    SUBCASE("cache-dir") {
+        const char *a[] = {a0, "--best", "--cache-dir=/tmp/upx-cache", nullptr};
+        test_options(a);
+        CHECK(strcmp(opt->cache_dir, "/tmp/upx-cache") == 0);
+    }
 
     opt = saved_opt;
 }
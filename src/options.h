@@ -28,7 +28,7 @@
 #pragma once
 
 struct Options;
-extern Options *opt;      // global options, see class PackMaster for per-file local options
+extern upx_thread_local Options *opt; // see class PackMaster for per-file local options
 #define options_t Options // old name
 
 #if WITH_THREADS
@@ -47,6 +47,7 @@ enum {
     CMD_TEST,
     CMD_LIST,
     CMD_FILEINFO,
+    CMD_BENCHMARK,
     CMD_HELP,
     CMD_LICENSE,
     CMD_VERSION,
@@ -67,9 +68,15 @@ struct Options final {
     bool all_methods; // try all available compression methods ?
     int all_methods_use_lzma;
     bool all_filters; // try all available filters ?
+    int rank_filters; // "--rank-filters=K": only compress the K best ranked filters
+    int rank_methods; // "--rank-methods=K": only compress with the K best predicted methods
+    int entropy_gate; // "--entropy-gate=N": store blocks of >= N/100 bits per byte; 0 = off
     bool no_filter;   // force no filter
     bool prefer_ucl;  // prefer UCL
     bool exact;       // user requires byte-identical decompression
+    int threads;      // number of worker threads for files or trials; 0 means number of CPUs
+    unsigned memory_limit; // "--memory-limit=N": working memory ceiling in MiB; 0 means none
+    const char *cache_dir; // "--cache-dir=DIR": reuse compression results stored in DIR
 
     // other options
     int backup;
@@ -85,6 +92,7 @@ struct Options final {
     bool preserve_ownership;
     bool preserve_timestamp;
     int small;
+    int stats; // "--stats": 1 = text, 2 = json
     int verbose;
     bool to_stdout;
 
@@ -98,6 +106,11 @@ struct Options final {
         bool getopt_throw_instead_of_exit; // for doctest
     } debug;
 
+    // benchmark options
+    struct {
+        bool json; // --benchmark=json
+    } benchmark;
+
     // overlay handling
     enum { SKIP_OVERLAY = 0, COPY_OVERLAY = 1, STRIP_OVERLAY = 2 };
     int overlay;
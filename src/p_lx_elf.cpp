@@ -135,14 +135,33 @@ funpad4(InputFile *fi)
     return d;
 }
 
-static void alloc_file_image(MemBuffer &mb, off_t size)
+// An ET_DYN is parsed from, and later patched in, the whole input file.
+// Map it copy-on-write, so that only the pages which get patched are
+// copied; else read it. Another load() re-reads the file at the same
+// address, so pointers into the image stay valid.
+void ElfFileImage::load(InputFile *f, unsigned size)
 {
     assert(mem_size_valid_bytes(size));
+    f->seek(0, SEEK_SET);
+    if (ptr_map || (!ptr && (upx_off_t)size == f->st_size())) {
+        assert((upx_off_t)size == f->st_size());
+        byte *const p = f->mapImage(ptr_map);
+        if (p) {
+            ptr = ptr_map = p;
+            map_len = size;
+            f->seek(size, SEEK_SET);  // as after readx()
+            return;
+        }
+        if (ptr_map)
+            throwIOException("input file changed");
+    }
     if (mb.getVoidPtr() == nullptr) {
         mb.alloc(size);
     } else {
-        assert((u32_t)size <= mb.getSize());
+        assert(size <= mb.getSize());
     }
+    f->readx(mb, size);
+    ptr = mb;
 }
 
 int
@@ -315,16 +334,12 @@ PackLinuxElf32::PackLinuxElf32help1(InputFile *f)
 
     if (f && Elf32_Ehdr::ET_DYN!=e_type) {
         unsigned const len = sz_phdrs + e_phoff;
-        alloc_file_image(file_image, len);
-        f->seek(0, SEEK_SET);
-        f->readx(file_image, len);
+        file_image.load(f, len);
         phdri= (Elf32_Phdr       *)(e_phoff + file_image);  // do not free() !!
     }
     if (f && Elf32_Ehdr::ET_DYN==e_type) {
         // The DT_SYMTAB has no designated length.  Read the whole file.
-        alloc_file_image(file_image, file_size);
-        f->seek(0, SEEK_SET);
-        f->readx(file_image, file_size);
+        file_image.load(f, file_size);
         phdri= (Elf32_Phdr *)(e_phoff + file_image);  // do not free() !!
         if (opt->cmd != CMD_COMPRESS || !e_shoff ||  file_size < e_shoff) {
             shdri = nullptr;
@@ -928,6 +943,28 @@ void PackLinuxElf::defineSymbols(Filter const *)
     linker->defineSymbol("O_BINFO", (!!opt->o_unix.is_ptinterp) | o_binfo);
 }
 
+// Compressed size of [offset, offset+len) of the input using method,
+// for the --all-methods trial.  ibuf may be smaller than len
+// (see getStreamingBlocksize()), so evaluate it in ibuf-sized windows.
+unsigned PackLinuxElf::trialPackedSize(int method, unsigned offset, unsigned len,
+    Filter &ft, Filter const &orig_ft, PackHeader const &orig_ph)
+{
+    unsigned sz = 0;
+    fi->seek(offset, SEEK_SET);
+    while (len) {
+        unsigned const l = UPX_MIN(len, ibuf.getSize());
+        fi->readx(ibuf, l);
+        ft = orig_ft;
+        ph = orig_ph;
+        ph.method = force_method(method);
+        ph.u_len = l;
+        compressWithFilters(&ft, OVERHEAD, NULL_cconf, 10, true);
+        sz += ph.c_len;
+        len -= l;
+    }
+    return sz;
+}
+
 void PackLinuxElf32::defineSymbols(Filter const *ft)
 {
     PackLinuxElf::defineSymbols(ft);
@@ -1024,16 +1061,12 @@ PackLinuxElf64::PackLinuxElf64help1(InputFile *f)
 
     if (f && Elf64_Ehdr::ET_DYN!=e_type) {
         unsigned const len = sz_phdrs + e_phoff;
-        alloc_file_image(file_image, len);
-        f->seek(0, SEEK_SET);
-        f->readx(file_image, len);
+        file_image.load(f, len);
         phdri= (Elf64_Phdr       *)(e_phoff + file_image);  // do not free() !!
     }
     if (f && Elf64_Ehdr::ET_DYN==e_type) {
         // The DT_SYMTAB has no designated length.  Read the whole file.
-        alloc_file_image(file_image, file_size);
-        f->seek(0, SEEK_SET);
-        f->readx(file_image, file_size);
+        file_image.load(f, file_size);
         phdri= (file_size <= (unsigned)e_phoff) ? nullptr : (Elf64_Phdr *)(e_phoff + file_image);  // do not free() !!
         if (!(opt->cmd == CMD_COMPRESS && e_shoff < (upx_uint64_t)file_size && mb_shdr.getSize() == 0)) {
             shdri = nullptr;
@@ -2599,9 +2632,7 @@ bool PackLinuxElf32::canPack()
 
     if (Elf32_Ehdr::ET_DYN==get_te16(&ehdr->e_type)) {
         // The DT_SYMTAB has no designated length.  Read the whole file.
-        alloc_file_image(file_image, file_size);
-        fi->seek(0, SEEK_SET);
-        fi->readx(file_image, file_size);
+        file_image.load(fi, file_size);
         memcpy(&ehdri, ehdr, sizeof(Elf32_Ehdr));
         phdri= (Elf32_Phdr *)((size_t)e_phoff + file_image);  // do not free() !!
         shdri= (Elf32_Shdr *)((size_t)e_shoff + file_image);  // do not free() !!
@@ -3031,9 +3062,7 @@ PackLinuxElf64::canPack()
 
     if (Elf64_Ehdr::ET_DYN==get_te16(&ehdr->e_type)) {
         // The DT_SYMTAB has no designated length.  Read the whole file.
-        alloc_file_image(file_image, file_size);
-        fi->seek(0, SEEK_SET);
-        fi->readx(file_image, file_size);
+        file_image.load(fi, file_size);
         memcpy(&ehdri, ehdr, sizeof(Elf64_Ehdr));
         phdri= (Elf64_Phdr *)((size_t)e_phoff + file_image);  // do not free() !!
         shdri= (Elf64_Shdr *)((size_t)e_shoff + file_image);  // do not free() !!
@@ -3853,6 +3882,30 @@ void PackLinuxElf32::pack1(OutputFile * /*fo*/, Filter &ft)
     }
     int methods[256];
     unsigned nmethods = prepareMethods(methods, ph.method, getCompressionMethods(M_ALL, ph.level));
+    if (1 < nmethods && 0 < opt->rank_methods) {
+        // "--rank-methods": predict from the largest PT_LOAD
+        unsigned x_offset = 0, x_filesz = 0;
+        Elf32_Phdr const *phdr = phdri;
+        for (unsigned j=0; j < e_phnum; ++phdr, ++j) {
+            if (PT_LOAD32 == get_te32(&phdr->p_type)
+            &&  x_filesz < get_te32(&phdr->p_filesz)) {
+                x_offset = get_te32(&phdr->p_offset);
+                x_filesz = get_te32(&phdr->p_filesz);
+            }
+        }
+        if (x_filesz && fi->canView()) { // sample the mapping, no copy
+            byte const *const p = raw_bytes(fi->view(x_offset, x_filesz), x_filesz);
+            nmethods = rankMethods(methods, nmethods, p, x_filesz, NULL_cconf);
+        }
+        else {
+            x_filesz = UPX_MIN(x_filesz, ibuf.getSize());
+            if (x_filesz) {
+                fi->seek(x_offset, SEEK_SET);
+                fi->readx(ibuf, x_filesz);
+                nmethods = rankMethods(methods, nmethods, ibuf, x_filesz, NULL_cconf);
+            }
+        }
+    }
     if (1 < nmethods) { // Many are available, but we must choose only one
         uip->ui_total_passes += 1;  // the batch for output
         uip->ui_total_passes *= nmethods * (1+ nfilters);  // finding smallest total
@@ -3881,27 +3934,15 @@ void PackLinuxElf32::pack1(OutputFile * /*fo*/, Filter &ft)
                             offset  = xct_off;
                             filesz -= xct_off;
                         }
-                        fi->seek(offset, SEEK_SET);
-                        fi->readx(ibuf, filesz);
-                        ft = orig_ft;
-                        ph = orig_ph;
-                        ph.method = force_method(methods[k]);
-                        ph.u_len = filesz;
-                        compressWithFilters(&ft, OVERHEAD, NULL_cconf, 10, true);
-                        sz_this += ph.c_len;
+                        sz_this += trialPackedSize(methods[k], offset, filesz,
+                            ft, orig_ft, orig_ph);
                     }
                 }
             }
             unsigned const sz_tail = file_size - max_offset;  // debuginfo, etc.
             if (sz_tail) {
-                fi->seek(max_offset, SEEK_SET);
-                fi->readx(ibuf, sz_tail);
-                ft = orig_ft;
-                ph = orig_ph;
-                ph.method = force_method(methods[k]);
-                ph.u_len = sz_tail;
-                compressWithFilters(&ft, OVERHEAD, NULL_cconf, 10, true);
-                sz_this += ph.c_len;
+                sz_this += trialPackedSize(methods[k], max_offset, sz_tail,
+                    ft, orig_ft, orig_ph);
             }
             // FIXME: loader size also depends on method
             if (sz_best > sz_this) {
@@ -4729,6 +4770,30 @@ void PackLinuxElf64::pack1(OutputFile * /*fo*/, Filter &ft)
     }
     int methods[256];
     unsigned nmethods = prepareMethods(methods, ph.method, getCompressionMethods(M_ALL, ph.level));
+    if (1 < nmethods && 0 < opt->rank_methods) {
+        // "--rank-methods": predict from the largest PT_LOAD
+        unsigned x_offset = 0, x_filesz = 0;
+        Elf64_Phdr const *phdr = phdri;
+        for (unsigned j=0; j < e_phnum; ++phdr, ++j) {
+            if (PT_LOAD64 == get_te32(&phdr->p_type)
+            &&  x_filesz < get_te64(&phdr->p_filesz)) {
+                x_offset = get_te64(&phdr->p_offset);
+                x_filesz = get_te64(&phdr->p_filesz);
+            }
+        }
+        if (x_filesz && fi->canView()) { // sample the mapping, no copy
+            byte const *const p = raw_bytes(fi->view(x_offset, x_filesz), x_filesz);
+            nmethods = rankMethods(methods, nmethods, p, x_filesz, NULL_cconf);
+        }
+        else {
+            x_filesz = UPX_MIN(x_filesz, ibuf.getSize());
+            if (x_filesz) {
+                fi->seek(x_offset, SEEK_SET);
+                fi->readx(ibuf, x_filesz);
+                nmethods = rankMethods(methods, nmethods, ibuf, x_filesz, NULL_cconf);
+            }
+        }
+    }
     if (1 < nmethods) { // Many are available, but we must choose only one
         uip->ui_total_passes += 1;  // the batch for output
         uip->ui_total_passes *= nmethods * (1+ nfilters);  // finding smallest total
@@ -4757,27 +4822,15 @@ void PackLinuxElf64::pack1(OutputFile * /*fo*/, Filter &ft)
                             offset  = xct_off;
                             filesz -= xct_off;
                         }
-                        fi->seek(offset, SEEK_SET);
-                        fi->readx(ibuf, filesz);
-                        ft = orig_ft;
-                        ph = orig_ph;
-                        ph.method = force_method(methods[k]);
-                        ph.u_len = filesz;
-                        compressWithFilters(&ft, OVERHEAD, NULL_cconf, 10, true);
-                        sz_this += ph.c_len;
+                        sz_this += trialPackedSize(methods[k], offset, filesz,
+                            ft, orig_ft, orig_ph);
                     }
                 }
             }
             unsigned const sz_tail = file_size - max_offset;  // debuginfo, etc.
             if (sz_tail) {
-                fi->seek(max_offset, SEEK_SET);
-                fi->readx(ibuf, sz_tail);
-                ft = orig_ft;
-                ph = orig_ph;
-                ph.method = force_method(methods[k]);
-                ph.u_len = sz_tail;
-                compressWithFilters(&ft, OVERHEAD, NULL_cconf, 10, true);
-                sz_this += ph.c_len;
+                sz_this += trialPackedSize(methods[k], max_offset, sz_tail,
+                    ft, orig_ft, orig_ph);
             }
             // FIXME: loader size also depends on method
             if (sz_best > sz_this) {
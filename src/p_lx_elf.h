@@ -37,6 +37,27 @@
 typedef upx_uint32_t u32_t;  // easier to type; more narrow
 typedef upx_uint64_t u64_t;  // easier to type; more narrow
 
+// the input file of an ET_DYN, see load() in p_lx_elf.cpp
+class ElfFileImage final
+{
+public:
+    ElfFileImage() noexcept {}
+    ~ElfFileImage() noexcept { InputFile::unmapImage(ptr_map, map_len); }
+    void load(InputFile *f, unsigned size);  // [0, size) of f, as by readx()
+    operator byte *() const noexcept { return ptr; }
+    void *getVoidPtr() const noexcept { return ptr; }
+
+private:
+    byte *ptr = nullptr;
+    byte *ptr_map = nullptr;  // copy-on-write mapping of the whole file
+    upx_off_t map_len = 0;
+    MemBuffer mb;  // else a copy
+
+    // disable copy and assignment
+    ElfFileImage(const ElfFileImage &) = delete;
+    ElfFileImage &operator=(const ElfFileImage &) = delete;
+};
+
 class PackLinuxElf : public PackUnix
 {
     typedef PackUnix super;
@@ -67,6 +88,8 @@ protected:
     virtual void defineSymbols(Filter const *);
     virtual void addStubEntrySections(Filter const *, unsigned m_decompr);
     virtual void unpack(OutputFile *fo) override;
+    unsigned trialPackedSize(int method, unsigned offset, unsigned len,
+        Filter &ft, Filter const &orig_ft, PackHeader const &orig_ph);
     unsigned old_data_off, old_data_len;  // un_shlib
 
     virtual upx_uint64_t elf_unsigned_dynamic(unsigned) const = 0;
@@ -79,7 +102,7 @@ protected:
     unsigned e_phnum;       /* Program header table entry count */
     unsigned e_shnum;
     unsigned e_shstrndx;
-    MemBuffer file_image;   // if ET_DYN investigation
+    ElfFileImage file_image;   // if ET_DYN investigation
     MemBuffer lowmem;  // at least including PT_LOAD[0]
     MemBuffer mb_shdr;      // Shdr might not be near Phdr
     MemBuffer mb_dt_offsets;  // file offset of various DT_ tables
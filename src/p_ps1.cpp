@@ -463,7 +463,7 @@ void PackPs1::pack(OutputFile *fo) {
         relocateLoader();
 
         buildPart2 = true;
-        buildLoader(&ft);
+        callBuildLoader(&ft);
     }
 
     memcpy(&oh, &ih, sizeof(ih));
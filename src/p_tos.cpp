@@ -559,7 +559,7 @@ void PackTos::pack(OutputFile *fo) {
         symbols.copy_to_stack_len = d / 2 - 1;
 
         // now re-build loader
-        buildLoader(&ft);
+        callBuildLoader(&ft);
         unsigned new_lsize = getLoaderSize();
         // printf("buildLoader %d %d\n", new_lsize, initial_lsize);
         assert(new_lsize <= initial_lsize);
@@ -37,6 +37,7 @@
 #include "packer.h"
 #include "p_unix.h"
 #include "p_elf.h"
+#include "ui.h"
 
 // do not change
 #define BLOCKSIZE       (512*1024)
@@ -143,6 +144,69 @@ int PackUnix::getStrategy(Filter &/*ft*/)
     return (opt->no_filter ? -3 : ((opt->filter > 0) ? -2 : 2));
 }
 
+/*************************************************************************
+// Block-parallel compression for pack2() and packExtent(): the main thread
+// reads ahead and writes the blocks in order, while worker threads run the
+// filter and compression trials (see Packer::runFilterTrials()).
+**************************************************************************/
+
+struct PackUnix::BlockJob final {
+    MemBuffer ibuf;  // uncompressed data, as read
+    int len = 0;
+    int filter_strategy = 0;
+    bool gated = false;  // see Packer::isGatedBlock()
+    Filter ft{0};
+    FilterTrials fts;
+    byte *c_ptr = nullptr;  // what a same-filter block compressed, see pack2()
+};
+
+// "--memory-limit": stream the input through smaller blocks. ibuf[],
+// obuf[] and the filtered copy and output buffer of compressWithFilters()
+// each need about one block, so a block gets a quarter of the budget.
+// Every block has its own b_info, so the stubs handle any block size.
+unsigned PackUnix::getStreamingBlocksize(unsigned size) const
+{
+    upx_uint64_t const budget = upx_get_memory_budget(~(upx_uint64_t)0);
+    upx_uint64_t limit = budget / 4;
+    limit = UPX_MAX(limit & ~(upx_uint64_t)0xfff, (upx_uint64_t)64 * 1024);
+    return (size > limit) ? (unsigned) limit : size;
+}
+
+// LZMA is by far the slowest method, and one block is encoded by one
+// thread. So packExtent() splits large extents into blocks of this size,
+// which the block pipeline then compresses in parallel. This costs a little
+// compression ratio, because the dictionary and the probability model start
+// afresh in each block; a block of 16 MiB is at least twice the dictionary
+// size of levels 1..9. The split depends only on the input and the options,
+// never on "--threads", the number of cpus or WITH_THREADS: the threads
+// only schedule the blocks, so the output is the same everywhere.
+// "--all-methods" and "--all-filters" search each block serially anyway.
+unsigned PackUnix::getExtentBlocksize(off_t size) const
+{
+    enum { LZMA_BLOCKSIZE = 16 * 1024 * 1024 };
+    if (M_IS_LZMA(ph.method) && !opt->all_methods && !opt->all_filters
+        && size > 2 * (off_t)LZMA_BLOCKSIZE)
+        return UPX_MIN(blocksize, (unsigned)LZMA_BLOCKSIZE);
+    return blocksize;
+}
+
+// number of blocks in flight; 0 means compress serially
+unsigned PackUnix::getBlockWindow(unsigned nblocks, unsigned nthreads, unsigned bsize) const
+{
+    if (nthreads <= 1 || nblocks <= 1)
+        return 0;
+    // compressWithFilters() runs these many trials for each block in parallel
+    if (opt->all_methods || opt->all_filters)
+        return 0;
+    // the block, plus up to 3 filter trials (see getStrategy()) with their
+    // own input and output buffers
+    upx_uint64_t const job_size = bsize + 3 *
+        (upx_uint64_t(bsize) + MemBuffer::getSizeForCompression(bsize));
+    upx_uint64_t window = UPX_MIN(nblocks, 2 * nthreads);
+    window = UPX_MIN(window, upx_get_memory_budget(1024ull * 1024 * 1024) / job_size);
+    return (window > 1) ? (unsigned) window : 0;
+}
+
 int PackUnix::pack2(OutputFile *fo, Filter &ft)
 {
     // compress blocks
@@ -156,22 +220,25 @@ int PackUnix::pack2(OutputFile *fo, Filter &ft)
 
     unsigned remaining = file_size;
     unsigned n_block = 0;
-    while (remaining > 0)
-    {
-        // FIXME: disable filters if we have more than one block.
-        // FIXME: There is only 1 un-filter in the stub [as of 2002-11-10].
-        // So the next block really has no choice!
-        // This merely prevents an assert() in compressWithFilters(),
+
+    auto read_block = [&](byte *buf, int &filter_strategy) -> int {
+        // There is only 1 un-filter in the stub [as of 2002-11-10].
+        // So only the first block has a free choice of filter, and the
+        // next blocks follow that choice; see compressWithSameFilter().
+        // This also prevents an assert() in compressWithFilters(),
         // which assumes it has free choice on each call [block].
-        // And if the choices aren't the same on each block,
-        // then un-filtering will give incorrect results.
-        int filter_strategy = getStrategy(ft);
-        if (file_size > (off_t)blocksize)
+        filter_strategy = getStrategy(ft);
+        if ((off_t)remaining != file_size)
             filter_strategy = -3;      // no filters
 
-        int l = fi->readx(ibuf, UPX_MIN(blocksize, remaining));
+        int l = fi->readx(buf, UPX_MIN(blocksize, remaining));
         remaining -= l;
+        return l;
+    };
 
+    // compress and write the block in ibuf[]; a gated block is stored;
+    // job holds the work of the block pipeline for this block, if any
+    auto pack_block = [&](int l, int filter_strategy, bool gated, BlockJob *job) {
         // Note: compression for a block can fail if the
         //       file is e.g. blocksize + 1 bytes long
 
@@ -184,12 +251,48 @@ int PackUnix::pack2(OutputFile *fo, Filter &ft)
         // that is, AFTER filtering.  We want BEFORE filtering,
         // so that decompression checks the end-to-end checksum.
         unsigned const end_u_adler = upx_adler32(ibuf, ph.u_len, ph.u_adler);
-        compressWithFilters(&ft, OVERHEAD, NULL_cconf, filter_strategy,
-            !!n_block++);  // check compression ratio only on first block
+        if (gated) {
+            // ft keeps the filter of the previous block for buildLoader()
+            if (!n_block++)
+                throwNotCompressible();
+            ph.saved_u_adler = ph.u_adler;
+            ph.saved_c_adler = ph.c_adler;
+            uip->passCallback(l, l);
+        }
+        else if (n_block && ft.id) {
+            n_block++;
+            bool compressed = false;
+            if (job == nullptr)
+                compressed = compressWithSameFilter(ft, l);
+            else if (job->fts.exc)
+                std::rethrow_exception(job->fts.exc);
+            else if (job->c_ptr == nullptr)
+                uip->passCallback(l, l);
+            else {
+                // already filtered and compressed by a worker thread
+                FilterTrials const &fts = job->fts;
+                uip->passCallback(l, fts.ph.c_len);
+                ph.filter = fts.ph.filter;
+                ph.filter_cto = fts.ph.filter_cto;
+                ph.n_mru = fts.ph.n_mru;
+                ph_rechain(ph, fts.ph, fts.compressed, job->c_ptr, fts.t_obufs);
+                if (ph.c_len < ph.u_len)
+                    memcpy(obuf, fts.t_obufs, ph.c_len);
+                compressed = fts.compressed;
+            }
+            if (!compressed) {
+                ph.c_len = ph.u_len;
+                ph.saved_c_adler = ph.c_adler;
+            }
+        }
+        else {
+            compressWithFilters(&ft, OVERHEAD, NULL_cconf, filter_strategy,
+                !!n_block++);  // check compression ratio only on first block
+        }
 
         if (ph.c_len < ph.u_len) {
             const upx_bytep tbuf = nullptr;
-            if (ft.id == 0) tbuf = ibuf;
+            if (ph.filter == 0) tbuf = ibuf;
             ph.overlap_overhead = OVERHEAD;
             if (!testOverlappingDecompression(obuf, tbuf, ph.overlap_overhead)) {
                 // not in-place compressible
@@ -228,6 +331,81 @@ int PackUnix::pack2(OutputFile *fo, Filter &ft)
 
         total_in += ph.u_len;
         total_out += ph.c_len;
+    };
+
+    // the first block chooses the filter for all blocks
+    if (remaining > 0) {
+        int filter_strategy;
+        int l = read_block(ibuf, filter_strategy);
+        pack_block(l, filter_strategy, isGatedBlock(ibuf, l), nullptr);
+    }
+
+    unsigned const nthreads = upx_get_nthreads(opt->threads);
+    unsigned const nblocks = remaining ? 1 + (remaining - 1) / blocksize : 0;
+    unsigned const window = getBlockWindow(nblocks, nthreads, blocksize);
+    if (window > 1) {
+        BlockJob *const jobs = new BlockJob[window];
+        auto produce = [&](unsigned i) {
+            BlockJob &job = jobs[i % window];
+            if (job.ibuf.getSize() == 0)
+                job.ibuf.alloc(blocksize);
+            job.len = read_block(job.ibuf, job.filter_strategy);
+            job.ft = ft;
+            job.ft.buf_len = job.len;
+            job.fts.ph = ph;
+            job.fts.ph.overlap_overhead = 0;
+            job.fts.ph.c_len = job.fts.ph.u_len = job.len;
+        };
+        auto work = [&](unsigned i) {
+            BlockJob &job = jobs[i % window];
+            job.gated = isGatedBlock(job.ibuf, job.len);
+            if (job.gated)
+                return;
+            if (job.ft.id == 0) {
+                runFilterTrials(&job.fts, job.ibuf, job.len, 0, nullptr, 0, &job.ft, OVERHEAD,
+                                NULL_cconf, job.filter_strategy);
+                return;
+            }
+            // the filter of the first block, see compressWithSameFilter()
+            FilterTrials &fts = job.fts;
+            fts.exc = nullptr;
+            fts.compressed = false;
+            try {
+                if (fts.t_ibufs.getSize() < (unsigned) job.len) {
+                    fts.t_ibufs.dealloc();
+                    fts.t_ibufs.alloc(blocksize);
+                }
+                if (fts.t_obufs.getSize() == 0)
+                    fts.t_obufs.allocForCompression(blocksize);
+                job.c_ptr = filterLikeFirstBlock(fts.ph, job.ft, job.ibuf, fts.t_ibufs, job.len);
+                if (job.c_ptr != nullptr)
+                    fts.compressed = compress(fts.ph, job.c_ptr, job.len, fts.t_obufs,
+                                              NULL_cconf, nullptr);
+            } catch (...) {
+                fts.exc = std::current_exception();
+            }
+        };
+        auto consume = [&](unsigned i) {
+            BlockJob &job = jobs[i % window];
+            memcpy(ibuf, job.ibuf, job.len);
+            if (!job.gated && job.ft.id == 0)
+                pending_trials = &job.fts;
+            pack_block(job.len, job.filter_strategy, job.gated, &job);
+        };
+        try {
+            upx_parallel_pipeline(nblocks, nthreads, window, produce, work, consume);
+        } catch (...) {
+            pending_trials = nullptr;
+            delete[] jobs;
+            throw;
+        }
+        delete[] jobs;
+    }
+    while (remaining > 0)
+    {
+        int filter_strategy;
+        int l = read_block(ibuf, filter_strategy);
+        pack_block(l, filter_strategy, isGatedBlock(ibuf, l), nullptr);
     }
 
     // update header with totals
@@ -241,6 +419,60 @@ int PackUnix::pack2(OutputFile *fo, Filter &ft)
     return 1;  // default: write end-of-compression bhdr next
 }
 
+// The stub un-filters every compressed block with the filter and cto
+// that the first block chose in compressWithFilters(). So a later block
+// must use exactly that filter: filter i_ptr[] into f_ptr[] and set the
+// filter of xph; return what to compress, or nullptr if the block must be
+// stored. Thread-safe; the block pipeline of pack2() calls this.
+byte *PackUnix::filterLikeFirstBlock(PackHeader &xph, Filter const &ft, byte *i_ptr,
+                                     byte *f_ptr, unsigned len) const
+{
+    Filter fb(xph.level);
+    fb.init(ft.id, ft.addvalue);
+    int preferred_ctos[2] = { ft.cto, -1 };
+    fb.preferred_ctos = preferred_ctos;
+    memcpy(f_ptr, i_ptr, len);
+    optimizeFilter(&fb, f_ptr, len);
+    if (fb.filter(f_ptr, len) && fb.cto == ft.cto && fb.n_mru == ft.n_mru) {
+        xph.filter = fb.id;
+        xph.filter_cto = fb.cto;
+        xph.n_mru = fb.n_mru;
+        return f_ptr;
+    }
+    // e.g. the cto byte is in use as an opcode.  "upx -d" unfilters each
+    // block by its b_ftid, but the execve stub applies its one unfilter to
+    // every compressed block.  So compress the block without the filter
+    // only if that unfilter leaves it unchanged; else store it.
+    Filter fu(xph.level);
+    fu.init(ft.id, ft.addvalue);
+    fu.cto = ft.cto;
+    fu.n_mru = ft.n_mru;
+    memcpy(f_ptr, i_ptr, len);
+    fu.unfilter(f_ptr, len);
+    if (memcmp(f_ptr, i_ptr, len) != 0)
+        return nullptr;
+    xph.filter = 0;
+    xph.filter_cto = 0;
+    xph.n_mru = 0;
+    return i_ptr;
+}
+
+// compress ibuf[] into obuf[] with the filter of the first block, or
+// return false if the block must be stored
+bool PackUnix::compressWithSameFilter(Filter const &ft, unsigned len)
+{
+    if (fbuf.getSize() < len) {
+        fbuf.dealloc();
+        fbuf.alloc(blocksize);  // reused by all blocks
+    }
+    byte *const c_ptr = filterLikeFirstBlock(ph, ft, ibuf, fbuf, len);
+    if (c_ptr == nullptr) {
+        uip->passCallback(len, len);
+        return false;
+    }
+    return compress(c_ptr, len, obuf);
+}
+
 void
 PackUnix::patchLoaderChecksum()
 {
@@ -261,7 +493,7 @@ off_t PackUnix::pack3(OutputFile *fo, Filter &ft)
         // If no filter, then linker is not constructed by side effect
         // of packExtent calling compressWithFilters.
         // This is typical after "/usr/bin/patchelf --set-rpath".
-        buildLoader(&ft);
+        callBuildLoader(&ft);
     }
     upx_byte *p = getLoader();
     lsize = getLoaderSize();
@@ -293,6 +525,7 @@ void PackUnix::pack(OutputFile *fo)
         blocksize = BLOCKSIZE;
     if ((off_t)blocksize > file_size)
         blocksize = file_size;
+    blocksize = getStreamingBlocksize(blocksize);
 
     // init compression buffers
     ibuf.alloc(blocksize);
@@ -339,6 +572,7 @@ void PackUnix::packExtent(
 {
     unsigned const init_u_adler = ph.u_adler;
     unsigned const init_c_adler = ph.c_adler;
+    unsigned const init_hdr_u_len = hdr_u_len;
     MemBuffer hdr_ibuf;
     if (hdr_u_len) {
         hdr_ibuf.alloc(hdr_u_len);
@@ -347,14 +581,19 @@ void PackUnix::packExtent(
         (void)l;
     }
     fi->seek(x.offset, SEEK_SET);
-    for (off_t rest = x.size; 0 != rest; ) {
-        int const filter_strategy = ft ? getStrategy(*ft) : 0;
-        int l = fi->readx(ibuf, UPX_MIN(rest, (off_t)blocksize));
-        if (l == 0) {
-            break;
-        }
+    off_t rest = x.size;
+    unsigned const xblocksize = getExtentBlocksize(x.size);
+
+    auto read_block = [&](byte *buf, int &filter_strategy) -> int {
+        filter_strategy = ft ? getStrategy(*ft) : 0;
+        int l = fi->readx(buf, UPX_MIN(rest, (off_t)xblocksize));
         rest -= l;
+        return l;
+    };
 
+    // compress and write the block in ibuf[]; fts are the results of
+    // runFilterTrials() for this block, if any; a gated block is stored
+    auto pack_block = [&](int l, int filter_strategy, FilterTrials *fts, bool gated) {
         // Note: compression for a block can fail if the
         //       file is e.g. blocksize + 1 bytes long
 
@@ -368,16 +607,36 @@ void PackUnix::packExtent(
             // so that decompression checks the end-to-end checksum.
             end_u_adler = upx_adler32(ibuf, ph.u_len, ph.u_adler);
             ft->buf_len = l;
-
+        }
+        if (gated) {
+            // *ft keeps the filter of the previous block for buildLoader();
+            // without ft (e.g. a gap between PT_LOADs) the block is just stored
+            if (ft && !inhibit_compression_check)
+                throwNotCompressible();
+            if (!ft)
+                ph.u_adler = upx_adler32(ibuf, ph.u_len, ph.u_adler);
+            uip->passCallback(l, l);
+        }
+        else if (ft) {
                 // compressWithFilters() requirements?
             ph.filter = 0;
             ph.filter_cto = 0;
             ft->id = 0;
             ft->cto = 0;
 
+            pending_trials = fts;
             compressWithFilters(ft, OVERHEAD, NULL_cconf, filter_strategy,
                                 0, 0, 0, hdr_ibuf, hdr_u_len, inhibit_compression_check);
         }
+        else if (fts && fts->ph.method == ph.method && fts->ph.level == ph.level) {
+            // already compressed by a worker thread
+            if (fts->exc)
+                std::rethrow_exception(fts->exc);
+            uip->passCallback(l, fts->ph.c_len);
+            ph_rechain(ph, fts->ph, fts->compressed, ibuf, fts->t_obufs);
+            if (ph.c_len < ph.u_len)
+                memcpy(obuf, fts->t_obufs, ph.c_len);
+        }
         else {
             (void) compress(ibuf, ph.u_len, obuf);    // ignore return value
         }
@@ -460,7 +719,205 @@ void PackUnix::packExtent(
         }
 
         total_in += ph.u_len;
+    };
+
+    unsigned const nthreads = upx_get_nthreads(opt->threads);
+    unsigned const nblocks = (unsigned) ((rest + xblocksize - 1) / xblocksize);
+    unsigned const window = getBlockWindow(nblocks, nthreads, xblocksize);
+    if (window > 1) {
+        BlockJob *const jobs = new BlockJob[window];
+        auto produce = [&](unsigned i) {
+            BlockJob &job = jobs[i % window];
+            if (job.ibuf.getSize() == 0)
+                job.ibuf.alloc(xblocksize);
+            job.len = read_block(job.ibuf, job.filter_strategy);
+            if (ft) {
+                job.ft = *ft;
+                job.ft.id = 0;
+                job.ft.cto = 0;
+                job.ft.buf_len = job.len;
+            }
+            job.fts.ph = ph;
+            job.fts.ph.overlap_overhead = 0;
+            job.fts.ph.c_len = job.fts.ph.u_len = job.len;
+            job.fts.ph.filter = 0;
+            job.fts.ph.filter_cto = 0;
+        };
+        auto work = [&](unsigned i) {
+            BlockJob &job = jobs[i % window];
+            job.gated = isGatedBlock(job.ibuf, job.len);
+            if (!job.gated) {
+                // the header goes with the first block, see pack_block()
+                bool const with_hdr = (i == 0 && init_hdr_u_len != 0);
+                runFilterTrials(&job.fts, job.ibuf, job.len, 0,
+                                with_hdr ? (const byte *) hdr_ibuf : nullptr,
+                                with_hdr ? init_hdr_u_len : 0, ft ? &job.ft : nullptr, OVERHEAD,
+                                NULL_cconf, job.filter_strategy);
+            }
+        };
+        auto consume = [&](unsigned i) {
+            BlockJob &job = jobs[i % window];
+            memcpy(ibuf, job.ibuf, job.len);
+            pack_block(job.len, job.filter_strategy, &job.fts, job.gated);
+        };
+        try {
+            upx_parallel_pipeline(nblocks, nthreads, window, produce, work, consume);
+        } catch (...) {
+            pending_trials = nullptr;
+            delete[] jobs;
+            throw;
+        }
+        delete[] jobs;
+    }
+    while (0 != rest) {
+        int filter_strategy;
+        int l = read_block(ibuf, filter_strategy);
+        if (l == 0) {
+            break;
+        }
+        pack_block(l, filter_strategy, nullptr, isGatedBlock(ibuf, l));
+    }
+}
+
+/*************************************************************************
+// Block-parallel decompression for unpackExtent(): the main thread reads
+// the b_info headers and the compressed data and writes the blocks in
+// order, while worker threads decompress, unfilter and checksum them.
+**************************************************************************/
+
+struct PackUnix::UnpackJob final {
+    MemBuffer cbuf;            // compressed data, unless viewed from the file
+    MemBuffer ubuf;            // uncompressed data
+    const byte *cpr = nullptr;
+    const byte *out = nullptr; // ubuf, or cpr if the block was stored
+    unsigned u_len = 0;
+    unsigned c_len = 0;
+    unsigned ftid = 0;         // filter to undo, or 0
+    unsigned cto = 0;
+    unsigned c_adler = 0;      // checksums of this block alone
+    unsigned u_adler = 0;
+    std::exception_ptr exc;    // rethrown when writing this block
+};
+
+// Handles the leading blocks of unpackExtent() which are well-formed and
+// fully wanted; the caller does the rest serially (and so reports errors
+// exactly as before). Returns the number of uncompressed bytes done.
+unsigned PackUnix::unpackExtentParallel(unsigned wanted, OutputFile *fo,
+    unsigned &c_adler, unsigned &u_adler, bool &first_PF_X)
+{
+    unsigned const nthreads = upx_get_nthreads(opt->threads);
+    if (nthreads <= 1 || wanted <= blocksize)
+        return 0;
+
+    // walk the b_info chain up front
+    b_info hdr; memset(&hdr, 0, sizeof(hdr));
+    upx_off_t const pos = fi->tell();
+    unsigned nblocks = 0;
+    unsigned rest = wanted;
+    while (rest && fi->tell() + szb_info <= fi->st_size()) {
+        fi->readx(&hdr, szb_info);
+        int const sz_unc = get_te32(&hdr.sz_unc);
+        int const sz_cpr = get_te32(&hdr.sz_cpr);
+        if (sz_unc <= 0 || sz_cpr <= 0 || sz_cpr > sz_unc || sz_unc > (int)blocksize)
+            break;
+        if (rest < (unsigned)sz_unc || fi->tell() + sz_cpr > fi->st_size())
+            break;
+        fi->seek(sz_cpr, SEEK_CUR);
+        rest -= sz_unc;
+        nblocks++;
+    }
+    fi->seek(pos, SEEK_SET);
+    unsigned window = UPX_MIN(nblocks, 2 * nthreads);
+    window = (unsigned) UPX_MIN(upx_uint64_t(window), upx_get_memory_budget(1024u * 1024 * 1024) /
+                                                          (2 * (blocksize + OVERHEAD)));
+    if (nblocks <= 1 || window <= 1)
+        return 0;
+
+    const PackHeader orig_ph = ph; // method and level of all blocks
+    unsigned done = 0;
+    UnpackJob *const jobs = new UnpackJob[window];
+    auto produce = [&](unsigned i) {
+        UnpackJob &job = jobs[i % window];
+        fi->readx(&hdr, szb_info);
+        int const sz_unc = ph.u_len = get_te32(&hdr.sz_unc);
+        int const sz_cpr = ph.c_len = get_te32(&hdr.sz_cpr);
+        ph.filter_cto = hdr.b_cto8;
+        job.u_len = sz_unc;
+        job.c_len = sz_cpr;
+        job.ftid = 0;
+        job.cto = hdr.b_cto8;
+        if (sz_cpr < sz_unc) { // same choice of filter as in unpackExtent()
+            if (12==szb_info)
+                job.ftid = hdr.b_ftid;
+            else if (first_PF_X)
+                first_PF_X = false;
+            else
+                job.ftid = ph.filter;
+        }
+        if (fi->canView()) {
+            job.cpr = raw_bytes(fi->viewx(sz_cpr), sz_cpr);
+        }
+        else {
+            if (job.cbuf.getSize() == 0)
+                job.cbuf.alloc(blocksize);
+            fi->readx(job.cbuf, sz_cpr);
+            job.cpr = job.cbuf;
+        }
+        total_in += sz_cpr;
+    };
+    auto work = [&](unsigned i) {
+        UnpackJob &job = jobs[i % window];
+        job.exc = nullptr;
+        try {
+            unsigned const sz_unc = job.u_len;
+            job.c_adler = upx_adler32(job.cpr, job.c_len);
+            job.out = job.cpr;
+            if (job.c_len < sz_unc) {
+                if (job.ubuf.getSize() == 0)
+                    job.ubuf.alloc(blocksize + OVERHEAD);
+                {
+                    UiStats::Scope timer(uip->stats, UiStats::PH_DECOMPRESS, sz_unc);
+                    PackHeader block_ph = orig_ph;
+                    block_ph.u_len = sz_unc;
+                    block_ph.c_len = job.c_len;
+                    ph_decompress(block_ph, job.cpr, job.ubuf, false, nullptr);
+                }
+                if (job.ftid) {
+                    Filter ft(orig_ph.level);
+                    ft.init(job.ftid, 0);
+                    ft.cto = (unsigned char) job.cto;
+                    ft.unfilter(job.ubuf, sz_unc);
+                }
+                job.out = job.ubuf;
+            }
+            job.u_adler = upx_adler32(job.out, sz_unc);
+        } catch (...) {
+            job.exc = std::current_exception();
+        }
+    };
+    auto consume = [&](unsigned i) {
+        UnpackJob &job = jobs[i % window];
+        if (job.exc)
+            std::rethrow_exception(job.exc);
+        unsigned const sz_unc = job.u_len;
+        c_adler = upx_adler32_combine(c_adler, job.c_adler, job.c_len);
+        u_adler = upx_adler32_combine(u_adler, job.u_adler, sz_unc);
+        if (fo) {
+            fo->write(job.out, sz_unc);
+            total_out += sz_unc;
+        }
+        if (i + 1 == nblocks) // leave ibuf[] as the serial loop does
+            memcpy(ibuf, job.out, sz_unc);
+        done += sz_unc;
+    };
+    try {
+        upx_parallel_pipeline(nblocks, nthreads, window, produce, work, consume);
+    } catch (...) {
+        delete[] jobs;
+        throw;
     }
+    delete[] jobs;
+    return done;
 }
 
 // Consumes b_info header block and sz_cpr data block from input file 'fi'.
@@ -475,6 +932,8 @@ unsigned PackUnix::unpackExtent(unsigned wanted, OutputFile *fo,
 {
     b_info hdr; memset(&hdr, 0, sizeof(hdr));
     unsigned inlen = 0; // output index (if-and-only-if peeking)
+    if (!is_rewrite) // write, or "upx -t"
+        wanted -= unpackExtentParallel(wanted, fo, c_adler, u_adler, first_PF_X);
     while (wanted) {
         fi->readx(&hdr, szb_info);
         int const sz_unc = ph.u_len = get_te32(&hdr.sz_unc);
@@ -493,13 +952,20 @@ unsigned PackUnix::unpackExtent(unsigned wanted, OutputFile *fo,
         // place the input for overlapping de-compression
         // FIXME: inlen cheats OVERHEAD; assumes small wanted peek length
         int j = inlen + blocksize + OVERHEAD - sz_cpr;
-        fi->readx(ibuf+j, sz_cpr);
+        const byte *cpr;
+        if (fi->canView()) { // decompress directly from the file mapping
+            cpr = raw_bytes(fi->viewx(sz_cpr), sz_cpr);
+        }
+        else {
+            fi->readx(ibuf+j, sz_cpr);
+            cpr = raw_index_bytes(ibuf, j, sz_cpr);
+        }
         total_in += sz_cpr;
         // update checksum of compressed data
-        c_adler = upx_adler32(ibuf + j, sz_cpr, c_adler);
+        c_adler = upx_adler32(cpr, sz_cpr, c_adler);
 
         if (sz_cpr < sz_unc) { // block was compressed
-            decompress(ibuf+j, ibuf+inlen, false);
+            decompress(cpr, ibuf+inlen, false);
             if (12==szb_info) { // modern per-block filter
                 if (hdr.b_ftid) {
                     Filter ft(ph.level);  // FIXME: ph.level for b_info?
@@ -521,7 +987,7 @@ unsigned PackUnix::unpackExtent(unsigned wanted, OutputFile *fo,
             }
         }
         else if (sz_cpr == sz_unc) { // slide literal (non-compressible) block
-            memmove(&ibuf[inlen], &ibuf[j], sz_unc);
+            memmove(&ibuf[inlen], cpr, sz_unc);
         }
         // update checksum of uncompressed data
         u_adler = upx_adler32(ibuf + inlen, sz_unc, u_adler);
@@ -698,4 +1164,270 @@ void PackUnix::unpack(OutputFile *fo)
         throwChecksumError();
 }
 
+/*************************************************************************
+// test
+**************************************************************************/
+
+namespace {
+// pack2() of a raw file with the filters of the i386 execve format, and
+// a fake loader; this runs on every host
+class TestUnixPacker final : public PackUnix {
+public:
+    explicit TestUnixPacker(InputFile *f) : PackUnix(f) {
+        bele = &N_BELE_RTP::le_policy;
+        initPackHeader();
+        ph.method = M_NRV2B_LE32;
+        ph.level = 1;
+        blocksize = 16384;
+        ibuf.alloc(blocksize);
+        obuf.allocForCompression(blocksize);
+    }
+    virtual int getFormat() const override { return UPX_F_LINUX_i386; }
+    virtual const char *getName() const override { return "test"; }
+    virtual const char *getFullName(const Options *) const override { return "test"; }
+    virtual const int *getCompressionMethods(int, int) const override { return nullptr; }
+    virtual const int *getFilters() const override {
+        static const int filters[] = {0x49, 0x46, FT_END};
+        return filters;
+    }
+    virtual int getLoaderSize() const override { return 1024; }
+    const UiStats *getStats() const { return uip->stats; }
+    // the block size of pack() for a file of this size
+    unsigned setBlocksize(unsigned size) {
+        blocksize = getStreamingBlocksize(size);
+        ibuf.alloc(blocksize);
+        obuf.allocForCompression(blocksize);
+        return blocksize;
+    }
+    // returns the filter of the first block
+    int run(OutputFile *fo) {
+        Filter ft(ph.level);
+        ft.addvalue = 0;
+        pack2(fo, ft);
+        return ft.id;
+    }
+
+protected:
+    virtual Linker *newLinker() const override { return nullptr; }
+    virtual void buildLoader(const Filter *) override {}
+    virtual void patchLoader() override {}
+    virtual void updateLoader(OutputFile *) override {}
+};
+
+// "call target; mov %eax,%ebx; nop" to a few targets
+void fill_calls(byte *buf, unsigned len) {
+    memset(buf, 0x90, len);
+    for (unsigned pos = 0; pos + 8 <= len; pos += 8) {
+        const unsigned target = 0x1000 * (1 + (pos / 8 * 7) % 13);
+        buf[pos] = 0xe8;
+        set_le32(buf + pos + 1, target - (pos + 5));
+        buf[pos + 5] = 0x89;
+        buf[pos + 6] = 0xc3;
+    }
+}
+
+// decode the blocks of a pack2() output o[] into u[]; a filtered block
+// must use filter ftid; returns the number of bytes decoded
+unsigned unpack2(const byte *o, unsigned o_len, byte *u, unsigned u_len, int ftid,
+                 unsigned *nblocks, unsigned *nfiltered) {
+    unsigned pos = 0, done = 0;
+    *nblocks = *nfiltered = 0;
+    while (pos + 12 <= o_len && done < u_len) {
+        const unsigned sz_unc = get_le32(o + pos);
+        const unsigned sz_cpr = get_le32(o + pos + 4);
+        const int method = o[pos + 8];
+        const int id = o[pos + 9];
+        const int cto = o[pos + 10];
+        pos += 12;
+        CHECK((sz_unc <= u_len - done && sz_cpr <= sz_unc && pos + sz_cpr <= o_len));
+        if (sz_unc > u_len - done || sz_cpr > sz_unc || pos + sz_cpr > o_len)
+            break;
+        if (sz_cpr < sz_unc) {
+            unsigned n = sz_unc;
+            CHECK(upx_decompress(o + pos, sz_cpr, u + done, &n, method, nullptr) == UPX_E_OK);
+            CHECK(n == sz_unc);
+            if (id != 0) {
+                CHECK(id == ftid);
+                Filter fu(1);
+                fu.init(id, 0);
+                fu.cto = (unsigned char) cto;
+                fu.unfilter(u + done, sz_unc);
+                *nfiltered += 1;
+            }
+        } else
+            memcpy(u + done, o + pos, sz_unc);
+        pos += sz_cpr;
+        done += sz_unc;
+        *nblocks += 1;
+    }
+    return done;
+}
+
+// read and remove a file
+void read_unlink(const char *name, MemBuffer &mb) {
+    InputFile f;
+    f.open(name, O_RDONLY | O_BINARY);
+    mb.alloc(f.st_size());
+    f.readx(mb, (int) f.st_size());
+    f.closex();
+    FileBase::unlink(name);
+}
+} // namespace
+
+TEST_CASE("PackUnix::pack2 same filter") {
+    // every later block uses the filter of the first block, with and
+    // without the block pipeline, and each block unfilters by its b_info
+    Options *const saved_opt = opt;
+    Options local_options;
+    opt = &local_options;
+    opt->reset();
+    opt->verbose = 0;
+    const char *const iname = "upx-test-pack2.tmp";
+    const char *const onames[2] = {"upx-test-pack2-1.tmp", "upx-test-pack2-4.tmp"};
+    const unsigned len = 4 * 16384 + 100;
+    MemBuffer buf(len);
+    fill_calls(buf, len);
+    OutputFile::dump(iname, buf, len);
+    int ftids[2];
+    MemBuffer obufs[2];
+    for (int k = 0; k < 2; k++) {
+        opt->threads = k ? 4 : 1;
+        {
+            InputFile fi;
+            fi.open(iname, O_RDONLY | O_BINARY);
+            OutputFile fo;
+            fo.open(onames[k], O_CREAT | O_WRONLY | O_TRUNC | O_BINARY, 0600);
+            TestUnixPacker p(&fi);
+            ftids[k] = p.run(&fo);
+            fo.closex();
+            fi.closex();
+        }
+        read_unlink(onames[k], obufs[k]);
+    }
+    FileBase::unlink(iname);
+    CHECK(ftids[0] != 0);
+    CHECK(ftids[1] == ftids[0]);
+    CHECK(obufs[1].getSize() == obufs[0].getSize());
+    CHECK(memcmp(obufs[1], obufs[0], UPX_MIN(obufs[0].getSize(), obufs[1].getSize())) == 0);
+
+    MemBuffer u(len);
+    unsigned nblocks, nfiltered;
+    CHECK(unpack2(obufs[0], obufs[0].getSize(), u, len, ftids[0], &nblocks, &nfiltered) == len);
+    CHECK(memcmp(u, buf, len) == 0);
+    CHECK(nfiltered >= 2); // not just the first block
+    opt = saved_opt;
+}
+
+TEST_CASE("PackUnix::getStreamingBlocksize") {
+    // "--memory-limit": a block gets a quarter of the budget, and the
+    // smaller blocks still pack and decode
+    Options *const saved_opt = opt;
+    Options local_options;
+    opt = &local_options;
+    opt->reset();
+    opt->verbose = 0;
+    const char *const iname = "upx-test-limit.tmp";
+    const char *const oname = "upx-test-limit-out.tmp";
+    const unsigned len = 600 * 1024 + 100;
+    MemBuffer buf(len);
+    fill_calls(buf, len);
+    OutputFile::dump(iname, buf, len);
+    MemBuffer o;
+    {
+        InputFile fi;
+        fi.open(iname, O_RDONLY | O_BINARY);
+        TestUnixPacker p(&fi);
+        CHECK(p.setBlocksize(len) == len); // no limit
+        opt->memory_limit = 3;
+        CHECK(p.setBlocksize(4 * 1024 * 1024) == 3 * 1024 * 1024 / 4);
+        opt->memory_limit = 2;
+        CHECK(p.setBlocksize(1000) == 1000);
+        opt->memory_limit = 1;
+        CHECK(p.setBlocksize(len) == 256 * 1024);
+        OutputFile fo;
+        fo.open(oname, O_CREAT | O_WRONLY | O_TRUNC | O_BINARY, 0600);
+        p.run(&fo);
+        fo.closex();
+        fi.closex();
+    }
+    read_unlink(oname, o);
+    FileBase::unlink(iname);
+    opt = saved_opt;
+    MemBuffer u(len);
+    unsigned nblocks, nfiltered;
+    CHECK(unpack2(o, o.getSize(), u, len, o[9], &nblocks, &nfiltered) == len);
+    CHECK(nblocks == 3);
+    CHECK(memcmp(u, buf, len) == 0);
+}
+
+TEST_CASE("PackUnix::pack2 entropy gate") {
+    // a random second block is stored without any compression trial, with
+    // and without the block pipeline, and the gate stats count its bytes
+    Options *const saved_opt = opt;
+    Options local_options;
+    opt = &local_options;
+    opt->reset();
+    opt->verbose = 0;
+    opt->stats = 1;
+    opt->entropy_gate = 790;
+    const char *const iname = "upx-test-gate.tmp";
+    const char *const oname = "upx-test-gate-out.tmp";
+    const unsigned len = 2 * 16384;
+    MemBuffer buf(len);
+    fill_calls(buf, 16384);
+    upx_uint32_t x = 12345;
+    for (unsigned i = 16384; i < len; i++) {
+        x = x * 1103515245 + 12345;
+        buf[i] = (byte) (x >> 23);
+    }
+    // k == 0: the first block only; k == 1, 2: both blocks
+    unsigned compress_count[3], gate_count[3];
+    upx_uint64_t compress_bytes[3], gate_bytes[3];
+    unsigned second_unc[3] = {}, second_cpr[3] = {};
+    for (int k = 0; k < 3; k++) {
+        opt->threads = k == 2 ? 4 : 1;
+        OutputFile::dump(iname, buf, k ? len : 16384);
+        {
+            InputFile fi;
+            fi.open(iname, O_RDONLY | O_BINARY);
+            OutputFile fo;
+            fo.open(oname, O_CREAT | O_WRONLY | O_TRUNC | O_BINARY, 0600);
+            TestUnixPacker p(&fi);
+            p.run(&fo);
+            fo.closex();
+            fi.closex();
+            const UiStats *const stats = p.getStats();
+            CHECK(stats != nullptr);
+            if (stats == nullptr)
+                break;
+            compress_count[k] = stats->getCount(UiStats::PH_COMPRESS);
+            compress_bytes[k] = stats->getBytes(UiStats::PH_COMPRESS);
+            gate_count[k] = stats->getCount(UiStats::PH_GATE);
+            gate_bytes[k] = stats->getBytes(UiStats::PH_GATE);
+        }
+        MemBuffer o;
+        read_unlink(oname, o);
+        // the b_info of the second block follows the first block
+        const unsigned pos = 12 + get_le32(o + 4);
+        if (k && pos + 12 <= o.getSize()) {
+            second_unc[k] = get_le32(o + pos);
+            second_cpr[k] = get_le32(o + pos + 4);
+            CHECK(memcmp(o + pos + 12, buf + 16384, 16384) == 0);
+        }
+    }
+    FileBase::unlink(iname);
+    opt = saved_opt;
+    CHECK(compress_count[0] > 0);
+    CHECK(gate_count[0] == 0);
+    CHECK(gate_bytes[0] == 0);
+    for (int k = 1; k < 3; k++) {
+        CHECK(compress_count[k] == compress_count[0]);
+        CHECK(compress_bytes[k] == compress_bytes[0]);
+        CHECK(gate_count[k] == 1);
+        CHECK(gate_bytes[k] == 16384);
+        CHECK(second_unc[k] == 16384);
+        CHECK(second_cpr[k] == 16384);
+    }
+}
+
 /* vim:set ts=4 sw=4 et: */
@@ -83,11 +83,23 @@ protected:
         Filter *, OutputFile *,
         unsigned hdr_len = 0, unsigned b_extra = 0 ,
         bool inhibit_compression_check = false);
+    // block-parallel compression, see pack2()
+    struct BlockJob;
+    unsigned getBlockWindow(unsigned nblocks, unsigned nthreads, unsigned bsize) const;
+    unsigned getStreamingBlocksize(unsigned size) const;
+    unsigned getExtentBlocksize(off_t size) const;
+    bool compressWithSameFilter(Filter const &ft, unsigned len);  // see pack2()
+    byte *filterLikeFirstBlock(PackHeader &xph, Filter const &ft, byte *i_ptr,
+        byte *f_ptr, unsigned len) const;
     virtual unsigned unpackExtent(unsigned wanted, OutputFile *fo,
         unsigned &c_adler, unsigned &u_adler,
         bool first_PF_X,
         int is_rewrite = false  // 0(false): write; 1(true): rewrite; -1: no write
         );
+    // block-parallel decompression, see unpackExtent()
+    struct UnpackJob;
+    unsigned unpackExtentParallel(unsigned wanted, OutputFile *fo,
+        unsigned &c_adler, unsigned &u_adler, bool &first_PF_X);
     unsigned total_in, total_out;  // unpack
 
     int exetype;
@@ -100,6 +112,7 @@ protected:
     MemBuffer pt_dynamic;
     int sz_dynamic;
 
+    MemBuffer fbuf;  // scratch for compressWithSameFilter()
     unsigned b_len;  // total length of b_info blocks
     unsigned methods_used;  // bitmask of compression methods
     unsigned szb_info;  // 3*4 (sizeof b_info); or 2*4 if ancient
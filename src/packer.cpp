@@ -93,14 +93,18 @@ void Packer::assertPacker() const {
 
 void Packer::doPack(OutputFile *fo) {
     uip->uiPackStart(fo);
+    fo->stats = uip->stats;
     pack(fo);
     uip->uiPackEnd(fo);
+    fo->stats = nullptr;
 }
 
 void Packer::doUnpack(OutputFile *fo) {
     uip->uiUnpackStart(fo);
+    fo->stats = uip->stats;
     unpack(fo);
     uip->uiUnpackEnd(fo);
+    fo->stats = nullptr;
 }
 
 void Packer::doTest() {
@@ -180,125 +184,177 @@ int forced_method(int method) // extract the forced method
 // compress - wrap call to low-level upx_compress()
 **************************************************************************/
 
+// cconf_parm (if any) and the "--crp-*" options for this method
+static void ph_initCompressConfig(upx_compress_config_t *cconf,
+                                  const upx_compress_config_t *cconf_parm, int method) {
+    cconf->reset();
+    if (cconf_parm)
+        *cconf = *cconf_parm;
+    if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) {
+        if (opt->crp.crp_ucl.c_flags != -1)
+            cconf->conf_ucl.c_flags = opt->crp.crp_ucl.c_flags;
+        if (opt->crp.crp_ucl.p_level != -1)
+            cconf->conf_ucl.p_level = opt->crp.crp_ucl.p_level;
+        if (opt->crp.crp_ucl.h_level != -1)
+            cconf->conf_ucl.h_level = opt->crp.crp_ucl.h_level;
+        if (opt->crp.crp_ucl.max_offset != UINT_MAX &&
+            opt->crp.crp_ucl.max_offset < cconf->conf_ucl.max_offset)
+            cconf->conf_ucl.max_offset = opt->crp.crp_ucl.max_offset;
+        if (opt->crp.crp_ucl.max_match != UINT_MAX &&
+            opt->crp.crp_ucl.max_match < cconf->conf_ucl.max_match)
+            cconf->conf_ucl.max_match = opt->crp.crp_ucl.max_match;
+    }
+    if (M_IS_LZMA(method)) {
+        oassign(cconf->conf_lzma.pos_bits, opt->crp.crp_lzma.pos_bits);
+        oassign(cconf->conf_lzma.lit_pos_bits, opt->crp.crp_lzma.lit_pos_bits);
+        oassign(cconf->conf_lzma.lit_context_bits, opt->crp.crp_lzma.lit_context_bits);
+        oassign(cconf->conf_lzma.dict_size, opt->crp.crp_lzma.dict_size);
+        oassign(cconf->conf_lzma.num_fast_bytes, opt->crp.crp_lzma.num_fast_bytes);
+    }
+    if (M_IS_DEFLATE(method)) {
+        oassign(cconf->conf_zlib.mem_level, opt->crp.crp_zlib.mem_level);
+        oassign(cconf->conf_zlib.window_bits, opt->crp.crp_zlib.window_bits);
+        oassign(cconf->conf_zlib.strategy, opt->crp.crp_zlib.strategy);
+    }
+}
+
 bool Packer::compress(SPAN_P(byte) i_ptr, unsigned i_len, SPAN_P(byte) o_ptr,
                       const upx_compress_config_t *cconf_parm) {
-    ph.u_len = i_len;
-    ph.c_len = 0;
-    assert(ph.level >= 1);
-    assert(ph.level <= 10);
+    return compress(ph, i_ptr, i_len, o_ptr, cconf_parm, uip);
+}
+
+// Does not touch this->ph or this->uip (except for the thread-safe
+// uip->stats), so this may get called from multiple threads.
+// Pass ui == nullptr to disable progress callbacks.
+// A result larger than max_c_len (if not 0) is useless to the caller, so the
+// compressor may give up early; compress() then returns false.
+bool Packer::compress(PackHeader &xph, SPAN_P(byte) i_ptr, unsigned i_len, SPAN_P(byte) o_ptr,
+                      const upx_compress_config_t *cconf_parm, UiPacker *ui,
+                      unsigned max_c_len) const {
+    xph.u_len = i_len;
+    xph.c_len = 0;
+    assert(xph.level >= 1);
+    assert(xph.level <= 10);
 
     // Avoid too many progress bar updates. 64 is s->bar_len in ui.cpp.
-    unsigned step = (ph.u_len < 64 * 1024) ? 0 : ph.u_len / 64;
+    unsigned step = (xph.u_len < 64 * 1024) ? 0 : xph.u_len / 64;
 
     // save current checksums
-    ph.saved_u_adler = ph.u_adler;
-    ph.saved_c_adler = ph.c_adler;
+    xph.saved_u_adler = xph.u_adler;
+    xph.saved_c_adler = xph.c_adler;
     // update checksum of uncompressed data
-    ph.u_adler = upx_adler32(raw_bytes(i_ptr, ph.u_len), ph.u_len, ph.u_adler);
+    xph.u_adler = upx_adler32(raw_bytes(i_ptr, xph.u_len), xph.u_len, xph.u_adler);
 
     // set compression parameters
     upx_compress_config_t cconf;
-    cconf.reset();
-    if (cconf_parm)
-        cconf = *cconf_parm;
-    // cconf options
-    int method = forced_method(ph.method);
-    if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) {
-        if (opt->crp.crp_ucl.c_flags != -1)
-            cconf.conf_ucl.c_flags = opt->crp.crp_ucl.c_flags;
-        if (opt->crp.crp_ucl.p_level != -1)
-            cconf.conf_ucl.p_level = opt->crp.crp_ucl.p_level;
-        if (opt->crp.crp_ucl.h_level != -1)
-            cconf.conf_ucl.h_level = opt->crp.crp_ucl.h_level;
-        if (opt->crp.crp_ucl.max_offset != UINT_MAX &&
-            opt->crp.crp_ucl.max_offset < cconf.conf_ucl.max_offset)
-            cconf.conf_ucl.max_offset = opt->crp.crp_ucl.max_offset;
-        if (opt->crp.crp_ucl.max_match != UINT_MAX &&
-            opt->crp.crp_ucl.max_match < cconf.conf_ucl.max_match)
-            cconf.conf_ucl.max_match = opt->crp.crp_ucl.max_match;
+    int method = forced_method(xph.method);
+    ph_initCompressConfig(&cconf, cconf_parm, method);
 #if (WITH_NRV)
-        if (ph.level >= 7 || (ph.level >= 4 && ph.u_len >= 512 * 1024))
+    if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method))
+        if (xph.level >= 7 || (xph.level >= 4 && xph.u_len >= 512 * 1024))
             step = 0;
 #endif
+    if (max_c_len != 0 && (cconf.max_c_len == 0 || max_c_len < cconf.max_c_len))
+        cconf.max_c_len = max_c_len;
+    if (ui != nullptr) {
+        if (ui->ui_pass >= 0)
+            ui->ui_pass++;
+        ui->startCallback(xph.u_len, step, ui->ui_pass, ui->ui_total_passes);
+        ui->firstCallback();
     }
-    if (M_IS_LZMA(method)) {
-        oassign(cconf.conf_lzma.pos_bits, opt->crp.crp_lzma.pos_bits);
-        oassign(cconf.conf_lzma.lit_pos_bits, opt->crp.crp_lzma.lit_pos_bits);
-        oassign(cconf.conf_lzma.lit_context_bits, opt->crp.crp_lzma.lit_context_bits);
-        oassign(cconf.conf_lzma.dict_size, opt->crp.crp_lzma.dict_size);
-        oassign(cconf.conf_lzma.num_fast_bytes, opt->crp.crp_lzma.num_fast_bytes);
-    }
-    if (M_IS_DEFLATE(method)) {
-        oassign(cconf.conf_zlib.mem_level, opt->crp.crp_zlib.mem_level);
-        oassign(cconf.conf_zlib.window_bits, opt->crp.crp_zlib.window_bits);
-        oassign(cconf.conf_zlib.strategy, opt->crp.crp_zlib.strategy);
-    }
-    if (uip->ui_pass >= 0)
-        uip->ui_pass++;
-    uip->startCallback(ph.u_len, step, uip->ui_pass, uip->ui_total_passes);
-    uip->firstCallback();
 
-    // OutputFile::dump("data.raw", in, ph.u_len);
+    // OutputFile::dump("data.raw", in, xph.u_len);
 
     // compress
-    int r = upx_compress(raw_bytes(i_ptr, ph.u_len), ph.u_len, raw_bytes(o_ptr, 0), &ph.c_len,
-                         uip->getCallback(), method, ph.level, &cconf, &ph.compress_result);
-
-    // uip->finalCallback(ph.u_len, ph.c_len);
-    uip->endCallback();
+    UiStats *const stats = uip->stats;
+    const UiStats::Timer timer(stats != nullptr);
+    int r = upx_compress(raw_bytes(i_ptr, xph.u_len), xph.u_len, raw_bytes(o_ptr, 0), &xph.c_len,
+                         ui ? ui->getCallback() : nullptr, method, xph.level, &cconf,
+                         &xph.compress_result);
+    if (stats != nullptr)
+        stats->addTrial(timer, method, xph.filter, xph.level, xph.u_len, xph.c_len);
+
+    // ui->finalCallback(xph.u_len, xph.c_len);
+    if (ui != nullptr)
+        ui->endCallback();
 
     if (r == UPX_E_OUT_OF_MEMORY)
         throwOutOfMemoryException();
+    if (r == UPX_E_NOT_COMPRESSIBLE && cconf.max_c_len != 0)
+        return false; // over budget
     if (r != UPX_E_OK)
         throwInternalError("compression failed");
 
     if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) {
-        const ucl_uint *res = ph.compress_result.result_ucl.result;
-        // ph.min_offset_found = res[0];
-        ph.max_offset_found = res[1];
-        // ph.min_match_found = res[2];
-        ph.max_match_found = res[3];
-        // ph.min_run_found = res[4];
-        ph.max_run_found = res[5];
-        ph.first_offset_found = res[6];
-        // ph.same_match_offsets_found = res[7];
+        const ucl_uint *res = xph.compress_result.result_ucl.result;
+        // xph.min_offset_found = res[0];
+        xph.max_offset_found = res[1];
+        // xph.min_match_found = res[2];
+        xph.max_match_found = res[3];
+        // xph.min_run_found = res[4];
+        xph.max_run_found = res[5];
+        xph.first_offset_found = res[6];
+        // xph.same_match_offsets_found = res[7];
         if (cconf_parm) {
             assert(cconf.conf_ucl.max_offset == 0 ||
-                   cconf.conf_ucl.max_offset >= ph.max_offset_found);
-            assert(cconf.conf_ucl.max_match == 0 || cconf.conf_ucl.max_match >= ph.max_match_found);
+                   cconf.conf_ucl.max_offset >= xph.max_offset_found);
+            assert(cconf.conf_ucl.max_match == 0 ||
+                   cconf.conf_ucl.max_match >= xph.max_match_found);
         }
     }
 
-    NO_printf("\nPacker::compress: %d/%d: %7d -> %7d\n", method, ph.level, ph.u_len, ph.c_len);
-    if (!checkCompressionRatio(ph.u_len, ph.c_len))
+    NO_printf("\nPacker::compress: %d/%d: %7d -> %7d\n", method, xph.level, xph.u_len, xph.c_len);
+    if (!checkCompressionRatio(xph.u_len, xph.c_len))
         return false;
     // return in any case if not compressible
-    if (ph.c_len >= ph.u_len)
+    if (xph.c_len >= xph.u_len)
         return false;
 
     // update checksum of compressed data
-    ph.c_adler = upx_adler32(raw_bytes(o_ptr, ph.c_len), ph.c_len, ph.c_adler);
+    xph.c_adler = upx_adler32(raw_bytes(o_ptr, xph.c_len), xph.c_len, xph.c_adler);
     // Decompress and verify. Skip this when using the fastest level.
-    if (!ph_skipVerify(ph)) {
+    if (!ph_skipVerify(xph)) {
+        UiStats::Scope verify_timer(stats, UiStats::PH_VERIFY, xph.u_len);
         // decompress
-        unsigned new_len = ph.u_len;
-        r = upx_decompress(raw_bytes(o_ptr, ph.c_len), ph.c_len, raw_bytes(i_ptr, ph.u_len),
-                           &new_len, method, &ph.compress_result);
+        unsigned new_len = xph.u_len;
+        r = upx_decompress(raw_bytes(o_ptr, xph.c_len), xph.c_len, raw_bytes(i_ptr, xph.u_len),
+                           &new_len, method, &xph.compress_result);
         if (r == UPX_E_OUT_OF_MEMORY)
             throwOutOfMemoryException();
-        // printf("%d %d: %d %d %d\n", method, r, ph.c_len, ph.u_len, new_len);
+        // printf("%d %d: %d %d %d\n", method, r, xph.c_len, xph.u_len, new_len);
         if (r != UPX_E_OK)
             throwInternalError("decompression failed");
-        if (new_len != ph.u_len)
+        if (new_len != xph.u_len)
             throwInternalError("decompression failed (size error)");
 
         // verify decompression
-        if (ph.u_adler != upx_adler32(raw_bytes(i_ptr, ph.u_len), ph.u_len, ph.saved_u_adler))
+        if (xph.u_adler != upx_adler32(raw_bytes(i_ptr, xph.u_len), xph.u_len, xph.saved_u_adler))
             throwInternalError("decompression failed (checksum error)");
     }
     return true;
 }
 
+// xph holds the result of compress() on an older copy of ph: update ph
+// as if compress() had been called on it; see Packer::runFilterTrials()
+void ph_rechain(PackHeader &ph, const PackHeader &xph, bool compressed, const byte *i_ptr,
+                const byte *o_ptr) {
+    ph.u_len = xph.u_len;
+    ph.c_len = xph.c_len;
+    ph.compress_result = xph.compress_result;
+    const int method = forced_method(xph.method);
+    if (M_IS_NRV2B(method) || M_IS_NRV2D(method) || M_IS_NRV2E(method)) {
+        ph.max_offset_found = xph.max_offset_found;
+        ph.max_match_found = xph.max_match_found;
+        ph.max_run_found = xph.max_run_found;
+        ph.first_offset_found = xph.first_offset_found;
+    }
+    ph.saved_u_adler = ph.u_adler;
+    ph.saved_c_adler = ph.c_adler;
+    ph.u_adler = upx_adler32(i_ptr, ph.u_len, ph.u_adler);
+    if (compressed)
+        ph.c_adler = upx_adler32(o_ptr, ph.c_len, ph.c_adler);
+}
+
 bool Packer::checkDefaultCompressionRatio(unsigned u_len, unsigned c_len) const {
     assert((int) u_len > 0);
     assert((int) c_len > 0);
@@ -365,6 +421,7 @@ void ph_decompress(PackHeader &ph, SPAN_P(const byte) in, SPAN_P(byte) out, bool
 }
 
 void Packer::decompress(SPAN_P(const byte) in, SPAN_P(byte) out, bool verify_checksum, Filter *ft) {
+    UiStats::Scope timer(uip->stats, UiStats::PH_DECOMPRESS, ph.u_len);
     ph_decompress(ph, in, out, verify_checksum, ft);
 }
 
@@ -428,7 +485,8 @@ void Packer::verifyOverlappingDecompression(Filter *ft) {
     if (offset + ph.c_len > obuf.getSize())
         return;
     memmove(obuf + offset, obuf, ph.c_len);
-    decompress(obuf + offset, obuf, true, ft);
+    UiStats::Scope timer(uip->stats, UiStats::PH_VERIFY, ph.u_len);
+    ph_decompress(ph, obuf + offset, obuf, true, ft);
     obuf.checkState();
 }
 
@@ -441,12 +499,17 @@ void Packer::verifyOverlappingDecompression(byte *o_ptr, unsigned o_size, Filter
     if (offset + ph.c_len > o_size)
         return;
     memmove(o_ptr + offset, o_ptr, ph.c_len);
-    decompress(o_ptr + offset, o_ptr, true, ft);
+    UiStats::Scope timer(uip->stats, UiStats::PH_VERIFY, ph.u_len);
+    ph_decompress(ph, o_ptr + offset, o_ptr, true, ft);
 }
 
 /*************************************************************************
-// Find overhead for in-place decompression in a heuristic way
-// (using a binary search). Return 0 on error.
+// Find overhead for in-place decompression.
+//
+// The decompressor first reports the smallest safe overlap in a single
+// instrumented pass (upx_find_overlap), and we verify that value with
+// one real overlapping decompression. Methods without such support and
+// failed verifications fall back to a binary search. Return 0 on error.
 //
 // To speed up things:
 //   - you can pass the range of an acceptable interval (so that
@@ -454,25 +517,39 @@ void Packer::verifyOverlappingDecompression(byte *o_ptr, unsigned o_size, Filter
 //   - you can enforce an upper_limit (so that we can fail early)
 **************************************************************************/
 
-unsigned Packer::findOverlapOverhead(const byte *buf, const byte *tbuf, unsigned range,
-                                     unsigned upper_limit) const {
-    assert((int) range >= 0);
-
-    // prepare to deal with very pessimistic values
-    unsigned low = 1;
-    unsigned high = UPX_MIN(ph.u_len + 512, upper_limit);
-    // but be optimistic for first try (speedup)
-    unsigned m = UPX_MIN(16u, high);
-    //
+// returns the estimated overlap_overhead, or 0 if not available
+static unsigned ph_estimateOverlapOverhead(const PackHeader &ph, const byte *buf) {
+    if (ph.c_len >= ph.u_len)
+        return 0;
+    unsigned src_off = 0;
+    unsigned new_len = ph.u_len;
+    int r = upx_find_overlap(buf, ph.c_len, &new_len, &src_off, forced_method(ph.method),
+                             &ph.compress_result);
+    if (r == UPX_E_OUT_OF_MEMORY)
+        throwOutOfMemoryException();
+    if (r != UPX_E_OK || new_len != ph.u_len)
+        return 0;
+    // see ph_testOverlappingDecompression() for the extra bytes
+    unsigned extra = 0;
+    if (M_IS_NRV2B(ph.method) || M_IS_NRV2D(ph.method) || M_IS_NRV2E(ph.method))
+        extra = 3;
     unsigned overhead = 0;
-    unsigned nr = 0; // statistics
+    if (src_off + ph.c_len > ph.u_len)
+        overhead = src_off + ph.c_len - ph.u_len;
+    return UPX_MAX(overhead + extra, 5 + extra);
+}
 
+// binary search for the smallest overhead in [low .. high], starting at m;
+// overhead is a known good value above high, or 0
+static unsigned ph_searchOverlapOverhead(const PackHeader &ph, const byte *buf, const byte *tbuf,
+                                         unsigned range, unsigned low, unsigned high, unsigned m,
+                                         unsigned overhead, unsigned &nr) {
     while (high >= low) {
         assert(m >= low);
         assert(m <= high);
         assert(m < overhead || overhead == 0);
         nr++;
-        bool success = testOverlappingDecompression(buf, tbuf, m);
+        bool success = ph_testOverlappingDecompression(ph, buf, tbuf, m);
         // printf("testOverlapOverhead(%d): %d %d: %d -> %d\n", nr, low, high, m, (int)success);
         if (success) {
             overhead = m;
@@ -488,15 +565,63 @@ unsigned Packer::findOverlapOverhead(const byte *buf, const byte *tbuf, unsigned
         ////m = (low + high) / 2;
         m = (low & high) + ((low ^ high) >> 1); // avoid overflow
     }
+    return overhead;
+}
+
+static unsigned ph_findOverlapOverhead(const PackHeader &ph, const byte *buf, const byte *tbuf,
+                                       unsigned range, unsigned upper_limit,
+                                       unsigned *ntests = nullptr) {
+    assert((int) range >= 0);
+
+    // prepare to deal with very pessimistic values
+    unsigned low = 1;
+    unsigned high = UPX_MIN(ph.u_len + 512, upper_limit);
+    // but be optimistic for first try (speedup)
+    unsigned m = UPX_MIN(16u, high);
+    //
+    unsigned overhead = 0;
+    unsigned nr = 0; // statistics
+
+    const unsigned estimate = ph_estimateOverlapOverhead(ph, buf);
+    if (estimate != 0 && estimate <= high) {
+        nr++;
+        if (ph_testOverlappingDecompression(ph, buf, tbuf, estimate)) {
+            // The estimate is good, but a pessimistic tracker may have
+            // overshot. As in the binary search below, accept it if the
+            // value "range" (or 1) below fails; else search below that.
+            const unsigned below = estimate - UPX_MAX(range, 1u);
+            nr++;
+            if (below >= estimate || !ph_testOverlappingDecompression(ph, buf, tbuf, below)) {
+                if (ntests != nullptr)
+                    *ntests = nr;
+                return estimate;
+            }
+            overhead = below;
+            high = below - 1;
+        } else {
+            // the estimate was too optimistic, so continue the search above it
+            low = estimate + 1;
+        }
+        m = (low & high) + ((low ^ high) >> 1);
+    }
+
+    overhead = ph_searchOverlapOverhead(ph, buf, tbuf, range, low, high, m, overhead, nr);
 
     // printf("findOverlapOverhead: %d (%d tries)\n", overhead, nr);
     if (overhead == 0)
         throwInternalError("this is an oo bug");
 
-    UNUSED(nr);
+    if (ntests != nullptr)
+        *ntests = nr;
     return overhead;
 }
 
+unsigned Packer::findOverlapOverhead(const byte *buf, const byte *tbuf, unsigned range,
+                                     unsigned upper_limit) const {
+    UiStats::Scope timer(uip->stats, UiStats::PH_OVERLAP, ph.u_len);
+    return ph_findOverlapOverhead(ph, buf, tbuf, range, upper_limit, &timer.count);
+}
+
 /*************************************************************************
 // file i/o utils
 **************************************************************************/
@@ -678,6 +803,13 @@ bool Packer::getPackHeader(const void *b, int blen, bool allow_incompressible) {
 
 bool Packer::readPackHeader(int len, bool allow_incompressible) {
     assert(len > 0);
+    if (fi->canView()) {
+        const upx_off_t pos = fi->tell();
+        len = (int) UPX_MIN((upx_off_t) len, UPX_MAX(fi->st_size() - pos, (upx_off_t) 0));
+        if (len <= 0)
+            return false;
+        return getPackHeader(raw_bytes(fi->viewx(len), len), len, allow_incompressible);
+    }
     MemBuffer buf(len);
     len = fi->read(buf, len);
     if (len <= 0)
@@ -950,7 +1082,24 @@ int Packer::getLoaderSectionStart(const char *name, int *slen) const {
     return ostart;
 }
 
+// All calls of buildLoader() go through here, so "--stats" times each
+// loader build exactly once. A relocateLoader() made by buildLoader()
+// belongs to PH_LOADER and is not counted again as PH_RELOCATE.
+void Packer::callBuildLoader(const Filter *ft) {
+    UiStats::Scope timer(uip->stats, UiStats::PH_LOADER);
+    const bool saved = in_build_loader;
+    in_build_loader = true;
+    try {
+        buildLoader(ft);
+    } catch (...) {
+        in_build_loader = saved;
+        throw;
+    }
+    in_build_loader = saved;
+}
+
 void Packer::relocateLoader() {
+    UiStats::Scope timer(in_build_loader ? nullptr : uip->stats, UiStats::PH_RELOCATE);
     linker->relocate();
 
 #if 0
@@ -1037,6 +1186,104 @@ int Packer::prepareMethods(int *methods, int ph_method, const int *all_methods)
     return nmethods;
 }
 
+/*************************************************************************
+// rankMethods
+//
+// "--rank-methods=K": instead of compressing a large input once per
+// method, compress a few slices spread over the input with every method
+// and extrapolate. Only the K smallest methods then proceed to the full
+// compression, so "--all-methods" on a large image costs little more than
+// K full compressions.
+**************************************************************************/
+
+int Packer::rankMethods(int *methods, int nmethods, const byte *i_ptr, unsigned i_len,
+                        const upx_compress_config_t *cconf_parm) const {
+    enum { NSLICES = 4, SLICE_LEN = 256 * 1024, MIN_LEN = 2 * NSLICES * SLICE_LEN };
+    const int top = opt->rank_methods;
+    if (top <= 0 || nmethods <= top || i_len < MIN_LEN)
+        return nmethods;
+
+    // compress the slices in parallel; ~0u means "failed"
+    const unsigned ntasks = nmethods * NSLICES;
+    unsigned c_lens[256 * NSLICES];
+    const int level = ph.level;
+    auto task = [&](unsigned i) {
+        const int method = forced_method(methods[i / NSLICES]);
+        const unsigned slice = i % NSLICES;
+        // the slices start at 0, 1/4, 1/2 and 3/4 of the input
+        const unsigned off = (i_len / NSLICES) * slice;
+        c_lens[i] = ~0u;
+        try {
+            MemBuffer o_buf;
+            o_buf.allocForCompression(SLICE_LEN);
+            unsigned c_len = o_buf.getSize();
+            // the same parameters as the full compression in compress()
+            upx_compress_config_t cconf;
+            ph_initCompressConfig(&cconf, cconf_parm, method);
+            int r = upx_compress(i_ptr + off, SLICE_LEN, o_buf, &c_len, nullptr, method, level,
+                                 &cconf, nullptr);
+            if (r == UPX_E_OK)
+                c_lens[i] = c_len;
+        } catch (...) {
+        }
+    };
+    upx_parallel_for(ntasks, upx_get_nthreads(opt->threads), task);
+    upx_uint64_t sizes[256];
+    for (int mm = 0; mm < nmethods; mm++) {
+        sizes[mm] = 0;
+        for (unsigned slice = 0; slice < NSLICES; slice++) {
+            const unsigned c_len = c_lens[mm * NSLICES + slice];
+            sizes[mm] += (c_len == ~0u) ? unsigned(SLICE_LEN) : c_len;
+        }
+        NO_printf("rankMethods: %#x %llu\n", methods[mm], (unsigned long long) sizes[mm]);
+    }
+
+    // select the best ones; ties go to the method which comes first
+    bool keep[256];
+    for (int mm = 0; mm < nmethods; mm++)
+        keep[mm] = false;
+    for (int k = 0; k < top; k++) {
+        int best = -1;
+        for (int mm = 0; mm < nmethods; mm++)
+            if (!keep[mm] && (best < 0 || sizes[mm] < sizes[best]))
+                best = mm;
+        keep[best] = true;
+    }
+
+    // keep the original order of the selected methods
+    int n = 0;
+    for (int mm = 0; mm < nmethods; mm++)
+        if (keep[mm])
+            methods[n++] = methods[mm];
+    return n;
+}
+
+/*************************************************************************
+// isGatedBlock
+//
+// "--entropy-gate=N": a block whose order-0 entropy is at least N/100
+// bits per byte (already compressed or encrypted data) is stored right
+// away, without running any compressor or the overlap test on it.
+// The gate is off by default: an order-0 estimate cannot see the LZ
+// redundancy of e.g. a repeated compressed asset. Small blocks rarely
+// reach a gate like 799, as their entropy estimate is too low.
+//
+// Thread-safe; the block pipelines call this from the worker threads.
+**************************************************************************/
+
+bool Packer::isGatedBlock(const byte *i_ptr, unsigned i_len) const {
+    const int gate = opt->entropy_gate;
+    if (gate <= 0 || i_len == 0)
+        return false;
+    UiStats::Scope timer(uip->stats, UiStats::PH_GATE, 0);
+    timer.count = 0;
+    if (upx_byte_entropy(i_ptr, i_len) * 100 < gate)
+        return false;
+    timer.bytes = i_len;
+    timer.count = 1;
+    return true;
+}
+
 static int prepareFilters(int *filters, int &filter_strategy, const int *all_filters) {
     int nfilters = 0;
 
@@ -1091,6 +1338,251 @@ done:
     return nfilters;
 }
 
+// one method/filter trial of the parallel search in compressWithFilters()
+struct Packer::FilterTrial final {
+    PackHeader ph;
+    Filter ft{0};
+    unsigned task_id = 0;     // method index * nfilters + filter index
+    byte *ibuf_ptr = nullptr; // private copy of i_ptr[], filtered
+    byte *obuf_ptr = nullptr; // compressed data
+    bool success = false;     // filter success
+    bool compressed = false;  // compress() success
+    bool reused = false;      // filtered data from an earlier trial, see FilterVariants
+    std::exception_ptr exc;   // rethrown when evaluating this trial
+
+    void run(const Packer *p, const PackHeader &orig_ph, const Filter &orig_ft, int method,
+             int filter, const byte *i_ptr, unsigned i_len, unsigned f_off, unsigned f_len,
+             const upx_compress_config_t *cconf, unsigned max_c_len = 0) noexcept;
+    void reuse(const Packer *p, const PackHeader &orig_ph, const Filter &filtered_ft, int method,
+               const byte *i_ptr, unsigned i_len, unsigned f_off, const byte *f_buf,
+               unsigned f_len, const upx_compress_config_t *cconf, unsigned max_c_len) noexcept;
+};
+
+// filter and compress ibuf_ptr[]; may get called from multiple threads
+void Packer::FilterTrial::run(const Packer *p, const PackHeader &orig_ph, const Filter &orig_ft,
+                              int method, int filter, const byte *i_ptr, unsigned i_len,
+                              unsigned f_off, unsigned f_len,
+                              const upx_compress_config_t *cconf, unsigned max_c_len) noexcept {
+    try {
+        ph = orig_ph;
+        ph.method = method;
+        ph.filter = filter;
+        ph.overlap_overhead = 0;
+        ft = orig_ft;
+        ft.init(ph.filter, orig_ft.addvalue);
+        success = compressed = reused = false;
+        exc = nullptr;
+        memcpy(ibuf_ptr, i_ptr, i_len);
+        byte *const f_ptr = ibuf_ptr + f_off;
+        p->optimizeFilter(&ft, f_ptr, f_len);
+        success = ft.filter(f_ptr, f_len);
+        if (ft.id != 0 && ft.calls == 0)
+            success = false;
+        if (success) {
+            ph.filter_cto = ft.cto;
+            ph.n_mru = ft.n_mru;
+            compressed = p->compress(ph, ibuf_ptr, i_len, obuf_ptr, cconf, nullptr, max_c_len);
+        }
+    } catch (...) {
+        exc = std::current_exception();
+    }
+}
+
+// like run(), but f_buf[] already holds the data filtered by filtered_ft
+void Packer::FilterTrial::reuse(const Packer *p, const PackHeader &orig_ph,
+                                const Filter &filtered_ft, int method, const byte *i_ptr,
+                                unsigned i_len, unsigned f_off, const byte *f_buf, unsigned f_len,
+                                const upx_compress_config_t *cconf, unsigned max_c_len) noexcept {
+    try {
+        ph = orig_ph;
+        ph.method = method;
+        ph.filter = filtered_ft.id;
+        ph.overlap_overhead = 0;
+        ft = filtered_ft;
+        success = reused = true;
+        compressed = false;
+        exc = nullptr;
+        memcpy(ibuf_ptr, i_ptr, f_off);
+        memcpy(ibuf_ptr + f_off, f_buf, f_len);
+        memcpy(ibuf_ptr + f_off + f_len, i_ptr + f_off + f_len, i_len - f_off - f_len);
+        ph.filter_cto = ft.cto;
+        ph.n_mru = ft.n_mru;
+        compressed = p->compress(ph, ibuf_ptr, i_len, obuf_ptr, cconf, nullptr, max_c_len);
+    } catch (...) {
+        exc = std::current_exception();
+    }
+}
+
+Packer::FilterTrials::~FilterTrials() noexcept { delete[] trials; }
+
+/*************************************************************************
+// Every method of compressWithFilters() tries the same filters. Keep the
+// filtered variants of f_ptr[], as far as the memory budget allows, so
+// that each filter runs (and gets verified by unfiltering) only once per
+// call instead of once per method.
+**************************************************************************/
+
+namespace {
+struct FilterVariants final {
+    struct Variant final {
+        bool done = false;    // filter() has been called
+        bool success = false; // filter success
+        Filter ft{0};         // state after filter()
+        byte *buf = nullptr;  // filtered data; nullptr if it did not fit
+        MemBuffer mb;         // holds buf, allocated on the first success
+    };
+
+    // pass nfilters == 0 to disable
+    FilterVariants(int nfilters, const byte *f_ptr, unsigned f_len_) : f_len(f_len_) {
+        // one buffer holds the unfiltered data to restore f_ptr[]
+        const upx_uint64_t n = upx_get_memory_budget(256u * 1024 * 1024) / UPX_MAX(f_len, 1u);
+        if (nfilters <= 0 || n < 2)
+            return;
+        nbufs = (unsigned) UPX_MIN(n - 1, upx_uint64_t(nfilters));
+        mem.alloc(f_len);
+        memcpy(mem, f_ptr, f_len);
+        v = new Variant[nfilters];
+    }
+    ~FilterVariants() noexcept { delete[] v; }
+
+    bool enabled() const { return nbufs > 0; }
+    const byte *unfiltered() const { return mem; }
+
+    // the variant of filter index ff, or nullptr if it must be (re)computed
+    const Variant *find(int ff) const {
+        const Variant &x = v[ff];
+        if (!x.done || (x.success && x.ft.id != 0 && x.buf == nullptr))
+            return nullptr;
+        return &x;
+    }
+    // the filtered data of a variant
+    const byte *data(const Variant *x) const { return x->ft.id == 0 ? unfiltered() : x->buf; }
+
+    void addFailed(int ff) {
+        v[ff].done = true;
+        v[ff].success = false;
+    }
+    void add(int ff, const Filter &ft, const byte *f_buf) {
+        Variant &x = v[ff];
+        if (x.done)
+            return;
+        x.done = true;
+        x.success = true;
+        x.ft = ft;
+        if (ft.id != 0 && used < nbufs) {
+            // most filters fail or are never reached, so allocate lazily
+            used++;
+            x.mb.alloc(f_len);
+            x.buf = x.mb;
+            memcpy(x.buf, f_buf, f_len);
+        }
+    }
+
+private:
+    Variant *v = nullptr;
+    MemBuffer mem;
+    unsigned f_len;
+    unsigned nbufs = 0;
+    unsigned used = 0;
+
+    // disable copy and assignment
+    FilterVariants(const FilterVariants &) = delete;
+    FilterVariants &operator=(const FilterVariants &) = delete;
+};
+} // namespace
+
+// Run the method/filter trials of compressWithFilters() in the order of the
+// serial search; this does not touch this->ph, so it may get called from
+// multiple threads. Note that findOverlapOverhead() is not virtual here.
+void Packer::runFilterTrials(FilterTrials *fts, const byte *i_ptr, const unsigned i_len,
+                             const unsigned f_off, const byte *hdr_ptr, const unsigned hdr_len,
+                             const Filter *parm_ft, const unsigned overlap_range,
+                             const upx_compress_config_t *cconf, int filter_strategy) const {
+    fts->compressed = false;
+    fts->cached = false;
+    fts->i_len = i_len;
+    fts->ntrials = 0;
+    fts->exc = nullptr;
+    try {
+        const unsigned o_size = MemBuffer::getSizeForCompression(i_len);
+        if (parm_ft == nullptr) {
+            // just compress()
+            if (fts->t_ibufs.getSize() < i_len) {
+                fts->t_ibufs.dealloc();
+                fts->t_ibufs.alloc(i_len);
+            }
+            if (fts->t_obufs.getSize() < o_size) {
+                fts->t_obufs.dealloc();
+                fts->t_obufs.alloc(o_size);
+            }
+            memcpy(fts->t_ibufs, i_ptr, i_len);
+            fts->compressed = compress(fts->ph, fts->t_ibufs, i_len, fts->t_obufs, cconf, nullptr);
+            return;
+        }
+        const unsigned f_len = parm_ft->buf_len ? parm_ft->buf_len : i_len;
+        fts->nmethods = prepareMethods(fts->methods, fts->ph.method,
+                                       getCompressionMethods(M_ALL, fts->ph.level));
+        fts->nmethods = rankMethods(fts->methods, fts->nmethods, i_ptr, i_len, cconf);
+        fts->nfilters = prepareFilters(fts->filters, filter_strategy, getFilters());
+        if (filter_strategy >= 0)
+            fts->nfilters =
+                rankFilters(fts->filters, fts->nfilters, i_ptr + f_off, f_len, parm_ft);
+        if (opt->cache_dir != nullptr) {
+            // leave it to compressWithFilters() if the result is in the cache;
+            // this must be the very same key as in compressWithFilters()
+            CacheKey key;
+            getCacheKey(&key, i_ptr, i_len, f_off, f_len, hdr_ptr, hdr_len, parm_ft, overlap_range,
+                        cconf, fts->methods, fts->nmethods, fts->filters, fts->nfilters,
+                        filter_strategy);
+            if (probeCache(key)) {
+                fts->cached = true;
+                return;
+            }
+        }
+        const unsigned ntasks = fts->nmethods * fts->nfilters;
+        if (fts->t_ibufs.getSize() < mem_size(i_len, ntasks)) {
+            fts->t_ibufs.dealloc();
+            fts->t_ibufs.alloc(mem_size(i_len, ntasks));
+        }
+        if (fts->t_obufs.getSize() < mem_size(o_size, ntasks)) {
+            fts->t_obufs.dealloc();
+            fts->t_obufs.alloc(mem_size(o_size, ntasks));
+        }
+        delete[] fts->trials;
+        fts->trials = nullptr;
+        fts->trials = new FilterTrial[ntasks];
+        int done_mm = -1;
+        for (unsigned task = 0; task < ntasks; task++) {
+            const int mm = task / fts->nfilters;
+            if (mm == done_mm)
+                continue; // serial search would not try this filter
+            FilterTrial &t = fts->trials[fts->ntrials];
+            t.task_id = task;
+            t.ibuf_ptr = raw_index_bytes(fts->t_ibufs, fts->ntrials * i_len, i_len);
+            t.obuf_ptr = raw_index_bytes(fts->t_obufs, fts->ntrials * o_size, o_size);
+            fts->ntrials++;
+            t.run(this, fts->ph, *parm_ft, fts->methods[mm], fts->filters[task % fts->nfilters],
+                  i_ptr, i_len, f_off, f_len, cconf);
+            if (t.exc)
+                break; // gets rethrown when evaluating this trial
+            if (t.compressed) {
+                try {
+                    UiStats::Scope timer(uip->stats, UiStats::PH_OVERLAP, t.ph.u_len);
+                    t.ph.overlap_overhead = ph_findOverlapOverhead(
+                        t.ph, t.obuf_ptr, t.ibuf_ptr, overlap_range, ~0u, &timer.count);
+                } catch (...) {
+                    t.exc = std::current_exception();
+                    break;
+                }
+            }
+            if (t.success && filter_strategy < 0)
+                done_mm = mm;
+        }
+    } catch (...) {
+        fts->exc = std::current_exception();
+    }
+}
+
 void Packer::compressWithFilters(byte *i_ptr,
                                  const unsigned i_len, // written and restored by filters
                                  byte *const o_ptr,    // where to put compressed output
@@ -1121,10 +1613,13 @@ void Packer::compressWithFilters(byte *i_ptr,
     // prepare methods and filters
     int methods[256];
     int nmethods = prepareMethods(methods, ph.method, getCompressionMethods(M_ALL, ph.level));
+    nmethods = rankMethods(methods, nmethods, i_ptr, i_len, cconf);
     assert(nmethods > 0);
     assert(nmethods < 256);
     int filters[256];
     int nfilters = prepareFilters(filters, filter_strategy, getFilters());
+    if (filter_strategy >= 0)
+        nfilters = rankFilters(filters, nfilters, f_ptr, f_len, &orig_ft);
     assert(nfilters > 0);
     assert(nfilters < 256);
 #if 0
@@ -1137,6 +1632,25 @@ void Packer::compressWithFilters(byte *i_ptr,
     printf("\n");
 #endif
 
+    // "--cache-dir": reuse the result of an identical search
+    CacheKey key = {};
+    if (opt->cache_dir != nullptr) {
+        getCacheKey(&key, i_ptr, i_len, ptr_udiff(f_ptr, i_ptr), f_len, hdr_ptr, hdr_len, &orig_ft,
+                    overlap_range, cconf, methods, nmethods, filters, nfilters, filter_strategy);
+        if (loadFromCache(key, i_ptr, i_len, o_ptr, f_ptr, f_len, parm_ft)) {
+            pending_trials = nullptr;
+            uip->passCallback(i_len, ph.c_len);
+            callBuildLoader(parm_ft);
+            if (!inhibit_compression_check) {
+                if (ph.c_len + getLoaderSize() >= ph.u_len)
+                    throwNotCompressible();
+                if (!checkCompressionRatio(ph.u_len, ph.c_len))
+                    throwNotCompressible();
+            }
+            return;
+        }
+    }
+
     // update total_passes; previous (ui_total_passes > 0) means incremental
     if (!is_forced_method(ph.method)) {
         if (uip->ui_total_passes > 0)
@@ -1147,118 +1661,309 @@ void Packer::compressWithFilters(byte *i_ptr,
             uip->ui_total_passes += nfilters * nmethods;
     }
 
-    // Working buffer for compressed data. Don't waste memory and allocate as needed.
-    byte *o_tmp = o_ptr;
-    MemBuffer o_tmp_buf;
+    // header compression; only the size of the result is needed
+    auto compress_hdr = [&](int method, byte *out) -> unsigned {
+        unsigned hdr_c_len = 0;
+        int r = upx_compress(hdr_ptr, hdr_len, out, &hdr_c_len, nullptr, method, 10, nullptr,
+                             nullptr);
+        if (r != UPX_E_OK)
+            throwInternalError("header compression failed");
+        if (hdr_c_len >= hdr_len)
+            throwInternalError("header compression size increase");
+        return hdr_c_len;
+    };
+
+    // compare the current result in this->ph with the best one so far;
+    // o_buf[] holds the compressed data and t_buf[] the filtered input
+    auto update_best = [&](const Filter &ft, const byte *o_buf, const byte *t_buf,
+                           unsigned hdr_c_len) {
+        unsigned lsize = 0;
+        // findOverlapOperhead() might be slow; omit if already too big.
+        if (ph.c_len + lsize + hdr_c_len <= best_ph.c_len + best_ph_lsize + best_hdr_c_len) {
+            // get results; runFilterTrials() might have done this already
+            if (ph.overlap_overhead == 0)
+                ph.overlap_overhead = findOverlapOverhead(o_buf, t_buf, overlap_range);
+            callBuildLoader(&ft);
+            lsize = getLoaderSize();
+            assert(lsize > 0);
+        }
+        NO_printf("\n%2d %02x: %d +%4d +%3d = %d  (best: %d +%4d +%3d = %d)\n", ph.method,
+                  ph.filter, ph.c_len, lsize, hdr_c_len, ph.c_len + lsize + hdr_c_len,
+                  best_ph.c_len, best_ph_lsize, best_hdr_c_len,
+                  best_ph.c_len + best_ph_lsize + best_hdr_c_len);
+        bool update = false;
+        if (ph.c_len + lsize + hdr_c_len < best_ph.c_len + best_ph_lsize + best_hdr_c_len)
+            update = true;
+        else if (ph.c_len + lsize + hdr_c_len == best_ph.c_len + best_ph_lsize + best_hdr_c_len) {
+            // prefer smaller loaders
+            if (lsize + hdr_c_len < best_ph_lsize + best_hdr_c_len)
+                update = true;
+            else if (lsize + hdr_c_len == best_ph_lsize + best_hdr_c_len) {
+                // prefer less overlap_overhead
+                if (ph.overlap_overhead < best_ph.overlap_overhead)
+                    update = true;
+            }
+        }
+        if (update) {
+            assert((int) ph.overlap_overhead > 0);
+            // update o_ptr[] with best version
+            if (o_buf != o_ptr)
+                memcpy(o_ptr, o_buf, ph.c_len);
+            // save compression results
+            best_ph = ph;
+            best_ph_lsize = lsize;
+            best_hdr_c_len = hdr_c_len;
+            best_ft = ft;
+        }
+    };
+
+    // A candidate whose compressed data plus header is already larger than
+    // the best total so far can never win (the loader size is > 0), so its
+    // compressor may give up as soon as the output exceeds this budget.
+    auto output_budget = [&](unsigned hdr_c_len) -> unsigned {
+        if (best_ph_lsize == 0)
+            return 0; // no result yet
+        const unsigned best_total = best_ph.c_len + best_ph_lsize + best_hdr_c_len;
+        return best_total > hdr_c_len ? best_total - hdr_c_len : 1;
+    };
 
     // compress using all methods/filters
     int nfilters_success_total = 0;
-    for (int mm = 0; mm < nmethods; mm++) // for all methods
-    {
-        NO_printf("\nmethod %d (%d of %d)\n", methods[mm], 1 + mm, nmethods);
-        assert(isValidCompressionMethod(methods[mm]));
+    const unsigned ntasks = nmethods * nfilters;
+    const unsigned o_size = MemBuffer::getSizeForCompression(i_len);
+    unsigned ntrials = UPX_MIN(upx_get_nthreads(opt->threads), ntasks);
+    // each concurrent trial needs its own input and output buffer
+    ntrials = (unsigned) UPX_MIN(upx_uint64_t(ntrials), upx_get_memory_budget(1024u * 1024 * 1024) /
+                                                            (i_len + o_size));
+    // trials which already have been run by runFilterTrials()
+    FilterTrials *fts = pending_trials;
+    pending_trials = nullptr;
+    if (fts != nullptr) {
+        if (fts->exc)
+            std::rethrow_exception(fts->exc);
+        if (fts->cached)
+            fts = nullptr; // the trials were skipped, but the cache missed
+        else if (fts->i_len != i_len || fts->nmethods != nmethods || fts->nfilters != nfilters ||
+            memcmp(fts->methods, methods, sizeof(methods[0]) * nmethods) != 0 ||
+            memcmp(fts->filters, filters, sizeof(filters[0]) * nfilters) != 0)
+            fts = nullptr; // not the same search - just do it again
+    }
+    if (fts != nullptr || ntrials > 1) {
+        // Parallel search: each trial filters and compresses a private copy
+        // of i_ptr[]. The results are evaluated in exactly the same order
+        // as in the serial loop below, so the output is identical.
+        const unsigned f_off = ptr_udiff(f_ptr, i_ptr);
+        MemBuffer hdr_buf;
+        if (hdr_ptr != nullptr && hdr_len)
+            hdr_buf.allocForCompression(hdr_len);
+        int last_mm = -1;
+        bool last_mm_done = false;
         unsigned hdr_c_len = 0;
-        if (hdr_ptr != nullptr && hdr_len) {
-            if (nfilters_success_total != 0 && o_tmp == o_ptr) {
-                // do not overwrite o_ptr
-                o_tmp_buf.allocForCompression(UPX_MAX(hdr_len, i_len));
-                o_tmp = o_tmp_buf;
-            }
-            int r = upx_compress(hdr_ptr, hdr_len, o_tmp, &hdr_c_len, nullptr, methods[mm], 10,
-                                 nullptr, nullptr);
-            if (r != UPX_E_OK)
-                throwInternalError("header compression failed");
-            if (hdr_c_len >= hdr_len)
-                throwInternalError("header compression size increase");
-        }
         int nfilters_success_mm = 0;
-        for (int ff = 0; ff < nfilters; ff++) // for all filters
-        {
-            assert(isValidFilter(filters[ff]));
-            // get fresh packheader
-            ph = orig_ph;
-            ph.method = methods[mm];
-            ph.filter = filters[ff];
-            ph.overlap_overhead = 0;
-            // get fresh filter
-            Filter ft = orig_ft;
-            ft.init(ph.filter, orig_ft.addvalue);
-            // filter
-            optimizeFilter(&ft, f_ptr, f_len);
-            bool success = ft.filter(f_ptr, f_len);
-            if (ft.id != 0 && ft.calls == 0) {
-                // filter did not do anything - no need to call ft.unfilter()
-                success = false;
+        // trials by runFilterTrials() are done already
+        FilterVariants fvs(fts == nullptr && nmethods > 1 ? nfilters : 0, f_ptr, f_len);
+        auto evaluate = [&](FilterTrial &t) {
+            const int mm = t.task_id / nfilters;
+            if (mm != last_mm) {
+                assert(last_mm < 0 || nfilters_success_mm > 0);
+                NO_printf("\nmethod %d (%d of %d)\n", methods[mm], 1 + mm, nmethods);
+                assert(isValidCompressionMethod(methods[mm]));
+                last_mm = mm;
+                last_mm_done = false;
+                nfilters_success_mm = 0;
+                hdr_c_len = 0;
+                if (hdr_ptr != nullptr && hdr_len)
+                    hdr_c_len = compress_hdr(methods[mm], hdr_buf);
             }
-            if (!success) {
+            if (last_mm_done)
+                return; // serial search would not have tried this filter
+            if (t.exc)
+                std::rethrow_exception(t.exc);
+            if (!t.success) {
                 // filter failed or was useless
+                if (fvs.enabled())
+                    fvs.addFailed(t.task_id % nfilters);
                 if (filter_strategy >= 0) {
                     // adjust ui passes
                     if (uip->ui_pass >= 0)
                         uip->ui_pass++;
                 }
-                continue;
-            }
-            // filter success
-            NO_printf("\nfilter: id 0x%02x size %6d, calls %5d/%5d/%3d/%5d/%5d, cto 0x%02x\n",
-                      ft.id, ft.buf_len, ft.calls, ft.noncalls, ft.wrongcalls, ft.firstcall,
-                      ft.lastcall, ft.cto);
-            if (nfilters_success_total != 0 && o_tmp == o_ptr) {
-                o_tmp_buf.allocForCompression(i_len);
-                o_tmp = o_tmp_buf;
+                return;
             }
             nfilters_success_total++;
             nfilters_success_mm++;
-            ph.filter_cto = ft.cto;
-            ph.n_mru = ft.n_mru;
-            // compress
-            if (compress(i_ptr, i_len, o_tmp, cconf)) {
-                unsigned lsize = 0;
-                // findOverlapOperhead() might be slow; omit if already too big.
-                if (ph.c_len + lsize + hdr_c_len <=
-                    best_ph.c_len + best_ph_lsize + best_hdr_c_len) {
-                    // get results
-                    ph.overlap_overhead = findOverlapOverhead(o_tmp, i_ptr, overlap_range);
-                    buildLoader(&ft);
-                    lsize = getLoaderSize();
-                    assert(lsize > 0);
+            uip->passCallback(i_len, t.ph.c_len);
+            if (t.compressed) {
+                if (fts != nullptr) {
+                    // t.ph is based on an older copy of this->ph
+                    ph = orig_ph;
+                    ph.method = t.ph.method;
+                    ph.filter = t.ph.filter;
+                    ph.overlap_overhead = t.ph.overlap_overhead;
+                    ph.filter_cto = t.ph.filter_cto;
+                    ph.n_mru = t.ph.n_mru;
+                    ph_rechain(ph, t.ph, true, t.ibuf_ptr, t.obuf_ptr);
+                } else
+                    ph = t.ph;
+                t.ft.buf = f_ptr; // as if filtered in place
+                update_best(t.ft, t.obuf_ptr, t.ibuf_ptr, hdr_c_len);
+            }
+            if (!t.reused) {
+                if (fvs.enabled())
+                    fvs.add(t.task_id % nfilters, t.ft, t.ibuf_ptr + f_off);
+                // unfilter with verify
+                t.ft.unfilter(t.ibuf_ptr + f_off, f_len, true);
+            }
+            if (filter_strategy < 0)
+                last_mm_done = true;
+        };
+        if (fts != nullptr) {
+            for (unsigned i = 0; i < fts->ntrials; i++)
+                evaluate(fts->trials[i]);
+        } else {
+            MemBuffer t_ibufs(mem_size(i_len, ntrials));
+            MemBuffer t_obufs(mem_size(o_size, ntrials));
+            FilterTrial *const trials = new FilterTrial[ntrials];
+            try {
+                for (unsigned i = 0; i < ntrials; i++) {
+                    trials[i].ibuf_ptr = raw_index_bytes(t_ibufs, i * i_len, i_len);
+                    trials[i].obuf_ptr = raw_index_bytes(t_obufs, i * o_size, o_size);
                 }
-                NO_printf("\n%2d %02x: %d +%4d +%3d = %d  (best: %d +%4d +%3d = %d)\n", ph.method,
-                          ph.filter, ph.c_len, lsize, hdr_c_len, ph.c_len + lsize + hdr_c_len,
-                          best_ph.c_len, best_ph_lsize, best_hdr_c_len,
-                          best_ph.c_len + best_ph_lsize + best_hdr_c_len);
-                bool update = false;
-                if (ph.c_len + lsize + hdr_c_len < best_ph.c_len + best_ph_lsize + best_hdr_c_len)
-                    update = true;
-                else if (ph.c_len + lsize + hdr_c_len ==
-                         best_ph.c_len + best_ph_lsize + best_hdr_c_len) {
-                    // prefer smaller loaders
-                    if (lsize + hdr_c_len < best_ph_lsize + best_hdr_c_len)
-                        update = true;
-                    else if (lsize + hdr_c_len == best_ph_lsize + best_hdr_c_len) {
-                        // prefer less overlap_overhead
-                        if (ph.overlap_overhead < best_ph.overlap_overhead)
-                            update = true;
+                unsigned max_c_len = 0; // the budget of the current batch
+                auto run_trial = [&](unsigned i) {
+                    FilterTrial &t = trials[i];
+                    const int method = methods[t.task_id / nfilters];
+                    const int ff = t.task_id % nfilters;
+                    const FilterVariants::Variant *const x = fvs.enabled() ? fvs.find(ff) : nullptr;
+                    if (x == nullptr)
+                        t.run(this, orig_ph, orig_ft, method, filters[ff], i_ptr, i_len, f_off,
+                              f_len, cconf, max_c_len);
+                    else if (x->success)
+                        t.reuse(this, orig_ph, x->ft, method, i_ptr, i_len, f_off, fvs.data(x),
+                                f_len, cconf, max_c_len);
+                    else {
+                        // filter failed or was useless
+                        t.success = t.compressed = false;
+                        t.exc = nullptr;
                     }
+                };
+                unsigned next_task = 0;
+                while (next_task < ntasks) {
+                    // run the next batch of trials
+                    unsigned n = 0;
+                    for (; next_task < ntasks && n < ntrials; next_task++) {
+                        if (last_mm_done && (int) (next_task / nfilters) == last_mm)
+                            continue;
+                        trials[n++].task_id = next_task;
+                    }
+                    // the best result only gets better while evaluating
+                    // the batch in order, so this budget is safe for all of it
+                    max_c_len = output_budget(0);
+                    upx_parallel_for(n, ntrials, run_trial);
+                    // and evaluate them in order
+                    for (unsigned i = 0; i < n; i++)
+                        evaluate(trials[i]);
                 }
-                if (update) {
-                    assert((int) ph.overlap_overhead > 0);
-                    // update o_ptr[] with best version
-                    if (o_tmp != o_ptr)
-                        memcpy(o_ptr, o_tmp, ph.c_len);
-                    // save compression results
-                    best_ph = ph;
-                    best_ph_lsize = lsize;
-                    best_hdr_c_len = hdr_c_len;
-                    best_ft = ft;
-                }
+            } catch (...) {
+                delete[] trials;
+                throw;
             }
-            // restore - unfilter with verify
-            ft.unfilter(f_ptr, f_len, true);
-            if (filter_strategy < 0)
-                break;
+            delete[] trials;
         }
         assert(nfilters_success_mm > 0);
+    } else {
+        // Working buffer for compressed data. Don't waste memory and allocate as needed.
+        byte *o_tmp = o_ptr;
+        MemBuffer o_tmp_buf;
+        FilterVariants fvs(nmethods > 1 ? nfilters : 0, f_ptr, f_len);
+
+        for (int mm = 0; mm < nmethods; mm++) // for all methods
+        {
+            NO_printf("\nmethod %d (%d of %d)\n", methods[mm], 1 + mm, nmethods);
+            assert(isValidCompressionMethod(methods[mm]));
+            unsigned hdr_c_len = 0;
+            if (hdr_ptr != nullptr && hdr_len) {
+                if (nfilters_success_total != 0 && o_tmp == o_ptr) {
+                    // do not overwrite o_ptr
+                    o_tmp_buf.allocForCompression(UPX_MAX(hdr_len, i_len));
+                    o_tmp = o_tmp_buf;
+                }
+                hdr_c_len = compress_hdr(methods[mm], o_tmp);
+            }
+            int nfilters_success_mm = 0;
+            for (int ff = 0; ff < nfilters; ff++) // for all filters
+            {
+                assert(isValidFilter(filters[ff]));
+                // get fresh packheader
+                ph = orig_ph;
+                ph.method = methods[mm];
+                ph.filter = filters[ff];
+                ph.overlap_overhead = 0;
+                // get fresh filter
+                Filter ft = orig_ft;
+                ft.init(ph.filter, orig_ft.addvalue);
+                const FilterVariants::Variant *const x = fvs.enabled() ? fvs.find(ff) : nullptr;
+                bool success;
+                if (x != nullptr) {
+                    // filtered by an earlier method
+                    success = x->success;
+                    if (success) {
+                        ft = x->ft;
+                        if (ft.id != 0)
+                            memcpy(f_ptr, fvs.data(x), f_len);
+                    }
+                } else {
+                    // filter
+                    optimizeFilter(&ft, f_ptr, f_len);
+                    success = ft.filter(f_ptr, f_len);
+                    if (ft.id != 0 && ft.calls == 0) {
+                        // filter did not do anything - no need to call ft.unfilter()
+                        success = false;
+                    }
+                    if (fvs.enabled()) {
+                        if (success)
+                            fvs.add(ff, ft, f_ptr);
+                        else
+                            fvs.addFailed(ff);
+                    }
+                }
+                if (!success) {
+                    // filter failed or was useless
+                    if (filter_strategy >= 0) {
+                        // adjust ui passes
+                        if (uip->ui_pass >= 0)
+                            uip->ui_pass++;
+                    }
+                    continue;
+                }
+                // filter success
+                NO_printf("\nfilter: id 0x%02x size %6d, calls %5d/%5d/%3d/%5d/%5d, cto 0x%02x\n",
+                          ft.id, ft.buf_len, ft.calls, ft.noncalls, ft.wrongcalls, ft.firstcall,
+                          ft.lastcall, ft.cto);
+                if (nfilters_success_total != 0 && o_tmp == o_ptr) {
+                    o_tmp_buf.allocForCompression(i_len);
+                    o_tmp = o_tmp_buf;
+                }
+                nfilters_success_total++;
+                nfilters_success_mm++;
+                ph.filter_cto = ft.cto;
+                ph.n_mru = ft.n_mru;
+                // compress
+                if (compress(ph, i_ptr, i_len, o_tmp, cconf, uip, output_budget(hdr_c_len)))
+                    update_best(ft, o_tmp, i_ptr, hdr_c_len);
+                // restore
+                if (x != nullptr) {
+                    if (ft.id != 0)
+                        memcpy(f_ptr, fvs.unfiltered(), f_len);
+                } else {
+                    // unfilter with verify
+                    ft.unfilter(f_ptr, f_len, true);
+                }
+                if (filter_strategy < 0)
+                    break;
+            }
+            assert(nfilters_success_mm > 0);
+        }
     }
 
     // postconditions 1)
@@ -1283,9 +1988,11 @@ void Packer::compressWithFilters(byte *i_ptr,
         // postconditions 2)
         assert(best_ph.overlap_overhead > 0);
     }
+    if (opt->cache_dir != nullptr)
+        storeInCache(key, o_ptr);
 
     // convenience
-    buildLoader(&best_ft);
+    callBuildLoader(&best_ft);
 }
 
 /*************************************************************************
@@ -1324,4 +2031,191 @@ void Packer::compressWithFilters(Filter *ft, const unsigned overlap_range,
     obuf.checkState();
 }
 
+
+/*************************************************************************
+// test
+**************************************************************************/
+
+namespace {
+// a Packer for the tests of the compression helpers
+class TestPacker final : public Packer {
+public:
+    TestPacker() : Packer(nullptr) {}
+    virtual int getVersion() const override { return 13; }
+    virtual int getFormat() const override { return UPX_F_LINUX_ELF_i386; }
+    virtual const char *getName() const override { return "test"; }
+    virtual const char *getFullName(const Options *) const override { return "test"; }
+    virtual const int *getCompressionMethods(int, int) const override { return nullptr; }
+    virtual const int *getFilters() const override { return nullptr; }
+    virtual void pack(OutputFile *) override {}
+    virtual void unpack(OutputFile *) override {}
+    virtual bool canPack() override { return false; }
+    virtual int canUnpack() override { return false; }
+    virtual int getLoaderSize() const override { return 1024; }
+    PackHeader &header() { return ph; }
+    int rank(int *methods, int nmethods, const byte *i_ptr, unsigned i_len) const {
+        return rankMethods(methods, nmethods, i_ptr, i_len, nullptr);
+    }
+
+protected:
+    virtual Linker *newLinker() const override { return nullptr; }
+    virtual void buildLoader(const Filter *) override {}
+};
+} // namespace
+
+TEST_CASE("findOverlapOverhead") {
+    // the single-pass estimate must give the same overhead as a plain
+    // binary search, i.e. the smallest one that verifies
+    Options *const saved_opt = opt;
+    Options local_options;
+    opt = &local_options;
+    opt->reset();
+    constexpr unsigned N = 16384;
+    MemBuffer u_buf(N);
+    upx_uint32_t x = 1;
+    for (unsigned i = 0; i < N; i++) {
+        x = x * 1103515245 + 12345;
+        // random runs at the end make the overlap non-trivial
+        u_buf[i] = (byte) (i < N - 2048 && (i % 97) < 64 ? i / 97 : x >> 24);
+    }
+    MemBuffer c_buf;
+    c_buf.allocForCompression(N);
+    static const int methods[] = {M_NRV2B_LE32, M_NRV2B_8, M_NRV2D_LE32, M_NRV2E_LE32, M_LZMA};
+    for (const int method : methods) {
+        TestPacker p;
+        PackHeader &ph = p.header();
+        ph.method = method;
+        ph.level = 6;
+        ph.u_len = N;
+        ph.c_len = 0;
+        int r = upx_compress(u_buf, N, c_buf, &ph.c_len, nullptr, method, ph.level, nullptr,
+                             &ph.compress_result);
+        CHECK(r == UPX_E_OK);
+        CHECK(ph.c_len < ph.u_len);
+        if (r != UPX_E_OK || ph.c_len >= ph.u_len)
+            continue;
+        CHECK(ph_estimateOverlapOverhead(ph, c_buf) != 0);
+        const unsigned high = ph.u_len + 512;
+        unsigned nr = 0;
+        const unsigned old_overhead =
+            ph_searchOverlapOverhead(ph, c_buf, u_buf, 0, 1, high, 16, 0, nr);
+        CHECK(old_overhead != 0);
+        CHECK(ph_findOverlapOverhead(ph, c_buf, u_buf, 0, high) == old_overhead);
+        // with a range, the result is at most range - 1 above the smallest one
+        const unsigned overhead = ph_findOverlapOverhead(ph, c_buf, u_buf, 512, high);
+        CHECK(overhead >= old_overhead);
+        CHECK(overhead < old_overhead + 512);
+    }
+    opt = saved_opt;
+}
+
+TEST_CASE("rankMethods") {
+    // the top K of the sampled methods include the best method of a
+    // full "--all-methods" compression
+    Options *const saved_opt = opt;
+    Options local_options;
+    opt = &local_options;
+    opt->reset();
+    constexpr unsigned N = 2 * 1024 * 1024 + 4096;
+    MemBuffer u_buf(N);
+    static const char *const words[] = {"mov ", "eax", ", ", "call ", "0x", "\n", "push ",
+                                        "ebx", "ret", "jmp ", "[esp+", "]", "lea ", "xor "};
+    upx_uint32_t x = 1;
+    for (unsigned i = 0; i < N;) {
+        x = x * 1103515245 + 12345;
+        if ((x >> 28) == 0) { // some binary noise
+            u_buf[i++] = (byte) (x >> 16);
+            continue;
+        }
+        for (const char *w = words[(x >> 16) % TABLESIZE(words)]; *w && i < N; w++)
+            u_buf[i++] = (byte) *w;
+    }
+    static const int all[] = {M_NRV2B_LE32, M_NRV2D_LE32, M_NRV2E_LE32, M_DEFLATE, M_LZMA};
+    constexpr int nall = (int) TABLESIZE(all);
+    const int level = 2;
+    MemBuffer c_buf;
+    c_buf.allocForCompression(N);
+    int best = -1;
+    unsigned best_c_len = 0;
+    for (int mm = 0; mm < nall; mm++) {
+        upx_compress_config_t cconf;
+        ph_initCompressConfig(&cconf, nullptr, all[mm]);
+        unsigned c_len = c_buf.getSize();
+        CHECK(upx_compress(u_buf, N, c_buf, &c_len, nullptr, all[mm], level, &cconf, nullptr) ==
+              UPX_E_OK);
+        if (best < 0 || c_len < best_c_len) {
+            best = all[mm];
+            best_c_len = c_len;
+        }
+    }
+    TestPacker p;
+    p.header().level = level;
+    opt->rank_methods = 2;
+    int methods[nall];
+    memcpy(methods, all, sizeof(all));
+    const int n = p.rank(methods, nall, u_buf, N);
+    CHECK(n == 2);
+    bool found = false;
+    for (int mm = 0; mm < n; mm++)
+        found |= methods[mm] == best;
+    CHECK(found);
+    // too small to rank
+    memcpy(methods, all, sizeof(all));
+    CHECK(p.rank(methods, nall, u_buf, N / 2) == nall);
+    opt = saved_opt;
+}
+
+TEST_CASE("FilterVariants") {
+    // x86-like data: calls and jumps to nearby targets between random bytes
+    constexpr unsigned N = 16384;
+    MemBuffer orig(N);
+    upx_uint32_t x = 1;
+    for (unsigned i = 0; i < N; i++) {
+        x = x * 1103515245 + 12345;
+        orig[i] = (byte) (x >> 24);
+    }
+    for (unsigned i = 0; i + 5 <= N; i += 37) {
+        orig[i] = (i & 64) ? 0xe9 : 0xe8;
+        set_le32(orig + i + 1, (i * 7) & 0xfff);
+    }
+    static const int ids[] = {0x00, 0x11, 0x26, 0x49};
+    const int nfilters = (int) TABLESIZE(ids);
+    FilterVariants fvs(nfilters, orig, N);
+    CHECK(fvs.enabled());
+    MemBuffer work(N);
+    for (int ff = 0; ff < nfilters; ff++) {
+        CHECK(fvs.find(ff) == nullptr);
+        memcpy(work, orig, N);
+        Filter ft(10);
+        ft.init(ids[ff], 0);
+        if (ft.filter(work, N))
+            fvs.add(ff, ft, work);
+        else
+            fvs.addFailed(ff);
+    }
+    CHECK(memcmp(fvs.unfiltered(), orig, N) == 0);
+    // a kept variant is the same as filtering afresh
+    for (int ff = 0; ff < nfilters; ff++) {
+        memcpy(work, orig, N);
+        Filter ft(10);
+        ft.init(ids[ff], 0);
+        const bool ok = ft.filter(work, N);
+        const FilterVariants::Variant *const v = fvs.find(ff);
+        CHECK(v != nullptr);
+        if (v == nullptr)
+            continue;
+        CHECK(v->success == ok);
+        if (!ok)
+            continue;
+        CHECK(v->ft.id == ft.id);
+        CHECK(v->ft.cto == ft.cto);
+        CHECK(v->ft.calls == ft.calls);
+        CHECK(v->ft.n_mru == ft.n_mru);
+        CHECK(memcmp(fvs.data(v), work, N) == 0);
+    }
+    // disabled
+    FilterVariants none(0, orig, N);
+    CHECK(!none.enabled());
+}
+
 /* vim:set ts=4 sw=4 et: */
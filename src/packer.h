@@ -96,6 +96,8 @@ void ph_decompress(PackHeader &ph, SPAN_P(const byte) in, SPAN_P(byte) out, bool
                    Filter *ft);
 bool ph_testOverlappingDecompression(const PackHeader &ph, SPAN_P(const byte) buf,
                                      unsigned overlap_overhead);
+void ph_rechain(PackHeader &ph, const PackHeader &xph, bool compressed, const byte *i_ptr,
+                const byte *o_ptr);
 
 /*************************************************************************
 // abstract base class for packers
@@ -104,6 +106,7 @@ bool ph_testOverlappingDecompression(const PackHeader &ph, SPAN_P(const byte) bu
 **************************************************************************/
 
 class Packer {
+    friend class PackMaster; // for uip->stats
     friend class UiPacker;
 
 protected:
@@ -157,10 +160,18 @@ public:
     // is definitely not packed". See packmast.cpp try_unpack().
     virtual int canUnpack() = 0;
 
+    // identifies a compressWithFilters() search in the "--cache-dir"
+    struct CacheKey final {
+        upx_uint64_t h[2];
+    };
+
 protected:
     // main compression drivers
     bool compress(SPAN_P(byte) i_ptr, unsigned i_len, SPAN_P(byte) o_ptr,
                   const upx_compress_config_t *cconf = nullptr);
+    bool compress(PackHeader &xph, SPAN_P(byte) i_ptr, unsigned i_len, SPAN_P(byte) o_ptr,
+                  const upx_compress_config_t *cconf, UiPacker *ui,
+                  unsigned max_c_len = 0) const;
     void decompress(SPAN_P(const byte) in, SPAN_P(byte) out, bool verify_checksum = true,
                     Filter *ft = nullptr);
     virtual bool checkDefaultCompressionRatio(unsigned u_len, unsigned c_len) const;
@@ -185,6 +196,26 @@ protected:
                              unsigned overlap_range, upx_compress_config_t const *cconf,
                              int filter_strategy, bool inhibit_compression_check = false);
 
+    struct FilterTrial; // see compressWithFilters()
+    // Block-parallel compression, see PackUnix::pack2(): runFilterTrials() is the
+    // thread-safe part of compressWithFilters() (or of compress() if parm_ft is nullptr),
+    // and the next compressWithFilters() then just evaluates the pending_trials.
+    struct FilterTrials;
+    void runFilterTrials(FilterTrials *fts, const byte *i_ptr, unsigned i_len, unsigned f_off,
+                         const byte *hdr_ptr, unsigned hdr_len, const Filter *parm_ft,
+                         unsigned overlap_range, const upx_compress_config_t *cconf,
+                         int filter_strategy) const;
+
+    // "--cache-dir", see compcache.cpp
+    void getCacheKey(CacheKey *key, const byte *i_ptr, unsigned i_len, unsigned f_off,
+                     unsigned f_len, const byte *hdr_ptr, unsigned hdr_len, const Filter *parm_ft,
+                     unsigned overlap_range, const upx_compress_config_t *cconf, const int *methods,
+                     int nmethods, const int *filters, int nfilters, int filter_strategy) const;
+    bool probeCache(const CacheKey &key) const;
+    bool loadFromCache(const CacheKey &key, byte *i_ptr, unsigned i_len, byte *o_ptr, byte *f_ptr,
+                       unsigned f_len, Filter *parm_ft);
+    void storeInCache(const CacheKey &key, const byte *o_ptr) const;
+
     // util for verifying overlapping decompression
     //   non-destructive test
     virtual bool testOverlappingDecompression(const byte *buf, const byte *tbuf,
@@ -204,6 +235,7 @@ protected:
 
     // loader core
     virtual void buildLoader(const Filter *ft) = 0;
+    void callBuildLoader(const Filter *ft); // buildLoader() timed as UiStats::PH_LOADER
     virtual Linker *newLinker() const = 0;
     virtual void relocateLoader();
     // loader util for linker
@@ -239,6 +271,9 @@ protected:
     const int *getDefaultCompressionMethods_8(int method, int level, int small = -1) const;
     const int *getDefaultCompressionMethods_le32(int method, int level, int small = -1) const;
     int prepareMethods(int *methods, int ph_method, const int *all_methods) const;
+    int rankMethods(int *methods, int nmethods, const byte *i_ptr, unsigned i_len,
+                    const upx_compress_config_t *cconf) const;
+    bool isGatedBlock(const byte *i_ptr, unsigned i_len) const;
     virtual const char *getDecompressorSections() const;
     virtual unsigned getDecompressorWrkmemSize() const;
     virtual void defineDecompressorSymbols();
@@ -246,6 +281,8 @@ protected:
     // filter handling [see packer_f.cpp]
     virtual bool isValidFilter(int filter_id) const;
     virtual void optimizeFilter(Filter *, const byte *, unsigned) const {}
+    int rankFilters(int *filters, int nfilters, const byte *f_ptr, unsigned f_len,
+                    const Filter *parm_ft) const;
     virtual void addFilter32(int filter_id);
     virtual void defineFilterSymbols(const Filter *ft);
 
@@ -341,10 +378,16 @@ protected:
     // UI handler
     UiPacker *uip = nullptr;
 
+    // see runFilterTrials()
+    FilterTrials *pending_trials = nullptr;
+
     // linker
     Linker *linker = nullptr;
 
 private:
+    // see callBuildLoader()
+    bool in_build_loader = false;
+
     // private to checkPatch()
     void *last_patch = nullptr;
     int last_patch_len;
@@ -356,6 +399,31 @@ private:
     Packer &operator=(const Packer &) = delete;
 };
 
+// the results of runFilterTrials() for one block
+struct Packer::FilterTrials final {
+    FilterTrials() {}
+    ~FilterTrials() noexcept;
+
+    PackHeader ph;           // in: copy of Packer::ph; out: compress() result if no filter
+    bool compressed = false; // compress() result if no filter
+    bool cached = false;     // trials skipped, the result is in the "--cache-dir"
+    unsigned i_len = 0;
+    int methods[256];
+    int nmethods = 0;
+    int filters[256];
+    int nfilters = 0;
+    FilterTrial *trials = nullptr; // in the order of the serial search
+    unsigned ntrials = 0;
+    MemBuffer t_ibufs; // filtered input of the trials
+    MemBuffer t_obufs; // compressed data
+    std::exception_ptr exc;
+
+private:
+    // disable copy and assignment
+    FilterTrials(const FilterTrials &) = delete;
+    FilterTrials &operator=(const FilterTrials &) = delete;
+};
+
 int force_method(int method);     // (0x80ul<<24)|method
 int forced_method(int method);    // (0x80ul<<24)|method ==> method
 int is_forced_method(int method); // predicate
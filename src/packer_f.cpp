@@ -25,6 +25,8 @@
    <markus@oberhumer.com>               <ezerotven+github@gmail.com>
  */
 
+#include "headers.h"
+#include <cmath>
 #include "conf.h"
 #include "packer.h"
 #include "filter.h"
@@ -38,6 +40,96 @@ bool Packer::isValidFilter(int filter_id) const {
     return Filter::isValidFilter(filter_id, getFilters());
 }
 
+/*************************************************************************
+// rankFilters
+//
+// "--rank-filters=K": instead of compressing the input once per filter,
+// filter a sample of the input with every filter and estimate the size
+// of the result by its order-1 entropy. Only the K best filters (and the
+// "no filter" fallback) then proceed to compressWithFilters(), so
+// "--all-filters" scales with K instead of with the number of filters.
+**************************************************************************/
+
+// order-1 entropy of buf[] in bits; counts[] must hold 256*256 entries
+static double estimate_bits(const byte *buf, unsigned len, unsigned *counts) {
+    memset(counts, 0, sizeof(*counts) * 256 * 256);
+    unsigned ctx = 0;
+    for (unsigned i = 0; i < len; i++) {
+        counts[ctx | buf[i]] += 1;
+        ctx = buf[i] << 8;
+    }
+    double bits = 0;
+    for (unsigned c = 0; c < 256 * 256; c += 256) {
+        unsigned total = 0;
+        for (unsigned b = 0; b < 256; b++)
+            total += counts[c + b];
+        if (total == 0)
+            continue;
+        for (unsigned b = 0; b < 256; b++) {
+            const unsigned n = counts[c + b];
+            if (n != 0)
+                bits += n * std::log2(double(total) / n);
+        }
+    }
+    return bits;
+}
+
+int Packer::rankFilters(int *filters, int nfilters, const byte *f_ptr, unsigned f_len,
+                        const Filter *parm_ft) const {
+    const int top = opt->rank_filters;
+    int ncandidates = 0;
+    for (int i = 0; i < nfilters; i++)
+        if (filters[i] != 0)
+            ncandidates++;
+    if (top <= 0 || ncandidates <= top)
+        return nfilters;
+
+    // the call-trick filters only look at their own buffer, so a prefix
+    // of the input is a good enough sample
+    const unsigned s_len = UPX_MIN(f_len, 4u * 1024 * 1024);
+    MemBuffer s_buf(s_len);
+    MemBuffer counts(mem_size(sizeof(unsigned), 256 * 256));
+    double bits[256];
+    for (int i = 0; i < nfilters; i++) {
+        bits[i] = 0;
+        if (filters[i] == 0)
+            continue;
+        memcpy(s_buf, f_ptr, s_len);
+        Filter ft = *parm_ft;
+        ft.init(filters[i], parm_ft->addvalue);
+        optimizeFilter(&ft, s_buf, s_len);
+        if (ft.filter(s_buf, s_len) && ft.calls > 0)
+            bits[i] = estimate_bits(s_buf, s_len, (unsigned *) counts.getVoidPtr());
+        else
+            bits[i] = -1; // rank last, but the full input may still work
+        NO_printf("rankFilters: %#x calls=%u noncalls=%u bits=%.0f\n", filters[i], ft.calls,
+                  ft.noncalls, bits[i]);
+    }
+
+    // select the best ones; ties go to the filter which comes first
+    bool keep[256];
+    for (int i = 0; i < nfilters; i++)
+        keep[i] = (filters[i] == 0);
+    for (int k = 0; k < top; k++) {
+        int best = -1;
+        for (int i = 0; i < nfilters; i++) {
+            if (keep[i])
+                continue;
+            if (best < 0 || (bits[best] < 0 && bits[i] >= 0) ||
+                (bits[i] >= 0 && bits[i] < bits[best]))
+                best = i;
+        }
+        keep[best] = true;
+    }
+
+    // keep the original order of the selected filters
+    int n = 0;
+    for (int i = 0; i < nfilters; i++)
+        if (keep[i])
+            filters[n++] = filters[i];
+    return n;
+}
+
 /*************************************************************************
 // addFilter32
 **************************************************************************/
@@ -305,4 +397,74 @@ void Packer::defineFilterSymbols(const Filter *ft) {
 #endif
 }
 
+/*************************************************************************
+// test
+**************************************************************************/
+
+namespace {
+// just enough of a packer for rankFilters()
+class TestFilterPacker final : public Packer {
+public:
+    TestFilterPacker() : Packer(nullptr) {}
+    virtual int getVersion() const override { return 13; }
+    virtual int getFormat() const override { return UPX_F_LINUX_i386; }
+    virtual const char *getName() const override { return "test"; }
+    virtual const char *getFullName(const Options *) const override { return "test"; }
+    virtual const int *getCompressionMethods(int, int) const override { return nullptr; }
+    virtual const int *getFilters() const override { return nullptr; }
+    virtual void pack(OutputFile *) override {}
+    virtual void unpack(OutputFile *) override {}
+    virtual bool canPack() override { return false; }
+    virtual int canUnpack() override { return false; }
+    int rank(int *filters, int nfilters, const byte *f_ptr, unsigned f_len) const {
+        Filter ft(1);
+        ft.addvalue = 0;
+        return rankFilters(filters, nfilters, f_ptr, f_len, &ft);
+    }
+
+protected:
+    virtual Linker *newLinker() const override { return nullptr; }
+    virtual void buildLoader(const Filter *) override {}
+};
+} // namespace
+
+TEST_CASE("rankFilters") {
+    // x86-like data with many calls to a few targets: the e8 call-trick
+    // filter must beat those for other opcodes, byte orders or subtraction
+    Options *const saved_opt = opt;
+    Options local_options;
+    opt = &local_options;
+    opt->reset();
+    constexpr unsigned N = 65536;
+    MemBuffer buf(N);
+    upx_uint32_t x = 1;
+    for (unsigned i = 0; i < N; i++) {
+        x = x * 1103515245 + 12345;
+        buf[i] = (byte) (x >> 24);
+    }
+    for (unsigned i = 0; i + 5 <= N; i += 11) {
+        const unsigned target = 0x1000 * (1 + (i * 7) % 13);
+        buf[i] = 0xe8;
+        set_le32(buf + i + 1, target - (i + 5));
+    }
+    TestFilterPacker p;
+    static const int all[] = {0x00, 0x12, 0x1a, 0x17, 0x90, 0x11};
+    constexpr int nall = (int) TABLESIZE(all);
+    int filters[nall];
+    memcpy(filters, all, sizeof(all));
+    opt->rank_filters = 0; // off
+    CHECK(p.rank(filters, nall, buf, N) == nall);
+    opt->rank_filters = 2;
+    const int n = p.rank(filters, nall, buf, N);
+    CHECK(n == 3); // the top 2 and "no filter"
+    bool found_none = false, found_ct = false;
+    for (int i = 0; i < n; i++) {
+        found_none |= filters[i] == 0x00;
+        found_ct |= filters[i] == 0x11;
+    }
+    CHECK(found_none);
+    CHECK(found_ct);
+    opt = saved_opt;
+}
+
 /* vim:set ts=4 sw=4 et: */
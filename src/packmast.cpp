@@ -29,6 +29,7 @@
 #include "file.h"
 #include "packmast.h"
 #include "packer.h"
+#include "ui.h"
 
 #include "lefile.h"
 #include "pefile.h"
@@ -132,24 +133,106 @@ static Packer *try_can_unpack(Packer *p, void *user) {
     return nullptr;
 }
 
+/*************************************************************************
+// Sniff the format families of a file by reading its head and tail
+// once, so that visitAllPackers() only has to construct the packers
+// that can possibly accept it. This must stay conservative: a family
+// may only be skipped if all its canPack() and canUnpack() are sure
+// to reject the file.
+**************************************************************************/
+
+enum : unsigned {
+    SNIFF_EXE = 1,      // dos/exe, dos32 (djgpp2, tmt, wcle) and Windows PE
+    SNIFF_ELF = 2,      // ELF, including vmlinux
+    SNIFF_EXECVE = 4,   // linux/i386 execve: a.out, shell scripts, Java
+    SNIFF_VMLINUZ = 8,  // x86 boot sector or ARM zImage
+    SNIFF_MACH = 16,    // Mach-O and fat binaries
+    SNIFF_TOS = 32,     // atari/tos
+    SNIFF_PS1 = 64,     // ps1/exe
+    SNIFF_ANY = 128,    // packers that check no magic (dos/com, dos/sys)
+    SNIFF_ALL = ~0u,
+};
+
+static unsigned sniffFormats(InputFile *f) {
+    if (f == nullptr) // see show_all_packers()
+        return SNIFF_ALL;
+    byte head_buf[1024];
+    byte tail_buf[2 * 4096 + 256]; // see PackUnix::canUnpack()
+    const byte *head = head_buf;
+    const byte *tail = tail_buf;
+    int head_len, tail_len;
+    try {
+        const upx_off_t file_size = f->st_size();
+        head_len = (int) UPX_MIN(file_size, (upx_off_t) sizeof(head_buf));
+        tail_len = (int) UPX_MIN(file_size, (upx_off_t) sizeof(tail_buf));
+        if (f->canView()) {
+            head = raw_bytes(f->view(0, head_len), head_len);
+            tail = raw_bytes(f->view(file_size - tail_len, tail_len), tail_len);
+        } else {
+            f->seek(0, SEEK_SET);
+            head_len = f->read(head_buf, head_len);
+            f->seek(-tail_len, SEEK_END);
+            tail_len = f->read(tail_buf, tail_len);
+            f->seek(0, SEEK_SET);
+        }
+    } catch (const IOException &) {
+        return SNIFF_ALL; // let the packers report the error
+    }
+    if (head_len < 64)
+        return SNIFF_ALL;
+
+    unsigned r = SNIFF_ANY;
+    const unsigned m16 = get_le16(head);
+    const unsigned m32 = get_le32(head);
+    if (m16 == 0x5a4d || m16 == 0x4d5a || m16 == 0x5742 || m16 == 0x454c || m16 == 0x014c ||
+        m32 == 0x31574d50 || m32 == 0x6d616441 || m32 == 0x00004550) // MZ ZM BW LE PMW1 Adam PE
+        r |= SNIFF_EXE;
+    if (m32 == 0x464c457f) // "\x7fELF"
+        r |= SNIFF_ELF;
+    if (m16 == 0x2123 || m32 == 0xbebafeca || m32 == 0x00640107 || m32 == 0x00640108 ||
+        m32 == 0x0064010b || m32 == 0x006400cc) // "#!", Java, OMAGIC NMAGIC ZMAGIC QMAGIC
+        r |= SNIFF_EXECVE;
+    if (find_le32(tail, tail_len, UPX_MAGIC_LE32) >= 0) // see PackUnix::find_overlay_offset()
+        r |= SNIFF_EXECVE;
+    if (head_len >= 512 && get_le16(head + 510) == 0xaa55) // see PackVmlinuzI386::readFileHeader()
+        r |= SNIFF_VMLINUZ;
+    unsigned nops = 0; // see PackVmlinuzARMEL::readFileHeader()
+    while (nops < 8 && get_le32(head + 4 * nops) == 0xe1a00000)
+        nops += 1;
+    if (nops == 8)
+        r |= SNIFF_VMLINUZ;
+    if ((m32 | 1) == 0xfeedfacf || (get_be32(head) | 1) == 0xfeedfacf || m32 == 0xbebafeca)
+        r |= SNIFF_MACH;
+    if (get_be16(head) == 0x601a)
+        r |= SNIFF_TOS;
+    if (memcmp(head, "PS-X EXE", 8) == 0 || memcmp(head, "EXE X-SP", 8) == 0)
+        r |= SNIFF_PS1;
+    return r;
+}
+
 /*************************************************************************
 //
 **************************************************************************/
 
 /*static*/
 Packer *PackMaster::visitAllPackers(visit_func_t func, InputFile *f, const Options *o, void *user) {
+    const unsigned sniff = sniffFormats(f);
+    if (o->debug.debug_level)
+        fprintf(stderr, "visitAllPackers: sniff=%#x\n", sniff);
 
-#define D(Klass)                                                                                   \
+#define D(Klass, family)                                                                           \
     ACC_BLOCK_BEGIN                                                                                \
-    COMPILE_TIME_ASSERT(std::is_nothrow_destructible_v<Klass>)                                     \
-    Klass *kp = new Klass(f);                                                                      \
-    kp->assertPacker();                                                                            \
-    if (o->debug.debug_level)                                                                      \
-        fprintf(stderr, "visitAllPackers: (ver=%d, fmt=%3d) %s\n", kp->getVersion(),               \
-                kp->getFormat(), #Klass);                                                          \
-    Packer *p = func(kp, user);                                                                    \
-    if (p != nullptr)                                                                              \
-        return p;                                                                                  \
+    if (sniff & (family)) {                                                                        \
+        COMPILE_TIME_ASSERT(std::is_nothrow_destructible_v<Klass>)                                 \
+        Klass *kp = new Klass(f);                                                                  \
+        kp->assertPacker();                                                                        \
+        if (o->debug.debug_level)                                                                  \
+            fprintf(stderr, "visitAllPackers: (ver=%d, fmt=%3d) %s\n", kp->getVersion(),           \
+                    kp->getFormat(), #Klass);                                                      \
+        Packer *p = func(kp, user);                                                                \
+        if (p != nullptr)                                                                          \
+            return p;                                                                              \
+    }                                                                                              \
     ACC_BLOCK_END
 
     // NOTE: order of tries is important !!!
@@ -159,78 +242,79 @@ Packer *PackMaster::visitAllPackers(visit_func_t func, InputFile *f, const Optio
     //
     if (!o->dos_exe.force_stub) {
         // dos32
-        D(PackDjgpp2);
-        D(PackTmt);
-        D(PackWcle);
+        D(PackDjgpp2, SNIFF_EXE);
+        D(PackTmt, SNIFF_EXE);
+        D(PackWcle, SNIFF_EXE);
         // Windows
-        // D(PackW64PeArm64EC); // NOT YET IMPLEMENTED
-        // D(PackW64PeArm64); // NOT YET IMPLEMENTED
-        D(PackW64PeAmd64);
-        D(PackW32PeI386);
-        D(PackWinCeArm);
+        // D(PackW64PeArm64EC, SNIFF_EXE); // NOT YET IMPLEMENTED
+        // D(PackW64PeArm64, SNIFF_EXE); // NOT YET IMPLEMENTED
+        D(PackW64PeAmd64, SNIFF_EXE);
+        D(PackW32PeI386, SNIFF_EXE);
+        D(PackWinCeArm, SNIFF_EXE);
     }
-    D(PackExe); // dos/exe
+    D(PackExe, SNIFF_EXE); // dos/exe
 
     //
     // linux kernel
     //
-    D(PackVmlinuxARMEL);
-    D(PackVmlinuxARMEB);
-    D(PackVmlinuxPPC32);
-    D(PackVmlinuxPPC64LE);
-    D(PackVmlinuxAMD64);
-    D(PackVmlinuxI386);
-    D(PackVmlinuzI386);
-    D(PackBvmlinuzI386);
-    D(PackVmlinuzARMEL);
+    D(PackVmlinuxARMEL, SNIFF_ELF);
+    D(PackVmlinuxARMEB, SNIFF_ELF);
+    D(PackVmlinuxPPC32, SNIFF_ELF);
+    D(PackVmlinuxPPC64LE, SNIFF_ELF);
+    D(PackVmlinuxAMD64, SNIFF_ELF);
+    D(PackVmlinuxI386, SNIFF_ELF);
+    D(PackVmlinuzI386, SNIFF_VMLINUZ);
+    D(PackBvmlinuzI386, SNIFF_VMLINUZ);
+    D(PackVmlinuzARMEL, SNIFF_VMLINUZ);
 
     //
     // linux
     //
     if (!o->o_unix.force_execve) {
         if (o->o_unix.use_ptinterp) {
-            D(PackLinuxElf32x86interp);
+            D(PackLinuxElf32x86interp, SNIFF_ALL); // --make-ptinterp accepts any file
         }
-        D(PackFreeBSDElf32x86);
-        D(PackNetBSDElf32x86);
-        D(PackOpenBSDElf32x86);
-        D(PackLinuxElf32x86);
-        D(PackLinuxElf64amd);
-        D(PackLinuxElf32armLe);
-        D(PackLinuxElf32armBe);
-        D(PackLinuxElf64arm);
-        D(PackLinuxElf32ppc);
-        D(PackLinuxElf64ppc);
-        D(PackLinuxElf64ppcle);
-        D(PackLinuxElf32mipsel);
-        D(PackLinuxElf32mipseb);
-        D(PackLinuxI386sh);
+        D(PackFreeBSDElf32x86, SNIFF_ELF);
+        D(PackNetBSDElf32x86, SNIFF_ELF);
+        D(PackOpenBSDElf32x86, SNIFF_ELF);
+        D(PackLinuxElf32x86, SNIFF_ELF);
+        D(PackLinuxElf64amd, SNIFF_ELF);
+        D(PackLinuxElf32armLe, SNIFF_ELF);
+        D(PackLinuxElf32armBe, SNIFF_ELF);
+        D(PackLinuxElf64arm, SNIFF_ELF);
+        D(PackLinuxElf32ppc, SNIFF_ELF);
+        D(PackLinuxElf64ppc, SNIFF_ELF);
+        D(PackLinuxElf64ppcle, SNIFF_ELF);
+        D(PackLinuxElf32mipsel, SNIFF_ELF);
+        D(PackLinuxElf32mipseb, SNIFF_ELF);
+        D(PackLinuxI386sh, SNIFF_ELF | SNIFF_EXECVE);
     }
-    D(PackBSDI386);
-    D(PackMachFat);   // cafebabe conflict
-    D(PackLinuxI386); // cafebabe conflict
+    D(PackBSDI386, SNIFF_ELF | SNIFF_EXECVE);
+    D(PackMachFat, SNIFF_MACH);                 // cafebabe conflict
+    D(PackLinuxI386, SNIFF_ELF | SNIFF_EXECVE); // cafebabe conflict
 
     // Mach (Darwin / macOS)
-    D(PackDylibAMD64);
-    D(PackMachPPC32); // TODO: this works with upx 3.91..3.94 but got broken in 3.95; FIXME
-    D(PackMachI386);
-    D(PackMachAMD64);
-    D(PackMachARMEL);
-    D(PackMachARM64EL);
+    D(PackDylibAMD64, SNIFF_MACH);
+    // TODO: PackMachPPC32 works with upx 3.91..3.94 but got broken in 3.95; FIXME
+    D(PackMachPPC32, SNIFF_MACH);
+    D(PackMachI386, SNIFF_MACH);
+    D(PackMachAMD64, SNIFF_MACH);
+    D(PackMachARMEL, SNIFF_MACH);
+    D(PackMachARM64EL, SNIFF_MACH);
 
     // 2010-03-12  omit these because PackMachBase<T>::pack4dylib (p_mach.cpp)
     // does not understand what the Darwin (Apple Mac OS X) dynamic loader
     // assumes about .dylib file structure.
-    //   D(PackDylibI386);
-    //   D(PackDylibPPC32);
+    //   D(PackDylibI386, SNIFF_MACH);
+    //   D(PackDylibPPC32, SNIFF_MACH);
 
     //
     // misc
     //
-    D(PackTos); // atari/tos
-    D(PackPs1); // ps1/exe
-    D(PackSys); // dos/sys
-    D(PackCom); // dos/com
+    D(PackTos, SNIFF_TOS); // atari/tos
+    D(PackPs1, SNIFF_PS1); // ps1/exe
+    D(PackSys, SNIFF_ANY); // dos/sys
+    D(PackCom, SNIFF_ANY); // dos/com
 
     return nullptr;
 #undef D
@@ -256,19 +340,25 @@ Packer *PackMaster::visitAllPackers(visit_func_t func, InputFile *f, const Optio
 
 void PackMaster::pack(OutputFile *fo) {
     assert(packer == nullptr);
+    const UiStats::Timer timer;
     packer = getPacker(fi);
+    timer.stop(packer->uip->stats, UiStats::PH_DETECT, fi->st_size());
     packer->doPack(fo);
 }
 
 void PackMaster::unpack(OutputFile *fo) {
     assert(packer == nullptr);
+    const UiStats::Timer timer;
     packer = getUnpacker(fi);
+    timer.stop(packer->uip->stats, UiStats::PH_DETECT, fi->st_size());
     packer->doUnpack(fo);
 }
 
 void PackMaster::test() {
     assert(packer == nullptr);
+    const UiStats::Timer timer;
     packer = getUnpacker(fi);
+    timer.stop(packer->uip->stats, UiStats::PH_DETECT, fi->st_size());
     packer->doTest();
 }
 
@@ -288,4 +378,75 @@ void PackMaster::fileInfo() {
     packer->doFileInfo();
 }
 
+/*************************************************************************
+// test
+**************************************************************************/
+
+static unsigned sniff_test_file(const byte *buf, unsigned len) {
+    const char *const name = "upx-test-sniff.tmp";
+    OutputFile::dump(name, buf, len);
+    unsigned r;
+    {
+        InputFile fi;
+        fi.open(name, O_RDONLY | O_BINARY);
+        r = sniffFormats(&fi);
+        fi.closex();
+    }
+    FileBase::unlink(name);
+    return r;
+}
+
+TEST_CASE("sniffFormats") {
+    CHECK(sniffFormats(nullptr) == SNIFF_ALL);
+    byte b[8192];
+    memset(b, 0, sizeof(b));
+    CHECK(sniff_test_file(b, 63) == SNIFF_ALL); // too short to tell
+    CHECK(sniff_test_file(b, sizeof(b)) == SNIFF_ANY);
+
+    struct Magic {
+        unsigned off;
+        bool be;
+        unsigned value;
+        unsigned size;
+        unsigned expected;
+    };
+    static const Magic magics[] = {
+        {0, false, 0x5a4d, 2, SNIFF_EXE},                        // MZ
+        {0, false, 0x00004550, 4, SNIFF_EXE},                    // PE
+        {0, false, 0x464c457f, 4, SNIFF_ELF},                    // ELF
+        {0, false, 0x2123, 2, SNIFF_EXECVE},                     // #!
+        {0, false, 0x00640107, 4, SNIFF_EXECVE},                 // a.out OMAGIC
+        {0, false, 0x00640108, 4, SNIFF_EXECVE},                 // a.out NMAGIC
+        {0, false, 0x0064010b, 4, SNIFF_EXECVE},                 // a.out ZMAGIC
+        {0, false, 0x006400cc, 4, SNIFF_EXECVE},                 // a.out QMAGIC
+        {510, false, 0xaa55, 2, SNIFF_VMLINUZ},                  // boot sector
+        {0, false, 0xfeedface, 4, SNIFF_MACH},                   // Mach-O 32 LE
+        {0, false, 0xfeedfacf, 4, SNIFF_MACH},                   // Mach-O 64 LE
+        {0, true, 0xfeedface, 4, SNIFF_MACH},                    // Mach-O 32 BE
+        {0, true, 0xfeedfacf, 4, SNIFF_MACH},                    // Mach-O 64 BE
+        {0, true, 0xcafebabe, 4, SNIFF_MACH | SNIFF_EXECVE},     // fat or Java
+        {0, true, 0x601a, 2, SNIFF_TOS},                         // atari/tos
+        {sizeof(b) - 36, false, UPX_MAGIC_LE32, 4, SNIFF_EXECVE}, // trailing UPX!
+    };
+    for (const Magic &m : magics) {
+        memset(b, 0, sizeof(b));
+        if (m.size == 2)
+            m.be ? set_be16(b + m.off, m.value) : set_le16(b + m.off, m.value);
+        else
+            m.be ? set_be32(b + m.off, m.value) : set_le32(b + m.off, m.value);
+        CHECK(sniff_test_file(b, sizeof(b)) == (SNIFF_ANY | m.expected));
+    }
+
+    memset(b, 0, sizeof(b)); // ARM zImage nop sled
+    for (unsigned i = 0; i < 8; i++)
+        set_le32(b + 4 * i, 0xe1a00000);
+    CHECK(sniff_test_file(b, sizeof(b)) == (SNIFF_ANY | SNIFF_VMLINUZ));
+    set_le32(b + 4 * 7, 0); // 7 nops are not enough
+    CHECK(sniff_test_file(b, sizeof(b)) == SNIFF_ANY);
+
+    memset(b, 0, sizeof(b));
+    memcpy(b, "PS-X EXE", 8);
+    CHECK(sniff_test_file(b, sizeof(b)) == (SNIFF_ANY | SNIFF_PS1));
+}
+
 /* vim:set ts=4 sw=4 et: */
@@ -1,5 +1,5 @@
 /* amd64-darwin.dylib-entry.h
-   created from amd64-darwin.dylib-entry.bin, 8669 (0x21dd) bytes
+   created from amd64-darwin.dylib-entry.bin, 7022 (0x1b6e) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_DARWIN_DYLIB_ENTRY_SIZE    8669
-#define STUB_AMD64_DARWIN_DYLIB_ENTRY_ADLER32 0x193620b8
-#define STUB_AMD64_DARWIN_DYLIB_ENTRY_CRC32   0xe2c934e4
+#define STUB_AMD64_DARWIN_DYLIB_ENTRY_SIZE    7022
+#define STUB_AMD64_DARWIN_DYLIB_ENTRY_ADLER32 0x9eba6f27
+#define STUB_AMD64_DARWIN_DYLIB_ENTRY_CRC32   0x727e750d
 
-unsigned char stub_amd64_darwin_dylib_entry[8669] = {
+unsigned char stub_amd64_darwin_dylib_entry[7022] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0, 32, 25,  0,  0,  0,  0,  0,  0,
@@ -427,155 +427,52 @@ unsigned char stub_amd64_darwin_dylib_entry[8669] = {
 /* 0x1840 */  86, 94,172, 60,128,114, 10, 60,143,119,  6,128,126,254, 15,116,
 /* 0x1850 */   6, 44,232, 60,  1,119,228, 72, 57,206,115, 22, 86,173, 40,208,
 /* 0x1860 */ 117,223, 95, 15,200, 41,248,  1,216,171, 72, 57,206,115,  3,172,
-/* 0x1870 */ 235,223, 91,195,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1880 */ 101,108,102, 54, 52, 45,120, 56, 54, 45, 54, 52, 10, 10, 83,101,
-/* 0x1890 */  99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101,
-/* 0x18a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32,
-/* 0x18b0 */  32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x18c0 */  32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x18d0 */  32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102,
-/* 0x18e0 */  32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32,
-/* 0x18f0 */  48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32,
-/* 0x1900 */  48, 49,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32,
-/* 0x1910 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1920 */  32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32,
-/* 0x1930 */  32, 48, 54, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53,100, 32,
-/* 0x1940 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1950 */  32, 32, 50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1960 */  32, 32, 48, 98, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 99, 51,
-/* 0x1970 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1980 */  10, 32, 32, 51, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32,
-/* 0x1990 */  32, 32, 32, 48, 97, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x19a0 */  55,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x19b0 */  84, 83, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32,
-/* 0x19c0 */  32, 32, 32, 32, 32, 48, 57, 51, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x19d0 */  48, 50, 49,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x19e0 */  69, 78, 84, 83, 10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x19f0 */  70, 48, 48, 32, 32, 32, 32, 48, 54, 52, 32, 32, 48, 32, 32, 48,
-/* 0x1a00 */  32, 32, 48, 50, 98, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1a10 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95,
-/* 0x1a20 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 57,102, 55, 32, 32, 48,
-/* 0x1a30 */  32, 32, 48, 32, 32, 48, 51, 49, 53, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1a40 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 76, 90,
-/* 0x1a50 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 57,102, 55,
-/* 0x1a60 */  32, 32, 48, 32, 32, 48, 32, 32, 48,100, 48, 99, 32, 32, 50, 42,
-/* 0x1a70 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56,
-/* 0x1a80 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48,
-/* 0x1a90 */  49, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 48, 51, 32,
-/* 0x1aa0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1ab0 */  32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32,
-/* 0x1ac0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 49, 98,
-/* 0x1ad0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1ae0 */  10, 32, 49, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 32,
-/* 0x1af0 */  32, 32, 32, 48, 49, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x1b00 */  55, 49, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1b10 */  78, 84, 83, 10, 32, 49, 49, 32, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x1b20 */  90, 32, 32, 32, 32, 32, 48, 49, 52, 56, 32, 32, 48, 32, 32, 48,
-/* 0x1b30 */  32, 32, 48, 49, 55, 50, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1b40 */  79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84,
-/* 0x1b50 */  65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b60 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x1b70 */  82, 86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86, 95, 72, 69,
-/* 0x1b80 */  65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b90 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x1ba0 */  95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1bb0 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67,
-/* 0x1bd0 */  72, 77, 65, 73, 78, 89, 32, 48, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x1be0 */  78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72,
-/* 0x1c00 */  77, 65, 73, 78, 90, 32, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x1c10 */  90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c20 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77,
-/* 0x1c30 */  65, 73, 78, 88, 32, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88,
-/* 0x1c40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c50 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32,
-/* 0x1c60 */  48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1c80 */  32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x1c90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ca0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32,
-/* 0x1cb0 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1cd0 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65,
-/* 0x1ce0 */  95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1d00 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77,
-/* 0x1d10 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1d30 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90,
-/* 0x1d40 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1d60 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 48, 32, 78, 82, 86,
-/* 0x1d70 */  95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 77,
-/* 0x1d90 */  65, 67, 72, 77, 65, 73, 78, 88, 32, 48, 32, 95,115,116, 97,114,
-/* 0x1da0 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1db0 */  49, 49, 32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77,
-/* 0x1dc0 */  65, 73, 78, 89, 32, 48, 32,101,110,100, 95,100,101, 99,111,109,
-/* 0x1dd0 */ 112,114,101,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1de0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 77,
-/* 0x1df0 */  65, 67, 72, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x1e00 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x1e10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x1e20 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e30 */  48, 48, 48, 97, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x1e40 */  51, 50, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90,
-/* 0x1e50 */  43, 48,120,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x1e60 */ 102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x1e70 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x1e80 */  50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x1e90 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x1ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x1eb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 97,102, 32, 82,
-/* 0x1ec0 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x1ed0 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48,
-/* 0x1ee0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95,
-/* 0x1f00 */  88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x1f10 */  77, 65, 67, 72, 77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,
-/* 0x1f20 */ 102,102,102,102,102,102,102,102,102,102,102, 99, 10, 10, 82, 69,
-/* 0x1f30 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x1f40 */  32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70,
-/* 0x1f50 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x1f60 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f70 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f80 */  48, 48, 48, 48, 48, 57, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x1f90 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69,
-/* 0x1fa0 */  65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 53, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x1fd0 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x1fe0 */  78, 89, 43, 48,120,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x1ff0 */ 102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2000 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x2010 */  82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2020 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2030 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2040 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 56, 98,
-/* 0x2050 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32,
-/* 0x2060 */  32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48,
-/* 0x2080 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 51, 32,
-/* 0x2090 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x20a0 */  32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 43, 48,120,102,102,
-/* 0x20b0 */ 102,102,102,102,102,102,102,102,102,102,102,102,102, 99, 10, 10,
-/* 0x20c0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x20d0 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x20e0 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x20f0 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2100 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2110 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82,
-/* 0x2120 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x2130 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48,
-/* 0x2140 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 50, 10, 10,
-/* 0x2150 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2160 */  68, 83, 32, 70, 79, 82, 32, 91, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x2170 */  90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32,
-/* 0x2180 */  32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2190 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 99, 32, 82, 95,
-/* 0x21b0 */  88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21c0 */  77, 65, 67, 72, 77, 65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 52, 99, 10
+/* 0x1870 */ 235,223, 91,195, 12,  0,  0,  0, 14,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1880 */ 158,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 29,  0,  0,  0,
+/* 0x1890 */   0,  0,  0,  0, 10,  0,  0,  0, 93,  0,  0,  0,102,  0,  0,  0,
+/* 0x18a0 */   0,  0,  0,  0, 19,  0,  0,  0,195,  0,  0,  0,186,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0, 25,  0,  0,  0,125,  1,  0,  0,161,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0, 31,  0,  0,  0, 30,  2,  0,  0,147,  0,  0,  0,
+/* 0x18d0 */   0,  0,  0,  0, 37,  0,  0,  0,177,  2,  0,  0,100,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0, 48,  0,  0,  0, 21,  3,  0,  0,247,  9,  0,  0,
+/* 0x18f0 */   0,  0,  0,  0, 59,  0,  0,  0, 12, 13,  0,  0,247,  9,  0,  0,
+/* 0x1900 */   0,  0,  0,  0, 70,  0,  0,  0,  3, 23,  0,  0, 24,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0, 81,  0,  0,  0, 27, 23,  0,  0,  0,  0,  0,  0,
+/* 0x1920 */   0,  0,  0,  0, 90,  0,  0,  0, 27, 23,  0,  0, 17,  0,  0,  0,
+/* 0x1930 */   0,  0,  0,  0,100,  0,  0,  0, 44, 23,  0,  0, 72,  1,  0,  0,
+/* 0x1940 */   0,  0,  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1950 */  70,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x1960 */  10,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1980 */  19,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,
+/* 0x1990 */   3,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  4,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0, 37,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19b0 */  48,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 59,  0,  0,  0,
+/* 0x19c0 */   7,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  9,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19e0 */ 117,  0,  0,  0, 10,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */  10,  0,  0,  0,132,  0,  0,  0,100,  0,  0,  0,252,255,255,255,
+/* 0x1a00 */ 255,255,255,255,  2,  0,  0,  0,175,  0,  0,  0,132,  0,  0,  0,
+/* 0x1a10 */  10,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1a20 */  92,  0,  0,  0,132,  0,  0,  0, 90,  0,  0,  0,252,255,255,255,
+/* 0x1a30 */ 255,255,255,255,  3,  0,  0,  0,150,  0,  0,  0,132,  0,  0,  0,
+/* 0x1a40 */  10,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1a50 */  92,  0,  0,  0,132,  0,  0,  0, 90,  0,  0,  0,252,255,255,255,
+/* 0x1a60 */ 255,255,255,255,  4,  0,  0,  0,139,  0,  0,  0,132,  0,  0,  0,
+/* 0x1a70 */  10,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1a80 */  83,  0,  0,  0,132,  0,  0,  0, 90,  0,  0,  0,252,255,255,255,
+/* 0x1a90 */ 255,255,255,255,  5,  0,  0,  0,  6,  0,  0,  0,132,  0,  0,  0,
+/* 0x1aa0 */  70,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1ab0 */  28,  0,  0,  0,146,  0,  0,  0,100,  0,  0,  0, 76,  1,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0, 77, 65, 67, 72, 77, 65, 73, 78, 88,  0, 78, 82,
+/* 0x1ad0 */  86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86,
+/* 0x1ae0 */  50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76,
+/* 0x1af0 */  70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76,
+/* 0x1b00 */  90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x1b10 */  69, 67, 51, 48,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 77, 65,
+/* 0x1b20 */  67, 72, 77, 65, 73, 78, 89,  0, 77, 65, 67, 72, 77, 65, 73, 78,
+/* 0x1b30 */  90,  0, 95,115,116, 97,114,116,  0,101,110,100, 95,100,101, 99,
+/* 0x1b40 */ 111,109,112,114,101,115,115,  0, 82, 95, 88, 56, 54, 95, 54, 52,
+/* 0x1b50 */  95, 80, 67, 51, 50,  0, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51,
+/* 0x1b60 */  50,  0,116, 24,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
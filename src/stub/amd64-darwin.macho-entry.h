@@ -1,5 +1,5 @@
 /* amd64-darwin.macho-entry.h
-   created from amd64-darwin.macho-entry.bin, 8895 (0x22bf) bytes
+   created from amd64-darwin.macho-entry.bin, 7126 (0x1bd6) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_DARWIN_MACHO_ENTRY_SIZE    8895
-#define STUB_AMD64_DARWIN_MACHO_ENTRY_ADLER32 0x2fa94d83
-#define STUB_AMD64_DARWIN_MACHO_ENTRY_CRC32   0x2f9e3790
+#define STUB_AMD64_DARWIN_MACHO_ENTRY_SIZE    7126
+#define STUB_AMD64_DARWIN_MACHO_ENTRY_ADLER32 0xa69f7e64
+#define STUB_AMD64_DARWIN_MACHO_ENTRY_CRC32   0xd9cf7877
 
-unsigned char stub_amd64_darwin_macho_entry[8895] = {
+unsigned char stub_amd64_darwin_macho_entry[7126] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0, 88, 25,  0,  0,  0,  0,  0,  0,
@@ -429,167 +429,57 @@ unsigned char stub_amd64_darwin_macho_entry[8895] = {
 /* 0x1860 */ 101, 95,112, 97,116,104, 61, 72, 57, 72,  8,117,218, 72,141,120,
 /* 0x1870 */  16, 41,246,184,  5,  0,  0,  2, 15,  5, 80, 72,141, 53,  0,  0,
 /* 0x1880 */   0,  0, 73,137,244,173, 73, 41,196, 73,137,246,173, 73, 41,198,
-/* 0x1890 */  76,141,120,248, 76,137,100, 36, 16,232,203,254,255,255,102,105,
-/* 0x18a0 */ 108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 54, 52, 45,
-/* 0x18b0 */ 120, 56, 54, 45, 54, 52, 10, 10, 83,101, 99,116,105,111,110,115,
-/* 0x18c0 */  58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32,
-/* 0x18d0 */  32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77,
-/* 0x18e0 */  65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x18f0 */  76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1900 */  32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110,
-/* 0x1910 */  32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 65, 77, 68, 54,
-/* 0x1920 */  52, 66, 88, 88, 32, 32, 32, 32, 32, 32, 48, 52, 99, 32, 32, 48,
-/* 0x1930 */  32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1940 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 77, 65, 67,
-/* 0x1950 */  72, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x1960 */  32, 32, 48, 32, 32, 48, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1970 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 77, 65, 67,
-/* 0x1980 */  72, 95, 85, 78, 67, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48,
-/* 0x1990 */  32, 32, 48, 32, 32, 48, 57, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x19a0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78, 82, 86,
-/* 0x19b0 */  95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 54, 55, 32, 32,
-/* 0x19c0 */  48, 32, 32, 48, 32, 32, 48, 57, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x19d0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78, 82,
-/* 0x19e0 */  86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 98, 97, 32,
-/* 0x19f0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 48, 48, 32, 32, 50, 42, 42,
-/* 0x1a00 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32,
-/* 0x1a10 */  78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 97,
-/* 0x1a20 */  49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 97, 32, 32, 50,
-/* 0x1a30 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x1a40 */  54, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a50 */  48, 57, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 53, 98, 32,
-/* 0x1a60 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1a70 */  32, 32, 55, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32,
-/* 0x1a80 */  32, 32, 48, 54, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,101,
-/* 0x1a90 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1aa0 */  83, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1ab0 */  32, 32, 32, 32, 48, 57,102, 55, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1ac0 */  48, 51, 53, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1ad0 */  69, 78, 84, 83, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1ae0 */  67, 50, 48, 32, 32, 32, 32, 48, 57,102, 55, 32, 32, 48, 32, 32,
-/* 0x1af0 */  48, 32, 32, 48,100, 52, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1b00 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 76, 90, 77, 65,
-/* 0x1b10 */  95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 49, 56, 32, 32, 48,
-/* 0x1b20 */  32, 32, 48, 32, 32, 48, 49, 55, 52, 48, 32, 32, 50, 42, 42, 48,
-/* 0x1b30 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 78,
-/* 0x1b40 */  82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 32, 32,
-/* 0x1b50 */  48, 32, 32, 48, 32, 32, 48, 49, 55, 53, 56, 32, 32, 50, 42, 42,
-/* 0x1b60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32,
-/* 0x1b70 */  77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 48, 49,
-/* 0x1b80 */  49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 53, 56, 32, 32,
-/* 0x1b90 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1ba0 */  49, 51, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 32, 32, 32, 32,
-/* 0x1bb0 */  32, 48, 49, 51, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55,
-/* 0x1bc0 */  54, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1bd0 */  84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58,
-/* 0x1be0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69,
-/* 0x1c00 */  65, 68, 32, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48,
-/* 0x1c10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1c20 */  32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x1c30 */  48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48,
-/* 0x1c40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c50 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x1c60 */  89, 32, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 10, 48, 48,
-/* 0x1c70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1c80 */  32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90,
-/* 0x1c90 */  32, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1cb0 */  32, 32, 32,100, 32, 32, 65, 77, 68, 54, 52, 66, 88, 88, 32, 48,
-/* 0x1cc0 */  32, 65, 77, 68, 54, 52, 66, 88, 88, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1ce0 */ 100, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 32, 48, 32, 77,
-/* 0x1cf0 */  65, 67, 72, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1d10 */  32, 32, 77, 65, 67, 72, 95, 85, 78, 67, 32, 48, 32, 77, 65, 67,
-/* 0x1d20 */  72, 95, 85, 78, 67, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x1d40 */  82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1d60 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82,
-/* 0x1d70 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1d90 */  50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1db0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48,
-/* 0x1dc0 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1de0 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32,
-/* 0x1df0 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x1e00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1e10 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x1e20 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x1e30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1e40 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32,
-/* 0x1e50 */  48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x1e70 */  32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 32, 48, 32,
-/* 0x1e80 */  95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48, 48, 48, 49, 49, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ea0 */  77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 48, 32,101,110,100, 95,
-/* 0x1eb0 */ 100,101, 99,111,109,112,114,101,115,115, 10, 10, 82, 69, 76, 79,
-/* 0x1ec0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x1ed0 */  79, 82, 32, 91, 77, 65, 67, 72, 77, 65, 73, 78, 88, 93, 58, 10,
-/* 0x1ee0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ef0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f00 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 88, 56, 54, 95,
-/* 0x1f20 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 77, 65, 67, 72,
-/* 0x1f30 */  77, 65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 99, 56, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x1f50 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x1f60 */  32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1f70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1f80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1f90 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fa0 */  48, 97,102, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x1fb0 */  50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,
-/* 0x1fc0 */ 120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x1fd0 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fe0 */  53, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x1ff0 */  32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 43, 48,
-/* 0x2000 */ 120,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x2010 */  99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x2020 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68,
-/* 0x2030 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2040 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2050 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x2060 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 54, 32, 82, 95, 88,
-/* 0x2070 */  56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78,
-/* 0x2080 */  82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48,
-/* 0x2090 */  48, 48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48,
-/* 0x20a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 88, 56,
-/* 0x20b0 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 77, 65,
-/* 0x20c0 */  67, 72, 77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,102,102,
-/* 0x20d0 */ 102,102,102,102,102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79,
-/* 0x20e0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x20f0 */  79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2100 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x2110 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2120 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  48, 48, 48, 56, 98, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80,
-/* 0x2140 */  67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,
-/* 0x2150 */  43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2160 */  48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2170 */  48, 48, 53, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x2180 */  51, 50, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89,
-/* 0x2190 */  43, 48,120,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x21a0 */ 102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x21b0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77,
-/* 0x21c0 */  65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x21d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x21e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x21f0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x2210 */  50, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x2220 */  43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  48, 49, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x2240 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 77, 65, 67,
-/* 0x2250 */  72, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x2260 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x2270 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x2280 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x2290 */  49, 53, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x22a0 */  32, 32, 32, 32, 32, 95,115,116, 97,114,116, 43, 48,120,102,102,
-/* 0x22b0 */ 102,102,102,102,102,102,102,102,102,102,102,102,102, 52, 10
+/* 0x1890 */  76,141,120,248, 76,137,100, 36, 16,232,203,254,255,255, 14,  0,
+/* 0x18a0 */   0,  0, 16,  0,  0,  0,  9,  0,  0,  0,164,  0,  0,  0,  0,  0,
+/* 0x18b0 */   0,  0, 64,  0,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x18c0 */   0,  0,140,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 19,  0,
+/* 0x18d0 */   0,  0,145,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 28,  0,
+/* 0x18e0 */   0,  0,153,  0,  0,  0,103,  0,  0,  0,  0,  0,  0,  0, 37,  0,
+/* 0x18f0 */   0,  0,  0,  1,  0,  0,186,  0,  0,  0,  0,  0,  0,  0, 43,  0,
+/* 0x1900 */   0,  0,186,  1,  0,  0,161,  0,  0,  0,  0,  0,  0,  0, 49,  0,
+/* 0x1910 */   0,  0, 91,  2,  0,  0,147,  0,  0,  0,  0,  0,  0,  0, 55,  0,
+/* 0x1920 */   0,  0,238,  2,  0,  0,100,  0,  0,  0,  0,  0,  0,  0, 66,  0,
+/* 0x1930 */   0,  0, 82,  3,  0,  0,247,  9,  0,  0,  0,  0,  0,  0, 77,  0,
+/* 0x1940 */   0,  0, 73, 13,  0,  0,247,  9,  0,  0,  0,  0,  0,  0, 88,  0,
+/* 0x1950 */   0,  0, 64, 23,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0, 99,  0,
+/* 0x1960 */   0,  0, 88, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,  0,
+/* 0x1970 */   0,  0, 88, 23,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,118,  0,
+/* 0x1980 */   0,  0,105, 23,  0,  0, 53,  1,  0,  0,  0,  0,  0,  0, 28,  0,
+/* 0x1990 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 88,  0,  0,  0, 10,  0,
+/* 0x19a0 */   0,  0,  0,  0,  0,  0,108,  0,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x19b0 */   0,  0,118,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0, 19,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x19e0 */   0,  0, 37,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 43,  0,
+/* 0x19f0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  6,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0,  0, 55,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0,  0, 66,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 77,  0,
+/* 0x1a20 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 11,  0,
+/* 0x1a30 */   0,  0,  0,  0,  0,  0,128,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1a40 */   0,  0,135,  0,  0,  0, 12,  0,  0,  0, 17,  0,  0,  0,  1,  0,
+/* 0x1a50 */   0,  0,  1,  0,  0,  0,150,  0,  0,  0,118,  0,  0,  0,200,  0,
+/* 0x1a60 */   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,175,  0,  0,  0,150,  0,
+/* 0x1a70 */   0,  0, 28,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  4,  0,
+/* 0x1a80 */   0,  0, 92,  0,  0,  0,150,  0,  0,  0,108,  0,  0,  0,252,255,
+/* 0x1a90 */ 255,255,255,255,255,255,  5,  0,  0,  0,150,  0,  0,  0,150,  0,
+/* 0x1aa0 */   0,  0, 28,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+/* 0x1ab0 */   0,  0, 92,  0,  0,  0,150,  0,  0,  0,108,  0,  0,  0,252,255,
+/* 0x1ac0 */ 255,255,255,255,255,255,  6,  0,  0,  0,139,  0,  0,  0,150,  0,
+/* 0x1ad0 */   0,  0, 28,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x1ae0 */   0,  0, 83,  0,  0,  0,150,  0,  0,  0,108,  0,  0,  0,252,255,
+/* 0x1af0 */ 255,255,255,255,255,255,  7,  0,  0,  0,  6,  0,  0,  0,150,  0,
+/* 0x1b00 */   0,  0, 88,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0, 13,  0,
+/* 0x1b10 */   0,  0, 21,  1,  0,  0,150,  0,  0,  0,128,  0,  0,  0,244,255,
+/* 0x1b20 */ 255,255,255,255,255,255, 65, 77, 68, 54, 52, 66, 88, 88,  0, 77,
+/* 0x1b30 */  65, 67, 72, 77, 65, 73, 78, 88,  0, 77, 65, 67, 72, 95, 85, 78,
+/* 0x1b40 */  67,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,
+/* 0x1b50 */   0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77,
+/* 0x1b60 */  65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x1b70 */  49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90,
+/* 0x1b80 */  77, 65, 95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 84, 65, 73,
+/* 0x1b90 */  76,  0, 77, 65, 67, 72, 77, 65, 73, 78, 89,  0, 77, 65, 67, 72,
+/* 0x1ba0 */  77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0,101,110,100,
+/* 0x1bb0 */  95,100,101, 99,111,109,112,114,101,115,115,  0, 82, 95, 88, 56,
+/* 0x1bc0 */  54, 95, 54, 52, 95, 80, 67, 51, 50,  0,158, 24,  0,  0, 85, 80,
+/* 0x1bd0 */  88, 76, 78, 75, 48, 49
 };
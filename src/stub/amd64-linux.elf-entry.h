@@ -1,5 +1,5 @@
 /* amd64-linux.elf-entry.h
-   created from amd64-linux.elf-entry.bin, 8638 (0x21be) bytes
+   created from amd64-linux.elf-entry.bin, 6912 (0x1b00) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_LINUX_ELF_ENTRY_SIZE    8638
-#define STUB_AMD64_LINUX_ELF_ENTRY_ADLER32 0xcdd5efc3
-#define STUB_AMD64_LINUX_ELF_ENTRY_CRC32   0x86cbc9ed
+#define STUB_AMD64_LINUX_ELF_ENTRY_SIZE    6912
+#define STUB_AMD64_LINUX_ELF_ENTRY_ADLER32 0x8cf12ab7
+#define STUB_AMD64_LINUX_ELF_ENTRY_CRC32   0x27bde8a5
 
-unsigned char stub_amd64_linux_elf_entry[8638] = {
+unsigned char stub_amd64_linux_elf_entry[6912] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,168, 24,  0,  0,  0,  0,  0,  0,
@@ -419,161 +419,53 @@ unsigned char stub_amd64_linux_elf_entry[8638] = {
 /* 0x17c0 */ 173, 65,144, 72,137,247, 94,255,213, 89, 72,139,116, 36, 24, 72,
 /* 0x17d0 */ 139,124, 36, 16,106,  5, 90,106, 10, 88, 15,  5, 65,255,229, 93,
 /* 0x17e0 */ 232,122,255,255,255, 47,112,114,111, 99, 47,115,101,108,102, 47,
-/* 0x17f0 */ 101,120,101,  0,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x1800 */ 109, 97,116, 32,101,108,102, 54, 52, 45,120, 56, 54, 45, 54, 52,
-/* 0x1810 */  10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32,
-/* 0x1820 */  78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,
-/* 0x1830 */ 122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1840 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32,
-/* 0x1850 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101,
-/* 0x1860 */  32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,
-/* 0x1870 */ 115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32,
-/* 0x1880 */  32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,
-/* 0x1890 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x18a0 */  83, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32,
-/* 0x18b0 */  32, 32, 32, 32, 48, 54, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x18c0 */  52,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x18d0 */  84, 83, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32,
-/* 0x18e0 */  32, 32, 32, 32, 32, 48, 98, 97, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x18f0 */  48, 98, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1900 */  78, 84, 83, 10, 32, 32, 51, 32, 78, 82, 86, 50, 68, 32, 32, 32,
-/* 0x1910 */  32, 32, 32, 32, 32, 32, 48, 97, 49, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1920 */  32, 48, 49, 54,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1930 */  84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32,
-/* 0x1940 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 57, 51, 32, 32, 48, 32, 32,
-/* 0x1950 */  48, 32, 32, 48, 50, 49, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1960 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 76, 90, 77, 65,
-/* 0x1970 */  95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 54, 52, 32, 32, 48,
-/* 0x1980 */  32, 32, 48, 32, 32, 48, 50, 97, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1990 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 76, 90,
-/* 0x19a0 */  77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 57,102, 55,
-/* 0x19b0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 48, 55, 32, 32, 50, 42,
-/* 0x19c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55,
-/* 0x19d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48,
-/* 0x19e0 */  57,102, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 99,102,101, 32,
-/* 0x19f0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1a00 */  32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32,
-/* 0x1a10 */  32, 32, 48, 49, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 54,
-/* 0x1a20 */ 102, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1a30 */  84, 83, 10, 32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32,
-/* 0x1a40 */  32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x1a50 */  55, 48,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1a60 */  78, 84, 83, 10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x1a70 */  32, 32, 32, 32, 32, 32, 48, 51, 97, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1a80 */  32, 48, 49, 55, 48,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1a90 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65,
-/* 0x1aa0 */  73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 98, 49, 32, 32, 48, 32,
-/* 0x1ab0 */  32, 48, 32, 32, 48, 49, 55, 52, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1ac0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76,
-/* 0x1ad0 */  32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ae0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1af0 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86, 95,
-/* 0x1b00 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b10 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1b20 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1b30 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x1b50 */  76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1b60 */  78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b70 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x1b80 */  65, 73, 78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x1b90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1bb0 */  88, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1bd0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82,
-/* 0x1be0 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1c00 */  50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1c10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1c20 */  32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50,
-/* 0x1c30 */  66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c40 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1c50 */  69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1c60 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c70 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x1c80 */  95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1c90 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x1cb0 */  65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1cc0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1ce0 */  86, 95, 84, 65, 73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x1cf0 */  76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d00 */  48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65,
-/* 0x1d10 */  73, 78, 88, 32, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x1d30 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 79, 95,
-/* 0x1d40 */  66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1d50 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x1d60 */  76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1d70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1d80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1d90 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x1db0 */  50, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,
-/* 0x1dc0 */ 120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57,
-/* 0x1dd0 */  52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x1de0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69,
-/* 0x1df0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e00 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e10 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x1e20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 97,102, 32, 82, 95, 88,
-/* 0x1e30 */  56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78,
-/* 0x1e40 */  82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48,
-/* 0x1e60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 88, 56,
-/* 0x1e70 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76,
-/* 0x1e80 */  70, 77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,102,102,102,
-/* 0x1e90 */ 102,102,102,102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67,
-/* 0x1ea0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1eb0 */  82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x1ec0 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x1ed0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x1ee0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ef0 */  48, 48, 57, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67,
-/* 0x1f00 */  51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43,
-/* 0x1f10 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f20 */  50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f30 */  48, 53, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x1f40 */  50, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 43, 48,
-/* 0x1f50 */ 120,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x1f60 */  99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x1f70 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66,
-/* 0x1f80 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f90 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1fa0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 56, 98, 32, 82, 95, 88,
-/* 0x1fc0 */  56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78,
-/* 0x1fd0 */  82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 51, 32, 82, 95, 88, 56,
-/* 0x2000 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76,
-/* 0x2010 */  70, 77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,102,102,102,
-/* 0x2020 */ 102,102,102,102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2030 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2040 */  82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10,
-/* 0x2050 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2060 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2070 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2080 */  48, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 88, 56, 54, 95,
-/* 0x2090 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x20a0 */  95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20b0 */  48, 48, 48, 48, 48, 48, 48, 49, 50, 10, 10, 82, 69, 76, 79, 67,
-/* 0x20c0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x20d0 */  82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70,
-/* 0x20e0 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x20f0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2100 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2110 */  48, 48, 48, 48, 48, 49, 56, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x2120 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x2130 */  78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2140 */  48, 48, 48, 48, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2150 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x2160 */  76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x2170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2180 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2190 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21a0 */  48, 97,100, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32,
-/* 0x21b0 */  32, 32, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x17f0 */ 101,120,101,  0,  0,  0,  0,  0, 12,  0,  0,  0, 14,  0,  0,  0,
+/* 0x1800 */  10,  0,  0,  0,148,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,
+/* 0x1810 */  15,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 79,  0,  0,  0,
+/* 0x1820 */ 102,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,181,  0,  0,  0,
+/* 0x1830 */ 186,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,111,  1,  0,  0,
+/* 0x1840 */ 161,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 16,  2,  0,  0,
+/* 0x1850 */ 147,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,163,  2,  0,  0,
+/* 0x1860 */ 100,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  7,  3,  0,  0,
+/* 0x1870 */ 247,  9,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,254, 12,  0,  0,
+/* 0x1880 */ 247,  9,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,245, 22,  0,  0,
+/* 0x1890 */  24,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0, 13, 23,  0,  0,
+/* 0x18a0 */   0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 13, 23,  0,  0,
+/* 0x18b0 */  58,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 71, 23,  0,  0,
+/* 0x18c0 */ 177,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x18d0 */   0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18e0 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x18f0 */  11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1900 */   0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */  24,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x1920 */   4,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1930 */   0,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */  58,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,
+/* 0x1950 */   9,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1960 */   0,  0,  0,  0,114,  0,  0,  0, 13,  0,  0,  0,173,222,173,222,
+/* 0x1970 */   0,  0,  0,  0,  3,  0,  0,  0,122,  0,  0,  0, 98,  0,  0,  0,
+/* 0x1980 */ 148,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,175,  0,  0,  0,
+/* 0x1990 */ 122,  0,  0,  0,  9,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   2,  0,  0,  0, 92,  0,  0,  0,122,  0,  0,  0, 89,  0,  0,  0,
+/* 0x19b0 */ 252,255,255,255,255,255,255,255,  3,  0,  0,  0,150,  0,  0,  0,
+/* 0x19c0 */ 122,  0,  0,  0,  9,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   3,  0,  0,  0, 92,  0,  0,  0,122,  0,  0,  0, 89,  0,  0,  0,
+/* 0x19e0 */ 252,255,255,255,255,255,255,255,  4,  0,  0,  0,139,  0,  0,  0,
+/* 0x19f0 */ 122,  0,  0,  0,  9,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   4,  0,  0,  0, 83,  0,  0,  0,122,  0,  0,  0, 89,  0,  0,  0,
+/* 0x1a10 */ 252,255,255,255,255,255,255,255,  5,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1a20 */ 122,  0,  0,  0, 69,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */  10,  0,  0,  0, 24,  0,  0,  0,122,  0,  0,  0, 98,  0,  0,  0,
+/* 0x1a40 */   3,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,173,  0,  0,  0,
+/* 0x1a50 */ 136,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */  69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65,
+/* 0x1a70 */  68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82,
+/* 0x1a80 */  86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76,
+/* 0x1a90 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x1aa0 */  69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0,
+/* 0x1ab0 */  78, 82, 86, 95, 84, 65, 73, 76,  0, 69, 76, 70, 77, 65, 73, 78,
+/* 0x1ac0 */  89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,
+/* 0x1ad0 */ 116,  0, 79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 88, 56, 54, 95,
+/* 0x1ae0 */  54, 52, 95, 80, 67, 51, 50,  0, 82, 95, 88, 56, 54, 95, 54, 52,
+/* 0x1af0 */  95, 51, 50,  0,248, 23,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
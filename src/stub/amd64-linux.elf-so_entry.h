@@ -1,5 +1,5 @@
 /* amd64-linux.elf-so_entry.h
-   created from amd64-linux.elf-so_entry.bin, 970 (0x3ca) bytes
+   created from amd64-linux.elf-so_entry.bin, 506 (0x1fa) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_LINUX_ELF_SO_ENTRY_SIZE    970
-#define STUB_AMD64_LINUX_ELF_SO_ENTRY_ADLER32 0x06cc0686
-#define STUB_AMD64_LINUX_ELF_SO_ENTRY_CRC32   0xe28ae3dc
+#define STUB_AMD64_LINUX_ELF_SO_ENTRY_SIZE    506
+#define STUB_AMD64_LINUX_ELF_SO_ENTRY_ADLER32 0x7dba89b7
+#define STUB_AMD64_LINUX_ELF_SO_ENTRY_CRC32   0xd896a34d
 
-unsigned char stub_amd64_linux_elf_so_entry[970] = {
+unsigned char stub_amd64_linux_elf_so_entry[506] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,128,  1,  0,  0,  0,  0,  0,  0,
@@ -56,45 +56,16 @@ unsigned char stub_amd64_linux_elf_so_entry[970] = {
 /* 0x0110 */   5, 90, 41,255,106,  9,232, 15,  0,  0,  0, 80, 65, 80, 95,106,
 /* 0x0120 */   3,232,  4,  0,  0,  0, 88, 80,255,224, 72,139, 68, 36,  8, 15,
 /* 0x0130 */   5, 72, 61,  0,240,255,255,114,  1,204,194,  8,  0, 90,232,  0,
-/* 0x0140 */   0,  0,  0,102,105,108,101, 32,102,111,114,109, 97,116, 32,101,
-/* 0x0150 */ 108,102, 54, 52, 45,120, 56, 54, 45, 54, 52, 10, 10, 83,101, 99,
-/* 0x0160 */ 116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32,
-/* 0x0170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32,
-/* 0x0180 */  32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0190 */  32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x01a0 */  32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32,
-/* 0x01b0 */  32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48,
-/* 0x01c0 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48,
-/* 0x01d0 */ 102,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50,
-/* 0x01e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x01f0 */  49, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32,
-/* 0x0200 */  48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51,100, 32, 32,
-/* 0x0210 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83,
-/* 0x0220 */  89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48,
-/* 0x0230 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x0240 */  32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48,
-/* 0x0250 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48,
-/* 0x0260 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x0270 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 95,115,
-/* 0x0280 */ 116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0290 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x02a0 */  70, 77, 65, 73, 78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x02b0 */  90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x02c0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65,
-/* 0x02d0 */  73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x02e0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x02f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x0300 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 97, 32,
-/* 0x0310 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x0320 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,120,102,102,102,
-/* 0x0330 */ 102,102,102,102,102,102,102,102,102,102,102,102, 99, 10, 10, 82,
-/* 0x0340 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x0350 */  83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93,
-/* 0x0360 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0370 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0380 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x0390 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 88, 56,
-/* 0x03a0 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76,
-/* 0x03b0 */  70, 77, 65, 73, 78, 88, 43, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x03c0 */  48, 48, 48, 48, 48, 48, 48, 49, 57, 10
+/* 0x0140 */   0,  0,  0,  2,  0,  0,  0,  3,  0,  0,  0,  2,  0,  0,  0, 39,
+/* 0x0150 */   0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,253,  0,  0,  0,  0,
+/* 0x0160 */   0,  0,  0,  9,  0,  0,  0, 61,  1,  0,  0,  6,  0,  0,  0,  0,
+/* 0x0170 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,
+/* 0x0180 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,
+/* 0x0190 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 25,
+/* 0x01a0 */   0,  0,  0,  9,  0,  0,  0,252,255,255,255,255,255,255,255,  1,
+/* 0x01b0 */   0,  0,  0,  2,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0, 25,
+/* 0x01c0 */   0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0,
+/* 0x01d0 */  69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0,
+/* 0x01e0 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,  0, 67,  1,
+/* 0x01f0 */   0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
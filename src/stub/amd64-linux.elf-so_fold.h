@@ -1,5 +1,5 @@
 /* amd64-linux.elf-so_fold.h
-   created from amd64-linux.elf-so_fold.bin, 17197 (0x432d) bytes
+   created from amd64-linux.elf-so_fold.bin, 13846 (0x3616) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_LINUX_ELF_SO_FOLD_SIZE    17197
-#define STUB_AMD64_LINUX_ELF_SO_FOLD_ADLER32 0xffc4d39e
-#define STUB_AMD64_LINUX_ELF_SO_FOLD_CRC32   0xed02b4a9
+#define STUB_AMD64_LINUX_ELF_SO_FOLD_SIZE    13846
+#define STUB_AMD64_LINUX_ELF_SO_FOLD_ADLER32 0xe0488d63
+#define STUB_AMD64_LINUX_ELF_SO_FOLD_CRC32   0x1de581f7
 
-unsigned char stub_amd64_linux_elf_so_fold[17197] = {
+unsigned char stub_amd64_linux_elf_so_fold[13846] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,  8, 33,  0,  0,  0,  0,  0,  0,
@@ -780,335 +780,126 @@ unsigned char stub_amd64_linux_elf_so_fold[17197] = {
 /* 0x2e50 */  19,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 32,  0,  0,  0,
 /* 0x2e60 */ 252,255,255,255,255,255,255,255,  6,  0,  0,  0,  0,  0,  0,  0,
 /* 0x2e70 */   2,  0,  0,  0,  2,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
-/* 0x2e80 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 54,
-/* 0x2e90 */  52, 45,120, 56, 54, 45, 54, 52, 10, 10, 83,101, 99,116,105,111,
-/* 0x2ea0 */ 110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32,
-/* 0x2eb0 */  32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32,
-/* 0x2ec0 */  86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ed0 */  32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ee0 */  32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,
-/* 0x2ef0 */ 103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 83, 79,
-/* 0x2f00 */  95, 77, 65, 73, 78, 32, 32, 32, 32, 32, 32, 32, 48, 55, 57, 49,
-/* 0x2f10 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42,
-/* 0x2f20 */  52, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32,
-/* 0x2f30 */  69, 88, 80, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48,101,
-/* 0x2f40 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 55,100, 49, 32, 32, 50,
-/* 0x2f50 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x2f60 */  50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2f70 */  48,101, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 98, 49, 32,
-/* 0x2f80 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2f90 */  32, 32, 51, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2fa0 */  32, 32, 48,100, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 57,
-/* 0x2fb0 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2fc0 */  83, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32,
-/* 0x2fd0 */  32, 32, 32, 32, 48, 99, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2fe0 */  97, 54,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2ff0 */  78, 84, 83, 10, 32, 32, 53, 32, 83, 79, 95, 72, 69, 65, 68, 32,
-/* 0x3000 */  32, 32, 32, 32, 32, 32, 48, 50, 99, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3010 */  32, 48, 98, 50,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3020 */  84, 69, 78, 84, 83, 10, 32, 32, 54, 32,112,116,114, 95, 78, 69,
-/* 0x3030 */  88, 84, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3040 */  32, 48, 98, 53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3050 */  84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 83, 79, 95, 84, 65, 73,
-/* 0x3060 */  76, 32, 32, 32, 32, 32, 32, 32, 48, 56, 99, 32, 32, 48, 32, 32,
-/* 0x3070 */  48, 32, 32, 48, 98, 53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3080 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 76, 90, 77, 65,
-/* 0x3090 */  95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 54, 52, 32, 32, 48,
-/* 0x30a0 */  32, 32, 48, 32, 32, 48, 98,101, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x30b0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 76, 90,
-/* 0x30c0 */  77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 57,102, 55,
-/* 0x30d0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 99, 52, 97, 32, 32, 50, 42,
-/* 0x30e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48,
-/* 0x30f0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48,
-/* 0x3100 */  57,102, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 54, 52, 49,
-/* 0x3110 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3120 */  10, 32, 49, 49, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32,
-/* 0x3130 */  32, 32, 32, 48, 49, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x3140 */  48, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3150 */  78, 84, 83, 10, 32, 49, 50, 32, 69, 88, 80, 95, 84, 65, 73, 76,
-/* 0x3160 */  32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3170 */  48, 50, 48, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3180 */  84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66,
-/* 0x3190 */  76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31a0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 80,
-/* 0x31b0 */  95, 72, 69, 65, 68, 32, 48, 32, 69, 88, 80, 95, 72, 69, 65, 68,
-/* 0x31c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x31e0 */  69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x31f0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3200 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 80, 95, 84,
-/* 0x3210 */  65, 73, 76, 32, 48, 32, 69, 88, 80, 95, 84, 65, 73, 76, 10, 48,
-/* 0x3220 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3230 */ 108, 32, 32, 32, 32,100, 32, 32, 83, 79, 95, 77, 65, 73, 78, 32,
-/* 0x3240 */  48, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3250 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3260 */ 100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69,
-/* 0x3270 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3280 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32,
-/* 0x3290 */  48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x32b0 */  32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x32c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x32d0 */ 108, 32, 32, 32, 32,100, 32, 32, 83, 79, 95, 72, 69, 65, 68, 32,
-/* 0x32e0 */  48, 32, 83, 79, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x32f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3300 */ 100, 32, 32,112,116,114, 95, 78, 69, 88, 84, 32, 48, 32,112,116,
-/* 0x3310 */ 114, 95, 78, 69, 88, 84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3320 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3330 */  83, 79, 95, 84, 65, 73, 76, 32, 48, 32, 83, 79, 95, 84, 65, 73,
-/* 0x3340 */  76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3350 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3360 */  69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x3370 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3380 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x3390 */  95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x33a0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33b0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x33c0 */  65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x33d0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33e0 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 88,
-/* 0x33f0 */  80, 95, 72, 69, 65, 68, 32, 48, 32,102, 95,101,120,112, 97,110,
-/* 0x3400 */ 100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3410 */  55, 53, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65,
-/* 0x3420 */  73, 76, 32, 48, 32,109,117,110,109, 97,112, 10, 48, 48, 48, 48,
-/* 0x3430 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 99, 32,103, 32, 32,
-/* 0x3440 */  32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,
-/* 0x3450 */ 101,109, 99,112,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3460 */  48, 48, 48, 48, 51, 49, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3470 */  79, 95, 84, 65, 73, 76, 32, 48, 32, 79, 95, 66, 73, 78, 70, 79,
-/* 0x3480 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x3490 */  55, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x34a0 */  76, 32, 48, 32,102,116,114,117,110, 99, 97,116,101, 10, 48, 48,
-/* 0x34b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 49, 32,103,
-/* 0x34c0 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48,
-/* 0x34d0 */  32,109,109, 97,112, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34e0 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 83,
-/* 0x34f0 */  79, 95, 84, 65, 73, 76, 32, 48, 32,101,111,102, 10, 48, 48, 48,
-/* 0x3500 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54,100, 32,103, 32,
-/* 0x3510 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3520 */ 119,114,105,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3530 */  48, 48, 48, 51, 56, 97, 32,103, 32, 32, 32, 32, 32, 70, 32, 83,
-/* 0x3540 */  79, 95, 77, 65, 73, 78, 32, 48, 49,100, 32, 80, 70, 95,116,111,
-/* 0x3550 */  95, 80, 82, 79, 84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3560 */  48, 48, 48, 48, 53, 98, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3570 */  79, 95, 84, 65, 73, 76, 32, 48, 32,109,101,109,102,100, 95, 99,
-/* 0x3580 */ 114,101, 97,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3590 */  48, 48, 48, 48, 55, 49, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x35a0 */  79, 95, 84, 65, 73, 76, 32, 48, 32,114,101, 97,100, 10, 48, 48,
-/* 0x35b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 51, 32,103,
-/* 0x35c0 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48,
-/* 0x35d0 */  32,109,101,109,115,101,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x35e0 */  48, 48, 48, 48, 48, 48, 49, 49, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x35f0 */  32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,121, 95, 98,107,
-/* 0x3600 */ 112,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3610 */  48, 55, 57, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84,
-/* 0x3620 */  65, 73, 76, 32, 48, 32, 80,112,114,111,116,101, 99,116, 10, 48,
-/* 0x3630 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 51, 32,
-/* 0x3640 */ 103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32,
-/* 0x3650 */  48, 32,101,120,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3660 */  48, 48, 48, 48, 48, 54, 54, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3670 */  83, 79, 95, 84, 65, 73, 76, 32, 48, 32,111,112,101,110, 97,116,
-/* 0x3680 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55,
-/* 0x3690 */  57, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x36a0 */  76, 32, 48, 32,109,112,114,111,116,101, 99,116, 10, 48, 48, 48,
-/* 0x36b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54, 50, 32,103, 32,
-/* 0x36c0 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x36d0 */  99,108,111,115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36e0 */  48, 48, 48, 51, 97, 55, 32,103, 32, 32, 32, 32, 32, 70, 32, 83,
-/* 0x36f0 */  79, 95, 77, 65, 73, 78, 32, 48, 51,101, 97, 32,117,112,120, 95,
-/* 0x3700 */ 115,111, 95,109, 97,105,110, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x3710 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x3720 */  91, 83, 79, 95, 77, 65, 73, 78, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x3730 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3740 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3750 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3760 */  48, 48, 48,100, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76,
-/* 0x3770 */  84, 51, 50, 32, 32, 32, 32,109,121, 95, 98,107,112,116, 43, 48,
-/* 0x3780 */ 120,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x3790 */  99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37a0 */  49, 55, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51,
-/* 0x37b0 */  50, 32, 32, 32, 32,101,120,105,116, 43, 48,120,102,102,102,102,
-/* 0x37c0 */ 102,102,102,102,102,102,102,102,102,102,102, 99, 10, 48, 48, 48,
-/* 0x37d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50,101, 32, 82, 95,
-/* 0x37e0 */  88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,
-/* 0x37f0 */ 101,120,105,116, 43, 48,120,102,102,102,102,102,102,102,102,102,
-/* 0x3800 */ 102,102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3810 */  48, 48, 48, 48, 48, 49, 48,101, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x3820 */  52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,102, 95,101,120,112,
-/* 0x3830 */  97,110,100, 43, 48,120,102,102,102,102,102,102,102,102,102,102,
-/* 0x3840 */ 102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3850 */  48, 48, 48, 48, 49,101, 57, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x3860 */  95, 80, 76, 84, 51, 50, 32, 32, 32, 32,109,101,109,102,100, 95,
-/* 0x3870 */  99,114,101, 97,116,101, 43, 48,120,102,102,102,102,102,102,102,
-/* 0x3880 */ 102,102,102,102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3890 */  48, 48, 48, 48, 48, 48, 48, 50, 48, 52, 32, 82, 95, 88, 56, 54,
-/* 0x38a0 */  95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,119,114,105,
-/* 0x38b0 */ 116,101, 43, 48,120,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x38c0 */ 102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38d0 */  48, 48, 48, 50, 50, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x38e0 */  80, 76, 84, 51, 50, 32, 32, 32, 32,109,109, 97,112, 43, 48,120,
-/* 0x38f0 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99,
-/* 0x3900 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 51,
-/* 0x3910 */  48, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50,
-/* 0x3920 */  32, 32, 32, 32, 99,108,111,115,101, 43, 48,120,102,102,102,102,
-/* 0x3930 */ 102,102,102,102,102,102,102,102,102,102,102, 99, 10, 48, 48, 48,
-/* 0x3940 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 56, 97, 32, 82, 95,
-/* 0x3950 */  88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,
-/* 0x3960 */ 111,112,101,110, 97,116, 43, 48,120,102,102,102,102,102,102,102,
-/* 0x3970 */ 102,102,102,102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3980 */  48, 48, 48, 48, 48, 48, 48, 50, 97, 53, 32, 82, 95, 88, 56, 54,
-/* 0x3990 */  95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,114,101, 97,
-/* 0x39a0 */ 100, 43, 48,120,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x39b0 */ 102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39c0 */  48, 48, 50, 98, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80,
-/* 0x39d0 */  76, 84, 51, 50, 32, 32, 32, 32, 99,108,111,115,101, 43, 48,120,
-/* 0x39e0 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99,
-/* 0x39f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 50,
-/* 0x3a00 */ 102, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50,
-/* 0x3a10 */  32, 32, 32, 32,109,101,109, 99,112,121, 43, 48,120,102,102,102,
-/* 0x3a20 */ 102,102,102,102,102,102,102,102,102,102,102,102, 99, 10, 48, 48,
-/* 0x3a30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 53, 48, 32, 82,
-/* 0x3a40 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32,
-/* 0x3a50 */  32,109,109, 97,112, 43, 48,120,102,102,102,102,102,102,102,102,
-/* 0x3a60 */ 102,102,102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a70 */  48, 48, 48, 48, 48, 48, 51, 53,101, 32, 82, 95, 88, 56, 54, 95,
-/* 0x3a80 */  54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,109,101,109, 99,
-/* 0x3a90 */ 112,121, 43, 48,120,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x3aa0 */ 102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ab0 */  48, 48, 48, 52, 50, 52, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x3ac0 */  80, 76, 84, 51, 50, 32, 32, 32, 32,109,109, 97,112, 43, 48,120,
-/* 0x3ad0 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99,
-/* 0x3ae0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 51,
-/* 0x3af0 */  55, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50,
-/* 0x3b00 */  32, 32, 32, 32,109,101,109, 99,112,121, 43, 48,120,102,102,102,
-/* 0x3b10 */ 102,102,102,102,102,102,102,102,102,102,102,102, 99, 10, 48, 48,
-/* 0x3b20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,100, 57, 32, 82,
-/* 0x3b30 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32,
-/* 0x3b40 */  32,109,101,109,102,100, 95, 99,114,101, 97,116,101, 43, 48,120,
-/* 0x3b50 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99,
-/* 0x3b60 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,102,
-/* 0x3b70 */  50, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50,
-/* 0x3b80 */  32, 32, 32, 32,119,114,105,116,101, 43, 48,120,102,102,102,102,
-/* 0x3b90 */ 102,102,102,102,102,102,102,102,102,102,102, 99, 10, 48, 48, 48,
-/* 0x3ba0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 48, 54, 32, 82, 95,
-/* 0x3bb0 */  88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,
-/* 0x3bc0 */ 119,114,105,116,101, 43, 48,120,102,102,102,102,102,102,102,102,
-/* 0x3bd0 */ 102,102,102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3be0 */  48, 48, 48, 48, 48, 48, 53, 49, 53, 32, 82, 95, 88, 56, 54, 95,
-/* 0x3bf0 */  54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,109,117,110,109,
-/* 0x3c00 */  97,112, 43, 48,120,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x3c10 */ 102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c20 */  48, 48, 48, 53, 49,100, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x3c30 */  80, 76, 84, 51, 50, 32, 32, 32, 32, 80, 70, 95,116,111, 95, 80,
-/* 0x3c40 */  82, 79, 84, 43, 48,120,102,102,102,102,102,102,102,102,102,102,
-/* 0x3c50 */ 102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c60 */  48, 48, 48, 48, 53, 51, 56, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x3c70 */  95, 80, 76, 84, 51, 50, 32, 32, 32, 32,109,109, 97,112, 43, 48,
-/* 0x3c80 */ 120,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x3c90 */  99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53,
-/* 0x3ca0 */  51,102, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51,
-/* 0x3cb0 */  50, 32, 32, 32, 32, 99,108,111,115,101, 43, 48,120,102,102,102,
-/* 0x3cc0 */ 102,102,102,102,102,102,102,102,102,102,102,102, 99, 10, 48, 48,
-/* 0x3cd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54, 49, 98, 32, 82,
-/* 0x3ce0 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32,
-/* 0x3cf0 */  32,109,101,109,102,100, 95, 99,114,101, 97,116,101, 43, 48,120,
-/* 0x3d00 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99,
-/* 0x3d10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54, 50,
-/* 0x3d20 */  97, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50,
-/* 0x3d30 */  32, 32, 32, 32,102,116,114,117,110, 99, 97,116,101, 43, 48,120,
-/* 0x3d40 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99,
-/* 0x3d50 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54, 51,
-/* 0x3d60 */  97, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50,
-/* 0x3d70 */  32, 32, 32, 32,119,114,105,116,101, 43, 48,120,102,102,102,102,
-/* 0x3d80 */ 102,102,102,102,102,102,102,102,102,102,102, 99, 10, 48, 48, 48,
-/* 0x3d90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54, 53, 99, 32, 82, 95,
-/* 0x3da0 */  88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,
-/* 0x3db0 */ 109,109, 97,112, 43, 48,120,102,102,102,102,102,102,102,102,102,
-/* 0x3dc0 */ 102,102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3dd0 */  48, 48, 48, 48, 48, 54, 54,101, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x3de0 */  52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,109,117,110,109, 97,
-/* 0x3df0 */ 112, 43, 48,120,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x3e00 */ 102,102,102, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e10 */  48, 48, 54,102, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80,
-/* 0x3e20 */  76, 84, 51, 50, 32, 32, 32, 32,109,117,110,109, 97,112, 43, 48,
-/* 0x3e30 */ 120,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x3e40 */  99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54,
-/* 0x3e50 */ 102, 98, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51,
-/* 0x3e60 */  50, 32, 32, 32, 32, 80, 70, 95,116,111, 95, 80, 82, 79, 84, 43,
-/* 0x3e70 */  48,120,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
-/* 0x3e80 */ 102, 99, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e90 */  55, 50, 49, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84,
-/* 0x3ea0 */  51, 50, 32, 32, 32, 32,109,109, 97,112, 43, 48,120,102,102,102,
-/* 0x3eb0 */ 102,102,102,102,102,102,102,102,102,102,102,102, 99, 10, 48, 48,
-/* 0x3ec0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55, 50, 57, 32, 82,
-/* 0x3ed0 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32,
-/* 0x3ee0 */  32, 99,108,111,115,101, 43, 48,120,102,102,102,102,102,102,102,
-/* 0x3ef0 */ 102,102,102,102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3f00 */  48, 48, 48, 48, 48, 48, 48, 55, 51, 51, 32, 82, 95, 88, 56, 54,
-/* 0x3f10 */  95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32, 80, 70, 95,
-/* 0x3f20 */ 116,111, 95, 80, 82, 79, 84, 43, 48,120,102,102,102,102,102,102,
-/* 0x3f30 */ 102,102,102,102,102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48,
-/* 0x3f40 */  48, 48, 48, 48, 48, 48, 48, 48, 55, 52, 57, 32, 82, 95, 88, 56,
-/* 0x3f50 */  54, 95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32, 80,112,
-/* 0x3f60 */ 114,111,116,101, 99,116, 43, 48,120,102,102,102,102,102,102,102,
-/* 0x3f70 */ 102,102,102,102,102,102,102,102, 99, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3f80 */  48, 48, 48, 48, 48, 48, 48, 55, 54, 52, 32, 82, 95, 88, 56, 54,
-/* 0x3f90 */  95, 54, 52, 95, 80, 76, 84, 51, 50, 32, 32, 32, 32,109,117,110,
-/* 0x3fa0 */ 109, 97,112, 43, 48,120,102,102,102,102,102,102,102,102,102,102,
-/* 0x3fb0 */ 102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x3fc0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x3fd0 */  78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3fe0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x3ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4000 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,100,
-/* 0x4010 */  97, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32,
-/* 0x4020 */  32, 32, 32, 32, 69, 88, 80, 95, 72, 69, 65, 68, 43, 48,120, 48,
-/* 0x4030 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57,102, 10,
-/* 0x4040 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55, 49,
-/* 0x4050 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32,
-/* 0x4060 */  32, 32, 32, 69, 88, 80, 95, 84, 65, 73, 76, 43, 48,120,102,102,
-/* 0x4070 */ 102,102,102,102,102,102,102,102,102,102,102,102,102, 99, 10, 10,
-/* 0x4080 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4090 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10,
-/* 0x40a0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x40b0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x40c0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40d0 */  48, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 88, 56, 54, 95,
-/* 0x40e0 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 88, 80, 95,
-/* 0x40f0 */  72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4100 */  48, 48, 48, 48, 48, 57,102, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4110 */  48, 48, 48, 48, 48, 48, 55, 49, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x4120 */  52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 88, 80, 95, 84,
-/* 0x4130 */  65, 73, 76, 43, 48,120,102,102,102,102,102,102,102,102,102,102,
-/* 0x4140 */ 102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4150 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4160 */  78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4180 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4190 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 98,
-/* 0x41a0 */  54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32,
-/* 0x41b0 */  32, 32, 32, 32, 69, 88, 80, 95, 72, 69, 65, 68, 43, 48,120, 48,
-/* 0x41c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57,102, 10,
-/* 0x41d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53,100,
-/* 0x41e0 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32,
-/* 0x41f0 */  32, 32, 32, 69, 88, 80, 95, 84, 65, 73, 76, 43, 48,120,102,102,
-/* 0x4200 */ 102,102,102,102,102,102,102,102,102,102,102,102,102, 99, 10, 10,
-/* 0x4210 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4220 */  68, 83, 32, 70, 79, 82, 32, 91, 83, 79, 95, 72, 69, 65, 68, 93,
-/* 0x4230 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4240 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4250 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4260 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 51, 32, 82, 95, 88, 56,
-/* 0x4270 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,117,112,
-/* 0x4280 */ 120, 95,115,111, 95,109, 97,105,110, 43, 48,120,102,102,102,102,
-/* 0x4290 */ 102,102,102,102,102,102,102,102,102,102,102, 99, 10, 10, 82, 69,
-/* 0x42a0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x42b0 */  32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x42c0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x42d0 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x42e0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x42f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 88,
-/* 0x4300 */  56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 76,
-/* 0x4310 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48,
-/* 0x4320 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 50, 10
+/* 0x2e80 */  13,  0,  0,  0, 32,  0,  0,  0, 43,  0,  0,  0, 34,  1,  0,  0,
+/* 0x2e90 */   0,  0,  0,  0, 64,  0,  0,  0,145,  7,  0,  0,  4,  0,  0,  0,
+/* 0x2ea0 */   8,  0,  0,  0,209,  7,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2eb0 */  17,  0,  0,  0,177,  8,  0,  0,229,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ec0 */  23,  0,  0,  0,150,  9,  0,  0,215,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ed0 */  29,  0,  0,  0,109, 10,  0,  0,193,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ee0 */  35,  0,  0,  0, 46, 11,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ef0 */  43,  0,  0,  0, 90, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f00 */  52,  0,  0,  0, 90, 11,  0,  0,140,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */  60,  0,  0,  0,230, 11,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f20 */  71,  0,  0,  0, 74, 12,  0,  0,247,  9,  0,  0,  0,  0,  0,  0,
+/* 0x2f30 */  82,  0,  0,  0, 65, 22,  0,  0,247,  9,  0,  0,  0,  0,  0,  0,
+/* 0x2f40 */  93,  0,  0,  0, 56, 32,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f50 */ 104,  0,  0,  0, 80, 32,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f60 */   8,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 93,  0,  0,  0,
+/* 0x2f70 */  11,  0,  0,  0,  0,  0,  0,  0,104,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2f80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f90 */  17,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,
+/* 0x2fa0 */   3,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2fb0 */   0,  0,  0,  0, 35,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fc0 */  43,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x2fd0 */   7,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2fe0 */   0,  0,  0,  0, 71,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ff0 */  82,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,113,  0,  0,  0,
+/* 0x3000 */   1,  0,  0,  0,  0,  0,  0,  0,122,  0,  0,  0,  7,  0,  0,  0,
+/* 0x3010 */ 117,  0,  0,  0,129,  0,  0,  0,  7,  0,  0,  0, 28,  0,  0,  0,
+/* 0x3020 */ 136,  0,  0,  0,  7,  0,  0,  0, 49,  0,  0,  0,144,  0,  0,  0,
+/* 0x3030 */   7,  0,  0,  0, 87,  0,  0,  0,154,  0,  0,  0,  7,  0,  0,  0,
+/* 0x3040 */  49,  0,  0,  0,159,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3050 */ 163,  0,  0,  0,  7,  0,  0,  0,109,  0,  0,  0,169,  0,  0,  0,
+/* 0x3060 */   0,  0,  0,  0,138,  3,  0,  0,180,  0,  0,  0,  7,  0,  0,  0,
+/* 0x3070 */  91,  0,  0,  0,193,  0,  0,  0,  7,  0,  0,  0,113,  0,  0,  0,
+/* 0x3080 */ 198,  0,  0,  0,  7,  0,  0,  0, 19,  0,  0,  0,205,  0,  0,  0,
+/* 0x3090 */   7,  0,  0,  0, 17,  0,  0,  0,213,  0,  0,  0,  7,  0,  0,  0,
+/* 0x30a0 */ 121,  0,  0,  0,222,  0,  0,  0,  7,  0,  0,  0, 83,  0,  0,  0,
+/* 0x30b0 */ 227,  0,  0,  0,  7,  0,  0,  0,102,  0,  0,  0,234,  0,  0,  0,
+/* 0x30c0 */   7,  0,  0,  0,121,  0,  0,  0,243,  0,  0,  0,  7,  0,  0,  0,
+/* 0x30d0 */  98,  0,  0,  0,249,  0,  0,  0,  0,  0,  0,  0,167,  3,  0,  0,
+/* 0x30e0 */   0,  0,  0,  0, 13,  0,  0,  0,  5,  1,  0,  0,205,  0,  0,  0,
+/* 0x30f0 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 23,  0,  0,  0,
+/* 0x3100 */   5,  1,  0,  0,222,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3110 */   0,  0,  0,  0, 46,  0,  0,  0,  5,  1,  0,  0,222,  0,  0,  0,
+/* 0x3120 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 14,  1,  0,  0,
+/* 0x3130 */   5,  1,  0,  0,113,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3140 */   0,  0,  0,  0,233,  1,  0,  0,  5,  1,  0,  0,180,  0,  0,  0,
+/* 0x3150 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0,  4,  2,  0,  0,
+/* 0x3160 */   5,  1,  0,  0,163,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3170 */   0,  0,  0,  0, 38,  2,  0,  0,  5,  1,  0,  0,154,  0,  0,  0,
+/* 0x3180 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 48,  2,  0,  0,
+/* 0x3190 */   5,  1,  0,  0,243,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x31a0 */   0,  0,  0,  0,138,  2,  0,  0,  5,  1,  0,  0,227,  0,  0,  0,
+/* 0x31b0 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0,165,  2,  0,  0,
+/* 0x31c0 */   5,  1,  0,  0,193,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x31d0 */   0,  0,  0,  0,179,  2,  0,  0,  5,  1,  0,  0,243,  0,  0,  0,
+/* 0x31e0 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 47,  3,  0,  0,
+/* 0x31f0 */   5,  1,  0,  0,129,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3200 */   0,  0,  0,  0, 80,  3,  0,  0,  5,  1,  0,  0,154,  0,  0,  0,
+/* 0x3210 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 94,  3,  0,  0,
+/* 0x3220 */   5,  1,  0,  0,129,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3230 */   0,  0,  0,  0, 36,  4,  0,  0,  5,  1,  0,  0,154,  0,  0,  0,
+/* 0x3240 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 55,  4,  0,  0,
+/* 0x3250 */   5,  1,  0,  0,129,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3260 */   0,  0,  0,  0,217,  4,  0,  0,  5,  1,  0,  0,180,  0,  0,  0,
+/* 0x3270 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0,242,  4,  0,  0,
+/* 0x3280 */   5,  1,  0,  0,163,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3290 */   0,  0,  0,  0,  6,  5,  0,  0,  5,  1,  0,  0,163,  0,  0,  0,
+/* 0x32a0 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 21,  5,  0,  0,
+/* 0x32b0 */   5,  1,  0,  0,122,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x32c0 */   0,  0,  0,  0, 29,  5,  0,  0,  5,  1,  0,  0,169,  0,  0,  0,
+/* 0x32d0 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 56,  5,  0,  0,
+/* 0x32e0 */   5,  1,  0,  0,154,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x32f0 */   0,  0,  0,  0, 63,  5,  0,  0,  5,  1,  0,  0,243,  0,  0,  0,
+/* 0x3300 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 27,  6,  0,  0,
+/* 0x3310 */   5,  1,  0,  0,180,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3320 */   0,  0,  0,  0, 42,  6,  0,  0,  5,  1,  0,  0,144,  0,  0,  0,
+/* 0x3330 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 58,  6,  0,  0,
+/* 0x3340 */   5,  1,  0,  0,163,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3350 */   0,  0,  0,  0, 92,  6,  0,  0,  5,  1,  0,  0,154,  0,  0,  0,
+/* 0x3360 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0,110,  6,  0,  0,
+/* 0x3370 */   5,  1,  0,  0,122,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3380 */   0,  0,  0,  0,243,  6,  0,  0,  5,  1,  0,  0,122,  0,  0,  0,
+/* 0x3390 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0,251,  6,  0,  0,
+/* 0x33a0 */   5,  1,  0,  0,169,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x33b0 */   0,  0,  0,  0, 33,  7,  0,  0,  5,  1,  0,  0,154,  0,  0,  0,
+/* 0x33c0 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 41,  7,  0,  0,
+/* 0x33d0 */   5,  1,  0,  0,243,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x33e0 */   0,  0,  0,  0, 51,  7,  0,  0,  5,  1,  0,  0,169,  0,  0,  0,
+/* 0x33f0 */ 252,255,255,255,255,255,255,255,  0,  0,  0,  0, 73,  7,  0,  0,
+/* 0x3400 */   5,  1,  0,  0,213,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x3410 */   0,  0,  0,  0,100,  7,  0,  0,  5,  1,  0,  0,122,  0,  0,  0,
+/* 0x3420 */ 252,255,255,255,255,255,255,255,  2,  0,  0,  0,218,  0,  0,  0,
+/* 0x3430 */  20,  1,  0,  0,  8,  0,  0,  0,159,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3440 */   2,  0,  0,  0,113,  0,  0,  0, 20,  1,  0,  0,104,  0,  0,  0,
+/* 0x3450 */ 252,255,255,255,255,255,255,255,  3,  0,  0,  0,204,  0,  0,  0,
+/* 0x3460 */  20,  1,  0,  0,  8,  0,  0,  0,159,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3470 */   3,  0,  0,  0,113,  0,  0,  0, 20,  1,  0,  0,104,  0,  0,  0,
+/* 0x3480 */ 252,255,255,255,255,255,255,255,  4,  0,  0,  0,182,  0,  0,  0,
+/* 0x3490 */  20,  1,  0,  0,  8,  0,  0,  0,159,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34a0 */   4,  0,  0,  0, 93,  0,  0,  0, 20,  1,  0,  0,104,  0,  0,  0,
+/* 0x34b0 */ 252,255,255,255,255,255,255,255,  5,  0,  0,  0, 19,  0,  0,  0,
+/* 0x34c0 */  20,  1,  0,  0,249,  0,  0,  0,252,255,255,255,255,255,255,255,
+/* 0x34d0 */   8,  0,  0,  0,  6,  0,  0,  0, 20,  1,  0,  0, 93,  0,  0,  0,
+/* 0x34e0 */  18,  0,  0,  0,  0,  0,  0,  0, 83, 79, 95, 77, 65, 73, 78,  0,
+/* 0x34f0 */  69, 88, 80, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,  0, 78,
+/* 0x3500 */  82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 83, 79, 95, 72, 69,
+/* 0x3510 */  65, 68,  0,112,116,114, 95, 78, 69, 88, 84,  0, 83, 79, 95, 84,
+/* 0x3520 */  65, 73, 76,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76,
+/* 0x3530 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x3540 */  69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0,
+/* 0x3550 */  69, 88, 80, 95, 84, 65, 73, 76,  0,102, 95,101,120,112, 97,110,
+/* 0x3560 */ 100,  0,109,117,110,109, 97,112,  0,109,101,109, 99,112,121,  0,
+/* 0x3570 */  79, 95, 66, 73, 78, 70, 79,  0,102,116,114,117,110, 99, 97,116,
+/* 0x3580 */ 101,  0,109,109, 97,112,  0,101,111,102,  0,119,114,105,116,101,
+/* 0x3590 */   0, 80, 70, 95,116,111, 95, 80, 82, 79, 84,  0,109,101,109,102,
+/* 0x35a0 */ 100, 95, 99,114,101, 97,116,101,  0,114,101, 97,100,  0,109,101,
+/* 0x35b0 */ 109,115,101,116,  0,109,121, 95, 98,107,112,116,  0, 80,112,114,
+/* 0x35c0 */ 111,116,101, 99,116,  0,101,120,105,116,  0,111,112,101,110, 97,
+/* 0x35d0 */ 116,  0,109,112,114,111,116,101, 99,116,  0, 99,108,111,115,101,
+/* 0x35e0 */   0,117,112,120, 95,115,111, 95,109, 97,105,110,  0, 82, 95, 88,
+/* 0x35f0 */  56, 54, 95, 54, 52, 95, 80, 76, 84, 51, 50,  0, 82, 95, 88, 56,
+/* 0x3600 */  54, 95, 54, 52, 95, 80, 67, 51, 50,  0,128, 46,  0,  0, 85, 80,
+/* 0x3610 */  88, 76, 78, 75, 48, 49
 };
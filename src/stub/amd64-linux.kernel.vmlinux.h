@@ -1,5 +1,5 @@
 /* amd64-linux.kernel.vmlinux.h
-   created from amd64-linux.kernel.vmlinux.bin, 21590 (0x5456) bytes
+   created from amd64-linux.kernel.vmlinux.bin, 12222 (0x2fbe) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_LINUX_KERNEL_VMLINUX_SIZE    21590
-#define STUB_AMD64_LINUX_KERNEL_VMLINUX_ADLER32 0xd1552260
-#define STUB_AMD64_LINUX_KERNEL_VMLINUX_CRC32   0x9dc6ed5a
+#define STUB_AMD64_LINUX_KERNEL_VMLINUX_SIZE    12222
+#define STUB_AMD64_LINUX_KERNEL_VMLINUX_ADLER32 0xd658d6ae
+#define STUB_AMD64_LINUX_KERNEL_VMLINUX_CRC32   0xe4751d97
 
-unsigned char stub_amd64_linux_kernel_vmlinux[21590] = {
+unsigned char stub_amd64_linux_kernel_vmlinux[12222] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  52, 30,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -450,940 +450,354 @@ unsigned char stub_amd64_linux_kernel_vmlinux[21590] = {
 /* 0x19b0 */ 252,131,193,  3,193,233,  2,141,116,138,252,141,120,252,243,165,
 /* 0x19c0 */ 252,141,119,  4,137,239,131,205,255,255,224, 85, 80, 88, 33,161,
 /* 0x19d0 */ 216,208,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x19e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,102,105,108,101, 32,
-/* 0x19f0 */ 102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,105, 51, 56,
-/* 0x1a00 */  54, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120,
-/* 0x1a10 */  32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x1a20 */ 105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32,
-/* 0x1a30 */  32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,
-/* 0x1a40 */ 101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,
-/* 0x1a50 */ 103,115, 10, 32, 32, 48, 32, 76, 73, 78, 85, 88, 48, 48, 48, 32,
-/* 0x1a60 */  32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1a70 */  51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1a80 */  84, 83, 10, 32, 32, 49, 32, 76, 88, 67, 65, 76, 76, 84, 49, 32,
-/* 0x1a90 */  32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1aa0 */  52, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1ab0 */  84, 83, 10, 32, 32, 50, 32, 76, 88, 67, 75, 76, 76, 84, 49, 32,
-/* 0x1ac0 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1ad0 */  52, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1ae0 */  84, 83, 10, 32, 32, 51, 32, 76, 88, 77, 79, 86, 69, 85, 80, 32,
-/* 0x1af0 */  32, 32, 32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1b00 */  52, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1b10 */  84, 83, 10, 32, 32, 52, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32,
-/* 0x1b20 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1b30 */  53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1b40 */  84, 83, 10, 32, 32, 53, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32,
-/* 0x1b50 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1b60 */  53, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1b70 */  84, 83, 10, 32, 32, 54, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32,
-/* 0x1b80 */  32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1b90 */  53, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1ba0 */  84, 83, 10, 32, 32, 55, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32,
-/* 0x1bb0 */  32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1bc0 */  53, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1bd0 */  84, 83, 10, 32, 32, 56, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32,
-/* 0x1be0 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1bf0 */  54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1c00 */  84, 83, 10, 32, 32, 57, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32,
-/* 0x1c10 */  32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1c20 */  54, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1c30 */  84, 83, 10, 32, 49, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32,
-/* 0x1c40 */  32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1c50 */  55, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1c60 */  84, 83, 10, 32, 49, 49, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32,
-/* 0x1c70 */  32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1c80 */  56, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1c90 */  84, 83, 10, 32, 49, 50, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32,
-/* 0x1ca0 */  32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1cb0 */  56,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1cc0 */  84, 83, 10, 32, 49, 51, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32,
-/* 0x1cd0 */  32, 32, 32, 32, 32, 48, 51,101, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1ce0 */  48, 57,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1cf0 */  78, 84, 83, 10, 32, 49, 52, 32, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x1d00 */  32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1d10 */  48,100, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d20 */  78, 84, 83, 10, 32, 49, 53, 32, 78, 50, 66, 70, 65, 83, 52, 48,
-/* 0x1d30 */  32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1d40 */  48,101, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d50 */  78, 84, 83, 10, 32, 49, 54, 32, 78, 50, 66, 83, 77, 65, 53, 48,
-/* 0x1d60 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1d70 */  48,102, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d80 */  78, 84, 83, 10, 32, 49, 55, 32, 78, 50, 66, 70, 65, 83, 53, 48,
-/* 0x1d90 */  32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1da0 */  48,102, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1db0 */  78, 84, 83, 10, 32, 49, 56, 32, 78, 50, 66, 68, 69, 67, 53, 48,
-/* 0x1dc0 */  32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1dd0 */  48,102, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1de0 */  78, 84, 83, 10, 32, 49, 57, 32, 78, 50, 66, 83, 77, 65, 54, 48,
-/* 0x1df0 */  32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1e00 */  48, 49, 48, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1e10 */  69, 78, 84, 83, 10, 32, 50, 48, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x1e20 */  48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48,
-/* 0x1e30 */  32, 32, 48, 49, 49, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1e40 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 49, 32, 78, 50, 66, 70, 65,
-/* 0x1e50 */  83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32,
-/* 0x1e60 */  32, 48, 32, 32, 48, 49, 50, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e70 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 50, 32, 78, 50, 66,
-/* 0x1e80 */  68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1e90 */  32, 48, 32, 32, 48, 49, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1ea0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 51, 32, 78, 50, 68,
-/* 0x1eb0 */  83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x1ec0 */  32, 32, 48, 32, 32, 48, 49, 52, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1ed0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 52, 32, 78, 50,
-/* 0x1ee0 */  68, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x1ef0 */  48, 32, 32, 48, 32, 32, 48, 49, 52, 51, 32, 32, 50, 42, 42, 48,
-/* 0x1f00 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 53, 32, 78,
-/* 0x1f10 */  50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x1f20 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 52, 53, 32, 32, 50, 42, 42,
-/* 0x1f30 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 54, 32,
-/* 0x1f40 */  78, 50, 68, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98,
-/* 0x1f50 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 52, 98, 32, 32, 50, 42,
-/* 0x1f60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 55,
-/* 0x1f70 */  32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1f80 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 53, 54, 32, 32, 50,
-/* 0x1f90 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x1fa0 */  56, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1fb0 */  48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 53, 98, 32, 32,
-/* 0x1fc0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1fd0 */  50, 57, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32,
-/* 0x1fe0 */  32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 54, 52, 32,
-/* 0x1ff0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2000 */  32, 51, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 32, 32, 32,
-/* 0x2010 */  32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 49,
-/* 0x2020 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2030 */  10, 32, 51, 49, 32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 32, 32,
-/* 0x2040 */  32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55,
-/* 0x2050 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2060 */  83, 10, 32, 51, 50, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 32,
-/* 0x2070 */  32, 32, 32, 32, 48, 53, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2080 */  49, 56,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2090 */  78, 84, 83, 10, 32, 51, 51, 32, 78, 50, 68, 83, 77, 65, 52, 48,
-/* 0x20a0 */  32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x20b0 */  48, 49,100,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x20c0 */  69, 78, 84, 83, 10, 32, 51, 52, 32, 78, 50, 68, 70, 65, 83, 52,
-/* 0x20d0 */  48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32,
-/* 0x20e0 */  32, 48, 49,101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x20f0 */  84, 69, 78, 84, 83, 10, 32, 51, 53, 32, 78, 50, 68, 83, 77, 65,
-/* 0x2100 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x2110 */  32, 32, 48, 49,102, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2120 */  78, 84, 69, 78, 84, 83, 10, 32, 51, 54, 32, 78, 50, 68, 70, 65,
-/* 0x2130 */  83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x2140 */  48, 32, 32, 48, 49,102,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2150 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 55, 32, 78, 50, 68, 68,
-/* 0x2160 */  69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32,
-/* 0x2170 */  32, 48, 32, 32, 48, 50, 48, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2180 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 56, 32, 78, 50, 68,
-/* 0x2190 */  83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48,
-/* 0x21a0 */  32, 32, 48, 32, 32, 48, 50, 48, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x21b0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 57, 32, 78, 50,
-/* 0x21c0 */  68, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32,
-/* 0x21d0 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 49, 53, 32, 32, 50, 42, 42,
-/* 0x21e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 48, 32,
-/* 0x21f0 */  78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x2200 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 50,101, 32, 32, 50,
-/* 0x2210 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52,
-/* 0x2220 */  49, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2230 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 52, 52, 32, 32, 50,
-/* 0x2240 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52,
-/* 0x2250 */  50, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2260 */  48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 52, 52, 32, 32,
-/* 0x2270 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2280 */  52, 51, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32,
-/* 0x2290 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 52, 55, 32,
-/* 0x22a0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x22b0 */  32, 52, 52, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 32, 32, 32,
-/* 0x22c0 */  32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 52, 57,
-/* 0x22d0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x22e0 */  10, 32, 52, 53, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 32, 32,
-/* 0x22f0 */  32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 52,
-/* 0x2300 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2310 */  83, 10, 32, 52, 54, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 32,
-/* 0x2320 */  32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x2330 */  53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2340 */  84, 83, 10, 32, 52, 55, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32,
-/* 0x2350 */  32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2360 */  50, 53,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2370 */  78, 84, 83, 10, 32, 52, 56, 32, 78, 50, 69, 68, 69, 67, 50, 48,
-/* 0x2380 */  32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2390 */  48, 50, 54, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x23a0 */  69, 78, 84, 83, 10, 32, 52, 57, 32, 78, 50, 69, 83, 77, 65, 51,
-/* 0x23b0 */  48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32,
-/* 0x23c0 */  32, 48, 50, 55, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x23d0 */  84, 69, 78, 84, 83, 10, 32, 53, 48, 32, 78, 50, 69, 70, 65, 83,
-/* 0x23e0 */  51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48,
-/* 0x23f0 */  32, 32, 48, 50, 56, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2400 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 49, 32, 78, 50, 69, 68, 69,
-/* 0x2410 */  67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 53,102, 32, 32, 48, 32,
-/* 0x2420 */  32, 48, 32, 32, 48, 50, 57, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2430 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 50, 32, 78, 50, 69,
-/* 0x2440 */  83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48,
-/* 0x2450 */  32, 32, 48, 32, 32, 48, 50,102, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2460 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 51, 32, 78, 50,
-/* 0x2470 */  69, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32,
-/* 0x2480 */  48, 32, 32, 48, 32, 32, 48, 50,102,100, 32, 32, 50, 42, 42, 48,
-/* 0x2490 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 52, 32, 78,
-/* 0x24a0 */  50, 69, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x24b0 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 48, 99, 32, 32, 50, 42, 42,
-/* 0x24c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 53, 32,
-/* 0x24d0 */  78, 50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x24e0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 48,101, 32, 32, 50, 42,
-/* 0x24f0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 54,
-/* 0x2500 */  32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2510 */  57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 49, 49, 32, 32, 50,
-/* 0x2520 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x2530 */  55, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2540 */  48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 49, 97, 32, 32,
-/* 0x2550 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2560 */  53, 56, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32,
-/* 0x2570 */  32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 50, 54,
-/* 0x2580 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2590 */  10, 32, 53, 57, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 32, 32,
-/* 0x25a0 */  32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x25b0 */  51,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x25c0 */  84, 83, 10, 32, 54, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32,
-/* 0x25d0 */  32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x25e0 */  53, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x25f0 */  84, 83, 10, 32, 54, 49, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48,
-/* 0x2600 */  48, 32, 32, 32, 32, 48, 50,101, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2610 */  48, 51, 53, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2620 */  69, 78, 84, 83, 10, 32, 54, 50, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x2630 */  70, 48, 48, 32, 32, 32, 32, 48, 52, 56, 32, 32, 48, 32, 32, 48,
-/* 0x2640 */  32, 32, 48, 51, 56, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2650 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 51, 32, 76, 90, 77, 65, 95,
-/* 0x2660 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 97, 56, 54, 32, 32, 48,
-/* 0x2670 */  32, 32, 48, 32, 32, 48, 51, 99, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2680 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 52, 32, 76, 90,
-/* 0x2690 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 97, 56, 54,
-/* 0x26a0 */  32, 32, 48, 32, 32, 48, 32, 32, 48,101, 53, 49, 32, 32, 50, 42,
-/* 0x26b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 53,
-/* 0x26c0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48,
-/* 0x26d0 */  49, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56,100, 55, 32,
-/* 0x26e0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x26f0 */  32, 54, 54, 32, 76, 88, 67, 75, 76, 76, 84, 57, 32, 32, 32, 32,
-/* 0x2700 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56,102,
-/* 0x2710 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2720 */  83, 10, 32, 54, 55, 32, 99,116,111,107, 51, 50, 46, 48, 48, 32,
-/* 0x2730 */  32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2740 */  56,102, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2750 */  78, 84, 83, 10, 32, 54, 56, 32, 99,116,111,107, 51, 50, 46, 49,
-/* 0x2760 */  48, 32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2770 */  48, 49, 56,102, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2780 */  84, 69, 78, 84, 83, 10, 32, 54, 57, 32, 99,116,111,107, 51, 50,
-/* 0x2790 */  46, 50, 48, 32, 32, 32, 32, 32, 48, 50, 48, 32, 32, 48, 32, 32,
-/* 0x27a0 */  48, 32, 32, 48, 49, 57, 48, 57, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x27b0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 48, 32, 99,116,111,
-/* 0x27c0 */ 107, 51, 50, 46, 51, 48, 32, 32, 32, 32, 32, 48, 97, 32, 32, 48,
-/* 0x27d0 */  32, 32, 48, 32, 32, 48, 49, 57, 50, 57, 32, 32, 50, 42, 42, 48,
-/* 0x27e0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 49, 32, 99,
-/* 0x27f0 */ 116,111,107, 51, 50, 46, 52, 48, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x2800 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 51, 32, 32, 50, 42,
-/* 0x2810 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 50,
-/* 0x2820 */  32, 76, 88, 67, 65, 76, 76, 84, 57, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2830 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 56, 32, 32,
-/* 0x2840 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2850 */  55, 51, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 32, 32, 32, 32,
-/* 0x2860 */  32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 97,
-/* 0x2870 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2880 */  10, 32, 55, 52, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 32, 32,
-/* 0x2890 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x28a0 */  52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x28b0 */  84, 83, 10, 32, 55, 53, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32,
-/* 0x28c0 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x28d0 */  49, 57, 52,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x28e0 */  69, 78, 84, 83, 10, 32, 55, 54, 32, 67, 84, 66, 83, 72, 82, 48,
-/* 0x28f0 */  49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2900 */  32, 48, 49, 57, 53, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2910 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 55, 32, 67, 84, 66, 82, 79,
-/* 0x2920 */  82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2930 */  48, 32, 32, 48, 49, 57, 53, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2940 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 56, 32, 67, 84, 66,
-/* 0x2950 */  83, 87, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2960 */  32, 32, 48, 32, 32, 48, 49, 57, 53, 56, 32, 32, 50, 42, 42, 48,
-/* 0x2970 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 57, 32, 67,
-/* 0x2980 */  65, 76, 76, 84, 82, 48, 50, 32, 32, 32, 32, 32, 32, 48,101, 32,
-/* 0x2990 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53,100, 32, 32, 50, 42,
-/* 0x29a0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 48,
-/* 0x29b0 */  32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x29c0 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54, 98, 32, 32,
-/* 0x29d0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x29e0 */  56, 49, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32, 32, 32, 32, 32,
-/* 0x29f0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 48,
-/* 0x2a00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2a10 */  10, 32, 56, 50, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 32, 32,
-/* 0x2a20 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2a30 */  55, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2a40 */  84, 83, 10, 32, 56, 51, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32,
-/* 0x2a50 */  32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2a60 */  49, 57, 55, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2a70 */  69, 78, 84, 83, 10, 32, 56, 52, 32, 67, 84, 67, 76, 69, 86, 69,
-/* 0x2a80 */  50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2a90 */  32, 48, 49, 57, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2aa0 */  78, 84, 69, 78, 84, 83, 10, 32, 56, 53, 32, 67, 65, 76, 76, 84,
-/* 0x2ab0 */  82, 49, 50, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2ac0 */  48, 32, 32, 48, 49, 57, 55,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2ad0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 54, 32, 67, 84, 66,
-/* 0x2ae0 */  83, 72, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48,
-/* 0x2af0 */  32, 32, 48, 32, 32, 48, 49, 57, 55,102, 32, 32, 50, 42, 42, 48,
-/* 0x2b00 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 55, 32, 67,
-/* 0x2b10 */  84, 66, 82, 79, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x2b20 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 51, 32, 32, 50, 42,
-/* 0x2b30 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 56,
-/* 0x2b40 */  32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2b50 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 53, 32, 32,
-/* 0x2b60 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2b70 */  56, 57, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 32, 32, 32, 32,
-/* 0x2b80 */  32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 97,
-/* 0x2b90 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2ba0 */  10, 32, 57, 48, 32, 76, 73, 78, 85, 88, 57, 57, 48, 32, 32, 32,
-/* 0x2bb0 */  32, 32, 32, 48, 51, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2bc0 */  57, 56,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2bd0 */  78, 84, 83, 10, 32, 57, 49, 32, 76, 73, 78, 85, 88, 57, 57, 49,
-/* 0x2be0 */  32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2bf0 */  48, 49, 57, 99, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2c00 */  84, 69, 78, 84, 83, 10, 32, 57, 50, 32, 76, 73, 78, 85, 88, 57,
-/* 0x2c10 */  57, 50, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x2c20 */  32, 32, 48, 49, 57, 99, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2c30 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 51, 32, 85, 80, 88, 49,
-/* 0x2c40 */  72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 50, 48, 32, 32, 48,
-/* 0x2c50 */  32, 32, 48, 32, 32, 48, 49, 57, 99, 98, 32, 32, 50, 42, 42, 48,
-/* 0x2c60 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79,
-/* 0x2c70 */  76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2c80 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x2c90 */  49, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48,
-/* 0x2ca0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x2cb0 */  50, 66, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x2cc0 */  49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2cd0 */  32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 48, 32, 78,
-/* 0x2ce0 */  50, 66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2cf0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50,
-/* 0x2d00 */  48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2d10 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x2d20 */  66, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 51,
-/* 0x2d30 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2d40 */ 100, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50,
-/* 0x2d50 */  66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d60 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49,
-/* 0x2d70 */  32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48,
-/* 0x2d80 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x2d90 */  68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48,
-/* 0x2da0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2db0 */  32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 68,
-/* 0x2dc0 */  83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2dd0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32,
-/* 0x2de0 */  48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48,
-/* 0x2df0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68,
-/* 0x2e00 */  69, 67, 49, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10,
-/* 0x2e10 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2e20 */  32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 48, 32, 78, 50, 68, 68,
-/* 0x2e30 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2e40 */  32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 48,
-/* 0x2e50 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2e60 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69,
-/* 0x2e70 */  67, 53, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 48,
-/* 0x2e80 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2e90 */  78, 50, 68, 70, 65, 83, 54, 49, 32, 48, 32, 78, 50, 68, 70, 65,
-/* 0x2ea0 */  83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2eb0 */  32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 48, 32,
-/* 0x2ec0 */  78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ed0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x2ee0 */  49, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48,
-/* 0x2ef0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x2f00 */  50, 69, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83,
-/* 0x2f10 */  49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2f20 */  32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 48, 32, 78,
-/* 0x2f30 */  50, 69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f40 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50,
-/* 0x2f50 */  48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2f60 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x2f70 */  69, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x2f80 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2f90 */ 100, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50,
-/* 0x2fa0 */  69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2fb0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49,
-/* 0x2fc0 */  32, 48, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48,
-/* 0x2fd0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x2fe0 */  68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48,
-/* 0x2ff0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3000 */  32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 32, 48, 32, 99,116,
-/* 0x3010 */ 111,107, 51, 50, 46, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3020 */  32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46,
-/* 0x3030 */  49, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 48,
-/* 0x3040 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3050 */  99,116,111,107, 51, 50, 46, 50, 48, 32, 48, 32, 99,116,111,107,
-/* 0x3060 */  51, 50, 46, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3070 */  32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x3080 */  32, 48, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48,
-/* 0x3090 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x30a0 */  76, 76, 84, 82, 48, 48, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48,
-/* 0x30b0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x30c0 */ 100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 48, 32, 67, 65,
-/* 0x30d0 */  76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x30e0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49,
-/* 0x30f0 */  32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 48, 48, 48, 48,
-/* 0x3100 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76,
-/* 0x3110 */  76, 84, 82, 49, 51, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51,
-/* 0x3120 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3130 */  32, 32, 76, 73, 78, 85, 88, 57, 57, 48, 32, 48, 32, 76, 73, 78,
-/* 0x3140 */  85, 88, 57, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3150 */  32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88, 48, 48, 48, 32,
-/* 0x3160 */  48, 32, 76, 73, 78, 85, 88, 48, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3170 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65,
-/* 0x3180 */  76, 76, 84, 49, 32, 48, 32, 76, 88, 67, 65, 76, 76, 84, 49, 10,
-/* 0x3190 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x31a0 */  32, 76, 88, 67, 75, 76, 76, 84, 49, 32, 48, 32, 76, 88, 67, 75,
-/* 0x31b0 */  76, 76, 84, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x31c0 */  32, 32, 32,100, 32, 32, 76, 88, 77, 79, 86, 69, 85, 80, 32, 48,
-/* 0x31d0 */  32, 76, 88, 77, 79, 86, 69, 85, 80, 10, 48, 48, 48, 48, 48, 48,
-/* 0x31e0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65,
-/* 0x31f0 */  83, 49, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 49, 48, 10, 48,
-/* 0x3200 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3210 */  78, 50, 66, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 66, 83, 77,
-/* 0x3220 */  65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3230 */  32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 48, 32,
-/* 0x3240 */  78, 50, 66, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3250 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x3260 */  51, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 51, 48, 10, 48, 48,
-/* 0x3270 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3280 */  50, 66, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x3290 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x32a0 */  32,100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 48, 32, 78,
-/* 0x32b0 */  50, 66, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 52,
-/* 0x32d0 */  48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48, 10, 48, 48, 48,
-/* 0x32e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x32f0 */  66, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 53,
-/* 0x3300 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3310 */ 100, 32, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50,
-/* 0x3320 */  66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3330 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 54, 48,
-/* 0x3340 */  32, 48, 32, 78, 50, 66, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48,
-/* 0x3350 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x3360 */  70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48,
-/* 0x3370 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3380 */  32, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 68,
-/* 0x3390 */  70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x33a0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32,
-/* 0x33b0 */  48, 32, 78, 50, 68, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x33c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x33d0 */  65, 83, 50, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 50, 48, 10,
-/* 0x33e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x33f0 */  32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 68, 83,
-/* 0x3400 */  77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3410 */  32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 48,
-/* 0x3420 */  32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3430 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77,
-/* 0x3440 */  65, 52, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 52, 48, 10, 48,
-/* 0x3450 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3460 */  78, 50, 68, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 68, 70, 65,
-/* 0x3470 */  83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3480 */  32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 48, 32,
-/* 0x3490 */  78, 50, 68, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x34b0 */  53, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 53, 48, 10, 48, 48,
-/* 0x34c0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x34d0 */  50, 68, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x34e0 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x34f0 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 48, 32, 78,
-/* 0x3500 */  50, 68, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3510 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49,
-/* 0x3520 */  48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48, 10, 48, 48, 48,
-/* 0x3530 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3540 */  69, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 50,
-/* 0x3550 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3560 */ 100, 32, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50,
-/* 0x3570 */  69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3580 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 51, 48,
-/* 0x3590 */  32, 48, 32, 78, 50, 69, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48,
-/* 0x35a0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x35b0 */  70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x35c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x35d0 */  32, 32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 69,
-/* 0x35e0 */  83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x35f0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32,
-/* 0x3600 */  48, 32, 78, 50, 69, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3610 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83,
-/* 0x3620 */  77, 65, 53, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 53, 48, 10,
-/* 0x3630 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3640 */  32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 69, 70,
-/* 0x3650 */  65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3660 */  32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 48,
-/* 0x3670 */  32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3680 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65,
-/* 0x3690 */  83, 54, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54, 48, 10, 48,
-/* 0x36a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x36b0 */  76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 48, 32, 76, 90, 77,
-/* 0x36c0 */  65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36d0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x36e0 */  70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x36f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3700 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,
-/* 0x3710 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3720 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3730 */  68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3740 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3750 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48,
-/* 0x3760 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x3770 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67,
-/* 0x3780 */  75, 76, 76, 84, 57, 32, 48, 32, 76, 88, 67, 75, 76, 76, 84, 57,
-/* 0x3790 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x37a0 */  32, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 48, 32, 99,116,
-/* 0x37b0 */ 111,107, 51, 50, 46, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 84,
-/* 0x37d0 */  57, 32, 48, 32, 76, 88, 67, 65, 76, 76, 84, 57, 10, 48, 48, 48,
-/* 0x37e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x37f0 */  67, 76, 69, 86, 69, 49, 32, 48, 32, 67, 84, 67, 76, 69, 86, 69,
-/* 0x3800 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3810 */ 100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 48, 32, 67, 65,
-/* 0x3820 */  76, 76, 84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3830 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 48, 49,
-/* 0x3840 */  32, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10, 48, 48, 48, 48,
-/* 0x3850 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66,
-/* 0x3860 */  82, 79, 82, 48, 49, 32, 48, 32, 67, 84, 66, 82, 79, 82, 48, 49,
-/* 0x3870 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3880 */  32, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 48, 32, 67, 84, 66,
-/* 0x3890 */  83, 87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x38a0 */  32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32,
-/* 0x38b0 */  48, 32, 67, 65, 76, 76, 84, 82, 48, 50, 10, 48, 48, 48, 48, 48,
-/* 0x38c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x38d0 */  84, 82, 69, 56, 32, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 10,
-/* 0x38e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x38f0 */  32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 48, 32, 67, 65, 76, 76,
-/* 0x3900 */  84, 82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3910 */  32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 48,
-/* 0x3920 */  32, 67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3930 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84,
-/* 0x3940 */  82, 49, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 50, 10, 48,
-/* 0x3950 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3960 */  67, 84, 66, 83, 72, 82, 49, 49, 32, 48, 32, 67, 84, 66, 83, 72,
-/* 0x3970 */  82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3980 */  32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 48, 32,
-/* 0x3990 */  67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65,
-/* 0x39b0 */  49, 49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48,
-/* 0x39c0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x39d0 */  73, 78, 85, 88, 57, 57, 49, 32, 48, 32, 76, 73, 78, 85, 88, 57,
-/* 0x39e0 */  57, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x39f0 */  32,100, 32, 32, 76, 73, 78, 85, 88, 57, 57, 50, 32, 48, 32, 76,
-/* 0x3a00 */  73, 78, 85, 88, 57, 57, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a10 */  32,108, 32, 32, 32, 32,100, 32, 32, 85, 80, 88, 49, 72, 69, 65,
-/* 0x3a20 */  68, 32, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x3a30 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x3a40 */  78, 68, 42, 32, 48, 32, 69, 78, 84, 82, 89, 95, 80, 79, 73, 78,
-/* 0x3a50 */  84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3a60 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 80, 72, 89, 83, 73,
-/* 0x3a70 */  67, 65, 76, 95, 83, 84, 65, 82, 84, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3a80 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x3a90 */  32, 48, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48,
-/* 0x3aa0 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x3ab0 */  85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,114, 95,108,101,
-/* 0x3ac0 */ 110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x3ad0 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,
-/* 0x3ae0 */ 109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10,
-/* 0x3af0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3b00 */  32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,117, 95,
-/* 0x3b10 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x3b20 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109,
-/* 0x3b30 */  97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x3b50 */  32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,
-/* 0x3b60 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3b70 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 73, 78, 85, 88, 48,
-/* 0x3b80 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x3b90 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ba0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x3bb0 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3bc0 */  32, 69, 78, 84, 82, 89, 95, 80, 79, 73, 78, 84, 10, 48, 48, 48,
-/* 0x3bd0 */  48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x3be0 */  32, 32, 32, 32, 32, 32, 32, 32, 80, 72, 89, 83, 73, 67, 65, 76,
-/* 0x3bf0 */  95, 83, 84, 65, 82, 84, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x3c00 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x3c10 */  76, 88, 67, 75, 76, 76, 84, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x3c20 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3c30 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x3c40 */  48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32,
-/* 0x3c50 */  32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,
-/* 0x3c60 */ 111, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x3c70 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 79, 86,
-/* 0x3c80 */  69, 85, 80, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x3c90 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ca0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x3cb0 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3cc0 */  32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10,
-/* 0x3cd0 */  48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x3ce0 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 73, 78, 85, 88,
-/* 0x3cf0 */  57, 57, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x3d00 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x3d10 */  83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3d20 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3d30 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d40 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x3d50 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x3d60 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x3d70 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 49, 48, 93, 58,
-/* 0x3d80 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x3d90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x3da0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x3db0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x3dc0 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x3dd0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x3de0 */  50, 66, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x3df0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e00 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x3e10 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x3e20 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 10,
-/* 0x3e30 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x3e40 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 50, 48,
-/* 0x3e50 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3e60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3e70 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x3e80 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x3e90 */  50, 66, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x3ea0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x3eb0 */  91, 78, 50, 66, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x3ec0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ed0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x3ee0 */  48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x3ef0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48,
-/* 0x3f00 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3f10 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83,
-/* 0x3f20 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x3f30 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f40 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x3f50 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f60 */  32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3f70 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x3f80 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82,
-/* 0x3f90 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x3fa0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 68, 69, 67, 51, 48, 93,
-/* 0x3fb0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x3fc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x3fd0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32, 82, 95, 51, 56,
-/* 0x3fe0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x3ff0 */  66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 50,102, 32,
-/* 0x4000 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4010 */  32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79,
-/* 0x4020 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4030 */  79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 52, 48, 93, 58, 10, 79,
-/* 0x4040 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4050 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4060 */  48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x4070 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x4080 */  67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4090 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x40a0 */  70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x40b0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x40c0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40d0 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x40e0 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x40f0 */  48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x4100 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x4110 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4120 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65,
-/* 0x4130 */  54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4140 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4150 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82,
-/* 0x4160 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4170 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4180 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4190 */  82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70,
-/* 0x41a0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x41b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x41c0 */  48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x41d0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x41e0 */  54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56,
-/* 0x41f0 */  54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4200 */  66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4210 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4220 */  78, 50, 66, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4230 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4240 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4250 */  48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x4260 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10,
-/* 0x4270 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x4280 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 49,
-/* 0x4290 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x42a0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x42b0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x42c0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x42d0 */  78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x42e0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x42f0 */  32, 91, 78, 50, 68, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x4300 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4310 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4320 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x4330 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x4340 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4350 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77,
-/* 0x4360 */  65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4370 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4380 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x4390 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x43a0 */  32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x43b0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x43c0 */  79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 50, 48, 93, 58, 10, 79,
-/* 0x43d0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x43e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x43f0 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x4400 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65,
-/* 0x4410 */  83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4420 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x4430 */  83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4440 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4450 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4460 */  99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4470 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69,
-/* 0x4480 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4490 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 51, 48, 93, 58,
-/* 0x44a0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x44b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x44c0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54,
-/* 0x44d0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x44e0 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82,
-/* 0x44f0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4500 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4510 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4520 */  82, 32, 91, 78, 50, 68, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70,
-/* 0x4530 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4540 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4550 */  48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4560 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x4570 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32, 82, 95, 51, 56,
-/* 0x4580 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4590 */  68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 52, 51, 32,
-/* 0x45a0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x45b0 */  32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79,
-/* 0x45c0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x45d0 */  79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 52, 48, 93, 58, 10, 79,
-/* 0x45e0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x45f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4600 */  48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x4610 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x4620 */  67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4630 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x4640 */  70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4650 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4660 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4670 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4680 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x4690 */  48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x46a0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x46b0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x46c0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65,
-/* 0x46d0 */  54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x46e0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x46f0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82,
-/* 0x4700 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4710 */  32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4720 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4730 */  82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70,
-/* 0x4740 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4750 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4760 */  48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4770 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4780 */  54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56,
-/* 0x4790 */  54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x47a0 */  68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x47b0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x47c0 */  78, 50, 68, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x47d0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x47e0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x47f0 */  48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x4800 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10,
-/* 0x4810 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x4820 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 49,
-/* 0x4830 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x4840 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x4850 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x4860 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4870 */  78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4880 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4890 */  32, 91, 78, 50, 69, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x48a0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x48b0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x48c0 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x48d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x48e0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x48f0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77,
-/* 0x4900 */  65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4910 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4920 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x4930 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4940 */  32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x4950 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4960 */  79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 50, 48, 93, 58, 10, 79,
-/* 0x4970 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4980 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4990 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x49a0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65,
-/* 0x49b0 */  83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x49c0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x49d0 */  83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x49e0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49f0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a00 */  99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4a10 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69,
-/* 0x4a20 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4a30 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 51, 48, 93, 58,
-/* 0x4a40 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4a50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4a60 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54,
-/* 0x4a70 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x4a80 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82,
-/* 0x4a90 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4aa0 */  32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4ab0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4ac0 */  82, 32, 91, 78, 50, 69, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70,
-/* 0x4ad0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4ae0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4af0 */  48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4b00 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x4b10 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56,
-/* 0x4b20 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4b30 */  69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 51, 48, 32,
-/* 0x4b40 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b50 */  32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 10, 82, 69, 76, 79,
-/* 0x4b60 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4b70 */  79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 52, 48, 93, 58, 10, 79,
-/* 0x4b80 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4b90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4ba0 */  48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x4bb0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x4bc0 */  67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4bd0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x4be0 */  70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4bf0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c00 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c10 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4c20 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x4c30 */  48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x4c40 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x4c50 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4c60 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65,
-/* 0x4c70 */  54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4c80 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c90 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82,
-/* 0x4ca0 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4cb0 */  32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4cc0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4cd0 */  82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70,
-/* 0x4ce0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4cf0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4d00 */  48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4d10 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x4d20 */  54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56,
-/* 0x4d30 */  54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4d40 */  69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4d50 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4d60 */  78, 50, 69, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4d70 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4d80 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4d90 */  48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x4da0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10,
-/* 0x4db0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x4dc0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69,
-/* 0x4dd0 */  67, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4de0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4df0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x4e00 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e10 */  32, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,
-/* 0x4e20 */ 117,115,116, 10, 48, 48, 48, 48, 48, 48, 49, 52, 32, 82, 95, 51,
-/* 0x4e30 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x4e40 */ 122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4e50 */  49,101, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x4e60 */  32, 32, 32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10,
-/* 0x4e70 */  48, 48, 48, 48, 48, 48, 50, 97, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x4e80 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,
-/* 0x4e90 */ 112,114,111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79,
-/* 0x4ea0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4eb0 */  79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10,
-/* 0x4ec0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4ed0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4ee0 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4ef0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x4f00 */  51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x4f10 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x4f20 */ 116,111,107, 51, 50, 46, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4f30 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f40 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4f50 */  48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x4f60 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48,
-/* 0x4f70 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4f80 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50,
-/* 0x4f90 */  46, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4fa0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4fb0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x4fc0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4fd0 */  32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48,
-/* 0x4fe0 */  48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x4ff0 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x5000 */  10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5010 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x5020 */  51, 50, 46, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5030 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x5040 */ 116,111,107, 51, 50, 46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5050 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5060 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5070 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5080 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x5090 */  10, 48, 48, 48, 48, 48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95,
-/* 0x50a0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x50b0 */  51, 50, 46, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x50c0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x50d0 */ 116,111,107, 51, 50, 46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x50e0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50f0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5100 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5110 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,
-/* 0x5120 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5130 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x5140 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5150 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5160 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x5170 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5180 */  32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10, 10,
-/* 0x5190 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x51a0 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 49,
-/* 0x51b0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x51c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x51d0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51,
-/* 0x51e0 */  56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x51f0 */ 105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5200 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5210 */  32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82,
-/* 0x5220 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5230 */  83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 50, 93,
-/* 0x5240 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5250 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5260 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56,
-/* 0x5270 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65,
-/* 0x5280 */  76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5290 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x52a0 */  67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x52b0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x52c0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x52d0 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x52e0 */  32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,
-/* 0x52f0 */ 110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5300 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65,
-/* 0x5310 */  76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5320 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5330 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5340 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5350 */  32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 10, 82,
-/* 0x5360 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5370 */  83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 50, 93,
-/* 0x5380 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5390 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x53a0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56,
-/* 0x53b0 */  54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,
-/* 0x53c0 */ 108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x53d0 */  52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x53e0 */  32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 10, 82, 69,
-/* 0x53f0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5400 */  32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 51, 93, 58,
-/* 0x5410 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5420 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5430 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54,
-/* 0x5440 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76,
-/* 0x5450 */  76, 84, 82, 49, 48, 10
+/* 0x19e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45, 94,  0,  0,  0,102,
+/* 0x19f0 */   0,  0,  0, 76,  0,  0,  0,239,  3,  0,  0,  0,  0,  0,  0, 52,
+/* 0x1a00 */   0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 66,
+/* 0x1a10 */   0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 67,
+/* 0x1a20 */   0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0, 70,
+/* 0x1a30 */   0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0, 80,
+/* 0x1a40 */   0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0, 83,
+/* 0x1a50 */   0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0, 85,
+/* 0x1a60 */   0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 91,
+/* 0x1a70 */   0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,102,
+/* 0x1a80 */   0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,107,
+/* 0x1a90 */   0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,116,
+/* 0x1aa0 */   0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,129,
+/* 0x1ab0 */   0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,142,
+/* 0x1ac0 */   0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,157,
+/* 0x1ad0 */   0,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0,219,
+/* 0x1ae0 */   0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0,232,
+/* 0x1af0 */   0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0,247,
+/* 0x1b00 */   0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,249,
+/* 0x1b10 */   0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0,252,
+/* 0x1b20 */   0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0,  5,
+/* 0x1b30 */   1,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0, 17,
+/* 0x1b40 */   1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 42,
+/* 0x1b50 */   1,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0, 64,
+/* 0x1b60 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0, 64,
+/* 0x1b70 */   1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0, 67,
+/* 0x1b80 */   1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 69,
+/* 0x1b90 */   1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 75,
+/* 0x1ba0 */   1,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0, 86,
+/* 0x1bb0 */   1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 91,
+/* 0x1bc0 */   1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0,100,
+/* 0x1bd0 */   1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0,113,
+/* 0x1be0 */   1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0,126,
+/* 0x1bf0 */   1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0,141,
+/* 0x1c00 */   1,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0,223,
+/* 0x1c10 */   1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0,236,
+/* 0x1c20 */   1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,251,
+/* 0x1c30 */   1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0,253,
+/* 0x1c40 */   1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0,  0,
+/* 0x1c50 */   2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0,  9,
+/* 0x1c60 */   2,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0, 21,
+/* 0x1c70 */   2,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 46,
+/* 0x1c80 */   2,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 68,
+/* 0x1c90 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0, 68,
+/* 0x1ca0 */   2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0, 71,
+/* 0x1cb0 */   2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 73,
+/* 0x1cc0 */   2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0, 79,
+/* 0x1cd0 */   2,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 90,
+/* 0x1ce0 */   2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 95,
+/* 0x1cf0 */   2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0,104,
+/* 0x1d00 */   2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0,117,
+/* 0x1d10 */   2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0,130,
+/* 0x1d20 */   2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0,145,
+/* 0x1d30 */   2,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0,240,
+/* 0x1d40 */   2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0,253,
+/* 0x1d50 */   2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0, 12,
+/* 0x1d60 */   3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0, 14,
+/* 0x1d70 */   3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0, 17,
+/* 0x1d80 */   3,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 26,
+/* 0x1d90 */   3,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0, 38,
+/* 0x1da0 */   3,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 63,
+/* 0x1db0 */   3,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0, 85,
+/* 0x1dc0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  2,  0,  0, 85,
+/* 0x1dd0 */   3,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0, 48,  2,  0,  0,131,
+/* 0x1de0 */   3,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0, 59,  2,  0,  0,203,
+/* 0x1df0 */   3,  0,  0,134, 10,  0,  0,  0,  0,  0,  0, 70,  2,  0,  0, 81,
+/* 0x1e00 */  14,  0,  0,134, 10,  0,  0,  0,  0,  0,  0, 81,  2,  0,  0,215,
+/* 0x1e10 */  24,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0, 92,  2,  0,  0,241,
+/* 0x1e20 */  24,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,101,  2,  0,  0,244,
+/* 0x1e30 */  24,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,111,  2,  0,  0,251,
+/* 0x1e40 */  24,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,121,  2,  0,  0,  9,
+/* 0x1e50 */  25,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,131,  2,  0,  0, 41,
+/* 0x1e60 */  25,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,141,  2,  0,  0, 51,
+/* 0x1e70 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,151,  2,  0,  0, 56,
+/* 0x1e80 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,160,  2,  0,  0, 58,
+/* 0x1e90 */  25,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,169,  2,  0,  0, 72,
+/* 0x1ea0 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,178,  2,  0,  0, 77,
+/* 0x1eb0 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,187,  2,  0,  0, 82,
+/* 0x1ec0 */  25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,196,  2,  0,  0, 86,
+/* 0x1ed0 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,205,  2,  0,  0, 88,
+/* 0x1ee0 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,214,  2,  0,  0, 93,
+/* 0x1ef0 */  25,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,223,  2,  0,  0,107,
+/* 0x1f00 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,232,  2,  0,  0,112,
+/* 0x1f10 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,241,  2,  0,  0,114,
+/* 0x1f20 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,250,  2,  0,  0,116,
+/* 0x1f30 */  25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  3,  3,  0,  0,120,
+/* 0x1f40 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 12,  3,  0,  0,125,
+/* 0x1f50 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 21,  3,  0,  0,127,
+/* 0x1f60 */  25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 30,  3,  0,  0,131,
+/* 0x1f70 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 39,  3,  0,  0,133,
+/* 0x1f80 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 48,  3,  0,  0,138,
+/* 0x1f90 */  25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 57,  3,  0,  0,143,
+/* 0x1fa0 */  25,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0, 66,  3,  0,  0,198,
+/* 0x1fb0 */  25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 75,  3,  0,  0,201,
+/* 0x1fc0 */  25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 84,  3,  0,  0,203,
+/* 0x1fd0 */  25,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  4,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  6,  0,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0, 63,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 90,
+/* 0x2000 */   0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0, 13,
+/* 0x2010 */   0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0, 18,  0,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,189,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,198,
+/* 0x2030 */   0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0, 23,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 25,  0,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,234,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  5,
+/* 0x2060 */   1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0, 32,
+/* 0x2070 */   0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0, 37,  0,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,104,  1,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,113,
+/* 0x2090 */   1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0, 42,
+/* 0x20a0 */   0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 44,  0,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,149,  1,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,176,
+/* 0x20c0 */   1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0, 51,
+/* 0x20d0 */   0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0, 56,  0,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0, 19,  2,  0,  0, 59,  0,  0,  0,  0,  0,  0,  0, 28,
+/* 0x20f0 */   2,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,101,  2,  0,  0, 67,
+/* 0x2100 */   0,  0,  0,  0,  0,  0,  0,111,  2,  0,  0, 68,  0,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,121,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,141,
+/* 0x2120 */   2,  0,  0, 71,  0,  0,  0,  0,  0,  0,  0,160,  2,  0,  0, 73,
+/* 0x2130 */   0,  0,  0,  0,  0,  0,  0,223,  2,  0,  0, 80,  0,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,250,  2,  0,  0, 83,  0,  0,  0,  0,  0,  0,  0, 48,
+/* 0x2150 */   3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0, 57,  3,  0,  0, 90,
+/* 0x2160 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,
+/* 0x2180 */   0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,
+/* 0x2190 */   0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  5,  0,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0, 72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 81,
+/* 0x21b0 */   0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 11,
+/* 0x21c0 */   0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0, 12,  0,  0,  0,  0,
+/* 0x21d0 */   0,  0,  0,126,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,135,
+/* 0x21e0 */   0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0, 16,
+/* 0x21f0 */   0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0, 17,  0,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,171,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,180,
+/* 0x2210 */   0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0, 24,
+/* 0x2220 */   0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0, 27,  0,  0,  0,  0,
+/* 0x2230 */   0,  0,  0,252,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 14,
+/* 0x2240 */   1,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0, 31,
+/* 0x2250 */   0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0, 33,  0,  0,  0,  0,
+/* 0x2260 */   0,  0,  0, 50,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0, 59,
+/* 0x2270 */   1,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0, 36,
+/* 0x2280 */   0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0, 38,  0,  0,  0,  0,
+/* 0x2290 */   0,  0,  0, 95,  1,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,131,
+/* 0x22a0 */   1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 46,
+/* 0x22b0 */   0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 47,  0,  0,  0,  0,
+/* 0x22c0 */   0,  0,  0,185,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,194,
+/* 0x22d0 */   1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0, 52,
+/* 0x22e0 */   0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0, 53,  0,  0,  0,  0,
+/* 0x22f0 */   0,  0,  0,230,  1,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,239,
+/* 0x2300 */   1,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 57,
+/* 0x2310 */   0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0, 58,  0,  0,  0,  0,
+/* 0x2320 */   0,  0,  0, 37,  2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0, 48,
+/* 0x2330 */   2,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0, 59,  2,  0,  0, 63,
+/* 0x2340 */   0,  0,  0,  0,  0,  0,  0, 70,  2,  0,  0, 64,  0,  0,  0,  0,
+/* 0x2350 */   0,  0,  0, 81,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0, 92,
+/* 0x2360 */   2,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,131,  2,  0,  0, 70,
+/* 0x2370 */   0,  0,  0,  0,  0,  0,  0,151,  2,  0,  0, 72,  0,  0,  0,  0,
+/* 0x2380 */   0,  0,  0,169,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,178,
+/* 0x2390 */   2,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,187,  2,  0,  0, 76,
+/* 0x23a0 */   0,  0,  0,  0,  0,  0,  0,196,  2,  0,  0, 77,  0,  0,  0,  0,
+/* 0x23b0 */   0,  0,  0,205,  2,  0,  0, 78,  0,  0,  0,  0,  0,  0,  0,214,
+/* 0x23c0 */   2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,232,  2,  0,  0, 81,
+/* 0x23d0 */   0,  0,  0,  0,  0,  0,  0,241,  2,  0,  0, 82,  0,  0,  0,  0,
+/* 0x23e0 */   0,  0,  0,  3,  3,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0, 12,
+/* 0x23f0 */   3,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0, 21,  3,  0,  0, 86,
+/* 0x2400 */   0,  0,  0,  0,  0,  0,  0, 30,  3,  0,  0, 87,  0,  0,  0,  0,
+/* 0x2410 */   0,  0,  0, 39,  3,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0, 66,
+/* 0x2420 */   3,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0, 75,  3,  0,  0, 92,
+/* 0x2430 */   0,  0,  0,  0,  0,  0,  0, 84,  3,  0,  0, 93,  0,  0,  0,  0,
+/* 0x2440 */   0,  0,  0, 93,  3,  0,  0, 95,  0,  0,  0,173,222,173,222,105,
+/* 0x2450 */   3,  0,  0, 95,  0,  0,  0,173,222,173,222,120,  3,  0,  0, 95,
+/* 0x2460 */   0,  0,  0,173,222,173,222,131,  3,  0,  0, 95,  0,  0,  0,173,
+/* 0x2470 */ 222,173,222,145,  3,  0,  0, 95,  0,  0,  0,173,222,173,222,163,
+/* 0x2480 */   3,  0,  0, 95,  0,  0,  0,173,222,173,222,174,  3,  0,  0, 95,
+/* 0x2490 */   0,  0,  0,173,222,173,222,185,  3,  0,  0, 95,  0,  0,  0,173,
+/* 0x24a0 */ 222,173,222,  0,  0,  0,  0,  3,  0,  0,  0,201,  3,  0,  0, 93,
+/* 0x24b0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,
+/* 0x24c0 */   0,  0,  0,201,  3,  0,  0,105,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24d0 */   0,  0,  0,  2,  0,  0,  0,  2,  0,  0,  0,210,  3,  0,  0,120,
+/* 0x24e0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  1,
+/* 0x24f0 */   0,  0,  0,201,  3,  0,  0,131,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2500 */   0,  0,  0,  3,  0,  0,  0,  6,  0,  0,  0,218,  3,  0,  0, 57,
+/* 0x2510 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  1,
+/* 0x2520 */   0,  0,  0,229,  3,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2530 */   0,  0,  0,  5,  0,  0,  0,  1,  0,  0,  0,229,  3,  0,  0, 63,
+/* 0x2540 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  1,
+/* 0x2550 */   0,  0,  0,229,  3,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2560 */   0,  0,  0,  9,  0,  0,  0,  3,  0,  0,  0,229,  3,  0,  0, 54,
+/* 0x2570 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 12,
+/* 0x2580 */   0,  0,  0,229,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2590 */   0,  0,  0, 12,  0,  0,  0,  3,  0,  0,  0,229,  3,  0,  0, 90,
+/* 0x25a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 14,
+/* 0x25b0 */   0,  0,  0,229,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25c0 */   0,  0,  0, 13,  0,  0,  0, 17,  0,  0,  0,229,  3,  0,  0,198,
+/* 0x25d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 47,
+/* 0x25e0 */   0,  0,  0,229,  3,  0,  0,162,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25f0 */   0,  0,  0, 14,  0,  0,  0, 12,  0,  0,  0,229,  3,  0,  0,117,
+/* 0x2600 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  3,
+/* 0x2610 */   0,  0,  0,229,  3,  0,  0,117,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2620 */   0,  0,  0, 15,  0,  0,  0, 14,  0,  0,  0,229,  3,  0,  0,117,
+/* 0x2630 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,  8,
+/* 0x2640 */   0,  0,  0,218,  3,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2650 */   0,  0,  0, 20,  0,  0,  0, 10,  0,  0,  0,229,  3,  0,  0,189,
+/* 0x2660 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0, 21,
+/* 0x2670 */   0,  0,  0,218,  3,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2680 */   0,  0,  0, 21,  0,  0,  0, 18,  0,  0,  0,218,  3,  0,  0, 63,
+/* 0x2690 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,  1,
+/* 0x26a0 */   0,  0,  0,229,  3,  0,  0,234,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26b0 */   0,  0,  0, 24,  0,  0,  0,  1,  0,  0,  0,229,  3,  0,  0,234,
+/* 0x26c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  1,
+/* 0x26d0 */   0,  0,  0,229,  3,  0,  0,207,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26e0 */   0,  0,  0, 28,  0,  0,  0,  3,  0,  0,  0,229,  3,  0,  0,225,
+/* 0x26f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 12,
+/* 0x2700 */   0,  0,  0,229,  3,  0,  0, 32,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2710 */   0,  0,  0, 31,  0,  0,  0,  5,  0,  0,  0,229,  3,  0,  0, 32,
+/* 0x2720 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 14,
+/* 0x2730 */   0,  0,  0,229,  3,  0,  0, 32,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */   0,  0,  0, 32,  0,  0,  0, 15,  0,  0,  0,229,  3,  0,  0,  5,
+/* 0x2750 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 33,
+/* 0x2760 */   0,  0,  0,229,  3,  0,  0,113,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */   0,  0,  0, 32,  0,  0,  0, 67,  0,  0,  0,229,  3,  0,  0, 77,
+/* 0x2780 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0, 12,
+/* 0x2790 */   0,  0,  0,229,  3,  0,  0, 32,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27a0 */   0,  0,  0, 34,  0,  0,  0,  3,  0,  0,  0,229,  3,  0,  0, 32,
+/* 0x27b0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  0,  0,  0, 14,
+/* 0x27c0 */   0,  0,  0,229,  3,  0,  0, 32,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27d0 */   0,  0,  0, 38,  0,  0,  0,  8,  0,  0,  0,218,  3,  0,  0,234,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0, 10,
+/* 0x27f0 */   0,  0,  0,229,  3,  0,  0,104,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2800 */   0,  0,  0, 39,  0,  0,  0, 21,  0,  0,  0,218,  3,  0,  0,234,
+/* 0x2810 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,  0, 18,
+/* 0x2820 */   0,  0,  0,218,  3,  0,  0,234,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2830 */   0,  0,  0, 42,  0,  0,  0,  1,  0,  0,  0,229,  3,  0,  0,149,
+/* 0x2840 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,  0,  0,  0,  1,
+/* 0x2850 */   0,  0,  0,229,  3,  0,  0,149,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2860 */   0,  0,  0, 46,  0,  0,  0,  1,  0,  0,  0,229,  3,  0,  0,122,
+/* 0x2870 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  3,
+/* 0x2880 */   0,  0,  0,229,  3,  0,  0,140,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2890 */   0,  0,  0, 49,  0,  0,  0, 12,  0,  0,  0,229,  3,  0,  0,203,
+/* 0x28a0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,  5,
+/* 0x28b0 */   0,  0,  0,229,  3,  0,  0,203,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28c0 */   0,  0,  0, 50,  0,  0,  0, 14,  0,  0,  0,229,  3,  0,  0,203,
+/* 0x28d0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,  0, 15,
+/* 0x28e0 */   0,  0,  0,229,  3,  0,  0,176,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */   0,  0,  0, 51,  0,  0,  0, 30,  0,  0,  0,229,  3,  0,  0,248,
+/* 0x2900 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,  0, 48,
+/* 0x2910 */   0,  0,  0,229,  3,  0,  0, 28,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */   0,  0,  0, 52,  0,  0,  0, 12,  0,  0,  0,229,  3,  0,  0,203,
+/* 0x2930 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0,  3,
+/* 0x2940 */   0,  0,  0,229,  3,  0,  0,203,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2950 */   0,  0,  0, 53,  0,  0,  0, 14,  0,  0,  0,229,  3,  0,  0,203,
+/* 0x2960 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,  8,
+/* 0x2970 */   0,  0,  0,218,  3,  0,  0,149,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2980 */   0,  0,  0, 58,  0,  0,  0, 10,  0,  0,  0,229,  3,  0,  0, 19,
+/* 0x2990 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0, 21,
+/* 0x29a0 */   0,  0,  0,218,  3,  0,  0,149,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29b0 */   0,  0,  0, 59,  0,  0,  0, 18,  0,  0,  0,218,  3,  0,  0,149,
+/* 0x29c0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0,  5,
+/* 0x29d0 */   0,  0,  0,201,  3,  0,  0,145,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29e0 */   0,  0,  0, 61,  0,  0,  0, 20,  0,  0,  0,201,  3,  0,  0,163,
+/* 0x29f0 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0, 30,
+/* 0x2a00 */   0,  0,  0,201,  3,  0,  0,174,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a10 */   0,  0,  0, 61,  0,  0,  0, 42,  0,  0,  0,201,  3,  0,  0,185,
+/* 0x2a20 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  3,
+/* 0x2a30 */   0,  0,  0,229,  3,  0,  0,121,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a40 */   0,  0,  0, 68,  0,  0,  0, 13,  0,  0,  0,229,  3,  0,  0,121,
+/* 0x2a50 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  5,
+/* 0x2a60 */   0,  0,  0,229,  3,  0,  0,141,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a70 */   0,  0,  0, 69,  0,  0,  0, 10,  0,  0,  0,229,  3,  0,  0,141,
+/* 0x2a80 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 16,
+/* 0x2a90 */   0,  0,  0,229,  3,  0,  0,141,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2aa0 */   0,  0,  0, 70,  0,  0,  0,  4,  0,  0,  0,229,  3,  0,  0,141,
+/* 0x2ab0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  9,
+/* 0x2ac0 */   0,  0,  0,229,  3,  0,  0,111,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ad0 */   0,  0,  0, 71,  0,  0,  0,  4,  0,  0,  0,229,  3,  0,  0,101,
+/* 0x2ae0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 73,  0,  0,  0,  1,
+/* 0x2af0 */   0,  0,  0,201,  3,  0,  0,131,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b00 */   0,  0,  0, 74,  0,  0,  0,  2,  0,  0,  0,210,  3,  0,  0,120,
+/* 0x2b10 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74,  0,  0,  0,  4,
+/* 0x2b20 */   0,  0,  0,229,  3,  0,  0,160,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b30 */   0,  0,  0, 79,  0,  0,  0, 13,  0,  0,  0,229,  3,  0,  0,160,
+/* 0x2b40 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  1,
+/* 0x2b50 */   0,  0,  0,201,  3,  0,  0,131,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b60 */   0,  0,  0, 83,  0,  0,  0,  3,  0,  0,  0,229,  3,  0,  0, 48,
+/* 0x2b70 */   3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 84,  0,  0,  0,  2,
+/* 0x2b80 */   0,  0,  0,210,  3,  0,  0,120,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b90 */   0,  0,  0, 84,  0,  0,  0,  4,  0,  0,  0,229,  3,  0,  0,250,
+/* 0x2ba0 */   2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,  4,
+/* 0x2bb0 */   0,  0,  0,229,  3,  0,  0,223,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bc0 */   0,  0,  0, 76, 73, 78, 85, 88, 48, 48, 48,  0, 76, 88, 67, 65,
+/* 0x2bd0 */  76, 76, 84, 49,  0, 76, 88, 67, 75, 76, 76, 84, 49,  0, 76, 88,
+/* 0x2be0 */  77, 79, 86, 69, 85, 80,  0, 78, 50, 66, 83, 77, 65, 49, 48,  0,
+/* 0x2bf0 */  78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49,
+/* 0x2c00 */  49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66, 83, 77,
+/* 0x2c10 */  65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78, 50, 66,
+/* 0x2c20 */  68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,  0, 78,
+/* 0x2c30 */  50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67, 51, 48,
+/* 0x2c40 */   0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70, 65, 83,
+/* 0x2c50 */  52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50, 66, 70,
+/* 0x2c60 */  65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0, 78, 50,
+/* 0x2c70 */  66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 48,  0,
+/* 0x2c80 */  78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69, 67, 54,
+/* 0x2c90 */  48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68, 70, 65,
+/* 0x2ca0 */  83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78, 50, 68,
+/* 0x2cb0 */  68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,  0, 78,
+/* 0x2cc0 */  50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67, 50, 48,
+/* 0x2cd0 */   0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x2ce0 */  51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50, 68, 83,
+/* 0x2cf0 */  77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0, 78, 50,
+/* 0x2d00 */  68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53, 48,  0,
+/* 0x2d10 */  78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77, 65, 54,
+/* 0x2d20 */  48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68, 70, 65,
+/* 0x2d30 */  83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78, 50, 69,
+/* 0x2d40 */  83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,  0, 78,
+/* 0x2d50 */  50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67, 49, 48,
+/* 0x2d60 */   0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x2d70 */  50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50, 69, 83,
+/* 0x2d80 */  77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0, 78, 50,
+/* 0x2d90 */  69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52, 48,  0,
+/* 0x2da0 */  78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77, 65, 53,
+/* 0x2db0 */  48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69, 68, 69,
+/* 0x2dc0 */  67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78, 50, 69,
+/* 0x2dd0 */  70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,  0, 78,
+/* 0x2de0 */  50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x2df0 */  48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x2e00 */  77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x2e10 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76,
+/* 0x2e20 */  88, 67, 75, 76, 76, 84, 57,  0, 99,116,111,107, 51, 50, 46, 48,
+/* 0x2e30 */  48,  0, 99,116,111,107, 51, 50, 46, 49, 48,  0, 99,116,111,107,
+/* 0x2e40 */  51, 50, 46, 50, 48,  0, 99,116,111,107, 51, 50, 46, 51, 48,  0,
+/* 0x2e50 */  99,116,111,107, 51, 50, 46, 52, 48,  0, 76, 88, 67, 65, 76, 76,
+/* 0x2e60 */  84, 57,  0, 67, 65, 76, 76, 84, 82, 48, 48,  0, 67, 84, 67, 76,
+/* 0x2e70 */  69, 86, 69, 49,  0, 67, 65, 76, 76, 84, 82, 48, 49,  0, 67, 84,
+/* 0x2e80 */  66, 83, 72, 82, 48, 49,  0, 67, 84, 66, 82, 79, 82, 48, 49,  0,
+/* 0x2e90 */  67, 84, 66, 83, 87, 65, 48, 49,  0, 67, 65, 76, 76, 84, 82, 48,
+/* 0x2ea0 */  50,  0, 67, 65, 76, 76, 84, 82, 49, 48,  0, 67, 65, 76, 76, 84,
+/* 0x2eb0 */  82, 69, 56,  0, 67, 65, 76, 76, 84, 82, 69, 57,  0, 67, 65, 76,
+/* 0x2ec0 */  76, 84, 82, 49, 49,  0, 67, 84, 67, 76, 69, 86, 69, 50,  0, 67,
+/* 0x2ed0 */  65, 76, 76, 84, 82, 49, 50,  0, 67, 84, 66, 83, 72, 82, 49, 49,
+/* 0x2ee0 */   0, 67, 84, 66, 82, 79, 82, 49, 49,  0, 67, 84, 66, 83, 87, 65,
+/* 0x2ef0 */  49, 49,  0, 67, 65, 76, 76, 84, 82, 49, 51,  0, 76, 73, 78, 85,
+/* 0x2f00 */  88, 57, 57, 48,  0, 76, 73, 78, 85, 88, 57, 57, 49,  0, 76, 73,
+/* 0x2f10 */  78, 85, 88, 57, 57, 50,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0,
+/* 0x2f20 */  69, 78, 84, 82, 89, 95, 80, 79, 73, 78, 84,  0, 80, 72, 89, 83,
+/* 0x2f30 */  73, 67, 65, 76, 95, 83, 84, 65, 82, 84,  0,102,105,108,116,101,
+/* 0x2f40 */ 114, 95, 99,116,111,  0,102,105,108,116,101,114, 95,108,101,110,
+/* 0x2f50 */ 103,116,104,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,
+/* 0x2f60 */ 100,106,117,115,116,  0,108,122,109, 97, 95,117, 95,108,101,110,
+/* 0x2f70 */   0,108,122,109, 97, 95, 99, 95,108,101,110,  0,108,122,109, 97,
+/* 0x2f80 */  95,112,114,111,112,101,114,116,105,101,115,  0, 82, 95, 51, 56,
+/* 0x2f90 */  54, 95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 56,  0, 82, 95, 51,
+/* 0x2fa0 */  56, 54, 95, 80, 67, 51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67,
+/* 0x2fb0 */  56,  0,235, 25,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* amd64-linux.shlib-init.h
-   created from amd64-linux.shlib-init.bin, 8749 (0x222d) bytes
+   created from amd64-linux.shlib-init.bin, 7126 (0x1bd6) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_LINUX_SHLIB_INIT_SIZE    8749
-#define STUB_AMD64_LINUX_SHLIB_INIT_ADLER32 0x6a8948cf
-#define STUB_AMD64_LINUX_SHLIB_INIT_CRC32   0xbd9ef9e3
+#define STUB_AMD64_LINUX_SHLIB_INIT_SIZE    7126
+#define STUB_AMD64_LINUX_SHLIB_INIT_ADLER32 0x92959e34
+#define STUB_AMD64_LINUX_SHLIB_INIT_CRC32   0x9a65d616
 
-unsigned char stub_amd64_linux_shlib_init[8749] = {
+unsigned char stub_amd64_linux_shlib_init[7126] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,176, 25,  0,  0,  0,  0,  0,  0,
@@ -436,151 +436,50 @@ unsigned char stub_amd64_linux_shlib_init[8749] = {
 /* 0x18d0 */   3,193,233,  2,243,165, 94, 89, 81, 87,131,193,  3,193,233,  2,
 /* 0x18e0 */ 243,165, 72,139,117,168, 72,137,125,168,139, 78,252,243,164, 72,
 /* 0x18f0 */ 139,117,208, 72,137,125,208,139, 78,252,243,164, 72,137,198, 87,
-/* 0x1900 */ 139, 78,252,243,164,195,102,105,108,101, 32,102,111,114,109, 97,
-/* 0x1910 */ 116, 32,101,108,102, 54, 52, 45,120, 56, 54, 45, 54, 52, 10, 10,
-/* 0x1920 */  83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,
-/* 0x1930 */ 109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101,
-/* 0x1940 */  32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1950 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1960 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,
-/* 0x1970 */ 102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10,
-/* 0x1980 */  32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32,
-/* 0x1990 */  32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48,
-/* 0x19a0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x19b0 */  10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32,
-/* 0x19c0 */  32, 32, 32, 48, 54, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53,
-/* 0x19d0 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x19e0 */  83, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32,
-/* 0x19f0 */  32, 32, 32, 32, 48, 98, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1a00 */  98,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1a10 */  84, 83, 10, 32, 32, 51, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32,
-/* 0x1a20 */  32, 32, 32, 32, 32, 48, 97, 49, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1a30 */  48, 49, 55, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1a40 */  69, 78, 84, 83, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32,
-/* 0x1a50 */  32, 32, 32, 32, 32, 32, 32, 48, 57, 51, 32, 32, 48, 32, 32, 48,
-/* 0x1a60 */  32, 32, 48, 50, 49, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1a70 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 76, 90, 77, 65, 95,
-/* 0x1a80 */  69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 54, 52, 32, 32, 48, 32,
-/* 0x1a90 */  32, 48, 32, 32, 48, 50, 97,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1aa0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 76, 90, 77,
-/* 0x1ab0 */  65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 57,102, 55, 32,
-/* 0x1ac0 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 49, 49, 32, 32, 50, 42, 42,
-/* 0x1ad0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32,
-/* 0x1ae0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 57,
-/* 0x1af0 */ 102, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 48, 56, 32, 32,
-/* 0x1b00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1b10 */  32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x1b20 */  32, 48, 49, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 54,102,
-/* 0x1b30 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1b40 */  83, 10, 32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32,
-/* 0x1b50 */  32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55,
-/* 0x1b60 */  49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1b70 */  84, 83, 10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32,
-/* 0x1b80 */  32, 32, 32, 32, 32, 48, 51, 97, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1b90 */  48, 49, 55, 49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1ba0 */  84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1bb0 */  78, 90, 32, 32, 32, 32, 32, 32, 48, 49, 98, 53, 32, 32, 48, 32,
-/* 0x1bc0 */  32, 48, 32, 32, 48, 49, 55, 53, 49, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1bd0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76,
-/* 0x1be0 */  32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1c00 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86, 95,
-/* 0x1c10 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c20 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1c30 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1c40 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c50 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x1c60 */  76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1c70 */  78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x1c90 */  65, 73, 78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x1ca0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cb0 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1cc0 */  88, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48,
-/* 0x1cd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1ce0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82,
-/* 0x1cf0 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1d10 */  50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1d30 */  32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50,
-/* 0x1d40 */  66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1d60 */  69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1d70 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d80 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x1d90 */  95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1da0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1db0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x1dc0 */  65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1dd0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1de0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1df0 */  86, 95, 84, 65, 73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x1e00 */  76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e10 */  48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65,
-/* 0x1e20 */  73, 78, 88, 32, 48, 32, 95,115,116, 97,114,116, 10, 10, 82, 69,
-/* 0x1e30 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x1e40 */  32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58,
-/* 0x1e50 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e60 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e70 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1e80 */  48, 48, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 88, 56, 54,
-/* 0x1e90 */  95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x1ea0 */  77, 65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1eb0 */  48, 48, 48, 48, 48, 48, 48,100, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x1ec0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x1ed0 */  32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1ee0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1ef0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1f00 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 97,102, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x1f20 */  50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,
-/* 0x1f30 */ 120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x1f40 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f50 */  53, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x1f60 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 43, 48,120,
-/* 0x1f70 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99,
-/* 0x1f80 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x1f90 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93,
-/* 0x1fa0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1fb0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1fc0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 54, 32, 82, 95, 88, 56,
-/* 0x1fe0 */  54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1ff0 */  86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2000 */  48, 48, 48, 48, 48, 48, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 88, 56, 54,
-/* 0x2020 */  95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x2030 */  77, 65, 73, 78, 89, 43, 48,120,102,102,102,102,102,102,102,102,
-/* 0x2040 */ 102,102,102,102,102,102,102, 99, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2050 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2060 */  32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x2070 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2080 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2090 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20a0 */  48, 56, 98, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x20b0 */  50, 32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,
-/* 0x20c0 */ 120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x20d0 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20e0 */  53, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x20f0 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 43, 48,120,
-/* 0x2100 */ 102,102,102,102,102,102,102,102,102,102,102,102,102,102,102, 99,
-/* 0x2110 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2120 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69,
-/* 0x2130 */  76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2140 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2150 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2160 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54,
-/* 0x2170 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32,
-/* 0x2180 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120,
-/* 0x2190 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 50,
-/* 0x21a0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x21b0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73,
-/* 0x21c0 */  78, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x21d0 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x21e0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x21f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 56, 32, 82,
-/* 0x2200 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x2210 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,120,102,102,102,102,
-/* 0x2220 */ 102,102,102,102,102,102,102,102,102,102,102, 99, 10
+/* 0x1900 */ 139, 78,252,243,164,195, 12,  0,  0,  0, 13,  0,  0,  0,  9,  0,
+/* 0x1910 */   0,  0,128,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 25,  0,
+/* 0x1920 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 89,  0,  0,  0,102,  0,
+/* 0x1930 */   0,  0,  0,  0,  0,  0, 18,  0,  0,  0,191,  0,  0,  0,186,  0,
+/* 0x1940 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0,121,  1,  0,  0,161,  0,
+/* 0x1950 */   0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 26,  2,  0,  0,147,  0,
+/* 0x1960 */   0,  0,  0,  0,  0,  0, 36,  0,  0,  0,173,  2,  0,  0,100,  0,
+/* 0x1970 */   0,  0,  0,  0,  0,  0, 47,  0,  0,  0, 17,  3,  0,  0,247,  9,
+/* 0x1980 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  8, 13,  0,  0,247,  9,
+/* 0x1990 */   0,  0,  0,  0,  0,  0, 69,  0,  0,  0,255, 22,  0,  0, 24,  0,
+/* 0x19a0 */   0,  0,  0,  0,  0,  0, 80,  0,  0,  0, 23, 23,  0,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 23, 23,  0,  0, 58,  0,
+/* 0x19c0 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 81, 23,  0,  0,181,  1,
+/* 0x19d0 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x19e0 */   0,  0, 69,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x19f0 */   0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 11,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 24,  0,
+/* 0x1a20 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  4,  0,
+/* 0x1a30 */   0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1a40 */   0,  0, 47,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 58,  0,
+/* 0x1a50 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  9,  0,
+/* 0x1a60 */   0,  0,  0,  0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0, 13,  0,  0,  0,114,  0,  0,  0, 98,  0,
+/* 0x1a80 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,175,  0,
+/* 0x1a90 */   0,  0,114,  0,  0,  0,  9,  0,  0,  0, 33,  0,  0,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  2,  0,  0,  0, 92,  0,  0,  0,114,  0,  0,  0, 89,  0,
+/* 0x1ab0 */   0,  0,252,255,255,255,255,255,255,255,  3,  0,  0,  0,150,  0,
+/* 0x1ac0 */   0,  0,114,  0,  0,  0,  9,  0,  0,  0, 33,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  3,  0,  0,  0, 92,  0,  0,  0,114,  0,  0,  0, 89,  0,
+/* 0x1ae0 */   0,  0,252,255,255,255,255,255,255,255,  4,  0,  0,  0,139,  0,
+/* 0x1af0 */   0,  0,114,  0,  0,  0,  9,  0,  0,  0, 33,  0,  0,  0,  0,  0,
+/* 0x1b00 */   0,  0,  4,  0,  0,  0, 83,  0,  0,  0,114,  0,  0,  0, 89,  0,
+/* 0x1b10 */   0,  0,252,255,255,255,255,255,255,255,  5,  0,  0,  0,  6,  0,
+/* 0x1b20 */   0,  0,114,  0,  0,  0, 69,  0,  0,  0, 18,  0,  0,  0,  0,  0,
+/* 0x1b30 */   0,  0, 10,  0,  0,  0, 24,  0,  0,  0,114,  0,  0,  0, 98,  0,
+/* 0x1b40 */   0,  0,252,255,255,255,255,255,255,255, 69, 76, 70, 77, 65, 73,
+/* 0x1b50 */  78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50,
+/* 0x1b60 */  69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90,
+/* 0x1b70 */  77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1b80 */  67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76,
+/* 0x1b90 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 84, 65,
+/* 0x1ba0 */  73, 76,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77,
+/* 0x1bb0 */  65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0, 82, 95, 88, 56,
+/* 0x1bc0 */  54, 95, 54, 52, 95, 80, 67, 51, 50,  0,  6, 25,  0,  0, 85, 80,
+/* 0x1bd0 */  88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* amd64-win64.pe.h
-   created from amd64-win64.pe.bin, 14679 (0x3957) bytes
+   created from amd64-win64.pe.bin, 7731 (0x1e33) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_AMD64_WIN64_PE_SIZE    14679
-#define STUB_AMD64_WIN64_PE_ADLER32 0x64c27601
-#define STUB_AMD64_WIN64_PE_CRC32   0x16bb9397
+#define STUB_AMD64_WIN64_PE_SIZE    7731
+#define STUB_AMD64_WIN64_PE_ADLER32 0x5a39770e
+#define STUB_AMD64_WIN64_PE_CRC32   0xcff34752
 
-unsigned char stub_amd64_win64_pe[14679] = {
+unsigned char stub_amd64_win64_pe[7731] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 62,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,200, 17,  0,  0,  0,  0,  0,  0,
@@ -281,677 +281,243 @@ unsigned char stub_amd64_win64_pe[14679] = {
 /* 0x0f20 */  72,173, 72,133,192,116, 20, 81, 82, 65, 80, 72,131,236, 40,255,
 /* 0x0f30 */ 208, 72,131,196, 40, 65, 88, 90, 89,235,229, 94,195, 85, 80, 88,
 /* 0x0f40 */  33,161,216,208,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x0f50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,102,105,108,
-/* 0x0f60 */ 101, 32,102,111,114,109, 97,116, 32,101,108,102, 54, 52, 45,120,
-/* 0x0f70 */  56, 54, 45, 54, 52, 10, 10, 83,101, 99,116,105,111,110,115, 58,
-/* 0x0f80 */  10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0f90 */  32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65,
-/* 0x0fa0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x0fb0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0fc0 */  32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32,
-/* 0x0fd0 */  32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 83, 84, 65, 82, 84,
-/* 0x0fe0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x0ff0 */  32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1000 */  84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 80, 69, 73, 83, 68, 76,
-/* 0x1010 */  76, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48,
-/* 0x1020 */  32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1030 */  84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 80, 69, 73, 83, 69, 70,
-/* 0x1040 */  73, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x1050 */  32, 32, 48, 52,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1060 */  84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 80, 69, 73, 83, 68, 76,
-/* 0x1070 */  76, 49, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48,
-/* 0x1080 */  32, 32, 48, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1090 */  84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 80, 69, 77, 65, 73, 78,
-/* 0x10a0 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 49, 50, 32, 32, 48, 32, 32,
-/* 0x10b0 */  48, 32, 32, 48, 53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x10c0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 80, 69, 73, 67, 79,
-/* 0x10d0 */  78, 83, 49, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32,
-/* 0x10e0 */  48, 32, 32, 48, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x10f0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 80, 69, 73, 67, 79,
-/* 0x1100 */  78, 83, 50, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32,
-/* 0x1110 */  48, 32, 32, 48, 55, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1120 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 80, 69, 84, 76, 83,
-/* 0x1130 */  72, 65, 75, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32, 32, 48, 32,
-/* 0x1140 */  32, 48, 32, 32, 48, 55, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1150 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 80, 69, 77, 65,
-/* 0x1160 */  73, 78, 48, 50, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32,
-/* 0x1170 */  32, 48, 32, 32, 48, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1180 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 80, 69, 77, 65,
-/* 0x1190 */  73, 78, 48, 51, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x11a0 */  48, 32, 32, 48, 56,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x11b0 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 78, 82, 86, 95, 72,
-/* 0x11c0 */  69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 54, 48, 32, 32, 48, 32,
-/* 0x11d0 */  32, 48, 32, 32, 48, 56,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x11e0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 78, 82, 86, 50,
-/* 0x11f0 */  66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 56, 51, 32, 32, 48,
-/* 0x1200 */  32, 32, 48, 32, 32, 48,101,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1210 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 78, 82, 86,
-/* 0x1220 */  50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 57, 49, 32, 32,
-/* 0x1230 */  48, 32, 32, 48, 32, 32, 48, 49, 55, 48, 32, 32, 50, 42, 42, 48,
-/* 0x1240 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32, 78,
-/* 0x1250 */  82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 97, 97,
-/* 0x1260 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 48, 49, 32, 32, 50, 42,
-/* 0x1270 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 52,
-/* 0x1280 */  32, 76, 90, 77, 65, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 48,
-/* 0x1290 */  49, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 97, 98, 32, 32,
-/* 0x12a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x12b0 */  49, 53, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32,
-/* 0x12c0 */  32, 48, 53, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 98,102,
-/* 0x12d0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x12e0 */  10, 32, 49, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x12f0 */  32, 32, 32, 48, 97, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1300 */  51, 49, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1310 */  78, 84, 83, 10, 32, 49, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1320 */  51, 48, 32, 32, 32, 32, 48, 49, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1330 */  32, 48,100, 49, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1340 */  84, 69, 78, 84, 83, 10, 32, 49, 56, 32, 76, 90, 77, 65, 95, 84,
-/* 0x1350 */  65, 73, 76, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x1360 */  32, 32, 48,100, 50,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1370 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 57, 32, 80, 69, 77, 65, 73,
-/* 0x1380 */  78, 49, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32,
-/* 0x1390 */  48, 32, 32, 48,100, 51, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x13a0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 48, 32, 80, 69, 84, 76,
-/* 0x13b0 */  83, 72, 65, 75, 50, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32,
-/* 0x13c0 */  32, 48, 32, 32, 48,100, 51, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x13d0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 49, 32, 80, 69, 67,
-/* 0x13e0 */  84, 84, 80, 79, 83, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48,
-/* 0x13f0 */  32, 32, 48, 32, 32, 48,100, 51, 53, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1400 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 50, 32, 80, 69,
-/* 0x1410 */  67, 84, 84, 78, 85, 76, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32,
-/* 0x1420 */  48, 32, 32, 48, 32, 32, 48,100, 51, 99, 32, 32, 50, 42, 42, 48,
-/* 0x1430 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 51, 32, 80,
-/* 0x1440 */  69, 70, 73, 76, 84, 69, 82, 52, 57, 32, 32, 32, 32, 48, 53, 50,
-/* 0x1450 */  32, 32, 48, 32, 32, 48, 32, 32, 48,100, 51,102, 32, 32, 50, 42,
-/* 0x1460 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 52,
-/* 0x1470 */  32, 80, 69, 73, 77, 80, 79, 82, 84, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1480 */  51, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 57, 49, 32, 32,
-/* 0x1490 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x14a0 */  50, 53, 32, 80, 69, 73, 66, 89, 79, 82, 68, 32, 32, 32, 32, 32,
-/* 0x14b0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 99, 53, 32,
-/* 0x14c0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x14d0 */  32, 50, 54, 32, 80, 69, 75, 51, 50, 79, 82, 68, 32, 32, 32, 32,
-/* 0x14e0 */  32, 32, 48, 49, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 99,
-/* 0x14f0 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1500 */  83, 10, 32, 50, 55, 32, 80, 69, 73, 77, 79, 82, 68, 49, 32, 32,
-/* 0x1510 */  32, 32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48,100,
-/* 0x1520 */ 100, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1530 */  84, 83, 10, 32, 50, 56, 32, 80, 69, 73, 77, 80, 79, 82, 50, 32,
-/* 0x1540 */  32, 32, 32, 32, 32, 48, 50, 49, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1550 */  48,100,101, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1560 */  69, 78, 84, 83, 10, 32, 50, 57, 32, 80, 69, 73, 69, 82, 68, 76,
-/* 0x1570 */  76, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1580 */  32, 48,101, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1590 */  84, 69, 78, 84, 83, 10, 32, 51, 48, 32, 80, 69, 73, 69, 82, 69,
-/* 0x15a0 */  88, 69, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48,
-/* 0x15b0 */  32, 32, 48,101, 48,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x15c0 */  78, 84, 69, 78, 84, 83, 10, 32, 51, 49, 32, 80, 69, 73, 77, 68,
-/* 0x15d0 */  79, 78, 69, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32,
-/* 0x15e0 */  48, 32, 32, 48,101, 49, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x15f0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 50, 32, 80, 69, 82, 69,
-/* 0x1600 */  76, 79, 67, 49, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32,
-/* 0x1610 */  32, 48, 32, 32, 48,101, 49, 57, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1620 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 51, 32, 80, 69, 82,
-/* 0x1630 */  69, 76, 79, 67, 50, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48,
-/* 0x1640 */  32, 32, 48, 32, 32, 48,101, 50, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1650 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 52, 32, 80, 69,
-/* 0x1660 */  82, 69, 76, 79, 67, 51, 32, 32, 32, 32, 32, 32, 48, 51, 48, 32,
-/* 0x1670 */  32, 48, 32, 32, 48, 32, 32, 48,101, 50, 52, 32, 32, 50, 42, 42,
-/* 0x1680 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 53, 32,
-/* 0x1690 */  82, 69, 76, 54, 52, 66, 73, 71, 32, 32, 32, 32, 32, 32, 48, 97,
-/* 0x16a0 */  32, 32, 48, 32, 32, 48, 32, 32, 48,101, 53, 52, 32, 32, 50, 42,
-/* 0x16b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 54,
-/* 0x16c0 */  32, 82, 69, 76, 79, 67, 54, 52, 74, 32, 32, 32, 32, 32, 32, 48,
-/* 0x16d0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 53,101, 32, 32, 50,
-/* 0x16e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51,
-/* 0x16f0 */  55, 32, 80, 69, 82, 76, 79, 72, 73, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1700 */  48, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 54, 48, 32, 32,
-/* 0x1710 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1720 */  51, 56, 32, 80, 69, 82, 69, 76, 76, 79, 48, 32, 32, 32, 32, 32,
-/* 0x1730 */  32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 54, 97, 32,
-/* 0x1740 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1750 */  32, 51, 57, 32, 80, 69, 82, 69, 76, 72, 73, 48, 32, 32, 32, 32,
-/* 0x1760 */  32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 55, 53,
-/* 0x1770 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1780 */  10, 32, 52, 48, 32, 80, 69, 68, 69, 80, 72, 65, 75, 32, 32, 32,
-/* 0x1790 */  32, 32, 32, 48, 52, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48,101,
-/* 0x17a0 */  56, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x17b0 */  84, 83, 10, 32, 52, 49, 32, 80, 69, 84, 76, 83, 67, 32, 32, 32,
-/* 0x17c0 */  32, 32, 32, 32, 32, 48, 49, 98, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x17d0 */  48,101, 99,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x17e0 */  69, 78, 84, 83, 10, 32, 52, 50, 32, 80, 69, 77, 65, 73, 78, 50,
-/* 0x17f0 */  48, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1800 */  32, 48,101,101, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1810 */  84, 69, 78, 84, 83, 10, 32, 52, 51, 32, 67, 76, 69, 65, 82, 83,
-/* 0x1820 */  84, 65, 67, 75, 32, 32, 32, 32, 48, 49, 48, 32, 32, 48, 32, 32,
-/* 0x1830 */  48, 32, 32, 48,101,101,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1840 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 52, 32, 80, 69, 77, 65,
-/* 0x1850 */  73, 78, 50, 49, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1860 */  48, 32, 32, 48,101,102,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1870 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 53, 32, 80, 69, 73, 83,
-/* 0x1880 */  68, 76, 76, 57, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32,
-/* 0x1890 */  32, 48, 32, 32, 48,101,102,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x18a0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 54, 32, 80, 69, 73,
-/* 0x18b0 */  83, 69, 70, 73, 57, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x18c0 */  32, 32, 48, 32, 32, 48,102, 48, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x18d0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 55, 32, 80, 69,
-/* 0x18e0 */  82, 69, 84, 85, 82, 78, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32,
-/* 0x18f0 */  48, 32, 32, 48, 32, 32, 48,102, 48,101, 32, 32, 50, 42, 42, 48,
-/* 0x1900 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 56, 32, 80,
-/* 0x1910 */  69, 68, 79, 74, 85, 77, 80, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x1920 */  32, 48, 32, 32, 48, 32, 32, 48,102, 49, 50, 32, 32, 50, 42, 42,
-/* 0x1930 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 57, 32,
-/* 0x1940 */  80, 69, 84, 76, 83, 67, 50, 32, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x1950 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48,102, 49, 55, 32, 32, 50,
-/* 0x1960 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x1970 */  48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32,
-/* 0x1980 */  48, 50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,102, 51,100, 32,
-/* 0x1990 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x19a0 */  83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48,
-/* 0x19b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x19c0 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32,
-/* 0x19d0 */  48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x19f0 */  32, 32, 32, 32, 80, 69, 73, 77, 68, 79, 78, 69, 32, 48, 32,105,
-/* 0x1a00 */ 109,112,111,114,116,115, 95,100,111,110,101, 10, 48, 48, 48, 48,
-/* 0x1a10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 98, 32,108, 32, 32,
-/* 0x1a20 */  32, 32, 32, 32, 32, 80, 69, 73, 77, 80, 79, 82, 84, 32, 48, 32,
-/* 0x1a30 */ 110,101,120,116, 95,102,117,110, 99, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1a40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 97, 32,108, 32, 32, 32, 32,
-/* 0x1a50 */  32, 32, 32, 80, 69, 73, 77, 79, 82, 68, 49, 32, 48, 32, 98,121,
-/* 0x1a60 */ 110, 97,109,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 49, 56, 32,108, 32, 32, 32, 32, 32, 32, 32, 80, 69,
-/* 0x1a80 */  73, 77, 80, 79, 82, 50, 32, 48, 32,110,101,120,116, 95,105,109,
-/* 0x1a90 */ 112, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1aa0 */  48, 97, 32,108, 32, 32, 32, 32, 32, 32, 32, 80, 69, 73, 77, 80,
-/* 0x1ab0 */  79, 82, 50, 32, 48, 32,102,105,114,115,116, 95,105,109,112, 10,
-/* 0x1ac0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x1ad0 */  32,108, 32, 32, 32, 32, 32, 32, 32, 82, 69, 76, 79, 67, 54, 52,
-/* 0x1ae0 */  74, 32, 48, 32,114,101,108,111, 99, 95,101,110,100,120, 10, 48,
-/* 0x1af0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 51, 32,
-/* 0x1b00 */ 108, 32, 32, 32, 32, 32, 32, 32, 80, 69, 82, 69, 76, 79, 67, 51,
-/* 0x1b10 */  32, 48, 32,114,101,108,111, 99, 95, 97,100,100, 10, 48, 48, 48,
-/* 0x1b20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1b30 */  32, 32, 32,100, 32, 32, 80, 69, 84, 76, 83, 67, 50, 32, 48, 32,
-/* 0x1b40 */  80, 69, 84, 76, 83, 67, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b50 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1b60 */  32, 80, 69, 77, 65, 73, 78, 50, 49, 32, 48, 32, 80, 69, 77, 65,
-/* 0x1b70 */  73, 78, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 83, 84,
-/* 0x1b90 */  65, 82, 84, 32, 48, 32, 83, 84, 65, 82, 84, 10, 48, 48, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1bb0 */  32, 32,100, 32, 32, 80, 69, 73, 83, 68, 76, 76, 48, 32, 48, 32,
-/* 0x1bc0 */  80, 69, 73, 83, 68, 76, 76, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bd0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1be0 */  32, 32, 80, 69, 73, 83, 69, 70, 73, 48, 32, 48, 32, 80, 69, 73,
-/* 0x1bf0 */  83, 69, 70, 73, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c00 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80,
-/* 0x1c10 */  69, 73, 83, 68, 76, 76, 49, 32, 48, 32, 80, 69, 73, 83, 68, 76,
-/* 0x1c20 */  76, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c30 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 77, 65,
-/* 0x1c40 */  73, 78, 48, 49, 32, 48, 32, 80, 69, 77, 65, 73, 78, 48, 49, 10,
-/* 0x1c50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c60 */  32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 67, 79, 78, 83,
-/* 0x1c70 */  49, 32, 48, 32, 80, 69, 73, 67, 79, 78, 83, 49, 10, 48, 48, 48,
-/* 0x1c80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1c90 */  32, 32, 32,100, 32, 32, 80, 69, 73, 67, 79, 78, 83, 50, 32, 48,
-/* 0x1ca0 */  32, 80, 69, 73, 67, 79, 78, 83, 50, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1cc0 */ 100, 32, 32, 80, 69, 84, 76, 83, 72, 65, 75, 32, 48, 32, 80, 69,
-/* 0x1cd0 */  84, 76, 83, 72, 65, 75, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1cf0 */  80, 69, 77, 65, 73, 78, 48, 50, 32, 48, 32, 80, 69, 77, 65, 73,
-/* 0x1d00 */  78, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d10 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 77,
-/* 0x1d20 */  65, 73, 78, 48, 51, 32, 48, 32, 80, 69, 77, 65, 73, 78, 48, 51,
-/* 0x1d30 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d40 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66, 32,
-/* 0x1d50 */  48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d60 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1d70 */  32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1d90 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32,
-/* 0x1da0 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1db0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1dc0 */  90, 77, 65, 95, 72, 69, 65, 68, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1dd0 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1de0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1df0 */  77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1e00 */  69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e10 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1e20 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65,
-/* 0x1e30 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e40 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1e50 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77,
-/* 0x1e60 */  65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e70 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1e80 */  32, 76, 90, 77, 65, 95, 84, 65, 73, 76, 32, 48, 32, 76, 90, 77,
-/* 0x1e90 */  65, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ea0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1eb0 */  80, 69, 77, 65, 73, 78, 49, 48, 32, 48, 32, 80, 69, 77, 65, 73,
-/* 0x1ec0 */  78, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 84,
-/* 0x1ee0 */  76, 83, 72, 65, 75, 50, 32, 48, 32, 80, 69, 84, 76, 83, 72, 65,
-/* 0x1ef0 */  75, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 67, 84,
-/* 0x1f10 */  84, 80, 79, 83, 32, 48, 32, 80, 69, 67, 84, 84, 80, 79, 83, 10,
-/* 0x1f20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f30 */  32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 67, 84, 84, 78, 85,
-/* 0x1f40 */  76, 32, 48, 32, 80, 69, 67, 84, 84, 78, 85, 76, 10, 48, 48, 48,
-/* 0x1f50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1f60 */  32, 32, 32,100, 32, 32, 80, 69, 70, 73, 76, 84, 69, 82, 52, 57,
-/* 0x1f70 */  32, 48, 32, 80, 69, 70, 73, 76, 84, 69, 82, 52, 57, 10, 48, 48,
-/* 0x1f80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1f90 */  32, 32, 32, 32,100, 32, 32, 80, 69, 73, 77, 80, 79, 82, 84, 32,
-/* 0x1fa0 */  48, 32, 80, 69, 73, 77, 80, 79, 82, 84, 10, 48, 48, 48, 48, 48,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1fc0 */  32,100, 32, 32, 80, 69, 73, 66, 89, 79, 82, 68, 32, 48, 32, 80,
-/* 0x1fd0 */  69, 73, 66, 89, 79, 82, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1ff0 */  32, 80, 69, 75, 51, 50, 79, 82, 68, 32, 48, 32, 80, 69, 75, 51,
-/* 0x2000 */  50, 79, 82, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x2020 */  73, 77, 79, 82, 68, 49, 32, 48, 32, 80, 69, 73, 77, 79, 82, 68,
-/* 0x2030 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2040 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 77, 80,
-/* 0x2050 */  79, 82, 50, 32, 48, 32, 80, 69, 73, 77, 80, 79, 82, 50, 10, 48,
-/* 0x2060 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2070 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 69, 82, 68, 76, 76,
-/* 0x2080 */  32, 48, 32, 80, 69, 73, 69, 82, 68, 76, 76, 10, 48, 48, 48, 48,
-/* 0x2090 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x20a0 */  32, 32,100, 32, 32, 80, 69, 73, 69, 82, 69, 88, 69, 32, 48, 32,
-/* 0x20b0 */  80, 69, 73, 69, 82, 69, 88, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x20d0 */  32, 32, 80, 69, 73, 77, 68, 79, 78, 69, 32, 48, 32, 80, 69, 73,
-/* 0x20e0 */  77, 68, 79, 78, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20f0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80,
-/* 0x2100 */  69, 82, 69, 76, 79, 67, 49, 32, 48, 32, 80, 69, 82, 69, 76, 79,
-/* 0x2110 */  67, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2120 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69,
-/* 0x2130 */  76, 79, 67, 50, 32, 48, 32, 80, 69, 82, 69, 76, 79, 67, 50, 10,
-/* 0x2140 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2150 */  32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69, 76, 79, 67,
-/* 0x2160 */  51, 32, 48, 32, 80, 69, 82, 69, 76, 79, 67, 51, 10, 48, 48, 48,
-/* 0x2170 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2180 */  32, 32, 32,100, 32, 32, 82, 69, 76, 54, 52, 66, 73, 71, 32, 48,
-/* 0x2190 */  32, 82, 69, 76, 54, 52, 66, 73, 71, 10, 48, 48, 48, 48, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x21b0 */ 100, 32, 32, 82, 69, 76, 79, 67, 54, 52, 74, 32, 48, 32, 82, 69,
-/* 0x21c0 */  76, 79, 67, 54, 52, 74, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x21e0 */  80, 69, 82, 76, 79, 72, 73, 48, 32, 48, 32, 80, 69, 82, 76, 79,
-/* 0x21f0 */  72, 73, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82,
-/* 0x2210 */  69, 76, 76, 79, 48, 32, 48, 32, 80, 69, 82, 69, 76, 76, 79, 48,
-/* 0x2220 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2230 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69, 76, 72,
-/* 0x2240 */  73, 48, 32, 48, 32, 80, 69, 82, 69, 76, 72, 73, 48, 10, 48, 48,
-/* 0x2250 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2260 */  32, 32, 32, 32,100, 32, 32, 80, 69, 68, 69, 80, 72, 65, 75, 32,
-/* 0x2270 */  48, 32, 80, 69, 68, 69, 80, 72, 65, 75, 10, 48, 48, 48, 48, 48,
-/* 0x2280 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2290 */  32,100, 32, 32, 80, 69, 84, 76, 83, 67, 32, 48, 32, 80, 69, 84,
-/* 0x22a0 */  76, 83, 67, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22b0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 77,
-/* 0x22c0 */  65, 73, 78, 50, 48, 32, 48, 32, 80, 69, 77, 65, 73, 78, 50, 48,
-/* 0x22d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22e0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 69, 65, 82, 83,
-/* 0x22f0 */  84, 65, 67, 75, 32, 48, 32, 67, 76, 69, 65, 82, 83, 84, 65, 67,
-/* 0x2300 */  75, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 83, 68,
-/* 0x2320 */  76, 76, 57, 32, 48, 32, 80, 69, 73, 83, 68, 76, 76, 57, 10, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2340 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 83, 69, 70, 73, 57,
-/* 0x2350 */  32, 48, 32, 80, 69, 73, 83, 69, 70, 73, 57, 10, 48, 48, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2370 */  32, 32,100, 32, 32, 80, 69, 82, 69, 84, 85, 82, 78, 32, 48, 32,
-/* 0x2380 */  80, 69, 82, 69, 84, 85, 82, 78, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2390 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x23a0 */  32, 32, 80, 69, 68, 79, 74, 85, 77, 80, 32, 48, 32, 80, 69, 68,
-/* 0x23b0 */  79, 74, 85, 77, 80, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23c0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85,
-/* 0x23d0 */  80, 88, 49, 72, 69, 65, 68, 32, 48, 32, 85, 80, 88, 49, 72, 69,
-/* 0x23e0 */  65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23f0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x2400 */  42, 32, 48, 32,115,116, 97,114,116, 95,111,102, 95, 99,111,109,
-/* 0x2410 */ 112,114,101,115,115,101,100, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2420 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2430 */  32, 42, 85, 78, 68, 42, 32, 48, 32,115,116, 97,114,116, 95,111,
-/* 0x2440 */ 102, 95,117,110, 99,111,109,112,114,101,115,115,101,100, 10, 48,
-/* 0x2450 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2460 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x2470 */ 105, 99,111,110, 95,111,102,102,115,101,116, 10, 48, 48, 48, 48,
-/* 0x2480 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x2490 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,105, 99,111,
-/* 0x24a0 */ 110, 95,100,101,108,116, 97, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x24c0 */  32, 42, 85, 78, 68, 42, 32, 48, 32,116,108,115, 95, 97,100,100,
-/* 0x24d0 */ 114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24e0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x24f0 */  78, 68, 42, 32, 48, 32,116,108,115, 95,118, 97,108,117,101, 10,
-/* 0x2500 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2510 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x2520 */  32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x2530 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x2540 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109,
-/* 0x2550 */  97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2560 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2570 */  32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,114, 95,
-/* 0x2580 */  98,117,102,102,101,114, 95,115,116, 97,114,116, 10, 48, 48, 48,
-/* 0x2590 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x25a0 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,
-/* 0x25b0 */ 108,116,101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x25c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x25d0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,108,
-/* 0x25e0 */ 116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2600 */  32, 42, 85, 78, 68, 42, 32, 48, 32, 99,111,109,112,114,101,115,
-/* 0x2610 */ 115,101,100, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48,
-/* 0x2620 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x2630 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,115,116, 97,
-/* 0x2640 */ 114,116, 95,111,102, 95,105,109,112,111,114,116,115, 10, 48, 48,
-/* 0x2650 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2660 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 76,
-/* 0x2670 */ 111, 97,100, 76,105, 98,114, 97,114,121, 65, 10, 48, 48, 48, 48,
-/* 0x2680 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x2690 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,107,101,114,
-/* 0x26a0 */ 110,101,108, 51, 50, 95,111,114,100,105,110, 97,108,115, 10, 48,
-/* 0x26b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x26c0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x26d0 */  71,101,116, 80,114,111, 99, 65,100,100,114,101,115,115, 10, 48,
-/* 0x26e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x26f0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x2700 */  69,120,105,116, 80,114,111, 99,101,115,115, 10, 48, 48, 48, 48,
-/* 0x2710 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x2720 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,115,116, 97,
-/* 0x2730 */ 114,116, 95,111,102, 95,114,101,108,111, 99,115, 10, 48, 48, 48,
-/* 0x2740 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x2750 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,114,101,
-/* 0x2760 */ 108,111, 99, 95,100,101,108,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2770 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2780 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 86,105,114,116,117, 97,
-/* 0x2790 */ 108, 80,114,111,116,101, 99,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27b0 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,118,112, 95, 98, 97,115,
-/* 0x27c0 */ 101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27d0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x27e0 */  32, 48, 32,118,112, 95,115,105,122,101, 10, 48, 48, 48, 48, 48,
-/* 0x27f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x2800 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,115,119,114,105,
-/* 0x2810 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2820 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x2830 */  48, 32,116,108,115, 95,109,111,100,117,108,101, 95, 98, 97,115,
-/* 0x2840 */ 101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2850 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x2860 */  32, 48, 32,111,114,105,103,105,110, 97,108, 95,101,110,116,114,
-/* 0x2870 */ 121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2880 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x2890 */  32, 48, 32,116,108,115, 95, 99, 97,108,108, 98, 97, 99,107,115,
-/* 0x28a0 */  95,112,116,114, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x28b0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69,
-/* 0x28c0 */  73, 83, 68, 76, 76, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x28d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x28e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x28f0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2900 */  48, 53, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x2910 */  32, 32, 32, 32, 32, 80, 69, 77, 65, 73, 78, 50, 49, 45, 48,120,
-/* 0x2920 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x2930 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2940 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 77, 65, 73, 78,
-/* 0x2950 */  48, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x2960 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2970 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2980 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82,
-/* 0x2990 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x29a0 */  32,115,116, 97,114,116, 95,111,102, 95, 99,111,109,112,114,101,
-/* 0x29b0 */ 115,115,101,100, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29c0 */  48, 48, 48, 48, 48, 48, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29d0 */  48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x29e0 */  52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,115,116, 97,114,116,
-/* 0x29f0 */  95,111,102, 95,117,110, 99,111,109,112,114,101,115,115,101,100,
-/* 0x2a00 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2a10 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 67, 79, 78,
-/* 0x2a20 */  83, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x2a30 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2a40 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2a50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x2a60 */  95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32, 32, 32,
-/* 0x2a70 */  32,105, 99,111,110, 95,111,102,102,115,101,116, 10, 10, 82, 69,
-/* 0x2a80 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2a90 */  32, 70, 79, 82, 32, 91, 80, 69, 73, 67, 79, 78, 83, 50, 93, 58,
-/* 0x2aa0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ab0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ac0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2ad0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 88, 56, 54,
-/* 0x2ae0 */  95, 54, 52, 95, 51, 50, 83, 32, 32, 32, 32, 32, 32,105, 99,111,
-/* 0x2af0 */ 110, 95,111,102,102,115,101,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b00 */  48, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 88, 56, 54, 95,
-/* 0x2b10 */  54, 52, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32,105, 99,111,110,
-/* 0x2b20 */  95,100,101,108,116, 97, 43, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b30 */  48, 48, 48, 48, 48, 56, 48, 48, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2b40 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2b50 */  82, 32, 91, 80, 69, 84, 76, 83, 72, 65, 75, 93, 58, 10, 79, 70,
-/* 0x2b60 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x2b70 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b80 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b90 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x2ba0 */  95, 51, 50, 83, 32, 32, 32, 32, 32, 32,116,108,115, 95, 97,100,
-/* 0x2bb0 */ 100,114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2bc0 */  48, 48, 48, 48, 48, 98, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x2bd0 */  51, 50, 32, 32, 32, 32, 32, 32, 32,116,108,115, 95,118, 97,108,
-/* 0x2be0 */ 117,101, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 56, 48, 48,
-/* 0x2bf0 */  48, 48, 48, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2c00 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x2c10 */  82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2c20 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2c30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2c40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55,100,
-/* 0x2c50 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32,
-/* 0x2c60 */  32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120, 48, 48,
-/* 0x2c70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 98, 10, 10,
-/* 0x2c80 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2c90 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10,
-/* 0x2ca0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2cb0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2cc0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2cd0 */  48, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95, 88, 56, 54, 95,
-/* 0x2ce0 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 78, 82, 86, 95,
-/* 0x2cf0 */  72, 69, 65, 68, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d00 */  48, 48, 48, 48, 48, 49, 98, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x2d10 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x2d20 */  91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x2d30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x2d40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x2d50 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2d60 */  97, 49, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x2d70 */  32, 32, 32, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 43, 48,120,
-/* 0x2d80 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 98,
-/* 0x2d90 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2da0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 72,
-/* 0x2db0 */  69, 65, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x2dc0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2dd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2de0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x2df0 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x2e00 */  32, 32,108,122,109, 97, 95,117, 95,108,101,110, 43, 48,120, 48,
-/* 0x2e10 */  48, 48, 48, 48, 48, 48, 48, 56, 48, 48, 48, 48, 48, 48, 48, 10,
-/* 0x2e20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 48,
-/* 0x2e30 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32, 32, 32,
-/* 0x2e40 */  32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 43, 48,120,
-/* 0x2e50 */  48, 48, 48, 48, 48, 48, 48, 48, 56, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2e60 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2e70 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 67, 84, 84, 80,
-/* 0x2e80 */  79, 83, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x2e90 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2eb0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x2ec0 */  95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32, 32, 32,
-/* 0x2ed0 */  32,102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,
-/* 0x2ee0 */ 116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2ef0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69,
-/* 0x2f00 */  70, 73, 76, 84, 69, 82, 52, 57, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2f10 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2f20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x2f30 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f40 */  48, 48, 48, 55, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50,
-/* 0x2f50 */  83, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,
-/* 0x2f60 */ 110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f70 */  48, 48, 48, 48, 99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 56,
-/* 0x2f80 */  32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,
-/* 0x2f90 */ 116,111, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x2fa0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 77,
-/* 0x2fb0 */  80, 79, 82, 84, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2fc0 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2fd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2fe0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55,
-/* 0x2ff0 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32,
-/* 0x3000 */  32, 32, 32, 99,111,109,112,114,101,115,115,101,100, 95,105,109,
-/* 0x3010 */ 112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3020 */  48, 48, 48, 48, 49, 48, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x3030 */  80, 67, 56, 32, 32, 32, 32, 32, 32,105,109,112,111,114,116,115,
-/* 0x3040 */  95,100,111,110,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3050 */  48, 48, 48, 48, 49, 56, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x3060 */  51, 50, 83, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,
-/* 0x3070 */ 102, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3080 */  48, 48, 48, 48, 48, 48, 48, 48, 50, 53, 32, 82, 95, 88, 56, 54,
-/* 0x3090 */  95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 76,111, 97,
-/* 0x30a0 */ 100, 76,105, 98,114, 97,114,121, 65, 45, 48,120, 48, 48, 48, 48,
-/* 0x30b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 10, 10, 82, 69,
-/* 0x30c0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x30d0 */  32, 70, 79, 82, 32, 91, 80, 69, 73, 66, 89, 79, 82, 68, 93, 58,
-/* 0x30e0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x30f0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3100 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3110 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 88, 56, 54,
-/* 0x3120 */  95, 54, 52, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 98,121,110,
-/* 0x3130 */  97,109,101, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x3140 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 75,
-/* 0x3150 */  51, 50, 79, 82, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3160 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x3170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x3180 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3190 */  99, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32,
-/* 0x31a0 */  32, 32, 32, 32,107,101,114,110,101,108, 51, 50, 95,111,114,100,
-/* 0x31b0 */ 105,110, 97,108,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31c0 */  48, 48, 48, 48, 49, 49, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x31d0 */  80, 67, 56, 32, 32, 32, 32, 32, 32,110,101,120,116, 95,105,109,
-/* 0x31e0 */ 112, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x31f0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 77, 79,
-/* 0x3200 */  82, 68, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x3210 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x3220 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x3230 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 32,
-/* 0x3240 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x3250 */  32, 32,102,105,114,115,116, 95,105,109,112, 10, 10, 82, 69, 76,
-/* 0x3260 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x3270 */  70, 79, 82, 32, 91, 80, 69, 73, 77, 80, 79, 82, 50, 93, 58, 10,
-/* 0x3280 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3290 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x32a0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32b0 */  48, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 88, 56, 54, 95,
-/* 0x32c0 */  54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 71,101,116, 80,
-/* 0x32d0 */ 114,111, 99, 65,100,100,114,101,115,115, 45, 48,120, 48, 48, 48,
-/* 0x32e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 10, 48, 48,
-/* 0x32f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 48, 32, 82,
-/* 0x3300 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x3310 */  32,110,101,120,116, 95,102,117,110, 99, 10, 10, 82, 69, 76, 79,
-/* 0x3320 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x3330 */  79, 82, 32, 91, 80, 69, 73, 69, 82, 69, 88, 69, 93, 58, 10, 79,
-/* 0x3340 */  70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3350 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3360 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3370 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 88, 56, 54, 95, 54,
-/* 0x3380 */  52, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 69,120,105,116, 80,
-/* 0x3390 */ 114,111, 99,101,115,115, 45, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33a0 */  48, 48, 48, 48, 48, 48, 48, 48, 52, 10, 10, 82, 69, 76, 79, 67,
-/* 0x33b0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x33c0 */  82, 32, 91, 80, 69, 82, 69, 76, 79, 67, 49, 93, 58, 10, 79, 70,
-/* 0x33d0 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x33e0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x33f0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3400 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x3410 */  95, 51, 50, 83, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,
-/* 0x3420 */ 111,102, 95,114,101,108,111, 99,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x3430 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x3440 */  82, 32, 91, 80, 69, 82, 69, 76, 79, 67, 51, 93, 58, 10, 79, 70,
-/* 0x3450 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x3460 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3470 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3480 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 88, 56, 54, 95, 54, 52,
-/* 0x3490 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32,114,101,108,111, 99, 95,
-/* 0x34a0 */ 101,110,100,120, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x34b0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 82, 69,
-/* 0x34c0 */  76, 54, 52, 66, 73, 71, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x34d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x34e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x34f0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3500 */  48, 51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 56, 32,
-/* 0x3510 */  32, 32, 32, 32, 32,114,101,108,111, 99, 95, 97,100,100, 10, 10,
-/* 0x3520 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x3530 */  68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67, 54, 52, 74,
-/* 0x3540 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3550 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3560 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x3570 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 88,
-/* 0x3580 */  56, 54, 95, 54, 52, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,114,
-/* 0x3590 */ 101,108,111, 99, 95, 97,100,100, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x35a0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x35b0 */  32, 91, 80, 69, 82, 76, 79, 72, 73, 48, 93, 58, 10, 79, 70, 70,
-/* 0x35c0 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x35d0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x35e0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x35f0 */  48, 48, 48, 48, 48, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x3600 */  51, 50, 83, 32, 32, 32, 32, 32, 32,114,101,108,111, 99, 95,100,
-/* 0x3610 */ 101,108,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x3620 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 68,
-/* 0x3630 */  69, 80, 72, 65, 75, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3640 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x3650 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x3660 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3670 */  51, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32,
-/* 0x3680 */  32, 32, 32, 32, 86,105,114,116,117, 97,108, 80,114,111,116,101,
-/* 0x3690 */  99,116, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36a0 */  48, 48, 48, 48, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36b0 */  48, 48, 48, 48, 48, 97, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95,
-/* 0x36c0 */  51, 50, 83, 32, 32, 32, 32, 32, 32,118,112, 95, 98, 97,115,101,
-/* 0x36d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36e0 */ 102, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 32, 32, 32,
-/* 0x36f0 */  32, 32, 32, 32,118,112, 95,115,105,122,101, 43, 48,120, 48, 48,
-/* 0x3700 */  48, 48, 48, 48, 48, 48, 56, 48, 48, 48, 48, 48, 48, 48, 10, 48,
-/* 0x3710 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 99, 32,
-/* 0x3720 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32, 32,
-/* 0x3730 */  32, 32,115,119,114,105, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x3740 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x3750 */  80, 69, 84, 76, 83, 67, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x3760 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x3770 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x3780 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3790 */  48, 50, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50,
-/* 0x37a0 */  32, 32, 32, 32, 32, 80, 69, 84, 76, 83, 67, 50, 45, 48,120, 48,
-/* 0x37b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 10,
-/* 0x37c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 97,
-/* 0x37d0 */  32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50, 83, 32, 32, 32,
-/* 0x37e0 */  32, 32, 32,116,108,115, 95,109,111,100,117,108,101, 95, 98, 97,
-/* 0x37f0 */ 115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3800 */  48, 49, 54, 32, 82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51,
-/* 0x3810 */  50, 32, 32, 32, 32, 32, 80, 69, 84, 76, 83, 67, 50, 45, 48,120,
-/* 0x3820 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x3830 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3840 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 68, 79, 74, 85,
-/* 0x3850 */  77, 80, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x3860 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x3870 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x3880 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x3890 */  95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x38a0 */  32,111,114,105,103,105,110, 97,108, 95,101,110,116,114,121, 45,
-/* 0x38b0 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38c0 */  48, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x38d0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 84, 76,
-/* 0x38e0 */  83, 67, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x38f0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x3900 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x3910 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x3920 */  82, 95, 88, 56, 54, 95, 54, 52, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x3930 */  32, 32,116,108,115, 95, 99, 97,108,108, 98, 97, 99,107,115, 95,
-/* 0x3940 */ 112,116,114, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3950 */  48, 48, 48, 48, 48, 52, 10
+/* 0x0f50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45, 51,  0,  0,
+/* 0x0f60 */   0, 84,  0,  0,  0, 41,  0,  0,  0,194,  3,  0,  0,  0,  0,  0,
+/* 0x0f70 */   0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,
+/* 0x0f80 */   0, 64,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,
+/* 0x0f90 */   0, 79,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,
+/* 0x0fa0 */   0, 81,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,
+/* 0x0fb0 */   0, 90,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,
+/* 0x0fc0 */   0,108,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,
+/* 0x0fd0 */   0,115,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,
+/* 0x0fe0 */   0,124,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,
+/* 0x0ff0 */   0,140,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,
+/* 0x1000 */   0,141,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 87,  0,  0,
+/* 0x1010 */   0,141,  0,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,
+/* 0x1020 */   0,237,  0,  0,  0,131,  0,  0,  0,  0,  0,  0,  0,102,  0,  0,
+/* 0x1030 */   0,112,  1,  0,  0,145,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,
+/* 0x1040 */   0,  1,  2,  0,  0,170,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,
+/* 0x1050 */   0,171,  2,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,124,  0,  0,
+/* 0x1060 */   0,191,  2,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,
+/* 0x1070 */   0, 25,  3,  0,  0,  1, 10,  0,  0,  0,  0,  0,  0,146,  0,  0,
+/* 0x1080 */   0, 26, 13,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,157,  0,  0,
+/* 0x1090 */   0, 46, 13,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,
+/* 0x10a0 */   0, 48, 13,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,176,  0,  0,
+/* 0x10b0 */   0, 49, 13,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,186,  0,  0,
+/* 0x10c0 */   0, 53, 13,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,195,  0,  0,
+/* 0x10d0 */   0, 60, 13,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,204,  0,  0,
+/* 0x10e0 */   0, 63, 13,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,215,  0,  0,
+/* 0x10f0 */   0,145, 13,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,224,  0,  0,
+/* 0x1100 */   0,197, 13,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,233,  0,  0,
+/* 0x1110 */   0,199, 13,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,242,  0,  0,
+/* 0x1120 */   0,217, 13,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,251,  0,  0,
+/* 0x1130 */   0,227, 13,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  4,  1,  0,
+/* 0x1140 */   0,  4, 14,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 13,  1,  0,
+/* 0x1150 */   0, 15, 14,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 22,  1,  0,
+/* 0x1160 */   0, 21, 14,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 31,  1,  0,
+/* 0x1170 */   0, 25, 14,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 40,  1,  0,
+/* 0x1180 */   0, 32, 14,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 49,  1,  0,
+/* 0x1190 */   0, 36, 14,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0, 58,  1,  0,
+/* 0x11a0 */   0, 84, 14,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 67,  1,  0,
+/* 0x11b0 */   0, 94, 14,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 76,  1,  0,
+/* 0x11c0 */   0, 96, 14,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 85,  1,  0,
+/* 0x11d0 */   0,106, 14,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 94,  1,  0,
+/* 0x11e0 */   0,117, 14,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,103,  1,  0,
+/* 0x11f0 */   0,131, 14,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,112,  1,  0,
+/* 0x1200 */   0,206, 14,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,119,  1,  0,
+/* 0x1210 */   0,233, 14,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,128,  1,  0,
+/* 0x1220 */   0,237, 14,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,139,  1,  0,
+/* 0x1230 */   0,253, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,148,  1,  0,
+/* 0x1240 */   0,253, 14,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,157,  1,  0,
+/* 0x1250 */   0, 12, 15,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,166,  1,  0,
+/* 0x1260 */   0, 14, 15,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,175,  1,  0,
+/* 0x1270 */   0, 18, 15,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,184,  1,  0,
+/* 0x1280 */   0, 23, 15,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,192,  1,  0,
+/* 0x1290 */   0, 61, 15,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 87,  0,  0,
+/* 0x12a0 */   0, 10,  0,  0,  0,  0,  0,  0,  0,201,  1,  0,  0, 31,  0,  0,
+/* 0x12b0 */   0,  0,  0,  0,  0,214,  1,  0,  0, 24,  0,  0,  0, 43,  0,  0,
+/* 0x12c0 */   0,224,  1,  0,  0, 27,  0,  0,  0, 10,  0,  0,  0,231,  1,  0,
+/* 0x12d0 */   0, 28,  0,  0,  0, 24,  0,  0,  0,240,  1,  0,  0, 28,  0,  0,
+/* 0x12e0 */   0, 10,  0,  0,  0,250,  1,  0,  0, 36,  0,  0,  0,  2,  0,  0,
+/* 0x12f0 */   0,  5,  2,  0,  0, 34,  0,  0,  0, 19,  0,  0,  0,184,  1,  0,
+/* 0x1300 */   0, 49,  0,  0,  0,  0,  0,  0,  0,139,  1,  0,  0, 44,  0,  0,
+/* 0x1310 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1320 */   0,  6,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,
+/* 0x1330 */   0,  2,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,
+/* 0x1340 */   0,  0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x1350 */   0, 42,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,
+/* 0x1360 */   0,  6,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  7,  0,  0,
+/* 0x1370 */   0,  0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,
+/* 0x1380 */   0, 78,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,
+/* 0x1390 */   0, 11,  0,  0,  0,  0,  0,  0,  0,102,  0,  0,  0, 12,  0,  0,
+/* 0x13a0 */   0,  0,  0,  0,  0,108,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x13b0 */   0,114,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,124,  0,  0,
+/* 0x13c0 */   0, 15,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0, 16,  0,  0,
+/* 0x13d0 */   0,  0,  0,  0,  0,146,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,
+/* 0x13e0 */   0,157,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,
+/* 0x13f0 */   0, 19,  0,  0,  0,  0,  0,  0,  0,176,  0,  0,  0, 20,  0,  0,
+/* 0x1400 */   0,  0,  0,  0,  0,186,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,
+/* 0x1410 */   0,195,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,204,  0,  0,
+/* 0x1420 */   0, 23,  0,  0,  0,  0,  0,  0,  0,215,  0,  0,  0, 24,  0,  0,
+/* 0x1430 */   0,  0,  0,  0,  0,224,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1440 */   0,233,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,242,  0,  0,
+/* 0x1450 */   0, 27,  0,  0,  0,  0,  0,  0,  0,251,  0,  0,  0, 28,  0,  0,
+/* 0x1460 */   0,  0,  0,  0,  0,  4,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,
+/* 0x1470 */   0, 13,  1,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0, 22,  1,  0,
+/* 0x1480 */   0, 31,  0,  0,  0,  0,  0,  0,  0, 31,  1,  0,  0, 32,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  0, 40,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,
+/* 0x14a0 */   0, 49,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0, 58,  1,  0,
+/* 0x14b0 */   0, 35,  0,  0,  0,  0,  0,  0,  0, 67,  1,  0,  0, 36,  0,  0,
+/* 0x14c0 */   0,  0,  0,  0,  0, 76,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,
+/* 0x14d0 */   0, 85,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0, 94,  1,  0,
+/* 0x14e0 */   0, 39,  0,  0,  0,  0,  0,  0,  0,103,  1,  0,  0, 40,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0,  0,112,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,
+/* 0x1500 */   0,119,  1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,128,  1,  0,
+/* 0x1510 */   0, 43,  0,  0,  0,  0,  0,  0,  0,148,  1,  0,  0, 45,  0,  0,
+/* 0x1520 */   0,  0,  0,  0,  0,157,  1,  0,  0, 46,  0,  0,  0,  0,  0,  0,
+/* 0x1530 */   0,166,  1,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,175,  1,  0,
+/* 0x1540 */   0, 48,  0,  0,  0,  0,  0,  0,  0,192,  1,  0,  0, 50,  0,  0,
+/* 0x1550 */   0,  0,  0,  0,  0, 15,  2,  0,  0, 52,  0,  0,  0,173,222,173,
+/* 0x1560 */ 222, 35,  2,  0,  0, 52,  0,  0,  0,173,222,173,222, 57,  2,  0,
+/* 0x1570 */   0, 52,  0,  0,  0,173,222,173,222, 69,  2,  0,  0, 52,  0,  0,
+/* 0x1580 */   0,173,222,173,222, 80,  2,  0,  0, 52,  0,  0,  0,173,222,173,
+/* 0x1590 */ 222, 92,  2,  0,  0, 52,  0,  0,  0,173,222,173,222,102,  2,  0,
+/* 0x15a0 */   0, 52,  0,  0,  0,173,222,173,222,113,  2,  0,  0, 52,  0,  0,
+/* 0x15b0 */   0,173,222,173,222,124,  2,  0,  0, 52,  0,  0,  0,173,222,173,
+/* 0x15c0 */ 222,144,  2,  0,  0, 52,  0,  0,  0,173,222,173,222,158,  2,  0,
+/* 0x15d0 */   0, 52,  0,  0,  0,173,222,173,222,169,  2,  0,  0, 52,  0,  0,
+/* 0x15e0 */   0,173,222,173,222,188,  2,  0,  0, 52,  0,  0,  0,173,222,173,
+/* 0x15f0 */ 222,205,  2,  0,  0, 52,  0,  0,  0,173,222,173,222,218,  2,  0,
+/* 0x1600 */   0, 52,  0,  0,  0,173,222,173,222,236,  2,  0,  0, 52,  0,  0,
+/* 0x1610 */   0,173,222,173,222,251,  2,  0,  0, 52,  0,  0,  0,173,222,173,
+/* 0x1620 */ 222,  7,  3,  0,  0, 52,  0,  0,  0,173,222,173,222, 23,  3,  0,
+/* 0x1630 */   0, 52,  0,  0,  0,173,222,173,222, 34,  3,  0,  0, 52,  0,  0,
+/* 0x1640 */   0,173,222,173,222, 49,  3,  0,  0, 52,  0,  0,  0,173,222,173,
+/* 0x1650 */ 222, 57,  3,  0,  0, 52,  0,  0,  0,173,222,173,222, 65,  3,  0,
+/* 0x1660 */   0, 52,  0,  0,  0,173,222,173,222, 70,  3,  0,  0, 52,  0,  0,
+/* 0x1670 */   0,173,222,173,222, 86,  3,  0,  0, 52,  0,  0,  0,173,222,173,
+/* 0x1680 */ 222,101,  3,  0,  0, 52,  0,  0,  0,173,222,173,222,  3,  0,  0,
+/* 0x1690 */   0,  5,  0,  0,  0,119,  3,  0,  0,139,  1,  0,  0,252,255,255,
+/* 0x16a0 */ 255,255,255,255,255,  4,  0,  0,  0,  7,  0,  0,  0,119,  3,  0,
+/* 0x16b0 */   0, 15,  2,  0,  0,252,255,255,255,255,255,255,255,  4,  0,  0,
+/* 0x16c0 */   0, 14,  0,  0,  0,133,  3,  0,  0, 35,  2,  0,  0,  0,  0,  0,
+/* 0x16d0 */   0,  0,  0,  0,  0,  5,  0,  0,  0,  3,  0,  0,  0,133,  3,  0,
+/* 0x16e0 */   0, 57,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,
+/* 0x16f0 */   0,  3,  0,  0,  0,133,  3,  0,  0, 57,  2,  0,  0,  0,  0,  0,
+/* 0x1700 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  7,  0,  0,  0,146,  3,  0,
+/* 0x1710 */   0, 69,  2,  0,  0,  0,128,  0,  0,  0,  0,  0,  0,  7,  0,  0,
+/* 0x1720 */   0,  3,  0,  0,  0,133,  3,  0,  0, 80,  2,  0,  0,  0,  0,  0,
+/* 0x1730 */   0,  0,  0,  0,  0,  7,  0,  0,  0, 11,  0,  0,  0,158,  3,  0,
+/* 0x1740 */   0, 92,  2,  0,  0,  0,  0,  0,128,  0,  0,  0,  0, 11,  0,  0,
+/* 0x1750 */   0,125,  0,  0,  0,119,  3,  0,  0, 87,  0,  0,  0, 27,  0,  0,
+/* 0x1760 */   0,  0,  0,  0,  0, 12,  0,  0,  0,136,  0,  0,  0,119,  3,  0,
+/* 0x1770 */   0, 87,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,
+/* 0x1780 */   0,161,  0,  0,  0,119,  3,  0,  0, 87,  0,  0,  0, 27,  0,  0,
+/* 0x1790 */   0,  0,  0,  0,  0, 14,  0,  0,  0,  1,  0,  0,  0,158,  3,  0,
+/* 0x17a0 */   0,102,  2,  0,  0,  0,  0,  0,128,  0,  0,  0,  0, 14,  0,  0,
+/* 0x17b0 */   0, 16,  0,  0,  0,158,  3,  0,  0,113,  2,  0,  0,  0,  0,  0,
+/* 0x17c0 */ 128,  0,  0,  0,  0, 21,  0,  0,  0,  3,  0,  0,  0,133,  3,  0,
+/* 0x17d0 */   0,124,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,
+/* 0x17e0 */   0,  7,  0,  0,  0,133,  3,  0,  0,144,  2,  0,  0,  0,  0,  0,
+/* 0x17f0 */   0,  0,  0,  0,  0, 23,  0,  0,  0, 12,  0,  0,  0,170,  3,  0,
+/* 0x1800 */   0,158,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,
+/* 0x1810 */   0,  7,  0,  0,  0,133,  3,  0,  0,169,  2,  0,  0,  0,  0,  0,
+/* 0x1820 */   0,  0,  0,  0,  0, 24,  0,  0,  0, 16,  0,  0,  0,181,  3,  0,
+/* 0x1830 */   0,201,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,
+/* 0x1840 */   0, 24,  0,  0,  0,133,  3,  0,  0,188,  2,  0,  0,  0,  0,  0,
+/* 0x1850 */   0,  0,  0,  0,  0, 24,  0,  0,  0, 37,  0,  0,  0,119,  3,  0,
+/* 0x1860 */   0,205,  2,  0,  0,252,255,255,255,255,255,255,255, 25,  0,  0,
+/* 0x1870 */   0,  1,  0,  0,  0,181,  3,  0,  0,224,  1,  0,  0,  0,  0,  0,
+/* 0x1880 */   0,  0,  0,  0,  0, 26,  0,  0,  0, 12,  0,  0,  0,133,  3,  0,
+/* 0x1890 */   0,218,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,
+/* 0x18a0 */   0, 17,  0,  0,  0,181,  3,  0,  0,231,  1,  0,  0,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0,  0, 27,  0,  0,  0,  9,  0,  0,  0,181,  3,  0,
+/* 0x18c0 */   0,240,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,
+/* 0x18d0 */   0, 15,  0,  0,  0,119,  3,  0,  0,236,  2,  0,  0,252,255,255,
+/* 0x18e0 */ 255,255,255,255,255, 28,  0,  0,  0, 32,  0,  0,  0,181,  3,  0,
+/* 0x18f0 */   0,214,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,
+/* 0x1900 */   0,  2,  0,  0,  0,119,  3,  0,  0,251,  2,  0,  0,252,255,255,
+/* 0x1910 */ 255,255,255,255,255, 32,  0,  0,  0,  3,  0,  0,  0,133,  3,  0,
+/* 0x1920 */   0,  7,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  0,  0,
+/* 0x1930 */   0, 14,  0,  0,  0,181,  3,  0,  0,250,  1,  0,  0,  0,  0,  0,
+/* 0x1940 */   0,  0,  0,  0,  0, 35,  0,  0,  0,  3,  0,  0,  0,181,  3,  0,
+/* 0x1950 */   0,  5,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,
+/* 0x1960 */   0,  1,  0,  0,  0,181,  3,  0,  0,  5,  2,  0,  0,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,  0, 37,  0,  0,  0,  6,  0,  0,  0,133,  3,  0,
+/* 0x1980 */   0, 23,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,
+/* 0x1990 */   0,  3,  0,  0,  0,119,  3,  0,  0, 34,  3,  0,  0,252,255,255,
+/* 0x19a0 */ 255,255,255,255,255, 40,  0,  0,  0, 10,  0,  0,  0,133,  3,  0,
+/* 0x19b0 */   0, 49,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,
+/* 0x19c0 */   0, 15,  0,  0,  0,158,  3,  0,  0, 57,  3,  0,  0,  0,  0,  0,
+/* 0x19d0 */ 128,  0,  0,  0,  0, 40,  0,  0,  0, 44,  0,  0,  0,133,  3,  0,
+/* 0x19e0 */   0, 65,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,
+/* 0x19f0 */   0,  2,  0,  0,  0,119,  3,  0,  0,184,  1,  0,  0,251,255,255,
+/* 0x1a00 */ 255,255,255,255,255, 41,  0,  0,  0, 10,  0,  0,  0,133,  3,  0,
+/* 0x1a10 */   0, 70,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,
+/* 0x1a20 */   0, 22,  0,  0,  0,119,  3,  0,  0,184,  1,  0,  0,252,255,255,
+/* 0x1a30 */ 255,255,255,255,255, 48,  0,  0,  0,  1,  0,  0,  0,119,  3,  0,
+/* 0x1a40 */   0, 86,  3,  0,  0,252,255,255,255,255,255,255,255, 49,  0,  0,
+/* 0x1a50 */   0,  5,  0,  0,  0,119,  3,  0,  0,101,  3,  0,  0,252,255,255,
+/* 0x1a60 */ 255,255,255,255,255, 83, 84, 65, 82, 84,  0, 80, 69, 73, 83, 68,
+/* 0x1a70 */  76, 76, 48,  0, 80, 69, 73, 83, 69, 70, 73, 48,  0, 80, 69, 73,
+/* 0x1a80 */  83, 68, 76, 76, 49,  0, 80, 69, 77, 65, 73, 78, 48, 49,  0, 80,
+/* 0x1a90 */  69, 73, 67, 79, 78, 83, 49,  0, 80, 69, 73, 67, 79, 78, 83, 50,
+/* 0x1aa0 */   0, 80, 69, 84, 76, 83, 72, 65, 75,  0, 80, 69, 77, 65, 73, 78,
+/* 0x1ab0 */  48, 50,  0, 80, 69, 77, 65, 73, 78, 48, 51,  0, 78, 82, 86, 95,
+/* 0x1ac0 */  72, 69, 65, 68,  0, 78, 82, 86, 50, 66,  0, 78, 82, 86, 50, 68,
+/* 0x1ad0 */   0, 78, 82, 86, 50, 69,  0, 76, 90, 77, 65, 95, 72, 69, 65, 68,
+/* 0x1ae0 */   0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65,
+/* 0x1af0 */  95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51,
+/* 0x1b00 */  48,  0, 76, 90, 77, 65, 95, 84, 65, 73, 76,  0, 80, 69, 77, 65,
+/* 0x1b10 */  73, 78, 49, 48,  0, 80, 69, 84, 76, 83, 72, 65, 75, 50,  0, 80,
+/* 0x1b20 */  69, 67, 84, 84, 80, 79, 83,  0, 80, 69, 67, 84, 84, 78, 85, 76,
+/* 0x1b30 */   0, 80, 69, 70, 73, 76, 84, 69, 82, 52, 57,  0, 80, 69, 73, 77,
+/* 0x1b40 */  80, 79, 82, 84,  0, 80, 69, 73, 66, 89, 79, 82, 68,  0, 80, 69,
+/* 0x1b50 */  75, 51, 50, 79, 82, 68,  0, 80, 69, 73, 77, 79, 82, 68, 49,  0,
+/* 0x1b60 */  80, 69, 73, 77, 80, 79, 82, 50,  0, 80, 69, 73, 69, 82, 68, 76,
+/* 0x1b70 */  76,  0, 80, 69, 73, 69, 82, 69, 88, 69,  0, 80, 69, 73, 77, 68,
+/* 0x1b80 */  79, 78, 69,  0, 80, 69, 82, 69, 76, 79, 67, 49,  0, 80, 69, 82,
+/* 0x1b90 */  69, 76, 79, 67, 50,  0, 80, 69, 82, 69, 76, 79, 67, 51,  0, 82,
+/* 0x1ba0 */  69, 76, 54, 52, 66, 73, 71,  0, 82, 69, 76, 79, 67, 54, 52, 74,
+/* 0x1bb0 */   0, 80, 69, 82, 76, 79, 72, 73, 48,  0, 80, 69, 82, 69, 76, 76,
+/* 0x1bc0 */  79, 48,  0, 80, 69, 82, 69, 76, 72, 73, 48,  0, 80, 69, 68, 69,
+/* 0x1bd0 */  80, 72, 65, 75,  0, 80, 69, 84, 76, 83, 67,  0, 80, 69, 77, 65,
+/* 0x1be0 */  73, 78, 50, 48,  0, 67, 76, 69, 65, 82, 83, 84, 65, 67, 75,  0,
+/* 0x1bf0 */  80, 69, 77, 65, 73, 78, 50, 49,  0, 80, 69, 73, 83, 68, 76, 76,
+/* 0x1c00 */  57,  0, 80, 69, 73, 83, 69, 70, 73, 57,  0, 80, 69, 82, 69, 84,
+/* 0x1c10 */  85, 82, 78,  0, 80, 69, 68, 79, 74, 85, 77, 80,  0, 80, 69, 84,
+/* 0x1c20 */  76, 83, 67, 50,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0,105,109,
+/* 0x1c30 */ 112,111,114,116,115, 95,100,111,110,101,  0,110,101,120,116, 95,
+/* 0x1c40 */ 102,117,110, 99,  0, 98,121,110, 97,109,101,  0,110,101,120,116,
+/* 0x1c50 */  95,105,109,112,  0,102,105,114,115,116, 95,105,109,112,  0,114,
+/* 0x1c60 */ 101,108,111, 99, 95,101,110,100,120,  0,114,101,108,111, 99, 95,
+/* 0x1c70 */  97,100,100,  0,115,116, 97,114,116, 95,111,102, 95, 99,111,109,
+/* 0x1c80 */ 112,114,101,115,115,101,100,  0,115,116, 97,114,116, 95,111,102,
+/* 0x1c90 */  95,117,110, 99,111,109,112,114,101,115,115,101,100,  0,105, 99,
+/* 0x1ca0 */ 111,110, 95,111,102,102,115,101,116,  0,105, 99,111,110, 95,100,
+/* 0x1cb0 */ 101,108,116, 97,  0,116,108,115, 95, 97,100,100,114,101,115,115,
+/* 0x1cc0 */   0,116,108,115, 95,118, 97,108,117,101,  0,108,122,109, 97, 95,
+/* 0x1cd0 */ 117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,110,
+/* 0x1ce0 */   0,102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,
+/* 0x1cf0 */ 116, 97,114,116,  0,102,105,108,116,101,114, 95,108,101,110,103,
+/* 0x1d00 */ 116,104,  0,102,105,108,116,101,114, 95, 99,116,111,  0, 99,111,
+/* 0x1d10 */ 109,112,114,101,115,115,101,100, 95,105,109,112,111,114,116,115,
+/* 0x1d20 */   0,115,116, 97,114,116, 95,111,102, 95,105,109,112,111,114,116,
+/* 0x1d30 */ 115,  0, 76,111, 97,100, 76,105, 98,114, 97,114,121, 65,  0,107,
+/* 0x1d40 */ 101,114,110,101,108, 51, 50, 95,111,114,100,105,110, 97,108,115,
+/* 0x1d50 */   0, 71,101,116, 80,114,111, 99, 65,100,100,114,101,115,115,  0,
+/* 0x1d60 */  69,120,105,116, 80,114,111, 99,101,115,115,  0,115,116, 97,114,
+/* 0x1d70 */ 116, 95,111,102, 95,114,101,108,111, 99,115,  0,114,101,108,111,
+/* 0x1d80 */  99, 95,100,101,108,116,  0, 86,105,114,116,117, 97,108, 80,114,
+/* 0x1d90 */ 111,116,101, 99,116,  0,118,112, 95, 98, 97,115,101,  0,118,112,
+/* 0x1da0 */  95,115,105,122,101,  0,115,119,114,105,  0,116,108,115, 95,109,
+/* 0x1db0 */ 111,100,117,108,101, 95, 98, 97,115,101,  0,111,114,105,103,105,
+/* 0x1dc0 */ 110, 97,108, 95,101,110,116,114,121,  0,116,108,115, 95, 99, 97,
+/* 0x1dd0 */ 108,108, 98, 97, 99,107,115, 95,112,116,114,  0, 82, 95, 88, 56,
+/* 0x1de0 */  54, 95, 54, 52, 95, 80, 67, 51, 50,  0, 82, 95, 88, 56, 54, 95,
+/* 0x1df0 */  54, 52, 95, 51, 50, 83,  0, 82, 95, 88, 56, 54, 95, 54, 52, 95,
+/* 0x1e00 */  49, 54,  0, 82, 95, 88, 56, 54, 95, 54, 52, 95, 51, 50,  0, 82,
+/* 0x1e10 */  95, 88, 56, 54, 95, 54, 52, 95, 56,  0, 82, 95, 88, 56, 54, 95,
+/* 0x1e20 */  54, 52, 95, 80, 67, 56,  0, 93, 15,  0,  0, 85, 80, 88, 76, 78,
+/* 0x1e30 */  75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v4a-linux.elf-entry.h
-   created from arm.v4a-linux.elf-entry.bin, 13889 (0x3641) bytes
+   created from arm.v4a-linux.elf-entry.bin, 10134 (0x2796) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V4A_LINUX_ELF_ENTRY_SIZE    13889
-#define STUB_ARM_V4A_LINUX_ELF_ENTRY_ADLER32 0xbf074a11
-#define STUB_ARM_V4A_LINUX_ELF_ENTRY_CRC32   0xd676f477
+#define STUB_ARM_V4A_LINUX_ELF_ENTRY_SIZE    10134
+#define STUB_ARM_V4A_LINUX_ELF_ENTRY_ADLER32 0x15b60948
+#define STUB_ARM_V4A_LINUX_ELF_ENTRY_CRC32   0x23adfc22
 
-unsigned char stub_arm_v4a_linux_elf_entry[13889] = {
+unsigned char stub_arm_v4a_linux_elf_entry[10134] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  84, 19,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -334,575 +334,340 @@ unsigned char stub_arm_v4a_linux_elf_entry[13889] = {
 /* 0x1270 */  16,  0, 30,229, 16, 96, 78,226, 16,224,141,229,  0, 96, 70,224,
 /* 0x1280 */   0, 96,141,229,  0,144,160,225, 72,  0, 79,226,  0, 16,160,227,
 /* 0x1290 */   5,  0,144,239,  0,  0, 80,227, 37,  0,  0,186,  4,  0,141,229,
-/* 0x12a0 */  12, 48, 30,229,254,255,255,235,  0,  0,  0,  0,102,105,108,101,
-/* 0x12b0 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,108,105,
-/* 0x12c0 */ 116,116,108,101, 97,114,109, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x12d0 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x12e0 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x12f0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1300 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1310 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70,
-/* 0x1320 */  77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48,
-/* 0x1330 */  32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1340 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86,
-/* 0x1350 */  95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1360 */  32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1370 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 78, 82, 86, 95,
-/* 0x1380 */  84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1390 */  48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x13a0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78, 82, 86, 50, 69,
-/* 0x13b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 50, 99, 32, 32, 48,
-/* 0x13c0 */  32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x13d0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78, 82, 86,
-/* 0x13e0 */  50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 49, 56, 32,
-/* 0x13f0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 54, 99, 32, 32, 50, 42, 42,
-/* 0x1400 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32,
-/* 0x1410 */  78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,100,
-/* 0x1420 */  99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 52, 32, 32, 50,
-/* 0x1430 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x1440 */  54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32,
-/* 0x1450 */  48, 97, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 54, 48, 32,
-/* 0x1460 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1470 */  32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32,
-/* 0x1480 */  32, 32, 48, 57, 51, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,
-/* 0x1490 */  48, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x14a0 */  84, 83, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x14b0 */  48, 32, 32, 32, 32, 48, 52, 55, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x14c0 */  32, 48,100, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x14d0 */  84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68,
-/* 0x14e0 */  69, 67, 51, 48, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32,
-/* 0x14f0 */  32, 48, 49, 49, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1500 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 69, 76, 70, 77, 65,
-/* 0x1510 */  73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1520 */  32, 32, 48, 49, 49, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1530 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 69, 76, 70, 77,
-/* 0x1540 */  65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48,102, 48, 32, 32, 48,
-/* 0x1550 */  32, 32, 48, 32, 32, 48, 49, 49, 98, 99, 32, 32, 50, 42, 42, 50,
-/* 0x1560 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79,
-/* 0x1570 */  76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1580 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32,
-/* 0x1590 */  48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x15a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48,
-/* 0x15b0 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x15c0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32,
-/* 0x15d0 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x15e0 */  32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x15f0 */  48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48,
-/* 0x1600 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1610 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77,
-/* 0x1620 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1630 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1640 */  67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1650 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1660 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 69, 76, 70,
-/* 0x1670 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1680 */  32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32,
-/* 0x1690 */  48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48,
-/* 0x16a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95,
-/* 0x16b0 */  72, 69, 65, 68, 32, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10,
-/* 0x16c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x16d0 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 48, 32, 78, 82, 86, 95,
-/* 0x16e0 */  84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x16f0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x1700 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x1710 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x1720 */  76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1730 */  78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x1740 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 77, 70, 76, 71,
-/* 0x1750 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32,103, 32, 32, 32, 32, 32,
-/* 0x1760 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 95,115,116,
-/* 0x1770 */  97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x1780 */  32, 32, 32, 70, 32, 78, 82, 86, 50, 69, 32, 48, 49, 50, 99, 32,
-/* 0x1790 */ 117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,
-/* 0x17a0 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x17b0 */ 103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 68, 32, 48, 49,
-/* 0x17c0 */  49, 56, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,
-/* 0x17d0 */ 111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x17e0 */  48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 66,
-/* 0x17f0 */  32, 48,100, 99, 32,117, 99,108, 95,110,114,118, 50, 98, 95,100,
-/* 0x1800 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x1810 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x1820 */  65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,122,109, 97, 68,101,
-/* 0x1830 */  99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x1840 */  32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 48,
-/* 0x1850 */  32,101,110,100, 95,100,101, 99,111,109,112,114,101,115,115, 10,
-/* 0x1860 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1870 */  32, 42, 85, 78, 68, 42, 32, 48, 32, 79, 95, 66, 73, 78, 70, 79,
-/* 0x1880 */  10, 48, 48, 48, 48, 48, 48,102, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1890 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 99,112,114,
-/* 0x18a0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x18b0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65,
-/* 0x18c0 */  73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x18d0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x18e0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x18f0 */  82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32,
-/* 0x1900 */  32, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32,
-/* 0x1910 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1920 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79,
-/* 0x1930 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x1940 */  79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83,
-/* 0x1950 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1960 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x1970 */  48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1980 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1990 */  48, 48, 48, 48, 53, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x19a0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x19b0 */  48, 48, 48, 48, 48, 54, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x19c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x19d0 */  48, 48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x19e0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x19f0 */  10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1a00 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1a10 */  69, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77,
-/* 0x1a20 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1a30 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82, 95, 65, 82,
-/* 0x1a40 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1a50 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65,
-/* 0x1a60 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1a70 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95,
-/* 0x1a80 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a90 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82,
-/* 0x1aa0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ab0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32,
-/* 0x1ac0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1ad0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 98, 56,
-/* 0x1ae0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1af0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 99,
-/* 0x1b00 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1b10 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1b20 */  99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1b30 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1b40 */  48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1b50 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1b60 */  48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1b70 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1b80 */  48, 48, 48,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1b90 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1ba0 */  48, 48, 48, 48,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1bb0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1bc0 */  48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1bd0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1be0 */  48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1bf0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1c00 */  10, 48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1c10 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1c20 */  69, 10, 48, 48, 48, 48, 48, 49, 50, 52, 32, 82, 95, 65, 82, 77,
-/* 0x1c30 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1c40 */  50, 69, 10, 48, 48, 48, 48, 48, 49, 50, 56, 32, 82, 95, 65, 82,
-/* 0x1c50 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1c60 */  86, 50, 69, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x1c70 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x1c80 */  50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x1c90 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ca0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82,
-/* 0x1cb0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1cc0 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 53, 99, 32,
-/* 0x1cd0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1ce0 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 54, 48,
-/* 0x1cf0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1d00 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 54,
-/* 0x1d10 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1d20 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1d30 */  55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1d40 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1d50 */  48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1d60 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1d70 */  48, 48, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1d80 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1d90 */  48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1da0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x1db0 */  48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1dc0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1de0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1e00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x1e10 */  10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1e20 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1e30 */  68, 10, 48, 48, 48, 48, 48, 48, 99, 56, 32, 82, 95, 65, 82, 77,
-/* 0x1e40 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1e50 */  50, 68, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95, 65, 82,
-/* 0x1e60 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1e70 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82, 95, 65,
-/* 0x1e80 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1e90 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 56, 32, 82, 95,
-/* 0x1ea0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1eb0 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82,
-/* 0x1ec0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ed0 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 49, 48, 32,
-/* 0x1ee0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1ef0 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 49, 52,
-/* 0x1f00 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1f10 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x1f20 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x1f30 */  32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1f40 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f50 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1f60 */  48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1f70 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x1f80 */  48, 48, 54, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1f90 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x1fa0 */  48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1fb0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1fd0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1ff0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x2000 */  48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2010 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2020 */  10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2030 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2040 */  66, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2050 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2060 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82,
-/* 0x2070 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2080 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 52, 32, 82, 95, 65,
-/* 0x2090 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x20a0 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95,
-/* 0x20b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20c0 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82,
-/* 0x20d0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20e0 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32,
-/* 0x20f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2100 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,100, 52,
-/* 0x2110 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2120 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,100,
-/* 0x2130 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2140 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2150 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2160 */  82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10,
-/* 0x2170 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2180 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2190 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x21a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x21b0 */  95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 52, 99, 32,
-/* 0x21c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x21d0 */  32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48,
-/* 0x21e0 */  48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x21f0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2200 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82,
-/* 0x2210 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2220 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2230 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2240 */  32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 93, 58, 10, 79,
-/* 0x2250 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2260 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x2270 */  48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2280 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2290 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82,
-/* 0x22a0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22b0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x22c0 */  48, 48, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x22d0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x22e0 */  48, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x22f0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2300 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,102, 52,
-/* 0x2310 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2320 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2330 */  48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2340 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2350 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65,
-/* 0x2360 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2370 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x2380 */  52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2390 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x23a0 */  48, 48, 48, 48, 48, 49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x23b0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x23c0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82,
-/* 0x23d0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23e0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x23f0 */  48, 49,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2400 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2410 */  48, 10, 48, 48, 48, 48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2420 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2430 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56,
-/* 0x2440 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2450 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2460 */  48, 48, 48, 50, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2470 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2480 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65,
-/* 0x2490 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x24a0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x24b0 */  51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x24c0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x24d0 */  48, 48, 48, 48, 48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x24e0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x24f0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82,
-/* 0x2500 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2510 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2520 */  48, 50, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2530 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2540 */  48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2550 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2560 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56,
-/* 0x2570 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2580 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2590 */  48, 48, 48, 50,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x25a0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x25b0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65,
-/* 0x25c0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x25d0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x25e0 */  48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x25f0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2600 */  48, 48, 48, 48, 48, 51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2610 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2620 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82,
-/* 0x2630 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2640 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2650 */  48, 51, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2660 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2670 */  48, 10, 48, 48, 48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2680 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2690 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99,
-/* 0x26a0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x26b0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x26c0 */  48, 48, 48, 51,101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x26d0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x26e0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65,
-/* 0x26f0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2700 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x2710 */  50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2720 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2730 */  48, 48, 48, 48, 48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2740 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2750 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82,
-/* 0x2760 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2770 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2780 */  48, 52, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2790 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x27a0 */  48, 10, 48, 48, 48, 48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77,
-/* 0x27b0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x27c0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48,
-/* 0x27d0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x27e0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x27f0 */  48, 48, 48, 52,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2800 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2810 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65,
-/* 0x2820 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2830 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x2840 */ 102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2850 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2860 */  48, 48, 48, 48, 48, 53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2870 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2880 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82,
-/* 0x2890 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x28a0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x28b0 */  48, 53, 57, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x28c0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x28d0 */  48, 10, 48, 48, 48, 48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77,
-/* 0x28e0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x28f0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48,
-/* 0x2900 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2910 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2920 */  48, 48, 48, 53,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2930 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2940 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65,
-/* 0x2950 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2960 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x2970 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2980 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2990 */  48, 48, 48, 48, 48, 54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x29a0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x29b0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82,
-/* 0x29c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x29d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x29e0 */  48, 54, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x29f0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2a00 */  48, 10, 48, 48, 48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2a10 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2a20 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,100, 48,
-/* 0x2a30 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2a40 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2a50 */  48, 48, 48, 54,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2a60 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2a70 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65,
-/* 0x2a80 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2a90 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x2aa0 */  50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2ab0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2ac0 */  48, 48, 48, 48, 48, 55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2ad0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2ae0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82,
-/* 0x2af0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b00 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2b10 */  48, 55, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2b20 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2b30 */  48, 10, 48, 48, 48, 48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2b40 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2b50 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52,
-/* 0x2b60 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2b70 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2b80 */  48, 48, 48, 55,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2b90 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2ba0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65,
-/* 0x2bb0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2bc0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x2bd0 */  50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2be0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2bf0 */  48, 48, 48, 48, 48, 56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2c00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2c10 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82,
-/* 0x2c20 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c30 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2c40 */  48, 56, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2c50 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2c60 */  48, 10, 48, 48, 48, 48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2c70 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2c80 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,101, 56,
-/* 0x2c90 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2ca0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2cb0 */  48, 48, 48, 56,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2cc0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2cd0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65,
-/* 0x2ce0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2cf0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57,
-/* 0x2d00 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2d10 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2d20 */  48, 48, 48, 48, 48, 57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2d30 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2d40 */  68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2d50 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x2d60 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2d70 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d80 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2d90 */  48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2da0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2db0 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82,
-/* 0x2dc0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2dd0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56,
-/* 0x2de0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2df0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x2e00 */  48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2e10 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2e20 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95,
-/* 0x2e30 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2e40 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2e50 */  48,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2e60 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x2e70 */  10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2e80 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2e90 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32,
-/* 0x2ea0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2eb0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x2ec0 */  48, 48, 49, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2ed0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2ee0 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 49, 56, 32, 82, 95, 65, 82,
-/* 0x2ef0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2f00 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50,
-/* 0x2f10 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2f20 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x2f30 */  48, 48, 48, 48, 49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2f40 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2f50 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95,
-/* 0x2f60 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2f70 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2f80 */  49, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2f90 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x2fa0 */  10, 48, 48, 48, 48, 48, 49, 53, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2fb0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2fc0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 48, 32,
-/* 0x2fd0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2fe0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x2ff0 */  48, 48, 49, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3000 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3010 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 99, 32, 82, 95, 65, 82,
-/* 0x3020 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3030 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 57,
-/* 0x3040 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3050 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3060 */  48, 48, 48, 48, 49, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3070 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3080 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 48, 32, 82, 95,
-/* 0x3090 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x30a0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x30b0 */  49, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x30c0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x30d0 */  10, 48, 48, 48, 48, 48, 49,100, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x30e0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x30f0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,100, 99, 32,
-/* 0x3100 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3110 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3120 */  48, 48, 49,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3130 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3140 */  49, 48, 10, 48, 48, 48, 48, 48, 49,101, 99, 32, 82, 95, 65, 82,
-/* 0x3150 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3160 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50,
-/* 0x3170 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3180 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3190 */  48, 48, 48, 48, 50, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x31a0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x31b0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 52, 32, 82, 95,
-/* 0x31c0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x31d0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x31e0 */  50, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x31f0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3200 */  10, 48, 48, 48, 48, 48, 50, 53, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3210 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3220 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 54, 56, 32,
-/* 0x3230 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3240 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3250 */  48, 48, 50, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3260 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3270 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 56, 99, 32, 82, 95, 65, 82,
-/* 0x3280 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3290 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 97,
-/* 0x32a0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x32b0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x32c0 */  48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x32d0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x32e0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100, 48, 32, 82, 95,
-/* 0x32f0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3300 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3310 */  50,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3320 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3330 */  10, 48, 48, 48, 48, 48, 50,102, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3340 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3350 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32,
-/* 0x3360 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3370 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3380 */  48, 48, 51, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3390 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x33a0 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 50, 99, 32, 82, 95, 65, 82,
-/* 0x33b0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x33c0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53,
-/* 0x33d0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x33e0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x33f0 */  48, 48, 48, 48, 51, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3400 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3410 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 48, 32, 82, 95,
-/* 0x3420 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3430 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3440 */  51, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3450 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3460 */  10, 48, 48, 48, 48, 48, 51, 57, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3470 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3480 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 48, 32,
-/* 0x3490 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x34a0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x34b0 */  48, 48, 51, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x34c0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x34d0 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 56, 32, 82, 95, 65, 82,
-/* 0x34e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x34f0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99,
-/* 0x3500 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3510 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3520 */  48, 48, 48, 48, 52, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3530 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3540 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 49, 56, 32, 82, 95,
-/* 0x3550 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3560 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3570 */  52, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3580 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3590 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x35a0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73,
-/* 0x35b0 */  78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x35c0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x35d0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82,
-/* 0x35e0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x35f0 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3600 */ 101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3610 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x3620 */  48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83,
-/* 0x3630 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79,
-/* 0x3640 */  10
+/* 0x12a0 */  12, 48, 30,229,254,255,255,235,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x12b0 */  21,  0,  0,  0,193,  0,  0,  0,250,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12c0 */  52,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x12d0 */  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x12e0 */  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x12f0 */  64,  0,  0,  0, 44,  1,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1300 */ 108,  1,  0,  0, 24,  1,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1310 */ 132,  2,  0,  0,220,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1320 */  96,  3,  0,  0,172,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1330 */  12,  4,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1340 */  68, 13,  0,  0,120,  4,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,
+/* 0x1350 */ 188, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x1360 */ 188, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x1370 */ 188, 17,  0,  0,240,  0,  0,  0,  2,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1380 */   3,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1390 */   0,  0,  0,  0, 39,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13a0 */  45,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x13b0 */   7,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  8,  0,  0,  0,
+/* 0x13c0 */   0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x13e0 */   1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x13f0 */   0,  0,  0,  0, 78,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1400 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0,
+/* 0x1410 */  13,  0,  0,  0,173,222,173,222,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1420 */   4,  0,  0,  0,119,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1430 */ 142,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,
+/* 0x1440 */   5,  0,  0,  0,  0,  0,  0,  0,188,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1450 */   0,  0,  0,  0,199,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1460 */ 214,  0,  0,  0, 13,  0,  0,  0,173,222,173,222,222,  0,  0,  0,
+/* 0x1470 */  11,  0,  0,  0,240,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1480 */ 227,  0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0, 98,  0,  0,  0,
+/* 0x14a0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 16,  0,  0,  0,
+/* 0x14b0 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14c0 */   3,  0,  0,  0, 92,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x14d0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 96,  0,  0,  0,
+/* 0x14e0 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */   3,  0,  0,  0,104,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1500 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,116,  0,  0,  0,
+/* 0x1510 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   3,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1530 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,140,  0,  0,  0,
+/* 0x1540 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1550 */   3,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1560 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,156,  0,  0,  0,
+/* 0x1570 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */   3,  0,  0,  0,172,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1590 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,180,  0,  0,  0,
+/* 0x15a0 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */   3,  0,  0,  0,184,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,192,  0,  0,  0,
+/* 0x15d0 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */   3,  0,  0,  0,196,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,208,  0,  0,  0,
+/* 0x1600 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */   3,  0,  0,  0,212,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1620 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,220,  0,  0,  0,
+/* 0x1630 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */   3,  0,  0,  0,232,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1650 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,236,  0,  0,  0,
+/* 0x1660 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   3,  0,  0,  0,244,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1680 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,252,  0,  0,  0,
+/* 0x1690 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */   3,  0,  0,  0, 36,  1,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x16b0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 40,  1,  0,  0,
+/* 0x16c0 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16d0 */   4,  0,  0,  0, 16,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x16e0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 92,  0,  0,  0,
+/* 0x16f0 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1700 */   4,  0,  0,  0, 96,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1710 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,104,  0,  0,  0,
+/* 0x1720 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1730 */   4,  0,  0,  0,116,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1740 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,128,  0,  0,  0,
+/* 0x1750 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1760 */   4,  0,  0,  0,140,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1770 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,144,  0,  0,  0,
+/* 0x1780 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1790 */   4,  0,  0,  0,156,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x17a0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,172,  0,  0,  0,
+/* 0x17b0 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */   4,  0,  0,  0,180,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x17d0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,188,  0,  0,  0,
+/* 0x17e0 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17f0 */   4,  0,  0,  0,200,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1800 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,208,  0,  0,  0,
+/* 0x1810 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1820 */   4,  0,  0,  0,220,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1830 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,232,  0,  0,  0,
+/* 0x1840 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1850 */   4,  0,  0,  0,236,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1860 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 16,  1,  0,  0,
+/* 0x1870 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1880 */   4,  0,  0,  0, 20,  1,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1890 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0, 16,  0,  0,  0,
+/* 0x18a0 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18b0 */   5,  0,  0,  0, 96,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,104,  0,  0,  0,
+/* 0x18d0 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18e0 */   5,  0,  0,  0,108,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x18f0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,124,  0,  0,  0,
+/* 0x1900 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */   5,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1920 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,132,  0,  0,  0,
+/* 0x1930 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */   5,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1950 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,160,  0,  0,  0,
+/* 0x1960 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */   5,  0,  0,  0,164,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1980 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,172,  0,  0,  0,
+/* 0x1990 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   5,  0,  0,  0,180,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,184,  0,  0,  0,
+/* 0x19c0 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   5,  0,  0,  0,212,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,216,  0,  0,  0,
+/* 0x19f0 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   6,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 76,  0,  0,  0,
+/* 0x1a20 */ 239,  0,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */   6,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,168,  0,  0,  0,
+/* 0x1a50 */ 239,  0,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */   7,  0,  0,  0,116,  0,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,144,  0,  0,  0,
+/* 0x1a80 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   7,  0,  0,  0,184,  0,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,204,  0,  0,  0,
+/* 0x1ab0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   7,  0,  0,  0,244,  0,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  0,  1,  0,  0,
+/* 0x1ae0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */   7,  0,  0,  0,  8,  1,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1b00 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 68,  1,  0,  0,
+/* 0x1b10 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   7,  0,  0,  0,144,  1,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1b30 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,204,  1,  0,  0,
+/* 0x1b40 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */   7,  0,  0,  0,216,  1,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1b60 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  2,  0,  0,
+/* 0x1b70 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   7,  0,  0,  0, 24,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1b90 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 32,  2,  0,  0,
+/* 0x1ba0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   7,  0,  0,  0, 52,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 60,  2,  0,  0,
+/* 0x1bd0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   7,  0,  0,  0, 64,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 76,  2,  0,  0,
+/* 0x1c00 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */   7,  0,  0,  0, 88,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,164,  2,  0,  0,
+/* 0x1c30 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */   7,  0,  0,  0,200,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,232,  2,  0,  0,
+/* 0x1c60 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   7,  0,  0,  0,  4,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 12,  3,  0,  0,
+/* 0x1c90 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   7,  0,  0,  0, 60,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,136,  3,  0,  0,
+/* 0x1cc0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   7,  0,  0,  0,160,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,168,  3,  0,  0,
+/* 0x1cf0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   7,  0,  0,  0,204,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,224,  3,  0,  0,
+/* 0x1d20 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */   7,  0,  0,  0,232,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 36,  4,  0,  0,
+/* 0x1d50 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */   7,  0,  0,  0, 56,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,108,  4,  0,  0,
+/* 0x1d80 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */   7,  0,  0,  0,132,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,140,  4,  0,  0,
+/* 0x1db0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   7,  0,  0,  0,176,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,212,  4,  0,  0,
+/* 0x1de0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   7,  0,  0,  0,236,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  4,  0,  0,
+/* 0x1e10 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */   7,  0,  0,  0, 24,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 60,  5,  0,  0,
+/* 0x1e40 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */   7,  0,  0,  0,152,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,160,  5,  0,  0,
+/* 0x1e70 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */   7,  0,  0,  0,192,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,228,  5,  0,  0,
+/* 0x1ea0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   7,  0,  0,  0,252,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  6,  0,  0,
+/* 0x1ed0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   7,  0,  0,  0, 36,  6,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 72,  6,  0,  0,
+/* 0x1f00 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   7,  0,  0,  0,128,  6,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,140,  6,  0,  0,
+/* 0x1f30 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   7,  0,  0,  0,208,  6,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,236,  6,  0,  0,
+/* 0x1f60 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   7,  0,  0,  0, 28,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 40,  7,  0,  0,
+/* 0x1f90 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   7,  0,  0,  0,108,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,124,  7,  0,  0,
+/* 0x1fc0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   7,  0,  0,  0,156,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,184,  7,  0,  0,
+/* 0x1ff0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */   7,  0,  0,  0,196,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,208,  7,  0,  0,
+/* 0x2020 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */   7,  0,  0,  0,244,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 32,  8,  0,  0,
+/* 0x2050 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */   7,  0,  0,  0, 44,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,124,  8,  0,  0,
+/* 0x2080 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */   7,  0,  0,  0,136,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,160,  8,  0,  0,
+/* 0x20b0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */   7,  0,  0,  0,232,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  8,  0,  0,
+/* 0x20e0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */   7,  0,  0,  0,252,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  9,  0,  0,
+/* 0x2110 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */   7,  0,  0,  0, 40,  9,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,120,  0,  0,  0,
+/* 0x2140 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */   8,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,136,  0,  0,  0,
+/* 0x2170 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */   8,  0,  0,  0,168,  0,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,172,  0,  0,  0,
+/* 0x21a0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21b0 */   8,  0,  0,  0,228,  0,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  1,  0,  0,
+/* 0x21d0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21e0 */   8,  0,  0,  0, 12,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 20,  1,  0,  0,
+/* 0x2200 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2210 */   8,  0,  0,  0, 24,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 32,  1,  0,  0,
+/* 0x2230 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2240 */   8,  0,  0,  0, 40,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 68,  1,  0,  0,
+/* 0x2260 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2270 */   8,  0,  0,  0, 76,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  1,  0,  0,
+/* 0x2290 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22a0 */   8,  0,  0,  0,128,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,136,  1,  0,  0,
+/* 0x22c0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22d0 */   8,  0,  0,  0,140,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,156,  1,  0,  0,
+/* 0x22f0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2300 */   8,  0,  0,  0,160,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2310 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,192,  1,  0,  0,
+/* 0x2320 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2330 */   8,  0,  0,  0,204,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2340 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,212,  1,  0,  0,
+/* 0x2350 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2360 */   8,  0,  0,  0,220,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2370 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,228,  1,  0,  0,
+/* 0x2380 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2390 */   8,  0,  0,  0,236,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 40,  2,  0,  0,
+/* 0x23b0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23c0 */   8,  0,  0,  0, 44,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 68,  2,  0,  0,
+/* 0x23e0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23f0 */   8,  0,  0,  0, 76,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  2,  0,  0,
+/* 0x2410 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2420 */   8,  0,  0,  0,104,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,132,  2,  0,  0,
+/* 0x2440 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2450 */   8,  0,  0,  0,140,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,164,  2,  0,  0,
+/* 0x2470 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2480 */   8,  0,  0,  0,200,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2490 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,208,  2,  0,  0,
+/* 0x24a0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24b0 */   8,  0,  0,  0,220,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,244,  2,  0,  0,
+/* 0x24d0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24e0 */   8,  0,  0,  0, 12,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 20,  3,  0,  0,
+/* 0x2500 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2510 */   8,  0,  0,  0, 44,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2520 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  3,  0,  0,
+/* 0x2530 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2540 */   8,  0,  0,  0, 88,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2550 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,112,  3,  0,  0,
+/* 0x2560 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2570 */   8,  0,  0,  0,120,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2580 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,156,  3,  0,  0,
+/* 0x2590 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25a0 */   8,  0,  0,  0,176,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,184,  3,  0,  0,
+/* 0x25c0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25d0 */   8,  0,  0,  0,200,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,204,  3,  0,  0,
+/* 0x25f0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2600 */   8,  0,  0,  0,  0,  4,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2610 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 24,  4,  0,  0,
+/* 0x2620 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2630 */   8,  0,  0,  0, 64,  4,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2640 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,220,  0,  0,  0,
+/* 0x2650 */ 239,  0,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2660 */  11,  0,  0,  0,232,  0,  0,  0,239,  0,  0,  0, 98,  0,  0,  0,
+/* 0x2670 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,236,  0,  0,  0,
+/* 0x2680 */ 227,  0,  0,  0,214,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2690 */  69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65,
+/* 0x26a0 */  68,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 78, 82, 86, 50, 69,
+/* 0x26b0 */   0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77,
+/* 0x26c0 */  65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x26d0 */  50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90,
+/* 0x26e0 */  77, 65, 95, 68, 69, 67, 51, 48,  0, 69, 76, 70, 77, 65, 73, 78,
+/* 0x26f0 */  89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 77, 70, 76, 71,  0,
+/* 0x2700 */  95,115,116, 97,114,116,  0,117, 99,108, 95,110,114,118, 50,101,
+/* 0x2710 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,117, 99,
+/* 0x2720 */ 108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,
+/* 0x2730 */ 115,115, 95, 56,  0,117, 99,108, 95,110,114,118, 50, 98, 95,100,
+/* 0x2740 */ 101, 99,111,109,112,114,101,115,115, 95, 56,  0, 76,122,109, 97,
+/* 0x2750 */  68,101, 99,111,100,101,  0,101,110,100, 95,100,101, 99,111,109,
+/* 0x2760 */ 112,114,101,115,115,  0, 79, 95, 66, 73, 78, 70, 79,  0, 99,112,
+/* 0x2770 */ 114, 48,  0, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,  0, 82,
+/* 0x2780 */  95, 65, 82, 77, 95, 80, 67, 50, 52,  0,172, 18,  0,  0, 85, 80,
+/* 0x2790 */  88, 76, 78, 75, 48, 49
 };
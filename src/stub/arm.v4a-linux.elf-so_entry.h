@@ -1,5 +1,5 @@
 /* arm.v4a-linux.elf-so_entry.h
-   created from arm.v4a-linux.elf-so_entry.bin, 2286 (0x8ee) bytes
+   created from arm.v4a-linux.elf-so_entry.bin, 1715 (0x6b3) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V4A_LINUX_ELF_SO_ENTRY_SIZE    2286
-#define STUB_ARM_V4A_LINUX_ELF_SO_ENTRY_ADLER32 0x974aee5d
-#define STUB_ARM_V4A_LINUX_ELF_SO_ENTRY_CRC32   0x71fe022f
+#define STUB_ARM_V4A_LINUX_ELF_SO_ENTRY_SIZE    1715
+#define STUB_ARM_V4A_LINUX_ELF_SO_ENTRY_ADLER32 0x152c0200
+#define STUB_ARM_V4A_LINUX_ELF_SO_ENTRY_CRC32   0x14f70486
 
-unsigned char stub_arm_v4a_linux_elf_so_entry[2286] = {
+unsigned char stub_arm_v4a_linux_elf_so_entry[1715] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  28,  2,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -105,78 +105,43 @@ unsigned char stub_arm_v4a_linux_elf_so_entry[2286] = {
 /* 0x0420 */   1,  1,  0,  0,116,  1,  0,  0,  1,  1,  0,  0,124,  1,  0,  0,
 /* 0x0430 */   1,  1,  0,  0,132,  1,  0,  0,  1,  1,  0,  0,136,  1,  0,  0,
 /* 0x0440 */   1,  1,  0,  0,164,  1,  0,  0,  1,  1,  0,  0,168,  1,  0,  0,
-/* 0x0450 */   1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,102,105,108,101,
-/* 0x0460 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,108,105,
-/* 0x0470 */ 116,116,108,101, 97,114,109, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x0480 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x0490 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x04a0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x04b0 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x04c0 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70,
-/* 0x04d0 */  77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 49, 97, 99, 32,
-/* 0x04e0 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 50,
-/* 0x04f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 69,
-/* 0x0500 */  76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 52, 32,
-/* 0x0510 */  32, 48, 32, 32, 48, 32, 32, 48, 49,101, 48, 32, 32, 50, 42, 42,
-/* 0x0520 */  50, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66,
-/* 0x0530 */  79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48,
-/* 0x0540 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65,
-/* 0x0550 */  73, 78, 88, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48,
-/* 0x0560 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x0570 */  69, 76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 69, 76, 70, 77, 65,
-/* 0x0580 */  73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x0590 */  32, 32, 32, 70, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32,
-/* 0x05a0 */  95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 99, 48, 32,
-/* 0x05b0 */ 103, 32, 32, 32, 32, 32, 70, 32, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x05c0 */  32, 48,101, 99, 32,117, 99,108, 95,110,114,118, 50, 98, 95,100,
-/* 0x05d0 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 10, 82, 69, 76,
-/* 0x05e0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x05f0 */  70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10,
-/* 0x0600 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x0610 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x0620 */  10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x0630 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x0640 */  65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 51, 56, 32, 82, 95,
-/* 0x0650 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0660 */  69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48,100,
-/* 0x0670 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x0680 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48,
-/* 0x0690 */  48, 48, 49, 51, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x06a0 */  32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x06b0 */  10, 48, 48, 48, 48, 48, 49, 51, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x06c0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x06d0 */  65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 49, 51, 99, 32, 82, 95,
-/* 0x06e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x06f0 */  69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 49, 52,
-/* 0x0700 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x0710 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48,
-/* 0x0720 */  48, 48, 49, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x0730 */  32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x0740 */  10, 48, 48, 48, 48, 48, 49, 53, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x0750 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x0760 */  65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 49, 54, 48, 32, 82, 95,
-/* 0x0770 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0780 */  69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 49, 55,
-/* 0x0790 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x07a0 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48,
-/* 0x07b0 */  48, 48, 49, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x07c0 */  32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x07d0 */  10, 48, 48, 48, 48, 48, 49, 55, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x07e0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x07f0 */  65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 49, 56, 52, 32, 82, 95,
-/* 0x0800 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0810 */  69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 49, 56,
-/* 0x0820 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x0830 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48,
-/* 0x0840 */  48, 48, 49, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x0850 */  32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x0860 */  10, 48, 48, 48, 48, 48, 49, 97, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x0870 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77,
-/* 0x0880 */  65, 73, 78, 88, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x0890 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76,
-/* 0x08a0 */  70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x08b0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x08c0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x08d0 */  48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x08e0 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10
+/* 0x0450 */   1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  2,  0,  0,  0,
+/* 0x0460 */   4,  0,  0,  0, 18,  0,  0,  0, 59,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0470 */  52,  0,  0,  0,172,  1,  0,  0,  2,  0,  0,  0,  9,  0,  0,  0,
+/* 0x0480 */ 224,  1,  0,  0,  4,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0490 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x04a0 */   0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x04b0 */  25,  0,  0,  0,  0,  0,  0,  0,192,  0,  0,  0,  0,  0,  0,  0,
+/* 0x04c0 */  16,  0,  0,  0, 48,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x04d0 */   0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0, 48,  0,  0,  0,
+/* 0x04e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x04f0 */ 208,  0,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0500 */   0,  0,  0,  0,  0,  0,  0,  0, 48,  1,  0,  0, 48,  0,  0,  0,
+/* 0x0510 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0520 */  56,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0530 */   0,  0,  0,  0,  0,  0,  0,  0, 60,  1,  0,  0, 48,  0,  0,  0,
+/* 0x0540 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0550 */  76,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0560 */   0,  0,  0,  0,  0,  0,  0,  0, 80,  1,  0,  0, 48,  0,  0,  0,
+/* 0x0570 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0580 */  84,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0590 */   0,  0,  0,  0,  0,  0,  0,  0, 96,  1,  0,  0, 48,  0,  0,  0,
+/* 0x05a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x05b0 */ 112,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x05c0 */   0,  0,  0,  0,  0,  0,  0,  0,116,  1,  0,  0, 48,  0,  0,  0,
+/* 0x05d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x05e0 */ 124,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x05f0 */   0,  0,  0,  0,  0,  0,  0,  0,132,  1,  0,  0, 48,  0,  0,  0,
+/* 0x0600 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0610 */ 136,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0620 */   0,  0,  0,  0,  0,  0,  0,  0,164,  1,  0,  0, 48,  0,  0,  0,
+/* 0x0630 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0640 */ 168,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0650 */   0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,
+/* 0x0660 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77,
+/* 0x0670 */  65, 73, 78, 88,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,
+/* 0x0680 */ 116, 97,114,116,  0,117, 99,108, 95,110,114,118, 50, 98, 95,100,
+/* 0x0690 */ 101, 99,111,109,112,114,101,115,115, 95, 56,  0, 82, 95, 65, 82,
+/* 0x06a0 */  77, 95, 80, 67, 50, 52,  0, 92,  4,  0,  0, 85, 80, 88, 76, 78,
+/* 0x06b0 */  75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v4a-linux.elf-so_fold.h
-   created from arm.v4a-linux.elf-so_fold.bin, 26104 (0x65f8) bytes
+   created from arm.v4a-linux.elf-so_fold.bin, 20526 (0x502e) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V4A_LINUX_ELF_SO_FOLD_SIZE    26104
-#define STUB_ARM_V4A_LINUX_ELF_SO_FOLD_ADLER32 0xd622a069
-#define STUB_ARM_V4A_LINUX_ELF_SO_FOLD_CRC32   0xf7e5f86b
+#define STUB_ARM_V4A_LINUX_ELF_SO_FOLD_SIZE    20526
+#define STUB_ARM_V4A_LINUX_ELF_SO_FOLD_ADLER32 0x3c77c0ef
+#define STUB_ARM_V4A_LINUX_ELF_SO_FOLD_CRC32   0x9ffb85b8
 
-unsigned char stub_arm_v4a_linux_elf_so_fold[26104] = {
+unsigned char stub_arm_v4a_linux_elf_so_fold[20526] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 208, 28,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -786,886 +786,537 @@ unsigned char stub_arm_v4a_linux_elf_so_fold[26104] = {
 /* 0x2eb0 */ 184,  3,  0,  0,  1,  9,  0,  0,200,  3,  0,  0,  1,  9,  0,  0,
 /* 0x2ec0 */ 204,  3,  0,  0,  1,  9,  0,  0,  0,  4,  0,  0,  1,  9,  0,  0,
 /* 0x2ed0 */  24,  4,  0,  0,  1,  9,  0,  0, 64,  4,  0,  0,  1,  9,  0,  0,
-/* 0x2ee0 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x2ef0 */  50, 45,108,105,116,116,108,101, 97,114,109, 10, 10, 83,101, 99,
-/* 0x2f00 */ 116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32,
-/* 0x2f10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32,
-/* 0x2f20 */  32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x2f30 */  32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32,
-/* 0x2f40 */  32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48,
-/* 0x2f50 */  32, 83, 79, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2f60 */  50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50,
-/* 0x2f70 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x2f80 */  49, 32,112,116,114, 95, 78, 69, 88, 84, 32, 32, 32, 32, 32, 32,
-/* 0x2f90 */  48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 52, 32, 32, 50,
-/* 0x2fa0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x2fb0 */  50, 32, 83, 79, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2fc0 */  48, 50, 56, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 99, 32,
-/* 0x2fd0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2fe0 */  32, 32, 51, 32, 83, 79, 95, 77, 65, 73, 78, 32, 32, 32, 32, 32,
-/* 0x2ff0 */  32, 32, 48, 55, 50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x3000 */ 101, 52, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3010 */  84, 83, 10, 32, 32, 52, 32, 69, 88, 80, 95, 72, 69, 65, 68, 32,
-/* 0x3020 */  32, 32, 32, 32, 32, 48,100, 99, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3030 */  48, 97, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3040 */  69, 78, 84, 83, 10, 32, 32, 53, 32, 69, 88, 80, 95, 84, 65, 73,
-/* 0x3050 */  76, 32, 32, 32, 32, 32, 32, 48, 50, 52, 32, 32, 48, 32, 32, 48,
-/* 0x3060 */  32, 32, 48, 97,101, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3070 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 78, 82, 86, 50, 69,
-/* 0x3080 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 49, 52, 32, 32, 48,
-/* 0x3090 */  32, 32, 48, 32, 32, 48, 98, 48, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x30a0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 78, 82,
-/* 0x30b0 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 48, 48,
-/* 0x30c0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 99, 49, 56, 32, 32, 50, 42,
-/* 0x30d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56,
-/* 0x30e0 */  32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x30f0 */  99, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 49, 56, 32, 32,
-/* 0x3100 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x3110 */  32, 57, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32,
-/* 0x3120 */  32, 48, 57, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,100,100, 99,
-/* 0x3130 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3140 */  10, 32, 49, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x3150 */  32, 32, 32, 48, 57, 51, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3160 */ 101, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3170 */  78, 84, 83, 10, 32, 49, 49, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3180 */  49, 48, 32, 32, 32, 32, 48, 52, 55, 56, 32, 32, 48, 32, 32, 48,
-/* 0x3190 */  32, 32, 48, 49, 55, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x31a0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 76, 90, 77, 65,
-/* 0x31b0 */  95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x31c0 */  48, 32, 32, 48, 49, 99, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x31d0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32,
-/* 0x31e0 */  84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x31f0 */ 108, 32, 32, 32, 32,100, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32,
-/* 0x3200 */  48, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3210 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 83, 79, 95, 77, 65,
-/* 0x3220 */  73, 78, 32, 48, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x3230 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88,
-/* 0x3240 */  80, 95, 72, 69, 65, 68, 32, 48, 32, 69, 88, 80, 95, 72, 69, 65,
-/* 0x3250 */  68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3260 */ 100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69,
-/* 0x3270 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3280 */  32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10,
-/* 0x3290 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x32a0 */  32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x32b0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x32c0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77,
-/* 0x32d0 */  65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32e0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x32f0 */  67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x3300 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3310 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,
-/* 0x3320 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3330 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 83, 79, 95, 72, 69,
-/* 0x3340 */  65, 68, 32, 48, 32, 83, 79, 95, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x3350 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,112,116,
-/* 0x3360 */ 114, 95, 78, 69, 88, 84, 32, 48, 32,112,116,114, 95, 78, 69, 88,
-/* 0x3370 */  84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3380 */ 100, 32, 32, 69, 88, 80, 95, 84, 65, 73, 76, 32, 48, 32, 69, 88,
-/* 0x3390 */  80, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x33a0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x33b0 */  51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10,
-/* 0x33c0 */  48, 48, 48, 48, 48, 48, 55, 48, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x33d0 */  32, 69, 88, 80, 95, 72, 69, 65, 68, 32, 48, 32,102, 95,101,120,
-/* 0x33e0 */ 112, 97,110,100, 10, 48, 48, 48, 48, 48, 48, 53, 56, 32,103, 32,
-/* 0x33f0 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3400 */ 109,117,110,109, 97,112, 10, 48, 48, 48, 48, 48, 48, 99, 48, 32,
-/* 0x3410 */ 103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32,
-/* 0x3420 */  48, 32,103,101,116, 95,115,121,115, 95,109,117,110,109, 97,112,
-/* 0x3430 */  10, 48, 48, 48, 48, 48, 48, 52, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x3440 */  32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,103,101,116,112,
-/* 0x3450 */ 105,100, 10, 48, 48, 48, 48, 48, 48,101, 48, 32,103, 32, 32, 32,
-/* 0x3460 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,101,
-/* 0x3470 */ 109, 99,112,121, 10, 48, 48, 48, 48, 48, 48, 53, 48, 32,103, 32,
-/* 0x3480 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3490 */ 114,101, 97,100,108,105,110,107, 10, 48, 48, 48, 48, 48, 50, 50,
-/* 0x34a0 */  99, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x34b0 */  76, 32, 48, 32, 95, 95,117,100,105,118,115,105, 51, 10, 48, 48,
-/* 0x34c0 */  48, 48, 48, 48, 54, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x34d0 */  79, 95, 84, 65, 73, 76, 32, 48, 32,102,116,114,117,110, 99, 97,
-/* 0x34e0 */ 116,101, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32,103, 32, 32, 32,
-/* 0x34f0 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,109,
-/* 0x3500 */  97,112, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32,103, 32, 32, 32,
-/* 0x3510 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32, 95, 95,
-/* 0x3520 */  99,108,101, 97,114, 95, 99, 97, 99,104,101, 10, 48, 48, 48, 48,
-/* 0x3530 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 69, 88, 80,
-/* 0x3540 */  95, 84, 65, 73, 76, 32, 48, 32,101,111,102, 10, 48, 48, 48, 48,
-/* 0x3550 */  48, 48, 99, 56, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95,
-/* 0x3560 */  84, 65, 73, 76, 32, 48, 32,109,109, 97,112, 95,112,114,105,118,
-/* 0x3570 */  97,110,111,110, 10, 48, 48, 48, 48, 48, 48, 50, 48, 32,103, 32,
-/* 0x3580 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3590 */ 119,114,105,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103,
-/* 0x35a0 */  32, 32, 32, 32, 32, 70, 32, 83, 79, 95, 77, 65, 73, 78, 32, 48,
-/* 0x35b0 */  50, 99, 32, 80, 70, 95,116,111, 95, 80, 82, 79, 84, 10, 48, 48,
-/* 0x35c0 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78,
-/* 0x35d0 */  82, 86, 50, 68, 32, 48, 49, 48, 48, 32,117, 99,108, 95,110,114,
-/* 0x35e0 */ 118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x35f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x3600 */  32, 32, 83, 79, 95, 72, 69, 65, 68, 32, 48, 32,102,111,108,100,
-/* 0x3610 */  10, 48, 48, 48, 48, 48, 48, 54, 56, 32,103, 32, 32, 32, 32, 32,
-/* 0x3620 */  32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,101,109,102,
-/* 0x3630 */ 100, 95, 99,114,101, 97,116,101, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x3640 */  56, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x3650 */  76, 32, 48, 32,114,101, 97,100, 10, 48, 48, 48, 48, 48, 48, 51,
-/* 0x3660 */  56, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x3670 */  76, 32, 48, 32,117,110,108,105,110,107, 10, 48, 48, 48, 48, 48,
-/* 0x3680 */  49, 98, 52, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84,
-/* 0x3690 */  65, 73, 76, 32, 48, 32,117,110,100,101,114,108, 97,121, 10, 48,
-/* 0x36a0 */  48, 48, 48, 48, 50, 48, 52, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x36b0 */  83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,101,109,115,101,116,
-/* 0x36c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x36d0 */  70, 32, 78, 82, 86, 50, 66, 32, 48, 99, 52, 32,117, 99,108, 95,
-/* 0x36e0 */ 110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x36f0 */  95, 56, 10, 48, 48, 48, 48, 48, 49,100, 99, 32,103, 32, 32, 32,
-/* 0x3700 */  32, 32, 70, 32, 83, 79, 95, 77, 65, 73, 78, 32, 48, 97, 52, 32,
-/* 0x3710 */ 103,101,116, 95, 80, 65, 71, 69, 95, 77, 65, 83, 75, 10, 48, 48,
-/* 0x3720 */  48, 48, 48, 50, 49, 99, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3730 */  79, 95, 84, 65, 73, 76, 32, 48, 32,109,121, 95, 97,108,108,111,
-/* 0x3740 */  99, 97, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32,103, 32, 32, 32,
-/* 0x3750 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,121,
-/* 0x3760 */  95, 98,107,112,116, 10, 48, 48, 48, 48, 48, 48, 55, 48, 32,103,
-/* 0x3770 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48,
-/* 0x3780 */  32, 80,112,114,111,116,101, 99,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3790 */  48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 69,
-/* 0x37a0 */  32, 48, 49, 49, 52, 32,117, 99,108, 95,110,114,118, 50,101, 95,
-/* 0x37b0 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48,
-/* 0x37c0 */  48, 48, 48, 49, 52, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79,
-/* 0x37d0 */  95, 84, 65, 73, 76, 32, 48, 32,101,120,105,116, 10, 48, 48, 48,
-/* 0x37e0 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x37f0 */  77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,122,109, 97, 68,
-/* 0x3800 */ 101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 52, 56, 32,103,
-/* 0x3810 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48,
-/* 0x3820 */  32, 98,114,107, 10, 48, 48, 48, 48, 48, 48, 50, 56, 32,103, 32,
-/* 0x3830 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3840 */ 111,112,101,110, 10, 48, 48, 48, 48, 48, 50, 50, 99, 32,103, 32,
-/* 0x3850 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3860 */ 100,105,118, 49, 48, 10, 48, 48, 48, 48, 48, 48, 55, 48, 32,103,
-/* 0x3870 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48,
-/* 0x3880 */  32,109,112,114,111,116,101, 99,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3890 */  51, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65,
-/* 0x38a0 */  73, 76, 32, 48, 32, 99,108,111,115,101, 10, 48, 48, 48, 48, 48,
-/* 0x38b0 */  50, 56, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 83, 79, 95, 77,
-/* 0x38c0 */  65, 73, 78, 32, 48, 52, 97, 48, 32,117,112,120, 95,115,111, 95,
-/* 0x38d0 */ 109, 97,105,110, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x38e0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 83, 79,
-/* 0x38f0 */  95, 72, 69, 65, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3900 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3910 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3920 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3930 */  32, 32, 32, 32,117,112,120, 95,115,111, 95,109, 97,105,110, 10,
-/* 0x3940 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x3950 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 83, 79, 95, 84, 65, 73, 76,
-/* 0x3960 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3970 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3980 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82, 95, 65,
-/* 0x3990 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x39a0 */  79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48,102, 48, 32,
-/* 0x39b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x39c0 */  32, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 49,
-/* 0x39d0 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x39e0 */  32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48,
-/* 0x39f0 */  48, 48, 49, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3a00 */  32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 10,
-/* 0x3a10 */  48, 48, 48, 48, 48, 49, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3a20 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65,
-/* 0x3a30 */  73, 76, 10, 48, 48, 48, 48, 48, 49, 52, 56, 32, 82, 95, 65, 82,
-/* 0x3a40 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79,
-/* 0x3a50 */  95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 49, 53, 52, 32, 82,
-/* 0x3a60 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3a70 */  32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 49, 54,
-/* 0x3a80 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3a90 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48,
-/* 0x3aa0 */  48, 49, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3ab0 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48,
-/* 0x3ac0 */  48, 48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3ad0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x3ae0 */  76, 10, 48, 48, 48, 48, 48, 49, 56, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3af0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95,
-/* 0x3b00 */  84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 49, 97, 48, 32, 82, 95,
-/* 0x3b10 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3b20 */  83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 49, 97, 99,
-/* 0x3b30 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3b40 */  32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48,
-/* 0x3b50 */  49,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3b60 */  32, 32, 32, 32, 32, 32,109,101,109, 99,112,121, 10, 48, 48, 48,
-/* 0x3b70 */  48, 48, 49,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3b80 */  32, 32, 32, 32, 32, 32, 32, 32,109,109, 97,112, 95,112,114,105,
-/* 0x3b90 */ 118, 97,110,111,110, 10, 48, 48, 48, 48, 48, 49,102, 56, 32, 82,
-/* 0x3ba0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3bb0 */  32,109,101,109, 99,112,121, 10, 48, 48, 48, 48, 48, 50, 49, 52,
-/* 0x3bc0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3bd0 */  32, 32, 32,109,101,109,115,101,116, 10, 10, 82, 69, 76, 79, 67,
-/* 0x3be0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x3bf0 */  82, 32, 91, 83, 79, 95, 77, 65, 73, 78, 93, 58, 10, 79, 70, 70,
-/* 0x3c00 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x3c10 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x3c20 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3c30 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x3c40 */  10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3c50 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,121, 95, 98,
-/* 0x3c60 */ 107,112,116, 10, 48, 48, 48, 48, 48, 48, 51, 56, 32, 82, 95, 65,
-/* 0x3c70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,101,
-/* 0x3c80 */ 120,105,116, 10, 48, 48, 48, 48, 48, 48, 53, 56, 32, 82, 95, 65,
-/* 0x3c90 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3ca0 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 48, 54, 52, 32,
-/* 0x3cb0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3cc0 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3cd0 */  56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3ce0 */  32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x3cf0 */  48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3d00 */  32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10,
-/* 0x3d10 */  48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3d20 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65,
-/* 0x3d30 */  73, 78, 10, 48, 48, 48, 48, 48, 48,100, 56, 32, 82, 95, 65, 82,
-/* 0x3d40 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79,
-/* 0x3d50 */  95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82,
-/* 0x3d60 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3d70 */  32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 48,102,
-/* 0x3d80 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3d90 */  32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48,
-/* 0x3da0 */  48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3db0 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48,
-/* 0x3dc0 */  48, 48, 48, 48, 49, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3dd0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73,
-/* 0x3de0 */  78, 10, 48, 48, 48, 48, 48, 49, 49, 52, 32, 82, 95, 65, 82, 77,
-/* 0x3df0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95,
-/* 0x3e00 */  77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95,
-/* 0x3e10 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e20 */  83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 49, 50, 99,
-/* 0x3e30 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3e40 */  32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48,
-/* 0x3e50 */  49, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3e60 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48,
-/* 0x3e70 */  48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3e80 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x3e90 */  10, 48, 48, 48, 48, 48, 49, 53, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3ea0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,102, 95,101,120,
-/* 0x3eb0 */ 112, 97,110,100, 10, 48, 48, 48, 48, 48, 49, 54, 52, 32, 82, 95,
-/* 0x3ec0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ed0 */  83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 49, 55, 52,
-/* 0x3ee0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3ef0 */  32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48,
-/* 0x3f00 */  49, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3f10 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48,
-/* 0x3f20 */  48, 48, 48, 49, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3f30 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x3f40 */  10, 48, 48, 48, 48, 48, 49, 97, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3f50 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77,
-/* 0x3f60 */  65, 73, 78, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65,
-/* 0x3f70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3f80 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 49,101, 52, 32,
-/* 0x3f90 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3fa0 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3fb0 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3fc0 */  32, 32, 32, 32, 32,111,112,101,110, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3fd0 */  49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3fe0 */  32, 32, 32, 32, 32,114,101, 97,100, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3ff0 */  50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4000 */  32, 32, 32, 32, 32, 99,108,111,115,101, 10, 48, 48, 48, 48, 48,
-/* 0x4010 */  50, 51, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x4020 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48,
-/* 0x4030 */  48, 48, 48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4040 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x4050 */  10, 48, 48, 48, 48, 48, 50, 52, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4060 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77,
-/* 0x4070 */  65, 73, 78, 10, 48, 48, 48, 48, 48, 50, 53, 48, 32, 82, 95, 65,
-/* 0x4080 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x4090 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 50, 53, 99, 32,
-/* 0x40a0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x40b0 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 50,
-/* 0x40c0 */  54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x40d0 */  32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x40e0 */  48, 48, 50, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x40f0 */  32, 32, 32, 32, 32, 32, 32, 32,103,101,116, 95, 80, 65, 71, 69,
-/* 0x4100 */  95, 77, 65, 83, 75, 10, 48, 48, 48, 48, 48, 50,100, 99, 32, 82,
-/* 0x4110 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4120 */  32,109,109, 97,112, 10, 48, 48, 48, 48, 48, 50,101, 99, 32, 82,
-/* 0x4130 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4140 */  32,109,101,109, 99,112,121, 10, 48, 48, 48, 48, 48, 51, 49, 99,
-/* 0x4150 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x4160 */  32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48,
-/* 0x4170 */  51, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x4180 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48,
-/* 0x4190 */  48, 48, 48, 51, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x41a0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x41b0 */  10, 48, 48, 48, 48, 48, 51, 54, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x41c0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77,
-/* 0x41d0 */  65, 73, 78, 10, 48, 48, 48, 48, 48, 51, 54, 52, 32, 82, 95, 65,
-/* 0x41e0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x41f0 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 51, 55, 52, 32,
-/* 0x4200 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4210 */  32, 32,109,101,109,102,100, 95, 99,114,101, 97,116,101, 10, 48,
-/* 0x4220 */  48, 48, 48, 48, 51, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4230 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32,119,114,105,116,101, 10,
-/* 0x4240 */  48, 48, 48, 48, 48, 51, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x4250 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,119,114,105,116,101,
-/* 0x4260 */  10, 48, 48, 48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4270 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,117,110,109,
-/* 0x4280 */  97,112, 10, 48, 48, 48, 48, 48, 51, 98, 48, 32, 82, 95, 65, 82,
-/* 0x4290 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 80, 70,
-/* 0x42a0 */  95,116,111, 95, 80, 82, 79, 84, 10, 48, 48, 48, 48, 48, 51,100,
-/* 0x42b0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x42c0 */  32, 32, 32, 32,109,109, 97,112, 10, 48, 48, 48, 48, 48, 51,100,
-/* 0x42d0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x42e0 */  32, 32, 32, 32, 99,108,111,115,101, 10, 48, 48, 48, 48, 48, 51,
-/* 0x42f0 */ 101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4300 */  32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x4310 */  48, 48, 52, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4320 */  32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10,
-/* 0x4330 */  48, 48, 48, 48, 48, 52, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x4340 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65,
-/* 0x4350 */  73, 78, 10, 48, 48, 48, 48, 48, 52, 50, 99, 32, 82, 95, 65, 82,
-/* 0x4360 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79,
-/* 0x4370 */  95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 52, 52, 99, 32, 82,
-/* 0x4380 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4390 */  32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 52, 97,
-/* 0x43a0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x43b0 */  32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48,
-/* 0x43c0 */  48, 52, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x43d0 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48,
-/* 0x43e0 */  48, 48, 48, 48, 52, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x43f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,101,109,102,100, 95,
-/* 0x4400 */  99,114,101, 97,116,101, 10, 48, 48, 48, 48, 48, 52, 99, 56, 32,
-/* 0x4410 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4420 */  32, 32,102,116,114,117,110, 99, 97,116,101, 10, 48, 48, 48, 48,
-/* 0x4430 */  48, 52,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x4440 */  32, 32, 32, 32, 32, 32, 32,119,114,105,116,101, 10, 48, 48, 48,
-/* 0x4450 */  48, 48, 52,102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4460 */  32, 32, 32, 32, 32, 32, 32, 32,109,109, 97,112, 10, 48, 48, 48,
-/* 0x4470 */  48, 48, 53, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4480 */  32, 32, 32, 32, 32, 32, 32, 32,109,117,110,109, 97,112, 10, 48,
-/* 0x4490 */  48, 48, 48, 48, 53, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x44a0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73,
-/* 0x44b0 */  78, 10, 48, 48, 48, 48, 48, 53, 50, 48, 32, 82, 95, 65, 82, 77,
-/* 0x44c0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,117,110,100,
-/* 0x44d0 */ 101,114,108, 97,121, 10, 48, 48, 48, 48, 48, 53, 53, 52, 32, 82,
-/* 0x44e0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x44f0 */  32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 53, 54,
-/* 0x4500 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4510 */  32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48,
-/* 0x4520 */  48, 53, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x4530 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48,
-/* 0x4540 */  48, 48, 48, 48, 53, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4550 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32,103,101,116, 95,115,121,
-/* 0x4560 */ 115, 95,109,117,110,109, 97,112, 10, 48, 48, 48, 48, 48, 53, 57,
-/* 0x4570 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4580 */  32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48,
-/* 0x4590 */  48, 53, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x45a0 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48,
-/* 0x45b0 */  48, 48, 48, 48, 53, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x45c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73,
-/* 0x45d0 */  78, 10, 48, 48, 48, 48, 48, 53,102, 48, 32, 82, 95, 65, 82, 77,
-/* 0x45e0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 99,
-/* 0x45f0 */ 108,101, 97,114, 95, 99, 97, 99,104,101, 10, 48, 48, 48, 48, 48,
-/* 0x4600 */  53,102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x4610 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48,
-/* 0x4620 */  48, 48, 48, 53,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4630 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x4640 */  10, 48, 48, 48, 48, 48, 54, 48, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4650 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,101,109,102,
-/* 0x4660 */ 100, 95, 99,114,101, 97,116,101, 10, 48, 48, 48, 48, 48, 54, 49,
-/* 0x4670 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4680 */  32, 32, 32, 32,119,114,105,116,101, 10, 48, 48, 48, 48, 48, 54,
-/* 0x4690 */  51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x46a0 */  32, 32, 32, 32, 32,109,109, 97,112, 10, 48, 48, 48, 48, 48, 54,
-/* 0x46b0 */  52, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x46c0 */  32, 32, 32, 32, 32, 99,108,111,115,101, 10, 48, 48, 48, 48, 48,
-/* 0x46d0 */  54, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x46e0 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48,
-/* 0x46f0 */  48, 48, 48, 54, 54, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4700 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x4710 */  10, 48, 48, 48, 48, 48, 54, 55, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4720 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,117,110,109,
-/* 0x4730 */  97,112, 10, 48, 48, 48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82,
-/* 0x4740 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 80, 70,
-/* 0x4750 */  95,116,111, 95, 80, 82, 79, 84, 10, 48, 48, 48, 48, 48, 54, 97,
-/* 0x4760 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4770 */  32, 32, 32, 32,109,109, 97,112, 10, 48, 48, 48, 48, 48, 54, 98,
-/* 0x4780 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4790 */  32, 32, 32, 32, 99,108,111,115,101, 10, 48, 48, 48, 48, 48, 54,
-/* 0x47a0 */  98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x47b0 */  32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x47c0 */  48, 48, 54,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x47d0 */  32, 32, 32, 32, 32, 32, 32, 32, 80, 70, 95,116,111, 95, 80, 82,
-/* 0x47e0 */  79, 84, 10, 48, 48, 48, 48, 48, 54,101, 48, 32, 82, 95, 65, 82,
-/* 0x47f0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 80,112,
-/* 0x4800 */ 114,111,116,101, 99,116, 10, 48, 48, 48, 48, 48, 54,101, 99, 32,
-/* 0x4810 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4820 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 54,
-/* 0x4830 */ 102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4840 */  32, 32, 32, 32, 32,109,117,110,109, 97,112, 10, 10, 82, 69, 76,
-/* 0x4850 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4860 */  70, 79, 82, 32, 91, 69, 88, 80, 95, 72, 69, 65, 68, 93, 58, 10,
-/* 0x4870 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4880 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4890 */  10, 48, 48, 48, 48, 48, 48, 50, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x48a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 80, 95,
-/* 0x48b0 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95,
-/* 0x48c0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x48d0 */  69, 88, 80, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 56,
-/* 0x48e0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x48f0 */  32, 32, 32, 32, 69, 88, 80, 95, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x4900 */  48, 48, 48, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4910 */  32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 80, 95, 72, 69, 65, 68,
-/* 0x4920 */  10, 48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4930 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 80, 95,
-/* 0x4940 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95,
-/* 0x4950 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4960 */  69, 88, 80, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 99,
-/* 0x4970 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4980 */  32, 32, 32, 32, 95, 95, 99,108,101, 97,114, 95, 99, 97, 99,104,
-/* 0x4990 */ 101, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x49a0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69,
-/* 0x49b0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x49c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x49d0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65,
-/* 0x49e0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x49f0 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95,
-/* 0x4a00 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a10 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 52, 56, 32, 82,
-/* 0x4a20 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a30 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 53, 48, 32,
-/* 0x4a40 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4a50 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 53, 99,
-/* 0x4a60 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x4a70 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 54,
-/* 0x4a80 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4a90 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4aa0 */  55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4ab0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4ac0 */  48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x4ad0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x4ae0 */  48, 48, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x4af0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x4b00 */  48, 48, 48, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4b10 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x4b20 */  48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4b30 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x4b40 */  48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4b50 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x4b60 */  48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x4b70 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x4b80 */  10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4b90 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x4ba0 */  69, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65, 82, 77,
-/* 0x4bb0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x4bc0 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82,
-/* 0x4bd0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x4be0 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65,
-/* 0x4bf0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4c00 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95,
-/* 0x4c10 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c20 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 52, 32, 82,
-/* 0x4c30 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c40 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 99, 32,
-/* 0x4c50 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4c60 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,101, 52,
-/* 0x4c70 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x4c80 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48,
-/* 0x4c90 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4ca0 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49,
-/* 0x4cb0 */  49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4cc0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 10, 82, 69, 76, 79,
-/* 0x4cd0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4ce0 */  79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4cf0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4d00 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4d10 */  48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4d20 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x4d30 */  48, 48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4d40 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x4d50 */  48, 48, 48, 48, 48, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4d60 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x4d70 */  48, 48, 48, 48, 48, 48, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x4d80 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x4d90 */  10, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4da0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x4db0 */  68, 10, 48, 48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77,
-/* 0x4dc0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x4dd0 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82,
-/* 0x4de0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x4df0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65,
-/* 0x4e00 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4e10 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95,
-/* 0x4e20 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e30 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82,
-/* 0x4e40 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e50 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32,
-/* 0x4e60 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4e70 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 97, 52,
-/* 0x4e80 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x4e90 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x4ea0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4eb0 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ec0 */  98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4ed0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x4ee0 */  48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x4ef0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x4f00 */  48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x4f10 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x4f20 */  48, 48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4f30 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x4f40 */  48, 48, 48, 48,102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4f50 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x4f60 */  48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4f70 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x4f80 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x4f90 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58,
-/* 0x4fa0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4fb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4fc0 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77,
-/* 0x4fd0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x4fe0 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 52, 56, 32, 82, 95, 65, 82,
-/* 0x4ff0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x5000 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 53, 48, 32, 82, 95, 65,
-/* 0x5010 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5020 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 53, 52, 32, 82, 95,
-/* 0x5030 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5040 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 54, 52, 32, 82,
-/* 0x5050 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5060 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 54, 56, 32,
-/* 0x5070 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x5080 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 54, 99,
-/* 0x5090 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x50a0 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 55,
-/* 0x50b0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x50c0 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x50d0 */  56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x50e0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x50f0 */  48, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x5100 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x5110 */  48, 48, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5120 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x5130 */  48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x5140 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x5150 */  48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5160 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x5170 */  48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x5180 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x5190 */  48, 48, 48, 48, 48, 48, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x51a0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x51b0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x51c0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69,
-/* 0x51d0 */  76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x51e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x51f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x5200 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x5210 */  32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48,
-/* 0x5220 */  48, 48, 48, 48, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5230 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x5240 */  70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65,
-/* 0x5250 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5260 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5270 */  56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x5280 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10,
-/* 0x5290 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x52a0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69,
-/* 0x52b0 */  67, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x52c0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x52d0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32,
-/* 0x52e0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x52f0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x5300 */  48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x5310 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x5320 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65, 82,
-/* 0x5330 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x5340 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 99,
-/* 0x5350 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x5360 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x5370 */  48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x5380 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5390 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95,
-/* 0x53a0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x53b0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x53c0 */  49, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x53d0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x53e0 */  10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x53f0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x5400 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 57, 48, 32,
-/* 0x5410 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x5420 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x5430 */  48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x5440 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x5450 */  50, 48, 10, 48, 48, 48, 48, 48, 49,100, 56, 32, 82, 95, 65, 82,
-/* 0x5460 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x5470 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 48,
-/* 0x5480 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x5490 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x54a0 */  48, 48, 48, 48, 50, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x54b0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x54c0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 50, 48, 32, 82, 95,
-/* 0x54d0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x54e0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x54f0 */  50, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x5500 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x5510 */  10, 48, 48, 48, 48, 48, 50, 51, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x5520 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x5530 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 52, 48, 32,
-/* 0x5540 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x5550 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x5560 */  48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x5570 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x5580 */  50, 48, 10, 48, 48, 48, 48, 48, 50, 53, 56, 32, 82, 95, 65, 82,
-/* 0x5590 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x55a0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 97,
-/* 0x55b0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x55c0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x55d0 */  48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x55e0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x55f0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,101, 56, 32, 82, 95,
-/* 0x5600 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5610 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5620 */  51, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x5630 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x5640 */  10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x5650 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x5660 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 51, 99, 32,
-/* 0x5670 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x5680 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x5690 */  48, 48, 51, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x56a0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x56b0 */  50, 48, 10, 48, 48, 48, 48, 48, 51, 97, 48, 32, 82, 95, 65, 82,
-/* 0x56c0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x56d0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97,
-/* 0x56e0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x56f0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x5700 */  48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x5710 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5720 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,101, 48, 32, 82, 95,
-/* 0x5730 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5740 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5750 */  51,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x5760 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x5770 */  10, 48, 48, 48, 48, 48, 52, 50, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x5780 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x5790 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 51, 56, 32,
-/* 0x57a0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x57b0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x57c0 */  48, 48, 52, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x57d0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x57e0 */  50, 48, 10, 48, 48, 48, 48, 48, 52, 56, 52, 32, 82, 95, 65, 82,
-/* 0x57f0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x5800 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56,
-/* 0x5810 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x5820 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x5830 */  48, 48, 48, 48, 52, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x5840 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5850 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,100, 52, 32, 82, 95,
-/* 0x5860 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5870 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5880 */  52,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x5890 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x58a0 */  10, 48, 48, 48, 48, 48, 52,102, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x58b0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x58c0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 49, 56, 32,
-/* 0x58d0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x58e0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x58f0 */  48, 48, 53, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x5900 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x5910 */  50, 48, 10, 48, 48, 48, 48, 48, 53, 57, 56, 32, 82, 95, 65, 82,
-/* 0x5920 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x5930 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 97,
-/* 0x5940 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x5950 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x5960 */  48, 48, 48, 48, 53, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x5970 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5980 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,101, 52, 32, 82, 95,
-/* 0x5990 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59a0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x59b0 */  53,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x59c0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x59d0 */  10, 48, 48, 48, 48, 48, 54, 48, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x59e0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x59f0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 50, 52, 32,
-/* 0x5a00 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x5a10 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x5a20 */  48, 48, 54, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x5a30 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x5a40 */  50, 48, 10, 48, 48, 48, 48, 48, 54, 56, 48, 32, 82, 95, 65, 82,
-/* 0x5a50 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x5a60 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56,
-/* 0x5a70 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x5a80 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x5a90 */  48, 48, 48, 48, 54,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x5aa0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5ab0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,101, 99, 32, 82, 95,
-/* 0x5ac0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ad0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5ae0 */  55, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x5af0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x5b00 */  10, 48, 48, 48, 48, 48, 55, 50, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x5b10 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x5b20 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 54, 99, 32,
-/* 0x5b30 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x5b40 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x5b50 */  48, 48, 55, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x5b60 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x5b70 */  50, 48, 10, 48, 48, 48, 48, 48, 55, 57, 99, 32, 82, 95, 65, 82,
-/* 0x5b80 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x5b90 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 98,
-/* 0x5ba0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x5bb0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x5bc0 */  48, 48, 48, 48, 55, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x5bd0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5be0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,100, 48, 32, 82, 95,
-/* 0x5bf0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c00 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5c10 */  55,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x5c20 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x5c30 */  10, 48, 48, 48, 48, 48, 56, 50, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x5c40 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x5c50 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 99, 32,
-/* 0x5c60 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x5c70 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x5c80 */  48, 48, 56, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x5c90 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x5ca0 */  50, 48, 10, 48, 48, 48, 48, 48, 56, 56, 56, 32, 82, 95, 65, 82,
-/* 0x5cb0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x5cc0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 97,
-/* 0x5cd0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x5ce0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x5cf0 */  48, 48, 48, 48, 56,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x5d00 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5d10 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,102, 52, 32, 82, 95,
-/* 0x5d20 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d30 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5d40 */  56,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x5d50 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x5d60 */  10, 48, 48, 48, 48, 48, 57, 48, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x5d70 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x5d80 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 50, 56, 32,
-/* 0x5d90 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x5da0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 10, 82, 69,
-/* 0x5db0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5dc0 */  32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x5dd0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5de0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5df0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65,
-/* 0x5e00 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5e10 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5e20 */  56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x5e30 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x5e40 */  48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x5e50 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x5e60 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 97, 56, 32, 82,
-/* 0x5e70 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e80 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x5e90 */  48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5ea0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x5eb0 */  48, 10, 48, 48, 48, 48, 48, 48,101, 52, 32, 82, 95, 65, 82, 77,
-/* 0x5ec0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x5ed0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 48,
-/* 0x5ee0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x5ef0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x5f00 */  48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5f10 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x5f20 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 49, 52, 32, 82, 95, 65,
-/* 0x5f30 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5f40 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x5f50 */  49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x5f60 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x5f70 */  48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x5f80 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x5f90 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 56, 32, 82,
-/* 0x5fa0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fb0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x5fc0 */  48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5fd0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x5fe0 */  48, 10, 48, 48, 48, 48, 48, 49, 52, 99, 32, 82, 95, 65, 82, 77,
-/* 0x5ff0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x6000 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 53, 48,
-/* 0x6010 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x6020 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x6030 */  48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x6040 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x6050 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 56, 32, 82, 95, 65,
-/* 0x6060 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x6070 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x6080 */  56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x6090 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x60a0 */  48, 48, 48, 48, 48, 49, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x60b0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x60c0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 97, 48, 32, 82,
-/* 0x60d0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x60e0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x60f0 */  48, 49, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x6100 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x6110 */  48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x6120 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x6130 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,100, 52,
-/* 0x6140 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x6150 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x6160 */  48, 48, 48, 49,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x6170 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x6180 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49,101, 52, 32, 82, 95, 65,
-/* 0x6190 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x61a0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x61b0 */ 101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x61c0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x61d0 */  48, 48, 48, 48, 48, 50, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x61e0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x61f0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 99, 32, 82,
-/* 0x6200 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6210 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x6220 */  48, 50, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x6230 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x6240 */  48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77,
-/* 0x6250 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x6260 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 53, 48,
-/* 0x6270 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x6280 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x6290 */  48, 48, 48, 50, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x62a0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x62b0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 56, 52, 32, 82, 95, 65,
-/* 0x62c0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x62d0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x62e0 */  56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x62f0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x6300 */  48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x6310 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x6320 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82,
-/* 0x6330 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6340 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x6350 */  48, 50,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x6360 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x6370 */  48, 10, 48, 48, 48, 48, 48, 50,100, 99, 32, 82, 95, 65, 82, 77,
-/* 0x6380 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x6390 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,102, 52,
-/* 0x63a0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x63b0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x63c0 */  48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x63d0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x63e0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 49, 52, 32, 82, 95, 65,
-/* 0x63f0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x6400 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x6410 */  50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x6420 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x6430 */  48, 48, 48, 48, 48, 51, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x6440 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x6450 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 56, 32, 82,
-/* 0x6460 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6470 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x6480 */  48, 51, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x6490 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x64a0 */  48, 10, 48, 48, 48, 48, 48, 51, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x64b0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x64c0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 57, 99,
-/* 0x64d0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x64e0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x64f0 */  48, 48, 48, 51, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x6500 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x6510 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 56, 32, 82, 95, 65,
-/* 0x6520 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x6530 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x6540 */  99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x6550 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x6560 */  48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x6570 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x6580 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 48, 48, 32, 82,
-/* 0x6590 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65a0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x65b0 */  48, 52, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x65c0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x65d0 */  48, 10, 48, 48, 48, 48, 48, 52, 52, 48, 32, 82, 95, 65, 82, 77,
-/* 0x65e0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x65f0 */  65, 95, 68, 69, 67, 49, 48, 10
+/* 0x2ee0 */  13,  0,  0,  0, 48,  0,  0,  0, 46,  1,  0,  0,210,  1,  0,  0,
+/* 0x2ef0 */   0,  0,  0,  0, 52,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f00 */   8,  0,  0,  0, 84,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */  17,  0,  0,  0, 92,  0,  0,  0,136,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2f20 */  25,  0,  0,  0,228,  2,  0,  0, 32,  7,  0,  0,  2,  0,  0,  0,
+/* 0x2f30 */  33,  0,  0,  0,  4, 10,  0,  0,220,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f40 */  42,  0,  0,  0,224, 10,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f50 */  51,  0,  0,  0,  4, 11,  0,  0, 20,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2f60 */  57,  0,  0,  0, 24, 12,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2f70 */  63,  0,  0,  0, 24, 13,  0,  0,196,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f80 */  69,  0,  0,  0,220, 13,  0,  0,144,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f90 */  80,  0,  0,  0,108, 14,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0,
+/* 0x2fa0 */  91,  0,  0,  0,164, 23,  0,  0,120,  4,  0,  0,  0,  0,  0,  0,
+/* 0x2fb0 */ 102,  0,  0,  0, 28, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fc0 */  17,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,
+/* 0x2fd0 */   3,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2fe0 */   0,  0,  0,  0, 51,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ff0 */  57,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x3000 */   8,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  9,  0,  0,  0,
+/* 0x3010 */   0,  0,  0,  0, 80,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3020 */  91,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3040 */   0,  0,  0,  0, 42,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3050 */ 102,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,113,  0,  0,  0,
+/* 0x3060 */   4,  0,  0,  0,112,  0,  0,  0,122,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3070 */  88,  0,  0,  0,129,  0,  0,  0,  2,  0,  0,  0,192,  0,  0,  0,
+/* 0x3080 */ 144,  0,  0,  0,  2,  0,  0,  0, 64,  0,  0,  0,151,  0,  0,  0,
+/* 0x3090 */   2,  0,  0,  0,224,  0,  0,  0,158,  0,  0,  0,  2,  0,  0,  0,
+/* 0x30a0 */  80,  0,  0,  0,167,  0,  0,  0,  2,  0,  0,  0, 44,  2,  0,  0,
+/* 0x30b0 */ 177,  0,  0,  0,  2,  0,  0,  0, 96,  0,  0,  0,187,  0,  0,  0,
+/* 0x30c0 */   2,  0,  0,  0,136,  0,  0,  0,192,  0,  0,  0,  2,  0,  0,  0,
+/* 0x30d0 */ 180,  0,  0,  0,206,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30e0 */ 210,  0,  0,  0,  2,  0,  0,  0,200,  0,  0,  0,224,  0,  0,  0,
+/* 0x30f0 */   2,  0,  0,  0, 32,  0,  0,  0,230,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3100 */   0,  0,  0,  0,241,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3110 */   8,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  1,  0,  0,
+/* 0x3120 */   2,  0,  0,  0,104,  0,  0,  0, 26,  1,  0,  0,  2,  0,  0,  0,
+/* 0x3130 */  24,  0,  0,  0, 31,  1,  0,  0,  2,  0,  0,  0, 56,  0,  0,  0,
+/* 0x3140 */  38,  1,  0,  0,  2,  0,  0,  0,180,  1,  0,  0, 47,  1,  0,  0,
+/* 0x3150 */   2,  0,  0,  0,  4,  2,  0,  0, 54,  1,  0,  0,  8,  0,  0,  0,
+/* 0x3160 */   0,  0,  0,  0, 77,  1,  0,  0,  3,  0,  0,  0,220,  1,  0,  0,
+/* 0x3170 */  91,  1,  0,  0,  2,  0,  0,  0, 28,  2,  0,  0,101,  1,  0,  0,
+/* 0x3180 */   2,  0,  0,  0, 12,  0,  0,  0,109,  1,  0,  0,  2,  0,  0,  0,
+/* 0x3190 */ 112,  0,  0,  0,118,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31a0 */ 141,  1,  0,  0,  2,  0,  0,  0, 20,  0,  0,  0,146,  1,  0,  0,
+/* 0x31b0 */  11,  0,  0,  0,  0,  0,  0,  0,157,  1,  0,  0,  2,  0,  0,  0,
+/* 0x31c0 */  72,  0,  0,  0,161,  1,  0,  0,  2,  0,  0,  0, 40,  0,  0,  0,
+/* 0x31d0 */ 166,  1,  0,  0,  2,  0,  0,  0, 44,  2,  0,  0,172,  1,  0,  0,
+/* 0x31e0 */   2,  0,  0,  0,112,  0,  0,  0,181,  1,  0,  0,  2,  0,  0,  0,
+/* 0x31f0 */  48,  0,  0,  0,187,  1,  0,  0,  3,  0,  0,  0,128,  2,  0,  0,
+/* 0x3200 */   0,  0,  0,  0,  8,  0,  0,  0,199,  1,  0,  0,187,  1,  0,  0,
+/* 0x3210 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,220,  0,  0,  0,
+/* 0x3220 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3230 */   2,  0,  0,  0,240,  0,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x3240 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  4,  1,  0,  0,
+/* 0x3250 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3260 */   2,  0,  0,  0, 16,  1,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x3270 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 28,  1,  0,  0,
+/* 0x3280 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3290 */   2,  0,  0,  0, 72,  1,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x32a0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 84,  1,  0,  0,
+/* 0x32b0 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32c0 */   2,  0,  0,  0,100,  1,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x32d0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,112,  1,  0,  0,
+/* 0x32e0 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32f0 */   2,  0,  0,  0,128,  1,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x3300 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,136,  1,  0,  0,
+/* 0x3310 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3320 */   2,  0,  0,  0,160,  1,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x3330 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,172,  1,  0,  0,
+/* 0x3340 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3350 */   2,  0,  0,  0,208,  1,  0,  0,199,  1,  0,  0,151,  0,  0,  0,
+/* 0x3360 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,236,  1,  0,  0,
+/* 0x3370 */ 199,  1,  0,  0,210,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3380 */   2,  0,  0,  0,248,  1,  0,  0,199,  1,  0,  0,151,  0,  0,  0,
+/* 0x3390 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 20,  2,  0,  0,
+/* 0x33a0 */ 199,  1,  0,  0, 47,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33b0 */   3,  0,  0,  0,  4,  0,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x33c0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 48,  0,  0,  0,
+/* 0x33d0 */ 199,  1,  0,  0,101,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33e0 */   3,  0,  0,  0, 56,  0,  0,  0,199,  1,  0,  0,141,  1,  0,  0,
+/* 0x33f0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 88,  0,  0,  0,
+/* 0x3400 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3410 */   3,  0,  0,  0,100,  0,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3420 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,132,  0,  0,  0,
+/* 0x3430 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3440 */   3,  0,  0,  0,188,  0,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3450 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,204,  0,  0,  0,
+/* 0x3460 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3470 */   3,  0,  0,  0,216,  0,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3480 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,236,  0,  0,  0,
+/* 0x3490 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34a0 */   3,  0,  0,  0,248,  0,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x34b0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  1,  0,  0,
+/* 0x34c0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34d0 */   3,  0,  0,  0,  4,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x34e0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 20,  1,  0,  0,
+/* 0x34f0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3500 */   3,  0,  0,  0, 32,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3510 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 44,  1,  0,  0,
+/* 0x3520 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3530 */   3,  0,  0,  0, 52,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3540 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 68,  1,  0,  0,
+/* 0x3550 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3560 */   3,  0,  0,  0, 92,  1,  0,  0,199,  1,  0,  0,113,  0,  0,  0,
+/* 0x3570 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,100,  1,  0,  0,
+/* 0x3580 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3590 */   3,  0,  0,  0,116,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x35a0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,124,  1,  0,  0,
+/* 0x35b0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35c0 */   3,  0,  0,  0,156,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x35d0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,168,  1,  0,  0,
+/* 0x35e0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35f0 */   3,  0,  0,  0,204,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3600 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,228,  1,  0,  0,
+/* 0x3610 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3620 */   3,  0,  0,  0,  4,  2,  0,  0,199,  1,  0,  0,161,  1,  0,  0,
+/* 0x3630 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 24,  2,  0,  0,
+/* 0x3640 */ 199,  1,  0,  0, 26,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3650 */   3,  0,  0,  0, 40,  2,  0,  0,199,  1,  0,  0,181,  1,  0,  0,
+/* 0x3660 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 48,  2,  0,  0,
+/* 0x3670 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3680 */   3,  0,  0,  0, 64,  2,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3690 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 68,  2,  0,  0,
+/* 0x36a0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36b0 */   3,  0,  0,  0, 80,  2,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x36c0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 92,  2,  0,  0,
+/* 0x36d0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36e0 */   3,  0,  0,  0,108,  2,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x36f0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,148,  2,  0,  0,
+/* 0x3700 */ 199,  1,  0,  0, 77,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3710 */   3,  0,  0,  0,220,  2,  0,  0,199,  1,  0,  0,187,  0,  0,  0,
+/* 0x3720 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,236,  2,  0,  0,
+/* 0x3730 */ 199,  1,  0,  0,151,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3740 */   3,  0,  0,  0, 28,  3,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3750 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 52,  3,  0,  0,
+/* 0x3760 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3770 */   3,  0,  0,  0, 68,  3,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3780 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 96,  3,  0,  0,
+/* 0x3790 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37a0 */   3,  0,  0,  0,100,  3,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x37b0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,116,  3,  0,  0,
+/* 0x37c0 */ 199,  1,  0,  0, 13,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37d0 */   3,  0,  0,  0,136,  3,  0,  0,199,  1,  0,  0,224,  0,  0,  0,
+/* 0x37e0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,156,  3,  0,  0,
+/* 0x37f0 */ 199,  1,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3800 */   3,  0,  0,  0,168,  3,  0,  0,199,  1,  0,  0,122,  0,  0,  0,
+/* 0x3810 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,176,  3,  0,  0,
+/* 0x3820 */ 199,  1,  0,  0,230,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3830 */   3,  0,  0,  0,208,  3,  0,  0,199,  1,  0,  0,187,  0,  0,  0,
+/* 0x3840 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,216,  3,  0,  0,
+/* 0x3850 */ 199,  1,  0,  0,181,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3860 */   3,  0,  0,  0,232,  3,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3870 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  8,  4,  0,  0,
+/* 0x3880 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3890 */   3,  0,  0,  0, 20,  4,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x38a0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 44,  4,  0,  0,
+/* 0x38b0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38c0 */   3,  0,  0,  0, 76,  4,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x38d0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,168,  4,  0,  0,
+/* 0x38e0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38f0 */   3,  0,  0,  0,172,  4,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3900 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,188,  4,  0,  0,
+/* 0x3910 */ 199,  1,  0,  0, 13,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3920 */   3,  0,  0,  0,200,  4,  0,  0,199,  1,  0,  0,177,  0,  0,  0,
+/* 0x3930 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,216,  4,  0,  0,
+/* 0x3940 */ 199,  1,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3950 */   3,  0,  0,  0,248,  4,  0,  0,199,  1,  0,  0,187,  0,  0,  0,
+/* 0x3960 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  8,  5,  0,  0,
+/* 0x3970 */ 199,  1,  0,  0,122,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3980 */   3,  0,  0,  0, 20,  5,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3990 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 32,  5,  0,  0,
+/* 0x39a0 */ 199,  1,  0,  0, 38,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39b0 */   3,  0,  0,  0, 84,  5,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x39c0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 96,  5,  0,  0,
+/* 0x39d0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39e0 */   3,  0,  0,  0,108,  5,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x39f0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,116,  5,  0,  0,
+/* 0x3a00 */ 199,  1,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a10 */   3,  0,  0,  0,148,  5,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3a20 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,160,  5,  0,  0,
+/* 0x3a30 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a40 */   3,  0,  0,  0,192,  5,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3a50 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,240,  5,  0,  0,
+/* 0x3a60 */ 199,  1,  0,  0,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a70 */   3,  0,  0,  0,248,  5,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3a80 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,252,  5,  0,  0,
+/* 0x3a90 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3aa0 */   3,  0,  0,  0, 12,  6,  0,  0,199,  1,  0,  0, 13,  1,  0,  0,
+/* 0x3ab0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 28,  6,  0,  0,
+/* 0x3ac0 */ 199,  1,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ad0 */   3,  0,  0,  0, 60,  6,  0,  0,199,  1,  0,  0,187,  0,  0,  0,
+/* 0x3ae0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 72,  6,  0,  0,
+/* 0x3af0 */ 199,  1,  0,  0,181,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b00 */   3,  0,  0,  0, 80,  6,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3b10 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,100,  6,  0,  0,
+/* 0x3b20 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b30 */   3,  0,  0,  0,116,  6,  0,  0,199,  1,  0,  0,122,  0,  0,  0,
+/* 0x3b40 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,140,  6,  0,  0,
+/* 0x3b50 */ 199,  1,  0,  0,230,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b60 */   3,  0,  0,  0,172,  6,  0,  0,199,  1,  0,  0,187,  0,  0,  0,
+/* 0x3b70 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,180,  6,  0,  0,
+/* 0x3b80 */ 199,  1,  0,  0,181,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b90 */   3,  0,  0,  0,184,  6,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3ba0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,208,  6,  0,  0,
+/* 0x3bb0 */ 199,  1,  0,  0,230,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3bc0 */   3,  0,  0,  0,224,  6,  0,  0,199,  1,  0,  0,109,  1,  0,  0,
+/* 0x3bd0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,236,  6,  0,  0,
+/* 0x3be0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3bf0 */   3,  0,  0,  0,248,  6,  0,  0,199,  1,  0,  0,122,  0,  0,  0,
+/* 0x3c00 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 40,  0,  0,  0,
+/* 0x3c10 */ 199,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c20 */   4,  0,  0,  0, 68,  0,  0,  0,199,  1,  0,  0, 33,  0,  0,  0,
+/* 0x3c30 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,132,  0,  0,  0,
+/* 0x3c40 */ 199,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c50 */   4,  0,  0,  0,148,  0,  0,  0,199,  1,  0,  0, 33,  0,  0,  0,
+/* 0x3c60 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,168,  0,  0,  0,
+/* 0x3c70 */ 199,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c80 */   4,  0,  0,  0,184,  0,  0,  0,199,  1,  0,  0, 33,  0,  0,  0,
+/* 0x3c90 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,204,  0,  0,  0,
+/* 0x3ca0 */ 199,  1,  0,  0,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3cb0 */   6,  0,  0,  0, 16,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3cc0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 68,  0,  0,  0,
+/* 0x3cd0 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ce0 */   6,  0,  0,  0, 72,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3cf0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 80,  0,  0,  0,
+/* 0x3d00 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d10 */   6,  0,  0,  0, 92,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3d20 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,104,  0,  0,  0,
+/* 0x3d30 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d40 */   6,  0,  0,  0,116,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3d50 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,120,  0,  0,  0,
+/* 0x3d60 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d70 */   6,  0,  0,  0,132,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3d80 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,148,  0,  0,  0,
+/* 0x3d90 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3da0 */   6,  0,  0,  0,156,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3db0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,160,  0,  0,  0,
+/* 0x3dc0 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3dd0 */   6,  0,  0,  0,168,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3de0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,172,  0,  0,  0,
+/* 0x3df0 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e00 */   6,  0,  0,  0,184,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3e10 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,188,  0,  0,  0,
+/* 0x3e20 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e30 */   6,  0,  0,  0,196,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3e40 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,208,  0,  0,  0,
+/* 0x3e50 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e60 */   6,  0,  0,  0,212,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3e70 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,220,  0,  0,  0,
+/* 0x3e80 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e90 */   6,  0,  0,  0,228,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3ea0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 12,  1,  0,  0,
+/* 0x3eb0 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ec0 */   6,  0,  0,  0, 16,  1,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3ed0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 16,  0,  0,  0,
+/* 0x3ee0 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ef0 */   7,  0,  0,  0, 68,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x3f00 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 72,  0,  0,  0,
+/* 0x3f10 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3f20 */   7,  0,  0,  0, 80,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x3f30 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 92,  0,  0,  0,
+/* 0x3f40 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3f50 */   7,  0,  0,  0,104,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x3f60 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,116,  0,  0,  0,
+/* 0x3f70 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3f80 */   7,  0,  0,  0,120,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x3f90 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,132,  0,  0,  0,
+/* 0x3fa0 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3fb0 */   7,  0,  0,  0,148,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x3fc0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,156,  0,  0,  0,
+/* 0x3fd0 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3fe0 */   7,  0,  0,  0,164,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x3ff0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,176,  0,  0,  0,
+/* 0x4000 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4010 */   7,  0,  0,  0,184,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x4020 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,196,  0,  0,  0,
+/* 0x4030 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4040 */   7,  0,  0,  0,208,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x4050 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,212,  0,  0,  0,
+/* 0x4060 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4070 */   7,  0,  0,  0,248,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x4080 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,252,  0,  0,  0,
+/* 0x4090 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x40a0 */   8,  0,  0,  0, 16,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x40b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 72,  0,  0,  0,
+/* 0x40c0 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x40d0 */   8,  0,  0,  0, 80,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x40e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 84,  0,  0,  0,
+/* 0x40f0 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4100 */   8,  0,  0,  0,100,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x4110 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,104,  0,  0,  0,
+/* 0x4120 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4130 */   8,  0,  0,  0,108,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x4140 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,120,  0,  0,  0,
+/* 0x4150 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4160 */   8,  0,  0,  0,136,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x4170 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,140,  0,  0,  0,
+/* 0x4180 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4190 */   8,  0,  0,  0,148,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x41a0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,156,  0,  0,  0,
+/* 0x41b0 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x41c0 */   8,  0,  0,  0,160,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x41d0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,188,  0,  0,  0,
+/* 0x41e0 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x41f0 */   8,  0,  0,  0,192,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x4200 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  8,  0,  0,  0,
+/* 0x4210 */ 199,  1,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4220 */   9,  0,  0,  0, 76,  0,  0,  0,199,  1,  0,  0, 69,  0,  0,  0,
+/* 0x4230 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,128,  0,  0,  0,
+/* 0x4240 */ 199,  1,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4250 */   9,  0,  0,  0,140,  0,  0,  0,199,  1,  0,  0, 69,  0,  0,  0,
+/* 0x4260 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,116,  0,  0,  0,
+/* 0x4270 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4280 */  10,  0,  0,  0,144,  0,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4290 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,184,  0,  0,  0,
+/* 0x42a0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x42b0 */  10,  0,  0,  0,204,  0,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x42c0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,244,  0,  0,  0,
+/* 0x42d0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x42e0 */  10,  0,  0,  0,  0,  1,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x42f0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  8,  1,  0,  0,
+/* 0x4300 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4310 */  10,  0,  0,  0, 68,  1,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4320 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,144,  1,  0,  0,
+/* 0x4330 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4340 */  10,  0,  0,  0,204,  1,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4350 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,216,  1,  0,  0,
+/* 0x4360 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4370 */  10,  0,  0,  0,  4,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4380 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 24,  2,  0,  0,
+/* 0x4390 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x43a0 */  10,  0,  0,  0, 32,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x43b0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 52,  2,  0,  0,
+/* 0x43c0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x43d0 */  10,  0,  0,  0, 60,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x43e0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 64,  2,  0,  0,
+/* 0x43f0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4400 */  10,  0,  0,  0, 76,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4410 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 88,  2,  0,  0,
+/* 0x4420 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4430 */  10,  0,  0,  0,164,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4440 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,200,  2,  0,  0,
+/* 0x4450 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4460 */  10,  0,  0,  0,232,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4470 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  4,  3,  0,  0,
+/* 0x4480 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4490 */  10,  0,  0,  0, 12,  3,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x44a0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 60,  3,  0,  0,
+/* 0x44b0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x44c0 */  10,  0,  0,  0,136,  3,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x44d0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,160,  3,  0,  0,
+/* 0x44e0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x44f0 */  10,  0,  0,  0,168,  3,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4500 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,204,  3,  0,  0,
+/* 0x4510 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4520 */  10,  0,  0,  0,224,  3,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4530 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,232,  3,  0,  0,
+/* 0x4540 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4550 */  10,  0,  0,  0, 36,  4,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4560 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 56,  4,  0,  0,
+/* 0x4570 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4580 */  10,  0,  0,  0,108,  4,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4590 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,132,  4,  0,  0,
+/* 0x45a0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x45b0 */  10,  0,  0,  0,140,  4,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x45c0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,176,  4,  0,  0,
+/* 0x45d0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x45e0 */  10,  0,  0,  0,212,  4,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x45f0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,236,  4,  0,  0,
+/* 0x4600 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4610 */  10,  0,  0,  0,244,  4,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4620 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 24,  5,  0,  0,
+/* 0x4630 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4640 */  10,  0,  0,  0, 60,  5,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4650 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,152,  5,  0,  0,
+/* 0x4660 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4670 */  10,  0,  0,  0,160,  5,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4680 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,192,  5,  0,  0,
+/* 0x4690 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x46a0 */  10,  0,  0,  0,228,  5,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x46b0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,252,  5,  0,  0,
+/* 0x46c0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x46d0 */  10,  0,  0,  0,  4,  6,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x46e0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 36,  6,  0,  0,
+/* 0x46f0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4700 */  10,  0,  0,  0, 72,  6,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4710 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,128,  6,  0,  0,
+/* 0x4720 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4730 */  10,  0,  0,  0,140,  6,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4740 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,208,  6,  0,  0,
+/* 0x4750 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4760 */  10,  0,  0,  0,236,  6,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4770 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 28,  7,  0,  0,
+/* 0x4780 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4790 */  10,  0,  0,  0, 40,  7,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x47a0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,108,  7,  0,  0,
+/* 0x47b0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x47c0 */  10,  0,  0,  0,124,  7,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x47d0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,156,  7,  0,  0,
+/* 0x47e0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x47f0 */  10,  0,  0,  0,184,  7,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4800 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,196,  7,  0,  0,
+/* 0x4810 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4820 */  10,  0,  0,  0,208,  7,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4830 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,244,  7,  0,  0,
+/* 0x4840 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4850 */  10,  0,  0,  0, 32,  8,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4860 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 44,  8,  0,  0,
+/* 0x4870 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4880 */  10,  0,  0,  0,124,  8,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4890 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,136,  8,  0,  0,
+/* 0x48a0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x48b0 */  10,  0,  0,  0,160,  8,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x48c0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,232,  8,  0,  0,
+/* 0x48d0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x48e0 */  10,  0,  0,  0,244,  8,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x48f0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,252,  8,  0,  0,
+/* 0x4900 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4910 */  10,  0,  0,  0,  4,  9,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4920 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 40,  9,  0,  0,
+/* 0x4930 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4940 */  11,  0,  0,  0,120,  0,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4950 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,128,  0,  0,  0,
+/* 0x4960 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4970 */  11,  0,  0,  0,136,  0,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4980 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,168,  0,  0,  0,
+/* 0x4990 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x49a0 */  11,  0,  0,  0,172,  0,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x49b0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,228,  0,  0,  0,
+/* 0x49c0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x49d0 */  11,  0,  0,  0,  0,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x49e0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 12,  1,  0,  0,
+/* 0x49f0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4a00 */  11,  0,  0,  0, 20,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4a10 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 24,  1,  0,  0,
+/* 0x4a20 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4a30 */  11,  0,  0,  0, 32,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4a40 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 40,  1,  0,  0,
+/* 0x4a50 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4a60 */  11,  0,  0,  0, 68,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4a70 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 76,  1,  0,  0,
+/* 0x4a80 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4a90 */  11,  0,  0,  0, 80,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4aa0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,128,  1,  0,  0,
+/* 0x4ab0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4ac0 */  11,  0,  0,  0,136,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4ad0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,140,  1,  0,  0,
+/* 0x4ae0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4af0 */  11,  0,  0,  0,156,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4b00 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,160,  1,  0,  0,
+/* 0x4b10 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4b20 */  11,  0,  0,  0,192,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4b30 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,204,  1,  0,  0,
+/* 0x4b40 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4b50 */  11,  0,  0,  0,212,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4b60 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,220,  1,  0,  0,
+/* 0x4b70 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4b80 */  11,  0,  0,  0,228,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4b90 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,236,  1,  0,  0,
+/* 0x4ba0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4bb0 */  11,  0,  0,  0, 40,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4bc0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 44,  2,  0,  0,
+/* 0x4bd0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4be0 */  11,  0,  0,  0, 68,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4bf0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 76,  2,  0,  0,
+/* 0x4c00 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4c10 */  11,  0,  0,  0, 80,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4c20 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,104,  2,  0,  0,
+/* 0x4c30 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4c40 */  11,  0,  0,  0,132,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4c50 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,140,  2,  0,  0,
+/* 0x4c60 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4c70 */  11,  0,  0,  0,164,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4c80 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,200,  2,  0,  0,
+/* 0x4c90 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4ca0 */  11,  0,  0,  0,208,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4cb0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,220,  2,  0,  0,
+/* 0x4cc0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4cd0 */  11,  0,  0,  0,244,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4ce0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 12,  3,  0,  0,
+/* 0x4cf0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4d00 */  11,  0,  0,  0, 20,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4d10 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 44,  3,  0,  0,
+/* 0x4d20 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4d30 */  11,  0,  0,  0, 80,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4d40 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 88,  3,  0,  0,
+/* 0x4d50 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4d60 */  11,  0,  0,  0,112,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4d70 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,120,  3,  0,  0,
+/* 0x4d80 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4d90 */  11,  0,  0,  0,156,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4da0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,176,  3,  0,  0,
+/* 0x4db0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4dc0 */  11,  0,  0,  0,184,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4dd0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,200,  3,  0,  0,
+/* 0x4de0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4df0 */  11,  0,  0,  0,204,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4e00 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  4,  0,  0,
+/* 0x4e10 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4e20 */  11,  0,  0,  0, 24,  4,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4e30 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 64,  4,  0,  0,
+/* 0x4e40 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4e50 */  83, 79, 95, 72, 69, 65, 68,  0,112,116,114, 95, 78, 69, 88, 84,
+/* 0x4e60 */   0, 83, 79, 95, 84, 65, 73, 76,  0, 83, 79, 95, 77, 65, 73, 78,
+/* 0x4e70 */   0, 69, 88, 80, 95, 72, 69, 65, 68,  0, 69, 88, 80, 95, 84, 65,
+/* 0x4e80 */  73, 76,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78,
+/* 0x4e90 */  82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0,
+/* 0x4ea0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95,
+/* 0x4eb0 */  68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
+/* 0x4ec0 */   0,102, 95,101,120,112, 97,110,100,  0,109,117,110,109, 97,112,
+/* 0x4ed0 */   0,103,101,116, 95,115,121,115, 95,109,117,110,109, 97,112,  0,
+/* 0x4ee0 */ 103,101,116,112,105,100,  0,109,101,109, 99,112,121,  0,114,101,
+/* 0x4ef0 */  97,100,108,105,110,107,  0, 95, 95,117,100,105,118,115,105, 51,
+/* 0x4f00 */   0,102,116,114,117,110, 99, 97,116,101,  0,109,109, 97,112,  0,
+/* 0x4f10 */  95, 95, 99,108,101, 97,114, 95, 99, 97, 99,104,101,  0,101,111,
+/* 0x4f20 */ 102,  0,109,109, 97,112, 95,112,114,105,118, 97,110,111,110,  0,
+/* 0x4f30 */ 119,114,105,116,101,  0, 80, 70, 95,116,111, 95, 80, 82, 79, 84,
+/* 0x4f40 */   0,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,
+/* 0x4f50 */ 112,114,101,115,115, 95, 56,  0,102,111,108,100,  0,109,101,109,
+/* 0x4f60 */ 102,100, 95, 99,114,101, 97,116,101,  0,114,101, 97,100,  0,117,
+/* 0x4f70 */ 110,108,105,110,107,  0,117,110,100,101,114,108, 97,121,  0,109,
+/* 0x4f80 */ 101,109,115,101,116,  0,117, 99,108, 95,110,114,118, 50, 98, 95,
+/* 0x4f90 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,103,101,116,
+/* 0x4fa0 */  95, 80, 65, 71, 69, 95, 77, 65, 83, 75,  0,109,121, 95, 97,108,
+/* 0x4fb0 */ 108,111, 99, 97,  0,109,121, 95, 98,107,112,116,  0, 80,112,114,
+/* 0x4fc0 */ 111,116,101, 99,116,  0,117, 99,108, 95,110,114,118, 50,101, 95,
+/* 0x4fd0 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,101,120,105,
+/* 0x4fe0 */ 116,  0, 76,122,109, 97, 68,101, 99,111,100,101,  0, 98,114,107,
+/* 0x4ff0 */   0,111,112,101,110,  0,100,105,118, 49, 48,  0,109,112,114,111,
+/* 0x5000 */ 116,101, 99,116,  0, 99,108,111,115,101,  0,117,112,120, 95,115,
+/* 0x5010 */ 111, 95,109, 97,105,110,  0, 82, 95, 65, 82, 77, 95, 80, 67, 50,
+/* 0x5020 */  52,  0,224, 46,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
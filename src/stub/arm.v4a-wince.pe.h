@@ -1,5 +1,5 @@
 /* arm.v4a-wince.pe.h
-   created from arm.v4a-wince.pe.bin, 14676 (0x3954) bytes
+   created from arm.v4a-wince.pe.bin, 9162 (0x23ca) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V4A_WINCE_PE_SIZE    14676
-#define STUB_ARM_V4A_WINCE_PE_ADLER32 0x3e1886fc
-#define STUB_ARM_V4A_WINCE_PE_CRC32   0x3d92a84f
+#define STUB_ARM_V4A_WINCE_PE_SIZE    9162
+#define STUB_ARM_V4A_WINCE_PE_ADLER32 0x1bc9735b
+#define STUB_ARM_V4A_WINCE_PE_CRC32   0xcf96f1b4
 
-unsigned char stub_arm_v4a_wince_pe[14676] = {
+unsigned char stub_arm_v4a_wince_pe[9162] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 156, 15,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -268,690 +268,345 @@ unsigned char stub_arm_v4a_wince_pe[14676] = {
 /* 0x0e50 */  65,  2,  0, 42,  9,  0, 94,225, 73,  2,  0, 10,  1,224,142,226,
 /* 0x0e60 */   4,  0,157,229,  0, 16,157,229, 92, 32,157,229, 14, 48, 96,224,
 /* 0x0e70 */   0,  0,160,227,  0, 48,129,229,  0,176,130,229, 74,  2,  0,234,
-/* 0x0e80 */   1,  0,160,227, 48,208,141,226,240,143,189,232,102,105,108,101,
-/* 0x0e90 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,108,105,
-/* 0x0ea0 */ 116,116,108,101, 97,114,109, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x0eb0 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x0ec0 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x0ed0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x0ee0 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x0ef0 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 68,108,108,
-/* 0x0f00 */  83,116, 97,114,116, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48,
-/* 0x0f10 */  32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x0f20 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 69,120,101,
-/* 0x0f30 */  83,116, 97,114,116, 32, 32, 32, 32, 32, 32, 48, 53, 52, 32, 32,
-/* 0x0f40 */  48, 32, 32, 48, 32, 32, 48, 51, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x0f50 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 80,114,
-/* 0x0f60 */ 111, 99,101,115,115, 69,110,100, 32, 32, 32, 32, 48, 52, 32, 32,
-/* 0x0f70 */  48, 32, 32, 48, 32, 32, 48, 57, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x0f80 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 85,110,
-/* 0x0f90 */ 102,105,108,116,101,114, 95, 48,120, 53, 48, 32, 48, 52, 99, 32,
-/* 0x0fa0 */  32, 48, 32, 32, 48, 32, 32, 48, 57, 52, 32, 32, 50, 42, 42, 48,
-/* 0x0fb0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 82,
-/* 0x0fc0 */ 101,108,111, 99,115, 32, 32, 32, 32, 32, 32, 32, 32, 48, 54, 48,
-/* 0x0fd0 */  32, 32, 48, 32, 32, 48, 32, 32, 48,101, 48, 32, 32, 50, 42, 42,
-/* 0x0fe0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32,
-/* 0x0ff0 */  73,109,112,111,114,116,115, 32, 32, 32, 32, 32, 32, 32, 48, 98,
-/* 0x1000 */  99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 52, 48, 32, 32, 50,
-/* 0x1010 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x1020 */  54, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32,
-/* 0x1030 */  48, 50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102, 99, 32,
-/* 0x1040 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1050 */  32, 32, 55, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,
-/* 0x1060 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 32, 48, 49, 49, 52,
-/* 0x1070 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 49, 99, 32, 32, 50, 42,
-/* 0x1080 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56,
-/* 0x1090 */  32, 67, 97,108,108, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x10a0 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 51, 48, 32, 32, 50,
-/* 0x10b0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x10c0 */  57, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,
-/* 0x10d0 */ 111,109,112,114,101,115,115, 95, 56, 32, 48, 49, 48, 48, 32, 32,
-/* 0x10e0 */  48, 32, 32, 48, 32, 32, 48, 51, 51, 52, 32, 32, 50, 42, 42, 48,
-/* 0x10f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 67,
-/* 0x1100 */  97,108,108, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 48, 52, 32,
-/* 0x1110 */  32, 48, 32, 32, 48, 32, 32, 48, 52, 51, 52, 32, 32, 50, 42, 42,
-/* 0x1120 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32,
-/* 0x1130 */  46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,
-/* 0x1140 */ 112,114,101,115,115, 95, 56, 32, 48, 99, 52, 32, 32, 48, 32, 32,
-/* 0x1150 */  48, 32, 32, 48, 52, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1160 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 67, 97,108,108,
-/* 0x1170 */  50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32,
-/* 0x1180 */  32, 48, 32, 32, 48, 52,102, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1190 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32, 67, 97,108,
-/* 0x11a0 */ 108, 76, 90, 77, 65, 32, 32, 32, 32, 32, 32, 48, 53, 52, 32, 32,
-/* 0x11b0 */  48, 32, 32, 48, 32, 32, 48, 53, 48, 48, 32, 32, 50, 42, 42, 48,
-/* 0x11c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 52, 32, 76,
-/* 0x11d0 */  90, 77, 65, 95, 68, 69, 67, 79, 68, 69, 32, 32, 32, 48, 32, 32,
-/* 0x11e0 */  48, 32, 32, 48, 32, 32, 48, 53, 53, 52, 32, 32, 50, 42, 42, 48,
-/* 0x11f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 53, 32, 76,
-/* 0x1200 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 57, 51,
-/* 0x1210 */  56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 53, 52, 32, 32, 50,
-/* 0x1220 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89,
-/* 0x1230 */  77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48,
-/* 0x1240 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,120,101,
-/* 0x1250 */  83,116, 97,114,116, 32, 48, 32, 69,120,101, 83,116, 97,114,116,
-/* 0x1260 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1270 */  32, 32, 85,110,102,105,108,116,101,114, 95, 48,120, 53, 48, 32,
-/* 0x1280 */  48, 32, 85,110,102,105,108,116,101,114, 95, 48,120, 53, 48, 10,
-/* 0x1290 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x12a0 */  32, 82,101,108,111, 99,115, 32, 48, 32, 82,101,108,111, 99,115,
-/* 0x12b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x12c0 */  32, 32, 73,109,112,111,114,116,115, 32, 48, 32, 73,109,112,111,
-/* 0x12d0 */ 114,116,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x12e0 */  32, 32,100, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,
-/* 0x12f0 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 32, 48, 32, 46,
-/* 0x1300 */ 117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,
-/* 0x1310 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1320 */ 108, 32, 32, 32, 32,100, 32, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x1330 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 32,
-/* 0x1340 */  48, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,
-/* 0x1350 */ 111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1360 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 46,117, 99,108, 95,
-/* 0x1370 */ 110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x1380 */  95, 56, 32, 48, 32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,
-/* 0x1390 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48,
-/* 0x13a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 97,
-/* 0x13b0 */ 108,108, 76, 90, 77, 65, 32, 48, 32, 67, 97,108,108, 76, 90, 77,
-/* 0x13c0 */  65, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x13d0 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69, 32, 48,
-/* 0x13e0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69, 10, 48, 48, 48,
-/* 0x13f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1400 */  77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1410 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1420 */  32, 32, 32, 32,100, 32, 32, 68,108,108, 83,116, 97,114,116, 32,
-/* 0x1430 */  48, 32, 68,108,108, 83,116, 97,114,116, 10, 48, 48, 48, 48, 48,
-/* 0x1440 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80,114,111, 99,
-/* 0x1450 */ 101,115,115, 69,110,100, 32, 48, 32, 80,114,111, 99,101,115,115,
-/* 0x1460 */  69,110,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1470 */  32, 32,100, 32, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 48, 32,
-/* 0x1480 */  85, 80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1490 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 97,108,108, 50, 69,
-/* 0x14a0 */  32, 48, 32, 67, 97,108,108, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x14b0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 97,108,108, 50,
-/* 0x14c0 */  68, 32, 48, 32, 67, 97,108,108, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x14d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 97,108,108,
-/* 0x14e0 */  50, 66, 32, 48, 32, 67, 97,108,108, 50, 66, 10, 48, 48, 48, 48,
-/* 0x14f0 */  48, 48, 50, 99, 32,103, 32, 32, 32, 32, 32, 32, 32, 69,120,101,
-/* 0x1500 */  83,116, 97,114,116, 32, 48, 32, 83, 82, 67, 48, 10, 48, 48, 48,
-/* 0x1510 */  48, 48, 48, 51, 52, 32,103, 32, 32, 32, 32, 32, 32, 32, 69,120,
-/* 0x1520 */ 101, 83,116, 97,114,116, 32, 48, 32, 68, 83, 84, 48, 10, 48, 48,
-/* 0x1530 */  48, 48, 48, 48, 51, 99, 32,103, 32, 32, 32, 32, 32, 32, 32, 69,
-/* 0x1540 */ 120,101, 83,116, 97,114,116, 32, 48, 32, 73, 65, 84, 84, 10, 48,
-/* 0x1550 */  48, 48, 48, 48, 48, 52, 99, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1560 */  69,120,101, 83,116, 97,114,116, 32, 48, 32, 69, 78, 84, 82, 10,
-/* 0x1570 */  48, 48, 48, 48, 48, 48, 52, 52, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x1580 */  32, 85,110,102,105,108,116,101,114, 95, 48,120, 53, 48, 32, 48,
-/* 0x1590 */  32, 70, 73, 66, 83, 10, 48, 48, 48, 48, 48, 48, 52, 56, 32,103,
-/* 0x15a0 */  32, 32, 32, 32, 32, 32, 32, 85,110,102,105,108,116,101,114, 95,
-/* 0x15b0 */  48,120, 53, 48, 32, 48, 32, 70, 73, 66, 69, 10, 48, 48, 48, 48,
-/* 0x15c0 */  48, 48, 53, 99, 32,103, 32, 32, 32, 32, 32, 32, 32, 82,101,108,
-/* 0x15d0 */ 111, 99,115, 32, 48, 32, 66, 82, 69, 76, 10, 48, 48, 48, 48, 48,
-/* 0x15e0 */  48, 98, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,
-/* 0x15f0 */ 114,116,115, 32, 48, 32, 66, 73, 77, 80, 10, 48, 48, 48, 48, 48,
-/* 0x1600 */  48, 98, 52, 32,103, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,
-/* 0x1610 */ 114,116,115, 32, 48, 32, 79, 78, 65, 77, 10, 48, 48, 48, 48, 48,
-/* 0x1620 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x1630 */  42, 32, 48, 32,115,116, 97,114,116, 95,111,102, 95, 99,111,109,
-/* 0x1640 */ 112,114,101,115,115,101,100, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1650 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x1660 */  32, 99,111,109,112,114,101,115,115,101,100, 95,108,101,110,103,
-/* 0x1670 */ 116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x1680 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,115,116, 97,114,
-/* 0x1690 */ 116, 95,111,102, 95,117,110, 99,111,109,112,114,101,115,115,101,
-/* 0x16a0 */ 100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x16b0 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,117,110, 99,111,109,
-/* 0x16c0 */ 112,114,101,115,115,101,100, 95,108,101,110,103,116,104, 10, 48,
-/* 0x16d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x16e0 */  42, 85, 78, 68, 42, 32, 48, 32,111,114,105,103,105,110, 97,108,
-/* 0x16f0 */  95,101,110,116,114,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1700 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x1710 */ 102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,116,
-/* 0x1720 */  97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x1730 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,108,
-/* 0x1740 */ 116,101,114, 95, 98,117,102,102,101,114, 95,101,110,100, 10, 48,
-/* 0x1750 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1760 */  42, 85, 78, 68, 42, 32, 48, 32,115,116, 97,114,116, 95,111,102,
-/* 0x1770 */  95,114,101,108,111, 99,115, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1780 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x1790 */  32,115,116, 97,114,116, 95,111,102, 95,105,109,112,111,114,116,
-/* 0x17a0 */ 115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x17b0 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,115,116, 97,114,116,
-/* 0x17c0 */  95,111,102, 95,100,108,108, 95,110, 97,109,101,115, 10, 48, 48,
-/* 0x17d0 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 46,
-/* 0x17e0 */ 117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,
-/* 0x17f0 */ 114,101,115,115, 95, 56, 32, 48, 49, 49, 52, 32,117, 99,108, 95,
-/* 0x1800 */ 110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x1810 */  95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x1820 */  32, 32, 70, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,
-/* 0x1830 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 32, 48, 49, 48, 48,
-/* 0x1840 */  32,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,
-/* 0x1850 */ 112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1860 */  32,103, 32, 32, 32, 32, 32, 70, 32, 46,117, 99,108, 95,110,114,
-/* 0x1870 */ 118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x1880 */  32, 48, 99, 52, 32,117, 99,108, 95,110,114,118, 50, 98, 95,100,
-/* 0x1890 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x18a0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x18b0 */  68, 42, 32, 48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10,
-/* 0x18c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x18d0 */  32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,115,116,
-/* 0x18e0 */  97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48,
-/* 0x18f0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x1900 */  42, 32, 48, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48,
-/* 0x1910 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1920 */  42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,112,114,111,
-/* 0x1930 */ 112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x1940 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x1950 */  91, 68,108,108, 83,116, 97,114,116, 93, 58, 10, 79, 70, 70, 83,
-/* 0x1960 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1970 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x1980 */  48, 48, 48, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1990 */  32, 32, 32, 32, 32, 32, 32, 32, 69,120,101, 83,116, 97,114,116,
-/* 0x19a0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x19b0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,120,101, 83,116, 97,
-/* 0x19c0 */ 114,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x19d0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x19e0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 52, 32, 82,
-/* 0x19f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a00 */  32, 69,120,101, 83,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  49, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1a20 */  32, 32, 32, 32, 32, 69,120,101, 83,116, 97,114,116, 10, 48, 48,
-/* 0x1a30 */  48, 48, 48, 48, 50, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83,
-/* 0x1a40 */  51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,
-/* 0x1a50 */ 102, 95, 99,111,109,112,114,101,115,115,101,100, 10, 48, 48, 48,
-/* 0x1a60 */  48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51,
-/* 0x1a70 */  50, 32, 32, 32, 32, 32, 32, 32, 99,111,109,112,114,101,115,115,
-/* 0x1a80 */ 101,100, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1a90 */  51, 52, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32,
-/* 0x1aa0 */  32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,102, 95,117,110,
-/* 0x1ab0 */  99,111,109,112,114,101,115,115,101,100, 10, 48, 48, 48, 48, 48,
-/* 0x1ac0 */  48, 51, 56, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32,
-/* 0x1ad0 */  32, 32, 32, 32, 32, 32,117,110, 99,111,109,112,114,101,115,115,
-/* 0x1ae0 */ 101,100, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1af0 */  52, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32,
-/* 0x1b00 */  32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108, 95,101,110,
-/* 0x1b10 */ 116,114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x1b20 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 85,110,102,
-/* 0x1b30 */ 105,108,116,101,114, 95, 48,120, 53, 48, 93, 58, 10, 79, 70, 70,
-/* 0x1b40 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x1b50 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x1b60 */  48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1b70 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 85,110,102,105,108,116,101,
-/* 0x1b80 */ 114, 95, 48,120, 53, 48, 10, 48, 48, 48, 48, 48, 48, 50, 48, 32,
-/* 0x1b90 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1ba0 */  32, 32, 85,110,102,105,108,116,101,114, 95, 48,120, 53, 48, 10,
-/* 0x1bb0 */  48, 48, 48, 48, 48, 48, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1bc0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 85,110,102,105,108,
-/* 0x1bd0 */ 116,101,114, 95, 48,120, 53, 48, 10, 48, 48, 48, 48, 48, 48, 52,
-/* 0x1be0 */  52, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32,
-/* 0x1bf0 */  32, 32, 32, 32,102,105,108,116,101,114, 95, 98,117,102,102,101,
-/* 0x1c00 */ 114, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 52, 56,
-/* 0x1c10 */  32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32,
-/* 0x1c20 */  32, 32, 32,102,105,108,116,101,114, 95, 98,117,102,102,101,114,
-/* 0x1c30 */  95,101,110,100, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x1c40 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 82,101,
-/* 0x1c50 */ 108,111, 99,115, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x1c60 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c70 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48,
-/* 0x1c80 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1c90 */  32, 32, 32, 82,101,108,111, 99,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1ca0 */  53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1cb0 */  32, 32, 32, 32, 32, 82,101,108,111, 99,115, 10, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 53, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x1cd0 */  32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,102, 95,
-/* 0x1ce0 */ 114,101,108,111, 99,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x1cf0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x1d00 */  73,109,112,111,114,116,115, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1d10 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d20 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1d30 */  48, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1d40 */  32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115, 10, 48, 48,
-/* 0x1d50 */  48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1d60 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115,
-/* 0x1d70 */  10, 48, 48, 48, 48, 48, 48, 50, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1d80 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,
-/* 0x1d90 */ 114,116,115, 10, 48, 48, 48, 48, 48, 48, 51, 52, 32, 82, 95, 65,
-/* 0x1da0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 73,
-/* 0x1db0 */ 109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 52, 48, 32,
-/* 0x1dc0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1dd0 */  32, 32, 73,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1de0 */  53, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1df0 */  32, 32, 32, 32, 32, 73,109,112,111,114,116,115, 10, 48, 48, 48,
-/* 0x1e00 */  48, 48, 48, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1e10 */  32, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115, 10,
-/* 0x1e20 */  48, 48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1e30 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,
-/* 0x1e40 */ 116,115, 10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82,
-/* 0x1e50 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 73,109,
-/* 0x1e60 */ 112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82,
-/* 0x1e70 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e80 */  32, 73,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 56,
-/* 0x1e90 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1ea0 */  32, 32, 32, 32, 73,109,112,111,114,116,115, 10, 48, 48, 48, 48,
-/* 0x1eb0 */  48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1ec0 */  32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115, 10, 48,
-/* 0x1ed0 */  48, 48, 48, 48, 48, 98, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66,
-/* 0x1ee0 */  83, 51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,
-/* 0x1ef0 */ 111,102, 95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48,
-/* 0x1f00 */  48, 98, 52, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32,
-/* 0x1f10 */  32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,102, 95,100,
-/* 0x1f20 */ 108,108, 95,110, 97,109,101,115, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x1f30 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x1f40 */  32, 91, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
-/* 0x1f50 */ 111,109,112,114,101,115,115, 95, 56, 93, 58, 10, 79, 70, 70, 83,
-/* 0x1f60 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f70 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x1f80 */  48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1f90 */  32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x1fa0 */  50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1fc0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,
-/* 0x1fd0 */ 110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x1fe0 */  95, 56, 10, 48, 48, 48, 48, 48, 48, 52, 56, 32, 82, 95, 65, 82,
-/* 0x1ff0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117,
-/* 0x2000 */  99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,
-/* 0x2010 */ 101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 53, 48, 32, 82,
-/* 0x2020 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2030 */  32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,
-/* 0x2040 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 53,
-/* 0x2050 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2060 */  32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,
-/* 0x2070 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x2080 */  48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2090 */  32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,
-/* 0x20a0 */ 101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48,
-/* 0x20b0 */  48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x20c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,
-/* 0x20d0 */ 114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x20e0 */  56, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x20f0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,
-/* 0x2100 */ 108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,
-/* 0x2110 */ 115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95,
-/* 0x2120 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2130 */  46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,
-/* 0x2140 */ 112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 57, 52,
-/* 0x2150 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2160 */  32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,101,
-/* 0x2170 */  99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48,
-/* 0x2180 */  48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2190 */  32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101,
-/* 0x21a0 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x21b0 */  48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x21c0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,
-/* 0x21d0 */ 118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x21e0 */  10, 48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x21f0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108,
-/* 0x2200 */  95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x2210 */ 115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65,
-/* 0x2220 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,
-/* 0x2230 */ 117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,
-/* 0x2240 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32,
-/* 0x2250 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2260 */  32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
-/* 0x2270 */ 111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2280 */  98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2290 */  32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,
-/* 0x22a0 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48,
-/* 0x22b0 */  48, 48, 48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x22c0 */  32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x22d0 */  50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10,
-/* 0x22e0 */  48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x22f0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,
-/* 0x2300 */ 110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x2310 */  95, 56, 10, 48, 48, 48, 48, 48, 48,100, 52, 32, 82, 95, 65, 82,
-/* 0x2320 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117,
-/* 0x2330 */  99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,
-/* 0x2340 */ 101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82,
-/* 0x2350 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2360 */  32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,
-/* 0x2370 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,101,
-/* 0x2380 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2390 */  32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,
-/* 0x23a0 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x23b0 */  48, 49, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x23c0 */  32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,
-/* 0x23d0 */ 101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48,
-/* 0x23e0 */  48, 48, 48, 48, 49, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x23f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,
-/* 0x2400 */ 114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x2410 */  56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x2420 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 97,108,108, 50,
-/* 0x2430 */  69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x2440 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2450 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95,
-/* 0x2460 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2470 */ 117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,
-/* 0x2480 */ 114,101,115,115, 95, 56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2490 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x24a0 */  46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,
-/* 0x24b0 */ 112,114,101,115,115, 95, 56, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x24c0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x24d0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x24e0 */  48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x24f0 */  32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,100,
-/* 0x2500 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x2510 */  48, 48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2520 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,
-/* 0x2530 */ 118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x2540 */  10, 48, 48, 48, 48, 48, 48, 52, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2550 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108,
-/* 0x2560 */  95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x2570 */ 115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 53, 48, 32, 82, 95, 65,
-/* 0x2580 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,
-/* 0x2590 */ 117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,
-/* 0x25a0 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 53, 99, 32,
-/* 0x25b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x25c0 */  32, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,
-/* 0x25d0 */ 111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x25e0 */  54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x25f0 */  32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,
-/* 0x2600 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48,
-/* 0x2610 */  48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2620 */  32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x2630 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10,
-/* 0x2640 */  48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2650 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,
-/* 0x2660 */ 110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x2670 */  95, 56, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82,
-/* 0x2680 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117,
-/* 0x2690 */  99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,
-/* 0x26a0 */ 101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82,
-/* 0x26b0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26c0 */  32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,
-/* 0x26d0 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 57,
-/* 0x26e0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x26f0 */  32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,
-/* 0x2700 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x2710 */  48, 48, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2720 */  32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,
-/* 0x2730 */ 100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48,
-/* 0x2740 */  48, 48, 48, 48, 48, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2750 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,
-/* 0x2760 */ 114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x2770 */  56, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2780 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,
-/* 0x2790 */ 108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,
-/* 0x27a0 */ 115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95,
-/* 0x27b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27c0 */  46,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,
-/* 0x27d0 */ 112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48,100, 48,
-/* 0x27e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x27f0 */  32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,100, 95,100,101,
-/* 0x2800 */  99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48,
-/* 0x2810 */  48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2820 */  32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,100,
-/* 0x2830 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x2840 */  48, 48, 48, 48,102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2850 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,
-/* 0x2860 */ 118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x2870 */  10, 48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2880 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108,
-/* 0x2890 */  95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x28a0 */ 115, 95, 56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x28b0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 97,108,
-/* 0x28c0 */ 108, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x28d0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x28e0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x28f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2900 */  32, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,
-/* 0x2910 */ 109,112,114,101,115,115, 95, 56, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2920 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2930 */  32, 91, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,
-/* 0x2940 */ 111,109,112,114,101,115,115, 95, 56, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2950 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2960 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2970 */  48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2980 */  32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118,
-/* 0x2990 */  50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10,
-/* 0x29a0 */  48, 48, 48, 48, 48, 48, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x29b0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,
-/* 0x29c0 */ 110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x29d0 */  95, 56, 10, 48, 48, 48, 48, 48, 48, 53, 48, 32, 82, 95, 65, 82,
-/* 0x29e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117,
-/* 0x29f0 */  99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,
-/* 0x2a00 */ 101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 53, 52, 32, 82,
-/* 0x2a10 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a20 */  32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,
-/* 0x2a30 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 54,
-/* 0x2a40 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2a50 */  32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,
-/* 0x2a60 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x2a70 */  48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2a80 */  32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50,
-/* 0x2a90 */  98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48,
-/* 0x2aa0 */  48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2ab0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,
-/* 0x2ac0 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x2ad0 */  56, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2ae0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,
-/* 0x2af0 */ 108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,
-/* 0x2b00 */ 115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95,
-/* 0x2b10 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b20 */  46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,
-/* 0x2b30 */ 112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 56, 99,
-/* 0x2b40 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2b50 */  32, 32, 32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101,
-/* 0x2b60 */  99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48,
-/* 0x2b70 */  48, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2b80 */  32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,118, 50, 98,
-/* 0x2b90 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x2ba0 */  48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2bb0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108, 95,110,114,
-/* 0x2bc0 */ 118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x2bd0 */  10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2be0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,117, 99,108,
-/* 0x2bf0 */  95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x2c00 */ 115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65,
-/* 0x2c10 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 46,
-/* 0x2c20 */ 117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,
-/* 0x2c30 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 99, 48, 32,
-/* 0x2c40 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2c50 */  32, 32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,
-/* 0x2c60 */ 111,109,112,114,101,115,115, 95, 56, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2c70 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2c80 */  82, 32, 91, 67, 97,108,108, 50, 66, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2c90 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ca0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2cb0 */  48, 48, 48, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2cc0 */  32, 32, 32, 32, 32, 32, 32, 32,117, 99,108, 95,110,114,118, 50,
-/* 0x2cd0 */  98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 10,
-/* 0x2ce0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2cf0 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 97,108,108, 76, 90, 77, 65,
-/* 0x2d00 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2d10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x2d20 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 99, 32, 82, 95, 65,
-/* 0x2d30 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0x2d40 */  97,108,108, 76, 90, 77, 65, 10, 48, 48, 48, 48, 48, 48, 51, 56,
-/* 0x2d50 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2d60 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69, 10, 48,
-/* 0x2d70 */  48, 48, 48, 48, 48, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2d80 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 67, 97,108,108, 76, 90,
-/* 0x2d90 */  77, 65, 10, 48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95, 65, 82,
-/* 0x2da0 */  77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x2db0 */ 109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 52,
-/* 0x2dc0 */  56, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32,
-/* 0x2dd0 */  32, 32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,
-/* 0x2de0 */ 100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 52, 99, 32, 82,
-/* 0x2df0 */  95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x2e00 */  32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x2e10 */  48, 48, 53, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x2e20 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,
-/* 0x2e30 */ 101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2e40 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2e50 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x2e60 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2e70 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2e80 */  48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2e90 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2ea0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65,
-/* 0x2eb0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2ec0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2ed0 */  98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2ee0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x2ef0 */  48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2f00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2f10 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82,
-/* 0x2f20 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2f30 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x2f40 */  48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2f50 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x2f60 */  48, 10, 48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2f70 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2f80 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52,
-/* 0x2f90 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2fa0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x2fb0 */  48, 48, 48, 49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2fc0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2fd0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65,
-/* 0x2fe0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2ff0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3000 */ 100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3010 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3020 */  48, 48, 48, 48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3030 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3040 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56, 32, 82,
-/* 0x3050 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3060 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3070 */  48, 50, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3080 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3090 */  48, 10, 48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65, 82, 77,
-/* 0x30a0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x30b0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 51, 99,
-/* 0x30c0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x30d0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x30e0 */  48, 48, 48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x30f0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3100 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65,
-/* 0x3110 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3120 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3130 */  53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3140 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3150 */  48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3160 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3170 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82,
-/* 0x3180 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3190 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x31a0 */  48, 50,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x31b0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x31c0 */  48, 10, 48, 48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65, 82, 77,
-/* 0x31d0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x31e0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99,
-/* 0x31f0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3200 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3210 */  48, 48, 48, 51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3220 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3230 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82, 95, 65,
-/* 0x3240 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3250 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x3260 */  97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3270 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3280 */  48, 48, 48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3290 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x32a0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82,
-/* 0x32b0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x32c0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x32d0 */  48, 51,101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x32e0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x32f0 */  48, 10, 48, 48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3300 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3310 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 50, 52,
-/* 0x3320 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3330 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3340 */  48, 48, 48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3350 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3360 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82, 95, 65,
-/* 0x3370 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3380 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x3390 */  56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x33a0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x33b0 */  48, 48, 48, 48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x33c0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x33d0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48, 32, 82,
-/* 0x33e0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x33f0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3400 */  48, 52,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3410 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3420 */  48, 10, 48, 48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3430 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3440 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52,102, 52,
-/* 0x3450 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3460 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3470 */  48, 48, 48, 53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3480 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3490 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82, 95, 65,
-/* 0x34a0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x34b0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 53,
-/* 0x34c0 */  57, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x34d0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x34e0 */  48, 48, 48, 48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x34f0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3500 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48, 32, 82,
-/* 0x3510 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3520 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3530 */  48, 53,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3540 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3550 */  48, 10, 48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3560 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3570 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 54, 48, 52,
-/* 0x3580 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3590 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x35a0 */  48, 48, 48, 54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x35b0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x35c0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82, 95, 65,
-/* 0x35d0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x35e0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x35f0 */  56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3600 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3610 */  48, 48, 48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3620 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3630 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 54,100, 48, 32, 82,
-/* 0x3640 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3650 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3660 */  48, 54,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3670 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3680 */  48, 10, 48, 48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3690 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x36a0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 55, 50, 56,
-/* 0x36b0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x36c0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x36d0 */  48, 48, 48, 55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x36e0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x36f0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82, 95, 65,
-/* 0x3700 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3710 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x3720 */  57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3730 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3740 */  48, 48, 48, 48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3750 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3760 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52, 32, 82,
-/* 0x3770 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3780 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3790 */  48, 55,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x37a0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x37b0 */  48, 10, 48, 48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65, 82, 77,
-/* 0x37c0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x37d0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 56, 50, 48,
-/* 0x37e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x37f0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3800 */  48, 48, 48, 56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3810 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3820 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82, 95, 65,
-/* 0x3830 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3840 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x3850 */  56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3860 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3870 */  48, 48, 48, 48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3880 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3890 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 56,101, 56, 32, 82,
-/* 0x38a0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x38b0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x38c0 */  48, 56,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x38d0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x38e0 */  48, 10, 48, 48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65, 82, 77,
-/* 0x38f0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3900 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 57, 48, 52,
-/* 0x3910 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3920 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3930 */  48, 48, 48, 57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3940 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3950 */  67, 49, 48, 10
+/* 0x0e80 */   1,  0,160,227, 48,208,141,226,240,143,189,232, 16,  0,  0,  0,
+/* 0x0e90 */  42,  0,  0,  0,170,  0,  0,  0, 58,  2,  0,  0,  0,  0,  0,  0,
+/* 0x0ea0 */  52,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x0eb0 */  60,  0,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x0ec0 */ 144,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,
+/* 0x0ed0 */ 148,  0,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0, 43,  0,  0,  0,
+/* 0x0ee0 */ 224,  0,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,
+/* 0x0ef0 */  64,  1,  0,  0,188,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,
+/* 0x0f00 */ 252,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x0f10 */  28,  2,  0,  0, 20,  1,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,
+/* 0x0f20 */  48,  3,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x0f30 */  52,  3,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,122,  0,  0,  0,
+/* 0x0f40 */  52,  4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,
+/* 0x0f50 */  56,  4,  0,  0,196,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,
+/* 0x0f60 */ 252,  4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,160,  0,  0,  0,
+/* 0x0f70 */   0,  5,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,169,  0,  0,  0,
+/* 0x0f80 */  84,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,181,  0,  0,  0,
+/* 0x0f90 */  84,  5,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x0fa0 */   1,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,  3,  0,  0,  0,
+/* 0x0fb0 */   0,  0,  0,  0, 43,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0fc0 */  50,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x0fd0 */   7,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,  9,  0,  0,  0,
+/* 0x0fe0 */   0,  0,  0,  0,129,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0ff0 */ 160,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,169,  0,  0,  0,
+/* 0x1000 */  14,  0,  0,  0,  0,  0,  0,  0,181,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1010 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1020 */  18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,
+/* 0x1030 */   6,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1040 */   0,  0,  0,  0,122,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1050 */ 153,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,192,  0,  0,  0,
+/* 0x1060 */   1,  0,  0,  0, 44,  0,  0,  0,197,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1070 */  52,  0,  0,  0,202,  0,  0,  0,  1,  0,  0,  0, 60,  0,  0,  0,
+/* 0x1080 */ 207,  0,  0,  0,  1,  0,  0,  0, 76,  0,  0,  0,212,  0,  0,  0,
+/* 0x1090 */   3,  0,  0,  0, 68,  0,  0,  0,217,  0,  0,  0,  3,  0,  0,  0,
+/* 0x10a0 */  72,  0,  0,  0,222,  0,  0,  0,  4,  0,  0,  0, 92,  0,  0,  0,
+/* 0x10b0 */ 227,  0,  0,  0,  5,  0,  0,  0,176,  0,  0,  0,232,  0,  0,  0,
+/* 0x10c0 */   5,  0,  0,  0,180,  0,  0,  0,237,  0,  0,  0, 17,  0,  0,  0,
+/* 0x10d0 */ 173,222,173,222,  1,  1,  0,  0, 17,  0,  0,  0,173,222,173,222,
+/* 0x10e0 */  19,  1,  0,  0, 17,  0,  0,  0,173,222,173,222, 41,  1,  0,  0,
+/* 0x10f0 */  17,  0,  0,  0,173,222,173,222, 61,  1,  0,  0, 17,  0,  0,  0,
+/* 0x1100 */ 173,222,173,222, 76,  1,  0,  0, 17,  0,  0,  0,173,222,173,222,
+/* 0x1110 */  96,  1,  0,  0, 17,  0,  0,  0,173,222,173,222,114,  1,  0,  0,
+/* 0x1120 */  17,  0,  0,  0,173,222,173,222,130,  1,  0,  0, 17,  0,  0,  0,
+/* 0x1130 */ 173,222,173,222,147,  1,  0,  0, 17,  0,  0,  0,173,222,173,222,
+/* 0x1140 */ 166,  1,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,189,  1,  0,  0,
+/* 0x1150 */   9,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0, 11,  0,  0,  0,
+/* 0x1160 */   0,  0,  0,  0,235,  1,  0,  0, 17,  0,  0,  0,173,222,173,222,
+/* 0x1170 */ 246,  1,  0,  0, 17,  0,  0,  0,173,222,173,222,  8,  2,  0,  0,
+/* 0x1180 */  17,  0,  0,  0,173,222,173,222, 19,  2,  0,  0, 17,  0,  0,  0,
+/* 0x1190 */ 173,222,173,222,  0,  0,  0,  0,  4,  0,  0,  0, 35,  2,  0,  0,
+/* 0x11a0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x11b0 */  20,  0,  0,  0, 35,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x11c0 */   0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0, 35,  2,  0,  0,
+/* 0x11d0 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x11e0 */  44,  0,  0,  0, 46,  2,  0,  0,237,  0,  0,  0,  0,  0,  0,  0,
+/* 0x11f0 */   0,  0,  0,  0,  1,  0,  0,  0, 48,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1200 */   1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1210 */  52,  0,  0,  0, 46,  2,  0,  0, 19,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1220 */   0,  0,  0,  0,  1,  0,  0,  0, 56,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1230 */  41,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1240 */  76,  0,  0,  0, 46,  2,  0,  0, 61,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1250 */   0,  0,  0,  0,  3,  0,  0,  0, 16,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1260 */  29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1270 */  32,  0,  0,  0, 35,  2,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1280 */   0,  0,  0,  0,  3,  0,  0,  0, 64,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1290 */  29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x12a0 */  68,  0,  0,  0, 46,  2,  0,  0, 76,  1,  0,  0,  0,  0,  0,  0,
+/* 0x12b0 */   0,  0,  0,  0,  3,  0,  0,  0, 72,  0,  0,  0, 46,  2,  0,  0,
+/* 0x12c0 */  96,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x12d0 */  16,  0,  0,  0, 35,  2,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12e0 */   0,  0,  0,  0,  4,  0,  0,  0, 88,  0,  0,  0, 35,  2,  0,  0,
+/* 0x12f0 */  43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1300 */  92,  0,  0,  0, 46,  2,  0,  0,114,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1310 */   0,  0,  0,  0,  5,  0,  0,  0, 12,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1320 */  50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1330 */  16,  0,  0,  0, 35,  2,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1340 */   0,  0,  0,  0,  5,  0,  0,  0, 44,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1350 */  50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1360 */  52,  0,  0,  0, 35,  2,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1370 */   0,  0,  0,  0,  5,  0,  0,  0, 64,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1380 */  50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1390 */  84,  0,  0,  0, 35,  2,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13a0 */   0,  0,  0,  0,  5,  0,  0,  0, 88,  0,  0,  0, 35,  2,  0,  0,
+/* 0x13b0 */  50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x13c0 */ 104,  0,  0,  0, 35,  2,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13d0 */   0,  0,  0,  0,  5,  0,  0,  0,108,  0,  0,  0, 35,  2,  0,  0,
+/* 0x13e0 */  50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x13f0 */ 128,  0,  0,  0, 35,  2,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1400 */   0,  0,  0,  0,  5,  0,  0,  0,136,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1410 */  50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1420 */ 156,  0,  0,  0, 35,  2,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1430 */   0,  0,  0,  0,  5,  0,  0,  0,176,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1440 */ 130,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1450 */ 180,  0,  0,  0, 46,  2,  0,  0,147,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1460 */   0,  0,  0,  0,  7,  0,  0,  0, 16,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1470 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1480 */  68,  0,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  7,  0,  0,  0, 72,  0,  0,  0, 35,  2,  0,  0,
+/* 0x14a0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x14b0 */  80,  0,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14c0 */   0,  0,  0,  0,  7,  0,  0,  0, 92,  0,  0,  0, 35,  2,  0,  0,
+/* 0x14d0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x14e0 */ 104,  0,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0,  7,  0,  0,  0,116,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1500 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1510 */ 120,  0,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   0,  0,  0,  0,  7,  0,  0,  0,132,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1530 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1540 */ 148,  0,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1550 */   0,  0,  0,  0,  7,  0,  0,  0,156,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1560 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1570 */ 160,  0,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */   0,  0,  0,  0,  7,  0,  0,  0,168,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1590 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x15a0 */ 172,  0,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */   0,  0,  0,  0,  7,  0,  0,  0,184,  0,  0,  0, 35,  2,  0,  0,
+/* 0x15c0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x15d0 */ 188,  0,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */   0,  0,  0,  0,  7,  0,  0,  0,196,  0,  0,  0, 35,  2,  0,  0,
+/* 0x15f0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1600 */ 208,  0,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */   0,  0,  0,  0,  7,  0,  0,  0,212,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1620 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1630 */ 220,  0,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */   0,  0,  0,  0,  7,  0,  0,  0,228,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1650 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1660 */  12,  1,  0,  0, 35,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   0,  0,  0,  0,  7,  0,  0,  0, 16,  1,  0,  0, 35,  2,  0,  0,
+/* 0x1680 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1690 */   0,  0,  0,  0, 35,  2,  0,  0,166,  1,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */   0,  0,  0,  0,  9,  0,  0,  0, 16,  0,  0,  0, 35,  2,  0,  0,
+/* 0x16b0 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x16c0 */  68,  0,  0,  0, 35,  2,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16d0 */   0,  0,  0,  0,  9,  0,  0,  0, 72,  0,  0,  0, 35,  2,  0,  0,
+/* 0x16e0 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x16f0 */  80,  0,  0,  0, 35,  2,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1700 */   0,  0,  0,  0,  9,  0,  0,  0, 92,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1710 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1720 */ 104,  0,  0,  0, 35,  2,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1730 */   0,  0,  0,  0,  9,  0,  0,  0,116,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1740 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1750 */ 120,  0,  0,  0, 35,  2,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1760 */   0,  0,  0,  0,  9,  0,  0,  0,132,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1770 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1780 */ 148,  0,  0,  0, 35,  2,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1790 */   0,  0,  0,  0,  9,  0,  0,  0,156,  0,  0,  0, 35,  2,  0,  0,
+/* 0x17a0 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x17b0 */ 164,  0,  0,  0, 35,  2,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */   0,  0,  0,  0,  9,  0,  0,  0,176,  0,  0,  0, 35,  2,  0,  0,
+/* 0x17d0 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x17e0 */ 184,  0,  0,  0, 35,  2,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17f0 */   0,  0,  0,  0,  9,  0,  0,  0,196,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1800 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1810 */ 208,  0,  0,  0, 35,  2,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1820 */   0,  0,  0,  0,  9,  0,  0,  0,212,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1830 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1840 */ 248,  0,  0,  0, 35,  2,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1850 */   0,  0,  0,  0,  9,  0,  0,  0,252,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1860 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1870 */   0,  0,  0,  0, 35,  2,  0,  0,189,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1880 */   0,  0,  0,  0, 11,  0,  0,  0, 16,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1890 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x18a0 */  72,  0,  0,  0, 35,  2,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0, 11,  0,  0,  0, 80,  0,  0,  0, 35,  2,  0,  0,
+/* 0x18c0 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x18d0 */  84,  0,  0,  0, 35,  2,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0, 11,  0,  0,  0,100,  0,  0,  0, 35,  2,  0,  0,
+/* 0x18f0 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1900 */ 104,  0,  0,  0, 35,  2,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0, 11,  0,  0,  0,108,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1920 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1930 */ 120,  0,  0,  0, 35,  2,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */   0,  0,  0,  0, 11,  0,  0,  0,136,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1950 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1960 */ 140,  0,  0,  0, 35,  2,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0, 11,  0,  0,  0,148,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1980 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1990 */ 156,  0,  0,  0, 35,  2,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0, 11,  0,  0,  0,160,  0,  0,  0, 35,  2,  0,  0,
+/* 0x19b0 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x19c0 */ 188,  0,  0,  0, 35,  2,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0, 11,  0,  0,  0,192,  0,  0,  0, 35,  2,  0,  0,
+/* 0x19e0 */ 129,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0,  0, 35,  2,  0,  0,212,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0, 13,  0,  0,  0, 28,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1a10 */ 160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1a20 */  56,  0,  0,  0, 35,  2,  0,  0,169,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0, 13,  0,  0,  0, 64,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1a40 */ 160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1a50 */  68,  0,  0,  0, 46,  2,  0,  0,235,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */   0,  0,  0,  0, 13,  0,  0,  0, 72,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1a70 */ 246,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1a80 */  76,  0,  0,  0, 46,  2,  0,  0,  8,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0, 13,  0,  0,  0, 80,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1aa0 */  19,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1ab0 */ 116,  0,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0, 15,  0,  0,  0,144,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1ad0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1ae0 */ 184,  0,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */   0,  0,  0,  0, 15,  0,  0,  0,204,  0,  0,  0, 35,  2,  0,  0,
+/* 0x1b00 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1b10 */ 244,  0,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   0,  0,  0,  0, 15,  0,  0,  0,  0,  1,  0,  0, 35,  2,  0,  0,
+/* 0x1b30 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1b40 */   8,  1,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */   0,  0,  0,  0, 15,  0,  0,  0, 68,  1,  0,  0, 35,  2,  0,  0,
+/* 0x1b60 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1b70 */ 144,  1,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0, 15,  0,  0,  0,204,  1,  0,  0, 35,  2,  0,  0,
+/* 0x1b90 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1ba0 */ 216,  1,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0, 15,  0,  0,  0,  4,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1bc0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1bd0 */  24,  2,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   0,  0,  0,  0, 15,  0,  0,  0, 32,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1bf0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c00 */  52,  2,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0, 15,  0,  0,  0, 60,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1c20 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c30 */  64,  2,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0, 15,  0,  0,  0, 76,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1c50 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c60 */  88,  2,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0, 15,  0,  0,  0,164,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1c80 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c90 */ 200,  2,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0, 15,  0,  0,  0,232,  2,  0,  0, 35,  2,  0,  0,
+/* 0x1cb0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1cc0 */   4,  3,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0, 15,  0,  0,  0, 12,  3,  0,  0, 35,  2,  0,  0,
+/* 0x1ce0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1cf0 */  60,  3,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0, 15,  0,  0,  0,136,  3,  0,  0, 35,  2,  0,  0,
+/* 0x1d10 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1d20 */ 160,  3,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0, 15,  0,  0,  0,168,  3,  0,  0, 35,  2,  0,  0,
+/* 0x1d40 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1d50 */ 204,  3,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0, 15,  0,  0,  0,224,  3,  0,  0, 35,  2,  0,  0,
+/* 0x1d70 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1d80 */ 232,  3,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0, 15,  0,  0,  0, 36,  4,  0,  0, 35,  2,  0,  0,
+/* 0x1da0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1db0 */  56,  4,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0, 15,  0,  0,  0,108,  4,  0,  0, 35,  2,  0,  0,
+/* 0x1dd0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1de0 */ 132,  4,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0, 15,  0,  0,  0,140,  4,  0,  0, 35,  2,  0,  0,
+/* 0x1e00 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1e10 */ 176,  4,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0, 15,  0,  0,  0,212,  4,  0,  0, 35,  2,  0,  0,
+/* 0x1e30 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1e40 */ 236,  4,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0, 15,  0,  0,  0,244,  4,  0,  0, 35,  2,  0,  0,
+/* 0x1e60 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1e70 */  24,  5,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0, 15,  0,  0,  0, 60,  5,  0,  0, 35,  2,  0,  0,
+/* 0x1e90 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1ea0 */ 152,  5,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0, 15,  0,  0,  0,160,  5,  0,  0, 35,  2,  0,  0,
+/* 0x1ec0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1ed0 */ 192,  5,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0, 15,  0,  0,  0,228,  5,  0,  0, 35,  2,  0,  0,
+/* 0x1ef0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f00 */ 252,  5,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0, 15,  0,  0,  0,  4,  6,  0,  0, 35,  2,  0,  0,
+/* 0x1f20 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f30 */  36,  6,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0, 15,  0,  0,  0, 72,  6,  0,  0, 35,  2,  0,  0,
+/* 0x1f50 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f60 */ 128,  6,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0, 15,  0,  0,  0,140,  6,  0,  0, 35,  2,  0,  0,
+/* 0x1f80 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f90 */ 208,  6,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0, 15,  0,  0,  0,236,  6,  0,  0, 35,  2,  0,  0,
+/* 0x1fb0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1fc0 */  28,  7,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0, 15,  0,  0,  0, 40,  7,  0,  0, 35,  2,  0,  0,
+/* 0x1fe0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1ff0 */ 108,  7,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0, 15,  0,  0,  0,124,  7,  0,  0, 35,  2,  0,  0,
+/* 0x2010 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2020 */ 156,  7,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0, 15,  0,  0,  0,184,  7,  0,  0, 35,  2,  0,  0,
+/* 0x2040 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2050 */ 196,  7,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0, 15,  0,  0,  0,208,  7,  0,  0, 35,  2,  0,  0,
+/* 0x2070 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2080 */ 244,  7,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0, 15,  0,  0,  0, 32,  8,  0,  0, 35,  2,  0,  0,
+/* 0x20a0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x20b0 */  44,  8,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0, 15,  0,  0,  0,124,  8,  0,  0, 35,  2,  0,  0,
+/* 0x20d0 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x20e0 */ 136,  8,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0, 15,  0,  0,  0,160,  8,  0,  0, 35,  2,  0,  0,
+/* 0x2100 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2110 */ 232,  8,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0, 15,  0,  0,  0,244,  8,  0,  0, 35,  2,  0,  0,
+/* 0x2130 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2140 */ 252,  8,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0, 15,  0,  0,  0,  4,  9,  0,  0, 35,  2,  0,  0,
+/* 0x2160 */ 181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2170 */  40,  9,  0,  0, 35,  2,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0, 68,108,108, 83,116, 97,114,116,  0, 69,120,101,
+/* 0x2190 */  83,116, 97,114,116,  0, 80,114,111, 99,101,115,115, 69,110,100,
+/* 0x21a0 */   0, 85,110,102,105,108,116,101,114, 95, 48,120, 53, 48,  0, 82,
+/* 0x21b0 */ 101,108,111, 99,115,  0, 73,109,112,111,114,116,115,  0, 85, 80,
+/* 0x21c0 */  88, 49, 72, 69, 65, 68,  0, 46,117, 99,108, 95,110,114,118, 50,
+/* 0x21d0 */ 101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0, 67,
+/* 0x21e0 */  97,108,108, 50, 69,  0, 46,117, 99,108, 95,110,114,118, 50,100,
+/* 0x21f0 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0, 67, 97,
+/* 0x2200 */ 108,108, 50, 68,  0, 46,117, 99,108, 95,110,114,118, 50, 98, 95,
+/* 0x2210 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56,  0, 67, 97,108,
+/* 0x2220 */ 108, 50, 66,  0, 67, 97,108,108, 76, 90, 77, 65,  0, 76, 90, 77,
+/* 0x2230 */  65, 95, 68, 69, 67, 79, 68, 69,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x2240 */  67, 49, 48,  0, 83, 82, 67, 48,  0, 68, 83, 84, 48,  0, 73, 65,
+/* 0x2250 */  84, 84,  0, 69, 78, 84, 82,  0, 70, 73, 66, 83,  0, 70, 73, 66,
+/* 0x2260 */  69,  0, 66, 82, 69, 76,  0, 66, 73, 77, 80,  0, 79, 78, 65, 77,
+/* 0x2270 */   0,115,116, 97,114,116, 95,111,102, 95, 99,111,109,112,114,101,
+/* 0x2280 */ 115,115,101,100,  0, 99,111,109,112,114,101,115,115,101,100, 95,
+/* 0x2290 */ 108,101,110,103,116,104,  0,115,116, 97,114,116, 95,111,102, 95,
+/* 0x22a0 */ 117,110, 99,111,109,112,114,101,115,115,101,100,  0,117,110, 99,
+/* 0x22b0 */ 111,109,112,114,101,115,115,101,100, 95,108,101,110,103,116,104,
+/* 0x22c0 */   0,111,114,105,103,105,110, 97,108, 95,101,110,116,114,121,  0,
+/* 0x22d0 */ 102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,116,
+/* 0x22e0 */  97,114,116,  0,102,105,108,116,101,114, 95, 98,117,102,102,101,
+/* 0x22f0 */ 114, 95,101,110,100,  0,115,116, 97,114,116, 95,111,102, 95,114,
+/* 0x2300 */ 101,108,111, 99,115,  0,115,116, 97,114,116, 95,111,102, 95,105,
+/* 0x2310 */ 109,112,111,114,116,115,  0,115,116, 97,114,116, 95,111,102, 95,
+/* 0x2320 */ 100,108,108, 95,110, 97,109,101,115,  0,117, 99,108, 95,110,114,
+/* 0x2330 */ 118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
+/* 0x2340 */   0,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,
+/* 0x2350 */ 112,114,101,115,115, 95, 56,  0,117, 99,108, 95,110,114,118, 50,
+/* 0x2360 */  98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,108,
+/* 0x2370 */ 122,109, 97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95,115,
+/* 0x2380 */ 116, 97, 99,107, 95, 97,100,106,117,115,116,  0,108,122,109, 97,
+/* 0x2390 */  95, 99, 95,108,101,110,  0,108,122,109, 97, 95,112,114,111,112,
+/* 0x23a0 */ 101,114,116,105,101,115,  0, 82, 95, 65, 82, 77, 95, 80, 67, 50,
+/* 0x23b0 */  52,  0, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,  0,140, 14,
+/* 0x23c0 */   0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v4t-wince.pe.h
-   created from arm.v4t-wince.pe.bin, 6742 (0x1a56) bytes
+   created from arm.v4t-wince.pe.bin, 4533 (0x11b5) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V4T_WINCE_PE_SIZE    6742
-#define STUB_ARM_V4T_WINCE_PE_ADLER32 0xd74653e1
-#define STUB_ARM_V4T_WINCE_PE_CRC32   0xbafe943f
+#define STUB_ARM_V4T_WINCE_PE_SIZE    4533
+#define STUB_ARM_V4T_WINCE_PE_ADLER32 0x3bd96fa5
+#define STUB_ARM_V4T_WINCE_PE_CRC32   0x58c10553
 
-unsigned char stub_arm_v4t_wince_pe[6742] = {
+unsigned char stub_arm_v4t_wince_pe[4533] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 132, 11,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -206,256 +206,118 @@ unsigned char stub_arm_v4t_wince_pe[6742] = {
 /* 0x0a70 */ 241,209,  7,146,  7,152, 37,154,144, 66,  0,210,175,228,  9, 75,
 /* 0x0a80 */ 153, 66,  3,216, 16,155,157, 66,  9,208,  1, 53,  4,152,  3,153,
 /* 0x0a90 */  43, 26, 11, 96,  7,154, 38,155,  0, 32, 26, 96,  0,224,  1, 32,
-/* 0x0aa0 */  31,176,240,189,255,255,255,  0,102,105,108,101, 32,102,111,114,
-/* 0x0ab0 */ 109, 97,116, 32,101,108,102, 51, 50, 45,108,105,116,116,108,101,
-/* 0x0ac0 */  97,114,109, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,
-/* 0x0ad0 */ 100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0ae0 */  32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32,
-/* 0x0af0 */  32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,
-/* 0x0b00 */ 105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,
-/* 0x0b10 */ 108, 97,103,115, 10, 32, 32, 48, 32, 68,108,108, 83,116, 97,114,
-/* 0x0b20 */ 116, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x0b30 */  32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x0b40 */  69, 78, 84, 83, 10, 32, 32, 49, 32, 69,120,101, 83,116, 97,114,
-/* 0x0b50 */ 116, 32, 32, 32, 32, 32, 32, 48, 54, 52, 32, 32, 48, 32, 32, 48,
-/* 0x0b60 */  32, 32, 48, 51, 99, 32, 32, 50, 42, 42, 49, 32, 32, 67, 79, 78,
-/* 0x0b70 */  84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 85,110,102,105,108,116,
-/* 0x0b80 */ 101,114, 95, 48,120, 53, 48, 32, 48, 51, 56, 32, 32, 48, 32, 32,
-/* 0x0b90 */  48, 32, 32, 48, 97, 48, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79,
-/* 0x0ba0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 82,101,108,111, 99,
-/* 0x0bb0 */ 115, 32, 32, 32, 32, 32, 32, 32, 32, 48, 52, 48, 32, 32, 48, 32,
-/* 0x0bc0 */  32, 48, 32, 32, 48,100, 56, 32, 32, 50, 42, 42, 50, 32, 32, 67,
-/* 0x0bd0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 73,109,112,111,
-/* 0x0be0 */ 114,116,115, 32, 32, 32, 32, 32, 32, 32, 48, 56, 50, 32, 32, 48,
-/* 0x0bf0 */  32, 32, 48, 32, 32, 48, 49, 49, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x0c00 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 80,114,
-/* 0x0c10 */ 111, 99,101,115,115, 69,110,100, 32, 32, 32, 32, 48, 56, 32, 32,
-/* 0x0c20 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 97, 32, 32, 50, 42, 42, 48,
-/* 0x0c30 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 85,
-/* 0x0c40 */  80, 88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 50, 48,
-/* 0x0c50 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 50, 32, 32, 50, 42,
-/* 0x0c60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55,
-/* 0x0c70 */  32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,
-/* 0x0c80 */ 109,112,114,101,115,115, 95, 56, 32, 48, 57, 56, 32, 32, 48, 32,
-/* 0x0c90 */  32, 48, 32, 32, 48, 49, 99, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x0ca0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 67, 97,108,
-/* 0x0cb0 */ 108, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48,
-/* 0x0cc0 */  32, 32, 48, 32, 32, 48, 50, 53, 97, 32, 32, 50, 42, 42, 48, 32,
-/* 0x0cd0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 46,117,
-/* 0x0ce0 */  99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,
-/* 0x0cf0 */ 101,115,115, 95, 56, 32, 48, 98, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x0d00 */  32, 48, 50, 53,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x0d10 */  84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 67, 97,108,108, 50, 69,
-/* 0x0d20 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48,
-/* 0x0d30 */  32, 32, 48, 51, 49, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x0d40 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 67, 97,108,108, 76,
-/* 0x0d50 */  90, 77, 65, 32, 32, 32, 32, 32, 32, 48, 51, 52, 32, 32, 48, 32,
-/* 0x0d60 */  32, 48, 32, 32, 48, 51, 49, 52, 32, 32, 50, 42, 42, 50, 32, 32,
-/* 0x0d70 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 76, 90, 77,
-/* 0x0d80 */  65, 95, 68, 69, 67, 79, 68, 69, 32, 32, 32, 48, 32, 32, 48, 32,
-/* 0x0d90 */  32, 48, 32, 32, 48, 51, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x0da0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32, 76, 90, 77,
-/* 0x0db0 */  65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 55, 54, 48, 32,
-/* 0x0dc0 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 56, 32, 32, 50, 42, 42,
-/* 0x0dd0 */  50, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66,
-/* 0x0de0 */  79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48,
-/* 0x0df0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,120,101, 83,116,
-/* 0x0e00 */  97,114,116, 32, 48, 32, 69,120,101, 83,116, 97,114,116, 10, 48,
-/* 0x0e10 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0e20 */  73,109,112,111,114,116,115, 32, 48, 32, 46,114,101, 97,108, 95,
-/* 0x0e30 */ 115,116, 97,114,116, 95,111,102, 73,109,112,111,114,116,115, 10,
-/* 0x0e40 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x0e50 */  32, 46,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,
-/* 0x0e60 */ 109,112,114,101,115,115, 95, 56, 32, 48, 32, 46,117, 99,108, 95,
-/* 0x0e70 */ 110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x0e80 */  95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x0e90 */  32,100, 32, 32, 46,117, 99,108, 95,110,114,118, 50,101, 95,100,
-/* 0x0ea0 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 32, 48, 32, 46,117,
-/* 0x0eb0 */  99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,
-/* 0x0ec0 */ 101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x0ed0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 79,
-/* 0x0ee0 */  68, 69, 32, 48, 32, 46,114,101, 97,108, 95,115,116, 97,114,116,
-/* 0x0ef0 */  95,111,102, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68, 69, 10, 48,
-/* 0x0f00 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x0f10 */  68,108,108, 83,116, 97,114,116, 32, 48, 32, 68,108,108, 83,116,
-/* 0x0f20 */  97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x0f30 */  32, 32,100, 32, 32, 85,110,102,105,108,116,101,114, 95, 48,120,
-/* 0x0f40 */  53, 48, 32, 48, 32, 85,110,102,105,108,116,101,114, 95, 48,120,
-/* 0x0f50 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x0f60 */  32,100, 32, 32, 82,101,108,111, 99,115, 32, 48, 32, 82,101,108,
-/* 0x0f70 */ 111, 99,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x0f80 */  32, 32,100, 32, 32, 73,109,112,111,114,116,115, 32, 48, 32, 73,
-/* 0x0f90 */ 109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x0fa0 */ 108, 32, 32, 32, 32,100, 32, 32, 80,114,111, 99,101,115,115, 69,
-/* 0x0fb0 */ 110,100, 32, 48, 32, 80,114,111, 99,101,115,115, 69,110,100, 10,
-/* 0x0fc0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x0fd0 */  32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 48, 32, 85, 80, 88, 49,
-/* 0x0fe0 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x0ff0 */  32, 32, 32,100, 32, 32, 67, 97,108,108, 50, 66, 32, 48, 32, 67,
-/* 0x1000 */  97,108,108, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1010 */  32, 32, 32, 32,100, 32, 32, 67, 97,108,108, 50, 69, 32, 48, 32,
-/* 0x1020 */  67, 97,108,108, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1030 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 97,108,108, 76, 90, 77, 65,
-/* 0x1040 */  32, 48, 32, 67, 97,108,108, 76, 90, 77, 65, 10, 48, 48, 48, 48,
-/* 0x1050 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x1060 */  65, 95, 68, 69, 67, 79, 68, 69, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1070 */  68, 69, 67, 79, 68, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1080 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1090 */  49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x10a0 */  48, 48, 48, 48, 48, 48, 51, 56, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x10b0 */  32, 69,120,101, 83,116, 97,114,116, 32, 48, 32, 83, 82, 67, 48,
-/* 0x10c0 */  10, 48, 48, 48, 48, 48, 48, 52, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x10d0 */  32, 32, 69,120,101, 83,116, 97,114,116, 32, 48, 32, 68, 83, 84,
-/* 0x10e0 */  48, 10, 48, 48, 48, 48, 48, 48, 52, 56, 32,103, 32, 32, 32, 32,
-/* 0x10f0 */  32, 32, 32, 69,120,101, 83,116, 97,114,116, 32, 48, 32, 73, 65,
-/* 0x1100 */  84, 84, 10, 48, 48, 48, 48, 48, 48, 53, 56, 32,103, 32, 32, 32,
-/* 0x1110 */  32, 32, 32, 32, 69,120,101, 83,116, 97,114,116, 32, 48, 32, 69,
-/* 0x1120 */  78, 84, 82, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x1130 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,115,116, 97,
-/* 0x1140 */ 114,116, 95,111,102, 95, 99,111,109,112,114,101,115,115,101,100,
-/* 0x1150 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1160 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 99,111,109,112,114,101,
-/* 0x1170 */ 115,115,101,100, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x1180 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x1190 */  68, 42, 32, 48, 32,115,116, 97,114,116, 95,111,102, 95,117,110,
-/* 0x11a0 */  99,111,109,112,114,101,115,115,101,100, 10, 48, 48, 48, 48, 48,
-/* 0x11b0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x11c0 */  42, 32, 48, 32,117,110, 99,111,109,112,114,101,115,115,101,100,
-/* 0x11d0 */  95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x11e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x11f0 */  32,111,114,105,103,105,110, 97,108, 95,101,110,116,114,121, 10,
-/* 0x1200 */  48, 48, 48, 48, 48, 48, 51, 48, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x1210 */  32, 85,110,102,105,108,116,101,114, 95, 48,120, 53, 48, 32, 48,
-/* 0x1220 */  32, 70, 73, 66, 83, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1230 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,
-/* 0x1240 */ 105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,116, 97,
-/* 0x1250 */ 114,116, 10, 48, 48, 48, 48, 48, 48, 51, 52, 32,103, 32, 32, 32,
-/* 0x1260 */  32, 32, 32, 32, 85,110,102,105,108,116,101,114, 95, 48,120, 53,
-/* 0x1270 */  48, 32, 48, 32, 70, 73, 66, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1280 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x1290 */  48, 32,102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,
-/* 0x12a0 */ 101,110,100, 10, 48, 48, 48, 48, 48, 48, 51, 99, 32,103, 32, 32,
-/* 0x12b0 */  32, 32, 32, 32, 32, 82,101,108,111, 99,115, 32, 48, 32, 66, 82,
-/* 0x12c0 */  69, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x12d0 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,115,116, 97,114,
-/* 0x12e0 */ 116, 95,111,102, 95,114,101,108,111, 99,115, 10, 48, 48, 48, 48,
-/* 0x12f0 */  48, 48, 55, 56, 32,103, 32, 32, 32, 32, 32, 32, 32, 73,109,112,
-/* 0x1300 */ 111,114,116,115, 32, 48, 32, 66, 73, 77, 80, 10, 48, 48, 48, 48,
-/* 0x1310 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x1320 */  68, 42, 32, 48, 32,115,116, 97,114,116, 95,111,102, 95,105,109,
-/* 0x1330 */ 112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32,103,
-/* 0x1340 */  32, 32, 32, 32, 32, 32, 32, 73,109,112,111,114,116,115, 32, 48,
-/* 0x1350 */  32, 79, 78, 65, 77, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x1360 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,115,
-/* 0x1370 */ 116, 97,114,116, 95,111,102, 95,100,108,108, 95,110, 97,109,101,
-/* 0x1380 */ 115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1390 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,
-/* 0x13a0 */ 117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x13b0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,
-/* 0x13c0 */ 122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,
-/* 0x13d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x13e0 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95, 99,
-/* 0x13f0 */  95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x1400 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,
-/* 0x1410 */ 109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 10, 82,
-/* 0x1420 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x1430 */  83, 32, 70, 79, 82, 32, 91, 68,108,108, 83,116, 97,114,116, 93,
-/* 0x1440 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1450 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1460 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 82,
-/* 0x1470 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69,120,
-/* 0x1480 */ 101, 83,116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x1490 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x14a0 */  69,120,101, 83,116, 97,114,116, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x14b0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x14c0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x14d0 */  48, 48, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x14e0 */  32, 32, 32, 32, 32, 32, 32, 69,120,101, 83,116, 97,114,116, 10,
-/* 0x14f0 */  48, 48, 48, 48, 48, 48, 51, 56, 32, 82, 95, 65, 82, 77, 95, 65,
-/* 0x1500 */  66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116,
-/* 0x1510 */  95,111,102, 95, 99,111,109,112,114,101,115,115,101,100, 10, 48,
-/* 0x1520 */  48, 48, 48, 48, 48, 51, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66,
-/* 0x1530 */  83, 51, 50, 32, 32, 32, 32, 32, 32, 32, 99,111,109,112,114,101,
-/* 0x1540 */ 115,115,101,100, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x1550 */  48, 48, 52, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x1560 */  32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,102, 95,
-/* 0x1570 */ 117,110, 99,111,109,112,114,101,115,115,101,100, 10, 48, 48, 48,
-/* 0x1580 */  48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51,
-/* 0x1590 */  50, 32, 32, 32, 32, 32, 32, 32,117,110, 99,111,109,112,114,101,
-/* 0x15a0 */ 115,115,101,100, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48,
-/* 0x15b0 */  48, 48, 53, 56, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x15c0 */  32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108, 95,
-/* 0x15d0 */ 101,110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x15e0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 85,
-/* 0x15f0 */ 110,102,105,108,116,101,114, 95, 48,120, 53, 48, 93, 58, 10, 79,
-/* 0x1600 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x1610 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x1620 */  48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77, 95, 65,
-/* 0x1630 */  66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x1640 */ 114, 95, 98,117,102,102,101,114, 95,115,116, 97,114,116, 10, 48,
-/* 0x1650 */  48, 48, 48, 48, 48, 51, 52, 32, 82, 95, 65, 82, 77, 95, 65, 66,
-/* 0x1660 */  83, 51, 50, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114,
-/* 0x1670 */  95, 98,117,102,102,101,114, 95,101,110,100, 10, 10, 82, 69, 76,
-/* 0x1680 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x1690 */  70, 79, 82, 32, 91, 82,101,108,111, 99,115, 93, 58, 10, 79, 70,
-/* 0x16a0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x16b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x16c0 */  48, 48, 48, 48, 48, 51, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66,
-/* 0x16d0 */  83, 51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,
-/* 0x16e0 */ 111,102, 95,114,101,108,111, 99,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x16f0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1700 */  82, 32, 91, 73,109,112,111,114,116,115, 93, 58, 10, 79, 70, 70,
-/* 0x1710 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x1720 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x1730 */  48, 48, 48, 48, 48,101, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77,
-/* 0x1740 */  95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,
-/* 0x1750 */ 116, 97,114,116, 95,111,102, 73,109,112,111,114,116,115, 10, 48,
-/* 0x1760 */  48, 48, 48, 48, 48, 50, 56, 32, 82, 95, 65, 82, 77, 95, 84, 72,
-/* 0x1770 */  77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,
-/* 0x1780 */ 115,116, 97,114,116, 95,111,102, 73,109,112,111,114,116,115, 10,
-/* 0x1790 */  48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77, 95, 84,
-/* 0x17a0 */  72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108,
-/* 0x17b0 */  95,115,116, 97,114,116, 95,111,102, 73,109,112,111,114,116,115,
-/* 0x17c0 */  10, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x17d0 */  84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,
-/* 0x17e0 */ 108, 95,115,116, 97,114,116, 95,111,102, 73,109,112,111,114,116,
-/* 0x17f0 */ 115, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x1800 */  95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,
-/* 0x1810 */ 114,116, 95,111,102, 95,105,109,112,111,114,116,115, 10, 48, 48,
-/* 0x1820 */  48, 48, 48, 48, 55, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83,
-/* 0x1830 */  51, 50, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,
-/* 0x1840 */ 102, 95,100,108,108, 95,110, 97,109,101,115, 10, 10, 82, 69, 76,
-/* 0x1850 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x1860 */  70, 79, 82, 32, 91, 67, 97,108,108, 50, 66, 93, 58, 10, 79, 70,
-/* 0x1870 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x1880 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x1890 */  48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 65, 82, 77, 95, 84, 72,
-/* 0x18a0 */  77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,117, 99,108, 95,110,
-/* 0x18b0 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x18c0 */  56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x18d0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 97,108,108, 50,
-/* 0x18e0 */  69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x18f0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1900 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95,
-/* 0x1910 */  65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32,
-/* 0x1920 */  46,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,
-/* 0x1930 */ 112,114,101,115,115, 95, 56, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x1940 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x1950 */  91, 67, 97,108,108, 76, 90, 77, 65, 93, 58, 10, 79, 70, 70, 83,
-/* 0x1960 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1970 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x1980 */  48, 48, 48, 49, 99, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95,
-/* 0x1990 */  67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,116,
-/* 0x19a0 */  97,114,116, 95,111,102, 76, 90, 77, 65, 95, 68, 69, 67, 79, 68,
-/* 0x19b0 */  69, 10, 48, 48, 48, 48, 48, 48, 50, 52, 32, 82, 95, 65, 82, 77,
-/* 0x19c0 */  95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x19d0 */  97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 56,
-/* 0x19e0 */  32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32,
-/* 0x19f0 */  32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,
-/* 0x1a00 */ 106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 50, 99, 32, 82, 95,
-/* 0x1a10 */  65, 82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a20 */ 108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48,
-/* 0x1a30 */  48, 51, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32,
-/* 0x1a40 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,
-/* 0x1a50 */ 114,116,105,101,115, 10
+/* 0x0aa0 */  31,176,240,189,255,255,255,  0, 14,  0,  0,  0, 39,  0,  0,  0,
+/* 0x0ab0 */  23,  0,  0,  0, 21,  2,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x0ac0 */   8,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 60,  0,  0,  0,
+/* 0x0ad0 */ 100,  0,  0,  0,  1,  0,  0,  0, 18,  0,  0,  0,160,  0,  0,  0,
+/* 0x0ae0 */  56,  0,  0,  0,  2,  0,  0,  0, 32,  0,  0,  0,216,  0,  0,  0,
+/* 0x0af0 */  64,  0,  0,  0,  2,  0,  0,  0, 39,  0,  0,  0, 24,  1,  0,  0,
+/* 0x0b00 */ 130,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,154,  1,  0,  0,
+/* 0x0b10 */   8,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,162,  1,  0,  0,
+/* 0x0b20 */  32,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,194,  1,  0,  0,
+/* 0x0b30 */ 152,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0, 90,  2,  0,  0,
+/* 0x0b40 */   4,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 94,  2,  0,  0,
+/* 0x0b50 */ 178,  0,  0,  0,  0,  0,  0,  0,122,  0,  0,  0, 16,  3,  0,  0,
+/* 0x0b60 */   4,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0, 20,  3,  0,  0,
+/* 0x0b70 */  52,  0,  0,  0,  2,  0,  0,  0,138,  0,  0,  0, 72,  3,  0,  0,
+/* 0x0b80 */   0,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,  0, 72,  3,  0,  0,
+/* 0x0b90 */  96,  7,  0,  0,  2,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x0ba0 */   0,  0,  0,  0,161,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0bb0 */  67,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x0bc0 */   9,  0,  0,  0,  0,  0,  0,  0,183,  0,  0,  0, 12,  0,  0,  0,
+/* 0x0bd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0be0 */  18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,
+/* 0x0bf0 */   3,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  4,  0,  0,  0,
+/* 0x0c00 */   0,  0,  0,  0, 47,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0c10 */  58,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,
+/* 0x0c20 */   8,  0,  0,  0,  0,  0,  0,  0,122,  0,  0,  0, 10,  0,  0,  0,
+/* 0x0c30 */   0,  0,  0,  0,129,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0c40 */ 138,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,  0,
+/* 0x0c50 */  13,  0,  0,  0,  0,  0,  0,  0,209,  0,  0,  0,  1,  0,  0,  0,
+/* 0x0c60 */  56,  0,  0,  0,214,  0,  0,  0,  1,  0,  0,  0, 64,  0,  0,  0,
+/* 0x0c70 */ 219,  0,  0,  0,  1,  0,  0,  0, 72,  0,  0,  0,224,  0,  0,  0,
+/* 0x0c80 */   1,  0,  0,  0, 88,  0,  0,  0,229,  0,  0,  0, 15,  0,  0,  0,
+/* 0x0c90 */ 173,222,173,222,249,  0,  0,  0, 15,  0,  0,  0,173,222,173,222,
+/* 0x0ca0 */  11,  1,  0,  0, 15,  0,  0,  0,173,222,173,222, 33,  1,  0,  0,
+/* 0x0cb0 */  15,  0,  0,  0,173,222,173,222, 53,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0cc0 */ 173,222,173,222, 68,  1,  0,  0,  2,  0,  0,  0, 48,  0,  0,  0,
+/* 0x0cd0 */  73,  1,  0,  0, 15,  0,  0,  0,173,222,173,222, 93,  1,  0,  0,
+/* 0x0ce0 */   2,  0,  0,  0, 52,  0,  0,  0, 98,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0cf0 */ 173,222,173,222,116,  1,  0,  0,  3,  0,  0,  0, 60,  0,  0,  0,
+/* 0x0d00 */ 121,  1,  0,  0, 15,  0,  0,  0,173,222,173,222,137,  1,  0,  0,
+/* 0x0d10 */   4,  0,  0,  0,120,  0,  0,  0,142,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0d20 */ 173,222,173,222,159,  1,  0,  0,  4,  0,  0,  0,124,  0,  0,  0,
+/* 0x0d30 */ 164,  1,  0,  0, 15,  0,  0,  0,173,222,173,222,183,  1,  0,  0,
+/* 0x0d40 */  15,  0,  0,  0,173,222,173,222,194,  1,  0,  0, 15,  0,  0,  0,
+/* 0x0d50 */ 173,222,173,222,212,  1,  0,  0, 15,  0,  0,  0,173,222,173,222,
+/* 0x0d60 */ 223,  1,  0,  0, 15,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x0d70 */   4,  0,  0,  0,239,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0d80 */   0,  0,  0,  0,  1,  0,  0,  0, 28,  0,  0,  0,239,  1,  0,  0,
+/* 0x0d90 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x0da0 */  56,  0,  0,  0,250,  1,  0,  0,229,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0db0 */   0,  0,  0,  0,  1,  0,  0,  0, 60,  0,  0,  0,250,  1,  0,  0,
+/* 0x0dc0 */ 249,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x0dd0 */  64,  0,  0,  0,250,  1,  0,  0, 11,  1,  0,  0,  0,  0,  0,  0,
+/* 0x0de0 */   0,  0,  0,  0,  1,  0,  0,  0, 68,  0,  0,  0,250,  1,  0,  0,
+/* 0x0df0 */  33,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x0e00 */  88,  0,  0,  0,250,  1,  0,  0, 53,  1,  0,  0,  0,  0,  0,  0,
+/* 0x0e10 */   0,  0,  0,  0,  2,  0,  0,  0, 48,  0,  0,  0,250,  1,  0,  0,
+/* 0x0e20 */  73,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x0e30 */  52,  0,  0,  0,250,  1,  0,  0, 98,  1,  0,  0,  0,  0,  0,  0,
+/* 0x0e40 */   0,  0,  0,  0,  3,  0,  0,  0, 60,  0,  0,  0,250,  1,  0,  0,
+/* 0x0e50 */ 121,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x0e60 */  14,  0,  0,  0,  6,  2,  0,  0,161,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0e70 */   0,  0,  0,  0,  4,  0,  0,  0, 40,  0,  0,  0,  6,  2,  0,  0,
+/* 0x0e80 */ 161,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x0e90 */  48,  0,  0,  0,  6,  2,  0,  0,161,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0ea0 */   0,  0,  0,  0,  4,  0,  0,  0, 92,  0,  0,  0,  6,  2,  0,  0,
+/* 0x0eb0 */ 161,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x0ec0 */ 120,  0,  0,  0,250,  1,  0,  0,142,  1,  0,  0,  0,  0,  0,  0,
+/* 0x0ed0 */   0,  0,  0,  0,  4,  0,  0,  0,124,  0,  0,  0,250,  1,  0,  0,
+/* 0x0ee0 */ 164,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x0ef0 */   0,  0,  0,  0,  6,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0f00 */   0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  6,  2,  0,  0,
+/* 0x0f10 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x0f20 */  28,  0,  0,  0,  6,  2,  0,  0,183,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0f30 */   0,  0,  0,  0, 11,  0,  0,  0, 36,  0,  0,  0,250,  1,  0,  0,
+/* 0x0f40 */ 183,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x0f50 */  40,  0,  0,  0,250,  1,  0,  0,194,  1,  0,  0,  0,  0,  0,  0,
+/* 0x0f60 */   0,  0,  0,  0, 11,  0,  0,  0, 44,  0,  0,  0,250,  1,  0,  0,
+/* 0x0f70 */ 212,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x0f80 */  48,  0,  0,  0,250,  1,  0,  0,223,  1,  0,  0,  0,  0,  0,  0,
+/* 0x0f90 */   0,  0,  0,  0, 68,108,108, 83,116, 97,114,116,  0, 69,120,101,
+/* 0x0fa0 */  83,116, 97,114,116,  0, 85,110,102,105,108,116,101,114, 95, 48,
+/* 0x0fb0 */ 120, 53, 48,  0, 82,101,108,111, 99,115,  0, 73,109,112,111,114,
+/* 0x0fc0 */ 116,115,  0, 80,114,111, 99,101,115,115, 69,110,100,  0, 85, 80,
+/* 0x0fd0 */  88, 49, 72, 69, 65, 68,  0, 46,117, 99,108, 95,110,114,118, 50,
+/* 0x0fe0 */  98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0, 67,
+/* 0x0ff0 */  97,108,108, 50, 66,  0, 46,117, 99,108, 95,110,114,118, 50,101,
+/* 0x1000 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0, 67, 97,
+/* 0x1010 */ 108,108, 50, 69,  0, 67, 97,108,108, 76, 90, 77, 65,  0, 76, 90,
+/* 0x1020 */  77, 65, 95, 68, 69, 67, 79, 68, 69,  0, 76, 90, 77, 65, 95, 68,
+/* 0x1030 */  69, 67, 49, 48,  0, 46,114,101, 97,108, 95,115,116, 97,114,116,
+/* 0x1040 */  95,111,102, 73,109,112,111,114,116,115,  0, 46,114,101, 97,108,
+/* 0x1050 */  95,115,116, 97,114,116, 95,111,102, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1060 */  67, 79, 68, 69,  0, 83, 82, 67, 48,  0, 68, 83, 84, 48,  0, 73,
+/* 0x1070 */  65, 84, 84,  0, 69, 78, 84, 82,  0,115,116, 97,114,116, 95,111,
+/* 0x1080 */ 102, 95, 99,111,109,112,114,101,115,115,101,100,  0, 99,111,109,
+/* 0x1090 */ 112,114,101,115,115,101,100, 95,108,101,110,103,116,104,  0,115,
+/* 0x10a0 */ 116, 97,114,116, 95,111,102, 95,117,110, 99,111,109,112,114,101,
+/* 0x10b0 */ 115,115,101,100,  0,117,110, 99,111,109,112,114,101,115,115,101,
+/* 0x10c0 */ 100, 95,108,101,110,103,116,104,  0,111,114,105,103,105,110, 97,
+/* 0x10d0 */ 108, 95,101,110,116,114,121,  0, 70, 73, 66, 83,  0,102,105,108,
+/* 0x10e0 */ 116,101,114, 95, 98,117,102,102,101,114, 95,115,116, 97,114,116,
+/* 0x10f0 */   0, 70, 73, 66, 69,  0,102,105,108,116,101,114, 95, 98,117,102,
+/* 0x1100 */ 102,101,114, 95,101,110,100,  0, 66, 82, 69, 76,  0,115,116, 97,
+/* 0x1110 */ 114,116, 95,111,102, 95,114,101,108,111, 99,115,  0, 66, 73, 77,
+/* 0x1120 */  80,  0,115,116, 97,114,116, 95,111,102, 95,105,109,112,111,114,
+/* 0x1130 */ 116,115,  0, 79, 78, 65, 77,  0,115,116, 97,114,116, 95,111,102,
+/* 0x1140 */  95,100,108,108, 95,110, 97,109,101,115,  0,108,122,109, 97, 95,
+/* 0x1150 */ 117, 95,108,101,110,  0,108,122,109, 97, 95,115,116, 97, 99,107,
+/* 0x1160 */  95, 97,100,106,117,115,116,  0,108,122,109, 97, 95, 99, 95,108,
+/* 0x1170 */ 101,110,  0,108,122,109, 97, 95,112,114,111,112,101,114,116,105,
+/* 0x1180 */ 101,115,  0, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,  0, 82, 95,
+/* 0x1190 */  65, 82, 77, 95, 65, 66, 83, 51, 50,  0, 82, 95, 65, 82, 77, 95,
+/* 0x11a0 */  84, 72, 77, 95, 67, 65, 76, 76,  0,168, 10,  0,  0, 85, 80, 88,
+/* 0x11b0 */  76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v5a-darwin.macho-entry.h
-   created from arm.v5a-darwin.macho-entry.bin, 14129 (0x3731) bytes
+   created from arm.v5a-darwin.macho-entry.bin, 10359 (0x2877) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_SIZE    14129
-#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_ADLER32 0xfe74b14d
-#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_CRC32   0x2df44426
+#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_SIZE    10359
+#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_ADLER32 0xd9f24971
+#define STUB_ARM_V5A_DARWIN_MACHO_ENTRY_CRC32   0xff5ba515
 
-unsigned char stub_arm_v5a_darwin_macho_entry[14129] = {
+unsigned char stub_arm_v5a_darwin_macho_entry[10359] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  72, 20,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -349,575 +349,339 @@ unsigned char stub_arm_v5a_darwin_macho_entry[14129] = {
 /* 0x1360 */   0, 16,160,227,  5,192,160,227,128,  0,  0,239,  2,  1,128, 35,
 /* 0x1370 */  30,255, 47,225, 20,  0, 45,229,  6,128,160,225,  4,  0,150,228,
 /* 0x1380 */   0,128, 72,224, 16,128,141,229,  6,160,160,225,  4,  0,150,228,
-/* 0x1390 */   0,160, 74,224,  8,176, 64,226,254,255,255,235,102,105,108,101,
-/* 0x13a0 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,108,105,
-/* 0x13b0 */ 116,116,108,101, 97,114,109, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x13c0 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x13d0 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x13e0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x13f0 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1400 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 77, 65, 67,
-/* 0x1410 */  72, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48,
-/* 0x1420 */  32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1430 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86,
-/* 0x1440 */  95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1450 */  32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1460 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 78, 82, 86, 50,
-/* 0x1470 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 52, 52, 32, 32,
-/* 0x1480 */  48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1490 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78, 82,
-/* 0x14a0 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 51, 48,
-/* 0x14b0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 52, 32, 32, 50, 42,
-/* 0x14c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52,
-/* 0x14d0 */  32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x14e0 */ 102, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 98, 52, 32, 32,
-/* 0x14f0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1500 */  32, 53, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32,
-/* 0x1510 */  32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 97, 56, 32, 32,
-/* 0x1520 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1530 */  32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32,
-/* 0x1540 */  32, 48, 99, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 97, 56,
-/* 0x1550 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1560 */  10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x1570 */  32, 32, 32, 48, 57, 51, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1580 */  52, 54, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1590 */  78, 84, 83, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x15a0 */  49, 48, 32, 32, 32, 32, 48, 52, 55, 56, 32, 32, 48, 32, 32, 48,
-/* 0x15b0 */  32, 32, 48,100, 97, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x15c0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95,
-/* 0x15d0 */  68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x15e0 */  32, 32, 48, 49, 50, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x15f0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 77, 65, 67, 72,
-/* 0x1600 */  77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1610 */  48, 32, 32, 48, 49, 50, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1620 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 77, 65, 67,
-/* 0x1630 */  72, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 48, 49, 56, 52, 32,
-/* 0x1640 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 49, 56, 32, 32, 50, 42,
-/* 0x1650 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77,
-/* 0x1660 */  66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48,
-/* 0x1670 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x1680 */  69, 32, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1690 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,
-/* 0x16a0 */  32, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66, 32,
-/* 0x16c0 */  48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16d0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x16e0 */  70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x16f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1700 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76,
-/* 0x1710 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1720 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1730 */  68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1740 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1750 */  32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 32, 48, 32,
-/* 0x1760 */  77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1770 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77,
-/* 0x1780 */  65, 73, 78, 88, 32, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88,
-/* 0x1790 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x17a0 */  32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86,
-/* 0x17b0 */  95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x17c0 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32,
-/* 0x17d0 */  48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48,
-/* 0x17e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x17f0 */  95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1800 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1810 */  32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 48,
-/* 0x1820 */  32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48,
-/* 0x1830 */  48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72,
-/* 0x1840 */  77, 65, 73, 78, 88, 32, 48, 32, 95,115,116, 97,114,116, 10, 48,
-/* 0x1850 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32,
-/* 0x1860 */  78, 82, 86, 50, 69, 32, 48, 49, 52, 52, 32,117, 99,108, 95,110,
-/* 0x1870 */ 114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x1880 */  56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x1890 */  32, 70, 32, 78, 82, 86, 50, 68, 32, 48, 49, 51, 48, 32,117, 99,
-/* 0x18a0 */ 108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,
-/* 0x18b0 */ 115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x18c0 */  32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 66, 32, 48,102, 52, 32,
-/* 0x18d0 */ 117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,
-/* 0x18e0 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x18f0 */ 103, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1900 */  49, 48, 32, 48, 32, 76,122,109, 97, 68,101, 99,111,100,101, 10,
-/* 0x1910 */  48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x1920 */  32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 48, 32,101,110,100,
-/* 0x1930 */  95,100,101, 99,111,109,112,114,101,115,115, 10, 10, 82, 69, 76,
-/* 0x1940 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x1950 */  70, 79, 82, 32, 91, 77, 65, 67, 72, 77, 65, 73, 78, 88, 93, 58,
-/* 0x1960 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x1970 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x1980 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65, 82, 77,
-/* 0x1990 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67,
-/* 0x19a0 */  72, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x19b0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x19c0 */  78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x19d0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x19e0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x19f0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1a00 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1a20 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1a30 */  48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1a40 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1a50 */  48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1a60 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1a70 */  48, 48, 48, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1a80 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1a90 */  48, 48, 48, 48, 57, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1aa0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1ab0 */  48, 48, 48, 48, 48, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1ac0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1ae0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1af0 */  10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1b00 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1b10 */  69, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65, 82, 77,
-/* 0x1b20 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1b30 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82,
-/* 0x1b40 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1b50 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95, 65,
-/* 0x1b60 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1b70 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 56, 32, 82, 95,
-/* 0x1b80 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b90 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82,
-/* 0x1ba0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1bb0 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,101, 56, 32,
-/* 0x1bc0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1bd0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,101, 99,
-/* 0x1be0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1bf0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,102,
-/* 0x1c00 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1c10 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49,
-/* 0x1c20 */  48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1c30 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1c40 */  49, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1c50 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1c60 */  48, 49, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1c70 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1c80 */  48, 48, 49, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1c90 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 49, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1cb0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 49, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1cd0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1ce0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x1cf0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58,
-/* 0x1d00 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x1d10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x1d20 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77,
-/* 0x1d30 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1d40 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82,
-/* 0x1d50 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1d60 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65,
-/* 0x1d70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1d80 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95,
-/* 0x1d90 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1da0 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82,
-/* 0x1db0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1dc0 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 57, 56, 32,
-/* 0x1dd0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1de0 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 97, 52,
-/* 0x1df0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1e00 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x1e10 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1e20 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1e30 */  98, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1e40 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1e60 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1e70 */  48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1e80 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1e90 */  48, 48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x1eb0 */  48, 48, 48, 48,101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1ec0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x1ed0 */  48, 48, 48, 48, 48,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1ee0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1f00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x1f10 */  10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1f20 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1f30 */  68, 10, 48, 48, 48, 48, 48, 49, 48, 52, 32, 82, 95, 65, 82, 77,
-/* 0x1f40 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1f50 */  50, 68, 10, 48, 48, 48, 48, 48, 49, 50, 56, 32, 82, 95, 65, 82,
-/* 0x1f60 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1f70 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 50, 99, 32, 82, 95, 65,
-/* 0x1f80 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1f90 */  82, 86, 50, 68, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x1fa0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x1fb0 */  86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x1fc0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1fd0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32,
-/* 0x1fe0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1ff0 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 55, 56,
-/* 0x2000 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2010 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 56,
-/* 0x2020 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2030 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2040 */  56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2050 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x2060 */  48, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2070 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x2080 */  48, 48, 57, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2090 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x20a0 */  48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x20b0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x20c0 */  48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x20d0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x20e0 */  48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x20f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x2100 */  48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2110 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2120 */  10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2130 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2140 */  66, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2150 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2160 */  50, 66, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95, 65, 82,
-/* 0x2170 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2180 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65,
-/* 0x2190 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x21a0 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,102, 48, 32, 82, 95,
-/* 0x21b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x21c0 */  78, 82, 86, 50, 66, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x21d0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x21e0 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x21f0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2200 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2210 */  48, 48, 48, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2220 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2230 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 52, 99, 32, 82, 95, 65, 82,
-/* 0x2240 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2250 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 56,
-/* 0x2260 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2270 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48,
-/* 0x2280 */  48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2290 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69,
-/* 0x22a0 */  76, 70, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x22b0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90,
-/* 0x22c0 */  77, 65, 95, 68, 69, 67, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x22d0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22e0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x22f0 */  48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2300 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2310 */  48, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2320 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2330 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 98, 56,
-/* 0x2340 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2350 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2370 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2380 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65,
-/* 0x2390 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x23a0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x23b0 */  48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x23c0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x23d0 */  48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x23e0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x23f0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82,
-/* 0x2400 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2410 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2420 */  48, 49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2430 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2440 */  48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2450 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2460 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,100, 56,
-/* 0x2470 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2480 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2490 */  48, 48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x24a0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x24b0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56, 32, 82, 95, 65,
-/* 0x24c0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x24d0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x24e0 */  50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x24f0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2500 */  48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2510 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2520 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 99, 32, 82,
-/* 0x2530 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2540 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2550 */  48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2560 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2570 */  48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2580 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2590 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 53, 56,
-/* 0x25a0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x25b0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x25c0 */  48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x25d0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x25e0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65,
-/* 0x25f0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2600 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x2610 */ 101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2620 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2630 */  48, 48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2640 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2650 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82,
-/* 0x2660 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2670 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2680 */  48, 51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2690 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x26a0 */  48, 10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82, 95, 65, 82, 77,
-/* 0x26b0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x26c0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97, 48,
-/* 0x26d0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x26e0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x26f0 */  48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2700 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2710 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95, 65,
-/* 0x2720 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2730 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x2740 */ 101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2750 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2760 */  48, 48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2770 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2780 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 50, 52, 32, 82,
-/* 0x2790 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27a0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x27b0 */  48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x27c0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x27d0 */  48, 10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82, 95, 65, 82, 77,
-/* 0x27e0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x27f0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56, 52,
-/* 0x2800 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2810 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2820 */  48, 48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2830 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2840 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48, 32, 82, 95, 65,
-/* 0x2850 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2860 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x2870 */ 100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2880 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2890 */  48, 48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x28a0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x28b0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,102, 52, 32, 82,
-/* 0x28c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x28d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x28e0 */  48, 53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x28f0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2900 */  48, 10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2910 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2920 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 57, 56,
-/* 0x2930 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2940 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2950 */  48, 48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2960 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2970 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48, 32, 82, 95, 65,
-/* 0x2980 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2990 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,
-/* 0x29a0 */ 101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x29b0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x29c0 */  48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x29d0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x29e0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 48, 52, 32, 82,
-/* 0x29f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a00 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2a10 */  48, 54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2a20 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2a30 */  48, 10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2a40 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2a50 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56, 48,
-/* 0x2a60 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2a70 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2a80 */  48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2a90 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2aa0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 54,100, 48, 32, 82, 95, 65,
-/* 0x2ab0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2ac0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x2ad0 */ 101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2ae0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2af0 */  48, 48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2b00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2b10 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 50, 56, 32, 82,
-/* 0x2b20 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b30 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2b40 */  48, 55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2b50 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2b60 */  48, 10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2b70 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2b80 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 57, 99,
-/* 0x2b90 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2ba0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2bb0 */  48, 48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2bc0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2bd0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52, 32, 82, 95, 65,
-/* 0x2be0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2bf0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x2c00 */ 100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2c10 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2c20 */  48, 48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2c30 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2c40 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 48, 32, 82,
-/* 0x2c50 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c60 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2c70 */  48, 56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2c80 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2c90 */  48, 10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2ca0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2cb0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 56, 56,
-/* 0x2cc0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2cd0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2ce0 */  48, 48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2cf0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2d00 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 56,101, 56, 32, 82, 95, 65,
-/* 0x2d10 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2d20 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x2d30 */ 102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2d40 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2d50 */  48, 48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2d60 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2d70 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 48, 52, 32, 82,
-/* 0x2d80 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d90 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2da0 */  48, 57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2db0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2dc0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x2dd0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95,
-/* 0x2de0 */  68, 69, 67, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2df0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2e00 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55,
-/* 0x2e10 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2e20 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x2e30 */  48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2e40 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2e50 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95,
-/* 0x2e60 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2e70 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2e80 */  48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2e90 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x2ea0 */  10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2eb0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2ec0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,101, 52, 32,
-/* 0x2ed0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2ee0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x2ef0 */  48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2f00 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2f10 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82,
-/* 0x2f20 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2f30 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 49,
-/* 0x2f40 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2f50 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x2f60 */  48, 48, 48, 48, 49, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2f70 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2f80 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95,
-/* 0x2f90 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2fa0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2fb0 */  49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2fc0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x2fd0 */  10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2fe0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2ff0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 99, 32,
-/* 0x3000 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3010 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3020 */  48, 48, 49, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3030 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3040 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82,
-/* 0x3050 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3060 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56,
-/* 0x3070 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3080 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3090 */  48, 48, 48, 48, 49, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x30a0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x30b0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 57, 99, 32, 82, 95,
-/* 0x30c0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x30d0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x30e0 */  49, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x30f0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3100 */  10, 48, 48, 48, 48, 48, 49, 99, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3110 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3120 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32,
-/* 0x3130 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3140 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3150 */  48, 48, 49,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3160 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3170 */  49, 48, 10, 48, 48, 48, 48, 48, 49,100, 99, 32, 82, 95, 65, 82,
-/* 0x3180 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3190 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,101,
-/* 0x31a0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x31b0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x31c0 */  48, 48, 48, 48, 49,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x31d0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x31e0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 56, 32, 82, 95,
-/* 0x31f0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3200 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3210 */  50, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3220 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3230 */  10, 48, 48, 48, 48, 48, 50, 52, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3240 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3250 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32,
-/* 0x3260 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3270 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3280 */  48, 48, 50, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3290 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x32a0 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 54, 56, 32, 82, 95, 65, 82,
-/* 0x32b0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x32c0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 56,
-/* 0x32d0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x32e0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x32f0 */  48, 48, 48, 48, 50, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3300 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3310 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95,
-/* 0x3320 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3330 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3340 */  50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3350 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3360 */  10, 48, 48, 48, 48, 48, 50,100, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3370 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3380 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100, 99, 32,
-/* 0x3390 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x33a0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x33b0 */  48, 48, 50,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x33c0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x33d0 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82,
-/* 0x33e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x33f0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 49,
-/* 0x3400 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3410 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3420 */  48, 48, 48, 48, 51, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3430 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3440 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 48, 32, 82, 95,
-/* 0x3450 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3460 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3470 */  51, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3480 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3490 */  10, 48, 48, 48, 48, 48, 51, 55, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x34a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x34b0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 56, 32,
-/* 0x34c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x34d0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x34e0 */  48, 48, 51, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x34f0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3500 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 48, 32, 82, 95, 65, 82,
-/* 0x3510 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3520 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98,
-/* 0x3530 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3540 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3550 */  48, 48, 48, 48, 51, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3560 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3570 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95,
-/* 0x3580 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3590 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x35a0 */  52, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x35b0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x35c0 */  10, 48, 48, 48, 48, 48, 52, 49, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x35d0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x35e0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 52, 48, 32,
-/* 0x35f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3600 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x3610 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x3620 */  32, 70, 79, 82, 32, 91, 77, 65, 67, 72, 77, 65, 73, 78, 90, 93,
-/* 0x3630 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x3640 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x3650 */  85, 69, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82,
-/* 0x3660 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65,
-/* 0x3670 */  67, 72, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 49, 56,
-/* 0x3680 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3690 */  32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48, 48, 48,
-/* 0x36a0 */  48, 48, 49, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x36b0 */  32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x36c0 */  90, 10, 48, 48, 48, 48, 48, 49, 51, 99, 32, 82, 95, 65, 82, 77,
-/* 0x36d0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67,
-/* 0x36e0 */  72, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32,
-/* 0x36f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3700 */  32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48,
-/* 0x3710 */  48, 49, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3720 */  32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90,
-/* 0x3730 */  10
+/* 0x1390 */   0,160, 74,224,  8,176, 64,226,254,255,255,235, 12,  0,  0,  0,
+/* 0x13a0 */  18,  0,  0,  0,195,  0,  0,  0,223,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13b0 */  52,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x13c0 */  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,
+/* 0x13d0 */  64,  0,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,
+/* 0x13e0 */ 132,  1,  0,  0, 48,  1,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,
+/* 0x13f0 */ 180,  2,  0,  0,244,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,
+/* 0x1400 */ 168,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,
+/* 0x1410 */ 168,  3,  0,  0,192,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,
+/* 0x1420 */ 104,  4,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1430 */ 160, 13,  0,  0,120,  4,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0,
+/* 0x1440 */  24, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x1450 */  24, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0,
+/* 0x1460 */  24, 18,  0,  0,132,  1,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,
+/* 0x1470 */   2,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1480 */   0,  0,  0,  0, 31,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1490 */  46,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,
+/* 0x14a0 */   7,  0,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,  8,  0,  0,  0,
+/* 0x14b0 */   0,  0,  0,  0,100,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x14d0 */   1,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,  5,  0,  0,  0,
+/* 0x14e0 */   0,  0,  0,  0, 79,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */  90,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,110,  0,  0,  0,
+/* 0x1500 */   0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1510 */   0,  0,  0,  0,140,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */ 163,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,186,  0,  0,  0,
+/* 0x1530 */   8,  0,  0,  0,  0,  0,  0,  0,197,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1540 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,212,  0,  0,  0,
+/* 0x1550 */ 100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1560 */  16,  0,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1570 */   0,  0,  0,  0,  2,  0,  0,  0,116,  0,  0,  0,212,  0,  0,  0,
+/* 0x1580 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1590 */ 120,  0,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15a0 */   0,  0,  0,  0,  2,  0,  0,  0,128,  0,  0,  0,212,  0,  0,  0,
+/* 0x15b0 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x15c0 */ 140,  0,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15d0 */   0,  0,  0,  0,  2,  0,  0,  0,152,  0,  0,  0,212,  0,  0,  0,
+/* 0x15e0 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x15f0 */ 164,  0,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1600 */   0,  0,  0,  0,  2,  0,  0,  0,168,  0,  0,  0,212,  0,  0,  0,
+/* 0x1610 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1620 */ 180,  0,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1630 */   0,  0,  0,  0,  2,  0,  0,  0,196,  0,  0,  0,212,  0,  0,  0,
+/* 0x1640 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1650 */ 204,  0,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1660 */   0,  0,  0,  0,  2,  0,  0,  0,208,  0,  0,  0,212,  0,  0,  0,
+/* 0x1670 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1680 */ 216,  0,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1690 */   0,  0,  0,  0,  2,  0,  0,  0,220,  0,  0,  0,212,  0,  0,  0,
+/* 0x16a0 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x16b0 */ 232,  0,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16c0 */   0,  0,  0,  0,  2,  0,  0,  0,236,  0,  0,  0,212,  0,  0,  0,
+/* 0x16d0 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x16e0 */ 244,  0,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16f0 */   0,  0,  0,  0,  2,  0,  0,  0,  0,  1,  0,  0,212,  0,  0,  0,
+/* 0x1700 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1710 */   4,  1,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1720 */   0,  0,  0,  0,  2,  0,  0,  0, 12,  1,  0,  0,212,  0,  0,  0,
+/* 0x1730 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1740 */  20,  1,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1750 */   0,  0,  0,  0,  2,  0,  0,  0, 60,  1,  0,  0,212,  0,  0,  0,
+/* 0x1760 */  19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1770 */  64,  1,  0,  0,212,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1780 */   0,  0,  0,  0,  3,  0,  0,  0, 16,  0,  0,  0,212,  0,  0,  0,
+/* 0x1790 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x17a0 */ 116,  0,  0,  0,212,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17b0 */   0,  0,  0,  0,  3,  0,  0,  0,120,  0,  0,  0,212,  0,  0,  0,
+/* 0x17c0 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x17d0 */ 128,  0,  0,  0,212,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17e0 */   0,  0,  0,  0,  3,  0,  0,  0,140,  0,  0,  0,212,  0,  0,  0,
+/* 0x17f0 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1800 */ 152,  0,  0,  0,212,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1810 */   0,  0,  0,  0,  3,  0,  0,  0,164,  0,  0,  0,212,  0,  0,  0,
+/* 0x1820 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1830 */ 168,  0,  0,  0,212,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1840 */   0,  0,  0,  0,  3,  0,  0,  0,180,  0,  0,  0,212,  0,  0,  0,
+/* 0x1850 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1860 */ 196,  0,  0,  0,212,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1870 */   0,  0,  0,  0,  3,  0,  0,  0,204,  0,  0,  0,212,  0,  0,  0,
+/* 0x1880 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1890 */ 212,  0,  0,  0,212,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18a0 */   0,  0,  0,  0,  3,  0,  0,  0,224,  0,  0,  0,212,  0,  0,  0,
+/* 0x18b0 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x18c0 */ 232,  0,  0,  0,212,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18d0 */   0,  0,  0,  0,  3,  0,  0,  0,244,  0,  0,  0,212,  0,  0,  0,
+/* 0x18e0 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x18f0 */   0,  1,  0,  0,212,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1900 */   0,  0,  0,  0,  3,  0,  0,  0,  4,  1,  0,  0,212,  0,  0,  0,
+/* 0x1910 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1920 */  40,  1,  0,  0,212,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1930 */   0,  0,  0,  0,  3,  0,  0,  0, 44,  1,  0,  0,212,  0,  0,  0,
+/* 0x1940 */  25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1950 */  16,  0,  0,  0,212,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1960 */   0,  0,  0,  0,  4,  0,  0,  0,120,  0,  0,  0,212,  0,  0,  0,
+/* 0x1970 */  31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1980 */ 128,  0,  0,  0,212,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1990 */   0,  0,  0,  0,  4,  0,  0,  0,132,  0,  0,  0,212,  0,  0,  0,
+/* 0x19a0 */  31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x19b0 */ 148,  0,  0,  0,212,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19c0 */   0,  0,  0,  0,  4,  0,  0,  0,152,  0,  0,  0,212,  0,  0,  0,
+/* 0x19d0 */  31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x19e0 */ 156,  0,  0,  0,212,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0,  0,  4,  0,  0,  0,168,  0,  0,  0,212,  0,  0,  0,
+/* 0x1a00 */  31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1a10 */ 184,  0,  0,  0,212,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */   0,  0,  0,  0,  4,  0,  0,  0,188,  0,  0,  0,212,  0,  0,  0,
+/* 0x1a30 */  31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1a40 */ 196,  0,  0,  0,212,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */   0,  0,  0,  0,  4,  0,  0,  0,204,  0,  0,  0,212,  0,  0,  0,
+/* 0x1a60 */  31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1a70 */ 208,  0,  0,  0,212,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0,  4,  0,  0,  0,236,  0,  0,  0,212,  0,  0,  0,
+/* 0x1a90 */  31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1aa0 */ 240,  0,  0,  0,212,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */   0,  0,  0,  0,  6,  0,  0,  0,  8,  0,  0,  0,212,  0,  0,  0,
+/* 0x1ac0 */  46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1ad0 */  76,  0,  0,  0,212,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */   0,  0,  0,  0,  6,  0,  0,  0,128,  0,  0,  0,212,  0,  0,  0,
+/* 0x1af0 */  46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1b00 */ 188,  0,  0,  0,212,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */   0,  0,  0,  0,  7,  0,  0,  0,116,  0,  0,  0,212,  0,  0,  0,
+/* 0x1b20 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b30 */ 144,  0,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b40 */   0,  0,  0,  0,  7,  0,  0,  0,184,  0,  0,  0,212,  0,  0,  0,
+/* 0x1b50 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b60 */ 204,  0,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */   0,  0,  0,  0,  7,  0,  0,  0,244,  0,  0,  0,212,  0,  0,  0,
+/* 0x1b80 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b90 */   0,  1,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   0,  0,  0,  0,  7,  0,  0,  0,  8,  1,  0,  0,212,  0,  0,  0,
+/* 0x1bb0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1bc0 */  68,  1,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bd0 */   0,  0,  0,  0,  7,  0,  0,  0,144,  1,  0,  0,212,  0,  0,  0,
+/* 0x1be0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1bf0 */ 204,  1,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c00 */   0,  0,  0,  0,  7,  0,  0,  0,216,  1,  0,  0,212,  0,  0,  0,
+/* 0x1c10 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c20 */   4,  2,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */   0,  0,  0,  0,  7,  0,  0,  0, 24,  2,  0,  0,212,  0,  0,  0,
+/* 0x1c40 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c50 */  32,  2,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */   0,  0,  0,  0,  7,  0,  0,  0, 52,  2,  0,  0,212,  0,  0,  0,
+/* 0x1c70 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c80 */  60,  2,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */   0,  0,  0,  0,  7,  0,  0,  0, 64,  2,  0,  0,212,  0,  0,  0,
+/* 0x1ca0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1cb0 */  76,  2,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cc0 */   0,  0,  0,  0,  7,  0,  0,  0, 88,  2,  0,  0,212,  0,  0,  0,
+/* 0x1cd0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ce0 */ 164,  2,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cf0 */   0,  0,  0,  0,  7,  0,  0,  0,200,  2,  0,  0,212,  0,  0,  0,
+/* 0x1d00 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d10 */ 232,  2,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */   0,  0,  0,  0,  7,  0,  0,  0,  4,  3,  0,  0,212,  0,  0,  0,
+/* 0x1d30 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d40 */  12,  3,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d50 */   0,  0,  0,  0,  7,  0,  0,  0, 60,  3,  0,  0,212,  0,  0,  0,
+/* 0x1d60 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d70 */ 136,  3,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d80 */   0,  0,  0,  0,  7,  0,  0,  0,160,  3,  0,  0,212,  0,  0,  0,
+/* 0x1d90 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1da0 */ 168,  3,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */   0,  0,  0,  0,  7,  0,  0,  0,204,  3,  0,  0,212,  0,  0,  0,
+/* 0x1dc0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1dd0 */ 224,  3,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0,  7,  0,  0,  0,232,  3,  0,  0,212,  0,  0,  0,
+/* 0x1df0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e00 */  36,  4,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0,  7,  0,  0,  0, 56,  4,  0,  0,212,  0,  0,  0,
+/* 0x1e20 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e30 */ 108,  4,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0,  7,  0,  0,  0,132,  4,  0,  0,212,  0,  0,  0,
+/* 0x1e50 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e60 */ 140,  4,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0,  7,  0,  0,  0,176,  4,  0,  0,212,  0,  0,  0,
+/* 0x1e80 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e90 */ 212,  4,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0,  7,  0,  0,  0,236,  4,  0,  0,212,  0,  0,  0,
+/* 0x1eb0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ec0 */ 244,  4,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  7,  0,  0,  0, 24,  5,  0,  0,212,  0,  0,  0,
+/* 0x1ee0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ef0 */  60,  5,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0,  7,  0,  0,  0,152,  5,  0,  0,212,  0,  0,  0,
+/* 0x1f10 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f20 */ 160,  5,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0,  7,  0,  0,  0,192,  5,  0,  0,212,  0,  0,  0,
+/* 0x1f40 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f50 */ 228,  5,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0,  7,  0,  0,  0,252,  5,  0,  0,212,  0,  0,  0,
+/* 0x1f70 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f80 */   4,  6,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0,  7,  0,  0,  0, 36,  6,  0,  0,212,  0,  0,  0,
+/* 0x1fa0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1fb0 */  72,  6,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0,  7,  0,  0,  0,128,  6,  0,  0,212,  0,  0,  0,
+/* 0x1fd0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1fe0 */ 140,  6,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0,  7,  0,  0,  0,208,  6,  0,  0,212,  0,  0,  0,
+/* 0x2000 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2010 */ 236,  6,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0,  7,  0,  0,  0, 28,  7,  0,  0,212,  0,  0,  0,
+/* 0x2030 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2040 */  40,  7,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,  7,  0,  0,  0,108,  7,  0,  0,212,  0,  0,  0,
+/* 0x2060 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2070 */ 124,  7,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,  7,  0,  0,  0,156,  7,  0,  0,212,  0,  0,  0,
+/* 0x2090 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20a0 */ 184,  7,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,  7,  0,  0,  0,196,  7,  0,  0,212,  0,  0,  0,
+/* 0x20c0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20d0 */ 208,  7,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0,  7,  0,  0,  0,244,  7,  0,  0,212,  0,  0,  0,
+/* 0x20f0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2100 */  32,  8,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,  0,  7,  0,  0,  0, 44,  8,  0,  0,212,  0,  0,  0,
+/* 0x2120 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2130 */ 124,  8,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,  0,  7,  0,  0,  0,136,  8,  0,  0,212,  0,  0,  0,
+/* 0x2150 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2160 */ 160,  8,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  0,  7,  0,  0,  0,232,  8,  0,  0,212,  0,  0,  0,
+/* 0x2180 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2190 */ 244,  8,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0,  7,  0,  0,  0,252,  8,  0,  0,212,  0,  0,  0,
+/* 0x21b0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x21c0 */   4,  9,  0,  0,212,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0,  7,  0,  0,  0, 40,  9,  0,  0,212,  0,  0,  0,
+/* 0x21e0 */  57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x21f0 */ 120,  0,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0,  8,  0,  0,  0,128,  0,  0,  0,212,  0,  0,  0,
+/* 0x2210 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2220 */ 136,  0,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2230 */   0,  0,  0,  0,  8,  0,  0,  0,168,  0,  0,  0,212,  0,  0,  0,
+/* 0x2240 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2250 */ 172,  0,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2260 */   0,  0,  0,  0,  8,  0,  0,  0,228,  0,  0,  0,212,  0,  0,  0,
+/* 0x2270 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2280 */   0,  1,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2290 */   0,  0,  0,  0,  8,  0,  0,  0, 12,  1,  0,  0,212,  0,  0,  0,
+/* 0x22a0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x22b0 */  20,  1,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22c0 */   0,  0,  0,  0,  8,  0,  0,  0, 24,  1,  0,  0,212,  0,  0,  0,
+/* 0x22d0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x22e0 */  32,  1,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0,  8,  0,  0,  0, 40,  1,  0,  0,212,  0,  0,  0,
+/* 0x2300 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2310 */  68,  1,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2320 */   0,  0,  0,  0,  8,  0,  0,  0, 76,  1,  0,  0,212,  0,  0,  0,
+/* 0x2330 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2340 */  80,  1,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2350 */   0,  0,  0,  0,  8,  0,  0,  0,128,  1,  0,  0,212,  0,  0,  0,
+/* 0x2360 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2370 */ 136,  1,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2380 */   0,  0,  0,  0,  8,  0,  0,  0,140,  1,  0,  0,212,  0,  0,  0,
+/* 0x2390 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23a0 */ 156,  1,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23b0 */   0,  0,  0,  0,  8,  0,  0,  0,160,  1,  0,  0,212,  0,  0,  0,
+/* 0x23c0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23d0 */ 192,  1,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23e0 */   0,  0,  0,  0,  8,  0,  0,  0,204,  1,  0,  0,212,  0,  0,  0,
+/* 0x23f0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2400 */ 212,  1,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2410 */   0,  0,  0,  0,  8,  0,  0,  0,220,  1,  0,  0,212,  0,  0,  0,
+/* 0x2420 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2430 */ 228,  1,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2440 */   0,  0,  0,  0,  8,  0,  0,  0,236,  1,  0,  0,212,  0,  0,  0,
+/* 0x2450 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2460 */  40,  2,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2470 */   0,  0,  0,  0,  8,  0,  0,  0, 44,  2,  0,  0,212,  0,  0,  0,
+/* 0x2480 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2490 */  68,  2,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24a0 */   0,  0,  0,  0,  8,  0,  0,  0, 76,  2,  0,  0,212,  0,  0,  0,
+/* 0x24b0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24c0 */  80,  2,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24d0 */   0,  0,  0,  0,  8,  0,  0,  0,104,  2,  0,  0,212,  0,  0,  0,
+/* 0x24e0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24f0 */ 132,  2,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2500 */   0,  0,  0,  0,  8,  0,  0,  0,140,  2,  0,  0,212,  0,  0,  0,
+/* 0x2510 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2520 */ 164,  2,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2530 */   0,  0,  0,  0,  8,  0,  0,  0,200,  2,  0,  0,212,  0,  0,  0,
+/* 0x2540 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2550 */ 208,  2,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2560 */   0,  0,  0,  0,  8,  0,  0,  0,220,  2,  0,  0,212,  0,  0,  0,
+/* 0x2570 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2580 */ 244,  2,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2590 */   0,  0,  0,  0,  8,  0,  0,  0, 12,  3,  0,  0,212,  0,  0,  0,
+/* 0x25a0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25b0 */  20,  3,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25c0 */   0,  0,  0,  0,  8,  0,  0,  0, 44,  3,  0,  0,212,  0,  0,  0,
+/* 0x25d0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25e0 */  80,  3,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25f0 */   0,  0,  0,  0,  8,  0,  0,  0, 88,  3,  0,  0,212,  0,  0,  0,
+/* 0x2600 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2610 */ 112,  3,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2620 */   0,  0,  0,  0,  8,  0,  0,  0,120,  3,  0,  0,212,  0,  0,  0,
+/* 0x2630 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2640 */ 156,  3,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2650 */   0,  0,  0,  0,  8,  0,  0,  0,176,  3,  0,  0,212,  0,  0,  0,
+/* 0x2660 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2670 */ 184,  3,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2680 */   0,  0,  0,  0,  8,  0,  0,  0,200,  3,  0,  0,212,  0,  0,  0,
+/* 0x2690 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x26a0 */ 204,  3,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26b0 */   0,  0,  0,  0,  8,  0,  0,  0,  0,  4,  0,  0,212,  0,  0,  0,
+/* 0x26c0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x26d0 */  24,  4,  0,  0,212,  0,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26e0 */   0,  0,  0,  0,  8,  0,  0,  0, 64,  4,  0,  0,212,  0,  0,  0,
+/* 0x26f0 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2700 */  12,  1,  0,  0,212,  0,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2710 */   0,  0,  0,  0, 11,  0,  0,  0, 24,  1,  0,  0,212,  0,  0,  0,
+/* 0x2720 */ 100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2730 */  36,  1,  0,  0,212,  0,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */   0,  0,  0,  0, 11,  0,  0,  0, 60,  1,  0,  0,212,  0,  0,  0,
+/* 0x2750 */ 100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2760 */  68,  1,  0,  0,212,  0,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */   0,  0,  0,  0, 11,  0,  0,  0,128,  1,  0,  0,212,  0,  0,  0,
+/* 0x2780 */ 100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 77, 65, 67, 72,
+/* 0x2790 */  77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78,
+/* 0x27a0 */  82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,
+/* 0x27b0 */   0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 76, 90, 77, 65, 95, 69,
+/* 0x27c0 */  76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0,
+/* 0x27d0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95,
+/* 0x27e0 */  68, 69, 67, 51, 48,  0, 77, 65, 67, 72, 77, 65, 73, 78, 89,  0,
+/* 0x27f0 */  77, 65, 67, 72, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,
+/* 0x2800 */   0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,
+/* 0x2810 */ 112,114,101,115,115, 95, 56,  0,117, 99,108, 95,110,114,118, 50,
+/* 0x2820 */ 100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,117,
+/* 0x2830 */  99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,
+/* 0x2840 */ 101,115,115, 95, 56,  0, 76,122,109, 97, 68,101, 99,111,100,101,
+/* 0x2850 */   0,101,110,100, 95,100,101, 99,111,109,112,114,101,115,115,  0,
+/* 0x2860 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52,  0,156, 19,  0,  0, 85,
+/* 0x2870 */  80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v5a-linux.elf-entry.h
-   created from arm.v5a-linux.elf-entry.bin, 14006 (0x36b6) bytes
+   created from arm.v5a-linux.elf-entry.bin, 10250 (0x280a) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V5A_LINUX_ELF_ENTRY_SIZE    14006
-#define STUB_ARM_V5A_LINUX_ELF_ENTRY_ADLER32 0x66c37fd8
-#define STUB_ARM_V5A_LINUX_ELF_ENTRY_CRC32   0xda79b3ca
+#define STUB_ARM_V5A_LINUX_ELF_ENTRY_SIZE    10250
+#define STUB_ARM_V5A_LINUX_ELF_ENTRY_ADLER32 0x216d3d28
+#define STUB_ARM_V5A_LINUX_ELF_ENTRY_CRC32   0xf7d3eb37
 
-unsigned char stub_arm_v5a_linux_elf_entry[14006] = {
+unsigned char stub_arm_v5a_linux_elf_entry[10250] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 200, 19,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -342,574 +342,339 @@ unsigned char stub_arm_v5a_linux_elf_entry[14006] = {
 /* 0x12f0 */   0, 96,141,229,  0,144,160,225, 80,  0, 79,226,  0, 16,160,227,
 /* 0x1300 */   5,112,160,227,  0,  0,  0,239,  0,  0, 80,227, 39,  0,  0,186,
 /* 0x1310 */   4,  0,141,229, 12, 48, 30,229,254,255,255,235,  0,  0,  0,  0,
-/* 0x1320 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x1330 */  50, 45,108,105,116,116,108,101, 97,114,109, 10, 10, 83,101, 99,
-/* 0x1340 */ 116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32,
-/* 0x1350 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32,
-/* 0x1360 */  32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x1370 */  32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32,
-/* 0x1380 */  32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48,
-/* 0x1390 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48,
-/* 0x13a0 */  99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42,
-/* 0x13b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49,
-/* 0x13c0 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48,
-/* 0x13d0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42,
-/* 0x13e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32,
-/* 0x13f0 */  78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x1400 */  32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48,
-/* 0x1410 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78,
-/* 0x1420 */  82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 52,
-/* 0x1430 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42,
-/* 0x1440 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52,
-/* 0x1450 */  32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1460 */  49, 51, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 52, 32,
-/* 0x1470 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1480 */  32, 32, 53, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1490 */  32, 32, 48,102, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 98,
-/* 0x14a0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x14b0 */  83, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x14c0 */  32, 32, 32, 32, 48, 99, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x14d0 */  51, 97, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x14e0 */  78, 84, 83, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x14f0 */  50, 48, 32, 32, 32, 32, 48, 57, 51, 56, 32, 32, 48, 32, 32, 48,
-/* 0x1500 */  32, 32, 48, 52, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1510 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95,
-/* 0x1520 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 52, 55, 56, 32, 32, 48,
-/* 0x1530 */  32, 32, 48, 32, 32, 48,100, 97, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1540 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 76, 90,
-/* 0x1550 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 32, 32, 48,
-/* 0x1560 */  32, 32, 48, 32, 32, 48, 49, 50, 49, 99, 32, 32, 50, 42, 42, 48,
-/* 0x1570 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 69,
-/* 0x1580 */  76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 32, 32,
-/* 0x1590 */  48, 32, 32, 48, 32, 32, 48, 49, 50, 49, 99, 32, 32, 50, 42, 42,
-/* 0x15a0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32,
-/* 0x15b0 */  69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x15c0 */  48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 49, 99, 32,
-/* 0x15d0 */  32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x15e0 */  83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48,
-/* 0x15f0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x1600 */  82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1610 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1620 */  86, 50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1630 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1640 */  50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x1650 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x1660 */  95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x1670 */  70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1680 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x1690 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x16a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x16b0 */  77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x16c0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x16d0 */  32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32,
-/* 0x16e0 */  48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48,
-/* 0x16f0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x1700 */  65, 73, 78, 88, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10,
-/* 0x1710 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1720 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86, 95,
-/* 0x1730 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1740 */  32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 48,
-/* 0x1750 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1760 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1770 */  68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1780 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1790 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69,
-/* 0x17a0 */  76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x17c0 */  32, 77, 70, 76, 71, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,103,
-/* 0x17d0 */  32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32,
-/* 0x17e0 */  48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17f0 */  48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 69, 32,
-/* 0x1800 */  48, 49, 52, 52, 32,117, 99,108, 95,110,114,118, 50,101, 95,100,
-/* 0x1810 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x1820 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86,
-/* 0x1830 */  50, 68, 32, 48, 49, 51, 48, 32,117, 99,108, 95,110,114,118, 50,
-/* 0x1840 */ 100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48,
-/* 0x1850 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32,
-/* 0x1860 */  78, 82, 86, 50, 66, 32, 48,102, 52, 32,117, 99,108, 95,110,114,
-/* 0x1870 */ 118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x1880 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1890 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,
-/* 0x18a0 */ 122,109, 97, 68,101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48,
-/* 0x18b0 */  48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65,
-/* 0x18c0 */  73, 78, 89, 32, 48, 32,101,110,100, 95,100,101, 99,111,109,112,
-/* 0x18d0 */ 114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x18e0 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 79, 95,
-/* 0x18f0 */  66, 73, 78, 70, 79, 10, 48, 48, 48, 48, 48, 49, 48, 52, 32,103,
-/* 0x1900 */  32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32,
-/* 0x1910 */  48, 32, 99,112,114, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x1920 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x1930 */  69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x1940 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1950 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x1960 */  48, 48, 48, 48, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,
-/* 0x1970 */  32, 32, 32, 32, 32, 32, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48,
-/* 0x1980 */  48, 48, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1990 */  32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x19a0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x19b0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58,
-/* 0x19c0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x19d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x19e0 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77,
-/* 0x19f0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1a00 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82,
-/* 0x1a10 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1a20 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65,
-/* 0x1a30 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1a40 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95,
-/* 0x1a50 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a60 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82,
-/* 0x1a70 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a80 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 56, 32,
-/* 0x1a90 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1aa0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97, 52,
-/* 0x1ab0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1ac0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x1ad0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1ae0 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1af0 */  98, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1b00 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1b10 */  48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1b20 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1b30 */  48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1b40 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1b50 */  48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1b60 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1b70 */  48, 48, 48, 48,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1b80 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1b90 */  48, 48, 48, 48, 48,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1ba0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1bb0 */  48, 48, 48, 48, 48, 48,101, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1bc0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1bd0 */  10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1be0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1bf0 */  69, 10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77,
-/* 0x1c00 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1c10 */  50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82,
-/* 0x1c20 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1c30 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 52, 32, 82, 95, 65,
-/* 0x1c40 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1c50 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95,
-/* 0x1c60 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c70 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 49, 52, 32, 82,
-/* 0x1c80 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c90 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 51, 99, 32,
-/* 0x1ca0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1cb0 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 52, 48,
-/* 0x1cc0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1cd0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x1ce0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x1cf0 */  32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1d00 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d10 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1d30 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1d40 */  48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1d50 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1d60 */  48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1d70 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1d90 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1db0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x1dc0 */  48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1dd0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x1de0 */  10, 48, 48, 48, 48, 48, 48, 97, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1df0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1e00 */  68, 10, 48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77,
-/* 0x1e10 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1e20 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 65, 82,
-/* 0x1e30 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1e40 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65,
-/* 0x1e50 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1e60 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95,
-/* 0x1e70 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e80 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 52, 32, 82,
-/* 0x1e90 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ea0 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 48, 32,
-/* 0x1eb0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1ec0 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 56,
-/* 0x1ed0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1ee0 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,102,
-/* 0x1ef0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1f00 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49,
-/* 0x1f10 */  48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1f20 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1f30 */  49, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1f40 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1f50 */  48, 49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1f60 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1f70 */  48, 48, 49, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1f80 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 10, 82,
-/* 0x1f90 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x1fa0 */  83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79,
-/* 0x1fb0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x1fc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x1fd0 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1fe0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x1ff0 */  10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2000 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2010 */  66, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2020 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2030 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82,
-/* 0x2040 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2050 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82, 95, 65,
-/* 0x2060 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2070 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95,
-/* 0x2080 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2090 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32, 82,
-/* 0x20a0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20b0 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 56, 32,
-/* 0x20c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x20d0 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 56,
-/* 0x20e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x20f0 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x2100 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2110 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2120 */  99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2130 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x2140 */  48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2150 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x2160 */  48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2170 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x2180 */  48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2190 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x21a0 */  48, 48, 48, 48,102, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x21b0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 10,
-/* 0x21c0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x21d0 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x21e0 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x21f0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2200 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82,
-/* 0x2210 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2220 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48,
-/* 0x2230 */  48, 48, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2240 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x2250 */  48, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2260 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2270 */  65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 99, 48,
-/* 0x2280 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2290 */  32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 10, 82,
-/* 0x22a0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x22b0 */  83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x22c0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x22d0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x22e0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95,
-/* 0x22f0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2300 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2310 */  48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2320 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2330 */  10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2340 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2350 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32,
-/* 0x2360 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2370 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2380 */  48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2390 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x23a0 */  50, 48, 10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82,
-/* 0x23b0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x23c0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 48,
-/* 0x23d0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x23e0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x23f0 */  48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2400 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2410 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 57, 48, 32, 82, 95,
-/* 0x2420 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2430 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2440 */  49, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2450 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2460 */  10, 48, 48, 48, 48, 48, 49,100, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2470 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2480 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 48, 52, 32,
-/* 0x2490 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x24a0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x24b0 */  48, 48, 50, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x24c0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x24d0 */  50, 48, 10, 48, 48, 48, 48, 48, 50, 50, 48, 32, 82, 95, 65, 82,
-/* 0x24e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x24f0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51,
-/* 0x2500 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2510 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2520 */  48, 48, 48, 48, 50, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2530 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2540 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 52, 48, 32, 82, 95,
-/* 0x2550 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2560 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2570 */  50, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2580 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2590 */  10, 48, 48, 48, 48, 48, 50, 53, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x25a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x25b0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32,
-/* 0x25c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x25d0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x25e0 */  48, 48, 50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x25f0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2600 */  50, 48, 10, 48, 48, 48, 48, 48, 50,101, 56, 32, 82, 95, 65, 82,
-/* 0x2610 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2620 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48,
-/* 0x2630 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2640 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2650 */  48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2660 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2670 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 51, 99, 32, 82, 95,
-/* 0x2680 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2690 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x26a0 */  51, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x26b0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x26c0 */  10, 48, 48, 48, 48, 48, 51, 97, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x26d0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x26e0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97, 56, 32,
-/* 0x26f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2700 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2710 */  48, 48, 51, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2720 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2730 */  50, 48, 10, 48, 48, 48, 48, 48, 51,101, 48, 32, 82, 95, 65, 82,
-/* 0x2740 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2750 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,101,
-/* 0x2760 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2770 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2780 */  48, 48, 48, 48, 52, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2790 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x27a0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 51, 56, 32, 82, 95,
-/* 0x27b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27c0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x27d0 */  52, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x27e0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x27f0 */  10, 48, 48, 48, 48, 48, 52, 56, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2800 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2810 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56, 99, 32,
-/* 0x2820 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2830 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2840 */  48, 48, 52, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2850 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2860 */  50, 48, 10, 48, 48, 48, 48, 48, 52,100, 52, 32, 82, 95, 65, 82,
-/* 0x2870 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2880 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,101,
-/* 0x2890 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x28a0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x28b0 */  48, 48, 48, 48, 52,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x28c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x28d0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 49, 56, 32, 82, 95,
-/* 0x28e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x28f0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2900 */  53, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2910 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2920 */  10, 48, 48, 48, 48, 48, 53, 57, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2930 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2940 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 97, 48, 32,
-/* 0x2950 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2960 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2970 */  48, 48, 53, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2980 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2990 */  50, 48, 10, 48, 48, 48, 48, 48, 53,101, 52, 32, 82, 95, 65, 82,
-/* 0x29a0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x29b0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,102,
-/* 0x29c0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x29d0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x29e0 */  48, 48, 48, 48, 54, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x29f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2a00 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 50, 52, 32, 82, 95,
-/* 0x2a10 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a20 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2a30 */  54, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2a40 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2a50 */  10, 48, 48, 48, 48, 48, 54, 56, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2a60 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2a70 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56, 99, 32,
-/* 0x2a80 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2a90 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2aa0 */  48, 48, 54,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2ab0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2ac0 */  50, 48, 10, 48, 48, 48, 48, 48, 54,101, 99, 32, 82, 95, 65, 82,
-/* 0x2ad0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2ae0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 49,
-/* 0x2af0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2b00 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2b10 */  48, 48, 48, 48, 55, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2b20 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2b30 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 54, 99, 32, 82, 95,
-/* 0x2b40 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b50 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2b60 */  55, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2b70 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2b80 */  10, 48, 48, 48, 48, 48, 55, 57, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2b90 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2ba0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 98, 56, 32,
-/* 0x2bb0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2bc0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2bd0 */  48, 48, 55, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2be0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2bf0 */  50, 48, 10, 48, 48, 48, 48, 48, 55,100, 48, 32, 82, 95, 65, 82,
-/* 0x2c00 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2c10 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,102,
-/* 0x2c20 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2c30 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2c40 */  48, 48, 48, 48, 56, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2c50 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2c60 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 99, 32, 82, 95,
-/* 0x2c70 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c80 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2c90 */  56, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2ca0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2cb0 */  10, 48, 48, 48, 48, 48, 56, 56, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2cc0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2cd0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 97, 48, 32,
-/* 0x2ce0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2cf0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2d00 */  48, 48, 56,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2d10 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2d20 */  50, 48, 10, 48, 48, 48, 48, 48, 56,102, 52, 32, 82, 95, 65, 82,
-/* 0x2d30 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2d40 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,102,
-/* 0x2d50 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2d60 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2d70 */  48, 48, 48, 48, 57, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2d80 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2d90 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 50, 56, 32, 82, 95,
-/* 0x2da0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2db0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79,
-/* 0x2dc0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2dd0 */  79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 93, 58,
-/* 0x2de0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x2df0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x2e00 */  69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x2e10 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2e20 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 48,
-/* 0x2e30 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2e40 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x2e50 */  48, 48, 48, 48, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2e60 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2e70 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65,
-/* 0x2e80 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2e90 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2ea0 */  97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2eb0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x2ec0 */  48, 48, 48, 48, 48, 48,101, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2ed0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2ee0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82,
-/* 0x2ef0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2f00 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x2f10 */  48, 49, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2f20 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x2f30 */  48, 10, 48, 48, 48, 48, 48, 49, 49, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2f40 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2f50 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 49, 56,
-/* 0x2f60 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2f70 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x2f80 */  48, 48, 48, 49, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2f90 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2fa0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 56, 32, 82, 95, 65,
-/* 0x2fb0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2fc0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x2fd0 */  52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2fe0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x2ff0 */  48, 48, 48, 48, 48, 49, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3000 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3010 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 53, 48, 32, 82,
-/* 0x3020 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3030 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3040 */  48, 49, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3050 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3060 */  48, 10, 48, 48, 48, 48, 48, 49, 56, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3070 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3080 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 99,
-/* 0x3090 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x30a0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x30b0 */  48, 48, 48, 49, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x30c0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x30d0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 97, 48, 32, 82, 95, 65,
-/* 0x30e0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x30f0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3100 */  99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3110 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3120 */  48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3130 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3140 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,100, 52, 32, 82,
-/* 0x3150 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3160 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3170 */  48, 49,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3180 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3190 */  48, 10, 48, 48, 48, 48, 48, 49,101, 52, 32, 82, 95, 65, 82, 77,
-/* 0x31a0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x31b0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,101, 99,
-/* 0x31c0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x31d0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x31e0 */  48, 48, 48, 50, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x31f0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3200 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 99, 32, 82, 95, 65,
-/* 0x3210 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3220 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3230 */  52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3240 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3250 */  48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3260 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3270 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 53, 48, 32, 82,
-/* 0x3280 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3290 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x32a0 */  48, 50, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x32b0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x32c0 */  48, 10, 48, 48, 48, 48, 48, 50, 56, 52, 32, 82, 95, 65, 82, 77,
-/* 0x32d0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x32e0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 56, 99,
-/* 0x32f0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3300 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3310 */  48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3320 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3330 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65,
-/* 0x3340 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3350 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3360 */ 100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3370 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3380 */  48, 48, 48, 48, 48, 50,100, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3390 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x33a0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,102, 52, 32, 82,
-/* 0x33b0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x33c0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x33d0 */  48, 51, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x33e0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x33f0 */  48, 10, 48, 48, 48, 48, 48, 51, 49, 52, 32, 82, 95, 65, 82, 77,
-/* 0x3400 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3410 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 50, 99,
-/* 0x3420 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3430 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3440 */  48, 48, 48, 51, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3450 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3460 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 56, 32, 82, 95, 65,
-/* 0x3470 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3480 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x3490 */  55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x34a0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x34b0 */  48, 48, 48, 48, 48, 51, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x34c0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x34d0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 57, 99, 32, 82,
-/* 0x34e0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x34f0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3500 */  48, 51, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3510 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3520 */  48, 10, 48, 48, 48, 48, 48, 51, 98, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3530 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3540 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 56,
-/* 0x3550 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3560 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3570 */  48, 48, 48, 51, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3580 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3590 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 48, 48, 32, 82, 95, 65,
-/* 0x35a0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x35b0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x35c0 */  49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x35d0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x35e0 */  48, 48, 48, 48, 48, 52, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x35f0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3600 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x3610 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x3620 */  76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x3630 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3640 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x3650 */  48,102, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3660 */  32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48,
-/* 0x3670 */  48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3680 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x3690 */  78, 90, 10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82,
-/* 0x36a0 */  77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32, 79, 95,
-/* 0x36b0 */  66, 73, 78, 70, 79, 10
+/* 0x1320 */  12,  0,  0,  0, 21,  0,  0,  0,193,  0,  0,  0,250,  0,  0,  0,
+/* 0x1330 */   0,  0,  0,  0, 52,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1340 */   9,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1350 */  18,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1360 */  27,  0,  0,  0, 64,  0,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1370 */  33,  0,  0,  0,132,  1,  0,  0, 48,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1380 */  39,  0,  0,  0,180,  2,  0,  0,244,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1390 */  45,  0,  0,  0,168,  3,  0,  0,196,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13a0 */  56,  0,  0,  0,108,  4,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0,
+/* 0x13b0 */  67,  0,  0,  0,164, 13,  0,  0,120,  4,  0,  0,  0,  0,  0,  0,
+/* 0x13c0 */  78,  0,  0,  0, 28, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13d0 */  89,  0,  0,  0, 28, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13e0 */  98,  0,  0,  0, 28, 18,  0,  0,  4,  1,  0,  0,  2,  0,  0,  0,
+/* 0x13f0 */  27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1400 */   4,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1410 */   0,  0,  0,  0, 45,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1420 */  56,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1430 */   8,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1440 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1450 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1460 */   2,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1470 */   0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1480 */ 107,  0,  0,  0, 13,  0,  0,  0,173,222,173,222,112,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  4,  0,  0,  0,119,  0,  0,  0,  3,  0,  0,  0,
+/* 0x14a0 */   0,  0,  0,  0,142,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14b0 */ 165,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,188,  0,  0,  0,
+/* 0x14c0 */   8,  0,  0,  0,  0,  0,  0,  0,199,  0,  0,  0, 10,  0,  0,  0,
+/* 0x14d0 */   0,  0,  0,  0,214,  0,  0,  0, 13,  0,  0,  0,173,222,173,222,
+/* 0x14e0 */ 222,  0,  0,  0, 11,  0,  0,  0,  4,  1,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0,227,  0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1500 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0,
+/* 0x1510 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1520 */  16,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1530 */   0,  0,  0,  0,  3,  0,  0,  0,116,  0,  0,  0,239,  0,  0,  0,
+/* 0x1540 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1550 */ 120,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1560 */   0,  0,  0,  0,  3,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,
+/* 0x1570 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1580 */ 140,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1590 */   0,  0,  0,  0,  3,  0,  0,  0,152,  0,  0,  0,239,  0,  0,  0,
+/* 0x15a0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x15b0 */ 164,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0,  3,  0,  0,  0,168,  0,  0,  0,239,  0,  0,  0,
+/* 0x15d0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x15e0 */ 180,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  3,  0,  0,  0,196,  0,  0,  0,239,  0,  0,  0,
+/* 0x1600 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1610 */ 204,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1620 */   0,  0,  0,  0,  3,  0,  0,  0,208,  0,  0,  0,239,  0,  0,  0,
+/* 0x1630 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1640 */ 216,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1650 */   0,  0,  0,  0,  3,  0,  0,  0,220,  0,  0,  0,239,  0,  0,  0,
+/* 0x1660 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1670 */ 232,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1680 */   0,  0,  0,  0,  3,  0,  0,  0,236,  0,  0,  0,239,  0,  0,  0,
+/* 0x1690 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x16a0 */ 244,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16b0 */   0,  0,  0,  0,  3,  0,  0,  0,  0,  1,  0,  0,239,  0,  0,  0,
+/* 0x16c0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x16d0 */   4,  1,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16e0 */   0,  0,  0,  0,  3,  0,  0,  0, 12,  1,  0,  0,239,  0,  0,  0,
+/* 0x16f0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1700 */  20,  1,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1710 */   0,  0,  0,  0,  3,  0,  0,  0, 60,  1,  0,  0,239,  0,  0,  0,
+/* 0x1720 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1730 */  64,  1,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1740 */   0,  0,  0,  0,  4,  0,  0,  0, 16,  0,  0,  0,239,  0,  0,  0,
+/* 0x1750 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1760 */ 116,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1770 */   0,  0,  0,  0,  4,  0,  0,  0,120,  0,  0,  0,239,  0,  0,  0,
+/* 0x1780 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1790 */ 128,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17a0 */   0,  0,  0,  0,  4,  0,  0,  0,140,  0,  0,  0,239,  0,  0,  0,
+/* 0x17b0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x17c0 */ 152,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17d0 */   0,  0,  0,  0,  4,  0,  0,  0,164,  0,  0,  0,239,  0,  0,  0,
+/* 0x17e0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x17f0 */ 168,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1800 */   0,  0,  0,  0,  4,  0,  0,  0,180,  0,  0,  0,239,  0,  0,  0,
+/* 0x1810 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1820 */ 196,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1830 */   0,  0,  0,  0,  4,  0,  0,  0,204,  0,  0,  0,239,  0,  0,  0,
+/* 0x1840 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1850 */ 212,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1860 */   0,  0,  0,  0,  4,  0,  0,  0,224,  0,  0,  0,239,  0,  0,  0,
+/* 0x1870 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1880 */ 232,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1890 */   0,  0,  0,  0,  4,  0,  0,  0,244,  0,  0,  0,239,  0,  0,  0,
+/* 0x18a0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x18b0 */   0,  1,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0,  4,  0,  0,  0,  4,  1,  0,  0,239,  0,  0,  0,
+/* 0x18d0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x18e0 */  40,  1,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18f0 */   0,  0,  0,  0,  4,  0,  0,  0, 44,  1,  0,  0,239,  0,  0,  0,
+/* 0x1900 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1910 */  16,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1920 */   0,  0,  0,  0,  5,  0,  0,  0,120,  0,  0,  0,239,  0,  0,  0,
+/* 0x1930 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1940 */ 128,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1950 */   0,  0,  0,  0,  5,  0,  0,  0,132,  0,  0,  0,239,  0,  0,  0,
+/* 0x1960 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1970 */ 148,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1980 */   0,  0,  0,  0,  5,  0,  0,  0,152,  0,  0,  0,239,  0,  0,  0,
+/* 0x1990 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19a0 */ 156,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  5,  0,  0,  0,168,  0,  0,  0,239,  0,  0,  0,
+/* 0x19c0 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19d0 */ 184,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0,  5,  0,  0,  0,188,  0,  0,  0,239,  0,  0,  0,
+/* 0x19f0 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a00 */ 196,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  5,  0,  0,  0,204,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a20 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a30 */ 208,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0,  0,  5,  0,  0,  0,236,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a50 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a60 */ 240,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  6,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0,
+/* 0x1a80 */  45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1a90 */  76,  0,  0,  0,239,  0,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  6,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,
+/* 0x1ab0 */  45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1ac0 */ 192,  0,  0,  0,239,  0,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  7,  0,  0,  0,116,  0,  0,  0,239,  0,  0,  0,
+/* 0x1ae0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1af0 */ 144,  0,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */   0,  0,  0,  0,  7,  0,  0,  0,184,  0,  0,  0,239,  0,  0,  0,
+/* 0x1b10 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b20 */ 204,  0,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b30 */   0,  0,  0,  0,  7,  0,  0,  0,244,  0,  0,  0,239,  0,  0,  0,
+/* 0x1b40 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b50 */   0,  1,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b60 */   0,  0,  0,  0,  7,  0,  0,  0,  8,  1,  0,  0,239,  0,  0,  0,
+/* 0x1b70 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b80 */  68,  1,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */   0,  0,  0,  0,  7,  0,  0,  0,144,  1,  0,  0,239,  0,  0,  0,
+/* 0x1ba0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1bb0 */ 204,  1,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  7,  0,  0,  0,216,  1,  0,  0,239,  0,  0,  0,
+/* 0x1bd0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1be0 */   4,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  7,  0,  0,  0, 24,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c00 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c10 */  32,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,  7,  0,  0,  0, 52,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c30 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c40 */  60,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0,  7,  0,  0,  0, 64,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c60 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c70 */  76,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0,  7,  0,  0,  0, 88,  2,  0,  0,239,  0,  0,  0,
+/* 0x1c90 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ca0 */ 164,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  7,  0,  0,  0,200,  2,  0,  0,239,  0,  0,  0,
+/* 0x1cc0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1cd0 */ 232,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  7,  0,  0,  0,  4,  3,  0,  0,239,  0,  0,  0,
+/* 0x1cf0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d00 */  12,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,  7,  0,  0,  0, 60,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d20 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d30 */ 136,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,  7,  0,  0,  0,160,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d50 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d60 */ 168,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,  7,  0,  0,  0,204,  3,  0,  0,239,  0,  0,  0,
+/* 0x1d80 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d90 */ 224,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0,  7,  0,  0,  0,232,  3,  0,  0,239,  0,  0,  0,
+/* 0x1db0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1dc0 */  36,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  7,  0,  0,  0, 56,  4,  0,  0,239,  0,  0,  0,
+/* 0x1de0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1df0 */ 108,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,  7,  0,  0,  0,132,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e10 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e20 */ 140,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,  7,  0,  0,  0,176,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e40 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e50 */ 212,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  7,  0,  0,  0,236,  4,  0,  0,239,  0,  0,  0,
+/* 0x1e70 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e80 */ 244,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,  7,  0,  0,  0, 24,  5,  0,  0,239,  0,  0,  0,
+/* 0x1ea0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1eb0 */  60,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  7,  0,  0,  0,152,  5,  0,  0,239,  0,  0,  0,
+/* 0x1ed0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ee0 */ 160,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  7,  0,  0,  0,192,  5,  0,  0,239,  0,  0,  0,
+/* 0x1f00 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f10 */ 228,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,  7,  0,  0,  0,252,  5,  0,  0,239,  0,  0,  0,
+/* 0x1f30 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f40 */   4,  6,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,  7,  0,  0,  0, 36,  6,  0,  0,239,  0,  0,  0,
+/* 0x1f60 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f70 */  72,  6,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,  7,  0,  0,  0,128,  6,  0,  0,239,  0,  0,  0,
+/* 0x1f90 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1fa0 */ 140,  6,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  7,  0,  0,  0,208,  6,  0,  0,239,  0,  0,  0,
+/* 0x1fc0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1fd0 */ 236,  6,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  7,  0,  0,  0, 28,  7,  0,  0,239,  0,  0,  0,
+/* 0x1ff0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2000 */  40,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  7,  0,  0,  0,108,  7,  0,  0,239,  0,  0,  0,
+/* 0x2020 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2030 */ 124,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  7,  0,  0,  0,156,  7,  0,  0,239,  0,  0,  0,
+/* 0x2050 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2060 */ 184,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,  7,  0,  0,  0,196,  7,  0,  0,239,  0,  0,  0,
+/* 0x2080 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2090 */ 208,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,  7,  0,  0,  0,244,  7,  0,  0,239,  0,  0,  0,
+/* 0x20b0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20c0 */  32,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,  7,  0,  0,  0, 44,  8,  0,  0,239,  0,  0,  0,
+/* 0x20e0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20f0 */ 124,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  7,  0,  0,  0,136,  8,  0,  0,239,  0,  0,  0,
+/* 0x2110 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2120 */ 160,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,  7,  0,  0,  0,232,  8,  0,  0,239,  0,  0,  0,
+/* 0x2140 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2150 */ 244,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  7,  0,  0,  0,252,  8,  0,  0,239,  0,  0,  0,
+/* 0x2170 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2180 */   4,  9,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,  7,  0,  0,  0, 40,  9,  0,  0,239,  0,  0,  0,
+/* 0x21a0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x21b0 */ 120,  0,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0,  8,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0,
+/* 0x21d0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x21e0 */ 136,  0,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,  8,  0,  0,  0,168,  0,  0,  0,239,  0,  0,  0,
+/* 0x2200 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2210 */ 172,  0,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,  8,  0,  0,  0,228,  0,  0,  0,239,  0,  0,  0,
+/* 0x2230 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2240 */   0,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,  8,  0,  0,  0, 12,  1,  0,  0,239,  0,  0,  0,
+/* 0x2260 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2270 */  20,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,  8,  0,  0,  0, 24,  1,  0,  0,239,  0,  0,  0,
+/* 0x2290 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x22a0 */  32,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0,  8,  0,  0,  0, 40,  1,  0,  0,239,  0,  0,  0,
+/* 0x22c0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x22d0 */  68,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0,  8,  0,  0,  0, 76,  1,  0,  0,239,  0,  0,  0,
+/* 0x22f0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2300 */  80,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2310 */   0,  0,  0,  0,  8,  0,  0,  0,128,  1,  0,  0,239,  0,  0,  0,
+/* 0x2320 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2330 */ 136,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2340 */   0,  0,  0,  0,  8,  0,  0,  0,140,  1,  0,  0,239,  0,  0,  0,
+/* 0x2350 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2360 */ 156,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2370 */   0,  0,  0,  0,  8,  0,  0,  0,160,  1,  0,  0,239,  0,  0,  0,
+/* 0x2380 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2390 */ 192,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0,  8,  0,  0,  0,204,  1,  0,  0,239,  0,  0,  0,
+/* 0x23b0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23c0 */ 212,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,  8,  0,  0,  0,220,  1,  0,  0,239,  0,  0,  0,
+/* 0x23e0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23f0 */ 228,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,  8,  0,  0,  0,236,  1,  0,  0,239,  0,  0,  0,
+/* 0x2410 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2420 */  40,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,  8,  0,  0,  0, 44,  2,  0,  0,239,  0,  0,  0,
+/* 0x2440 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2450 */  68,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,  8,  0,  0,  0, 76,  2,  0,  0,239,  0,  0,  0,
+/* 0x2470 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2480 */  80,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2490 */   0,  0,  0,  0,  8,  0,  0,  0,104,  2,  0,  0,239,  0,  0,  0,
+/* 0x24a0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24b0 */ 132,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0,  8,  0,  0,  0,140,  2,  0,  0,239,  0,  0,  0,
+/* 0x24d0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24e0 */ 164,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0,  8,  0,  0,  0,200,  2,  0,  0,239,  0,  0,  0,
+/* 0x2500 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2510 */ 208,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2520 */   0,  0,  0,  0,  8,  0,  0,  0,220,  2,  0,  0,239,  0,  0,  0,
+/* 0x2530 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2540 */ 244,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2550 */   0,  0,  0,  0,  8,  0,  0,  0, 12,  3,  0,  0,239,  0,  0,  0,
+/* 0x2560 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2570 */  20,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2580 */   0,  0,  0,  0,  8,  0,  0,  0, 44,  3,  0,  0,239,  0,  0,  0,
+/* 0x2590 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25a0 */  80,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,  8,  0,  0,  0, 88,  3,  0,  0,239,  0,  0,  0,
+/* 0x25c0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25d0 */ 112,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,  8,  0,  0,  0,120,  3,  0,  0,239,  0,  0,  0,
+/* 0x25f0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2600 */ 156,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2610 */   0,  0,  0,  0,  8,  0,  0,  0,176,  3,  0,  0,239,  0,  0,  0,
+/* 0x2620 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2630 */ 184,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2640 */   0,  0,  0,  0,  8,  0,  0,  0,200,  3,  0,  0,239,  0,  0,  0,
+/* 0x2650 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2660 */ 204,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2670 */   0,  0,  0,  0,  8,  0,  0,  0,  0,  4,  0,  0,239,  0,  0,  0,
+/* 0x2680 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2690 */  24,  4,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26a0 */   0,  0,  0,  0,  8,  0,  0,  0, 64,  4,  0,  0,239,  0,  0,  0,
+/* 0x26b0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x26c0 */ 240,  0,  0,  0,239,  0,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26d0 */   0,  0,  0,  0, 11,  0,  0,  0,252,  0,  0,  0,239,  0,  0,  0,
+/* 0x26e0 */  98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x26f0 */   0,  1,  0,  0,227,  0,  0,  0,214,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2700 */   0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86,
+/* 0x2710 */  95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 78,
+/* 0x2720 */  82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,
+/* 0x2730 */   0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65,
+/* 0x2740 */  95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49,
+/* 0x2750 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 69, 76, 70,
+/* 0x2760 */  77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 77,
+/* 0x2770 */  70, 76, 71,  0, 95,115,116, 97,114,116,  0,117, 99,108, 95,110,
+/* 0x2780 */ 114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95,
+/* 0x2790 */  56,  0,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,
+/* 0x27a0 */ 109,112,114,101,115,115, 95, 56,  0,117, 99,108, 95,110,114,118,
+/* 0x27b0 */  50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,
+/* 0x27c0 */  76,122,109, 97, 68,101, 99,111,100,101,  0,101,110,100, 95,100,
+/* 0x27d0 */ 101, 99,111,109,112,114,101,115,115,  0, 79, 95, 66, 73, 78, 70,
+/* 0x27e0 */  79,  0, 99,112,114, 48,  0, 82, 95, 65, 82, 77, 95, 65, 66, 83,
+/* 0x27f0 */  51, 50,  0, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,  0, 32, 19,
+/* 0x2800 */   0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v5a-linux.elf-so_fold.h
-   created from arm.v5a-linux.elf-so_fold.bin, 26433 (0x6741) bytes
+   created from arm.v5a-linux.elf-so_fold.bin, 20822 (0x5156) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V5A_LINUX_ELF_SO_FOLD_SIZE    26433
-#define STUB_ARM_V5A_LINUX_ELF_SO_FOLD_ADLER32 0x3996263f
-#define STUB_ARM_V5A_LINUX_ELF_SO_FOLD_CRC32   0x296eda9a
+#define STUB_ARM_V5A_LINUX_ELF_SO_FOLD_SIZE    20822
+#define STUB_ARM_V5A_LINUX_ELF_SO_FOLD_ADLER32 0xff50398b
+#define STUB_ARM_V5A_LINUX_ELF_SO_FOLD_CRC32   0xf0c29e07
 
-unsigned char stub_arm_v5a_linux_elf_so_fold[26433] = {
+unsigned char stub_arm_v5a_linux_elf_so_fold[20822] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 152, 29,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -800,893 +800,542 @@ unsigned char stub_arm_v5a_linux_elf_so_fold[26433] = {
 /* 0x2f90 */ 184,  3,  0,  0,  1,  9,  0,  0,200,  3,  0,  0,  1,  9,  0,  0,
 /* 0x2fa0 */ 204,  3,  0,  0,  1,  9,  0,  0,  0,  4,  0,  0,  1,  9,  0,  0,
 /* 0x2fb0 */  24,  4,  0,  0,  1,  9,  0,  0, 64,  4,  0,  0,  1,  9,  0,  0,
-/* 0x2fc0 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x2fd0 */  50, 45,108,105,116,116,108,101, 97,114,109, 10, 10, 83,101, 99,
-/* 0x2fe0 */ 116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32,
-/* 0x2ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32,
-/* 0x3000 */  32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x3010 */  32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32,
-/* 0x3020 */  32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48,
-/* 0x3030 */  32, 83, 79, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3040 */  50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50,
-/* 0x3050 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x3060 */  49, 32,112,116,114, 95, 78, 69, 88, 84, 32, 32, 32, 32, 32, 32,
-/* 0x3070 */  48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 52, 32, 32, 50,
-/* 0x3080 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x3090 */  50, 32, 83, 79, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 32,
-/* 0x30a0 */  48, 51, 52, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 99, 32,
-/* 0x30b0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x30c0 */  32, 32, 51, 32, 83, 79, 95, 77, 65, 73, 78, 32, 32, 32, 32, 32,
-/* 0x30d0 */  32, 32, 48, 55, 50, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x30e0 */  97, 56, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x30f0 */  84, 83, 10, 32, 32, 52, 32, 69, 88, 80, 95, 72, 69, 65, 68, 32,
-/* 0x3100 */  32, 32, 32, 32, 32, 48,100, 99, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3110 */  48, 97, 99, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3120 */  69, 78, 84, 83, 10, 32, 32, 53, 32, 69, 88, 80, 95, 84, 65, 73,
-/* 0x3130 */  76, 32, 32, 32, 32, 32, 32, 48, 50, 52, 32, 32, 48, 32, 32, 48,
-/* 0x3140 */  32, 32, 48, 98, 97, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3150 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 78, 82, 86, 50, 69,
-/* 0x3160 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 49, 52, 32, 32, 48,
-/* 0x3170 */  32, 32, 48, 32, 32, 48, 98, 99, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3180 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 78, 82,
-/* 0x3190 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 48, 48,
-/* 0x31a0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 99,101, 48, 32, 32, 50, 42,
-/* 0x31b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56,
-/* 0x31c0 */  32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x31d0 */  99, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,100,101, 48, 32, 32,
-/* 0x31e0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x31f0 */  32, 57, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32,
-/* 0x3200 */  32, 48, 57, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 97, 52,
-/* 0x3210 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3220 */  10, 32, 49, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x3230 */  32, 32, 32, 48, 57, 51, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3240 */ 102, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3250 */  78, 84, 83, 10, 32, 49, 49, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3260 */  49, 48, 32, 32, 32, 32, 48, 52, 55, 56, 32, 32, 48, 32, 32, 48,
-/* 0x3270 */  32, 32, 48, 49, 56, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3280 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 76, 90, 77, 65,
-/* 0x3290 */  95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x32a0 */  48, 32, 32, 48, 49, 99,101, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x32b0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32,
-/* 0x32c0 */  84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x32d0 */ 108, 32, 32, 32, 32,100, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32,
-/* 0x32e0 */  48, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48,
-/* 0x32f0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 83, 79, 95, 77, 65,
-/* 0x3300 */  73, 78, 32, 48, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x3310 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88,
-/* 0x3320 */  80, 95, 72, 69, 65, 68, 32, 48, 32, 69, 88, 80, 95, 72, 69, 65,
-/* 0x3330 */  68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3340 */ 100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69,
-/* 0x3350 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3360 */  32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10,
-/* 0x3370 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3380 */  32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x3390 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x33a0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77,
-/* 0x33b0 */  65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x33d0 */  67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x33e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x33f0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,
-/* 0x3400 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3410 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 83, 79, 95, 72, 69,
-/* 0x3420 */  65, 68, 32, 48, 32, 83, 79, 95, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x3430 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,112,116,
-/* 0x3440 */ 114, 95, 78, 69, 88, 84, 32, 48, 32,112,116,114, 95, 78, 69, 88,
-/* 0x3450 */  84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3460 */ 100, 32, 32, 69, 88, 80, 95, 84, 65, 73, 76, 32, 48, 32, 69, 88,
-/* 0x3470 */  80, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3480 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3490 */  51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10,
-/* 0x34a0 */  48, 48, 48, 48, 48, 48, 55, 48, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x34b0 */  32, 69, 88, 80, 95, 72, 69, 65, 68, 32, 48, 32,102, 95,101,120,
-/* 0x34c0 */ 112, 97,110,100, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32,103, 32,
-/* 0x34d0 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x34e0 */ 109,117,110,109, 97,112, 10, 48, 48, 48, 48, 48, 49, 56, 52, 32,
-/* 0x34f0 */ 103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32,
-/* 0x3500 */  48, 32,103,101,116, 95,115,121,115, 95,109,117,110,109, 97,112,
-/* 0x3510 */  10, 48, 48, 48, 48, 48, 48, 56, 56, 32,103, 32, 32, 32, 32, 32,
-/* 0x3520 */  32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,103,101,116,112,
-/* 0x3530 */ 105,100, 10, 48, 48, 48, 48, 48, 49, 97, 52, 32,103, 32, 32, 32,
-/* 0x3540 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,101,
-/* 0x3550 */ 109, 99,112,121, 10, 48, 48, 48, 48, 48, 48, 98, 48, 32,103, 32,
-/* 0x3560 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3570 */ 114,101, 97,100,108,105,110,107, 10, 48, 48, 48, 48, 48, 50,102,
-/* 0x3580 */  48, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x3590 */  76, 32, 48, 32, 95, 95,117,100,105,118,115,105, 51, 10, 48, 48,
-/* 0x35a0 */  48, 48, 48, 48,100, 56, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x35b0 */  79, 95, 84, 65, 73, 76, 32, 48, 32,102,116,114,117,110, 99, 97,
-/* 0x35c0 */ 116,101, 10, 48, 48, 48, 48, 48, 49, 50, 56, 32,103, 32, 32, 32,
-/* 0x35d0 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,109,
-/* 0x35e0 */  97,112, 10, 48, 48, 48, 48, 48, 49, 54, 48, 32,103, 32, 32, 32,
-/* 0x35f0 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32, 95, 95,
-/* 0x3600 */  99,108,101, 97,114, 95, 99, 97, 99,104,101, 10, 48, 48, 48, 48,
-/* 0x3610 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 69, 88, 80,
-/* 0x3620 */  95, 84, 65, 73, 76, 32, 48, 32,101,111,102, 10, 48, 48, 48, 48,
-/* 0x3630 */  48, 49, 56, 99, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95,
-/* 0x3640 */  84, 65, 73, 76, 32, 48, 32,109,109, 97,112, 95,112,114,105,118,
-/* 0x3650 */  97,110,111,110, 10, 48, 48, 48, 48, 48, 48, 51, 56, 32,103, 32,
-/* 0x3660 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3670 */ 119,114,105,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103,
-/* 0x3680 */  32, 32, 32, 32, 32, 70, 32, 83, 79, 95, 77, 65, 73, 78, 32, 48,
-/* 0x3690 */  50, 99, 32, 80, 70, 95,116,111, 95, 80, 82, 79, 84, 10, 48, 48,
-/* 0x36a0 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78,
-/* 0x36b0 */  82, 86, 50, 68, 32, 48, 49, 48, 48, 32,117, 99,108, 95,110,114,
-/* 0x36c0 */ 118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,
-/* 0x36d0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x36e0 */  32, 32, 83, 79, 95, 72, 69, 65, 68, 32, 48, 32,102,111,108,100,
-/* 0x36f0 */  10, 48, 48, 48, 48, 48, 48,101, 99, 32,103, 32, 32, 32, 32, 32,
-/* 0x3700 */  32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,101,109,102,
-/* 0x3710 */ 100, 95, 99,114,101, 97,116,101, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x3720 */  52, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x3730 */  76, 32, 48, 32,114,101, 97,100, 10, 48, 48, 48, 48, 48, 48, 55,
-/* 0x3740 */  52, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x3750 */  76, 32, 48, 32,117,110,108,105,110,107, 10, 48, 48, 48, 48, 48,
-/* 0x3760 */  50, 55, 56, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84,
-/* 0x3770 */  65, 73, 76, 32, 48, 32,117,110,100,101,114,108, 97,121, 10, 48,
-/* 0x3780 */  48, 48, 48, 48, 50, 99, 56, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3790 */  83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,101,109,115,101,116,
-/* 0x37a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x37b0 */  70, 32, 78, 82, 86, 50, 66, 32, 48, 99, 52, 32,117, 99,108, 95,
-/* 0x37c0 */ 110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x37d0 */  95, 56, 10, 48, 48, 48, 48, 48, 49,101, 56, 32,103, 32, 32, 32,
-/* 0x37e0 */  32, 32, 70, 32, 83, 79, 95, 77, 65, 73, 78, 32, 48, 97, 52, 32,
-/* 0x37f0 */ 103,101,116, 95, 80, 65, 71, 69, 95, 77, 65, 83, 75, 10, 48, 48,
-/* 0x3800 */  48, 48, 48, 50,101, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3810 */  79, 95, 84, 65, 73, 76, 32, 48, 32,109,121, 95, 97,108,108,111,
-/* 0x3820 */  99, 97, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32,103, 32, 32, 32,
-/* 0x3830 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,121,
-/* 0x3840 */  95, 98,107,112,116, 10, 48, 48, 48, 48, 48, 49, 48, 52, 32,103,
-/* 0x3850 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48,
-/* 0x3860 */  32, 80,112,114,111,116,101, 99,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3870 */  48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 69,
-/* 0x3880 */  32, 48, 49, 49, 52, 32,117, 99,108, 95,110,114,118, 50,101, 95,
-/* 0x3890 */ 100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48,
-/* 0x38a0 */  48, 48, 48, 49, 52, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79,
-/* 0x38b0 */  95, 84, 65, 73, 76, 32, 48, 32,101,120,105,116, 10, 48, 48, 48,
-/* 0x38c0 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x38d0 */  77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,122,109, 97, 68,
-/* 0x38e0 */ 101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32,103,
-/* 0x38f0 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48,
-/* 0x3900 */  32, 98,114,107, 10, 48, 48, 48, 48, 48, 48, 52, 99, 32,103, 32,
-/* 0x3910 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3920 */ 111,112,101,110, 10, 48, 48, 48, 48, 48, 50,102, 48, 32,103, 32,
-/* 0x3930 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3940 */ 100,105,118, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 52, 32,103,
-/* 0x3950 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48,
-/* 0x3960 */  32,109,112,114,111,116,101, 99,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3970 */  54, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65,
-/* 0x3980 */  73, 76, 32, 48, 32, 99,108,111,115,101, 10, 48, 48, 48, 48, 48,
-/* 0x3990 */  50, 56, 99, 32,103, 32, 32, 32, 32, 32, 70, 32, 83, 79, 95, 77,
-/* 0x39a0 */  65, 73, 78, 32, 48, 52, 57, 56, 32,117,112,120, 95,115,111, 95,
-/* 0x39b0 */ 109, 97,105,110, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x39c0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 83, 79,
-/* 0x39d0 */  95, 72, 69, 65, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x39e0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x39f0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a00 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3a10 */  32, 32, 32, 32,117,112,120, 95,115,111, 95,109, 97,105,110, 10,
-/* 0x3a20 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x3a30 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 83, 79, 95, 84, 65, 73, 76,
-/* 0x3a40 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3a50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3a60 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 49, 97, 48, 32, 82, 95, 65,
-/* 0x3a70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3a80 */  79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 49, 98, 52, 32,
-/* 0x3a90 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3aa0 */  32, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3ab0 */  99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3ac0 */  32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48,
-/* 0x3ad0 */  48, 48, 49,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3ae0 */  32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 10,
-/* 0x3af0 */  48, 48, 48, 48, 48, 49,101, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3b00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65,
-/* 0x3b10 */  73, 76, 10, 48, 48, 48, 48, 48, 50, 48, 99, 32, 82, 95, 65, 82,
-/* 0x3b20 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79,
-/* 0x3b30 */  95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 50, 49, 56, 32, 82,
-/* 0x3b40 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3b50 */  32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 50, 50,
-/* 0x3b60 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3b70 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48,
-/* 0x3b80 */  48, 50, 51, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3b90 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48,
-/* 0x3ba0 */  48, 48, 48, 48, 50, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3bb0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x3bc0 */  76, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77,
-/* 0x3bd0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95,
-/* 0x3be0 */  84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 50, 54, 52, 32, 82, 95,
-/* 0x3bf0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3c00 */  83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 50, 55, 48,
-/* 0x3c10 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3c20 */  32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48,
-/* 0x3c30 */  50, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3c40 */  32, 32, 32, 32, 32, 32,109,101,109, 99,112,121, 10, 48, 48, 48,
-/* 0x3c50 */  48, 48, 50, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3c60 */  32, 32, 32, 32, 32, 32, 32, 32,109,109, 97,112, 95,112,114,105,
-/* 0x3c70 */ 118, 97,110,111,110, 10, 48, 48, 48, 48, 48, 50, 98, 99, 32, 82,
-/* 0x3c80 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3c90 */  32,109,101,109, 99,112,121, 10, 48, 48, 48, 48, 48, 50,100, 56,
-/* 0x3ca0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3cb0 */  32, 32, 32,109,101,109,115,101,116, 10, 10, 82, 69, 76, 79, 67,
-/* 0x3cc0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x3cd0 */  82, 32, 91, 83, 79, 95, 77, 65, 73, 78, 93, 58, 10, 79, 70, 70,
-/* 0x3ce0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x3cf0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x3d00 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3d10 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x3d20 */  10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3d30 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,121, 95, 98,
-/* 0x3d40 */ 107,112,116, 10, 48, 48, 48, 48, 48, 48, 51, 56, 32, 82, 95, 65,
-/* 0x3d50 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,101,
-/* 0x3d60 */ 120,105,116, 10, 48, 48, 48, 48, 48, 48, 53, 52, 32, 82, 95, 65,
-/* 0x3d70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3d80 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 48, 53, 99, 32,
-/* 0x3d90 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3da0 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3db0 */  54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3dc0 */  32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x3dd0 */  48, 48, 48, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3de0 */  32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10,
-/* 0x3df0 */  48, 48, 48, 48, 48, 48, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3e00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65,
-/* 0x3e10 */  73, 78, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95, 65, 82,
-/* 0x3e20 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79,
-/* 0x3e30 */  95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82,
-/* 0x3e40 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e50 */  32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 48,101,
-/* 0x3e60 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3e70 */  32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48,
-/* 0x3e80 */  48, 48,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3e90 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48,
-/* 0x3ea0 */  48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3eb0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73,
-/* 0x3ec0 */  78, 10, 48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3ed0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95,
-/* 0x3ee0 */  77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95,
-/* 0x3ef0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f00 */  83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 49, 49, 56,
-/* 0x3f10 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3f20 */  32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48,
-/* 0x3f30 */  49, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3f40 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48,
-/* 0x3f50 */  48, 48, 48, 49, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3f60 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x3f70 */  10, 48, 48, 48, 48, 48, 49, 51, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3f80 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77,
-/* 0x3f90 */  65, 73, 78, 10, 48, 48, 48, 48, 48, 49, 52, 48, 32, 82, 95, 65,
-/* 0x3fa0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3fb0 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 49, 53, 48, 32,
-/* 0x3fc0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3fd0 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3fe0 */  54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3ff0 */  32, 32, 32, 32, 32,102, 95,101,120,112, 97,110,100, 10, 48, 48,
-/* 0x4000 */  48, 48, 48, 49, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4010 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x4020 */  10, 48, 48, 48, 48, 48, 49, 56, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4030 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77,
-/* 0x4040 */  65, 73, 78, 10, 48, 48, 48, 48, 48, 49, 56, 56, 32, 82, 95, 65,
-/* 0x4050 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x4060 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 49, 97, 56, 32,
-/* 0x4070 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4080 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 49,
-/* 0x4090 */  98, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x40a0 */  32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x40b0 */  48, 48, 49,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x40c0 */  32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10,
-/* 0x40d0 */  48, 48, 48, 48, 48, 49,102, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x40e0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65,
-/* 0x40f0 */  73, 78, 10, 48, 48, 48, 48, 48, 50, 49, 48, 32, 82, 95, 65, 82,
-/* 0x4100 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,111,112,
-/* 0x4110 */ 101,110, 10, 48, 48, 48, 48, 48, 50, 50, 52, 32, 82, 95, 65, 82,
-/* 0x4120 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,114,101,
-/* 0x4130 */  97,100, 10, 48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65, 82,
-/* 0x4140 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 99,108,
-/* 0x4150 */ 111,115,101, 10, 48, 48, 48, 48, 48, 50, 51, 99, 32, 82, 95, 65,
-/* 0x4160 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x4170 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32,
-/* 0x4180 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4190 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 50,
-/* 0x41a0 */  53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x41b0 */  32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x41c0 */  48, 48, 50, 53, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x41d0 */  32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10,
-/* 0x41e0 */  48, 48, 48, 48, 48, 50, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x41f0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65,
-/* 0x4200 */  73, 78, 10, 48, 48, 48, 48, 48, 50, 55, 56, 32, 82, 95, 65, 82,
-/* 0x4210 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79,
-/* 0x4220 */  95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 50, 97, 48, 32, 82,
-/* 0x4230 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4240 */  32,103,101,116, 95, 80, 65, 71, 69, 95, 77, 65, 83, 75, 10, 48,
-/* 0x4250 */  48, 48, 48, 48, 50,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4260 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,109, 97,112, 10, 48,
-/* 0x4270 */  48, 48, 48, 48, 50,102, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4280 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,101,109, 99,112,121,
-/* 0x4290 */  10, 48, 48, 48, 48, 48, 51, 50, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x42a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77,
-/* 0x42b0 */  65, 73, 78, 10, 48, 48, 48, 48, 48, 51, 52, 48, 32, 82, 95, 65,
-/* 0x42c0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x42d0 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 51, 53, 48, 32,
-/* 0x42e0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x42f0 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 51,
-/* 0x4300 */  54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4310 */  32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x4320 */  48, 48, 51, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4330 */  32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10,
-/* 0x4340 */  48, 48, 48, 48, 48, 51, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x4350 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,101,109,102,100,
-/* 0x4360 */  95, 99,114,101, 97,116,101, 10, 48, 48, 48, 48, 48, 51, 57, 52,
-/* 0x4370 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x4380 */  32, 32, 32,119,114,105,116,101, 10, 48, 48, 48, 48, 48, 51, 97,
-/* 0x4390 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x43a0 */  32, 32, 32, 32,119,114,105,116,101, 10, 48, 48, 48, 48, 48, 51,
-/* 0x43b0 */  98, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x43c0 */  32, 32, 32, 32, 32,109,117,110,109, 97,112, 10, 48, 48, 48, 48,
-/* 0x43d0 */  48, 51, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x43e0 */  32, 32, 32, 32, 32, 32, 32, 80, 70, 95,116,111, 95, 80, 82, 79,
-/* 0x43f0 */  84, 10, 48, 48, 48, 48, 48, 51,100, 99, 32, 82, 95, 65, 82, 77,
-/* 0x4400 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,109, 97,
-/* 0x4410 */ 112, 10, 48, 48, 48, 48, 48, 51,101, 52, 32, 82, 95, 65, 82, 77,
-/* 0x4420 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 99,108,111,
-/* 0x4430 */ 115,101, 10, 48, 48, 48, 48, 48, 51,102, 52, 32, 82, 95, 65, 82,
-/* 0x4440 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79,
-/* 0x4450 */  95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 52, 49, 52, 32, 82,
-/* 0x4460 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4470 */  32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 52, 50,
-/* 0x4480 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4490 */  32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48,
-/* 0x44a0 */  48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x44b0 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48,
-/* 0x44c0 */  48, 48, 48, 48, 52, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x44d0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73,
-/* 0x44e0 */  78, 10, 48, 48, 48, 48, 48, 52, 98, 52, 32, 82, 95, 65, 82, 77,
-/* 0x44f0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95,
-/* 0x4500 */  77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 52, 98, 56, 32, 82, 95,
-/* 0x4510 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4520 */  83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 52, 99, 56,
-/* 0x4530 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x4540 */  32, 32, 32,109,101,109,102,100, 95, 99,114,101, 97,116,101, 10,
-/* 0x4550 */  48, 48, 48, 48, 48, 52,100, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x4560 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,102,116,114,117,110,
-/* 0x4570 */  99, 97,116,101, 10, 48, 48, 48, 48, 48, 52,101, 52, 32, 82, 95,
-/* 0x4580 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4590 */ 119,114,105,116,101, 10, 48, 48, 48, 48, 48, 53, 48, 52, 32, 82,
-/* 0x45a0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x45b0 */  32,109,109, 97,112, 10, 48, 48, 48, 48, 48, 53, 49, 52, 32, 82,
-/* 0x45c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x45d0 */  32,109,117,110,109, 97,112, 10, 48, 48, 48, 48, 48, 53, 50, 48,
-/* 0x45e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x45f0 */  32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48,
-/* 0x4600 */  53, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x4610 */  32, 32, 32, 32, 32, 32,117,110,100,101,114,108, 97,121, 10, 48,
-/* 0x4620 */  48, 48, 48, 48, 53, 54, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4630 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65, 73,
-/* 0x4640 */  78, 10, 48, 48, 48, 48, 48, 53, 54, 99, 32, 82, 95, 65, 82, 77,
-/* 0x4650 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95,
-/* 0x4660 */  77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 53, 55, 56, 32, 82, 95,
-/* 0x4670 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4680 */  83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 53, 56, 48,
-/* 0x4690 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x46a0 */  32, 32, 32,103,101,116, 95,115,121,115, 95,109,117,110,109, 97,
-/* 0x46b0 */ 112, 10, 48, 48, 48, 48, 48, 53, 57, 56, 32, 82, 95, 65, 82, 77,
-/* 0x46c0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95,
-/* 0x46d0 */  77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 53, 97, 52, 32, 82, 95,
-/* 0x46e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x46f0 */  83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 53, 99, 52,
-/* 0x4700 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x4710 */  32, 32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48,
-/* 0x4720 */  53,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x4730 */  32, 32, 32, 32, 32, 32, 95, 95, 99,108,101, 97,114, 95, 99, 97,
-/* 0x4740 */  99,104,101, 10, 48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65,
-/* 0x4750 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x4760 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 54, 48, 48, 32,
-/* 0x4770 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4780 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 54,
-/* 0x4790 */  49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x47a0 */  32, 32, 32, 32, 32,109,101,109,102,100, 95, 99,114,101, 97,116,
-/* 0x47b0 */ 101, 10, 48, 48, 48, 48, 48, 54, 50, 48, 32, 82, 95, 65, 82, 77,
-/* 0x47c0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,119,114,105,
-/* 0x47d0 */ 116,101, 10, 48, 48, 48, 48, 48, 54, 52, 48, 32, 82, 95, 65, 82,
-/* 0x47e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,109,
-/* 0x47f0 */  97,112, 10, 48, 48, 48, 48, 48, 54, 52, 99, 32, 82, 95, 65, 82,
-/* 0x4800 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 99,108,
-/* 0x4810 */ 111,115,101, 10, 48, 48, 48, 48, 48, 54, 53, 52, 32, 82, 95, 65,
-/* 0x4820 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x4830 */  79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 54, 54, 56, 32,
-/* 0x4840 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4850 */  32, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 54,
-/* 0x4860 */  55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4870 */  32, 32, 32, 32, 32,109,117,110,109, 97,112, 10, 48, 48, 48, 48,
-/* 0x4880 */  48, 54, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x4890 */  32, 32, 32, 32, 32, 32, 32, 80, 70, 95,116,111, 95, 80, 82, 79,
-/* 0x48a0 */  84, 10, 48, 48, 48, 48, 48, 54, 98, 48, 32, 82, 95, 65, 82, 77,
-/* 0x48b0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,109, 97,
-/* 0x48c0 */ 112, 10, 48, 48, 48, 48, 48, 54, 98, 56, 32, 82, 95, 65, 82, 77,
-/* 0x48d0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 99,108,111,
-/* 0x48e0 */ 115,101, 10, 48, 48, 48, 48, 48, 54, 98, 99, 32, 82, 95, 65, 82,
-/* 0x48f0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79,
-/* 0x4900 */  95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 54,100, 52, 32, 82,
-/* 0x4910 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4920 */  32, 80, 70, 95,116,111, 95, 80, 82, 79, 84, 10, 48, 48, 48, 48,
-/* 0x4930 */  48, 54,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x4940 */  32, 32, 32, 32, 32, 32, 32, 80,112,114,111,116,101, 99,116, 10,
-/* 0x4950 */  48, 48, 48, 48, 48, 54,102, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x4960 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 77, 65,
-/* 0x4970 */  73, 78, 10, 48, 48, 48, 48, 48, 54,102, 99, 32, 82, 95, 65, 82,
-/* 0x4980 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,109,117,
-/* 0x4990 */ 110,109, 97,112, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x49a0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88,
-/* 0x49b0 */  80, 95, 72, 69, 65, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x49c0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49d0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x49e0 */  50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x49f0 */  32, 32, 32, 32, 32, 69, 88, 80, 95, 72, 69, 65, 68, 10, 48, 48,
-/* 0x4a00 */  48, 48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4a10 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 80, 95, 72, 69, 65,
-/* 0x4a20 */  68, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82, 77,
-/* 0x4a30 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 80,
-/* 0x4a40 */  95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82,
-/* 0x4a50 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a60 */  32, 69, 88, 80, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4a70 */  97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4a80 */  32, 32, 32, 32, 32, 69, 88, 80, 95, 72, 69, 65, 68, 10, 48, 48,
-/* 0x4a90 */  48, 48, 48, 48, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4aa0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 80, 95, 72, 69, 65,
-/* 0x4ab0 */  68, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x4ac0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 99,
-/* 0x4ad0 */ 108,101, 97,114, 95, 99, 97, 99,104,101, 10, 10, 82, 69, 76, 79,
-/* 0x4ae0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4af0 */  79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4b00 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b10 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4b20 */  48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4b30 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x4b40 */  48, 48, 48, 48, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4b50 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x4b60 */  48, 48, 48, 48, 48, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4b70 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x4b80 */  48, 48, 48, 48, 48, 48, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x4b90 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x4ba0 */  10, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4bb0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x4bc0 */  69, 10, 48, 48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77,
-/* 0x4bd0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x4be0 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82,
-/* 0x4bf0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x4c00 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65,
-/* 0x4c10 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4c20 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95,
-/* 0x4c30 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c40 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82,
-/* 0x4c50 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c60 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32,
-/* 0x4c70 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4c80 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97, 48,
-/* 0x4c90 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x4ca0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x4cb0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4cc0 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4cd0 */  97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4ce0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4cf0 */  48, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x4d00 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x4d10 */  48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x4d20 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x4d30 */  48, 48, 48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4d40 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x4d50 */  48, 48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4d60 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x4d70 */  48, 48, 48, 48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4d80 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x4d90 */  48, 48, 48, 48, 48, 48,100, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x4da0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x4db0 */  10, 48, 48, 48, 48, 48, 48,101, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4dc0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x4dd0 */  69, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65, 82, 77,
-/* 0x4de0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x4df0 */  50, 69, 10, 48, 48, 48, 48, 48, 49, 49, 48, 32, 82, 95, 65, 82,
-/* 0x4e00 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x4e10 */  86, 50, 69, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4e20 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x4e30 */  50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4e40 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e50 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82,
-/* 0x4e60 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e70 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 52, 52, 32,
-/* 0x4e80 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x4e90 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 52, 56,
-/* 0x4ea0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x4eb0 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 53,
-/* 0x4ec0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x4ed0 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ee0 */  53, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x4ef0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x4f00 */  48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x4f10 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x4f20 */  48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x4f30 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x4f40 */  48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x4f50 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x4f60 */  48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x4f70 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x4f80 */  48, 48, 48, 48, 48, 57, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x4f90 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x4fa0 */  48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x4fb0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x4fc0 */  10, 48, 48, 48, 48, 48, 48, 97, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x4fd0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x4fe0 */  68, 10, 48, 48, 48, 48, 48, 48, 98, 48, 32, 82, 95, 65, 82, 77,
-/* 0x4ff0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x5000 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65, 82,
-/* 0x5010 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x5020 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65,
-/* 0x5030 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5040 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95,
-/* 0x5050 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5060 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 52, 32, 82,
-/* 0x5070 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5080 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,102, 56, 32,
-/* 0x5090 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x50a0 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,102, 99,
-/* 0x50b0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x50c0 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x50d0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x50e0 */  32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x50f0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5100 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5110 */  48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x5120 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x5130 */  48, 48, 52, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5140 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x5150 */  48, 48, 48, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x5160 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x5170 */  48, 48, 48, 48, 53, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5180 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x5190 */  48, 48, 48, 48, 48, 54, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x51a0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x51b0 */  48, 48, 48, 48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x51c0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x51d0 */  10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x51e0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x51f0 */  66, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77,
-/* 0x5200 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x5210 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82, 95, 65, 82,
-/* 0x5220 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x5230 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82, 95, 65,
-/* 0x5240 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5250 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82, 95,
-/* 0x5260 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5270 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32, 82,
-/* 0x5280 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5290 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32,
-/* 0x52a0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x52b0 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 99,
-/* 0x52c0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x52d0 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 99,
-/* 0x52e0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x52f0 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5300 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5310 */  82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10,
-/* 0x5320 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5330 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5340 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x5350 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x5360 */  95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 52, 99, 32,
-/* 0x5370 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x5380 */  32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48,
-/* 0x5390 */  48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x53a0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x53b0 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82, 95, 65, 82,
-/* 0x53c0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x53d0 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x53e0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x53f0 */  32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 93, 58, 10, 79,
-/* 0x5400 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5410 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5420 */  48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x5430 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x5440 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82,
-/* 0x5450 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5460 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5470 */  48, 48, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5480 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x5490 */  48, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77,
-/* 0x54a0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x54b0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,102, 52,
-/* 0x54c0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x54d0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x54e0 */  48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x54f0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x5500 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65,
-/* 0x5510 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5520 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x5530 */  52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x5540 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x5550 */  48, 48, 48, 48, 48, 49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x5560 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x5570 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82,
-/* 0x5580 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5590 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x55a0 */  48, 49,100, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x55b0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x55c0 */  48, 10, 48, 48, 48, 48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77,
-/* 0x55d0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x55e0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56,
-/* 0x55f0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x5600 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x5610 */  48, 48, 48, 50, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5620 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x5630 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65,
-/* 0x5640 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5650 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x5660 */  51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x5670 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x5680 */  48, 48, 48, 48, 48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x5690 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x56a0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82,
-/* 0x56b0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x56c0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x56d0 */  48, 50, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x56e0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x56f0 */  48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77,
-/* 0x5700 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x5710 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56,
-/* 0x5720 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x5730 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x5740 */  48, 48, 48, 50,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5750 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x5760 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65,
-/* 0x5770 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5780 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x5790 */  48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x57a0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x57b0 */  48, 48, 48, 48, 48, 51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x57c0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x57d0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82,
-/* 0x57e0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57f0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5800 */  48, 51, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5810 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x5820 */  48, 10, 48, 48, 48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77,
-/* 0x5830 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x5840 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99,
-/* 0x5850 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x5860 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x5870 */  48, 48, 48, 51,101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5880 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x5890 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65,
-/* 0x58a0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x58b0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x58c0 */  50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x58d0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x58e0 */  48, 48, 48, 48, 48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x58f0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x5900 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82,
-/* 0x5910 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5920 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5930 */  48, 52, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5940 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x5950 */  48, 10, 48, 48, 48, 48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77,
-/* 0x5960 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x5970 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48,
-/* 0x5980 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x5990 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x59a0 */  48, 48, 48, 52,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x59b0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x59c0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65,
-/* 0x59d0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x59e0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x59f0 */ 102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x5a00 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x5a10 */  48, 48, 48, 48, 48, 53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x5a20 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x5a30 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82,
-/* 0x5a40 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a50 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5a60 */  48, 53, 57, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5a70 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x5a80 */  48, 10, 48, 48, 48, 48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77,
-/* 0x5a90 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x5aa0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48,
-/* 0x5ab0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x5ac0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x5ad0 */  48, 48, 48, 53,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5ae0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x5af0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65,
-/* 0x5b00 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5b10 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x5b20 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x5b30 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x5b40 */  48, 48, 48, 48, 48, 54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x5b50 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x5b60 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82,
-/* 0x5b70 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b80 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5b90 */  48, 54, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5ba0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x5bb0 */  48, 10, 48, 48, 48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77,
-/* 0x5bc0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x5bd0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,100, 48,
-/* 0x5be0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x5bf0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x5c00 */  48, 48, 48, 54,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5c10 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x5c20 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65,
-/* 0x5c30 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5c40 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x5c50 */  50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x5c60 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x5c70 */  48, 48, 48, 48, 48, 55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x5c80 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x5c90 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82,
-/* 0x5ca0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5cb0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5cc0 */  48, 55, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5cd0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x5ce0 */  48, 10, 48, 48, 48, 48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77,
-/* 0x5cf0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x5d00 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52,
-/* 0x5d10 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x5d20 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x5d30 */  48, 48, 48, 55,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5d40 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x5d50 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65,
-/* 0x5d60 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5d70 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x5d80 */  50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x5d90 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x5da0 */  48, 48, 48, 48, 48, 56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x5db0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x5dc0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82,
-/* 0x5dd0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5de0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5df0 */  48, 56, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x5e00 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x5e10 */  48, 10, 48, 48, 48, 48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77,
-/* 0x5e20 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x5e30 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,101, 56,
-/* 0x5e40 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x5e50 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x5e60 */  48, 48, 48, 56,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x5e70 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x5e80 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65,
-/* 0x5e90 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5ea0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57,
-/* 0x5eb0 */  48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x5ec0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x5ed0 */  48, 48, 48, 48, 48, 57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x5ee0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x5ef0 */  68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5f00 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x5f10 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5f20 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f30 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5f40 */  48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x5f50 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x5f60 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82,
-/* 0x5f70 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x5f80 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56,
-/* 0x5f90 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x5fa0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x5fb0 */  48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x5fc0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x5fd0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95,
-/* 0x5fe0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ff0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6000 */  48,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x6010 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x6020 */  10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x6030 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x6040 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32,
-/* 0x6050 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x6060 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x6070 */  48, 48, 49, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x6080 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x6090 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 49, 56, 32, 82, 95, 65, 82,
-/* 0x60a0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x60b0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50,
-/* 0x60c0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x60d0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x60e0 */  48, 48, 48, 48, 49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x60f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x6100 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95,
-/* 0x6110 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6120 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6130 */  49, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x6140 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x6150 */  10, 48, 48, 48, 48, 48, 49, 53, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x6160 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x6170 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 48, 32,
-/* 0x6180 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x6190 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x61a0 */  48, 48, 49, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x61b0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x61c0 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 99, 32, 82, 95, 65, 82,
-/* 0x61d0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x61e0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 57,
-/* 0x61f0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x6200 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x6210 */  48, 48, 48, 48, 49, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x6220 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x6230 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 48, 32, 82, 95,
-/* 0x6240 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6250 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6260 */  49, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x6270 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x6280 */  10, 48, 48, 48, 48, 48, 49,100, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x6290 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x62a0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,100, 99, 32,
-/* 0x62b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x62c0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x62d0 */  48, 48, 49,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x62e0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x62f0 */  49, 48, 10, 48, 48, 48, 48, 48, 49,101, 99, 32, 82, 95, 65, 82,
-/* 0x6300 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x6310 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50,
-/* 0x6320 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x6330 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x6340 */  48, 48, 48, 48, 50, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x6350 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x6360 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 52, 32, 82, 95,
-/* 0x6370 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6380 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6390 */  50, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x63a0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x63b0 */  10, 48, 48, 48, 48, 48, 50, 53, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x63c0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x63d0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 54, 56, 32,
-/* 0x63e0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x63f0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x6400 */  48, 48, 50, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x6410 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x6420 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 56, 99, 32, 82, 95, 65, 82,
-/* 0x6430 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x6440 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 97,
-/* 0x6450 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x6460 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x6470 */  48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x6480 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x6490 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100, 48, 32, 82, 95,
-/* 0x64a0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64b0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x64c0 */  50,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x64d0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x64e0 */  10, 48, 48, 48, 48, 48, 50,102, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x64f0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x6500 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32,
-/* 0x6510 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x6520 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x6530 */  48, 48, 51, 49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x6540 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x6550 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 50, 99, 32, 82, 95, 65, 82,
-/* 0x6560 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x6570 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53,
-/* 0x6580 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x6590 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x65a0 */  48, 48, 48, 48, 51, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x65b0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x65c0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 48, 32, 82, 95,
-/* 0x65d0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65e0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x65f0 */  51, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x6600 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x6610 */  10, 48, 48, 48, 48, 48, 51, 57, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x6620 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x6630 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 48, 32,
-/* 0x6640 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x6650 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x6660 */  48, 48, 51, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x6670 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x6680 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 56, 32, 82, 95, 65, 82,
-/* 0x6690 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x66a0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99,
-/* 0x66b0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x66c0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x66d0 */  48, 48, 48, 48, 52, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x66e0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x66f0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 49, 56, 32, 82, 95,
-/* 0x6700 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6710 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6720 */  52, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x6730 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x6740 */  10
+/* 0x2fc0 */  13,  0,  0,  0, 48,  0,  0,  0, 49,  1,  0,  0,210,  1,  0,  0,
+/* 0x2fd0 */   0,  0,  0,  0, 52,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fe0 */   8,  0,  0,  0, 84,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ff0 */  17,  0,  0,  0, 92,  0,  0,  0, 76,  3,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */  25,  0,  0,  0,168,  3,  0,  0, 36,  7,  0,  0,  2,  0,  0,  0,
+/* 0x3010 */  33,  0,  0,  0,204, 10,  0,  0,220,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3020 */  42,  0,  0,  0,168, 11,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */  51,  0,  0,  0,204, 11,  0,  0, 20,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3040 */  57,  0,  0,  0,224, 12,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3050 */  63,  0,  0,  0,224, 13,  0,  0,196,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3060 */  69,  0,  0,  0,164, 14,  0,  0,144,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3070 */  80,  0,  0,  0, 52, 15,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0,
+/* 0x3080 */  91,  0,  0,  0,108, 24,  0,  0,120,  4,  0,  0,  0,  0,  0,  0,
+/* 0x3090 */ 102,  0,  0,  0,228, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30a0 */  17,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,
+/* 0x30b0 */   3,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,
+/* 0x30c0 */   0,  0,  0,  0, 51,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30d0 */  57,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x30e0 */   8,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  9,  0,  0,  0,
+/* 0x30f0 */   0,  0,  0,  0, 80,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3100 */  91,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3110 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3120 */   0,  0,  0,  0, 42,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3130 */ 102,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,113,  0,  0,  0,
+/* 0x3140 */   4,  0,  0,  0,112,  0,  0,  0,122,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3150 */ 196,  0,  0,  0,129,  0,  0,  0,  2,  0,  0,  0,132,  1,  0,  0,
+/* 0x3160 */ 144,  0,  0,  0,  2,  0,  0,  0,136,  0,  0,  0,151,  0,  0,  0,
+/* 0x3170 */   2,  0,  0,  0,164,  1,  0,  0,158,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3180 */ 176,  0,  0,  0,167,  0,  0,  0,  2,  0,  0,  0,240,  2,  0,  0,
+/* 0x3190 */ 177,  0,  0,  0,  2,  0,  0,  0,216,  0,  0,  0,187,  0,  0,  0,
+/* 0x31a0 */   2,  0,  0,  0, 40,  1,  0,  0,192,  0,  0,  0,  2,  0,  0,  0,
+/* 0x31b0 */  96,  1,  0,  0,206,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31c0 */ 210,  0,  0,  0,  2,  0,  0,  0,140,  1,  0,  0,224,  0,  0,  0,
+/* 0x31d0 */   2,  0,  0,  0, 56,  0,  0,  0,230,  0,  0,  0,  3,  0,  0,  0,
+/* 0x31e0 */   0,  0,  0,  0,241,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31f0 */   8,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  1,  0,  0,
+/* 0x3200 */   2,  0,  0,  0,236,  0,  0,  0, 26,  1,  0,  0,  2,  0,  0,  0,
+/* 0x3210 */  36,  0,  0,  0, 31,  1,  0,  0,  2,  0,  0,  0,116,  0,  0,  0,
+/* 0x3220 */  38,  1,  0,  0,  2,  0,  0,  0,120,  2,  0,  0, 47,  1,  0,  0,
+/* 0x3230 */   2,  0,  0,  0,200,  2,  0,  0, 54,  1,  0,  0,  8,  0,  0,  0,
+/* 0x3240 */   0,  0,  0,  0, 77,  1,  0,  0,  3,  0,  0,  0,232,  1,  0,  0,
+/* 0x3250 */  91,  1,  0,  0,  2,  0,  0,  0,224,  2,  0,  0,101,  1,  0,  0,
+/* 0x3260 */   2,  0,  0,  0, 12,  0,  0,  0,109,  1,  0,  0,  2,  0,  0,  0,
+/* 0x3270 */   4,  1,  0,  0,118,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3280 */ 141,  1,  0,  0,  2,  0,  0,  0, 20,  0,  0,  0,146,  1,  0,  0,
+/* 0x3290 */  11,  0,  0,  0,  0,  0,  0,  0,157,  1,  0,  0,  2,  0,  0,  0,
+/* 0x32a0 */ 156,  0,  0,  0,161,  1,  0,  0,  2,  0,  0,  0, 76,  0,  0,  0,
+/* 0x32b0 */ 166,  1,  0,  0,  2,  0,  0,  0,240,  2,  0,  0,172,  1,  0,  0,
+/* 0x32c0 */   2,  0,  0,  0,  4,  1,  0,  0,181,  1,  0,  0,  2,  0,  0,  0,
+/* 0x32d0 */  96,  0,  0,  0,187,  1,  0,  0,  3,  0,  0,  0,140,  2,  0,  0,
+/* 0x32e0 */   0,  0,  0,  0,  8,  0,  0,  0,199,  1,  0,  0,187,  1,  0,  0,
+/* 0x32f0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,160,  1,  0,  0,
+/* 0x3300 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3310 */   2,  0,  0,  0,180,  1,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x3320 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,200,  1,  0,  0,
+/* 0x3330 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3340 */   2,  0,  0,  0,212,  1,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x3350 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,224,  1,  0,  0,
+/* 0x3360 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3370 */   2,  0,  0,  0, 12,  2,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x3380 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 24,  2,  0,  0,
+/* 0x3390 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33a0 */   2,  0,  0,  0, 40,  2,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x33b0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 52,  2,  0,  0,
+/* 0x33c0 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33d0 */   2,  0,  0,  0, 68,  2,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x33e0 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0, 76,  2,  0,  0,
+/* 0x33f0 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3400 */   2,  0,  0,  0,100,  2,  0,  0,199,  1,  0,  0, 17,  0,  0,  0,
+/* 0x3410 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,112,  2,  0,  0,
+/* 0x3420 */ 199,  1,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3430 */   2,  0,  0,  0,148,  2,  0,  0,199,  1,  0,  0,151,  0,  0,  0,
+/* 0x3440 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,176,  2,  0,  0,
+/* 0x3450 */ 199,  1,  0,  0,210,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3460 */   2,  0,  0,  0,188,  2,  0,  0,199,  1,  0,  0,151,  0,  0,  0,
+/* 0x3470 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,216,  2,  0,  0,
+/* 0x3480 */ 199,  1,  0,  0, 47,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3490 */   3,  0,  0,  0,  4,  0,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x34a0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 48,  0,  0,  0,
+/* 0x34b0 */ 199,  1,  0,  0,101,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34c0 */   3,  0,  0,  0, 56,  0,  0,  0,199,  1,  0,  0,141,  1,  0,  0,
+/* 0x34d0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 84,  0,  0,  0,
+/* 0x34e0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34f0 */   3,  0,  0,  0, 92,  0,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3500 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,104,  0,  0,  0,
+/* 0x3510 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3520 */   3,  0,  0,  0,136,  0,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3530 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,192,  0,  0,  0,
+/* 0x3540 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3550 */   3,  0,  0,  0,208,  0,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3560 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,220,  0,  0,  0,
+/* 0x3570 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3580 */   3,  0,  0,  0,236,  0,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3590 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,244,  0,  0,  0,
+/* 0x35a0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35b0 */   3,  0,  0,  0,  0,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x35c0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  8,  1,  0,  0,
+/* 0x35d0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35e0 */   3,  0,  0,  0, 12,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x35f0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 24,  1,  0,  0,
+/* 0x3600 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3610 */   3,  0,  0,  0, 32,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3620 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 44,  1,  0,  0,
+/* 0x3630 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3640 */   3,  0,  0,  0, 56,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3650 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 64,  1,  0,  0,
+/* 0x3660 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3670 */   3,  0,  0,  0, 80,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3680 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,104,  1,  0,  0,
+/* 0x3690 */ 199,  1,  0,  0,113,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36a0 */   3,  0,  0,  0,112,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x36b0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,128,  1,  0,  0,
+/* 0x36c0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36d0 */   3,  0,  0,  0,136,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x36e0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,168,  1,  0,  0,
+/* 0x36f0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3700 */   3,  0,  0,  0,180,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3710 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,216,  1,  0,  0,
+/* 0x3720 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3730 */   3,  0,  0,  0,240,  1,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3740 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 16,  2,  0,  0,
+/* 0x3750 */ 199,  1,  0,  0,161,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3760 */   3,  0,  0,  0, 36,  2,  0,  0,199,  1,  0,  0, 26,  1,  0,  0,
+/* 0x3770 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 52,  2,  0,  0,
+/* 0x3780 */ 199,  1,  0,  0,181,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3790 */   3,  0,  0,  0, 60,  2,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x37a0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 76,  2,  0,  0,
+/* 0x37b0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37c0 */   3,  0,  0,  0, 80,  2,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x37d0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 92,  2,  0,  0,
+/* 0x37e0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37f0 */   3,  0,  0,  0,104,  2,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3800 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,120,  2,  0,  0,
+/* 0x3810 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3820 */   3,  0,  0,  0,160,  2,  0,  0,199,  1,  0,  0, 77,  1,  0,  0,
+/* 0x3830 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,232,  2,  0,  0,
+/* 0x3840 */ 199,  1,  0,  0,187,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3850 */   3,  0,  0,  0,248,  2,  0,  0,199,  1,  0,  0,151,  0,  0,  0,
+/* 0x3860 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 40,  3,  0,  0,
+/* 0x3870 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3880 */   3,  0,  0,  0, 64,  3,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3890 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 80,  3,  0,  0,
+/* 0x38a0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38b0 */   3,  0,  0,  0,108,  3,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x38c0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,112,  3,  0,  0,
+/* 0x38d0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38e0 */   3,  0,  0,  0,128,  3,  0,  0,199,  1,  0,  0, 13,  1,  0,  0,
+/* 0x38f0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,148,  3,  0,  0,
+/* 0x3900 */ 199,  1,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3910 */   3,  0,  0,  0,168,  3,  0,  0,199,  1,  0,  0,224,  0,  0,  0,
+/* 0x3920 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,180,  3,  0,  0,
+/* 0x3930 */ 199,  1,  0,  0,122,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3940 */   3,  0,  0,  0,188,  3,  0,  0,199,  1,  0,  0,230,  0,  0,  0,
+/* 0x3950 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,220,  3,  0,  0,
+/* 0x3960 */ 199,  1,  0,  0,187,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3970 */   3,  0,  0,  0,228,  3,  0,  0,199,  1,  0,  0,181,  1,  0,  0,
+/* 0x3980 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,244,  3,  0,  0,
+/* 0x3990 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39a0 */   3,  0,  0,  0, 20,  4,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x39b0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 32,  4,  0,  0,
+/* 0x39c0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39d0 */   3,  0,  0,  0, 56,  4,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x39e0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 88,  4,  0,  0,
+/* 0x39f0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a00 */   3,  0,  0,  0,180,  4,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3a10 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,184,  4,  0,  0,
+/* 0x3a20 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a30 */   3,  0,  0,  0,200,  4,  0,  0,199,  1,  0,  0, 13,  1,  0,  0,
+/* 0x3a40 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,212,  4,  0,  0,
+/* 0x3a50 */ 199,  1,  0,  0,177,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a60 */   3,  0,  0,  0,228,  4,  0,  0,199,  1,  0,  0,224,  0,  0,  0,
+/* 0x3a70 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  4,  5,  0,  0,
+/* 0x3a80 */ 199,  1,  0,  0,187,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a90 */   3,  0,  0,  0, 20,  5,  0,  0,199,  1,  0,  0,122,  0,  0,  0,
+/* 0x3aa0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 32,  5,  0,  0,
+/* 0x3ab0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ac0 */   3,  0,  0,  0, 44,  5,  0,  0,199,  1,  0,  0, 38,  1,  0,  0,
+/* 0x3ad0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 96,  5,  0,  0,
+/* 0x3ae0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3af0 */   3,  0,  0,  0,108,  5,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3b00 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,120,  5,  0,  0,
+/* 0x3b10 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b20 */   3,  0,  0,  0,128,  5,  0,  0,199,  1,  0,  0,129,  0,  0,  0,
+/* 0x3b30 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,152,  5,  0,  0,
+/* 0x3b40 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b50 */   3,  0,  0,  0,164,  5,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3b60 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,196,  5,  0,  0,
+/* 0x3b70 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b80 */   3,  0,  0,  0,244,  5,  0,  0,199,  1,  0,  0,192,  0,  0,  0,
+/* 0x3b90 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,252,  5,  0,  0,
+/* 0x3ba0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3bb0 */   3,  0,  0,  0,  0,  6,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3bc0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 16,  6,  0,  0,
+/* 0x3bd0 */ 199,  1,  0,  0, 13,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3be0 */   3,  0,  0,  0, 32,  6,  0,  0,199,  1,  0,  0,224,  0,  0,  0,
+/* 0x3bf0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 64,  6,  0,  0,
+/* 0x3c00 */ 199,  1,  0,  0,187,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c10 */   3,  0,  0,  0, 76,  6,  0,  0,199,  1,  0,  0,181,  1,  0,  0,
+/* 0x3c20 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 84,  6,  0,  0,
+/* 0x3c30 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c40 */   3,  0,  0,  0,104,  6,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3c50 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,120,  6,  0,  0,
+/* 0x3c60 */ 199,  1,  0,  0,122,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c70 */   3,  0,  0,  0,144,  6,  0,  0,199,  1,  0,  0,230,  0,  0,  0,
+/* 0x3c80 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,176,  6,  0,  0,
+/* 0x3c90 */ 199,  1,  0,  0,187,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ca0 */   3,  0,  0,  0,184,  6,  0,  0,199,  1,  0,  0,181,  1,  0,  0,
+/* 0x3cb0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,188,  6,  0,  0,
+/* 0x3cc0 */ 199,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3cd0 */   3,  0,  0,  0,212,  6,  0,  0,199,  1,  0,  0,230,  0,  0,  0,
+/* 0x3ce0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,228,  6,  0,  0,
+/* 0x3cf0 */ 199,  1,  0,  0,109,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d00 */   3,  0,  0,  0,240,  6,  0,  0,199,  1,  0,  0, 25,  0,  0,  0,
+/* 0x3d10 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,252,  6,  0,  0,
+/* 0x3d20 */ 199,  1,  0,  0,122,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d30 */   4,  0,  0,  0, 40,  0,  0,  0,199,  1,  0,  0, 33,  0,  0,  0,
+/* 0x3d40 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 68,  0,  0,  0,
+/* 0x3d50 */ 199,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d60 */   4,  0,  0,  0,132,  0,  0,  0,199,  1,  0,  0, 33,  0,  0,  0,
+/* 0x3d70 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,148,  0,  0,  0,
+/* 0x3d80 */ 199,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d90 */   4,  0,  0,  0,168,  0,  0,  0,199,  1,  0,  0, 33,  0,  0,  0,
+/* 0x3da0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,184,  0,  0,  0,
+/* 0x3db0 */ 199,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3dc0 */   4,  0,  0,  0,204,  0,  0,  0,199,  1,  0,  0,192,  0,  0,  0,
+/* 0x3dd0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 16,  0,  0,  0,
+/* 0x3de0 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3df0 */   6,  0,  0,  0, 68,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3e00 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 72,  0,  0,  0,
+/* 0x3e10 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e20 */   6,  0,  0,  0, 80,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3e30 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 92,  0,  0,  0,
+/* 0x3e40 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e50 */   6,  0,  0,  0,104,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3e60 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,116,  0,  0,  0,
+/* 0x3e70 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e80 */   6,  0,  0,  0,120,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3e90 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,132,  0,  0,  0,
+/* 0x3ea0 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3eb0 */   6,  0,  0,  0,148,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3ec0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,156,  0,  0,  0,
+/* 0x3ed0 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ee0 */   6,  0,  0,  0,160,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3ef0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,168,  0,  0,  0,
+/* 0x3f00 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3f10 */   6,  0,  0,  0,172,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3f20 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,184,  0,  0,  0,
+/* 0x3f30 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3f40 */   6,  0,  0,  0,188,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3f50 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,196,  0,  0,  0,
+/* 0x3f60 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3f70 */   6,  0,  0,  0,208,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3f80 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,212,  0,  0,  0,
+/* 0x3f90 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3fa0 */   6,  0,  0,  0,220,  0,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3fb0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,228,  0,  0,  0,
+/* 0x3fc0 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3fd0 */   6,  0,  0,  0, 12,  1,  0,  0,199,  1,  0,  0, 51,  0,  0,  0,
+/* 0x3fe0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 16,  1,  0,  0,
+/* 0x3ff0 */ 199,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4000 */   7,  0,  0,  0, 16,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x4010 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 68,  0,  0,  0,
+/* 0x4020 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4030 */   7,  0,  0,  0, 72,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x4040 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 80,  0,  0,  0,
+/* 0x4050 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4060 */   7,  0,  0,  0, 92,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x4070 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,104,  0,  0,  0,
+/* 0x4080 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4090 */   7,  0,  0,  0,116,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x40a0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,120,  0,  0,  0,
+/* 0x40b0 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x40c0 */   7,  0,  0,  0,132,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x40d0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,148,  0,  0,  0,
+/* 0x40e0 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x40f0 */   7,  0,  0,  0,156,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x4100 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,164,  0,  0,  0,
+/* 0x4110 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4120 */   7,  0,  0,  0,176,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x4130 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,184,  0,  0,  0,
+/* 0x4140 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4150 */   7,  0,  0,  0,196,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x4160 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,208,  0,  0,  0,
+/* 0x4170 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4180 */   7,  0,  0,  0,212,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x4190 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,248,  0,  0,  0,
+/* 0x41a0 */ 199,  1,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x41b0 */   7,  0,  0,  0,252,  0,  0,  0,199,  1,  0,  0, 57,  0,  0,  0,
+/* 0x41c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 16,  0,  0,  0,
+/* 0x41d0 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x41e0 */   8,  0,  0,  0, 72,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x41f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  0,  0,  0,
+/* 0x4200 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4210 */   8,  0,  0,  0, 84,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x4220 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,100,  0,  0,  0,
+/* 0x4230 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4240 */   8,  0,  0,  0,104,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x4250 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,108,  0,  0,  0,
+/* 0x4260 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4270 */   8,  0,  0,  0,120,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x4280 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,136,  0,  0,  0,
+/* 0x4290 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x42a0 */   8,  0,  0,  0,140,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x42b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,148,  0,  0,  0,
+/* 0x42c0 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x42d0 */   8,  0,  0,  0,156,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x42e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,160,  0,  0,  0,
+/* 0x42f0 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4300 */   8,  0,  0,  0,188,  0,  0,  0,199,  1,  0,  0, 63,  0,  0,  0,
+/* 0x4310 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,192,  0,  0,  0,
+/* 0x4320 */ 199,  1,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4330 */   9,  0,  0,  0,  8,  0,  0,  0,199,  1,  0,  0, 69,  0,  0,  0,
+/* 0x4340 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 76,  0,  0,  0,
+/* 0x4350 */ 199,  1,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4360 */   9,  0,  0,  0,128,  0,  0,  0,199,  1,  0,  0, 69,  0,  0,  0,
+/* 0x4370 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,140,  0,  0,  0,
+/* 0x4380 */ 199,  1,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4390 */  10,  0,  0,  0,116,  0,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x43a0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,144,  0,  0,  0,
+/* 0x43b0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x43c0 */  10,  0,  0,  0,184,  0,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x43d0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,204,  0,  0,  0,
+/* 0x43e0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x43f0 */  10,  0,  0,  0,244,  0,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4400 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  1,  0,  0,
+/* 0x4410 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4420 */  10,  0,  0,  0,  8,  1,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4430 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 68,  1,  0,  0,
+/* 0x4440 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4450 */  10,  0,  0,  0,144,  1,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4460 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,204,  1,  0,  0,
+/* 0x4470 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4480 */  10,  0,  0,  0,216,  1,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4490 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  4,  2,  0,  0,
+/* 0x44a0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x44b0 */  10,  0,  0,  0, 24,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x44c0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 32,  2,  0,  0,
+/* 0x44d0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x44e0 */  10,  0,  0,  0, 52,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x44f0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 60,  2,  0,  0,
+/* 0x4500 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4510 */  10,  0,  0,  0, 64,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4520 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 76,  2,  0,  0,
+/* 0x4530 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4540 */  10,  0,  0,  0, 88,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4550 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,164,  2,  0,  0,
+/* 0x4560 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4570 */  10,  0,  0,  0,200,  2,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4580 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,232,  2,  0,  0,
+/* 0x4590 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x45a0 */  10,  0,  0,  0,  4,  3,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x45b0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 12,  3,  0,  0,
+/* 0x45c0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x45d0 */  10,  0,  0,  0, 60,  3,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x45e0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,136,  3,  0,  0,
+/* 0x45f0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4600 */  10,  0,  0,  0,160,  3,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4610 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,168,  3,  0,  0,
+/* 0x4620 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4630 */  10,  0,  0,  0,204,  3,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4640 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,224,  3,  0,  0,
+/* 0x4650 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4660 */  10,  0,  0,  0,232,  3,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4670 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 36,  4,  0,  0,
+/* 0x4680 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4690 */  10,  0,  0,  0, 56,  4,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x46a0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,108,  4,  0,  0,
+/* 0x46b0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x46c0 */  10,  0,  0,  0,132,  4,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x46d0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,140,  4,  0,  0,
+/* 0x46e0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x46f0 */  10,  0,  0,  0,176,  4,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4700 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,212,  4,  0,  0,
+/* 0x4710 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4720 */  10,  0,  0,  0,236,  4,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4730 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,244,  4,  0,  0,
+/* 0x4740 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4750 */  10,  0,  0,  0, 24,  5,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4760 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 60,  5,  0,  0,
+/* 0x4770 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4780 */  10,  0,  0,  0,152,  5,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4790 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,160,  5,  0,  0,
+/* 0x47a0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x47b0 */  10,  0,  0,  0,192,  5,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x47c0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,228,  5,  0,  0,
+/* 0x47d0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x47e0 */  10,  0,  0,  0,252,  5,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x47f0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  4,  6,  0,  0,
+/* 0x4800 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4810 */  10,  0,  0,  0, 36,  6,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4820 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 72,  6,  0,  0,
+/* 0x4830 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4840 */  10,  0,  0,  0,128,  6,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4850 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,140,  6,  0,  0,
+/* 0x4860 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4870 */  10,  0,  0,  0,208,  6,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4880 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,236,  6,  0,  0,
+/* 0x4890 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x48a0 */  10,  0,  0,  0, 28,  7,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x48b0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 40,  7,  0,  0,
+/* 0x48c0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x48d0 */  10,  0,  0,  0,108,  7,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x48e0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,124,  7,  0,  0,
+/* 0x48f0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4900 */  10,  0,  0,  0,156,  7,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4910 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,184,  7,  0,  0,
+/* 0x4920 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4930 */  10,  0,  0,  0,196,  7,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4940 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,208,  7,  0,  0,
+/* 0x4950 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4960 */  10,  0,  0,  0,244,  7,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4970 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 32,  8,  0,  0,
+/* 0x4980 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4990 */  10,  0,  0,  0, 44,  8,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x49a0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,124,  8,  0,  0,
+/* 0x49b0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x49c0 */  10,  0,  0,  0,136,  8,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x49d0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,160,  8,  0,  0,
+/* 0x49e0 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x49f0 */  10,  0,  0,  0,232,  8,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4a00 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,244,  8,  0,  0,
+/* 0x4a10 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4a20 */  10,  0,  0,  0,252,  8,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4a30 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  4,  9,  0,  0,
+/* 0x4a40 */ 199,  1,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4a50 */  10,  0,  0,  0, 40,  9,  0,  0,199,  1,  0,  0, 80,  0,  0,  0,
+/* 0x4a60 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,120,  0,  0,  0,
+/* 0x4a70 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4a80 */  11,  0,  0,  0,128,  0,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4a90 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,136,  0,  0,  0,
+/* 0x4aa0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4ab0 */  11,  0,  0,  0,168,  0,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4ac0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,172,  0,  0,  0,
+/* 0x4ad0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4ae0 */  11,  0,  0,  0,228,  0,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4af0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  1,  0,  0,
+/* 0x4b00 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4b10 */  11,  0,  0,  0, 12,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4b20 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 20,  1,  0,  0,
+/* 0x4b30 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4b40 */  11,  0,  0,  0, 24,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4b50 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 32,  1,  0,  0,
+/* 0x4b60 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4b70 */  11,  0,  0,  0, 40,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4b80 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 68,  1,  0,  0,
+/* 0x4b90 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4ba0 */  11,  0,  0,  0, 76,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4bb0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 80,  1,  0,  0,
+/* 0x4bc0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4bd0 */  11,  0,  0,  0,128,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4be0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,136,  1,  0,  0,
+/* 0x4bf0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4c00 */  11,  0,  0,  0,140,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4c10 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,156,  1,  0,  0,
+/* 0x4c20 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4c30 */  11,  0,  0,  0,160,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4c40 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,192,  1,  0,  0,
+/* 0x4c50 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4c60 */  11,  0,  0,  0,204,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4c70 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,212,  1,  0,  0,
+/* 0x4c80 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4c90 */  11,  0,  0,  0,220,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4ca0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,228,  1,  0,  0,
+/* 0x4cb0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4cc0 */  11,  0,  0,  0,236,  1,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4cd0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 40,  2,  0,  0,
+/* 0x4ce0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4cf0 */  11,  0,  0,  0, 44,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4d00 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 68,  2,  0,  0,
+/* 0x4d10 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4d20 */  11,  0,  0,  0, 76,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4d30 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 80,  2,  0,  0,
+/* 0x4d40 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4d50 */  11,  0,  0,  0,104,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4d60 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,132,  2,  0,  0,
+/* 0x4d70 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4d80 */  11,  0,  0,  0,140,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4d90 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,164,  2,  0,  0,
+/* 0x4da0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4db0 */  11,  0,  0,  0,200,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4dc0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,208,  2,  0,  0,
+/* 0x4dd0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4de0 */  11,  0,  0,  0,220,  2,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4df0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,244,  2,  0,  0,
+/* 0x4e00 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4e10 */  11,  0,  0,  0, 12,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4e20 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 20,  3,  0,  0,
+/* 0x4e30 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4e40 */  11,  0,  0,  0, 44,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4e50 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 80,  3,  0,  0,
+/* 0x4e60 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4e70 */  11,  0,  0,  0, 88,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4e80 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,112,  3,  0,  0,
+/* 0x4e90 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4ea0 */  11,  0,  0,  0,120,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4eb0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,156,  3,  0,  0,
+/* 0x4ec0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4ed0 */  11,  0,  0,  0,176,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4ee0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,184,  3,  0,  0,
+/* 0x4ef0 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4f00 */  11,  0,  0,  0,200,  3,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4f10 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,204,  3,  0,  0,
+/* 0x4f20 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4f30 */  11,  0,  0,  0,  0,  4,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4f40 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 24,  4,  0,  0,
+/* 0x4f50 */ 199,  1,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x4f60 */  11,  0,  0,  0, 64,  4,  0,  0,199,  1,  0,  0, 91,  0,  0,  0,
+/* 0x4f70 */   0,  0,  0,  0,  0,  0,  0,  0, 83, 79, 95, 72, 69, 65, 68,  0,
+/* 0x4f80 */ 112,116,114, 95, 78, 69, 88, 84,  0, 83, 79, 95, 84, 65, 73, 76,
+/* 0x4f90 */   0, 83, 79, 95, 77, 65, 73, 78,  0, 69, 88, 80, 95, 72, 69, 65,
+/* 0x4fa0 */  68,  0, 69, 88, 80, 95, 84, 65, 73, 76,  0, 78, 82, 86, 50, 69,
+/* 0x4fb0 */   0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77,
+/* 0x4fc0 */  65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x4fd0 */  50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90,
+/* 0x4fe0 */  77, 65, 95, 68, 69, 67, 51, 48,  0,102, 95,101,120,112, 97,110,
+/* 0x4ff0 */ 100,  0,109,117,110,109, 97,112,  0,103,101,116, 95,115,121,115,
+/* 0x5000 */  95,109,117,110,109, 97,112,  0,103,101,116,112,105,100,  0,109,
+/* 0x5010 */ 101,109, 99,112,121,  0,114,101, 97,100,108,105,110,107,  0, 95,
+/* 0x5020 */  95,117,100,105,118,115,105, 51,  0,102,116,114,117,110, 99, 97,
+/* 0x5030 */ 116,101,  0,109,109, 97,112,  0, 95, 95, 99,108,101, 97,114, 95,
+/* 0x5040 */  99, 97, 99,104,101,  0,101,111,102,  0,109,109, 97,112, 95,112,
+/* 0x5050 */ 114,105,118, 97,110,111,110,  0,119,114,105,116,101,  0, 80, 70,
+/* 0x5060 */  95,116,111, 95, 80, 82, 79, 84,  0,117, 99,108, 95,110,114,118,
+/* 0x5070 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,
+/* 0x5080 */ 102,111,108,100,  0,109,101,109,102,100, 95, 99,114,101, 97,116,
+/* 0x5090 */ 101,  0,114,101, 97,100,  0,117,110,108,105,110,107,  0,117,110,
+/* 0x50a0 */ 100,101,114,108, 97,121,  0,109,101,109,115,101,116,  0,117, 99,
+/* 0x50b0 */ 108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,
+/* 0x50c0 */ 115,115, 95, 56,  0,103,101,116, 95, 80, 65, 71, 69, 95, 77, 65,
+/* 0x50d0 */  83, 75,  0,109,121, 95, 97,108,108,111, 99, 97,  0,109,121, 95,
+/* 0x50e0 */  98,107,112,116,  0, 80,112,114,111,116,101, 99,116,  0,117, 99,
+/* 0x50f0 */ 108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,
+/* 0x5100 */ 115,115, 95, 56,  0,101,120,105,116,  0, 76,122,109, 97, 68,101,
+/* 0x5110 */  99,111,100,101,  0, 98,114,107,  0,111,112,101,110,  0,100,105,
+/* 0x5120 */ 118, 49, 48,  0,109,112,114,111,116,101, 99,116,  0, 99,108,111,
+/* 0x5130 */ 115,101,  0,117,112,120, 95,115,111, 95,109, 97,105,110,  0, 82,
+/* 0x5140 */  95, 65, 82, 77, 95, 80, 67, 50, 52,  0,192, 47,  0,  0, 85, 80,
+/* 0x5150 */  88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm.v5t-linux.shlib-init.h
-   created from arm.v5t-linux.shlib-init.bin, 14998 (0x3a96) bytes
+   created from arm.v5t-linux.shlib-init.bin, 10871 (0x2a77) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM_V5T_LINUX_SHLIB_INIT_SIZE    14998
-#define STUB_ARM_V5T_LINUX_SHLIB_INIT_ADLER32 0xff4ca44c
-#define STUB_ARM_V5T_LINUX_SHLIB_INIT_CRC32   0x41d462dd
+#define STUB_ARM_V5T_LINUX_SHLIB_INIT_SIZE    10871
+#define STUB_ARM_V5T_LINUX_SHLIB_INIT_ADLER32 0x498fb028
+#define STUB_ARM_V5T_LINUX_SHLIB_INIT_CRC32   0xf4c9d8b5
 
-unsigned char stub_arm_v5t_linux_shlib_init[14998] = {
+unsigned char stub_arm_v5t_linux_shlib_init[10871] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 40,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 252, 20,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -361,617 +361,359 @@ unsigned char stub_arm_v5t_linux_shlib_init[14998] = {
 /* 0x1420 */ 195,231,204,120,139,120, 36,  2, 28, 67, 75,120, 36,  2, 28, 67,
 /* 0x1430 */  11,120, 36,  2, 28, 67,  4, 49,112, 71,155,  8,155,  0,  4, 59,
 /* 0x1440 */  29,136,109,  5,173, 10, 91,136, 91,  5, 91, 13,237, 24,  2, 53,
-/* 0x1450 */ 109,  8,112, 71,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1460 */ 101,108,102, 51, 50, 45,108,105,116,116,108,101, 97,114,109, 10,
-/* 0x1470 */  10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78,
-/* 0x1480 */  97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,
-/* 0x1490 */ 101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32,
-/* 0x14a0 */  32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,
-/* 0x14b0 */ 111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115,
-/* 0x14c0 */  10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32,
-/* 0x14d0 */  32, 32, 32, 48, 97, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x14e0 */  52, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x14f0 */  83, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32,
-/* 0x1500 */  32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 52,
-/* 0x1510 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1520 */  10, 32, 32, 50, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32,
-/* 0x1530 */  32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 52, 32,
-/* 0x1540 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1550 */  32, 32, 51, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1560 */  32, 32, 48, 49, 51, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48,100,
-/* 0x1570 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1580 */  83, 10, 32, 32, 52, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32,
-/* 0x1590 */  32, 32, 32, 32, 48, 49, 50, 56, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x15a0 */  48, 50, 49, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x15b0 */  69, 78, 84, 83, 10, 32, 32, 53, 32, 78, 82, 86, 50, 66, 32, 32,
-/* 0x15c0 */  32, 32, 32, 32, 32, 32, 32, 48,101, 99, 32, 32, 48, 32, 32, 48,
-/* 0x15d0 */  32, 32, 48, 51, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x15e0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95,
-/* 0x15f0 */  69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 98, 99, 32, 32, 48, 32,
-/* 0x1600 */  32, 48, 32, 32, 48, 52, 50, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1610 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 76, 90, 77,
-/* 0x1620 */  65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 57, 51, 56, 32,
-/* 0x1630 */  32, 48, 32, 32, 48, 32, 32, 48, 52,101, 48, 32, 32, 50, 42, 42,
-/* 0x1640 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32,
-/* 0x1650 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 52,
-/* 0x1660 */  55, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 49, 56, 32, 32,
-/* 0x1670 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1680 */  32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x1690 */  32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 57, 48, 32,
-/* 0x16a0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x16b0 */  32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32,
-/* 0x16c0 */  32, 32, 48, 51,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50,
-/* 0x16d0 */  57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x16e0 */  84, 83, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32,
-/* 0x16f0 */  32, 32, 32, 32, 32, 48, 49, 56, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1700 */  32, 48, 49, 50,100, 48, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79,
-/* 0x1710 */  78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65,
-/* 0x1720 */  66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 56, 50, 32,108, 32,
-/* 0x1730 */  32, 32, 32, 32, 70, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48,
-/* 0x1740 */  32, 76, 54, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1750 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78,
-/* 0x1760 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1770 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82,
-/* 0x1780 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1790 */  32, 32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86,
-/* 0x17a0 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x17b0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48,
-/* 0x17c0 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48,
-/* 0x17d0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x17e0 */  65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x17f0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1800 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1810 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x1820 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x1830 */  76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1840 */  78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1850 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 46,
-/* 0x1860 */ 114,101, 97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70,
-/* 0x1870 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1880 */  32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32,
-/* 0x1890 */  48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48,
-/* 0x18a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95,
-/* 0x18b0 */  72, 69, 65, 68, 32, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10,
-/* 0x18c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x18d0 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 48, 32, 78, 82, 86, 95,
-/* 0x18e0 */  84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x18f0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x1900 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x1910 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x1920 */  76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1930 */  78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x1940 */  32, 32, 70, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 95,
-/* 0x1950 */ 115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103,
-/* 0x1960 */  32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 69, 32, 48, 49, 51,
-/* 0x1970 */  99, 32,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,
-/* 0x1980 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1990 */  48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 68, 32,
-/* 0x19a0 */  48, 49, 50, 56, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,
-/* 0x19b0 */ 101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48,
-/* 0x19c0 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86,
-/* 0x19d0 */  50, 66, 32, 48,101, 99, 32,117, 99,108, 95,110,114,118, 50, 98,
-/* 0x19e0 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56, 10, 48, 48,
-/* 0x19f0 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x1a00 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,122,109, 97,
-/* 0x1a10 */  68,101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1a20 */ 103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x1a30 */  32, 48, 32,101,110,100, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x1a40 */ 115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x1a50 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65,
-/* 0x1a60 */  73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x1a70 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a80 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 51, 52, 32,
-/* 0x1a90 */  82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32,
-/* 0x1aa0 */  32, 32, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,111,102,
-/* 0x1ab0 */  69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 52,
-/* 0x1ac0 */  99, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76,
-/* 0x1ad0 */  32, 32, 32, 32, 76, 54, 49, 48, 10, 48, 48, 48, 48, 48, 48, 57,
-/* 0x1ae0 */  48, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76,
-/* 0x1af0 */  32, 32, 32, 32, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,
-/* 0x1b00 */ 111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48,
-/* 0x1b10 */  48, 57, 54, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65,
-/* 0x1b20 */  76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,116, 97,114,
-/* 0x1b30 */ 116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95,
-/* 0x1b50 */  67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,116,
-/* 0x1b60 */  97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10,
-/* 0x1b70 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x1b80 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10,
-/* 0x1b90 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x1ba0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x1bb0 */  10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1bc0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1bd0 */  69, 10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 65, 82, 77,
-/* 0x1be0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1bf0 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 48, 32, 82, 95, 65, 82,
-/* 0x1c00 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1c10 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65,
-/* 0x1c20 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1c30 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 56, 52, 32, 82, 95,
-/* 0x1c40 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c50 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82,
-/* 0x1c60 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c70 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32,
-/* 0x1c80 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1c90 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97, 48,
-/* 0x1ca0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1cb0 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x1cc0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1cd0 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1cf0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1d00 */  48, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1d10 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1d20 */  48, 48, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1d30 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1d40 */  48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1d50 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1d60 */  48, 48, 48, 48,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1d70 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1d80 */  48, 48, 48, 48, 48,101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1d90 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1da0 */  48, 48, 48, 48, 48, 48,101, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1db0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1dc0 */  10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1dd0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1de0 */  69, 10, 48, 48, 48, 48, 48, 48,102, 56, 32, 82, 95, 65, 82, 77,
-/* 0x1df0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1e00 */  50, 69, 10, 48, 48, 48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82,
-/* 0x1e10 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1e20 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 52, 32, 82, 95, 65,
-/* 0x1e30 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1e40 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95,
-/* 0x1e50 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e60 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 51, 52, 32, 82,
-/* 0x1e70 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e80 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 49, 51, 56, 32,
-/* 0x1e90 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1ea0 */  32, 32, 78, 82, 86, 50, 69, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x1eb0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x1ec0 */  91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x1ed0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ee0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1ef0 */  49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1f00 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1f10 */  48, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1f20 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1f30 */  48, 48, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1f40 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1f50 */  48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1f60 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x1f70 */  48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1f80 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x1f90 */  48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1fa0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x1fb0 */  48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1fc0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x1fd0 */  10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1fe0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1ff0 */  68, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2000 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2010 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82,
-/* 0x2020 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2030 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32, 82, 95, 65,
-/* 0x2040 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2050 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95,
-/* 0x2060 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2070 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,100, 56, 32, 82,
-/* 0x2080 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2090 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 48, 32,
-/* 0x20a0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x20b0 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,101, 99,
-/* 0x20c0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x20d0 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,102,
-/* 0x20e0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x20f0 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2100 */ 102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2110 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x2120 */  49, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2130 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x2140 */  48, 49, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2150 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 10, 82, 69,
-/* 0x2160 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2170 */  32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70,
-/* 0x2180 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2190 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x21a0 */  48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x21b0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x21c0 */  48, 48, 48, 48, 48, 48, 55, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x21d0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x21e0 */  10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x21f0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x2200 */  66, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2210 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2220 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 56, 99, 32, 82, 95, 65, 82,
-/* 0x2230 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x2240 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65,
-/* 0x2250 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2260 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 57, 52, 32, 82, 95,
-/* 0x2270 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2280 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 97, 48, 32, 82,
-/* 0x2290 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22a0 */  32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 48, 32,
-/* 0x22b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x22c0 */  32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 52,
-/* 0x22d0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x22e0 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x22f0 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2300 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2320 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x2330 */  48, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2340 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x2350 */  48, 48,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2360 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x2370 */  48, 48, 48,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2380 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 10, 82,
-/* 0x2390 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x23a0 */  83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x23b0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x23c0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x23d0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x23e0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23f0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2400 */  48, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2410 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x2420 */  10, 48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2430 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2440 */  95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32,
-/* 0x2450 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2460 */  32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 10, 82, 69,
-/* 0x2470 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2480 */  32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2490 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x24a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x24b0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32, 82, 95, 65,
-/* 0x24c0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x24d0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x24e0 */  57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x24f0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2500 */  48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2510 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2520 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82,
-/* 0x2530 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2540 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2550 */  48, 48,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2560 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2570 */  48, 10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2580 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2590 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 48, 56,
-/* 0x25a0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x25b0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x25c0 */  48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x25d0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x25e0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 57, 48, 32, 82, 95, 65,
-/* 0x25f0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2600 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x2610 */  99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2620 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2630 */  48, 48, 48, 48, 48, 49,100, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2640 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2650 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 48, 52, 32, 82,
-/* 0x2660 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2670 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2680 */  48, 50, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2690 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x26a0 */  48, 10, 48, 48, 48, 48, 48, 50, 50, 48, 32, 82, 95, 65, 82, 77,
-/* 0x26b0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x26c0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 52,
-/* 0x26d0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x26e0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x26f0 */  48, 48, 48, 50, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2700 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2710 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 52, 48, 32, 82, 95, 65,
-/* 0x2720 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2730 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x2740 */  52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2750 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2760 */  48, 48, 48, 48, 48, 50, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2770 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2780 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82,
-/* 0x2790 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27a0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x27b0 */  48, 50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x27c0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x27d0 */  48, 10, 48, 48, 48, 48, 48, 50,101, 56, 32, 82, 95, 65, 82, 77,
-/* 0x27e0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x27f0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 52,
-/* 0x2800 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2810 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2820 */  48, 48, 48, 51, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2830 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2840 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 51, 99, 32, 82, 95, 65,
-/* 0x2850 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2860 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x2870 */  56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2880 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2890 */  48, 48, 48, 48, 48, 51, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x28a0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x28b0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97, 56, 32, 82,
-/* 0x28c0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x28d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x28e0 */  48, 51, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x28f0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2900 */  48, 10, 48, 48, 48, 48, 48, 51,101, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2910 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2920 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51,101, 56,
-/* 0x2930 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2940 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2950 */  48, 48, 48, 52, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2960 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2970 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 51, 56, 32, 82, 95, 65,
-/* 0x2980 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2990 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,
-/* 0x29a0 */  54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x29b0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x29c0 */  48, 48, 48, 48, 48, 52, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x29d0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x29e0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56, 99, 32, 82,
-/* 0x29f0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a00 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2a10 */  48, 52, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2a20 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2a30 */  48, 10, 48, 48, 48, 48, 48, 52,100, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2a40 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2a50 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,101, 99,
-/* 0x2a60 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2a70 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2a80 */  48, 48, 48, 52,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2a90 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2aa0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 49, 56, 32, 82, 95, 65,
-/* 0x2ab0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2ac0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,
-/* 0x2ad0 */  51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2ae0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2af0 */  48, 48, 48, 48, 48, 53, 57, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2b00 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2b10 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 97, 48, 32, 82,
-/* 0x2b20 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b30 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2b40 */  48, 53, 99, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2b50 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2b60 */  48, 10, 48, 48, 48, 48, 48, 53,101, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2b70 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2b80 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53,102, 99,
-/* 0x2b90 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2ba0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2bb0 */  48, 48, 48, 54, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2bc0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2bd0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 50, 52, 32, 82, 95, 65,
-/* 0x2be0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2bf0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,
-/* 0x2c00 */  52, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2c10 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2c20 */  48, 48, 48, 48, 48, 54, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2c30 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2c40 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56, 99, 32, 82,
-/* 0x2c50 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2c60 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2c70 */  48, 54,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2c80 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2c90 */  48, 10, 48, 48, 48, 48, 48, 54,101, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2ca0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2cb0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 49, 99,
-/* 0x2cc0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2cd0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2ce0 */  48, 48, 48, 55, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2cf0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2d00 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 54, 99, 32, 82, 95, 65,
-/* 0x2d10 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2d20 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,
-/* 0x2d30 */  55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2d40 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2d50 */  48, 48, 48, 48, 48, 55, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2d60 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2d70 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 98, 56, 32, 82,
-/* 0x2d80 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d90 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2da0 */  48, 55, 99, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2db0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2dc0 */  48, 10, 48, 48, 48, 48, 48, 55,100, 48, 32, 82, 95, 65, 82, 77,
-/* 0x2dd0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2de0 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55,102, 52,
-/* 0x2df0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2e00 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2e10 */  48, 48, 48, 56, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2e20 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2e30 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 99, 32, 82, 95, 65,
-/* 0x2e40 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2e50 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,
-/* 0x2e60 */  55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2e70 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10,
-/* 0x2e80 */  48, 48, 48, 48, 48, 56, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2e90 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2ea0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 97, 48, 32, 82,
-/* 0x2eb0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ec0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x2ed0 */  48, 56,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2ee0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x2ef0 */  48, 10, 48, 48, 48, 48, 48, 56,102, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2f00 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2f10 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,102, 99,
-/* 0x2f20 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2f30 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x2f40 */  48, 48, 48, 57, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2f50 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2f60 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 50, 56, 32, 82, 95, 65,
-/* 0x2f70 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2f80 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2f90 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2fa0 */  82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 93, 58, 10,
-/* 0x2fb0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2fc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2fd0 */  10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2fe0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2ff0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 48, 32,
-/* 0x3000 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3010 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3020 */  48, 48, 48, 56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3030 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3040 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82,
-/* 0x3050 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3060 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x3070 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3080 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3090 */  48, 48, 48, 48, 48,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x30a0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x30b0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 48, 32, 82, 95,
-/* 0x30c0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x30d0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x30e0 */  49, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x30f0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3100 */  10, 48, 48, 48, 48, 48, 49, 49, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3110 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3120 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 49, 56, 32,
-/* 0x3130 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3140 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3150 */  48, 48, 49, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3160 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3170 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 56, 32, 82, 95, 65, 82,
-/* 0x3180 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3190 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52,
-/* 0x31a0 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x31b0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x31c0 */  48, 48, 48, 48, 49, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x31d0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x31e0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 53, 48, 32, 82, 95,
-/* 0x31f0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3200 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3210 */  49, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3220 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3230 */  10, 48, 48, 48, 48, 48, 49, 56, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3240 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3250 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 99, 32,
-/* 0x3260 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3270 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3280 */  48, 48, 49, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3290 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x32a0 */  49, 48, 10, 48, 48, 48, 48, 48, 49, 97, 48, 32, 82, 95, 65, 82,
-/* 0x32b0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x32c0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99,
-/* 0x32d0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x32e0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x32f0 */  48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3300 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3310 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,100, 52, 32, 82, 95,
-/* 0x3320 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3330 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3340 */  49,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3350 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3360 */  10, 48, 48, 48, 48, 48, 49,101, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3370 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3380 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,101, 99, 32,
-/* 0x3390 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x33a0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x33b0 */  48, 48, 50, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x33c0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x33d0 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 99, 32, 82, 95, 65, 82,
-/* 0x33e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x33f0 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52,
-/* 0x3400 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3410 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3420 */  48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3430 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3440 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 53, 48, 32, 82, 95,
-/* 0x3450 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3460 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3470 */  50, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x3480 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x3490 */  10, 48, 48, 48, 48, 48, 50, 56, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x34a0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x34b0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 56, 99, 32,
-/* 0x34c0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x34d0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x34e0 */  48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x34f0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3500 */  49, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82, 95, 65, 82,
-/* 0x3510 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3520 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100,
-/* 0x3530 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3540 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3550 */  48, 48, 48, 48, 50,100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3560 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3570 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,102, 52, 32, 82, 95,
-/* 0x3580 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3590 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x35a0 */  51, 48, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x35b0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x35c0 */  10, 48, 48, 48, 48, 48, 51, 49, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x35d0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x35e0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 50, 99, 32,
-/* 0x35f0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3600 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3610 */  48, 48, 51, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3620 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3630 */  49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 56, 32, 82, 95, 65, 82,
-/* 0x3640 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3650 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55,
-/* 0x3660 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x3670 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3680 */  48, 48, 48, 48, 51, 55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x3690 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x36a0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 57, 99, 32, 82, 95,
-/* 0x36b0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x36c0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x36d0 */  51, 98, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x36e0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x36f0 */  10, 48, 48, 48, 48, 48, 51, 98, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x3700 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x3710 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 56, 32,
-/* 0x3720 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3730 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3740 */  48, 48, 51, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x3750 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3760 */  49, 48, 10, 48, 48, 48, 48, 48, 52, 48, 48, 32, 82, 95, 65, 82,
-/* 0x3770 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3780 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 49,
-/* 0x3790 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x37a0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48,
-/* 0x37b0 */  48, 48, 48, 48, 52, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x37c0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x37d0 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x37e0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76,
-/* 0x37f0 */  70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x3800 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3810 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3820 */  50, 48, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76,
-/* 0x3830 */  76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,116, 97,114,116,
-/* 0x3840 */  95,111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48,
-/* 0x3850 */  48, 48, 50, 56, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67,
-/* 0x3860 */  65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,116, 97,
-/* 0x3870 */ 114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x3880 */  48, 48, 48, 48, 51, 48, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77,
-/* 0x3890 */  95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,
-/* 0x38a0 */ 116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x38b0 */  48, 48, 48, 48, 48, 48, 53, 48, 32, 82, 95, 65, 82, 77, 95, 84,
-/* 0x38c0 */  72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108,
-/* 0x38d0 */  95,115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78,
-/* 0x38e0 */  90, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 65, 82, 77,
-/* 0x38f0 */  95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101,
-/* 0x3900 */  97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65,
-/* 0x3910 */  73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95, 65,
-/* 0x3920 */  82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,
-/* 0x3930 */ 114,101, 97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70,
-/* 0x3940 */  77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82,
-/* 0x3950 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3960 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3970 */ 101, 99, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76,
-/* 0x3980 */  76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,116, 97,114,116,
-/* 0x3990 */  95,111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48,
-/* 0x39a0 */  48, 49, 49, 50, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67,
-/* 0x39b0 */  65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,116, 97,
-/* 0x39c0 */ 114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x39d0 */  48, 48, 48, 49, 50, 97, 32, 82, 95, 65, 82, 77, 95, 84, 72, 77,
-/* 0x39e0 */  95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108, 95,115,
-/* 0x39f0 */ 116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x3a00 */  48, 48, 48, 48, 48, 49, 51, 52, 32, 82, 95, 65, 82, 77, 95, 84,
-/* 0x3a10 */  72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101, 97,108,
-/* 0x3a20 */  95,115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65, 73, 78,
-/* 0x3a30 */  90, 10, 48, 48, 48, 48, 48, 49, 51,101, 32, 82, 95, 65, 82, 77,
-/* 0x3a40 */  95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,114,101,
-/* 0x3a50 */  97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70, 77, 65,
-/* 0x3a60 */  73, 78, 90, 10, 48, 48, 48, 48, 48, 49, 52, 54, 32, 82, 95, 65,
-/* 0x3a70 */  82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76, 32, 32, 32, 32, 46,
-/* 0x3a80 */ 114,101, 97,108, 95,115,116, 97,114,116, 95,111,102, 69, 76, 70,
-/* 0x3a90 */  77, 65, 73, 78, 90, 10
+/* 0x1450 */ 109,  8,112, 71, 12,  0,  0,  0, 20,  0,  0,  0,206,  0,  0,  0,
+/* 0x1460 */   7,  1,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,160,  0,  0,  0,
+/* 0x1470 */   2,  0,  0,  0,  9,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1480 */   0,  0,  0,  0, 18,  0,  0,  0,212,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0, 27,  0,  0,  0,212,  0,  0,  0, 60,  1,  0,  0,
+/* 0x14a0 */   0,  0,  0,  0, 33,  0,  0,  0, 16,  2,  0,  0, 40,  1,  0,  0,
+/* 0x14b0 */   0,  0,  0,  0, 39,  0,  0,  0, 56,  3,  0,  0,236,  0,  0,  0,
+/* 0x14c0 */   0,  0,  0,  0, 45,  0,  0,  0, 36,  4,  0,  0,188,  0,  0,  0,
+/* 0x14d0 */   0,  0,  0,  0, 56,  0,  0,  0,224,  4,  0,  0, 56,  9,  0,  0,
+/* 0x14e0 */   0,  0,  0,  0, 67,  0,  0,  0, 24, 14,  0,  0,120,  4,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0, 78,  0,  0,  0,144, 18,  0,  0,  0,  0,  0,  0,
+/* 0x1500 */   0,  0,  0,  0, 89,  0,  0,  0,144, 18,  0,  0, 62,  0,  0,  0,
+/* 0x1510 */   0,  0,  0,  0, 98,  0,  0,  0,208, 18,  0,  0,132,  1,  0,  0,
+/* 0x1520 */   2,  0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,130,  0,  0,  0,
+/* 0x1530 */  27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1540 */   4,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1550 */   0,  0,  0,  0, 45,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1560 */  56,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1570 */   8,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1580 */   0,  0,  0,  0,112,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1590 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x15a0 */   1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x15b0 */   0,  0,  0,  0, 78,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15c0 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0,
+/* 0x15d0 */   0,  0,  0,  0,  0,  0,  0,  0,142,  0,  0,  0,  3,  0,  0,  0,
+/* 0x15e0 */   0,  0,  0,  0,165,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15f0 */ 188,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,211,  0,  0,  0,
+/* 0x1600 */   8,  0,  0,  0,  0,  0,  0,  0,222,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1610 */   0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,237,  0,  0,  0,
+/* 0x1620 */ 112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1630 */  76,  0,  0,  0,237,  0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */   0,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0,237,  0,  0,  0,
+/* 0x1650 */ 112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1660 */ 150,  0,  0,  0,237,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   0,  0,  0,  0,  0,  0,  0,  0,156,  0,  0,  0,237,  0,  0,  0,
+/* 0x1680 */ 112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1690 */  16,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */   0,  0,  0,  0,  3,  0,  0,  0,108,  0,  0,  0,252,  0,  0,  0,
+/* 0x16b0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x16c0 */ 112,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16d0 */   0,  0,  0,  0,  3,  0,  0,  0,120,  0,  0,  0,252,  0,  0,  0,
+/* 0x16e0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x16f0 */ 132,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1700 */   0,  0,  0,  0,  3,  0,  0,  0,144,  0,  0,  0,252,  0,  0,  0,
+/* 0x1710 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1720 */ 156,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1730 */   0,  0,  0,  0,  3,  0,  0,  0,160,  0,  0,  0,252,  0,  0,  0,
+/* 0x1740 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1750 */ 172,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1760 */   0,  0,  0,  0,  3,  0,  0,  0,188,  0,  0,  0,252,  0,  0,  0,
+/* 0x1770 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1780 */ 196,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1790 */   0,  0,  0,  0,  3,  0,  0,  0,200,  0,  0,  0,252,  0,  0,  0,
+/* 0x17a0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x17b0 */ 208,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */   0,  0,  0,  0,  3,  0,  0,  0,212,  0,  0,  0,252,  0,  0,  0,
+/* 0x17d0 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x17e0 */ 224,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17f0 */   0,  0,  0,  0,  3,  0,  0,  0,228,  0,  0,  0,252,  0,  0,  0,
+/* 0x1800 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1810 */ 236,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1820 */   0,  0,  0,  0,  3,  0,  0,  0,248,  0,  0,  0,252,  0,  0,  0,
+/* 0x1830 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1840 */ 252,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1850 */   0,  0,  0,  0,  3,  0,  0,  0,  4,  1,  0,  0,252,  0,  0,  0,
+/* 0x1860 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1870 */  12,  1,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1880 */   0,  0,  0,  0,  3,  0,  0,  0, 52,  1,  0,  0,252,  0,  0,  0,
+/* 0x1890 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x18a0 */  56,  1,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18b0 */   0,  0,  0,  0,  4,  0,  0,  0, 16,  0,  0,  0,252,  0,  0,  0,
+/* 0x18c0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x18d0 */ 108,  0,  0,  0,252,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18e0 */   0,  0,  0,  0,  4,  0,  0,  0,112,  0,  0,  0,252,  0,  0,  0,
+/* 0x18f0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1900 */ 120,  0,  0,  0,252,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */   0,  0,  0,  0,  4,  0,  0,  0,132,  0,  0,  0,252,  0,  0,  0,
+/* 0x1920 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1930 */ 144,  0,  0,  0,252,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */   0,  0,  0,  0,  4,  0,  0,  0,156,  0,  0,  0,252,  0,  0,  0,
+/* 0x1950 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1960 */ 160,  0,  0,  0,252,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */   0,  0,  0,  0,  4,  0,  0,  0,172,  0,  0,  0,252,  0,  0,  0,
+/* 0x1980 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1990 */ 188,  0,  0,  0,252,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   0,  0,  0,  0,  4,  0,  0,  0,196,  0,  0,  0,252,  0,  0,  0,
+/* 0x19b0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x19c0 */ 204,  0,  0,  0,252,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   0,  0,  0,  0,  4,  0,  0,  0,216,  0,  0,  0,252,  0,  0,  0,
+/* 0x19e0 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x19f0 */ 224,  0,  0,  0,252,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,  4,  0,  0,  0,236,  0,  0,  0,252,  0,  0,  0,
+/* 0x1a10 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1a20 */ 248,  0,  0,  0,252,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */   0,  0,  0,  0,  4,  0,  0,  0,252,  0,  0,  0,252,  0,  0,  0,
+/* 0x1a40 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1a50 */  32,  1,  0,  0,252,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */   0,  0,  0,  0,  4,  0,  0,  0, 36,  1,  0,  0,252,  0,  0,  0,
+/* 0x1a70 */  33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1a80 */  16,  0,  0,  0,252,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   0,  0,  0,  0,  5,  0,  0,  0,112,  0,  0,  0,252,  0,  0,  0,
+/* 0x1aa0 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1ab0 */ 120,  0,  0,  0,252,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  5,  0,  0,  0,124,  0,  0,  0,252,  0,  0,  0,
+/* 0x1ad0 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1ae0 */ 140,  0,  0,  0,252,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */   0,  0,  0,  0,  5,  0,  0,  0,144,  0,  0,  0,252,  0,  0,  0,
+/* 0x1b00 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1b10 */ 148,  0,  0,  0,252,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   0,  0,  0,  0,  5,  0,  0,  0,160,  0,  0,  0,252,  0,  0,  0,
+/* 0x1b30 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1b40 */ 176,  0,  0,  0,252,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */   0,  0,  0,  0,  5,  0,  0,  0,180,  0,  0,  0,252,  0,  0,  0,
+/* 0x1b60 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1b70 */ 188,  0,  0,  0,252,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0,  5,  0,  0,  0,196,  0,  0,  0,252,  0,  0,  0,
+/* 0x1b90 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1ba0 */ 200,  0,  0,  0,252,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0,  5,  0,  0,  0,228,  0,  0,  0,252,  0,  0,  0,
+/* 0x1bc0 */  39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1bd0 */ 232,  0,  0,  0,252,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   0,  0,  0,  0,  6,  0,  0,  0,  8,  0,  0,  0,252,  0,  0,  0,
+/* 0x1bf0 */  45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1c00 */  76,  0,  0,  0,252,  0,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0,  6,  0,  0,  0,128,  0,  0,  0,252,  0,  0,  0,
+/* 0x1c20 */  45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1c30 */ 184,  0,  0,  0,252,  0,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0,  7,  0,  0,  0,116,  0,  0,  0,252,  0,  0,  0,
+/* 0x1c50 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c60 */ 144,  0,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0,  7,  0,  0,  0,184,  0,  0,  0,252,  0,  0,  0,
+/* 0x1c80 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c90 */ 204,  0,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0,  7,  0,  0,  0,244,  0,  0,  0,252,  0,  0,  0,
+/* 0x1cb0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1cc0 */   0,  1,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  7,  0,  0,  0,  8,  1,  0,  0,252,  0,  0,  0,
+/* 0x1ce0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1cf0 */  68,  1,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,  7,  0,  0,  0,144,  1,  0,  0,252,  0,  0,  0,
+/* 0x1d10 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d20 */ 204,  1,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,  7,  0,  0,  0,216,  1,  0,  0,252,  0,  0,  0,
+/* 0x1d40 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d50 */   4,  2,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,  7,  0,  0,  0, 24,  2,  0,  0,252,  0,  0,  0,
+/* 0x1d70 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1d80 */  32,  2,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0,  7,  0,  0,  0, 52,  2,  0,  0,252,  0,  0,  0,
+/* 0x1da0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1db0 */  60,  2,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,  7,  0,  0,  0, 64,  2,  0,  0,252,  0,  0,  0,
+/* 0x1dd0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1de0 */  76,  2,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0,  7,  0,  0,  0, 88,  2,  0,  0,252,  0,  0,  0,
+/* 0x1e00 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e10 */ 164,  2,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,  7,  0,  0,  0,200,  2,  0,  0,252,  0,  0,  0,
+/* 0x1e30 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e40 */ 232,  2,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,  7,  0,  0,  0,  4,  3,  0,  0,252,  0,  0,  0,
+/* 0x1e60 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1e70 */  12,  3,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0,  7,  0,  0,  0, 60,  3,  0,  0,252,  0,  0,  0,
+/* 0x1e90 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ea0 */ 136,  3,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,  7,  0,  0,  0,160,  3,  0,  0,252,  0,  0,  0,
+/* 0x1ec0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ed0 */ 168,  3,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  7,  0,  0,  0,204,  3,  0,  0,252,  0,  0,  0,
+/* 0x1ef0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f00 */ 224,  3,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,  7,  0,  0,  0,232,  3,  0,  0,252,  0,  0,  0,
+/* 0x1f20 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f30 */  36,  4,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,  7,  0,  0,  0, 56,  4,  0,  0,252,  0,  0,  0,
+/* 0x1f50 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f60 */ 108,  4,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,  7,  0,  0,  0,132,  4,  0,  0,252,  0,  0,  0,
+/* 0x1f80 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f90 */ 140,  4,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  7,  0,  0,  0,176,  4,  0,  0,252,  0,  0,  0,
+/* 0x1fb0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1fc0 */ 212,  4,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,  7,  0,  0,  0,236,  4,  0,  0,252,  0,  0,  0,
+/* 0x1fe0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1ff0 */ 244,  4,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,  7,  0,  0,  0, 24,  5,  0,  0,252,  0,  0,  0,
+/* 0x2010 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2020 */  60,  5,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0,  7,  0,  0,  0,152,  5,  0,  0,252,  0,  0,  0,
+/* 0x2040 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2050 */ 160,  5,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,  7,  0,  0,  0,192,  5,  0,  0,252,  0,  0,  0,
+/* 0x2070 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2080 */ 228,  5,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,  7,  0,  0,  0,252,  5,  0,  0,252,  0,  0,  0,
+/* 0x20a0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20b0 */   4,  6,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  7,  0,  0,  0, 36,  6,  0,  0,252,  0,  0,  0,
+/* 0x20d0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x20e0 */  72,  6,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,  7,  0,  0,  0,128,  6,  0,  0,252,  0,  0,  0,
+/* 0x2100 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2110 */ 140,  6,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,  7,  0,  0,  0,208,  6,  0,  0,252,  0,  0,  0,
+/* 0x2130 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2140 */ 236,  6,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,  7,  0,  0,  0, 28,  7,  0,  0,252,  0,  0,  0,
+/* 0x2160 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2170 */  40,  7,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,  7,  0,  0,  0,108,  7,  0,  0,252,  0,  0,  0,
+/* 0x2190 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x21a0 */ 124,  7,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0,  7,  0,  0,  0,156,  7,  0,  0,252,  0,  0,  0,
+/* 0x21c0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x21d0 */ 184,  7,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,  7,  0,  0,  0,196,  7,  0,  0,252,  0,  0,  0,
+/* 0x21f0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2200 */ 208,  7,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,  7,  0,  0,  0,244,  7,  0,  0,252,  0,  0,  0,
+/* 0x2220 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2230 */  32,  8,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,  7,  0,  0,  0, 44,  8,  0,  0,252,  0,  0,  0,
+/* 0x2250 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2260 */ 124,  8,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,  7,  0,  0,  0,136,  8,  0,  0,252,  0,  0,  0,
+/* 0x2280 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2290 */ 160,  8,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0,  7,  0,  0,  0,232,  8,  0,  0,252,  0,  0,  0,
+/* 0x22b0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x22c0 */ 244,  8,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0,  7,  0,  0,  0,252,  8,  0,  0,252,  0,  0,  0,
+/* 0x22e0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x22f0 */   4,  9,  0,  0,252,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2300 */   0,  0,  0,  0,  7,  0,  0,  0, 40,  9,  0,  0,252,  0,  0,  0,
+/* 0x2310 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2320 */ 120,  0,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,  8,  0,  0,  0,128,  0,  0,  0,252,  0,  0,  0,
+/* 0x2340 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2350 */ 136,  0,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2360 */   0,  0,  0,  0,  8,  0,  0,  0,168,  0,  0,  0,252,  0,  0,  0,
+/* 0x2370 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2380 */ 172,  0,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2390 */   0,  0,  0,  0,  8,  0,  0,  0,228,  0,  0,  0,252,  0,  0,  0,
+/* 0x23a0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23b0 */   0,  1,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0,  8,  0,  0,  0, 12,  1,  0,  0,252,  0,  0,  0,
+/* 0x23d0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x23e0 */  20,  1,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,  8,  0,  0,  0, 24,  1,  0,  0,252,  0,  0,  0,
+/* 0x2400 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2410 */  32,  1,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,  8,  0,  0,  0, 40,  1,  0,  0,252,  0,  0,  0,
+/* 0x2430 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2440 */  68,  1,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,  8,  0,  0,  0, 76,  1,  0,  0,252,  0,  0,  0,
+/* 0x2460 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2470 */  80,  1,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,  8,  0,  0,  0,128,  1,  0,  0,252,  0,  0,  0,
+/* 0x2490 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24a0 */ 136,  1,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0,  8,  0,  0,  0,140,  1,  0,  0,252,  0,  0,  0,
+/* 0x24c0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x24d0 */ 156,  1,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,  8,  0,  0,  0,160,  1,  0,  0,252,  0,  0,  0,
+/* 0x24f0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2500 */ 192,  1,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2510 */   0,  0,  0,  0,  8,  0,  0,  0,204,  1,  0,  0,252,  0,  0,  0,
+/* 0x2520 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2530 */ 212,  1,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2540 */   0,  0,  0,  0,  8,  0,  0,  0,220,  1,  0,  0,252,  0,  0,  0,
+/* 0x2550 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2560 */ 228,  1,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2570 */   0,  0,  0,  0,  8,  0,  0,  0,236,  1,  0,  0,252,  0,  0,  0,
+/* 0x2580 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2590 */  40,  2,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,  8,  0,  0,  0, 44,  2,  0,  0,252,  0,  0,  0,
+/* 0x25b0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25c0 */  68,  2,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,  8,  0,  0,  0, 76,  2,  0,  0,252,  0,  0,  0,
+/* 0x25e0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x25f0 */  80,  2,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2600 */   0,  0,  0,  0,  8,  0,  0,  0,104,  2,  0,  0,252,  0,  0,  0,
+/* 0x2610 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2620 */ 132,  2,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,  8,  0,  0,  0,140,  2,  0,  0,252,  0,  0,  0,
+/* 0x2640 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2650 */ 164,  2,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,  8,  0,  0,  0,200,  2,  0,  0,252,  0,  0,  0,
+/* 0x2670 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2680 */ 208,  2,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,  8,  0,  0,  0,220,  2,  0,  0,252,  0,  0,  0,
+/* 0x26a0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x26b0 */ 244,  2,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0,  8,  0,  0,  0, 12,  3,  0,  0,252,  0,  0,  0,
+/* 0x26d0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x26e0 */  20,  3,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0,  8,  0,  0,  0, 44,  3,  0,  0,252,  0,  0,  0,
+/* 0x2700 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2710 */  80,  3,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2720 */   0,  0,  0,  0,  8,  0,  0,  0, 88,  3,  0,  0,252,  0,  0,  0,
+/* 0x2730 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2740 */ 112,  3,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2750 */   0,  0,  0,  0,  8,  0,  0,  0,120,  3,  0,  0,252,  0,  0,  0,
+/* 0x2760 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2770 */ 156,  3,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2780 */   0,  0,  0,  0,  8,  0,  0,  0,176,  3,  0,  0,252,  0,  0,  0,
+/* 0x2790 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x27a0 */ 184,  3,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0,  8,  0,  0,  0,200,  3,  0,  0,252,  0,  0,  0,
+/* 0x27c0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x27d0 */ 204,  3,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0,  8,  0,  0,  0,  0,  4,  0,  0,252,  0,  0,  0,
+/* 0x27f0 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2800 */  24,  4,  0,  0,252,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2810 */   0,  0,  0,  0,  8,  0,  0,  0, 64,  4,  0,  0,252,  0,  0,  0,
+/* 0x2820 */  67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2830 */  32,  0,  0,  0,237,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2840 */   0,  0,  0,  0, 11,  0,  0,  0, 40,  0,  0,  0,237,  0,  0,  0,
+/* 0x2850 */ 112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2860 */  48,  0,  0,  0,237,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2870 */   0,  0,  0,  0, 11,  0,  0,  0, 80,  0,  0,  0,237,  0,  0,  0,
+/* 0x2880 */ 112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2890 */ 124,  0,  0,  0,237,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0, 11,  0,  0,  0,156,  0,  0,  0,237,  0,  0,  0,
+/* 0x28b0 */ 112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x28c0 */ 204,  0,  0,  0,252,  0,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0, 11,  0,  0,  0,236,  0,  0,  0,237,  0,  0,  0,
+/* 0x28e0 */ 112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x28f0 */  18,  1,  0,  0,237,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2900 */   0,  0,  0,  0, 11,  0,  0,  0, 42,  1,  0,  0,237,  0,  0,  0,
+/* 0x2910 */ 112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2920 */  52,  1,  0,  0,237,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2930 */   0,  0,  0,  0, 11,  0,  0,  0, 62,  1,  0,  0,237,  0,  0,  0,
+/* 0x2940 */ 112,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2950 */  70,  1,  0,  0,237,  0,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2960 */   0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86,
+/* 0x2970 */  95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 78,
+/* 0x2980 */  82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,
+/* 0x2990 */   0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65,
+/* 0x29a0 */  95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49,
+/* 0x29b0 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 69, 76, 70,
+/* 0x29c0 */  77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 76,
+/* 0x29d0 */  54, 49, 48,  0, 46,114,101, 97,108, 95,115,116, 97,114,116, 95,
+/* 0x29e0 */ 111,102, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,
+/* 0x29f0 */ 116,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,
+/* 0x2a00 */ 109,112,114,101,115,115, 95, 56,  0,117, 99,108, 95,110,114,118,
+/* 0x2a10 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,
+/* 0x2a20 */ 117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,
+/* 0x2a30 */ 114,101,115,115, 95, 56,  0, 76,122,109, 97, 68,101, 99,111,100,
+/* 0x2a40 */ 101,  0,101,110,100, 95,100,101, 99,111,109,112,114,101,115,115,
+/* 0x2a50 */   0, 82, 95, 65, 82, 77, 95, 84, 72, 77, 95, 67, 65, 76, 76,  0,
+/* 0x2a60 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52,  0, 84, 20,  0,  0, 85,
+/* 0x2a70 */  80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm64-darwin.macho-entry.h
-   created from arm64-darwin.macho-entry.bin, 7365 (0x1cc5) bytes
+   created from arm64-darwin.macho-entry.bin, 6123 (0x17eb) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_DARWIN_MACHO_ENTRY_SIZE    7365
-#define STUB_ARM64_DARWIN_MACHO_ENTRY_ADLER32 0x31b06f6b
-#define STUB_ARM64_DARWIN_MACHO_ENTRY_CRC32   0x0f5ec97d
+#define STUB_ARM64_DARWIN_MACHO_ENTRY_SIZE    6123
+#define STUB_ARM64_DARWIN_MACHO_ENTRY_ADLER32 0x90011f01
+#define STUB_ARM64_DARWIN_MACHO_ENTRY_CRC32   0xffdb4393
 
-unsigned char stub_arm64_darwin_macho_entry[7365] = {
+unsigned char stub_arm64_darwin_macho_entry[6123] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,248, 23,  0,  0,  0,  0,  0,  0,
@@ -369,132 +369,54 @@ unsigned char stub_arm64_darwin_macho_entry[7365] = {
 /* 0x14a0 */  99,255,255, 53,  1,  0,128,210,168,  0,128, 82,  1,  0,  0,212,
 /* 0x14b0 */ 224, 15, 29,248,  1,  0,  0, 16,246,  3,  1,170, 32, 68, 64,184,
 /* 0x14c0 */ 214, 66, 32,203,246, 19,  0,249,244,  3,  1,170, 32, 68, 64,184,
-/* 0x14d0 */ 148, 66, 32,203, 21, 32,  0,209,173,255,255,151,102,105,108,101,
-/* 0x14e0 */  32,102,111,114,109, 97,116, 32,101,108,102, 54, 52, 45,108,105,
-/* 0x14f0 */ 116,116,108,101, 97, 97,114, 99,104, 54, 52, 10, 10, 83,101, 99,
-/* 0x1500 */ 116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32,
-/* 0x1510 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32,
-/* 0x1520 */  32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1530 */  32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1540 */  32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32,
-/* 0x1550 */  32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48,
-/* 0x1560 */  32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 48,
-/* 0x1570 */  56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42,
-/* 0x1580 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49,
-/* 0x1590 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48,
-/* 0x15a0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 56, 32, 32, 50, 42, 42,
-/* 0x15b0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32,
-/* 0x15c0 */  78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x15d0 */  55, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 56, 32, 32, 50,
-/* 0x15e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x15f0 */  51, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1600 */  48, 49, 55, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 99, 52,
-/* 0x1610 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1620 */  10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32,
-/* 0x1630 */  32, 32, 32, 48, 49, 52, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1640 */  51, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1650 */  78, 84, 83, 10, 32, 32, 53, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x1660 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1670 */  52, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1680 */  78, 84, 83, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1690 */  48, 48, 32, 32, 32, 32, 48, 49, 48, 99, 32, 32, 48, 32, 32, 48,
-/* 0x16a0 */  32, 32, 48, 52, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x16b0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95,
-/* 0x16c0 */  68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 57, 54, 56, 32, 32, 48,
-/* 0x16d0 */  32, 32, 48, 32, 32, 48, 53, 56, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x16e0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 76, 90,
-/* 0x16f0 */  77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 52, 97, 48,
-/* 0x1700 */  32, 32, 48, 32, 32, 48, 32, 32, 48,101,101, 99, 32, 32, 50, 42,
-/* 0x1710 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57,
-/* 0x1720 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48,
-/* 0x1730 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 56, 99, 32, 32, 50,
-/* 0x1740 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x1750 */  48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32,
-/* 0x1760 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 56, 99, 32, 32,
-/* 0x1770 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1780 */  49, 49, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90, 32, 32, 32, 32,
-/* 0x1790 */  32, 48, 49, 53, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51,
-/* 0x17a0 */  56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x17b0 */  84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58,
-/* 0x17c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x17e0 */  69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x17f0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1800 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77,
-/* 0x1810 */  65, 73, 78, 90, 32, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90,
-/* 0x1820 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1830 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77, 65,
-/* 0x1840 */  73, 78, 88, 32, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 88, 10,
-/* 0x1850 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1860 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x1870 */  68, 32, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x1880 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1890 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82,
-/* 0x18a0 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18b0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x18c0 */  50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x18d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x18e0 */  32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50,
-/* 0x18f0 */  66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1900 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84,
-/* 0x1910 */  65, 73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48,
-/* 0x1920 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1930 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1940 */  48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10,
-/* 0x1950 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1960 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1970 */  67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x1980 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1990 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x19a0 */  69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x19b0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19c0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72, 77,
-/* 0x19d0 */  65, 73, 78, 89, 32, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78, 89,
-/* 0x19e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19f0 */  48, 32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65,
-/* 0x1a00 */  73, 78, 88, 32, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48,
-/* 0x1a10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x1a20 */  32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 69, 32, 48, 49, 55, 99,
-/* 0x1a30 */  32,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,
-/* 0x1a40 */ 112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1a60 */  70, 32, 78, 82, 86, 50, 68, 32, 48, 49, 55, 48, 32,117, 99,108,
-/* 0x1a70 */  95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x1a80 */ 115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a90 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82,
-/* 0x1aa0 */  86, 50, 66, 32, 48, 49, 52, 52, 32,117, 99,108, 95,110,114,118,
-/* 0x1ab0 */  50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,
-/* 0x1ac0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ad0 */  48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1ae0 */  69, 67, 49, 48, 32, 48, 32, 76,122,109, 97, 68,101, 99,111,100,
-/* 0x1af0 */ 101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b00 */  48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77,
-/* 0x1b10 */  65, 73, 78, 89, 32, 48, 32,101,110,100, 95,100,101, 99,111,109,
-/* 0x1b20 */ 112,114,101,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1b30 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 77,
-/* 0x1b40 */  65, 67, 72, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x1b50 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x1b60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x1b70 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */  48, 48, 48, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67,
-/* 0x1b90 */  65, 76, 76, 50, 54, 32, 32, 77, 65, 67, 72, 77, 65, 73, 78, 90,
-/* 0x1ba0 */  43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bb0 */  48,100, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x1bc0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77,
-/* 0x1bd0 */  65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1be0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1bf0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1c00 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c10 */  48, 48, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 79,
-/* 0x1c20 */  78, 68, 66, 82, 49, 57, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1c30 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x1c40 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 77, 65, 67, 72,
-/* 0x1c50 */  77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x1c60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x1c70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x1c80 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 50,
-/* 0x1c90 */  56, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 65, 68, 82, 95,
-/* 0x1ca0 */  80, 82, 69, 76, 95, 76, 79, 50, 49, 32, 32, 95,115,116, 97,114,
-/* 0x1cb0 */ 116, 45, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 56, 10
+/* 0x14d0 */ 148, 66, 32,203, 21, 32,  0,209,173,255,255,151, 12,  0,  0,  0,
+/* 0x14e0 */  18,  0,  0,  0,  3,  0,  0,  0, 19,  1,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */  64,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1500 */  72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,
+/* 0x1510 */  72,  0,  0,  0,124,  1,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,
+/* 0x1520 */ 196,  1,  0,  0,112,  1,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,
+/* 0x1530 */  52,  3,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,
+/* 0x1540 */ 120,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,
+/* 0x1550 */ 120,  4,  0,  0, 12,  1,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,
+/* 0x1560 */ 132,  5,  0,  0,104,  9,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1570 */ 236, 14,  0,  0,160,  4,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0,
+/* 0x1580 */ 140, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x1590 */ 140, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0,
+/* 0x15a0 */ 140, 19,  0,  0, 80,  1,  0,  0,  0,  0,  0,  0, 79,  0,  0,  0,
+/* 0x15b0 */   9,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 11,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15d0 */  10,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,
+/* 0x15e0 */   2,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  3,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0, 31,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1600 */  37,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,
+/* 0x1610 */   6,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1620 */   0,  0,  0,  0, 68,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1630 */  90,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,110,  0,  0,  0,
+/* 0x1640 */   0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1650 */   0,  0,  0,  0,141,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1660 */ 165,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0,
+/* 0x1670 */   8,  0,  0,  0,  0,  0,  0,  0,200,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1680 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,215,  0,  0,  0,
+/* 0x1690 */ 100,  0,  0,  0,220,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x16a0 */   4,  0,  0,  0,232,  0,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16b0 */   0,  0,  0,  0, 11,  0,  0,  0, 40,  1,  0,  0,251,  0,  0,  0,
+/* 0x16c0 */ 110,  0,  0,  0,248,255,255,255,255,255,255,255, 77, 65, 67, 72,
+/* 0x16d0 */  77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78,
+/* 0x16e0 */  82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,
+/* 0x16f0 */   0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 76, 90, 77, 65, 95, 69,
+/* 0x1700 */  76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0,
+/* 0x1710 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95,
+/* 0x1720 */  68, 69, 67, 51, 48,  0, 77, 65, 67, 72, 77, 65, 73, 78, 89,  0,
+/* 0x1730 */  77, 65, 67, 72, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,
+/* 0x1740 */   0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,
+/* 0x1750 */ 112,114,101,115,115, 95, 51, 50,  0,117, 99,108, 95,110,114,118,
+/* 0x1760 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,
+/* 0x1770 */   0,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,
+/* 0x1780 */ 112,114,101,115,115, 95, 51, 50,  0, 76,122,109, 97, 68,101, 99,
+/* 0x1790 */ 111,100,101,  0,101,110,100, 95,100,101, 99,111,109,112,114,101,
+/* 0x17a0 */ 115,115,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76,
+/* 0x17b0 */  76, 50, 54,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 79,
+/* 0x17c0 */  78, 68, 66, 82, 49, 57,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52,
+/* 0x17d0 */  95, 65, 68, 82, 95, 80, 82, 69, 76, 95, 76, 79, 50, 49,  0,220,
+/* 0x17e0 */  20,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm64-linux.elf-entry.h
-   created from arm64-linux.elf-entry.bin, 7489 (0x1d41) bytes
+   created from arm64-linux.elf-entry.bin, 6213 (0x1845) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_LINUX_ELF_ENTRY_SIZE    7489
-#define STUB_ARM64_LINUX_ELF_ENTRY_ADLER32 0x86268564
-#define STUB_ARM64_LINUX_ELF_ENTRY_CRC32   0x10255b7a
+#define STUB_ARM64_LINUX_ELF_ENTRY_SIZE    6213
+#define STUB_ARM64_LINUX_ELF_ENTRY_ADLER32 0x443226b4
+#define STUB_ARM64_LINUX_ELF_ENTRY_CRC32   0xb79988a7
 
-unsigned char stub_arm64_linux_elf_entry[7489] = {
+unsigned char stub_arm64_linux_elf_entry[6213] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,112, 24,  0,  0,  0,  0,  0,  0,
@@ -372,137 +372,57 @@ unsigned char stub_arm64_linux_elf_entry[7489] = {
 /* 0x14d0 */ 161,255,255, 53, 34,  0,160,210,250,  3,  2,203, 96, 12,128, 18,
 /* 0x14e0 */ 161,252,255, 16,  2,  0,128, 82,  8,  7,128, 82,  1,  0,  0,212,
 /* 0x14f0 */ 251,  3,  0, 42, 31,  0,  0,113,203,252,255, 84,185,255,255,151,
-/* 0x1500 */   0,  0,  0,  0,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1510 */ 101,108,102, 54, 52, 45,108,105,116,116,108,101, 97, 97,114, 99,
-/* 0x1520 */ 104, 54, 52, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,
-/* 0x1530 */ 100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1540 */  32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32,
-/* 0x1550 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x1560 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,
-/* 0x1570 */ 105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,
-/* 0x1580 */ 108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1590 */  88, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x15a0 */  32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x15b0 */  69, 78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x15c0 */  68, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x15d0 */  48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x15e0 */  78, 84, 83, 10, 32, 32, 50, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x15f0 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1600 */  52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1610 */  84, 83, 10, 32, 32, 51, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32,
-/* 0x1620 */  32, 32, 32, 32, 32, 48, 49, 55, 99, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1630 */  32, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1640 */  69, 78, 84, 83, 10, 32, 32, 52, 32, 78, 82, 86, 50, 68, 32, 32,
-/* 0x1650 */  32, 32, 32, 32, 32, 32, 32, 48, 49, 55, 48, 32, 32, 48, 32, 32,
-/* 0x1660 */  48, 32, 32, 48, 49, 99, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1670 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 78, 82, 86, 50,
-/* 0x1680 */  66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 52, 52, 32, 32,
-/* 0x1690 */  48, 32, 32, 48, 32, 32, 48, 51, 51, 52, 32, 32, 50, 42, 42, 48,
-/* 0x16a0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 76,
-/* 0x16b0 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 49, 48,
-/* 0x16c0 */  99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 55, 56, 32, 32, 50,
-/* 0x16d0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x16e0 */  55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32,
-/* 0x16f0 */  48, 57, 54, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 56, 52,
-/* 0x1700 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1710 */  10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32,
-/* 0x1720 */  32, 32, 32, 48, 52, 97, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1730 */ 101,101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1740 */  78, 84, 83, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1750 */  51, 48, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1760 */  49, 51, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1770 */  69, 78, 84, 83, 10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1780 */  89, 32, 32, 32, 32, 32, 32, 48, 51,101, 32, 32, 48, 32, 32, 48,
-/* 0x1790 */  32, 32, 48, 49, 51, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x17a0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 69, 76, 70, 77,
-/* 0x17b0 */  65, 73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 49, 51, 56, 32, 32,
-/* 0x17c0 */  48, 32, 32, 48, 32, 32, 48, 49, 51, 99, 99, 32, 32, 50, 42, 42,
-/* 0x17d0 */  50, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66,
-/* 0x17e0 */  79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48,
-/* 0x17f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1800 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32,
-/* 0x1810 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x1820 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1830 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 69,
-/* 0x1840 */  76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1850 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1860 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 69, 76, 70, 77,
-/* 0x1870 */  65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1880 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1890 */  86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x18a0 */  68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x18b0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84,
-/* 0x18c0 */  65, 73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48,
-/* 0x18d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x18e0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32,
-/* 0x18f0 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1900 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x1910 */  82, 86, 50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1920 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1930 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82,
-/* 0x1940 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1950 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x1960 */  65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69,
-/* 0x1970 */  76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1980 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1990 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x19a0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x19c0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65,
-/* 0x19d0 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x19e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x19f0 */  69, 76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65,
-/* 0x1a00 */  73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a10 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x1a20 */  68, 42, 32, 48, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1a30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32,103, 32, 32, 32, 32,
-/* 0x1a40 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 95,115,
-/* 0x1a50 */ 116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a60 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82,
-/* 0x1a70 */  86, 50, 69, 32, 48, 49, 55, 99, 32,117, 99,108, 95,110,114,118,
-/* 0x1a80 */  50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,
-/* 0x1a90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1aa0 */  48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 68, 32,
-/* 0x1ab0 */  48, 49, 55, 48, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,
-/* 0x1ac0 */ 101, 99,111,109,112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x1ae0 */  32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 66, 32, 48, 49, 52, 52,
-/* 0x1af0 */  32,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,
-/* 0x1b00 */ 112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1b20 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,
-/* 0x1b30 */ 122,109, 97, 68,101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1b40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x1b50 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 48, 32,101,110,
-/* 0x1b60 */ 100, 95,100,101, 99,111,109,112,114,101,115,115, 10, 48, 48, 48,
-/* 0x1b70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x1b80 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 79, 95,
-/* 0x1b90 */  66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1ba0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x1bb0 */  76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1bc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1bd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1be0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 65, 66,
-/* 0x1c00 */  83, 51, 50, 32, 32, 32, 77, 70, 76, 71, 10, 48, 48, 48, 48, 48,
-/* 0x1c10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 65,
-/* 0x1c20 */  82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32, 69, 76,
-/* 0x1c30 */  70, 77, 65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c40 */  48, 48, 48, 48, 48, 48, 48,101, 52, 10, 10, 82, 69, 76, 79, 67,
-/* 0x1c50 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1c60 */  82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10,
-/* 0x1c70 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c80 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c90 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 65, 65, 82, 67,
-/* 0x1cb0 */  72, 54, 52, 95, 67, 79, 78, 68, 66, 82, 49, 57, 32, 32, 76, 90,
-/* 0x1cc0 */  77, 65, 95, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x1cd0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x1ce0 */  32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70,
-/* 0x1cf0 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x1d00 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d10 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 48, 48, 49, 51, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52,
-/* 0x1d30 */  95, 65, 66, 83, 51, 50, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79,
-/* 0x1d40 */  10
+/* 0x1500 */   0,  0,  0,  0, 12,  0,  0,  0, 20,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1510 */  21,  1,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1520 */   0,  0,  0,  0,  9,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1530 */   0,  0,  0,  0, 18,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1540 */   0,  0,  0,  0, 27,  0,  0,  0, 72,  0,  0,  0,124,  1,  0,  0,
+/* 0x1550 */   0,  0,  0,  0, 33,  0,  0,  0,196,  1,  0,  0,112,  1,  0,  0,
+/* 0x1560 */   0,  0,  0,  0, 39,  0,  0,  0, 52,  3,  0,  0, 68,  1,  0,  0,
+/* 0x1570 */   0,  0,  0,  0, 45,  0,  0,  0,120,  4,  0,  0, 12,  1,  0,  0,
+/* 0x1580 */   0,  0,  0,  0, 56,  0,  0,  0,132,  5,  0,  0,104,  9,  0,  0,
+/* 0x1590 */   0,  0,  0,  0, 67,  0,  0,  0,236, 14,  0,  0,160,  4,  0,  0,
+/* 0x15a0 */   0,  0,  0,  0, 78,  0,  0,  0,140, 19,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */   0,  0,  0,  0, 89,  0,  0,  0,140, 19,  0,  0, 62,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0, 98,  0,  0,  0,204, 19,  0,  0, 56,  1,  0,  0,
+/* 0x15d0 */   2,  0,  0,  0, 78,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */  98,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1600 */   0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */  27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1620 */   4,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1630 */   0,  0,  0,  0, 45,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */  56,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1650 */   8,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1660 */   0,  0,  0,  0,107,  0,  0,  0, 13,  0,  0,  0,173,222,173,222,
+/* 0x1670 */ 112,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,119,  0,  0,  0,
+/* 0x1680 */   3,  0,  0,  0,  0,  0,  0,  0,143,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1690 */   0,  0,  0,  0,167,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */ 191,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,202,  0,  0,  0,
+/* 0x16b0 */  10,  0,  0,  0,  0,  0,  0,  0,217,  0,  0,  0, 13,  0,  0,  0,
+/* 0x16c0 */ 173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0,
+/* 0x16d0 */ 107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16e0 */   4,  0,  0,  0,241,  0,  0,  0, 98,  0,  0,  0,228,  0,  0,  0,
+/* 0x16f0 */   0,  0,  0,  0,  6,  0,  0,  0,  4,  0,  0,  0,  2,  1,  0,  0,
+/* 0x1700 */  78,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1710 */  52,  1,  0,  0,225,  0,  0,  0,217,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1720 */   0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86,
+/* 0x1730 */  95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 78,
+/* 0x1740 */  82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,
+/* 0x1750 */   0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65,
+/* 0x1760 */  95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49,
+/* 0x1770 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 69, 76, 70,
+/* 0x1780 */  77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 77,
+/* 0x1790 */  70, 76, 71,  0, 95,115,116, 97,114,116,  0,117, 99,108, 95,110,
+/* 0x17a0 */ 114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95,
+/* 0x17b0 */  51, 50,  0,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,
+/* 0x17c0 */ 111,109,112,114,101,115,115, 95, 51, 50,  0,117, 99,108, 95,110,
+/* 0x17d0 */ 114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95,
+/* 0x17e0 */  51, 50,  0, 76,122,109, 97, 68,101, 99,111,100,101,  0,101,110,
+/* 0x17f0 */ 100, 95,100,101, 99,111,109,112,114,101,115,115,  0, 79, 95, 66,
+/* 0x1800 */  73, 78, 70, 79,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 65,
+/* 0x1810 */  66, 83, 51, 50,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67,
+/* 0x1820 */  65, 76, 76, 50, 54,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95,
+/* 0x1830 */  67, 79, 78, 68, 66, 82, 49, 57,  0,  4, 21,  0,  0, 85, 80, 88,
+/* 0x1840 */  76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm64-linux.elf-so_entry.h
-   created from arm64-linux.elf-so_entry.bin, 1891 (0x763) bytes
+   created from arm64-linux.elf-so_entry.bin, 1510 (0x5e6) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_LINUX_ELF_SO_ENTRY_SIZE    1891
-#define STUB_ARM64_LINUX_ELF_SO_ENTRY_ADLER32 0x75cc7776
-#define STUB_ARM64_LINUX_ELF_SO_ENTRY_CRC32   0x9c79c3e7
+#define STUB_ARM64_LINUX_ELF_SO_ENTRY_SIZE    1510
+#define STUB_ARM64_LINUX_ELF_SO_ENTRY_ADLER32 0x60f50dff
+#define STUB_ARM64_LINUX_ELF_SO_ENTRY_CRC32   0x2c2ba897
 
-unsigned char stub_arm64_linux_elf_so_entry[1891] = {
+unsigned char stub_arm64_linux_elf_so_entry[1510] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0, 48,  3,  0,  0,  0,  0,  0,  0,
@@ -115,44 +115,20 @@ unsigned char stub_arm64_linux_elf_so_entry[1891] = {
 /* 0x04c0 */   0,  0,  0,  0,  0,  0,  0,  0,224,  2,  0,  0,  0,  0,  0,  0,
 /* 0x04d0 */  32,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x04e0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x04f0 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 54,
-/* 0x0500 */  52, 45,108,105,116,116,108,101, 97, 97,114, 99,104, 54, 52, 10,
-/* 0x0510 */  10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78,
-/* 0x0520 */  97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,
-/* 0x0530 */ 101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32,
-/* 0x0540 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x0550 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,
-/* 0x0560 */ 111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115,
-/* 0x0570 */  10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32,
-/* 0x0580 */  32, 32, 32, 48, 49,101, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x0590 */  52, 48, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x05a0 */  84, 83, 10, 32, 32, 49, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32,
-/* 0x05b0 */  32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x05c0 */  50, 50, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x05d0 */  78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69,
-/* 0x05e0 */  58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x05f0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65,
-/* 0x0600 */  73, 78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48,
-/* 0x0610 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x0620 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x0630 */  32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48,
-/* 0x0640 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x0650 */  32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32,
-/* 0x0660 */  95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0670 */  48, 48, 48, 48, 48, 97, 56, 32,103, 32, 32, 32, 32, 32, 70, 32,
-/* 0x0680 */  69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 49, 52, 52, 32,117, 99,
-/* 0x0690 */ 108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,
-/* 0x06a0 */ 115,115, 95, 51, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x06b0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x06c0 */  76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x06d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x06e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x06f0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0700 */  48, 49, 48, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65,
-/* 0x0710 */  76, 76, 50, 54, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48,
-/* 0x0720 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 56, 32,
-/* 0x0730 */  82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 65, 68, 82, 95, 80, 82,
-/* 0x0740 */  69, 76, 95, 76, 79, 50, 49, 32, 32, 95,115,116, 97,114,116, 45,
-/* 0x0750 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0760 */  49, 48, 10
+/* 0x04f0 */   2,  0,  0,  0,  4,  0,  0,  0,  2,  0,  0,  0, 90,  0,  0,  0,
+/* 0x0500 */   0,  0,  0,  0, 64,  0,  0,  0,236,  1,  0,  0,  2,  0,  0,  0,
+/* 0x0510 */   9,  0,  0,  0, 44,  2,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0520 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0530 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0540 */   0,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,168,  0,  0,  0,
+/* 0x0550 */   0,  0,  0,  0, 16,  0,  0,  0, 49,  0,  0,  0,  9,  0,  0,  0,
+/* 0x0560 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,152,  0,  0,  0,
+/* 0x0570 */  66,  0,  0,  0, 18,  0,  0,  0,240,255,255,255,255,255,255,255,
+/* 0x0580 */  69, 76, 70, 77, 65, 73, 78, 88,  0, 69, 76, 70, 77, 65, 73, 78,
+/* 0x0590 */  90,  0, 95,115,116, 97,114,116,  0,117, 99,108, 95,110,114,118,
+/* 0x05a0 */  50, 98, 95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,
+/* 0x05b0 */   0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50,
+/* 0x05c0 */  54,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 65, 68, 82, 95,
+/* 0x05d0 */  80, 82, 69, 76, 95, 76, 79, 50, 49,  0,240,  4,  0,  0, 85, 80,
+/* 0x05e0 */  88, 76, 78, 75, 48, 49
 };
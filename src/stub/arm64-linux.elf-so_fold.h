@@ -1,5 +1,5 @@
 /* arm64-linux.elf-so_fold.h
-   created from arm64-linux.elf-so_fold.bin, 16222 (0x3f5e) bytes
+   created from arm64-linux.elf-so_fold.bin, 13646 (0x354e) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_LINUX_ELF_SO_FOLD_SIZE    16222
-#define STUB_ARM64_LINUX_ELF_SO_FOLD_ADLER32 0x40c42ac9
-#define STUB_ARM64_LINUX_ELF_SO_FOLD_CRC32   0x320d0c0c
+#define STUB_ARM64_LINUX_ELF_SO_FOLD_SIZE    13646
+#define STUB_ARM64_LINUX_ELF_SO_FOLD_ADLER32 0xaf1edafe
+#define STUB_ARM64_LINUX_ELF_SO_FOLD_CRC32   0x09aa4a0c
 
-unsigned char stub_arm64_linux_elf_so_fold[16222] = {
+unsigned char stub_arm64_linux_elf_so_fold[13646] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,176, 39,  0,  0,  0,  0,  0,  0,
@@ -755,299 +755,138 @@ unsigned char stub_arm64_linux_elf_so_fold[16222] = {
 /* 0x2cc0 */   0,  0,  0,  0,  0,  0,  0,  0,208, 34,  0,  0,  0,  0,  0,  0,
 /* 0x2cd0 */  50,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x2ce0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x2cf0 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 54,
-/* 0x2d00 */  52, 45,108,105,116,116,108,101, 97, 97,114, 99,104, 54, 52, 10,
-/* 0x2d10 */  10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78,
-/* 0x2d20 */  97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,
-/* 0x2d30 */ 101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32,
-/* 0x2d40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x2d50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,
-/* 0x2d60 */ 111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115,
-/* 0x2d70 */  10, 32, 32, 48, 32, 83, 79, 95, 77, 65, 73, 78, 32, 32, 32, 32,
-/* 0x2d80 */  32, 32, 32, 48, 55, 97, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2d90 */  52, 48, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2da0 */  84, 83, 10, 32, 32, 49, 32, 83, 79, 95, 72, 69, 65, 68, 32, 32,
-/* 0x2db0 */  32, 32, 32, 32, 32, 48, 52, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2dc0 */  48, 55,101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2dd0 */  69, 78, 84, 83, 10, 32, 32, 50, 32,112,116,114, 95, 78, 69, 88,
-/* 0x2de0 */  84, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2df0 */  32, 48, 56, 51, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2e00 */  84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 83, 79, 95, 84, 65, 73,
-/* 0x2e10 */  76, 32, 32, 32, 32, 32, 32, 32, 48, 49, 54, 99, 32, 32, 48, 32,
-/* 0x2e20 */  32, 48, 32, 32, 48, 56, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2e30 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 69, 88, 80,
-/* 0x2e40 */  95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 49, 48, 52, 32,
-/* 0x2e50 */  32, 48, 32, 32, 48, 32, 32, 48, 57, 97, 52, 32, 32, 50, 42, 42,
-/* 0x2e60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32,
-/* 0x2e70 */  69, 88, 80, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x2e80 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 97, 97, 56, 32, 32, 50,
-/* 0x2e90 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x2ea0 */  54, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2eb0 */  48, 49, 55, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 97, 99, 56,
-/* 0x2ec0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2ed0 */  10, 32, 32, 55, 32, 78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32,
-/* 0x2ee0 */  32, 32, 32, 48, 49, 55, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2ef0 */  99, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2f00 */  78, 84, 83, 10, 32, 32, 56, 32, 78, 82, 86, 50, 66, 32, 32, 32,
-/* 0x2f10 */  32, 32, 32, 32, 32, 32, 48, 49, 52, 52, 32, 32, 48, 32, 32, 48,
-/* 0x2f20 */  32, 32, 48,100, 98, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2f30 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95,
-/* 0x2f40 */  69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 49, 48, 99, 32, 32, 48,
-/* 0x2f50 */  32, 32, 48, 32, 32, 48,101,102, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2f60 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 76, 90,
-/* 0x2f70 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 57, 54, 56,
-/* 0x2f80 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 48, 48, 52, 32, 32, 50,
-/* 0x2f90 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x2fa0 */  49, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x2fb0 */  48, 52, 97, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54,
-/* 0x2fc0 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2fd0 */  83, 10, 32, 49, 50, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x2fe0 */  32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,101,
-/* 0x2ff0 */  48, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3000 */  84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58,
-/* 0x3010 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3020 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3030 */  69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x3040 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3050 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 83, 79, 95, 77, 65,
-/* 0x3060 */  73, 78, 32, 48, 32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48,
-/* 0x3070 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3080 */  32, 32, 32,100, 32, 32, 83, 79, 95, 72, 69, 65, 68, 32, 48, 32,
-/* 0x3090 */  83, 79, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x30b0 */  32,112,116,114, 95, 78, 69, 88, 84, 32, 48, 32,112,116,114, 95,
-/* 0x30c0 */  78, 69, 88, 84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x30d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 83, 79,
-/* 0x30e0 */  95, 84, 65, 73, 76, 32, 48, 32, 83, 79, 95, 84, 65, 73, 76, 10,
-/* 0x30f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3100 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 80, 95, 72, 69, 65,
-/* 0x3110 */  68, 32, 48, 32, 69, 88, 80, 95, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x3120 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3130 */  32, 32, 32,100, 32, 32, 69, 88, 80, 95, 84, 65, 73, 76, 32, 48,
-/* 0x3140 */  32, 69, 88, 80, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3150 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3160 */ 100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69,
-/* 0x3170 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3180 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32,
-/* 0x3190 */  48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x31b0 */  32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x31c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x31d0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x31e0 */  48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10,
-/* 0x31f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3200 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3210 */  67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x3220 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3230 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3240 */  69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3250 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3260 */  97, 99, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65,
-/* 0x3270 */  73, 76, 32, 48, 32, 95, 95,115,121,110, 99, 95, 99, 97, 99,104,
-/* 0x3280 */ 101, 95,114, 97,110,103,101, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3290 */  48, 48, 48, 48, 48, 48, 50, 48, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x32a0 */  32, 83, 79, 95, 72, 69, 65, 68, 32, 48, 32,103,101,116, 52, 10,
-/* 0x32b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32c0 */  32,103, 32, 32, 32, 32, 32, 32, 32, 69, 88, 80, 95, 72, 69, 65,
-/* 0x32d0 */  68, 32, 48, 32,102, 95,101,120,112, 97,110,100, 10, 48, 48, 48,
-/* 0x32e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 56, 56, 32,103, 32,
-/* 0x32f0 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3300 */ 109,117,110,109, 97,112, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3310 */  48, 48, 48, 48, 49, 52, 48, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3320 */  83, 79, 95, 84, 65, 73, 76, 32, 48, 32,103,101,116, 95,115,121,
-/* 0x3330 */ 115, 95,109,117,110,109, 97,112, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3340 */  48, 48, 48, 48, 48, 48, 48, 54, 52, 32,103, 32, 32, 32, 32, 32,
-/* 0x3350 */  32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,103,101,116,112,
-/* 0x3360 */ 105,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3370 */  49, 52, 56, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84,
-/* 0x3380 */  65, 73, 76, 32, 48, 32,109,101,109, 99,112,121, 10, 48, 48, 48,
-/* 0x3390 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 55, 99, 32,103, 32,
-/* 0x33a0 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x33b0 */ 114,101, 97,100,108,105,110,107, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33c0 */  48, 48, 48, 48, 48, 48, 48, 49, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x33d0 */  32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,102,116,114,117,
-/* 0x33e0 */ 110, 99, 97,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x33f0 */  48, 48, 48, 49, 50, 56, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3400 */  79, 95, 84, 65, 73, 76, 32, 48, 32,109,109, 97,112, 10, 48, 48,
-/* 0x3410 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103,
-/* 0x3420 */  32, 32, 32, 32, 32, 70, 32, 69, 88, 80, 95, 84, 65, 73, 76, 32,
-/* 0x3430 */  48, 32,101,111,102, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3440 */  48, 48, 48, 49, 49, 56, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3450 */  79, 95, 84, 65, 73, 76, 32, 48, 32,109,109, 97,112, 95,112,114,
-/* 0x3460 */ 105,118, 97,110,111,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3470 */  48, 48, 48, 48, 48, 51, 52, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3480 */  83, 79, 95, 84, 65, 73, 76, 32, 48, 32,119,114,105,116,101, 10,
-/* 0x3490 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50,101, 48,
-/* 0x34a0 */  32,103, 32, 32, 32, 32, 32, 70, 32, 83, 79, 95, 77, 65, 73, 78,
-/* 0x34b0 */  32, 48, 51, 52, 32, 80, 70, 95,116,111, 95, 80, 82, 79, 84, 10,
-/* 0x34c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 56,
-/* 0x34d0 */  32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76,
-/* 0x34e0 */  32, 48, 32,117,110,108,105,110,107, 97,116, 10, 48, 48, 48, 48,
-/* 0x34f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x3500 */  32, 32, 32, 70, 32, 78, 82, 86, 50, 68, 32, 48, 49, 55, 48, 32,
-/* 0x3510 */ 117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,
-/* 0x3520 */ 114,101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3530 */  48, 48, 48, 48, 48, 48, 49, 99, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x3540 */  32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,101,109,102,100,
-/* 0x3550 */  95, 99,114,101, 97,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3560 */  48, 48, 48, 48, 48, 48, 50, 56, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x3570 */  32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,114,101, 97,100, 10,
-/* 0x3580 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 53, 99,
-/* 0x3590 */  32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76,
-/* 0x35a0 */  32, 48, 32,109,101,109,115,101,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x35b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x35c0 */  32, 70, 32, 78, 82, 86, 50, 66, 32, 48, 49, 52, 52, 32,117, 99,
-/* 0x35d0 */ 108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,
-/* 0x35e0 */ 115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x35f0 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x3600 */  79, 95, 84, 65, 73, 76, 32, 48, 32,109,121, 95, 98,107,112,116,
-/* 0x3610 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57,
-/* 0x3620 */  52, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x3630 */  76, 32, 48, 32, 80,112,114,111,116,101, 99,116, 10, 48, 48, 48,
-/* 0x3640 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 56, 32,103, 32,
-/* 0x3650 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x3660 */ 101,120,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3670 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x3680 */  77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,122,109, 97, 68,
-/* 0x3690 */ 101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36a0 */  48, 48, 48, 48, 55, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x36b0 */  79, 95, 84, 65, 73, 76, 32, 48, 32, 98,114,107, 10, 48, 48, 48,
-/* 0x36c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 48, 32,103, 32,
-/* 0x36d0 */  32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x36e0 */ 111,112,101,110, 97,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36f0 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32,
-/* 0x3700 */  78, 82, 86, 50, 69, 32, 48, 49, 55, 99, 32,117, 99,108, 95,110,
-/* 0x3710 */ 114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95,
-/* 0x3720 */  51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3730 */  48, 57, 52, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84,
-/* 0x3740 */  65, 73, 76, 32, 48, 32,109,112,114,111,116,101, 99,116, 10, 48,
-/* 0x3750 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 99, 32,
-/* 0x3760 */ 103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32,
-/* 0x3770 */  48, 32, 99,108,111,115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3780 */  48, 48, 48, 48, 48, 51, 49, 52, 32,103, 32, 32, 32, 32, 32, 70,
-/* 0x3790 */  32, 83, 79, 95, 77, 65, 73, 78, 32, 48, 52, 57, 56, 32,117,112,
-/* 0x37a0 */ 120, 95,115,111, 95,109, 97,105,110, 10, 10, 82, 69, 76, 79, 67,
-/* 0x37b0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x37c0 */  82, 32, 91, 83, 79, 95, 77, 65, 73, 78, 93, 58, 10, 79, 70, 70,
-/* 0x37d0 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x37e0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x37f0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3800 */  48, 48, 48, 48, 50, 56, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52,
-/* 0x3810 */  95, 67, 65, 76, 76, 50, 54, 32, 32,109,101,109, 99,112,121, 10,
-/* 0x3820 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 52,
-/* 0x3830 */  32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50,
-/* 0x3840 */  54, 32, 32,109,109, 97,112, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3850 */  48, 48, 48, 48, 48, 48, 53, 52, 32, 82, 95, 65, 65, 82, 67, 72,
-/* 0x3860 */  54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,109,101,109, 99,112,
-/* 0x3870 */ 121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3880 */  97, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76,
-/* 0x3890 */  76, 50, 54, 32, 32,111,112,101,110, 97,116, 10, 48, 48, 48, 48,
-/* 0x38a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65,
-/* 0x38b0 */  65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,114,
-/* 0x38c0 */ 101, 97,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38d0 */  48, 48, 99, 56, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67,
-/* 0x38e0 */  65, 76, 76, 50, 54, 32, 32, 99,108,111,115,101, 10, 48, 48, 48,
-/* 0x38f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 53, 99, 32, 82, 95,
-/* 0x3900 */  65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,
-/* 0x3910 */ 101,120,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3920 */  48, 48, 49, 97, 48, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95,
-/* 0x3930 */  67, 65, 76, 76, 50, 54, 32, 32,109,121, 95, 98,107,112,116, 10,
-/* 0x3940 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 97, 56,
-/* 0x3950 */  32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50,
-/* 0x3960 */  54, 32, 32,101,120,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3970 */  48, 48, 48, 48, 48, 50, 54, 48, 32, 82, 95, 65, 65, 82, 67, 72,
-/* 0x3980 */  54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,102, 95,101,120,112,
-/* 0x3990 */  97,110,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39a0 */  48, 51, 56, 56, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67,
-/* 0x39b0 */  65, 76, 76, 50, 54, 32, 32,109,109, 97,112, 10, 48, 48, 48, 48,
-/* 0x39c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 51, 57, 56, 32, 82, 95, 65,
-/* 0x39d0 */  65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,109,
-/* 0x39e0 */ 101,109, 99,112,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39f0 */  48, 48, 48, 52, 49, 56, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52,
-/* 0x3a00 */  95, 67, 65, 76, 76, 50, 54, 32, 32,109,101,109,102,100, 95, 99,
-/* 0x3a10 */ 114,101, 97,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a20 */  48, 48, 48, 52, 50, 99, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52,
-/* 0x3a30 */  95, 67, 65, 76, 76, 50, 54, 32, 32,119,114,105,116,101, 10, 48,
-/* 0x3a40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 52, 48, 32,
-/* 0x3a50 */  82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54,
-/* 0x3a60 */  32, 32,119,114,105,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a70 */  48, 48, 48, 48, 48, 52, 53, 48, 32, 82, 95, 65, 65, 82, 67, 72,
-/* 0x3a80 */  54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,109,117,110,109, 97,
-/* 0x3a90 */ 112, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x3aa0 */  53, 56, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76,
-/* 0x3ab0 */  76, 50, 54, 32, 32, 80, 70, 95,116,111, 95, 80, 82, 79, 84, 10,
-/* 0x3ac0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 55, 52,
-/* 0x3ad0 */  32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50,
-/* 0x3ae0 */  54, 32, 32,109,109, 97,112, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3af0 */  48, 48, 48, 48, 48, 52, 55, 99, 32, 82, 95, 65, 65, 82, 67, 72,
-/* 0x3b00 */  54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32, 99,108,111,115,101,
-/* 0x3b10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 51,
-/* 0x3b20 */  52, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76,
-/* 0x3b30 */  50, 54, 32, 32,109,101,109,102,100, 95, 99,114,101, 97,116,101,
-/* 0x3b40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 52,
-/* 0x3b50 */  48, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76,
-/* 0x3b60 */  50, 54, 32, 32,102,116,114,117,110, 99, 97,116,101, 10, 48, 48,
-/* 0x3b70 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 53, 48, 32, 82,
-/* 0x3b80 */  95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32,
-/* 0x3b90 */  32,119,114,105,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ba0 */  48, 48, 48, 48, 53, 54, 99, 32, 82, 95, 65, 65, 82, 67, 72, 54,
-/* 0x3bb0 */  52, 95, 67, 65, 76, 76, 50, 54, 32, 32,109,109, 97,112, 10, 48,
-/* 0x3bc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 53, 55, 99, 32,
-/* 0x3bd0 */  82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54,
-/* 0x3be0 */  32, 32,109,117,110,109, 97,112, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3bf0 */  48, 48, 48, 48, 48, 48, 54, 57, 99, 32, 82, 95, 65, 65, 82, 67,
-/* 0x3c00 */  72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,109,101,109,102,
-/* 0x3c10 */ 100, 95, 99,114,101, 97,116,101, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c20 */  48, 48, 48, 48, 48, 48, 54, 97, 99, 32, 82, 95, 65, 65, 82, 67,
-/* 0x3c30 */  72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,119,114,105,116,
-/* 0x3c40 */ 101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54,
-/* 0x3c50 */  99, 99, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76,
-/* 0x3c60 */  76, 50, 54, 32, 32,109,109, 97,112, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3c70 */  48, 48, 48, 48, 48, 48, 48, 54,100, 56, 32, 82, 95, 65, 65, 82,
-/* 0x3c80 */  67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32, 99,108,111,
-/* 0x3c90 */ 115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ca0 */  54,102, 48, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65,
-/* 0x3cb0 */  76, 76, 50, 54, 32, 32,109,117,110,109, 97,112, 10, 48, 48, 48,
-/* 0x3cc0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 54,102, 56, 32, 82, 95,
-/* 0x3cd0 */  65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,
-/* 0x3ce0 */  80, 70, 95,116,111, 95, 80, 82, 79, 84, 10, 48, 48, 48, 48, 48,
-/* 0x3cf0 */  48, 48, 48, 48, 48, 48, 48, 48, 55, 50, 52, 32, 82, 95, 65, 65,
-/* 0x3d00 */  82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,109,109,
-/* 0x3d10 */  97,112, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d20 */  55, 50, 99, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 65,
-/* 0x3d30 */  76, 76, 50, 54, 32, 32, 99,108,111,115,101, 10, 48, 48, 48, 48,
-/* 0x3d40 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 55, 51, 56, 32, 82, 95, 65,
-/* 0x3d50 */  65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32, 80,
-/* 0x3d60 */  70, 95,116,111, 95, 80, 82, 79, 84, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3d70 */  48, 48, 48, 48, 48, 48, 48, 55, 53, 48, 32, 82, 95, 65, 65, 82,
-/* 0x3d80 */  67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32, 80,112,114,
-/* 0x3d90 */ 111,116,101, 99,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3da0 */  48, 48, 48, 55, 55, 48, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52,
-/* 0x3db0 */  95, 67, 65, 76, 76, 50, 54, 32, 32,109,117,110,109, 97,112, 10,
-/* 0x3dc0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x3dd0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 83, 79, 95, 72, 69, 65, 68,
-/* 0x3de0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3df0 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e00 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x3e10 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65,
-/* 0x3e20 */  65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32,117,
-/* 0x3e30 */ 112,120, 95,115,111, 95,109, 97,105,110, 10, 10, 82, 69, 76, 79,
-/* 0x3e40 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x3e50 */  79, 82, 32, 91, 83, 79, 95, 84, 65, 73, 76, 93, 58, 10, 79, 70,
-/* 0x3e60 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x3e70 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e80 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e90 */  48, 48, 48, 48, 49, 53, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54,
-/* 0x3ea0 */  52, 95, 67, 79, 78, 68, 66, 82, 49, 57, 32, 32,109,101,109, 99,
-/* 0x3eb0 */ 112,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ec0 */  49, 54, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 79,
-/* 0x3ed0 */  78, 68, 66, 82, 49, 57, 32, 32,109,101,109,115,101,116, 10, 10,
-/* 0x3ee0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x3ef0 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x3f00 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x3f10 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x3f20 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x3f30 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x3f40 */  95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 79, 78, 68, 66, 82, 49,
-/* 0x3f50 */  57, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10
+/* 0x2cf0 */  13,  0,  0,  0, 43,  0,  0,  0, 39,  0,  0,  0,198,  1,  0,  0,
+/* 0x2d00 */   0,  0,  0,  0, 64,  0,  0,  0,172,  7,  0,  0,  2,  0,  0,  0,
+/* 0x2d10 */   8,  0,  0,  0,236,  7,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d20 */  16,  0,  0,  0, 48,  8,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d30 */  25,  0,  0,  0, 56,  8,  0,  0,108,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2d40 */  33,  0,  0,  0,164,  9,  0,  0,  4,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2d50 */  42,  0,  0,  0,168, 10,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d60 */  51,  0,  0,  0,200, 10,  0,  0,124,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2d70 */  57,  0,  0,  0, 68, 12,  0,  0,112,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2d80 */  63,  0,  0,  0,180, 13,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2d90 */  69,  0,  0,  0,248, 14,  0,  0, 12,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2da0 */  80,  0,  0,  0,  4, 16,  0,  0,104,  9,  0,  0,  0,  0,  0,  0,
+/* 0x2db0 */  91,  0,  0,  0,108, 25,  0,  0,160,  4,  0,  0,  0,  0,  0,  0,
+/* 0x2dc0 */ 102,  0,  0,  0, 12, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2dd0 */ 102,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2de0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2df0 */   0,  0,  0,  0, 16,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e00 */  25,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x2e10 */   4,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2e20 */   0,  0,  0,  0, 51,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e30 */  57,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x2e40 */   8,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2e50 */   0,  0,  0,  0, 80,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e60 */  91,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,113,  0,  0,  0,
+/* 0x2e70 */   3,  0,  0,  0,172,  0,  0,  0,132,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2e80 */  32,  0,  0,  0,137,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e90 */ 146,  0,  0,  0,  3,  0,  0,  0,136,  0,  0,  0,153,  0,  0,  0,
+/* 0x2ea0 */   3,  0,  0,  0, 64,  1,  0,  0,168,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2eb0 */ 100,  0,  0,  0,175,  0,  0,  0,  3,  0,  0,  0, 72,  1,  0,  0,
+/* 0x2ec0 */ 182,  0,  0,  0,  3,  0,  0,  0,124,  0,  0,  0,191,  0,  0,  0,
+/* 0x2ed0 */   3,  0,  0,  0, 16,  0,  0,  0,201,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2ee0 */  40,  1,  0,  0,206,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ef0 */ 210,  0,  0,  0,  3,  0,  0,  0, 24,  1,  0,  0,224,  0,  0,  0,
+/* 0x2f00 */   3,  0,  0,  0, 52,  0,  0,  0,230,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */ 224,  2,  0,  0,241,  0,  0,  0,  3,  0,  0,  0, 88,  0,  0,  0,
+/* 0x2f20 */ 250,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 18,  1,  0,  0,
+/* 0x2f30 */   3,  0,  0,  0, 28,  0,  0,  0, 31,  1,  0,  0,  3,  0,  0,  0,
+/* 0x2f40 */  40,  0,  0,  0, 36,  1,  0,  0,  3,  0,  0,  0, 92,  1,  0,  0,
+/* 0x2f50 */  43,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 67,  1,  0,  0,
+/* 0x2f60 */   3,  0,  0,  0,  0,  0,  0,  0, 75,  1,  0,  0,  3,  0,  0,  0,
+/* 0x2f70 */ 148,  0,  0,  0, 84,  1,  0,  0,  3,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2f80 */  89,  1,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,100,  1,  0,  0,
+/* 0x2f90 */   3,  0,  0,  0,112,  0,  0,  0,104,  1,  0,  0,  3,  0,  0,  0,
+/* 0x2fa0 */  64,  0,  0,  0,111,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fb0 */ 135,  1,  0,  0,  3,  0,  0,  0,148,  0,  0,  0,144,  1,  0,  0,
+/* 0x2fc0 */   3,  0,  0,  0, 76,  0,  0,  0,150,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2fd0 */  20,  3,  0,  0,  0,  0,  0,  0, 40,  0,  0,  0,162,  1,  0,  0,
+/* 0x2fe0 */ 175,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ff0 */  68,  0,  0,  0,162,  1,  0,  0,201,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */   0,  0,  0,  0,  0,  0,  0,  0, 84,  0,  0,  0,162,  1,  0,  0,
+/* 0x3010 */ 175,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3020 */ 164,  0,  0,  0,162,  1,  0,  0,104,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */   0,  0,  0,  0,  0,  0,  0,  0,184,  0,  0,  0,162,  1,  0,  0,
+/* 0x3040 */  31,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3050 */ 200,  0,  0,  0,162,  1,  0,  0,144,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3060 */   0,  0,  0,  0,  0,  0,  0,  0, 92,  1,  0,  0,162,  1,  0,  0,
+/* 0x3070 */  84,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3080 */ 160,  1,  0,  0,162,  1,  0,  0, 67,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3090 */   0,  0,  0,  0,  0,  0,  0,  0,168,  1,  0,  0,162,  1,  0,  0,
+/* 0x30a0 */  84,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30b0 */  96,  2,  0,  0,162,  1,  0,  0,137,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30c0 */   0,  0,  0,  0,  0,  0,  0,  0,136,  3,  0,  0,162,  1,  0,  0,
+/* 0x30d0 */ 201,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30e0 */ 152,  3,  0,  0,162,  1,  0,  0,175,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30f0 */   0,  0,  0,  0,  0,  0,  0,  0, 24,  4,  0,  0,162,  1,  0,  0,
+/* 0x3100 */  18,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3110 */  44,  4,  0,  0,162,  1,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3120 */   0,  0,  0,  0,  0,  0,  0,  0, 64,  4,  0,  0,162,  1,  0,  0,
+/* 0x3130 */ 224,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3140 */  80,  4,  0,  0,162,  1,  0,  0,146,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3150 */   0,  0,  0,  0,  0,  0,  0,  0, 88,  4,  0,  0,162,  1,  0,  0,
+/* 0x3160 */ 230,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3170 */ 116,  4,  0,  0,162,  1,  0,  0,201,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3180 */   0,  0,  0,  0,  0,  0,  0,  0,124,  4,  0,  0,162,  1,  0,  0,
+/* 0x3190 */ 144,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31a0 */  52,  5,  0,  0,162,  1,  0,  0, 18,  1,  0,  0,  0,  0,  0,  0,
+/* 0x31b0 */   0,  0,  0,  0,  0,  0,  0,  0, 64,  5,  0,  0,162,  1,  0,  0,
+/* 0x31c0 */ 191,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31d0 */  80,  5,  0,  0,162,  1,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31e0 */   0,  0,  0,  0,  0,  0,  0,  0,108,  5,  0,  0,162,  1,  0,  0,
+/* 0x31f0 */ 201,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3200 */ 124,  5,  0,  0,162,  1,  0,  0,146,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3210 */   0,  0,  0,  0,  0,  0,  0,  0,156,  6,  0,  0,162,  1,  0,  0,
+/* 0x3220 */  18,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3230 */ 172,  6,  0,  0,162,  1,  0,  0,224,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3240 */   0,  0,  0,  0,  0,  0,  0,  0,204,  6,  0,  0,162,  1,  0,  0,
+/* 0x3250 */ 201,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3260 */ 216,  6,  0,  0,162,  1,  0,  0,144,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3270 */   0,  0,  0,  0,  0,  0,  0,  0,240,  6,  0,  0,162,  1,  0,  0,
+/* 0x3280 */ 146,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3290 */ 248,  6,  0,  0,162,  1,  0,  0,230,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32a0 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  7,  0,  0,162,  1,  0,  0,
+/* 0x32b0 */ 201,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32c0 */  44,  7,  0,  0,162,  1,  0,  0,144,  1,  0,  0,  0,  0,  0,  0,
+/* 0x32d0 */   0,  0,  0,  0,  0,  0,  0,  0, 56,  7,  0,  0,162,  1,  0,  0,
+/* 0x32e0 */ 230,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32f0 */  80,  7,  0,  0,162,  1,  0,  0, 75,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3300 */   0,  0,  0,  0,  0,  0,  0,  0,112,  7,  0,  0,162,  1,  0,  0,
+/* 0x3310 */ 146,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3320 */   8,  0,  0,  0,162,  1,  0,  0,150,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3330 */   0,  0,  0,  0,  3,  0,  0,  0, 84,  1,  0,  0,179,  1,  0,  0,
+/* 0x3340 */ 175,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3350 */ 100,  1,  0,  0,179,  1,  0,  0, 36,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3360 */   0,  0,  0,  0,  9,  0,  0,  0,  4,  0,  0,  0,179,  1,  0,  0,
+/* 0x3370 */ 102,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83, 79, 95, 77,
+/* 0x3380 */  65, 73, 78,  0, 83, 79, 95, 72, 69, 65, 68,  0,112,116,114, 95,
+/* 0x3390 */  78, 69, 88, 84,  0, 83, 79, 95, 84, 65, 73, 76,  0, 69, 88, 80,
+/* 0x33a0 */  95, 72, 69, 65, 68,  0, 69, 88, 80, 95, 84, 65, 73, 76,  0, 78,
+/* 0x33b0 */  82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,
+/* 0x33c0 */   0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65,
+/* 0x33d0 */  95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49,
+/* 0x33e0 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 95, 95,115,
+/* 0x33f0 */ 121,110, 99, 95, 99, 97, 99,104,101, 95,114, 97,110,103,101,  0,
+/* 0x3400 */ 103,101,116, 52,  0,102, 95,101,120,112, 97,110,100,  0,109,117,
+/* 0x3410 */ 110,109, 97,112,  0,103,101,116, 95,115,121,115, 95,109,117,110,
+/* 0x3420 */ 109, 97,112,  0,103,101,116,112,105,100,  0,109,101,109, 99,112,
+/* 0x3430 */ 121,  0,114,101, 97,100,108,105,110,107,  0,102,116,114,117,110,
+/* 0x3440 */  99, 97,116,101,  0,109,109, 97,112,  0,101,111,102,  0,109,109,
+/* 0x3450 */  97,112, 95,112,114,105,118, 97,110,111,110,  0,119,114,105,116,
+/* 0x3460 */ 101,  0, 80, 70, 95,116,111, 95, 80, 82, 79, 84,  0,117,110,108,
+/* 0x3470 */ 105,110,107, 97,116,  0,117, 99,108, 95,110,114,118, 50,100, 95,
+/* 0x3480 */ 100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,  0,109,101,
+/* 0x3490 */ 109,102,100, 95, 99,114,101, 97,116,101,  0,114,101, 97,100,  0,
+/* 0x34a0 */ 109,101,109,115,101,116,  0,117, 99,108, 95,110,114,118, 50, 98,
+/* 0x34b0 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,  0,109,
+/* 0x34c0 */ 121, 95, 98,107,112,116,  0, 80,112,114,111,116,101, 99,116,  0,
+/* 0x34d0 */ 101,120,105,116,  0, 76,122,109, 97, 68,101, 99,111,100,101,  0,
+/* 0x34e0 */  98,114,107,  0,111,112,101,110, 97,116,  0,117, 99,108, 95,110,
+/* 0x34f0 */ 114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,115, 95,
+/* 0x3500 */  51, 50,  0,109,112,114,111,116,101, 99,116,  0, 99,108,111,115,
+/* 0x3510 */ 101,  0,117,112,120, 95,115,111, 95,109, 97,105,110,  0, 82, 95,
+/* 0x3520 */  65, 65, 82, 67, 72, 54, 52, 95, 67, 65, 76, 76, 50, 54,  0, 82,
+/* 0x3530 */  95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 79, 78, 68, 66, 82, 49,
+/* 0x3540 */  57,  0,240, 44,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm64-linux.shlib-init.h
-   created from arm64-linux.shlib-init.bin, 7923 (0x1ef3) bytes
+   created from arm64-linux.shlib-init.bin, 6629 (0x19e5) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_LINUX_SHLIB_INIT_SIZE    7923
-#define STUB_ARM64_LINUX_SHLIB_INIT_ADLER32 0x74b92ff3
-#define STUB_ARM64_LINUX_SHLIB_INIT_CRC32   0xfaebe7b3
+#define STUB_ARM64_LINUX_SHLIB_INIT_SIZE    6629
+#define STUB_ARM64_LINUX_SHLIB_INIT_ADLER32 0x763cc7b8
+#define STUB_ARM64_LINUX_SHLIB_INIT_CRC32   0x0e5a4732
 
-unsigned char stub_arm64_linux_shlib_init[7923] = {
+unsigned char stub_arm64_linux_shlib_init[6629] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,248, 25,  0,  0,  0,  0,  0,  0,
@@ -397,139 +397,58 @@ unsigned char stub_arm64_linux_shlib_init[7923] = {
 /* 0x1660 */   0,249,211,255,255,151,224,135, 67,169,162,  0,128,210, 72, 28,
 /* 0x1670 */ 128, 82,  1,  0,  0,212, 31,  4, 64,177, 67,  0,  0, 84,  0,  0,
 /* 0x1680 */  32,212,254, 95, 64,249,192,  3, 31,214, 99,192, 95,184, 99, 92,
-/* 0x1690 */   0, 18, 66,  0,  3,139,192,  3, 95,214,102,105,108,101, 32,102,
-/* 0x16a0 */ 111,114,109, 97,116, 32,101,108,102, 54, 52, 45,108,105,116,116,
-/* 0x16b0 */ 108,101, 97, 97,114, 99,104, 54, 52, 10, 10, 83,101, 99,116,105,
-/* 0x16c0 */ 111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32,
-/* 0x16d0 */  32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32,
-/* 0x16e0 */  32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x16f0 */  32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1700 */  32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,
-/* 0x1710 */ 108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69,
-/* 0x1720 */  76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 49, 48,
-/* 0x1730 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42,
-/* 0x1740 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32,
-/* 0x1750 */  78, 82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x1760 */  32, 48, 32, 32, 48, 32, 32, 48, 53, 48, 32, 32, 50, 42, 42, 48,
-/* 0x1770 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 78,
-/* 0x1780 */  82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 32, 32,
-/* 0x1790 */  48, 32, 32, 48, 32, 32, 48, 53, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x17a0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78, 82,
-/* 0x17b0 */  86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 55, 99,
-/* 0x17c0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 48, 32, 32, 50, 42, 42,
-/* 0x17d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32,
-/* 0x17e0 */  78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x17f0 */  55, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 99, 99, 32, 32,
-/* 0x1800 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1810 */  32, 53, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1820 */  32, 48, 49, 52, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 51,
-/* 0x1830 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1840 */  83, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x1850 */  32, 32, 32, 32, 48, 49, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1860 */  48, 52, 56, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1870 */  69, 78, 84, 83, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1880 */  67, 50, 48, 32, 32, 32, 32, 48, 57, 54, 56, 32, 32, 48, 32, 32,
-/* 0x1890 */  48, 32, 32, 48, 53, 56, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x18a0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 76, 90, 77, 65,
-/* 0x18b0 */  95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 52, 97, 48, 32, 32,
-/* 0x18c0 */  48, 32, 32, 48, 32, 32, 48,101,102, 52, 32, 32, 50, 42, 42, 48,
-/* 0x18d0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 76,
-/* 0x18e0 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 32, 32,
-/* 0x18f0 */  48, 32, 32, 48, 32, 32, 48, 49, 51, 57, 52, 32, 32, 50, 42, 42,
-/* 0x1900 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32,
-/* 0x1910 */  69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x1920 */ 101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 57, 52, 32, 32,
-/* 0x1930 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1940 */  49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32,
-/* 0x1950 */  32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51,100, 50, 32,
-/* 0x1960 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1970 */  32, 49, 50, 32, 69, 76, 70, 77, 65, 74, 78, 90, 32, 32, 32, 32,
-/* 0x1980 */  32, 32, 48, 50, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51,
-/* 0x1990 */ 100, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x19a0 */  84, 83, 10, 32, 49, 51, 32, 65, 78, 68, 77, 65, 74, 78, 90, 32,
-/* 0x19b0 */  32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x19c0 */  49, 51,102, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x19d0 */  69, 78, 84, 83, 10, 32, 49, 52, 32, 69, 76, 70, 77, 65, 75, 78,
-/* 0x19e0 */  90, 32, 32, 32, 32, 32, 32, 48, 50, 97, 48, 32, 32, 48, 32, 32,
-/* 0x19f0 */  48, 32, 32, 48, 49, 51,102, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1a00 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32,
-/* 0x1a10 */  84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1a30 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77,
-/* 0x1a40 */  65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a50 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1a60 */  32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 69, 76, 70, 77,
-/* 0x1a70 */  65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1a80 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x1a90 */  70, 77, 65, 73, 78, 88, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1aa0 */  88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ab0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72,
-/* 0x1ac0 */  69, 65, 68, 32, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48,
-/* 0x1ad0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1ae0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x1af0 */  32, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48,
-/* 0x1b00 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1b10 */  32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82, 86,
-/* 0x1b20 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b30 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x1b40 */  68, 32, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1b50 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1b60 */ 100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50, 66,
-/* 0x1b70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69,
-/* 0x1b90 */  76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x1ba0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1bb0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x1bc0 */  68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1bd0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1be0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x1bf0 */  95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1c00 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c10 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70,
-/* 0x1c20 */  77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x1c30 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c40 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 74,
-/* 0x1c50 */  78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 74, 78, 90, 10, 48, 48,
-/* 0x1c60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1c70 */  32, 32, 32, 32,100, 32, 32, 65, 78, 68, 77, 65, 74, 78, 90, 32,
-/* 0x1c80 */  48, 32, 65, 78, 68, 77, 65, 74, 78, 90, 10, 48, 48, 48, 48, 48,
-/* 0x1c90 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1ca0 */  32,100, 32, 32, 69, 76, 70, 77, 65, 75, 78, 90, 32, 48, 32, 69,
-/* 0x1cb0 */  76, 70, 77, 65, 75, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x1cd0 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 95,115,116, 97,
-/* 0x1ce0 */ 114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1cf0 */  48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50,
-/* 0x1d00 */  69, 32, 48, 49, 55, 99, 32,117, 99,108, 95,110,114,118, 50,101,
-/* 0x1d10 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50, 10, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1d30 */ 103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 68, 32, 48, 49,
-/* 0x1d40 */  55, 48, 32,117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,
-/* 0x1d50 */ 111,109,112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48,
-/* 0x1d60 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32,
-/* 0x1d70 */  32, 32, 70, 32, 78, 82, 86, 50, 66, 32, 48, 49, 52, 52, 32,117,
-/* 0x1d80 */  99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,
-/* 0x1d90 */ 101,115,115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1db0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,122,109,
-/* 0x1dc0 */  97, 68,101, 99,111,100,101, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x1de0 */  32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 48, 32,101,110,100, 95,
-/* 0x1df0 */ 100,101, 99,111,109,112,114,101,115,115, 10, 10, 82, 69, 76, 79,
-/* 0x1e00 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x1e10 */  79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79,
-/* 0x1e20 */  70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e30 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e40 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 65, 65, 82, 67, 72,
-/* 0x1e60 */  54, 52, 95, 67, 65, 76, 76, 50, 54, 32, 32, 69, 76, 70, 77, 65,
-/* 0x1e70 */  73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x1e80 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77,
-/* 0x1e90 */  65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1eb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1ec0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ed0 */  48, 48, 52, 32, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 79,
-/* 0x1ee0 */  78, 68, 66, 82, 49, 57, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1ef0 */  51, 48, 10
+/* 0x1690 */   0, 18, 66,  0,  3,139,192,  3, 95,214, 15,  0,  0,  0, 21,  0,
+/* 0x16a0 */   0,  0,  2,  0,  0,  0, 19,  1,  0,  0,  0,  0,  0,  0, 64,  0,
+/* 0x16b0 */   0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 80,  0,
+/* 0x16c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 80,  0,
+/* 0x16d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0, 80,  0,
+/* 0x16e0 */   0,  0,124,  1,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,204,  1,
+/* 0x16f0 */   0,  0,112,  1,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0, 60,  3,
+/* 0x1700 */   0,  0, 68,  1,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,128,  4,
+/* 0x1710 */   0,  0, 12,  1,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,140,  5,
+/* 0x1720 */   0,  0,104,  9,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,244, 14,
+/* 0x1730 */   0,  0,160,  4,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,148, 19,
+/* 0x1740 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,148, 19,
+/* 0x1750 */   0,  0, 62,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,210, 19,
+/* 0x1760 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0,210, 19,
+/* 0x1770 */   0,  0, 36,  0,  0,  0,  0,  0,  0,  0,116,  0,  0,  0,246, 19,
+/* 0x1780 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,125,  0,  0,  0,250, 19,
+/* 0x1790 */   0,  0,160,  2,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  9,  0,
+/* 0x17a0 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x17b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x17c0 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,
+/* 0x17d0 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x17e0 */   0,  0, 33,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 39,  0,
+/* 0x17f0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  6,  0,
+/* 0x1800 */   0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x1810 */   0,  0, 67,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x1820 */   0,  0, 10,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0, 12,  0,
+/* 0x1830 */   0,  0,  0,  0,  0,  0,116,  0,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1840 */   0,  0,125,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,134,  0,
+/* 0x1850 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,141,  0,  0,  0,  3,  0,
+/* 0x1860 */   0,  0,  0,  0,  0,  0,165,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1870 */   0,  0,189,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,213,  0,
+/* 0x1880 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0,224,  0,  0,  0, 10,  0,
+/* 0x1890 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,239,  0,
+/* 0x18a0 */   0,  0, 98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x18b0 */   0,  0,  4,  0,  0,  0,  0,  1,  0,  0, 78,  0,  0,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78,
+/* 0x18d0 */  82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,
+/* 0x18e0 */   0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86,
+/* 0x18f0 */  50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x1900 */  77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1910 */  67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 69,
+/* 0x1920 */  76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,
+/* 0x1930 */   0, 69, 76, 70, 77, 65, 74, 78, 90,  0, 65, 78, 68, 77, 65, 74,
+/* 0x1940 */  78, 90,  0, 69, 76, 70, 77, 65, 75, 78, 90,  0, 95,115,116, 97,
+/* 0x1950 */ 114,116,  0,117, 99,108, 95,110,114,118, 50,101, 95,100,101, 99,
+/* 0x1960 */ 111,109,112,114,101,115,115, 95, 51, 50,  0,117, 99,108, 95,110,
+/* 0x1970 */ 114,118, 50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95,
+/* 0x1980 */  51, 50,  0,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,
+/* 0x1990 */ 111,109,112,114,101,115,115, 95, 51, 50,  0, 76,122,109, 97, 68,
+/* 0x19a0 */ 101, 99,111,100,101,  0,101,110,100, 95,100,101, 99,111,109,112,
+/* 0x19b0 */ 114,101,115,115,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67,
+/* 0x19c0 */  65, 76, 76, 50, 54,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95,
+/* 0x19d0 */  67, 79, 78, 68, 66, 82, 49, 57,  0,154, 22,  0,  0, 85, 80, 88,
+/* 0x19e0 */  76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* arm64-win64.pe.h
-   created from arm64-win64.pe.bin, 6445 (0x192d) bytes
+   created from arm64-win64.pe.bin, 5569 (0x15c1) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARM64_WIN64_PE_SIZE    6445
-#define STUB_ARM64_WIN64_PE_ADLER32 0x2ad96830
-#define STUB_ARM64_WIN64_PE_CRC32   0x37da39bd
+#define STUB_ARM64_WIN64_PE_SIZE    5569
+#define STUB_ARM64_WIN64_PE_ADLER32 0xbce471df
+#define STUB_ARM64_WIN64_PE_CRC32   0xb7b4f033
 
-unsigned char stub_arm64_win64_pe[6445] = {
+unsigned char stub_arm64_win64_pe[5569] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,183,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,216, 21,  0,  0,  0,  0,  0,  0,
@@ -348,95 +348,41 @@ unsigned char stub_arm64_win64_pe[6445] = {
 /* 0x1350 */ 231,  3,  2, 42,  2,  0,129, 82, 66,  0,  3, 75,  0,  0,  0, 58,
 /* 0x1360 */  99, 20, 66, 11, 35,  0,  0,121, 32,  2, 95,214,140,  1,  2, 75,
 /* 0x1370 */ 231,  0,  2, 75, 99, 20, 67, 75,  0,  0,  0, 58, 35,  0,  0,121,
-/* 0x1380 */  32,  2, 95,214,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1390 */ 101,108,102, 54, 52, 45,108,105,116,116,108,101, 97, 97,114, 99,
-/* 0x13a0 */ 104, 54, 52, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,
-/* 0x13b0 */ 100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x13c0 */  32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32,
-/* 0x13d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x13e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,
-/* 0x13f0 */ 105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,
-/* 0x1400 */ 108, 97,103,115, 10, 32, 32, 48, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x1410 */  68, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1420 */  48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1430 */  78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86, 50, 66, 32, 32, 32,
-/* 0x1440 */  32, 32, 32, 32, 32, 32, 48, 49, 52, 52, 32, 32, 48, 32, 32, 48,
-/* 0x1450 */  32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1460 */  84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 78, 82, 86, 50, 68, 32,
-/* 0x1470 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 55, 48, 32, 32, 48, 32,
-/* 0x1480 */  32, 48, 32, 32, 48, 49, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1490 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78, 82, 86,
-/* 0x14a0 */  50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 55, 99, 32,
-/* 0x14b0 */  32, 48, 32, 32, 48, 32, 32, 48, 50,102, 52, 32, 32, 50, 42, 42,
-/* 0x14c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32,
-/* 0x14d0 */  76, 90, 77, 65, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 48, 32,
-/* 0x14e0 */  32, 48, 32, 32, 48, 32, 32, 48, 52, 55, 48, 32, 32, 50, 42, 42,
-/* 0x14f0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32,
-/* 0x1500 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 49,
-/* 0x1510 */  48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 55, 48, 32, 32,
-/* 0x1520 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1530 */  32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32,
-/* 0x1540 */  32, 48, 57, 54, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 55,
-/* 0x1550 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1560 */  83, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1570 */  32, 32, 32, 32, 48, 52, 97, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1580 */  48,101,101, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1590 */  69, 78, 84, 83, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x15a0 */  67, 51, 48, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x15b0 */  48, 49, 51, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x15c0 */  84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 84,
-/* 0x15d0 */  65, 73, 76, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32,
-/* 0x15e0 */  32, 48, 49, 51, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x15f0 */  78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65,
-/* 0x1600 */  66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1610 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1620 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1630 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1640 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x1650 */  82, 86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86, 95, 72, 69,
-/* 0x1660 */  65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1670 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x1680 */  66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1690 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x16a0 */ 100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82, 86, 50, 68,
-/* 0x16b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32,
-/* 0x16d0 */  48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x16f0 */  32, 76, 90, 77, 65, 95, 72, 69, 65, 68, 32, 48, 32, 76, 90, 77,
-/* 0x1700 */  65, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1710 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1720 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77,
-/* 0x1730 */  65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1740 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1750 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90,
-/* 0x1760 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1770 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1780 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,
-/* 0x1790 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x17a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x17b0 */ 100, 32, 32, 76, 90, 77, 65, 95, 84, 65, 73, 76, 32, 48, 32, 76,
-/* 0x17c0 */  90, 77, 65, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x17d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x17e0 */  70, 32, 78, 82, 86, 50, 66, 32, 48, 49, 52, 52, 32,117, 99,108,
-/* 0x17f0 */  95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x1800 */ 115, 95, 51, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1810 */  48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82,
-/* 0x1820 */  86, 50, 68, 32, 48, 49, 55, 48, 32,117, 99,108, 95,110,114,118,
-/* 0x1830 */  50,100, 95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,
-/* 0x1840 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1850 */  48, 32,103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 69, 32,
-/* 0x1860 */  48, 49, 55, 99, 32,117, 99,108, 95,110,114,118, 50,101, 95,100,
-/* 0x1870 */ 101, 99,111,109,112,114,101,115,115, 95, 51, 50, 10, 48, 48, 48,
-/* 0x1880 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x1890 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x18a0 */  32, 48, 32, 76,122,109, 97, 68,101, 99,111,100,101, 10, 10, 82,
-/* 0x18b0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x18c0 */  83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x18d0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32,
-/* 0x18e0 */  32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x18f0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x1900 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x1910 */  65, 65, 82, 67, 72, 54, 52, 95, 67, 79, 78, 68, 66, 82, 49, 57,
-/* 0x1920 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10
+/* 0x1380 */  32,  2, 95,214, 10,  0,  0,  0, 14,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1390 */ 193,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13a0 */   0,  0,  0,  0,  9,  0,  0,  0, 64,  0,  0,  0, 68,  1,  0,  0,
+/* 0x13b0 */   0,  0,  0,  0, 15,  0,  0,  0,132,  1,  0,  0,112,  1,  0,  0,
+/* 0x13c0 */   0,  0,  0,  0, 21,  0,  0,  0,244,  2,  0,  0,124,  1,  0,  0,
+/* 0x13d0 */   0,  0,  0,  0, 27,  0,  0,  0,112,  4,  0,  0,  0,  0,  0,  0,
+/* 0x13e0 */   0,  0,  0,  0, 37,  0,  0,  0,112,  4,  0,  0, 12,  1,  0,  0,
+/* 0x13f0 */   0,  0,  0,  0, 48,  0,  0,  0,124,  5,  0,  0,104,  9,  0,  0,
+/* 0x1400 */   0,  0,  0,  0, 59,  0,  0,  0,228, 14,  0,  0,160,  4,  0,  0,
+/* 0x1410 */   0,  0,  0,  0, 70,  0,  0,  0,132, 19,  0,  0,  0,  0,  0,  0,
+/* 0x1420 */   0,  0,  0,  0, 81,  0,  0,  0,132, 19,  0,  0,  0,  0,  0,  0,
+/* 0x1430 */   0,  0,  0,  0, 70,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1440 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1450 */   1,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1460 */   0,  0,  0,  0, 21,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1470 */  27,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,
+/* 0x1480 */   5,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0, 59,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14a0 */  81,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,
+/* 0x14b0 */   1,  0,  0,  0,  0,  0,  0,  0,115,  0,  0,  0,  2,  0,  0,  0,
+/* 0x14c0 */   0,  0,  0,  0,139,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14d0 */ 163,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x14e0 */   4,  0,  0,  0,174,  0,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */   0,  0,  0,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86,
+/* 0x1500 */  50, 66,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 69,  0, 76,
+/* 0x1510 */  90, 77, 65, 95, 72, 69, 65, 68,  0, 76, 90, 77, 65, 95, 69, 76,
+/* 0x1520 */  70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76,
+/* 0x1530 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x1540 */  69, 67, 51, 48,  0, 76, 90, 77, 65, 95, 84, 65, 73, 76,  0,117,
+/* 0x1550 */  99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,109,112,114,
+/* 0x1560 */ 101,115,115, 95, 51, 50,  0,117, 99,108, 95,110,114,118, 50,100,
+/* 0x1570 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 51, 50,  0,117,
+/* 0x1580 */  99,108, 95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,
+/* 0x1590 */ 101,115,115, 95, 51, 50,  0, 76,122,109, 97, 68,101, 99,111,100,
+/* 0x15a0 */ 101,  0, 82, 95, 65, 65, 82, 67, 72, 54, 52, 95, 67, 79, 78, 68,
+/* 0x15b0 */  66, 82, 49, 57,  0,132, 19,  0,  0, 85, 80, 88, 76, 78, 75, 48,
+/* 0x15c0 */  49
 };
@@ -1,5 +1,5 @@
 /* armeb.v4a-linux.elf-entry.h
-   created from armeb.v4a-linux.elf-entry.bin, 13886 (0x363e) bytes
+   created from armeb.v4a-linux.elf-entry.bin, 10134 (0x2796) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_SIZE    13886
-#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_ADLER32 0x1a5748b6
-#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_CRC32   0xbdd15d50
+#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_SIZE    10134
+#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_ADLER32 0xc19d0949
+#define STUB_ARMEB_V4A_LINUX_ELF_ENTRY_CRC32   0x8b80a35b
 
-unsigned char stub_armeb_v4a_linux_elf_entry[13886] = {
+unsigned char stub_armeb_v4a_linux_elf_entry[10134] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1, 97,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 40,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 19, 84,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -334,574 +334,340 @@ unsigned char stub_armeb_v4a_linux_elf_entry[13886] = {
 /* 0x1270 */ 229, 30,  0, 16,226, 78, 96, 16,229,141,224, 16,224, 70, 96,  0,
 /* 0x1280 */ 229,141, 96,  0,225,160,144,  0,226, 79,  0, 72,227,160, 16,  0,
 /* 0x1290 */ 239,144,  0,  5,227, 80,  0,  0,186,  0,  0, 37,229,141,  0,  4,
-/* 0x12a0 */ 229, 30, 48, 12,235,255,255,254,  0,  0,  0,  0,102,105,108,101,
-/* 0x12b0 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45, 98,105,
-/* 0x12c0 */ 103, 97,114,109, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10,
-/* 0x12d0 */  73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x12e0 */  32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32,
-/* 0x12f0 */  32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1300 */  70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32,
-/* 0x1310 */  70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1320 */  78, 88, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48,
-/* 0x1330 */  32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1340 */  84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69,
-/* 0x1350 */  65, 68, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1360 */  32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1370 */  69, 78, 84, 83, 10, 32, 32, 50, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x1380 */  76, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1390 */  48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x13a0 */  78, 84, 83, 10, 32, 32, 51, 32, 78, 82, 86, 50, 69, 32, 32, 32,
-/* 0x13b0 */  32, 32, 32, 32, 32, 32, 48, 49, 50, 99, 32, 32, 48, 32, 32, 48,
-/* 0x13c0 */  32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x13d0 */  84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78, 82, 86, 50, 68, 32,
-/* 0x13e0 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 49, 56, 32, 32, 48, 32,
-/* 0x13f0 */  32, 48, 32, 32, 48, 49, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1400 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 78, 82, 86,
-/* 0x1410 */  50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,100, 99, 32, 32,
-/* 0x1420 */  48, 32, 32, 48, 32, 32, 48, 50, 56, 52, 32, 32, 50, 42, 42, 48,
-/* 0x1430 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 76,
-/* 0x1440 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 97, 99,
-/* 0x1450 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 54, 48, 32, 32, 50, 42,
-/* 0x1460 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55,
-/* 0x1470 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48,
-/* 0x1480 */  57, 51, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 99, 32,
-/* 0x1490 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x14a0 */  32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32,
-/* 0x14b0 */  32, 32, 48, 52, 55, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,100,
-/* 0x14c0 */  52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x14d0 */  84, 83, 10, 32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x14e0 */  48, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x14f0 */  49, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1500 */  78, 84, 83, 10, 32, 49, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x1510 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1520 */  49, 49, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1530 */  69, 78, 84, 83, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1540 */  90, 32, 32, 32, 32, 32, 32, 48,102, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1550 */  32, 32, 48, 49, 49, 98, 99, 32, 32, 50, 42, 42, 50, 32, 32, 67,
-/* 0x1560 */  79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84,
-/* 0x1570 */  65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1580 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78,
-/* 0x1590 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x15a0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82,
-/* 0x15b0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x15c0 */  32, 32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86,
-/* 0x15d0 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x15e0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48,
-/* 0x15f0 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48,
-/* 0x1600 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x1610 */  65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1620 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1630 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1640 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x1650 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x1660 */  76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1670 */  78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1680 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 69,
-/* 0x1690 */  76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x16a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x16b0 */  68, 32, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48,
-/* 0x16c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x16d0 */  86, 95, 84, 65, 73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x16e0 */  76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x16f0 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32,
-/* 0x1700 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x1710 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x1720 */  65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10,
-/* 0x1730 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1740 */  32, 42, 85, 78, 68, 42, 32, 48, 32, 77, 70, 76, 71, 10, 48, 48,
-/* 0x1750 */  48, 48, 48, 48, 48, 52, 32,103, 32, 32, 32, 32, 32, 32, 32, 69,
-/* 0x1760 */  76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 95,115,116, 97,114,116,
-/* 0x1770 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x1780 */  70, 32, 78, 82, 86, 50, 69, 32, 48, 49, 50, 99, 32,117, 99,108,
-/* 0x1790 */  95,110,114,118, 50,101, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x17a0 */ 115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x17b0 */  32, 32, 32, 70, 32, 78, 82, 86, 50, 68, 32, 48, 49, 49, 56, 32,
-/* 0x17c0 */ 117, 99,108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,
-/* 0x17d0 */ 114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x17e0 */ 103, 32, 32, 32, 32, 32, 70, 32, 78, 82, 86, 50, 66, 32, 48,100,
-/* 0x17f0 */  99, 32,117, 99,108, 95,110,114,118, 50, 98, 95,100,101, 99,111,
-/* 0x1800 */ 109,112,114,101,115,115, 95, 56, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1810 */  48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1820 */  69, 67, 49, 48, 32, 48, 32, 76,122,109, 97, 68,101, 99,111,100,
-/* 0x1830 */ 101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x1840 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 48, 32,101,110,
-/* 0x1850 */ 100, 95,100,101, 99,111,109,112,114,101,115,115, 10, 48, 48, 48,
-/* 0x1860 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x1870 */  78, 68, 42, 32, 48, 32, 79, 95, 66, 73, 78, 70, 79, 10, 48, 48,
-/* 0x1880 */  48, 48, 48, 48,102, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69,
-/* 0x1890 */  76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 99,112,114, 48, 10, 10,
-/* 0x18a0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x18b0 */  68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x18c0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x18d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x18e0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 65,
-/* 0x18f0 */  82, 77, 95, 65, 66, 83, 51, 50, 32, 32, 32, 32, 32, 32, 32, 77,
-/* 0x1900 */  70, 76, 71, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 65,
-/* 0x1910 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69,
-/* 0x1920 */  76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x1930 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x1940 */  91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x1950 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1960 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1970 */  49, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1980 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1990 */  48, 53, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x19a0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x19b0 */  48, 48, 54, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x19c0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x19d0 */  48, 48, 48, 54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x19e0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x19f0 */  48, 48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1a00 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1a10 */  48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1a20 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1a30 */  48, 48, 48, 48, 48, 48, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1a40 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1a50 */  10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1a60 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1a70 */  69, 10, 48, 48, 48, 48, 48, 48, 57, 99, 32, 82, 95, 65, 82, 77,
-/* 0x1a80 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1a90 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82,
-/* 0x1aa0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1ab0 */  86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 65,
-/* 0x1ac0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1ad0 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95,
-/* 0x1ae0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1af0 */  78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 99, 48, 32, 82,
-/* 0x1b00 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1b10 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32,
-/* 0x1b20 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1b30 */  32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100, 48,
-/* 0x1b40 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1b50 */  32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,100,
-/* 0x1b60 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1b70 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1b80 */ 100, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1b90 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1ba0 */  48,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1bb0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x1bc0 */  48, 48,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1bd0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x1be0 */  48, 48, 48,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1bf0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x1c00 */  48, 48, 48, 48,102, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1c10 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10, 48,
-/* 0x1c20 */  48, 48, 48, 48, 49, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1c30 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 10,
-/* 0x1c40 */  48, 48, 48, 48, 48, 49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1c50 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1c60 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x1c70 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93,
-/* 0x1c80 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x1c90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x1ca0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 65, 82,
-/* 0x1cb0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1cc0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95, 65,
-/* 0x1cd0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1ce0 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 54, 48, 32, 82, 95,
-/* 0x1cf0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d00 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 54, 56, 32, 82,
-/* 0x1d10 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d20 */  32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 55, 52, 32,
-/* 0x1d30 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1d40 */  32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 56, 48,
-/* 0x1d50 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1d60 */  32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 56,
-/* 0x1d70 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1d80 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1d90 */  57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1da0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48,
-/* 0x1db0 */  48, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1dc0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48,
-/* 0x1dd0 */  48, 48, 97, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1de0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48,
-/* 0x1df0 */  48, 48, 48, 98, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x1e00 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48, 48,
-/* 0x1e10 */  48, 48, 48, 48, 98, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x1e20 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10, 48,
-/* 0x1e30 */  48, 48, 48, 48, 48, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x1e40 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 10,
-/* 0x1e50 */  48, 48, 48, 48, 48, 48,100, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x1e60 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68,
-/* 0x1e70 */  10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x1e80 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x1e90 */  68, 10, 48, 48, 48, 48, 48, 48,101, 56, 32, 82, 95, 65, 82, 77,
-/* 0x1ea0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x1eb0 */  50, 68, 10, 48, 48, 48, 48, 48, 48,101, 99, 32, 82, 95, 65, 82,
-/* 0x1ec0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x1ed0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 49, 48, 32, 82, 95, 65,
-/* 0x1ee0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x1ef0 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 49, 49, 52, 32, 82, 95,
-/* 0x1f00 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f10 */  78, 82, 86, 50, 68, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x1f20 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x1f30 */  82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x1f40 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f50 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 48,
-/* 0x1f60 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1f70 */  32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 54,
-/* 0x1f80 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x1f90 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1fa0 */  54, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x1fb0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x1fd0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x1fe0 */  48, 48, 55, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x1ff0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48,
-/* 0x2000 */  48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2010 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48, 48,
-/* 0x2020 */  48, 48, 48, 48, 56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2030 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x2040 */  48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2050 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 10,
-/* 0x2060 */  48, 48, 48, 48, 48, 48, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2070 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2080 */  10, 48, 48, 48, 48, 48, 48, 97, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2090 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x20a0 */  66, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77,
-/* 0x20b0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x20c0 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 65, 82,
-/* 0x20d0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x20e0 */  86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 98, 56, 32, 82, 95, 65,
-/* 0x20f0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x2100 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,100, 52, 32, 82, 95,
-/* 0x2110 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2120 */  78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,100, 56, 32, 82,
-/* 0x2130 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2140 */  32, 78, 82, 86, 50, 66, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2150 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2160 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x2170 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2180 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2190 */  48, 48, 48, 48, 48, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x21a0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x21b0 */  70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 52, 99, 32, 82, 95, 65,
-/* 0x21c0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x21d0 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x21e0 */  56, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x21f0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10,
-/* 0x2200 */  48, 48, 48, 48, 48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2210 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2220 */  69, 76, 70, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2230 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x2240 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2250 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2260 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2270 */  48, 48, 48, 55, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2280 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2290 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 65, 82,
-/* 0x22a0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x22b0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x22c0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x22d0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x22e0 */  48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x22f0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2300 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,102, 52, 32, 82, 95,
-/* 0x2310 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2320 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2330 */  49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2340 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2350 */  10, 48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2360 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2370 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32,
-/* 0x2380 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2390 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x23a0 */  48, 48, 49, 57, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x23b0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x23c0 */  50, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99, 32, 82, 95, 65, 82,
-/* 0x23d0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x23e0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 49,100,
-/* 0x23f0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2400 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2410 */  48, 48, 48, 48, 50, 48, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2420 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2430 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 49, 56, 32, 82, 95,
-/* 0x2440 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2450 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2460 */  50, 50, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2470 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2480 */  10, 48, 48, 48, 48, 48, 50, 51, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2490 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x24a0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 51, 99, 32,
-/* 0x24b0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x24c0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x24d0 */  48, 48, 50, 52, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x24e0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x24f0 */  50, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99, 32, 82, 95, 65, 82,
-/* 0x2500 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2510 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 53,
-/* 0x2520 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2530 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2540 */  48, 48, 48, 48, 50, 97, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2550 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2560 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 50, 99, 56, 32, 82, 95,
-/* 0x2570 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2580 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2590 */  50,101, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x25a0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x25b0 */  10, 48, 48, 48, 48, 48, 51, 48, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x25c0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x25d0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32,
-/* 0x25e0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x25f0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2600 */  48, 48, 51, 51, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2610 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2620 */  50, 48, 10, 48, 48, 48, 48, 48, 51, 56, 56, 32, 82, 95, 65, 82,
-/* 0x2630 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2640 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 97,
-/* 0x2650 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2660 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2670 */  48, 48, 48, 48, 51, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2680 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2690 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82, 95,
-/* 0x26a0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26b0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x26c0 */  51,101, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x26d0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x26e0 */  10, 48, 48, 48, 48, 48, 51,101, 56, 32, 82, 95, 65, 82, 77, 95,
-/* 0x26f0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2700 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 50, 52, 32,
-/* 0x2710 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2720 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2730 */  48, 48, 52, 51, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2740 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2750 */  50, 48, 10, 48, 48, 48, 48, 48, 52, 54, 99, 32, 82, 95, 65, 82,
-/* 0x2760 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2770 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 56,
-/* 0x2780 */  52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2790 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x27a0 */  48, 48, 48, 48, 52, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x27b0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x27c0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52, 98, 48, 32, 82, 95,
-/* 0x27d0 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x27e0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x27f0 */  52,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2800 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2810 */  10, 48, 48, 48, 48, 48, 52,101, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2820 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2830 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 52,102, 52, 32,
-/* 0x2840 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2850 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2860 */  48, 48, 53, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2870 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2880 */  50, 48, 10, 48, 48, 48, 48, 48, 53, 51, 99, 32, 82, 95, 65, 82,
-/* 0x2890 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x28a0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 57,
-/* 0x28b0 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x28c0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x28d0 */  48, 48, 48, 48, 53, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x28e0 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x28f0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 53, 99, 48, 32, 82, 95,
-/* 0x2900 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2910 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2920 */  53,101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2930 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2940 */  10, 48, 48, 48, 48, 48, 53,102, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2950 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2960 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 48, 52, 32,
-/* 0x2970 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2980 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2990 */  48, 48, 54, 50, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x29a0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x29b0 */  50, 48, 10, 48, 48, 48, 48, 48, 54, 52, 56, 32, 82, 95, 65, 82,
-/* 0x29c0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x29d0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54, 56,
-/* 0x29e0 */  48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x29f0 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2a00 */  48, 48, 48, 48, 54, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2a10 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2a20 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 54,100, 48, 32, 82, 95,
-/* 0x2a30 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2a40 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2a50 */  54,101, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2a60 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2a70 */  10, 48, 48, 48, 48, 48, 55, 49, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2a80 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2a90 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 50, 56, 32,
-/* 0x2aa0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2ab0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2ac0 */  48, 48, 55, 54, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2ad0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2ae0 */  50, 48, 10, 48, 48, 48, 48, 48, 55, 55, 99, 32, 82, 95, 65, 82,
-/* 0x2af0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2b00 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 57,
-/* 0x2b10 */  99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2b20 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2b30 */  48, 48, 48, 48, 55, 98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2b40 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2b50 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 55, 99, 52, 32, 82, 95,
-/* 0x2b60 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2b70 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2b80 */  55,100, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2b90 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2ba0 */  10, 48, 48, 48, 48, 48, 55,102, 52, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2bb0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2bc0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 50, 48, 32,
-/* 0x2bd0 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2be0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2bf0 */  48, 48, 56, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2c00 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2c10 */  50, 48, 10, 48, 48, 48, 48, 48, 56, 55, 99, 32, 82, 95, 65, 82,
-/* 0x2c20 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2c30 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56, 56,
-/* 0x2c40 */  56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32,
-/* 0x2c50 */  32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2c60 */  48, 48, 48, 48, 56, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67,
-/* 0x2c70 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2c80 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 56,101, 56, 32, 82, 95,
-/* 0x2c90 */  65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2ca0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2cb0 */  56,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32,
-/* 0x2cc0 */  32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2cd0 */  10, 48, 48, 48, 48, 48, 56,102, 99, 32, 82, 95, 65, 82, 77, 95,
-/* 0x2ce0 */  80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2cf0 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 57, 48, 52, 32,
-/* 0x2d00 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2d10 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2d20 */  48, 48, 57, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52,
-/* 0x2d30 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2d40 */  50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x2d50 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65,
-/* 0x2d60 */  95, 68, 69, 67, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x2d70 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d80 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2d90 */  55, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2da0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x2db0 */  48, 48, 48, 48, 48, 48, 56, 48, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2dc0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2dd0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 56, 56, 32, 82,
-/* 0x2de0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2df0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x2e00 */  48, 48, 97, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2e10 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x2e20 */  48, 10, 48, 48, 48, 48, 48, 48, 97, 99, 32, 82, 95, 65, 82, 77,
-/* 0x2e30 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2e40 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,101, 52,
-/* 0x2e50 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2e60 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x2e70 */  48, 48, 48, 49, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2e80 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2e90 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 48, 99, 32, 82, 95, 65,
-/* 0x2ea0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2eb0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x2ec0 */  49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x2ed0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x2ee0 */  48, 48, 48, 48, 48, 49, 49, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x2ef0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2f00 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82,
-/* 0x2f10 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2f20 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x2f30 */  48, 49, 50, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x2f40 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x2f50 */  48, 10, 48, 48, 48, 48, 48, 49, 52, 52, 32, 82, 95, 65, 82, 77,
-/* 0x2f60 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x2f70 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 52, 99,
-/* 0x2f80 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2f90 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x2fa0 */  48, 48, 48, 49, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x2fb0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2fc0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 56, 48, 32, 82, 95, 65,
-/* 0x2fd0 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2fe0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x2ff0 */  56, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3000 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3010 */  48, 48, 48, 48, 48, 49, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3020 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3030 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 57, 99, 32, 82,
-/* 0x3040 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3050 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3060 */  48, 49, 97, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3070 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3080 */  48, 10, 48, 48, 48, 48, 48, 49, 99, 48, 32, 82, 95, 65, 82, 77,
-/* 0x3090 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x30a0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49, 99, 99,
-/* 0x30b0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x30c0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x30d0 */  48, 48, 48, 49,100, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x30e0 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x30f0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 49,100, 99, 32, 82, 95, 65,
-/* 0x3100 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3110 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 49,
-/* 0x3120 */ 101, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3130 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3140 */  48, 48, 48, 48, 48, 49,101, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3150 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3160 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 50, 56, 32, 82,
-/* 0x3170 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3180 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3190 */  48, 50, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x31a0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x31b0 */  48, 10, 48, 48, 48, 48, 48, 50, 52, 52, 32, 82, 95, 65, 82, 77,
-/* 0x31c0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x31d0 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 52, 99,
-/* 0x31e0 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x31f0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3200 */  48, 48, 48, 50, 53, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3210 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3220 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 54, 56, 32, 82, 95, 65,
-/* 0x3230 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3240 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,
-/* 0x3250 */  56, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3260 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x3270 */  48, 48, 48, 48, 48, 50, 56, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x3280 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3290 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50, 97, 52, 32, 82,
-/* 0x32a0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x32b0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x32c0 */  48, 50, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x32d0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x32e0 */  48, 10, 48, 48, 48, 48, 48, 50,100, 48, 32, 82, 95, 65, 82, 77,
-/* 0x32f0 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3300 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 50,100, 99,
-/* 0x3310 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3320 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3330 */  48, 48, 48, 50,102, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3340 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3350 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 48, 99, 32, 82, 95, 65,
-/* 0x3360 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x3370 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x3380 */  49, 52, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x3390 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x33a0 */  48, 48, 48, 48, 48, 51, 50, 99, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x33b0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x33c0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 53, 48, 32, 82,
-/* 0x33d0 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x33e0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x33f0 */  48, 51, 53, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3400 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3410 */  48, 10, 48, 48, 48, 48, 48, 51, 55, 48, 32, 82, 95, 65, 82, 77,
-/* 0x3420 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3430 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 55, 56,
-/* 0x3440 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3450 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x3460 */  48, 48, 48, 51, 57, 99, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50,
-/* 0x3470 */  52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3480 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 98, 48, 32, 82, 95, 65,
-/* 0x3490 */  82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x34a0 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51,
-/* 0x34b0 */  98, 56, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32,
-/* 0x34c0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x34d0 */  48, 48, 48, 48, 48, 51, 99, 56, 32, 82, 95, 65, 82, 77, 95, 80,
-/* 0x34e0 */  67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95,
-/* 0x34f0 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 51, 99, 99, 32, 82,
-/* 0x3500 */  95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3510 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3520 */  48, 52, 48, 48, 32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32,
-/* 0x3530 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x3540 */  48, 10, 48, 48, 48, 48, 48, 52, 49, 56, 32, 82, 95, 65, 82, 77,
-/* 0x3550 */  95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77,
-/* 0x3560 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 52, 52, 48,
-/* 0x3570 */  32, 82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32,
-/* 0x3580 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x3590 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x35a0 */  83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93,
-/* 0x35b0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x35c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x35d0 */  85, 69, 10, 48, 48, 48, 48, 48, 48,100, 99, 32, 82, 95, 65, 82,
-/* 0x35e0 */  77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76,
-/* 0x35f0 */  70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48,101, 56, 32,
-/* 0x3600 */  82, 95, 65, 82, 77, 95, 80, 67, 50, 52, 32, 32, 32, 32, 32, 32,
-/* 0x3610 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48,
-/* 0x3620 */  48,101, 99, 32, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50, 32,
-/* 0x3630 */  32, 32, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x12a0 */ 229, 30, 48, 12,235,255,255,254,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x12b0 */  21,  0,  0,  0,193,  0,  0,  0,250,  0,  0,  0,  0,  0,  0,  0,
+/* 0x12c0 */  52,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x12d0 */  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x12e0 */  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x12f0 */  64,  0,  0,  0, 44,  1,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1300 */ 108,  1,  0,  0, 24,  1,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1310 */ 132,  2,  0,  0,220,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1320 */  96,  3,  0,  0,172,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1330 */  12,  4,  0,  0, 56,  9,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,
+/* 0x1340 */  68, 13,  0,  0,120,  4,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,
+/* 0x1350 */ 188, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x1360 */ 188, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x1370 */ 188, 17,  0,  0,240,  0,  0,  0,  2,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1380 */   3,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1390 */   0,  0,  0,  0, 39,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13a0 */  45,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x13b0 */   7,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  8,  0,  0,  0,
+/* 0x13c0 */   0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x13d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x13e0 */   1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x13f0 */   0,  0,  0,  0, 78,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1400 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0,
+/* 0x1410 */  13,  0,  0,  0,173,222,173,222,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1420 */   4,  0,  0,  0,119,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1430 */ 142,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,
+/* 0x1440 */   5,  0,  0,  0,  0,  0,  0,  0,188,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1450 */   0,  0,  0,  0,199,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1460 */ 214,  0,  0,  0, 13,  0,  0,  0,173,222,173,222,222,  0,  0,  0,
+/* 0x1470 */  11,  0,  0,  0,240,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1480 */ 227,  0,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1490 */   0,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0, 98,  0,  0,  0,
+/* 0x14a0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 16,  0,  0,  0,
+/* 0x14b0 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14c0 */   3,  0,  0,  0, 92,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x14d0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 96,  0,  0,  0,
+/* 0x14e0 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x14f0 */   3,  0,  0,  0,104,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1500 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,116,  0,  0,  0,
+/* 0x1510 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1520 */   3,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1530 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,140,  0,  0,  0,
+/* 0x1540 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1550 */   3,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1560 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,156,  0,  0,  0,
+/* 0x1570 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1580 */   3,  0,  0,  0,172,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1590 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,180,  0,  0,  0,
+/* 0x15a0 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15b0 */   3,  0,  0,  0,184,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x15c0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,192,  0,  0,  0,
+/* 0x15d0 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x15e0 */   3,  0,  0,  0,196,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x15f0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,208,  0,  0,  0,
+/* 0x1600 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1610 */   3,  0,  0,  0,212,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1620 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,220,  0,  0,  0,
+/* 0x1630 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1640 */   3,  0,  0,  0,232,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1650 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,236,  0,  0,  0,
+/* 0x1660 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1670 */   3,  0,  0,  0,244,  0,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1680 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,252,  0,  0,  0,
+/* 0x1690 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16a0 */   3,  0,  0,  0, 36,  1,  0,  0,239,  0,  0,  0, 27,  0,  0,  0,
+/* 0x16b0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, 40,  1,  0,  0,
+/* 0x16c0 */ 239,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x16d0 */   4,  0,  0,  0, 16,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x16e0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 92,  0,  0,  0,
+/* 0x16f0 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1700 */   4,  0,  0,  0, 96,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1710 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,104,  0,  0,  0,
+/* 0x1720 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1730 */   4,  0,  0,  0,116,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1740 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,128,  0,  0,  0,
+/* 0x1750 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1760 */   4,  0,  0,  0,140,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1770 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,144,  0,  0,  0,
+/* 0x1780 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1790 */   4,  0,  0,  0,156,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x17a0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,172,  0,  0,  0,
+/* 0x17b0 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */   4,  0,  0,  0,180,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x17d0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,188,  0,  0,  0,
+/* 0x17e0 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17f0 */   4,  0,  0,  0,200,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1800 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,208,  0,  0,  0,
+/* 0x1810 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1820 */   4,  0,  0,  0,220,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1830 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,232,  0,  0,  0,
+/* 0x1840 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1850 */   4,  0,  0,  0,236,  0,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1860 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 16,  1,  0,  0,
+/* 0x1870 */ 239,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1880 */   4,  0,  0,  0, 20,  1,  0,  0,239,  0,  0,  0, 33,  0,  0,  0,
+/* 0x1890 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0, 16,  0,  0,  0,
+/* 0x18a0 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18b0 */   5,  0,  0,  0, 96,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,104,  0,  0,  0,
+/* 0x18d0 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18e0 */   5,  0,  0,  0,108,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x18f0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,124,  0,  0,  0,
+/* 0x1900 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */   5,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1920 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,132,  0,  0,  0,
+/* 0x1930 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */   5,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1950 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,160,  0,  0,  0,
+/* 0x1960 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */   5,  0,  0,  0,164,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x1980 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,172,  0,  0,  0,
+/* 0x1990 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   5,  0,  0,  0,180,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,184,  0,  0,  0,
+/* 0x19c0 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */   5,  0,  0,  0,212,  0,  0,  0,239,  0,  0,  0, 39,  0,  0,  0,
+/* 0x19e0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,216,  0,  0,  0,
+/* 0x19f0 */ 239,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */   6,  0,  0,  0,  8,  0,  0,  0,239,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0, 76,  0,  0,  0,
+/* 0x1a20 */ 239,  0,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */   6,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1a40 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,168,  0,  0,  0,
+/* 0x1a50 */ 239,  0,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */   7,  0,  0,  0,116,  0,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,144,  0,  0,  0,
+/* 0x1a80 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   7,  0,  0,  0,184,  0,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,204,  0,  0,  0,
+/* 0x1ab0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   7,  0,  0,  0,244,  0,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  0,  1,  0,  0,
+/* 0x1ae0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */   7,  0,  0,  0,  8,  1,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1b00 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 68,  1,  0,  0,
+/* 0x1b10 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   7,  0,  0,  0,144,  1,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1b30 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,204,  1,  0,  0,
+/* 0x1b40 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */   7,  0,  0,  0,216,  1,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1b60 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  2,  0,  0,
+/* 0x1b70 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   7,  0,  0,  0, 24,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1b90 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 32,  2,  0,  0,
+/* 0x1ba0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   7,  0,  0,  0, 52,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 60,  2,  0,  0,
+/* 0x1bd0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   7,  0,  0,  0, 64,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 76,  2,  0,  0,
+/* 0x1c00 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */   7,  0,  0,  0, 88,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,164,  2,  0,  0,
+/* 0x1c30 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */   7,  0,  0,  0,200,  2,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,232,  2,  0,  0,
+/* 0x1c60 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   7,  0,  0,  0,  4,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 12,  3,  0,  0,
+/* 0x1c90 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   7,  0,  0,  0, 60,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,136,  3,  0,  0,
+/* 0x1cc0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   7,  0,  0,  0,160,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,168,  3,  0,  0,
+/* 0x1cf0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   7,  0,  0,  0,204,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,224,  3,  0,  0,
+/* 0x1d20 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */   7,  0,  0,  0,232,  3,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 36,  4,  0,  0,
+/* 0x1d50 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */   7,  0,  0,  0, 56,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,108,  4,  0,  0,
+/* 0x1d80 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */   7,  0,  0,  0,132,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,140,  4,  0,  0,
+/* 0x1db0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   7,  0,  0,  0,176,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,212,  4,  0,  0,
+/* 0x1de0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   7,  0,  0,  0,236,  4,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  4,  0,  0,
+/* 0x1e10 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */   7,  0,  0,  0, 24,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 60,  5,  0,  0,
+/* 0x1e40 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */   7,  0,  0,  0,152,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,160,  5,  0,  0,
+/* 0x1e70 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */   7,  0,  0,  0,192,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,228,  5,  0,  0,
+/* 0x1ea0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   7,  0,  0,  0,252,  5,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  6,  0,  0,
+/* 0x1ed0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   7,  0,  0,  0, 36,  6,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 72,  6,  0,  0,
+/* 0x1f00 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   7,  0,  0,  0,128,  6,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,140,  6,  0,  0,
+/* 0x1f30 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   7,  0,  0,  0,208,  6,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,236,  6,  0,  0,
+/* 0x1f60 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   7,  0,  0,  0, 28,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 40,  7,  0,  0,
+/* 0x1f90 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   7,  0,  0,  0,108,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,124,  7,  0,  0,
+/* 0x1fc0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   7,  0,  0,  0,156,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,184,  7,  0,  0,
+/* 0x1ff0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */   7,  0,  0,  0,196,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,208,  7,  0,  0,
+/* 0x2020 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */   7,  0,  0,  0,244,  7,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 32,  8,  0,  0,
+/* 0x2050 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */   7,  0,  0,  0, 44,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,124,  8,  0,  0,
+/* 0x2080 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */   7,  0,  0,  0,136,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,160,  8,  0,  0,
+/* 0x20b0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */   7,  0,  0,  0,232,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,244,  8,  0,  0,
+/* 0x20e0 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */   7,  0,  0,  0,252,  8,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  9,  0,  0,
+/* 0x2110 */ 239,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */   7,  0,  0,  0, 40,  9,  0,  0,239,  0,  0,  0, 56,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,120,  0,  0,  0,
+/* 0x2140 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */   8,  0,  0,  0,128,  0,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,136,  0,  0,  0,
+/* 0x2170 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */   8,  0,  0,  0,168,  0,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,172,  0,  0,  0,
+/* 0x21a0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21b0 */   8,  0,  0,  0,228,  0,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  1,  0,  0,
+/* 0x21d0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21e0 */   8,  0,  0,  0, 12,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 20,  1,  0,  0,
+/* 0x2200 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2210 */   8,  0,  0,  0, 24,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 32,  1,  0,  0,
+/* 0x2230 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2240 */   8,  0,  0,  0, 40,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 68,  1,  0,  0,
+/* 0x2260 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2270 */   8,  0,  0,  0, 76,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  1,  0,  0,
+/* 0x2290 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22a0 */   8,  0,  0,  0,128,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,136,  1,  0,  0,
+/* 0x22c0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22d0 */   8,  0,  0,  0,140,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,156,  1,  0,  0,
+/* 0x22f0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2300 */   8,  0,  0,  0,160,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2310 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,192,  1,  0,  0,
+/* 0x2320 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2330 */   8,  0,  0,  0,204,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2340 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,212,  1,  0,  0,
+/* 0x2350 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2360 */   8,  0,  0,  0,220,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2370 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,228,  1,  0,  0,
+/* 0x2380 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2390 */   8,  0,  0,  0,236,  1,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 40,  2,  0,  0,
+/* 0x23b0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23c0 */   8,  0,  0,  0, 44,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 68,  2,  0,  0,
+/* 0x23e0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23f0 */   8,  0,  0,  0, 76,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  2,  0,  0,
+/* 0x2410 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2420 */   8,  0,  0,  0,104,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,132,  2,  0,  0,
+/* 0x2440 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2450 */   8,  0,  0,  0,140,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,164,  2,  0,  0,
+/* 0x2470 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2480 */   8,  0,  0,  0,200,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2490 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,208,  2,  0,  0,
+/* 0x24a0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24b0 */   8,  0,  0,  0,220,  2,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,244,  2,  0,  0,
+/* 0x24d0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24e0 */   8,  0,  0,  0, 12,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 20,  3,  0,  0,
+/* 0x2500 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2510 */   8,  0,  0,  0, 44,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2520 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 80,  3,  0,  0,
+/* 0x2530 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2540 */   8,  0,  0,  0, 88,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2550 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,112,  3,  0,  0,
+/* 0x2560 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2570 */   8,  0,  0,  0,120,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2580 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,156,  3,  0,  0,
+/* 0x2590 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25a0 */   8,  0,  0,  0,176,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,184,  3,  0,  0,
+/* 0x25c0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25d0 */   8,  0,  0,  0,200,  3,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,204,  3,  0,  0,
+/* 0x25f0 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2600 */   8,  0,  0,  0,  0,  4,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2610 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0, 24,  4,  0,  0,
+/* 0x2620 */ 239,  0,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2630 */   8,  0,  0,  0, 64,  4,  0,  0,239,  0,  0,  0, 67,  0,  0,  0,
+/* 0x2640 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,220,  0,  0,  0,
+/* 0x2650 */ 239,  0,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2660 */  11,  0,  0,  0,232,  0,  0,  0,239,  0,  0,  0, 98,  0,  0,  0,
+/* 0x2670 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,236,  0,  0,  0,
+/* 0x2680 */ 227,  0,  0,  0,214,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2690 */  69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 95, 72, 69, 65,
+/* 0x26a0 */  68,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 78, 82, 86, 50, 69,
+/* 0x26b0 */   0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77,
+/* 0x26c0 */  65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x26d0 */  50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90,
+/* 0x26e0 */  77, 65, 95, 68, 69, 67, 51, 48,  0, 69, 76, 70, 77, 65, 73, 78,
+/* 0x26f0 */  89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 77, 70, 76, 71,  0,
+/* 0x2700 */  95,115,116, 97,114,116,  0,117, 99,108, 95,110,114,118, 50,101,
+/* 0x2710 */  95,100,101, 99,111,109,112,114,101,115,115, 95, 56,  0,117, 99,
+/* 0x2720 */ 108, 95,110,114,118, 50,100, 95,100,101, 99,111,109,112,114,101,
+/* 0x2730 */ 115,115, 95, 56,  0,117, 99,108, 95,110,114,118, 50, 98, 95,100,
+/* 0x2740 */ 101, 99,111,109,112,114,101,115,115, 95, 56,  0, 76,122,109, 97,
+/* 0x2750 */  68,101, 99,111,100,101,  0,101,110,100, 95,100,101, 99,111,109,
+/* 0x2760 */ 112,114,101,115,115,  0, 79, 95, 66, 73, 78, 70, 79,  0, 99,112,
+/* 0x2770 */ 114, 48,  0, 82, 95, 65, 82, 77, 95, 65, 66, 83, 51, 50,  0, 82,
+/* 0x2780 */  95, 65, 82, 77, 95, 80, 67, 50, 52,  0,172, 18,  0,  0, 85, 80,
+/* 0x2790 */  88, 76, 78, 75, 48, 49
 };
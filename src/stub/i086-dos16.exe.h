@@ -1,5 +1,5 @@
 /* i086-dos16.exe.h
-   created from i086-dos16.exe.bin, 26112 (0x6600) bytes
+   created from i086-dos16.exe.bin, 16618 (0x40ea) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I086_DOS16_EXE_SIZE    26112
-#define STUB_I086_DOS16_EXE_ADLER32 0x1abb93ec
-#define STUB_I086_DOS16_EXE_CRC32   0x4d7ec6d3
+#define STUB_I086_DOS16_EXE_SIZE    16618
+#define STUB_I086_DOS16_EXE_ADLER32 0x9bddd562
+#define STUB_I086_DOS16_EXE_CRC32   0x484bacac
 
-unsigned char stub_i086_dos16_exe[26112] = {
+unsigned char stub_i086_dos16_exe[16618] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  12, 44,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -672,1000 +672,407 @@ unsigned char stub_i086_dos16_exe[26112] = {
 /* 0x2790 */  17,129,199,254,  0,114,  8,226, 22,  7,  6, 31,157,114, 16,  7,
 /* 0x27a0 */  31, 93, 95, 94, 91, 88,142,208,137,220, 90, 89, 91, 88,203,141,
 /* 0x27b0 */ 134,  0,  0,142,208,188,  0,  0,234,  0,  0,  0,  0,129,197,  0,
-/* 0x27c0 */   0, 85,184,  0,  0, 80,203,102,105,108,101, 32,102,111,114,109,
-/* 0x27d0 */  97,116, 32,101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,
-/* 0x27e0 */ 101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,
-/* 0x27f0 */ 101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32,
-/* 0x2800 */  32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x2810 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,
-/* 0x2820 */ 102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32,
-/* 0x2830 */  32, 48, 32, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82, 89, 32, 32,
-/* 0x2840 */  32, 48, 50,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 32,
-/* 0x2850 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2860 */  32, 32, 49, 32, 76, 90, 77, 65, 68, 69, 86, 73, 67, 69, 32, 32,
-/* 0x2870 */  32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 54, 49, 32,
-/* 0x2880 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2890 */  32, 32, 50, 32, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82, 89, 50,
-/* 0x28a0 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 54, 54, 32,
-/* 0x28b0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x28c0 */  32, 32, 51, 32, 76, 90, 77, 65, 69, 78, 84, 82, 89, 32, 32, 32,
-/* 0x28d0 */  32, 32, 48, 49, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 54, 57,
-/* 0x28e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x28f0 */  10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 49, 54, 48, 32, 32, 32,
-/* 0x2900 */  32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 55, 97,
-/* 0x2910 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2920 */  10, 32, 32, 53, 32, 78, 82, 86, 68, 68, 79, 78, 69, 32, 32, 32,
-/* 0x2930 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 52,
-/* 0x2940 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2950 */  10, 32, 32, 54, 32, 78, 82, 86, 68, 82, 69, 84, 85, 32, 32, 32,
-/* 0x2960 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 54,
-/* 0x2970 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2980 */  10, 32, 32, 55, 32, 78, 82, 86, 68, 69, 67, 79, 49, 32, 32, 32,
-/* 0x2990 */  32, 32, 32, 48, 49,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56,
-/* 0x29a0 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x29b0 */  83, 10, 32, 32, 56, 32, 78, 82, 86, 76, 69, 68, 48, 48, 32, 32,
-/* 0x29c0 */  32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 97,
-/* 0x29d0 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x29e0 */  83, 10, 32, 32, 57, 32, 78, 82, 86, 71, 84, 68, 48, 48, 32, 32,
-/* 0x29f0 */  32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 97,
-/* 0x2a00 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2a10 */  83, 10, 32, 49, 48, 32, 78, 82, 86, 68, 69, 67, 79, 50, 32, 32,
-/* 0x2a20 */  32, 32, 32, 32, 48, 49, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2a30 */  97,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2a40 */  84, 83, 10, 32, 49, 49, 32, 67, 65, 76, 76, 84, 82, 49, 54, 32,
-/* 0x2a50 */  32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2a60 */  99, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2a70 */  84, 83, 10, 32, 49, 50, 32, 67, 84, 49, 54, 73, 50, 56, 54, 32,
-/* 0x2a80 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2a90 */ 100, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2aa0 */  84, 83, 10, 32, 49, 51, 32, 67, 84, 49, 54, 83, 85, 66, 48, 32,
-/* 0x2ab0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2ac0 */ 100, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2ad0 */  84, 83, 10, 32, 49, 52, 32, 67, 84, 49, 54, 73, 48, 56, 54, 32,
-/* 0x2ae0 */  32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2af0 */ 100, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b00 */  84, 83, 10, 32, 49, 53, 32, 67, 65, 76, 76, 84, 82, 73, 50, 32,
-/* 0x2b10 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2b20 */ 100,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b30 */  84, 83, 10, 32, 49, 54, 32, 67, 84, 49, 54, 69, 56, 48, 48, 32,
-/* 0x2b40 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2b50 */ 101, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b60 */  84, 83, 10, 32, 49, 55, 32, 67, 84, 49, 54, 69, 57, 48, 48, 32,
-/* 0x2b70 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2b80 */ 101, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b90 */  84, 83, 10, 32, 49, 56, 32, 67, 65, 76, 76, 84, 82, 73, 53, 32,
-/* 0x2ba0 */  32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2bb0 */ 101, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2bc0 */  84, 83, 10, 32, 49, 57, 32, 67, 84, 49, 54, 74, 69, 78, 68, 32,
-/* 0x2bd0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2be0 */ 101, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2bf0 */  84, 83, 10, 32, 50, 48, 32, 67, 84, 49, 54, 74, 85, 76, 50, 32,
-/* 0x2c00 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2c10 */ 101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2c20 */  84, 83, 10, 32, 50, 49, 32, 67, 84, 49, 54, 73, 50, 56, 55, 32,
-/* 0x2c30 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2c40 */ 101,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2c50 */  84, 83, 10, 32, 50, 50, 32, 67, 84, 49, 54, 83, 85, 66, 49, 32,
-/* 0x2c60 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2c70 */ 102, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2c80 */  84, 83, 10, 32, 50, 51, 32, 67, 84, 49, 54, 73, 48, 56, 55, 32,
-/* 0x2c90 */  32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2ca0 */ 102, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2cb0 */  84, 83, 10, 32, 50, 52, 32, 67, 65, 76, 76, 84, 82, 73, 54, 32,
-/* 0x2cc0 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2cd0 */ 102, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2ce0 */  84, 83, 10, 32, 50, 53, 32, 69, 88, 69, 69, 78, 84, 82, 89, 32,
-/* 0x2cf0 */  32, 32, 32, 32, 32, 48, 49, 99, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2d00 */  48,102,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2d10 */  78, 84, 83, 10, 32, 50, 54, 32, 76, 79, 78, 71, 83, 85, 66, 32,
-/* 0x2d20 */  32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2d30 */  48, 49, 49, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2d40 */  69, 78, 84, 83, 10, 32, 50, 55, 32, 83, 72, 79, 82, 84, 83, 85,
-/* 0x2d50 */  66, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2d60 */  32, 48, 49, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2d70 */  84, 69, 78, 84, 83, 10, 32, 50, 56, 32, 74, 78, 67, 68, 79, 67,
-/* 0x2d80 */  79, 80, 89, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x2d90 */  32, 32, 48, 49, 50, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2da0 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 57, 32, 69, 88, 69, 82, 69,
-/* 0x2db0 */  76, 80, 85, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32,
-/* 0x2dc0 */  48, 32, 32, 48, 49, 50, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2dd0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 48, 32, 69, 88, 69, 77,
-/* 0x2de0 */  65, 73, 78, 52, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32,
-/* 0x2df0 */  32, 48, 32, 32, 48, 49, 50, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2e00 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 49, 32, 69, 88, 69,
-/* 0x2e10 */  77, 65, 73, 78, 52, 66, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x2e20 */  32, 32, 48, 32, 32, 48, 49, 51, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2e30 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 50, 32, 69, 88,
-/* 0x2e40 */  69, 77, 65, 73, 78, 52, 67, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x2e50 */  48, 32, 32, 48, 32, 32, 48, 49, 51, 55, 32, 32, 50, 42, 42, 48,
-/* 0x2e60 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 51, 32, 67,
-/* 0x2e70 */  79, 77, 80, 82, 69, 83, 83, 69, 68, 95, 76, 90, 77, 65, 95, 83,
-/* 0x2e80 */  84, 65, 82, 84, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2e90 */  51, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2ea0 */  84, 83, 10, 32, 51, 52, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32,
-/* 0x2eb0 */  32, 32, 32, 32, 32, 48, 49, 98, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2ec0 */  48, 49, 51, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2ed0 */  69, 78, 84, 83, 10, 32, 51, 53, 32, 69, 88, 69, 67, 85, 84, 80,
-/* 0x2ee0 */  79, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2ef0 */  48, 49, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2f00 */  69, 78, 84, 83, 10, 32, 51, 54, 32, 78, 82, 86, 50, 66, 49, 54,
-/* 0x2f10 */  83, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2f20 */  32, 48, 49, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2f30 */  84, 69, 78, 84, 83, 10, 32, 51, 55, 32, 78, 50, 66, 54, 52, 75,
-/* 0x2f40 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48,
-/* 0x2f50 */  32, 32, 48, 49, 54, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2f60 */  78, 84, 69, 78, 84, 83, 10, 32, 51, 56, 32, 78, 82, 86, 50, 66,
-/* 0x2f70 */  69, 88, 49, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32,
-/* 0x2f80 */  48, 32, 32, 48, 49, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2f90 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 57, 32, 78, 50, 66, 88,
-/* 0x2fa0 */  56, 54, 48, 49, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32,
-/* 0x2fb0 */  32, 48, 32, 32, 48, 49, 55, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2fc0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 48, 32, 78, 50, 66,
-/* 0x2fd0 */  50, 56, 54, 48, 49, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x2fe0 */  32, 32, 48, 32, 32, 48, 49, 55,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2ff0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 49, 32, 78, 82,
-/* 0x3000 */  86, 50, 66, 69, 88, 50, 32, 32, 32, 32, 32, 32, 48, 51, 49, 32,
-/* 0x3010 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 50, 32, 32, 50, 42, 42,
-/* 0x3020 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 50, 32,
-/* 0x3030 */  78, 50, 66, 88, 56, 54, 48, 50, 32, 32, 32, 32, 32, 32, 48,101,
-/* 0x3040 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 51, 32, 32, 50, 42,
-/* 0x3050 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 51,
-/* 0x3060 */  32, 78, 50, 66, 50, 56, 54, 48, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3070 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 99, 49, 32, 32, 50,
-/* 0x3080 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52,
-/* 0x3090 */  52, 32, 78, 82, 86, 50, 66, 69, 88, 51, 32, 32, 32, 32, 32, 32,
-/* 0x30a0 */  48, 49, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 99, 55, 32,
-/* 0x30b0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x30c0 */  32, 52, 53, 32, 78, 50, 66, 54, 52, 75, 48, 50, 32, 32, 32, 32,
-/* 0x30d0 */  32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100, 99,
-/* 0x30e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x30f0 */  10, 32, 52, 54, 32, 78, 82, 86, 50, 66, 69, 88, 57, 32, 32, 32,
-/* 0x3100 */  32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,101,
-/* 0x3110 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3120 */  83, 10, 32, 52, 55, 32, 78, 82, 86, 50, 68, 49, 54, 83, 32, 32,
-/* 0x3130 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3140 */ 101, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3150 */  84, 83, 10, 32, 52, 56, 32, 78, 50, 68, 54, 52, 75, 48, 49, 32,
-/* 0x3160 */  32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3170 */  49,102, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3180 */  78, 84, 83, 10, 32, 52, 57, 32, 78, 82, 86, 50, 68, 69, 88, 49,
-/* 0x3190 */  32, 32, 32, 32, 32, 32, 48, 49, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x31a0 */  32, 48, 50, 48, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x31b0 */  84, 69, 78, 84, 83, 10, 32, 53, 48, 32, 78, 50, 68, 88, 56, 54,
-/* 0x31c0 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48,
-/* 0x31d0 */  32, 32, 48, 50, 49, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x31e0 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 49, 32, 78, 50, 68, 50, 56,
-/* 0x31f0 */  54, 48, 49, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x3200 */  48, 32, 32, 48, 50, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3210 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 50, 32, 78, 82, 86, 50,
-/* 0x3220 */  68, 69, 88, 50, 32, 32, 32, 32, 32, 32, 48, 51, 57, 32, 32, 48,
-/* 0x3230 */  32, 32, 48, 32, 32, 48, 50, 49,102, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3240 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 51, 32, 78, 50,
-/* 0x3250 */  68, 88, 56, 54, 48, 50, 32, 32, 32, 32, 32, 32, 48,101, 32, 32,
-/* 0x3260 */  48, 32, 32, 48, 32, 32, 48, 50, 53, 56, 32, 32, 50, 42, 42, 48,
-/* 0x3270 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 52, 32, 78,
-/* 0x3280 */  50, 68, 50, 56, 54, 48, 50, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x3290 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 54, 54, 32, 32, 50, 42, 42,
-/* 0x32a0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 53, 32,
-/* 0x32b0 */  78, 82, 86, 50, 68, 69, 88, 51, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x32c0 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 54, 99, 32, 32, 50,
-/* 0x32d0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x32e0 */  54, 32, 78, 50, 68, 54, 52, 75, 48, 50, 32, 32, 32, 32, 32, 32,
-/* 0x32f0 */  48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 49, 32, 32,
-/* 0x3300 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x3310 */  53, 55, 32, 78, 82, 86, 50, 68, 69, 88, 57, 32, 32, 32, 32, 32,
-/* 0x3320 */  32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 99, 32,
-/* 0x3330 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3340 */  32, 53, 56, 32, 78, 82, 86, 50, 69, 49, 54, 83, 32, 32, 32, 32,
-/* 0x3350 */  32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 57, 48,
-/* 0x3360 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3370 */  10, 32, 53, 57, 32, 78, 50, 69, 54, 52, 75, 48, 49, 32, 32, 32,
-/* 0x3380 */  32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 57,
-/* 0x3390 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x33a0 */  83, 10, 32, 54, 48, 32, 78, 82, 86, 50, 69, 69, 88, 49, 32, 32,
-/* 0x33b0 */  32, 32, 32, 32, 48, 49, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x33c0 */  50, 97, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x33d0 */  78, 84, 83, 10, 32, 54, 49, 32, 78, 50, 69, 88, 56, 54, 48, 49,
-/* 0x33e0 */  32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x33f0 */  48, 50, 98, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3400 */  69, 78, 84, 83, 10, 32, 54, 50, 32, 78, 50, 69, 50, 56, 54, 48,
-/* 0x3410 */  49, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3420 */  32, 48, 50, 99, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3430 */  84, 69, 78, 84, 83, 10, 32, 54, 51, 32, 78, 82, 86, 50, 69, 69,
-/* 0x3440 */  88, 50, 32, 32, 32, 32, 32, 32, 48, 51,101, 32, 32, 48, 32, 32,
-/* 0x3450 */  48, 32, 32, 48, 50, 99, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3460 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 52, 32, 78, 50, 69, 88,
-/* 0x3470 */  56, 54, 48, 50, 32, 32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32,
-/* 0x3480 */  32, 48, 32, 32, 48, 51, 48, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3490 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 53, 32, 78, 50, 69,
-/* 0x34a0 */  50, 56, 54, 48, 50, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48,
-/* 0x34b0 */  32, 32, 48, 32, 32, 48, 51, 49, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x34c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 54, 32, 78, 82,
-/* 0x34d0 */  86, 50, 69, 69, 88, 51, 32, 32, 32, 32, 32, 32, 48, 49, 53, 32,
-/* 0x34e0 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 49, 54, 32, 32, 50, 42, 42,
-/* 0x34f0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 55, 32,
-/* 0x3500 */  78, 50, 69, 54, 52, 75, 48, 50, 32, 32, 32, 32, 32, 32, 48, 98,
-/* 0x3510 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 50, 98, 32, 32, 50, 42,
-/* 0x3520 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 56,
-/* 0x3530 */  32, 78, 82, 86, 50, 69, 69, 88, 57, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3540 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 51, 54, 32, 32, 50,
-/* 0x3550 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54,
-/* 0x3560 */  57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32,
-/* 0x3570 */  48, 51, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 51, 97, 32,
-/* 0x3580 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3590 */  32, 55, 48, 32,105,103,110,111,114,101, 95,114,101,108,111, 99,
-/* 0x35a0 */  95,111,118,101,114,102,108,111,119, 32, 48, 56, 32, 32, 48, 32,
-/* 0x35b0 */  32, 48, 32, 32, 48, 51, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x35c0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 49, 32, 76, 90, 77,
-/* 0x35d0 */  65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 49, 49, 57, 98,
-/* 0x35e0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 55, 52, 32, 32, 50, 42,
-/* 0x35f0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 50,
-/* 0x3600 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48,
-/* 0x3610 */  49, 50, 50,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 53, 48,
-/* 0x3620 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3630 */  83, 10, 32, 55, 51, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x3640 */  32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x3650 */  55, 51,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3660 */  78, 84, 83, 10, 32, 55, 52, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3670 */  51, 49, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3680 */  48, 50, 55, 51,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3690 */  84, 69, 78, 84, 83, 10, 32, 55, 53, 32, 76, 90, 77, 65, 95, 68,
-/* 0x36a0 */  69, 67, 51, 50, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x36b0 */  32, 32, 48, 50, 55, 52, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x36c0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 54, 32, 76, 90, 77, 65,
-/* 0x36d0 */  95, 68, 69, 67, 51, 51, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32,
-/* 0x36e0 */  32, 48, 32, 32, 48, 50, 55, 53, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x36f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 55, 32, 69, 88,
-/* 0x3700 */  69, 77, 65, 73, 78, 53, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32,
-/* 0x3710 */  48, 32, 32, 48, 32, 32, 48, 50, 55, 53, 55, 32, 32, 50, 42, 42,
-/* 0x3720 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 56, 32,
-/* 0x3730 */  69, 88, 69, 65, 68, 74, 85, 83, 32, 32, 32, 32, 32, 32, 48, 55,
-/* 0x3740 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 53, 56, 32, 32, 50,
-/* 0x3750 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55,
-/* 0x3760 */  57, 32, 69, 88, 69, 78, 79, 65, 68, 74, 32, 32, 32, 32, 32, 32,
-/* 0x3770 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 53,102, 32,
-/* 0x3780 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3790 */  32, 56, 48, 32, 69, 88, 69, 82, 69, 76, 79, 49, 32, 32, 32, 32,
-/* 0x37a0 */  32, 32, 48, 49,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55,
-/* 0x37b0 */  54, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x37c0 */  84, 83, 10, 32, 56, 49, 32, 69, 88, 69, 82, 69, 76, 57, 65, 32,
-/* 0x37d0 */  32, 32, 32, 32, 32, 48, 49, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x37e0 */  48, 50, 55, 55,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x37f0 */  84, 69, 78, 84, 83, 10, 32, 56, 50, 32, 69, 88, 69, 82, 69, 76,
-/* 0x3800 */  79, 50, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48,
-/* 0x3810 */  32, 32, 48, 50, 55, 57, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3820 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 51, 32, 69, 88, 69, 82,
-/* 0x3830 */  69, 66, 73, 71, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x3840 */  32, 48, 32, 32, 48, 50, 55, 57, 53, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3850 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 52, 32, 69, 88,
-/* 0x3860 */  69, 82, 69, 76, 79, 51, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x3870 */  48, 32, 32, 48, 32, 32, 48, 50, 55, 57, 55, 32, 32, 50, 42, 42,
-/* 0x3880 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 53, 32,
-/* 0x3890 */  69, 88, 69, 77, 65, 73, 78, 56, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x38a0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 57, 57, 32, 32, 50,
-/* 0x38b0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56,
-/* 0x38c0 */  54, 32, 68, 69, 86, 73, 67, 69, 69, 78, 68, 32, 32, 32, 32, 32,
-/* 0x38d0 */  48, 49, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 57, 99,
-/* 0x38e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x38f0 */  10, 32, 56, 55, 32, 69, 88, 69, 83, 84, 65, 67, 75, 32, 32, 32,
-/* 0x3900 */  32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55,
-/* 0x3910 */  97,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3920 */  84, 83, 10, 32, 56, 56, 32, 69, 88, 69, 83, 84, 65, 83, 80, 32,
-/* 0x3930 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3940 */  50, 55, 98, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3950 */  69, 78, 84, 83, 10, 32, 56, 57, 32, 69, 88, 69, 74, 85, 77, 80,
-/* 0x3960 */  70, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3970 */  32, 48, 50, 55, 98, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3980 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 48, 32, 69, 88, 69, 82, 67,
-/* 0x3990 */  83, 80, 79, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32,
-/* 0x39a0 */  48, 32, 32, 48, 50, 55, 98,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x39b0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 49, 32, 69, 88, 69,
-/* 0x39c0 */  82, 69, 84, 73, 80, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48,
-/* 0x39d0 */  32, 32, 48, 32, 32, 48, 50, 55, 99, 49, 32, 32, 50, 42, 42, 48,
-/* 0x39e0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79,
-/* 0x39f0 */  76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 68, 69, 86, 73, 67, 69,
-/* 0x3a10 */  69, 78, 84, 82, 89, 32, 48, 32, 68, 69, 86, 73, 67, 69, 69, 78,
-/* 0x3a20 */  84, 82, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3a30 */  32, 32,100, 32, 32, 67, 79, 77, 80, 82, 69, 83, 83, 69, 68, 95,
-/* 0x3a40 */  76, 90, 77, 65, 95, 83, 84, 65, 82, 84, 32, 48, 32, 67, 79, 77,
-/* 0x3a50 */  80, 82, 69, 83, 83, 69, 68, 95, 76, 90, 77, 65, 95, 83, 84, 65,
-/* 0x3a60 */  82, 84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3a70 */  32,100, 32, 32, 78, 82, 86, 50, 66, 49, 54, 48, 32, 48, 32, 78,
-/* 0x3a80 */  82, 86, 50, 66, 49, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a90 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 68, 69, 67, 79,
-/* 0x3aa0 */  50, 32, 48, 32, 78, 82, 86, 68, 69, 67, 79, 50, 10, 48, 48, 48,
-/* 0x3ab0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x3ac0 */  76, 76, 84, 82, 49, 54, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x3ad0 */  54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3ae0 */ 100, 32, 32, 67, 65, 76, 76, 84, 82, 73, 53, 32, 48, 32, 67, 65,
-/* 0x3af0 */  76, 76, 84, 82, 73, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3b00 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 73, 54,
-/* 0x3b10 */  32, 48, 32, 67, 65, 76, 76, 84, 82, 73, 54, 10, 48, 48, 48, 48,
-/* 0x3b20 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69,
-/* 0x3b30 */  69, 78, 84, 82, 89, 32, 48, 32, 69, 88, 69, 69, 78, 84, 82, 89,
-/* 0x3b40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3b50 */  32, 32, 78, 82, 86, 50, 66, 49, 54, 83, 32, 48, 32, 78, 82, 86,
-/* 0x3b60 */  50, 66, 49, 54, 83, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3b70 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66, 69, 88, 50, 32,
-/* 0x3b80 */  48, 32, 78, 82, 86, 50, 66, 69, 88, 50, 10, 48, 48, 48, 48, 48,
-/* 0x3b90 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x3ba0 */  66, 69, 88, 51, 32, 48, 32, 78, 82, 86, 50, 66, 69, 88, 51, 10,
-/* 0x3bb0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3bc0 */  32, 78, 82, 86, 50, 66, 69, 88, 57, 32, 48, 32, 78, 82, 86, 50,
-/* 0x3bd0 */  66, 69, 88, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3be0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 49, 54, 83, 32, 48,
-/* 0x3bf0 */  32, 78, 82, 86, 50, 68, 49, 54, 83, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3c00 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68,
-/* 0x3c10 */  69, 88, 50, 32, 48, 32, 78, 82, 86, 50, 68, 69, 88, 50, 10, 48,
-/* 0x3c20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3c30 */  78, 82, 86, 50, 68, 69, 88, 51, 32, 48, 32, 78, 82, 86, 50, 68,
-/* 0x3c40 */  69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3c50 */  32, 32,100, 32, 32, 78, 82, 86, 50, 68, 69, 88, 57, 32, 48, 32,
-/* 0x3c60 */  78, 82, 86, 50, 68, 69, 88, 57, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c70 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 49,
-/* 0x3c80 */  54, 83, 32, 48, 32, 78, 82, 86, 50, 69, 49, 54, 83, 10, 48, 48,
-/* 0x3c90 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3ca0 */  82, 86, 50, 69, 69, 88, 50, 32, 48, 32, 78, 82, 86, 50, 69, 69,
-/* 0x3cb0 */  88, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3cc0 */  32,100, 32, 32, 78, 82, 86, 50, 69, 69, 88, 51, 32, 48, 32, 78,
-/* 0x3cd0 */  82, 86, 50, 69, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ce0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 69, 88,
-/* 0x3cf0 */  57, 32, 48, 32, 78, 82, 86, 50, 69, 69, 88, 57, 10, 48, 48, 48,
-/* 0x3d00 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x3d10 */  77, 65, 95, 68, 69, 67, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x3d20 */  68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3d30 */  32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x3d40 */  50, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 50, 10, 48,
-/* 0x3d50 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3d60 */  69, 88, 69, 82, 69, 76, 79, 49, 32, 48, 32, 69, 88, 69, 82, 69,
-/* 0x3d70 */  76, 79, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3d80 */  32, 32,100, 32, 32, 69, 88, 69, 82, 69, 76, 79, 50, 32, 48, 32,
-/* 0x3d90 */  69, 88, 69, 82, 69, 76, 79, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3da0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 68, 69,
-/* 0x3db0 */  86, 73, 67, 69, 32, 48, 32, 76, 90, 77, 65, 68, 69, 86, 73, 67,
-/* 0x3dc0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3dd0 */ 100, 32, 32, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82, 89, 50, 32,
-/* 0x3de0 */  48, 32, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82, 89, 50, 10, 48,
-/* 0x3df0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3e00 */  76, 90, 77, 65, 69, 78, 84, 82, 89, 32, 48, 32, 76, 90, 77, 65,
-/* 0x3e10 */  69, 78, 84, 82, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3e20 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 68, 68, 79, 78, 69, 32,
-/* 0x3e30 */  48, 32, 78, 82, 86, 68, 68, 79, 78, 69, 10, 48, 48, 48, 48, 48,
-/* 0x3e40 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 68,
-/* 0x3e50 */  82, 69, 84, 85, 32, 48, 32, 78, 82, 86, 68, 82, 69, 84, 85, 10,
-/* 0x3e60 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3e70 */  32, 78, 82, 86, 68, 69, 67, 79, 49, 32, 48, 32, 78, 82, 86, 68,
-/* 0x3e80 */  69, 67, 79, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3e90 */  32, 32, 32,100, 32, 32, 78, 82, 86, 76, 69, 68, 48, 48, 32, 48,
-/* 0x3ea0 */  32, 78, 82, 86, 76, 69, 68, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3eb0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 71, 84,
-/* 0x3ec0 */  68, 48, 48, 32, 48, 32, 78, 82, 86, 71, 84, 68, 48, 48, 10, 48,
-/* 0x3ed0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3ee0 */  67, 84, 49, 54, 73, 50, 56, 54, 32, 48, 32, 67, 84, 49, 54, 73,
-/* 0x3ef0 */  50, 56, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3f00 */  32, 32,100, 32, 32, 67, 84, 49, 54, 83, 85, 66, 48, 32, 48, 32,
-/* 0x3f10 */  67, 84, 49, 54, 83, 85, 66, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f20 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 49, 54, 73, 48,
-/* 0x3f30 */  56, 54, 32, 48, 32, 67, 84, 49, 54, 73, 48, 56, 54, 10, 48, 48,
-/* 0x3f40 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x3f50 */  65, 76, 76, 84, 82, 73, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3f60 */  73, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3f70 */  32,100, 32, 32, 67, 84, 49, 54, 69, 56, 48, 48, 32, 48, 32, 67,
-/* 0x3f80 */  84, 49, 54, 69, 56, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f90 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 49, 54, 69, 57, 48,
-/* 0x3fa0 */  48, 32, 48, 32, 67, 84, 49, 54, 69, 57, 48, 48, 10, 48, 48, 48,
-/* 0x3fb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x3fc0 */  49, 54, 74, 69, 78, 68, 32, 48, 32, 67, 84, 49, 54, 74, 69, 78,
-/* 0x3fd0 */  68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3fe0 */ 100, 32, 32, 67, 84, 49, 54, 74, 85, 76, 50, 32, 48, 32, 67, 84,
-/* 0x3ff0 */  49, 54, 74, 85, 76, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4000 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 49, 54, 73, 50, 56, 55,
-/* 0x4010 */  32, 48, 32, 67, 84, 49, 54, 73, 50, 56, 55, 10, 48, 48, 48, 48,
-/* 0x4020 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 49,
-/* 0x4030 */  54, 83, 85, 66, 49, 32, 48, 32, 67, 84, 49, 54, 83, 85, 66, 49,
-/* 0x4040 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4050 */  32, 32, 67, 84, 49, 54, 73, 48, 56, 55, 32, 48, 32, 67, 84, 49,
-/* 0x4060 */  54, 73, 48, 56, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4070 */  32, 32, 32, 32,100, 32, 32, 76, 79, 78, 71, 83, 85, 66, 32, 48,
-/* 0x4080 */  32, 76, 79, 78, 71, 83, 85, 66, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4090 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 83, 72, 79, 82, 84, 83,
-/* 0x40a0 */  85, 66, 32, 48, 32, 83, 72, 79, 82, 84, 83, 85, 66, 10, 48, 48,
-/* 0x40b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 74,
-/* 0x40c0 */  78, 67, 68, 79, 67, 79, 80, 89, 32, 48, 32, 74, 78, 67, 68, 79,
-/* 0x40d0 */  67, 79, 80, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x40e0 */  32, 32, 32,100, 32, 32, 69, 88, 69, 82, 69, 76, 80, 85, 32, 48,
-/* 0x40f0 */  32, 69, 88, 69, 82, 69, 76, 80, 85, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4100 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 77, 65,
-/* 0x4110 */  73, 78, 52, 32, 48, 32, 69, 88, 69, 77, 65, 73, 78, 52, 10, 48,
-/* 0x4120 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4130 */  69, 88, 69, 77, 65, 73, 78, 52, 66, 32, 48, 32, 69, 88, 69, 77,
-/* 0x4140 */  65, 73, 78, 52, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4150 */  32, 32, 32, 32,100, 32, 32, 69, 88, 69, 77, 65, 73, 78, 52, 67,
-/* 0x4160 */  32, 48, 32, 69, 88, 69, 77, 65, 73, 78, 52, 67, 10, 48, 48, 48,
-/* 0x4170 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85, 80,
-/* 0x4180 */  88, 49, 72, 69, 65, 68, 32, 48, 32, 85, 80, 88, 49, 72, 69, 65,
-/* 0x4190 */  68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x41a0 */ 100, 32, 32, 69, 88, 69, 67, 85, 84, 80, 79, 32, 48, 32, 69, 88,
-/* 0x41b0 */  69, 67, 85, 84, 80, 79, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x41c0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 54, 52, 75, 48, 49,
-/* 0x41d0 */  32, 48, 32, 78, 50, 66, 54, 52, 75, 48, 49, 10, 48, 48, 48, 48,
-/* 0x41e0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x41f0 */  50, 66, 69, 88, 49, 32, 48, 32, 78, 82, 86, 50, 66, 69, 88, 49,
-/* 0x4200 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4210 */  32, 32, 78, 50, 66, 88, 56, 54, 48, 49, 32, 48, 32, 78, 50, 66,
-/* 0x4220 */  88, 56, 54, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4230 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 50, 56, 54, 48, 49, 32,
-/* 0x4240 */  48, 32, 78, 50, 66, 50, 56, 54, 48, 49, 10, 48, 48, 48, 48, 48,
-/* 0x4250 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 88,
-/* 0x4260 */  56, 54, 48, 50, 32, 48, 32, 78, 50, 66, 88, 56, 54, 48, 50, 10,
-/* 0x4270 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4280 */  32, 78, 50, 66, 50, 56, 54, 48, 50, 32, 48, 32, 78, 50, 66, 50,
-/* 0x4290 */  56, 54, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x42a0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 54, 52, 75, 48, 50, 32, 48,
-/* 0x42b0 */  32, 78, 50, 66, 54, 52, 75, 48, 50, 10, 48, 48, 48, 48, 48, 48,
-/* 0x42c0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 54, 52,
-/* 0x42d0 */  75, 48, 49, 32, 48, 32, 78, 50, 68, 54, 52, 75, 48, 49, 10, 48,
-/* 0x42e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x42f0 */  78, 82, 86, 50, 68, 69, 88, 49, 32, 48, 32, 78, 82, 86, 50, 68,
-/* 0x4300 */  69, 88, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4310 */  32, 32,100, 32, 32, 78, 50, 68, 88, 56, 54, 48, 49, 32, 48, 32,
-/* 0x4320 */  78, 50, 68, 88, 56, 54, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4330 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 50, 56, 54,
-/* 0x4340 */  48, 49, 32, 48, 32, 78, 50, 68, 50, 56, 54, 48, 49, 10, 48, 48,
-/* 0x4350 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x4360 */  50, 68, 88, 56, 54, 48, 50, 32, 48, 32, 78, 50, 68, 88, 56, 54,
-/* 0x4370 */  48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4380 */  32,100, 32, 32, 78, 50, 68, 50, 56, 54, 48, 50, 32, 48, 32, 78,
-/* 0x4390 */  50, 68, 50, 56, 54, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x43a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 54, 52, 75, 48,
-/* 0x43b0 */  50, 32, 48, 32, 78, 50, 68, 54, 52, 75, 48, 50, 10, 48, 48, 48,
-/* 0x43c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x43d0 */  69, 54, 52, 75, 48, 49, 32, 48, 32, 78, 50, 69, 54, 52, 75, 48,
-/* 0x43e0 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x43f0 */ 100, 32, 32, 78, 82, 86, 50, 69, 69, 88, 49, 32, 48, 32, 78, 82,
-/* 0x4400 */  86, 50, 69, 69, 88, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4410 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 88, 56, 54, 48, 49,
-/* 0x4420 */  32, 48, 32, 78, 50, 69, 88, 56, 54, 48, 49, 10, 48, 48, 48, 48,
-/* 0x4430 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x4440 */  50, 56, 54, 48, 49, 32, 48, 32, 78, 50, 69, 50, 56, 54, 48, 49,
-/* 0x4450 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4460 */  32, 32, 78, 50, 69, 88, 56, 54, 48, 50, 32, 48, 32, 78, 50, 69,
-/* 0x4470 */  88, 56, 54, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4480 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 50, 56, 54, 48, 50, 32,
-/* 0x4490 */  48, 32, 78, 50, 69, 50, 56, 54, 48, 50, 10, 48, 48, 48, 48, 48,
-/* 0x44a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 54,
-/* 0x44b0 */  52, 75, 48, 50, 32, 48, 32, 78, 50, 69, 54, 52, 75, 48, 50, 10,
-/* 0x44c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x44d0 */  32,105,103,110,111,114,101, 95,114,101,108,111, 99, 95,111,118,
-/* 0x44e0 */ 101,114,102,108,111,119, 32, 48, 32,105,103,110,111,114,101, 95,
-/* 0x44f0 */ 114,101,108,111, 99, 95,111,118,101,114,102,108,111,119, 10, 48,
-/* 0x4500 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4510 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77,
-/* 0x4520 */  65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4530 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x4540 */  67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x4550 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4560 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76,
-/* 0x4570 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4580 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x4590 */  68, 69, 67, 51, 49, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x45a0 */  51, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x45b0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 51, 32, 48,
-/* 0x45c0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 51, 10, 48, 48, 48, 48,
-/* 0x45d0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69,
-/* 0x45e0 */  77, 65, 73, 78, 53, 32, 48, 32, 69, 88, 69, 77, 65, 73, 78, 53,
-/* 0x45f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4600 */  32, 32, 69, 88, 69, 65, 68, 74, 85, 83, 32, 48, 32, 69, 88, 69,
-/* 0x4610 */  65, 68, 74, 85, 83, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4620 */  32, 32, 32, 32,100, 32, 32, 69, 88, 69, 78, 79, 65, 68, 74, 32,
-/* 0x4630 */  48, 32, 69, 88, 69, 78, 79, 65, 68, 74, 10, 48, 48, 48, 48, 48,
-/* 0x4640 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 82,
-/* 0x4650 */  69, 76, 57, 65, 32, 48, 32, 69, 88, 69, 82, 69, 76, 57, 65, 10,
-/* 0x4660 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4670 */  32, 69, 88, 69, 82, 69, 66, 73, 71, 32, 48, 32, 69, 88, 69, 82,
-/* 0x4680 */  69, 66, 73, 71, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4690 */  32, 32, 32,100, 32, 32, 69, 88, 69, 82, 69, 76, 79, 51, 32, 48,
-/* 0x46a0 */  32, 69, 88, 69, 82, 69, 76, 79, 51, 10, 48, 48, 48, 48, 48, 48,
-/* 0x46b0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 77, 65,
-/* 0x46c0 */  73, 78, 56, 32, 48, 32, 69, 88, 69, 77, 65, 73, 78, 56, 10, 48,
-/* 0x46d0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x46e0 */  68, 69, 86, 73, 67, 69, 69, 78, 68, 32, 48, 32, 68, 69, 86, 73,
-/* 0x46f0 */  67, 69, 69, 78, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4700 */  32, 32, 32, 32,100, 32, 32, 69, 88, 69, 83, 84, 65, 67, 75, 32,
-/* 0x4710 */  48, 32, 69, 88, 69, 83, 84, 65, 67, 75, 10, 48, 48, 48, 48, 48,
-/* 0x4720 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 83,
-/* 0x4730 */  84, 65, 83, 80, 32, 48, 32, 69, 88, 69, 83, 84, 65, 83, 80, 10,
-/* 0x4740 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4750 */  32, 69, 88, 69, 74, 85, 77, 80, 70, 32, 48, 32, 69, 88, 69, 74,
-/* 0x4760 */  85, 77, 80, 70, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4770 */  32, 32, 32,100, 32, 32, 69, 88, 69, 82, 67, 83, 80, 79, 32, 48,
-/* 0x4780 */  32, 69, 88, 69, 82, 67, 83, 80, 79, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4790 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 69, 82, 69,
-/* 0x47a0 */  84, 73, 80, 32, 48, 32, 69, 88, 69, 82, 69, 84, 73, 80, 10, 48,
-/* 0x47b0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x47c0 */  42, 85, 78, 68, 42, 32, 48, 32, 97,116,116,114,105, 98,117,116,
-/* 0x47d0 */ 101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x47e0 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,105,110,116,101,114,
-/* 0x47f0 */ 114,117,112,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x4800 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,111,114,
-/* 0x4810 */ 105,103, 95,115,116,114, 97,116,101,103,121, 10, 48, 48, 48, 48,
-/* 0x4820 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x4830 */  68, 42, 32, 48, 32,101,120,101, 95,115,116, 97, 99,107, 95,115,
-/* 0x4840 */ 115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x4850 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,101,120,101, 95,115,
-/* 0x4860 */ 116, 97, 99,107, 95,115,112, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4870 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x4880 */  32, 99, 97,108,108,116,114,105, 99,107, 95, 99, 97,108,108,115,
-/* 0x4890 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x48a0 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,119,111,114,100,115, 95,
-/* 0x48b0 */ 116,111, 95, 99,111,112,121, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x48d0 */  32, 99,111,112,121, 95,111,102,102,115,101,116, 10, 48, 48, 48,
-/* 0x48e0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x48f0 */  78, 68, 42, 32, 48, 32,115,111,117,114, 99,101, 95,115,101,103,
-/* 0x4900 */ 109,101,110,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x4910 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,100,101,
-/* 0x4920 */ 115,116,105,110, 97,116,105,111,110, 95,115,101,103,109,101,110,
-/* 0x4930 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x4940 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,100,101, 99,111,109,
-/* 0x4950 */ 112,114,101,115,115,111,114, 95,101,110,116,114,121, 10, 48, 48,
-/* 0x4960 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x4970 */  85, 78, 68, 42, 32, 48, 32, 98,120, 95,109, 97,103,105, 99, 10,
-/* 0x4980 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4990 */  32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,115,116,
-/* 0x49a0 */  97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48,
-/* 0x49b0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x49c0 */  42, 32, 48, 32,108,122,109, 97, 95,117, 95,108,101,110, 95,104,
-/* 0x49d0 */ 105, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x49e0 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,
-/* 0x49f0 */ 117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4a00 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,
-/* 0x4a10 */ 122,109, 97, 95, 99, 95,108,101,110, 95,104,105, 10, 48, 48, 48,
-/* 0x4a20 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x4a30 */  78, 68, 42, 32, 48, 32,108,122,109, 97, 95, 99, 95,108,101,110,
-/* 0x4a40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a50 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,112,
-/* 0x4a60 */ 114,111,112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4a70 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x4a80 */  32, 48, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,
-/* 0x4a90 */ 101,115, 95,104,105, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4aa0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 99,
-/* 0x4ab0 */ 108,101, 97,114, 95,100,105,114,116,121, 95,115,116, 97, 99,107,
-/* 0x4ac0 */  95,108,111,119, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x4ad0 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,
-/* 0x4ae0 */ 109, 97, 95,117, 95,108,101,110, 95,115,101,103,109,101,110,116,
-/* 0x4af0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b00 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,114,101,108,111, 99, 95,
-/* 0x4b10 */ 115,105,122,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x4b20 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,111,114,
-/* 0x4b30 */ 105,103,105,110, 97,108, 95,115,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4b40 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x4b50 */  32, 48, 32,111,114,105,103,105,110, 97,108, 95,115,112, 10, 48,
-/* 0x4b60 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b70 */  42, 85, 78, 68, 42, 32, 48, 32,111,114,105,103,105,110, 97,108,
-/* 0x4b80 */  95,105,112, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x4b90 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,111,114,105,
-/* 0x4ba0 */ 103,105,110, 97,108, 95, 99,115, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4bb0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4bc0 */  32, 91, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82, 89, 93, 58, 10,
-/* 0x4bd0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4be0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4bf0 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4c00 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 97,116,116,114,
-/* 0x4c10 */ 105, 98,117,116,101, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82,
-/* 0x4c20 */  95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c30 */  32, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82, 89, 10, 48, 48, 48,
-/* 0x4c40 */  48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32,
-/* 0x4c50 */  32, 32, 32, 32, 32, 32, 32, 32,105,110,116,101,114,114,117,112,
-/* 0x4c60 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54,
-/* 0x4c70 */  95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,
-/* 0x4c80 */ 103, 95,115,116,114, 97,116,101,103,121, 10, 48, 48, 48, 48, 48,
-/* 0x4c90 */  48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32,
-/* 0x4ca0 */  32, 32, 32, 32, 32, 32, 68, 69, 86, 73, 67, 69, 69, 78, 84, 82,
-/* 0x4cb0 */  89, 10, 48, 48, 48, 48, 48, 48, 49, 57, 32, 82, 95, 51, 56, 54,
-/* 0x4cc0 */  95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,101,120,101,
-/* 0x4cd0 */  95,115,116, 97, 99,107, 95,115,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ce0 */  49, 99, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32,
-/* 0x4cf0 */  32, 32, 32, 32, 32,101,120,101, 95,115,116, 97, 99,107, 95,115,
-/* 0x4d00 */ 112, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4d10 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 68,
-/* 0x4d20 */  69, 86, 73, 67, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4d30 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4d40 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d50 */  49, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x4d60 */  32, 32, 32, 32,101,120,101, 95,115,116, 97, 99,107, 95,115,115,
-/* 0x4d70 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4d80 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 69, 78,
-/* 0x4d90 */  84, 82, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4da0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4db0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32,
-/* 0x4dc0 */  82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4dd0 */  32, 32, 67, 79, 77, 80, 82, 69, 83, 83, 69, 68, 95, 76, 90, 77,
-/* 0x4de0 */  65, 95, 83, 84, 65, 82, 84, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4df0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4e00 */  91, 78, 82, 86, 50, 66, 49, 54, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4e10 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e20 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4e30 */  48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54,
-/* 0x4e40 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 68, 69, 67, 79, 50,
-/* 0x4e50 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4e60 */  80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 68,
-/* 0x4e70 */  69, 67, 79, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4e80 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x4e90 */  86, 68, 68, 79, 78, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4ea0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4eb0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ec0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4ed0 */  32, 32, 32, 32, 32, 78, 82, 86, 68, 69, 67, 79, 50, 10, 10, 82,
-/* 0x4ee0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4ef0 */  83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 68, 82, 69, 84, 85, 93,
-/* 0x4f00 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4f10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4f20 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x4f30 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x4f40 */  86, 68, 69, 67, 79, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4f50 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4f60 */  78, 82, 86, 68, 69, 67, 79, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4f70 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f80 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4f90 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x4fa0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 49, 54, 48, 10,
-/* 0x4fb0 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x4fc0 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 68, 69,
-/* 0x4fd0 */  67, 79, 50, 10, 48, 48, 48, 48, 48, 48, 49, 56, 32, 82, 95, 51,
-/* 0x4fe0 */  56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4ff0 */  82, 86, 68, 69, 67, 79, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5000 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5010 */  91, 78, 82, 86, 68, 69, 67, 79, 50, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5020 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5030 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5040 */  48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5050 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 49, 54, 48,
-/* 0x5060 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5070 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x5080 */  49, 54, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5090 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50a0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x50b0 */  95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50c0 */  32, 99, 97,108,108,116,114,105, 99,107, 95, 99, 97,108,108,115,
-/* 0x50d0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x50e0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x50f0 */  73, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5100 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5110 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x5120 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5130 */  32, 67, 65, 76, 76, 84, 82, 49, 54, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5140 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5150 */  82, 32, 91, 67, 65, 76, 76, 84, 82, 73, 53, 93, 58, 10, 79, 70,
-/* 0x5160 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5180 */  48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 49, 54,
-/* 0x5190 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97,108,108,116,114,
-/* 0x51a0 */ 105, 99,107, 95, 99, 97,108,108,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x51b0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x51c0 */  82, 32, 91, 67, 84, 49, 54, 74, 69, 78, 68, 93, 58, 10, 79, 70,
-/* 0x51d0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x51e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x51f0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5200 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 68, 69, 67,
-/* 0x5210 */  79, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5220 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 49, 54,
-/* 0x5230 */  74, 85, 76, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5240 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5250 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5260 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5270 */  32, 32, 32, 67, 65, 76, 76, 84, 82, 73, 54, 10, 10, 82, 69, 76,
-/* 0x5280 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5290 */  70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 73, 54, 93, 58, 10,
-/* 0x52a0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x52b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x52c0 */  10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x52d0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76,
-/* 0x52e0 */  84, 82, 73, 53, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x52f0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88,
-/* 0x5300 */  69, 69, 78, 84, 82, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5310 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5320 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5330 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32,
-/* 0x5340 */  32, 32, 32, 32, 32,119,111,114,100,115, 95,116,111, 95, 99,111,
-/* 0x5350 */ 112,121, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56,
-/* 0x5360 */  54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,111,
-/* 0x5370 */ 112,121, 95,111,102,102,115,101,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5380 */  48,102, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32,
-/* 0x5390 */  32, 32, 32, 32, 32,115,111,117,114, 99,101, 95,115,101,103,109,
-/* 0x53a0 */ 101,110,116, 10, 48, 48, 48, 48, 48, 48, 49, 52, 32, 82, 95, 51,
-/* 0x53b0 */  56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,100,
-/* 0x53c0 */ 101,115,116,105,110, 97,116,105,111,110, 95,115,101,103,109,101,
-/* 0x53d0 */ 110,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x53e0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 79, 78, 71,
-/* 0x53f0 */  83, 85, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5400 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5410 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x5420 */  82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5430 */  32, 32, 69, 88, 69, 69, 78, 84, 82, 89, 10, 10, 82, 69, 76, 79,
-/* 0x5440 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5450 */  79, 82, 32, 91, 83, 72, 79, 82, 84, 83, 85, 66, 93, 58, 10, 79,
-/* 0x5460 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5470 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5480 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 56,
-/* 0x5490 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 69, 69, 78,
-/* 0x54a0 */  84, 82, 89, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x54b0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 74, 78, 67,
-/* 0x54c0 */  68, 79, 67, 79, 80, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x54d0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x54e0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x54f0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5500 */  32, 32, 32, 32, 32, 69, 88, 69, 69, 78, 84, 82, 89, 10, 10, 82,
-/* 0x5510 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5520 */  83, 32, 70, 79, 82, 32, 91, 69, 88, 69, 77, 65, 73, 78, 52, 93,
-/* 0x5530 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5540 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5550 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 51, 56,
-/* 0x5560 */  54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,100,101,
-/* 0x5570 */  99,111,109,112,114,101,115,115,111,114, 95,101,110,116,114,121,
-/* 0x5580 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5590 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88, 69, 77, 65, 73,
-/* 0x55a0 */  78, 52, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x55b0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x55c0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x55d0 */  82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x55e0 */  32, 32, 98,120, 95,109, 97,103,105, 99, 10, 10, 82, 69, 76, 79,
-/* 0x55f0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5600 */  79, 82, 32, 91, 78, 82, 86, 50, 66, 49, 54, 83, 93, 58, 10, 79,
-/* 0x5610 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5620 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5630 */  48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5640 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66,
-/* 0x5650 */  69, 88, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5660 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x5670 */  50, 66, 69, 88, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5680 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5690 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x56a0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32,
-/* 0x56b0 */  32, 32, 32, 32, 78, 82, 86, 50, 66, 69, 88, 51, 10, 48, 48, 48,
-/* 0x56c0 */  48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x56d0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 69, 88, 57,
-/* 0x56e0 */  10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95,
-/* 0x56f0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x5700 */  66, 69, 88, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5710 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x5720 */  86, 50, 66, 69, 88, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5730 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5740 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5750 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x5760 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 69, 88, 51, 10, 48, 48,
-/* 0x5770 */  48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49,
-/* 0x5780 */  54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 69, 88,
-/* 0x5790 */  51, 10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 51, 56, 54,
-/* 0x57a0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x57b0 */  50, 66, 49, 54, 83, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x57c0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x57d0 */  82, 86, 50, 66, 69, 88, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x57e0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57f0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5800 */  48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5810 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 69, 88, 50, 10, 48,
-/* 0x5820 */  48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5830 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 66, 69,
-/* 0x5840 */  88, 57, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5850 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50,
-/* 0x5860 */  68, 49, 54, 83, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5870 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5880 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54,
-/* 0x5890 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x58a0 */  32, 32, 32, 78, 82, 86, 50, 68, 69, 88, 51, 10, 10, 82, 69, 76,
-/* 0x58b0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x58c0 */  70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 69, 88, 49, 93, 58, 10,
-/* 0x58d0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x58e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x58f0 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5900 */  80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x5910 */  68, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95,
-/* 0x5920 */  51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5930 */  78, 82, 86, 50, 68, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5940 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5950 */  32, 32, 32, 32, 78, 82, 86, 50, 68, 69, 88, 57, 10, 48, 48, 48,
-/* 0x5960 */  48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5970 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 69, 88, 50,
-/* 0x5980 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5990 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 69,
-/* 0x59a0 */  88, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x59b0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59c0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82,
-/* 0x59d0 */  95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59e0 */  32, 78, 82, 86, 50, 68, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48,
-/* 0x59f0 */  49, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x5a00 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 69, 88, 51, 10, 48, 48,
-/* 0x5a10 */  48, 48, 48, 48, 49, 98, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49,
-/* 0x5a20 */  54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 69, 88,
-/* 0x5a30 */  51, 10, 48, 48, 48, 48, 48, 48, 51, 56, 32, 82, 95, 51, 56, 54,
-/* 0x5a40 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x5a50 */  50, 68, 49, 54, 83, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5a60 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5a70 */  82, 86, 50, 68, 69, 88, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5a80 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a90 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5aa0 */  48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5ab0 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 69, 88, 50, 10, 48,
-/* 0x5ac0 */  48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5ad0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 68, 69,
-/* 0x5ae0 */  88, 57, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5af0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50,
-/* 0x5b00 */  69, 49, 54, 83, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5b10 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b20 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54,
-/* 0x5b30 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x5b40 */  32, 32, 32, 78, 82, 86, 50, 69, 69, 88, 51, 10, 10, 82, 69, 76,
-/* 0x5b50 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5b60 */  70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 69, 88, 49, 93, 58, 10,
-/* 0x5b70 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5b80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5b90 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5ba0 */  80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50,
-/* 0x5bb0 */  69, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95,
-/* 0x5bc0 */  51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5bd0 */  78, 82, 86, 50, 69, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5be0 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5bf0 */  32, 32, 32, 32, 78, 82, 86, 50, 69, 69, 88, 57, 10, 48, 48, 48,
-/* 0x5c00 */  48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5c10 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 69, 88, 50,
-/* 0x5c20 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5c30 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 69,
-/* 0x5c40 */  88, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5c50 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c60 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82,
-/* 0x5c70 */  95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c80 */  32, 78, 82, 86, 50, 69, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5c90 */  49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x5ca0 */  32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 69, 88, 51, 10, 48, 48,
-/* 0x5cb0 */  48, 48, 48, 48, 49, 98, 32, 82, 95, 51, 56, 54, 95, 80, 67, 49,
-/* 0x5cc0 */  54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 69, 88,
-/* 0x5cd0 */  51, 10, 48, 48, 48, 48, 48, 48, 50, 48, 32, 82, 95, 51, 56, 54,
-/* 0x5ce0 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x5cf0 */  50, 69, 69, 88, 51, 10, 48, 48, 48, 48, 48, 48, 51,100, 32, 82,
-/* 0x5d00 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d10 */  32, 78, 82, 86, 50, 69, 49, 54, 83, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5d20 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5d30 */  82, 32, 91, 78, 82, 86, 50, 69, 69, 88, 51, 93, 58, 10, 79, 70,
-/* 0x5d40 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5d50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5d60 */  48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5d70 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 50, 69, 69,
-/* 0x5d80 */  88, 50, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56,
-/* 0x5d90 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x5da0 */  86, 50, 69, 69, 88, 57, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5db0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5dc0 */  76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5dd0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5de0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5df0 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32,
-/* 0x5e00 */  32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116,
-/* 0x5e10 */  97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48,
-/* 0x5e20 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32,
-/* 0x5e30 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110,
-/* 0x5e40 */  95,104,105, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51,
-/* 0x5e50 */  56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x5e60 */ 122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5e70 */  49, 97, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32,
-/* 0x5e80 */  32, 32, 32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 95,
-/* 0x5e90 */ 104,105, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56,
-/* 0x5ea0 */  54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x5eb0 */ 109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x5ec0 */  99, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x5ed0 */  32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,
-/* 0x5ee0 */ 105,101,115, 10, 48, 48, 48, 48, 48, 48, 51, 49, 32, 82, 95, 51,
-/* 0x5ef0 */  56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x5f00 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115, 95,104,
-/* 0x5f10 */ 105, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5f20 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,105,103,110,111,114,
-/* 0x5f30 */ 101, 95,114,101,108,111, 99, 95,111,118,101,114,102,108,111,119,
-/* 0x5f40 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5f50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5f60 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 51,
-/* 0x5f70 */  56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x5f80 */ 122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5f90 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5fa0 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 10,
-/* 0x5fb0 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56,
-/* 0x5fc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,
-/* 0x5fd0 */  99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x5fe0 */  95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ff0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48,
-/* 0x6000 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32,
-/* 0x6010 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,
-/* 0x6020 */ 101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x6030 */  82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6040 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48,
-/* 0x6050 */  48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32,
-/* 0x6060 */  32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,
-/* 0x6070 */ 101,110, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 51, 56,
-/* 0x6080 */  54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 90,
-/* 0x6090 */  77, 65, 95, 68, 69, 67, 51, 50, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x60a0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x60b0 */  32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 51, 49, 93, 58, 10, 79,
-/* 0x60c0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x60d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x60e0 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 49,
-/* 0x60f0 */  54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,108,101, 97,114,
-/* 0x6100 */  95,100,105,114,116,121, 95,115,116, 97, 99,107, 95,108,111,119,
-/* 0x6110 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6120 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68,
-/* 0x6130 */  69, 67, 51, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6140 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6150 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x6160 */  32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6170 */  32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 10, 82,
-/* 0x6180 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6190 */  83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x61a0 */  51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x61b0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x61c0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x61d0 */  51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x61e0 */ 108,122,109, 97, 95,117, 95,108,101,110, 95,115,101,103,109,101,
-/* 0x61f0 */ 110,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6200 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88, 69, 82,
-/* 0x6210 */  69, 76, 79, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6220 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6230 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x6240 */  32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6250 */  32, 32, 32,114,101,108,111, 99, 95,115,105,122,101, 10, 48, 48,
-/* 0x6260 */  48, 48, 48, 48, 49, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6270 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 69, 82, 69, 76, 79,
-/* 0x6280 */  50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6290 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88, 69, 82, 69,
-/* 0x62a0 */  76, 57, 65, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x62b0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x62c0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32,
-/* 0x62d0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x62e0 */  32, 32, 69, 88, 69, 82, 69, 76, 79, 49, 10, 10, 82, 69, 76, 79,
-/* 0x62f0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6300 */  79, 82, 32, 91, 69, 88, 69, 82, 69, 66, 73, 71, 93, 58, 10, 79,
-/* 0x6310 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6320 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6330 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6340 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 69, 82, 69,
-/* 0x6350 */  76, 79, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6360 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88, 69,
-/* 0x6370 */  82, 69, 76, 79, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6380 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6390 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x63a0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x63b0 */  32, 32, 32, 32, 69, 88, 69, 82, 69, 76, 79, 49, 10, 10, 82, 69,
-/* 0x63c0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x63d0 */  32, 70, 79, 82, 32, 91, 69, 88, 69, 83, 84, 65, 67, 75, 93, 58,
-/* 0x63e0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x63f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6400 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54,
-/* 0x6410 */  95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,
-/* 0x6420 */ 103,105,110, 97,108, 95,115,115, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6430 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6440 */  32, 91, 69, 88, 69, 83, 84, 65, 83, 80, 93, 58, 10, 79, 70, 70,
-/* 0x6450 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6460 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6470 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32,
-/* 0x6480 */  32, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,
-/* 0x6490 */ 108, 95,115,112, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x64a0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88,
-/* 0x64b0 */  69, 74, 85, 77, 80, 70, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x64c0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64d0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x64e0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32,
-/* 0x64f0 */  32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108, 95,105,112,
-/* 0x6500 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6510 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,
-/* 0x6520 */ 105,110, 97,108, 95, 99,115, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6530 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6540 */  91, 69, 88, 69, 82, 67, 83, 80, 79, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6550 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6560 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6570 */  48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32,
-/* 0x6580 */  32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108,
-/* 0x6590 */  95, 99,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x65a0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 88, 69,
-/* 0x65b0 */  82, 69, 84, 73, 80, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x65c0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65d0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x65e0 */  50, 32, 82, 95, 51, 56, 54, 95, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x65f0 */  32, 32, 32, 32,111,114,105,103,105,110, 97,108, 95,105,112, 10
+/* 0x27c0 */   0, 85,184,  0,  0, 80,203, 92,  0,  0,  0,118,  0,  0,  0, 93,
+/* 0x27d0 */   0,  0,  0,  7,  5,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 45,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 97,  0,  0,  0,  5,
+/* 0x27f0 */   0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,102,  0,  0,  0,  3,
+/* 0x2800 */   0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,105,  0,  0,  0, 17,
+/* 0x2810 */   0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,122,  0,  0,  0, 10,
+/* 0x2820 */   0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0,132,  0,  0,  0,  2,
+/* 0x2830 */   0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,134,  0,  0,  0,  2,
+/* 0x2840 */   0,  0,  0,  0,  0,  0,  0, 73,  0,  0,  0,136,  0,  0,  0, 30,
+/* 0x2850 */   0,  0,  0,  0,  0,  0,  0, 82,  0,  0,  0,166,  0,  0,  0,  1,
+/* 0x2860 */   0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,167,  0,  0,  0,  7,
+/* 0x2870 */   0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0,174,  0,  0,  0, 23,
+/* 0x2880 */   0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,197,  0,  0,  0, 11,
+/* 0x2890 */   0,  0,  0,  0,  0,  0,  0,118,  0,  0,  0,208,  0,  0,  0,  3,
+/* 0x28a0 */   0,  0,  0,  0,  0,  0,  0,127,  0,  0,  0,211,  0,  0,  0,  2,
+/* 0x28b0 */   0,  0,  0,  0,  0,  0,  0,136,  0,  0,  0,213,  0,  0,  0,  8,
+/* 0x28c0 */   0,  0,  0,  0,  0,  0,  0,145,  0,  0,  0,221,  0,  0,  0,  3,
+/* 0x28d0 */   0,  0,  0,  0,  0,  0,  0,154,  0,  0,  0,224,  0,  0,  0,  2,
+/* 0x28e0 */   0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0,226,  0,  0,  0,  2,
+/* 0x28f0 */   0,  0,  0,  0,  0,  0,  0,172,  0,  0,  0,228,  0,  0,  0,  6,
+/* 0x2900 */   0,  0,  0,  0,  0,  0,  0,181,  0,  0,  0,234,  0,  0,  0,  2,
+/* 0x2910 */   0,  0,  0,  0,  0,  0,  0,190,  0,  0,  0,236,  0,  0,  0,  2,
+/* 0x2920 */   0,  0,  0,  0,  0,  0,  0,199,  0,  0,  0,238,  0,  0,  0,  3,
+/* 0x2930 */   0,  0,  0,  0,  0,  0,  0,208,  0,  0,  0,241,  0,  0,  0,  2,
+/* 0x2940 */   0,  0,  0,  0,  0,  0,  0,217,  0,  0,  0,243,  0,  0,  0,  8,
+/* 0x2950 */   0,  0,  0,  0,  0,  0,  0,226,  0,  0,  0,251,  0,  0,  0,  3,
+/* 0x2960 */   0,  0,  0,  0,  0,  0,  0,235,  0,  0,  0,254,  0,  0,  0, 28,
+/* 0x2970 */   0,  0,  0,  0,  0,  0,  0,244,  0,  0,  0, 26,  1,  0,  0,  6,
+/* 0x2980 */   0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 32,  1,  0,  0,  5,
+/* 0x2990 */   0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0, 37,  1,  0,  0,  5,
+/* 0x29a0 */   0,  0,  0,  0,  0,  0,  0, 15,  1,  0,  0, 42,  1,  0,  0,  1,
+/* 0x29b0 */   0,  0,  0,  0,  0,  0,  0, 24,  1,  0,  0, 43,  1,  0,  0,  9,
+/* 0x29c0 */   0,  0,  0,  0,  0,  0,  0, 33,  1,  0,  0, 52,  1,  0,  0,  3,
+/* 0x29d0 */   0,  0,  0,  0,  0,  0,  0, 43,  1,  0,  0, 55,  1,  0,  0,  2,
+/* 0x29e0 */   0,  0,  0,  0,  0,  0,  0, 53,  1,  0,  0, 57,  1,  0,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0,  0,  0,  0, 75,  1,  0,  0, 57,  1,  0,  0, 27,
+/* 0x2a00 */   0,  0,  0,  0,  0,  0,  0, 84,  1,  0,  0, 84,  1,  0,  0,  0,
+/* 0x2a10 */   0,  0,  0,  0,  0,  0,  0, 93,  1,  0,  0, 84,  1,  0,  0, 13,
+/* 0x2a20 */   0,  0,  0,  0,  0,  0,  0,102,  1,  0,  0, 97,  1,  0,  0, 11,
+/* 0x2a30 */   0,  0,  0,  0,  0,  0,  0,111,  1,  0,  0,108,  1,  0,  0, 11,
+/* 0x2a40 */   0,  0,  0,  0,  0,  0,  0,120,  1,  0,  0,119,  1,  0,  0,  8,
+/* 0x2a50 */   0,  0,  0,  0,  0,  0,  0,129,  1,  0,  0,127,  1,  0,  0,  3,
+/* 0x2a60 */   0,  0,  0,  0,  0,  0,  0,138,  1,  0,  0,130,  1,  0,  0, 49,
+/* 0x2a70 */   0,  0,  0,  0,  0,  0,  0,147,  1,  0,  0,179,  1,  0,  0, 14,
+/* 0x2a80 */   0,  0,  0,  0,  0,  0,  0,156,  1,  0,  0,193,  1,  0,  0,  6,
+/* 0x2a90 */   0,  0,  0,  0,  0,  0,  0,165,  1,  0,  0,199,  1,  0,  0, 21,
+/* 0x2aa0 */   0,  0,  0,  0,  0,  0,  0,174,  1,  0,  0,220,  1,  0,  0, 11,
+/* 0x2ab0 */   0,  0,  0,  0,  0,  0,  0,183,  1,  0,  0,231,  1,  0,  0,  4,
+/* 0x2ac0 */   0,  0,  0,  0,  0,  0,  0,192,  1,  0,  0,235,  1,  0,  0, 13,
+/* 0x2ad0 */   0,  0,  0,  0,  0,  0,  0,201,  1,  0,  0,248,  1,  0,  0, 11,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  0,  0,210,  1,  0,  0,  3,  2,  0,  0, 19,
+/* 0x2af0 */   0,  0,  0,  0,  0,  0,  0,219,  1,  0,  0, 22,  2,  0,  0,  6,
+/* 0x2b00 */   0,  0,  0,  0,  0,  0,  0,228,  1,  0,  0, 28,  2,  0,  0,  3,
+/* 0x2b10 */   0,  0,  0,  0,  0,  0,  0,237,  1,  0,  0, 31,  2,  0,  0, 57,
+/* 0x2b20 */   0,  0,  0,  0,  0,  0,  0,246,  1,  0,  0, 88,  2,  0,  0, 14,
+/* 0x2b30 */   0,  0,  0,  0,  0,  0,  0,255,  1,  0,  0,102,  2,  0,  0,  6,
+/* 0x2b40 */   0,  0,  0,  0,  0,  0,  0,  8,  2,  0,  0,108,  2,  0,  0, 21,
+/* 0x2b50 */   0,  0,  0,  0,  0,  0,  0, 17,  2,  0,  0,129,  2,  0,  0, 11,
+/* 0x2b60 */   0,  0,  0,  0,  0,  0,  0, 26,  2,  0,  0,140,  2,  0,  0,  4,
+/* 0x2b70 */   0,  0,  0,  0,  0,  0,  0, 35,  2,  0,  0,144,  2,  0,  0, 13,
+/* 0x2b80 */   0,  0,  0,  0,  0,  0,  0, 44,  2,  0,  0,157,  2,  0,  0, 11,
+/* 0x2b90 */   0,  0,  0,  0,  0,  0,  0, 53,  2,  0,  0,168,  2,  0,  0, 19,
+/* 0x2ba0 */   0,  0,  0,  0,  0,  0,  0, 62,  2,  0,  0,187,  2,  0,  0,  6,
+/* 0x2bb0 */   0,  0,  0,  0,  0,  0,  0, 71,  2,  0,  0,193,  2,  0,  0,  3,
+/* 0x2bc0 */   0,  0,  0,  0,  0,  0,  0, 80,  2,  0,  0,196,  2,  0,  0, 62,
+/* 0x2bd0 */   0,  0,  0,  0,  0,  0,  0, 89,  2,  0,  0,  2,  3,  0,  0, 14,
+/* 0x2be0 */   0,  0,  0,  0,  0,  0,  0, 98,  2,  0,  0, 16,  3,  0,  0,  6,
+/* 0x2bf0 */   0,  0,  0,  0,  0,  0,  0,107,  2,  0,  0, 22,  3,  0,  0, 21,
+/* 0x2c00 */   0,  0,  0,  0,  0,  0,  0,116,  2,  0,  0, 43,  3,  0,  0, 11,
+/* 0x2c10 */   0,  0,  0,  0,  0,  0,  0,125,  2,  0,  0, 54,  3,  0,  0,  4,
+/* 0x2c20 */   0,  0,  0,  0,  0,  0,  0,134,  2,  0,  0, 58,  3,  0,  0, 50,
+/* 0x2c30 */   0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0,108,  3,  0,  0,  8,
+/* 0x2c40 */   0,  0,  0,  0,  0,  0,  0,167,  2,  0,  0,116,  3,  0,  0,155,
+/* 0x2c50 */  17,  0,  0,  0,  0,  0,  0,178,  2,  0,  0, 15, 21,  0,  0, 47,
+/* 0x2c60 */  18,  0,  0,  0,  0,  0,  0,189,  2,  0,  0, 62, 39,  0,  0,  1,
+/* 0x2c70 */   0,  0,  0,  0,  0,  0,  0,200,  2,  0,  0, 63, 39,  0,  0, 12,
+/* 0x2c80 */   0,  0,  0,  0,  0,  0,  0,211,  2,  0,  0, 75, 39,  0,  0,  5,
+/* 0x2c90 */   0,  0,  0,  0,  0,  0,  0,222,  2,  0,  0, 80, 39,  0,  0,  7,
+/* 0x2ca0 */   0,  0,  0,  0,  0,  0,  0,233,  2,  0,  0, 87, 39,  0,  0,  1,
+/* 0x2cb0 */   0,  0,  0,  0,  0,  0,  0,242,  2,  0,  0, 88, 39,  0,  0,  7,
+/* 0x2cc0 */   0,  0,  0,  0,  0,  0,  0,251,  2,  0,  0, 95, 39,  0,  0,  2,
+/* 0x2cd0 */   0,  0,  0,  0,  0,  0,  0,  4,  3,  0,  0, 97, 39,  0,  0, 30,
+/* 0x2ce0 */   0,  0,  0,  0,  0,  0,  0, 13,  3,  0,  0,127, 39,  0,  0, 18,
+/* 0x2cf0 */   0,  0,  0,  0,  0,  0,  0, 22,  3,  0,  0,145, 39,  0,  0,  4,
+/* 0x2d00 */   0,  0,  0,  0,  0,  0,  0, 31,  3,  0,  0,149, 39,  0,  0,  2,
+/* 0x2d10 */   0,  0,  0,  0,  0,  0,  0, 40,  3,  0,  0,151, 39,  0,  0,  2,
+/* 0x2d20 */   0,  0,  0,  0,  0,  0,  0, 49,  3,  0,  0,153, 39,  0,  0,  3,
+/* 0x2d30 */   0,  0,  0,  0,  0,  0,  0, 58,  3,  0,  0,156, 39,  0,  0, 19,
+/* 0x2d40 */   0,  0,  0,  0,  0,  0,  0, 68,  3,  0,  0,175, 39,  0,  0,  6,
+/* 0x2d50 */   0,  0,  0,  0,  0,  0,  0, 77,  3,  0,  0,181, 39,  0,  0,  3,
+/* 0x2d60 */   0,  0,  0,  0,  0,  0,  0, 86,  3,  0,  0,184, 39,  0,  0,  5,
+/* 0x2d70 */   0,  0,  0,  0,  0,  0,  0, 95,  3,  0,  0,189, 39,  0,  0,  4,
+/* 0x2d80 */   0,  0,  0,  0,  0,  0,  0,104,  3,  0,  0,193, 39,  0,  0,  6,
+/* 0x2d90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2da0 */   0,  0,  0, 53,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0, 46,
+/* 0x2db0 */   0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 10,
+/* 0x2dc0 */   0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0, 11,  0,  0,  0,  0,
+/* 0x2dd0 */   0,  0,  0,172,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,226,
+/* 0x2de0 */   0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,235,  0,  0,  0, 25,
+/* 0x2df0 */   0,  0,  0,  0,  0,  0,  0, 93,  1,  0,  0, 36,  0,  0,  0,  0,
+/* 0x2e00 */   0,  0,  0,138,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,165,
+/* 0x2e10 */   1,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,183,  1,  0,  0, 46,
+/* 0x2e20 */   0,  0,  0,  0,  0,  0,  0,192,  1,  0,  0, 47,  0,  0,  0,  0,
+/* 0x2e30 */   0,  0,  0,237,  1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  8,
+/* 0x2e40 */   2,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0, 26,  2,  0,  0, 57,
+/* 0x2e50 */   0,  0,  0,  0,  0,  0,  0, 35,  2,  0,  0, 58,  0,  0,  0,  0,
+/* 0x2e60 */   0,  0,  0, 80,  2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,107,
+/* 0x2e70 */   2,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,125,  2,  0,  0, 68,
+/* 0x2e80 */   0,  0,  0,  0,  0,  0,  0,134,  2,  0,  0, 69,  0,  0,  0,  0,
+/* 0x2e90 */   0,  0,  0,211,  2,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,  4,
+/* 0x2ea0 */   3,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0, 22,  3,  0,  0, 82,
+/* 0x2eb0 */   0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,  1,  0,  0,  0,  0,
+/* 0x2ec0 */   0,  0,  0, 23,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 36,
+/* 0x2ed0 */   0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0,  5,
+/* 0x2ee0 */   0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  6,  0,  0,  0,  0,
+/* 0x2ef0 */   0,  0,  0, 73,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 82,
+/* 0x2f00 */   0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  9,
+/* 0x2f10 */   0,  0,  0,  0,  0,  0,  0,118,  0,  0,  0, 12,  0,  0,  0,  0,
+/* 0x2f20 */   0,  0,  0,127,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,136,
+/* 0x2f30 */   0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,145,  0,  0,  0, 15,
+/* 0x2f40 */   0,  0,  0,  0,  0,  0,  0,154,  0,  0,  0, 16,  0,  0,  0,  0,
+/* 0x2f50 */   0,  0,  0,163,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,181,
+/* 0x2f60 */   0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,190,  0,  0,  0, 20,
+/* 0x2f70 */   0,  0,  0,  0,  0,  0,  0,199,  0,  0,  0, 21,  0,  0,  0,  0,
+/* 0x2f80 */   0,  0,  0,208,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,217,
+/* 0x2f90 */   0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,244,  0,  0,  0, 26,
+/* 0x2fa0 */   0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 27,  0,  0,  0,  0,
+/* 0x2fb0 */   0,  0,  0,  5,  1,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 15,
+/* 0x2fc0 */   1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0, 24,  1,  0,  0, 30,
+/* 0x2fd0 */   0,  0,  0,  0,  0,  0,  0, 33,  1,  0,  0, 31,  0,  0,  0,  0,
+/* 0x2fe0 */   0,  0,  0, 43,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 75,
+/* 0x2ff0 */   1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0, 84,  1,  0,  0, 35,
+/* 0x3000 */   0,  0,  0,  0,  0,  0,  0,102,  1,  0,  0, 37,  0,  0,  0,  0,
+/* 0x3010 */   0,  0,  0,111,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,120,
+/* 0x3020 */   1,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,129,  1,  0,  0, 40,
+/* 0x3030 */   0,  0,  0,  0,  0,  0,  0,147,  1,  0,  0, 42,  0,  0,  0,  0,
+/* 0x3040 */   0,  0,  0,156,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,174,
+/* 0x3050 */   1,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,201,  1,  0,  0, 48,
+/* 0x3060 */   0,  0,  0,  0,  0,  0,  0,210,  1,  0,  0, 49,  0,  0,  0,  0,
+/* 0x3070 */   0,  0,  0,219,  1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,228,
+/* 0x3080 */   1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,246,  1,  0,  0, 53,
+/* 0x3090 */   0,  0,  0,  0,  0,  0,  0,255,  1,  0,  0, 54,  0,  0,  0,  0,
+/* 0x30a0 */   0,  0,  0, 17,  2,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0, 44,
+/* 0x30b0 */   2,  0,  0, 59,  0,  0,  0,  0,  0,  0,  0, 53,  2,  0,  0, 60,
+/* 0x30c0 */   0,  0,  0,  0,  0,  0,  0, 62,  2,  0,  0, 61,  0,  0,  0,  0,
+/* 0x30d0 */   0,  0,  0, 71,  2,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0, 89,
+/* 0x30e0 */   2,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0, 98,  2,  0,  0, 65,
+/* 0x30f0 */   0,  0,  0,  0,  0,  0,  0,116,  2,  0,  0, 67,  0,  0,  0,  0,
+/* 0x3100 */   0,  0,  0,145,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,167,
+/* 0x3110 */   2,  0,  0, 71,  0,  0,  0,  0,  0,  0,  0,178,  2,  0,  0, 72,
+/* 0x3120 */   0,  0,  0,  0,  0,  0,  0,189,  2,  0,  0, 73,  0,  0,  0,  0,
+/* 0x3130 */   0,  0,  0,200,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,222,
+/* 0x3140 */   2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,233,  2,  0,  0, 77,
+/* 0x3150 */   0,  0,  0,  0,  0,  0,  0,242,  2,  0,  0, 78,  0,  0,  0,  0,
+/* 0x3160 */   0,  0,  0,251,  2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0, 13,
+/* 0x3170 */   3,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0, 31,  3,  0,  0, 83,
+/* 0x3180 */   0,  0,  0,  0,  0,  0,  0, 40,  3,  0,  0, 84,  0,  0,  0,  0,
+/* 0x3190 */   0,  0,  0, 49,  3,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0, 58,
+/* 0x31a0 */   3,  0,  0, 86,  0,  0,  0,  0,  0,  0,  0, 68,  3,  0,  0, 87,
+/* 0x31b0 */   0,  0,  0,  0,  0,  0,  0, 77,  3,  0,  0, 88,  0,  0,  0,  0,
+/* 0x31c0 */   0,  0,  0, 86,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0, 95,
+/* 0x31d0 */   3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,104,  3,  0,  0, 91,
+/* 0x31e0 */   0,  0,  0,  0,  0,  0,  0,113,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x31f0 */ 222,173,222,123,  3,  0,  0, 93,  0,  0,  0,173,222,173,222,133,
+/* 0x3200 */   3,  0,  0, 93,  0,  0,  0,173,222,173,222,147,  3,  0,  0, 93,
+/* 0x3210 */   0,  0,  0,173,222,173,222,160,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x3220 */ 222,173,222,173,  3,  0,  0, 93,  0,  0,  0,173,222,173,222,189,
+/* 0x3230 */   3,  0,  0, 93,  0,  0,  0,173,222,173,222,203,  3,  0,  0, 93,
+/* 0x3240 */   0,  0,  0,173,222,173,222,215,  3,  0,  0, 93,  0,  0,  0,173,
+/* 0x3250 */ 222,173,222,230,  3,  0,  0, 93,  0,  0,  0,173,222,173,222,250,
+/* 0x3260 */   3,  0,  0, 93,  0,  0,  0,173,222,173,222, 13,  4,  0,  0, 93,
+/* 0x3270 */   0,  0,  0,173,222,173,222, 22,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3280 */ 222,173,222, 40,  4,  0,  0, 93,  0,  0,  0,173,222,173,222, 54,
+/* 0x3290 */   4,  0,  0, 93,  0,  0,  0,173,222,173,222, 65,  4,  0,  0, 93,
+/* 0x32a0 */   0,  0,  0,173,222,173,222, 79,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x32b0 */ 222,173,222, 90,  4,  0,  0, 93,  0,  0,  0,173,222,173,222,106,
+/* 0x32c0 */   4,  0,  0, 93,  0,  0,  0,173,222,173,222,125,  4,  0,  0, 93,
+/* 0x32d0 */   0,  0,  0,173,222,173,222,147,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x32e0 */ 222,173,222,166,  4,  0,  0, 93,  0,  0,  0,173,222,173,222,177,
+/* 0x32f0 */   4,  0,  0, 93,  0,  0,  0,173,222,173,222,189,  4,  0,  0, 93,
+/* 0x3300 */   0,  0,  0,173,222,173,222,201,  4,  0,  0, 93,  0,  0,  0,173,
+/* 0x3310 */ 222,173,222,213,  4,  0,  0, 93,  0,  0,  0,173,222,173,222,  0,
+/* 0x3320 */   0,  0,  0,  4,  0,  0,  0,225,  4,  0,  0,113,  3,  0,  0,  0,
+/* 0x3330 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,225,
+/* 0x3340 */   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3350 */   0,  0,  0,  8,  0,  0,  0,225,  4,  0,  0,123,  3,  0,  0,  0,
+/* 0x3360 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,225,
+/* 0x3370 */   4,  0,  0,133,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3380 */   0,  0,  0, 16,  0,  0,  0,225,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3390 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,225,
+/* 0x33a0 */   4,  0,  0,147,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33b0 */   0,  0,  0, 28,  0,  0,  0,225,  4,  0,  0,160,  3,  0,  0,  0,
+/* 0x33c0 */   0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,225,
+/* 0x33d0 */   4,  0,  0,147,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
+/* 0x33e0 */   0,  0,  0,  8,  0,  0,  0,225,  4,  0,  0, 53,  1,  0,  0,  0,
+/* 0x33f0 */   0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  2,  0,  0,  0,234,
+/* 0x3400 */   4,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
+/* 0x3410 */   0,  0,  0,  8,  0,  0,  0,234,  4,  0,  0,100,  0,  0,  0,  0,
+/* 0x3420 */   0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  1,  0,  0,  0,245,
+/* 0x3430 */   4,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,
+/* 0x3440 */   0,  0,  0,  1,  0,  0,  0,245,  4,  0,  0,100,  0,  0,  0,  0,
+/* 0x3450 */   0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0,245,
+/* 0x3460 */   4,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,
+/* 0x3470 */   0,  0,  0, 16,  0,  0,  0,234,  4,  0,  0,100,  0,  0,  0,  0,
+/* 0x3480 */   0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 24,  0,  0,  0,234,
+/* 0x3490 */   4,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,
+/* 0x34a0 */   0,  0,  0,  8,  0,  0,  0,245,  4,  0,  0, 46,  0,  0,  0,  0,
+/* 0x34b0 */   0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  2,  0,  0,  0,225,
+/* 0x34c0 */   4,  0,  0,173,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,
+/* 0x34d0 */   0,  0,  0,  2,  0,  0,  0,245,  4,  0,  0,109,  0,  0,  0,  0,
+/* 0x34e0 */   0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,225,
+/* 0x34f0 */   4,  0,  0,173,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,
+/* 0x3500 */   0,  0,  0,  1,  0,  0,  0,245,  4,  0,  0,100,  0,  0,  0,  0,
+/* 0x3510 */   0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  1,  0,  0,  0,245,
+/* 0x3520 */   4,  0,  0,226,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24,
+/* 0x3530 */   0,  0,  0,  2,  0,  0,  0,245,  4,  0,  0,172,  0,  0,  0,  0,
+/* 0x3540 */   0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  1,  0,  0,  0,225,
+/* 0x3550 */   4,  0,  0,189,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,
+/* 0x3560 */   0,  0,  0,  4,  0,  0,  0,225,  4,  0,  0,203,  3,  0,  0,  0,
+/* 0x3570 */   0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0, 15,  0,  0,  0,225,
+/* 0x3580 */   4,  0,  0,215,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,
+/* 0x3590 */   0,  0,  0, 20,  0,  0,  0,225,  4,  0,  0,230,  3,  0,  0,  0,
+/* 0x35a0 */   0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  3,  0,  0,  0,225,
+/* 0x35b0 */   4,  0,  0,235,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,
+/* 0x35c0 */   0,  0,  0,  3,  0,  0,  0,255,  4,  0,  0,235,  0,  0,  0,  0,
+/* 0x35d0 */   0,  0,  0,  0,  0,  0,  0, 28,  0,  0,  0,  1,  0,  0,  0,245,
+/* 0x35e0 */   4,  0,  0,235,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,
+/* 0x35f0 */   0,  0,  0,  7,  0,  0,  0,225,  4,  0,  0,250,  3,  0,  0,  0,
+/* 0x3600 */   0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  1,  0,  0,  0,225,
+/* 0x3610 */   4,  0,  0, 13,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,
+/* 0x3620 */   0,  0,  0,  6,  0,  0,  0,234,  4,  0,  0,165,  1,  0,  0,  0,
+/* 0x3630 */   0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,  1,  0,  0,  0,234,
+/* 0x3640 */   4,  0,  0,165,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,
+/* 0x3650 */   0,  0,  0,  4,  0,  0,  0,245,  4,  0,  0,183,  1,  0,  0,  0,
+/* 0x3660 */   0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0, 10,  0,  0,  0,245,
+/* 0x3670 */   4,  0,  0,138,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,
+/* 0x3680 */   0,  0,  0, 10,  0,  0,  0,234,  4,  0,  0,165,  1,  0,  0,  0,
+/* 0x3690 */   0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0, 18,  0,  0,  0,234,
+/* 0x36a0 */   4,  0,  0,165,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,
+/* 0x36b0 */   0,  0,  0, 48,  0,  0,  0,245,  4,  0,  0, 93,  1,  0,  0,  0,
+/* 0x36c0 */   0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,  5,  0,  0,  0,245,
+/* 0x36d0 */   4,  0,  0,138,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,
+/* 0x36e0 */   0,  0,  0, 18,  0,  0,  0,245,  4,  0,  0,183,  1,  0,  0,  0,
+/* 0x36f0 */   0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,234,
+/* 0x3700 */   4,  0,  0,  8,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,
+/* 0x3710 */   0,  0,  0,  1,  0,  0,  0,234,  4,  0,  0,  8,  2,  0,  0,  0,
+/* 0x3720 */   0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  7,  0,  0,  0,234,
+/* 0x3730 */   4,  0,  0,  8,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,
+/* 0x3740 */   0,  0,  0, 14,  0,  0,  0,245,  4,  0,  0, 26,  2,  0,  0,  0,
+/* 0x3750 */   0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0, 18,  0,  0,  0,245,
+/* 0x3760 */   4,  0,  0,237,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,
+/* 0x3770 */   0,  0,  0, 14,  0,  0,  0,234,  4,  0,  0,  8,  2,  0,  0,  0,
+/* 0x3780 */   0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 19,  0,  0,  0,234,
+/* 0x3790 */   4,  0,  0,  8,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,
+/* 0x37a0 */   0,  0,  0, 27,  0,  0,  0,234,  4,  0,  0,  8,  2,  0,  0,  0,
+/* 0x37b0 */   0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 56,  0,  0,  0,245,
+/* 0x37c0 */   4,  0,  0,192,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,
+/* 0x37d0 */   0,  0,  0,  5,  0,  0,  0,245,  4,  0,  0,237,  1,  0,  0,  0,
+/* 0x37e0 */   0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0, 18,  0,  0,  0,245,
+/* 0x37f0 */   4,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,
+/* 0x3800 */   0,  0,  0,  6,  0,  0,  0,234,  4,  0,  0,107,  2,  0,  0,  0,
+/* 0x3810 */   0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  1,  0,  0,  0,234,
+/* 0x3820 */   4,  0,  0,107,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,
+/* 0x3830 */   0,  0,  0,  7,  0,  0,  0,234,  4,  0,  0,107,  2,  0,  0,  0,
+/* 0x3840 */   0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0, 14,  0,  0,  0,245,
+/* 0x3850 */   4,  0,  0,125,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,
+/* 0x3860 */   0,  0,  0, 18,  0,  0,  0,245,  4,  0,  0, 80,  2,  0,  0,  0,
+/* 0x3870 */   0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 14,  0,  0,  0,234,
+/* 0x3880 */   4,  0,  0,107,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,
+/* 0x3890 */   0,  0,  0, 21,  0,  0,  0,234,  4,  0,  0,107,  2,  0,  0,  0,
+/* 0x38a0 */   0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 27,  0,  0,  0,234,
+/* 0x38b0 */   4,  0,  0,107,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63,
+/* 0x38c0 */   0,  0,  0, 32,  0,  0,  0,234,  4,  0,  0,107,  2,  0,  0,  0,
+/* 0x38d0 */   0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 61,  0,  0,  0,245,
+/* 0x38e0 */   4,  0,  0, 35,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,
+/* 0x38f0 */   0,  0,  0,  5,  0,  0,  0,245,  4,  0,  0, 80,  2,  0,  0,  0,
+/* 0x3900 */   0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0, 18,  0,  0,  0,245,
+/* 0x3910 */   4,  0,  0,125,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,
+/* 0x3920 */   0,  0,  0,  4,  0,  0,  0,225,  4,  0,  0, 22,  4,  0,  0,  0,
+/* 0x3930 */   0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 12,  0,  0,  0,225,
+/* 0x3940 */   4,  0,  0, 40,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,
+/* 0x3950 */   0,  0,  0, 16,  0,  0,  0,225,  4,  0,  0, 54,  4,  0,  0,  0,
+/* 0x3960 */   0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 26,  0,  0,  0,225,
+/* 0x3970 */   4,  0,  0, 65,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,
+/* 0x3980 */   0,  0,  0, 30,  0,  0,  0,225,  4,  0,  0, 79,  4,  0,  0,  0,
+/* 0x3990 */   0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 44,  0,  0,  0,225,
+/* 0x39a0 */   4,  0,  0, 90,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,
+/* 0x39b0 */   0,  0,  0, 49,  0,  0,  0,255,  4,  0,  0,106,  4,  0,  0,  0,
+/* 0x39c0 */   0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,255,
+/* 0x39d0 */   4,  0,  0, 54,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x39e0 */   0,  0,  0,  1,  0,  0,  0,255,  4,  0,  0,134,  2,  0,  0,  0,
+/* 0x39f0 */   0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  2,  0,  0,  0,255,
+/* 0x3a00 */   4,  0,  0, 79,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x3a10 */   0,  0,  0,  3,  0,  0,  0,255,  4,  0,  0,134,  2,  0,  0,  0,
+/* 0x3a20 */   0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  4,  0,  0,  0,255,
+/* 0x3a30 */   4,  0,  0, 90,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x3a40 */   0,  0,  0,  5,  0,  0,  0,255,  4,  0,  0,134,  2,  0,  0,  0,
+/* 0x3a50 */   0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  6,  0,  0,  0,255,
+/* 0x3a60 */   4,  0,  0, 54,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,
+/* 0x3a70 */   0,  0,  0,  7,  0,  0,  0,255,  4,  0,  0,211,  2,  0,  0,  0,
+/* 0x3a80 */   0,  0,  0,  0,  0,  0,  0, 74,  0,  0,  0,  3,  0,  0,  0,225,
+/* 0x3a90 */   4,  0,  0,125,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 75,
+/* 0x3aa0 */   0,  0,  0,  3,  0,  0,  0,225,  4,  0,  0, 54,  4,  0,  0,  0,
+/* 0x3ab0 */   0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,  3,  0,  0,  0,225,
+/* 0x3ac0 */   4,  0,  0,147,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80,
+/* 0x3ad0 */   0,  0,  0,  2,  0,  0,  0,225,  4,  0,  0,166,  4,  0,  0,  0,
+/* 0x3ae0 */   0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0, 26,  0,  0,  0,245,
+/* 0x3af0 */   4,  0,  0, 22,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,
+/* 0x3b00 */   0,  0,  0, 17,  0,  0,  0,245,  4,  0,  0,  4,  3,  0,  0,  0,
+/* 0x3b10 */   0,  0,  0,  0,  0,  0,  0, 83,  0,  0,  0,  1,  0,  0,  0,245,
+/* 0x3b20 */   4,  0,  0,  4,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 84,
+/* 0x3b30 */   0,  0,  0,  1,  0,  0,  0,245,  4,  0,  0,  4,  3,  0,  0,  0,
+/* 0x3b40 */   0,  0,  0,  0,  0,  0,  0, 87,  0,  0,  0,  2,  0,  0,  0,225,
+/* 0x3b50 */   4,  0,  0,177,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,
+/* 0x3b60 */   0,  0,  0,  1,  0,  0,  0,225,  4,  0,  0,189,  4,  0,  0,  0,
+/* 0x3b70 */   0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,  1,  0,  0,  0,225,
+/* 0x3b80 */   4,  0,  0,201,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,
+/* 0x3b90 */   0,  0,  0,  3,  0,  0,  0,225,  4,  0,  0,213,  4,  0,  0,  0,
+/* 0x3ba0 */   0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,  2,  0,  0,  0,225,
+/* 0x3bb0 */   4,  0,  0,213,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,
+/* 0x3bc0 */   0,  0,  0,  2,  0,  0,  0,225,  4,  0,  0,201,  4,  0,  0,  0,
+/* 0x3bd0 */   0,  0,  0,  0,  0,  0,  0, 68, 69, 86, 73, 67, 69, 69, 78, 84,
+/* 0x3be0 */  82, 89,  0, 76, 90, 77, 65, 68, 69, 86, 73, 67, 69,  0, 68, 69,
+/* 0x3bf0 */  86, 73, 67, 69, 69, 78, 84, 82, 89, 50,  0, 76, 90, 77, 65, 69,
+/* 0x3c00 */  78, 84, 82, 89,  0, 78, 82, 86, 50, 66, 49, 54, 48,  0, 78, 82,
+/* 0x3c10 */  86, 68, 68, 79, 78, 69,  0, 78, 82, 86, 68, 82, 69, 84, 85,  0,
+/* 0x3c20 */  78, 82, 86, 68, 69, 67, 79, 49,  0, 78, 82, 86, 76, 69, 68, 48,
+/* 0x3c30 */  48,  0, 78, 82, 86, 71, 84, 68, 48, 48,  0, 78, 82, 86, 68, 69,
+/* 0x3c40 */  67, 79, 50,  0, 67, 65, 76, 76, 84, 82, 49, 54,  0, 67, 84, 49,
+/* 0x3c50 */  54, 73, 50, 56, 54,  0, 67, 84, 49, 54, 83, 85, 66, 48,  0, 67,
+/* 0x3c60 */  84, 49, 54, 73, 48, 56, 54,  0, 67, 65, 76, 76, 84, 82, 73, 50,
+/* 0x3c70 */   0, 67, 84, 49, 54, 69, 56, 48, 48,  0, 67, 84, 49, 54, 69, 57,
+/* 0x3c80 */  48, 48,  0, 67, 65, 76, 76, 84, 82, 73, 53,  0, 67, 84, 49, 54,
+/* 0x3c90 */  74, 69, 78, 68,  0, 67, 84, 49, 54, 74, 85, 76, 50,  0, 67, 84,
+/* 0x3ca0 */  49, 54, 73, 50, 56, 55,  0, 67, 84, 49, 54, 83, 85, 66, 49,  0,
+/* 0x3cb0 */  67, 84, 49, 54, 73, 48, 56, 55,  0, 67, 65, 76, 76, 84, 82, 73,
+/* 0x3cc0 */  54,  0, 69, 88, 69, 69, 78, 84, 82, 89,  0, 76, 79, 78, 71, 83,
+/* 0x3cd0 */  85, 66,  0, 83, 72, 79, 82, 84, 83, 85, 66,  0, 74, 78, 67, 68,
+/* 0x3ce0 */  79, 67, 79, 80, 89,  0, 69, 88, 69, 82, 69, 76, 80, 85,  0, 69,
+/* 0x3cf0 */  88, 69, 77, 65, 73, 78, 52,  0, 69, 88, 69, 77, 65, 73, 78, 52,
+/* 0x3d00 */  66,  0, 69, 88, 69, 77, 65, 73, 78, 52, 67,  0, 67, 79, 77, 80,
+/* 0x3d10 */  82, 69, 83, 83, 69, 68, 95, 76, 90, 77, 65, 95, 83, 84, 65, 82,
+/* 0x3d20 */  84,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0, 69, 88, 69, 67, 85,
+/* 0x3d30 */  84, 80, 79,  0, 78, 82, 86, 50, 66, 49, 54, 83,  0, 78, 50, 66,
+/* 0x3d40 */  54, 52, 75, 48, 49,  0, 78, 82, 86, 50, 66, 69, 88, 49,  0, 78,
+/* 0x3d50 */  50, 66, 88, 56, 54, 48, 49,  0, 78, 50, 66, 50, 56, 54, 48, 49,
+/* 0x3d60 */   0, 78, 82, 86, 50, 66, 69, 88, 50,  0, 78, 50, 66, 88, 56, 54,
+/* 0x3d70 */  48, 50,  0, 78, 50, 66, 50, 56, 54, 48, 50,  0, 78, 82, 86, 50,
+/* 0x3d80 */  66, 69, 88, 51,  0, 78, 50, 66, 54, 52, 75, 48, 50,  0, 78, 82,
+/* 0x3d90 */  86, 50, 66, 69, 88, 57,  0, 78, 82, 86, 50, 68, 49, 54, 83,  0,
+/* 0x3da0 */  78, 50, 68, 54, 52, 75, 48, 49,  0, 78, 82, 86, 50, 68, 69, 88,
+/* 0x3db0 */  49,  0, 78, 50, 68, 88, 56, 54, 48, 49,  0, 78, 50, 68, 50, 56,
+/* 0x3dc0 */  54, 48, 49,  0, 78, 82, 86, 50, 68, 69, 88, 50,  0, 78, 50, 68,
+/* 0x3dd0 */  88, 56, 54, 48, 50,  0, 78, 50, 68, 50, 56, 54, 48, 50,  0, 78,
+/* 0x3de0 */  82, 86, 50, 68, 69, 88, 51,  0, 78, 50, 68, 54, 52, 75, 48, 50,
+/* 0x3df0 */   0, 78, 82, 86, 50, 68, 69, 88, 57,  0, 78, 82, 86, 50, 69, 49,
+/* 0x3e00 */  54, 83,  0, 78, 50, 69, 54, 52, 75, 48, 49,  0, 78, 82, 86, 50,
+/* 0x3e10 */  69, 69, 88, 49,  0, 78, 50, 69, 88, 56, 54, 48, 49,  0, 78, 50,
+/* 0x3e20 */  69, 50, 56, 54, 48, 49,  0, 78, 82, 86, 50, 69, 69, 88, 50,  0,
+/* 0x3e30 */  78, 50, 69, 88, 56, 54, 48, 50,  0, 78, 50, 69, 50, 56, 54, 48,
+/* 0x3e40 */  50,  0, 78, 82, 86, 50, 69, 69, 88, 51,  0, 78, 50, 69, 54, 52,
+/* 0x3e50 */  75, 48, 50,  0, 78, 82, 86, 50, 69, 69, 88, 57,  0, 76, 90, 77,
+/* 0x3e60 */  65, 95, 68, 69, 67, 48, 48,  0,105,103,110,111,114,101, 95,114,
+/* 0x3e70 */ 101,108,111, 99, 95,111,118,101,114,102,108,111,119,  0, 76, 90,
+/* 0x3e80 */  77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x3e90 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76,
+/* 0x3ea0 */  90, 77, 65, 95, 68, 69, 67, 51, 49,  0, 76, 90, 77, 65, 95, 68,
+/* 0x3eb0 */  69, 67, 51, 50,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 51,  0,
+/* 0x3ec0 */  69, 88, 69, 77, 65, 73, 78, 53,  0, 69, 88, 69, 65, 68, 74, 85,
+/* 0x3ed0 */  83,  0, 69, 88, 69, 78, 79, 65, 68, 74,  0, 69, 88, 69, 82, 69,
+/* 0x3ee0 */  76, 79, 49,  0, 69, 88, 69, 82, 69, 76, 57, 65,  0, 69, 88, 69,
+/* 0x3ef0 */  82, 69, 76, 79, 50,  0, 69, 88, 69, 82, 69, 66, 73, 71,  0, 69,
+/* 0x3f00 */  88, 69, 82, 69, 76, 79, 51,  0, 69, 88, 69, 77, 65, 73, 78, 56,
+/* 0x3f10 */   0, 68, 69, 86, 73, 67, 69, 69, 78, 68,  0, 69, 88, 69, 83, 84,
+/* 0x3f20 */  65, 67, 75,  0, 69, 88, 69, 83, 84, 65, 83, 80,  0, 69, 88, 69,
+/* 0x3f30 */  74, 85, 77, 80, 70,  0, 69, 88, 69, 82, 67, 83, 80, 79,  0, 69,
+/* 0x3f40 */  88, 69, 82, 69, 84, 73, 80,  0, 97,116,116,114,105, 98,117,116,
+/* 0x3f50 */ 101,  0,105,110,116,101,114,114,117,112,116,  0,111,114,105,103,
+/* 0x3f60 */  95,115,116,114, 97,116,101,103,121,  0,101,120,101, 95,115,116,
+/* 0x3f70 */  97, 99,107, 95,115,115,  0,101,120,101, 95,115,116, 97, 99,107,
+/* 0x3f80 */  95,115,112,  0, 99, 97,108,108,116,114,105, 99,107, 95, 99, 97,
+/* 0x3f90 */ 108,108,115,  0,119,111,114,100,115, 95,116,111, 95, 99,111,112,
+/* 0x3fa0 */ 121,  0, 99,111,112,121, 95,111,102,102,115,101,116,  0,115,111,
+/* 0x3fb0 */ 117,114, 99,101, 95,115,101,103,109,101,110,116,  0,100,101,115,
+/* 0x3fc0 */ 116,105,110, 97,116,105,111,110, 95,115,101,103,109,101,110,116,
+/* 0x3fd0 */   0,100,101, 99,111,109,112,114,101,115,115,111,114, 95,101,110,
+/* 0x3fe0 */ 116,114,121,  0, 98,120, 95,109, 97,103,105, 99,  0,108,122,109,
+/* 0x3ff0 */  97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,  0,108,
+/* 0x4000 */ 122,109, 97, 95,117, 95,108,101,110, 95,104,105,  0,108,122,109,
+/* 0x4010 */  97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,
+/* 0x4020 */ 101,110, 95,104,105,  0,108,122,109, 97, 95, 99, 95,108,101,110,
+/* 0x4030 */   0,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,
+/* 0x4040 */   0,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,
+/* 0x4050 */  95,104,105,  0, 99,108,101, 97,114, 95,100,105,114,116,121, 95,
+/* 0x4060 */ 115,116, 97, 99,107, 95,108,111,119,  0,108,122,109, 97, 95,117,
+/* 0x4070 */  95,108,101,110, 95,115,101,103,109,101,110,116,  0,114,101,108,
+/* 0x4080 */ 111, 99, 95,115,105,122,101,  0,111,114,105,103,105,110, 97,108,
+/* 0x4090 */  95,115,115,  0,111,114,105,103,105,110, 97,108, 95,115,112,  0,
+/* 0x40a0 */ 111,114,105,103,105,110, 97,108, 95,105,112,  0,111,114,105,103,
+/* 0x40b0 */ 105,110, 97,108, 95, 99,115,  0, 82, 95, 51, 56, 54, 95, 49, 54,
+/* 0x40c0 */   0, 82, 95, 51, 56, 54, 95, 80, 67, 49, 54,  0, 82, 95, 51, 56,
+/* 0x40d0 */  54, 95, 80, 67, 56,  0, 82, 95, 51, 56, 54, 95, 56,  0,199, 39,
+/* 0x40e0 */   0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* i386-bsd.elf-entry.h
-   created from i386-bsd.elf-entry.bin, 30750 (0x781e) bytes
+   created from i386-bsd.elf-entry.bin, 15914 (0x3e2a) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_BSD_ELF_ENTRY_SIZE    30750
-#define STUB_I386_BSD_ELF_ENTRY_ADLER32 0x927c03e7
-#define STUB_I386_BSD_ELF_ENTRY_CRC32   0xc9c68fc4
+#define STUB_I386_BSD_ELF_ENTRY_SIZE    15914
+#define STUB_I386_BSD_ELF_ENTRY_ADLER32 0x6611cf3d
+#define STUB_I386_BSD_ELF_ENTRY_CRC32   0xc93f82b0
 
-unsigned char stub_i386_bsd_elf_entry[30750] = {
+unsigned char stub_i386_bsd_elf_entry[15914] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 160, 34,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -473,1489 +473,562 @@ unsigned char stub_i386_bsd_elf_entry[30750] = {
 /* 0x1b20 */  82,184,197,  0,  0,  0,205,128, 15,130,252,255,255,255,146, 91,
 /* 0x1b30 */  83,252,173, 80,137,225, 80, 81, 82,173, 80,173,137, 68, 36, 12,
 /* 0x1b40 */  86,255,213,131,196, 60,195, 93,232, 48,  0,  0,  0,  0,  0,  0,
-/* 0x1b50 */   0,102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102,
-/* 0x1b60 */  51, 50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x1b70 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x1b80 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1b90 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1ba0 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1bb0 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 76, 69, 88,
-/* 0x1bc0 */  69, 67, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x1bd0 */  32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1be0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 76, 69, 88,
-/* 0x1bf0 */  69, 67, 48, 48, 57, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1c00 */  32, 48, 32, 32, 48, 51, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1c10 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 76, 69, 88, 69,
-/* 0x1c20 */  67, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32,
-/* 0x1c30 */  32, 48, 32, 32, 48, 51, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1c40 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78, 50, 66, 83,
-/* 0x1c50 */  77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32,
-/* 0x1c60 */  32, 48, 32, 32, 48, 52, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1c70 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78, 50, 66, 70,
-/* 0x1c80 */  65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x1c90 */  32, 48, 32, 32, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1ca0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 78, 50, 66, 70,
-/* 0x1cb0 */  65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32,
-/* 0x1cc0 */  32, 48, 32, 32, 48, 52, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1cd0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 78, 50, 66, 68,
-/* 0x1ce0 */  69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32,
-/* 0x1cf0 */  32, 48, 32, 32, 48, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1d00 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 78, 50, 66, 83,
-/* 0x1d10 */  77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x1d20 */  32, 48, 32, 32, 48, 53, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1d30 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 78, 50, 66, 70,
-/* 0x1d40 */  65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32,
-/* 0x1d50 */  32, 48, 32, 32, 48, 54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1d60 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 78, 50, 66, 68,
-/* 0x1d70 */  69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32,
-/* 0x1d80 */  32, 48, 32, 32, 48, 54, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1d90 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 78, 50, 66, 83,
-/* 0x1da0 */  77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32,
-/* 0x1db0 */  32, 48, 32, 32, 48, 55, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1dc0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 78, 50, 66, 70,
-/* 0x1dd0 */  65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32,
-/* 0x1de0 */  32, 48, 32, 32, 48, 56, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1df0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 78, 50, 66, 68,
-/* 0x1e00 */  69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 51,101, 32, 32, 48,
-/* 0x1e10 */  32, 32, 48, 32, 32, 48, 57, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e20 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32, 78, 50, 66,
-/* 0x1e30 */  83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48,
-/* 0x1e40 */  32, 32, 48, 32, 32, 48,100, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e50 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 52, 32, 78, 50, 66,
-/* 0x1e60 */  70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48,
-/* 0x1e70 */  32, 32, 48, 32, 32, 48,100,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e80 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 53, 32, 78, 50, 66,
-/* 0x1e90 */  83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x1ea0 */  32, 32, 48, 32, 32, 48,101, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1eb0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 54, 32, 78, 50, 66,
-/* 0x1ec0 */  70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x1ed0 */  32, 32, 48, 32, 32, 48,101,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1ee0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 55, 32, 78, 50, 66,
-/* 0x1ef0 */  68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48,
-/* 0x1f00 */  32, 32, 48, 32, 32, 48,102, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f10 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 56, 32, 78, 50, 66,
-/* 0x1f20 */  83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48,
-/* 0x1f30 */  32, 32, 48, 32, 32, 48,102, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f40 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 57, 32, 78, 50, 66,
-/* 0x1f50 */  70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32,
-/* 0x1f60 */  48, 32, 32, 48, 32, 32, 48, 49, 48, 54, 32, 32, 50, 42, 42, 48,
-/* 0x1f70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 48, 32, 78,
-/* 0x1f80 */  50, 66, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54,
-/* 0x1f90 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 49,102, 32, 32, 50, 42,
-/* 0x1fa0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 49,
-/* 0x1fb0 */  32, 78, 50, 66, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1fc0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 53, 32, 32, 50, 42,
-/* 0x1fd0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 50,
-/* 0x1fe0 */  32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1ff0 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 53, 32, 32, 50,
-/* 0x2000 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x2010 */  51, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2020 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 56, 32, 32,
-/* 0x2030 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2040 */  50, 52, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32,
-/* 0x2050 */  32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 97, 32,
-/* 0x2060 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2070 */  32, 50, 53, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x2080 */  32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 52, 48,
-/* 0x2090 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x20a0 */  10, 32, 50, 54, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 32, 32,
-/* 0x20b0 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 52,
-/* 0x20c0 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x20d0 */  83, 10, 32, 50, 55, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 32,
-/* 0x20e0 */  32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x20f0 */  53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2100 */  84, 83, 10, 32, 50, 56, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32,
-/* 0x2110 */  32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2120 */  49, 53, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2130 */  78, 84, 83, 10, 32, 50, 57, 32, 78, 50, 68, 83, 77, 65, 51, 48,
-/* 0x2140 */  32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2150 */  48, 49, 54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2160 */  69, 78, 84, 83, 10, 32, 51, 48, 32, 78, 50, 68, 70, 65, 83, 51,
-/* 0x2170 */  48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2180 */  32, 48, 49, 55, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2190 */  84, 69, 78, 84, 83, 10, 32, 51, 49, 32, 78, 50, 68, 68, 69, 67,
-/* 0x21a0 */  51, 48, 32, 32, 32, 32, 32, 32, 48, 53, 50, 32, 32, 48, 32, 32,
-/* 0x21b0 */  48, 32, 32, 48, 49, 56, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x21c0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 50, 32, 78, 50, 68, 83,
-/* 0x21d0 */  77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32,
-/* 0x21e0 */  32, 48, 32, 32, 48, 49,100, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x21f0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 51, 32, 78, 50, 68,
-/* 0x2200 */  70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48,
-/* 0x2210 */  32, 32, 48, 32, 32, 48, 49,101, 49, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2220 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 52, 32, 78, 50,
-/* 0x2230 */  68, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x2240 */  48, 32, 32, 48, 32, 32, 48, 49,102, 48, 32, 32, 50, 42, 42, 48,
-/* 0x2250 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 53, 32, 78,
-/* 0x2260 */  50, 68, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32,
-/* 0x2270 */  32, 48, 32, 32, 48, 32, 32, 48, 49,102, 50, 32, 32, 50, 42, 42,
-/* 0x2280 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 54, 32,
-/* 0x2290 */  78, 50, 68, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57,
-/* 0x22a0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102, 53, 32, 32, 50, 42,
-/* 0x22b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 55,
-/* 0x22c0 */  32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x22d0 */  99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102,101, 32, 32, 50,
-/* 0x22e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51,
-/* 0x22f0 */  56, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2300 */  48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 48, 97, 32,
-/* 0x2310 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2320 */  32, 51, 57, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32, 32,
-/* 0x2330 */  32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 50,
-/* 0x2340 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2350 */  83, 10, 32, 52, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 32,
-/* 0x2360 */  32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 51,
-/* 0x2370 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2380 */  83, 10, 32, 52, 49, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32, 32,
-/* 0x2390 */  32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x23a0 */  51, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x23b0 */  84, 83, 10, 32, 52, 50, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32,
-/* 0x23c0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x23d0 */  50, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x23e0 */  78, 84, 83, 10, 32, 52, 51, 32, 78, 50, 69, 70, 65, 83, 49, 49,
-/* 0x23f0 */  32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2400 */  48, 50, 51,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2410 */  69, 78, 84, 83, 10, 32, 52, 52, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x2420 */  48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2430 */  32, 48, 50, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2440 */  84, 69, 78, 84, 83, 10, 32, 52, 53, 32, 78, 50, 69, 83, 77, 65,
-/* 0x2450 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x2460 */  32, 32, 48, 50, 52,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2470 */  78, 84, 69, 78, 84, 83, 10, 32, 52, 54, 32, 78, 50, 69, 70, 65,
-/* 0x2480 */  83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32,
-/* 0x2490 */  48, 32, 32, 48, 50, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x24a0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 55, 32, 78, 50, 69, 68,
-/* 0x24b0 */  69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32,
-/* 0x24c0 */  32, 48, 32, 32, 48, 50, 53,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x24d0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 56, 32, 78, 50, 69,
-/* 0x24e0 */  83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48,
-/* 0x24f0 */  32, 32, 48, 32, 32, 48, 50, 54, 97, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2500 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 57, 32, 78, 50,
-/* 0x2510 */  69, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32,
-/* 0x2520 */  48, 32, 32, 48, 32, 32, 48, 50, 55, 55, 32, 32, 50, 42, 42, 48,
-/* 0x2530 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 48, 32, 78,
-/* 0x2540 */  50, 69, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 53,102,
-/* 0x2550 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 54, 32, 32, 50, 42,
-/* 0x2560 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 49,
-/* 0x2570 */  32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2580 */ 100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,101, 53, 32, 32, 50,
-/* 0x2590 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x25a0 */  50, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x25b0 */  48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,102, 50, 32, 32,
-/* 0x25c0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x25d0 */  53, 51, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32,
-/* 0x25e0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 48, 49, 32,
-/* 0x25f0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2600 */  32, 53, 52, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32,
-/* 0x2610 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 48, 51,
-/* 0x2620 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2630 */  10, 32, 53, 53, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32, 32,
-/* 0x2640 */  32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 48,
-/* 0x2650 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2660 */  83, 10, 32, 53, 54, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 32,
-/* 0x2670 */  32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2680 */  48,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2690 */  84, 83, 10, 32, 53, 55, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32,
-/* 0x26a0 */  32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x26b0 */  48, 51, 49, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x26c0 */  69, 78, 84, 83, 10, 32, 53, 56, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x26d0 */  49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48,
-/* 0x26e0 */  32, 32, 48, 51, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x26f0 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 57, 32, 78, 50, 69, 68, 69,
-/* 0x2700 */  67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2710 */  32, 32, 48, 51, 52, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2720 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 48, 32, 76, 90, 77, 65, 95,
-/* 0x2730 */  68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 50,101, 32, 32, 48, 32,
-/* 0x2740 */  32, 48, 32, 32, 48, 51, 52, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2750 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 49, 32, 76, 90, 77,
-/* 0x2760 */  65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 52, 56, 32, 32,
-/* 0x2770 */  48, 32, 32, 48, 32, 32, 48, 51, 55, 56, 32, 32, 50, 42, 42, 48,
-/* 0x2780 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 50, 32, 76,
-/* 0x2790 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 97, 56,
-/* 0x27a0 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 99, 48, 32, 32, 50,
-/* 0x27b0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54,
-/* 0x27c0 */  51, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32,
-/* 0x27d0 */  48, 97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 52, 54,
-/* 0x27e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x27f0 */  10, 32, 54, 52, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32,
-/* 0x2800 */  32, 32, 32, 48, 49, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2810 */  56, 99, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2820 */  78, 84, 83, 10, 32, 54, 53, 32, 76, 69, 88, 69, 67, 48, 49, 53,
-/* 0x2830 */  32, 32, 32, 32, 32, 32, 48, 49,100, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2840 */  32, 48, 49, 56,101, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2850 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 54, 32, 76, 88, 85, 78, 70,
-/* 0x2860 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2870 */  48, 32, 32, 48, 49, 57, 48, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2880 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 55, 32, 76, 88, 85,
-/* 0x2890 */  78, 70, 48, 48, 50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x28a0 */  32, 32, 48, 32, 32, 48, 49, 57, 48, 53, 32, 32, 50, 42, 42, 48,
-/* 0x28b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 56, 32, 77,
-/* 0x28c0 */  82, 85, 66, 89, 84, 69, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x28d0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 48, 97, 32, 32, 50, 42,
-/* 0x28e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 57,
-/* 0x28f0 */  32, 76, 88, 77, 82, 85, 48, 48, 53, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2900 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 48, 99, 32, 32,
-/* 0x2910 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2920 */  55, 48, 32, 76, 88, 77, 82, 85, 48, 48, 54, 32, 32, 32, 32, 32,
-/* 0x2930 */  32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 49, 49,
-/* 0x2940 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2950 */  10, 32, 55, 49, 32, 76, 88, 77, 82, 85, 48, 48, 55, 32, 32, 32,
-/* 0x2960 */  32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2970 */  49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2980 */  84, 83, 10, 32, 55, 50, 32, 76, 88, 85, 78, 70, 48, 48, 56, 32,
-/* 0x2990 */  32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x29a0 */  49, 57, 49,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x29b0 */  69, 78, 84, 83, 10, 32, 55, 51, 32, 76, 88, 85, 78, 70, 48, 49,
-/* 0x29c0 */  48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x29d0 */  32, 48, 49, 57, 50, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x29e0 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 52, 32, 76, 88, 74, 67, 67,
-/* 0x29f0 */  48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x2a00 */  48, 32, 32, 48, 49, 57, 50, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2a10 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 53, 32, 76, 88, 77,
-/* 0x2a20 */  82, 85, 48, 52, 53, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x2a30 */  32, 32, 48, 32, 32, 48, 49, 57, 50, 98, 32, 32, 50, 42, 42, 48,
-/* 0x2a40 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 54, 32, 76,
-/* 0x2a50 */  88, 77, 82, 85, 48, 52, 54, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x2a60 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50,101, 32, 32, 50, 42,
-/* 0x2a70 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 55,
-/* 0x2a80 */  32, 76, 88, 74, 67, 67, 48, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2a90 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 48, 32, 32,
-/* 0x2aa0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2ab0 */  55, 56, 32, 76, 88, 74, 67, 67, 48, 50, 49, 32, 32, 32, 32, 32,
-/* 0x2ac0 */  32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 50,
-/* 0x2ad0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2ae0 */  10, 32, 55, 57, 32, 76, 88, 74, 67, 67, 48, 50, 51, 32, 32, 32,
-/* 0x2af0 */  32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2b00 */  51, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b10 */  84, 83, 10, 32, 56, 48, 32, 76, 88, 85, 78, 70, 48, 51, 55, 32,
-/* 0x2b20 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2b30 */  49, 57, 51,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2b40 */  69, 78, 84, 83, 10, 32, 56, 49, 32, 76, 88, 85, 78, 70, 51, 56,
-/* 0x2b50 */  54, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2b60 */  32, 48, 49, 57, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2b70 */  78, 84, 69, 78, 84, 83, 10, 32, 56, 50, 32, 76, 88, 85, 78, 70,
-/* 0x2b80 */  51, 56, 55, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32,
-/* 0x2b90 */  48, 32, 32, 48, 49, 57, 52, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2ba0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 51, 32, 76, 88, 85,
-/* 0x2bb0 */  78, 70, 51, 56, 56, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x2bc0 */  32, 32, 48, 32, 32, 48, 49, 57, 52, 97, 32, 32, 50, 42, 42, 48,
-/* 0x2bd0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 52, 32, 76,
-/* 0x2be0 */  88, 85, 78, 70, 52, 56, 54, 32, 32, 32, 32, 32, 32, 48, 52, 32,
-/* 0x2bf0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 52,100, 32, 32, 50, 42,
-/* 0x2c00 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 53,
-/* 0x2c10 */  32, 76, 88, 85, 78, 70, 52, 56, 55, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2c20 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 49, 32, 32,
-/* 0x2c30 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2c40 */  56, 54, 32, 76, 88, 77, 82, 85, 48, 54, 53, 32, 32, 32, 32, 32,
-/* 0x2c50 */  32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 51,
-/* 0x2c60 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2c70 */  10, 32, 56, 55, 32, 77, 82, 85, 66, 89, 84, 69, 51, 32, 32, 32,
-/* 0x2c80 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2c90 */  53, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2ca0 */  84, 83, 10, 32, 56, 56, 32, 77, 82, 85, 65, 82, 66, 51, 48, 32,
-/* 0x2cb0 */  32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2cc0 */  49, 57, 53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2cd0 */  69, 78, 84, 83, 10, 32, 56, 57, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x2ce0 */  51, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2cf0 */  32, 48, 49, 57, 53, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2d00 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 48, 32, 77, 82, 85, 65, 82,
-/* 0x2d10 */  66, 52, 48, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32,
-/* 0x2d20 */  48, 32, 32, 48, 49, 57, 53,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2d30 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 49, 32, 76, 88, 77,
-/* 0x2d40 */  82, 85, 48, 55, 48, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48,
-/* 0x2d50 */  32, 32, 48, 32, 32, 48, 49, 57, 54, 49, 32, 32, 50, 42, 42, 48,
-/* 0x2d60 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 50, 32, 77,
-/* 0x2d70 */  82, 85, 66, 89, 84, 69, 52, 32, 32, 32, 32, 32, 32, 48, 51, 32,
-/* 0x2d80 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54, 57, 32, 32, 50, 42,
-/* 0x2d90 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 51,
-/* 0x2da0 */  32, 77, 82, 85, 66, 73, 84, 83, 52, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2db0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54, 99, 32, 32,
-/* 0x2dc0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2dd0 */  57, 52, 32, 77, 82, 85, 65, 82, 66, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2de0 */  32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54,101,
-/* 0x2df0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2e00 */  10, 32, 57, 53, 32, 76, 88, 77, 82, 85, 48, 56, 48, 32, 32, 32,
-/* 0x2e10 */  32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2e20 */  55, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2e30 */  84, 83, 10, 32, 57, 54, 32, 77, 82, 85, 66, 89, 84, 69, 53, 32,
-/* 0x2e40 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2e50 */  49, 57, 55, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2e60 */  69, 78, 84, 83, 10, 32, 57, 55, 32, 77, 82, 85, 65, 82, 66, 54,
-/* 0x2e70 */  48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2e80 */  32, 48, 49, 57, 55, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2e90 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 56, 32, 77, 82, 85, 66, 73,
-/* 0x2ea0 */  84, 83, 53, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2eb0 */  48, 32, 32, 48, 49, 57, 55, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2ec0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 57, 32, 77, 82, 85,
-/* 0x2ed0 */  65, 82, 66, 55, 48, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48,
-/* 0x2ee0 */  32, 32, 48, 32, 32, 48, 49, 57, 55, 99, 32, 32, 50, 42, 42, 48,
-/* 0x2ef0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 48, 32, 76,
-/* 0x2f00 */  88, 77, 82, 85, 48, 57, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32,
-/* 0x2f10 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 48, 32, 32, 50, 42,
-/* 0x2f20 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 49,
-/* 0x2f30 */  32, 77, 82, 85, 66, 89, 84, 69, 54, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2f40 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 98, 32, 32,
-/* 0x2f50 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x2f60 */  48, 50, 32, 77, 82, 85, 65, 82, 66, 56, 48, 32, 32, 32, 32, 32,
-/* 0x2f70 */  32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56,100,
-/* 0x2f80 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2f90 */  10, 49, 48, 51, 32, 77, 82, 85, 66, 73, 84, 83, 54, 32, 32, 32,
-/* 0x2fa0 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2fb0 */  56,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2fc0 */  84, 83, 10, 49, 48, 52, 32, 77, 82, 85, 65, 82, 66, 57, 48, 32,
-/* 0x2fd0 */  32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2fe0 */  49, 57, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2ff0 */  69, 78, 84, 83, 10, 49, 48, 53, 32, 76, 88, 77, 82, 85, 49, 48,
-/* 0x3000 */  48, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3010 */  32, 32, 48, 49, 57, 57, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3020 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 54, 32, 76, 88, 85, 78,
-/* 0x3030 */  70, 48, 52, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x3040 */  32, 48, 32, 32, 48, 49, 57, 97, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3050 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 55, 32, 76, 88,
-/* 0x3060 */  77, 82, 85, 49, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32,
-/* 0x3070 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 97, 57, 32, 32, 50, 42, 42,
-/* 0x3080 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 56, 32,
-/* 0x3090 */  76, 88, 77, 82, 85, 49, 49, 49, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x30a0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97, 99, 32, 32, 50,
-/* 0x30b0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48,
-/* 0x30c0 */  57, 32, 76, 88, 85, 78, 70, 48, 52, 49, 32, 32, 32, 32, 32, 32,
-/* 0x30d0 */  48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97,101, 32,
-/* 0x30e0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x30f0 */  49, 49, 48, 32, 76, 88, 85, 78, 70, 48, 52, 50, 32, 32, 32, 32,
-/* 0x3100 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 53,
-/* 0x3110 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3120 */  10, 49, 49, 49, 32, 76, 69, 88, 69, 67, 48, 49, 54, 32, 32, 32,
-/* 0x3130 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x3140 */  98, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3150 */  84, 83, 10, 49, 49, 50, 32, 76, 88, 77, 82, 85, 48, 49, 48, 32,
-/* 0x3160 */  32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3170 */  49, 57, 98, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3180 */  69, 78, 84, 83, 10, 49, 49, 51, 32, 76, 88, 74, 77, 80, 65, 48,
-/* 0x3190 */  48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x31a0 */  32, 48, 49, 57, 98, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x31b0 */  78, 84, 69, 78, 84, 83, 10, 49, 49, 52, 32, 76, 88, 67, 65, 76,
-/* 0x31c0 */  76, 66, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x31d0 */  48, 32, 32, 48, 49, 57, 98,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x31e0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 53, 32, 76, 88, 85,
-/* 0x31f0 */  78, 70, 48, 50, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48,
-/* 0x3200 */  32, 32, 48, 32, 32, 48, 49, 57, 98,102, 32, 32, 50, 42, 42, 48,
-/* 0x3210 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 54, 32, 76,
-/* 0x3220 */  88, 77, 82, 85, 48, 50, 50, 32, 32, 32, 32, 32, 32, 48, 51, 32,
-/* 0x3230 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99, 53, 32, 32, 50, 42,
-/* 0x3240 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 55,
-/* 0x3250 */  32, 76, 88, 74, 77, 80, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3260 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99, 56, 32, 32,
-/* 0x3270 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3280 */  49, 56, 32, 76, 88, 67, 65, 76, 76, 66, 49, 32, 32, 32, 32, 32,
-/* 0x3290 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99, 97,
-/* 0x32a0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x32b0 */  10, 49, 49, 57, 32, 77, 82, 85, 66, 73, 84, 83, 49, 32, 32, 32,
-/* 0x32c0 */  32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x32d0 */  99, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x32e0 */  84, 83, 10, 49, 50, 48, 32, 76, 88, 77, 82, 85, 48, 51, 48, 32,
-/* 0x32f0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3300 */  49, 57, 99,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3310 */  69, 78, 84, 83, 10, 49, 50, 49, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x3320 */  49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3330 */  32, 48, 49, 57, 99,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3340 */  78, 84, 69, 78, 84, 83, 10, 49, 50, 50, 32, 77, 82, 85, 65, 82,
-/* 0x3350 */  66, 49, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32,
-/* 0x3360 */  48, 32, 32, 48, 49, 57,100, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3370 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 51, 32, 76, 88, 77,
-/* 0x3380 */  82, 85, 48, 52, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x3390 */  32, 32, 48, 32, 32, 48, 49, 57,100, 50, 32, 32, 50, 42, 42, 48,
-/* 0x33a0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 52, 32, 76,
-/* 0x33b0 */  88, 85, 78, 70, 48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x33c0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100, 52, 32, 32, 50, 42,
-/* 0x33d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 53,
-/* 0x33e0 */  32, 76, 88, 74, 67, 67, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x33f0 */  56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100, 97, 32, 32,
-/* 0x3400 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3410 */  50, 54, 32, 76, 88, 67, 74, 48, 77, 82, 85, 32, 32, 32, 32, 32,
-/* 0x3420 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,101, 50,
-/* 0x3430 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3440 */  10, 49, 50, 55, 32, 76, 88, 67, 74, 49, 77, 82, 85, 32, 32, 32,
-/* 0x3450 */  32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x3460 */ 101, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3470 */  84, 83, 10, 49, 50, 56, 32, 76, 88, 67, 65, 76, 74, 77, 80, 32,
-/* 0x3480 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3490 */  49, 57,101, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x34a0 */  69, 78, 84, 83, 10, 49, 50, 57, 32, 76, 88, 67, 65, 76, 76, 48,
-/* 0x34b0 */  48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x34c0 */  32, 48, 49, 57,101, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x34d0 */  78, 84, 69, 78, 84, 83, 10, 49, 51, 48, 32, 76, 88, 67, 65, 76,
-/* 0x34e0 */  76, 48, 49, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x34f0 */  48, 32, 32, 48, 49, 57,101, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3500 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 49, 32, 76, 88, 67,
-/* 0x3510 */  74, 50, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x3520 */  32, 32, 48, 32, 32, 48, 49, 57,101,102, 32, 32, 50, 42, 42, 48,
-/* 0x3530 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 50, 32, 76,
-/* 0x3540 */  88, 67, 74, 52, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x3550 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 49, 32, 32, 50, 42,
-/* 0x3560 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 51,
-/* 0x3570 */  32, 76, 88, 67, 74, 54, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3580 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 51, 32, 32,
-/* 0x3590 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x35a0 */  51, 52, 32, 76, 88, 67, 74, 55, 77, 82, 85, 32, 32, 32, 32, 32,
-/* 0x35b0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 53,
-/* 0x35c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x35d0 */  10, 49, 51, 53, 32, 76, 88, 67, 74, 56, 77, 82, 85, 32, 32, 32,
-/* 0x35e0 */  32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x35f0 */ 102, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3600 */  84, 83, 10, 49, 51, 54, 32, 76, 88, 85, 78, 70, 48, 51, 52, 32,
-/* 0x3610 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3620 */  49, 57,102, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3630 */  69, 78, 84, 83, 10, 49, 51, 55, 32, 76, 88, 77, 82, 85, 48, 53,
-/* 0x3640 */  53, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3650 */  32, 48, 49, 57,102,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3660 */  78, 84, 69, 78, 84, 83, 10, 49, 51, 56, 32, 77, 82, 85, 66, 89,
-/* 0x3670 */  84, 69, 50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x3680 */  48, 32, 32, 48, 49, 97, 48, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3690 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 57, 32, 77, 82, 85,
-/* 0x36a0 */  66, 73, 84, 83, 50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x36b0 */  32, 32, 48, 32, 32, 48, 49, 97, 48, 54, 32, 32, 50, 42, 42, 48,
-/* 0x36c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 48, 32, 77,
-/* 0x36d0 */  82, 85, 65, 82, 66, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x36e0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 48, 98, 32, 32, 50, 42,
-/* 0x36f0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 49,
-/* 0x3700 */  32, 76, 88, 77, 82, 85, 48, 53, 55, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3710 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 48, 32, 32,
-/* 0x3720 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3730 */  52, 50, 32, 76, 88, 77, 82, 85, 48, 53, 56, 32, 32, 32, 32, 32,
-/* 0x3740 */  32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 54,
-/* 0x3750 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3760 */  10, 49, 52, 51, 32, 76, 88, 85, 78, 70, 48, 51, 53, 32, 32, 32,
-/* 0x3770 */  32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3780 */  49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3790 */  84, 83, 10, 49, 52, 52, 32, 99,116,111,107, 51, 50, 46, 48, 48,
-/* 0x37a0 */  32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x37b0 */  49, 97, 49,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x37c0 */  69, 78, 84, 83, 10, 49, 52, 53, 32, 99,116,111,107, 51, 50, 46,
-/* 0x37d0 */  49, 48, 32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32,
-/* 0x37e0 */  32, 48, 49, 97, 50, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x37f0 */  78, 84, 69, 78, 84, 83, 10, 49, 52, 54, 32, 99,116,111,107, 51,
-/* 0x3800 */  50, 46, 50, 48, 32, 32, 32, 32, 32, 48, 50, 48, 32, 32, 48, 32,
-/* 0x3810 */  32, 48, 32, 32, 48, 49, 97, 51, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3820 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 55, 32, 99,116,
-/* 0x3830 */ 111,107, 51, 50, 46, 51, 48, 32, 32, 32, 32, 32, 48, 97, 32, 32,
-/* 0x3840 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 53, 50, 32, 32, 50, 42, 42,
-/* 0x3850 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 56, 32,
-/* 0x3860 */  99,116,111,107, 51, 50, 46, 52, 48, 32, 32, 32, 32, 32, 48, 53,
-/* 0x3870 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 53, 99, 32, 32, 50,
-/* 0x3880 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52,
-/* 0x3890 */  57, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x38a0 */  48, 49, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 54, 49,
-/* 0x38b0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x38c0 */  10, 49, 53, 48, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 32, 32,
-/* 0x38d0 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x38e0 */  55, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x38f0 */  84, 83, 10, 49, 53, 49, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32,
-/* 0x3900 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3910 */  49, 97, 55, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3920 */  69, 78, 84, 83, 10, 49, 53, 50, 32, 67, 84, 66, 83, 72, 82, 48,
-/* 0x3930 */  49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3940 */  32, 48, 49, 97, 55, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3950 */  78, 84, 69, 78, 84, 83, 10, 49, 53, 51, 32, 67, 84, 66, 82, 79,
-/* 0x3960 */  82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x3970 */  48, 32, 32, 48, 49, 97, 55,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3980 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 52, 32, 67, 84, 66,
-/* 0x3990 */  83, 87, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x39a0 */  32, 32, 48, 32, 32, 48, 49, 97, 56, 49, 32, 32, 50, 42, 42, 48,
-/* 0x39b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 53, 32, 67,
-/* 0x39c0 */  65, 76, 76, 84, 82, 48, 50, 32, 32, 32, 32, 32, 32, 48, 49, 48,
-/* 0x39d0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56, 54, 32, 32, 50,
-/* 0x39e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53,
-/* 0x39f0 */  54, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3a00 */  48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 57, 54, 32,
-/* 0x3a10 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3a20 */  49, 53, 55, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32, 32, 32, 32,
-/* 0x3a30 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 57,
-/* 0x3a40 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3a50 */  83, 10, 49, 53, 56, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 32,
-/* 0x3a60 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3a70 */  97, 57,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3a80 */  78, 84, 83, 10, 49, 53, 57, 32, 67, 65, 76, 76, 84, 82, 49, 49,
-/* 0x3a90 */  32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3aa0 */  48, 49, 97, 57,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3ab0 */  84, 69, 78, 84, 83, 10, 49, 54, 48, 32, 67, 84, 67, 76, 69, 86,
-/* 0x3ac0 */  69, 50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x3ad0 */  32, 32, 48, 49, 97, 97, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3ae0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 49, 32, 67, 65, 76, 76,
-/* 0x3af0 */  84, 82, 49, 50, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x3b00 */  32, 48, 32, 32, 48, 49, 97, 97, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3b10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 50, 32, 67, 84,
-/* 0x3b20 */  66, 83, 72, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32,
-/* 0x3b30 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 97, 97, 32, 32, 50, 42, 42,
-/* 0x3b40 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 51, 32,
-/* 0x3b50 */  67, 84, 66, 82, 79, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x3b60 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97,101, 32, 32, 50,
-/* 0x3b70 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54,
-/* 0x3b80 */  52, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 32, 32, 32, 32, 32,
-/* 0x3b90 */  48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 98, 48, 32,
-/* 0x3ba0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3bb0 */  49, 54, 53, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 32, 32, 32,
-/* 0x3bc0 */  32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 98,
-/* 0x3bd0 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3be0 */  83, 10, 49, 54, 54, 32, 76, 69, 88, 69, 67, 48, 49, 55, 32, 32,
-/* 0x3bf0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3c00 */  97, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3c10 */  78, 84, 83, 10, 49, 54, 55, 32, 76, 69, 88, 69, 67, 48, 50, 48,
-/* 0x3c20 */  32, 32, 32, 32, 32, 32, 48, 52, 98, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3c30 */  32, 48, 49, 97, 98,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3c40 */  78, 84, 69, 78, 84, 83, 10, 49, 54, 56, 32, 76, 85, 78, 77, 80,
-/* 0x3c50 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x3c60 */  48, 32, 32, 48, 49, 98, 48, 57, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3c70 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 57, 32, 76, 85, 78,
-/* 0x3c80 */  77, 80, 48, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x3c90 */  32, 32, 48, 32, 32, 48, 49, 98, 48, 98, 32, 32, 50, 42, 42, 48,
-/* 0x3ca0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 55, 48, 32, 76,
-/* 0x3cb0 */  69, 88, 69, 67, 48, 50, 53, 32, 32, 32, 32, 32, 32, 48, 52, 52,
-/* 0x3cc0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 48,100, 32, 32, 50,
-/* 0x3cd0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89,
-/* 0x3ce0 */  77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48,
-/* 0x3cf0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x3d00 */  83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x3d10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3d20 */  32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 66,
-/* 0x3d30 */  70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3d40 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32,
-/* 0x3d50 */  48, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3d60 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68,
-/* 0x3d70 */  69, 67, 50, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10,
-/* 0x3d80 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3d90 */  32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 66, 68,
-/* 0x3da0 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3db0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 48,
-/* 0x3dc0 */  32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3dd0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65,
-/* 0x3de0 */  83, 54, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48,
-/* 0x3df0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3e00 */  78, 50, 66, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 66, 68, 69,
-/* 0x3e10 */  67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3e20 */  32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 48, 32,
-/* 0x3e30 */  78, 50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e40 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x3e50 */  49, 49, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48,
-/* 0x3e60 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3e70 */  50, 68, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x3e80 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3e90 */  32,100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 48, 32, 78,
-/* 0x3ea0 */  50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3eb0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x3ec0 */  48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x3ed0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3ee0 */  68, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 53,
-/* 0x3ef0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3f00 */ 100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 48, 32, 78, 50,
-/* 0x3f10 */  68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3f20 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48,
-/* 0x3f30 */  32, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48,
-/* 0x3f40 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x3f50 */  83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48,
-/* 0x3f60 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3f70 */  32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 69,
-/* 0x3f80 */  70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3f90 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32,
-/* 0x3fa0 */  48, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3fb0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68,
-/* 0x3fc0 */  69, 67, 50, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10,
-/* 0x3fd0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3fe0 */  32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 69, 68,
-/* 0x3ff0 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4000 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 48,
-/* 0x4010 */  32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4020 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65,
-/* 0x4030 */  83, 54, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48,
-/* 0x4040 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4050 */  78, 50, 69, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 69, 68, 69,
-/* 0x4060 */  67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4070 */  32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 49, 48, 32, 48, 32,
-/* 0x4080 */  76, 88, 85, 78, 70, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4090 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48,
-/* 0x40a0 */  49, 48, 32, 48, 32, 76, 88, 74, 67, 67, 48, 49, 48, 10, 48, 48,
-/* 0x40b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x40c0 */  88, 85, 78, 70, 48, 51, 55, 32, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x40d0 */  51, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x40e0 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 55, 48, 32, 48, 32, 76,
-/* 0x40f0 */  88, 77, 82, 85, 48, 55, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4100 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 49, 48,
-/* 0x4110 */  48, 32, 48, 32, 76, 88, 77, 82, 85, 49, 48, 48, 10, 48, 48, 48,
-/* 0x4120 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x4130 */  85, 78, 70, 48, 52, 48, 32, 48, 32, 76, 88, 85, 78, 70, 48, 52,
-/* 0x4140 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4150 */ 100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 50, 32, 48, 32, 76, 88,
-/* 0x4160 */  85, 78, 70, 48, 52, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4170 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 51, 48,
-/* 0x4180 */  32, 48, 32, 76, 88, 77, 82, 85, 48, 51, 48, 10, 48, 48, 48, 48,
-/* 0x4190 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x41a0 */  78, 70, 48, 51, 48, 32, 48, 32, 76, 88, 85, 78, 70, 48, 51, 48,
-/* 0x41b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x41c0 */  32, 32, 76, 88, 67, 74, 56, 77, 82, 85, 32, 48, 32, 76, 88, 67,
-/* 0x41d0 */  74, 56, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x41e0 */  32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 32,
-/* 0x41f0 */  48, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 48, 48, 48, 48, 48,
-/* 0x4200 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107,
-/* 0x4210 */  51, 50, 46, 48, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 48,
-/* 0x4220 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4230 */ 100, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 48, 32, 99,
-/* 0x4240 */ 116,111,107, 51, 50, 46, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4250 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50,
-/* 0x4260 */  46, 50, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10,
-/* 0x4270 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4280 */  32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 48, 32, 99,116,111,
-/* 0x4290 */ 107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x42a0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48,
-/* 0x42b0 */  32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48, 48,
-/* 0x42c0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76,
-/* 0x42d0 */  76, 84, 82, 49, 48, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 48,
-/* 0x42e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x42f0 */  32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32, 48, 32, 67, 65, 76,
-/* 0x4300 */  76, 84, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4310 */  32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32,
-/* 0x4320 */  48, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 48, 48, 48, 48, 48,
-/* 0x4330 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69,
-/* 0x4340 */  67, 48, 50, 48, 32, 48, 32, 76, 69, 88, 69, 67, 48, 50, 48, 10,
-/* 0x4350 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4360 */  32, 76, 69, 88, 69, 67, 48, 50, 53, 32, 48, 32, 76, 69, 88, 69,
-/* 0x4370 */  67, 48, 50, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4380 */  32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 48, 48, 32, 48,
-/* 0x4390 */  32, 76, 69, 88, 69, 67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x43a0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67,
-/* 0x43b0 */  48, 48, 57, 32, 48, 32, 76, 69, 88, 69, 67, 48, 48, 57, 10, 48,
-/* 0x43c0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x43d0 */  76, 69, 88, 69, 67, 48, 49, 48, 32, 48, 32, 76, 69, 88, 69, 67,
-/* 0x43e0 */  48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x43f0 */  32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 48, 32,
-/* 0x4400 */  78, 50, 66, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4410 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4420 */  50, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 50, 48, 10, 48, 48,
-/* 0x4430 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x4440 */  50, 66, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x4450 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4460 */  32,100, 32, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 48, 32, 78,
-/* 0x4470 */  50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4480 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 51,
-/* 0x4490 */  48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 51, 48, 10, 48, 48, 48,
-/* 0x44a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x44b0 */  66, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 52,
-/* 0x44c0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x44d0 */ 100, 32, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50,
-/* 0x44e0 */  66, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x44f0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 53, 48,
-/* 0x4500 */  32, 48, 32, 78, 50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48,
-/* 0x4510 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x4520 */  70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 53, 48,
-/* 0x4530 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4540 */  32, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 66,
-/* 0x4550 */  83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4560 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32,
-/* 0x4570 */  48, 32, 78, 50, 66, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4580 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x4590 */  65, 83, 49, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10,
-/* 0x45a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x45b0 */  32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 68, 83,
-/* 0x45c0 */  77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x45d0 */  32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 48,
-/* 0x45e0 */  32, 78, 50, 68, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x45f0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77,
-/* 0x4600 */  65, 51, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10, 48,
-/* 0x4610 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4620 */  78, 50, 68, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 68, 70, 65,
-/* 0x4630 */  83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4640 */  32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 48, 32,
-/* 0x4650 */  78, 50, 68, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4660 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x4670 */  52, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 52, 48, 10, 48, 48,
-/* 0x4680 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x4690 */  50, 68, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x46a0 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x46b0 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 48, 32, 78,
-/* 0x46c0 */  50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x46d0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 54,
-/* 0x46e0 */  48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 54, 48, 10, 48, 48, 48,
-/* 0x46f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4700 */  68, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 54,
-/* 0x4710 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4720 */ 100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50,
-/* 0x4730 */  69, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4740 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 50, 48,
-/* 0x4750 */  32, 48, 32, 78, 50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48,
-/* 0x4760 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x4770 */  70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 50, 48,
-/* 0x4780 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4790 */  32, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 69,
-/* 0x47a0 */  83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x47b0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32,
-/* 0x47c0 */  48, 32, 78, 50, 69, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x47d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83,
-/* 0x47e0 */  77, 65, 52, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10,
-/* 0x47f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4800 */  32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 69, 70,
-/* 0x4810 */  65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4820 */  32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 48,
-/* 0x4830 */  32, 78, 50, 69, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4840 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65,
-/* 0x4850 */  83, 53, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10, 48,
-/* 0x4860 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4870 */  78, 50, 69, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 69, 83, 77,
-/* 0x4880 */  65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4890 */  32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 48, 32,
-/* 0x48a0 */  78, 50, 69, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x48c0 */  69, 67, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48,
-/* 0x48d0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x48e0 */ 100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32,
-/* 0x48f0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4900 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x4910 */  95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x4920 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4930 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x4940 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x4950 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x4960 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x4970 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4980 */  32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 53, 32,
-/* 0x4990 */  48, 32, 76, 69, 88, 69, 67, 48, 49, 53, 10, 48, 48, 48, 48, 48,
-/* 0x49a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x49b0 */  70, 48, 48, 48, 32, 48, 32, 76, 88, 85, 78, 70, 48, 48, 48, 10,
-/* 0x49c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x49d0 */  32, 76, 88, 85, 78, 70, 48, 48, 50, 32, 48, 32, 76, 88, 85, 78,
-/* 0x49e0 */  70, 48, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x49f0 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 48, 32, 48,
-/* 0x4a00 */  32, 77, 82, 85, 66, 89, 84, 69, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4a10 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x4a20 */  48, 48, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48, 48, 53, 10, 48,
-/* 0x4a30 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4a40 */  76, 88, 77, 82, 85, 48, 48, 54, 32, 48, 32, 76, 88, 77, 82, 85,
-/* 0x4a50 */  48, 48, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4a60 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 48, 55, 32, 48, 32,
-/* 0x4a70 */  76, 88, 77, 82, 85, 48, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a80 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x4a90 */  48, 56, 32, 48, 32, 76, 88, 85, 78, 70, 48, 48, 56, 10, 48, 48,
-/* 0x4aa0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4ab0 */  88, 77, 82, 85, 48, 52, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4ac0 */  52, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4ad0 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 52, 54, 32, 48, 32, 76,
-/* 0x4ae0 */  88, 77, 82, 85, 48, 52, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4af0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50,
-/* 0x4b00 */  48, 32, 48, 32, 76, 88, 74, 67, 67, 48, 50, 48, 10, 48, 48, 48,
-/* 0x4b10 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x4b20 */  74, 67, 67, 48, 50, 49, 32, 48, 32, 76, 88, 74, 67, 67, 48, 50,
-/* 0x4b30 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4b40 */ 100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 51, 32, 48, 32, 76, 88,
-/* 0x4b50 */  74, 67, 67, 48, 50, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4b60 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51, 56, 54,
-/* 0x4b70 */  32, 48, 32, 76, 88, 85, 78, 70, 51, 56, 54, 10, 48, 48, 48, 48,
-/* 0x4b80 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x4b90 */  78, 70, 51, 56, 55, 32, 48, 32, 76, 88, 85, 78, 70, 51, 56, 55,
-/* 0x4ba0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4bb0 */  32, 32, 76, 88, 85, 78, 70, 51, 56, 56, 32, 48, 32, 76, 88, 85,
-/* 0x4bc0 */  78, 70, 51, 56, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4bd0 */  32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 52, 56, 54, 32,
-/* 0x4be0 */  48, 32, 76, 88, 85, 78, 70, 52, 56, 54, 10, 48, 48, 48, 48, 48,
-/* 0x4bf0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x4c00 */  70, 52, 56, 55, 32, 48, 32, 76, 88, 85, 78, 70, 52, 56, 55, 10,
-/* 0x4c10 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4c20 */  32, 76, 88, 77, 82, 85, 48, 54, 53, 32, 48, 32, 76, 88, 77, 82,
-/* 0x4c30 */  85, 48, 54, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4c40 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 51, 32, 48,
-/* 0x4c50 */  32, 77, 82, 85, 66, 89, 84, 69, 51, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4c60 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82,
-/* 0x4c70 */  66, 51, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 51, 48, 10, 48,
-/* 0x4c80 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4c90 */  77, 82, 85, 66, 73, 84, 83, 51, 32, 48, 32, 77, 82, 85, 66, 73,
-/* 0x4ca0 */  84, 83, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4cb0 */  32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 52, 48, 32, 48, 32,
-/* 0x4cc0 */  77, 82, 85, 65, 82, 66, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4cd0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84,
-/* 0x4ce0 */  69, 52, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 52, 10, 48, 48,
-/* 0x4cf0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77,
-/* 0x4d00 */  82, 85, 66, 73, 84, 83, 52, 32, 48, 32, 77, 82, 85, 66, 73, 84,
-/* 0x4d10 */  83, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4d20 */  32,100, 32, 32, 77, 82, 85, 65, 82, 66, 53, 48, 32, 48, 32, 77,
-/* 0x4d30 */  82, 85, 65, 82, 66, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d40 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 56,
-/* 0x4d50 */  48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 56, 48, 10, 48, 48, 48,
-/* 0x4d60 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x4d70 */  85, 66, 89, 84, 69, 53, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x4d80 */  53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4d90 */ 100, 32, 32, 77, 82, 85, 65, 82, 66, 54, 48, 32, 48, 32, 77, 82,
-/* 0x4da0 */  85, 65, 82, 66, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4db0 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 53,
-/* 0x4dc0 */  32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 53, 10, 48, 48, 48, 48,
-/* 0x4dd0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x4de0 */  65, 82, 66, 55, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 55, 48,
-/* 0x4df0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4e00 */  32, 32, 76, 88, 77, 82, 85, 48, 57, 48, 32, 48, 32, 76, 88, 77,
-/* 0x4e10 */  82, 85, 48, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4e20 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 54, 32,
-/* 0x4e30 */  48, 32, 77, 82, 85, 66, 89, 84, 69, 54, 10, 48, 48, 48, 48, 48,
-/* 0x4e40 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65,
-/* 0x4e50 */  82, 66, 56, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 56, 48, 10,
-/* 0x4e60 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4e70 */  32, 77, 82, 85, 66, 73, 84, 83, 54, 32, 48, 32, 77, 82, 85, 66,
-/* 0x4e80 */  73, 84, 83, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4e90 */  32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 57, 48, 32, 48,
-/* 0x4ea0 */  32, 77, 82, 85, 65, 82, 66, 57, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4eb0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x4ec0 */  49, 49, 48, 32, 48, 32, 76, 88, 77, 82, 85, 49, 49, 48, 10, 48,
-/* 0x4ed0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4ee0 */  76, 88, 77, 82, 85, 49, 49, 49, 32, 48, 32, 76, 88, 77, 82, 85,
-/* 0x4ef0 */  49, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4f00 */  32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 49, 32, 48, 32,
-/* 0x4f10 */  76, 88, 85, 78, 70, 48, 52, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f20 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x4f30 */  49, 54, 32, 48, 32, 76, 69, 88, 69, 67, 48, 49, 54, 10, 48, 48,
-/* 0x4f40 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4f50 */  88, 77, 82, 85, 48, 49, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4f60 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4f70 */  32,100, 32, 32, 76, 88, 74, 77, 80, 65, 48, 48, 32, 48, 32, 76,
-/* 0x4f80 */  88, 74, 77, 80, 65, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f90 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 66,
-/* 0x4fa0 */  48, 32, 48, 32, 76, 88, 67, 65, 76, 76, 66, 48, 10, 48, 48, 48,
-/* 0x4fb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x4fc0 */  85, 78, 70, 48, 50, 49, 32, 48, 32, 76, 88, 85, 78, 70, 48, 50,
-/* 0x4fd0 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4fe0 */ 100, 32, 32, 76, 88, 77, 82, 85, 48, 50, 50, 32, 48, 32, 76, 88,
-/* 0x4ff0 */  77, 82, 85, 48, 50, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5000 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 77, 80, 65, 48, 49,
-/* 0x5010 */  32, 48, 32, 76, 88, 74, 77, 80, 65, 48, 49, 10, 48, 48, 48, 48,
-/* 0x5020 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67,
-/* 0x5030 */  65, 76, 76, 66, 49, 32, 48, 32, 76, 88, 67, 65, 76, 76, 66, 49,
-/* 0x5040 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5050 */  32, 32, 77, 82, 85, 66, 73, 84, 83, 49, 32, 48, 32, 77, 82, 85,
-/* 0x5060 */  66, 73, 84, 83, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5070 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 49, 32,
-/* 0x5080 */  48, 32, 77, 82, 85, 66, 89, 84, 69, 49, 10, 48, 48, 48, 48, 48,
-/* 0x5090 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65,
-/* 0x50a0 */  82, 66, 49, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 49, 48, 10,
-/* 0x50b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x50c0 */  32, 76, 88, 77, 82, 85, 48, 52, 48, 32, 48, 32, 76, 88, 77, 82,
-/* 0x50d0 */  85, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x50e0 */  32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 48, 48, 32, 48,
-/* 0x50f0 */  32, 76, 88, 74, 67, 67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5100 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 48,
-/* 0x5110 */  77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 48, 77, 82, 85, 10, 48,
-/* 0x5120 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5130 */  76, 88, 67, 74, 49, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 49,
-/* 0x5140 */  77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5150 */  32, 32,100, 32, 32, 76, 88, 67, 65, 76, 74, 77, 80, 32, 48, 32,
-/* 0x5160 */  76, 88, 67, 65, 76, 74, 77, 80, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5170 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76,
-/* 0x5180 */  48, 48, 32, 48, 32, 76, 88, 67, 65, 76, 76, 48, 48, 10, 48, 48,
-/* 0x5190 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x51a0 */  88, 67, 65, 76, 76, 48, 49, 32, 48, 32, 76, 88, 67, 65, 76, 76,
-/* 0x51b0 */  48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x51c0 */  32,100, 32, 32, 76, 88, 67, 74, 50, 77, 82, 85, 32, 48, 32, 76,
-/* 0x51d0 */  88, 67, 74, 50, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x51e0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 52, 77, 82,
-/* 0x51f0 */  85, 32, 48, 32, 76, 88, 67, 74, 52, 77, 82, 85, 10, 48, 48, 48,
-/* 0x5200 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x5210 */  67, 74, 54, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 54, 77, 82,
-/* 0x5220 */  85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5230 */ 100, 32, 32, 76, 88, 67, 74, 55, 77, 82, 85, 32, 48, 32, 76, 88,
-/* 0x5240 */  67, 74, 55, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5250 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 53, 53,
-/* 0x5260 */  32, 48, 32, 76, 88, 77, 82, 85, 48, 53, 53, 10, 48, 48, 48, 48,
-/* 0x5270 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x5280 */  66, 89, 84, 69, 50, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 50,
-/* 0x5290 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x52a0 */  32, 32, 77, 82, 85, 66, 73, 84, 83, 50, 32, 48, 32, 77, 82, 85,
-/* 0x52b0 */  66, 73, 84, 83, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x52c0 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 50, 48, 32,
-/* 0x52d0 */  48, 32, 77, 82, 85, 65, 82, 66, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x52e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x52f0 */  85, 48, 53, 55, 32, 48, 32, 76, 88, 77, 82, 85, 48, 53, 55, 10,
-/* 0x5300 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5310 */  32, 76, 88, 77, 82, 85, 48, 53, 56, 32, 48, 32, 76, 88, 77, 82,
-/* 0x5320 */  85, 48, 53, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5330 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 53, 32, 48,
-/* 0x5340 */  32, 76, 88, 85, 78, 70, 48, 51, 53, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5350 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51,
-/* 0x5360 */  50, 46, 51, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 51, 48,
-/* 0x5370 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5380 */  32, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 48, 32, 67, 84, 67,
-/* 0x5390 */  76, 69, 86, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x53a0 */  32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32,
-/* 0x53b0 */  48, 32, 67, 65, 76, 76, 84, 82, 48, 49, 10, 48, 48, 48, 48, 48,
-/* 0x53c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83,
-/* 0x53d0 */  72, 82, 48, 49, 32, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10,
-/* 0x53e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x53f0 */  32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 48, 32, 67, 84, 66, 82,
-/* 0x5400 */  79, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5410 */  32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 48,
-/* 0x5420 */  32, 67, 84, 66, 83, 87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5430 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84,
-/* 0x5440 */  82, 48, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 50, 10, 48,
-/* 0x5450 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5460 */  67, 65, 76, 76, 84, 82, 69, 56, 32, 48, 32, 67, 65, 76, 76, 84,
-/* 0x5470 */  82, 69, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5480 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 48, 32,
-/* 0x5490 */  67, 65, 76, 76, 84, 82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x54a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86,
-/* 0x54b0 */  69, 50, 32, 48, 32, 67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48,
-/* 0x54c0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x54d0 */  65, 76, 76, 84, 82, 49, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x54e0 */  49, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x54f0 */  32,100, 32, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 48, 32, 67,
-/* 0x5500 */  84, 66, 83, 72, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5510 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 49,
-/* 0x5520 */  49, 32, 48, 32, 67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48,
-/* 0x5530 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x5540 */  66, 83, 87, 65, 49, 49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 49,
-/* 0x5550 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5560 */ 100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 55, 32, 48, 32, 76, 69,
-/* 0x5570 */  88, 69, 67, 48, 49, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5580 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 85, 78, 77, 80, 48, 48, 48,
-/* 0x5590 */  32, 48, 32, 76, 85, 78, 77, 80, 48, 48, 48, 10, 48, 48, 48, 48,
-/* 0x55a0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 85, 78,
-/* 0x55b0 */  77, 80, 48, 48, 49, 32, 48, 32, 76, 85, 78, 77, 80, 48, 48, 49,
-/* 0x55c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32,
-/* 0x55d0 */  32, 32, 76, 69, 88, 69, 67, 48, 48, 48, 32, 48, 32, 95,115,116,
-/* 0x55e0 */  97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x55f0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109,
-/* 0x5600 */  97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48,
-/* 0x5610 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5620 */  42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,117, 95,108,
-/* 0x5630 */ 101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x5640 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97,
-/* 0x5650 */  95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5660 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x5670 */ 108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10,
-/* 0x5680 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5690 */  32, 42, 85, 78, 68, 42, 32, 48, 32, 78, 77, 82, 85, 10, 48, 48,
-/* 0x56a0 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x56b0 */  85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,114, 95,108,101,
-/* 0x56c0 */ 110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x56d0 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,
-/* 0x56e0 */ 108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x56f0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x5700 */  48, 32, 79, 95, 66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5710 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5720 */  82, 32, 91, 76, 69, 88, 69, 67, 48, 48, 48, 93, 58, 10, 79, 70,
-/* 0x5730 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5740 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5750 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5760 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x5770 */  50, 53, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5780 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83,
-/* 0x5790 */  77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x57a0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57b0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x57c0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x57d0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x57e0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x57f0 */  70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 49, 48, 93, 58, 10,
-/* 0x5800 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5810 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5820 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5830 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x5840 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5850 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5860 */  66, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5870 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5880 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5890 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x58a0 */  32, 32, 32, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 10, 82,
-/* 0x58b0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x58c0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 50, 48, 93,
-/* 0x58d0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x58e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x58f0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56,
-/* 0x5900 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5910 */  66, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5920 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5930 */  78, 50, 66, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5940 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5950 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5960 */  48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5970 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10,
-/* 0x5980 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5990 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 51,
-/* 0x59a0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x59b0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x59c0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x59d0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59e0 */  78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x59f0 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5a00 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69,
-/* 0x5a10 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5a20 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 68, 69, 67, 51, 48, 93, 58,
-/* 0x5a30 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5a40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5a50 */  69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32, 82, 95, 51, 56, 54,
-/* 0x5a60 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x5a70 */  68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 50,102, 32, 82,
-/* 0x5a80 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a90 */  32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5aa0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5ab0 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70,
-/* 0x5ac0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5ad0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5ae0 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5af0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x5b00 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5b10 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x5b20 */  65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5b30 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b40 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x5b50 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5b60 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x5b70 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5b80 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10,
-/* 0x5b90 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5ba0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 54,
-/* 0x5bb0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5bc0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5bd0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x5be0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5bf0 */  78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5c00 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5c10 */  32, 91, 78, 50, 66, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5c20 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5c30 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5c40 */  48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5c50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x5c60 */  49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54,
-/* 0x5c70 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x5c80 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5c90 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5ca0 */  50, 66, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5cb0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5cc0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5cd0 */  48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x5ce0 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10,
-/* 0x5cf0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5d00 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 49, 48,
-/* 0x5d10 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5d20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5d30 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x5d40 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5d50 */  50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5d60 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5d70 */  91, 78, 50, 68, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5d80 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d90 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5da0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5db0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48,
-/* 0x5dc0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5dd0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65,
-/* 0x5de0 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5df0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e00 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x5e10 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e20 */  32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5e30 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5e40 */  82, 32, 91, 78, 50, 68, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70,
-/* 0x5e50 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5e60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5e70 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5e80 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x5e90 */  49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5ea0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83,
-/* 0x5eb0 */  77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5ec0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ed0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x5ee0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5ef0 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x5f00 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5f10 */  70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 51, 48, 93, 58, 10,
-/* 0x5f20 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5f30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5f40 */  10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5f50 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x5f60 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x5f70 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f80 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5f90 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5fa0 */  32, 91, 78, 50, 68, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5fb0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5fc0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5fd0 */  48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5fe0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 50,
-/* 0x5ff0 */  48, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32, 82, 95, 51, 56, 54,
-/* 0x6000 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x6010 */  68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 52, 51, 32, 82,
-/* 0x6020 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6030 */  32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6040 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6050 */  82, 32, 91, 78, 50, 68, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70,
-/* 0x6060 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6070 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6080 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6090 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x60a0 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x60b0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70,
-/* 0x60c0 */  65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x60d0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x60e0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x60f0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6100 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x6110 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6120 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10,
-/* 0x6130 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6140 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 54,
-/* 0x6150 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6160 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6170 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x6180 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6190 */  78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x61a0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x61b0 */  32, 91, 78, 50, 68, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x61c0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x61d0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x61e0 */  48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x61f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 54,
-/* 0x6200 */  49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54,
-/* 0x6210 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x6220 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6230 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x6240 */  50, 68, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6250 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6260 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6270 */  48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x6280 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10,
-/* 0x6290 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x62a0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 49, 48,
-/* 0x62b0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x62c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x62d0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x62e0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x62f0 */  50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6300 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6310 */  91, 78, 50, 69, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6320 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6330 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6340 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6350 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48,
-/* 0x6360 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6370 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65,
-/* 0x6380 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6390 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63a0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x63b0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63c0 */  32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x63d0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x63e0 */  82, 32, 91, 78, 50, 69, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70,
-/* 0x63f0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6400 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6410 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6420 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x6430 */  49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6440 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83,
-/* 0x6450 */  77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6460 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6470 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x6480 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6490 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x64a0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x64b0 */  70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 51, 48, 93, 58, 10,
-/* 0x64c0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x64d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x64e0 */  10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95,
-/* 0x64f0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x6500 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x6510 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6520 */  78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6530 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6540 */  32, 91, 78, 50, 69, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6550 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6560 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6570 */  48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6580 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 50,
-/* 0x6590 */  48, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54,
-/* 0x65a0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x65b0 */  68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82,
-/* 0x65c0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65d0 */  32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x65e0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x65f0 */  82, 32, 91, 78, 50, 69, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70,
-/* 0x6600 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6610 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6620 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6630 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x6640 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6650 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70,
-/* 0x6660 */  65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6670 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6680 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x6690 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x66a0 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x66b0 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x66c0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10,
-/* 0x66d0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x66e0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 54,
-/* 0x66f0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6700 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6710 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x6720 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6730 */  78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6740 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6750 */  32, 91, 78, 50, 69, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6760 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6770 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6780 */  48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6790 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x67a0 */  49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54,
-/* 0x67b0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x67c0 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x67d0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x67e0 */  50, 69, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x67f0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6800 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6810 */  48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x6820 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10,
-/* 0x6830 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6840 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x6850 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6860 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6870 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0x6880 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6890 */  32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,
-/* 0x68a0 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 49, 52, 32, 82, 95, 51, 56,
-/* 0x68b0 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x68c0 */ 109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x68d0 */ 101, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x68e0 */  32, 32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48,
-/* 0x68f0 */  48, 48, 48, 48, 48, 50, 97, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x6900 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,
-/* 0x6910 */ 114,111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6920 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6930 */  82, 32, 91, 76, 88, 85, 78, 70, 48, 48, 48, 93, 58, 10, 79, 70,
-/* 0x6940 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6950 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6960 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6970 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x6980 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6990 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82,
-/* 0x69a0 */  85, 48, 48, 53, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x69b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x69c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x69d0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x69e0 */  32, 32, 32, 78, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x69f0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6a00 */  91, 76, 88, 85, 78, 70, 48, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6a10 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a20 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6a30 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,
-/* 0x6a40 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 50,
-/* 0x6a50 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6a60 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48,
-/* 0x6a70 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6a80 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a90 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x6aa0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ab0 */  32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6ac0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6ad0 */  82, 32, 91, 76, 88, 74, 67, 67, 48, 50, 49, 93, 58, 10, 79, 70,
-/* 0x6ae0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6af0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6b00 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6b10 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x6b20 */  51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6b30 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78,
-/* 0x6b40 */  70, 51, 56, 56, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6b50 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6b60 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x6b70 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6b80 */  32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76,
-/* 0x6b90 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6ba0 */  70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 52, 56, 55, 93, 58, 10,
-/* 0x6bb0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6bc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6bd0 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6be0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78,
-/* 0x6bf0 */  70, 48, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6c00 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0x6c10 */  77, 82, 85, 48, 54, 53, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6c20 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c30 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6c40 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6c50 */  32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48, 55, 48, 10, 10, 82,
-/* 0x6c60 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6c70 */  83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 55, 48, 93,
-/* 0x6c80 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6c90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6ca0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56,
-/* 0x6cb0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x6cc0 */  85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6cd0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6ce0 */  76, 88, 77, 82, 85, 48, 57, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6cf0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6d00 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6d10 */  48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6d20 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 49, 48, 48, 10,
-/* 0x6d30 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6d40 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 52,
-/* 0x6d50 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6d60 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6d70 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95,
-/* 0x6d80 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6d90 */  76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6da0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6db0 */  32, 91, 76, 69, 88, 69, 67, 48, 49, 54, 93, 58, 10, 79, 70, 70,
-/* 0x6dc0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6dd0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6de0 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x6df0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52,
-/* 0x6e00 */  50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6e10 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85,
-/* 0x6e20 */  48, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6e30 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e40 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x6e50 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e60 */  32, 32, 76, 88, 77, 82, 85, 48, 51, 48, 10, 10, 82, 69, 76, 79,
-/* 0x6e70 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6e80 */  79, 82, 32, 91, 76, 88, 74, 67, 67, 48, 48, 48, 93, 58, 10, 79,
-/* 0x6e90 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6eb0 */  48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6ec0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 74, 67, 67,
-/* 0x6ed0 */  48, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6ee0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67,
-/* 0x6ef0 */  65, 76, 76, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6f00 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f10 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6f20 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6f30 */  32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69,
-/* 0x6f40 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6f50 */  32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 50, 77, 82, 85, 93, 58,
-/* 0x6f60 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6f70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6f80 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x6f90 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85,
-/* 0x6fa0 */  78, 70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6fb0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x6fc0 */  88, 67, 74, 52, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6fd0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6fe0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6ff0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7000 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10,
-/* 0x7010 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x7020 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 54, 77, 82, 85,
-/* 0x7030 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7050 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x7060 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x7070 */  88, 67, 74, 56, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x7080 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x7090 */  91, 76, 88, 67, 74, 55, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83,
-/* 0x70a0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x70b0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x70c0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x70d0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85,
-/* 0x70e0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x70f0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 56, 77,
-/* 0x7100 */  82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x7110 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7120 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x7130 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7140 */  32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7150 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7160 */  82, 32, 91, 76, 88, 85, 78, 70, 48, 51, 52, 93, 58, 10, 79, 70,
-/* 0x7170 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7180 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7190 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x71a0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x71b0 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x71c0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107,
-/* 0x71d0 */  51, 50, 46, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x71e0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x71f0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7200 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7210 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82,
-/* 0x7220 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7230 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x7240 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7250 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7260 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51,
-/* 0x7270 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x7280 */ 116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7290 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x72a0 */  32, 91, 99,116,111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70,
-/* 0x72b0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x72c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x72d0 */  48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x72e0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50,
-/* 0x72f0 */  46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x7300 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x7310 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x7320 */  48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7330 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 10, 82,
-/* 0x7340 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7350 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 51, 48,
-/* 0x7360 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7370 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7380 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x7390 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x73a0 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x73b0 */  57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x73c0 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 10, 82,
-/* 0x73d0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x73e0 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x73f0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7400 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7410 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x7420 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x7430 */ 116,111,107, 51, 50, 46, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7440 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7450 */  32, 91, 67, 65, 76, 76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x7460 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7470 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7480 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x7490 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x74a0 */ 108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x74b0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x74c0 */  67, 84, 67, 76, 69, 86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x74d0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74e0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x74f0 */  48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32,
-/* 0x7500 */  32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,
-/* 0x7510 */ 111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54,
-/* 0x7520 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76,
-/* 0x7530 */  76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7540 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x7550 */  65, 76, 76, 84, 82, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7560 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7570 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7580 */  48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7590 */  32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10,
-/* 0x75a0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x75b0 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48,
-/* 0x75c0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x75d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x75e0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x75f0 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x7600 */ 105,108,116,101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69,
-/* 0x7610 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7620 */  32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58,
-/* 0x7630 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7640 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7650 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x7660 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76,
-/* 0x7670 */  76, 84, 82, 49, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7680 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x7690 */  84, 67, 76, 69, 86, 69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x76a0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x76b0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x76c0 */  48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32,
-/* 0x76d0 */  32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111,
-/* 0x76e0 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95,
-/* 0x76f0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76,
-/* 0x7700 */  84, 82, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x7710 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65,
-/* 0x7720 */  76, 76, 84, 82, 49, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x7730 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7740 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7750 */  48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x7760 */  32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 10, 82,
-/* 0x7770 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7780 */  83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 50, 53, 93,
-/* 0x7790 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x77a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x77b0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 51, 99, 32, 82, 95, 51, 56,
-/* 0x77c0 */  54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 69,
-/* 0x77d0 */  88, 69, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 52, 48, 32,
-/* 0x77e0 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x77f0 */  32, 32, 79, 95, 66, 73, 78, 70, 79, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7800 */  49,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x7810 */  32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48, 50, 48, 10
+/* 0x1b50 */   0,171,  0,  0,  0,180,  0,  0,  0, 96,  0,  0,  0,157,  6,  0,
+/* 0x1b60 */   0,  0,  0,  0,  0, 52,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */   0,  9,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */   0, 18,  0,  0,  0, 57,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */   0, 27,  0,  0,  0, 69,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   0, 36,  0,  0,  0, 72,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   0, 45,  0,  0,  0, 74,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */   0, 54,  0,  0,  0, 80,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,
+/* 0x1bd0 */   0, 63,  0,  0,  0, 91,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   0, 72,  0,  0,  0, 96,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1bf0 */   0, 81,  0,  0,  0,105,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1c00 */   0, 90,  0,  0,  0,118,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */   0, 99,  0,  0,  0,131,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1c20 */   0,108,  0,  0,  0,146,  0,  0,  0, 62,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */   0,117,  0,  0,  0,208,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */   0,126,  0,  0,  0,221,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1c50 */   0,135,  0,  0,  0,236,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */   0,144,  0,  0,  0,238,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */   0,153,  0,  0,  0,241,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1c80 */   0,162,  0,  0,  0,250,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */   0,171,  0,  0,  0,  6,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   0,180,  0,  0,  0, 31,  1,  0,  0, 22,  0,  0,  0,  0,  0,  0,
+/* 0x1cb0 */   0,189,  0,  0,  0, 53,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cc0 */   0,198,  0,  0,  0, 53,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   0,207,  0,  0,  0, 56,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,216,  0,  0,  0, 58,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x1cf0 */   0,225,  0,  0,  0, 64,  1,  0,  0, 11,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,234,  0,  0,  0, 75,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1d10 */   0,243,  0,  0,  0, 80,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */   0,252,  0,  0,  0, 89,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */   0,  5,  1,  0,  0,102,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1d40 */   0, 14,  1,  0,  0,115,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1d50 */   0, 23,  1,  0,  0,130,  1,  0,  0, 82,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */   0, 32,  1,  0,  0,212,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0, 41,  1,  0,  0,225,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1d80 */   0, 50,  1,  0,  0,240,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */   0, 59,  1,  0,  0,242,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */   0, 68,  1,  0,  0,245,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */   0, 77,  1,  0,  0,254,  1,  0,  0, 12,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   0, 86,  1,  0,  0, 10,  2,  0,  0, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1dd0 */   0, 95,  1,  0,  0, 35,  2,  0,  0, 22,  0,  0,  0,  0,  0,  0,
+/* 0x1de0 */   0,104,  1,  0,  0, 57,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */   0,113,  1,  0,  0, 57,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,122,  1,  0,  0, 60,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1e10 */   0,131,  1,  0,  0, 62,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */   0,140,  1,  0,  0, 68,  2,  0,  0, 11,  0,  0,  0,  0,  0,  0,
+/* 0x1e30 */   0,149,  1,  0,  0, 79,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1e40 */   0,158,  1,  0,  0, 84,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */   0,167,  1,  0,  0, 93,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,176,  1,  0,  0,106,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */   0,185,  1,  0,  0,119,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */   0,194,  1,  0,  0,134,  2,  0,  0, 95,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */   0,203,  1,  0,  0,229,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,212,  1,  0,  0,242,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,221,  1,  0,  0,  1,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,230,  1,  0,  0,  3,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,239,  1,  0,  0,  6,  3,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,248,  1,  0,  0, 15,  3,  0,  0, 12,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */   0,  1,  2,  0,  0, 27,  3,  0,  0, 25,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */   0, 10,  2,  0,  0, 52,  3,  0,  0, 22,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0, 19,  2,  0,  0, 74,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f20 */   0, 28,  2,  0,  0, 74,  3,  0,  0, 46,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */   0, 39,  2,  0,  0,120,  3,  0,  0, 72,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0, 50,  2,  0,  0,192,  3,  0,  0,134, 10,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0, 61,  2,  0,  0, 70, 14,  0,  0,134, 10,  0,  0,  0,  0,  0,
+/* 0x1f60 */   0, 72,  2,  0,  0,204, 24,  0,  0, 26,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0, 83,  2,  0,  0,230, 24,  0,  0, 29,  0,  0,  0,  0,  0,  0,
+/* 0x1f80 */   0, 92,  2,  0,  0,  3, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */   0,101,  2,  0,  0,  5, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0,110,  2,  0,  0, 10, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0,119,  2,  0,  0, 12, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   0,128,  2,  0,  0, 17, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0,137,  2,  0,  0, 24, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,146,  2,  0,  0, 31, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   0,155,  2,  0,  0, 35, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */   0,164,  2,  0,  0, 40, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */   0,173,  2,  0,  0, 43, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */   0,182,  2,  0,  0, 46, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */   0,191,  2,  0,  0, 48, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2040 */   0,200,  2,  0,  0, 50, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2050 */   0,209,  2,  0,  0, 55, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */   0,218,  2,  0,  0, 62, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2070 */   0,227,  2,  0,  0, 64, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */   0,236,  2,  0,  0, 65, 25,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */   0,245,  2,  0,  0, 74, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x20a0 */   0,254,  2,  0,  0, 77, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x20b0 */   0,  7,  3,  0,  0, 81, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */   0, 16,  3,  0,  0, 83, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x20d0 */   0, 25,  3,  0,  0, 88, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */   0, 34,  3,  0,  0, 90, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x20f0 */   0, 43,  3,  0,  0, 91, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */   0, 52,  3,  0,  0, 93, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x2110 */   0, 61,  3,  0,  0, 97, 25,  0,  0,  8,  0,  0,  0,  0,  0,  0,
+/* 0x2120 */   0, 70,  3,  0,  0,105, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2130 */   0, 79,  3,  0,  0,108, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2140 */   0, 88,  3,  0,  0,110, 25,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x2150 */   0, 97,  3,  0,  0,116, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2160 */   0,106,  3,  0,  0,119, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2170 */   0,115,  3,  0,  0,121, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2180 */   0,124,  3,  0,  0,122, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2190 */   0,133,  3,  0,  0,124, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x21a0 */   0,142,  3,  0,  0,128, 25,  0,  0, 11,  0,  0,  0,  0,  0,  0,
+/* 0x21b0 */   0,151,  3,  0,  0,139, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */   0,160,  3,  0,  0,141, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x21d0 */   0,169,  3,  0,  0,142, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x21e0 */   0,178,  3,  0,  0,144, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */   0,187,  3,  0,  0,148, 25,  0,  0, 16,  0,  0,  0,  0,  0,  0,
+/* 0x2200 */   0,196,  3,  0,  0,164, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2210 */   0,205,  3,  0,  0,169, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2220 */   0,214,  3,  0,  0,172, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2230 */   0,223,  3,  0,  0,174, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,
+/* 0x2240 */   0,232,  3,  0,  0,181, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2250 */   0,241,  3,  0,  0,181, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2260 */   0,250,  3,  0,  0,186, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2270 */   0,  3,  4,  0,  0,187, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2280 */   0, 12,  4,  0,  0,189, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2290 */   0, 21,  4,  0,  0,191, 25,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x22a0 */   0, 30,  4,  0,  0,197, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x22b0 */   0, 39,  4,  0,  0,200, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x22c0 */   0, 48,  4,  0,  0,202, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x22d0 */   0, 57,  4,  0,  0,204, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x22e0 */   0, 66,  4,  0,  0,205, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x22f0 */   0, 75,  4,  0,  0,207, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2300 */   0, 84,  4,  0,  0,209, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2310 */   0, 93,  4,  0,  0,210, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2320 */   0,102,  4,  0,  0,212, 25,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x2330 */   0,111,  4,  0,  0,218, 25,  0,  0,  8,  0,  0,  0,  0,  0,  0,
+/* 0x2340 */   0,120,  4,  0,  0,226, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2350 */   0,129,  4,  0,  0,228, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2360 */   0,138,  4,  0,  0,231, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2370 */   0,147,  4,  0,  0,234, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2380 */   0,156,  4,  0,  0,236, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2390 */   0,165,  4,  0,  0,239, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x23a0 */   0,174,  4,  0,  0,241, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x23b0 */   0,183,  4,  0,  0,243, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x23c0 */   0,192,  4,  0,  0,245, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x23d0 */   0,201,  4,  0,  0,247, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x23e0 */   0,210,  4,  0,  0,250, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x23f0 */   0,219,  4,  0,  0,255, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2400 */   0,228,  4,  0,  0,  1, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2410 */   0,237,  4,  0,  0,  6, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2420 */   0,246,  4,  0,  0, 11, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2430 */   0,255,  4,  0,  0, 16, 26,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x2440 */   0,  8,  5,  0,  0, 22, 26,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2450 */   0, 17,  5,  0,  0, 23, 26,  0,  0,  6,  0,  0,  0,  0,  0,  0,
+/* 0x2460 */   0, 26,  5,  0,  0, 29, 26,  0,  0,  7,  0,  0,  0,  0,  0,  0,
+/* 0x2470 */   0, 36,  5,  0,  0, 36, 26,  0,  0, 14,  0,  0,  0,  0,  0,  0,
+/* 0x2480 */   0, 46,  5,  0,  0, 50, 26,  0,  0, 32,  0,  0,  0,  0,  0,  0,
+/* 0x2490 */   0, 56,  5,  0,  0, 82, 26,  0,  0, 10,  0,  0,  0,  0,  0,  0,
+/* 0x24a0 */   0, 66,  5,  0,  0, 92, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x24b0 */   0, 76,  5,  0,  0, 97, 26,  0,  0, 16,  0,  0,  0,  0,  0,  0,
+/* 0x24c0 */   0, 85,  5,  0,  0,113, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x24d0 */   0, 94,  5,  0,  0,118, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x24e0 */   0,103,  5,  0,  0,123, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x24f0 */   0,112,  5,  0,  0,127, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2500 */   0,121,  5,  0,  0,129, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2510 */   0,130,  5,  0,  0,134, 26,  0,  0, 16,  0,  0,  0,  0,  0,  0,
+/* 0x2520 */   0,139,  5,  0,  0,150, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2530 */   0,148,  5,  0,  0,155, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2540 */   0,157,  5,  0,  0,157, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2550 */   0,166,  5,  0,  0,159, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x2560 */   0,175,  5,  0,  0,163, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2570 */   0,184,  5,  0,  0,168, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2580 */   0,193,  5,  0,  0,170, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+/* 0x2590 */   0,202,  5,  0,  0,174, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x25a0 */   0,211,  5,  0,  0,176, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x25b0 */   0,220,  5,  0,  0,181, 26,  0,  0,  7,  0,  0,  0,  0,  0,  0,
+/* 0x25c0 */   0,229,  5,  0,  0,188, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x25d0 */   0,238,  5,  0,  0,190, 26,  0,  0, 75,  0,  0,  0,  0,  0,  0,
+/* 0x25e0 */   0,247,  5,  0,  0,  9, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x25f0 */   0,  0,  6,  0,  0, 11, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2600 */   0,  9,  6,  0,  0, 13, 27,  0,  0, 68,  0,  0,  0,  0,  0,  0,
+/* 0x2610 */   0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,
+/* 0x2620 */   0,  5,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  6,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,  0, 81,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,
+/* 0x2640 */   0,108,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,
+/* 0x2650 */   0, 17,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0, 20,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,  0,189,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,
+/* 0x2670 */   0,198,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,
+/* 0x2680 */   0, 24,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 25,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,  0,252,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,
+/* 0x26a0 */   0, 23,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,
+/* 0x26b0 */   0, 36,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0, 39,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0,  0,104,  1,  0,  0, 40,  0,  0,  0,  0,  0,  0,
+/* 0x26d0 */   0,113,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,
+/* 0x26e0 */   0, 43,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 44,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0,  0,167,  1,  0,  0, 47,  0,  0,  0,  0,  0,  0,
+/* 0x2700 */   0,194,  1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,
+/* 0x2710 */   0, 55,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0, 58,  0,  0,
+/* 0x2720 */   0,  0,  0,  0,  0, 19,  2,  0,  0, 59,  0,  0,  0,  0,  0,  0,
+/* 0x2730 */   0,155,  2,  0,  0, 73,  0,  0,  0,  0,  0,  0,  0,164,  2,  0,
+/* 0x2740 */   0, 74,  0,  0,  0,  0,  0,  0,  0,218,  2,  0,  0, 80,  0,  0,
+/* 0x2750 */   0,  0,  0,  0,  0, 61,  3,  0,  0, 91,  0,  0,  0,  0,  0,  0,
+/* 0x2760 */   0,187,  3,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,196,  3,  0,
+/* 0x2770 */   0,106,  0,  0,  0,  0,  0,  0,  0,232,  3,  0,  0,110,  0,  0,
+/* 0x2780 */   0,  0,  0,  0,  0, 66,  4,  0,  0,120,  0,  0,  0,  0,  0,  0,
+/* 0x2790 */   0,102,  4,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,201,  4,  0,
+/* 0x27a0 */   0,135,  0,  0,  0,  0,  0,  0,  0,210,  4,  0,  0,136,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0,  0, 26,  5,  0,  0,144,  0,  0,  0,  0,  0,  0,
+/* 0x27c0 */   0, 36,  5,  0,  0,145,  0,  0,  0,  0,  0,  0,  0, 46,  5,  0,
+/* 0x27d0 */   0,146,  0,  0,  0,  0,  0,  0,  0, 66,  5,  0,  0,148,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0,  0, 76,  5,  0,  0,149,  0,  0,  0,  0,  0,  0,
+/* 0x27f0 */   0,139,  5,  0,  0,156,  0,  0,  0,  0,  0,  0,  0,166,  5,  0,
+/* 0x2800 */   0,159,  0,  0,  0,  0,  0,  0,  0,220,  5,  0,  0,165,  0,  0,
+/* 0x2810 */   0,  0,  0,  0,  0,238,  5,  0,  0,167,  0,  0,  0,  0,  0,  0,
+/* 0x2820 */   0,  9,  6,  0,  0,170,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2830 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,
+/* 0x2840 */   0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2850 */   0, 36,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,
+/* 0x2860 */   0,  7,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  8,  0,  0,
+/* 0x2870 */   0,  0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,
+/* 0x2880 */   0, 99,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,
+/* 0x2890 */   0, 13,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0, 14,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0,  0,135,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x28b0 */   0,144,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,
+/* 0x28c0 */   0, 18,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0, 19,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0,  0,207,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,
+/* 0x28e0 */   0,234,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,
+/* 0x28f0 */   0, 27,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0, 29,  0,  0,
+/* 0x2900 */   0,  0,  0,  0,  0, 14,  1,  0,  0, 30,  0,  0,  0,  0,  0,  0,
+/* 0x2910 */   0, 32,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,
+/* 0x2920 */   0, 33,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0, 34,  0,  0,
+/* 0x2930 */   0,  0,  0,  0,  0, 59,  1,  0,  0, 35,  0,  0,  0,  0,  0,  0,
+/* 0x2940 */   0, 77,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,
+/* 0x2950 */   0, 38,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0, 42,  0,  0,
+/* 0x2960 */   0,  0,  0,  0,  0,149,  1,  0,  0, 45,  0,  0,  0,  0,  0,  0,
+/* 0x2970 */   0,158,  1,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,
+/* 0x2980 */   0, 48,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0, 49,  0,  0,
+/* 0x2990 */   0,  0,  0,  0,  0,203,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,
+/* 0x29a0 */   0,212,  1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,
+/* 0x29b0 */   0, 53,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0, 54,  0,  0,
+/* 0x29c0 */   0,  0,  0,  0,  0,248,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,
+/* 0x29d0 */   0,  1,  2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,
+/* 0x29e0 */   0, 60,  0,  0,  0,  0,  0,  0,  0, 39,  2,  0,  0, 61,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0,  0, 50,  2,  0,  0, 62,  0,  0,  0,  0,  0,  0,
+/* 0x2a00 */   0, 61,  2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0, 72,  2,  0,
+/* 0x2a10 */   0, 64,  0,  0,  0,  0,  0,  0,  0, 83,  2,  0,  0, 65,  0,  0,
+/* 0x2a20 */   0,  0,  0,  0,  0, 92,  2,  0,  0, 66,  0,  0,  0,  0,  0,  0,
+/* 0x2a30 */   0,101,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,110,  2,  0,
+/* 0x2a40 */   0, 68,  0,  0,  0,  0,  0,  0,  0,119,  2,  0,  0, 69,  0,  0,
+/* 0x2a50 */   0,  0,  0,  0,  0,128,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,
+/* 0x2a60 */   0,137,  2,  0,  0, 71,  0,  0,  0,  0,  0,  0,  0,146,  2,  0,
+/* 0x2a70 */   0, 72,  0,  0,  0,  0,  0,  0,  0,173,  2,  0,  0, 75,  0,  0,
+/* 0x2a80 */   0,  0,  0,  0,  0,182,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,
+/* 0x2a90 */   0,191,  2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,200,  2,  0,
+/* 0x2aa0 */   0, 78,  0,  0,  0,  0,  0,  0,  0,209,  2,  0,  0, 79,  0,  0,
+/* 0x2ab0 */   0,  0,  0,  0,  0,227,  2,  0,  0, 81,  0,  0,  0,  0,  0,  0,
+/* 0x2ac0 */   0,236,  2,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,245,  2,  0,
+/* 0x2ad0 */   0, 83,  0,  0,  0,  0,  0,  0,  0,254,  2,  0,  0, 84,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  7,  3,  0,  0, 85,  0,  0,  0,  0,  0,  0,
+/* 0x2af0 */   0, 16,  3,  0,  0, 86,  0,  0,  0,  0,  0,  0,  0, 25,  3,  0,
+/* 0x2b00 */   0, 87,  0,  0,  0,  0,  0,  0,  0, 34,  3,  0,  0, 88,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0,  0, 43,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,
+/* 0x2b20 */   0, 52,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0, 70,  3,  0,
+/* 0x2b30 */   0, 92,  0,  0,  0,  0,  0,  0,  0, 79,  3,  0,  0, 93,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0,  0, 88,  3,  0,  0, 94,  0,  0,  0,  0,  0,  0,
+/* 0x2b50 */   0, 97,  3,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,106,  3,  0,
+/* 0x2b60 */   0, 96,  0,  0,  0,  0,  0,  0,  0,115,  3,  0,  0, 97,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0,  0,124,  3,  0,  0, 98,  0,  0,  0,  0,  0,  0,
+/* 0x2b80 */   0,133,  3,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,142,  3,  0,
+/* 0x2b90 */   0,100,  0,  0,  0,  0,  0,  0,  0,151,  3,  0,  0,101,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0,  0,160,  3,  0,  0,102,  0,  0,  0,  0,  0,  0,
+/* 0x2bb0 */   0,169,  3,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,178,  3,  0,
+/* 0x2bc0 */   0,104,  0,  0,  0,  0,  0,  0,  0,205,  3,  0,  0,107,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0,  0,214,  3,  0,  0,108,  0,  0,  0,  0,  0,  0,
+/* 0x2be0 */   0,223,  3,  0,  0,109,  0,  0,  0,  0,  0,  0,  0,241,  3,  0,
+/* 0x2bf0 */   0,111,  0,  0,  0,  0,  0,  0,  0,250,  3,  0,  0,112,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0,  0,  3,  4,  0,  0,113,  0,  0,  0,  0,  0,  0,
+/* 0x2c10 */   0, 12,  4,  0,  0,114,  0,  0,  0,  0,  0,  0,  0, 21,  4,  0,
+/* 0x2c20 */   0,115,  0,  0,  0,  0,  0,  0,  0, 30,  4,  0,  0,116,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0,  0, 39,  4,  0,  0,117,  0,  0,  0,  0,  0,  0,
+/* 0x2c40 */   0, 48,  4,  0,  0,118,  0,  0,  0,  0,  0,  0,  0, 57,  4,  0,
+/* 0x2c50 */   0,119,  0,  0,  0,  0,  0,  0,  0, 75,  4,  0,  0,121,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0,  0, 84,  4,  0,  0,122,  0,  0,  0,  0,  0,  0,
+/* 0x2c70 */   0, 93,  4,  0,  0,123,  0,  0,  0,  0,  0,  0,  0,111,  4,  0,
+/* 0x2c80 */   0,125,  0,  0,  0,  0,  0,  0,  0,120,  4,  0,  0,126,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0,  0,129,  4,  0,  0,127,  0,  0,  0,  0,  0,  0,
+/* 0x2ca0 */   0,138,  4,  0,  0,128,  0,  0,  0,  0,  0,  0,  0,147,  4,  0,
+/* 0x2cb0 */   0,129,  0,  0,  0,  0,  0,  0,  0,156,  4,  0,  0,130,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0,  0,165,  4,  0,  0,131,  0,  0,  0,  0,  0,  0,
+/* 0x2cd0 */   0,174,  4,  0,  0,132,  0,  0,  0,  0,  0,  0,  0,183,  4,  0,
+/* 0x2ce0 */   0,133,  0,  0,  0,  0,  0,  0,  0,192,  4,  0,  0,134,  0,  0,
+/* 0x2cf0 */   0,  0,  0,  0,  0,219,  4,  0,  0,137,  0,  0,  0,  0,  0,  0,
+/* 0x2d00 */   0,228,  4,  0,  0,138,  0,  0,  0,  0,  0,  0,  0,237,  4,  0,
+/* 0x2d10 */   0,139,  0,  0,  0,  0,  0,  0,  0,246,  4,  0,  0,140,  0,  0,
+/* 0x2d20 */   0,  0,  0,  0,  0,255,  4,  0,  0,141,  0,  0,  0,  0,  0,  0,
+/* 0x2d30 */   0,  8,  5,  0,  0,142,  0,  0,  0,  0,  0,  0,  0, 17,  5,  0,
+/* 0x2d40 */   0,143,  0,  0,  0,  0,  0,  0,  0, 56,  5,  0,  0,147,  0,  0,
+/* 0x2d50 */   0,  0,  0,  0,  0, 85,  5,  0,  0,150,  0,  0,  0,  0,  0,  0,
+/* 0x2d60 */   0, 94,  5,  0,  0,151,  0,  0,  0,  0,  0,  0,  0,103,  5,  0,
+/* 0x2d70 */   0,152,  0,  0,  0,  0,  0,  0,  0,112,  5,  0,  0,153,  0,  0,
+/* 0x2d80 */   0,  0,  0,  0,  0,121,  5,  0,  0,154,  0,  0,  0,  0,  0,  0,
+/* 0x2d90 */   0,130,  5,  0,  0,155,  0,  0,  0,  0,  0,  0,  0,148,  5,  0,
+/* 0x2da0 */   0,157,  0,  0,  0,  0,  0,  0,  0,157,  5,  0,  0,158,  0,  0,
+/* 0x2db0 */   0,  0,  0,  0,  0,175,  5,  0,  0,160,  0,  0,  0,  0,  0,  0,
+/* 0x2dc0 */   0,184,  5,  0,  0,161,  0,  0,  0,  0,  0,  0,  0,193,  5,  0,
+/* 0x2dd0 */   0,162,  0,  0,  0,  0,  0,  0,  0,202,  5,  0,  0,163,  0,  0,
+/* 0x2de0 */   0,  0,  0,  0,  0,211,  5,  0,  0,164,  0,  0,  0,  0,  0,  0,
+/* 0x2df0 */   0,229,  5,  0,  0,166,  0,  0,  0,  0,  0,  0,  0,247,  5,  0,
+/* 0x2e00 */   0,168,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,169,  0,  0,
+/* 0x2e10 */   0,  0,  0,  0,  0, 18,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e20 */   0, 25,  6,  0,  0,172,  0,  0,  0,173,222,173,222, 43,  6,  0,
+/* 0x2e30 */   0,172,  0,  0,  0,173,222,173,222, 54,  6,  0,  0,172,  0,  0,
+/* 0x2e40 */   0,173,222,173,222, 65,  6,  0,  0,172,  0,  0,  0,173,222,173,
+/* 0x2e50 */ 222, 81,  6,  0,  0,172,  0,  0,  0,173,222,173,222, 86,  6,  0,
+/* 0x2e60 */   0,172,  0,  0,  0,173,222,173,222,100,  6,  0,  0,172,  0,  0,
+/* 0x2e70 */   0,173,222,173,222,111,  6,  0,  0,172,  0,  0,  0,173,222,173,
+/* 0x2e80 */ 222,  0,  0,  0,  0,  1,  0,  0,  0,119,  6,  0,  0,  9,  6,  0,
+/* 0x2e90 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,
+/* 0x2ea0 */   0,130,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2eb0 */   0,  4,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0, 54,  0,  0,
+/* 0x2ec0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,
+/* 0x2ed0 */   0,130,  6,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ee0 */   0,  8,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,  0, 45,  0,  0,
+/* 0x2ef0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 12,  0,  0,
+/* 0x2f00 */   0,130,  6,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */   0, 11,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,  0, 81,  0,  0,
+/* 0x2f20 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 14,  0,  0,
+/* 0x2f30 */   0,130,  6,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f40 */   0, 12,  0,  0,  0, 17,  0,  0,  0,130,  6,  0,  0,189,  0,  0,
+/* 0x2f50 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 47,  0,  0,
+/* 0x2f60 */   0,130,  6,  0,  0,153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f70 */   0, 13,  0,  0,  0, 12,  0,  0,  0,130,  6,  0,  0,108,  0,  0,
+/* 0x2f80 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  3,  0,  0,
+/* 0x2f90 */   0,130,  6,  0,  0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fa0 */   0, 14,  0,  0,  0, 14,  0,  0,  0,130,  6,  0,  0,108,  0,  0,
+/* 0x2fb0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  8,  0,  0,
+/* 0x2fc0 */   0,119,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fd0 */   0, 19,  0,  0,  0, 10,  0,  0,  0,130,  6,  0,  0,180,  0,  0,
+/* 0x2fe0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0, 21,  0,  0,
+/* 0x2ff0 */   0,119,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */   0, 20,  0,  0,  0, 18,  0,  0,  0,119,  6,  0,  0, 54,  0,  0,
+/* 0x3010 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,  1,  0,  0,
+/* 0x3020 */   0,130,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */   0, 23,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0,225,  0,  0,
+/* 0x3040 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  1,  0,  0,
+/* 0x3050 */   0,130,  6,  0,  0,198,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3060 */   0, 27,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,  0,216,  0,  0,
+/* 0x3070 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0, 12,  0,  0,
+/* 0x3080 */   0,130,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3090 */   0, 30,  0,  0,  0,  5,  0,  0,  0,130,  6,  0,  0, 23,  1,  0,
+/* 0x30a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 14,  0,  0,
+/* 0x30b0 */   0,130,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30c0 */   0, 31,  0,  0,  0, 15,  0,  0,  0,130,  6,  0,  0,252,  0,  0,
+/* 0x30d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 33,  0,  0,
+/* 0x30e0 */   0,130,  6,  0,  0,104,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30f0 */   0, 31,  0,  0,  0, 67,  0,  0,  0,130,  6,  0,  0, 68,  1,  0,
+/* 0x3100 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 12,  0,  0,
+/* 0x3110 */   0,130,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3120 */   0, 33,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,  0, 23,  1,  0,
+/* 0x3130 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0, 14,  0,  0,
+/* 0x3140 */   0,130,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3150 */   0, 37,  0,  0,  0,  8,  0,  0,  0,119,  6,  0,  0,225,  0,  0,
+/* 0x3160 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0, 10,  0,  0,
+/* 0x3170 */   0,130,  6,  0,  0, 95,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3180 */   0, 38,  0,  0,  0, 21,  0,  0,  0,119,  6,  0,  0,225,  0,  0,
+/* 0x3190 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0, 18,  0,  0,
+/* 0x31a0 */   0,119,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31b0 */   0, 41,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0,140,  1,  0,
+/* 0x31c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,  1,  0,  0,
+/* 0x31d0 */   0,130,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31e0 */   0, 45,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0,113,  1,  0,
+/* 0x31f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  3,  0,  0,
+/* 0x3200 */   0,130,  6,  0,  0,131,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3210 */   0, 48,  0,  0,  0, 12,  0,  0,  0,130,  6,  0,  0,194,  1,  0,
+/* 0x3220 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  5,  0,  0,
+/* 0x3230 */   0,130,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3240 */   0, 49,  0,  0,  0, 14,  0,  0,  0,130,  6,  0,  0,194,  1,  0,
+/* 0x3250 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0, 15,  0,  0,
+/* 0x3260 */   0,130,  6,  0,  0,167,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3270 */   0, 50,  0,  0,  0, 30,  0,  0,  0,130,  6,  0,  0,239,  1,  0,
+/* 0x3280 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0, 48,  0,  0,
+/* 0x3290 */   0,130,  6,  0,  0, 19,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32a0 */   0, 51,  0,  0,  0, 12,  0,  0,  0,130,  6,  0,  0,194,  1,  0,
+/* 0x32b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  3,  0,  0,
+/* 0x32c0 */   0,130,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32d0 */   0, 52,  0,  0,  0, 14,  0,  0,  0,130,  6,  0,  0,194,  1,  0,
+/* 0x32e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  8,  0,  0,
+/* 0x32f0 */   0,119,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3300 */   0, 57,  0,  0,  0, 10,  0,  0,  0,130,  6,  0,  0, 10,  2,  0,
+/* 0x3310 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0, 21,  0,  0,
+/* 0x3320 */   0,119,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3330 */   0, 58,  0,  0,  0, 18,  0,  0,  0,119,  6,  0,  0,140,  1,  0,
+/* 0x3340 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  5,  0,  0,
+/* 0x3350 */   0,140,  6,  0,  0, 25,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3360 */   0, 60,  0,  0,  0, 20,  0,  0,  0,140,  6,  0,  0, 43,  6,  0,
+/* 0x3370 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0, 30,  0,  0,
+/* 0x3380 */   0,140,  6,  0,  0, 54,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3390 */   0, 60,  0,  0,  0, 42,  0,  0,  0,140,  6,  0,  0, 65,  6,  0,
+/* 0x33a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,  1,  0,  0,
+/* 0x33b0 */   0,130,  6,  0,  0,155,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33c0 */   0, 69,  0,  0,  0,  1,  0,  0,  0,140,  6,  0,  0, 81,  6,  0,
+/* 0x33d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 73,  0,  0,  0,  1,  0,  0,
+/* 0x33e0 */   0,119,  6,  0,  0,232,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33f0 */   0, 77,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0,210,  4,  0,
+/* 0x3400 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  4,  0,  0,
+/* 0x3410 */   0,130,  6,  0,  0,210,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3420 */   0, 83,  0,  0,  0,  2,  0,  0,  0,130,  6,  0,  0,196,  3,  0,
+/* 0x3430 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 85,  0,  0,  0,  1,  0,  0,
+/* 0x3440 */   0,130,  6,  0,  0,196,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3450 */   0, 86,  0,  0,  0,  4,  0,  0,  0,130,  6,  0,  0, 61,  3,  0,
+/* 0x3460 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  4,  0,  0,
+/* 0x3470 */   0,130,  6,  0,  0,196,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3480 */   0,100,  0,  0,  0,  6,  0,  0,  0,130,  6,  0,  0,187,  3,  0,
+/* 0x3490 */   0,  0,  0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,  6,  0,  0,
+/* 0x34a0 */   0,130,  6,  0,  0,210,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34b0 */   0,111,  0,  0,  0,  1,  0,  0,  0,119,  6,  0,  0,232,  3,  0,
+/* 0x34c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,123,  0,  0,  0,  1,  0,  0,
+/* 0x34d0 */   0,130,  6,  0,  0, 66,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34e0 */   0,125,  0,  0,  0,  7,  0,  0,  0,130,  6,  0,  0,164,  2,  0,
+/* 0x34f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,  1,  0,  0,
+/* 0x3500 */   0,130,  6,  0,  0,218,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3510 */   0,131,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0,218,  2,  0,
+/* 0x3520 */   0,  0,  0,  0,  0,  0,  0,  0,  0,132,  0,  0,  0,  1,  0,  0,
+/* 0x3530 */   0,130,  6,  0,  0,210,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3540 */   0,133,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,  0,201,  4,  0,
+/* 0x3550 */   0,  0,  0,  0,  0,  0,  0,  0,  0,134,  0,  0,  0,  1,  0,  0,
+/* 0x3560 */   0,130,  6,  0,  0,201,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3570 */   0,135,  0,  0,  0,  2,  0,  0,  0,130,  6,  0,  0,218,  2,  0,
+/* 0x3580 */   0,  0,  0,  0,  0,  0,  0,  0,  0,136,  0,  0,  0,  4,  0,  0,
+/* 0x3590 */   0,130,  6,  0,  0,102,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35a0 */   0,144,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,  0, 46,  5,  0,
+/* 0x35b0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,145,  0,  0,  0, 13,  0,  0,
+/* 0x35c0 */   0,130,  6,  0,  0, 46,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35d0 */   0,146,  0,  0,  0,  5,  0,  0,  0,130,  6,  0,  0, 66,  5,  0,
+/* 0x35e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,  0, 10,  0,  0,
+/* 0x35f0 */   0,130,  6,  0,  0, 66,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3600 */   0,146,  0,  0,  0, 16,  0,  0,  0,130,  6,  0,  0, 66,  5,  0,
+/* 0x3610 */   0,  0,  0,  0,  0,  0,  0,  0,  0,147,  0,  0,  0,  4,  0,  0,
+/* 0x3620 */   0,130,  6,  0,  0, 66,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3630 */   0,147,  0,  0,  0,  9,  0,  0,  0,130,  6,  0,  0, 36,  5,  0,
+/* 0x3640 */   0,  0,  0,  0,  0,  0,  0,  0,  0,148,  0,  0,  0,  4,  0,  0,
+/* 0x3650 */   0,130,  6,  0,  0, 26,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3660 */   0,149,  0,  0,  0,  1,  0,  0,  0,140,  6,  0,  0, 86,  6,  0,
+/* 0x3670 */   0,  0,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,  0,  2,  0,  0,
+/* 0x3680 */   0,149,  6,  0,  0,100,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3690 */   0,150,  0,  0,  0,  4,  0,  0,  0,130,  6,  0,  0, 76,  5,  0,
+/* 0x36a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,155,  0,  0,  0, 15,  0,  0,
+/* 0x36b0 */   0,130,  6,  0,  0, 76,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36c0 */   0,156,  0,  0,  0,  1,  0,  0,  0,140,  6,  0,  0, 86,  6,  0,
+/* 0x36d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,159,  0,  0,  0,  3,  0,  0,
+/* 0x36e0 */   0,130,  6,  0,  0,220,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36f0 */   0,160,  0,  0,  0,  2,  0,  0,  0,149,  6,  0,  0,100,  6,  0,
+/* 0x3700 */   0,  0,  0,  0,  0,  0,  0,  0,  0,160,  0,  0,  0,  4,  0,  0,
+/* 0x3710 */   0,130,  6,  0,  0,166,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3720 */   0,165,  0,  0,  0,  6,  0,  0,  0,130,  6,  0,  0,139,  5,  0,
+/* 0x3730 */   0,  0,  0,  0,  0,  0,  0,  0,  0,170,  0,  0,  0, 60,  0,  0,
+/* 0x3740 */   0,119,  6,  0,  0,238,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3750 */   0,170,  0,  0,  0, 64,  0,  0,  0,140,  6,  0,  0,111,  6,  0,
+/* 0x3760 */   0,  0,  0,  0,  0,  0,  0,  0,  0,170,  0,  0,  0, 29,  0,  0,
+/* 0x3770 */   0,119,  6,  0,  0,238,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3780 */   0, 76, 69, 88, 69, 67, 48, 48, 48,  0, 76, 69, 88, 69, 67, 48,
+/* 0x3790 */  48, 57,  0, 76, 69, 88, 69, 67, 48, 49, 48,  0, 78, 50, 66, 83,
+/* 0x37a0 */  77, 65, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50,
+/* 0x37b0 */  66, 70, 65, 83, 49, 49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0,
+/* 0x37c0 */  78, 50, 66, 83, 77, 65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50,
+/* 0x37d0 */  48,  0, 78, 50, 66, 68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77,
+/* 0x37e0 */  65, 51, 48,  0, 78, 50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66,
+/* 0x37f0 */  68, 69, 67, 51, 48,  0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78,
+/* 0x3800 */  50, 66, 70, 65, 83, 52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,
+/* 0x3810 */   0, 78, 50, 66, 70, 65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67,
+/* 0x3820 */  53, 48,  0, 78, 50, 66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70,
+/* 0x3830 */  65, 83, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50,
+/* 0x3840 */  66, 68, 69, 67, 54, 48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0,
+/* 0x3850 */  78, 50, 68, 70, 65, 83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49,
+/* 0x3860 */  49,  0, 78, 50, 68, 68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77,
+/* 0x3870 */  65, 50, 48,  0, 78, 50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68,
+/* 0x3880 */  68, 69, 67, 50, 48,  0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78,
+/* 0x3890 */  50, 68, 70, 65, 83, 51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,
+/* 0x38a0 */   0, 78, 50, 68, 83, 77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x38b0 */  52, 48,  0, 78, 50, 68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70,
+/* 0x38c0 */  65, 83, 53, 48,  0, 78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50,
+/* 0x38d0 */  68, 83, 77, 65, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0,
+/* 0x38e0 */  78, 50, 68, 70, 65, 83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54,
+/* 0x38f0 */  48,  0, 78, 50, 69, 83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65,
+/* 0x3900 */  83, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69,
+/* 0x3910 */  68, 69, 67, 49, 48,  0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78,
+/* 0x3920 */  50, 69, 70, 65, 83, 50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,
+/* 0x3930 */   0, 78, 50, 69, 83, 77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x3940 */  51, 48,  0, 78, 50, 69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83,
+/* 0x3950 */  77, 65, 52, 48,  0, 78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50,
+/* 0x3960 */  69, 83, 77, 65, 53, 48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0,
+/* 0x3970 */  78, 50, 69, 68, 69, 67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54,
+/* 0x3980 */  48,  0, 78, 50, 69, 70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65,
+/* 0x3990 */  83, 54, 49,  0, 78, 50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77,
+/* 0x39a0 */  65, 95, 68, 69, 67, 48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70,
+/* 0x39b0 */  48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90,
+/* 0x39c0 */  77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x39d0 */  67, 51, 48,  0, 76, 69, 88, 69, 67, 48, 49, 53,  0, 76, 88, 85,
+/* 0x39e0 */  78, 70, 48, 48, 48,  0, 76, 88, 85, 78, 70, 48, 48, 50,  0, 77,
+/* 0x39f0 */  82, 85, 66, 89, 84, 69, 48,  0, 76, 88, 77, 82, 85, 48, 48, 53,
+/* 0x3a00 */   0, 76, 88, 77, 82, 85, 48, 48, 54,  0, 76, 88, 77, 82, 85, 48,
+/* 0x3a10 */  48, 55,  0, 76, 88, 85, 78, 70, 48, 48, 56,  0, 76, 88, 85, 78,
+/* 0x3a20 */  70, 48, 49, 48,  0, 76, 88, 74, 67, 67, 48, 49, 48,  0, 76, 88,
+/* 0x3a30 */  77, 82, 85, 48, 52, 53,  0, 76, 88, 77, 82, 85, 48, 52, 54,  0,
+/* 0x3a40 */  76, 88, 74, 67, 67, 48, 50, 48,  0, 76, 88, 74, 67, 67, 48, 50,
+/* 0x3a50 */  49,  0, 76, 88, 74, 67, 67, 48, 50, 51,  0, 76, 88, 85, 78, 70,
+/* 0x3a60 */  48, 51, 55,  0, 76, 88, 85, 78, 70, 51, 56, 54,  0, 76, 88, 85,
+/* 0x3a70 */  78, 70, 51, 56, 55,  0, 76, 88, 85, 78, 70, 51, 56, 56,  0, 76,
+/* 0x3a80 */  88, 85, 78, 70, 52, 56, 54,  0, 76, 88, 85, 78, 70, 52, 56, 55,
+/* 0x3a90 */   0, 76, 88, 77, 82, 85, 48, 54, 53,  0, 77, 82, 85, 66, 89, 84,
+/* 0x3aa0 */  69, 51,  0, 77, 82, 85, 65, 82, 66, 51, 48,  0, 77, 82, 85, 66,
+/* 0x3ab0 */  73, 84, 83, 51,  0, 77, 82, 85, 65, 82, 66, 52, 48,  0, 76, 88,
+/* 0x3ac0 */  77, 82, 85, 48, 55, 48,  0, 77, 82, 85, 66, 89, 84, 69, 52,  0,
+/* 0x3ad0 */  77, 82, 85, 66, 73, 84, 83, 52,  0, 77, 82, 85, 65, 82, 66, 53,
+/* 0x3ae0 */  48,  0, 76, 88, 77, 82, 85, 48, 56, 48,  0, 77, 82, 85, 66, 89,
+/* 0x3af0 */  84, 69, 53,  0, 77, 82, 85, 65, 82, 66, 54, 48,  0, 77, 82, 85,
+/* 0x3b00 */  66, 73, 84, 83, 53,  0, 77, 82, 85, 65, 82, 66, 55, 48,  0, 76,
+/* 0x3b10 */  88, 77, 82, 85, 48, 57, 48,  0, 77, 82, 85, 66, 89, 84, 69, 54,
+/* 0x3b20 */   0, 77, 82, 85, 65, 82, 66, 56, 48,  0, 77, 82, 85, 66, 73, 84,
+/* 0x3b30 */  83, 54,  0, 77, 82, 85, 65, 82, 66, 57, 48,  0, 76, 88, 77, 82,
+/* 0x3b40 */  85, 49, 48, 48,  0, 76, 88, 85, 78, 70, 48, 52, 48,  0, 76, 88,
+/* 0x3b50 */  77, 82, 85, 49, 49, 48,  0, 76, 88, 77, 82, 85, 49, 49, 49,  0,
+/* 0x3b60 */  76, 88, 85, 78, 70, 48, 52, 49,  0, 76, 88, 85, 78, 70, 48, 52,
+/* 0x3b70 */  50,  0, 76, 69, 88, 69, 67, 48, 49, 54,  0, 76, 88, 77, 82, 85,
+/* 0x3b80 */  48, 49, 48,  0, 76, 88, 74, 77, 80, 65, 48, 48,  0, 76, 88, 67,
+/* 0x3b90 */  65, 76, 76, 66, 48,  0, 76, 88, 85, 78, 70, 48, 50, 49,  0, 76,
+/* 0x3ba0 */  88, 77, 82, 85, 48, 50, 50,  0, 76, 88, 74, 77, 80, 65, 48, 49,
+/* 0x3bb0 */   0, 76, 88, 67, 65, 76, 76, 66, 49,  0, 77, 82, 85, 66, 73, 84,
+/* 0x3bc0 */  83, 49,  0, 76, 88, 77, 82, 85, 48, 51, 48,  0, 77, 82, 85, 66,
+/* 0x3bd0 */  89, 84, 69, 49,  0, 77, 82, 85, 65, 82, 66, 49, 48,  0, 76, 88,
+/* 0x3be0 */  77, 82, 85, 48, 52, 48,  0, 76, 88, 85, 78, 70, 48, 51, 48,  0,
+/* 0x3bf0 */  76, 88, 74, 67, 67, 48, 48, 48,  0, 76, 88, 67, 74, 48, 77, 82,
+/* 0x3c00 */  85,  0, 76, 88, 67, 74, 49, 77, 82, 85,  0, 76, 88, 67, 65, 76,
+/* 0x3c10 */  74, 77, 80,  0, 76, 88, 67, 65, 76, 76, 48, 48,  0, 76, 88, 67,
+/* 0x3c20 */  65, 76, 76, 48, 49,  0, 76, 88, 67, 74, 50, 77, 82, 85,  0, 76,
+/* 0x3c30 */  88, 67, 74, 52, 77, 82, 85,  0, 76, 88, 67, 74, 54, 77, 82, 85,
+/* 0x3c40 */   0, 76, 88, 67, 74, 55, 77, 82, 85,  0, 76, 88, 67, 74, 56, 77,
+/* 0x3c50 */  82, 85,  0, 76, 88, 85, 78, 70, 48, 51, 52,  0, 76, 88, 77, 82,
+/* 0x3c60 */  85, 48, 53, 53,  0, 77, 82, 85, 66, 89, 84, 69, 50,  0, 77, 82,
+/* 0x3c70 */  85, 66, 73, 84, 83, 50,  0, 77, 82, 85, 65, 82, 66, 50, 48,  0,
+/* 0x3c80 */  76, 88, 77, 82, 85, 48, 53, 55,  0, 76, 88, 77, 82, 85, 48, 53,
+/* 0x3c90 */  56,  0, 76, 88, 85, 78, 70, 48, 51, 53,  0, 99,116,111,107, 51,
+/* 0x3ca0 */  50, 46, 48, 48,  0, 99,116,111,107, 51, 50, 46, 49, 48,  0, 99,
+/* 0x3cb0 */ 116,111,107, 51, 50, 46, 50, 48,  0, 99,116,111,107, 51, 50, 46,
+/* 0x3cc0 */  51, 48,  0, 99,116,111,107, 51, 50, 46, 52, 48,  0, 67, 65, 76,
+/* 0x3cd0 */  76, 84, 82, 48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,  0, 67,
+/* 0x3ce0 */  65, 76, 76, 84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82, 48, 49,
+/* 0x3cf0 */   0, 67, 84, 66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83, 87, 65,
+/* 0x3d00 */  48, 49,  0, 67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65, 76, 76,
+/* 0x3d10 */  84, 82, 49, 48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0, 67, 65,
+/* 0x3d20 */  76, 76, 84, 82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49, 49,  0,
+/* 0x3d30 */  67, 84, 67, 76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84, 82, 49,
+/* 0x3d40 */  50,  0, 67, 84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66, 82, 79,
+/* 0x3d50 */  82, 49, 49,  0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67, 65, 76,
+/* 0x3d60 */  76, 84, 82, 49, 51,  0, 76, 69, 88, 69, 67, 48, 49, 55,  0, 76,
+/* 0x3d70 */  69, 88, 69, 67, 48, 50, 48,  0, 76, 85, 78, 77, 80, 48, 48, 48,
+/* 0x3d80 */   0, 76, 85, 78, 77, 80, 48, 48, 49,  0, 76, 69, 88, 69, 67, 48,
+/* 0x3d90 */  50, 53,  0, 95,115,116, 97,114,116,  0,108,122,109, 97, 95,115,
+/* 0x3da0 */ 116, 97, 99,107, 95, 97,100,106,117,115,116,  0,108,122,109, 97,
+/* 0x3db0 */  95,117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,
+/* 0x3dc0 */ 110,  0,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,
+/* 0x3dd0 */ 115,  0, 78, 77, 82, 85,  0,102,105,108,116,101,114, 95,108,101,
+/* 0x3de0 */ 110,103,116,104,  0,102,105,108,116,101,114, 95, 99,116,111,  0,
+/* 0x3df0 */  79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 51, 56, 54, 95, 80, 67,
+/* 0x3e00 */  51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51,
+/* 0x3e10 */  56, 54, 95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 56,  0, 81, 27,
+/* 0x3e20 */   0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* i386-bsd.elf.execve-entry.h
-   created from i386-bsd.elf.execve-entry.bin, 30538 (0x774a) bytes
+   created from i386-bsd.elf.execve-entry.bin, 15709 (0x3d5d) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_BSD_ELF_EXECVE_ENTRY_SIZE    30538
-#define STUB_I386_BSD_ELF_EXECVE_ENTRY_ADLER32 0x6f09c753
-#define STUB_I386_BSD_ELF_EXECVE_ENTRY_CRC32   0xd73658ab
+#define STUB_I386_BSD_ELF_EXECVE_ENTRY_SIZE    15709
+#define STUB_I386_BSD_ELF_EXECVE_ENTRY_ADLER32 0x6155925f
+#define STUB_I386_BSD_ELF_EXECVE_ENTRY_CRC32   0xcc86e9d7
 
-unsigned char stub_i386_bsd_elf_execve_entry[30538] = {
+unsigned char stub_i386_bsd_elf_execve_entry[15709] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  32, 34,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -465,1484 +465,557 @@ unsigned char stub_i386_bsd_elf_execve_entry[30538] = {
 /* 0x1aa0 */ 131,199,  5,136,216,226, 11,185,  0,  0,  0,  0,176,232,176,233,
 /* 0x1ab0 */ 242,174,117,  6,128, 63,  0,117,255,139,  7,102,193,232,  8,134,
 /* 0x1ac0 */ 196,193,192, 16,134,196, 41,248,  1,240,171,235,  4, 97,195, 93,
-/* 0x1ad0 */ 187,  0, 16, 64,  0,102,105,108,101, 32,102,111,114,109, 97,116,
-/* 0x1ae0 */  32,101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,
-/* 0x1af0 */ 116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32,
-/* 0x1b00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32,
-/* 0x1b10 */  32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x1b20 */  32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32,
-/* 0x1b30 */  32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48,
-/* 0x1b40 */  32, 76, 69, 88, 69, 67, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1b50 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42,
-/* 0x1b60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49,
-/* 0x1b70 */  32, 76, 69, 88, 69, 67, 48, 48, 57, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1b80 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 57, 32, 32, 50, 42,
-/* 0x1b90 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50,
-/* 0x1ba0 */  32, 76, 69, 88, 69, 67, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1bb0 */ 101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,101, 32, 32, 50, 42,
-/* 0x1bc0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51,
-/* 0x1bd0 */  32, 78, 50, 66, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1be0 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 99, 32, 32, 50, 42,
-/* 0x1bf0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52,
-/* 0x1c00 */  32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1c10 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,102, 32, 32, 50, 42,
-/* 0x1c20 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53,
-/* 0x1c30 */  32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1c40 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 49, 32, 32, 50, 42,
-/* 0x1c50 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54,
-/* 0x1c60 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1c70 */  98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 55, 32, 32, 50, 42,
-/* 0x1c80 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55,
-/* 0x1c90 */  32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1ca0 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 54, 50, 32, 32, 50, 42,
-/* 0x1cb0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56,
-/* 0x1cc0 */  32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1cd0 */  57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 54, 55, 32, 32, 50, 42,
-/* 0x1ce0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57,
-/* 0x1cf0 */  32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1d00 */ 100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 55, 48, 32, 32, 50, 42,
-/* 0x1d10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48,
-/* 0x1d20 */  32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1d30 */ 100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 55,100, 32, 32, 50, 42,
-/* 0x1d40 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49,
-/* 0x1d50 */  32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1d60 */ 102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 97, 32, 32, 50, 42,
-/* 0x1d70 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50,
-/* 0x1d80 */  32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1d90 */  51,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 57, 32, 32, 50,
-/* 0x1da0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x1db0 */  51, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1dc0 */  48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 55, 32, 32, 50,
-/* 0x1dd0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x1de0 */  52, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1df0 */  48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 52, 32, 32, 50,
-/* 0x1e00 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x1e10 */  53, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1e20 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,102, 51, 32, 32, 50,
-/* 0x1e30 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x1e40 */  54, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1e50 */  48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,102, 53, 32, 32, 50,
-/* 0x1e60 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x1e70 */  55, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1e80 */  48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48,102, 56, 32, 32, 50,
-/* 0x1e90 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x1ea0 */  56, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1eb0 */  48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 48, 49, 32, 32,
-/* 0x1ec0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1ed0 */  49, 57, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32,
-/* 0x1ee0 */  32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 48,100,
-/* 0x1ef0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1f00 */  10, 32, 50, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 32, 32,
-/* 0x1f10 */  32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x1f20 */  50, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1f30 */  84, 83, 10, 32, 50, 49, 32, 78, 50, 66, 68, 69, 67, 54, 48, 32,
-/* 0x1f40 */  32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x1f50 */  51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1f60 */  84, 83, 10, 32, 50, 50, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32,
-/* 0x1f70 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1f80 */  49, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1f90 */  78, 84, 83, 10, 32, 50, 51, 32, 78, 50, 68, 70, 65, 83, 49, 48,
-/* 0x1fa0 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1fb0 */  48, 49, 51,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1fc0 */  69, 78, 84, 83, 10, 32, 50, 52, 32, 78, 50, 68, 70, 65, 83, 49,
-/* 0x1fd0 */  49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1fe0 */  32, 48, 49, 52, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1ff0 */  84, 69, 78, 84, 83, 10, 32, 50, 53, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2000 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48,
-/* 0x2010 */  32, 32, 48, 49, 52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2020 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 54, 32, 78, 50, 68, 83, 77,
-/* 0x2030 */  65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x2040 */  48, 32, 32, 48, 49, 53, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2050 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 55, 32, 78, 50, 68, 70,
-/* 0x2060 */  65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32,
-/* 0x2070 */  32, 48, 32, 32, 48, 49, 53, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2080 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 56, 32, 78, 50, 68,
-/* 0x2090 */  68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48,
-/* 0x20a0 */  32, 32, 48, 32, 32, 48, 49, 54, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x20b0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 57, 32, 78, 50,
-/* 0x20c0 */  68, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32,
-/* 0x20d0 */  48, 32, 32, 48, 32, 32, 48, 49, 54,100, 32, 32, 50, 42, 42, 48,
-/* 0x20e0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 48, 32, 78,
-/* 0x20f0 */  50, 68, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32,
-/* 0x2100 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 97, 32, 32, 50, 42, 42,
-/* 0x2110 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 49, 32,
-/* 0x2120 */  78, 50, 68, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 53,
-/* 0x2130 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 57, 32, 32, 50,
-/* 0x2140 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51,
-/* 0x2150 */  50, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2160 */  48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100, 98, 32, 32,
-/* 0x2170 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2180 */  51, 51, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32,
-/* 0x2190 */  32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,101, 56, 32,
-/* 0x21a0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x21b0 */  32, 51, 52, 32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 32, 32, 32,
-/* 0x21c0 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102, 55,
-/* 0x21d0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x21e0 */  10, 32, 51, 53, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 32, 32,
-/* 0x21f0 */  32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102,
-/* 0x2200 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2210 */  83, 10, 32, 51, 54, 32, 78, 50, 68, 68, 69, 67, 53, 48, 32, 32,
-/* 0x2220 */  32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2230 */ 102, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2240 */  84, 83, 10, 32, 51, 55, 32, 78, 50, 68, 83, 77, 65, 54, 48, 32,
-/* 0x2250 */  32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2260 */  50, 48, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2270 */  78, 84, 83, 10, 32, 51, 56, 32, 78, 50, 68, 70, 65, 83, 54, 48,
-/* 0x2280 */  32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2290 */  32, 48, 50, 49, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x22a0 */  84, 69, 78, 84, 83, 10, 32, 51, 57, 32, 78, 50, 68, 70, 65, 83,
-/* 0x22b0 */  54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32,
-/* 0x22c0 */  48, 32, 32, 48, 50, 50, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x22d0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 48, 32, 78, 50, 68, 68,
-/* 0x22e0 */  69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x22f0 */  48, 32, 32, 48, 50, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2300 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 49, 32, 78, 50, 69, 83,
-/* 0x2310 */  77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32,
-/* 0x2320 */  32, 48, 32, 32, 48, 50, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2330 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 50, 32, 78, 50, 69,
-/* 0x2340 */  70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2350 */  32, 32, 48, 32, 32, 48, 50, 52, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2360 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 51, 32, 78, 50,
-/* 0x2370 */  69, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32,
-/* 0x2380 */  48, 32, 32, 48, 32, 32, 48, 50, 52, 53, 32, 32, 50, 42, 42, 48,
-/* 0x2390 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 52, 32, 78,
-/* 0x23a0 */  50, 69, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32,
-/* 0x23b0 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 52, 98, 32, 32, 50, 42, 42,
-/* 0x23c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 53, 32,
-/* 0x23d0 */  78, 50, 69, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53,
-/* 0x23e0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 53, 54, 32, 32, 50, 42,
-/* 0x23f0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 54,
-/* 0x2400 */  32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2410 */  57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 53, 98, 32, 32, 50,
-/* 0x2420 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52,
-/* 0x2430 */  55, 32, 78, 50, 69, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2440 */  48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 54, 52, 32, 32,
-/* 0x2450 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2460 */  52, 56, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32,
-/* 0x2470 */  32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 49, 32,
-/* 0x2480 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2490 */  32, 52, 57, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 32, 32, 32,
-/* 0x24a0 */  32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55,101,
-/* 0x24b0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x24c0 */  10, 32, 53, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x24d0 */  32, 32, 32, 48, 53,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x24e0 */  56,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x24f0 */  84, 83, 10, 32, 53, 49, 32, 78, 50, 69, 83, 77, 65, 52, 48, 32,
-/* 0x2500 */  32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2510 */  50,101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2520 */  78, 84, 83, 10, 32, 53, 50, 32, 78, 50, 69, 70, 65, 83, 52, 48,
-/* 0x2530 */  32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2540 */  48, 50,102, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2550 */  69, 78, 84, 83, 10, 32, 53, 51, 32, 78, 50, 69, 83, 77, 65, 53,
-/* 0x2560 */  48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2570 */  32, 48, 51, 48, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2580 */  84, 69, 78, 84, 83, 10, 32, 53, 52, 32, 78, 50, 69, 70, 65, 83,
-/* 0x2590 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48,
-/* 0x25a0 */  32, 32, 48, 51, 48, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x25b0 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 53, 32, 78, 50, 69, 68, 69,
-/* 0x25c0 */  67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32,
-/* 0x25d0 */  48, 32, 32, 48, 51, 48,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x25e0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 54, 32, 78, 50, 69, 83,
-/* 0x25f0 */  77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32,
-/* 0x2600 */  32, 48, 32, 32, 48, 51, 49, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2610 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 55, 32, 78, 50, 69,
-/* 0x2620 */  70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32,
-/* 0x2630 */  48, 32, 32, 48, 32, 32, 48, 51, 50, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2640 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 56, 32, 78,
-/* 0x2650 */  50, 69, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54,
-/* 0x2660 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 51, 98, 32, 32, 50, 42,
-/* 0x2670 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 57,
-/* 0x2680 */  32, 78, 50, 69, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2690 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 53, 49, 32, 32, 50, 42,
-/* 0x26a0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 48,
-/* 0x26b0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48,
-/* 0x26c0 */  50,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 53, 49, 32, 32,
-/* 0x26d0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x26e0 */  54, 49, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32,
-/* 0x26f0 */  32, 48, 52, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 55,102,
-/* 0x2700 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2710 */  10, 32, 54, 50, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32,
-/* 0x2720 */  32, 32, 32, 48, 97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2730 */  51, 99, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2740 */  78, 84, 83, 10, 32, 54, 51, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2750 */  50, 48, 32, 32, 32, 32, 48, 97, 56, 54, 32, 32, 48, 32, 32, 48,
-/* 0x2760 */  32, 32, 48,101, 52,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2770 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 52, 32, 76, 90, 77, 65, 95,
-/* 0x2780 */  68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 49, 97, 32, 32, 48, 32,
-/* 0x2790 */  32, 48, 32, 32, 48, 49, 56,100, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x27a0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 53, 32, 76, 69,
-/* 0x27b0 */  88, 69, 67, 48, 49, 53, 32, 32, 32, 32, 32, 32, 48, 50, 48, 32,
-/* 0x27c0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 56,101,100, 32, 32, 50, 42,
-/* 0x27d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 54,
-/* 0x27e0 */  32, 76, 69, 88, 69, 67, 49, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x27f0 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 48,100, 32, 32,
-/* 0x2800 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2810 */  54, 55, 32, 76, 69, 88, 69, 67, 49, 48, 48, 32, 32, 32, 32, 32,
-/* 0x2820 */  32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 49, 51,
-/* 0x2830 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2840 */  10, 32, 54, 56, 32, 76, 69, 88, 69, 67, 48, 49, 54, 32, 32, 32,
-/* 0x2850 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2860 */  49, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2870 */  84, 83, 10, 32, 54, 57, 32, 76, 88, 85, 78, 70, 48, 48, 48, 32,
-/* 0x2880 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2890 */  49, 57, 49, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x28a0 */  69, 78, 84, 83, 10, 32, 55, 48, 32, 76, 88, 85, 78, 70, 48, 48,
-/* 0x28b0 */  50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x28c0 */  32, 48, 49, 57, 49, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x28d0 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 49, 32, 77, 82, 85, 66, 89,
-/* 0x28e0 */  84, 69, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x28f0 */  48, 32, 32, 48, 49, 57, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2900 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 50, 32, 76, 88, 77,
-/* 0x2910 */  82, 85, 48, 48, 53, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2920 */  32, 32, 48, 32, 32, 48, 49, 57, 50, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2930 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 51, 32, 76,
-/* 0x2940 */  88, 77, 82, 85, 48, 48, 54, 32, 32, 32, 32, 32, 32, 48, 55, 32,
-/* 0x2950 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50, 55, 32, 32, 50, 42,
-/* 0x2960 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 52,
-/* 0x2970 */  32, 76, 88, 77, 82, 85, 48, 48, 55, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2980 */  55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50,101, 32, 32,
-/* 0x2990 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x29a0 */  55, 53, 32, 76, 88, 85, 78, 70, 48, 48, 56, 32, 32, 32, 32, 32,
-/* 0x29b0 */  32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 53,
-/* 0x29c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x29d0 */  10, 32, 55, 54, 32, 76, 88, 85, 78, 70, 48, 49, 48, 32, 32, 32,
-/* 0x29e0 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x29f0 */  51, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2a00 */  84, 83, 10, 32, 55, 55, 32, 76, 88, 74, 67, 67, 48, 49, 48, 32,
-/* 0x2a10 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2a20 */  49, 57, 51,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2a30 */  69, 78, 84, 83, 10, 32, 55, 56, 32, 76, 88, 77, 82, 85, 48, 52,
-/* 0x2a40 */  53, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2a50 */  32, 48, 49, 57, 52, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2a60 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 57, 32, 76, 88, 77, 82, 85,
-/* 0x2a70 */  48, 52, 54, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2a80 */  48, 32, 32, 48, 49, 57, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2a90 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 48, 32, 76, 88, 74,
-/* 0x2aa0 */  67, 67, 48, 50, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2ab0 */  32, 32, 48, 32, 32, 48, 49, 57, 52, 54, 32, 32, 50, 42, 42, 48,
-/* 0x2ac0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 49, 32, 76,
-/* 0x2ad0 */  88, 74, 67, 67, 48, 50, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x2ae0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 52, 56, 32, 32, 50, 42,
-/* 0x2af0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 50,
-/* 0x2b00 */  32, 76, 88, 74, 67, 67, 48, 50, 51, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2b10 */  55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 52,100, 32, 32,
-/* 0x2b20 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2b30 */  56, 51, 32, 76, 88, 85, 78, 70, 48, 51, 55, 32, 32, 32, 32, 32,
-/* 0x2b40 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 52,
-/* 0x2b50 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2b60 */  10, 32, 56, 52, 32, 76, 88, 85, 78, 70, 51, 56, 54, 32, 32, 32,
-/* 0x2b70 */  32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2b80 */  53, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b90 */  84, 83, 10, 32, 56, 53, 32, 76, 88, 85, 78, 70, 51, 56, 55, 32,
-/* 0x2ba0 */  32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2bb0 */  49, 57, 53, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2bc0 */  69, 78, 84, 83, 10, 32, 56, 54, 32, 76, 88, 85, 78, 70, 51, 56,
-/* 0x2bd0 */  56, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2be0 */  32, 48, 49, 57, 54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2bf0 */  78, 84, 69, 78, 84, 83, 10, 32, 56, 55, 32, 76, 88, 85, 78, 70,
-/* 0x2c00 */  52, 56, 54, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32,
-/* 0x2c10 */  48, 32, 32, 48, 49, 57, 54, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2c20 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 56, 32, 76, 88, 85,
-/* 0x2c30 */  78, 70, 52, 56, 55, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2c40 */  32, 32, 48, 32, 32, 48, 49, 57, 54, 55, 32, 32, 50, 42, 42, 48,
-/* 0x2c50 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 57, 32, 76,
-/* 0x2c60 */  88, 77, 82, 85, 48, 54, 53, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x2c70 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54, 57, 32, 32, 50, 42,
-/* 0x2c80 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 48,
-/* 0x2c90 */  32, 77, 82, 85, 66, 89, 84, 69, 51, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2ca0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54,101, 32, 32,
-/* 0x2cb0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2cc0 */  57, 49, 32, 77, 82, 85, 65, 82, 66, 51, 48, 32, 32, 32, 32, 32,
-/* 0x2cd0 */  32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 48,
-/* 0x2ce0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2cf0 */  10, 32, 57, 50, 32, 77, 82, 85, 66, 73, 84, 83, 51, 32, 32, 32,
-/* 0x2d00 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2d10 */  55, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2d20 */  84, 83, 10, 32, 57, 51, 32, 77, 82, 85, 65, 82, 66, 52, 48, 32,
-/* 0x2d30 */  32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2d40 */  49, 57, 55, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2d50 */  69, 78, 84, 83, 10, 32, 57, 52, 32, 76, 88, 77, 82, 85, 48, 55,
-/* 0x2d60 */  48, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2d70 */  32, 48, 49, 57, 55, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2d80 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 53, 32, 77, 82, 85, 66, 89,
-/* 0x2d90 */  84, 69, 52, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x2da0 */  48, 32, 32, 48, 49, 57, 55,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2db0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 54, 32, 77, 82, 85,
-/* 0x2dc0 */  66, 73, 84, 83, 52, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2dd0 */  32, 32, 48, 32, 32, 48, 49, 57, 56, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2de0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 55, 32, 77,
-/* 0x2df0 */  82, 85, 65, 82, 66, 53, 48, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x2e00 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 52, 32, 32, 50, 42,
-/* 0x2e10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 56,
-/* 0x2e20 */  32, 76, 88, 77, 82, 85, 48, 56, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2e30 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 97, 32, 32,
-/* 0x2e40 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2e50 */  57, 57, 32, 77, 82, 85, 66, 89, 84, 69, 53, 32, 32, 32, 32, 32,
-/* 0x2e60 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56,100,
-/* 0x2e70 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2e80 */  10, 49, 48, 48, 32, 77, 82, 85, 65, 82, 66, 54, 48, 32, 32, 32,
-/* 0x2e90 */  32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2ea0 */  56,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2eb0 */  84, 83, 10, 49, 48, 49, 32, 77, 82, 85, 66, 73, 84, 83, 53, 32,
-/* 0x2ec0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2ed0 */  49, 57, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2ee0 */  69, 78, 84, 83, 10, 49, 48, 50, 32, 77, 82, 85, 65, 82, 66, 55,
-/* 0x2ef0 */  48, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2f00 */  32, 48, 49, 57, 57, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2f10 */  78, 84, 69, 78, 84, 83, 10, 49, 48, 51, 32, 76, 88, 77, 82, 85,
-/* 0x2f20 */  48, 57, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32,
-/* 0x2f30 */  48, 32, 32, 48, 49, 57, 57, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2f40 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 52, 32, 77, 82, 85,
-/* 0x2f50 */  66, 89, 84, 69, 54, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2f60 */  32, 32, 48, 32, 32, 48, 49, 57, 97, 49, 32, 32, 50, 42, 42, 48,
-/* 0x2f70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 53, 32, 77,
-/* 0x2f80 */  82, 85, 65, 82, 66, 56, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32,
-/* 0x2f90 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97, 51, 32, 32, 50, 42,
-/* 0x2fa0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 54,
-/* 0x2fb0 */  32, 77, 82, 85, 66, 73, 84, 83, 54, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2fc0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97, 52, 32, 32,
-/* 0x2fd0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x2fe0 */  48, 55, 32, 77, 82, 85, 65, 82, 66, 57, 48, 32, 32, 32, 32, 32,
-/* 0x2ff0 */  32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97, 54,
-/* 0x3000 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3010 */  10, 49, 48, 56, 32, 76, 88, 77, 82, 85, 49, 48, 48, 32, 32, 32,
-/* 0x3020 */  32, 32, 32, 48, 49, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3030 */  57, 97, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3040 */  78, 84, 83, 10, 49, 48, 57, 32, 76, 88, 85, 78, 70, 48, 52, 48,
-/* 0x3050 */  32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3060 */  48, 49, 57, 98, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3070 */  84, 69, 78, 84, 83, 10, 49, 49, 48, 32, 76, 88, 77, 82, 85, 49,
-/* 0x3080 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48,
-/* 0x3090 */  32, 32, 48, 49, 57, 98,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x30a0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 49, 32, 76, 88, 77, 82,
-/* 0x30b0 */  85, 49, 49, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x30c0 */  32, 48, 32, 32, 48, 49, 57, 99, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x30d0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 50, 32, 76, 88,
-/* 0x30e0 */  85, 78, 70, 48, 52, 49, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32,
-/* 0x30f0 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 99, 52, 32, 32, 50, 42, 42,
-/* 0x3100 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 51, 32,
-/* 0x3110 */  76, 88, 85, 78, 70, 48, 52, 50, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x3120 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99, 98, 32, 32, 50, 42,
-/* 0x3130 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 52,
-/* 0x3140 */  32, 76, 88, 77, 82, 85, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3150 */  49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99, 98, 32, 32,
-/* 0x3160 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3170 */  49, 53, 32, 76, 88, 74, 77, 80, 65, 48, 48, 32, 32, 32, 32, 32,
-/* 0x3180 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99, 99,
-/* 0x3190 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x31a0 */  10, 49, 49, 54, 32, 76, 88, 67, 65, 76, 76, 66, 48, 32, 32, 32,
-/* 0x31b0 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x31c0 */  99,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x31d0 */  84, 83, 10, 49, 49, 55, 32, 76, 88, 85, 78, 70, 48, 50, 49, 32,
-/* 0x31e0 */  32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x31f0 */  49, 57,100, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3200 */  69, 78, 84, 83, 10, 49, 49, 56, 32, 76, 88, 77, 82, 85, 48, 50,
-/* 0x3210 */  50, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3220 */  32, 48, 49, 57,100, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3230 */  78, 84, 69, 78, 84, 83, 10, 49, 49, 57, 32, 76, 88, 74, 77, 80,
-/* 0x3240 */  65, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x3250 */  48, 32, 32, 48, 49, 57,100, 57, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3260 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 48, 32, 76, 88, 67,
-/* 0x3270 */  65, 76, 76, 66, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x3280 */  32, 32, 48, 32, 32, 48, 49, 57,100, 98, 32, 32, 50, 42, 42, 48,
-/* 0x3290 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 49, 32, 77,
-/* 0x32a0 */  82, 85, 66, 73, 84, 83, 49, 32, 32, 32, 32, 32, 32, 48, 49, 32,
-/* 0x32b0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100,100, 32, 32, 50, 42,
-/* 0x32c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 50,
-/* 0x32d0 */  32, 76, 88, 77, 82, 85, 48, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x32e0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100,101, 32, 32,
-/* 0x32f0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3300 */  50, 51, 32, 77, 82, 85, 66, 89, 84, 69, 49, 32, 32, 32, 32, 32,
-/* 0x3310 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,101, 48,
-/* 0x3320 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3330 */  10, 49, 50, 52, 32, 77, 82, 85, 65, 82, 66, 49, 48, 32, 32, 32,
-/* 0x3340 */  32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x3350 */ 101, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3360 */  84, 83, 10, 49, 50, 53, 32, 76, 88, 77, 82, 85, 48, 52, 48, 32,
-/* 0x3370 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3380 */  49, 57,101, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3390 */  69, 78, 84, 83, 10, 49, 50, 54, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x33a0 */  48, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32,
-/* 0x33b0 */  32, 48, 49, 57,101, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x33c0 */  78, 84, 69, 78, 84, 83, 10, 49, 50, 55, 32, 76, 88, 74, 67, 67,
-/* 0x33d0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32,
-/* 0x33e0 */  48, 32, 32, 48, 49, 57,101, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x33f0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 56, 32, 76, 88, 67,
-/* 0x3400 */  74, 48, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x3410 */  32, 32, 48, 32, 32, 48, 49, 57,102, 51, 32, 32, 50, 42, 42, 48,
-/* 0x3420 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 57, 32, 76,
-/* 0x3430 */  88, 67, 74, 49, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 51, 32,
-/* 0x3440 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 53, 32, 32, 50, 42,
-/* 0x3450 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 48,
-/* 0x3460 */  32, 76, 88, 67, 65, 76, 74, 77, 80, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3470 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 56, 32, 32,
-/* 0x3480 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3490 */  51, 49, 32, 76, 88, 67, 65, 76, 76, 48, 48, 32, 32, 32, 32, 32,
-/* 0x34a0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 98,
-/* 0x34b0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x34c0 */  10, 49, 51, 50, 32, 76, 88, 67, 65, 76, 76, 48, 49, 32, 32, 32,
-/* 0x34d0 */  32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x34e0 */ 102,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x34f0 */  84, 83, 10, 49, 51, 51, 32, 76, 88, 67, 74, 50, 77, 82, 85, 32,
-/* 0x3500 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3510 */  49, 97, 48, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3520 */  69, 78, 84, 83, 10, 49, 51, 52, 32, 76, 88, 67, 74, 52, 77, 82,
-/* 0x3530 */  85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3540 */  32, 48, 49, 97, 48, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3550 */  78, 84, 69, 78, 84, 83, 10, 49, 51, 53, 32, 76, 88, 67, 74, 54,
-/* 0x3560 */  77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x3570 */  48, 32, 32, 48, 49, 97, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3580 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 54, 32, 76, 88, 67,
-/* 0x3590 */  74, 55, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x35a0 */  32, 32, 48, 32, 32, 48, 49, 97, 48, 54, 32, 32, 50, 42, 42, 48,
-/* 0x35b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 55, 32, 76,
-/* 0x35c0 */  88, 67, 74, 56, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 51, 32,
-/* 0x35d0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 48, 56, 32, 32, 50, 42,
-/* 0x35e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 56,
-/* 0x35f0 */  32, 76, 88, 85, 78, 70, 48, 51, 52, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3600 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 48, 98, 32, 32,
-/* 0x3610 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3620 */  51, 57, 32, 76, 88, 77, 82, 85, 48, 53, 53, 32, 32, 32, 32, 32,
-/* 0x3630 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 48,
-/* 0x3640 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3650 */  10, 49, 52, 48, 32, 77, 82, 85, 66, 89, 84, 69, 50, 32, 32, 32,
-/* 0x3660 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3670 */  49, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3680 */  84, 83, 10, 49, 52, 49, 32, 77, 82, 85, 66, 73, 84, 83, 50, 32,
-/* 0x3690 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x36a0 */  49, 97, 49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x36b0 */  69, 78, 84, 83, 10, 49, 52, 50, 32, 77, 82, 85, 65, 82, 66, 50,
-/* 0x36c0 */  48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x36d0 */  32, 48, 49, 97, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x36e0 */  78, 84, 69, 78, 84, 83, 10, 49, 52, 51, 32, 76, 88, 77, 82, 85,
-/* 0x36f0 */  48, 53, 55, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32,
-/* 0x3700 */  48, 32, 32, 48, 49, 97, 50, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3710 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 52, 32, 76, 88, 77,
-/* 0x3720 */  82, 85, 48, 53, 56, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48,
-/* 0x3730 */  32, 32, 48, 32, 32, 48, 49, 97, 50, 55, 32, 32, 50, 42, 42, 48,
-/* 0x3740 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 53, 32, 76,
-/* 0x3750 */  88, 85, 78, 70, 48, 51, 53, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x3760 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 50, 56, 32, 32, 50, 42,
-/* 0x3770 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 54,
-/* 0x3780 */  32, 99,116,111,107, 51, 50, 46, 48, 48, 32, 32, 32, 32, 32, 48,
-/* 0x3790 */  55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 50,101, 32, 32,
-/* 0x37a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x37b0 */  52, 55, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 32, 32, 32,
-/* 0x37c0 */  32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 51, 53,
-/* 0x37d0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x37e0 */  10, 49, 52, 56, 32, 99,116,111,107, 51, 50, 46, 50, 48, 32, 32,
-/* 0x37f0 */  32, 32, 32, 48, 50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3800 */  97, 52, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3810 */  78, 84, 83, 10, 49, 52, 57, 32, 99,116,111,107, 51, 50, 46, 51,
-/* 0x3820 */  48, 32, 32, 32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3830 */  48, 49, 97, 54, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3840 */  84, 69, 78, 84, 83, 10, 49, 53, 48, 32, 99,116,111,107, 51, 50,
-/* 0x3850 */  46, 52, 48, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x3860 */  32, 32, 48, 49, 97, 54,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3870 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 49, 32, 67, 65, 76, 76,
-/* 0x3880 */  84, 82, 48, 48, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32, 32, 48,
-/* 0x3890 */  32, 32, 48, 32, 32, 48, 49, 97, 55, 50, 32, 32, 50, 42, 42, 48,
-/* 0x38a0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 50, 32, 67,
-/* 0x38b0 */  84, 67, 76, 69, 86, 69, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x38c0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56, 50, 32, 32, 50, 42,
-/* 0x38d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 51,
-/* 0x38e0 */  32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x38f0 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56, 55, 32, 32,
-/* 0x3900 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3910 */  53, 52, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 32, 32, 32, 32,
-/* 0x3920 */  32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56, 99,
-/* 0x3930 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3940 */  10, 49, 53, 53, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 32, 32,
-/* 0x3950 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3960 */  57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3970 */  84, 83, 10, 49, 53, 54, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32,
-/* 0x3980 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3990 */  49, 97, 57, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x39a0 */  69, 78, 84, 83, 10, 49, 53, 55, 32, 67, 65, 76, 76, 84, 82, 48,
-/* 0x39b0 */  50, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32, 32, 48, 32, 32, 48,
-/* 0x39c0 */  32, 32, 48, 49, 97, 57, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x39d0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 56, 32, 67, 65, 76, 76,
-/* 0x39e0 */  84, 82, 49, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x39f0 */  32, 48, 32, 32, 48, 49, 97, 97, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3a00 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 57, 32, 67, 65,
-/* 0x3a10 */  76, 76, 84, 82, 69, 56, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x3a20 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 97, 99, 32, 32, 50, 42, 42,
-/* 0x3a30 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 48, 32,
-/* 0x3a40 */  67, 65, 76, 76, 84, 82, 69, 57, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x3a50 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97,101, 32, 32, 50,
-/* 0x3a60 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54,
-/* 0x3a70 */  49, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32, 32, 32, 32, 32, 32,
-/* 0x3a80 */  48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 98, 48, 32,
-/* 0x3a90 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3aa0 */  49, 54, 50, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 32, 32, 32,
-/* 0x3ab0 */  32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 98,
-/* 0x3ac0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3ad0 */  83, 10, 49, 54, 51, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 32,
-/* 0x3ae0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3af0 */  97, 98, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3b00 */  78, 84, 83, 10, 49, 54, 52, 32, 67, 84, 66, 83, 72, 82, 49, 49,
-/* 0x3b10 */  32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3b20 */  48, 49, 97, 98, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3b30 */  84, 69, 78, 84, 83, 10, 49, 54, 53, 32, 67, 84, 66, 82, 79, 82,
-/* 0x3b40 */  49, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x3b50 */  32, 32, 48, 49, 97, 98,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3b60 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 54, 32, 67, 84, 66, 83,
-/* 0x3b70 */  87, 65, 49, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x3b80 */  32, 48, 32, 32, 48, 49, 97, 99, 49, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3b90 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 55, 32, 67, 65,
-/* 0x3ba0 */  76, 76, 84, 82, 49, 51, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32,
-/* 0x3bb0 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 99, 54, 32, 32, 50, 42, 42,
-/* 0x3bc0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 56, 32,
-/* 0x3bd0 */  76, 69, 88, 69, 67, 48, 49, 55, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x3be0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 99,100, 32, 32, 50,
-/* 0x3bf0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54,
-/* 0x3c00 */  57, 32, 76, 69, 88, 69, 67, 48, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3c10 */  48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 99,102, 32,
-/* 0x3c20 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3c30 */  83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48,
-/* 0x3c40 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3c50 */  50, 66, 83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x3c60 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3c70 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 48, 32, 78,
-/* 0x3c80 */  50, 66, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c90 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x3ca0 */  48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3cb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3cc0 */  66, 68, 69, 67, 50, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 50,
-/* 0x3cd0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3ce0 */ 100, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50,
-/* 0x3cf0 */  66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3d00 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48,
-/* 0x3d10 */  32, 48, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48,
-/* 0x3d20 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x3d30 */  70, 65, 83, 54, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49,
-/* 0x3d40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3d50 */  32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 66,
-/* 0x3d60 */  68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3d70 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32,
-/* 0x3d80 */  48, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3d90 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x3da0 */  65, 83, 49, 49, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10,
-/* 0x3db0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3dc0 */  32, 78, 50, 68, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 68, 68,
-/* 0x3dd0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3de0 */  32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 48,
-/* 0x3df0 */  32, 78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3e00 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69,
-/* 0x3e10 */  67, 51, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48,
-/* 0x3e20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3e30 */  78, 50, 68, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 68, 68, 69,
-/* 0x3e40 */  67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3e50 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 48, 32,
-/* 0x3e60 */  78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e70 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x3e80 */  54, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48,
-/* 0x3e90 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3ea0 */  50, 69, 83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x3eb0 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3ec0 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 48, 32, 78,
-/* 0x3ed0 */  50, 69, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ee0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x3ef0 */  48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3f00 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3f10 */  69, 68, 69, 67, 50, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 50,
-/* 0x3f20 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3f30 */ 100, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50,
-/* 0x3f40 */  69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3f50 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48,
-/* 0x3f60 */  32, 48, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48,
-/* 0x3f70 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x3f80 */  70, 65, 83, 54, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54, 49,
-/* 0x3f90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3fa0 */  32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 69,
-/* 0x3fb0 */  68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3fc0 */  32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 49, 48, 32,
-/* 0x3fd0 */  48, 32, 76, 88, 85, 78, 70, 48, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3fe0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67,
-/* 0x3ff0 */  67, 48, 49, 48, 32, 48, 32, 76, 88, 74, 67, 67, 48, 49, 48, 10,
-/* 0x4000 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4010 */  32, 76, 88, 85, 78, 70, 48, 51, 55, 32, 48, 32, 76, 88, 85, 78,
-/* 0x4020 */  70, 48, 51, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4030 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 55, 48, 32, 48,
-/* 0x4040 */  32, 76, 88, 77, 82, 85, 48, 55, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4050 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x4060 */  49, 48, 48, 32, 48, 32, 76, 88, 77, 82, 85, 49, 48, 48, 10, 48,
-/* 0x4070 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4080 */  76, 88, 85, 78, 70, 48, 52, 48, 32, 48, 32, 76, 88, 85, 78, 70,
-/* 0x4090 */  48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x40a0 */  32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 50, 32, 48, 32,
-/* 0x40b0 */  76, 88, 85, 78, 70, 48, 52, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x40d0 */  51, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 51, 48, 10, 48, 48,
-/* 0x40e0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x40f0 */  88, 85, 78, 70, 48, 51, 48, 32, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x4100 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4110 */  32,100, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85, 32, 48, 32, 76,
-/* 0x4120 */  88, 67, 74, 56, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4130 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x4140 */  52, 32, 48, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 48, 48, 48,
-/* 0x4150 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,
-/* 0x4160 */ 111,107, 51, 50, 46, 48, 48, 32, 48, 32, 99,116,111,107, 51, 50,
-/* 0x4170 */  46, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4180 */  32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 48,
-/* 0x4190 */  32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x41a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107,
-/* 0x41b0 */  51, 50, 46, 50, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 50,
-/* 0x41c0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x41d0 */ 100, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 48, 32, 99,
-/* 0x41e0 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x41f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4200 */  48, 48, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48, 48,
-/* 0x4210 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x4220 */  65, 76, 76, 84, 82, 49, 48, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4230 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4240 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32, 48, 32, 67,
-/* 0x4250 */  65, 76, 76, 84, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4260 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x4270 */  51, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 48, 48, 48,
-/* 0x4280 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69,
-/* 0x4290 */  88, 69, 67, 48, 50, 48, 32, 48, 32, 76, 69, 88, 69, 67, 48, 50,
-/* 0x42a0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x42b0 */ 100, 32, 32, 76, 69, 88, 69, 67, 48, 48, 48, 32, 48, 32, 76, 69,
-/* 0x42c0 */  88, 69, 67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x42d0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 48, 57,
-/* 0x42e0 */  32, 48, 32, 76, 69, 88, 69, 67, 48, 48, 57, 10, 48, 48, 48, 48,
-/* 0x42f0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88,
-/* 0x4300 */  69, 67, 48, 49, 48, 32, 48, 32, 76, 69, 88, 69, 67, 48, 49, 48,
-/* 0x4310 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4320 */  32, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 66,
-/* 0x4330 */  70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4340 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32,
-/* 0x4350 */  48, 32, 78, 50, 66, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4360 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x4370 */  65, 83, 50, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 10,
-/* 0x4380 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4390 */  32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 66, 83,
-/* 0x43a0 */  77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x43b0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 48,
-/* 0x43c0 */  32, 78, 50, 66, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x43d0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77,
-/* 0x43e0 */  65, 52, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 52, 48, 10, 48,
-/* 0x43f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4400 */  78, 50, 66, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 66, 70, 65,
-/* 0x4410 */  83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4420 */  32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 48, 32,
-/* 0x4430 */  78, 50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4440 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x4450 */  53, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 53, 48, 10, 48, 48,
-/* 0x4460 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x4470 */  50, 66, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4480 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4490 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32, 48, 32, 78,
-/* 0x44a0 */  50, 66, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x44b0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49,
-/* 0x44c0 */  48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48,
-/* 0x44d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x44e0 */  68, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 50,
-/* 0x44f0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4500 */ 100, 32, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50,
-/* 0x4510 */  68, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4520 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48,
-/* 0x4530 */  32, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48,
-/* 0x4540 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x4550 */  70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48,
-/* 0x4560 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4570 */  32, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 68,
-/* 0x4580 */  83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4590 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32,
-/* 0x45a0 */  48, 32, 78, 50, 68, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x45b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x45c0 */  77, 65, 53, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48, 10,
-/* 0x45d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x45e0 */  32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 68, 70,
-/* 0x45f0 */  65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4600 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 48,
-/* 0x4610 */  32, 78, 50, 68, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4620 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65,
-/* 0x4630 */  83, 54, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 54, 48, 10, 48,
-/* 0x4640 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4650 */  78, 50, 69, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 69, 70, 65,
-/* 0x4660 */  83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4670 */  32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 48, 32,
-/* 0x4680 */  78, 50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4690 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x46a0 */  50, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 50, 48, 10, 48, 48,
-/* 0x46b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x46c0 */  50, 69, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x46d0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x46e0 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 48, 32, 78,
-/* 0x46f0 */  50, 69, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4700 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 52,
-/* 0x4710 */  48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48,
-/* 0x4720 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4730 */  69, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 52,
-/* 0x4740 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4750 */ 100, 32, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50,
-/* 0x4760 */  69, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4770 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48,
-/* 0x4780 */  32, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48,
-/* 0x4790 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x47a0 */  83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 54, 48,
-/* 0x47b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x47c0 */  32, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 69,
-/* 0x47d0 */  70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x47e0 */  32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48,
-/* 0x47f0 */  48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 10, 48,
-/* 0x4800 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4810 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77,
-/* 0x4820 */  65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4830 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x4840 */  67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x4850 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4860 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76,
-/* 0x4870 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4880 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x4890 */  68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x48a0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x48b0 */  32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 53, 32, 48, 32, 76,
-/* 0x48c0 */  69, 88, 69, 67, 48, 49, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48d0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 49, 49,
-/* 0x48e0 */  48, 32, 48, 32, 76, 69, 88, 69, 67, 49, 49, 48, 10, 48, 48, 48,
-/* 0x48f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69,
-/* 0x4900 */  88, 69, 67, 49, 48, 48, 32, 48, 32, 76, 69, 88, 69, 67, 49, 48,
-/* 0x4910 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4920 */ 100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 54, 32, 48, 32, 76, 69,
-/* 0x4930 */  88, 69, 67, 48, 49, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4940 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 48, 48,
-/* 0x4950 */  32, 48, 32, 76, 88, 85, 78, 70, 48, 48, 48, 10, 48, 48, 48, 48,
-/* 0x4960 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x4970 */  78, 70, 48, 48, 50, 32, 48, 32, 76, 88, 85, 78, 70, 48, 48, 50,
-/* 0x4980 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4990 */  32, 32, 77, 82, 85, 66, 89, 84, 69, 48, 32, 48, 32, 77, 82, 85,
-/* 0x49a0 */  66, 89, 84, 69, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x49b0 */  32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 48, 53, 32,
-/* 0x49c0 */  48, 32, 76, 88, 77, 82, 85, 48, 48, 53, 10, 48, 48, 48, 48, 48,
-/* 0x49d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x49e0 */  85, 48, 48, 54, 32, 48, 32, 76, 88, 77, 82, 85, 48, 48, 54, 10,
-/* 0x49f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4a00 */  32, 76, 88, 77, 82, 85, 48, 48, 55, 32, 48, 32, 76, 88, 77, 82,
-/* 0x4a10 */  85, 48, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4a20 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 48, 56, 32, 48,
-/* 0x4a30 */  32, 76, 88, 85, 78, 70, 48, 48, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4a40 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x4a50 */  48, 52, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48, 52, 53, 10, 48,
-/* 0x4a60 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4a70 */  76, 88, 77, 82, 85, 48, 52, 54, 32, 48, 32, 76, 88, 77, 82, 85,
-/* 0x4a80 */  48, 52, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4a90 */  32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 48, 32, 48, 32,
-/* 0x4aa0 */  76, 88, 74, 67, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ab0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48,
-/* 0x4ac0 */  50, 49, 32, 48, 32, 76, 88, 74, 67, 67, 48, 50, 49, 10, 48, 48,
-/* 0x4ad0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4ae0 */  88, 74, 67, 67, 48, 50, 51, 32, 48, 32, 76, 88, 74, 67, 67, 48,
-/* 0x4af0 */  50, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4b00 */  32,100, 32, 32, 76, 88, 85, 78, 70, 51, 56, 54, 32, 48, 32, 76,
-/* 0x4b10 */  88, 85, 78, 70, 51, 56, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b20 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51, 56,
-/* 0x4b30 */  55, 32, 48, 32, 76, 88, 85, 78, 70, 51, 56, 55, 10, 48, 48, 48,
-/* 0x4b40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x4b50 */  85, 78, 70, 51, 56, 56, 32, 48, 32, 76, 88, 85, 78, 70, 51, 56,
-/* 0x4b60 */  56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4b70 */ 100, 32, 32, 76, 88, 85, 78, 70, 52, 56, 54, 32, 48, 32, 76, 88,
-/* 0x4b80 */  85, 78, 70, 52, 56, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4b90 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 52, 56, 55,
-/* 0x4ba0 */  32, 48, 32, 76, 88, 85, 78, 70, 52, 56, 55, 10, 48, 48, 48, 48,
-/* 0x4bb0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77,
-/* 0x4bc0 */  82, 85, 48, 54, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48, 54, 53,
-/* 0x4bd0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4be0 */  32, 32, 77, 82, 85, 66, 89, 84, 69, 51, 32, 48, 32, 77, 82, 85,
-/* 0x4bf0 */  66, 89, 84, 69, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4c00 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 51, 48, 32,
-/* 0x4c10 */  48, 32, 77, 82, 85, 65, 82, 66, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4c20 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66,
-/* 0x4c30 */  73, 84, 83, 51, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 51, 10,
-/* 0x4c40 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4c50 */  32, 77, 82, 85, 65, 82, 66, 52, 48, 32, 48, 32, 77, 82, 85, 65,
-/* 0x4c60 */  82, 66, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4c70 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 52, 32, 48,
-/* 0x4c80 */  32, 77, 82, 85, 66, 89, 84, 69, 52, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4c90 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73,
-/* 0x4ca0 */  84, 83, 52, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 52, 10, 48,
-/* 0x4cb0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4cc0 */  77, 82, 85, 65, 82, 66, 53, 48, 32, 48, 32, 77, 82, 85, 65, 82,
-/* 0x4cd0 */  66, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4ce0 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 56, 48, 32, 48, 32,
-/* 0x4cf0 */  76, 88, 77, 82, 85, 48, 56, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84,
-/* 0x4d10 */  69, 53, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 53, 10, 48, 48,
-/* 0x4d20 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77,
-/* 0x4d30 */  82, 85, 65, 82, 66, 54, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66,
-/* 0x4d40 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4d50 */  32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 53, 32, 48, 32, 77,
-/* 0x4d60 */  82, 85, 66, 73, 84, 83, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d70 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 55,
-/* 0x4d80 */  48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 55, 48, 10, 48, 48, 48,
-/* 0x4d90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x4da0 */  77, 82, 85, 48, 57, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 57,
-/* 0x4db0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4dc0 */ 100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 54, 32, 48, 32, 77, 82,
-/* 0x4dd0 */  85, 66, 89, 84, 69, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4de0 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 56, 48,
-/* 0x4df0 */  32, 48, 32, 77, 82, 85, 65, 82, 66, 56, 48, 10, 48, 48, 48, 48,
-/* 0x4e00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x4e10 */  66, 73, 84, 83, 54, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 54,
-/* 0x4e20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4e30 */  32, 32, 77, 82, 85, 65, 82, 66, 57, 48, 32, 48, 32, 77, 82, 85,
-/* 0x4e40 */  65, 82, 66, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4e50 */  32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 49, 49, 48, 32,
-/* 0x4e60 */  48, 32, 76, 88, 77, 82, 85, 49, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4e70 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x4e80 */  85, 49, 49, 49, 32, 48, 32, 76, 88, 77, 82, 85, 49, 49, 49, 10,
-/* 0x4e90 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4ea0 */  32, 76, 88, 85, 78, 70, 48, 52, 49, 32, 48, 32, 76, 88, 85, 78,
-/* 0x4eb0 */  70, 48, 52, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4ec0 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 49, 48, 32, 48,
-/* 0x4ed0 */  32, 76, 88, 77, 82, 85, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ee0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 77, 80,
-/* 0x4ef0 */  65, 48, 48, 32, 48, 32, 76, 88, 74, 77, 80, 65, 48, 48, 10, 48,
-/* 0x4f00 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4f10 */  76, 88, 67, 65, 76, 76, 66, 48, 32, 48, 32, 76, 88, 67, 65, 76,
-/* 0x4f20 */  76, 66, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4f30 */  32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 50, 49, 32, 48, 32,
-/* 0x4f40 */  76, 88, 85, 78, 70, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f50 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4f60 */  50, 50, 32, 48, 32, 76, 88, 77, 82, 85, 48, 50, 50, 10, 48, 48,
-/* 0x4f70 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4f80 */  88, 74, 77, 80, 65, 48, 49, 32, 48, 32, 76, 88, 74, 77, 80, 65,
-/* 0x4f90 */  48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4fa0 */  32,100, 32, 32, 76, 88, 67, 65, 76, 76, 66, 49, 32, 48, 32, 76,
-/* 0x4fb0 */  88, 67, 65, 76, 76, 66, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4fc0 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x4fd0 */  49, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 49, 10, 48, 48, 48,
-/* 0x4fe0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x4ff0 */  85, 66, 89, 84, 69, 49, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x5000 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5010 */ 100, 32, 32, 77, 82, 85, 65, 82, 66, 49, 48, 32, 48, 32, 77, 82,
-/* 0x5020 */  85, 65, 82, 66, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5030 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 52, 48,
-/* 0x5040 */  32, 48, 32, 76, 88, 77, 82, 85, 48, 52, 48, 10, 48, 48, 48, 48,
-/* 0x5050 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74,
-/* 0x5060 */  67, 67, 48, 48, 48, 32, 48, 32, 76, 88, 74, 67, 67, 48, 48, 48,
-/* 0x5070 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5080 */  32, 32, 76, 88, 67, 74, 48, 77, 82, 85, 32, 48, 32, 76, 88, 67,
-/* 0x5090 */  74, 48, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x50a0 */  32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 49, 77, 82, 85, 32,
-/* 0x50b0 */  48, 32, 76, 88, 67, 74, 49, 77, 82, 85, 10, 48, 48, 48, 48, 48,
-/* 0x50c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65,
-/* 0x50d0 */  76, 74, 77, 80, 32, 48, 32, 76, 88, 67, 65, 76, 74, 77, 80, 10,
-/* 0x50e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x50f0 */  32, 76, 88, 67, 65, 76, 76, 48, 48, 32, 48, 32, 76, 88, 67, 65,
-/* 0x5100 */  76, 76, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5110 */  32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 48, 49, 32, 48,
-/* 0x5120 */  32, 76, 88, 67, 65, 76, 76, 48, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5130 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 50,
-/* 0x5140 */  77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 50, 77, 82, 85, 10, 48,
-/* 0x5150 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5160 */  76, 88, 67, 74, 52, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 52,
-/* 0x5170 */  77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5180 */  32, 32,100, 32, 32, 76, 88, 67, 74, 54, 77, 82, 85, 32, 48, 32,
-/* 0x5190 */  76, 88, 67, 74, 54, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x51a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 55, 77,
-/* 0x51b0 */  82, 85, 32, 48, 32, 76, 88, 67, 74, 55, 77, 82, 85, 10, 48, 48,
-/* 0x51c0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x51d0 */  88, 77, 82, 85, 48, 53, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48,
-/* 0x51e0 */  53, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x51f0 */  32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 50, 32, 48, 32, 77,
-/* 0x5200 */  82, 85, 66, 89, 84, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5210 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x5220 */  50, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 50, 10, 48, 48, 48,
-/* 0x5230 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x5240 */  85, 65, 82, 66, 50, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 50,
-/* 0x5250 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5260 */ 100, 32, 32, 76, 88, 77, 82, 85, 48, 53, 55, 32, 48, 32, 76, 88,
-/* 0x5270 */  77, 82, 85, 48, 53, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5280 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 53, 56,
-/* 0x5290 */  32, 48, 32, 76, 88, 77, 82, 85, 48, 53, 56, 10, 48, 48, 48, 48,
-/* 0x52a0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x52b0 */  78, 70, 48, 51, 53, 32, 48, 32, 76, 88, 85, 78, 70, 48, 51, 53,
-/* 0x52c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x52d0 */  32, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 48, 32, 99,116,
-/* 0x52e0 */ 111,107, 51, 50, 46, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x52f0 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69,
-/* 0x5300 */  49, 32, 48, 32, 67, 84, 67, 76, 69, 86, 69, 49, 10, 48, 48, 48,
-/* 0x5310 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x5320 */  76, 76, 84, 82, 48, 49, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48,
-/* 0x5330 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5340 */ 100, 32, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 48, 32, 67, 84,
-/* 0x5350 */  66, 83, 72, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5360 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 48, 49,
-/* 0x5370 */  32, 48, 32, 67, 84, 66, 82, 79, 82, 48, 49, 10, 48, 48, 48, 48,
-/* 0x5380 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66,
-/* 0x5390 */  83, 87, 65, 48, 49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 48, 49,
-/* 0x53a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x53b0 */  32, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 48, 32, 67, 65, 76,
-/* 0x53c0 */  76, 84, 82, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x53d0 */  32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32,
-/* 0x53e0 */  48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 10, 48, 48, 48, 48, 48,
-/* 0x53f0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x5400 */  84, 82, 69, 57, 32, 48, 32, 67, 65, 76, 76, 84, 82, 69, 57, 10,
-/* 0x5410 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5420 */  32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 48, 32, 67, 84, 67, 76,
-/* 0x5430 */  69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5440 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 48,
-/* 0x5450 */  32, 67, 65, 76, 76, 84, 82, 49, 50, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5460 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72,
-/* 0x5470 */  82, 49, 49, 32, 48, 32, 67, 84, 66, 83, 72, 82, 49, 49, 10, 48,
-/* 0x5480 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5490 */  67, 84, 66, 82, 79, 82, 49, 49, 32, 48, 32, 67, 84, 66, 82, 79,
-/* 0x54a0 */  82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x54b0 */  32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 48, 32,
-/* 0x54c0 */  67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x54d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x54e0 */  49, 55, 32, 48, 32, 76, 69, 88, 69, 67, 48, 49, 55, 10, 48, 48,
-/* 0x54f0 */  48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5500 */  69, 88, 69, 67, 48, 48, 48, 32, 48, 32, 95,115,116, 97,114,116,
-/* 0x5510 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5520 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 78, 77, 82, 85, 10, 48,
-/* 0x5530 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5540 */  42, 85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,114, 95, 99,
-/* 0x5550 */ 116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x5560 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97,
-/* 0x5570 */  95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48,
-/* 0x5580 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x5590 */  85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,117, 95,108,101,
-/* 0x55a0 */ 110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x55b0 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,
-/* 0x55c0 */  99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x55d0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,
-/* 0x55e0 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 48,
-/* 0x55f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5600 */  42, 85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,114, 95,108,
-/* 0x5610 */ 101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5620 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x5630 */  69, 88, 69, 67, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5640 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5650 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5660 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x5670 */  32, 32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48, 50, 48, 10, 10,
-/* 0x5680 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5690 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 48, 57,
-/* 0x56a0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x56b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x56c0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x56d0 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x56e0 */  77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x56f0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 69, 88,
-/* 0x5700 */  69, 67, 48, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5710 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5720 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5730 */  50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5740 */  32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 10,
-/* 0x5750 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5760 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x5770 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5780 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5790 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x57a0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x57b0 */  50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x57c0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x57d0 */  91, 78, 50, 66, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x57e0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57f0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5800 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5810 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x5820 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5830 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65,
-/* 0x5840 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5850 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5860 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x5870 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5880 */  32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5890 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x58a0 */  82, 32, 91, 78, 50, 66, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70,
-/* 0x58b0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x58c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x58d0 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x58e0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x58f0 */  49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5900 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83,
-/* 0x5910 */  77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5920 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5930 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x5940 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5950 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76,
-/* 0x5960 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5970 */  70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 51, 48, 93, 58, 10,
-/* 0x5980 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5990 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x59a0 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x59b0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x59c0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x59d0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59e0 */  78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x59f0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5a00 */  32, 91, 78, 50, 66, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5a10 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5a20 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5a30 */  48, 48, 48, 48, 49, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5a40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 54,
-/* 0x5a50 */  48, 10, 48, 48, 48, 48, 48, 48, 50,102, 32, 82, 95, 51, 56, 54,
-/* 0x5a60 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x5a70 */  68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5a80 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5a90 */  50, 66, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5aa0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ab0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5ac0 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5ad0 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10,
-/* 0x5ae0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5af0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 52, 48,
-/* 0x5b00 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5b10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5b20 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x5b30 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5b40 */  50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x5b50 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5b60 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x5b70 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5b80 */  70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 54, 48, 93, 58, 10,
-/* 0x5b90 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5ba0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5bb0 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5bc0 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x5bd0 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5be0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5bf0 */  66, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5c00 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c10 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5c20 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5c30 */  32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48,
-/* 0x5c40 */  48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x5c50 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x5c60 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5c70 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65,
-/* 0x5c80 */  83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5c90 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ca0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32,
-/* 0x5cb0 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x5cc0 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5cd0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5ce0 */  79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 49, 48, 93, 58, 10, 79,
-/* 0x5cf0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5d00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5d10 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5d20 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x5d30 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5d40 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x5d50 */  70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5d60 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d70 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5d80 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5d90 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x5da0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5db0 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 50, 48, 93, 58,
-/* 0x5dc0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5dd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5de0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x5df0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x5e00 */  83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5e10 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5e20 */  50, 68, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5e30 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e40 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5e50 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5e60 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 10,
-/* 0x5e70 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5e80 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 51, 48,
-/* 0x5e90 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5eb0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x5ec0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5ed0 */  50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5ee0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5ef0 */  91, 78, 50, 68, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5f00 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f10 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5f20 */  48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5f30 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x5f40 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5f50 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x5f60 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5f70 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5f80 */  68, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5f90 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fa0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5fb0 */  48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5fc0 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x5fd0 */  48, 48, 48, 48, 50, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5fe0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 54,
-/* 0x5ff0 */  48, 10, 48, 48, 48, 48, 48, 48, 52, 51, 32, 82, 95, 51, 56, 54,
-/* 0x6000 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x6010 */  68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6020 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x6030 */  50, 68, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6040 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6050 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6060 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6070 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10,
-/* 0x6080 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6090 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 52, 48,
-/* 0x60a0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x60b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x60c0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x60d0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x60e0 */  50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x60f0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6100 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x6110 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6120 */  70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 54, 48, 93, 58, 10,
-/* 0x6130 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6140 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6150 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6160 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x6170 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6180 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x6190 */  68, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x61a0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x61b0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x61c0 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x61d0 */  32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48,
-/* 0x61e0 */  48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x61f0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x6200 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6210 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65,
-/* 0x6220 */  83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6230 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6240 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32,
-/* 0x6250 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x6260 */  32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x6270 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6280 */  79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 49, 48, 93, 58, 10, 79,
-/* 0x6290 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x62a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x62b0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x62c0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x62d0 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x62e0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x62f0 */  70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6300 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6310 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6320 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6330 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x6340 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6350 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 50, 48, 93, 58,
-/* 0x6360 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6370 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6380 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x6390 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x63a0 */  83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x63b0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x63c0 */  50, 69, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x63d0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63e0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x63f0 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6400 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 10,
-/* 0x6410 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6420 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 51, 48,
-/* 0x6430 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6440 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6450 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x6460 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6470 */  50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6480 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6490 */  91, 78, 50, 69, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x64a0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64b0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x64c0 */  48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x64d0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x64e0 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x64f0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x6500 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6510 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x6520 */  69, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6530 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6540 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6550 */  48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6560 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x6570 */  48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6580 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 53,
-/* 0x6590 */  48, 10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 51, 56, 54,
-/* 0x65a0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x65b0 */  68, 69, 67, 54, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x65c0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x65d0 */  50, 69, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x65e0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65f0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6600 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6610 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10,
-/* 0x6620 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6630 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 52, 48,
-/* 0x6640 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6650 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6660 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x6670 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6680 */  50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x6690 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x66a0 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x66b0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x66c0 */  70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 54, 48, 93, 58, 10,
-/* 0x66d0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x66e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x66f0 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6700 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x6710 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6720 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x6730 */  69, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6740 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6750 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6760 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6770 */  32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48,
-/* 0x6780 */  48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x6790 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x67a0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x67b0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65,
-/* 0x67c0 */  83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x67d0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x67e0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32,
-/* 0x67f0 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x6800 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x6810 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6820 */  79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58,
-/* 0x6830 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6840 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6850 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54,
-/* 0x6860 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x6870 */  97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48,
-/* 0x6880 */  48, 48, 48, 48, 48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x6890 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117,
-/* 0x68a0 */  95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95,
-/* 0x68b0 */  51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x68c0 */ 108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48,
-/* 0x68d0 */  48, 50, 97, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x68e0 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,
-/* 0x68f0 */ 114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6900 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x6910 */  69, 88, 69, 67, 48, 49, 54, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6920 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6930 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6940 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x6950 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 50, 10, 10,
-/* 0x6960 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6970 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 48, 48,
-/* 0x6980 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6990 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x69a0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x69b0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x69c0 */  88, 85, 78, 70, 48, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x69d0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x69e0 */  91, 76, 88, 77, 82, 85, 48, 48, 53, 93, 58, 10, 79, 70, 70, 83,
-/* 0x69f0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a00 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6a10 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x6a20 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 77, 82, 85, 10, 10, 82, 69,
-/* 0x6a30 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6a40 */  32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 49, 48, 93, 58,
-/* 0x6a50 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6a60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6a70 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x6a80 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85,
-/* 0x6a90 */  78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6aa0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x6ab0 */  88, 74, 67, 67, 48, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6ac0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ad0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6ae0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6af0 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10,
-/* 0x6b00 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6b10 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48, 50, 49,
-/* 0x6b20 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6b30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6b40 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x6b50 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x6b60 */  88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6b70 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6b80 */  91, 76, 88, 85, 78, 70, 51, 56, 56, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6b90 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ba0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6bb0 */  48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6bc0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48,
-/* 0x6bd0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6be0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 52,
-/* 0x6bf0 */  56, 55, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6c00 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c10 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x6c20 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c30 */  32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6c40 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6c50 */  82, 32, 91, 76, 88, 77, 82, 85, 48, 54, 53, 93, 58, 10, 79, 70,
-/* 0x6c60 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6c70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6c80 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6c90 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x6ca0 */  55, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6cb0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82,
-/* 0x6cc0 */  85, 48, 55, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6cd0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ce0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x6cf0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6d00 */  32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76,
-/* 0x6d10 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6d20 */  70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 57, 48, 93, 58, 10,
-/* 0x6d30 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6d40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6d50 */  10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6d60 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82,
-/* 0x6d70 */  85, 49, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6d80 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0x6d90 */  85, 78, 70, 48, 52, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6da0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6db0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6dc0 */  48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6dd0 */  32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82,
-/* 0x6de0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6df0 */  83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 52, 48, 93,
-/* 0x6e00 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6e10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6e20 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x6e30 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x6e40 */  77, 82, 85, 48, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6e50 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6e60 */  76, 88, 74, 67, 67, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6e70 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e80 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6e90 */  48, 48, 48, 55, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6ea0 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 74, 67, 67, 48, 49, 48, 10,
-/* 0x6eb0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6ec0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 65, 76, 76, 48,
-/* 0x6ed0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6ee0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6ef0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x6f00 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f10 */  76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6f20 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6f30 */  32, 91, 76, 88, 67, 74, 50, 77, 82, 85, 93, 58, 10, 79, 70, 70,
-/* 0x6f40 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6f50 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6f60 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6f70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x6f80 */  55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6f90 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 52,
-/* 0x6fa0 */  77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6fb0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6fc0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x6fd0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6fe0 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79,
-/* 0x6ff0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x7000 */  79, 82, 32, 91, 76, 88, 67, 74, 54, 77, 82, 85, 93, 58, 10, 79,
-/* 0x7010 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x7020 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7030 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7040 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 67, 74, 56,
-/* 0x7050 */  77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x7060 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67,
-/* 0x7070 */  74, 55, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7080 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7090 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x70a0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x70b0 */  32, 32, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85, 10, 10, 82, 69,
-/* 0x70c0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x70d0 */  32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 56, 77, 82, 85, 93, 58,
-/* 0x70e0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x70f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7100 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54,
-/* 0x7110 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85,
-/* 0x7120 */  78, 70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7130 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x7140 */  88, 85, 78, 70, 48, 51, 52, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7150 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7160 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7170 */  48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7180 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 48, 10, 10,
-/* 0x7190 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x71a0 */  68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 48,
-/* 0x71b0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x71c0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x71d0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x71e0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x71f0 */  99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7200 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7210 */  82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48, 93, 58, 10, 79,
-/* 0x7220 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x7230 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7240 */  48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7250 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0x7260 */  50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x7270 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,
-/* 0x7280 */ 111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7290 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x72a0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x72b0 */  48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x72c0 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10,
-/* 0x72d0 */  48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x72e0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0x72f0 */  50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95,
-/* 0x7300 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7310 */  99,116,111,107, 51, 50, 46, 52, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7320 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7330 */  82, 32, 91, 99,116,111,107, 51, 50, 46, 51, 48, 93, 58, 10, 79,
-/* 0x7340 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x7350 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7360 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7370 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0x7380 */  50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 57, 32, 82, 95,
-/* 0x7390 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x73a0 */  99,116,111,107, 51, 50, 46, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x73b0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x73c0 */  82, 32, 91, 99,116,111,107, 51, 50, 46, 52, 48, 93, 58, 10, 79,
-/* 0x73d0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x73e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x73f0 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7400 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0x7410 */  50, 46, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x7420 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65,
-/* 0x7430 */  76, 76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x7440 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7450 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7460 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x7470 */  32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,
-/* 0x7480 */ 116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7490 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76,
-/* 0x74a0 */  69, 86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x74b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x74d0 */  32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74e0 */  32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48,
-/* 0x74f0 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7500 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48,
-/* 0x7510 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7520 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84,
-/* 0x7530 */  82, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7540 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7550 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x7560 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7570 */  32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79,
-/* 0x7580 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x7590 */  79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10, 79,
-/* 0x75a0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x75b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x75c0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x75d0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x75e0 */ 114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x75f0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7600 */  32, 91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70, 70,
-/* 0x7610 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7620 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7630 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7640 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x7650 */  51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7660 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69,
-/* 0x7670 */  86, 69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7680 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7690 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x76a0 */  82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x76b0 */  32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48,
-/* 0x76c0 */  48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x76d0 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49,
-/* 0x76e0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x76f0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x7700 */  49, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x7710 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7720 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82,
-/* 0x7730 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7740 */  32, 67, 65, 76, 76, 84, 82, 49, 48, 10
+/* 0x1ad0 */ 187,  0, 16, 64,  0,170,  0,  0,  0,178,  0,  0,  0, 95,  0,  0,
+/* 0x1ae0 */   0,140,  6,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  5,  0,  0,
+/* 0x1af0 */   0,  0,  0,  0,  0,  9,  0,  0,  0, 57,  0,  0,  0,  5,  0,  0,
+/* 0x1b00 */   0,  0,  0,  0,  0, 18,  0,  0,  0, 62,  0,  0,  0, 14,  0,  0,
+/* 0x1b10 */   0,  0,  0,  0,  0, 27,  0,  0,  0, 76,  0,  0,  0,  3,  0,  0,
+/* 0x1b20 */   0,  0,  0,  0,  0, 36,  0,  0,  0, 79,  0,  0,  0,  2,  0,  0,
+/* 0x1b30 */   0,  0,  0,  0,  0, 45,  0,  0,  0, 81,  0,  0,  0,  6,  0,  0,
+/* 0x1b40 */   0,  0,  0,  0,  0, 54,  0,  0,  0, 87,  0,  0,  0, 11,  0,  0,
+/* 0x1b50 */   0,  0,  0,  0,  0, 63,  0,  0,  0, 98,  0,  0,  0,  5,  0,  0,
+/* 0x1b60 */   0,  0,  0,  0,  0, 72,  0,  0,  0,103,  0,  0,  0,  9,  0,  0,
+/* 0x1b70 */   0,  0,  0,  0,  0, 81,  0,  0,  0,112,  0,  0,  0, 13,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0,  0, 90,  0,  0,  0,125,  0,  0,  0, 13,  0,  0,
+/* 0x1b90 */   0,  0,  0,  0,  0, 99,  0,  0,  0,138,  0,  0,  0, 15,  0,  0,
+/* 0x1ba0 */   0,  0,  0,  0,  0,108,  0,  0,  0,153,  0,  0,  0, 62,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0,  0,117,  0,  0,  0,215,  0,  0,  0, 13,  0,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  0,126,  0,  0,  0,228,  0,  0,  0, 15,  0,  0,
+/* 0x1bd0 */   0,  0,  0,  0,  0,135,  0,  0,  0,243,  0,  0,  0,  2,  0,  0,
+/* 0x1be0 */   0,  0,  0,  0,  0,144,  0,  0,  0,245,  0,  0,  0,  3,  0,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  0,153,  0,  0,  0,248,  0,  0,  0,  9,  0,  0,
+/* 0x1c00 */   0,  0,  0,  0,  0,162,  0,  0,  0,  1,  1,  0,  0, 12,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0,  0,171,  0,  0,  0, 13,  1,  0,  0, 25,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,  0,180,  0,  0,  0, 38,  1,  0,  0, 22,  0,  0,
+/* 0x1c30 */   0,  0,  0,  0,  0,189,  0,  0,  0, 60,  1,  0,  0,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0,  0,198,  0,  0,  0, 60,  1,  0,  0,  3,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0,  0,207,  0,  0,  0, 63,  1,  0,  0,  2,  0,  0,
+/* 0x1c60 */   0,  0,  0,  0,  0,216,  0,  0,  0, 65,  1,  0,  0,  6,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0,  0,225,  0,  0,  0, 71,  1,  0,  0, 11,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0,  0,234,  0,  0,  0, 82,  1,  0,  0,  5,  0,  0,
+/* 0x1c90 */   0,  0,  0,  0,  0,243,  0,  0,  0, 87,  1,  0,  0,  9,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0,  0,252,  0,  0,  0, 96,  1,  0,  0, 13,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  0,  5,  1,  0,  0,109,  1,  0,  0, 13,  0,  0,
+/* 0x1cc0 */   0,  0,  0,  0,  0, 14,  1,  0,  0,122,  1,  0,  0, 15,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  0, 23,  1,  0,  0,137,  1,  0,  0, 82,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  0, 32,  1,  0,  0,219,  1,  0,  0, 13,  0,  0,
+/* 0x1cf0 */   0,  0,  0,  0,  0, 41,  1,  0,  0,232,  1,  0,  0, 15,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,  0, 50,  1,  0,  0,247,  1,  0,  0,  2,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,  0, 59,  1,  0,  0,249,  1,  0,  0,  3,  0,  0,
+/* 0x1d20 */   0,  0,  0,  0,  0, 68,  1,  0,  0,252,  1,  0,  0,  9,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,  0, 77,  1,  0,  0,  5,  2,  0,  0, 12,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,  0, 86,  1,  0,  0, 17,  2,  0,  0, 25,  0,  0,
+/* 0x1d50 */   0,  0,  0,  0,  0, 95,  1,  0,  0, 42,  2,  0,  0, 22,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,  0,104,  1,  0,  0, 64,  2,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,  0,113,  1,  0,  0, 64,  2,  0,  0,  3,  0,  0,
+/* 0x1d80 */   0,  0,  0,  0,  0,122,  1,  0,  0, 67,  2,  0,  0,  2,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0,  0,131,  1,  0,  0, 69,  2,  0,  0,  6,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0,  0,140,  1,  0,  0, 75,  2,  0,  0, 11,  0,  0,
+/* 0x1db0 */   0,  0,  0,  0,  0,149,  1,  0,  0, 86,  2,  0,  0,  5,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,  0,158,  1,  0,  0, 91,  2,  0,  0,  9,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  0,167,  1,  0,  0,100,  2,  0,  0, 13,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0,  0,176,  1,  0,  0,113,  2,  0,  0, 13,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0,  0,185,  1,  0,  0,126,  2,  0,  0, 15,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,  0,194,  1,  0,  0,141,  2,  0,  0, 95,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0,  0,203,  1,  0,  0,236,  2,  0,  0, 13,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,  0,212,  1,  0,  0,249,  2,  0,  0, 15,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,  0,221,  1,  0,  0,  8,  3,  0,  0,  2,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0,  0,230,  1,  0,  0, 10,  3,  0,  0,  3,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,  0,239,  1,  0,  0, 13,  3,  0,  0,  9,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,248,  1,  0,  0, 22,  3,  0,  0, 12,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0,  0,  1,  2,  0,  0, 34,  3,  0,  0, 25,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0,  0, 10,  2,  0,  0, 59,  3,  0,  0, 22,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,  0, 19,  2,  0,  0, 81,  3,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0,  0, 28,  2,  0,  0, 81,  3,  0,  0, 46,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,  0, 39,  2,  0,  0,127,  3,  0,  0, 72,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  0, 50,  2,  0,  0,199,  3,  0,  0,134, 10,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  0, 61,  2,  0,  0, 77, 14,  0,  0,134, 10,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  0, 72,  2,  0,  0,211, 24,  0,  0, 26,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  0, 83,  2,  0,  0,237, 24,  0,  0, 32,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0,  0, 92,  2,  0,  0, 13, 25,  0,  0,  6,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,  0,101,  2,  0,  0, 19, 25,  0,  0,  1,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,  0,110,  2,  0,  0, 20, 25,  0,  0,  5,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0,  0,119,  2,  0,  0, 25, 25,  0,  0,  2,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,  0,128,  2,  0,  0, 27, 25,  0,  0,  5,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,  0,137,  2,  0,  0, 32, 25,  0,  0,  2,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0,  0,146,  2,  0,  0, 34, 25,  0,  0,  5,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,  0,155,  2,  0,  0, 39, 25,  0,  0,  7,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,  0,164,  2,  0,  0, 46, 25,  0,  0,  7,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0,  0,173,  2,  0,  0, 53, 25,  0,  0,  4,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  0,182,  2,  0,  0, 57, 25,  0,  0,  5,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,191,  2,  0,  0, 62, 25,  0,  0,  3,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0,  0,200,  2,  0,  0, 65, 25,  0,  0,  3,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,  0,209,  2,  0,  0, 68, 25,  0,  0,  2,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,218,  2,  0,  0, 70, 25,  0,  0,  2,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0,  0,227,  2,  0,  0, 72, 25,  0,  0,  5,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,  0,236,  2,  0,  0, 77, 25,  0,  0,  7,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  0,245,  2,  0,  0, 84, 25,  0,  0,  2,  0,  0,
+/* 0x2020 */   0,  0,  0,  0,  0,254,  2,  0,  0, 86, 25,  0,  0,  1,  0,  0,
+/* 0x2030 */   0,  0,  0,  0,  0,  7,  3,  0,  0, 87, 25,  0,  0,  9,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  0, 16,  3,  0,  0, 96, 25,  0,  0,  3,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,  0, 25,  3,  0,  0, 99, 25,  0,  0,  4,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,  0, 34,  3,  0,  0,103, 25,  0,  0,  2,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,  0, 43,  3,  0,  0,105, 25,  0,  0,  5,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,  0, 52,  3,  0,  0,110, 25,  0,  0,  2,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,  0, 61,  3,  0,  0,112, 25,  0,  0,  1,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,  0, 70,  3,  0,  0,113, 25,  0,  0,  2,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,  0, 79,  3,  0,  0,115, 25,  0,  0,  4,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  0, 88,  3,  0,  0,119, 25,  0,  0,  8,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,  0, 97,  3,  0,  0,127, 25,  0,  0,  3,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0,  0,106,  3,  0,  0,130, 25,  0,  0,  2,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,  0,115,  3,  0,  0,132, 25,  0,  0,  6,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,  0,124,  3,  0,  0,138, 25,  0,  0,  3,  0,  0,
+/* 0x2110 */   0,  0,  0,  0,  0,133,  3,  0,  0,141, 25,  0,  0,  2,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,  0,142,  3,  0,  0,143, 25,  0,  0,  1,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,  0,151,  3,  0,  0,144, 25,  0,  0,  2,  0,  0,
+/* 0x2140 */   0,  0,  0,  0,  0,160,  3,  0,  0,146, 25,  0,  0,  4,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,  0,169,  3,  0,  0,150, 25,  0,  0, 11,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  0,178,  3,  0,  0,161, 25,  0,  0,  2,  0,  0,
+/* 0x2170 */   0,  0,  0,  0,  0,187,  3,  0,  0,163, 25,  0,  0,  1,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,  0,196,  3,  0,  0,164, 25,  0,  0,  2,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,  0,205,  3,  0,  0,166, 25,  0,  0,  4,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0,  0,214,  3,  0,  0,170, 25,  0,  0, 16,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0,  0,223,  3,  0,  0,186, 25,  0,  0,  5,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0,  0,232,  3,  0,  0,191, 25,  0,  0,  3,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0,  0,241,  3,  0,  0,194, 25,  0,  0,  2,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,  0,250,  3,  0,  0,196, 25,  0,  0,  7,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,  0,  3,  4,  0,  0,203, 25,  0,  0,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0,  0, 12,  4,  0,  0,203, 25,  0,  0,  1,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,  0, 21,  4,  0,  0,204, 25,  0,  0,  2,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,  0, 30,  4,  0,  0,206, 25,  0,  0,  2,  0,  0,
+/* 0x2230 */   0,  0,  0,  0,  0, 39,  4,  0,  0,208, 25,  0,  0,  6,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,  0, 48,  4,  0,  0,214, 25,  0,  0,  3,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,  0, 57,  4,  0,  0,217, 25,  0,  0,  2,  0,  0,
+/* 0x2260 */   0,  0,  0,  0,  0, 66,  4,  0,  0,219, 25,  0,  0,  2,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,  0, 75,  4,  0,  0,221, 25,  0,  0,  1,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,  0, 84,  4,  0,  0,222, 25,  0,  0,  2,  0,  0,
+/* 0x2290 */   0,  0,  0,  0,  0, 93,  4,  0,  0,224, 25,  0,  0,  2,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0,  0,102,  4,  0,  0,226, 25,  0,  0,  1,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0,  0,111,  4,  0,  0,227, 25,  0,  0,  2,  0,  0,
+/* 0x22c0 */   0,  0,  0,  0,  0,120,  4,  0,  0,229, 25,  0,  0,  6,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0,  0,129,  4,  0,  0,235, 25,  0,  0,  8,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0,  0,138,  4,  0,  0,243, 25,  0,  0,  2,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0,  0,147,  4,  0,  0,245, 25,  0,  0,  3,  0,  0,
+/* 0x2300 */   0,  0,  0,  0,  0,156,  4,  0,  0,248, 25,  0,  0,  3,  0,  0,
+/* 0x2310 */   0,  0,  0,  0,  0,165,  4,  0,  0,251, 25,  0,  0,  2,  0,  0,
+/* 0x2320 */   0,  0,  0,  0,  0,174,  4,  0,  0,253, 25,  0,  0,  3,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,  0,183,  4,  0,  0,  0, 26,  0,  0,  2,  0,  0,
+/* 0x2340 */   0,  0,  0,  0,  0,192,  4,  0,  0,  2, 26,  0,  0,  2,  0,  0,
+/* 0x2350 */   0,  0,  0,  0,  0,201,  4,  0,  0,  4, 26,  0,  0,  2,  0,  0,
+/* 0x2360 */   0,  0,  0,  0,  0,210,  4,  0,  0,  6, 26,  0,  0,  2,  0,  0,
+/* 0x2370 */   0,  0,  0,  0,  0,219,  4,  0,  0,  8, 26,  0,  0,  3,  0,  0,
+/* 0x2380 */   0,  0,  0,  0,  0,228,  4,  0,  0, 11, 26,  0,  0,  5,  0,  0,
+/* 0x2390 */   0,  0,  0,  0,  0,237,  4,  0,  0, 16, 26,  0,  0,  2,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0,  0,246,  4,  0,  0, 18, 26,  0,  0,  5,  0,  0,
+/* 0x23b0 */   0,  0,  0,  0,  0,255,  4,  0,  0, 23, 26,  0,  0,  5,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0,  0,  8,  5,  0,  0, 28, 26,  0,  0,  5,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,  0, 17,  5,  0,  0, 33, 26,  0,  0,  6,  0,  0,
+/* 0x23e0 */   0,  0,  0,  0,  0, 26,  5,  0,  0, 39, 26,  0,  0,  1,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,  0, 35,  5,  0,  0, 40, 26,  0,  0,  6,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,  0, 44,  5,  0,  0, 46, 26,  0,  0,  7,  0,  0,
+/* 0x2410 */   0,  0,  0,  0,  0, 54,  5,  0,  0, 53, 26,  0,  0, 14,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,  0, 64,  5,  0,  0, 67, 26,  0,  0, 32,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,  0, 74,  5,  0,  0, 99, 26,  0,  0, 10,  0,  0,
+/* 0x2440 */   0,  0,  0,  0,  0, 84,  5,  0,  0,109, 26,  0,  0,  5,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,  0, 94,  5,  0,  0,114, 26,  0,  0, 16,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,  0,103,  5,  0,  0,130, 26,  0,  0,  5,  0,  0,
+/* 0x2470 */   0,  0,  0,  0,  0,112,  5,  0,  0,135, 26,  0,  0,  5,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,  0,121,  5,  0,  0,140, 26,  0,  0,  4,  0,  0,
+/* 0x2490 */   0,  0,  0,  0,  0,130,  5,  0,  0,144, 26,  0,  0,  2,  0,  0,
+/* 0x24a0 */   0,  0,  0,  0,  0,139,  5,  0,  0,146, 26,  0,  0,  5,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0,  0,148,  5,  0,  0,151, 26,  0,  0, 16,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0,  0,157,  5,  0,  0,167, 26,  0,  0,  5,  0,  0,
+/* 0x24d0 */   0,  0,  0,  0,  0,166,  5,  0,  0,172, 26,  0,  0,  2,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,  0,175,  5,  0,  0,174, 26,  0,  0,  2,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0,  0,184,  5,  0,  0,176, 26,  0,  0,  4,  0,  0,
+/* 0x2500 */   0,  0,  0,  0,  0,193,  5,  0,  0,180, 26,  0,  0,  5,  0,  0,
+/* 0x2510 */   0,  0,  0,  0,  0,202,  5,  0,  0,185, 26,  0,  0,  2,  0,  0,
+/* 0x2520 */   0,  0,  0,  0,  0,211,  5,  0,  0,187, 26,  0,  0,  4,  0,  0,
+/* 0x2530 */   0,  0,  0,  0,  0,220,  5,  0,  0,191, 26,  0,  0,  2,  0,  0,
+/* 0x2540 */   0,  0,  0,  0,  0,229,  5,  0,  0,193, 26,  0,  0,  5,  0,  0,
+/* 0x2550 */   0,  0,  0,  0,  0,238,  5,  0,  0,198, 26,  0,  0,  7,  0,  0,
+/* 0x2560 */   0,  0,  0,  0,  0,247,  5,  0,  0,205, 26,  0,  0,  2,  0,  0,
+/* 0x2570 */   0,  0,  0,  0,  0,  0,  6,  0,  0,207, 26,  0,  0,  6,  0,  0,
+/* 0x2580 */   0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2590 */   0, 45,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,
+/* 0x25a0 */   0,  6,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  9,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,  0,108,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,
+/* 0x25c0 */   0,153,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,
+/* 0x25d0 */   0, 20,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 21,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,  0,198,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,
+/* 0x25f0 */   0,216,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,
+/* 0x2600 */   0, 25,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 28,  0,  0,
+/* 0x2610 */   0,  0,  0,  0,  0, 23,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,
+/* 0x2620 */   0, 68,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,
+/* 0x2630 */   0, 39,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 40,  0,  0,
+/* 0x2640 */   0,  0,  0,  0,  0,113,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,
+/* 0x2650 */   0,131,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,
+/* 0x2660 */   0, 44,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 47,  0,  0,
+/* 0x2670 */   0,  0,  0,  0,  0,194,  1,  0,  0, 50,  0,  0,  0,  0,  0,  0,
+/* 0x2680 */   0,239,  1,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,
+/* 0x2690 */   0, 58,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 59,  0,  0,
+/* 0x26a0 */   0,  0,  0,  0,  0,182,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,
+/* 0x26b0 */   0,191,  2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,245,  2,  0,
+/* 0x26c0 */   0, 83,  0,  0,  0,  0,  0,  0,  0, 88,  3,  0,  0, 94,  0,  0,
+/* 0x26d0 */   0,  0,  0,  0,  0,214,  3,  0,  0,108,  0,  0,  0,  0,  0,  0,
+/* 0x26e0 */   0,223,  3,  0,  0,109,  0,  0,  0,  0,  0,  0,  0,  3,  4,  0,
+/* 0x26f0 */   0,113,  0,  0,  0,  0,  0,  0,  0, 84,  4,  0,  0,122,  0,  0,
+/* 0x2700 */   0,  0,  0,  0,  0,120,  4,  0,  0,126,  0,  0,  0,  0,  0,  0,
+/* 0x2710 */   0,219,  4,  0,  0,137,  0,  0,  0,  0,  0,  0,  0,228,  4,  0,
+/* 0x2720 */   0,138,  0,  0,  0,  0,  0,  0,  0, 44,  5,  0,  0,146,  0,  0,
+/* 0x2730 */   0,  0,  0,  0,  0, 54,  5,  0,  0,147,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */   0, 64,  5,  0,  0,148,  0,  0,  0,  0,  0,  0,  0, 84,  5,  0,
+/* 0x2750 */   0,150,  0,  0,  0,  0,  0,  0,  0, 94,  5,  0,  0,151,  0,  0,
+/* 0x2760 */   0,  0,  0,  0,  0,157,  5,  0,  0,158,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */   0,184,  5,  0,  0,161,  0,  0,  0,  0,  0,  0,  0,238,  5,  0,
+/* 0x2780 */   0,167,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,169,  0,  0,
+/* 0x2790 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27a0 */   0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,
+/* 0x27b0 */   0,  2,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  4,  0,  0,
+/* 0x27c0 */   0,  0,  0,  0,  0, 63,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,
+/* 0x27d0 */   0, 72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,
+/* 0x27e0 */   0, 10,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 11,  0,  0,
+/* 0x27f0 */   0,  0,  0,  0,  0,117,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,
+/* 0x2800 */   0,126,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,
+/* 0x2810 */   0, 15,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0, 16,  0,  0,
+/* 0x2820 */   0,  0,  0,  0,  0,162,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,
+/* 0x2830 */   0,171,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,
+/* 0x2840 */   0, 23,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 26,  0,  0,
+/* 0x2850 */   0,  0,  0,  0,  0,243,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,
+/* 0x2860 */   0,  5,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,
+/* 0x2870 */   0, 30,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0, 32,  0,  0,
+/* 0x2880 */   0,  0,  0,  0,  0, 41,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,
+/* 0x2890 */   0, 50,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,
+/* 0x28a0 */   0, 35,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0, 37,  0,  0,
+/* 0x28b0 */   0,  0,  0,  0,  0, 86,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,
+/* 0x28c0 */   0,122,  1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,
+/* 0x28d0 */   0, 45,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 46,  0,  0,
+/* 0x28e0 */   0,  0,  0,  0,  0,176,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */   0,185,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,
+/* 0x2900 */   0, 51,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0, 52,  0,  0,
+/* 0x2910 */   0,  0,  0,  0,  0,221,  1,  0,  0, 53,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */   0,230,  1,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,
+/* 0x2930 */   0, 56,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 57,  0,  0,
+/* 0x2940 */   0,  0,  0,  0,  0, 28,  2,  0,  0, 60,  0,  0,  0,  0,  0,  0,
+/* 0x2950 */   0, 39,  2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0, 50,  2,  0,
+/* 0x2960 */   0, 62,  0,  0,  0,  0,  0,  0,  0, 61,  2,  0,  0, 63,  0,  0,
+/* 0x2970 */   0,  0,  0,  0,  0, 72,  2,  0,  0, 64,  0,  0,  0,  0,  0,  0,
+/* 0x2980 */   0, 83,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0, 92,  2,  0,
+/* 0x2990 */   0, 66,  0,  0,  0,  0,  0,  0,  0,101,  2,  0,  0, 67,  0,  0,
+/* 0x29a0 */   0,  0,  0,  0,  0,110,  2,  0,  0, 68,  0,  0,  0,  0,  0,  0,
+/* 0x29b0 */   0,119,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,128,  2,  0,
+/* 0x29c0 */   0, 70,  0,  0,  0,  0,  0,  0,  0,137,  2,  0,  0, 71,  0,  0,
+/* 0x29d0 */   0,  0,  0,  0,  0,146,  2,  0,  0, 72,  0,  0,  0,  0,  0,  0,
+/* 0x29e0 */   0,155,  2,  0,  0, 73,  0,  0,  0,  0,  0,  0,  0,164,  2,  0,
+/* 0x29f0 */   0, 74,  0,  0,  0,  0,  0,  0,  0,173,  2,  0,  0, 75,  0,  0,
+/* 0x2a00 */   0,  0,  0,  0,  0,200,  2,  0,  0, 78,  0,  0,  0,  0,  0,  0,
+/* 0x2a10 */   0,209,  2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,218,  2,  0,
+/* 0x2a20 */   0, 80,  0,  0,  0,  0,  0,  0,  0,227,  2,  0,  0, 81,  0,  0,
+/* 0x2a30 */   0,  0,  0,  0,  0,236,  2,  0,  0, 82,  0,  0,  0,  0,  0,  0,
+/* 0x2a40 */   0,254,  2,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,  7,  3,  0,
+/* 0x2a50 */   0, 85,  0,  0,  0,  0,  0,  0,  0, 16,  3,  0,  0, 86,  0,  0,
+/* 0x2a60 */   0,  0,  0,  0,  0, 25,  3,  0,  0, 87,  0,  0,  0,  0,  0,  0,
+/* 0x2a70 */   0, 34,  3,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0, 43,  3,  0,
+/* 0x2a80 */   0, 89,  0,  0,  0,  0,  0,  0,  0, 52,  3,  0,  0, 90,  0,  0,
+/* 0x2a90 */   0,  0,  0,  0,  0, 61,  3,  0,  0, 91,  0,  0,  0,  0,  0,  0,
+/* 0x2aa0 */   0, 70,  3,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0, 79,  3,  0,
+/* 0x2ab0 */   0, 93,  0,  0,  0,  0,  0,  0,  0, 97,  3,  0,  0, 95,  0,  0,
+/* 0x2ac0 */   0,  0,  0,  0,  0,106,  3,  0,  0, 96,  0,  0,  0,  0,  0,  0,
+/* 0x2ad0 */   0,115,  3,  0,  0, 97,  0,  0,  0,  0,  0,  0,  0,124,  3,  0,
+/* 0x2ae0 */   0, 98,  0,  0,  0,  0,  0,  0,  0,133,  3,  0,  0, 99,  0,  0,
+/* 0x2af0 */   0,  0,  0,  0,  0,142,  3,  0,  0,100,  0,  0,  0,  0,  0,  0,
+/* 0x2b00 */   0,151,  3,  0,  0,101,  0,  0,  0,  0,  0,  0,  0,160,  3,  0,
+/* 0x2b10 */   0,102,  0,  0,  0,  0,  0,  0,  0,169,  3,  0,  0,103,  0,  0,
+/* 0x2b20 */   0,  0,  0,  0,  0,178,  3,  0,  0,104,  0,  0,  0,  0,  0,  0,
+/* 0x2b30 */   0,187,  3,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,196,  3,  0,
+/* 0x2b40 */   0,106,  0,  0,  0,  0,  0,  0,  0,205,  3,  0,  0,107,  0,  0,
+/* 0x2b50 */   0,  0,  0,  0,  0,232,  3,  0,  0,110,  0,  0,  0,  0,  0,  0,
+/* 0x2b60 */   0,241,  3,  0,  0,111,  0,  0,  0,  0,  0,  0,  0,250,  3,  0,
+/* 0x2b70 */   0,112,  0,  0,  0,  0,  0,  0,  0, 12,  4,  0,  0,114,  0,  0,
+/* 0x2b80 */   0,  0,  0,  0,  0, 21,  4,  0,  0,115,  0,  0,  0,  0,  0,  0,
+/* 0x2b90 */   0, 30,  4,  0,  0,116,  0,  0,  0,  0,  0,  0,  0, 39,  4,  0,
+/* 0x2ba0 */   0,117,  0,  0,  0,  0,  0,  0,  0, 48,  4,  0,  0,118,  0,  0,
+/* 0x2bb0 */   0,  0,  0,  0,  0, 57,  4,  0,  0,119,  0,  0,  0,  0,  0,  0,
+/* 0x2bc0 */   0, 66,  4,  0,  0,120,  0,  0,  0,  0,  0,  0,  0, 75,  4,  0,
+/* 0x2bd0 */   0,121,  0,  0,  0,  0,  0,  0,  0, 93,  4,  0,  0,123,  0,  0,
+/* 0x2be0 */   0,  0,  0,  0,  0,102,  4,  0,  0,124,  0,  0,  0,  0,  0,  0,
+/* 0x2bf0 */   0,111,  4,  0,  0,125,  0,  0,  0,  0,  0,  0,  0,129,  4,  0,
+/* 0x2c00 */   0,127,  0,  0,  0,  0,  0,  0,  0,138,  4,  0,  0,128,  0,  0,
+/* 0x2c10 */   0,  0,  0,  0,  0,147,  4,  0,  0,129,  0,  0,  0,  0,  0,  0,
+/* 0x2c20 */   0,156,  4,  0,  0,130,  0,  0,  0,  0,  0,  0,  0,165,  4,  0,
+/* 0x2c30 */   0,131,  0,  0,  0,  0,  0,  0,  0,174,  4,  0,  0,132,  0,  0,
+/* 0x2c40 */   0,  0,  0,  0,  0,183,  4,  0,  0,133,  0,  0,  0,  0,  0,  0,
+/* 0x2c50 */   0,192,  4,  0,  0,134,  0,  0,  0,  0,  0,  0,  0,201,  4,  0,
+/* 0x2c60 */   0,135,  0,  0,  0,  0,  0,  0,  0,210,  4,  0,  0,136,  0,  0,
+/* 0x2c70 */   0,  0,  0,  0,  0,237,  4,  0,  0,139,  0,  0,  0,  0,  0,  0,
+/* 0x2c80 */   0,246,  4,  0,  0,140,  0,  0,  0,  0,  0,  0,  0,255,  4,  0,
+/* 0x2c90 */   0,141,  0,  0,  0,  0,  0,  0,  0,  8,  5,  0,  0,142,  0,  0,
+/* 0x2ca0 */   0,  0,  0,  0,  0, 17,  5,  0,  0,143,  0,  0,  0,  0,  0,  0,
+/* 0x2cb0 */   0, 26,  5,  0,  0,144,  0,  0,  0,  0,  0,  0,  0, 35,  5,  0,
+/* 0x2cc0 */   0,145,  0,  0,  0,  0,  0,  0,  0, 74,  5,  0,  0,149,  0,  0,
+/* 0x2cd0 */   0,  0,  0,  0,  0,103,  5,  0,  0,152,  0,  0,  0,  0,  0,  0,
+/* 0x2ce0 */   0,112,  5,  0,  0,153,  0,  0,  0,  0,  0,  0,  0,121,  5,  0,
+/* 0x2cf0 */   0,154,  0,  0,  0,  0,  0,  0,  0,130,  5,  0,  0,155,  0,  0,
+/* 0x2d00 */   0,  0,  0,  0,  0,139,  5,  0,  0,156,  0,  0,  0,  0,  0,  0,
+/* 0x2d10 */   0,148,  5,  0,  0,157,  0,  0,  0,  0,  0,  0,  0,166,  5,  0,
+/* 0x2d20 */   0,159,  0,  0,  0,  0,  0,  0,  0,175,  5,  0,  0,160,  0,  0,
+/* 0x2d30 */   0,  0,  0,  0,  0,193,  5,  0,  0,162,  0,  0,  0,  0,  0,  0,
+/* 0x2d40 */   0,202,  5,  0,  0,163,  0,  0,  0,  0,  0,  0,  0,211,  5,  0,
+/* 0x2d50 */   0,164,  0,  0,  0,  0,  0,  0,  0,220,  5,  0,  0,165,  0,  0,
+/* 0x2d60 */   0,  0,  0,  0,  0,229,  5,  0,  0,166,  0,  0,  0,  0,  0,  0,
+/* 0x2d70 */   0,247,  5,  0,  0,168,  0,  0,  0,  0,  0,  0,  0,  9,  6,  0,
+/* 0x2d80 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  6,  0,  0,171,  0,  0,
+/* 0x2d90 */   0,173,222,173,222, 21,  6,  0,  0,171,  0,  0,  0,173,222,173,
+/* 0x2da0 */ 222, 32,  6,  0,  0,171,  0,  0,  0,173,222,173,222, 50,  6,  0,
+/* 0x2db0 */   0,171,  0,  0,  0,173,222,173,222, 61,  6,  0,  0,171,  0,  0,
+/* 0x2dc0 */   0,173,222,173,222, 72,  6,  0,  0,171,  0,  0,  0,173,222,173,
+/* 0x2dd0 */ 222, 88,  6,  0,  0,171,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x2de0 */   0,  1,  0,  0,  0,102,  6,  0,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x2df0 */   0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,113,  6,  0,
+/* 0x2e00 */   0, 16,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+/* 0x2e10 */   0,  2,  0,  0,  0,122,  6,  0,  0, 21,  6,  0,  0,  0,  0,  0,
+/* 0x2e20 */   0,  0,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,
+/* 0x2e30 */   0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
+/* 0x2e40 */   0,  1,  0,  0,  0,130,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,
+/* 0x2e50 */   0,  0,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,
+/* 0x2e60 */   0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,
+/* 0x2e70 */   0,  3,  0,  0,  0,130,  6,  0,  0, 45,  0,  0,  0,  0,  0,  0,
+/* 0x2e80 */   0,  0,  0,  0,  0, 10,  0,  0,  0, 12,  0,  0,  0,130,  6,  0,
+/* 0x2e90 */   0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,
+/* 0x2ea0 */   0,  3,  0,  0,  0,130,  6,  0,  0, 81,  0,  0,  0,  0,  0,  0,
+/* 0x2eb0 */   0,  0,  0,  0,  0, 11,  0,  0,  0, 14,  0,  0,  0,130,  6,  0,
+/* 0x2ec0 */   0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,
+/* 0x2ed0 */   0, 17,  0,  0,  0,130,  6,  0,  0,189,  0,  0,  0,  0,  0,  0,
+/* 0x2ee0 */   0,  0,  0,  0,  0, 12,  0,  0,  0, 47,  0,  0,  0,130,  6,  0,
+/* 0x2ef0 */   0,153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,
+/* 0x2f00 */   0, 12,  0,  0,  0,130,  6,  0,  0,108,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */   0,  0,  0,  0,  0, 14,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,
+/* 0x2f20 */   0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,
+/* 0x2f30 */   0, 14,  0,  0,  0,130,  6,  0,  0,108,  0,  0,  0,  0,  0,  0,
+/* 0x2f40 */   0,  0,  0,  0,  0, 18,  0,  0,  0,  8,  0,  0,  0,102,  6,  0,
+/* 0x2f50 */   0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,
+/* 0x2f60 */   0, 10,  0,  0,  0,130,  6,  0,  0,180,  0,  0,  0,  0,  0,  0,
+/* 0x2f70 */   0,  0,  0,  0,  0, 19,  0,  0,  0, 21,  0,  0,  0,102,  6,  0,
+/* 0x2f80 */   0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,
+/* 0x2f90 */   0, 18,  0,  0,  0,102,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,
+/* 0x2fa0 */   0,  0,  0,  0,  0, 22,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,
+/* 0x2fb0 */   0,225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,
+/* 0x2fc0 */   0,  1,  0,  0,  0,130,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,
+/* 0x2fd0 */   0,  0,  0,  0,  0, 26,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,
+/* 0x2fe0 */   0,198,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,
+/* 0x2ff0 */   0,  3,  0,  0,  0,130,  6,  0,  0,216,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */   0,  0,  0,  0,  0, 29,  0,  0,  0, 12,  0,  0,  0,130,  6,  0,
+/* 0x3010 */   0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,
+/* 0x3020 */   0,  5,  0,  0,  0,130,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,
+/* 0x3030 */   0,  0,  0,  0,  0, 30,  0,  0,  0, 14,  0,  0,  0,130,  6,  0,
+/* 0x3040 */   0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,
+/* 0x3050 */   0, 15,  0,  0,  0,130,  6,  0,  0,252,  0,  0,  0,  0,  0,  0,
+/* 0x3060 */   0,  0,  0,  0,  0, 31,  0,  0,  0, 33,  0,  0,  0,130,  6,  0,
+/* 0x3070 */   0,104,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,
+/* 0x3080 */   0, 67,  0,  0,  0,130,  6,  0,  0, 68,  1,  0,  0,  0,  0,  0,
+/* 0x3090 */   0,  0,  0,  0,  0, 32,  0,  0,  0, 12,  0,  0,  0,130,  6,  0,
+/* 0x30a0 */   0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,
+/* 0x30b0 */   0,  3,  0,  0,  0,130,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,
+/* 0x30c0 */   0,  0,  0,  0,  0, 33,  0,  0,  0, 14,  0,  0,  0,130,  6,  0,
+/* 0x30d0 */   0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,
+/* 0x30e0 */   0,  8,  0,  0,  0,102,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,
+/* 0x30f0 */   0,  0,  0,  0,  0, 38,  0,  0,  0, 10,  0,  0,  0,130,  6,  0,
+/* 0x3100 */   0, 95,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,
+/* 0x3110 */   0, 21,  0,  0,  0,102,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,
+/* 0x3120 */   0,  0,  0,  0,  0, 39,  0,  0,  0, 18,  0,  0,  0,102,  6,  0,
+/* 0x3130 */   0,225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,
+/* 0x3140 */   0,  1,  0,  0,  0,130,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,
+/* 0x3150 */   0,  0,  0,  0,  0, 42,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,
+/* 0x3160 */   0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,
+/* 0x3170 */   0,  1,  0,  0,  0,130,  6,  0,  0,113,  1,  0,  0,  0,  0,  0,
+/* 0x3180 */   0,  0,  0,  0,  0, 46,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,
+/* 0x3190 */   0,131,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,
+/* 0x31a0 */   0, 12,  0,  0,  0,130,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,
+/* 0x31b0 */   0,  0,  0,  0,  0, 49,  0,  0,  0,  5,  0,  0,  0,130,  6,  0,
+/* 0x31c0 */   0,194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,
+/* 0x31d0 */   0, 14,  0,  0,  0,130,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,
+/* 0x31e0 */   0,  0,  0,  0,  0, 50,  0,  0,  0, 15,  0,  0,  0,130,  6,  0,
+/* 0x31f0 */   0,167,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,
+/* 0x3200 */   0, 30,  0,  0,  0,130,  6,  0,  0,239,  1,  0,  0,  0,  0,  0,
+/* 0x3210 */   0,  0,  0,  0,  0, 50,  0,  0,  0, 48,  0,  0,  0,130,  6,  0,
+/* 0x3220 */   0, 19,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,
+/* 0x3230 */   0, 12,  0,  0,  0,130,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,
+/* 0x3240 */   0,  0,  0,  0,  0, 52,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,
+/* 0x3250 */   0,194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,
+/* 0x3260 */   0, 14,  0,  0,  0,130,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,
+/* 0x3270 */   0,  0,  0,  0,  0, 56,  0,  0,  0,  8,  0,  0,  0,102,  6,  0,
+/* 0x3280 */   0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,
+/* 0x3290 */   0, 10,  0,  0,  0,130,  6,  0,  0, 10,  2,  0,  0,  0,  0,  0,
+/* 0x32a0 */   0,  0,  0,  0,  0, 57,  0,  0,  0, 21,  0,  0,  0,102,  6,  0,
+/* 0x32b0 */   0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,
+/* 0x32c0 */   0, 18,  0,  0,  0,102,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,
+/* 0x32d0 */   0,  0,  0,  0,  0, 60,  0,  0,  0,  5,  0,  0,  0,113,  6,  0,
+/* 0x32e0 */   0, 32,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,
+/* 0x32f0 */   0, 20,  0,  0,  0,113,  6,  0,  0, 50,  6,  0,  0,  0,  0,  0,
+/* 0x3300 */   0,  0,  0,  0,  0, 60,  0,  0,  0, 30,  0,  0,  0,113,  6,  0,
+/* 0x3310 */   0, 61,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,
+/* 0x3320 */   0, 42,  0,  0,  0,113,  6,  0,  0, 72,  6,  0,  0,  0,  0,  0,
+/* 0x3330 */   0,  0,  0,  0,  0, 68,  0,  0,  0,  1,  0,  0,  0,102,  6,  0,
+/* 0x3340 */   0,  3,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,
+/* 0x3350 */   0,  1,  0,  0,  0,130,  6,  0,  0,182,  2,  0,  0,  0,  0,  0,
+/* 0x3360 */   0,  0,  0,  0,  0, 72,  0,  0,  0,  1,  0,  0,  0,113,  6,  0,
+/* 0x3370 */   0, 16,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,
+/* 0x3380 */   0,  1,  0,  0,  0,102,  6,  0,  0,  3,  4,  0,  0,  0,  0,  0,
+/* 0x3390 */   0,  0,  0,  0,  0, 80,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,
+/* 0x33a0 */   0,228,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,
+/* 0x33b0 */   0,  4,  0,  0,  0,130,  6,  0,  0,228,  4,  0,  0,  0,  0,  0,
+/* 0x33c0 */   0,  0,  0,  0,  0, 86,  0,  0,  0,  2,  0,  0,  0,130,  6,  0,
+/* 0x33d0 */   0,223,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  0,  0,
+/* 0x33e0 */   0,  1,  0,  0,  0,130,  6,  0,  0,223,  3,  0,  0,  0,  0,  0,
+/* 0x33f0 */   0,  0,  0,  0,  0, 89,  0,  0,  0,  4,  0,  0,  0,130,  6,  0,
+/* 0x3400 */   0, 88,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 94,  0,  0,
+/* 0x3410 */   0,  4,  0,  0,  0,130,  6,  0,  0,223,  3,  0,  0,  0,  0,  0,
+/* 0x3420 */   0,  0,  0,  0,  0,103,  0,  0,  0,  6,  0,  0,  0,130,  6,  0,
+/* 0x3430 */   0,214,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,112,  0,  0,
+/* 0x3440 */   0,  6,  0,  0,  0,130,  6,  0,  0,228,  4,  0,  0,  0,  0,  0,
+/* 0x3450 */   0,  0,  0,  0,  0,125,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,
+/* 0x3460 */   0, 84,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,127,  0,  0,
+/* 0x3470 */   0,  7,  0,  0,  0,130,  6,  0,  0,191,  2,  0,  0,  0,  0,  0,
+/* 0x3480 */   0,  0,  0,  0,  0,131,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,
+/* 0x3490 */   0,245,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,133,  0,  0,
+/* 0x34a0 */   0,  1,  0,  0,  0,130,  6,  0,  0,245,  2,  0,  0,  0,  0,  0,
+/* 0x34b0 */   0,  0,  0,  0,  0,134,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,
+/* 0x34c0 */   0,228,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,
+/* 0x34d0 */   0,  1,  0,  0,  0,130,  6,  0,  0,219,  4,  0,  0,  0,  0,  0,
+/* 0x34e0 */   0,  0,  0,  0,  0,136,  0,  0,  0,  1,  0,  0,  0,130,  6,  0,
+/* 0x34f0 */   0,219,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,137,  0,  0,
+/* 0x3500 */   0,  2,  0,  0,  0,130,  6,  0,  0,245,  2,  0,  0,  0,  0,  0,
+/* 0x3510 */   0,  0,  0,  0,  0,138,  0,  0,  0,  4,  0,  0,  0,130,  6,  0,
+/* 0x3520 */   0,120,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,
+/* 0x3530 */   0,  3,  0,  0,  0,130,  6,  0,  0, 64,  5,  0,  0,  0,  0,  0,
+/* 0x3540 */   0,  0,  0,  0,  0,147,  0,  0,  0, 13,  0,  0,  0,130,  6,  0,
+/* 0x3550 */   0, 64,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,148,  0,  0,
+/* 0x3560 */   0,  5,  0,  0,  0,130,  6,  0,  0, 84,  5,  0,  0,  0,  0,  0,
+/* 0x3570 */   0,  0,  0,  0,  0,148,  0,  0,  0, 10,  0,  0,  0,130,  6,  0,
+/* 0x3580 */   0, 84,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,148,  0,  0,
+/* 0x3590 */   0, 16,  0,  0,  0,130,  6,  0,  0, 84,  5,  0,  0,  0,  0,  0,
+/* 0x35a0 */   0,  0,  0,  0,  0,149,  0,  0,  0,  4,  0,  0,  0,130,  6,  0,
+/* 0x35b0 */   0, 84,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,  0,  0,
+/* 0x35c0 */   0,  9,  0,  0,  0,130,  6,  0,  0, 54,  5,  0,  0,  0,  0,  0,
+/* 0x35d0 */   0,  0,  0,  0,  0,150,  0,  0,  0,  4,  0,  0,  0,130,  6,  0,
+/* 0x35e0 */   0, 44,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,151,  0,  0,
+/* 0x35f0 */   0,  1,  0,  0,  0,113,  6,  0,  0, 88,  6,  0,  0,  0,  0,  0,
+/* 0x3600 */   0,  0,  0,  0,  0,152,  0,  0,  0,  2,  0,  0,  0,122,  6,  0,
+/* 0x3610 */   0, 21,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,152,  0,  0,
+/* 0x3620 */   0,  4,  0,  0,  0,130,  6,  0,  0, 94,  5,  0,  0,  0,  0,  0,
+/* 0x3630 */   0,  0,  0,  0,  0,157,  0,  0,  0, 15,  0,  0,  0,130,  6,  0,
+/* 0x3640 */   0, 94,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,158,  0,  0,
+/* 0x3650 */   0,  1,  0,  0,  0,113,  6,  0,  0, 88,  6,  0,  0,  0,  0,  0,
+/* 0x3660 */   0,  0,  0,  0,  0,161,  0,  0,  0,  3,  0,  0,  0,130,  6,  0,
+/* 0x3670 */   0,238,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,
+/* 0x3680 */   0,  2,  0,  0,  0,122,  6,  0,  0, 21,  6,  0,  0,  0,  0,  0,
+/* 0x3690 */   0,  0,  0,  0,  0,162,  0,  0,  0,  4,  0,  0,  0,130,  6,  0,
+/* 0x36a0 */   0,184,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,
+/* 0x36b0 */   0,  6,  0,  0,  0,130,  6,  0,  0,157,  5,  0,  0,  0,  0,  0,
+/* 0x36c0 */   0,  0,  0,  0,  0, 76, 69, 88, 69, 67, 48, 48, 48,  0, 76, 69,
+/* 0x36d0 */  88, 69, 67, 48, 48, 57,  0, 76, 69, 88, 69, 67, 48, 49, 48,  0,
+/* 0x36e0 */  78, 50, 66, 83, 77, 65, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49,
+/* 0x36f0 */  48,  0, 78, 50, 66, 70, 65, 83, 49, 49,  0, 78, 50, 66, 68, 69,
+/* 0x3700 */  67, 49, 48,  0, 78, 50, 66, 83, 77, 65, 50, 48,  0, 78, 50, 66,
+/* 0x3710 */  70, 65, 83, 50, 48,  0, 78, 50, 66, 68, 69, 67, 50, 48,  0, 78,
+/* 0x3720 */  50, 66, 83, 77, 65, 51, 48,  0, 78, 50, 66, 70, 65, 83, 51, 48,
+/* 0x3730 */   0, 78, 50, 66, 68, 69, 67, 51, 48,  0, 78, 50, 66, 83, 77, 65,
+/* 0x3740 */  52, 48,  0, 78, 50, 66, 70, 65, 83, 52, 48,  0, 78, 50, 66, 83,
+/* 0x3750 */  77, 65, 53, 48,  0, 78, 50, 66, 70, 65, 83, 53, 48,  0, 78, 50,
+/* 0x3760 */  66, 68, 69, 67, 53, 48,  0, 78, 50, 66, 83, 77, 65, 54, 48,  0,
+/* 0x3770 */  78, 50, 66, 70, 65, 83, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54,
+/* 0x3780 */  49,  0, 78, 50, 66, 68, 69, 67, 54, 48,  0, 78, 50, 68, 83, 77,
+/* 0x3790 */  65, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 48,  0, 78, 50, 68,
+/* 0x37a0 */  70, 65, 83, 49, 49,  0, 78, 50, 68, 68, 69, 67, 49, 48,  0, 78,
+/* 0x37b0 */  50, 68, 83, 77, 65, 50, 48,  0, 78, 50, 68, 70, 65, 83, 50, 48,
+/* 0x37c0 */   0, 78, 50, 68, 68, 69, 67, 50, 48,  0, 78, 50, 68, 83, 77, 65,
+/* 0x37d0 */  51, 48,  0, 78, 50, 68, 70, 65, 83, 51, 48,  0, 78, 50, 68, 68,
+/* 0x37e0 */  69, 67, 51, 48,  0, 78, 50, 68, 83, 77, 65, 52, 48,  0, 78, 50,
+/* 0x37f0 */  68, 70, 65, 83, 52, 48,  0, 78, 50, 68, 83, 77, 65, 53, 48,  0,
+/* 0x3800 */  78, 50, 68, 70, 65, 83, 53, 48,  0, 78, 50, 68, 68, 69, 67, 53,
+/* 0x3810 */  48,  0, 78, 50, 68, 83, 77, 65, 54, 48,  0, 78, 50, 68, 70, 65,
+/* 0x3820 */  83, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 49,  0, 78, 50, 68,
+/* 0x3830 */  68, 69, 67, 54, 48,  0, 78, 50, 69, 83, 77, 65, 49, 48,  0, 78,
+/* 0x3840 */  50, 69, 70, 65, 83, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 49,
+/* 0x3850 */   0, 78, 50, 69, 68, 69, 67, 49, 48,  0, 78, 50, 69, 83, 77, 65,
+/* 0x3860 */  50, 48,  0, 78, 50, 69, 70, 65, 83, 50, 48,  0, 78, 50, 69, 68,
+/* 0x3870 */  69, 67, 50, 48,  0, 78, 50, 69, 83, 77, 65, 51, 48,  0, 78, 50,
+/* 0x3880 */  69, 70, 65, 83, 51, 48,  0, 78, 50, 69, 68, 69, 67, 51, 48,  0,
+/* 0x3890 */  78, 50, 69, 83, 77, 65, 52, 48,  0, 78, 50, 69, 70, 65, 83, 52,
+/* 0x38a0 */  48,  0, 78, 50, 69, 83, 77, 65, 53, 48,  0, 78, 50, 69, 70, 65,
+/* 0x38b0 */  83, 53, 48,  0, 78, 50, 69, 68, 69, 67, 53, 48,  0, 78, 50, 69,
+/* 0x38c0 */  83, 77, 65, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 48,  0, 78,
+/* 0x38d0 */  50, 69, 70, 65, 83, 54, 49,  0, 78, 50, 69, 68, 69, 67, 54, 48,
+/* 0x38e0 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  0, 76, 90, 77, 65,
+/* 0x38f0 */  95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49,
+/* 0x3900 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77,
+/* 0x3910 */  65, 95, 68, 69, 67, 51, 48,  0, 76, 69, 88, 69, 67, 48, 49, 53,
+/* 0x3920 */   0, 76, 69, 88, 69, 67, 49, 49, 48,  0, 76, 69, 88, 69, 67, 49,
+/* 0x3930 */  48, 48,  0, 76, 69, 88, 69, 67, 48, 49, 54,  0, 76, 88, 85, 78,
+/* 0x3940 */  70, 48, 48, 48,  0, 76, 88, 85, 78, 70, 48, 48, 50,  0, 77, 82,
+/* 0x3950 */  85, 66, 89, 84, 69, 48,  0, 76, 88, 77, 82, 85, 48, 48, 53,  0,
+/* 0x3960 */  76, 88, 77, 82, 85, 48, 48, 54,  0, 76, 88, 77, 82, 85, 48, 48,
+/* 0x3970 */  55,  0, 76, 88, 85, 78, 70, 48, 48, 56,  0, 76, 88, 85, 78, 70,
+/* 0x3980 */  48, 49, 48,  0, 76, 88, 74, 67, 67, 48, 49, 48,  0, 76, 88, 77,
+/* 0x3990 */  82, 85, 48, 52, 53,  0, 76, 88, 77, 82, 85, 48, 52, 54,  0, 76,
+/* 0x39a0 */  88, 74, 67, 67, 48, 50, 48,  0, 76, 88, 74, 67, 67, 48, 50, 49,
+/* 0x39b0 */   0, 76, 88, 74, 67, 67, 48, 50, 51,  0, 76, 88, 85, 78, 70, 48,
+/* 0x39c0 */  51, 55,  0, 76, 88, 85, 78, 70, 51, 56, 54,  0, 76, 88, 85, 78,
+/* 0x39d0 */  70, 51, 56, 55,  0, 76, 88, 85, 78, 70, 51, 56, 56,  0, 76, 88,
+/* 0x39e0 */  85, 78, 70, 52, 56, 54,  0, 76, 88, 85, 78, 70, 52, 56, 55,  0,
+/* 0x39f0 */  76, 88, 77, 82, 85, 48, 54, 53,  0, 77, 82, 85, 66, 89, 84, 69,
+/* 0x3a00 */  51,  0, 77, 82, 85, 65, 82, 66, 51, 48,  0, 77, 82, 85, 66, 73,
+/* 0x3a10 */  84, 83, 51,  0, 77, 82, 85, 65, 82, 66, 52, 48,  0, 76, 88, 77,
+/* 0x3a20 */  82, 85, 48, 55, 48,  0, 77, 82, 85, 66, 89, 84, 69, 52,  0, 77,
+/* 0x3a30 */  82, 85, 66, 73, 84, 83, 52,  0, 77, 82, 85, 65, 82, 66, 53, 48,
+/* 0x3a40 */   0, 76, 88, 77, 82, 85, 48, 56, 48,  0, 77, 82, 85, 66, 89, 84,
+/* 0x3a50 */  69, 53,  0, 77, 82, 85, 65, 82, 66, 54, 48,  0, 77, 82, 85, 66,
+/* 0x3a60 */  73, 84, 83, 53,  0, 77, 82, 85, 65, 82, 66, 55, 48,  0, 76, 88,
+/* 0x3a70 */  77, 82, 85, 48, 57, 48,  0, 77, 82, 85, 66, 89, 84, 69, 54,  0,
+/* 0x3a80 */  77, 82, 85, 65, 82, 66, 56, 48,  0, 77, 82, 85, 66, 73, 84, 83,
+/* 0x3a90 */  54,  0, 77, 82, 85, 65, 82, 66, 57, 48,  0, 76, 88, 77, 82, 85,
+/* 0x3aa0 */  49, 48, 48,  0, 76, 88, 85, 78, 70, 48, 52, 48,  0, 76, 88, 77,
+/* 0x3ab0 */  82, 85, 49, 49, 48,  0, 76, 88, 77, 82, 85, 49, 49, 49,  0, 76,
+/* 0x3ac0 */  88, 85, 78, 70, 48, 52, 49,  0, 76, 88, 85, 78, 70, 48, 52, 50,
+/* 0x3ad0 */   0, 76, 88, 77, 82, 85, 48, 49, 48,  0, 76, 88, 74, 77, 80, 65,
+/* 0x3ae0 */  48, 48,  0, 76, 88, 67, 65, 76, 76, 66, 48,  0, 76, 88, 85, 78,
+/* 0x3af0 */  70, 48, 50, 49,  0, 76, 88, 77, 82, 85, 48, 50, 50,  0, 76, 88,
+/* 0x3b00 */  74, 77, 80, 65, 48, 49,  0, 76, 88, 67, 65, 76, 76, 66, 49,  0,
+/* 0x3b10 */  77, 82, 85, 66, 73, 84, 83, 49,  0, 76, 88, 77, 82, 85, 48, 51,
+/* 0x3b20 */  48,  0, 77, 82, 85, 66, 89, 84, 69, 49,  0, 77, 82, 85, 65, 82,
+/* 0x3b30 */  66, 49, 48,  0, 76, 88, 77, 82, 85, 48, 52, 48,  0, 76, 88, 85,
+/* 0x3b40 */  78, 70, 48, 51, 48,  0, 76, 88, 74, 67, 67, 48, 48, 48,  0, 76,
+/* 0x3b50 */  88, 67, 74, 48, 77, 82, 85,  0, 76, 88, 67, 74, 49, 77, 82, 85,
+/* 0x3b60 */   0, 76, 88, 67, 65, 76, 74, 77, 80,  0, 76, 88, 67, 65, 76, 76,
+/* 0x3b70 */  48, 48,  0, 76, 88, 67, 65, 76, 76, 48, 49,  0, 76, 88, 67, 74,
+/* 0x3b80 */  50, 77, 82, 85,  0, 76, 88, 67, 74, 52, 77, 82, 85,  0, 76, 88,
+/* 0x3b90 */  67, 74, 54, 77, 82, 85,  0, 76, 88, 67, 74, 55, 77, 82, 85,  0,
+/* 0x3ba0 */  76, 88, 67, 74, 56, 77, 82, 85,  0, 76, 88, 85, 78, 70, 48, 51,
+/* 0x3bb0 */  52,  0, 76, 88, 77, 82, 85, 48, 53, 53,  0, 77, 82, 85, 66, 89,
+/* 0x3bc0 */  84, 69, 50,  0, 77, 82, 85, 66, 73, 84, 83, 50,  0, 77, 82, 85,
+/* 0x3bd0 */  65, 82, 66, 50, 48,  0, 76, 88, 77, 82, 85, 48, 53, 55,  0, 76,
+/* 0x3be0 */  88, 77, 82, 85, 48, 53, 56,  0, 76, 88, 85, 78, 70, 48, 51, 53,
+/* 0x3bf0 */   0, 99,116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,107, 51,
+/* 0x3c00 */  50, 46, 49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,  0, 99,
+/* 0x3c10 */ 116,111,107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51, 50, 46,
+/* 0x3c20 */  52, 48,  0, 67, 65, 76, 76, 84, 82, 48, 48,  0, 67, 84, 67, 76,
+/* 0x3c30 */  69, 86, 69, 49,  0, 67, 65, 76, 76, 84, 82, 48, 49,  0, 67, 84,
+/* 0x3c40 */  66, 83, 72, 82, 48, 49,  0, 67, 84, 66, 82, 79, 82, 48, 49,  0,
+/* 0x3c50 */  67, 84, 66, 83, 87, 65, 48, 49,  0, 67, 65, 76, 76, 84, 82, 48,
+/* 0x3c60 */  50,  0, 67, 65, 76, 76, 84, 82, 49, 48,  0, 67, 65, 76, 76, 84,
+/* 0x3c70 */  82, 69, 56,  0, 67, 65, 76, 76, 84, 82, 69, 57,  0, 67, 65, 76,
+/* 0x3c80 */  76, 84, 82, 49, 49,  0, 67, 84, 67, 76, 69, 86, 69, 50,  0, 67,
+/* 0x3c90 */  65, 76, 76, 84, 82, 49, 50,  0, 67, 84, 66, 83, 72, 82, 49, 49,
+/* 0x3ca0 */   0, 67, 84, 66, 82, 79, 82, 49, 49,  0, 67, 84, 66, 83, 87, 65,
+/* 0x3cb0 */  49, 49,  0, 67, 65, 76, 76, 84, 82, 49, 51,  0, 76, 69, 88, 69,
+/* 0x3cc0 */  67, 48, 49, 55,  0, 76, 69, 88, 69, 67, 48, 50, 48,  0, 95,115,
+/* 0x3cd0 */ 116, 97,114,116,  0, 78, 77, 82, 85,  0,102,105,108,116,101,114,
+/* 0x3ce0 */  95, 99,116,111,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95,
+/* 0x3cf0 */  97,100,106,117,115,116,  0,108,122,109, 97, 95,117, 95,108,101,
+/* 0x3d00 */ 110,  0,108,122,109, 97, 95, 99, 95,108,101,110,  0,108,122,109,
+/* 0x3d10 */  97, 95,112,114,111,112,101,114,116,105,101,115,  0,102,105,108,
+/* 0x3d20 */ 116,101,114, 95,108,101,110,103,116,104,  0, 82, 95, 51, 56, 54,
+/* 0x3d30 */  95, 80, 67, 51, 50,  0, 82, 95, 51, 56, 54, 95, 51, 50,  0, 82,
+/* 0x3d40 */  95, 51, 56, 54, 95, 56,  0, 82, 95, 51, 56, 54, 95, 80, 67, 56,
+/* 0x3d50 */   0,213, 26,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* i386-darwin.dylib-entry.h
-   created from i386-darwin.dylib-entry.bin, 30552 (0x7758) bytes
+   created from i386-darwin.dylib-entry.bin, 15867 (0x3dfb) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_DARWIN_DYLIB_ENTRY_SIZE    30552
-#define STUB_I386_DARWIN_DYLIB_ENTRY_ADLER32 0x3677f3d6
-#define STUB_I386_DARWIN_DYLIB_ENTRY_CRC32   0xa2df29f4
+#define STUB_I386_DARWIN_DYLIB_ENTRY_SIZE    15867
+#define STUB_I386_DARWIN_DYLIB_ENTRY_ADLER32 0xcc3dd9b2
+#define STUB_I386_DARWIN_DYLIB_ENTRY_CRC32   0x766ecb81
 
-unsigned char stub_i386_darwin_dylib_entry[30552] = {
+unsigned char stub_i386_darwin_dylib_entry[15867] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 192, 34,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -476,1474 +476,556 @@ unsigned char stub_i386_darwin_dylib_entry[30552] = {
 /* 0x1b50 */ 216, 81, 15,182, 72, 10, 81,255, 48, 82,141, 69,  2,255,208,131,
 /* 0x1b60 */ 196, 16,235,197,184,197,  0,  0,  0,232, 26,  0,  0,  0,115,  3,
 /* 0x1b70 */ 131,200,255,195, 88,141, 87,251,198,  2, 88,199, 66,  1, 88, 88,
-/* 0x1b80 */  97,195,184, 73,  0,  0,  0, 82, 90,137,225, 15, 52,102,105,108,
-/* 0x1b90 */ 101, 32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,105,
-/* 0x1ba0 */  51, 56, 54, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,
-/* 0x1bb0 */ 100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1bc0 */  32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32,
-/* 0x1bd0 */  32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,
-/* 0x1be0 */ 105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,
-/* 0x1bf0 */ 108, 97,103,115, 10, 32, 32, 48, 32, 76, 69, 88, 69, 67, 48, 48,
-/* 0x1c00 */  48, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1c10 */  32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1c20 */  69, 78, 84, 83, 10, 32, 32, 49, 32, 76, 69, 88, 69, 67, 48, 48,
-/* 0x1c30 */  57, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1c40 */  48, 51, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1c50 */  78, 84, 83, 10, 32, 32, 50, 32, 76, 69, 88, 69, 67, 48, 49, 48,
-/* 0x1c60 */  32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1c70 */  48, 51, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1c80 */  78, 84, 83, 10, 32, 32, 51, 32, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x1c90 */  32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1ca0 */  48, 52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1cb0 */  78, 84, 83, 10, 32, 32, 52, 32, 78, 50, 66, 70, 65, 83, 49, 48,
-/* 0x1cc0 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1cd0 */  48, 52, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1ce0 */  78, 84, 83, 10, 32, 32, 53, 32, 78, 50, 66, 70, 65, 83, 49, 49,
-/* 0x1cf0 */  32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1d00 */  48, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d10 */  78, 84, 83, 10, 32, 32, 54, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x1d20 */  32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1d30 */  48, 53, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d40 */  78, 84, 83, 10, 32, 32, 55, 32, 78, 50, 66, 83, 77, 65, 50, 48,
-/* 0x1d50 */  32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1d60 */  48, 53,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d70 */  78, 84, 83, 10, 32, 32, 56, 32, 78, 50, 66, 70, 65, 83, 50, 48,
-/* 0x1d80 */  32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1d90 */  48, 54, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1da0 */  78, 84, 83, 10, 32, 32, 57, 32, 78, 50, 66, 68, 69, 67, 50, 48,
-/* 0x1db0 */  32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1dc0 */  48, 54, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1dd0 */  78, 84, 83, 10, 32, 49, 48, 32, 78, 50, 66, 83, 77, 65, 51, 48,
-/* 0x1de0 */  32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1df0 */  48, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1e00 */  78, 84, 83, 10, 32, 49, 49, 32, 78, 50, 66, 70, 65, 83, 51, 48,
-/* 0x1e10 */  32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1e20 */  48, 56, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1e30 */  78, 84, 83, 10, 32, 49, 50, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x1e40 */  32, 32, 32, 32, 32, 32, 48, 51,101, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1e50 */  32, 48, 57, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1e60 */  69, 78, 84, 83, 10, 32, 49, 51, 32, 78, 50, 66, 83, 77, 65, 52,
-/* 0x1e70 */  48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1e80 */  32, 48,100, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1e90 */  69, 78, 84, 83, 10, 32, 49, 52, 32, 78, 50, 66, 70, 65, 83, 52,
-/* 0x1ea0 */  48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1eb0 */  32, 48,100,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1ec0 */  69, 78, 84, 83, 10, 32, 49, 53, 32, 78, 50, 66, 83, 77, 65, 53,
-/* 0x1ed0 */  48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1ee0 */  32, 48,101,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1ef0 */  69, 78, 84, 83, 10, 32, 49, 54, 32, 78, 50, 66, 70, 65, 83, 53,
-/* 0x1f00 */  48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1f10 */  32, 48,102, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1f20 */  69, 78, 84, 83, 10, 32, 49, 55, 32, 78, 50, 66, 68, 69, 67, 53,
-/* 0x1f30 */  48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1f40 */  32, 48,102, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1f50 */  69, 78, 84, 83, 10, 32, 49, 56, 32, 78, 50, 66, 83, 77, 65, 54,
-/* 0x1f60 */  48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1f70 */  32, 48,102, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1f80 */  69, 78, 84, 83, 10, 32, 49, 57, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x1f90 */  48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48,
-/* 0x1fa0 */  32, 32, 48, 49, 48, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1fb0 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 48, 32, 78, 50, 66, 70, 65,
-/* 0x1fc0 */  83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32,
-/* 0x1fd0 */  32, 48, 32, 32, 48, 49, 50, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1fe0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 49, 32, 78, 50, 66,
-/* 0x1ff0 */  68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2000 */  32, 48, 32, 32, 48, 49, 51, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2010 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 50, 32, 78, 50, 68,
-/* 0x2020 */  83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x2030 */  32, 32, 48, 32, 32, 48, 49, 51, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2040 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 51, 32, 78, 50,
-/* 0x2050 */  68, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x2060 */  48, 32, 32, 48, 32, 32, 48, 49, 51, 97, 32, 32, 50, 42, 42, 48,
-/* 0x2070 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 52, 32, 78,
-/* 0x2080 */  50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x2090 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 99, 32, 32, 50, 42, 42,
-/* 0x20a0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 53, 32,
-/* 0x20b0 */  78, 50, 68, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98,
-/* 0x20c0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 52, 50, 32, 32, 50, 42,
-/* 0x20d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 54,
-/* 0x20e0 */  32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x20f0 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 52,100, 32, 32, 50,
-/* 0x2100 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x2110 */  55, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2120 */  48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 53, 50, 32, 32,
-/* 0x2130 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2140 */  50, 56, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32,
-/* 0x2150 */  32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 53, 98, 32,
-/* 0x2160 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2170 */  32, 50, 57, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 32, 32, 32,
-/* 0x2180 */  32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 54, 56,
-/* 0x2190 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x21a0 */  10, 32, 51, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 32, 32,
-/* 0x21b0 */  32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55,
-/* 0x21c0 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x21d0 */  83, 10, 32, 51, 49, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 32,
-/* 0x21e0 */  32, 32, 32, 32, 48, 53, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x21f0 */  49, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2200 */  78, 84, 83, 10, 32, 51, 50, 32, 78, 50, 68, 83, 77, 65, 52, 48,
-/* 0x2210 */  32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2220 */  48, 49,100, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2230 */  69, 78, 84, 83, 10, 32, 51, 51, 32, 78, 50, 68, 70, 65, 83, 52,
-/* 0x2240 */  48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2250 */  32, 48, 49,101, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2260 */  84, 69, 78, 84, 83, 10, 32, 51, 52, 32, 78, 50, 68, 83, 77, 65,
-/* 0x2270 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x2280 */  32, 32, 48, 49,102, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2290 */  78, 84, 69, 78, 84, 83, 10, 32, 51, 53, 32, 78, 50, 68, 70, 65,
-/* 0x22a0 */  83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x22b0 */  48, 32, 32, 48, 49,102, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x22c0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 54, 32, 78, 50, 68, 68,
-/* 0x22d0 */  69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32,
-/* 0x22e0 */  32, 48, 32, 32, 48, 49,102, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x22f0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 55, 32, 78, 50, 68,
-/* 0x2300 */  83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48,
-/* 0x2310 */  32, 32, 48, 32, 32, 48, 50, 48, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2320 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 56, 32, 78, 50,
-/* 0x2330 */  68, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32,
-/* 0x2340 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 48, 99, 32, 32, 50, 42, 42,
-/* 0x2350 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 57, 32,
-/* 0x2360 */  78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x2370 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 50, 53, 32, 32, 50,
-/* 0x2380 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52,
-/* 0x2390 */  48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x23a0 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 51, 98, 32, 32, 50,
-/* 0x23b0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52,
-/* 0x23c0 */  49, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x23d0 */  48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 51, 98, 32, 32,
-/* 0x23e0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x23f0 */  52, 50, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32,
-/* 0x2400 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 51,101, 32,
-/* 0x2410 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2420 */  32, 52, 51, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 32, 32, 32,
-/* 0x2430 */  32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 52, 48,
-/* 0x2440 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2450 */  10, 32, 52, 52, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 32, 32,
-/* 0x2460 */  32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 52,
-/* 0x2470 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2480 */  83, 10, 32, 52, 53, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 32,
-/* 0x2490 */  32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x24a0 */  53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x24b0 */  84, 83, 10, 32, 52, 54, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32,
-/* 0x24c0 */  32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x24d0 */  50, 53, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x24e0 */  78, 84, 83, 10, 32, 52, 55, 32, 78, 50, 69, 68, 69, 67, 50, 48,
-/* 0x24f0 */  32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2500 */  48, 50, 53,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2510 */  69, 78, 84, 83, 10, 32, 52, 56, 32, 78, 50, 69, 83, 77, 65, 51,
-/* 0x2520 */  48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2530 */  32, 48, 50, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2540 */  84, 69, 78, 84, 83, 10, 32, 52, 57, 32, 78, 50, 69, 70, 65, 83,
-/* 0x2550 */  51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48,
-/* 0x2560 */  32, 32, 48, 50, 55, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2570 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 48, 32, 78, 50, 69, 68, 69,
-/* 0x2580 */  67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 53,102, 32, 32, 48, 32,
-/* 0x2590 */  32, 48, 32, 32, 48, 50, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x25a0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 49, 32, 78, 50, 69,
-/* 0x25b0 */  83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48,
-/* 0x25c0 */  32, 32, 48, 32, 32, 48, 50,101, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x25d0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 50, 32, 78, 50,
-/* 0x25e0 */  69, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32,
-/* 0x25f0 */  48, 32, 32, 48, 32, 32, 48, 50,102, 52, 32, 32, 50, 42, 42, 48,
-/* 0x2600 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 51, 32, 78,
-/* 0x2610 */  50, 69, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x2620 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 48, 51, 32, 32, 50, 42, 42,
-/* 0x2630 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 52, 32,
-/* 0x2640 */  78, 50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x2650 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 48, 53, 32, 32, 50, 42,
-/* 0x2660 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 53,
-/* 0x2670 */  32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2680 */  57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 48, 56, 32, 32, 50,
-/* 0x2690 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x26a0 */  54, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x26b0 */  48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 49, 49, 32, 32,
-/* 0x26c0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x26d0 */  53, 55, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32,
-/* 0x26e0 */  32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 49,100,
-/* 0x26f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2700 */  10, 32, 53, 56, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 32, 32,
-/* 0x2710 */  32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2720 */  51, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2730 */  84, 83, 10, 32, 53, 57, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32,
-/* 0x2740 */  32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2750 */  52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2760 */  84, 83, 10, 32, 54, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48,
-/* 0x2770 */  48, 32, 32, 32, 32, 48, 50,101, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2780 */  48, 51, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2790 */  69, 78, 84, 83, 10, 32, 54, 49, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x27a0 */  70, 48, 48, 32, 32, 32, 32, 48, 52, 56, 32, 32, 48, 32, 32, 48,
-/* 0x27b0 */  32, 32, 48, 51, 55, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x27c0 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 50, 32, 76, 90, 77, 65, 95,
-/* 0x27d0 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 97, 56, 54, 32, 32, 48,
-/* 0x27e0 */  32, 32, 48, 32, 32, 48, 51, 99, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x27f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 51, 32, 76, 90,
-/* 0x2800 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 97, 56, 54,
-/* 0x2810 */  32, 32, 48, 32, 32, 48, 32, 32, 48,101, 52, 56, 32, 32, 50, 42,
-/* 0x2820 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 52,
-/* 0x2830 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48,
-/* 0x2840 */  49, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 99,101, 32,
-/* 0x2850 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2860 */  32, 54, 53, 32, 76, 69, 88, 69, 67, 48, 49, 53, 32, 32, 32, 32,
-/* 0x2870 */  32, 32, 48, 49,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56,
-/* 0x2880 */ 101, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2890 */  84, 83, 10, 32, 54, 54, 32, 76, 88, 85, 78, 70, 48, 48, 48, 32,
-/* 0x28a0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x28b0 */  49, 57, 48, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x28c0 */  69, 78, 84, 83, 10, 32, 54, 55, 32, 76, 88, 85, 78, 70, 48, 48,
-/* 0x28d0 */  50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x28e0 */  32, 48, 49, 57, 48, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x28f0 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 56, 32, 77, 82, 85, 66, 89,
-/* 0x2900 */  84, 69, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2910 */  48, 32, 32, 48, 49, 57, 48, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2920 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 57, 32, 76, 88, 77,
-/* 0x2930 */  82, 85, 48, 48, 53, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2940 */  32, 32, 48, 32, 32, 48, 49, 57, 48,101, 32, 32, 50, 42, 42, 48,
-/* 0x2950 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 48, 32, 76,
-/* 0x2960 */  88, 77, 82, 85, 48, 48, 54, 32, 32, 32, 32, 32, 32, 48, 55, 32,
-/* 0x2970 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 49, 51, 32, 32, 50, 42,
-/* 0x2980 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 49,
-/* 0x2990 */  32, 76, 88, 77, 82, 85, 48, 48, 55, 32, 32, 32, 32, 32, 32, 48,
-/* 0x29a0 */  55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 49, 97, 32, 32,
-/* 0x29b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x29c0 */  55, 50, 32, 76, 88, 85, 78, 70, 48, 48, 56, 32, 32, 32, 32, 32,
-/* 0x29d0 */  32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50, 49,
-/* 0x29e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x29f0 */  10, 32, 55, 51, 32, 76, 88, 85, 78, 70, 48, 49, 48, 32, 32, 32,
-/* 0x2a00 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2a10 */  50, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2a20 */  84, 83, 10, 32, 55, 52, 32, 76, 88, 74, 67, 67, 48, 49, 48, 32,
-/* 0x2a30 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2a40 */  49, 57, 50, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2a50 */  69, 78, 84, 83, 10, 32, 55, 53, 32, 76, 88, 77, 82, 85, 48, 52,
-/* 0x2a60 */  53, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2a70 */  32, 48, 49, 57, 50,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2a80 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 54, 32, 76, 88, 77, 82, 85,
-/* 0x2a90 */  48, 52, 54, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2aa0 */  48, 32, 32, 48, 49, 57, 51, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2ab0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 55, 32, 76, 88, 74,
-/* 0x2ac0 */  67, 67, 48, 50, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2ad0 */  32, 32, 48, 32, 32, 48, 49, 57, 51, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2ae0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 56, 32, 76,
-/* 0x2af0 */  88, 74, 67, 67, 48, 50, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x2b00 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 52, 32, 32, 50, 42,
-/* 0x2b10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 57,
-/* 0x2b20 */  32, 76, 88, 74, 67, 67, 48, 50, 51, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2b30 */  55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 57, 32, 32,
-/* 0x2b40 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2b50 */  56, 48, 32, 76, 88, 85, 78, 70, 48, 51, 55, 32, 32, 32, 32, 32,
-/* 0x2b60 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 52, 48,
-/* 0x2b70 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2b80 */  10, 32, 56, 49, 32, 76, 88, 85, 78, 70, 51, 56, 54, 32, 32, 32,
-/* 0x2b90 */  32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2ba0 */  52, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2bb0 */  84, 83, 10, 32, 56, 50, 32, 76, 88, 85, 78, 70, 51, 56, 55, 32,
-/* 0x2bc0 */  32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2bd0 */  49, 57, 52, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2be0 */  69, 78, 84, 83, 10, 32, 56, 51, 32, 76, 88, 85, 78, 70, 51, 56,
-/* 0x2bf0 */  56, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2c00 */  32, 48, 49, 57, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2c10 */  78, 84, 69, 78, 84, 83, 10, 32, 56, 52, 32, 76, 88, 85, 78, 70,
-/* 0x2c20 */  52, 56, 54, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32,
-/* 0x2c30 */  48, 32, 32, 48, 49, 57, 52,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2c40 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 53, 32, 76, 88, 85,
-/* 0x2c50 */  78, 70, 52, 56, 55, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2c60 */  32, 32, 48, 32, 32, 48, 49, 57, 53, 51, 32, 32, 50, 42, 42, 48,
-/* 0x2c70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 54, 32, 76,
-/* 0x2c80 */  88, 77, 82, 85, 48, 54, 53, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x2c90 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 53, 32, 32, 50, 42,
-/* 0x2ca0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 55,
-/* 0x2cb0 */  32, 77, 82, 85, 66, 89, 84, 69, 51, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2cc0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 97, 32, 32,
-/* 0x2cd0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2ce0 */  56, 56, 32, 77, 82, 85, 65, 82, 66, 51, 48, 32, 32, 32, 32, 32,
-/* 0x2cf0 */  32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 99,
-/* 0x2d00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2d10 */  10, 32, 56, 57, 32, 77, 82, 85, 66, 73, 84, 83, 51, 32, 32, 32,
-/* 0x2d20 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2d30 */  53,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2d40 */  84, 83, 10, 32, 57, 48, 32, 77, 82, 85, 65, 82, 66, 52, 48, 32,
-/* 0x2d50 */  32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2d60 */  49, 57, 53,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2d70 */  69, 78, 84, 83, 10, 32, 57, 49, 32, 76, 88, 77, 82, 85, 48, 55,
-/* 0x2d80 */  48, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2d90 */  32, 48, 49, 57, 54, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2da0 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 50, 32, 77, 82, 85, 66, 89,
-/* 0x2db0 */  84, 69, 52, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x2dc0 */  48, 32, 32, 48, 49, 57, 54, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2dd0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 51, 32, 77, 82, 85,
-/* 0x2de0 */  66, 73, 84, 83, 52, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2df0 */  32, 32, 48, 32, 32, 48, 49, 57, 54,101, 32, 32, 50, 42, 42, 48,
-/* 0x2e00 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 52, 32, 77,
-/* 0x2e10 */  82, 85, 65, 82, 66, 53, 48, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x2e20 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 48, 32, 32, 50, 42,
-/* 0x2e30 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 53,
-/* 0x2e40 */  32, 76, 88, 77, 82, 85, 48, 56, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2e50 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 54, 32, 32,
-/* 0x2e60 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2e70 */  57, 54, 32, 77, 82, 85, 66, 89, 84, 69, 53, 32, 32, 32, 32, 32,
-/* 0x2e80 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 57,
-/* 0x2e90 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2ea0 */  10, 32, 57, 55, 32, 77, 82, 85, 65, 82, 66, 54, 48, 32, 32, 32,
-/* 0x2eb0 */  32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2ec0 */  55, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2ed0 */  84, 83, 10, 32, 57, 56, 32, 77, 82, 85, 66, 73, 84, 83, 53, 32,
-/* 0x2ee0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2ef0 */  49, 57, 55, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2f00 */  69, 78, 84, 83, 10, 32, 57, 57, 32, 77, 82, 85, 65, 82, 66, 55,
-/* 0x2f10 */  48, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2f20 */  32, 48, 49, 57, 55,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2f30 */  78, 84, 69, 78, 84, 83, 10, 49, 48, 48, 32, 76, 88, 77, 82, 85,
-/* 0x2f40 */  48, 57, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32,
-/* 0x2f50 */  48, 32, 32, 48, 49, 57, 56, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2f60 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 49, 32, 77, 82, 85,
-/* 0x2f70 */  66, 89, 84, 69, 54, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2f80 */  32, 32, 48, 32, 32, 48, 49, 57, 56,100, 32, 32, 50, 42, 42, 48,
-/* 0x2f90 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 50, 32, 77,
-/* 0x2fa0 */  82, 85, 65, 82, 66, 56, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32,
-/* 0x2fb0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56,102, 32, 32, 50, 42,
-/* 0x2fc0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 51,
-/* 0x2fd0 */  32, 77, 82, 85, 66, 73, 84, 83, 54, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2fe0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 57, 48, 32, 32,
-/* 0x2ff0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3000 */  48, 52, 32, 77, 82, 85, 65, 82, 66, 57, 48, 32, 32, 32, 32, 32,
-/* 0x3010 */  32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 57, 50,
-/* 0x3020 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3030 */  10, 49, 48, 53, 32, 76, 88, 77, 82, 85, 49, 48, 48, 32, 32, 32,
-/* 0x3040 */  32, 32, 32, 48, 49, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3050 */  57, 57, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3060 */  78, 84, 83, 10, 49, 48, 54, 32, 76, 88, 85, 78, 70, 48, 52, 48,
-/* 0x3070 */  32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3080 */  48, 49, 57, 97, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3090 */  84, 69, 78, 84, 83, 10, 49, 48, 55, 32, 76, 88, 77, 82, 85, 49,
-/* 0x30a0 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48,
-/* 0x30b0 */  32, 32, 48, 49, 57, 97, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x30c0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 56, 32, 76, 88, 77, 82,
-/* 0x30d0 */  85, 49, 49, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x30e0 */  32, 48, 32, 32, 48, 49, 57, 97,101, 32, 32, 50, 42, 42, 48, 32,
-/* 0x30f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 57, 32, 76, 88,
-/* 0x3100 */  85, 78, 70, 48, 52, 49, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32,
-/* 0x3110 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 48, 32, 32, 50, 42, 42,
-/* 0x3120 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 48, 32,
-/* 0x3130 */  76, 88, 85, 78, 70, 48, 52, 50, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x3140 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 55, 32, 32, 50, 42,
-/* 0x3150 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 49,
-/* 0x3160 */  32, 76, 69, 88, 69, 67, 48, 49, 54, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3170 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 55, 32, 32,
-/* 0x3180 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3190 */  49, 50, 32, 76, 88, 77, 82, 85, 48, 49, 48, 32, 32, 32, 32, 32,
-/* 0x31a0 */  32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 99,
-/* 0x31b0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x31c0 */  10, 49, 49, 51, 32, 76, 88, 74, 77, 80, 65, 48, 48, 32, 32, 32,
-/* 0x31d0 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x31e0 */  98,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x31f0 */  84, 83, 10, 49, 49, 52, 32, 76, 88, 67, 65, 76, 76, 66, 48, 32,
-/* 0x3200 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3210 */  49, 57, 98,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3220 */  69, 78, 84, 83, 10, 49, 49, 53, 32, 76, 88, 85, 78, 70, 48, 50,
-/* 0x3230 */  49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3240 */  32, 48, 49, 57, 99, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3250 */  78, 84, 69, 78, 84, 83, 10, 49, 49, 54, 32, 76, 88, 77, 82, 85,
-/* 0x3260 */  48, 50, 50, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x3270 */  48, 32, 32, 48, 49, 57, 99, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3280 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 55, 32, 76, 88, 74,
-/* 0x3290 */  77, 80, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x32a0 */  32, 32, 48, 32, 32, 48, 49, 57, 99, 97, 32, 32, 50, 42, 42, 48,
-/* 0x32b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 56, 32, 76,
-/* 0x32c0 */  88, 67, 65, 76, 76, 66, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x32d0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99, 99, 32, 32, 50, 42,
-/* 0x32e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 57,
-/* 0x32f0 */  32, 77, 82, 85, 66, 73, 84, 83, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3300 */  49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99,101, 32, 32,
-/* 0x3310 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3320 */  50, 48, 32, 76, 88, 77, 82, 85, 48, 51, 48, 32, 32, 32, 32, 32,
-/* 0x3330 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99,102,
-/* 0x3340 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3350 */  10, 49, 50, 49, 32, 77, 82, 85, 66, 89, 84, 69, 49, 32, 32, 32,
-/* 0x3360 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x3370 */ 100, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3380 */  84, 83, 10, 49, 50, 50, 32, 77, 82, 85, 65, 82, 66, 49, 48, 32,
-/* 0x3390 */  32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x33a0 */  49, 57,100, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x33b0 */  69, 78, 84, 83, 10, 49, 50, 51, 32, 76, 88, 77, 82, 85, 48, 52,
-/* 0x33c0 */  48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x33d0 */  32, 48, 49, 57,100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x33e0 */  78, 84, 69, 78, 84, 83, 10, 49, 50, 52, 32, 76, 88, 85, 78, 70,
-/* 0x33f0 */  48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32,
-/* 0x3400 */  48, 32, 32, 48, 49, 57,100, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3410 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 53, 32, 76, 88, 74,
-/* 0x3420 */  67, 67, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48,
-/* 0x3430 */  32, 32, 48, 32, 32, 48, 49, 57,100, 99, 32, 32, 50, 42, 42, 48,
-/* 0x3440 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 54, 32, 76,
-/* 0x3450 */  88, 67, 74, 48, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x3460 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57,101, 52, 32, 32, 50, 42,
-/* 0x3470 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 55,
-/* 0x3480 */  32, 76, 88, 67, 74, 49, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3490 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,101, 54, 32, 32,
-/* 0x34a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x34b0 */  50, 56, 32, 76, 88, 67, 65, 76, 74, 77, 80, 32, 32, 32, 32, 32,
-/* 0x34c0 */  32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,101, 57,
-/* 0x34d0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x34e0 */  10, 49, 50, 57, 32, 76, 88, 67, 65, 76, 76, 48, 48, 32, 32, 32,
-/* 0x34f0 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x3500 */ 101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3510 */  84, 83, 10, 49, 51, 48, 32, 76, 88, 67, 65, 76, 76, 48, 49, 32,
-/* 0x3520 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3530 */  49, 57,101,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3540 */  69, 78, 84, 83, 10, 49, 51, 49, 32, 76, 88, 67, 74, 50, 77, 82,
-/* 0x3550 */  85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3560 */  32, 48, 49, 57,102, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3570 */  78, 84, 69, 78, 84, 83, 10, 49, 51, 50, 32, 76, 88, 67, 74, 52,
-/* 0x3580 */  77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x3590 */  48, 32, 32, 48, 49, 57,102, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x35a0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 51, 32, 76, 88, 67,
-/* 0x35b0 */  74, 54, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x35c0 */  32, 32, 48, 32, 32, 48, 49, 57,102, 53, 32, 32, 50, 42, 42, 48,
-/* 0x35d0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 52, 32, 76,
-/* 0x35e0 */  88, 67, 74, 55, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x35f0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 55, 32, 32, 50, 42,
-/* 0x3600 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 53,
-/* 0x3610 */  32, 76, 88, 67, 74, 56, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3620 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 57, 32, 32,
-/* 0x3630 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3640 */  51, 54, 32, 76, 88, 85, 78, 70, 48, 51, 52, 32, 32, 32, 32, 32,
-/* 0x3650 */  32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 99,
-/* 0x3660 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3670 */  10, 49, 51, 55, 32, 76, 88, 77, 82, 85, 48, 53, 53, 32, 32, 32,
-/* 0x3680 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3690 */  48, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x36a0 */  84, 83, 10, 49, 51, 56, 32, 77, 82, 85, 66, 89, 84, 69, 50, 32,
-/* 0x36b0 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x36c0 */  49, 97, 48, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x36d0 */  69, 78, 84, 83, 10, 49, 51, 57, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x36e0 */  50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x36f0 */  32, 48, 49, 97, 48, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3700 */  78, 84, 69, 78, 84, 83, 10, 49, 52, 48, 32, 77, 82, 85, 65, 82,
-/* 0x3710 */  66, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x3720 */  48, 32, 32, 48, 49, 97, 48,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3730 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 49, 32, 76, 88, 77,
-/* 0x3740 */  82, 85, 48, 53, 55, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48,
-/* 0x3750 */  32, 32, 48, 32, 32, 48, 49, 97, 49, 50, 32, 32, 50, 42, 42, 48,
-/* 0x3760 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 50, 32, 76,
-/* 0x3770 */  88, 77, 82, 85, 48, 53, 56, 32, 32, 32, 32, 32, 32, 48, 49, 32,
-/* 0x3780 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 56, 32, 32, 50, 42,
-/* 0x3790 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 51,
-/* 0x37a0 */  32, 76, 88, 85, 78, 70, 48, 51, 53, 32, 32, 32, 32, 32, 32, 48,
-/* 0x37b0 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 57, 32, 32,
-/* 0x37c0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x37d0 */  52, 52, 32, 99,116,111,107, 51, 50, 46, 48, 48, 32, 32, 32, 32,
-/* 0x37e0 */  32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49,102,
-/* 0x37f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3800 */  10, 49, 52, 53, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 32,
-/* 0x3810 */  32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3820 */  50, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3830 */  84, 83, 10, 49, 52, 54, 32, 99,116,111,107, 51, 50, 46, 50, 48,
-/* 0x3840 */  32, 32, 32, 32, 32, 48, 50, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3850 */  48, 49, 97, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3860 */  84, 69, 78, 84, 83, 10, 49, 52, 55, 32, 99,116,111,107, 51, 50,
-/* 0x3870 */  46, 51, 48, 32, 32, 32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48,
-/* 0x3880 */  32, 32, 48, 49, 97, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3890 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 56, 32, 99,116,111,107,
-/* 0x38a0 */  51, 50, 46, 52, 48, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x38b0 */  32, 48, 32, 32, 48, 49, 97, 53,101, 32, 32, 50, 42, 42, 48, 32,
-/* 0x38c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 57, 32, 67, 65,
-/* 0x38d0 */  76, 76, 84, 82, 48, 48, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32,
-/* 0x38e0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 54, 51, 32, 32, 50, 42,
-/* 0x38f0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 48,
-/* 0x3900 */  32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3910 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 55, 51, 32, 32,
-/* 0x3920 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3930 */  53, 49, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 32, 32, 32, 32,
-/* 0x3940 */  32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 55, 56,
-/* 0x3950 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3960 */  10, 49, 53, 50, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 32, 32,
-/* 0x3970 */  32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3980 */  55,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3990 */  84, 83, 10, 49, 53, 51, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32,
-/* 0x39a0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x39b0 */  49, 97, 56, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x39c0 */  69, 78, 84, 83, 10, 49, 53, 52, 32, 67, 84, 66, 83, 87, 65, 48,
-/* 0x39d0 */  49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x39e0 */  32, 48, 49, 97, 56, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x39f0 */  78, 84, 69, 78, 84, 83, 10, 49, 53, 53, 32, 67, 65, 76, 76, 84,
-/* 0x3a00 */  82, 48, 50, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32, 32, 48, 32,
-/* 0x3a10 */  32, 48, 32, 32, 48, 49, 97, 56, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3a20 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 54, 32, 67, 65,
-/* 0x3a30 */  76, 76, 84, 82, 49, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32,
-/* 0x3a40 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 57, 56, 32, 32, 50, 42, 42,
-/* 0x3a50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 55, 32,
-/* 0x3a60 */  67, 65, 76, 76, 84, 82, 69, 56, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x3a70 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 57,100, 32, 32, 50,
-/* 0x3a80 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53,
-/* 0x3a90 */  56, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 32, 32, 32, 32, 32,
-/* 0x3aa0 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 57,102, 32,
-/* 0x3ab0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3ac0 */  49, 53, 57, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32, 32, 32, 32,
-/* 0x3ad0 */  32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97,
-/* 0x3ae0 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3af0 */  83, 10, 49, 54, 48, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 32,
-/* 0x3b00 */  32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3b10 */  97, 97, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3b20 */  78, 84, 83, 10, 49, 54, 49, 32, 67, 65, 76, 76, 84, 82, 49, 50,
-/* 0x3b30 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3b40 */  48, 49, 97, 97, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3b50 */  84, 69, 78, 84, 83, 10, 49, 54, 50, 32, 67, 84, 66, 83, 72, 82,
-/* 0x3b60 */  49, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48,
-/* 0x3b70 */  32, 32, 48, 49, 97, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3b80 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 51, 32, 67, 84, 66, 82,
-/* 0x3b90 */  79, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x3ba0 */  32, 48, 32, 32, 48, 49, 97, 98, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3bb0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 52, 32, 67, 84,
-/* 0x3bc0 */  66, 83, 87, 65, 49, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32,
-/* 0x3bd0 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 98, 50, 32, 32, 50, 42, 42,
-/* 0x3be0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 53, 32,
-/* 0x3bf0 */  67, 65, 76, 76, 84, 82, 49, 51, 32, 32, 32, 32, 32, 32, 48, 55,
-/* 0x3c00 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 98, 55, 32, 32, 50,
-/* 0x3c10 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54,
-/* 0x3c20 */  54, 32, 76, 69, 88, 69, 67, 48, 49, 55, 32, 32, 32, 32, 32, 32,
-/* 0x3c30 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 98,101, 32,
-/* 0x3c40 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3c50 */  49, 54, 55, 32, 76, 69, 88, 69, 67, 48, 50, 48, 32, 32, 32, 32,
-/* 0x3c60 */  32, 32, 48, 99,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3c70 */  99, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3c80 */  84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58,
-/* 0x3c90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3ca0 */  32, 32, 76, 69, 88, 69, 67, 48, 48, 48, 32, 48, 32, 76, 69, 88,
-/* 0x3cb0 */  69, 67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3cc0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32,
-/* 0x3cd0 */  48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3ce0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x3cf0 */  65, 83, 49, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10,
-/* 0x3d00 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3d10 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 66, 68,
-/* 0x3d20 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3d30 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 48,
-/* 0x3d40 */  32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3d50 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69,
-/* 0x3d60 */  67, 51, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48,
-/* 0x3d70 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3d80 */  78, 50, 66, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 66, 68, 69,
-/* 0x3d90 */  67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3da0 */  32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 48, 32,
-/* 0x3db0 */  78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3dc0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x3dd0 */  54, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48,
-/* 0x3de0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3df0 */  50, 68, 83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x3e00 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3e10 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 48, 32, 78,
-/* 0x3e20 */  50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e30 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x3e40 */  48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3e50 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3e60 */  68, 68, 69, 67, 50, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 50,
-/* 0x3e70 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3e80 */ 100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50,
-/* 0x3e90 */  68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3ea0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48,
-/* 0x3eb0 */  32, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48,
-/* 0x3ec0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x3ed0 */  70, 65, 83, 54, 49, 32, 48, 32, 78, 50, 68, 70, 65, 83, 54, 49,
-/* 0x3ee0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3ef0 */  32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 68,
-/* 0x3f00 */  68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3f10 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32,
-/* 0x3f20 */  48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3f30 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x3f40 */  65, 83, 49, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10,
-/* 0x3f50 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3f60 */  32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 69, 68,
-/* 0x3f70 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3f80 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 32, 48,
-/* 0x3f90 */  32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3fa0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69,
-/* 0x3fb0 */  67, 51, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48,
-/* 0x3fc0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3fd0 */  78, 50, 69, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 69, 68, 69,
-/* 0x3fe0 */  67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3ff0 */  32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 48, 32,
-/* 0x4000 */  78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4010 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x4020 */  54, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 48, 48,
-/* 0x4030 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4040 */  88, 85, 78, 70, 48, 49, 48, 32, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x4050 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4060 */  32,100, 32, 32, 76, 88, 74, 67, 67, 48, 49, 48, 32, 48, 32, 76,
-/* 0x4070 */  88, 74, 67, 67, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4080 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x4090 */  55, 32, 48, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 48, 48, 48,
-/* 0x40a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x40b0 */  77, 82, 85, 48, 55, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 55,
-/* 0x40c0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x40d0 */ 100, 32, 32, 76, 88, 77, 82, 85, 49, 48, 48, 32, 48, 32, 76, 88,
-/* 0x40e0 */  77, 82, 85, 49, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x40f0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48,
-/* 0x4100 */  32, 48, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 48, 48, 48, 48,
-/* 0x4110 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x4120 */  78, 70, 48, 52, 50, 32, 48, 32, 76, 88, 85, 78, 70, 48, 52, 50,
-/* 0x4130 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4140 */  32, 32, 76, 88, 77, 82, 85, 48, 51, 48, 32, 48, 32, 76, 88, 77,
-/* 0x4150 */  82, 85, 48, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4160 */  32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 48, 32,
-/* 0x4170 */  48, 32, 76, 88, 85, 78, 70, 48, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4180 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74,
-/* 0x4190 */  56, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 56, 77, 82, 85, 10,
-/* 0x41a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x41b0 */  32, 76, 88, 85, 78, 70, 48, 51, 52, 32, 48, 32, 76, 88, 85, 78,
-/* 0x41c0 */  70, 48, 51, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x41d0 */  32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 32,
-/* 0x41e0 */  48, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 48, 48, 48, 48,
-/* 0x41f0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,
-/* 0x4200 */ 107, 51, 50, 46, 49, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46,
-/* 0x4210 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4220 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 32, 48, 32,
-/* 0x4230 */  99,116,111,107, 51, 50, 46, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4240 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51,
-/* 0x4250 */  50, 46, 52, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x4260 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4270 */  32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 48, 32, 67, 65, 76,
-/* 0x4280 */  76, 84, 82, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4290 */  32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32,
-/* 0x42a0 */  48, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x42b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x42c0 */  84, 82, 49, 49, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10,
-/* 0x42d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x42e0 */  32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 48, 32, 67, 65, 76, 76,
-/* 0x42f0 */  84, 82, 49, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4300 */  32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 50, 48, 32, 48,
-/* 0x4310 */  32, 76, 69, 88, 69, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4320 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67,
-/* 0x4330 */  48, 48, 57, 32, 48, 32, 76, 69, 88, 69, 67, 48, 48, 57, 10, 48,
-/* 0x4340 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4350 */  76, 69, 88, 69, 67, 48, 49, 48, 32, 48, 32, 76, 69, 88, 69, 67,
-/* 0x4360 */  48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4370 */  32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 48, 32,
-/* 0x4380 */  78, 50, 66, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4390 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x43a0 */  50, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 50, 48, 10, 48, 48,
-/* 0x43b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x43c0 */  50, 66, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x43d0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x43e0 */  32,100, 32, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 48, 32, 78,
-/* 0x43f0 */  50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4400 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 51,
-/* 0x4410 */  48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 51, 48, 10, 48, 48, 48,
-/* 0x4420 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4430 */  66, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 52,
-/* 0x4440 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4450 */ 100, 32, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50,
-/* 0x4460 */  66, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4470 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 53, 48,
-/* 0x4480 */  32, 48, 32, 78, 50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48,
-/* 0x4490 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x44a0 */  70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 53, 48,
-/* 0x44b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x44c0 */  32, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 66,
-/* 0x44d0 */  83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x44e0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32,
-/* 0x44f0 */  48, 32, 78, 50, 66, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4500 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x4510 */  65, 83, 49, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10,
-/* 0x4520 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4530 */  32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 68, 83,
-/* 0x4540 */  77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4550 */  32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 48,
-/* 0x4560 */  32, 78, 50, 68, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4570 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77,
-/* 0x4580 */  65, 51, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10, 48,
-/* 0x4590 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x45a0 */  78, 50, 68, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 68, 70, 65,
-/* 0x45b0 */  83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x45c0 */  32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 48, 32,
-/* 0x45d0 */  78, 50, 68, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x45e0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x45f0 */  52, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 52, 48, 10, 48, 48,
-/* 0x4600 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x4610 */  50, 68, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x4620 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4630 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 48, 32, 78,
-/* 0x4640 */  50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4650 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 54,
-/* 0x4660 */  48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 54, 48, 10, 48, 48, 48,
-/* 0x4670 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4680 */  68, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 54,
-/* 0x4690 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x46a0 */ 100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50,
-/* 0x46b0 */  69, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x46c0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 50, 48,
-/* 0x46d0 */  32, 48, 32, 78, 50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48,
-/* 0x46e0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x46f0 */  70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 50, 48,
-/* 0x4700 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4710 */  32, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 69,
-/* 0x4720 */  83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4730 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32,
-/* 0x4740 */  48, 32, 78, 50, 69, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4750 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83,
-/* 0x4760 */  77, 65, 52, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10,
-/* 0x4770 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4780 */  32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 69, 70,
-/* 0x4790 */  65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x47a0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 48,
-/* 0x47b0 */  32, 78, 50, 69, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x47c0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65,
-/* 0x47d0 */  83, 53, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10, 48,
-/* 0x47e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x47f0 */  78, 50, 69, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 69, 83, 77,
-/* 0x4800 */  65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4810 */  32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 48, 32,
-/* 0x4820 */  78, 50, 69, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4830 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x4840 */  69, 67, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48,
-/* 0x4850 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4860 */ 100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32,
-/* 0x4870 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4880 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x4890 */  95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x48a0 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x48b0 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x48c0 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x48d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x48e0 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x48f0 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4900 */  32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 53, 32,
-/* 0x4910 */  48, 32, 76, 69, 88, 69, 67, 48, 49, 53, 10, 48, 48, 48, 48, 48,
-/* 0x4920 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x4930 */  70, 48, 48, 48, 32, 48, 32, 76, 88, 85, 78, 70, 48, 48, 48, 10,
-/* 0x4940 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4950 */  32, 76, 88, 85, 78, 70, 48, 48, 50, 32, 48, 32, 76, 88, 85, 78,
-/* 0x4960 */  70, 48, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4970 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 48, 32, 48,
-/* 0x4980 */  32, 77, 82, 85, 66, 89, 84, 69, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4990 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x49a0 */  48, 48, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48, 48, 53, 10, 48,
-/* 0x49b0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x49c0 */  76, 88, 77, 82, 85, 48, 48, 54, 32, 48, 32, 76, 88, 77, 82, 85,
-/* 0x49d0 */  48, 48, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x49e0 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 48, 55, 32, 48, 32,
-/* 0x49f0 */  76, 88, 77, 82, 85, 48, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x4a10 */  48, 56, 32, 48, 32, 76, 88, 85, 78, 70, 48, 48, 56, 10, 48, 48,
-/* 0x4a20 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4a30 */  88, 77, 82, 85, 48, 52, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4a40 */  52, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4a50 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 52, 54, 32, 48, 32, 76,
-/* 0x4a60 */  88, 77, 82, 85, 48, 52, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a70 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50,
-/* 0x4a80 */  48, 32, 48, 32, 76, 88, 74, 67, 67, 48, 50, 48, 10, 48, 48, 48,
-/* 0x4a90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x4aa0 */  74, 67, 67, 48, 50, 49, 32, 48, 32, 76, 88, 74, 67, 67, 48, 50,
-/* 0x4ab0 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4ac0 */ 100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 51, 32, 48, 32, 76, 88,
-/* 0x4ad0 */  74, 67, 67, 48, 50, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4ae0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51, 56, 54,
-/* 0x4af0 */  32, 48, 32, 76, 88, 85, 78, 70, 51, 56, 54, 10, 48, 48, 48, 48,
-/* 0x4b00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x4b10 */  78, 70, 51, 56, 55, 32, 48, 32, 76, 88, 85, 78, 70, 51, 56, 55,
-/* 0x4b20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4b30 */  32, 32, 76, 88, 85, 78, 70, 51, 56, 56, 32, 48, 32, 76, 88, 85,
-/* 0x4b40 */  78, 70, 51, 56, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4b50 */  32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 52, 56, 54, 32,
-/* 0x4b60 */  48, 32, 76, 88, 85, 78, 70, 52, 56, 54, 10, 48, 48, 48, 48, 48,
-/* 0x4b70 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x4b80 */  70, 52, 56, 55, 32, 48, 32, 76, 88, 85, 78, 70, 52, 56, 55, 10,
-/* 0x4b90 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4ba0 */  32, 76, 88, 77, 82, 85, 48, 54, 53, 32, 48, 32, 76, 88, 77, 82,
-/* 0x4bb0 */  85, 48, 54, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4bc0 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 51, 32, 48,
-/* 0x4bd0 */  32, 77, 82, 85, 66, 89, 84, 69, 51, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4be0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82,
-/* 0x4bf0 */  66, 51, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 51, 48, 10, 48,
-/* 0x4c00 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4c10 */  77, 82, 85, 66, 73, 84, 83, 51, 32, 48, 32, 77, 82, 85, 66, 73,
-/* 0x4c20 */  84, 83, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4c30 */  32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 52, 48, 32, 48, 32,
-/* 0x4c40 */  77, 82, 85, 65, 82, 66, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c50 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84,
-/* 0x4c60 */  69, 52, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 52, 10, 48, 48,
-/* 0x4c70 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77,
-/* 0x4c80 */  82, 85, 66, 73, 84, 83, 52, 32, 48, 32, 77, 82, 85, 66, 73, 84,
-/* 0x4c90 */  83, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4ca0 */  32,100, 32, 32, 77, 82, 85, 65, 82, 66, 53, 48, 32, 48, 32, 77,
-/* 0x4cb0 */  82, 85, 65, 82, 66, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4cc0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 56,
-/* 0x4cd0 */  48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 56, 48, 10, 48, 48, 48,
-/* 0x4ce0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x4cf0 */  85, 66, 89, 84, 69, 53, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x4d00 */  53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4d10 */ 100, 32, 32, 77, 82, 85, 65, 82, 66, 54, 48, 32, 48, 32, 77, 82,
-/* 0x4d20 */  85, 65, 82, 66, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4d30 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 53,
-/* 0x4d40 */  32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 53, 10, 48, 48, 48, 48,
-/* 0x4d50 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x4d60 */  65, 82, 66, 55, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 55, 48,
-/* 0x4d70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4d80 */  32, 32, 76, 88, 77, 82, 85, 48, 57, 48, 32, 48, 32, 76, 88, 77,
-/* 0x4d90 */  82, 85, 48, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4da0 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 54, 32,
-/* 0x4db0 */  48, 32, 77, 82, 85, 66, 89, 84, 69, 54, 10, 48, 48, 48, 48, 48,
-/* 0x4dc0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65,
-/* 0x4dd0 */  82, 66, 56, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 56, 48, 10,
-/* 0x4de0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4df0 */  32, 77, 82, 85, 66, 73, 84, 83, 54, 32, 48, 32, 77, 82, 85, 66,
-/* 0x4e00 */  73, 84, 83, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4e10 */  32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 57, 48, 32, 48,
-/* 0x4e20 */  32, 77, 82, 85, 65, 82, 66, 57, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4e30 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x4e40 */  49, 49, 48, 32, 48, 32, 76, 88, 77, 82, 85, 49, 49, 48, 10, 48,
-/* 0x4e50 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4e60 */  76, 88, 77, 82, 85, 49, 49, 49, 32, 48, 32, 76, 88, 77, 82, 85,
-/* 0x4e70 */  49, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4e80 */  32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 49, 32, 48, 32,
-/* 0x4e90 */  76, 88, 85, 78, 70, 48, 52, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ea0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x4eb0 */  49, 54, 32, 48, 32, 76, 69, 88, 69, 67, 48, 49, 54, 10, 48, 48,
-/* 0x4ec0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4ed0 */  88, 77, 82, 85, 48, 49, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4ee0 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4ef0 */  32,100, 32, 32, 76, 88, 74, 77, 80, 65, 48, 48, 32, 48, 32, 76,
-/* 0x4f00 */  88, 74, 77, 80, 65, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f10 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 66,
-/* 0x4f20 */  48, 32, 48, 32, 76, 88, 67, 65, 76, 76, 66, 48, 10, 48, 48, 48,
-/* 0x4f30 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x4f40 */  85, 78, 70, 48, 50, 49, 32, 48, 32, 76, 88, 85, 78, 70, 48, 50,
-/* 0x4f50 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4f60 */ 100, 32, 32, 76, 88, 77, 82, 85, 48, 50, 50, 32, 48, 32, 76, 88,
-/* 0x4f70 */  77, 82, 85, 48, 50, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4f80 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 77, 80, 65, 48, 49,
-/* 0x4f90 */  32, 48, 32, 76, 88, 74, 77, 80, 65, 48, 49, 10, 48, 48, 48, 48,
-/* 0x4fa0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67,
-/* 0x4fb0 */  65, 76, 76, 66, 49, 32, 48, 32, 76, 88, 67, 65, 76, 76, 66, 49,
-/* 0x4fc0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4fd0 */  32, 32, 77, 82, 85, 66, 73, 84, 83, 49, 32, 48, 32, 77, 82, 85,
-/* 0x4fe0 */  66, 73, 84, 83, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4ff0 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 49, 32,
-/* 0x5000 */  48, 32, 77, 82, 85, 66, 89, 84, 69, 49, 10, 48, 48, 48, 48, 48,
-/* 0x5010 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65,
-/* 0x5020 */  82, 66, 49, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 49, 48, 10,
-/* 0x5030 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5040 */  32, 76, 88, 77, 82, 85, 48, 52, 48, 32, 48, 32, 76, 88, 77, 82,
-/* 0x5050 */  85, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5060 */  32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 48, 48, 32, 48,
-/* 0x5070 */  32, 76, 88, 74, 67, 67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5080 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 48,
-/* 0x5090 */  77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 48, 77, 82, 85, 10, 48,
-/* 0x50a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x50b0 */  76, 88, 67, 74, 49, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 49,
-/* 0x50c0 */  77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x50d0 */  32, 32,100, 32, 32, 76, 88, 67, 65, 76, 74, 77, 80, 32, 48, 32,
-/* 0x50e0 */  76, 88, 67, 65, 76, 74, 77, 80, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x50f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76,
-/* 0x5100 */  48, 48, 32, 48, 32, 76, 88, 67, 65, 76, 76, 48, 48, 10, 48, 48,
-/* 0x5110 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x5120 */  88, 67, 65, 76, 76, 48, 49, 32, 48, 32, 76, 88, 67, 65, 76, 76,
-/* 0x5130 */  48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5140 */  32,100, 32, 32, 76, 88, 67, 74, 50, 77, 82, 85, 32, 48, 32, 76,
-/* 0x5150 */  88, 67, 74, 50, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5160 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 52, 77, 82,
-/* 0x5170 */  85, 32, 48, 32, 76, 88, 67, 74, 52, 77, 82, 85, 10, 48, 48, 48,
-/* 0x5180 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x5190 */  67, 74, 54, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 54, 77, 82,
-/* 0x51a0 */  85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x51b0 */ 100, 32, 32, 76, 88, 67, 74, 55, 77, 82, 85, 32, 48, 32, 76, 88,
-/* 0x51c0 */  67, 74, 55, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x51d0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 53, 53,
-/* 0x51e0 */  32, 48, 32, 76, 88, 77, 82, 85, 48, 53, 53, 10, 48, 48, 48, 48,
-/* 0x51f0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x5200 */  66, 89, 84, 69, 50, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 50,
-/* 0x5210 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5220 */  32, 32, 77, 82, 85, 66, 73, 84, 83, 50, 32, 48, 32, 77, 82, 85,
-/* 0x5230 */  66, 73, 84, 83, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5240 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 50, 48, 32,
-/* 0x5250 */  48, 32, 77, 82, 85, 65, 82, 66, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5260 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x5270 */  85, 48, 53, 55, 32, 48, 32, 76, 88, 77, 82, 85, 48, 53, 55, 10,
-/* 0x5280 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5290 */  32, 76, 88, 77, 82, 85, 48, 53, 56, 32, 48, 32, 76, 88, 77, 82,
-/* 0x52a0 */  85, 48, 53, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x52b0 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 53, 32, 48,
-/* 0x52c0 */  32, 76, 88, 85, 78, 70, 48, 51, 53, 10, 48, 48, 48, 48, 48, 48,
-/* 0x52d0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51,
-/* 0x52e0 */  50, 46, 51, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 51, 48,
-/* 0x52f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5300 */  32, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 48, 32, 67, 84, 67,
-/* 0x5310 */  76, 69, 86, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5320 */  32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32,
-/* 0x5330 */  48, 32, 67, 65, 76, 76, 84, 82, 48, 49, 10, 48, 48, 48, 48, 48,
-/* 0x5340 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83,
-/* 0x5350 */  72, 82, 48, 49, 32, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10,
-/* 0x5360 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5370 */  32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 48, 32, 67, 84, 66, 82,
-/* 0x5380 */  79, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5390 */  32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 48,
-/* 0x53a0 */  32, 67, 84, 66, 83, 87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x53b0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84,
-/* 0x53c0 */  82, 48, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 50, 10, 48,
-/* 0x53d0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x53e0 */  67, 65, 76, 76, 84, 82, 69, 56, 32, 48, 32, 67, 65, 76, 76, 84,
-/* 0x53f0 */  82, 69, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5400 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 48, 32,
-/* 0x5410 */  67, 65, 76, 76, 84, 82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5420 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86,
-/* 0x5430 */  69, 50, 32, 48, 32, 67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48,
-/* 0x5440 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x5450 */  65, 76, 76, 84, 82, 49, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x5460 */  49, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5470 */  32,100, 32, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 48, 32, 67,
-/* 0x5480 */  84, 66, 83, 72, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5490 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 49,
-/* 0x54a0 */  49, 32, 48, 32, 67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48,
-/* 0x54b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x54c0 */  66, 83, 87, 65, 49, 49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 49,
-/* 0x54d0 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x54e0 */ 100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 55, 32, 48, 32, 76, 69,
-/* 0x54f0 */  88, 69, 67, 48, 49, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5500 */ 103, 32, 32, 32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48, 48, 48,
-/* 0x5510 */  32, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5520 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x5530 */  32, 48, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,
-/* 0x5540 */ 106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x5550 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,
-/* 0x5560 */ 109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5570 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x5580 */  48, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48,
-/* 0x5590 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x55a0 */  78, 68, 42, 32, 48, 32,108,122,109, 97, 95,112,114,111,112,101,
-/* 0x55b0 */ 114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x55c0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 78,
-/* 0x55d0 */  77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x55e0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,108,
-/* 0x55f0 */ 116,101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48,
-/* 0x5600 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x5610 */  42, 32, 48, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 10,
-/* 0x5620 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5630 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 48, 48,
-/* 0x5640 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5650 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5660 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x5670 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x5680 */  69, 88, 69, 67, 48, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5690 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x56a0 */  91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x56b0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x56c0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x56d0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x56e0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x56f0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5700 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83,
-/* 0x5710 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5720 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5730 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x5740 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5750 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5760 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5770 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70,
-/* 0x5780 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5790 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x57a0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x57b0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x57c0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x57d0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x57e0 */  65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x57f0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5800 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x5810 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5820 */  32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76,
-/* 0x5830 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5840 */  70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93, 58, 10,
-/* 0x5850 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5860 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5870 */  10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5880 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x5890 */  69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x58a0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x58b0 */  66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x58c0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x58d0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x58e0 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x58f0 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x5900 */  48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5910 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50,
-/* 0x5920 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5930 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 68, 69,
-/* 0x5940 */  67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5950 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5960 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32,
-/* 0x5970 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5980 */  32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5990 */  48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x59a0 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 10,
-/* 0x59b0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x59c0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x59d0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x59e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x59f0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x5a00 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5a10 */  50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5a20 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5a30 */  91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5a40 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a50 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5a60 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5a70 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x5a80 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5a90 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x5aa0 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5ab0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5ac0 */  66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5ad0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ae0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5af0 */  48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x5b00 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x5b10 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5b20 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 48, 93,
-/* 0x5b30 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5b40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5b50 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x5b60 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5b70 */  66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32,
-/* 0x5b80 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x5b90 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5ba0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5bb0 */  79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x5bc0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5bd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5be0 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5bf0 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x5c00 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5c10 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x5c20 */  83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5c30 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c40 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5c50 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5c60 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x5c70 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5c80 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48, 93, 58,
-/* 0x5c90 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5ca0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5cb0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x5cc0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x5cd0 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5ce0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5cf0 */  50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5d00 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d10 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5d20 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5d30 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 10,
-/* 0x5d40 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5d50 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 50, 48,
-/* 0x5d60 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5d70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5d80 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x5d90 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5da0 */  50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5db0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5dc0 */  91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5dd0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5de0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5df0 */  48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5e00 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x5e10 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5e20 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83,
-/* 0x5e30 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5e40 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e50 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0x5e60 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e70 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5e80 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5e90 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x5ea0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5eb0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51, 48, 93,
-/* 0x5ec0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5ed0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5ee0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56,
-/* 0x5ef0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5f00 */  68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32,
-/* 0x5f10 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f20 */  32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5f30 */  48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5f40 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 10,
-/* 0x5f50 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5f60 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 52, 48,
-/* 0x5f70 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5f80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5f90 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x5fa0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5fb0 */  50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5fc0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5fd0 */  91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5fe0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ff0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6000 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6010 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x6020 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6030 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x6040 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6050 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x6060 */  68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6070 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6080 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6090 */  48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x60a0 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x60b0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x60c0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 48, 93,
-/* 0x60d0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x60e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x60f0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x6100 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x6110 */  68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32,
-/* 0x6120 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x6130 */  32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x6140 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6150 */  79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x6160 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6180 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6190 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x61a0 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x61b0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x61c0 */  83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x61d0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x61e0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x61f0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6200 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x6210 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6220 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48, 93, 58,
-/* 0x6230 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6240 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6250 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x6260 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x6270 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6280 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x6290 */  50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x62a0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x62b0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x62c0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x62d0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 10,
-/* 0x62e0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x62f0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 50, 48,
-/* 0x6300 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6310 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6320 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x6330 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6340 */  50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6350 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6360 */  91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6370 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6380 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6390 */  48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x63a0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x63b0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x63c0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83,
-/* 0x63d0 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x63e0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63f0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0x6400 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6410 */  32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6420 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6430 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x6440 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6450 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51, 48, 93,
-/* 0x6460 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6470 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6480 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56,
-/* 0x6490 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x64a0 */  69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,101, 32,
-/* 0x64b0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64c0 */  32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x64d0 */  48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x64e0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 10,
-/* 0x64f0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6500 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 52, 48,
-/* 0x6510 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6520 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6530 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x6540 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6550 */  50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6560 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6570 */  91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6580 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6590 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x65a0 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x65b0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x65c0 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x65d0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x65e0 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x65f0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x6600 */  69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6610 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6620 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6630 */  48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x6640 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x6650 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6660 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 48, 93,
-/* 0x6670 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6680 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6690 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x66a0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x66b0 */  69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32,
-/* 0x66c0 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x66d0 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x66e0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x66f0 */  79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x6700 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6710 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6720 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6730 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x6740 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6750 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77,
-/* 0x6760 */  65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6770 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6780 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6790 */  48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x67a0 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,107,
-/* 0x67b0 */  95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 49, 52,
-/* 0x67c0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x67d0 */  32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48,
-/* 0x67e0 */  48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x67f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99, 95,
-/* 0x6800 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 97, 32, 82, 95, 51,
-/* 0x6810 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x6820 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 10,
-/* 0x6830 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6840 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 48, 48,
-/* 0x6850 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6860 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6870 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x6880 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x6890 */  88, 85, 78, 70, 48, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x68a0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x68b0 */  91, 76, 88, 77, 82, 85, 48, 48, 53, 93, 58, 10, 79, 70, 70, 83,
-/* 0x68c0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x68d0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x68e0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x68f0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 77, 82, 85, 10, 10, 82, 69,
-/* 0x6900 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6910 */  32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 49, 48, 93, 58,
-/* 0x6920 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6930 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6940 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x6950 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85,
-/* 0x6960 */  78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6970 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x6980 */  88, 74, 67, 67, 48, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6990 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x69a0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x69b0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x69c0 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10,
-/* 0x69d0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x69e0 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48, 50, 49,
-/* 0x69f0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6a00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6a10 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x6a20 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x6a30 */  88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6a40 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6a50 */  91, 76, 88, 85, 78, 70, 51, 56, 56, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6a60 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a70 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6a80 */  48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6a90 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48,
-/* 0x6aa0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6ab0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 52,
-/* 0x6ac0 */  56, 55, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6ad0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ae0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x6af0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6b00 */  32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6b10 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6b20 */  82, 32, 91, 76, 88, 77, 82, 85, 48, 54, 53, 93, 58, 10, 79, 70,
-/* 0x6b30 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6b40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6b50 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6b60 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x6b70 */  55, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6b80 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82,
-/* 0x6b90 */  85, 48, 55, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6ba0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6bb0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x6bc0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6bd0 */  32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76,
-/* 0x6be0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6bf0 */  70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 57, 48, 93, 58, 10,
-/* 0x6c00 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6c10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6c20 */  10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6c30 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82,
-/* 0x6c40 */  85, 49, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6c50 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0x6c60 */  85, 78, 70, 48, 52, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6c70 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c80 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6c90 */  48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6ca0 */  32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82,
-/* 0x6cb0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6cc0 */  83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 49, 54, 93,
-/* 0x6cd0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6ce0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6cf0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x6d00 */  54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x6d10 */  85, 78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6d20 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6d30 */  76, 88, 77, 82, 85, 48, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6d40 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6d50 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6d60 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6d70 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48, 51, 48, 10,
-/* 0x6d80 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6d90 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48, 48,
-/* 0x6da0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6db0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6dc0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95,
-/* 0x6dd0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6de0 */  76, 88, 74, 67, 67, 48, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6df0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6e00 */  32, 91, 76, 88, 67, 65, 76, 76, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6e10 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6e20 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6e30 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6e40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x6e50 */  55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6e60 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 50,
-/* 0x6e70 */  77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6e80 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e90 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x6ea0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6eb0 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69, 76, 79,
-/* 0x6ec0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6ed0 */  79, 82, 32, 91, 76, 88, 67, 74, 52, 77, 82, 85, 93, 58, 10, 79,
-/* 0x6ee0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6ef0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6f00 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6f10 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70,
-/* 0x6f20 */  48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6f30 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67,
-/* 0x6f40 */  74, 54, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6f50 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f60 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6f70 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6f80 */  32, 32, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85, 10, 10, 82, 69,
-/* 0x6f90 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6fa0 */  32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 55, 77, 82, 85, 93, 58,
-/* 0x6fb0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6fc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6fd0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x6fe0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 67,
-/* 0x6ff0 */  74, 56, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7000 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x7010 */  88, 67, 74, 56, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7020 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7030 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7040 */  48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7050 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10,
-/* 0x7060 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x7070 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 51, 52,
-/* 0x7080 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7090 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x70a0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x70b0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x70c0 */  88, 85, 78, 70, 48, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x70d0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x70e0 */  91, 99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x70f0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7100 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7110 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7120 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46,
-/* 0x7130 */  50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7140 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107,
-/* 0x7150 */  51, 50, 46, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7160 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7170 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7180 */ 100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7190 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82,
-/* 0x71a0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x71b0 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 50, 48,
-/* 0x71c0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x71d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x71e0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51,
-/* 0x71f0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x7200 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7210 */  97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7220 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48,
-/* 0x7230 */  48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7240 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46,
-/* 0x7250 */  52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7260 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107,
-/* 0x7270 */  51, 50, 46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7280 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7290 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x72a0 */  52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x72b0 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48,
-/* 0x72c0 */  48, 48, 48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x72d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46,
-/* 0x72e0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x72f0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107,
-/* 0x7300 */  51, 50, 46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7310 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7320 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7330 */  52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7340 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 10, 82,
-/* 0x7350 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7360 */  83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 48, 93,
-/* 0x7370 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x7380 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x7390 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x73a0 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,
-/* 0x73b0 */ 108,116,101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76,
-/* 0x73c0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x73d0 */  70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 49, 93, 58, 10,
-/* 0x73e0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x73f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7400 */  10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7410 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,
-/* 0x7420 */ 101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x7430 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7440 */  32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79,
-/* 0x7450 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x7460 */  79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 50, 93, 58, 10, 79,
-/* 0x7470 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x7480 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7490 */  48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x74a0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84,
-/* 0x74b0 */  82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x74c0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76,
-/* 0x74d0 */  76, 84, 82, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x74e0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74f0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7500 */  49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x7510 */  32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,
-/* 0x7520 */ 104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7530 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84,
-/* 0x7540 */  82, 49, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7550 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7560 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x7570 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7580 */  32, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 10, 82, 69, 76, 79,
-/* 0x7590 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x75a0 */  79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 50, 93, 58, 10, 79,
-/* 0x75b0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x75c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x75d0 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56,
-/* 0x75e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x75f0 */ 114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x7600 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7610 */  32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7620 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7630 */  82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 51, 93, 58, 10, 79, 70,
-/* 0x7640 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7650 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7660 */  48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7670 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x7680 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7690 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69,
-/* 0x76a0 */  67, 48, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x76b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x76c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x76d0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x76e0 */  32, 32, 32, 76, 69, 88, 69, 67, 48, 50, 48, 10, 48, 48, 48, 48,
-/* 0x76f0 */  48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x7700 */  32, 32, 32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48, 48, 48, 10,
-/* 0x7710 */  48, 48, 48, 48, 48, 48, 51, 50, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x7720 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 69, 88, 69, 67,
-/* 0x7730 */  48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 51, 56, 32, 82, 95, 51,
-/* 0x7740 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x7750 */  69, 88, 69, 67, 48, 48, 48, 10
+/* 0x1b80 */  97,195,184, 73,  0,  0,  0, 82, 90,137,225, 15, 52,168,  0,  0,
+/* 0x1b90 */   0,176,  0,  0,  0, 97,  0,  0,  0,122,  6,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   0, 52,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,
+/* 0x1bb0 */   0, 59,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,
+/* 0x1bc0 */   0, 59,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,
+/* 0x1bd0 */   0, 71,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,
+/* 0x1be0 */   0, 74,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,
+/* 0x1bf0 */   0, 76,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,
+/* 0x1c00 */   0, 82,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,
+/* 0x1c10 */   0, 93,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,
+/* 0x1c20 */   0, 98,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,
+/* 0x1c30 */   0,107,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,
+/* 0x1c40 */   0,120,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,
+/* 0x1c50 */   0,133,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,
+/* 0x1c60 */   0,148,  0,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,
+/* 0x1c70 */   0,210,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,
+/* 0x1c80 */   0,223,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,
+/* 0x1c90 */   0,238,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,
+/* 0x1ca0 */   0,240,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,
+/* 0x1cb0 */   0,243,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,
+/* 0x1cc0 */   0,252,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,
+/* 0x1cd0 */   0,  8,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,
+/* 0x1ce0 */   0, 33,  1,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,
+/* 0x1cf0 */   0, 55,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,
+/* 0x1d00 */   0, 55,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,
+/* 0x1d10 */   0, 58,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,
+/* 0x1d20 */   0, 60,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,
+/* 0x1d30 */   0, 66,  1,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,
+/* 0x1d40 */   0, 77,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,
+/* 0x1d50 */   0, 82,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,
+/* 0x1d60 */   0, 91,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,
+/* 0x1d70 */   0,104,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,
+/* 0x1d80 */   0,117,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,
+/* 0x1d90 */   0,132,  1,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,
+/* 0x1da0 */   0,214,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,
+/* 0x1db0 */   0,227,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,
+/* 0x1dc0 */   0,242,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,
+/* 0x1dd0 */   0,244,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,
+/* 0x1de0 */   0,247,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,
+/* 0x1df0 */   0,  0,  2,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,
+/* 0x1e00 */   0, 12,  2,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,
+/* 0x1e10 */   0, 37,  2,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,
+/* 0x1e20 */   0, 59,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,
+/* 0x1e30 */   0, 59,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,
+/* 0x1e40 */   0, 62,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,
+/* 0x1e50 */   0, 64,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,
+/* 0x1e60 */   0, 70,  2,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,
+/* 0x1e70 */   0, 81,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,
+/* 0x1e80 */   0, 86,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,
+/* 0x1e90 */   0, 95,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,
+/* 0x1ea0 */   0,108,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,
+/* 0x1eb0 */   0,121,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,
+/* 0x1ec0 */   0,136,  2,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,
+/* 0x1ed0 */   0,231,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,
+/* 0x1ee0 */   0,244,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,
+/* 0x1ef0 */   0,  3,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,
+/* 0x1f00 */   0,  5,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,
+/* 0x1f10 */   0,  8,  3,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,
+/* 0x1f20 */   0, 17,  3,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,
+/* 0x1f30 */   0, 29,  3,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,
+/* 0x1f40 */   0, 54,  3,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,
+/* 0x1f50 */   0, 76,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,
+/* 0x1f60 */   0, 76,  3,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0, 39,  2,  0,
+/* 0x1f70 */   0,122,  3,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0, 50,  2,  0,
+/* 0x1f80 */   0,194,  3,  0,  0,134, 10,  0,  0,  0,  0,  0,  0, 61,  2,  0,
+/* 0x1f90 */   0, 72, 14,  0,  0,134, 10,  0,  0,  0,  0,  0,  0, 72,  2,  0,
+/* 0x1fa0 */   0,206, 24,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0, 83,  2,  0,
+/* 0x1fb0 */   0,232, 24,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0, 92,  2,  0,
+/* 0x1fc0 */   0,  5, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,101,  2,  0,
+/* 0x1fd0 */   0,  7, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,110,  2,  0,
+/* 0x1fe0 */   0, 12, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,119,  2,  0,
+/* 0x1ff0 */   0, 14, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,128,  2,  0,
+/* 0x2000 */   0, 19, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,137,  2,  0,
+/* 0x2010 */   0, 26, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,146,  2,  0,
+/* 0x2020 */   0, 33, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,155,  2,  0,
+/* 0x2030 */   0, 37, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,164,  2,  0,
+/* 0x2040 */   0, 42, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,173,  2,  0,
+/* 0x2050 */   0, 45, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,182,  2,  0,
+/* 0x2060 */   0, 48, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,191,  2,  0,
+/* 0x2070 */   0, 50, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,200,  2,  0,
+/* 0x2080 */   0, 52, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,209,  2,  0,
+/* 0x2090 */   0, 57, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,218,  2,  0,
+/* 0x20a0 */   0, 64, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,227,  2,  0,
+/* 0x20b0 */   0, 66, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,236,  2,  0,
+/* 0x20c0 */   0, 67, 25,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,245,  2,  0,
+/* 0x20d0 */   0, 76, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,254,  2,  0,
+/* 0x20e0 */   0, 79, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  7,  3,  0,
+/* 0x20f0 */   0, 83, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 16,  3,  0,
+/* 0x2100 */   0, 85, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 25,  3,  0,
+/* 0x2110 */   0, 90, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 34,  3,  0,
+/* 0x2120 */   0, 92, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 43,  3,  0,
+/* 0x2130 */   0, 93, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 52,  3,  0,
+/* 0x2140 */   0, 95, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 61,  3,  0,
+/* 0x2150 */   0, 99, 25,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 70,  3,  0,
+/* 0x2160 */   0,107, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 79,  3,  0,
+/* 0x2170 */   0,110, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 88,  3,  0,
+/* 0x2180 */   0,112, 25,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 97,  3,  0,
+/* 0x2190 */   0,118, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,106,  3,  0,
+/* 0x21a0 */   0,121, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,115,  3,  0,
+/* 0x21b0 */   0,123, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,124,  3,  0,
+/* 0x21c0 */   0,124, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,133,  3,  0,
+/* 0x21d0 */   0,126, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,142,  3,  0,
+/* 0x21e0 */   0,130, 25,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,151,  3,  0,
+/* 0x21f0 */   0,141, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,160,  3,  0,
+/* 0x2200 */   0,143, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,169,  3,  0,
+/* 0x2210 */   0,144, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,178,  3,  0,
+/* 0x2220 */   0,146, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,187,  3,  0,
+/* 0x2230 */   0,150, 25,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,196,  3,  0,
+/* 0x2240 */   0,166, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,205,  3,  0,
+/* 0x2250 */   0,171, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,214,  3,  0,
+/* 0x2260 */   0,174, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,223,  3,  0,
+/* 0x2270 */   0,176, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,232,  3,  0,
+/* 0x2280 */   0,183, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,241,  3,  0,
+/* 0x2290 */   0,183, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,250,  3,  0,
+/* 0x22a0 */   0,188, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  3,  4,  0,
+/* 0x22b0 */   0,189, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 12,  4,  0,
+/* 0x22c0 */   0,191, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 21,  4,  0,
+/* 0x22d0 */   0,193, 25,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 30,  4,  0,
+/* 0x22e0 */   0,199, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 39,  4,  0,
+/* 0x22f0 */   0,202, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 48,  4,  0,
+/* 0x2300 */   0,204, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 57,  4,  0,
+/* 0x2310 */   0,206, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 66,  4,  0,
+/* 0x2320 */   0,207, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 75,  4,  0,
+/* 0x2330 */   0,209, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 84,  4,  0,
+/* 0x2340 */   0,211, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 93,  4,  0,
+/* 0x2350 */   0,212, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,102,  4,  0,
+/* 0x2360 */   0,214, 25,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,111,  4,  0,
+/* 0x2370 */   0,220, 25,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,120,  4,  0,
+/* 0x2380 */   0,228, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,129,  4,  0,
+/* 0x2390 */   0,230, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,138,  4,  0,
+/* 0x23a0 */   0,233, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,147,  4,  0,
+/* 0x23b0 */   0,236, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,156,  4,  0,
+/* 0x23c0 */   0,238, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,165,  4,  0,
+/* 0x23d0 */   0,241, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,174,  4,  0,
+/* 0x23e0 */   0,243, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,183,  4,  0,
+/* 0x23f0 */   0,245, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,192,  4,  0,
+/* 0x2400 */   0,247, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,201,  4,  0,
+/* 0x2410 */   0,249, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,210,  4,  0,
+/* 0x2420 */   0,252, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,219,  4,  0,
+/* 0x2430 */   0,  1, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,228,  4,  0,
+/* 0x2440 */   0,  3, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,237,  4,  0,
+/* 0x2450 */   0,  8, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,246,  4,  0,
+/* 0x2460 */   0, 13, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,255,  4,  0,
+/* 0x2470 */   0, 18, 26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  8,  5,  0,
+/* 0x2480 */   0, 24, 26,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 17,  5,  0,
+/* 0x2490 */   0, 25, 26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 26,  5,  0,
+/* 0x24a0 */   0, 31, 26,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 36,  5,  0,
+/* 0x24b0 */   0, 38, 26,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0, 46,  5,  0,
+/* 0x24c0 */   0, 52, 26,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 56,  5,  0,
+/* 0x24d0 */   0, 84, 26,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 66,  5,  0,
+/* 0x24e0 */   0, 94, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 76,  5,  0,
+/* 0x24f0 */   0, 99, 26,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0, 85,  5,  0,
+/* 0x2500 */   0,115, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 94,  5,  0,
+/* 0x2510 */   0,120, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,103,  5,  0,
+/* 0x2520 */   0,125, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,112,  5,  0,
+/* 0x2530 */   0,129, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,121,  5,  0,
+/* 0x2540 */   0,131, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,130,  5,  0,
+/* 0x2550 */   0,136, 26,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,139,  5,  0,
+/* 0x2560 */   0,152, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,148,  5,  0,
+/* 0x2570 */   0,157, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,157,  5,  0,
+/* 0x2580 */   0,159, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,166,  5,  0,
+/* 0x2590 */   0,161, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,175,  5,  0,
+/* 0x25a0 */   0,165, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,184,  5,  0,
+/* 0x25b0 */   0,170, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,193,  5,  0,
+/* 0x25c0 */   0,172, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,202,  5,  0,
+/* 0x25d0 */   0,176, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,211,  5,  0,
+/* 0x25e0 */   0,178, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,220,  5,  0,
+/* 0x25f0 */   0,183, 26,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,229,  5,  0,
+/* 0x2600 */   0,190, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,238,  5,  0,
+/* 0x2610 */   0,192, 26,  0,  0,205,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2620 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,  0, 45,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+/* 0x2640 */   0, 54,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,
+/* 0x2650 */   0,  9,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0, 12,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,  0,153,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,
+/* 0x2670 */   0,180,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,
+/* 0x2680 */   0, 21,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0, 22,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,  0,216,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,
+/* 0x26a0 */   0,225,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,
+/* 0x26b0 */   0, 28,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0, 31,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0,  0, 68,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,
+/* 0x26d0 */   0, 95,  1,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,
+/* 0x26e0 */   0, 40,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 41,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0,  0,131,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,
+/* 0x2700 */   0,140,  1,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,
+/* 0x2710 */   0, 47,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0, 50,  0,  0,
+/* 0x2720 */   0,  0,  0,  0,  0,239,  1,  0,  0, 55,  0,  0,  0,  0,  0,  0,
+/* 0x2730 */   0, 10,  2,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,
+/* 0x2740 */   0, 59,  0,  0,  0,  0,  0,  0,  0,155,  2,  0,  0, 73,  0,  0,
+/* 0x2750 */   0,  0,  0,  0,  0,164,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,
+/* 0x2760 */   0,218,  2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0, 61,  3,  0,
+/* 0x2770 */   0, 91,  0,  0,  0,  0,  0,  0,  0,187,  3,  0,  0,105,  0,  0,
+/* 0x2780 */   0,  0,  0,  0,  0,196,  3,  0,  0,106,  0,  0,  0,  0,  0,  0,
+/* 0x2790 */   0,232,  3,  0,  0,110,  0,  0,  0,  0,  0,  0,  0, 66,  4,  0,
+/* 0x27a0 */   0,120,  0,  0,  0,  0,  0,  0,  0,102,  4,  0,  0,124,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0,  0,201,  4,  0,  0,135,  0,  0,  0,  0,  0,  0,
+/* 0x27c0 */   0,210,  4,  0,  0,136,  0,  0,  0,  0,  0,  0,  0, 26,  5,  0,
+/* 0x27d0 */   0,144,  0,  0,  0,  0,  0,  0,  0, 36,  5,  0,  0,145,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0,  0, 46,  5,  0,  0,146,  0,  0,  0,  0,  0,  0,
+/* 0x27f0 */   0, 66,  5,  0,  0,148,  0,  0,  0,  0,  0,  0,  0, 76,  5,  0,
+/* 0x2800 */   0,149,  0,  0,  0,  0,  0,  0,  0,139,  5,  0,  0,156,  0,  0,
+/* 0x2810 */   0,  0,  0,  0,  0,166,  5,  0,  0,159,  0,  0,  0,  0,  0,  0,
+/* 0x2820 */   0,220,  5,  0,  0,165,  0,  0,  0,  0,  0,  0,  0,238,  5,  0,
+/* 0x2830 */   0,167,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,
+/* 0x2840 */   0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2850 */   0, 36,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,
+/* 0x2860 */   0,  7,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  8,  0,  0,
+/* 0x2870 */   0,  0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,
+/* 0x2880 */   0, 99,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,
+/* 0x2890 */   0, 13,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0, 14,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0,  0,135,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,
+/* 0x28b0 */   0,144,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,
+/* 0x28c0 */   0, 18,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0, 19,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0,  0,207,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,
+/* 0x28e0 */   0,234,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,
+/* 0x28f0 */   0, 27,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0, 29,  0,  0,
+/* 0x2900 */   0,  0,  0,  0,  0, 14,  1,  0,  0, 30,  0,  0,  0,  0,  0,  0,
+/* 0x2910 */   0, 32,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,
+/* 0x2920 */   0, 33,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0, 34,  0,  0,
+/* 0x2930 */   0,  0,  0,  0,  0, 59,  1,  0,  0, 35,  0,  0,  0,  0,  0,  0,
+/* 0x2940 */   0, 77,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,
+/* 0x2950 */   0, 38,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0, 42,  0,  0,
+/* 0x2960 */   0,  0,  0,  0,  0,149,  1,  0,  0, 45,  0,  0,  0,  0,  0,  0,
+/* 0x2970 */   0,158,  1,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,
+/* 0x2980 */   0, 48,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0, 49,  0,  0,
+/* 0x2990 */   0,  0,  0,  0,  0,203,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,
+/* 0x29a0 */   0,212,  1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,
+/* 0x29b0 */   0, 53,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0, 54,  0,  0,
+/* 0x29c0 */   0,  0,  0,  0,  0,248,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,
+/* 0x29d0 */   0,  1,  2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,
+/* 0x29e0 */   0, 60,  0,  0,  0,  0,  0,  0,  0, 39,  2,  0,  0, 61,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0,  0, 50,  2,  0,  0, 62,  0,  0,  0,  0,  0,  0,
+/* 0x2a00 */   0, 61,  2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0, 72,  2,  0,
+/* 0x2a10 */   0, 64,  0,  0,  0,  0,  0,  0,  0, 83,  2,  0,  0, 65,  0,  0,
+/* 0x2a20 */   0,  0,  0,  0,  0, 92,  2,  0,  0, 66,  0,  0,  0,  0,  0,  0,
+/* 0x2a30 */   0,101,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,110,  2,  0,
+/* 0x2a40 */   0, 68,  0,  0,  0,  0,  0,  0,  0,119,  2,  0,  0, 69,  0,  0,
+/* 0x2a50 */   0,  0,  0,  0,  0,128,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,
+/* 0x2a60 */   0,137,  2,  0,  0, 71,  0,  0,  0,  0,  0,  0,  0,146,  2,  0,
+/* 0x2a70 */   0, 72,  0,  0,  0,  0,  0,  0,  0,173,  2,  0,  0, 75,  0,  0,
+/* 0x2a80 */   0,  0,  0,  0,  0,182,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,
+/* 0x2a90 */   0,191,  2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,200,  2,  0,
+/* 0x2aa0 */   0, 78,  0,  0,  0,  0,  0,  0,  0,209,  2,  0,  0, 79,  0,  0,
+/* 0x2ab0 */   0,  0,  0,  0,  0,227,  2,  0,  0, 81,  0,  0,  0,  0,  0,  0,
+/* 0x2ac0 */   0,236,  2,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,245,  2,  0,
+/* 0x2ad0 */   0, 83,  0,  0,  0,  0,  0,  0,  0,254,  2,  0,  0, 84,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  7,  3,  0,  0, 85,  0,  0,  0,  0,  0,  0,
+/* 0x2af0 */   0, 16,  3,  0,  0, 86,  0,  0,  0,  0,  0,  0,  0, 25,  3,  0,
+/* 0x2b00 */   0, 87,  0,  0,  0,  0,  0,  0,  0, 34,  3,  0,  0, 88,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0,  0, 43,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,
+/* 0x2b20 */   0, 52,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0, 70,  3,  0,
+/* 0x2b30 */   0, 92,  0,  0,  0,  0,  0,  0,  0, 79,  3,  0,  0, 93,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0,  0, 88,  3,  0,  0, 94,  0,  0,  0,  0,  0,  0,
+/* 0x2b50 */   0, 97,  3,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,106,  3,  0,
+/* 0x2b60 */   0, 96,  0,  0,  0,  0,  0,  0,  0,115,  3,  0,  0, 97,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0,  0,124,  3,  0,  0, 98,  0,  0,  0,  0,  0,  0,
+/* 0x2b80 */   0,133,  3,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,142,  3,  0,
+/* 0x2b90 */   0,100,  0,  0,  0,  0,  0,  0,  0,151,  3,  0,  0,101,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0,  0,160,  3,  0,  0,102,  0,  0,  0,  0,  0,  0,
+/* 0x2bb0 */   0,169,  3,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,178,  3,  0,
+/* 0x2bc0 */   0,104,  0,  0,  0,  0,  0,  0,  0,205,  3,  0,  0,107,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0,  0,214,  3,  0,  0,108,  0,  0,  0,  0,  0,  0,
+/* 0x2be0 */   0,223,  3,  0,  0,109,  0,  0,  0,  0,  0,  0,  0,241,  3,  0,
+/* 0x2bf0 */   0,111,  0,  0,  0,  0,  0,  0,  0,250,  3,  0,  0,112,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0,  0,  3,  4,  0,  0,113,  0,  0,  0,  0,  0,  0,
+/* 0x2c10 */   0, 12,  4,  0,  0,114,  0,  0,  0,  0,  0,  0,  0, 21,  4,  0,
+/* 0x2c20 */   0,115,  0,  0,  0,  0,  0,  0,  0, 30,  4,  0,  0,116,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0,  0, 39,  4,  0,  0,117,  0,  0,  0,  0,  0,  0,
+/* 0x2c40 */   0, 48,  4,  0,  0,118,  0,  0,  0,  0,  0,  0,  0, 57,  4,  0,
+/* 0x2c50 */   0,119,  0,  0,  0,  0,  0,  0,  0, 75,  4,  0,  0,121,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0,  0, 84,  4,  0,  0,122,  0,  0,  0,  0,  0,  0,
+/* 0x2c70 */   0, 93,  4,  0,  0,123,  0,  0,  0,  0,  0,  0,  0,111,  4,  0,
+/* 0x2c80 */   0,125,  0,  0,  0,  0,  0,  0,  0,120,  4,  0,  0,126,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0,  0,129,  4,  0,  0,127,  0,  0,  0,  0,  0,  0,
+/* 0x2ca0 */   0,138,  4,  0,  0,128,  0,  0,  0,  0,  0,  0,  0,147,  4,  0,
+/* 0x2cb0 */   0,129,  0,  0,  0,  0,  0,  0,  0,156,  4,  0,  0,130,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0,  0,165,  4,  0,  0,131,  0,  0,  0,  0,  0,  0,
+/* 0x2cd0 */   0,174,  4,  0,  0,132,  0,  0,  0,  0,  0,  0,  0,183,  4,  0,
+/* 0x2ce0 */   0,133,  0,  0,  0,  0,  0,  0,  0,192,  4,  0,  0,134,  0,  0,
+/* 0x2cf0 */   0,  0,  0,  0,  0,219,  4,  0,  0,137,  0,  0,  0,  0,  0,  0,
+/* 0x2d00 */   0,228,  4,  0,  0,138,  0,  0,  0,  0,  0,  0,  0,237,  4,  0,
+/* 0x2d10 */   0,139,  0,  0,  0,  0,  0,  0,  0,246,  4,  0,  0,140,  0,  0,
+/* 0x2d20 */   0,  0,  0,  0,  0,255,  4,  0,  0,141,  0,  0,  0,  0,  0,  0,
+/* 0x2d30 */   0,  8,  5,  0,  0,142,  0,  0,  0,  0,  0,  0,  0, 17,  5,  0,
+/* 0x2d40 */   0,143,  0,  0,  0,  0,  0,  0,  0, 56,  5,  0,  0,147,  0,  0,
+/* 0x2d50 */   0,  0,  0,  0,  0, 85,  5,  0,  0,150,  0,  0,  0,  0,  0,  0,
+/* 0x2d60 */   0, 94,  5,  0,  0,151,  0,  0,  0,  0,  0,  0,  0,103,  5,  0,
+/* 0x2d70 */   0,152,  0,  0,  0,  0,  0,  0,  0,112,  5,  0,  0,153,  0,  0,
+/* 0x2d80 */   0,  0,  0,  0,  0,121,  5,  0,  0,154,  0,  0,  0,  0,  0,  0,
+/* 0x2d90 */   0,130,  5,  0,  0,155,  0,  0,  0,  0,  0,  0,  0,148,  5,  0,
+/* 0x2da0 */   0,157,  0,  0,  0,  0,  0,  0,  0,157,  5,  0,  0,158,  0,  0,
+/* 0x2db0 */   0,  0,  0,  0,  0,175,  5,  0,  0,160,  0,  0,  0,  0,  0,  0,
+/* 0x2dc0 */   0,184,  5,  0,  0,161,  0,  0,  0,  0,  0,  0,  0,193,  5,  0,
+/* 0x2dd0 */   0,162,  0,  0,  0,  0,  0,  0,  0,202,  5,  0,  0,163,  0,  0,
+/* 0x2de0 */   0,  0,  0,  0,  0,211,  5,  0,  0,164,  0,  0,  0,  0,  0,  0,
+/* 0x2df0 */   0,229,  5,  0,  0,166,  0,  0,  0,  0,  0,  0,  0,247,  5,  0,
+/* 0x2e00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,254,  5,  0,  0,169,  0,  0,
+/* 0x2e10 */   0,173,222,173,222, 16,  6,  0,  0,169,  0,  0,  0,173,222,173,
+/* 0x2e20 */ 222, 27,  6,  0,  0,169,  0,  0,  0,173,222,173,222, 38,  6,  0,
+/* 0x2e30 */   0,169,  0,  0,  0,173,222,173,222, 54,  6,  0,  0,169,  0,  0,
+/* 0x2e40 */   0,173,222,173,222, 59,  6,  0,  0,169,  0,  0,  0,173,222,173,
+/* 0x2e50 */ 222, 73,  6,  0,  0,169,  0,  0,  0,173,222,173,222,  0,  0,  0,
+/* 0x2e60 */   0,  3,  0,  0,  0, 84,  6,  0,  0,238,  5,  0,  0,  0,  0,  0,
+/* 0x2e70 */   0,  0,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x2e80 */   0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
+/* 0x2e90 */   0,  1,  0,  0,  0, 95,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,
+/* 0x2ea0 */   0,  0,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x2eb0 */   0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,
+/* 0x2ec0 */   0,  3,  0,  0,  0, 95,  6,  0,  0, 45,  0,  0,  0,  0,  0,  0,
+/* 0x2ed0 */   0,  0,  0,  0,  0, 10,  0,  0,  0, 12,  0,  0,  0, 95,  6,  0,
+/* 0x2ee0 */   0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,
+/* 0x2ef0 */   0,  3,  0,  0,  0, 95,  6,  0,  0, 81,  0,  0,  0,  0,  0,  0,
+/* 0x2f00 */   0,  0,  0,  0,  0, 11,  0,  0,  0, 14,  0,  0,  0, 95,  6,  0,
+/* 0x2f10 */   0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,
+/* 0x2f20 */   0, 17,  0,  0,  0, 95,  6,  0,  0,189,  0,  0,  0,  0,  0,  0,
+/* 0x2f30 */   0,  0,  0,  0,  0, 12,  0,  0,  0, 47,  0,  0,  0, 95,  6,  0,
+/* 0x2f40 */   0,153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,
+/* 0x2f50 */   0, 12,  0,  0,  0, 95,  6,  0,  0,108,  0,  0,  0,  0,  0,  0,
+/* 0x2f60 */   0,  0,  0,  0,  0, 14,  0,  0,  0,  3,  0,  0,  0, 95,  6,  0,
+/* 0x2f70 */   0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,
+/* 0x2f80 */   0, 14,  0,  0,  0, 95,  6,  0,  0,108,  0,  0,  0,  0,  0,  0,
+/* 0x2f90 */   0,  0,  0,  0,  0, 18,  0,  0,  0,  8,  0,  0,  0, 84,  6,  0,
+/* 0x2fa0 */   0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,
+/* 0x2fb0 */   0, 10,  0,  0,  0, 95,  6,  0,  0,180,  0,  0,  0,  0,  0,  0,
+/* 0x2fc0 */   0,  0,  0,  0,  0, 19,  0,  0,  0, 21,  0,  0,  0, 84,  6,  0,
+/* 0x2fd0 */   0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,
+/* 0x2fe0 */   0, 18,  0,  0,  0, 84,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,
+/* 0x2ff0 */   0,  0,  0,  0,  0, 22,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x3000 */   0,225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,
+/* 0x3010 */   0,  1,  0,  0,  0, 95,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,
+/* 0x3020 */   0,  0,  0,  0,  0, 26,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x3030 */   0,198,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,
+/* 0x3040 */   0,  3,  0,  0,  0, 95,  6,  0,  0,216,  0,  0,  0,  0,  0,  0,
+/* 0x3050 */   0,  0,  0,  0,  0, 29,  0,  0,  0, 12,  0,  0,  0, 95,  6,  0,
+/* 0x3060 */   0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,
+/* 0x3070 */   0,  5,  0,  0,  0, 95,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,
+/* 0x3080 */   0,  0,  0,  0,  0, 30,  0,  0,  0, 14,  0,  0,  0, 95,  6,  0,
+/* 0x3090 */   0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,
+/* 0x30a0 */   0, 15,  0,  0,  0, 95,  6,  0,  0,252,  0,  0,  0,  0,  0,  0,
+/* 0x30b0 */   0,  0,  0,  0,  0, 31,  0,  0,  0, 33,  0,  0,  0, 95,  6,  0,
+/* 0x30c0 */   0,104,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,
+/* 0x30d0 */   0, 67,  0,  0,  0, 95,  6,  0,  0, 68,  1,  0,  0,  0,  0,  0,
+/* 0x30e0 */   0,  0,  0,  0,  0, 32,  0,  0,  0, 12,  0,  0,  0, 95,  6,  0,
+/* 0x30f0 */   0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,
+/* 0x3100 */   0,  3,  0,  0,  0, 95,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,
+/* 0x3110 */   0,  0,  0,  0,  0, 33,  0,  0,  0, 14,  0,  0,  0, 95,  6,  0,
+/* 0x3120 */   0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,
+/* 0x3130 */   0,  8,  0,  0,  0, 84,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,
+/* 0x3140 */   0,  0,  0,  0,  0, 38,  0,  0,  0, 10,  0,  0,  0, 95,  6,  0,
+/* 0x3150 */   0, 95,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,
+/* 0x3160 */   0, 21,  0,  0,  0, 84,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,
+/* 0x3170 */   0,  0,  0,  0,  0, 39,  0,  0,  0, 18,  0,  0,  0, 84,  6,  0,
+/* 0x3180 */   0,225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,
+/* 0x3190 */   0,  1,  0,  0,  0, 95,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,
+/* 0x31a0 */   0,  0,  0,  0,  0, 42,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x31b0 */   0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,
+/* 0x31c0 */   0,  1,  0,  0,  0, 95,  6,  0,  0,113,  1,  0,  0,  0,  0,  0,
+/* 0x31d0 */   0,  0,  0,  0,  0, 46,  0,  0,  0,  3,  0,  0,  0, 95,  6,  0,
+/* 0x31e0 */   0,131,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,
+/* 0x31f0 */   0, 12,  0,  0,  0, 95,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,
+/* 0x3200 */   0,  0,  0,  0,  0, 49,  0,  0,  0,  5,  0,  0,  0, 95,  6,  0,
+/* 0x3210 */   0,194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,
+/* 0x3220 */   0, 14,  0,  0,  0, 95,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,
+/* 0x3230 */   0,  0,  0,  0,  0, 50,  0,  0,  0, 15,  0,  0,  0, 95,  6,  0,
+/* 0x3240 */   0,167,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,
+/* 0x3250 */   0, 30,  0,  0,  0, 95,  6,  0,  0,239,  1,  0,  0,  0,  0,  0,
+/* 0x3260 */   0,  0,  0,  0,  0, 50,  0,  0,  0, 48,  0,  0,  0, 95,  6,  0,
+/* 0x3270 */   0, 19,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,
+/* 0x3280 */   0, 12,  0,  0,  0, 95,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,
+/* 0x3290 */   0,  0,  0,  0,  0, 52,  0,  0,  0,  3,  0,  0,  0, 95,  6,  0,
+/* 0x32a0 */   0,194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,
+/* 0x32b0 */   0, 14,  0,  0,  0, 95,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,
+/* 0x32c0 */   0,  0,  0,  0,  0, 56,  0,  0,  0,  8,  0,  0,  0, 84,  6,  0,
+/* 0x32d0 */   0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,
+/* 0x32e0 */   0, 10,  0,  0,  0, 95,  6,  0,  0, 10,  2,  0,  0,  0,  0,  0,
+/* 0x32f0 */   0,  0,  0,  0,  0, 57,  0,  0,  0, 21,  0,  0,  0, 84,  6,  0,
+/* 0x3300 */   0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,
+/* 0x3310 */   0, 18,  0,  0,  0, 84,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,
+/* 0x3320 */   0,  0,  0,  0,  0, 60,  0,  0,  0,  5,  0,  0,  0,105,  6,  0,
+/* 0x3330 */   0,254,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,
+/* 0x3340 */   0, 20,  0,  0,  0,105,  6,  0,  0, 16,  6,  0,  0,  0,  0,  0,
+/* 0x3350 */   0,  0,  0,  0,  0, 60,  0,  0,  0, 30,  0,  0,  0,105,  6,  0,
+/* 0x3360 */   0, 27,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,
+/* 0x3370 */   0, 42,  0,  0,  0,105,  6,  0,  0, 38,  6,  0,  0,  0,  0,  0,
+/* 0x3380 */   0,  0,  0,  0,  0, 66,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x3390 */   0,155,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,
+/* 0x33a0 */   0,  1,  0,  0,  0,105,  6,  0,  0, 54,  6,  0,  0,  0,  0,  0,
+/* 0x33b0 */   0,  0,  0,  0,  0, 73,  0,  0,  0,  1,  0,  0,  0, 84,  6,  0,
+/* 0x33c0 */   0,232,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 77,  0,  0,
+/* 0x33d0 */   0,  1,  0,  0,  0, 95,  6,  0,  0,210,  4,  0,  0,  0,  0,  0,
+/* 0x33e0 */   0,  0,  0,  0,  0, 78,  0,  0,  0,  4,  0,  0,  0, 95,  6,  0,
+/* 0x33f0 */   0,210,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,  0,  0,
+/* 0x3400 */   0,  2,  0,  0,  0, 95,  6,  0,  0,196,  3,  0,  0,  0,  0,  0,
+/* 0x3410 */   0,  0,  0,  0,  0, 85,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x3420 */   0,196,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,
+/* 0x3430 */   0,  4,  0,  0,  0, 95,  6,  0,  0, 61,  3,  0,  0,  0,  0,  0,
+/* 0x3440 */   0,  0,  0,  0,  0, 91,  0,  0,  0,  4,  0,  0,  0, 95,  6,  0,
+/* 0x3450 */   0,196,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,
+/* 0x3460 */   0,  6,  0,  0,  0, 95,  6,  0,  0,187,  3,  0,  0,  0,  0,  0,
+/* 0x3470 */   0,  0,  0,  0,  0,109,  0,  0,  0,  6,  0,  0,  0, 95,  6,  0,
+/* 0x3480 */   0,210,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,111,  0,  0,
+/* 0x3490 */   0,  1,  0,  0,  0, 84,  6,  0,  0,232,  3,  0,  0,  0,  0,  0,
+/* 0x34a0 */   0,  0,  0,  0,  0,123,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x34b0 */   0, 66,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,125,  0,  0,
+/* 0x34c0 */   0,  7,  0,  0,  0, 95,  6,  0,  0,164,  2,  0,  0,  0,  0,  0,
+/* 0x34d0 */   0,  0,  0,  0,  0,129,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x34e0 */   0,218,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,131,  0,  0,
+/* 0x34f0 */   0,  1,  0,  0,  0, 95,  6,  0,  0,218,  2,  0,  0,  0,  0,  0,
+/* 0x3500 */   0,  0,  0,  0,  0,132,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x3510 */   0,210,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,133,  0,  0,
+/* 0x3520 */   0,  1,  0,  0,  0, 95,  6,  0,  0,201,  4,  0,  0,  0,  0,  0,
+/* 0x3530 */   0,  0,  0,  0,  0,134,  0,  0,  0,  1,  0,  0,  0, 95,  6,  0,
+/* 0x3540 */   0,201,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,
+/* 0x3550 */   0,  2,  0,  0,  0, 95,  6,  0,  0,218,  2,  0,  0,  0,  0,  0,
+/* 0x3560 */   0,  0,  0,  0,  0,136,  0,  0,  0,  4,  0,  0,  0, 95,  6,  0,
+/* 0x3570 */   0,102,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,
+/* 0x3580 */   0,  3,  0,  0,  0, 95,  6,  0,  0, 46,  5,  0,  0,  0,  0,  0,
+/* 0x3590 */   0,  0,  0,  0,  0,145,  0,  0,  0, 13,  0,  0,  0, 95,  6,  0,
+/* 0x35a0 */   0, 46,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,
+/* 0x35b0 */   0,  5,  0,  0,  0, 95,  6,  0,  0, 66,  5,  0,  0,  0,  0,  0,
+/* 0x35c0 */   0,  0,  0,  0,  0,146,  0,  0,  0, 10,  0,  0,  0, 95,  6,  0,
+/* 0x35d0 */   0, 66,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,
+/* 0x35e0 */   0, 16,  0,  0,  0, 95,  6,  0,  0, 66,  5,  0,  0,  0,  0,  0,
+/* 0x35f0 */   0,  0,  0,  0,  0,147,  0,  0,  0,  4,  0,  0,  0, 95,  6,  0,
+/* 0x3600 */   0, 66,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,147,  0,  0,
+/* 0x3610 */   0,  9,  0,  0,  0, 95,  6,  0,  0, 36,  5,  0,  0,  0,  0,  0,
+/* 0x3620 */   0,  0,  0,  0,  0,148,  0,  0,  0,  4,  0,  0,  0, 95,  6,  0,
+/* 0x3630 */   0, 26,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,  0,  0,
+/* 0x3640 */   0,  1,  0,  0,  0,105,  6,  0,  0, 59,  6,  0,  0,  0,  0,  0,
+/* 0x3650 */   0,  0,  0,  0,  0,150,  0,  0,  0,  2,  0,  0,  0,114,  6,  0,
+/* 0x3660 */   0, 73,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,
+/* 0x3670 */   0,  4,  0,  0,  0, 95,  6,  0,  0, 76,  5,  0,  0,  0,  0,  0,
+/* 0x3680 */   0,  0,  0,  0,  0,155,  0,  0,  0, 15,  0,  0,  0, 95,  6,  0,
+/* 0x3690 */   0, 76,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,156,  0,  0,
+/* 0x36a0 */   0,  1,  0,  0,  0,105,  6,  0,  0, 59,  6,  0,  0,  0,  0,  0,
+/* 0x36b0 */   0,  0,  0,  0,  0,159,  0,  0,  0,  3,  0,  0,  0, 95,  6,  0,
+/* 0x36c0 */   0,220,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,  0,  0,
+/* 0x36d0 */   0,  2,  0,  0,  0,114,  6,  0,  0, 73,  6,  0,  0,  0,  0,  0,
+/* 0x36e0 */   0,  0,  0,  0,  0,160,  0,  0,  0,  4,  0,  0,  0, 95,  6,  0,
+/* 0x36f0 */   0,166,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,
+/* 0x3700 */   0,  6,  0,  0,  0, 95,  6,  0,  0,139,  5,  0,  0,  0,  0,  0,
+/* 0x3710 */   0,  0,  0,  0,  0,167,  0,  0,  0,  8,  0,  0,  0,105,  6,  0,
+/* 0x3720 */   0,238,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,
+/* 0x3730 */   0, 13,  0,  0,  0,105,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3740 */   0,  0,  0,  0,  0,167,  0,  0,  0, 50,  0,  0,  0,105,  6,  0,
+/* 0x3750 */   0,238,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,
+/* 0x3760 */   0, 56,  0,  0,  0,105,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3770 */   0,  0,  0,  0,  0, 76, 69, 88, 69, 67, 48, 48, 48,  0, 76, 69,
+/* 0x3780 */  88, 69, 67, 48, 48, 57,  0, 76, 69, 88, 69, 67, 48, 49, 48,  0,
+/* 0x3790 */  78, 50, 66, 83, 77, 65, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49,
+/* 0x37a0 */  48,  0, 78, 50, 66, 70, 65, 83, 49, 49,  0, 78, 50, 66, 68, 69,
+/* 0x37b0 */  67, 49, 48,  0, 78, 50, 66, 83, 77, 65, 50, 48,  0, 78, 50, 66,
+/* 0x37c0 */  70, 65, 83, 50, 48,  0, 78, 50, 66, 68, 69, 67, 50, 48,  0, 78,
+/* 0x37d0 */  50, 66, 83, 77, 65, 51, 48,  0, 78, 50, 66, 70, 65, 83, 51, 48,
+/* 0x37e0 */   0, 78, 50, 66, 68, 69, 67, 51, 48,  0, 78, 50, 66, 83, 77, 65,
+/* 0x37f0 */  52, 48,  0, 78, 50, 66, 70, 65, 83, 52, 48,  0, 78, 50, 66, 83,
+/* 0x3800 */  77, 65, 53, 48,  0, 78, 50, 66, 70, 65, 83, 53, 48,  0, 78, 50,
+/* 0x3810 */  66, 68, 69, 67, 53, 48,  0, 78, 50, 66, 83, 77, 65, 54, 48,  0,
+/* 0x3820 */  78, 50, 66, 70, 65, 83, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54,
+/* 0x3830 */  49,  0, 78, 50, 66, 68, 69, 67, 54, 48,  0, 78, 50, 68, 83, 77,
+/* 0x3840 */  65, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 48,  0, 78, 50, 68,
+/* 0x3850 */  70, 65, 83, 49, 49,  0, 78, 50, 68, 68, 69, 67, 49, 48,  0, 78,
+/* 0x3860 */  50, 68, 83, 77, 65, 50, 48,  0, 78, 50, 68, 70, 65, 83, 50, 48,
+/* 0x3870 */   0, 78, 50, 68, 68, 69, 67, 50, 48,  0, 78, 50, 68, 83, 77, 65,
+/* 0x3880 */  51, 48,  0, 78, 50, 68, 70, 65, 83, 51, 48,  0, 78, 50, 68, 68,
+/* 0x3890 */  69, 67, 51, 48,  0, 78, 50, 68, 83, 77, 65, 52, 48,  0, 78, 50,
+/* 0x38a0 */  68, 70, 65, 83, 52, 48,  0, 78, 50, 68, 83, 77, 65, 53, 48,  0,
+/* 0x38b0 */  78, 50, 68, 70, 65, 83, 53, 48,  0, 78, 50, 68, 68, 69, 67, 53,
+/* 0x38c0 */  48,  0, 78, 50, 68, 83, 77, 65, 54, 48,  0, 78, 50, 68, 70, 65,
+/* 0x38d0 */  83, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 49,  0, 78, 50, 68,
+/* 0x38e0 */  68, 69, 67, 54, 48,  0, 78, 50, 69, 83, 77, 65, 49, 48,  0, 78,
+/* 0x38f0 */  50, 69, 70, 65, 83, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 49,
+/* 0x3900 */   0, 78, 50, 69, 68, 69, 67, 49, 48,  0, 78, 50, 69, 83, 77, 65,
+/* 0x3910 */  50, 48,  0, 78, 50, 69, 70, 65, 83, 50, 48,  0, 78, 50, 69, 68,
+/* 0x3920 */  69, 67, 50, 48,  0, 78, 50, 69, 83, 77, 65, 51, 48,  0, 78, 50,
+/* 0x3930 */  69, 70, 65, 83, 51, 48,  0, 78, 50, 69, 68, 69, 67, 51, 48,  0,
+/* 0x3940 */  78, 50, 69, 83, 77, 65, 52, 48,  0, 78, 50, 69, 70, 65, 83, 52,
+/* 0x3950 */  48,  0, 78, 50, 69, 83, 77, 65, 53, 48,  0, 78, 50, 69, 70, 65,
+/* 0x3960 */  83, 53, 48,  0, 78, 50, 69, 68, 69, 67, 53, 48,  0, 78, 50, 69,
+/* 0x3970 */  83, 77, 65, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 48,  0, 78,
+/* 0x3980 */  50, 69, 70, 65, 83, 54, 49,  0, 78, 50, 69, 68, 69, 67, 54, 48,
+/* 0x3990 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  0, 76, 90, 77, 65,
+/* 0x39a0 */  95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49,
+/* 0x39b0 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77,
+/* 0x39c0 */  65, 95, 68, 69, 67, 51, 48,  0, 76, 69, 88, 69, 67, 48, 49, 53,
+/* 0x39d0 */   0, 76, 88, 85, 78, 70, 48, 48, 48,  0, 76, 88, 85, 78, 70, 48,
+/* 0x39e0 */  48, 50,  0, 77, 82, 85, 66, 89, 84, 69, 48,  0, 76, 88, 77, 82,
+/* 0x39f0 */  85, 48, 48, 53,  0, 76, 88, 77, 82, 85, 48, 48, 54,  0, 76, 88,
+/* 0x3a00 */  77, 82, 85, 48, 48, 55,  0, 76, 88, 85, 78, 70, 48, 48, 56,  0,
+/* 0x3a10 */  76, 88, 85, 78, 70, 48, 49, 48,  0, 76, 88, 74, 67, 67, 48, 49,
+/* 0x3a20 */  48,  0, 76, 88, 77, 82, 85, 48, 52, 53,  0, 76, 88, 77, 82, 85,
+/* 0x3a30 */  48, 52, 54,  0, 76, 88, 74, 67, 67, 48, 50, 48,  0, 76, 88, 74,
+/* 0x3a40 */  67, 67, 48, 50, 49,  0, 76, 88, 74, 67, 67, 48, 50, 51,  0, 76,
+/* 0x3a50 */  88, 85, 78, 70, 48, 51, 55,  0, 76, 88, 85, 78, 70, 51, 56, 54,
+/* 0x3a60 */   0, 76, 88, 85, 78, 70, 51, 56, 55,  0, 76, 88, 85, 78, 70, 51,
+/* 0x3a70 */  56, 56,  0, 76, 88, 85, 78, 70, 52, 56, 54,  0, 76, 88, 85, 78,
+/* 0x3a80 */  70, 52, 56, 55,  0, 76, 88, 77, 82, 85, 48, 54, 53,  0, 77, 82,
+/* 0x3a90 */  85, 66, 89, 84, 69, 51,  0, 77, 82, 85, 65, 82, 66, 51, 48,  0,
+/* 0x3aa0 */  77, 82, 85, 66, 73, 84, 83, 51,  0, 77, 82, 85, 65, 82, 66, 52,
+/* 0x3ab0 */  48,  0, 76, 88, 77, 82, 85, 48, 55, 48,  0, 77, 82, 85, 66, 89,
+/* 0x3ac0 */  84, 69, 52,  0, 77, 82, 85, 66, 73, 84, 83, 52,  0, 77, 82, 85,
+/* 0x3ad0 */  65, 82, 66, 53, 48,  0, 76, 88, 77, 82, 85, 48, 56, 48,  0, 77,
+/* 0x3ae0 */  82, 85, 66, 89, 84, 69, 53,  0, 77, 82, 85, 65, 82, 66, 54, 48,
+/* 0x3af0 */   0, 77, 82, 85, 66, 73, 84, 83, 53,  0, 77, 82, 85, 65, 82, 66,
+/* 0x3b00 */  55, 48,  0, 76, 88, 77, 82, 85, 48, 57, 48,  0, 77, 82, 85, 66,
+/* 0x3b10 */  89, 84, 69, 54,  0, 77, 82, 85, 65, 82, 66, 56, 48,  0, 77, 82,
+/* 0x3b20 */  85, 66, 73, 84, 83, 54,  0, 77, 82, 85, 65, 82, 66, 57, 48,  0,
+/* 0x3b30 */  76, 88, 77, 82, 85, 49, 48, 48,  0, 76, 88, 85, 78, 70, 48, 52,
+/* 0x3b40 */  48,  0, 76, 88, 77, 82, 85, 49, 49, 48,  0, 76, 88, 77, 82, 85,
+/* 0x3b50 */  49, 49, 49,  0, 76, 88, 85, 78, 70, 48, 52, 49,  0, 76, 88, 85,
+/* 0x3b60 */  78, 70, 48, 52, 50,  0, 76, 69, 88, 69, 67, 48, 49, 54,  0, 76,
+/* 0x3b70 */  88, 77, 82, 85, 48, 49, 48,  0, 76, 88, 74, 77, 80, 65, 48, 48,
+/* 0x3b80 */   0, 76, 88, 67, 65, 76, 76, 66, 48,  0, 76, 88, 85, 78, 70, 48,
+/* 0x3b90 */  50, 49,  0, 76, 88, 77, 82, 85, 48, 50, 50,  0, 76, 88, 74, 77,
+/* 0x3ba0 */  80, 65, 48, 49,  0, 76, 88, 67, 65, 76, 76, 66, 49,  0, 77, 82,
+/* 0x3bb0 */  85, 66, 73, 84, 83, 49,  0, 76, 88, 77, 82, 85, 48, 51, 48,  0,
+/* 0x3bc0 */  77, 82, 85, 66, 89, 84, 69, 49,  0, 77, 82, 85, 65, 82, 66, 49,
+/* 0x3bd0 */  48,  0, 76, 88, 77, 82, 85, 48, 52, 48,  0, 76, 88, 85, 78, 70,
+/* 0x3be0 */  48, 51, 48,  0, 76, 88, 74, 67, 67, 48, 48, 48,  0, 76, 88, 67,
+/* 0x3bf0 */  74, 48, 77, 82, 85,  0, 76, 88, 67, 74, 49, 77, 82, 85,  0, 76,
+/* 0x3c00 */  88, 67, 65, 76, 74, 77, 80,  0, 76, 88, 67, 65, 76, 76, 48, 48,
+/* 0x3c10 */   0, 76, 88, 67, 65, 76, 76, 48, 49,  0, 76, 88, 67, 74, 50, 77,
+/* 0x3c20 */  82, 85,  0, 76, 88, 67, 74, 52, 77, 82, 85,  0, 76, 88, 67, 74,
+/* 0x3c30 */  54, 77, 82, 85,  0, 76, 88, 67, 74, 55, 77, 82, 85,  0, 76, 88,
+/* 0x3c40 */  67, 74, 56, 77, 82, 85,  0, 76, 88, 85, 78, 70, 48, 51, 52,  0,
+/* 0x3c50 */  76, 88, 77, 82, 85, 48, 53, 53,  0, 77, 82, 85, 66, 89, 84, 69,
+/* 0x3c60 */  50,  0, 77, 82, 85, 66, 73, 84, 83, 50,  0, 77, 82, 85, 65, 82,
+/* 0x3c70 */  66, 50, 48,  0, 76, 88, 77, 82, 85, 48, 53, 55,  0, 76, 88, 77,
+/* 0x3c80 */  82, 85, 48, 53, 56,  0, 76, 88, 85, 78, 70, 48, 51, 53,  0, 99,
+/* 0x3c90 */ 116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,107, 51, 50, 46,
+/* 0x3ca0 */  49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,  0, 99,116,111,
+/* 0x3cb0 */ 107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51, 50, 46, 52, 48,
+/* 0x3cc0 */   0, 67, 65, 76, 76, 84, 82, 48, 48,  0, 67, 84, 67, 76, 69, 86,
+/* 0x3cd0 */  69, 49,  0, 67, 65, 76, 76, 84, 82, 48, 49,  0, 67, 84, 66, 83,
+/* 0x3ce0 */  72, 82, 48, 49,  0, 67, 84, 66, 82, 79, 82, 48, 49,  0, 67, 84,
+/* 0x3cf0 */  66, 83, 87, 65, 48, 49,  0, 67, 65, 76, 76, 84, 82, 48, 50,  0,
+/* 0x3d00 */  67, 65, 76, 76, 84, 82, 49, 48,  0, 67, 65, 76, 76, 84, 82, 69,
+/* 0x3d10 */  56,  0, 67, 65, 76, 76, 84, 82, 69, 57,  0, 67, 65, 76, 76, 84,
+/* 0x3d20 */  82, 49, 49,  0, 67, 84, 67, 76, 69, 86, 69, 50,  0, 67, 65, 76,
+/* 0x3d30 */  76, 84, 82, 49, 50,  0, 67, 84, 66, 83, 72, 82, 49, 49,  0, 67,
+/* 0x3d40 */  84, 66, 82, 79, 82, 49, 49,  0, 67, 84, 66, 83, 87, 65, 49, 49,
+/* 0x3d50 */   0, 67, 65, 76, 76, 84, 82, 49, 51,  0, 76, 69, 88, 69, 67, 48,
+/* 0x3d60 */  49, 55,  0, 76, 69, 88, 69, 67, 48, 50, 48,  0, 95,115,116, 97,
+/* 0x3d70 */ 114,116,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,
+/* 0x3d80 */ 106,117,115,116,  0,108,122,109, 97, 95,117, 95,108,101,110,  0,
+/* 0x3d90 */ 108,122,109, 97, 95, 99, 95,108,101,110,  0,108,122,109, 97, 95,
+/* 0x3da0 */ 112,114,111,112,101,114,116,105,101,115,  0, 78, 77, 82, 85,  0,
+/* 0x3db0 */ 102,105,108,116,101,114, 95,108,101,110,103,116,104,  0,102,105,
+/* 0x3dc0 */ 108,116,101,114, 95, 99,116,111,  0, 82, 95, 51, 56, 54, 95, 80,
+/* 0x3dd0 */  67, 51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95,
+/* 0x3de0 */  51, 56, 54, 95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 56,  0,141,
+/* 0x3df0 */  27,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* i386-dos32.tmt.h
-   created from i386-dos32.tmt.bin, 22586 (0x583a) bytes
+   created from i386-dos32.tmt.bin, 12598 (0x3136) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_DOS32_TMT_SIZE    22586
-#define STUB_I386_DOS32_TMT_ADLER32 0x997c080e
-#define STUB_I386_DOS32_TMT_CRC32   0xf86d5212
+#define STUB_I386_DOS32_TMT_SIZE    12598
+#define STUB_I386_DOS32_TMT_ADLER32 0x5091d480
+#define STUB_I386_DOS32_TMT_CRC32   0x3d0332d7
 
-unsigned char stub_i386_dos32_tmt[22586] = {
+unsigned char stub_i386_dos32_tmt[12598] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 136, 30,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -452,1000 +452,376 @@ unsigned char stub_i386_dos32_tmt[22586] = {
 /* 0x19d0 */  60,239,119, 17,  1,199,139,  7,134,196,193,192, 16,134,196,  1,
 /* 0x19e0 */ 232,137,  7,235,226, 36, 15,193,224, 16,102,139,  6,131,198,  2,
 /* 0x19f0 */   9,192,117, 12,139,  6,131,198,  4,235, 12,233,252,255,255,255,
-/* 0x1a00 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x1a10 */  50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,105,111,110,115,
-/* 0x1a20 */  58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32,
-/* 0x1a30 */  32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77,
-/* 0x1a40 */  65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1a50 */  32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110,
-/* 0x1a60 */  32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 84, 77, 84, 77,
-/* 0x1a70 */  65, 73, 78, 49, 32, 32, 32, 32, 32, 32, 48, 49, 50, 32, 32, 48,
-/* 0x1a80 */  32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1a90 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 84, 77, 84,
-/* 0x1aa0 */  77, 65, 73, 78, 49, 65, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x1ab0 */  32, 32, 48, 32, 32, 48, 52, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1ac0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 84, 77, 84,
-/* 0x1ad0 */  77, 65, 73, 78, 49, 66, 32, 32, 32, 32, 32, 48,101, 32, 32, 48,
-/* 0x1ae0 */  32, 32, 48, 32, 32, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1af0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 84, 77, 84,
-/* 0x1b00 */  67, 65, 76, 84, 49, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48,
-/* 0x1b10 */  32, 32, 48, 32, 32, 48, 53, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1b20 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 84, 77, 84,
-/* 0x1b30 */  77, 65, 73, 78, 50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x1b40 */  32, 32, 48, 32, 32, 48, 53, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1b50 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 85, 80, 88,
-/* 0x1b60 */  49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 50, 48, 32, 32,
-/* 0x1b70 */  48, 32, 32, 48, 32, 32, 48, 53, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1b80 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 84, 77,
-/* 0x1b90 */  84, 67, 85, 84, 80, 79, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48,
-/* 0x1ba0 */  32, 32, 48, 32, 32, 48, 55, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1bb0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 78, 50, 66,
-/* 0x1bc0 */  83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x1bd0 */  32, 32, 48, 32, 32, 48, 55, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1be0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 78, 50, 66,
-/* 0x1bf0 */  70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x1c00 */  32, 32, 48, 32, 32, 48, 55,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1c10 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 78, 50, 66,
-/* 0x1c20 */  70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48,
-/* 0x1c30 */  32, 32, 48, 32, 32, 48, 56, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1c40 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 78, 50, 66,
-/* 0x1c50 */  68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48,
-/* 0x1c60 */  32, 32, 48, 32, 32, 48, 56, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1c70 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 78, 50, 66,
-/* 0x1c80 */  83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x1c90 */  32, 32, 48, 32, 32, 48, 57, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1ca0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 78, 50, 66,
-/* 0x1cb0 */  70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48,
-/* 0x1cc0 */  32, 32, 48, 32, 32, 48, 57, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1cd0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32, 78, 50, 66,
-/* 0x1ce0 */  68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48,
-/* 0x1cf0 */  32, 32, 48, 32, 32, 48, 97, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1d00 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 52, 32, 78, 50, 66,
-/* 0x1d10 */  83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48,
-/* 0x1d20 */  32, 32, 48, 32, 32, 48, 97,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1d30 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 53, 32, 78, 50, 66,
-/* 0x1d40 */  70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48,
-/* 0x1d50 */  32, 32, 48, 32, 32, 48, 98, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1d60 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 54, 32, 78, 50, 66,
-/* 0x1d70 */  68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 51,101, 32, 32,
-/* 0x1d80 */  48, 32, 32, 48, 32, 32, 48, 99, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1d90 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 55, 32, 78, 50,
-/* 0x1da0 */  66, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32,
-/* 0x1db0 */  48, 32, 32, 48, 32, 32, 48, 49, 48, 55, 32, 32, 50, 42, 42, 48,
-/* 0x1dc0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 56, 32, 78,
-/* 0x1dd0 */  50, 66, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32,
-/* 0x1de0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 49, 52, 32, 32, 50, 42, 42,
-/* 0x1df0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 57, 32,
-/* 0x1e00 */  78, 50, 66, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x1e10 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 51, 32, 32, 50, 42,
-/* 0x1e20 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 48,
-/* 0x1e30 */  32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1e40 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 53, 32, 32, 50,
-/* 0x1e50 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x1e60 */  49, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1e70 */  48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 56, 32, 32,
-/* 0x1e80 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1e90 */  50, 50, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32,
-/* 0x1ea0 */  32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 49, 32,
-/* 0x1eb0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1ec0 */  32, 50, 51, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32, 32, 32, 32,
-/* 0x1ed0 */  32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51,
-/* 0x1ee0 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1ef0 */  83, 10, 32, 50, 52, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 32,
-/* 0x1f00 */  32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1f10 */  49, 53, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1f20 */  78, 84, 83, 10, 32, 50, 53, 32, 78, 50, 66, 68, 69, 67, 54, 48,
-/* 0x1f30 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1f40 */  49, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1f50 */  78, 84, 83, 10, 32, 50, 54, 32, 78, 50, 68, 83, 77, 65, 49, 48,
-/* 0x1f60 */  32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1f70 */  48, 49, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1f80 */  69, 78, 84, 83, 10, 32, 50, 55, 32, 78, 50, 68, 70, 65, 83, 49,
-/* 0x1f90 */  48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1fa0 */  32, 48, 49, 54,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1fb0 */  84, 69, 78, 84, 83, 10, 32, 50, 56, 32, 78, 50, 68, 70, 65, 83,
-/* 0x1fc0 */  49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48,
-/* 0x1fd0 */  32, 32, 48, 49, 55, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1fe0 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 57, 32, 78, 50, 68, 68, 69,
-/* 0x1ff0 */  67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32,
-/* 0x2000 */  48, 32, 32, 48, 49, 55, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2010 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 48, 32, 78, 50, 68, 83,
-/* 0x2020 */  77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x2030 */  32, 48, 32, 32, 48, 49, 56, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2040 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 49, 32, 78, 50, 68,
-/* 0x2050 */  70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48,
-/* 0x2060 */  32, 32, 48, 32, 32, 48, 49, 56, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2070 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 50, 32, 78, 50,
-/* 0x2080 */  68, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32,
-/* 0x2090 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 48, 32, 32, 50, 42, 42, 48,
-/* 0x20a0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 51, 32, 78,
-/* 0x20b0 */  50, 68, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32,
-/* 0x20c0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100, 32, 32, 50, 42, 42,
-/* 0x20d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 52, 32,
-/* 0x20e0 */  78, 50, 68, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102,
-/* 0x20f0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97, 32, 32, 50, 42,
-/* 0x2100 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 53,
-/* 0x2110 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2120 */  53, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 57, 32, 32,
-/* 0x2130 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2140 */  51, 54, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32,
-/* 0x2150 */  32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 48, 98, 32,
-/* 0x2160 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2170 */  32, 51, 55, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32, 32, 32, 32,
-/* 0x2180 */  32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 49, 56,
-/* 0x2190 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x21a0 */  10, 32, 51, 56, 32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 32, 32,
-/* 0x21b0 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 50,
-/* 0x21c0 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x21d0 */  83, 10, 32, 51, 57, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 32,
-/* 0x21e0 */  32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x21f0 */  50, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2200 */  84, 83, 10, 32, 52, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48, 32,
-/* 0x2210 */  32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2220 */  50, 50, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2230 */  78, 84, 83, 10, 32, 52, 49, 32, 78, 50, 68, 83, 77, 65, 54, 48,
-/* 0x2240 */  32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2250 */  48, 50, 51, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2260 */  69, 78, 84, 83, 10, 32, 52, 50, 32, 78, 50, 68, 70, 65, 83, 54,
-/* 0x2270 */  48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48,
-/* 0x2280 */  32, 32, 48, 50, 52, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2290 */  78, 84, 69, 78, 84, 83, 10, 32, 52, 51, 32, 78, 50, 68, 70, 65,
-/* 0x22a0 */  83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32,
-/* 0x22b0 */  32, 48, 32, 32, 48, 50, 53, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x22c0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 52, 32, 78, 50, 68,
-/* 0x22d0 */  68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32,
-/* 0x22e0 */  32, 48, 32, 32, 48, 50, 55, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x22f0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 53, 32, 78, 50, 69,
-/* 0x2300 */  83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x2310 */  32, 32, 48, 32, 32, 48, 50, 55, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2320 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 54, 32, 78, 50,
-/* 0x2330 */  69, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x2340 */  48, 32, 32, 48, 32, 32, 48, 50, 55, 51, 32, 32, 50, 42, 42, 48,
-/* 0x2350 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 55, 32, 78,
-/* 0x2360 */  50, 69, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x2370 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 53, 32, 32, 50, 42, 42,
-/* 0x2380 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 56, 32,
-/* 0x2390 */  78, 50, 69, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98,
-/* 0x23a0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 98, 32, 32, 50, 42,
-/* 0x23b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 57,
-/* 0x23c0 */  32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x23d0 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 54, 32, 32, 50,
-/* 0x23e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x23f0 */  48, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2400 */  48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 98, 32, 32,
-/* 0x2410 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2420 */  53, 49, 32, 78, 50, 69, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32,
-/* 0x2430 */  32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 57, 52, 32,
-/* 0x2440 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2450 */  32, 53, 50, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32, 32, 32, 32,
-/* 0x2460 */  32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 97, 49,
-/* 0x2470 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2480 */  10, 32, 53, 51, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 32, 32,
-/* 0x2490 */  32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 97,
-/* 0x24a0 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x24b0 */  83, 10, 32, 53, 52, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 32,
-/* 0x24c0 */  32, 32, 32, 32, 48, 53,102, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x24d0 */  50, 98,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x24e0 */  78, 84, 83, 10, 32, 53, 53, 32, 78, 50, 69, 83, 77, 65, 52, 48,
-/* 0x24f0 */  32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2500 */  48, 51, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2510 */  69, 78, 84, 83, 10, 32, 53, 54, 32, 78, 50, 69, 70, 65, 83, 52,
-/* 0x2520 */  48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2530 */  32, 48, 51, 50, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2540 */  84, 69, 78, 84, 83, 10, 32, 53, 55, 32, 78, 50, 69, 83, 77, 65,
-/* 0x2550 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x2560 */  32, 32, 48, 51, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2570 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 56, 32, 78, 50, 69, 70, 65,
-/* 0x2580 */  83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x2590 */  48, 32, 32, 48, 51, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x25a0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 57, 32, 78, 50, 69, 68,
-/* 0x25b0 */  69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32,
-/* 0x25c0 */  32, 48, 32, 32, 48, 51, 51,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x25d0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 48, 32, 78, 50, 69,
-/* 0x25e0 */  83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48,
-/* 0x25f0 */  32, 32, 48, 32, 32, 48, 51, 52, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2600 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 49, 32, 78, 50,
-/* 0x2610 */  69, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32,
-/* 0x2620 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 53, 50, 32, 32, 50, 42, 42,
-/* 0x2630 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 50, 32,
-/* 0x2640 */  78, 50, 69, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x2650 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 54, 98, 32, 32, 50,
-/* 0x2660 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54,
-/* 0x2670 */  51, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2680 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 56, 49, 32, 32, 50,
-/* 0x2690 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54,
-/* 0x26a0 */  52, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32,
-/* 0x26b0 */  48, 50,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 56, 49, 32,
-/* 0x26c0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x26d0 */  32, 54, 53, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32,
-/* 0x26e0 */  32, 32, 48, 52, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 97,
-/* 0x26f0 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2700 */  83, 10, 32, 54, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x2710 */  32, 32, 32, 32, 48, 97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2720 */  48, 51,102, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2730 */  69, 78, 84, 83, 10, 32, 54, 55, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2740 */  67, 50, 48, 32, 32, 32, 32, 48, 97, 56, 54, 32, 32, 48, 32, 32,
-/* 0x2750 */  48, 32, 32, 48,101, 55,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2760 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 56, 32, 76, 90, 77, 65,
-/* 0x2770 */  95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 49, 97, 32, 32, 48,
-/* 0x2780 */  32, 32, 48, 32, 32, 48, 49, 57, 48, 51, 32, 32, 50, 42, 42, 48,
-/* 0x2790 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 57, 32, 84,
-/* 0x27a0 */  77, 84, 77, 65, 73, 78, 53, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x27b0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 49,100, 32, 32, 50, 42,
-/* 0x27c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 48,
-/* 0x27d0 */  32, 84, 77, 84, 67, 65, 76, 84, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x27e0 */  49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50, 51, 32, 32,
-/* 0x27f0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2800 */  55, 49, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 32, 32, 32, 32,
-/* 0x2810 */  32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50, 52,
-/* 0x2820 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2830 */  10, 32, 55, 50, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 32, 32,
-/* 0x2840 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2850 */  51, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2860 */  84, 83, 10, 32, 55, 51, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32,
-/* 0x2870 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2880 */  49, 57, 51, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2890 */  69, 78, 84, 83, 10, 32, 55, 52, 32, 67, 84, 66, 83, 72, 82, 48,
-/* 0x28a0 */  49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x28b0 */  32, 48, 49, 57, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x28c0 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 53, 32, 67, 84, 66, 82, 79,
-/* 0x28d0 */  82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x28e0 */  48, 32, 32, 48, 49, 57, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x28f0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 54, 32, 67, 84, 66,
-/* 0x2900 */  83, 87, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2910 */  32, 32, 48, 32, 32, 48, 49, 57, 52, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2920 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 55, 32, 67,
-/* 0x2930 */  65, 76, 76, 84, 82, 48, 50, 32, 32, 32, 32, 32, 32, 48, 49, 48,
-/* 0x2940 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 52, 55, 32, 32, 50,
-/* 0x2950 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55,
-/* 0x2960 */  56, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2970 */  48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 55, 32,
-/* 0x2980 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2990 */  32, 55, 57, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32, 32, 32, 32,
-/* 0x29a0 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53,
-/* 0x29b0 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x29c0 */  83, 10, 32, 56, 48, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 32,
-/* 0x29d0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x29e0 */  57, 53,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x29f0 */  78, 84, 83, 10, 32, 56, 49, 32, 67, 65, 76, 76, 84, 82, 49, 49,
-/* 0x2a00 */  32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2a10 */  48, 49, 57, 54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2a20 */  84, 69, 78, 84, 83, 10, 32, 56, 50, 32, 67, 84, 67, 76, 69, 86,
-/* 0x2a30 */  69, 50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x2a40 */  32, 32, 48, 49, 57, 54, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2a50 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 51, 32, 67, 65, 76, 76,
-/* 0x2a60 */  84, 82, 49, 50, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x2a70 */  32, 48, 32, 32, 48, 49, 57, 54, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2a80 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 52, 32, 67, 84,
-/* 0x2a90 */  66, 83, 72, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32,
-/* 0x2aa0 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 54, 98, 32, 32, 50, 42, 42,
-/* 0x2ab0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 53, 32,
-/* 0x2ac0 */  67, 84, 66, 82, 79, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x2ad0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54,102, 32, 32, 50,
-/* 0x2ae0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56,
-/* 0x2af0 */  54, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 32, 32, 32, 32, 32,
-/* 0x2b00 */  48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 49, 32,
-/* 0x2b10 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2b20 */  32, 56, 55, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 32, 32, 32,
-/* 0x2b30 */  32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55,
-/* 0x2b40 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2b50 */  83, 10, 32, 56, 56, 32, 99,116,111,107, 51, 50, 46, 48, 48, 32,
-/* 0x2b60 */  32, 32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2b70 */  57, 55,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2b80 */  78, 84, 83, 10, 32, 56, 57, 32, 99,116,111,107, 51, 50, 46, 49,
-/* 0x2b90 */  48, 32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2ba0 */  48, 49, 57, 56, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2bb0 */  84, 69, 78, 84, 83, 10, 32, 57, 48, 32, 99,116,111,107, 51, 50,
-/* 0x2bc0 */  46, 50, 48, 32, 32, 32, 32, 32, 48, 50, 48, 32, 32, 48, 32, 32,
-/* 0x2bd0 */  48, 32, 32, 48, 49, 57, 57, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2be0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 49, 32, 99,116,111,
-/* 0x2bf0 */ 107, 51, 50, 46, 51, 48, 32, 32, 32, 32, 32, 48, 97, 32, 32, 48,
-/* 0x2c00 */  32, 32, 48, 32, 32, 48, 49, 57, 98, 53, 32, 32, 50, 42, 42, 48,
-/* 0x2c10 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 50, 32, 99,
-/* 0x2c20 */ 116,111,107, 51, 50, 46, 52, 48, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x2c30 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98,102, 32, 32, 50, 42,
-/* 0x2c40 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 51,
-/* 0x2c50 */  32, 84, 77, 84, 82, 69, 76, 79, 67, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2c60 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99, 52, 32, 32,
-/* 0x2c70 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2c80 */  57, 52, 32, 82, 69, 76, 79, 67, 51, 50, 48, 32, 32, 32, 32, 32,
-/* 0x2c90 */  32, 48, 50, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99,
-/* 0x2ca0 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2cb0 */  83, 10, 32, 57, 53, 32, 82, 69, 76, 51, 50, 66, 73, 71, 32, 32,
-/* 0x2cc0 */  32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2cd0 */  57,102, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2ce0 */  78, 84, 83, 10, 32, 57, 54, 32, 82, 69, 76, 79, 67, 51, 50, 74,
-/* 0x2cf0 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2d00 */  48, 49, 57,102, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2d10 */  84, 69, 78, 84, 83, 10, 32, 57, 55, 32, 82, 69, 76, 51, 50, 69,
-/* 0x2d20 */  78, 68, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2d30 */  32, 48, 49, 57,102, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2d40 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 56, 32, 84, 77, 84, 74, 85,
-/* 0x2d50 */  77, 80, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x2d60 */  48, 32, 32, 48, 49, 57,102, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2d70 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32,
-/* 0x2d80 */  84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2d90 */ 108, 32, 32, 32, 32,100, 32, 32, 84, 77, 84, 67, 85, 84, 80, 79,
-/* 0x2da0 */  32, 48, 32, 84, 77, 84, 67, 85, 84, 80, 79, 10, 48, 48, 48, 48,
-/* 0x2db0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x2dc0 */  83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x2dd0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2de0 */  32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 66,
-/* 0x2df0 */  70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2e00 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32,
-/* 0x2e10 */  48, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2e20 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68,
-/* 0x2e30 */  69, 67, 50, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10,
-/* 0x2e40 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2e50 */  32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 66, 68,
-/* 0x2e60 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2e70 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 48,
-/* 0x2e80 */  32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2e90 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65,
-/* 0x2ea0 */  83, 54, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48,
-/* 0x2eb0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2ec0 */  78, 50, 66, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 66, 68, 69,
-/* 0x2ed0 */  67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2ee0 */  32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 48, 32,
-/* 0x2ef0 */  78, 50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x2f10 */  49, 49, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48,
-/* 0x2f20 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x2f30 */  50, 68, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2f40 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2f50 */  32,100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 48, 32, 78,
-/* 0x2f60 */  50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f70 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x2f80 */  48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x2f90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x2fa0 */  68, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 53,
-/* 0x2fb0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2fc0 */ 100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 48, 32, 78, 50,
-/* 0x2fd0 */  68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2fe0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48,
-/* 0x2ff0 */  32, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48,
-/* 0x3000 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x3010 */  83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48,
-/* 0x3020 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3030 */  32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 69,
-/* 0x3040 */  70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3050 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32,
-/* 0x3060 */  48, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3070 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68,
-/* 0x3080 */  69, 67, 50, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10,
-/* 0x3090 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x30a0 */  32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 69, 68,
-/* 0x30b0 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x30c0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 48,
-/* 0x30d0 */  32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x30e0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65,
-/* 0x30f0 */  83, 54, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48,
-/* 0x3100 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3110 */  78, 50, 69, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 69, 68, 69,
-/* 0x3120 */  67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3130 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 48, 32,
-/* 0x3140 */  67, 65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3150 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3160 */  49, 48, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 48, 48,
-/* 0x3170 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x3180 */  65, 76, 76, 84, 82, 49, 49, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3190 */  49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x31a0 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 48, 32, 67,
-/* 0x31b0 */  65, 76, 76, 84, 82, 49, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46,
-/* 0x31d0 */  48, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 48,
-/* 0x31e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x31f0 */  99,116,111,107, 51, 50, 46, 49, 48, 32, 48, 32, 99,116,111,107,
-/* 0x3200 */  51, 50, 46, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3210 */  32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48,
-/* 0x3220 */  32, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 48, 48, 48,
-/* 0x3230 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,
-/* 0x3240 */ 111,107, 51, 50, 46, 52, 48, 32, 48, 32, 99,116,111,107, 51, 50,
-/* 0x3250 */  46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3260 */  32, 32,100, 32, 32, 82, 69, 76, 79, 67, 51, 50, 48, 32, 48, 32,
-/* 0x3270 */  82, 69, 76, 79, 67, 51, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3280 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 79, 67, 51,
-/* 0x3290 */  50, 74, 32, 48, 32, 82, 69, 76, 79, 67, 51, 50, 74, 10, 48, 48,
-/* 0x32a0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 84,
-/* 0x32b0 */  77, 84, 77, 65, 73, 78, 49, 32, 48, 32, 84, 77, 84, 77, 65, 73,
-/* 0x32c0 */  78, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x32d0 */  32,100, 32, 32, 84, 77, 84, 77, 65, 73, 78, 49, 65, 32, 48, 32,
-/* 0x32e0 */  84, 77, 84, 77, 65, 73, 78, 49, 65, 10, 48, 48, 48, 48, 48, 48,
-/* 0x32f0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 84, 77, 84, 77, 65,
-/* 0x3300 */  73, 78, 49, 66, 32, 48, 32, 84, 77, 84, 77, 65, 73, 78, 49, 66,
-/* 0x3310 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3320 */  32, 32, 84, 77, 84, 67, 65, 76, 84, 49, 32, 48, 32, 84, 77, 84,
-/* 0x3330 */  67, 65, 76, 84, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3340 */  32, 32, 32, 32,100, 32, 32, 84, 77, 84, 77, 65, 73, 78, 50, 32,
-/* 0x3350 */  48, 32, 84, 77, 84, 77, 65, 73, 78, 50, 10, 48, 48, 48, 48, 48,
-/* 0x3360 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85, 80, 88, 49,
-/* 0x3370 */  72, 69, 65, 68, 32, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10,
-/* 0x3380 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3390 */  32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 66, 70,
-/* 0x33a0 */  65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x33b0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 48,
-/* 0x33c0 */  32, 78, 50, 66, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x33d0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65,
-/* 0x33e0 */  83, 50, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 10, 48,
-/* 0x33f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3400 */  78, 50, 66, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 66, 83, 77,
-/* 0x3410 */  65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3420 */  32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 48, 32,
-/* 0x3430 */  78, 50, 66, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3440 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x3450 */  52, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 52, 48, 10, 48, 48,
-/* 0x3460 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3470 */  50, 66, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x3480 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3490 */  32,100, 32, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 48, 32, 78,
-/* 0x34a0 */  50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34b0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 53,
-/* 0x34c0 */  48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 53, 48, 10, 48, 48, 48,
-/* 0x34d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x34e0 */  66, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 54,
-/* 0x34f0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3500 */ 100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50,
-/* 0x3510 */  66, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3520 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 48,
-/* 0x3530 */  32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3540 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x3550 */  83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 50, 48,
-/* 0x3560 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3570 */  32, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 68,
-/* 0x3580 */  70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3590 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32,
-/* 0x35a0 */  48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x35b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x35c0 */  65, 83, 51, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 10,
-/* 0x35d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x35e0 */  32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 68, 83,
-/* 0x35f0 */  77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3600 */  32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32, 48,
-/* 0x3610 */  32, 78, 50, 68, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3620 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77,
-/* 0x3630 */  65, 53, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48, 10, 48,
-/* 0x3640 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3650 */  78, 50, 68, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 68, 70, 65,
-/* 0x3660 */  83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3670 */  32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 48, 32,
-/* 0x3680 */  78, 50, 68, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3690 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x36a0 */  54, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 54, 48, 10, 48, 48,
-/* 0x36b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x36c0 */  50, 69, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83,
-/* 0x36d0 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x36e0 */  32,100, 32, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 48, 32, 78,
-/* 0x36f0 */  50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3700 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 50,
-/* 0x3710 */  48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 50, 48, 10, 48, 48, 48,
-/* 0x3720 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3730 */  69, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 51,
-/* 0x3740 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3750 */ 100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50,
-/* 0x3760 */  69, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3770 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 52, 48,
-/* 0x3780 */  32, 48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48,
-/* 0x3790 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x37a0 */  70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 52, 48,
-/* 0x37b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x37c0 */  32, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 69,
-/* 0x37d0 */  83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x37e0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32,
-/* 0x37f0 */  48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3800 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83,
-/* 0x3810 */  77, 65, 54, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 54, 48, 10,
-/* 0x3820 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3830 */  32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 69, 70,
-/* 0x3840 */  65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3850 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,
-/* 0x3860 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48,
-/* 0x3870 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x3880 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65,
-/* 0x3890 */  95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x38a0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x38b0 */  49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x38c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x38d0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90,
-/* 0x38e0 */  77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x38f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x3900 */  69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x3910 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3920 */ 100, 32, 32, 84, 77, 84, 77, 65, 73, 78, 53, 32, 48, 32, 84, 77,
-/* 0x3930 */  84, 77, 65, 73, 78, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3940 */ 108, 32, 32, 32, 32,100, 32, 32, 84, 77, 84, 67, 65, 76, 84, 50,
-/* 0x3950 */  32, 48, 32, 84, 77, 84, 67, 65, 76, 84, 50, 10, 48, 48, 48, 48,
-/* 0x3960 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67,
-/* 0x3970 */  76, 69, 86, 69, 49, 32, 48, 32, 67, 84, 67, 76, 69, 86, 69, 49,
-/* 0x3980 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3990 */  32, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 48, 32, 67, 65, 76,
-/* 0x39a0 */  76, 84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x39b0 */  32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32,
-/* 0x39c0 */  48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10, 48, 48, 48, 48, 48,
-/* 0x39d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82,
-/* 0x39e0 */  79, 82, 48, 49, 32, 48, 32, 67, 84, 66, 82, 79, 82, 48, 49, 10,
-/* 0x39f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3a00 */  32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 48, 32, 67, 84, 66, 83,
-/* 0x3a10 */  87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3a20 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 48,
-/* 0x3a30 */  32, 67, 65, 76, 76, 84, 82, 48, 50, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3a40 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84,
-/* 0x3a50 */  82, 69, 56, 32, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 10, 48,
-/* 0x3a60 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3a70 */  67, 65, 76, 76, 84, 82, 69, 57, 32, 48, 32, 67, 65, 76, 76, 84,
-/* 0x3a80 */  82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3a90 */  32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 48, 32,
-/* 0x3aa0 */  67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ab0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3ac0 */  49, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 50, 10, 48, 48,
-/* 0x3ad0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x3ae0 */  84, 66, 83, 72, 82, 49, 49, 32, 48, 32, 67, 84, 66, 83, 72, 82,
-/* 0x3af0 */  49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3b00 */  32,100, 32, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 48, 32, 67,
-/* 0x3b10 */  84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b20 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 49,
-/* 0x3b30 */  49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48, 48,
-/* 0x3b40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,
-/* 0x3b50 */ 111,107, 51, 50, 46, 51, 48, 32, 48, 32, 99,116,111,107, 51, 50,
-/* 0x3b60 */  46, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3b70 */  32, 32,100, 32, 32, 84, 77, 84, 82, 69, 76, 79, 67, 32, 48, 32,
-/* 0x3b80 */  84, 77, 84, 82, 69, 76, 79, 67, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3b90 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 51, 50, 66,
-/* 0x3ba0 */  73, 71, 32, 48, 32, 82, 69, 76, 51, 50, 66, 73, 71, 10, 48, 48,
-/* 0x3bb0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 82,
-/* 0x3bc0 */  69, 76, 51, 50, 69, 78, 68, 32, 48, 32, 82, 69, 76, 51, 50, 69,
-/* 0x3bd0 */  78, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3be0 */  32,100, 32, 32, 84, 77, 84, 74, 85, 77, 80, 49, 32, 48, 32, 84,
-/* 0x3bf0 */  77, 84, 74, 85, 77, 80, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x3c10 */  32, 99,111,112,121, 95,115,111,117,114, 99,101, 10, 48, 48, 48,
-/* 0x3c20 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x3c30 */  78, 68, 42, 32, 48, 32, 99,111,112,121, 95,100,101,115,116, 10,
-/* 0x3c40 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3c50 */  32, 42, 85, 78, 68, 42, 32, 48, 32, 98,121,116,101,115, 95,116,
-/* 0x3c60 */ 111, 95, 99,111,112,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3c70 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x3c80 */ 108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,
-/* 0x3c90 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3ca0 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,
-/* 0x3cb0 */ 117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3cc0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,
-/* 0x3cd0 */ 122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3ce0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x3cf0 */  32, 48, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,
-/* 0x3d00 */ 101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x3d10 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,108,116,
-/* 0x3d20 */ 101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3d30 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x3d40 */  32, 48, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48,
-/* 0x3d50 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x3d60 */  85, 78, 68, 42, 32, 48, 32,111,114,105,103,105,110, 97,108, 95,
-/* 0x3d70 */ 101,110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x3d80 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 84,
-/* 0x3d90 */  77, 84, 77, 65, 73, 78, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x3da0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3db0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x3dc0 */  48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x3dd0 */  32, 32, 32, 32, 32, 32, 99,111,112,121, 95,115,111,117,114, 99,
-/* 0x3de0 */ 101, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x3df0 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,111,112,
-/* 0x3e00 */ 121, 95,100,101,115,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x3e10 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x3e20 */  84, 77, 84, 77, 65, 73, 78, 49, 66, 93, 58, 10, 79, 70, 70, 83,
-/* 0x3e30 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e40 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x3e50 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x3e60 */  32, 32, 32, 32, 32, 32, 32, 32, 98,121,116,101,115, 95,116,111,
-/* 0x3e70 */  95, 99,111,112,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x3e80 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 84,
-/* 0x3e90 */  77, 84, 77, 65, 73, 78, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x3ea0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3eb0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x3ec0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x3ed0 */  32, 32, 32, 32, 32, 32, 84, 77, 84, 67, 85, 84, 80, 79, 10, 10,
-/* 0x3ee0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x3ef0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x3f00 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3f10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3f20 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x3f30 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x3f40 */  50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x3f50 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x3f60 */  91, 78, 50, 66, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x3f70 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f80 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x3f90 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x3fa0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x3fb0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3fc0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65,
-/* 0x3fd0 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x3fe0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ff0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x4000 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4010 */  32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4020 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4030 */  82, 32, 91, 78, 50, 66, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70,
-/* 0x4040 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4050 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4060 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4070 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x4080 */  49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4090 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83,
-/* 0x40a0 */  77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x40b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x40c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x40d0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x40e0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76,
-/* 0x40f0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4100 */  70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 51, 48, 93, 58, 10,
-/* 0x4110 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4120 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4130 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4140 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x4150 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x4160 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4170 */  78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4180 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4190 */  32, 91, 78, 50, 66, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x41a0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x41b0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x41c0 */  48, 48, 48, 48, 49, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x41d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 54,
-/* 0x41e0 */  48, 10, 48, 48, 48, 48, 48, 48, 50,102, 32, 82, 95, 51, 56, 54,
-/* 0x41f0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x4200 */  68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x4210 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x4220 */  50, 66, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x4230 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4240 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4250 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4260 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10,
-/* 0x4270 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4280 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 52, 48,
-/* 0x4290 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x42a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x42b0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x42c0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x42d0 */  50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x42e0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x42f0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x4300 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4310 */  70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 54, 48, 93, 58, 10,
-/* 0x4320 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4330 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4340 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4350 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x4360 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4370 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4380 */  66, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4390 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x43a0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x43b0 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x43c0 */  32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48,
-/* 0x43d0 */  48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x43e0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x43f0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4400 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65,
-/* 0x4410 */  83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4420 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4430 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32,
-/* 0x4440 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x4450 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x4460 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4470 */  79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 49, 48, 93, 58, 10, 79,
-/* 0x4480 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4490 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x44a0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x44b0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x44c0 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x44d0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x44e0 */  70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x44f0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4500 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4510 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4520 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x4530 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4540 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 50, 48, 93, 58,
-/* 0x4550 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4560 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4570 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x4580 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x4590 */  83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x45a0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x45b0 */  50, 68, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x45c0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x45d0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x45e0 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x45f0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 10,
-/* 0x4600 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4610 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 51, 48,
-/* 0x4620 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4630 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4640 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x4650 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4660 */  50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4670 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4680 */  91, 78, 50, 68, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4690 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x46a0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x46b0 */  48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x46c0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x46d0 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x46e0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x46f0 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4700 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4710 */  68, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4720 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4730 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4740 */  48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4750 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x4760 */  48, 48, 48, 48, 50, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x4770 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 54,
-/* 0x4780 */  48, 10, 48, 48, 48, 48, 48, 48, 52, 51, 32, 82, 95, 51, 56, 54,
-/* 0x4790 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x47a0 */  68, 69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x47b0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x47c0 */  50, 68, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x47d0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x47e0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x47f0 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4800 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10,
-/* 0x4810 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4820 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 52, 48,
-/* 0x4830 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4840 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4850 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x4860 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4870 */  50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x4880 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x4890 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x48a0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x48b0 */  70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 54, 48, 93, 58, 10,
-/* 0x48c0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x48d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x48e0 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x48f0 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x4900 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4910 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4920 */  68, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4930 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4940 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4950 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4960 */  32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48,
-/* 0x4970 */  48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x4980 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x4990 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x49a0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65,
-/* 0x49b0 */  83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x49c0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49d0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32,
-/* 0x49e0 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x49f0 */  32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x4a00 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4a10 */  79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 49, 48, 93, 58, 10, 79,
-/* 0x4a20 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4a30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4a40 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x4a50 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x4a60 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4a70 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x4a80 */  70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4a90 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4aa0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ab0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4ac0 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x4ad0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4ae0 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 50, 48, 93, 58,
-/* 0x4af0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4b00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4b10 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x4b20 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x4b30 */  83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x4b40 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x4b50 */  50, 69, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x4b60 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b70 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4b80 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4b90 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 10,
-/* 0x4ba0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4bb0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 51, 48,
-/* 0x4bc0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4bd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4be0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x4bf0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4c00 */  50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4c10 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4c20 */  91, 78, 50, 69, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4c30 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c40 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4c50 */  48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x4c60 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x4c70 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4c80 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x4c90 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4ca0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4cb0 */  69, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4cc0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4cd0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ce0 */  48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4cf0 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x4d00 */  48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x4d10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 53,
-/* 0x4d20 */  48, 10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 51, 56, 54,
-/* 0x4d30 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x4d40 */  68, 69, 67, 54, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x4d50 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x4d60 */  50, 69, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x4d70 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4d80 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4d90 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4da0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10,
-/* 0x4db0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4dc0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 52, 48,
-/* 0x4dd0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4de0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4df0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x4e00 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4e10 */  50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x4e20 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x4e30 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x4e40 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4e50 */  70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 54, 48, 93, 58, 10,
-/* 0x4e60 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4e70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4e80 */  10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4e90 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x4ea0 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4eb0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4ec0 */  69, 70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4ed0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ee0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ef0 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4f00 */  32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48,
-/* 0x4f10 */  48, 48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x4f20 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x4f30 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4f40 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65,
-/* 0x4f50 */  83, 54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4f60 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f70 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32,
-/* 0x4f80 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x4f90 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x4fa0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4fb0 */  79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58,
-/* 0x4fc0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4fd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4fe0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54,
-/* 0x4ff0 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x5000 */  97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48,
-/* 0x5010 */  48, 48, 48, 48, 48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x5020 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117,
-/* 0x5030 */  95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95,
-/* 0x5040 */  51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5050 */ 108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48,
-/* 0x5060 */  48, 50, 97, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x5070 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,
-/* 0x5080 */ 114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5090 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x50a0 */  65, 76, 76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x50b0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50c0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x50d0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x50e0 */  32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,110,
-/* 0x50f0 */ 103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5100 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67,
-/* 0x5110 */  76, 69, 86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5120 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5130 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5140 */  50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5150 */  32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48,
-/* 0x5160 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5170 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x5180 */  48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5190 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76,
-/* 0x51a0 */  84, 82, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x51b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x51c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102,
-/* 0x51d0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x51e0 */  32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76,
-/* 0x51f0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5200 */  70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10,
-/* 0x5210 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5220 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5230 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5240 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,
-/* 0x5250 */ 101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5260 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5270 */  82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70,
-/* 0x5280 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5290 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x52a0 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x52b0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x52c0 */  49, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x52d0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76,
-/* 0x52e0 */  69, 86, 69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x52f0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5300 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x5310 */  32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5320 */  32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48,
-/* 0x5330 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5340 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x5350 */  49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5360 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84,
-/* 0x5370 */  82, 49, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5380 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5390 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32,
-/* 0x53a0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x53b0 */  32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x53c0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x53d0 */  79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10,
-/* 0x53e0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x53f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5400 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5410 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,
-/* 0x5420 */ 101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5430 */  48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5440 */  32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10,
-/* 0x5450 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5460 */  68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49,
-/* 0x5470 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5480 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5490 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95,
-/* 0x54a0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x54b0 */  99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x54c0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x54d0 */  82, 32, 91, 99,116,111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79,
-/* 0x54e0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x54f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5500 */  48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5510 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0x5520 */  50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95,
-/* 0x5530 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5540 */  99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5550 */  48,101, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5560 */  32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10,
-/* 0x5570 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5580 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0x5590 */  50, 46, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x55a0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,
-/* 0x55b0 */ 111,107, 51, 50, 46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x55c0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x55d0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x55e0 */  48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x55f0 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10,
-/* 0x5600 */  48, 48, 48, 48, 48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5610 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51,
-/* 0x5620 */  50, 46, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5630 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,
-/* 0x5640 */ 111,107, 51, 50, 46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5650 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5660 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5670 */  48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5680 */  32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10,
-/* 0x5690 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x56a0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67, 51, 50,
-/* 0x56b0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x56c0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x56d0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95,
-/* 0x56e0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x56f0 */  82, 69, 76, 79, 67, 51, 50, 74, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5700 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5710 */  32, 91, 82, 69, 76, 51, 50, 66, 73, 71, 93, 58, 10, 79, 70, 70,
-/* 0x5720 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5730 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5740 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5750 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 82, 69, 76, 79, 67, 51, 50,
-/* 0x5760 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5770 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67,
-/* 0x5780 */  51, 50, 74, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5790 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57a0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x57b0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57c0 */  32, 32, 82, 69, 76, 79, 67, 51, 50, 48, 10, 10, 82, 69, 76, 79,
-/* 0x57d0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x57e0 */  79, 82, 32, 91, 84, 77, 84, 74, 85, 77, 80, 49, 93, 58, 10, 79,
-/* 0x57f0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5800 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5810 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5820 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,
-/* 0x5830 */ 110, 97,108, 95,101,110,116,114,121, 10
+/* 0x1a00 */  99,  0,  0,  0,109,  0,  0,  0, 81,  0,  0,  0, 54,  4,  0,  0,
+/* 0x1a10 */   0,  0,  0,  0, 52,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */   9,  0,  0,  0, 70,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */  19,  0,  0,  0, 72,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a40 */  29,  0,  0,  0, 86,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */  38,  0,  0,  0, 87,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */  47,  0,  0,  0, 92,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */  56,  0,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */  65,  0,  0,  0,124,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */  74,  0,  0,  0,127,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1aa0 */  83,  0,  0,  0,129,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */  92,  0,  0,  0,135,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */ 101,  0,  0,  0,146,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ad0 */ 110,  0,  0,  0,151,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ae0 */ 119,  0,  0,  0,160,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */ 128,  0,  0,  0,173,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b00 */ 137,  0,  0,  0,186,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b10 */ 146,  0,  0,  0,201,  0,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */ 155,  0,  0,  0,  7,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b30 */ 164,  0,  0,  0, 20,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b40 */ 173,  0,  0,  0, 35,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */ 182,  0,  0,  0, 37,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b60 */ 191,  0,  0,  0, 40,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b70 */ 200,  0,  0,  0, 49,  1,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */ 209,  0,  0,  0, 61,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */ 218,  0,  0,  0, 86,  1,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ba0 */ 227,  0,  0,  0,108,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */ 236,  0,  0,  0,108,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bc0 */ 245,  0,  0,  0,111,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bd0 */ 254,  0,  0,  0,113,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */   7,  1,  0,  0,119,  1,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bf0 */  16,  1,  0,  0,130,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c00 */  25,  1,  0,  0,135,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */  34,  1,  0,  0,144,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c20 */  43,  1,  0,  0,157,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */  52,  1,  0,  0,170,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */  61,  1,  0,  0,185,  1,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c50 */  70,  1,  0,  0, 11,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */  79,  1,  0,  0, 24,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */  88,  1,  0,  0, 39,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c80 */  97,  1,  0,  0, 41,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c90 */ 106,  1,  0,  0, 44,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */ 115,  1,  0,  0, 53,  2,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cb0 */ 124,  1,  0,  0, 65,  2,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cc0 */ 133,  1,  0,  0, 90,  2,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */ 142,  1,  0,  0,112,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */ 151,  1,  0,  0,112,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cf0 */ 160,  1,  0,  0,115,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */ 169,  1,  0,  0,117,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d10 */ 178,  1,  0,  0,123,  2,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d20 */ 187,  1,  0,  0,134,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d30 */ 196,  1,  0,  0,139,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d40 */ 205,  1,  0,  0,148,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d50 */ 214,  1,  0,  0,161,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */ 223,  1,  0,  0,174,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */ 232,  1,  0,  0,189,  2,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d80 */ 241,  1,  0,  0, 28,  3,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d90 */ 250,  1,  0,  0, 41,  3,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */   3,  2,  0,  0, 56,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1db0 */  12,  2,  0,  0, 58,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dc0 */  21,  2,  0,  0, 61,  3,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dd0 */  30,  2,  0,  0, 70,  3,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1de0 */  39,  2,  0,  0, 82,  3,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1df0 */  48,  2,  0,  0,107,  3,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */  57,  2,  0,  0,129,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e10 */  66,  2,  0,  0,129,  3,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e20 */  77,  2,  0,  0,175,  3,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e30 */  88,  2,  0,  0,247,  3,  0,  0,134, 10,  0,  0,  0,  0,  0,  0,
+/* 0x1e40 */  99,  2,  0,  0,125, 14,  0,  0,134, 10,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */ 110,  2,  0,  0,  3, 25,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */ 121,  2,  0,  0, 29, 25,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */ 130,  2,  0,  0, 35, 25,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e80 */ 139,  2,  0,  0, 36, 25,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */ 148,  2,  0,  0, 50, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */ 157,  2,  0,  0, 55, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */ 166,  2,  0,  0, 60, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */ 175,  2,  0,  0, 64, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */ 184,  2,  0,  0, 66, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */ 193,  2,  0,  0, 71, 25,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ef0 */ 202,  2,  0,  0, 87, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */ 211,  2,  0,  0, 92, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */ 220,  2,  0,  0, 94, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f20 */ 229,  2,  0,  0, 96, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */ 238,  2,  0,  0,100, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */ 247,  2,  0,  0,105, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0,  3,  0,  0,107, 25,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */   9,  3,  0,  0,111, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */  18,  3,  0,  0,113, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f80 */  27,  3,  0,  0,118, 25,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */  36,  3,  0,  0,125, 25,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */  46,  3,  0,  0,135, 25,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */  56,  3,  0,  0,149, 25,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */  66,  3,  0,  0,181, 25,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */  76,  3,  0,  0,191, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */  86,  3,  0,  0,196, 25,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ff0 */  95,  3,  0,  0,199, 25,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */ 104,  3,  0,  0,240, 25,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */ 113,  3,  0,  0,249, 25,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */ 122,  3,  0,  0,251, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */ 131,  3,  0,  0,251, 25,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2040 */  56,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,
+/* 0x2050 */   7,  0,  0,  0,  0,  0,  0,  0, 83,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0, 92,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2070 */ 119,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,  0,
+/* 0x2080 */  16,  0,  0,  0,  0,  0,  0,  0,191,  0,  0,  0, 21,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,218,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20a0 */ 227,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,236,  0,  0,  0,
+/* 0x20b0 */  26,  0,  0,  0,  0,  0,  0,  0,254,  0,  0,  0, 28,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  7,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20d0 */  34,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 61,  1,  0,  0,
+/* 0x20e0 */  35,  0,  0,  0,  0,  0,  0,  0,106,  1,  0,  0, 40,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,133,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */ 142,  1,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,151,  1,  0,  0,
+/* 0x2110 */  45,  0,  0,  0,  0,  0,  0,  0,169,  1,  0,  0, 47,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,178,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2130 */ 205,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,232,  1,  0,  0,
+/* 0x2140 */  54,  0,  0,  0,  0,  0,  0,  0, 21,  2,  0,  0, 59,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0, 48,  2,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2160 */  57,  2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0,139,  2,  0,  0,
+/* 0x2170 */  71,  0,  0,  0,  0,  0,  0,  0,202,  2,  0,  0, 78,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,229,  2,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2190 */  27,  3,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0, 36,  3,  0,  0,
+/* 0x21a0 */  88,  0,  0,  0,  0,  0,  0,  0, 46,  3,  0,  0, 89,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0, 56,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */  76,  3,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0, 95,  3,  0,  0,
+/* 0x21d0 */  94,  0,  0,  0,  0,  0,  0,  0,113,  3,  0,  0, 96,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,
+/* 0x2200 */   2,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0, 38,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2220 */  47,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 74,  0,  0,  0,
+/* 0x2230 */   8,  0,  0,  0,  0,  0,  0,  0,101,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,110,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2250 */ 128,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,137,  0,  0,  0,
+/* 0x2260 */  15,  0,  0,  0,  0,  0,  0,  0,155,  0,  0,  0, 17,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,164,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2280 */ 173,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,182,  0,  0,  0,
+/* 0x2290 */  20,  0,  0,  0,  0,  0,  0,  0,200,  0,  0,  0, 22,  0,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0,209,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22b0 */ 245,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0, 16,  1,  0,  0,
+/* 0x22c0 */  30,  0,  0,  0,  0,  0,  0,  0, 25,  1,  0,  0, 31,  0,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0, 43,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x22e0 */  52,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0, 70,  1,  0,  0,
+/* 0x22f0 */  36,  0,  0,  0,  0,  0,  0,  0, 79,  1,  0,  0, 37,  0,  0,  0,
+/* 0x2300 */   0,  0,  0,  0, 88,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2310 */  97,  1,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,115,  1,  0,  0,
+/* 0x2320 */  41,  0,  0,  0,  0,  0,  0,  0,124,  1,  0,  0, 42,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,160,  1,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2340 */ 187,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,196,  1,  0,  0,
+/* 0x2350 */  50,  0,  0,  0,  0,  0,  0,  0,214,  1,  0,  0, 52,  0,  0,  0,
+/* 0x2360 */   0,  0,  0,  0,223,  1,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2370 */ 241,  1,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0,250,  1,  0,  0,
+/* 0x2380 */  56,  0,  0,  0,  0,  0,  0,  0,  3,  2,  0,  0, 57,  0,  0,  0,
+/* 0x2390 */   0,  0,  0,  0, 12,  2,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23a0 */  30,  2,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0, 39,  2,  0,  0,
+/* 0x23b0 */  61,  0,  0,  0,  0,  0,  0,  0, 66,  2,  0,  0, 64,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0, 77,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23d0 */  88,  2,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0, 99,  2,  0,  0,
+/* 0x23e0 */  67,  0,  0,  0,  0,  0,  0,  0,110,  2,  0,  0, 68,  0,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,121,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2400 */ 130,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,148,  2,  0,  0,
+/* 0x2410 */  72,  0,  0,  0,  0,  0,  0,  0,157,  2,  0,  0, 73,  0,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,166,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2430 */ 175,  2,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,184,  2,  0,  0,
+/* 0x2440 */  76,  0,  0,  0,  0,  0,  0,  0,193,  2,  0,  0, 77,  0,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,211,  2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2460 */ 220,  2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,238,  2,  0,  0,
+/* 0x2470 */  82,  0,  0,  0,  0,  0,  0,  0,247,  2,  0,  0, 83,  0,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,  0,  3,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2490 */   9,  3,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0, 18,  3,  0,  0,
+/* 0x24a0 */  86,  0,  0,  0,  0,  0,  0,  0, 66,  3,  0,  0, 91,  0,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0, 86,  3,  0,  0, 93,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24c0 */ 104,  3,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,122,  3,  0,  0,
+/* 0x24d0 */  97,  0,  0,  0,  0,  0,  0,  0,131,  3,  0,  0, 98,  0,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,140,  3,  0,  0,100,  0,  0,  0,173,222,173,222,
+/* 0x24f0 */ 152,  3,  0,  0,100,  0,  0,  0,173,222,173,222,162,  3,  0,  0,
+/* 0x2500 */ 100,  0,  0,  0,173,222,173,222,176,  3,  0,  0,100,  0,  0,  0,
+/* 0x2510 */ 173,222,173,222,194,  3,  0,  0,100,  0,  0,  0,173,222,173,222,
+/* 0x2520 */ 205,  3,  0,  0,100,  0,  0,  0,173,222,173,222,216,  3,  0,  0,
+/* 0x2530 */ 100,  0,  0,  0,173,222,173,222,232,  3,  0,  0,100,  0,  0,  0,
+/* 0x2540 */ 173,222,173,222,246,  3,  0,  0,100,  0,  0,  0,173,222,173,222,
+/* 0x2550 */   1,  4,  0,  0,100,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x2560 */   8,  0,  0,  0, 16,  4,  0,  0,140,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2570 */   0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0, 16,  4,  0,  0,
+/* 0x2580 */ 152,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2590 */   1,  0,  0,  0, 16,  4,  0,  0,162,  3,  0,  0,  0,  0,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 25,  4,  0,  0,
+/* 0x25b0 */  56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x25c0 */   1,  0,  0,  0, 36,  4,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,  8,  0,  0,  0,  1,  0,  0,  0, 36,  4,  0,  0,
+/* 0x25e0 */  92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x25f0 */   1,  0,  0,  0, 36,  4,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2600 */   0,  0,  0,  0, 12,  0,  0,  0,  3,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2610 */  83,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2620 */  12,  0,  0,  0, 36,  4,  0,  0,119,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2630 */   0,  0,  0,  0, 15,  0,  0,  0,  3,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2640 */ 119,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2650 */  14,  0,  0,  0, 36,  4,  0,  0,119,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2660 */   0,  0,  0,  0, 16,  0,  0,  0, 17,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2670 */ 227,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,
+/* 0x2680 */  47,  0,  0,  0, 36,  4,  0,  0,191,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2690 */   0,  0,  0,  0, 17,  0,  0,  0, 12,  0,  0,  0, 36,  4,  0,  0,
+/* 0x26a0 */ 146,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x26b0 */   3,  0,  0,  0, 36,  4,  0,  0,146,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0, 18,  0,  0,  0, 14,  0,  0,  0, 36,  4,  0,  0,
+/* 0x26d0 */ 146,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,
+/* 0x26e0 */   8,  0,  0,  0, 25,  4,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0, 23,  0,  0,  0, 10,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2700 */ 218,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,
+/* 0x2710 */  21,  0,  0,  0, 25,  4,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2720 */   0,  0,  0,  0, 24,  0,  0,  0, 18,  0,  0,  0, 25,  4,  0,  0,
+/* 0x2730 */  92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
+/* 0x2740 */   1,  0,  0,  0, 36,  4,  0,  0,  7,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2750 */   0,  0,  0,  0, 27,  0,  0,  0,  1,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2760 */   7,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x2770 */   1,  0,  0,  0, 36,  4,  0,  0,236,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2780 */   0,  0,  0,  0, 31,  0,  0,  0,  3,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2790 */ 254,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x27a0 */  12,  0,  0,  0, 36,  4,  0,  0, 61,  1,  0,  0,  0,  0,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0, 34,  0,  0,  0,  5,  0,  0,  0, 36,  4,  0,  0,
+/* 0x27c0 */  61,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  0,  0,  0,
+/* 0x27d0 */  14,  0,  0,  0, 36,  4,  0,  0, 61,  1,  0,  0,  0,  0,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0, 35,  0,  0,  0, 15,  0,  0,  0, 36,  4,  0,  0,
+/* 0x27f0 */  34,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,
+/* 0x2800 */  33,  0,  0,  0, 36,  4,  0,  0,142,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2810 */   0,  0,  0,  0, 35,  0,  0,  0, 67,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2820 */ 106,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x2830 */  12,  0,  0,  0, 36,  4,  0,  0, 61,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2840 */   0,  0,  0,  0, 37,  0,  0,  0,  3,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2850 */  61,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,
+/* 0x2860 */  14,  0,  0,  0, 36,  4,  0,  0, 61,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2870 */   0,  0,  0,  0, 41,  0,  0,  0,  8,  0,  0,  0, 25,  4,  0,  0,
+/* 0x2880 */   7,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,
+/* 0x2890 */  10,  0,  0,  0, 36,  4,  0,  0,133,  1,  0,  0,  0,  0,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0, 42,  0,  0,  0, 21,  0,  0,  0, 25,  4,  0,  0,
+/* 0x28b0 */   7,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,  0,  0,  0,
+/* 0x28c0 */  18,  0,  0,  0, 25,  4,  0,  0,  7,  1,  0,  0,  0,  0,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0, 45,  0,  0,  0,  1,  0,  0,  0, 36,  4,  0,  0,
+/* 0x28e0 */ 178,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,
+/* 0x28f0 */   1,  0,  0,  0, 36,  4,  0,  0,178,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2900 */   0,  0,  0,  0, 49,  0,  0,  0,  1,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2910 */ 151,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,
+/* 0x2920 */   3,  0,  0,  0, 36,  4,  0,  0,169,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2930 */   0,  0,  0,  0, 52,  0,  0,  0, 12,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2940 */ 232,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0,
+/* 0x2950 */   5,  0,  0,  0, 36,  4,  0,  0,232,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2960 */   0,  0,  0,  0, 53,  0,  0,  0, 14,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2970 */ 232,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x2980 */  15,  0,  0,  0, 36,  4,  0,  0,205,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2990 */   0,  0,  0,  0, 54,  0,  0,  0, 30,  0,  0,  0, 36,  4,  0,  0,
+/* 0x29a0 */  21,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x29b0 */  48,  0,  0,  0, 36,  4,  0,  0, 57,  2,  0,  0,  0,  0,  0,  0,
+/* 0x29c0 */   0,  0,  0,  0, 55,  0,  0,  0, 12,  0,  0,  0, 36,  4,  0,  0,
+/* 0x29d0 */ 232,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x29e0 */   3,  0,  0,  0, 36,  4,  0,  0,232,  1,  0,  0,  0,  0,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0, 56,  0,  0,  0, 14,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2a00 */ 232,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,
+/* 0x2a10 */   8,  0,  0,  0, 25,  4,  0,  0,178,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2a20 */   0,  0,  0,  0, 61,  0,  0,  0, 10,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2a30 */  48,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0,
+/* 0x2a40 */  21,  0,  0,  0, 25,  4,  0,  0,178,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2a50 */   0,  0,  0,  0, 62,  0,  0,  0, 18,  0,  0,  0, 25,  4,  0,  0,
+/* 0x2a60 */ 178,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,
+/* 0x2a70 */   5,  0,  0,  0, 16,  4,  0,  0,176,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2a80 */   0,  0,  0,  0, 64,  0,  0,  0, 20,  0,  0,  0, 16,  4,  0,  0,
+/* 0x2a90 */ 194,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,
+/* 0x2aa0 */  30,  0,  0,  0, 16,  4,  0,  0,205,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2ab0 */   0,  0,  0,  0, 64,  0,  0,  0, 42,  0,  0,  0, 16,  4,  0,  0,
+/* 0x2ac0 */ 216,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0,
+/* 0x2ad0 */   1,  0,  0,  0, 16,  4,  0,  0,232,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0, 72,  0,  0,  0,  2,  0,  0,  0, 46,  4,  0,  0,
+/* 0x2af0 */ 246,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,
+/* 0x2b00 */   4,  0,  0,  0, 36,  4,  0,  0,139,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0, 77,  0,  0,  0, 15,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2b20 */ 139,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0,
+/* 0x2b30 */   1,  0,  0,  0, 16,  4,  0,  0,232,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0, 81,  0,  0,  0,  3,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2b50 */  27,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 82,  0,  0,  0,
+/* 0x2b60 */   2,  0,  0,  0, 46,  4,  0,  0,246,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0, 82,  0,  0,  0,  4,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2b80 */ 229,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 87,  0,  0,  0,
+/* 0x2b90 */   6,  0,  0,  0, 36,  4,  0,  0,202,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0, 88,  0,  0,  0,  1,  0,  0,  0, 16,  4,  0,  0,
+/* 0x2bb0 */ 232,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  0,  0,  0,
+/* 0x2bc0 */   6,  0,  0,  0, 36,  4,  0,  0, 56,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0, 89,  0,  0,  0, 13,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2be0 */  56,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x2bf0 */   5,  0,  0,  0, 36,  4,  0,  0, 76,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2c10 */  76,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x2c20 */  14,  0,  0,  0, 46,  4,  0,  0,246,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0, 90,  0,  0,  0, 16,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2c40 */  76,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,
+/* 0x2c50 */   4,  0,  0,  0, 36,  4,  0,  0, 76,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0, 91,  0,  0,  0,  9,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2c70 */  46,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 92,  0,  0,  0,
+/* 0x2c80 */   4,  0,  0,  0, 36,  4,  0,  0, 36,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0, 94,  0,  0,  0,  8,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2ca0 */ 113,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,  0,  0,  0,
+/* 0x2cb0 */   3,  0,  0,  0, 36,  4,  0,  0, 95,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0, 96,  0,  0,  0,  1,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2cd0 */  95,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,
+/* 0x2ce0 */   1,  0,  0,  0, 25,  4,  0,  0,  1,  4,  0,  0,  0,  0,  0,  0,
+/* 0x2cf0 */   0,  0,  0,  0, 84, 77, 84, 77, 65, 73, 78, 49,  0, 84, 77, 84,
+/* 0x2d00 */  77, 65, 73, 78, 49, 65,  0, 84, 77, 84, 77, 65, 73, 78, 49, 66,
+/* 0x2d10 */   0, 84, 77, 84, 67, 65, 76, 84, 49,  0, 84, 77, 84, 77, 65, 73,
+/* 0x2d20 */  78, 50,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0, 84, 77, 84, 67,
+/* 0x2d30 */  85, 84, 80, 79,  0, 78, 50, 66, 83, 77, 65, 49, 48,  0, 78, 50,
+/* 0x2d40 */  66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 49,  0,
+/* 0x2d50 */  78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66, 83, 77, 65, 50,
+/* 0x2d60 */  48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78, 50, 66, 68, 69,
+/* 0x2d70 */  67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,  0, 78, 50, 66,
+/* 0x2d80 */  70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67, 51, 48,  0, 78,
+/* 0x2d90 */  50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70, 65, 83, 52, 48,
+/* 0x2da0 */   0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50, 66, 70, 65, 83,
+/* 0x2db0 */  53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0, 78, 50, 66, 83,
+/* 0x2dc0 */  77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 48,  0, 78, 50,
+/* 0x2dd0 */  66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69, 67, 54, 48,  0,
+/* 0x2de0 */  78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49,
+/* 0x2df0 */  48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78, 50, 68, 68, 69,
+/* 0x2e00 */  67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,  0, 78, 50, 68,
+/* 0x2e10 */  70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67, 50, 48,  0, 78,
+/* 0x2e20 */  50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70, 65, 83, 51, 48,
+/* 0x2e30 */   0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50, 68, 83, 77, 65,
+/* 0x2e40 */  52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0, 78, 50, 68, 83,
+/* 0x2e50 */  77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53, 48,  0, 78, 50,
+/* 0x2e60 */  68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77, 65, 54, 48,  0,
+/* 0x2e70 */  78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54,
+/* 0x2e80 */  49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78, 50, 69, 83, 77,
+/* 0x2e90 */  65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,  0, 78, 50, 69,
+/* 0x2ea0 */  70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67, 49, 48,  0, 78,
+/* 0x2eb0 */  50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70, 65, 83, 50, 48,
+/* 0x2ec0 */   0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50, 69, 83, 77, 65,
+/* 0x2ed0 */  51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0, 78, 50, 69, 68,
+/* 0x2ee0 */  69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52, 48,  0, 78, 50,
+/* 0x2ef0 */  69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77, 65, 53, 48,  0,
+/* 0x2f00 */  78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69, 68, 69, 67, 53,
+/* 0x2f10 */  48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78, 50, 69, 70, 65,
+/* 0x2f20 */  83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,  0, 78, 50, 69,
+/* 0x2f30 */  68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,
+/* 0x2f40 */   0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65,
+/* 0x2f50 */  95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50,
+/* 0x2f60 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 84, 77, 84,
+/* 0x2f70 */  77, 65, 73, 78, 53,  0, 84, 77, 84, 67, 65, 76, 84, 50,  0, 67,
+/* 0x2f80 */  65, 76, 76, 84, 82, 48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,
+/* 0x2f90 */   0, 67, 65, 76, 76, 84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82,
+/* 0x2fa0 */  48, 49,  0, 67, 84, 66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83,
+/* 0x2fb0 */  87, 65, 48, 49,  0, 67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65,
+/* 0x2fc0 */  76, 76, 84, 82, 49, 48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0,
+/* 0x2fd0 */  67, 65, 76, 76, 84, 82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49,
+/* 0x2fe0 */  49,  0, 67, 84, 67, 76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84,
+/* 0x2ff0 */  82, 49, 50,  0, 67, 84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66,
+/* 0x3000 */  82, 79, 82, 49, 49,  0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67,
+/* 0x3010 */  65, 76, 76, 84, 82, 49, 51,  0, 99,116,111,107, 51, 50, 46, 48,
+/* 0x3020 */  48,  0, 99,116,111,107, 51, 50, 46, 49, 48,  0, 99,116,111,107,
+/* 0x3030 */  51, 50, 46, 50, 48,  0, 99,116,111,107, 51, 50, 46, 51, 48,  0,
+/* 0x3040 */  99,116,111,107, 51, 50, 46, 52, 48,  0, 84, 77, 84, 82, 69, 76,
+/* 0x3050 */  79, 67,  0, 82, 69, 76, 79, 67, 51, 50, 48,  0, 82, 69, 76, 51,
+/* 0x3060 */  50, 66, 73, 71,  0, 82, 69, 76, 79, 67, 51, 50, 74,  0, 82, 69,
+/* 0x3070 */  76, 51, 50, 69, 78, 68,  0, 84, 77, 84, 74, 85, 77, 80, 49,  0,
+/* 0x3080 */  99,111,112,121, 95,115,111,117,114, 99,101,  0, 99,111,112,121,
+/* 0x3090 */  95,100,101,115,116,  0, 98,121,116,101,115, 95,116,111, 95, 99,
+/* 0x30a0 */ 111,112,121,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,
+/* 0x30b0 */ 100,106,117,115,116,  0,108,122,109, 97, 95,117, 95,108,101,110,
+/* 0x30c0 */   0,108,122,109, 97, 95, 99, 95,108,101,110,  0,108,122,109, 97,
+/* 0x30d0 */  95,112,114,111,112,101,114,116,105,101,115,  0,102,105,108,116,
+/* 0x30e0 */ 101,114, 95,108,101,110,103,116,104,  0,102,105,108,116,101,114,
+/* 0x30f0 */  95, 99,116,111,  0,111,114,105,103,105,110, 97,108, 95,101,110,
+/* 0x3100 */ 116,114,121,  0, 82, 95, 51, 56, 54, 95, 51, 50,  0, 82, 95, 51,
+/* 0x3110 */  56, 54, 95, 80, 67, 51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67,
+/* 0x3120 */  56,  0, 82, 95, 51, 56, 54, 95, 56,  0,  0, 26,  0,  0, 85, 80,
+/* 0x3130 */  88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* i386-dos32.watcom.le.h
-   created from i386-dos32.watcom.le.bin, 22961 (0x59b1) bytes
+   created from i386-dos32.watcom.le.bin, 12797 (0x31fd) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_DOS32_WATCOM_LE_SIZE    22961
-#define STUB_I386_DOS32_WATCOM_LE_ADLER32 0x4a846c5a
-#define STUB_I386_DOS32_WATCOM_LE_CRC32   0xb0bd5d5b
+#define STUB_I386_DOS32_WATCOM_LE_SIZE    12797
+#define STUB_I386_DOS32_WATCOM_LE_ADLER32 0x61391327
+#define STUB_I386_DOS32_WATCOM_LE_CRC32   0x39689615
 
-unsigned char stub_i386_dos32_watcom_le[22961] = {
+unsigned char stub_i386_dos32_watcom_le[12797] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 180, 30,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -454,1022 +454,386 @@ unsigned char stub_i386_dos32_watcom_le[22961] = {
 /* 0x19f0 */  16,134,196,  1,232,137,  7,235,226, 36, 15,193,224, 16,102,139,
 /* 0x1a00 */   6,131,198,  2,  9,192,117, 12,139,  6,131,198,  4,235, 12,255,
 /* 0x1a10 */ 214, 95, 89, 41,249,193,233,  2,243,171,  7,141,165,  0,  0,  0,
-/* 0x1a20 */   0,233,252,255,255,255,102,105,108,101, 32,102,111,114,109, 97,
-/* 0x1a30 */ 116, 32,101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,101,
-/* 0x1a40 */  99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101,
-/* 0x1a50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32,
-/* 0x1a60 */  32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77,
-/* 0x1a70 */  65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102,
-/* 0x1a80 */  32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32,
-/* 0x1a90 */  48, 32, 87, 67, 76, 69, 77, 65, 73, 78, 32, 32, 32, 32, 32, 32,
-/* 0x1aa0 */  48, 50, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 32, 32,
-/* 0x1ab0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1ac0 */  32, 49, 32, 87, 67, 76, 69, 77, 65, 73, 78, 48, 50, 32, 32, 32,
-/* 0x1ad0 */  32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53,100, 32, 32,
-/* 0x1ae0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1af0 */  32, 50, 32, 87, 67, 76, 69, 77, 65, 73, 78, 48, 51, 32, 32, 32,
-/* 0x1b00 */  32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 54, 48, 32, 32,
-/* 0x1b10 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1b20 */  32, 51, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32,
-/* 0x1b30 */  32, 48, 50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 54, 54, 32,
-/* 0x1b40 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1b50 */  32, 32, 52, 32, 87, 67, 76, 69, 67, 85, 84, 80, 32, 32, 32, 32,
-/* 0x1b60 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 54, 32, 32,
-/* 0x1b70 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1b80 */  32, 53, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32,
-/* 0x1b90 */  32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 54, 32, 32,
-/* 0x1ba0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1bb0 */  32, 54, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32,
-/* 0x1bc0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 57, 32, 32,
-/* 0x1bd0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1be0 */  32, 55, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32,
-/* 0x1bf0 */  32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 98, 32, 32,
-/* 0x1c00 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1c10 */  32, 56, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32,
-/* 0x1c20 */  32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 49, 32, 32,
-/* 0x1c30 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1c40 */  32, 57, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32,
-/* 0x1c50 */  32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 99, 32, 32,
-/* 0x1c60 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1c70 */  49, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32,
-/* 0x1c80 */  32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 97, 49, 32, 32,
-/* 0x1c90 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1ca0 */  49, 49, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32,
-/* 0x1cb0 */  32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 97, 97, 32, 32,
-/* 0x1cc0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1cd0 */  49, 50, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32,
-/* 0x1ce0 */  32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 98, 55, 32, 32,
-/* 0x1cf0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1d00 */  49, 51, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32,
-/* 0x1d10 */  32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 99, 52, 32, 32,
-/* 0x1d20 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1d30 */  49, 52, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32,
-/* 0x1d40 */  32, 48, 51,101, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 51, 32,
-/* 0x1d50 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1d60 */  32, 49, 53, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 32, 32, 32,
-/* 0x1d70 */  32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 49, 49,
-/* 0x1d80 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1d90 */  10, 32, 49, 54, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32, 32, 32,
-/* 0x1da0 */  32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 49,
-/* 0x1db0 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1dc0 */  83, 10, 32, 49, 55, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 32,
-/* 0x1dd0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x1de0 */  50,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1df0 */  84, 83, 10, 32, 49, 56, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32,
-/* 0x1e00 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1e10 */  49, 50,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1e20 */  78, 84, 83, 10, 32, 49, 57, 32, 78, 50, 66, 68, 69, 67, 53, 48,
-/* 0x1e30 */  32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1e40 */  48, 49, 51, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1e50 */  69, 78, 84, 83, 10, 32, 50, 48, 32, 78, 50, 66, 83, 77, 65, 54,
-/* 0x1e60 */  48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1e70 */  32, 48, 49, 51, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1e80 */  84, 69, 78, 84, 83, 10, 32, 50, 49, 32, 78, 50, 66, 70, 65, 83,
-/* 0x1e90 */  54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32,
-/* 0x1ea0 */  48, 32, 32, 48, 49, 52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1eb0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 50, 32, 78, 50, 66, 70,
-/* 0x1ec0 */  65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48,
-/* 0x1ed0 */  32, 32, 48, 32, 32, 48, 49, 54, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1ee0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 51, 32, 78, 50,
-/* 0x1ef0 */  66, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48,
-/* 0x1f00 */  32, 32, 48, 32, 32, 48, 49, 55, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1f10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 52, 32, 78, 50,
-/* 0x1f20 */  68, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32,
-/* 0x1f30 */  48, 32, 32, 48, 32, 32, 48, 49, 55, 54, 32, 32, 50, 42, 42, 48,
-/* 0x1f40 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 53, 32, 78,
-/* 0x1f50 */  50, 68, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x1f60 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 57, 32, 32, 50, 42, 42,
-/* 0x1f70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 54, 32,
-/* 0x1f80 */  78, 50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54,
-/* 0x1f90 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 98, 32, 32, 50, 42,
-/* 0x1fa0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 55,
-/* 0x1fb0 */  32, 78, 50, 68, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1fc0 */  98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 49, 32, 32, 50,
-/* 0x1fd0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x1fe0 */  56, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1ff0 */  48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 99, 32, 32,
-/* 0x2000 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2010 */  50, 57, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32,
-/* 0x2020 */  32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 49, 32,
-/* 0x2030 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2040 */  32, 51, 48, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 32, 32, 32,
-/* 0x2050 */  32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97,
-/* 0x2060 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2070 */  10, 32, 51, 49, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 32, 32,
-/* 0x2080 */  32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x2090 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x20a0 */  83, 10, 32, 51, 50, 32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 32,
-/* 0x20b0 */  32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x20c0 */  98, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x20d0 */  84, 83, 10, 32, 51, 51, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32,
-/* 0x20e0 */  32, 32, 32, 32, 32, 48, 53, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x20f0 */  48, 49, 99, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2100 */  69, 78, 84, 83, 10, 32, 51, 52, 32, 78, 50, 68, 83, 77, 65, 52,
-/* 0x2110 */  48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2120 */  32, 48, 50, 49, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2130 */  84, 69, 78, 84, 83, 10, 32, 51, 53, 32, 78, 50, 68, 70, 65, 83,
-/* 0x2140 */  52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48,
-/* 0x2150 */  32, 32, 48, 50, 50, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2160 */  78, 84, 69, 78, 84, 83, 10, 32, 51, 54, 32, 78, 50, 68, 83, 77,
-/* 0x2170 */  65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2180 */  48, 32, 32, 48, 50, 51, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2190 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 55, 32, 78, 50, 68, 70,
-/* 0x21a0 */  65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32,
-/* 0x21b0 */  32, 48, 32, 32, 48, 50, 51, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x21c0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 56, 32, 78, 50, 68,
-/* 0x21d0 */  68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48,
-/* 0x21e0 */  32, 32, 48, 32, 32, 48, 50, 51, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x21f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 57, 32, 78, 50,
-/* 0x2200 */  68, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32,
-/* 0x2210 */  48, 32, 32, 48, 32, 32, 48, 50, 51,102, 32, 32, 50, 42, 42, 48,
-/* 0x2220 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 48, 32, 78,
-/* 0x2230 */  50, 68, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57,
-/* 0x2240 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 52, 98, 32, 32, 50, 42,
-/* 0x2250 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 49,
-/* 0x2260 */  32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2270 */  49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 54, 52, 32, 32,
-/* 0x2280 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2290 */  52, 50, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32,
-/* 0x22a0 */  32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 97, 32, 32,
-/* 0x22b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x22c0 */  52, 51, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32,
-/* 0x22d0 */  32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 97, 32,
-/* 0x22e0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x22f0 */  32, 52, 52, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 32, 32, 32,
-/* 0x2300 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55,100,
-/* 0x2310 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2320 */  10, 32, 52, 53, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 32, 32,
-/* 0x2330 */  32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55,
-/* 0x2340 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2350 */  83, 10, 32, 52, 54, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 32,
-/* 0x2360 */  32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x2370 */  56, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2380 */  84, 83, 10, 32, 52, 55, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32,
-/* 0x2390 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x23a0 */  50, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x23b0 */  78, 84, 83, 10, 32, 52, 56, 32, 78, 50, 69, 70, 65, 83, 50, 48,
-/* 0x23c0 */  32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x23d0 */  48, 50, 57, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x23e0 */  69, 78, 84, 83, 10, 32, 52, 57, 32, 78, 50, 69, 68, 69, 67, 50,
-/* 0x23f0 */  48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2400 */  32, 48, 50, 57,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2410 */  84, 69, 78, 84, 83, 10, 32, 53, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x2420 */  51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48,
-/* 0x2430 */  32, 32, 48, 50, 97, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2440 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 49, 32, 78, 50, 69, 70, 65,
-/* 0x2450 */  83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32,
-/* 0x2460 */  48, 32, 32, 48, 50, 98, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2470 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 50, 32, 78, 50, 69, 68,
-/* 0x2480 */  69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 53,102, 32, 32, 48,
-/* 0x2490 */  32, 32, 48, 32, 32, 48, 50, 99, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x24a0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 51, 32, 78, 50,
-/* 0x24b0 */  69, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32,
-/* 0x24c0 */  48, 32, 32, 48, 32, 32, 48, 51, 50, 54, 32, 32, 50, 42, 42, 48,
-/* 0x24d0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 52, 32, 78,
-/* 0x24e0 */  50, 69, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32,
-/* 0x24f0 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 51, 51, 32, 32, 50, 42, 42,
-/* 0x2500 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 53, 32,
-/* 0x2510 */  78, 50, 69, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x2520 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 50, 32, 32, 50, 42,
-/* 0x2530 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 54,
-/* 0x2540 */  32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2550 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 52, 32, 32, 50,
-/* 0x2560 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x2570 */  55, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2580 */  48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 55, 32, 32,
-/* 0x2590 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x25a0 */  53, 56, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32,
-/* 0x25b0 */  32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 53, 48, 32,
-/* 0x25c0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x25d0 */  32, 53, 57, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 32, 32, 32,
-/* 0x25e0 */  32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 53,
-/* 0x25f0 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2600 */  83, 10, 32, 54, 48, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 32,
-/* 0x2610 */  32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2620 */  51, 55, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2630 */  78, 84, 83, 10, 32, 54, 49, 32, 78, 50, 69, 68, 69, 67, 54, 48,
-/* 0x2640 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2650 */  51, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2660 */  78, 84, 83, 10, 32, 54, 50, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2670 */  48, 48, 32, 32, 32, 32, 48, 50,101, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2680 */  32, 48, 51, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2690 */  84, 69, 78, 84, 83, 10, 32, 54, 51, 32, 76, 90, 77, 65, 95, 69,
-/* 0x26a0 */  76, 70, 48, 48, 32, 32, 32, 32, 48, 52, 56, 32, 32, 48, 32, 32,
-/* 0x26b0 */  48, 32, 32, 48, 51, 98, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x26c0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 52, 32, 76, 90, 77, 65,
-/* 0x26d0 */  95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 97, 56, 54, 32, 32,
-/* 0x26e0 */  48, 32, 32, 48, 32, 32, 48, 52, 48, 49, 32, 32, 50, 42, 42, 48,
-/* 0x26f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 53, 32, 76,
-/* 0x2700 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 97, 56,
-/* 0x2710 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 56, 55, 32, 32, 50,
-/* 0x2720 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54,
-/* 0x2730 */  54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32,
-/* 0x2740 */  48, 49, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 48,100,
-/* 0x2750 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2760 */  10, 32, 54, 55, 32, 87, 67, 76, 69, 77, 65, 73, 50, 32, 32, 32,
-/* 0x2770 */  32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2780 */  50, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2790 */  84, 83, 10, 32, 54, 56, 32, 87, 67, 67, 84, 84, 80, 79, 83, 32,
-/* 0x27a0 */  32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x27b0 */  49, 57, 51, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x27c0 */  69, 78, 84, 83, 10, 32, 54, 57, 32, 87, 67, 67, 84, 84, 78, 85,
-/* 0x27d0 */  76, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x27e0 */  32, 48, 49, 57, 51, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x27f0 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 48, 32, 67, 65, 76, 76, 84,
-/* 0x2800 */  82, 48, 48, 32, 32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32,
-/* 0x2810 */  48, 32, 32, 48, 49, 57, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2820 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 49, 32, 67, 84, 67,
-/* 0x2830 */  76, 69, 86, 69, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2840 */  32, 32, 48, 32, 32, 48, 49, 57, 52, 54, 32, 32, 50, 42, 42, 48,
-/* 0x2850 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 50, 32, 67,
-/* 0x2860 */  65, 76, 76, 84, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x2870 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 52, 98, 32, 32, 50, 42,
-/* 0x2880 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 51,
-/* 0x2890 */  32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x28a0 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 48, 32, 32,
-/* 0x28b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x28c0 */  55, 52, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 32, 32, 32, 32,
-/* 0x28d0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 52,
-/* 0x28e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x28f0 */  10, 32, 55, 53, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 32, 32,
-/* 0x2900 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2910 */  53, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2920 */  84, 83, 10, 32, 55, 54, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32,
-/* 0x2930 */  32, 32, 32, 32, 32, 48, 49, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2940 */  48, 49, 57, 53, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2950 */  84, 69, 78, 84, 83, 10, 32, 55, 55, 32, 67, 65, 76, 76, 84, 82,
-/* 0x2960 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x2970 */  32, 32, 48, 49, 57, 54, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2980 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 56, 32, 67, 65, 76, 76,
-/* 0x2990 */  84, 82, 69, 56, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x29a0 */  32, 48, 32, 32, 48, 49, 57, 55, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x29b0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 57, 32, 67, 65,
-/* 0x29c0 */  76, 76, 84, 82, 69, 57, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x29d0 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 50, 32, 32, 50, 42, 42,
-/* 0x29e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 48, 32,
-/* 0x29f0 */  67, 65, 76, 76, 84, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 52,
-/* 0x2a00 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 52, 32, 32, 50,
-/* 0x2a10 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56,
-/* 0x2a20 */  49, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 32, 32, 32, 32, 32,
-/* 0x2a30 */  48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 56, 32,
-/* 0x2a40 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2a50 */  32, 56, 50, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 32, 32, 32,
-/* 0x2a60 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55,
-/* 0x2a70 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2a80 */  83, 10, 32, 56, 51, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 32,
-/* 0x2a90 */  32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2aa0 */  57, 55,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2ab0 */  78, 84, 83, 10, 32, 56, 52, 32, 67, 84, 66, 82, 79, 82, 49, 49,
-/* 0x2ac0 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2ad0 */  48, 49, 57, 56, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2ae0 */  84, 69, 78, 84, 83, 10, 32, 56, 53, 32, 67, 84, 66, 83, 87, 65,
-/* 0x2af0 */  49, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x2b00 */  32, 32, 48, 49, 57, 56, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2b10 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 54, 32, 67, 65, 76, 76,
-/* 0x2b20 */  84, 82, 49, 51, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32,
-/* 0x2b30 */  32, 48, 32, 32, 48, 49, 57, 56, 97, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2b40 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 55, 32, 99,116,
-/* 0x2b50 */ 111,107, 51, 50, 46, 48, 48, 32, 32, 32, 32, 32, 48, 97, 32, 32,
-/* 0x2b60 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 57, 49, 32, 32, 50, 42, 42,
-/* 0x2b70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 56, 32,
-/* 0x2b80 */  99,116,111,107, 51, 50, 46, 49, 48, 32, 32, 32, 32, 32, 48,101,
-/* 0x2b90 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 57, 98, 32, 32, 50,
-/* 0x2ba0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56,
-/* 0x2bb0 */  57, 32, 99,116,111,107, 51, 50, 46, 50, 48, 32, 32, 32, 32, 32,
-/* 0x2bc0 */  48, 50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97, 57,
-/* 0x2bd0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2be0 */  10, 32, 57, 48, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 32,
-/* 0x2bf0 */  32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2c00 */  99, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2c10 */  84, 83, 10, 32, 57, 49, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x2c20 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2c30 */  49, 57,100, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2c40 */  69, 78, 84, 83, 10, 32, 57, 50, 32, 87, 67, 82, 69, 76, 79, 67,
-/* 0x2c50 */  49, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2c60 */  32, 48, 49, 57,100, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2c70 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 51, 32, 82, 69, 76, 79, 67,
-/* 0x2c80 */  51, 50, 48, 32, 32, 32, 32, 32, 32, 48, 50, 57, 32, 32, 48, 32,
-/* 0x2c90 */  32, 48, 32, 32, 48, 49, 57,100, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2ca0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 52, 32, 82, 69,
-/* 0x2cb0 */  76, 51, 50, 66, 73, 71, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32,
-/* 0x2cc0 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 48, 52, 32, 32, 50, 42, 42,
-/* 0x2cd0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 53, 32,
-/* 0x2ce0 */  82, 69, 76, 79, 67, 51, 50, 74, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x2cf0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 48,100, 32, 32, 50,
-/* 0x2d00 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57,
-/* 0x2d10 */  54, 32, 82, 69, 76, 51, 50, 69, 78, 68, 32, 32, 32, 32, 32, 32,
-/* 0x2d20 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 48,102, 32, 32,
-/* 0x2d30 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2d40 */  57, 55, 32, 87, 67, 82, 69, 76, 83, 69, 76, 32, 32, 32, 32, 32,
-/* 0x2d50 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 48,102,
-/* 0x2d60 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2d70 */  10, 32, 57, 56, 32, 87, 67, 76, 69, 77, 65, 73, 52, 32, 32, 32,
-/* 0x2d80 */  32, 32, 32, 48, 49, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2d90 */  97, 49, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2da0 */  78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69,
-/* 0x2db0 */  58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2dc0 */ 100, 32, 32, 87, 67, 76, 69, 67, 85, 84, 80, 32, 48, 32, 87, 67,
-/* 0x2dd0 */  76, 69, 67, 85, 84, 80, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2de0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x2df0 */  32, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48,
-/* 0x2e00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x2e10 */  70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 49, 49,
-/* 0x2e20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2e30 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 66,
-/* 0x2e40 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2e50 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32,
-/* 0x2e60 */  48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2e70 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68,
-/* 0x2e80 */  69, 67, 51, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10,
-/* 0x2e90 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2ea0 */  32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 66, 68,
-/* 0x2eb0 */  69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2ec0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 48,
-/* 0x2ed0 */  32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2ee0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69,
-/* 0x2ef0 */  67, 54, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48,
-/* 0x2f00 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2f10 */  78, 50, 68, 83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 68, 83, 77,
-/* 0x2f20 */  65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2f30 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 48, 32,
-/* 0x2f40 */  78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2f50 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2f60 */  49, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x2f70 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x2f80 */  50, 68, 68, 69, 67, 50, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2f90 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2fa0 */  32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 48, 32, 78,
-/* 0x2fb0 */  50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2fc0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 53,
-/* 0x2fd0 */  48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 48, 48, 48,
-/* 0x2fe0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x2ff0 */  68, 70, 65, 83, 54, 49, 32, 48, 32, 78, 50, 68, 70, 65, 83, 54,
-/* 0x3000 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3010 */ 100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50,
-/* 0x3020 */  68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3030 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48,
-/* 0x3040 */  32, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3050 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x3060 */  70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 49, 49,
-/* 0x3070 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3080 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 69,
-/* 0x3090 */  68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x30a0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 32,
-/* 0x30b0 */  48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x30c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68,
-/* 0x30d0 */  69, 67, 51, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10,
-/* 0x30e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x30f0 */  32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 69, 68,
-/* 0x3100 */  69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3110 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 48,
-/* 0x3120 */  32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3130 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69,
-/* 0x3140 */  67, 54, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 48,
-/* 0x3150 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3160 */  67, 65, 76, 76, 84, 82, 48, 48, 32, 48, 32, 67, 65, 76, 76, 84,
-/* 0x3170 */  82, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3180 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 48, 32,
-/* 0x3190 */  67, 65, 76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x31b0 */  49, 49, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 48, 48,
-/* 0x31c0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x31d0 */  65, 76, 76, 84, 82, 49, 51, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x31e0 */  49, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x31f0 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 32, 48, 32,
-/* 0x3200 */  99,116,111,107, 51, 50, 46, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3210 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51,
-/* 0x3220 */  50, 46, 49, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x3230 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3240 */  32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 32, 48, 32, 99,116,
-/* 0x3250 */ 111,107, 51, 50, 46, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3260 */  32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46,
-/* 0x3270 */  52, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48,
-/* 0x3280 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3290 */  82, 69, 76, 79, 67, 51, 50, 48, 32, 48, 32, 82, 69, 76, 79, 67,
-/* 0x32a0 */  51, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x32b0 */  32, 32,100, 32, 32, 82, 69, 76, 79, 67, 51, 50, 74, 32, 48, 32,
-/* 0x32c0 */  82, 69, 76, 79, 67, 51, 50, 74, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 87, 67, 76, 69, 77, 65,
-/* 0x32e0 */  73, 78, 32, 48, 32, 87, 67, 76, 69, 77, 65, 73, 78, 10, 48, 48,
-/* 0x32f0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 87,
-/* 0x3300 */  67, 76, 69, 77, 65, 73, 78, 48, 50, 32, 48, 32, 87, 67, 76, 69,
-/* 0x3310 */  77, 65, 73, 78, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3320 */ 108, 32, 32, 32, 32,100, 32, 32, 87, 67, 76, 69, 77, 65, 73, 78,
-/* 0x3330 */  48, 51, 32, 48, 32, 87, 67, 76, 69, 77, 65, 73, 78, 48, 51, 10,
-/* 0x3340 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3350 */  32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 48, 32, 85, 80, 88, 49,
-/* 0x3360 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3370 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 48,
-/* 0x3380 */  32, 78, 50, 66, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3390 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77,
-/* 0x33a0 */  65, 50, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 50, 48, 10, 48,
-/* 0x33b0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x33c0 */  78, 50, 66, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 66, 70, 65,
-/* 0x33d0 */  83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x33e0 */  32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 48, 32,
-/* 0x33f0 */  78, 50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3400 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x3410 */  51, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 51, 48, 10, 48, 48,
-/* 0x3420 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3430 */  50, 66, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x3440 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3450 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32, 48, 32, 78,
-/* 0x3460 */  50, 66, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3470 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 53,
-/* 0x3480 */  48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48,
-/* 0x3490 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x34a0 */  66, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 53,
-/* 0x34b0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x34c0 */ 100, 32, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50,
-/* 0x34d0 */  66, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x34e0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48,
-/* 0x34f0 */  32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48,
-/* 0x3500 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x3510 */  70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 48,
-/* 0x3520 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3530 */  32, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 68,
-/* 0x3540 */  83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3550 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32,
-/* 0x3560 */  48, 32, 78, 50, 68, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3570 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83,
-/* 0x3580 */  77, 65, 51, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10,
-/* 0x3590 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x35a0 */  32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 68, 70,
-/* 0x35b0 */  65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x35c0 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 48,
-/* 0x35d0 */  32, 78, 50, 68, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x35e0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65,
-/* 0x35f0 */  83, 52, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 52, 48, 10, 48,
-/* 0x3600 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3610 */  78, 50, 68, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 68, 83, 77,
-/* 0x3620 */  65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3630 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 48, 32,
-/* 0x3640 */  78, 50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3650 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65,
-/* 0x3660 */  54, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 54, 48, 10, 48, 48,
-/* 0x3670 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3680 */  50, 68, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x3690 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x36a0 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 48, 32, 78,
-/* 0x36b0 */  50, 69, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x36c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 50,
-/* 0x36d0 */  48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48,
-/* 0x36e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x36f0 */  69, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 50,
-/* 0x3700 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3710 */ 100, 32, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50,
-/* 0x3720 */  69, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3730 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x3740 */  32, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48,
-/* 0x3750 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x3760 */  83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 52, 48,
-/* 0x3770 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3780 */  32, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 69,
-/* 0x3790 */  70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x37a0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32,
-/* 0x37b0 */  48, 32, 78, 50, 69, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x37c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x37d0 */  65, 83, 53, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10,
-/* 0x37e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x37f0 */  32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 69, 83,
-/* 0x3800 */  77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3810 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 48,
-/* 0x3820 */  32, 78, 50, 69, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3830 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3840 */  68, 69, 67, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3850 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3860 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48,
-/* 0x3870 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48,
-/* 0x3880 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x3890 */  65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x38a0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x38b0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x38c0 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x38d0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x38e0 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65,
-/* 0x38f0 */  95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3900 */ 108, 32, 32, 32, 32,100, 32, 32, 87, 67, 76, 69, 77, 65, 73, 50,
-/* 0x3910 */  32, 48, 32, 87, 67, 76, 69, 77, 65, 73, 50, 10, 48, 48, 48, 48,
-/* 0x3920 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 87, 67, 67,
-/* 0x3930 */  84, 84, 80, 79, 83, 32, 48, 32, 87, 67, 67, 84, 84, 80, 79, 83,
-/* 0x3940 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3950 */  32, 32, 87, 67, 67, 84, 84, 78, 85, 76, 32, 48, 32, 87, 67, 67,
-/* 0x3960 */  84, 84, 78, 85, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3970 */  32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32,
-/* 0x3980 */  48, 32, 67, 84, 67, 76, 69, 86, 69, 49, 10, 48, 48, 48, 48, 48,
-/* 0x3990 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x39a0 */  84, 82, 48, 49, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 49, 10,
-/* 0x39b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x39c0 */  32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 48, 32, 67, 84, 66, 83,
-/* 0x39d0 */  72, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x39e0 */  32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 48,
-/* 0x39f0 */  32, 67, 84, 66, 82, 79, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3a00 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87,
-/* 0x3a10 */  65, 48, 49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 48, 49, 10, 48,
-/* 0x3a20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3a30 */  67, 65, 76, 76, 84, 82, 48, 50, 32, 48, 32, 67, 65, 76, 76, 84,
-/* 0x3a40 */  82, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3a50 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32, 48, 32,
-/* 0x3a60 */  67, 65, 76, 76, 84, 82, 69, 56, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a70 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3a80 */  69, 57, 32, 48, 32, 67, 65, 76, 76, 84, 82, 69, 57, 10, 48, 48,
-/* 0x3a90 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x3aa0 */  84, 67, 76, 69, 86, 69, 50, 32, 48, 32, 67, 84, 67, 76, 69, 86,
-/* 0x3ab0 */  69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3ac0 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 48, 32, 67,
-/* 0x3ad0 */  65, 76, 76, 84, 82, 49, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ae0 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 49,
-/* 0x3af0 */  49, 32, 48, 32, 67, 84, 66, 83, 72, 82, 49, 49, 10, 48, 48, 48,
-/* 0x3b00 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x3b10 */  66, 82, 79, 82, 49, 49, 32, 48, 32, 67, 84, 66, 82, 79, 82, 49,
-/* 0x3b20 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3b30 */ 100, 32, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 48, 32, 67, 84,
-/* 0x3b40 */  66, 83, 87, 65, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3b50 */ 108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 51,
-/* 0x3b60 */  48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 51, 48, 10, 48, 48,
-/* 0x3b70 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 87,
-/* 0x3b80 */  67, 82, 69, 76, 79, 67, 49, 32, 48, 32, 87, 67, 82, 69, 76, 79,
-/* 0x3b90 */  67, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3ba0 */  32,100, 32, 32, 82, 69, 76, 51, 50, 66, 73, 71, 32, 48, 32, 82,
-/* 0x3bb0 */  69, 76, 51, 50, 66, 73, 71, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3bc0 */  32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 51, 50, 69, 78,
-/* 0x3bd0 */  68, 32, 48, 32, 82, 69, 76, 51, 50, 69, 78, 68, 10, 48, 48, 48,
-/* 0x3be0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 87, 67,
-/* 0x3bf0 */  82, 69, 76, 83, 69, 76, 32, 48, 32, 87, 67, 82, 69, 76, 83, 69,
-/* 0x3c00 */  76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3c10 */ 100, 32, 32, 87, 67, 76, 69, 77, 65, 73, 52, 32, 48, 32, 87, 67,
-/* 0x3c20 */  76, 69, 77, 65, 73, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3c30 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x3c40 */  99,111,112,121, 95,115,111,117,114, 99,101, 10, 48, 48, 48, 48,
-/* 0x3c50 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x3c60 */  68, 42, 32, 48, 32, 99,111,112,121, 95,100,101,115,116, 10, 48,
-/* 0x3c70 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3c80 */  42, 85, 78, 68, 42, 32, 48, 32,119,111,114,100,115, 95,116,111,
-/* 0x3c90 */  95, 99,111,112,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3ca0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,
-/* 0x3cb0 */ 122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,
-/* 0x3cc0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3cd0 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,117,
-/* 0x3ce0 */  95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x3cf0 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,
-/* 0x3d00 */ 109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d10 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x3d20 */  48, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,
-/* 0x3d30 */ 115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3d40 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,115,116, 97,114,116,
-/* 0x3d50 */  95,111,102, 95,114,101,108,111, 99,115, 10, 48, 48, 48, 48, 48,
-/* 0x3d60 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x3d70 */  42, 32, 48, 32,102,105,108,116,101,114, 95, 98,117,102,102,101,
-/* 0x3d80 */ 114, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x3da0 */  32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10, 48,
-/* 0x3db0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3dc0 */  42, 85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,114, 95, 99,
-/* 0x3dd0 */ 116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x3de0 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,111,114,105,103,
-/* 0x3df0 */ 105,110, 97,108, 95,115,116, 97, 99,107, 10, 48, 48, 48, 48, 48,
-/* 0x3e00 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x3e10 */  42, 32, 48, 32,111,114,105,103,105,110, 97,108, 95,101,110,116,
-/* 0x3e20 */ 114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x3e30 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 87, 67, 76, 69,
-/* 0x3e40 */  77, 65, 73, 78, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x3e50 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e60 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50,
-/* 0x3e70 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e80 */  32, 32, 32, 99,111,112,121, 95,115,111,117,114, 99,101, 10, 48,
-/* 0x3e90 */  48, 48, 48, 48, 48, 49, 56, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x3ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,111,112,121, 95,100,
-/* 0x3eb0 */ 101,115,116, 10, 48, 48, 48, 48, 48, 48, 49,100, 32, 82, 95, 51,
-/* 0x3ec0 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,119,
-/* 0x3ed0 */ 111,114,100,115, 95,116,111, 95, 99,111,112,121, 10, 10, 82, 69,
-/* 0x3ee0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x3ef0 */  32, 70, 79, 82, 32, 91, 87, 67, 76, 69, 77, 65, 73, 78, 48, 51,
-/* 0x3f00 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3f10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3f20 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51,
-/* 0x3f30 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 87,
-/* 0x3f40 */  67, 76, 69, 67, 85, 84, 80, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x3f50 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x3f60 */  91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x3f70 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f80 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x3f90 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x3fa0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x3fb0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3fc0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83,
-/* 0x3fd0 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x3fe0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ff0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x4000 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4010 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4020 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4030 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70,
-/* 0x4040 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4050 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4060 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4070 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4080 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4090 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x40a0 */  65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x40b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x40c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x40d0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x40e0 */  32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76,
-/* 0x40f0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4100 */  70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93, 58, 10,
-/* 0x4110 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4120 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4130 */  10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4140 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x4150 */  69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4160 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4170 */  66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4180 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4190 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x41a0 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x41b0 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x41c0 */  48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x41d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50,
-/* 0x41e0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x41f0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 68, 69,
-/* 0x4200 */  67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4210 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4220 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32,
-/* 0x4230 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4240 */  32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4250 */  48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4260 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 10,
-/* 0x4270 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4280 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x4290 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x42a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x42b0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x42c0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x42d0 */  50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x42e0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x42f0 */  91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4300 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4310 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4320 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x4330 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x4340 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4350 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x4360 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4370 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4380 */  66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4390 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x43a0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x43b0 */  48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x43c0 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x43d0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x43e0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 48, 93,
-/* 0x43f0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4400 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4410 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x4420 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4430 */  66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32,
-/* 0x4440 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x4450 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x4460 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4470 */  79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x4480 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4490 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x44a0 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x44b0 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x44c0 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x44d0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x44e0 */  83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x44f0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4500 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4510 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4520 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x4530 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4540 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48, 93, 58,
-/* 0x4550 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4560 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4570 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x4580 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x4590 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x45a0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x45b0 */  50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x45c0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x45d0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x45e0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x45f0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 10,
-/* 0x4600 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4610 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 50, 48,
-/* 0x4620 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4630 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4640 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x4650 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4660 */  50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4670 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4680 */  91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4690 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x46a0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x46b0 */  48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x46c0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x46d0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x46e0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83,
-/* 0x46f0 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4700 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4710 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0x4720 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4730 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4740 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4750 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x4760 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4770 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51, 48, 93,
-/* 0x4780 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4790 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x47a0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56,
-/* 0x47b0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x47c0 */  68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32,
-/* 0x47d0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x47e0 */  32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x47f0 */  48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4800 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 10,
-/* 0x4810 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4820 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 52, 48,
-/* 0x4830 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4840 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4850 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x4860 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4870 */  50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4880 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4890 */  91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x48a0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x48b0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x48c0 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x48d0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x48e0 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x48f0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x4900 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4910 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4920 */  68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4930 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4940 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4950 */  48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x4960 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x4970 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4980 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 48, 93,
-/* 0x4990 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x49a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x49b0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x49c0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x49d0 */  68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32,
-/* 0x49e0 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x49f0 */  32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x4a00 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4a10 */  79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x4a20 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4a30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4a40 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x4a50 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x4a60 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4a70 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x4a80 */  83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4a90 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4aa0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ab0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4ac0 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x4ad0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4ae0 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48, 93, 58,
-/* 0x4af0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4b00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4b10 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x4b20 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x4b30 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x4b40 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x4b50 */  50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x4b60 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b70 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4b80 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4b90 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 10,
-/* 0x4ba0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4bb0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 50, 48,
-/* 0x4bc0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4bd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4be0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x4bf0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4c00 */  50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4c10 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4c20 */  91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4c30 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c40 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4c50 */  48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x4c60 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x4c70 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4c80 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83,
-/* 0x4c90 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4ca0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4cb0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0x4cc0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4cd0 */  32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ce0 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4cf0 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x4d00 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4d10 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51, 48, 93,
-/* 0x4d20 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4d30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4d40 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56,
-/* 0x4d50 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4d60 */  69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,101, 32,
-/* 0x4d70 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4d80 */  32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4d90 */  48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4da0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 10,
-/* 0x4db0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4dc0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 52, 48,
-/* 0x4dd0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4de0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4df0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x4e00 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4e10 */  50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4e20 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4e30 */  91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4e40 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e50 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4e60 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x4e70 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x4e80 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4e90 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x4ea0 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4eb0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4ec0 */  69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4ed0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ee0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ef0 */  48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x4f00 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x4f10 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4f20 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 48, 93,
-/* 0x4f30 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4f40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4f50 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x4f60 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4f70 */  69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32,
-/* 0x4f80 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x4f90 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x4fa0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4fb0 */  79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x4fc0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4fd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4fe0 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x4ff0 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x5000 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5010 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77,
-/* 0x5020 */  65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5030 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5040 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5050 */  48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x5060 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,107,
-/* 0x5070 */  95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 49, 52,
-/* 0x5080 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5090 */  32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48,
-/* 0x50a0 */  48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x50b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99, 95,
-/* 0x50c0 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 97, 32, 82, 95, 51,
-/* 0x50d0 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x50e0 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 10,
-/* 0x50f0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5100 */  68, 83, 32, 70, 79, 82, 32, 91, 87, 67, 76, 69, 77, 65, 73, 50,
-/* 0x5110 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5120 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5130 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x5140 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,115,
-/* 0x5150 */ 116, 97,114,116, 95,111,102, 95,114,101,108,111, 99,115, 10, 10,
-/* 0x5160 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5170 */  68, 83, 32, 70, 79, 82, 32, 91, 87, 67, 67, 84, 84, 80, 79, 83,
-/* 0x5180 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5190 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x51a0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51,
-/* 0x51b0 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x51c0 */ 105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,116, 97,
-/* 0x51d0 */ 114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x51e0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76,
-/* 0x51f0 */  84, 82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5200 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5210 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5220 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5230 */  32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104,
-/* 0x5240 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5250 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86,
-/* 0x5260 */  69, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5270 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5280 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x5290 */  95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x52a0 */  32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48,
-/* 0x52b0 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x52c0 */  32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10,
-/* 0x52d0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x52e0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48,
-/* 0x52f0 */  50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5300 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5310 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95,
-/* 0x5320 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5330 */  67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5340 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5350 */  32, 91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5360 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5370 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5380 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x5390 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x53a0 */ 108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x53b0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x53c0 */  67, 65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x53d0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x53e0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x53f0 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5400 */  32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10,
-/* 0x5410 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5420 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69,
-/* 0x5430 */  50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5440 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5450 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95,
-/* 0x5460 */  51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5470 */ 102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48,
-/* 0x5480 */  48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5490 */  32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 10,
-/* 0x54a0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x54b0 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 51,
-/* 0x54c0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x54d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x54e0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51,
-/* 0x54f0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0x5500 */  65, 76, 76, 84, 82, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5510 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5520 */  91, 99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5530 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5540 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5550 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x5560 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x5570 */ 108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32,
-/* 0x5580 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5590 */  32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76,
-/* 0x55a0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x55b0 */  70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48, 93, 58,
-/* 0x55c0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x55d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x55e0 */  69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54,
-/* 0x55f0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,
-/* 0x5600 */ 107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5610 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5620 */  99,116,111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5630 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5640 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5650 */  48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5660 */  32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52,
-/* 0x5670 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54,
-/* 0x5680 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,
-/* 0x5690 */ 107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32,
-/* 0x56a0 */  82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x56b0 */  32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48,
-/* 0x56c0 */  48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x56d0 */  32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52,
-/* 0x56e0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x56f0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51,
-/* 0x5700 */  50, 46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5710 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5720 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x5730 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5740 */  32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48,
-/* 0x5750 */  48, 48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5760 */  32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 49,
-/* 0x5770 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5780 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51,
-/* 0x5790 */  50, 46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x57a0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57b0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x57c0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x57d0 */  32, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 10, 82, 69,
-/* 0x57e0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x57f0 */  32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67, 51, 50, 48, 93, 58,
-/* 0x5800 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5810 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5820 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54,
-/* 0x5830 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 82, 69, 76,
-/* 0x5840 */  79, 67, 51, 50, 74, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5850 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 82,
-/* 0x5860 */  69, 76, 51, 50, 66, 73, 71, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5870 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5880 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5890 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x58a0 */  32, 32, 32, 32, 32, 32, 82, 69, 76, 79, 67, 51, 50, 48, 10, 10,
-/* 0x58b0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x58c0 */  68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 79, 67, 51, 50, 74,
-/* 0x58d0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x58e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x58f0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x5900 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 82,
-/* 0x5910 */  69, 76, 79, 67, 51, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5920 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5930 */  91, 87, 67, 76, 69, 77, 65, 73, 52, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5940 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5950 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5960 */  48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x5970 */  32, 32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108,
-/* 0x5980 */  95,115,116, 97, 99,107, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32,
-/* 0x5990 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x59a0 */  32, 32,111,114,105,103,105,110, 97,108, 95,101,110,116,114,121,
-/* 0x59b0 */  10
+/* 0x1a20 */   0,233,252,255,255,255, 99,  0,  0,  0,112,  0,  0,  0, 84,  0,
+/* 0x1a30 */   0,  0,107,  4,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 41,  0,
+/* 0x1a40 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 93,  0,  0,  0,  3,  0,
+/* 0x1a50 */   0,  0,  0,  0,  0,  0, 20,  0,  0,  0, 96,  0,  0,  0,  6,  0,
+/* 0x1a60 */   0,  0,  0,  0,  0,  0, 31,  0,  0,  0,102,  0,  0,  0, 32,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0, 40,  0,  0,  0,134,  0,  0,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0,  0,  0, 49,  0,  0,  0,134,  0,  0,  0,  3,  0,
+/* 0x1a90 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,137,  0,  0,  0,  2,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0, 67,  0,  0,  0,139,  0,  0,  0,  6,  0,
+/* 0x1ab0 */   0,  0,  0,  0,  0,  0, 76,  0,  0,  0,145,  0,  0,  0, 11,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  0,  0, 85,  0,  0,  0,156,  0,  0,  0,  5,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0, 94,  0,  0,  0,161,  0,  0,  0,  9,  0,
+/* 0x1ae0 */   0,  0,  0,  0,  0,  0,103,  0,  0,  0,170,  0,  0,  0, 13,  0,
+/* 0x1af0 */   0,  0,  0,  0,  0,  0,112,  0,  0,  0,183,  0,  0,  0, 13,  0,
+/* 0x1b00 */   0,  0,  0,  0,  0,  0,121,  0,  0,  0,196,  0,  0,  0, 15,  0,
+/* 0x1b10 */   0,  0,  0,  0,  0,  0,130,  0,  0,  0,211,  0,  0,  0, 62,  0,
+/* 0x1b20 */   0,  0,  0,  0,  0,  0,139,  0,  0,  0, 17,  1,  0,  0, 13,  0,
+/* 0x1b30 */   0,  0,  0,  0,  0,  0,148,  0,  0,  0, 30,  1,  0,  0, 15,  0,
+/* 0x1b40 */   0,  0,  0,  0,  0,  0,157,  0,  0,  0, 45,  1,  0,  0,  2,  0,
+/* 0x1b50 */   0,  0,  0,  0,  0,  0,166,  0,  0,  0, 47,  1,  0,  0,  3,  0,
+/* 0x1b60 */   0,  0,  0,  0,  0,  0,175,  0,  0,  0, 50,  1,  0,  0,  9,  0,
+/* 0x1b70 */   0,  0,  0,  0,  0,  0,184,  0,  0,  0, 59,  1,  0,  0, 12,  0,
+/* 0x1b80 */   0,  0,  0,  0,  0,  0,193,  0,  0,  0, 71,  1,  0,  0, 25,  0,
+/* 0x1b90 */   0,  0,  0,  0,  0,  0,202,  0,  0,  0, 96,  1,  0,  0, 22,  0,
+/* 0x1ba0 */   0,  0,  0,  0,  0,  0,211,  0,  0,  0,118,  1,  0,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0,  0,  0,220,  0,  0,  0,118,  1,  0,  0,  3,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  0,  0,229,  0,  0,  0,121,  1,  0,  0,  2,  0,
+/* 0x1bd0 */   0,  0,  0,  0,  0,  0,238,  0,  0,  0,123,  1,  0,  0,  6,  0,
+/* 0x1be0 */   0,  0,  0,  0,  0,  0,247,  0,  0,  0,129,  1,  0,  0, 11,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  0,  0,  0,  1,  0,  0,140,  1,  0,  0,  5,  0,
+/* 0x1c00 */   0,  0,  0,  0,  0,  0,  9,  1,  0,  0,145,  1,  0,  0,  9,  0,
+/* 0x1c10 */   0,  0,  0,  0,  0,  0, 18,  1,  0,  0,154,  1,  0,  0, 13,  0,
+/* 0x1c20 */   0,  0,  0,  0,  0,  0, 27,  1,  0,  0,167,  1,  0,  0, 13,  0,
+/* 0x1c30 */   0,  0,  0,  0,  0,  0, 36,  1,  0,  0,180,  1,  0,  0, 15,  0,
+/* 0x1c40 */   0,  0,  0,  0,  0,  0, 45,  1,  0,  0,195,  1,  0,  0, 82,  0,
+/* 0x1c50 */   0,  0,  0,  0,  0,  0, 54,  1,  0,  0, 21,  2,  0,  0, 13,  0,
+/* 0x1c60 */   0,  0,  0,  0,  0,  0, 63,  1,  0,  0, 34,  2,  0,  0, 15,  0,
+/* 0x1c70 */   0,  0,  0,  0,  0,  0, 72,  1,  0,  0, 49,  2,  0,  0,  2,  0,
+/* 0x1c80 */   0,  0,  0,  0,  0,  0, 81,  1,  0,  0, 51,  2,  0,  0,  3,  0,
+/* 0x1c90 */   0,  0,  0,  0,  0,  0, 90,  1,  0,  0, 54,  2,  0,  0,  9,  0,
+/* 0x1ca0 */   0,  0,  0,  0,  0,  0, 99,  1,  0,  0, 63,  2,  0,  0, 12,  0,
+/* 0x1cb0 */   0,  0,  0,  0,  0,  0,108,  1,  0,  0, 75,  2,  0,  0, 25,  0,
+/* 0x1cc0 */   0,  0,  0,  0,  0,  0,117,  1,  0,  0,100,  2,  0,  0, 22,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  0,  0,126,  1,  0,  0,122,  2,  0,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,  0,  0,135,  1,  0,  0,122,  2,  0,  0,  3,  0,
+/* 0x1cf0 */   0,  0,  0,  0,  0,  0,144,  1,  0,  0,125,  2,  0,  0,  2,  0,
+/* 0x1d00 */   0,  0,  0,  0,  0,  0,153,  1,  0,  0,127,  2,  0,  0,  6,  0,
+/* 0x1d10 */   0,  0,  0,  0,  0,  0,162,  1,  0,  0,133,  2,  0,  0, 11,  0,
+/* 0x1d20 */   0,  0,  0,  0,  0,  0,171,  1,  0,  0,144,  2,  0,  0,  5,  0,
+/* 0x1d30 */   0,  0,  0,  0,  0,  0,180,  1,  0,  0,149,  2,  0,  0,  9,  0,
+/* 0x1d40 */   0,  0,  0,  0,  0,  0,189,  1,  0,  0,158,  2,  0,  0, 13,  0,
+/* 0x1d50 */   0,  0,  0,  0,  0,  0,198,  1,  0,  0,171,  2,  0,  0, 13,  0,
+/* 0x1d60 */   0,  0,  0,  0,  0,  0,207,  1,  0,  0,184,  2,  0,  0, 15,  0,
+/* 0x1d70 */   0,  0,  0,  0,  0,  0,216,  1,  0,  0,199,  2,  0,  0, 95,  0,
+/* 0x1d80 */   0,  0,  0,  0,  0,  0,225,  1,  0,  0, 38,  3,  0,  0, 13,  0,
+/* 0x1d90 */   0,  0,  0,  0,  0,  0,234,  1,  0,  0, 51,  3,  0,  0, 15,  0,
+/* 0x1da0 */   0,  0,  0,  0,  0,  0,243,  1,  0,  0, 66,  3,  0,  0,  2,  0,
+/* 0x1db0 */   0,  0,  0,  0,  0,  0,252,  1,  0,  0, 68,  3,  0,  0,  3,  0,
+/* 0x1dc0 */   0,  0,  0,  0,  0,  0,  5,  2,  0,  0, 71,  3,  0,  0,  9,  0,
+/* 0x1dd0 */   0,  0,  0,  0,  0,  0, 14,  2,  0,  0, 80,  3,  0,  0, 12,  0,
+/* 0x1de0 */   0,  0,  0,  0,  0,  0, 23,  2,  0,  0, 92,  3,  0,  0, 25,  0,
+/* 0x1df0 */   0,  0,  0,  0,  0,  0, 32,  2,  0,  0,117,  3,  0,  0, 22,  0,
+/* 0x1e00 */   0,  0,  0,  0,  0,  0, 41,  2,  0,  0,139,  3,  0,  0,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0,  0,  0, 50,  2,  0,  0,139,  3,  0,  0, 46,  0,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0, 61,  2,  0,  0,185,  3,  0,  0, 72,  0,
+/* 0x1e30 */   0,  0,  0,  0,  0,  0, 72,  2,  0,  0,  1,  4,  0,  0,134, 10,
+/* 0x1e40 */   0,  0,  0,  0,  0,  0, 83,  2,  0,  0,135, 14,  0,  0,134, 10,
+/* 0x1e50 */   0,  0,  0,  0,  0,  0, 94,  2,  0,  0, 13, 25,  0,  0, 26,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,  0,105,  2,  0,  0, 39, 25,  0,  0,  9,  0,
+/* 0x1e70 */   0,  0,  0,  0,  0,  0,114,  2,  0,  0, 48, 25,  0,  0,  6,  0,
+/* 0x1e80 */   0,  0,  0,  0,  0,  0,123,  2,  0,  0, 54, 25,  0,  0,  2,  0,
+/* 0x1e90 */   0,  0,  0,  0,  0,  0,132,  2,  0,  0, 56, 25,  0,  0, 14,  0,
+/* 0x1ea0 */   0,  0,  0,  0,  0,  0,141,  2,  0,  0, 70, 25,  0,  0,  5,  0,
+/* 0x1eb0 */   0,  0,  0,  0,  0,  0,150,  2,  0,  0, 75, 25,  0,  0,  5,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  0,  0,159,  2,  0,  0, 80, 25,  0,  0,  4,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  0,  0,168,  2,  0,  0, 84, 25,  0,  0,  2,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  0,  0,177,  2,  0,  0, 86, 25,  0,  0,  5,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  0,  0,186,  2,  0,  0, 91, 25,  0,  0, 16,  0,
+/* 0x1f00 */   0,  0,  0,  0,  0,  0,195,  2,  0,  0,107, 25,  0,  0,  5,  0,
+/* 0x1f10 */   0,  0,  0,  0,  0,  0,204,  2,  0,  0,112, 25,  0,  0,  2,  0,
+/* 0x1f20 */   0,  0,  0,  0,  0,  0,213,  2,  0,  0,114, 25,  0,  0,  2,  0,
+/* 0x1f30 */   0,  0,  0,  0,  0,  0,222,  2,  0,  0,116, 25,  0,  0,  4,  0,
+/* 0x1f40 */   0,  0,  0,  0,  0,  0,231,  2,  0,  0,120, 25,  0,  0,  5,  0,
+/* 0x1f50 */   0,  0,  0,  0,  0,  0,240,  2,  0,  0,125, 25,  0,  0,  2,  0,
+/* 0x1f60 */   0,  0,  0,  0,  0,  0,249,  2,  0,  0,127, 25,  0,  0,  4,  0,
+/* 0x1f70 */   0,  0,  0,  0,  0,  0,  2,  3,  0,  0,131, 25,  0,  0,  2,  0,
+/* 0x1f80 */   0,  0,  0,  0,  0,  0, 11,  3,  0,  0,133, 25,  0,  0,  5,  0,
+/* 0x1f90 */   0,  0,  0,  0,  0,  0, 20,  3,  0,  0,138, 25,  0,  0,  7,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  0,  0, 29,  3,  0,  0,145, 25,  0,  0, 10,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,  0, 39,  3,  0,  0,155, 25,  0,  0, 14,  0,
+/* 0x1fc0 */   0,  0,  0,  0,  0,  0, 49,  3,  0,  0,169, 25,  0,  0, 32,  0,
+/* 0x1fd0 */   0,  0,  0,  0,  0,  0, 59,  3,  0,  0,201, 25,  0,  0, 10,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0, 69,  3,  0,  0,211, 25,  0,  0,  5,  0,
+/* 0x1ff0 */   0,  0,  0,  0,  0,  0, 79,  3,  0,  0,216, 25,  0,  0,  3,  0,
+/* 0x2000 */   0,  0,  0,  0,  0,  0, 88,  3,  0,  0,219, 25,  0,  0, 41,  0,
+/* 0x2010 */   0,  0,  0,  0,  0,  0, 97,  3,  0,  0,  4, 26,  0,  0,  9,  0,
+/* 0x2020 */   0,  0,  0,  0,  0,  0,106,  3,  0,  0, 13, 26,  0,  0,  2,  0,
+/* 0x2030 */   0,  0,  0,  0,  0,  0,115,  3,  0,  0, 15, 26,  0,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,124,  3,  0,  0, 15, 26,  0,  0,  2,  0,
+/* 0x2050 */   0,  0,  0,  0,  0,  0,133,  3,  0,  0, 17, 26,  0,  0, 21,  0,
+/* 0x2060 */   0,  0,  0,  0,  0,  0, 40,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2070 */   0,  0, 49,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 67,  0,
+/* 0x2080 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,  8,  0,
+/* 0x2090 */   0,  0,  0,  0,  0,  0,103,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x20a0 */   0,  0,130,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,175,  0,
+/* 0x20b0 */   0,  0, 19,  0,  0,  0,  0,  0,  0,  0,202,  0,  0,  0, 22,  0,
+/* 0x20c0 */   0,  0,  0,  0,  0,  0,211,  0,  0,  0, 23,  0,  0,  0,  0,  0,
+/* 0x20d0 */   0,  0,220,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,238,  0,
+/* 0x20e0 */   0,  0, 26,  0,  0,  0,  0,  0,  0,  0,247,  0,  0,  0, 27,  0,
+/* 0x20f0 */   0,  0,  0,  0,  0,  0, 18,  1,  0,  0, 30,  0,  0,  0,  0,  0,
+/* 0x2100 */   0,  0, 45,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0, 90,  1,
+/* 0x2110 */   0,  0, 38,  0,  0,  0,  0,  0,  0,  0,117,  1,  0,  0, 41,  0,
+/* 0x2120 */   0,  0,  0,  0,  0,  0,126,  1,  0,  0, 42,  0,  0,  0,  0,  0,
+/* 0x2130 */   0,  0,135,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,153,  1,
+/* 0x2140 */   0,  0, 45,  0,  0,  0,  0,  0,  0,  0,162,  1,  0,  0, 46,  0,
+/* 0x2150 */   0,  0,  0,  0,  0,  0,189,  1,  0,  0, 49,  0,  0,  0,  0,  0,
+/* 0x2160 */   0,  0,216,  1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  5,  2,
+/* 0x2170 */   0,  0, 57,  0,  0,  0,  0,  0,  0,  0, 32,  2,  0,  0, 60,  0,
+/* 0x2180 */   0,  0,  0,  0,  0,  0, 41,  2,  0,  0, 61,  0,  0,  0,  0,  0,
+/* 0x2190 */   0,  0,132,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,195,  2,
+/* 0x21a0 */   0,  0, 77,  0,  0,  0,  0,  0,  0,  0,222,  2,  0,  0, 80,  0,
+/* 0x21b0 */   0,  0,  0,  0,  0,  0, 20,  3,  0,  0, 86,  0,  0,  0,  0,  0,
+/* 0x21c0 */   0,  0, 29,  3,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0, 39,  3,
+/* 0x21d0 */   0,  0, 88,  0,  0,  0,  0,  0,  0,  0, 49,  3,  0,  0, 89,  0,
+/* 0x21e0 */   0,  0,  0,  0,  0,  0, 69,  3,  0,  0, 91,  0,  0,  0,  0,  0,
+/* 0x21f0 */   0,  0, 88,  3,  0,  0, 93,  0,  0,  0,  0,  0,  0,  0,106,  3,
+/* 0x2200 */   0,  0, 95,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x2220 */   0,  0, 20,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 31,  0,
+/* 0x2230 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  6,  0,
+/* 0x2240 */   0,  0,  0,  0,  0,  0, 85,  0,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x2250 */   0,  0, 94,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,112,  0,
+/* 0x2260 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0,121,  0,  0,  0, 13,  0,
+/* 0x2270 */   0,  0,  0,  0,  0,  0,139,  0,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x2280 */   0,  0,148,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,157,  0,
+/* 0x2290 */   0,  0, 17,  0,  0,  0,  0,  0,  0,  0,166,  0,  0,  0, 18,  0,
+/* 0x22a0 */   0,  0,  0,  0,  0,  0,184,  0,  0,  0, 20,  0,  0,  0,  0,  0,
+/* 0x22b0 */   0,  0,193,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,229,  0,
+/* 0x22c0 */   0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0, 28,  0,
+/* 0x22d0 */   0,  0,  0,  0,  0,  0,  9,  1,  0,  0, 29,  0,  0,  0,  0,  0,
+/* 0x22e0 */   0,  0, 27,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0, 36,  1,
+/* 0x22f0 */   0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 54,  1,  0,  0, 34,  0,
+/* 0x2300 */   0,  0,  0,  0,  0,  0, 63,  1,  0,  0, 35,  0,  0,  0,  0,  0,
+/* 0x2310 */   0,  0, 72,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 81,  1,
+/* 0x2320 */   0,  0, 37,  0,  0,  0,  0,  0,  0,  0, 99,  1,  0,  0, 39,  0,
+/* 0x2330 */   0,  0,  0,  0,  0,  0,108,  1,  0,  0, 40,  0,  0,  0,  0,  0,
+/* 0x2340 */   0,  0,144,  1,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,171,  1,
+/* 0x2350 */   0,  0, 47,  0,  0,  0,  0,  0,  0,  0,180,  1,  0,  0, 48,  0,
+/* 0x2360 */   0,  0,  0,  0,  0,  0,198,  1,  0,  0, 50,  0,  0,  0,  0,  0,
+/* 0x2370 */   0,  0,207,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,225,  1,
+/* 0x2380 */   0,  0, 53,  0,  0,  0,  0,  0,  0,  0,234,  1,  0,  0, 54,  0,
+/* 0x2390 */   0,  0,  0,  0,  0,  0,243,  1,  0,  0, 55,  0,  0,  0,  0,  0,
+/* 0x23a0 */   0,  0,252,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0, 14,  2,
+/* 0x23b0 */   0,  0, 58,  0,  0,  0,  0,  0,  0,  0, 23,  2,  0,  0, 59,  0,
+/* 0x23c0 */   0,  0,  0,  0,  0,  0, 50,  2,  0,  0, 62,  0,  0,  0,  0,  0,
+/* 0x23d0 */   0,  0, 61,  2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0, 72,  2,
+/* 0x23e0 */   0,  0, 64,  0,  0,  0,  0,  0,  0,  0, 83,  2,  0,  0, 65,  0,
+/* 0x23f0 */   0,  0,  0,  0,  0,  0, 94,  2,  0,  0, 66,  0,  0,  0,  0,  0,
+/* 0x2400 */   0,  0,105,  2,  0,  0, 67,  0,  0,  0,  0,  0,  0,  0,114,  2,
+/* 0x2410 */   0,  0, 68,  0,  0,  0,  0,  0,  0,  0,123,  2,  0,  0, 69,  0,
+/* 0x2420 */   0,  0,  0,  0,  0,  0,141,  2,  0,  0, 71,  0,  0,  0,  0,  0,
+/* 0x2430 */   0,  0,150,  2,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,159,  2,
+/* 0x2440 */   0,  0, 73,  0,  0,  0,  0,  0,  0,  0,168,  2,  0,  0, 74,  0,
+/* 0x2450 */   0,  0,  0,  0,  0,  0,177,  2,  0,  0, 75,  0,  0,  0,  0,  0,
+/* 0x2460 */   0,  0,186,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,204,  2,
+/* 0x2470 */   0,  0, 78,  0,  0,  0,  0,  0,  0,  0,213,  2,  0,  0, 79,  0,
+/* 0x2480 */   0,  0,  0,  0,  0,  0,231,  2,  0,  0, 81,  0,  0,  0,  0,  0,
+/* 0x2490 */   0,  0,240,  2,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,249,  2,
+/* 0x24a0 */   0,  0, 83,  0,  0,  0,  0,  0,  0,  0,  2,  3,  0,  0, 84,  0,
+/* 0x24b0 */   0,  0,  0,  0,  0,  0, 11,  3,  0,  0, 85,  0,  0,  0,  0,  0,
+/* 0x24c0 */   0,  0, 59,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0, 79,  3,
+/* 0x24d0 */   0,  0, 92,  0,  0,  0,  0,  0,  0,  0, 97,  3,  0,  0, 94,  0,
+/* 0x24e0 */   0,  0,  0,  0,  0,  0,115,  3,  0,  0, 96,  0,  0,  0,  0,  0,
+/* 0x24f0 */   0,  0,124,  3,  0,  0, 97,  0,  0,  0,  0,  0,  0,  0,133,  3,
+/* 0x2500 */   0,  0, 98,  0,  0,  0,  0,  0,  0,  0,142,  3,  0,  0,100,  0,
+/* 0x2510 */   0,  0,173,222,173,222,154,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x2520 */ 173,222,164,  3,  0,  0,100,  0,  0,  0,173,222,173,222,178,  3,
+/* 0x2530 */   0,  0,100,  0,  0,  0,173,222,173,222,196,  3,  0,  0,100,  0,
+/* 0x2540 */   0,  0,173,222,173,222,207,  3,  0,  0,100,  0,  0,  0,173,222,
+/* 0x2550 */ 173,222,218,  3,  0,  0,100,  0,  0,  0,173,222,173,222,234,  3,
+/* 0x2560 */   0,  0,100,  0,  0,  0,173,222,173,222,250,  3,  0,  0,100,  0,
+/* 0x2570 */   0,  0,173,222,173,222, 14,  4,  0,  0,100,  0,  0,  0,173,222,
+/* 0x2580 */ 173,222, 28,  4,  0,  0,100,  0,  0,  0,173,222,173,222, 39,  4,
+/* 0x2590 */   0,  0,100,  0,  0,  0,173,222,173,222, 54,  4,  0,  0,100,  0,
+/* 0x25a0 */   0,  0,173,222,173,222,  0,  0,  0,  0, 18,  0,  0,  0, 69,  4,
+/* 0x25b0 */   0,  0,142,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25c0 */   0,  0, 24,  0,  0,  0, 69,  4,  0,  0,154,  3,  0,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0, 69,  4,
+/* 0x25e0 */   0,  0,164,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+/* 0x25f0 */   0,  0,  2,  0,  0,  0, 78,  4,  0,  0, 40,  0,  0,  0,  0,  0,
+/* 0x2600 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  1,  0,  0,  0, 89,  4,
+/* 0x2610 */   0,  0, 76,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x2620 */   0,  0,  1,  0,  0,  0, 89,  4,  0,  0, 76,  0,  0,  0,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0, 89,  4,
+/* 0x2640 */   0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,
+/* 0x2650 */   0,  0,  3,  0,  0,  0, 89,  4,  0,  0, 67,  0,  0,  0,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 12,  0,  0,  0, 89,  4,
+/* 0x2670 */   0,  0,103,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,
+/* 0x2680 */   0,  0,  3,  0,  0,  0, 89,  4,  0,  0,103,  0,  0,  0,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 14,  0,  0,  0, 89,  4,
+/* 0x26a0 */   0,  0,103,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,
+/* 0x26b0 */   0,  0, 17,  0,  0,  0, 89,  4,  0,  0,211,  0,  0,  0,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0,  0,  0, 14,  0,  0,  0, 47,  0,  0,  0, 89,  4,
+/* 0x26d0 */   0,  0,175,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,
+/* 0x26e0 */   0,  0, 12,  0,  0,  0, 89,  4,  0,  0,130,  0,  0,  0,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  3,  0,  0,  0, 89,  4,
+/* 0x2700 */   0,  0,130,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,
+/* 0x2710 */   0,  0, 14,  0,  0,  0, 89,  4,  0,  0,130,  0,  0,  0,  0,  0,
+/* 0x2720 */   0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  8,  0,  0,  0, 78,  4,
+/* 0x2730 */   0,  0, 76,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,
+/* 0x2740 */   0,  0, 10,  0,  0,  0, 89,  4,  0,  0,202,  0,  0,  0,  0,  0,
+/* 0x2750 */   0,  0,  0,  0,  0,  0, 21,  0,  0,  0, 21,  0,  0,  0, 78,  4,
+/* 0x2760 */   0,  0, 76,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,
+/* 0x2770 */   0,  0, 18,  0,  0,  0, 78,  4,  0,  0, 76,  0,  0,  0,  0,  0,
+/* 0x2780 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  1,  0,  0,  0, 89,  4,
+/* 0x2790 */   0,  0,247,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,
+/* 0x27a0 */   0,  0,  1,  0,  0,  0, 89,  4,  0,  0,247,  0,  0,  0,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0,  0,  0, 28,  0,  0,  0,  1,  0,  0,  0, 89,  4,
+/* 0x27c0 */   0,  0,220,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,
+/* 0x27d0 */   0,  0,  3,  0,  0,  0, 89,  4,  0,  0,238,  0,  0,  0,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 12,  0,  0,  0, 89,  4,
+/* 0x27f0 */   0,  0, 45,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,
+/* 0x2800 */   0,  0,  5,  0,  0,  0, 89,  4,  0,  0, 45,  1,  0,  0,  0,  0,
+/* 0x2810 */   0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 14,  0,  0,  0, 89,  4,
+/* 0x2820 */   0,  0, 45,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x2830 */   0,  0, 15,  0,  0,  0, 89,  4,  0,  0, 18,  1,  0,  0,  0,  0,
+/* 0x2840 */   0,  0,  0,  0,  0,  0, 33,  0,  0,  0, 33,  0,  0,  0, 89,  4,
+/* 0x2850 */   0,  0,126,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x2860 */   0,  0, 67,  0,  0,  0, 89,  4,  0,  0, 90,  1,  0,  0,  0,  0,
+/* 0x2870 */   0,  0,  0,  0,  0,  0, 34,  0,  0,  0, 12,  0,  0,  0, 89,  4,
+/* 0x2880 */   0,  0, 45,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  0,
+/* 0x2890 */   0,  0,  3,  0,  0,  0, 89,  4,  0,  0, 45,  1,  0,  0,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 14,  0,  0,  0, 89,  4,
+/* 0x28b0 */   0,  0, 45,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,
+/* 0x28c0 */   0,  0,  8,  0,  0,  0, 78,  4,  0,  0,247,  0,  0,  0,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0,  0,  0, 40,  0,  0,  0, 10,  0,  0,  0, 89,  4,
+/* 0x28e0 */   0,  0,117,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 40,  0,
+/* 0x28f0 */   0,  0, 21,  0,  0,  0, 78,  4,  0,  0,247,  0,  0,  0,  0,  0,
+/* 0x2900 */   0,  0,  0,  0,  0,  0, 41,  0,  0,  0, 18,  0,  0,  0, 78,  4,
+/* 0x2910 */   0,  0,247,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,  0,
+/* 0x2920 */   0,  0,  1,  0,  0,  0, 89,  4,  0,  0,162,  1,  0,  0,  0,  0,
+/* 0x2930 */   0,  0,  0,  0,  0,  0, 44,  0,  0,  0,  1,  0,  0,  0, 89,  4,
+/* 0x2940 */   0,  0,162,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,
+/* 0x2950 */   0,  0,  1,  0,  0,  0, 89,  4,  0,  0,135,  1,  0,  0,  0,  0,
+/* 0x2960 */   0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  3,  0,  0,  0, 89,  4,
+/* 0x2970 */   0,  0,153,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,
+/* 0x2980 */   0,  0, 12,  0,  0,  0, 89,  4,  0,  0,216,  1,  0,  0,  0,  0,
+/* 0x2990 */   0,  0,  0,  0,  0,  0, 51,  0,  0,  0,  5,  0,  0,  0, 89,  4,
+/* 0x29a0 */   0,  0,216,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,
+/* 0x29b0 */   0,  0, 14,  0,  0,  0, 89,  4,  0,  0,216,  1,  0,  0,  0,  0,
+/* 0x29c0 */   0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 15,  0,  0,  0, 89,  4,
+/* 0x29d0 */   0,  0,189,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,
+/* 0x29e0 */   0,  0, 30,  0,  0,  0, 89,  4,  0,  0,  5,  2,  0,  0,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 48,  0,  0,  0, 89,  4,
+/* 0x2a00 */   0,  0, 41,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,
+/* 0x2a10 */   0,  0, 12,  0,  0,  0, 89,  4,  0,  0,216,  1,  0,  0,  0,  0,
+/* 0x2a20 */   0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  3,  0,  0,  0, 89,  4,
+/* 0x2a30 */   0,  0,216,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,
+/* 0x2a40 */   0,  0, 14,  0,  0,  0, 89,  4,  0,  0,216,  1,  0,  0,  0,  0,
+/* 0x2a50 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  8,  0,  0,  0, 78,  4,
+/* 0x2a60 */   0,  0,162,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59,  0,
+/* 0x2a70 */   0,  0, 10,  0,  0,  0, 89,  4,  0,  0, 32,  2,  0,  0,  0,  0,
+/* 0x2a80 */   0,  0,  0,  0,  0,  0, 59,  0,  0,  0, 21,  0,  0,  0, 78,  4,
+/* 0x2a90 */   0,  0,162,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,
+/* 0x2aa0 */   0,  0, 18,  0,  0,  0, 78,  4,  0,  0,162,  1,  0,  0,  0,  0,
+/* 0x2ab0 */   0,  0,  0,  0,  0,  0, 62,  0,  0,  0,  5,  0,  0,  0, 69,  4,
+/* 0x2ac0 */   0,  0,178,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62,  0,
+/* 0x2ad0 */   0,  0, 20,  0,  0,  0, 69,  4,  0,  0,196,  3,  0,  0,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  0, 62,  0,  0,  0, 30,  0,  0,  0, 69,  4,
+/* 0x2af0 */   0,  0,207,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62,  0,
+/* 0x2b00 */   0,  0, 42,  0,  0,  0, 69,  4,  0,  0,218,  3,  0,  0,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  4,  0,  0,  0, 69,  4,
+/* 0x2b20 */   0,  0,234,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  0,
+/* 0x2b30 */   0,  0,  2,  0,  0,  0, 69,  4,  0,  0,250,  3,  0,  0,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0,  0,  0, 70,  0,  0,  0,  1,  0,  0,  0, 69,  4,
+/* 0x2b50 */   0,  0, 14,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,  0,
+/* 0x2b60 */   0,  0,  2,  0,  0,  0, 99,  4,  0,  0, 28,  4,  0,  0,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0,  0,  0, 71,  0,  0,  0,  4,  0,  0,  0, 89,  4,
+/* 0x2b80 */   0,  0,132,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  0,
+/* 0x2b90 */   0,  0, 15,  0,  0,  0, 89,  4,  0,  0,132,  2,  0,  0,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0,  0,  0, 77,  0,  0,  0,  1,  0,  0,  0, 69,  4,
+/* 0x2bb0 */   0,  0, 14,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x2bc0 */   0,  0,  3,  0,  0,  0, 89,  4,  0,  0, 20,  3,  0,  0,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  2,  0,  0,  0, 99,  4,
+/* 0x2be0 */   0,  0, 28,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,
+/* 0x2bf0 */   0,  0,  4,  0,  0,  0, 89,  4,  0,  0,222,  2,  0,  0,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0,  0,  0, 86,  0,  0,  0,  6,  0,  0,  0, 89,  4,
+/* 0x2c10 */   0,  0,195,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 87,  0,
+/* 0x2c20 */   0,  0,  1,  0,  0,  0, 69,  4,  0,  0, 14,  4,  0,  0,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0,  0,  0, 87,  0,  0,  0,  6,  0,  0,  0, 89,  4,
+/* 0x2c40 */   0,  0, 49,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  0,
+/* 0x2c50 */   0,  0, 13,  0,  0,  0, 89,  4,  0,  0, 49,  3,  0,  0,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0,  5,  0,  0,  0, 89,  4,
+/* 0x2c70 */   0,  0, 69,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x2c80 */   0,  0, 10,  0,  0,  0, 89,  4,  0,  0, 69,  3,  0,  0,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 14,  0,  0,  0, 99,  4,
+/* 0x2ca0 */   0,  0, 28,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x2cb0 */   0,  0, 16,  0,  0,  0, 89,  4,  0,  0, 69,  3,  0,  0,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0,  0,  0, 90,  0,  0,  0,  4,  0,  0,  0, 89,  4,
+/* 0x2cd0 */   0,  0, 69,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 90,  0,
+/* 0x2ce0 */   0,  0,  9,  0,  0,  0, 89,  4,  0,  0, 39,  3,  0,  0,  0,  0,
+/* 0x2cf0 */   0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  4,  0,  0,  0, 89,  4,
+/* 0x2d00 */   0,  0, 29,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93,  0,
+/* 0x2d10 */   0,  0,  8,  0,  0,  0, 89,  4,  0,  0,106,  3,  0,  0,  0,  0,
+/* 0x2d20 */   0,  0,  0,  0,  0,  0, 94,  0,  0,  0,  3,  0,  0,  0, 89,  4,
+/* 0x2d30 */   0,  0, 88,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 95,  0,
+/* 0x2d40 */   0,  0,  1,  0,  0,  0, 89,  4,  0,  0, 88,  3,  0,  0,  0,  0,
+/* 0x2d50 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 12,  0,  0,  0, 69,  4,
+/* 0x2d60 */   0,  0, 39,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,
+/* 0x2d70 */   0,  0, 17,  0,  0,  0, 78,  4,  0,  0, 54,  4,  0,  0,  0,  0,
+/* 0x2d80 */   0,  0,  0,  0,  0,  0, 87, 67, 76, 69, 77, 65, 73, 78,  0, 87,
+/* 0x2d90 */  67, 76, 69, 77, 65, 73, 78, 48, 50,  0, 87, 67, 76, 69, 77, 65,
+/* 0x2da0 */  73, 78, 48, 51,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0, 87, 67,
+/* 0x2db0 */  76, 69, 67, 85, 84, 80,  0, 78, 50, 66, 83, 77, 65, 49, 48,  0,
+/* 0x2dc0 */  78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49,
+/* 0x2dd0 */  49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66, 83, 77,
+/* 0x2de0 */  65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78, 50, 66,
+/* 0x2df0 */  68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,  0, 78,
+/* 0x2e00 */  50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67, 51, 48,
+/* 0x2e10 */   0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70, 65, 83,
+/* 0x2e20 */  52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50, 66, 70,
+/* 0x2e30 */  65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0, 78, 50,
+/* 0x2e40 */  66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 48,  0,
+/* 0x2e50 */  78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69, 67, 54,
+/* 0x2e60 */  48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68, 70, 65,
+/* 0x2e70 */  83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78, 50, 68,
+/* 0x2e80 */  68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,  0, 78,
+/* 0x2e90 */  50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67, 50, 48,
+/* 0x2ea0 */   0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x2eb0 */  51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50, 68, 83,
+/* 0x2ec0 */  77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0, 78, 50,
+/* 0x2ed0 */  68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53, 48,  0,
+/* 0x2ee0 */  78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77, 65, 54,
+/* 0x2ef0 */  48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68, 70, 65,
+/* 0x2f00 */  83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78, 50, 69,
+/* 0x2f10 */  83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,  0, 78,
+/* 0x2f20 */  50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67, 49, 48,
+/* 0x2f30 */   0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x2f40 */  50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50, 69, 83,
+/* 0x2f50 */  77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0, 78, 50,
+/* 0x2f60 */  69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52, 48,  0,
+/* 0x2f70 */  78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77, 65, 53,
+/* 0x2f80 */  48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69, 68, 69,
+/* 0x2f90 */  67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78, 50, 69,
+/* 0x2fa0 */  70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,  0, 78,
+/* 0x2fb0 */  50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x2fc0 */  48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x2fd0 */  77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x2fe0 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 87,
+/* 0x2ff0 */  67, 76, 69, 77, 65, 73, 50,  0, 87, 67, 67, 84, 84, 80, 79, 83,
+/* 0x3000 */   0, 87, 67, 67, 84, 84, 78, 85, 76,  0, 67, 65, 76, 76, 84, 82,
+/* 0x3010 */  48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,  0, 67, 65, 76, 76,
+/* 0x3020 */  84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82, 48, 49,  0, 67, 84,
+/* 0x3030 */  66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83, 87, 65, 48, 49,  0,
+/* 0x3040 */  67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65, 76, 76, 84, 82, 49,
+/* 0x3050 */  48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0, 67, 65, 76, 76, 84,
+/* 0x3060 */  82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49, 49,  0, 67, 84, 67,
+/* 0x3070 */  76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84, 82, 49, 50,  0, 67,
+/* 0x3080 */  84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66, 82, 79, 82, 49, 49,
+/* 0x3090 */   0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67, 65, 76, 76, 84, 82,
+/* 0x30a0 */  49, 51,  0, 99,116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,
+/* 0x30b0 */ 107, 51, 50, 46, 49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,
+/* 0x30c0 */   0, 99,116,111,107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51,
+/* 0x30d0 */  50, 46, 52, 48,  0, 87, 67, 82, 69, 76, 79, 67, 49,  0, 82, 69,
+/* 0x30e0 */  76, 79, 67, 51, 50, 48,  0, 82, 69, 76, 51, 50, 66, 73, 71,  0,
+/* 0x30f0 */  82, 69, 76, 79, 67, 51, 50, 74,  0, 82, 69, 76, 51, 50, 69, 78,
+/* 0x3100 */  68,  0, 87, 67, 82, 69, 76, 83, 69, 76,  0, 87, 67, 76, 69, 77,
+/* 0x3110 */  65, 73, 52,  0, 99,111,112,121, 95,115,111,117,114, 99,101,  0,
+/* 0x3120 */  99,111,112,121, 95,100,101,115,116,  0,119,111,114,100,115, 95,
+/* 0x3130 */ 116,111, 95, 99,111,112,121,  0,108,122,109, 97, 95,115,116, 97,
+/* 0x3140 */  99,107, 95, 97,100,106,117,115,116,  0,108,122,109, 97, 95,117,
+/* 0x3150 */  95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,101,110,  0,
+/* 0x3160 */ 108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115,  0,
+/* 0x3170 */ 115,116, 97,114,116, 95,111,102, 95,114,101,108,111, 99,115,  0,
+/* 0x3180 */ 102,105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,116,
+/* 0x3190 */  97,114,116,  0,102,105,108,116,101,114, 95,108,101,110,103,116,
+/* 0x31a0 */ 104,  0,102,105,108,116,101,114, 95, 99,116,111,  0,111,114,105,
+/* 0x31b0 */ 103,105,110, 97,108, 95,115,116, 97, 99,107,  0,111,114,105,103,
+/* 0x31c0 */ 105,110, 97,108, 95,101,110,116,114,121,  0, 82, 95, 51, 56, 54,
+/* 0x31d0 */  95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0, 82,
+/* 0x31e0 */  95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51, 56, 54, 95, 56,
+/* 0x31f0 */   0, 38, 26,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
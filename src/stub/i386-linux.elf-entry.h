@@ -1,5 +1,5 @@
 /* i386-linux.elf-entry.h
-   created from i386-linux.elf-entry.bin, 30433 (0x76e1) bytes
+   created from i386-linux.elf-entry.bin, 15774 (0x3d9e) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_ELF_ENTRY_SIZE    30433
-#define STUB_I386_LINUX_ELF_ENTRY_ADLER32 0x3c81cdb6
-#define STUB_I386_LINUX_ELF_ENTRY_CRC32   0x465abb32
+#define STUB_I386_LINUX_ELF_ENTRY_SIZE    15774
+#define STUB_I386_LINUX_ELF_ENTRY_ADLER32 0x775fbf72
+#define STUB_I386_LINUX_ELF_ENTRY_CRC32   0xb057c267
 
-unsigned char stub_i386_linux_elf_entry[30433] = {
+unsigned char stub_i386_linux_elf_entry[15774] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 152, 34,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -474,1469 +474,552 @@ unsigned char stub_i386_linux_elf_entry[30433] = {
 /* 0x1b30 */  81, 83,106,125, 88,205,128,139, 70,240,  1,248,139,141,246,255,
 /* 0x1b40 */ 255,255, 90, 82,255,226,141, 92, 36,  4,106, 90, 88,205,128, 61,
 /* 0x1b50 */   0,240,255,255,114,  1,244,194, 24,  0, 93,232,126,255,255,255,
-/* 0x1b60 */   0,  0,  0,  0,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1b70 */ 101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,
-/* 0x1b80 */ 105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32,
-/* 0x1b90 */  32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32,
-/* 0x1ba0 */  32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32,
-/* 0x1bb0 */  32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32,
-/* 0x1bc0 */  65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32,
-/* 0x1bd0 */  76, 69, 88, 69, 67, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 54,
-/* 0x1be0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42,
-/* 0x1bf0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32,
-/* 0x1c00 */  76, 69, 88, 69, 67, 48, 48, 57, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x1c10 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 97, 32, 32, 50, 42, 42, 48,
-/* 0x1c20 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 76,
-/* 0x1c30 */  69, 88, 69, 67, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32,
-/* 0x1c40 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 97, 32, 32, 50, 42, 42, 48,
-/* 0x1c50 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78,
-/* 0x1c60 */  50, 66, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32,
-/* 0x1c70 */  32, 48, 32, 32, 48, 32, 32, 48, 52, 54, 32, 32, 50, 42, 42, 48,
-/* 0x1c80 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78,
-/* 0x1c90 */  50, 66, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x1ca0 */  32, 48, 32, 32, 48, 32, 32, 48, 52, 57, 32, 32, 50, 42, 42, 48,
-/* 0x1cb0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 78,
-/* 0x1cc0 */  50, 66, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x1cd0 */  32, 48, 32, 32, 48, 32, 32, 48, 52, 98, 32, 32, 50, 42, 42, 48,
-/* 0x1ce0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 78,
-/* 0x1cf0 */  50, 66, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32,
-/* 0x1d00 */  32, 48, 32, 32, 48, 32, 32, 48, 53, 49, 32, 32, 50, 42, 42, 48,
-/* 0x1d10 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 78,
-/* 0x1d20 */  50, 66, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x1d30 */  32, 48, 32, 32, 48, 32, 32, 48, 53, 99, 32, 32, 50, 42, 42, 48,
-/* 0x1d40 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 78,
-/* 0x1d50 */  50, 66, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32,
-/* 0x1d60 */  32, 48, 32, 32, 48, 32, 32, 48, 54, 49, 32, 32, 50, 42, 42, 48,
-/* 0x1d70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 78,
-/* 0x1d80 */  50, 66, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32,
-/* 0x1d90 */  32, 48, 32, 32, 48, 32, 32, 48, 54, 97, 32, 32, 50, 42, 42, 48,
-/* 0x1da0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 78,
-/* 0x1db0 */  50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32,
-/* 0x1dc0 */  32, 48, 32, 32, 48, 32, 32, 48, 55, 55, 32, 32, 50, 42, 42, 48,
-/* 0x1dd0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 78,
-/* 0x1de0 */  50, 66, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32,
-/* 0x1df0 */  32, 48, 32, 32, 48, 32, 32, 48, 56, 52, 32, 32, 50, 42, 42, 48,
-/* 0x1e00 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 78,
-/* 0x1e10 */  50, 66, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 51,101,
-/* 0x1e20 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 51, 32, 32, 50, 42, 42,
-/* 0x1e30 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32,
-/* 0x1e40 */  78, 50, 66, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100,
-/* 0x1e50 */  32, 32, 48, 32, 32, 48, 32, 32, 48,100, 49, 32, 32, 50, 42, 42,
-/* 0x1e60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 52, 32,
-/* 0x1e70 */  78, 50, 66, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102,
-/* 0x1e80 */  32, 32, 48, 32, 32, 48, 32, 32, 48,100,101, 32, 32, 50, 42, 42,
-/* 0x1e90 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 53, 32,
-/* 0x1ea0 */  78, 50, 66, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x1eb0 */  32, 32, 48, 32, 32, 48, 32, 32, 48,101,100, 32, 32, 50, 42, 42,
-/* 0x1ec0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 54, 32,
-/* 0x1ed0 */  78, 50, 66, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x1ee0 */  32, 32, 48, 32, 32, 48, 32, 32, 48,101,102, 32, 32, 50, 42, 42,
-/* 0x1ef0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 55, 32,
-/* 0x1f00 */  78, 50, 66, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57,
-/* 0x1f10 */  32, 32, 48, 32, 32, 48, 32, 32, 48,102, 50, 32, 32, 50, 42, 42,
-/* 0x1f20 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 56, 32,
-/* 0x1f30 */  78, 50, 66, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99,
-/* 0x1f40 */  32, 32, 48, 32, 32, 48, 32, 32, 48,102, 98, 32, 32, 50, 42, 42,
-/* 0x1f50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 57, 32,
-/* 0x1f60 */  78, 50, 66, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x1f70 */  57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 48, 55, 32, 32, 50,
-/* 0x1f80 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x1f90 */  48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32,
-/* 0x1fa0 */  48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 48, 32,
-/* 0x1fb0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1fc0 */  32, 50, 49, 32, 78, 50, 66, 68, 69, 67, 54, 48, 32, 32, 32, 32,
-/* 0x1fd0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 54, 32,
-/* 0x1fe0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1ff0 */  32, 50, 50, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 32, 32, 32,
-/* 0x2000 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 54,
-/* 0x2010 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2020 */  10, 32, 50, 51, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 32, 32,
-/* 0x2030 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51,
-/* 0x2040 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2050 */  83, 10, 32, 50, 52, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 32,
-/* 0x2060 */  32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2070 */  51, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2080 */  84, 83, 10, 32, 50, 53, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32,
-/* 0x2090 */  32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x20a0 */  49, 52, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x20b0 */  78, 84, 83, 10, 32, 50, 54, 32, 78, 50, 68, 83, 77, 65, 50, 48,
-/* 0x20c0 */  32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x20d0 */  48, 49, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x20e0 */  69, 78, 84, 83, 10, 32, 50, 55, 32, 78, 50, 68, 70, 65, 83, 50,
-/* 0x20f0 */  48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2100 */  32, 48, 49, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2110 */  84, 69, 78, 84, 83, 10, 32, 50, 56, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2120 */  50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48,
-/* 0x2130 */  32, 32, 48, 49, 53, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2140 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 57, 32, 78, 50, 68, 83, 77,
-/* 0x2150 */  65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32,
-/* 0x2160 */  48, 32, 32, 48, 49, 54, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2170 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 48, 32, 78, 50, 68, 70,
-/* 0x2180 */  65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32,
-/* 0x2190 */  32, 48, 32, 32, 48, 49, 55, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x21a0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 49, 32, 78, 50, 68,
-/* 0x21b0 */  68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 53, 50, 32, 32,
-/* 0x21c0 */  48, 32, 32, 48, 32, 32, 48, 49, 56, 51, 32, 32, 50, 42, 42, 48,
-/* 0x21d0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 50, 32, 78,
-/* 0x21e0 */  50, 68, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32,
-/* 0x21f0 */  32, 48, 32, 32, 48, 32, 32, 48, 49,100, 53, 32, 32, 50, 42, 42,
-/* 0x2200 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 51, 32,
-/* 0x2210 */  78, 50, 68, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102,
-/* 0x2220 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49,101, 50, 32, 32, 50, 42,
-/* 0x2230 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 52,
-/* 0x2240 */  32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2250 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102, 49, 32, 32, 50,
-/* 0x2260 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51,
-/* 0x2270 */  53, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2280 */  48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102, 51, 32, 32,
-/* 0x2290 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x22a0 */  51, 54, 32, 78, 50, 68, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32,
-/* 0x22b0 */  32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102, 54, 32,
-/* 0x22c0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x22d0 */  32, 51, 55, 32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 32, 32, 32,
-/* 0x22e0 */  32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102,102,
-/* 0x22f0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2300 */  10, 32, 51, 56, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 32, 32,
-/* 0x2310 */  32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x2320 */  48, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2330 */  84, 83, 10, 32, 51, 57, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32,
-/* 0x2340 */  32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2350 */  48, 50, 50, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2360 */  69, 78, 84, 83, 10, 32, 52, 48, 32, 78, 50, 68, 68, 69, 67, 54,
-/* 0x2370 */  48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2380 */  48, 50, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2390 */  69, 78, 84, 83, 10, 32, 52, 49, 32, 78, 50, 69, 83, 77, 65, 49,
-/* 0x23a0 */  48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x23b0 */  32, 48, 50, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x23c0 */  84, 69, 78, 84, 83, 10, 32, 52, 50, 32, 78, 50, 69, 70, 65, 83,
-/* 0x23d0 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x23e0 */  32, 32, 48, 50, 51,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x23f0 */  78, 84, 69, 78, 84, 83, 10, 32, 52, 51, 32, 78, 50, 69, 70, 65,
-/* 0x2400 */  83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32,
-/* 0x2410 */  48, 32, 32, 48, 50, 51,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2420 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 52, 32, 78, 50, 69, 68,
-/* 0x2430 */  69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32,
-/* 0x2440 */  32, 48, 32, 32, 48, 50, 52, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2450 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 53, 32, 78, 50, 69,
-/* 0x2460 */  83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2470 */  32, 32, 48, 32, 32, 48, 50, 53, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2480 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 54, 32, 78, 50,
-/* 0x2490 */  69, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32,
-/* 0x24a0 */  48, 32, 32, 48, 32, 32, 48, 50, 53, 53, 32, 32, 50, 42, 42, 48,
-/* 0x24b0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 55, 32, 78,
-/* 0x24c0 */  50, 69, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32,
-/* 0x24d0 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 53,101, 32, 32, 50, 42, 42,
-/* 0x24e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 56, 32,
-/* 0x24f0 */  78, 50, 69, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100,
-/* 0x2500 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 54, 98, 32, 32, 50, 42,
-/* 0x2510 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 57,
-/* 0x2520 */  32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2530 */ 102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 56, 32, 32, 50,
-/* 0x2540 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x2550 */  48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2560 */  48, 53,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 55, 32,
-/* 0x2570 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2580 */  32, 53, 49, 32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 32, 32, 32,
-/* 0x2590 */  32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,101, 54,
-/* 0x25a0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x25b0 */  10, 32, 53, 50, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 32, 32,
-/* 0x25c0 */  32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,102,
-/* 0x25d0 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x25e0 */  83, 10, 32, 53, 51, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 32,
-/* 0x25f0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2600 */  48, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2610 */  84, 83, 10, 32, 53, 52, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32,
-/* 0x2620 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2630 */  51, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2640 */  78, 84, 83, 10, 32, 53, 53, 32, 78, 50, 69, 68, 69, 67, 53, 48,
-/* 0x2650 */  32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2660 */  48, 51, 48, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2670 */  69, 78, 84, 83, 10, 32, 53, 54, 32, 78, 50, 69, 83, 77, 65, 54,
-/* 0x2680 */  48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2690 */  32, 48, 51, 49, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x26a0 */  84, 69, 78, 84, 83, 10, 32, 53, 55, 32, 78, 50, 69, 70, 65, 83,
-/* 0x26b0 */  54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32,
-/* 0x26c0 */  48, 32, 32, 48, 51, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x26d0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 56, 32, 78, 50, 69, 70,
-/* 0x26e0 */  65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48,
-/* 0x26f0 */  32, 32, 48, 32, 32, 48, 51, 51, 53, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2700 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 57, 32, 78, 50,
-/* 0x2710 */  69, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48,
-/* 0x2720 */  32, 32, 48, 32, 32, 48, 51, 52, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2730 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 48, 32, 76, 90,
-/* 0x2740 */  77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 50,101, 32,
-/* 0x2750 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 98, 32, 32, 50, 42, 42,
-/* 0x2760 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 49, 32,
-/* 0x2770 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 52,
-/* 0x2780 */  56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 55, 57, 32, 32, 50,
-/* 0x2790 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54,
-/* 0x27a0 */  50, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x27b0 */  48, 97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 99, 49,
-/* 0x27c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x27d0 */  10, 32, 54, 51, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x27e0 */  32, 32, 32, 48, 97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x27f0 */ 101, 52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2800 */  78, 84, 83, 10, 32, 54, 52, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2810 */  51, 48, 32, 32, 32, 32, 48, 49, 97, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2820 */  32, 48, 49, 56, 99,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2830 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 53, 32, 67, 65, 76, 76, 84,
-/* 0x2840 */  82, 48, 48, 32, 32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32,
-/* 0x2850 */  48, 32, 32, 48, 49, 56,101, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2860 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 54, 32, 67, 84, 67,
-/* 0x2870 */  76, 69, 86, 69, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2880 */  32, 32, 48, 32, 32, 48, 49, 56,102, 53, 32, 32, 50, 42, 42, 48,
-/* 0x2890 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 55, 32, 67,
-/* 0x28a0 */  65, 76, 76, 84, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x28b0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 56,102, 97, 32, 32, 50, 42,
-/* 0x28c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 56,
-/* 0x28d0 */  32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x28e0 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56,102,102, 32, 32,
-/* 0x28f0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2900 */  54, 57, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 32, 32, 32, 32,
-/* 0x2910 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 48, 51,
-/* 0x2920 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2930 */  10, 32, 55, 48, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 32, 32,
-/* 0x2940 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2950 */  48, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2960 */  84, 83, 10, 32, 55, 49, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32,
-/* 0x2970 */  32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2980 */  49, 57, 48, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2990 */  69, 78, 84, 83, 10, 32, 55, 50, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x29a0 */  48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x29b0 */  32, 48, 49, 57, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x29c0 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 51, 32, 67, 65, 76, 76, 84,
-/* 0x29d0 */  82, 69, 56, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x29e0 */  48, 32, 32, 48, 49, 57, 49,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x29f0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 52, 32, 67, 65, 76,
-/* 0x2a00 */  76, 84, 82, 69, 57, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2a10 */  32, 32, 48, 32, 32, 48, 49, 57, 49,102, 32, 32, 50, 42, 42, 48,
-/* 0x2a20 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 53, 32, 67,
-/* 0x2a30 */  65, 76, 76, 84, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32,
-/* 0x2a40 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50, 49, 32, 32, 50, 42,
-/* 0x2a50 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 54,
-/* 0x2a60 */  32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2a70 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50, 53, 32, 32,
-/* 0x2a80 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2a90 */  55, 55, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 32, 32, 32, 32,
-/* 0x2aa0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50, 97,
-/* 0x2ab0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2ac0 */  10, 32, 55, 56, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 32, 32,
-/* 0x2ad0 */  32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2ae0 */  50, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2af0 */  84, 83, 10, 32, 55, 57, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32,
-/* 0x2b00 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2b10 */  49, 57, 51, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2b20 */  69, 78, 84, 83, 10, 32, 56, 48, 32, 67, 84, 66, 83, 87, 65, 49,
-/* 0x2b30 */  49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2b40 */  32, 48, 49, 57, 51, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2b50 */  78, 84, 69, 78, 84, 83, 10, 32, 56, 49, 32, 67, 65, 76, 76, 84,
-/* 0x2b60 */  82, 49, 51, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x2b70 */  48, 32, 32, 48, 49, 57, 51, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2b80 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 50, 32, 76, 69, 88,
-/* 0x2b90 */  69, 67, 48, 49, 53, 32, 32, 32, 32, 32, 32, 48, 49,100, 32, 32,
-/* 0x2ba0 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 99, 32, 32, 50, 42, 42,
-/* 0x2bb0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 51, 32,
-/* 0x2bc0 */  76, 88, 85, 78, 70, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x2bd0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 57, 32, 32, 50,
-/* 0x2be0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56,
-/* 0x2bf0 */  52, 32, 76, 88, 85, 78, 70, 48, 48, 50, 32, 32, 32, 32, 32, 32,
-/* 0x2c00 */  48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 98, 32,
-/* 0x2c10 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2c20 */  32, 56, 53, 32, 77, 82, 85, 66, 89, 84, 69, 48, 32, 32, 32, 32,
-/* 0x2c30 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54,
-/* 0x2c40 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2c50 */  83, 10, 32, 56, 54, 32, 76, 88, 77, 82, 85, 48, 48, 53, 32, 32,
-/* 0x2c60 */  32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2c70 */  57, 54, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2c80 */  78, 84, 83, 10, 32, 56, 55, 32, 76, 88, 77, 82, 85, 48, 48, 54,
-/* 0x2c90 */  32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2ca0 */  48, 49, 57, 54, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2cb0 */  84, 69, 78, 84, 83, 10, 32, 56, 56, 32, 76, 88, 77, 82, 85, 48,
-/* 0x2cc0 */  48, 55, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48,
-/* 0x2cd0 */  32, 32, 48, 49, 57, 54,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2ce0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 57, 32, 76, 88, 85, 78,
-/* 0x2cf0 */  70, 48, 48, 56, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32,
-/* 0x2d00 */  32, 48, 32, 32, 48, 49, 57, 55, 53, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2d10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 48, 32, 76, 88,
-/* 0x2d20 */  85, 78, 70, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32,
-/* 0x2d30 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 57, 32, 32, 50, 42, 42,
-/* 0x2d40 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 49, 32,
-/* 0x2d50 */  76, 88, 74, 67, 67, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x2d60 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 55,101, 32, 32, 50,
-/* 0x2d70 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57,
-/* 0x2d80 */  50, 32, 76, 88, 77, 82, 85, 48, 52, 53, 32, 32, 32, 32, 32, 32,
-/* 0x2d90 */  48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 49, 32,
-/* 0x2da0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2db0 */  32, 57, 51, 32, 76, 88, 77, 82, 85, 48, 52, 54, 32, 32, 32, 32,
-/* 0x2dc0 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56,
-/* 0x2dd0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2de0 */  83, 10, 32, 57, 52, 32, 76, 88, 74, 67, 67, 48, 50, 48, 32, 32,
-/* 0x2df0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2e00 */  57, 56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2e10 */  78, 84, 83, 10, 32, 57, 53, 32, 76, 88, 74, 67, 67, 48, 50, 49,
-/* 0x2e20 */  32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2e30 */  48, 49, 57, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2e40 */  84, 69, 78, 84, 83, 10, 32, 57, 54, 32, 76, 88, 74, 67, 67, 48,
-/* 0x2e50 */  50, 51, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48,
-/* 0x2e60 */  32, 32, 48, 49, 57, 56,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2e70 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 55, 32, 76, 88, 85, 78,
-/* 0x2e80 */  70, 48, 51, 55, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x2e90 */  32, 48, 32, 32, 48, 49, 57, 57, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2ea0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 56, 32, 76, 88,
-/* 0x2eb0 */  85, 78, 70, 51, 56, 54, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32,
-/* 0x2ec0 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 57, 54, 32, 32, 50, 42, 42,
-/* 0x2ed0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 57, 32,
-/* 0x2ee0 */  76, 88, 85, 78, 70, 51, 56, 55, 32, 32, 32, 32, 32, 32, 48, 57,
-/* 0x2ef0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 57, 55, 32, 32, 50,
-/* 0x2f00 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48,
-/* 0x2f10 */  48, 32, 76, 88, 85, 78, 70, 51, 56, 56, 32, 32, 32, 32, 32, 32,
-/* 0x2f20 */  48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97, 48, 32,
-/* 0x2f30 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2f40 */  49, 48, 49, 32, 76, 88, 85, 78, 70, 52, 56, 54, 32, 32, 32, 32,
-/* 0x2f50 */  32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97,
-/* 0x2f60 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2f70 */  83, 10, 49, 48, 50, 32, 76, 88, 85, 78, 70, 52, 56, 55, 32, 32,
-/* 0x2f80 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2f90 */  57, 97, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2fa0 */  78, 84, 83, 10, 49, 48, 51, 32, 76, 88, 77, 82, 85, 48, 54, 53,
-/* 0x2fb0 */  32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2fc0 */  48, 49, 57, 97, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2fd0 */  84, 69, 78, 84, 83, 10, 49, 48, 52, 32, 77, 82, 85, 66, 89, 84,
-/* 0x2fe0 */  69, 51, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x2ff0 */  32, 32, 48, 49, 57, 97,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3000 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 53, 32, 77, 82, 85, 65,
-/* 0x3010 */  82, 66, 51, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32,
-/* 0x3020 */  32, 48, 32, 32, 48, 49, 57, 98, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3030 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 54, 32, 77, 82,
-/* 0x3040 */  85, 66, 73, 84, 83, 51, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x3050 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 49, 32, 32, 50, 42, 42,
-/* 0x3060 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 55, 32,
-/* 0x3070 */  77, 82, 85, 65, 82, 66, 52, 48, 32, 32, 32, 32, 32, 32, 48, 52,
-/* 0x3080 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 51, 32, 32, 50,
-/* 0x3090 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48,
-/* 0x30a0 */  56, 32, 76, 88, 77, 82, 85, 48, 55, 48, 32, 32, 32, 32, 32, 32,
-/* 0x30b0 */  48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 55, 32,
-/* 0x30c0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x30d0 */  49, 48, 57, 32, 77, 82, 85, 66, 89, 84, 69, 52, 32, 32, 32, 32,
-/* 0x30e0 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98,
-/* 0x30f0 */ 102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3100 */  83, 10, 49, 49, 48, 32, 77, 82, 85, 66, 73, 84, 83, 52, 32, 32,
-/* 0x3110 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3120 */  57, 99, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3130 */  78, 84, 83, 10, 49, 49, 49, 32, 77, 82, 85, 65, 82, 66, 53, 48,
-/* 0x3140 */  32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3150 */  48, 49, 57, 99, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3160 */  84, 69, 78, 84, 83, 10, 49, 49, 50, 32, 76, 88, 77, 82, 85, 48,
-/* 0x3170 */  56, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48,
-/* 0x3180 */  32, 32, 48, 49, 57, 99, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3190 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 51, 32, 77, 82, 85, 66,
-/* 0x31a0 */  89, 84, 69, 53, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x31b0 */  32, 48, 32, 32, 48, 49, 57, 99,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x31c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 52, 32, 77, 82,
-/* 0x31d0 */  85, 65, 82, 66, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32,
-/* 0x31e0 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 99,102, 32, 32, 50, 42, 42,
-/* 0x31f0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 53, 32,
-/* 0x3200 */  77, 82, 85, 66, 73, 84, 83, 53, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x3210 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100, 48, 32, 32, 50,
-/* 0x3220 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49,
-/* 0x3230 */  54, 32, 77, 82, 85, 65, 82, 66, 55, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3240 */  48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100, 50, 32,
-/* 0x3250 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3260 */  49, 49, 55, 32, 76, 88, 77, 82, 85, 48, 57, 48, 32, 32, 32, 32,
-/* 0x3270 */  32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100,
-/* 0x3280 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3290 */  83, 10, 49, 49, 56, 32, 77, 82, 85, 66, 89, 84, 69, 54, 32, 32,
-/* 0x32a0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x32b0 */  57,101, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x32c0 */  78, 84, 83, 10, 49, 49, 57, 32, 77, 82, 85, 65, 82, 66, 56, 48,
-/* 0x32d0 */  32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x32e0 */  48, 49, 57,101, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x32f0 */  84, 69, 78, 84, 83, 10, 49, 50, 48, 32, 77, 82, 85, 66, 73, 84,
-/* 0x3300 */  83, 54, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x3310 */  32, 32, 48, 49, 57,101, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3320 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 49, 32, 77, 82, 85, 65,
-/* 0x3330 */  82, 66, 57, 48, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32,
-/* 0x3340 */  32, 48, 32, 32, 48, 49, 57,101, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3350 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 50, 32, 76, 88,
-/* 0x3360 */  77, 82, 85, 49, 48, 48, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32,
-/* 0x3370 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57,101, 97, 32, 32, 50, 42,
-/* 0x3380 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 51,
-/* 0x3390 */  32, 76, 88, 85, 78, 70, 48, 52, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x33a0 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 97, 32, 32,
-/* 0x33b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x33c0 */  50, 52, 32, 76, 88, 77, 82, 85, 49, 49, 48, 32, 32, 32, 32, 32,
-/* 0x33d0 */  32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102,102,
-/* 0x33e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x33f0 */  10, 49, 50, 53, 32, 76, 88, 77, 82, 85, 49, 49, 49, 32, 32, 32,
-/* 0x3400 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3410 */  48, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3420 */  84, 83, 10, 49, 50, 54, 32, 76, 88, 85, 78, 70, 48, 52, 49, 32,
-/* 0x3430 */  32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3440 */  49, 97, 48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3450 */  69, 78, 84, 83, 10, 49, 50, 55, 32, 76, 88, 85, 78, 70, 48, 52,
-/* 0x3460 */  50, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3470 */  48, 49, 97, 48, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3480 */  84, 69, 78, 84, 83, 10, 49, 50, 56, 32, 76, 69, 88, 69, 67, 48,
-/* 0x3490 */  49, 54, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x34a0 */  32, 32, 48, 49, 97, 48, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x34b0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 57, 32, 76, 88, 77, 82,
-/* 0x34c0 */  85, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32,
-/* 0x34d0 */  32, 48, 32, 32, 48, 49, 97, 49, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x34e0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 48, 32, 76, 88,
-/* 0x34f0 */  74, 77, 80, 65, 48, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x3500 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 49, 32, 32, 50, 42, 42,
-/* 0x3510 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 49, 32,
-/* 0x3520 */  76, 88, 67, 65, 76, 76, 66, 48, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x3530 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 51, 32, 32, 50,
-/* 0x3540 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51,
-/* 0x3550 */  50, 32, 76, 88, 85, 78, 70, 48, 50, 49, 32, 32, 32, 32, 32, 32,
-/* 0x3560 */  48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 53, 32,
-/* 0x3570 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3580 */  49, 51, 51, 32, 76, 88, 77, 82, 85, 48, 50, 50, 32, 32, 32, 32,
-/* 0x3590 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49,
-/* 0x35a0 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x35b0 */  83, 10, 49, 51, 52, 32, 76, 88, 74, 77, 80, 65, 48, 49, 32, 32,
-/* 0x35c0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x35d0 */  97, 49,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x35e0 */  78, 84, 83, 10, 49, 51, 53, 32, 76, 88, 67, 65, 76, 76, 66, 49,
-/* 0x35f0 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3600 */  48, 49, 97, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3610 */  84, 69, 78, 84, 83, 10, 49, 51, 54, 32, 77, 82, 85, 66, 73, 84,
-/* 0x3620 */  83, 49, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48,
-/* 0x3630 */  32, 32, 48, 49, 97, 50, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3640 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 55, 32, 76, 88, 77, 82,
-/* 0x3650 */  85, 48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x3660 */  32, 48, 32, 32, 48, 49, 97, 50, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3670 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 56, 32, 77, 82,
-/* 0x3680 */  85, 66, 89, 84, 69, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x3690 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 50, 53, 32, 32, 50, 42, 42,
-/* 0x36a0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 57, 32,
-/* 0x36b0 */  77, 82, 85, 65, 82, 66, 49, 48, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x36c0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 50, 55, 32, 32, 50,
-/* 0x36d0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52,
-/* 0x36e0 */  48, 32, 76, 88, 77, 82, 85, 48, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x36f0 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 50, 56, 32,
-/* 0x3700 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3710 */  49, 52, 49, 32, 76, 88, 85, 78, 70, 48, 51, 48, 32, 32, 32, 32,
-/* 0x3720 */  32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 50,
-/* 0x3730 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3740 */  83, 10, 49, 52, 50, 32, 76, 88, 74, 67, 67, 48, 48, 48, 32, 32,
-/* 0x3750 */  32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3760 */  97, 51, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3770 */  78, 84, 83, 10, 49, 52, 51, 32, 76, 88, 67, 74, 48, 77, 82, 85,
-/* 0x3780 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3790 */  48, 49, 97, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x37a0 */  84, 69, 78, 84, 83, 10, 49, 52, 52, 32, 76, 88, 67, 74, 49, 77,
-/* 0x37b0 */  82, 85, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48,
-/* 0x37c0 */  32, 32, 48, 49, 97, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x37d0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 53, 32, 76, 88, 67, 65,
-/* 0x37e0 */  76, 74, 77, 80, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32,
-/* 0x37f0 */  32, 48, 32, 32, 48, 49, 97, 51,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3800 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 54, 32, 76, 88,
-/* 0x3810 */  67, 65, 76, 76, 48, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x3820 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 52, 48, 32, 32, 50, 42, 42,
-/* 0x3830 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 55, 32,
-/* 0x3840 */  76, 88, 67, 65, 76, 76, 48, 49, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x3850 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 52, 50, 32, 32, 50,
-/* 0x3860 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52,
-/* 0x3870 */  56, 32, 76, 88, 67, 74, 50, 77, 82, 85, 32, 32, 32, 32, 32, 32,
-/* 0x3880 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 52, 53, 32,
-/* 0x3890 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x38a0 */  49, 52, 57, 32, 76, 88, 67, 74, 52, 77, 82, 85, 32, 32, 32, 32,
-/* 0x38b0 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 52,
-/* 0x38c0 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x38d0 */  83, 10, 49, 53, 48, 32, 76, 88, 67, 74, 54, 77, 82, 85, 32, 32,
-/* 0x38e0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x38f0 */  97, 52, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3900 */  78, 84, 83, 10, 49, 53, 49, 32, 76, 88, 67, 74, 55, 77, 82, 85,
-/* 0x3910 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3920 */  48, 49, 97, 52, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3930 */  84, 69, 78, 84, 83, 10, 49, 53, 50, 32, 76, 88, 67, 74, 56, 77,
-/* 0x3940 */  82, 85, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48,
-/* 0x3950 */  32, 32, 48, 49, 97, 52,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3960 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 51, 32, 76, 88, 85, 78,
-/* 0x3970 */  70, 48, 51, 52, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x3980 */  32, 48, 32, 32, 48, 49, 97, 53, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3990 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 52, 32, 76, 88,
-/* 0x39a0 */  77, 82, 85, 48, 53, 53, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x39b0 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 53, 53, 32, 32, 50, 42, 42,
-/* 0x39c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 53, 32,
-/* 0x39d0 */  77, 82, 85, 66, 89, 84, 69, 50, 32, 32, 32, 32, 32, 32, 48, 53,
-/* 0x39e0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 53, 55, 32, 32, 50,
-/* 0x39f0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53,
-/* 0x3a00 */  54, 32, 77, 82, 85, 66, 73, 84, 83, 50, 32, 32, 32, 32, 32, 32,
-/* 0x3a10 */  48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 53, 99, 32,
-/* 0x3a20 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3a30 */  49, 53, 55, 32, 77, 82, 85, 65, 82, 66, 50, 48, 32, 32, 32, 32,
-/* 0x3a40 */  32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 54,
-/* 0x3a50 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3a60 */  83, 10, 49, 53, 56, 32, 76, 88, 77, 82, 85, 48, 53, 55, 32, 32,
-/* 0x3a70 */  32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3a80 */  97, 54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3a90 */  78, 84, 83, 10, 49, 53, 57, 32, 76, 88, 77, 82, 85, 48, 53, 56,
-/* 0x3aa0 */  32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3ab0 */  48, 49, 97, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3ac0 */  84, 69, 78, 84, 83, 10, 49, 54, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x3ad0 */  51, 53, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48,
-/* 0x3ae0 */  32, 32, 48, 49, 97, 54,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3af0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 49, 32, 99,116,111,107,
-/* 0x3b00 */  51, 50, 46, 48, 48, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32,
-/* 0x3b10 */  32, 48, 32, 32, 48, 49, 97, 55, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3b20 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 50, 32, 99,116,
-/* 0x3b30 */ 111,107, 51, 50, 46, 49, 48, 32, 32, 32, 32, 32, 48,101, 32, 32,
-/* 0x3b40 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 55, 97, 32, 32, 50, 42, 42,
-/* 0x3b50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 51, 32,
-/* 0x3b60 */  99,116,111,107, 51, 50, 46, 50, 48, 32, 32, 32, 32, 32, 48, 50,
-/* 0x3b70 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56, 56, 32, 32,
-/* 0x3b80 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3b90 */  54, 52, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 32, 32, 32,
-/* 0x3ba0 */  32, 48, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97, 56,
-/* 0x3bb0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3bc0 */  10, 49, 54, 53, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 32,
-/* 0x3bd0 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3be0 */  98, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3bf0 */  84, 83, 10, 49, 54, 54, 32, 76, 69, 88, 69, 67, 48, 49, 55, 32,
-/* 0x3c00 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3c10 */  49, 97, 98, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3c20 */  69, 78, 84, 83, 10, 49, 54, 55, 32, 76, 69, 88, 69, 67, 48, 50,
-/* 0x3c30 */  48, 32, 32, 32, 32, 32, 32, 48, 97, 98, 32, 32, 48, 32, 32, 48,
-/* 0x3c40 */  32, 32, 48, 49, 97, 98, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3c50 */  79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84,
-/* 0x3c60 */  65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3c70 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32,
-/* 0x3c80 */  48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3c90 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x3ca0 */  65, 83, 49, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10,
-/* 0x3cb0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3cc0 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 66, 68,
-/* 0x3cd0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3ce0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 48,
-/* 0x3cf0 */  32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3d00 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69,
-/* 0x3d10 */  67, 51, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48,
-/* 0x3d20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3d30 */  78, 50, 66, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 66, 68, 69,
-/* 0x3d40 */  67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3d50 */  32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 48, 32,
-/* 0x3d60 */  78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d70 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x3d80 */  54, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48,
-/* 0x3d90 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3da0 */  50, 68, 83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x3db0 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3dc0 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 48, 32, 78,
-/* 0x3dd0 */  50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3de0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x3df0 */  48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x3e00 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3e10 */  68, 68, 69, 67, 50, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 50,
-/* 0x3e20 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3e30 */ 100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50,
-/* 0x3e40 */  68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3e50 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48,
-/* 0x3e60 */  32, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48,
-/* 0x3e70 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x3e80 */  70, 65, 83, 54, 49, 32, 48, 32, 78, 50, 68, 70, 65, 83, 54, 49,
-/* 0x3e90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3ea0 */  32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 68,
-/* 0x3eb0 */  68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3ec0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32,
-/* 0x3ed0 */  48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3ee0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x3ef0 */  65, 83, 49, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10,
-/* 0x3f00 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3f10 */  32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 69, 68,
-/* 0x3f20 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3f30 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 32, 48,
-/* 0x3f40 */  32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3f50 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69,
-/* 0x3f60 */  67, 51, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48,
-/* 0x3f70 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3f80 */  78, 50, 69, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 69, 68, 69,
-/* 0x3f90 */  67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3fa0 */  32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 48, 32,
-/* 0x3fb0 */  78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3fc0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x3fd0 */  54, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 48, 48,
-/* 0x3fe0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x3ff0 */  65, 76, 76, 84, 82, 48, 48, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4000 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4010 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 48, 32, 67,
-/* 0x4020 */  65, 76, 76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4030 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x4040 */  49, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 48, 48, 48,
-/* 0x4050 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x4060 */  76, 76, 84, 82, 49, 51, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x4070 */  51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4080 */ 100, 32, 32, 76, 88, 85, 78, 70, 48, 49, 48, 32, 48, 32, 76, 88,
-/* 0x4090 */  85, 78, 70, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x40a0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 49, 48,
-/* 0x40b0 */  32, 48, 32, 76, 88, 74, 67, 67, 48, 49, 48, 10, 48, 48, 48, 48,
-/* 0x40c0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x40d0 */  78, 70, 48, 51, 55, 32, 48, 32, 76, 88, 85, 78, 70, 48, 51, 55,
-/* 0x40e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x40f0 */  32, 32, 76, 88, 77, 82, 85, 48, 55, 48, 32, 48, 32, 76, 88, 77,
-/* 0x4100 */  82, 85, 48, 55, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4110 */  32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 49, 48, 48, 32,
-/* 0x4120 */  48, 32, 76, 88, 77, 82, 85, 49, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4130 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x4140 */  70, 48, 52, 48, 32, 48, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10,
-/* 0x4150 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4160 */  32, 76, 88, 85, 78, 70, 48, 52, 50, 32, 48, 32, 76, 88, 85, 78,
-/* 0x4170 */  70, 48, 52, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4180 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 51, 48, 32, 48,
-/* 0x4190 */  32, 76, 88, 77, 82, 85, 48, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x41a0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70,
-/* 0x41b0 */  48, 51, 48, 32, 48, 32, 76, 88, 85, 78, 70, 48, 51, 48, 10, 48,
-/* 0x41c0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x41d0 */  76, 88, 67, 74, 56, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 56,
-/* 0x41e0 */  77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x41f0 */  32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 32, 48, 32,
-/* 0x4200 */  76, 88, 85, 78, 70, 48, 51, 52, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4210 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50,
-/* 0x4220 */  46, 48, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10,
-/* 0x4230 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4240 */  32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 48, 32, 99,116,111,
-/* 0x4250 */ 107, 51, 50, 46, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4260 */ 108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 50,
-/* 0x4270 */  48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 48, 48,
-/* 0x4280 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,
-/* 0x4290 */ 116,111,107, 51, 50, 46, 52, 48, 32, 48, 32, 99,116,111,107, 51,
-/* 0x42a0 */  50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x42b0 */  32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 50, 48, 32, 48,
-/* 0x42c0 */  32, 76, 69, 88, 69, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x42d0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67,
-/* 0x42e0 */  48, 48, 48, 32, 48, 32, 76, 69, 88, 69, 67, 48, 48, 48, 10, 48,
-/* 0x42f0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4300 */  76, 69, 88, 69, 67, 48, 48, 57, 32, 48, 32, 76, 69, 88, 69, 67,
-/* 0x4310 */  48, 48, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4320 */  32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 48, 32, 48, 32,
-/* 0x4330 */  76, 69, 88, 69, 67, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4340 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x4350 */  49, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 49, 48, 10, 48, 48,
-/* 0x4360 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x4370 */  50, 66, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4380 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4390 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 48, 32, 78,
-/* 0x43a0 */  50, 66, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x43b0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 51,
-/* 0x43c0 */  48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 51, 48, 10, 48, 48, 48,
-/* 0x43d0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x43e0 */  66, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 51,
-/* 0x43f0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4400 */ 100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50,
-/* 0x4410 */  66, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4420 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 52, 48,
-/* 0x4430 */  32, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48,
-/* 0x4440 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x4450 */  83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 53, 48,
-/* 0x4460 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4470 */  32, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 66,
-/* 0x4480 */  70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4490 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32,
-/* 0x44a0 */  48, 32, 78, 50, 66, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x44b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x44c0 */  65, 83, 54, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48, 10,
-/* 0x44d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x44e0 */  32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 68, 70,
-/* 0x44f0 */  65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4500 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 48,
-/* 0x4510 */  32, 78, 50, 68, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4520 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65,
-/* 0x4530 */  83, 50, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 50, 48, 10, 48,
-/* 0x4540 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4550 */  78, 50, 68, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 68, 83, 77,
-/* 0x4560 */  65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4570 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 48, 32,
-/* 0x4580 */  78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4590 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65,
-/* 0x45a0 */  52, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 52, 48, 10, 48, 48,
-/* 0x45b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x45c0 */  50, 68, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x45d0 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x45e0 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 48, 32, 78,
-/* 0x45f0 */  50, 68, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4600 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 53,
-/* 0x4610 */  48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 53, 48, 10, 48, 48, 48,
-/* 0x4620 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4630 */  68, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 54,
-/* 0x4640 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4650 */ 100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50,
-/* 0x4660 */  68, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4670 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 48,
-/* 0x4680 */  32, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48,
-/* 0x4690 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x46a0 */  83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 50, 48,
-/* 0x46b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x46c0 */  32, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 69,
-/* 0x46d0 */  70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x46e0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32,
-/* 0x46f0 */  48, 32, 78, 50, 69, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4700 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x4710 */  65, 83, 51, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48, 10,
-/* 0x4720 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4730 */  32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 69, 83,
-/* 0x4740 */  77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4750 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 48,
-/* 0x4760 */  32, 78, 50, 69, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4770 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77,
-/* 0x4780 */  65, 53, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 53, 48, 10, 48,
-/* 0x4790 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x47a0 */  78, 50, 69, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 69, 70, 65,
-/* 0x47b0 */  83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x47c0 */  32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 48, 32,
-/* 0x47d0 */  78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x47e0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x47f0 */  54, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54, 48, 10, 48, 48,
-/* 0x4800 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4810 */  90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 48, 32, 76, 90, 77, 65,
-/* 0x4820 */  95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4830 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x4840 */  48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10,
-/* 0x4850 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4860 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90,
-/* 0x4870 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4880 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x4890 */  69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x48a0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x48b0 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32,
-/* 0x48c0 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x48d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76,
-/* 0x48e0 */  69, 86, 69, 49, 32, 48, 32, 67, 84, 67, 76, 69, 86, 69, 49, 10,
-/* 0x48f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4900 */  32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 48, 32, 67, 65, 76, 76,
-/* 0x4910 */  84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4920 */  32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 48,
-/* 0x4930 */  32, 67, 84, 66, 83, 72, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4940 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79,
-/* 0x4950 */  82, 48, 49, 32, 48, 32, 67, 84, 66, 82, 79, 82, 48, 49, 10, 48,
-/* 0x4960 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4970 */  67, 84, 66, 83, 87, 65, 48, 49, 32, 48, 32, 67, 84, 66, 83, 87,
-/* 0x4980 */  65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4990 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 48, 32,
-/* 0x49a0 */  67, 65, 76, 76, 84, 82, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x49b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x49c0 */  69, 56, 32, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 10, 48, 48,
-/* 0x49d0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x49e0 */  65, 76, 76, 84, 82, 69, 57, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x49f0 */  69, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4a00 */  32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 48, 32, 67,
-/* 0x4a10 */  84, 67, 76, 69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a20 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x4a30 */  50, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 50, 10, 48, 48, 48,
-/* 0x4a40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x4a50 */  66, 83, 72, 82, 49, 49, 32, 48, 32, 67, 84, 66, 83, 72, 82, 49,
-/* 0x4a60 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4a70 */ 100, 32, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 48, 32, 67, 84,
-/* 0x4a80 */  66, 82, 79, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4a90 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 49, 49,
-/* 0x4aa0 */  32, 48, 32, 67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48, 48, 48,
-/* 0x4ab0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88,
-/* 0x4ac0 */  69, 67, 48, 49, 53, 32, 48, 32, 76, 69, 88, 69, 67, 48, 49, 53,
-/* 0x4ad0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4ae0 */  32, 32, 76, 88, 85, 78, 70, 48, 48, 48, 32, 48, 32, 76, 88, 85,
-/* 0x4af0 */  78, 70, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4b00 */  32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 48, 50, 32,
-/* 0x4b10 */  48, 32, 76, 88, 85, 78, 70, 48, 48, 50, 10, 48, 48, 48, 48, 48,
-/* 0x4b20 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66,
-/* 0x4b30 */  89, 84, 69, 48, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 48, 10,
-/* 0x4b40 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4b50 */  32, 76, 88, 77, 82, 85, 48, 48, 53, 32, 48, 32, 76, 88, 77, 82,
-/* 0x4b60 */  85, 48, 48, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4b70 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 48, 54, 32, 48,
-/* 0x4b80 */  32, 76, 88, 77, 82, 85, 48, 48, 54, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4b90 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x4ba0 */  48, 48, 55, 32, 48, 32, 76, 88, 77, 82, 85, 48, 48, 55, 10, 48,
-/* 0x4bb0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4bc0 */  76, 88, 85, 78, 70, 48, 48, 56, 32, 48, 32, 76, 88, 85, 78, 70,
-/* 0x4bd0 */  48, 48, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4be0 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 52, 53, 32, 48, 32,
-/* 0x4bf0 */  76, 88, 77, 82, 85, 48, 52, 53, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4c10 */  52, 54, 32, 48, 32, 76, 88, 77, 82, 85, 48, 52, 54, 10, 48, 48,
-/* 0x4c20 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4c30 */  88, 74, 67, 67, 48, 50, 48, 32, 48, 32, 76, 88, 74, 67, 67, 48,
-/* 0x4c40 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4c50 */  32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 49, 32, 48, 32, 76,
-/* 0x4c60 */  88, 74, 67, 67, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4c70 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50,
-/* 0x4c80 */  51, 32, 48, 32, 76, 88, 74, 67, 67, 48, 50, 51, 10, 48, 48, 48,
-/* 0x4c90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x4ca0 */  85, 78, 70, 51, 56, 54, 32, 48, 32, 76, 88, 85, 78, 70, 51, 56,
-/* 0x4cb0 */  54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4cc0 */ 100, 32, 32, 76, 88, 85, 78, 70, 51, 56, 55, 32, 48, 32, 76, 88,
-/* 0x4cd0 */  85, 78, 70, 51, 56, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4ce0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51, 56, 56,
-/* 0x4cf0 */  32, 48, 32, 76, 88, 85, 78, 70, 51, 56, 56, 10, 48, 48, 48, 48,
-/* 0x4d00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x4d10 */  78, 70, 52, 56, 54, 32, 48, 32, 76, 88, 85, 78, 70, 52, 56, 54,
-/* 0x4d20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4d30 */  32, 32, 76, 88, 85, 78, 70, 52, 56, 55, 32, 48, 32, 76, 88, 85,
-/* 0x4d40 */  78, 70, 52, 56, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4d50 */  32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 54, 53, 32,
-/* 0x4d60 */  48, 32, 76, 88, 77, 82, 85, 48, 54, 53, 10, 48, 48, 48, 48, 48,
-/* 0x4d70 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66,
-/* 0x4d80 */  89, 84, 69, 51, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 51, 10,
-/* 0x4d90 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4da0 */  32, 77, 82, 85, 65, 82, 66, 51, 48, 32, 48, 32, 77, 82, 85, 65,
-/* 0x4db0 */  82, 66, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4dc0 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 51, 32, 48,
-/* 0x4dd0 */  32, 77, 82, 85, 66, 73, 84, 83, 51, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4de0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82,
-/* 0x4df0 */  66, 52, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 52, 48, 10, 48,
-/* 0x4e00 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4e10 */  77, 82, 85, 66, 89, 84, 69, 52, 32, 48, 32, 77, 82, 85, 66, 89,
-/* 0x4e20 */  84, 69, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4e30 */  32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 52, 32, 48, 32,
-/* 0x4e40 */  77, 82, 85, 66, 73, 84, 83, 52, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e50 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66,
-/* 0x4e60 */  53, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 53, 48, 10, 48, 48,
-/* 0x4e70 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4e80 */  88, 77, 82, 85, 48, 56, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4e90 */  56, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4ea0 */  32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 53, 32, 48, 32, 77,
-/* 0x4eb0 */  82, 85, 66, 89, 84, 69, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ec0 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 54,
-/* 0x4ed0 */  48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 54, 48, 10, 48, 48, 48,
-/* 0x4ee0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x4ef0 */  85, 66, 73, 84, 83, 53, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x4f00 */  53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4f10 */ 100, 32, 32, 77, 82, 85, 65, 82, 66, 55, 48, 32, 48, 32, 77, 82,
-/* 0x4f20 */  85, 65, 82, 66, 55, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4f30 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 57, 48,
-/* 0x4f40 */  32, 48, 32, 76, 88, 77, 82, 85, 48, 57, 48, 10, 48, 48, 48, 48,
-/* 0x4f50 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x4f60 */  66, 89, 84, 69, 54, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 54,
-/* 0x4f70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4f80 */  32, 32, 77, 82, 85, 65, 82, 66, 56, 48, 32, 48, 32, 77, 82, 85,
-/* 0x4f90 */  65, 82, 66, 56, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4fa0 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 54, 32,
-/* 0x4fb0 */  48, 32, 77, 82, 85, 66, 73, 84, 83, 54, 10, 48, 48, 48, 48, 48,
-/* 0x4fc0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65,
-/* 0x4fd0 */  82, 66, 57, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 57, 48, 10,
-/* 0x4fe0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4ff0 */  32, 76, 88, 77, 82, 85, 49, 49, 48, 32, 48, 32, 76, 88, 77, 82,
-/* 0x5000 */  85, 49, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5010 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 49, 49, 49, 32, 48,
-/* 0x5020 */  32, 76, 88, 77, 82, 85, 49, 49, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5030 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70,
-/* 0x5040 */  48, 52, 49, 32, 48, 32, 76, 88, 85, 78, 70, 48, 52, 49, 10, 48,
-/* 0x5050 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5060 */  76, 69, 88, 69, 67, 48, 49, 54, 32, 48, 32, 76, 69, 88, 69, 67,
-/* 0x5070 */  48, 49, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5080 */  32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 49, 48, 32, 48, 32,
-/* 0x5090 */  76, 88, 77, 82, 85, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x50a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 77, 80, 65,
-/* 0x50b0 */  48, 48, 32, 48, 32, 76, 88, 74, 77, 80, 65, 48, 48, 10, 48, 48,
-/* 0x50c0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x50d0 */  88, 67, 65, 76, 76, 66, 48, 32, 48, 32, 76, 88, 67, 65, 76, 76,
-/* 0x50e0 */  66, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x50f0 */  32,100, 32, 32, 76, 88, 85, 78, 70, 48, 50, 49, 32, 48, 32, 76,
-/* 0x5100 */  88, 85, 78, 70, 48, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5110 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 50,
-/* 0x5120 */  50, 32, 48, 32, 76, 88, 77, 82, 85, 48, 50, 50, 10, 48, 48, 48,
-/* 0x5130 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x5140 */  74, 77, 80, 65, 48, 49, 32, 48, 32, 76, 88, 74, 77, 80, 65, 48,
-/* 0x5150 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5160 */ 100, 32, 32, 76, 88, 67, 65, 76, 76, 66, 49, 32, 48, 32, 76, 88,
-/* 0x5170 */  67, 65, 76, 76, 66, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5180 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 49,
-/* 0x5190 */  32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 49, 10, 48, 48, 48, 48,
-/* 0x51a0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x51b0 */  66, 89, 84, 69, 49, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 49,
-/* 0x51c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x51d0 */  32, 32, 77, 82, 85, 65, 82, 66, 49, 48, 32, 48, 32, 77, 82, 85,
-/* 0x51e0 */  65, 82, 66, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x51f0 */  32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 52, 48, 32,
-/* 0x5200 */  48, 32, 76, 88, 77, 82, 85, 48, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5210 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67,
-/* 0x5220 */  67, 48, 48, 48, 32, 48, 32, 76, 88, 74, 67, 67, 48, 48, 48, 10,
-/* 0x5230 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5240 */  32, 76, 88, 67, 74, 48, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74,
-/* 0x5250 */  48, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5260 */  32, 32, 32,100, 32, 32, 76, 88, 67, 74, 49, 77, 82, 85, 32, 48,
-/* 0x5270 */  32, 76, 88, 67, 74, 49, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5280 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76,
-/* 0x5290 */  74, 77, 80, 32, 48, 32, 76, 88, 67, 65, 76, 74, 77, 80, 10, 48,
-/* 0x52a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x52b0 */  76, 88, 67, 65, 76, 76, 48, 48, 32, 48, 32, 76, 88, 67, 65, 76,
-/* 0x52c0 */  76, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x52d0 */  32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 48, 49, 32, 48, 32,
-/* 0x52e0 */  76, 88, 67, 65, 76, 76, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x52f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 50, 77,
-/* 0x5300 */  82, 85, 32, 48, 32, 76, 88, 67, 74, 50, 77, 82, 85, 10, 48, 48,
-/* 0x5310 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x5320 */  88, 67, 74, 52, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 52, 77,
-/* 0x5330 */  82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5340 */  32,100, 32, 32, 76, 88, 67, 74, 54, 77, 82, 85, 32, 48, 32, 76,
-/* 0x5350 */  88, 67, 74, 54, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5360 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 55, 77, 82,
-/* 0x5370 */  85, 32, 48, 32, 76, 88, 67, 74, 55, 77, 82, 85, 10, 48, 48, 48,
-/* 0x5380 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x5390 */  77, 82, 85, 48, 53, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48, 53,
-/* 0x53a0 */  53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x53b0 */ 100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 50, 32, 48, 32, 77, 82,
-/* 0x53c0 */  85, 66, 89, 84, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x53d0 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 50,
-/* 0x53e0 */  32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 50, 10, 48, 48, 48, 48,
-/* 0x53f0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x5400 */  65, 82, 66, 50, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 50, 48,
-/* 0x5410 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5420 */  32, 32, 76, 88, 77, 82, 85, 48, 53, 55, 32, 48, 32, 76, 88, 77,
-/* 0x5430 */  82, 85, 48, 53, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5440 */  32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 53, 56, 32,
-/* 0x5450 */  48, 32, 76, 88, 77, 82, 85, 48, 53, 56, 10, 48, 48, 48, 48, 48,
-/* 0x5460 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x5470 */  70, 48, 51, 53, 32, 48, 32, 76, 88, 85, 78, 70, 48, 51, 53, 10,
-/* 0x5480 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5490 */  32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 48, 32, 99,116,111,
-/* 0x54a0 */ 107, 51, 50, 46, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x54b0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 55,
-/* 0x54c0 */  32, 48, 32, 76, 69, 88, 69, 67, 48, 49, 55, 10, 48, 48, 48, 48,
-/* 0x54d0 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 69, 88,
-/* 0x54e0 */  69, 67, 48, 48, 48, 32, 48, 32, 95,115,116, 97,114,116, 10, 48,
-/* 0x54f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5500 */  42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,115,116, 97,
-/* 0x5510 */  99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5520 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x5530 */  32, 48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48,
-/* 0x5540 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x5550 */  85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95, 99, 95,108,101,
-/* 0x5560 */ 110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x5570 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,
-/* 0x5580 */ 112,114,111,112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48,
-/* 0x5590 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x55a0 */  42, 32, 48, 32,102,105,108,116,101,114, 95,108,101,110,103,116,
-/* 0x55b0 */ 104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x55c0 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,
-/* 0x55d0 */ 114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x55e0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 78,
-/* 0x55f0 */  77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x5600 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 79, 95, 66,
-/* 0x5610 */  73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5620 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 69,
-/* 0x5630 */  88, 69, 67, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5640 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5650 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5660 */  48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x5670 */  32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48, 50, 48, 10, 10, 82,
-/* 0x5680 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5690 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 49, 48, 93,
-/* 0x56a0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x56b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x56c0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x56d0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x56e0 */  66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x56f0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5700 */  78, 50, 66, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5710 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5720 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5730 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5740 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10,
-/* 0x5750 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5760 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 50,
-/* 0x5770 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5780 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5790 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x57a0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57b0 */  78, 50, 66, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x57c0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x57d0 */  32, 91, 78, 50, 66, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70,
-/* 0x57e0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x57f0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5800 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5810 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 49,
-/* 0x5820 */  49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5830 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77,
-/* 0x5840 */  65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5850 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5860 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32,
-/* 0x5870 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5880 */  32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5890 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x58a0 */  79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 51, 48, 93, 58, 10, 79,
-/* 0x58b0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x58c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x58d0 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x58e0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x58f0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51,
-/* 0x5900 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5910 */  50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5920 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5930 */  91, 78, 50, 66, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5940 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5950 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5960 */  48, 48, 48, 49, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5970 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48,
-/* 0x5980 */  10, 48, 48, 48, 48, 48, 48, 50,102, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5990 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x59a0 */  69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x59b0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x59c0 */  66, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x59d0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59e0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x59f0 */  48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5a00 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x5a10 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5a20 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 52, 48, 93,
-/* 0x5a30 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5a40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5a50 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56,
-/* 0x5a60 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5a70 */  66, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32,
-/* 0x5a80 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a90 */  32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5aa0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5ab0 */  79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 54, 48, 93, 58, 10, 79,
-/* 0x5ac0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5ad0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5ae0 */  48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5af0 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x5b00 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5b10 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x5b20 */  70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5b30 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b40 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5b50 */  97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5b60 */  32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48,
-/* 0x5b70 */  48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,
-/* 0x5b80 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x5b90 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5ba0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83,
-/* 0x5bb0 */  54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5bc0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5bd0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82,
-/* 0x5be0 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5bf0 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5c00 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5c10 */  82, 32, 91, 78, 50, 68, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70,
-/* 0x5c20 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5c30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5c40 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5c50 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x5c60 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5c70 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70,
-/* 0x5c80 */  65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5c90 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ca0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5cb0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5cc0 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x5cd0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5ce0 */  70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 50, 48, 93, 58, 10,
-/* 0x5cf0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5d00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5d10 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5d20 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 83,
-/* 0x5d30 */  77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5d40 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5d50 */  68, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5d60 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d70 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5d80 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5d90 */  32, 32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 10, 82,
-/* 0x5da0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5db0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 51, 48, 93,
-/* 0x5dc0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5dd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5de0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56,
-/* 0x5df0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5e00 */  68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5e10 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5e20 */  78, 50, 68, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5e30 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e40 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5e50 */  48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5e60 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10,
-/* 0x5e70 */  48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5e80 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x5e90 */  67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5ea0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x5eb0 */  68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5ec0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ed0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5ee0 */ 102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5ef0 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x5f00 */  48, 48, 48, 50, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5f10 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48,
-/* 0x5f20 */  10, 48, 48, 48, 48, 48, 48, 52, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5f30 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x5f40 */  69, 67, 53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5f50 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5f60 */  68, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5f70 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f80 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5f90 */  48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5fa0 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x5fb0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5fc0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 52, 48, 93,
-/* 0x5fd0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5fe0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5ff0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56,
-/* 0x6000 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x6010 */  68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32,
-/* 0x6020 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6030 */  32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79,
-/* 0x6040 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6050 */  79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 54, 48, 93, 58, 10, 79,
-/* 0x6060 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6070 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6080 */  48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6090 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x60a0 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x60b0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x60c0 */  70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x60d0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x60e0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x60f0 */  97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6100 */  32, 32, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48,
-/* 0x6110 */  48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,
-/* 0x6120 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48,
-/* 0x6130 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6140 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83,
-/* 0x6150 */  54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6160 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6170 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82,
-/* 0x6180 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6190 */  32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x61a0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x61b0 */  82, 32, 91, 78, 50, 69, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70,
-/* 0x61c0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x61d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x61e0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x61f0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x6200 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6210 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70,
-/* 0x6220 */  65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6230 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6240 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x6250 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6260 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x6270 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6280 */  70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 50, 48, 93, 58, 10,
-/* 0x6290 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x62a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x62b0 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x62c0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 83,
-/* 0x62d0 */  77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x62e0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x62f0 */  69, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6300 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6310 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6320 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6330 */  32, 32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 10, 82,
-/* 0x6340 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6350 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 51, 48, 93,
-/* 0x6360 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6370 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6380 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56,
-/* 0x6390 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x63a0 */  69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x63b0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x63c0 */  78, 50, 69, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x63d0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63e0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x63f0 */  48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6400 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10,
-/* 0x6410 */  48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6420 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x6430 */  67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6440 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x6450 */  68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6460 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6470 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6480 */ 102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6490 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x64a0 */  48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x64b0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48,
-/* 0x64c0 */  10, 48, 48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 51, 56, 54, 95,
-/* 0x64d0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x64e0 */  69, 67, 54, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x64f0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x6500 */  69, 83, 77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6510 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6520 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6530 */  48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6540 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x6550 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6560 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 52, 48, 93,
-/* 0x6570 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6580 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6590 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56,
-/* 0x65a0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x65b0 */  69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32,
-/* 0x65c0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65d0 */  32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79,
-/* 0x65e0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x65f0 */  79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 54, 48, 93, 58, 10, 79,
-/* 0x6600 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6610 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6620 */  48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6630 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x6640 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6650 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x6660 */  70, 65, 83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6670 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6680 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6690 */  97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x66a0 */  32, 32, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48,
-/* 0x66b0 */  48, 48, 48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,
-/* 0x66c0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48,
-/* 0x66d0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x66e0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83,
-/* 0x66f0 */  54, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6700 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6710 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82,
-/* 0x6720 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6730 */  32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6740 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6750 */  82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10,
-/* 0x6760 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6770 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6780 */  10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6790 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97,
-/* 0x67a0 */  95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48,
-/* 0x67b0 */  48, 48, 48, 48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x67c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,
-/* 0x67d0 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51,
-/* 0x67e0 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x67f0 */ 122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6800 */  50, 97, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x6810 */  32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,101,114,
-/* 0x6820 */ 116,105,101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6830 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65,
-/* 0x6840 */  76, 76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6850 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6860 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6870 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x6880 */  32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,
-/* 0x6890 */ 116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x68a0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76,
-/* 0x68b0 */  69, 86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x68c0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x68d0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x68e0 */  32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x68f0 */  32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48,
-/* 0x6900 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6910 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48,
-/* 0x6920 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6930 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84,
-/* 0x6940 */  82, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6950 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6960 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32,
-/* 0x6970 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6980 */  32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79,
-/* 0x6990 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x69a0 */  79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10, 79,
-/* 0x69b0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x69c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x69d0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x69e0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x69f0 */ 114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6a00 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6a10 */  32, 91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70, 70,
-/* 0x6a20 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6a30 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6a40 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6a50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x6a60 */  51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6a70 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69,
-/* 0x6a80 */  86, 69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6a90 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6aa0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x6ab0 */  82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ac0 */  32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48,
-/* 0x6ad0 */  48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6ae0 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49,
-/* 0x6af0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6b00 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x6b10 */  49, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6b20 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6b30 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x6b40 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6b50 */  32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6b60 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6b70 */  82, 32, 91, 76, 88, 85, 78, 70, 48, 48, 48, 93, 58, 10, 79, 70,
-/* 0x6b80 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6b90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6ba0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6bb0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x6bc0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6bd0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82,
-/* 0x6be0 */  85, 48, 48, 53, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6bf0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c00 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x6c10 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c20 */  32, 32, 32, 78, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x6c30 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x6c40 */  91, 76, 88, 85, 78, 70, 48, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6c50 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c60 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6c70 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,
-/* 0x6c80 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 50,
-/* 0x6c90 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6ca0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48,
-/* 0x6cb0 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6cc0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6cd0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x6ce0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6cf0 */  32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6d00 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6d10 */  82, 32, 91, 76, 88, 74, 67, 67, 48, 50, 49, 93, 58, 10, 79, 70,
-/* 0x6d20 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6d30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6d40 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6d50 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x6d60 */  51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6d70 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78,
-/* 0x6d80 */  70, 51, 56, 56, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6d90 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6da0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x6db0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6dc0 */  32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76,
-/* 0x6dd0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6de0 */  70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 52, 56, 55, 93, 58, 10,
-/* 0x6df0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6e00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6e10 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6e20 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78,
-/* 0x6e30 */  70, 48, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6e40 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0x6e50 */  77, 82, 85, 48, 54, 53, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6e60 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e70 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6e80 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6e90 */  32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48, 55, 48, 10, 10, 82,
-/* 0x6ea0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6eb0 */  83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 55, 48, 93,
-/* 0x6ec0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6ed0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6ee0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56,
-/* 0x6ef0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x6f00 */  85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6f10 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6f20 */  76, 88, 77, 82, 85, 48, 57, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6f30 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f40 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6f50 */  48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6f60 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 49, 48, 48, 10,
-/* 0x6f70 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6f80 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 52,
-/* 0x6f90 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6fa0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6fb0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95,
-/* 0x6fc0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6fd0 */  76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6fe0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6ff0 */  32, 91, 76, 69, 88, 69, 67, 48, 49, 54, 93, 58, 10, 79, 70, 70,
-/* 0x7000 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7010 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7020 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x7030 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52,
-/* 0x7040 */  50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7050 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85,
-/* 0x7060 */  48, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7070 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7080 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x7090 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x70a0 */  32, 32, 76, 88, 77, 82, 85, 48, 51, 48, 10, 10, 82, 69, 76, 79,
-/* 0x70b0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x70c0 */  79, 82, 32, 91, 76, 88, 74, 67, 67, 48, 48, 48, 93, 58, 10, 79,
-/* 0x70d0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x70e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x70f0 */  48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7100 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 74, 67, 67,
-/* 0x7110 */  48, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x7120 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67,
-/* 0x7130 */  65, 76, 76, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7140 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7150 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7160 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7170 */  32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69,
-/* 0x7180 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7190 */  32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 50, 77, 82, 85, 93, 58,
-/* 0x71a0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x71b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x71c0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x71d0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85,
-/* 0x71e0 */  78, 70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x71f0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x7200 */  88, 67, 74, 52, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7210 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7220 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7230 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x7240 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10,
-/* 0x7250 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x7260 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 54, 77, 82, 85,
-/* 0x7270 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7280 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7290 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x72a0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x72b0 */  88, 67, 74, 56, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x72c0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x72d0 */  91, 76, 88, 67, 74, 55, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83,
-/* 0x72e0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x72f0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x7300 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x7310 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85,
-/* 0x7320 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x7330 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 56, 77,
-/* 0x7340 */  82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x7350 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7360 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x7370 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7380 */  32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7390 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x73a0 */  82, 32, 91, 76, 88, 85, 78, 70, 48, 51, 52, 93, 58, 10, 79, 70,
-/* 0x73b0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x73c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x73d0 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x73e0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x73f0 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7400 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107,
-/* 0x7410 */  51, 50, 46, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7420 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7430 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7440 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7450 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82,
-/* 0x7460 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7470 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48,
-/* 0x7480 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7490 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x74a0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51,
-/* 0x74b0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x74c0 */ 116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x74d0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x74e0 */  32, 91, 99,116,111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70,
-/* 0x74f0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7500 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7510 */  48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7520 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50,
-/* 0x7530 */  46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x7540 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x7550 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x7560 */  48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7570 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 10, 82,
-/* 0x7580 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7590 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 51, 48,
-/* 0x75a0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x75b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x75c0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x75d0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x75e0 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x75f0 */  57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7600 */  32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 10, 82,
-/* 0x7610 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7620 */  83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x7630 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7640 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7650 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x7660 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x7670 */ 116,111,107, 51, 50, 46, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7680 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7690 */  32, 91, 76, 69, 88, 69, 67, 48, 50, 48, 93, 58, 10, 79, 70, 70,
-/* 0x76a0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x76b0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x76c0 */  48, 48, 48, 48, 97, 55, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x76d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79,
-/* 0x76e0 */  10
+/* 0x1b60 */   0,  0,  0,  0,168,  0,  0,  0,177,  0,  0,  0, 94,  0,  0,  0,
+/* 0x1b70 */ 130,  6,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0,  9,  0,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b90 */   0,  0,  0,  0, 18,  0,  0,  0, 58,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1ba0 */   0,  0,  0,  0, 27,  0,  0,  0, 70,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0, 36,  0,  0,  0, 73,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1bc0 */   0,  0,  0,  0, 45,  0,  0,  0, 75,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1bd0 */   0,  0,  0,  0, 54,  0,  0,  0, 81,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1be0 */   0,  0,  0,  0, 63,  0,  0,  0, 92,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1bf0 */   0,  0,  0,  0, 72,  0,  0,  0, 97,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1c00 */   0,  0,  0,  0, 81,  0,  0,  0,106,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0, 90,  0,  0,  0,119,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0, 99,  0,  0,  0,132,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c30 */   0,  0,  0,  0,108,  0,  0,  0,147,  0,  0,  0, 62,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0,117,  0,  0,  0,209,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0,126,  0,  0,  0,222,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c60 */   0,  0,  0,  0,135,  0,  0,  0,237,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0,144,  0,  0,  0,239,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0,153,  0,  0,  0,242,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1c90 */   0,  0,  0,  0,162,  0,  0,  0,251,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0,171,  0,  0,  0,  7,  1,  0,  0, 25,  0,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0,180,  0,  0,  0, 32,  1,  0,  0, 22,  0,  0,  0,
+/* 0x1cc0 */   0,  0,  0,  0,189,  0,  0,  0, 54,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,198,  0,  0,  0, 54,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,207,  0,  0,  0, 57,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1cf0 */   0,  0,  0,  0,216,  0,  0,  0, 59,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,225,  0,  0,  0, 65,  1,  0,  0, 11,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,234,  0,  0,  0, 76,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1d20 */   0,  0,  0,  0,243,  0,  0,  0, 81,  1,  0,  0,  9,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,252,  0,  0,  0, 90,  1,  0,  0, 13,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,  5,  1,  0,  0,103,  1,  0,  0, 13,  0,  0,  0,
+/* 0x1d50 */   0,  0,  0,  0, 14,  1,  0,  0,116,  1,  0,  0, 15,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0, 23,  1,  0,  0,131,  1,  0,  0, 82,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0, 32,  1,  0,  0,213,  1,  0,  0, 13,  0,  0,  0,
+/* 0x1d80 */   0,  0,  0,  0, 41,  1,  0,  0,226,  1,  0,  0, 15,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0, 50,  1,  0,  0,241,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0, 59,  1,  0,  0,243,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1db0 */   0,  0,  0,  0, 68,  1,  0,  0,246,  1,  0,  0,  9,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0, 77,  1,  0,  0,255,  1,  0,  0, 12,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0, 86,  1,  0,  0, 11,  2,  0,  0, 25,  0,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0, 95,  1,  0,  0, 36,  2,  0,  0, 22,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0,104,  1,  0,  0, 58,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,113,  1,  0,  0, 58,  2,  0,  0,  3,  0,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0,122,  1,  0,  0, 61,  2,  0,  0,  2,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,131,  1,  0,  0, 63,  2,  0,  0,  6,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,140,  1,  0,  0, 69,  2,  0,  0, 11,  0,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0,149,  1,  0,  0, 80,  2,  0,  0,  5,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,158,  1,  0,  0, 85,  2,  0,  0,  9,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,167,  1,  0,  0, 94,  2,  0,  0, 13,  0,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0,176,  1,  0,  0,107,  2,  0,  0, 13,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0,185,  1,  0,  0,120,  2,  0,  0, 15,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,194,  1,  0,  0,135,  2,  0,  0, 95,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0,203,  1,  0,  0,230,  2,  0,  0, 13,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,212,  1,  0,  0,243,  2,  0,  0, 15,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,221,  1,  0,  0,  2,  3,  0,  0,  2,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,230,  1,  0,  0,  4,  3,  0,  0,  3,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,239,  1,  0,  0,  7,  3,  0,  0,  9,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,248,  1,  0,  0, 16,  3,  0,  0, 12,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0,  1,  2,  0,  0, 28,  3,  0,  0, 25,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0, 10,  2,  0,  0, 53,  3,  0,  0, 22,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0, 19,  2,  0,  0, 75,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0, 28,  2,  0,  0, 75,  3,  0,  0, 46,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0, 39,  2,  0,  0,121,  3,  0,  0, 72,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0, 50,  2,  0,  0,193,  3,  0,  0,134, 10,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0, 61,  2,  0,  0, 71, 14,  0,  0,134, 10,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0, 72,  2,  0,  0,205, 24,  0,  0, 26,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0, 83,  2,  0,  0,231, 24,  0,  0, 14,  0,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0, 92,  2,  0,  0,245, 24,  0,  0,  5,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,101,  2,  0,  0,250, 24,  0,  0,  5,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,110,  2,  0,  0,255, 24,  0,  0,  4,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0,119,  2,  0,  0,  3, 25,  0,  0,  2,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,128,  2,  0,  0,  5, 25,  0,  0,  5,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,137,  2,  0,  0, 10, 25,  0,  0, 14,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0,146,  2,  0,  0, 24, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,155,  2,  0,  0, 29, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,164,  2,  0,  0, 31, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0,173,  2,  0,  0, 33, 25,  0,  0,  4,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0,182,  2,  0,  0, 37, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,191,  2,  0,  0, 42, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,200,  2,  0,  0, 44, 25,  0,  0,  4,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,209,  2,  0,  0, 48, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,218,  2,  0,  0, 50, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,227,  2,  0,  0, 55, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,236,  2,  0,  0, 60, 25,  0,  0, 29,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,245,  2,  0,  0, 89, 25,  0,  0,  2,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,254,  2,  0,  0, 91, 25,  0,  0,  5,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,  7,  3,  0,  0, 96, 25,  0,  0,  2,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0, 16,  3,  0,  0, 98, 25,  0,  0,  5,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0, 25,  3,  0,  0,103, 25,  0,  0,  7,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0, 34,  3,  0,  0,110, 25,  0,  0,  7,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0, 43,  3,  0,  0,117, 25,  0,  0,  4,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,  0, 52,  3,  0,  0,121, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0, 61,  3,  0,  0,126, 25,  0,  0,  3,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0, 70,  3,  0,  0,129, 25,  0,  0,  3,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,  0, 79,  3,  0,  0,132, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0, 88,  3,  0,  0,134, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0, 97,  3,  0,  0,136, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  0,106,  3,  0,  0,141, 25,  0,  0,  7,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,115,  3,  0,  0,148, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,124,  3,  0,  0,150, 25,  0,  0,  1,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0,133,  3,  0,  0,151, 25,  0,  0,  9,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0,142,  3,  0,  0,160, 25,  0,  0,  3,  0,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0,151,  3,  0,  0,163, 25,  0,  0,  4,  0,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0,160,  3,  0,  0,167, 25,  0,  0,  2,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,169,  3,  0,  0,169, 25,  0,  0,  5,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,178,  3,  0,  0,174, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0,187,  3,  0,  0,176, 25,  0,  0,  1,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,196,  3,  0,  0,177, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,205,  3,  0,  0,179, 25,  0,  0,  4,  0,  0,  0,
+/* 0x2230 */   0,  0,  0,  0,214,  3,  0,  0,183, 25,  0,  0,  8,  0,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,223,  3,  0,  0,191, 25,  0,  0,  3,  0,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,232,  3,  0,  0,194, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2260 */   0,  0,  0,  0,241,  3,  0,  0,196, 25,  0,  0,  6,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,250,  3,  0,  0,202, 25,  0,  0,  3,  0,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,  3,  4,  0,  0,205, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2290 */   0,  0,  0,  0, 12,  4,  0,  0,207, 25,  0,  0,  1,  0,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0, 21,  4,  0,  0,208, 25,  0,  0,  2,  0,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0, 30,  4,  0,  0,210, 25,  0,  0,  4,  0,  0,  0,
+/* 0x22c0 */   0,  0,  0,  0, 39,  4,  0,  0,214, 25,  0,  0, 11,  0,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0, 48,  4,  0,  0,225, 25,  0,  0,  2,  0,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0, 57,  4,  0,  0,227, 25,  0,  0,  1,  0,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0, 66,  4,  0,  0,228, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2300 */   0,  0,  0,  0, 75,  4,  0,  0,230, 25,  0,  0,  4,  0,  0,  0,
+/* 0x2310 */   0,  0,  0,  0, 84,  4,  0,  0,234, 25,  0,  0, 16,  0,  0,  0,
+/* 0x2320 */   0,  0,  0,  0, 93,  4,  0,  0,250, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,102,  4,  0,  0,255, 25,  0,  0,  3,  0,  0,  0,
+/* 0x2340 */   0,  0,  0,  0,111,  4,  0,  0,  2, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2350 */   0,  0,  0,  0,120,  4,  0,  0,  4, 26,  0,  0,  7,  0,  0,  0,
+/* 0x2360 */   0,  0,  0,  0,129,  4,  0,  0, 11, 26,  0,  0,  0,  0,  0,  0,
+/* 0x2370 */   0,  0,  0,  0,138,  4,  0,  0, 11, 26,  0,  0,  5,  0,  0,  0,
+/* 0x2380 */   0,  0,  0,  0,147,  4,  0,  0, 16, 26,  0,  0,  1,  0,  0,  0,
+/* 0x2390 */   0,  0,  0,  0,156,  4,  0,  0, 17, 26,  0,  0,  2,  0,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0,165,  4,  0,  0, 19, 26,  0,  0,  2,  0,  0,  0,
+/* 0x23b0 */   0,  0,  0,  0,174,  4,  0,  0, 21, 26,  0,  0,  6,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0,183,  4,  0,  0, 27, 26,  0,  0,  3,  0,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,192,  4,  0,  0, 30, 26,  0,  0,  2,  0,  0,  0,
+/* 0x23e0 */   0,  0,  0,  0,201,  4,  0,  0, 32, 26,  0,  0,  2,  0,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,210,  4,  0,  0, 34, 26,  0,  0,  1,  0,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,219,  4,  0,  0, 35, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2410 */   0,  0,  0,  0,228,  4,  0,  0, 37, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,237,  4,  0,  0, 39, 26,  0,  0,  1,  0,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,246,  4,  0,  0, 40, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2440 */   0,  0,  0,  0,255,  4,  0,  0, 42, 26,  0,  0,  6,  0,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,  8,  5,  0,  0, 48, 26,  0,  0,  8,  0,  0,  0,
+/* 0x2460 */   0,  0,  0,  0, 17,  5,  0,  0, 56, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2470 */   0,  0,  0,  0, 26,  5,  0,  0, 58, 26,  0,  0,  3,  0,  0,  0,
+/* 0x2480 */   0,  0,  0,  0, 35,  5,  0,  0, 61, 26,  0,  0,  3,  0,  0,  0,
+/* 0x2490 */   0,  0,  0,  0, 44,  5,  0,  0, 64, 26,  0,  0,  2,  0,  0,  0,
+/* 0x24a0 */   0,  0,  0,  0, 53,  5,  0,  0, 66, 26,  0,  0,  3,  0,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0, 62,  5,  0,  0, 69, 26,  0,  0,  2,  0,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0, 71,  5,  0,  0, 71, 26,  0,  0,  2,  0,  0,  0,
+/* 0x24d0 */   0,  0,  0,  0, 80,  5,  0,  0, 73, 26,  0,  0,  2,  0,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0, 89,  5,  0,  0, 75, 26,  0,  0,  2,  0,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0, 98,  5,  0,  0, 77, 26,  0,  0,  3,  0,  0,  0,
+/* 0x2500 */   0,  0,  0,  0,107,  5,  0,  0, 80, 26,  0,  0,  5,  0,  0,  0,
+/* 0x2510 */   0,  0,  0,  0,116,  5,  0,  0, 85, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2520 */   0,  0,  0,  0,125,  5,  0,  0, 87, 26,  0,  0,  5,  0,  0,  0,
+/* 0x2530 */   0,  0,  0,  0,134,  5,  0,  0, 92, 26,  0,  0,  5,  0,  0,  0,
+/* 0x2540 */   0,  0,  0,  0,143,  5,  0,  0, 97, 26,  0,  0,  5,  0,  0,  0,
+/* 0x2550 */   0,  0,  0,  0,152,  5,  0,  0,102, 26,  0,  0,  6,  0,  0,  0,
+/* 0x2560 */   0,  0,  0,  0,161,  5,  0,  0,108, 26,  0,  0,  1,  0,  0,  0,
+/* 0x2570 */   0,  0,  0,  0,170,  5,  0,  0,109, 26,  0,  0,  6,  0,  0,  0,
+/* 0x2580 */   0,  0,  0,  0,179,  5,  0,  0,115, 26,  0,  0,  7,  0,  0,  0,
+/* 0x2590 */   0,  0,  0,  0,189,  5,  0,  0,122, 26,  0,  0, 14,  0,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,199,  5,  0,  0,136, 26,  0,  0, 32,  0,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,209,  5,  0,  0,168, 26,  0,  0, 10,  0,  0,  0,
+/* 0x25c0 */   0,  0,  0,  0,219,  5,  0,  0,178, 26,  0,  0,  5,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,229,  5,  0,  0,183, 26,  0,  0,  2,  0,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,238,  5,  0,  0,185, 26,  0,  0,171,  0,  0,  0,
+/* 0x25f0 */   0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2600 */  45,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x2610 */   6,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2620 */   0,  0,  0,  0,108,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2630 */ 153,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,
+/* 0x2640 */  20,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 21,  0,  0,  0,
+/* 0x2650 */   0,  0,  0,  0,198,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2660 */ 216,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0,
+/* 0x2670 */  25,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 28,  0,  0,  0,
+/* 0x2680 */   0,  0,  0,  0, 23,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2690 */  68,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0,
+/* 0x26a0 */  39,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 40,  0,  0,  0,
+/* 0x26b0 */   0,  0,  0,  0,113,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26c0 */ 131,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0,
+/* 0x26d0 */  44,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 47,  0,  0,  0,
+/* 0x26e0 */   0,  0,  0,  0,194,  1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26f0 */ 239,  1,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0,
+/* 0x2700 */  58,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 59,  0,  0,  0,
+/* 0x2710 */   0,  0,  0,  0, 83,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2720 */ 146,  2,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,173,  2,  0,  0,
+/* 0x2730 */  75,  0,  0,  0,  0,  0,  0,  0,227,  2,  0,  0, 81,  0,  0,  0,
+/* 0x2740 */   0,  0,  0,  0, 52,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2750 */  61,  3,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,115,  3,  0,  0,
+/* 0x2760 */  97,  0,  0,  0,  0,  0,  0,  0,214,  3,  0,  0,108,  0,  0,  0,
+/* 0x2770 */   0,  0,  0,  0, 84,  4,  0,  0,122,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2780 */  93,  4,  0,  0,123,  0,  0,  0,  0,  0,  0,  0,129,  4,  0,  0,
+/* 0x2790 */ 127,  0,  0,  0,  0,  0,  0,  0,219,  4,  0,  0,137,  0,  0,  0,
+/* 0x27a0 */   0,  0,  0,  0,255,  4,  0,  0,141,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27b0 */  98,  5,  0,  0,152,  0,  0,  0,  0,  0,  0,  0,107,  5,  0,  0,
+/* 0x27c0 */ 153,  0,  0,  0,  0,  0,  0,  0,179,  5,  0,  0,161,  0,  0,  0,
+/* 0x27d0 */   0,  0,  0,  0,189,  5,  0,  0,162,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27e0 */ 199,  5,  0,  0,163,  0,  0,  0,  0,  0,  0,  0,219,  5,  0,  0,
+/* 0x27f0 */ 165,  0,  0,  0,  0,  0,  0,  0,238,  5,  0,  0,167,  0,  0,  0,
+/* 0x2800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2810 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2820 */   2,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2830 */   0,  0,  0,  0, 63,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2840 */  72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x2850 */  10,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2860 */   0,  0,  0,  0,117,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2870 */ 126,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0,
+/* 0x2880 */  15,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0, 16,  0,  0,  0,
+/* 0x2890 */   0,  0,  0,  0,162,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28a0 */ 171,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0,
+/* 0x28b0 */  23,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 26,  0,  0,  0,
+/* 0x28c0 */   0,  0,  0,  0,243,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28d0 */   5,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0,
+/* 0x28e0 */  30,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0, 32,  0,  0,  0,
+/* 0x28f0 */   0,  0,  0,  0, 41,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2900 */  50,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,
+/* 0x2910 */  35,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0, 37,  0,  0,  0,
+/* 0x2920 */   0,  0,  0,  0, 86,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2930 */ 122,  1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0,
+/* 0x2940 */  45,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 46,  0,  0,  0,
+/* 0x2950 */   0,  0,  0,  0,176,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2960 */ 185,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0,
+/* 0x2970 */  51,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0, 52,  0,  0,  0,
+/* 0x2980 */   0,  0,  0,  0,221,  1,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2990 */ 230,  1,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0,
+/* 0x29a0 */  56,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 57,  0,  0,  0,
+/* 0x29b0 */   0,  0,  0,  0, 28,  2,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29c0 */  39,  2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0, 50,  2,  0,  0,
+/* 0x29d0 */  62,  0,  0,  0,  0,  0,  0,  0, 61,  2,  0,  0, 63,  0,  0,  0,
+/* 0x29e0 */   0,  0,  0,  0, 72,  2,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29f0 */  92,  2,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,101,  2,  0,  0,
+/* 0x2a00 */  67,  0,  0,  0,  0,  0,  0,  0,110,  2,  0,  0, 68,  0,  0,  0,
+/* 0x2a10 */   0,  0,  0,  0,119,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a20 */ 128,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,137,  2,  0,  0,
+/* 0x2a30 */  71,  0,  0,  0,  0,  0,  0,  0,155,  2,  0,  0, 73,  0,  0,  0,
+/* 0x2a40 */   0,  0,  0,  0,164,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a50 */ 182,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,191,  2,  0,  0,
+/* 0x2a60 */  77,  0,  0,  0,  0,  0,  0,  0,200,  2,  0,  0, 78,  0,  0,  0,
+/* 0x2a70 */   0,  0,  0,  0,209,  2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a80 */ 218,  2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,236,  2,  0,  0,
+/* 0x2a90 */  82,  0,  0,  0,  0,  0,  0,  0,245,  2,  0,  0, 83,  0,  0,  0,
+/* 0x2aa0 */   0,  0,  0,  0,254,  2,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ab0 */   7,  3,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0, 16,  3,  0,  0,
+/* 0x2ac0 */  86,  0,  0,  0,  0,  0,  0,  0, 25,  3,  0,  0, 87,  0,  0,  0,
+/* 0x2ad0 */   0,  0,  0,  0, 34,  3,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ae0 */  43,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0, 70,  3,  0,  0,
+/* 0x2af0 */  92,  0,  0,  0,  0,  0,  0,  0, 79,  3,  0,  0, 93,  0,  0,  0,
+/* 0x2b00 */   0,  0,  0,  0, 88,  3,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b10 */  97,  3,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,106,  3,  0,  0,
+/* 0x2b20 */  96,  0,  0,  0,  0,  0,  0,  0,124,  3,  0,  0, 98,  0,  0,  0,
+/* 0x2b30 */   0,  0,  0,  0,133,  3,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b40 */ 142,  3,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,151,  3,  0,  0,
+/* 0x2b50 */ 101,  0,  0,  0,  0,  0,  0,  0,160,  3,  0,  0,102,  0,  0,  0,
+/* 0x2b60 */   0,  0,  0,  0,169,  3,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b70 */ 178,  3,  0,  0,104,  0,  0,  0,  0,  0,  0,  0,187,  3,  0,  0,
+/* 0x2b80 */ 105,  0,  0,  0,  0,  0,  0,  0,196,  3,  0,  0,106,  0,  0,  0,
+/* 0x2b90 */   0,  0,  0,  0,205,  3,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ba0 */ 223,  3,  0,  0,109,  0,  0,  0,  0,  0,  0,  0,232,  3,  0,  0,
+/* 0x2bb0 */ 110,  0,  0,  0,  0,  0,  0,  0,241,  3,  0,  0,111,  0,  0,  0,
+/* 0x2bc0 */   0,  0,  0,  0,250,  3,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bd0 */   3,  4,  0,  0,113,  0,  0,  0,  0,  0,  0,  0, 12,  4,  0,  0,
+/* 0x2be0 */ 114,  0,  0,  0,  0,  0,  0,  0, 21,  4,  0,  0,115,  0,  0,  0,
+/* 0x2bf0 */   0,  0,  0,  0, 30,  4,  0,  0,116,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c00 */  39,  4,  0,  0,117,  0,  0,  0,  0,  0,  0,  0, 48,  4,  0,  0,
+/* 0x2c10 */ 118,  0,  0,  0,  0,  0,  0,  0, 57,  4,  0,  0,119,  0,  0,  0,
+/* 0x2c20 */   0,  0,  0,  0, 66,  4,  0,  0,120,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c30 */  75,  4,  0,  0,121,  0,  0,  0,  0,  0,  0,  0,102,  4,  0,  0,
+/* 0x2c40 */ 124,  0,  0,  0,  0,  0,  0,  0,111,  4,  0,  0,125,  0,  0,  0,
+/* 0x2c50 */   0,  0,  0,  0,120,  4,  0,  0,126,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c60 */ 138,  4,  0,  0,128,  0,  0,  0,  0,  0,  0,  0,147,  4,  0,  0,
+/* 0x2c70 */ 129,  0,  0,  0,  0,  0,  0,  0,156,  4,  0,  0,130,  0,  0,  0,
+/* 0x2c80 */   0,  0,  0,  0,165,  4,  0,  0,131,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c90 */ 174,  4,  0,  0,132,  0,  0,  0,  0,  0,  0,  0,183,  4,  0,  0,
+/* 0x2ca0 */ 133,  0,  0,  0,  0,  0,  0,  0,192,  4,  0,  0,134,  0,  0,  0,
+/* 0x2cb0 */   0,  0,  0,  0,201,  4,  0,  0,135,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cc0 */ 210,  4,  0,  0,136,  0,  0,  0,  0,  0,  0,  0,228,  4,  0,  0,
+/* 0x2cd0 */ 138,  0,  0,  0,  0,  0,  0,  0,237,  4,  0,  0,139,  0,  0,  0,
+/* 0x2ce0 */   0,  0,  0,  0,246,  4,  0,  0,140,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cf0 */   8,  5,  0,  0,142,  0,  0,  0,  0,  0,  0,  0, 17,  5,  0,  0,
+/* 0x2d00 */ 143,  0,  0,  0,  0,  0,  0,  0, 26,  5,  0,  0,144,  0,  0,  0,
+/* 0x2d10 */   0,  0,  0,  0, 35,  5,  0,  0,145,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d20 */  44,  5,  0,  0,146,  0,  0,  0,  0,  0,  0,  0, 53,  5,  0,  0,
+/* 0x2d30 */ 147,  0,  0,  0,  0,  0,  0,  0, 62,  5,  0,  0,148,  0,  0,  0,
+/* 0x2d40 */   0,  0,  0,  0, 71,  5,  0,  0,149,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d50 */  80,  5,  0,  0,150,  0,  0,  0,  0,  0,  0,  0, 89,  5,  0,  0,
+/* 0x2d60 */ 151,  0,  0,  0,  0,  0,  0,  0,116,  5,  0,  0,154,  0,  0,  0,
+/* 0x2d70 */   0,  0,  0,  0,125,  5,  0,  0,155,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d80 */ 134,  5,  0,  0,156,  0,  0,  0,  0,  0,  0,  0,143,  5,  0,  0,
+/* 0x2d90 */ 157,  0,  0,  0,  0,  0,  0,  0,152,  5,  0,  0,158,  0,  0,  0,
+/* 0x2da0 */   0,  0,  0,  0,161,  5,  0,  0,159,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2db0 */ 170,  5,  0,  0,160,  0,  0,  0,  0,  0,  0,  0,209,  5,  0,  0,
+/* 0x2dc0 */ 164,  0,  0,  0,  0,  0,  0,  0,229,  5,  0,  0,166,  0,  0,  0,
+/* 0x2dd0 */   0,  0,  0,  0,247,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2de0 */ 254,  5,  0,  0,169,  0,  0,  0,173,222,173,222, 16,  6,  0,  0,
+/* 0x2df0 */ 169,  0,  0,  0,173,222,173,222, 27,  6,  0,  0,169,  0,  0,  0,
+/* 0x2e00 */ 173,222,173,222, 38,  6,  0,  0,169,  0,  0,  0,173,222,173,222,
+/* 0x2e10 */  54,  6,  0,  0,169,  0,  0,  0,173,222,173,222, 68,  6,  0,  0,
+/* 0x2e20 */ 169,  0,  0,  0,173,222,173,222, 79,  6,  0,  0,169,  0,  0,  0,
+/* 0x2e30 */ 173,222,173,222, 84,  6,  0,  0,169,  0,  0,  0,173,222,173,222,
+/* 0x2e40 */   0,  0,  0,  0,  2,  0,  0,  0, 92,  6,  0,  0,238,  5,  0,  0,
+/* 0x2e50 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2e60 */ 103,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e70 */   4,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0, 54,  0,  0,  0,
+/* 0x2e80 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2e90 */ 103,  6,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ea0 */   8,  0,  0,  0,  3,  0,  0,  0,103,  6,  0,  0, 45,  0,  0,  0,
+/* 0x2eb0 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2ec0 */ 103,  6,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ed0 */  11,  0,  0,  0,  3,  0,  0,  0,103,  6,  0,  0, 81,  0,  0,  0,
+/* 0x2ee0 */   0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2ef0 */ 103,  6,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f00 */  12,  0,  0,  0, 17,  0,  0,  0,103,  6,  0,  0,189,  0,  0,  0,
+/* 0x2f10 */   0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 47,  0,  0,  0,
+/* 0x2f20 */ 103,  6,  0,  0,153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f30 */  13,  0,  0,  0, 12,  0,  0,  0,103,  6,  0,  0,108,  0,  0,  0,
+/* 0x2f40 */   0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2f50 */ 103,  6,  0,  0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f60 */  14,  0,  0,  0, 14,  0,  0,  0,103,  6,  0,  0,108,  0,  0,  0,
+/* 0x2f70 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2f80 */  92,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f90 */  19,  0,  0,  0, 10,  0,  0,  0,103,  6,  0,  0,180,  0,  0,  0,
+/* 0x2fa0 */   0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0, 21,  0,  0,  0,
+/* 0x2fb0 */  92,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fc0 */  20,  0,  0,  0, 18,  0,  0,  0, 92,  6,  0,  0, 54,  0,  0,  0,
+/* 0x2fd0 */   0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2fe0 */ 103,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ff0 */  23,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0,225,  0,  0,  0,
+/* 0x3000 */   0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3010 */ 103,  6,  0,  0,198,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3020 */  27,  0,  0,  0,  3,  0,  0,  0,103,  6,  0,  0,216,  0,  0,  0,
+/* 0x3030 */   0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0, 12,  0,  0,  0,
+/* 0x3040 */ 103,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3050 */  30,  0,  0,  0,  5,  0,  0,  0,103,  6,  0,  0, 23,  1,  0,  0,
+/* 0x3060 */   0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 14,  0,  0,  0,
+/* 0x3070 */ 103,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3080 */  31,  0,  0,  0, 15,  0,  0,  0,103,  6,  0,  0,252,  0,  0,  0,
+/* 0x3090 */   0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0, 33,  0,  0,  0,
+/* 0x30a0 */ 103,  6,  0,  0,104,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30b0 */  31,  0,  0,  0, 67,  0,  0,  0,103,  6,  0,  0, 68,  1,  0,  0,
+/* 0x30c0 */   0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 12,  0,  0,  0,
+/* 0x30d0 */ 103,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30e0 */  33,  0,  0,  0,  3,  0,  0,  0,103,  6,  0,  0, 23,  1,  0,  0,
+/* 0x30f0 */   0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0, 14,  0,  0,  0,
+/* 0x3100 */ 103,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3110 */  37,  0,  0,  0,  8,  0,  0,  0, 92,  6,  0,  0,225,  0,  0,  0,
+/* 0x3120 */   0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0, 10,  0,  0,  0,
+/* 0x3130 */ 103,  6,  0,  0, 95,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3140 */  38,  0,  0,  0, 21,  0,  0,  0, 92,  6,  0,  0,225,  0,  0,  0,
+/* 0x3150 */   0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0, 18,  0,  0,  0,
+/* 0x3160 */  92,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3170 */  41,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0,140,  1,  0,  0,
+/* 0x3180 */   0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3190 */ 103,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31a0 */  45,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0,113,  1,  0,  0,
+/* 0x31b0 */   0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  3,  0,  0,  0,
+/* 0x31c0 */ 103,  6,  0,  0,131,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31d0 */  48,  0,  0,  0, 12,  0,  0,  0,103,  6,  0,  0,194,  1,  0,  0,
+/* 0x31e0 */   0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  5,  0,  0,  0,
+/* 0x31f0 */ 103,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3200 */  49,  0,  0,  0, 14,  0,  0,  0,103,  6,  0,  0,194,  1,  0,  0,
+/* 0x3210 */   0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0, 15,  0,  0,  0,
+/* 0x3220 */ 103,  6,  0,  0,167,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3230 */  50,  0,  0,  0, 30,  0,  0,  0,103,  6,  0,  0,239,  1,  0,  0,
+/* 0x3240 */   0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0, 48,  0,  0,  0,
+/* 0x3250 */ 103,  6,  0,  0, 19,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3260 */  51,  0,  0,  0, 12,  0,  0,  0,103,  6,  0,  0,194,  1,  0,  0,
+/* 0x3270 */   0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3280 */ 103,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3290 */  52,  0,  0,  0, 14,  0,  0,  0,103,  6,  0,  0,194,  1,  0,  0,
+/* 0x32a0 */   0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  8,  0,  0,  0,
+/* 0x32b0 */  92,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32c0 */  57,  0,  0,  0, 10,  0,  0,  0,103,  6,  0,  0, 10,  2,  0,  0,
+/* 0x32d0 */   0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0, 21,  0,  0,  0,
+/* 0x32e0 */  92,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32f0 */  58,  0,  0,  0, 18,  0,  0,  0, 92,  6,  0,  0,140,  1,  0,  0,
+/* 0x3300 */   0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  5,  0,  0,  0,
+/* 0x3310 */ 113,  6,  0,  0,254,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3320 */  60,  0,  0,  0, 20,  0,  0,  0,113,  6,  0,  0, 16,  6,  0,  0,
+/* 0x3330 */   0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0, 30,  0,  0,  0,
+/* 0x3340 */ 113,  6,  0,  0, 27,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3350 */  60,  0,  0,  0, 42,  0,  0,  0,113,  6,  0,  0, 38,  6,  0,  0,
+/* 0x3360 */   0,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3370 */ 113,  6,  0,  0, 54,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3380 */  66,  0,  0,  0,  2,  0,  0,  0,122,  6,  0,  0, 68,  6,  0,  0,
+/* 0x3390 */   0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,  4,  0,  0,  0,
+/* 0x33a0 */ 103,  6,  0,  0, 83,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33b0 */  71,  0,  0,  0, 13,  0,  0,  0,103,  6,  0,  0, 83,  2,  0,  0,
+/* 0x33c0 */   0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,  1,  0,  0,  0,
+/* 0x33d0 */ 113,  6,  0,  0, 54,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33e0 */  75,  0,  0,  0,  3,  0,  0,  0,103,  6,  0,  0,227,  2,  0,  0,
+/* 0x33f0 */   0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3400 */ 122,  6,  0,  0, 68,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3410 */  76,  0,  0,  0,  4,  0,  0,  0,103,  6,  0,  0,173,  2,  0,  0,
+/* 0x3420 */   0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  4,  0,  0,  0,
+/* 0x3430 */ 103,  6,  0,  0,146,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3440 */  83,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0, 52,  3,  0,  0,
+/* 0x3450 */   0,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3460 */ 113,  6,  0,  0, 79,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3470 */  90,  0,  0,  0,  1,  0,  0,  0, 92,  6,  0,  0,129,  4,  0,  0,
+/* 0x3480 */   0,  0,  0,  0,  0,  0,  0,  0, 94,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3490 */ 103,  6,  0,  0,107,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34a0 */  95,  0,  0,  0,  4,  0,  0,  0,103,  6,  0,  0,107,  5,  0,  0,
+/* 0x34b0 */   0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0,  2,  0,  0,  0,
+/* 0x34c0 */ 103,  6,  0,  0, 93,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34d0 */ 102,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0, 93,  4,  0,  0,
+/* 0x34e0 */   0,  0,  0,  0,  0,  0,  0,  0,103,  0,  0,  0,  4,  0,  0,  0,
+/* 0x34f0 */ 103,  6,  0,  0,214,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3500 */ 108,  0,  0,  0,  4,  0,  0,  0,103,  6,  0,  0, 93,  4,  0,  0,
+/* 0x3510 */   0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,  6,  0,  0,  0,
+/* 0x3520 */ 103,  6,  0,  0, 84,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3530 */ 126,  0,  0,  0,  6,  0,  0,  0,103,  6,  0,  0,107,  5,  0,  0,
+/* 0x3540 */   0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3550 */  92,  6,  0,  0,129,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3560 */ 140,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0,219,  4,  0,  0,
+/* 0x3570 */   0,  0,  0,  0,  0,  0,  0,  0,142,  0,  0,  0,  7,  0,  0,  0,
+/* 0x3580 */ 103,  6,  0,  0, 61,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3590 */ 146,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0,115,  3,  0,  0,
+/* 0x35a0 */   0,  0,  0,  0,  0,  0,  0,  0,148,  0,  0,  0,  1,  0,  0,  0,
+/* 0x35b0 */ 103,  6,  0,  0,115,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35c0 */ 149,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0,107,  5,  0,  0,
+/* 0x35d0 */   0,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,  0,  1,  0,  0,  0,
+/* 0x35e0 */ 103,  6,  0,  0, 98,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35f0 */ 151,  0,  0,  0,  1,  0,  0,  0,103,  6,  0,  0, 98,  5,  0,  0,
+/* 0x3600 */   0,  0,  0,  0,  0,  0,  0,  0,152,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3610 */ 103,  6,  0,  0,115,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3620 */ 153,  0,  0,  0,  4,  0,  0,  0,103,  6,  0,  0,255,  4,  0,  0,
+/* 0x3630 */   0,  0,  0,  0,  0,  0,  0,  0,161,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3640 */ 103,  6,  0,  0,199,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3650 */ 162,  0,  0,  0, 13,  0,  0,  0,103,  6,  0,  0,199,  5,  0,  0,
+/* 0x3660 */   0,  0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0,  5,  0,  0,  0,
+/* 0x3670 */ 103,  6,  0,  0,219,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3680 */ 163,  0,  0,  0, 10,  0,  0,  0,103,  6,  0,  0,219,  5,  0,  0,
+/* 0x3690 */   0,  0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0, 16,  0,  0,  0,
+/* 0x36a0 */ 103,  6,  0,  0,219,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36b0 */ 164,  0,  0,  0,  4,  0,  0,  0,103,  6,  0,  0,219,  5,  0,  0,
+/* 0x36c0 */   0,  0,  0,  0,  0,  0,  0,  0,164,  0,  0,  0,  9,  0,  0,  0,
+/* 0x36d0 */ 103,  6,  0,  0,189,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36e0 */ 165,  0,  0,  0,  4,  0,  0,  0,103,  6,  0,  0,179,  5,  0,  0,
+/* 0x36f0 */   0,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,  0,167,  0,  0,  0,
+/* 0x3700 */ 113,  6,  0,  0, 84,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3710 */  76, 69, 88, 69, 67, 48, 48, 48,  0, 76, 69, 88, 69, 67, 48, 48,
+/* 0x3720 */  57,  0, 76, 69, 88, 69, 67, 48, 49, 48,  0, 78, 50, 66, 83, 77,
+/* 0x3730 */  65, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66,
+/* 0x3740 */  70, 65, 83, 49, 49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78,
+/* 0x3750 */  50, 66, 83, 77, 65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,
+/* 0x3760 */   0, 78, 50, 66, 68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65,
+/* 0x3770 */  51, 48,  0, 78, 50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68,
+/* 0x3780 */  69, 67, 51, 48,  0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50,
+/* 0x3790 */  66, 70, 65, 83, 52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0,
+/* 0x37a0 */  78, 50, 66, 70, 65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53,
+/* 0x37b0 */  48,  0, 78, 50, 66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65,
+/* 0x37c0 */  83, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66,
+/* 0x37d0 */  68, 69, 67, 54, 48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78,
+/* 0x37e0 */  50, 68, 70, 65, 83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,
+/* 0x37f0 */   0, 78, 50, 68, 68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65,
+/* 0x3800 */  50, 48,  0, 78, 50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68,
+/* 0x3810 */  69, 67, 50, 48,  0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50,
+/* 0x3820 */  68, 70, 65, 83, 51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0,
+/* 0x3830 */  78, 50, 68, 83, 77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52,
+/* 0x3840 */  48,  0, 78, 50, 68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65,
+/* 0x3850 */  83, 53, 48,  0, 78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68,
+/* 0x3860 */  83, 77, 65, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78,
+/* 0x3870 */  50, 68, 70, 65, 83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,
+/* 0x3880 */   0, 78, 50, 69, 83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x3890 */  49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68,
+/* 0x38a0 */  69, 67, 49, 48,  0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50,
+/* 0x38b0 */  69, 70, 65, 83, 50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0,
+/* 0x38c0 */  78, 50, 69, 83, 77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51,
+/* 0x38d0 */  48,  0, 78, 50, 69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77,
+/* 0x38e0 */  65, 52, 48,  0, 78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69,
+/* 0x38f0 */  83, 77, 65, 53, 48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78,
+/* 0x3900 */  50, 69, 68, 69, 67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,
+/* 0x3910 */   0, 78, 50, 69, 70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x3920 */  54, 49,  0, 78, 50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65,
+/* 0x3930 */  95, 68, 69, 67, 48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48,
+/* 0x3940 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77,
+/* 0x3950 */  65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x3960 */  51, 48,  0, 67, 65, 76, 76, 84, 82, 48, 48,  0, 67, 84, 67, 76,
+/* 0x3970 */  69, 86, 69, 49,  0, 67, 65, 76, 76, 84, 82, 48, 49,  0, 67, 84,
+/* 0x3980 */  66, 83, 72, 82, 48, 49,  0, 67, 84, 66, 82, 79, 82, 48, 49,  0,
+/* 0x3990 */  67, 84, 66, 83, 87, 65, 48, 49,  0, 67, 65, 76, 76, 84, 82, 48,
+/* 0x39a0 */  50,  0, 67, 65, 76, 76, 84, 82, 49, 48,  0, 67, 65, 76, 76, 84,
+/* 0x39b0 */  82, 69, 56,  0, 67, 65, 76, 76, 84, 82, 69, 57,  0, 67, 65, 76,
+/* 0x39c0 */  76, 84, 82, 49, 49,  0, 67, 84, 67, 76, 69, 86, 69, 50,  0, 67,
+/* 0x39d0 */  65, 76, 76, 84, 82, 49, 50,  0, 67, 84, 66, 83, 72, 82, 49, 49,
+/* 0x39e0 */   0, 67, 84, 66, 82, 79, 82, 49, 49,  0, 67, 84, 66, 83, 87, 65,
+/* 0x39f0 */  49, 49,  0, 67, 65, 76, 76, 84, 82, 49, 51,  0, 76, 69, 88, 69,
+/* 0x3a00 */  67, 48, 49, 53,  0, 76, 88, 85, 78, 70, 48, 48, 48,  0, 76, 88,
+/* 0x3a10 */  85, 78, 70, 48, 48, 50,  0, 77, 82, 85, 66, 89, 84, 69, 48,  0,
+/* 0x3a20 */  76, 88, 77, 82, 85, 48, 48, 53,  0, 76, 88, 77, 82, 85, 48, 48,
+/* 0x3a30 */  54,  0, 76, 88, 77, 82, 85, 48, 48, 55,  0, 76, 88, 85, 78, 70,
+/* 0x3a40 */  48, 48, 56,  0, 76, 88, 85, 78, 70, 48, 49, 48,  0, 76, 88, 74,
+/* 0x3a50 */  67, 67, 48, 49, 48,  0, 76, 88, 77, 82, 85, 48, 52, 53,  0, 76,
+/* 0x3a60 */  88, 77, 82, 85, 48, 52, 54,  0, 76, 88, 74, 67, 67, 48, 50, 48,
+/* 0x3a70 */   0, 76, 88, 74, 67, 67, 48, 50, 49,  0, 76, 88, 74, 67, 67, 48,
+/* 0x3a80 */  50, 51,  0, 76, 88, 85, 78, 70, 48, 51, 55,  0, 76, 88, 85, 78,
+/* 0x3a90 */  70, 51, 56, 54,  0, 76, 88, 85, 78, 70, 51, 56, 55,  0, 76, 88,
+/* 0x3aa0 */  85, 78, 70, 51, 56, 56,  0, 76, 88, 85, 78, 70, 52, 56, 54,  0,
+/* 0x3ab0 */  76, 88, 85, 78, 70, 52, 56, 55,  0, 76, 88, 77, 82, 85, 48, 54,
+/* 0x3ac0 */  53,  0, 77, 82, 85, 66, 89, 84, 69, 51,  0, 77, 82, 85, 65, 82,
+/* 0x3ad0 */  66, 51, 48,  0, 77, 82, 85, 66, 73, 84, 83, 51,  0, 77, 82, 85,
+/* 0x3ae0 */  65, 82, 66, 52, 48,  0, 76, 88, 77, 82, 85, 48, 55, 48,  0, 77,
+/* 0x3af0 */  82, 85, 66, 89, 84, 69, 52,  0, 77, 82, 85, 66, 73, 84, 83, 52,
+/* 0x3b00 */   0, 77, 82, 85, 65, 82, 66, 53, 48,  0, 76, 88, 77, 82, 85, 48,
+/* 0x3b10 */  56, 48,  0, 77, 82, 85, 66, 89, 84, 69, 53,  0, 77, 82, 85, 65,
+/* 0x3b20 */  82, 66, 54, 48,  0, 77, 82, 85, 66, 73, 84, 83, 53,  0, 77, 82,
+/* 0x3b30 */  85, 65, 82, 66, 55, 48,  0, 76, 88, 77, 82, 85, 48, 57, 48,  0,
+/* 0x3b40 */  77, 82, 85, 66, 89, 84, 69, 54,  0, 77, 82, 85, 65, 82, 66, 56,
+/* 0x3b50 */  48,  0, 77, 82, 85, 66, 73, 84, 83, 54,  0, 77, 82, 85, 65, 82,
+/* 0x3b60 */  66, 57, 48,  0, 76, 88, 77, 82, 85, 49, 48, 48,  0, 76, 88, 85,
+/* 0x3b70 */  78, 70, 48, 52, 48,  0, 76, 88, 77, 82, 85, 49, 49, 48,  0, 76,
+/* 0x3b80 */  88, 77, 82, 85, 49, 49, 49,  0, 76, 88, 85, 78, 70, 48, 52, 49,
+/* 0x3b90 */   0, 76, 88, 85, 78, 70, 48, 52, 50,  0, 76, 69, 88, 69, 67, 48,
+/* 0x3ba0 */  49, 54,  0, 76, 88, 77, 82, 85, 48, 49, 48,  0, 76, 88, 74, 77,
+/* 0x3bb0 */  80, 65, 48, 48,  0, 76, 88, 67, 65, 76, 76, 66, 48,  0, 76, 88,
+/* 0x3bc0 */  85, 78, 70, 48, 50, 49,  0, 76, 88, 77, 82, 85, 48, 50, 50,  0,
+/* 0x3bd0 */  76, 88, 74, 77, 80, 65, 48, 49,  0, 76, 88, 67, 65, 76, 76, 66,
+/* 0x3be0 */  49,  0, 77, 82, 85, 66, 73, 84, 83, 49,  0, 76, 88, 77, 82, 85,
+/* 0x3bf0 */  48, 51, 48,  0, 77, 82, 85, 66, 89, 84, 69, 49,  0, 77, 82, 85,
+/* 0x3c00 */  65, 82, 66, 49, 48,  0, 76, 88, 77, 82, 85, 48, 52, 48,  0, 76,
+/* 0x3c10 */  88, 85, 78, 70, 48, 51, 48,  0, 76, 88, 74, 67, 67, 48, 48, 48,
+/* 0x3c20 */   0, 76, 88, 67, 74, 48, 77, 82, 85,  0, 76, 88, 67, 74, 49, 77,
+/* 0x3c30 */  82, 85,  0, 76, 88, 67, 65, 76, 74, 77, 80,  0, 76, 88, 67, 65,
+/* 0x3c40 */  76, 76, 48, 48,  0, 76, 88, 67, 65, 76, 76, 48, 49,  0, 76, 88,
+/* 0x3c50 */  67, 74, 50, 77, 82, 85,  0, 76, 88, 67, 74, 52, 77, 82, 85,  0,
+/* 0x3c60 */  76, 88, 67, 74, 54, 77, 82, 85,  0, 76, 88, 67, 74, 55, 77, 82,
+/* 0x3c70 */  85,  0, 76, 88, 67, 74, 56, 77, 82, 85,  0, 76, 88, 85, 78, 70,
+/* 0x3c80 */  48, 51, 52,  0, 76, 88, 77, 82, 85, 48, 53, 53,  0, 77, 82, 85,
+/* 0x3c90 */  66, 89, 84, 69, 50,  0, 77, 82, 85, 66, 73, 84, 83, 50,  0, 77,
+/* 0x3ca0 */  82, 85, 65, 82, 66, 50, 48,  0, 76, 88, 77, 82, 85, 48, 53, 55,
+/* 0x3cb0 */   0, 76, 88, 77, 82, 85, 48, 53, 56,  0, 76, 88, 85, 78, 70, 48,
+/* 0x3cc0 */  51, 53,  0, 99,116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,
+/* 0x3cd0 */ 107, 51, 50, 46, 49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,
+/* 0x3ce0 */   0, 99,116,111,107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51,
+/* 0x3cf0 */  50, 46, 52, 48,  0, 76, 69, 88, 69, 67, 48, 49, 55,  0, 76, 69,
+/* 0x3d00 */  88, 69, 67, 48, 50, 48,  0, 95,115,116, 97,114,116,  0,108,122,
+/* 0x3d10 */ 109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,  0,
+/* 0x3d20 */ 108,122,109, 97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95,
+/* 0x3d30 */  99, 95,108,101,110,  0,108,122,109, 97, 95,112,114,111,112,101,
+/* 0x3d40 */ 114,116,105,101,115,  0,102,105,108,116,101,114, 95,108,101,110,
+/* 0x3d50 */ 103,116,104,  0,102,105,108,116,101,114, 95, 99,116,111,  0, 78,
+/* 0x3d60 */  77, 82, 85,  0, 79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 51, 56,
+/* 0x3d70 */  54, 95, 80, 67, 51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 56,
+/* 0x3d80 */   0, 82, 95, 51, 56, 54, 95, 51, 50,  0, 82, 95, 51, 56, 54, 95,
+/* 0x3d90 */  56,  0,100, 27,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
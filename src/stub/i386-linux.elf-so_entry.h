@@ -1,5 +1,5 @@
 /* i386-linux.elf-so_entry.h
-   created from i386-linux.elf-so_entry.bin, 1295 (0x50f) bytes
+   created from i386-linux.elf-so_entry.bin, 940 (0x3ac) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_ELF_SO_ENTRY_SIZE    1295
-#define STUB_I386_LINUX_ELF_SO_ENTRY_ADLER32 0x9b5a12ef
-#define STUB_I386_LINUX_ELF_SO_ENTRY_CRC32   0xae0c7724
+#define STUB_I386_LINUX_ELF_SO_ENTRY_SIZE    940
+#define STUB_I386_LINUX_ELF_SO_ENTRY_ADLER32 0xede0a619
+#define STUB_I386_LINUX_ELF_SO_ENTRY_CRC32   0x54b6f4d1
 
-unsigned char stub_i386_linux_elf_so_entry[1295] = {
+unsigned char stub_i386_linux_elf_so_entry[940] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  96,  1,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -83,38 +83,16 @@ unsigned char stub_i386_linux_elf_so_entry[1295] = {
 /* 0x02c0 */   1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,
 /* 0x02d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  3,  0,
 /* 0x02e0 */   0, 95,115,116, 97,114,116,  0,  3,  0,  0,  0,  2,  3,  0,  0,
-/* 0x02f0 */   2,  0,  0,  0,  2,  1,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x0300 */ 109, 97,116, 32,101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10,
-/* 0x0310 */  83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,
-/* 0x0320 */ 109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101,
-/* 0x0330 */  32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x0340 */  76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,
-/* 0x0350 */ 102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10,
-/* 0x0360 */  32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 32, 32, 32,
-/* 0x0370 */  32, 32, 48,101,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52,
-/* 0x0380 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x0390 */  10, 32, 32, 49, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32,
-/* 0x03a0 */  32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50,
-/* 0x03b0 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x03c0 */  83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10,
-/* 0x03d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x03e0 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 69, 76, 70, 77,
-/* 0x03f0 */  65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x0400 */  32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48,
-/* 0x0410 */  32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x0420 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x0430 */  90, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69,
-/* 0x0440 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x0450 */  32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58,
-/* 0x0460 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x0470 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x0480 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x0490 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x04a0 */  77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x04b0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x04c0 */  76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x04d0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x04e0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x04f0 */  48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x0500 */  32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10
+/* 0x02f0 */   2,  0,  0,  0,  2,  1,  0,  0,  2,  0,  0,  0,  3,  0,  0,  0,
+/* 0x0300 */   2,  0,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x0310 */ 238,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 34,  1,  0,  0,
+/* 0x0320 */   6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0330 */   0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0340 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0350 */   3,  0,  0,  0, 25,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x0360 */   0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0, 25,  0,  0,  0,
+/* 0x0370 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77,
+/* 0x0380 */  65, 73, 78, 88,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,
+/* 0x0390 */ 116, 97,114,116,  0, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0,
+/* 0x03a0 */ 248,  2,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
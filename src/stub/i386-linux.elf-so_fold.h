@@ -1,5 +1,5 @@
 /* i386-linux.elf-so_fold.h
-   created from i386-linux.elf-so_fold.bin, 13609 (0x3529) bytes
+   created from i386-linux.elf-so_fold.bin, 11808 (0x2e20) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_ELF_SO_FOLD_SIZE    13609
-#define STUB_I386_LINUX_ELF_SO_FOLD_ADLER32 0xbbf40b00
-#define STUB_I386_LINUX_ELF_SO_FOLD_CRC32   0xc3705c49
+#define STUB_I386_LINUX_ELF_SO_FOLD_SIZE    11808
+#define STUB_I386_LINUX_ELF_SO_FOLD_ADLER32 0xcf13b18d
+#define STUB_I386_LINUX_ELF_SO_FOLD_CRC32   0xc6aa2981
 
-unsigned char stub_i386_linux_elf_so_fold[13609] = {
+unsigned char stub_i386_linux_elf_so_fold[11808] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  48, 32,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -671,220 +671,107 @@ unsigned char stub_i386_linux_elf_so_fold[13609] = {
 /* 0x2780 */ 102,  0,  0,  0,  2,  2,  0,  0,167,  0,  0,  0,  2,  1,  0,  0,
 /* 0x2790 */  84,  0,  0,  0,  2,  2,  0,  0,  5,  0,  0,  0,  1, 17,  0,  0,
 /* 0x27a0 */  20,  0,  0,  0,  1, 29,  0,  0, 30,  0,  0,  0,  1, 26,  0,  0,
-/* 0x27b0 */  42,  0,  0,  0,  1, 18,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x27c0 */ 109, 97,116, 32,101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10,
-/* 0x27d0 */  83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,
-/* 0x27e0 */ 109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101,
-/* 0x27f0 */  32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2800 */  76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,
-/* 0x2810 */ 102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,115, 10,
-/* 0x2820 */  32, 32, 48, 32, 83, 79, 95, 77, 65, 73, 78, 32, 32, 32, 32, 32,
-/* 0x2830 */  32, 32, 48, 53, 57, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2840 */  52, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2850 */  83, 10, 32, 32, 49, 32, 83, 79, 95, 72, 69, 65, 68, 32, 32, 32,
-/* 0x2860 */  32, 32, 32, 32, 48, 50, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2870 */  53, 99, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2880 */  78, 84, 83, 10, 32, 32, 50, 32,112,116,114, 95, 78, 69, 88, 84,
-/* 0x2890 */  32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x28a0 */  48, 53,102, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x28b0 */  69, 78, 84, 83, 10, 32, 32, 51, 32, 83, 79, 95, 84, 65, 73, 76,
-/* 0x28c0 */  32, 32, 32, 32, 32, 32, 32, 48, 97,102, 32, 32, 48, 32, 32, 48,
-/* 0x28d0 */  32, 32, 48, 53,102, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x28e0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 69, 88, 80, 95, 72,
-/* 0x28f0 */  69, 65, 68, 32, 32, 32, 32, 32, 32, 48,102, 49, 32, 32, 48, 32,
-/* 0x2900 */  32, 48, 32, 32, 48, 54, 97, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2910 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 69, 88, 80,
-/* 0x2920 */  95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48,
-/* 0x2930 */  32, 32, 48, 32, 32, 48, 55, 57, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2940 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 78, 82,
-/* 0x2950 */  86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,100, 50, 32,
-/* 0x2960 */  32, 48, 32, 32, 48, 32, 32, 48, 55, 57,101, 32, 32, 50, 42, 42,
-/* 0x2970 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32,
-/* 0x2980 */  78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 99,
-/* 0x2990 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 55, 48, 32, 32, 50,
-/* 0x29a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x29b0 */  56, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x29c0 */  48, 98, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 51, 53, 32,
-/* 0x29d0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x29e0 */  32, 32, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 32,
-/* 0x29f0 */  32, 32, 48, 50,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 57,101,
-/* 0x2a00 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2a10 */  83, 10, 32, 49, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x2a20 */  32, 32, 32, 32, 48, 52, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2a30 */  97, 49, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2a40 */  78, 84, 83, 10, 32, 49, 49, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2a50 */  49, 48, 32, 32, 32, 32, 48, 97, 56, 54, 32, 32, 48, 32, 32, 48,
-/* 0x2a60 */  32, 32, 48, 97, 53, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2a70 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 76, 90, 77, 65, 95,
-/* 0x2a80 */  68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 97, 56, 54, 32, 32, 48,
-/* 0x2a90 */  32, 32, 48, 32, 32, 48, 49, 52,101, 49, 32, 32, 50, 42, 42, 48,
-/* 0x2aa0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32, 76,
-/* 0x2ab0 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 49, 97,
-/* 0x2ac0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102, 54, 55, 32, 32, 50,
-/* 0x2ad0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89,
-/* 0x2ae0 */  77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48,
-/* 0x2af0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 88, 80,
-/* 0x2b00 */  95, 72, 69, 65, 68, 32, 48, 32, 69, 88, 80, 95, 72, 69, 65, 68,
-/* 0x2b10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2b20 */  32, 32, 69, 88, 80, 95, 84, 65, 73, 76, 32, 48, 32, 69, 88, 80,
-/* 0x2b30 */  95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2b40 */  32, 32, 32, 32,100, 32, 32, 83, 79, 95, 77, 65, 73, 78, 32, 48,
-/* 0x2b50 */  32, 83, 79, 95, 77, 65, 73, 78, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2b60 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 83, 79, 95, 72, 69, 65,
-/* 0x2b70 */  68, 32, 48, 32, 83, 79, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48,
-/* 0x2b80 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,112,116,114,
-/* 0x2b90 */  95, 78, 69, 88, 84, 32, 48, 32,112,116,114, 95, 78, 69, 88, 84,
-/* 0x2ba0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2bb0 */  32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32, 83, 79, 95, 84,
-/* 0x2bc0 */  65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2bd0 */  32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82, 86,
-/* 0x2be0 */  50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2bf0 */  32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82, 86, 50,
-/* 0x2c00 */  68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2c10 */ 100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50, 66,
-/* 0x2c20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2c30 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 48, 32, 76,
-/* 0x2c40 */  90, 77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2c50 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2c60 */  69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2c70 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2c80 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48,
-/* 0x2c90 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x2ca0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x2cb0 */  65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2cc0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2cd0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x2ce0 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x2cf0 */  48, 48, 48, 48, 53, 55, 32,103, 32, 32, 32, 32, 32, 32, 32, 69,
-/* 0x2d00 */  88, 80, 95, 72, 69, 65, 68, 32, 48, 32,102, 95,101,120,112, 97,
-/* 0x2d10 */ 110,100, 10, 48, 48, 48, 48, 48, 48, 97, 53, 32,103, 32, 32, 32,
-/* 0x2d20 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,117,
-/* 0x2d30 */ 110,109, 97,112, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x2d40 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,
-/* 0x2d50 */ 109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10,
-/* 0x2d60 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d70 */  32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,112,114,
-/* 0x2d80 */ 111,112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x2d90 */  57, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73,
-/* 0x2da0 */  76, 32, 48, 32,109,101,109, 99,112,121, 10, 48, 48, 48, 48, 48,
-/* 0x2db0 */  48, 51,101, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84,
-/* 0x2dc0 */  65, 73, 76, 32, 48, 32,109,109, 97,112, 10, 48, 48, 48, 48, 48,
-/* 0x2dd0 */  48, 48, 48, 32,103, 32, 32, 32, 32, 32, 70, 32, 83, 79, 95, 84,
-/* 0x2de0 */  65, 73, 76, 32, 48, 32,101,111,102, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2df0 */  97, 57, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65,
-/* 0x2e00 */  73, 76, 32, 48, 32,119,114,105,116,101, 10, 48, 48, 48, 48, 48,
-/* 0x2e10 */  50, 52, 57, 32,103, 32, 32, 32, 32, 32, 70, 32, 83, 79, 95, 77,
-/* 0x2e20 */  65, 73, 78, 32, 48, 50, 49, 32, 80, 70, 95,116,111, 95, 80, 82,
-/* 0x2e30 */  79, 84, 10, 48, 48, 48, 48, 48, 48, 56, 54, 32,103, 32, 32, 32,
-/* 0x2e40 */  32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32,109,101,
-/* 0x2e50 */ 109,102,100, 95, 99,114,101, 97,116,101, 10, 48, 48, 48, 48, 48,
-/* 0x2e60 */  48, 49, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84,
-/* 0x2e70 */  65, 73, 76, 32, 48, 32,109,101,109,115,101,116, 10, 48, 48, 48,
-/* 0x2e80 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x2e90 */  78, 68, 42, 32, 48, 32,108,122,109, 97, 95, 99, 95,108,101,110,
-/* 0x2ea0 */  10, 48, 48, 48, 48, 48, 49,102, 99, 32,103, 32, 32, 32, 32, 32,
-/* 0x2eb0 */  70, 32, 83, 79, 95, 77, 65, 73, 78, 32, 48, 54, 32,103,101,116,
-/* 0x2ec0 */  95, 80, 65, 71, 69, 95, 77, 65, 83, 75, 10, 48, 48, 48, 48, 48,
-/* 0x2ed0 */  48, 48,101, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84,
-/* 0x2ee0 */  65, 73, 76, 32, 48, 32,109,121, 95, 98,107,112,116, 10, 48, 48,
-/* 0x2ef0 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x2f00 */  85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,117, 95,108,101,
-/* 0x2f10 */ 110, 10, 48, 48, 48, 48, 48, 48, 53,101, 32,103, 32, 32, 32, 32,
-/* 0x2f20 */  32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48, 32, 80,112,114,
-/* 0x2f30 */ 111,116,101, 99,116, 10, 48, 48, 48, 48, 48, 48, 57,100, 32,103,
-/* 0x2f40 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48,
-/* 0x2f50 */  32,101,120,105,116, 10, 48, 48, 48, 48, 48, 48, 56,101, 32,103,
-/* 0x2f60 */  32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65, 73, 76, 32, 48,
-/* 0x2f70 */  32,109,112,114,111,116,101, 99,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2f80 */  97, 49, 32,103, 32, 32, 32, 32, 32, 32, 32, 83, 79, 95, 84, 65,
-/* 0x2f90 */  73, 76, 32, 48, 32, 99,108,111,115,101, 10, 48, 48, 48, 48, 48,
-/* 0x2fa0 */  50, 54, 97, 32,103, 32, 32, 32, 32, 32, 70, 32, 83, 79, 95, 77,
-/* 0x2fb0 */  65, 73, 78, 32, 48, 51, 50, 56, 32,117,112,120, 95,115,111, 95,
-/* 0x2fc0 */ 109, 97,105,110, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2fd0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 83, 79,
-/* 0x2fe0 */  95, 77, 65, 73, 78, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2ff0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3000 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3010 */  56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x3020 */  32, 32, 32, 32,109,121, 95, 98,107,112,116, 10, 48, 48, 48, 48,
-/* 0x3030 */  48, 48,102,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x3040 */  32, 32, 32, 32, 32, 32, 32,102, 95,101,120,112, 97,110,100, 10,
-/* 0x3050 */  48, 48, 48, 48, 48, 49,101, 51, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x3060 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,109,109, 97,112, 10,
-/* 0x3070 */  48, 48, 48, 48, 48, 50, 49,101, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x3080 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,109,101,109, 99,112,
-/* 0x3090 */ 121, 10, 48, 48, 48, 48, 48, 50, 50,102, 32, 82, 95, 51, 56, 54,
-/* 0x30a0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,109,109, 97,
-/* 0x30b0 */ 112, 10, 48, 48, 48, 48, 48, 50, 51, 97, 32, 82, 95, 51, 56, 54,
-/* 0x30c0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,109,101,109,
-/* 0x30d0 */  99,112,121, 10, 48, 48, 48, 48, 48, 50, 55, 55, 32, 82, 95, 51,
-/* 0x30e0 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,103,
-/* 0x30f0 */ 101,116, 95, 80, 65, 71, 69, 95, 77, 65, 83, 75, 10, 48, 48, 48,
-/* 0x3100 */  48, 48, 50, 98, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,
-/* 0x3110 */  32, 32, 32, 32, 32, 32, 32, 32,109,109, 97,112, 10, 48, 48, 48,
-/* 0x3120 */  48, 48, 50, 99, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,
-/* 0x3130 */  32, 32, 32, 32, 32, 32, 32, 32,109,101,109, 99,112,121, 10, 48,
-/* 0x3140 */  48, 48, 48, 48, 51, 57, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x3150 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 80, 70, 95,116,111, 95,
-/* 0x3160 */  80, 82, 79, 84, 10, 48, 48, 48, 48, 48, 51, 97, 52, 32, 82, 95,
-/* 0x3170 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3180 */ 109,109, 97,112, 10, 48, 48, 48, 48, 48, 52, 56, 55, 32, 82, 95,
-/* 0x3190 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x31a0 */ 109,109, 97,112, 10, 48, 48, 48, 48, 48, 53, 49,102, 32, 82, 95,
-/* 0x31b0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x31c0 */  80, 70, 95,116,111, 95, 80, 82, 79, 84, 10, 48, 48, 48, 48, 48,
-/* 0x31d0 */  53, 51, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x31e0 */  32, 32, 32, 32, 32, 32,109,109, 97,112, 10, 48, 48, 48, 48, 48,
-/* 0x31f0 */  53, 52, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x3200 */  32, 32, 32, 32, 32, 32, 80, 70, 95,116,111, 95, 80, 82, 79, 84,
-/* 0x3210 */  10, 48, 48, 48, 48, 48, 53, 53, 56, 32, 82, 95, 51, 56, 54, 95,
-/* 0x3220 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 80,112,114,111,
-/* 0x3230 */ 116,101, 99,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x3240 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 83, 79,
-/* 0x3250 */  95, 72, 69, 65, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3260 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3270 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x3280 */  50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x3290 */  32, 32, 32, 32,117,112,120, 95,115,111, 95,109, 97,105,110, 10,
-/* 0x32a0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x32b0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58,
-/* 0x32c0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x32d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x32e0 */  69, 10, 48, 48, 48, 48, 48, 48, 99, 55, 32, 82, 95, 51, 56, 54,
-/* 0x32f0 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 80,
-/* 0x3300 */  95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 54, 54, 32, 82,
-/* 0x3310 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3320 */  32, 69, 88, 80, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67,
-/* 0x3330 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x3340 */  82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x3350 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3360 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x3370 */  48, 48, 98, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x3380 */  32, 32, 32, 32, 32, 32, 32, 69, 88, 80, 95, 72, 69, 65, 68, 10,
-/* 0x3390 */  48, 48, 48, 48, 48, 48, 54, 54, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x33a0 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 69, 88, 80, 95, 84,
-/* 0x33b0 */  65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x33c0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x33d0 */  50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x33e0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x33f0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 97, 55, 32, 82,
-/* 0x3400 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3410 */  32, 69, 88, 80, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3420 */  53, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x3430 */  32, 32, 32, 32, 32, 69, 88, 80, 95, 84, 65, 73, 76, 10, 10, 82,
-/* 0x3440 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x3450 */  83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 48,
-/* 0x3460 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x3470 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x3480 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95,
-/* 0x3490 */  51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x34a0 */ 108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,
-/* 0x34b0 */ 116, 10, 48, 48, 48, 48, 48, 48, 49, 52, 32, 82, 95, 51, 56, 54,
-/* 0x34c0 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x34d0 */  97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,101,
-/* 0x34e0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x34f0 */  32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48,
-/* 0x3500 */  48, 48, 48, 48, 50, 97, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x3510 */  32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,
-/* 0x3520 */ 111,112,101,114,116,105,101,115, 10
+/* 0x27b0 */  42,  0,  0,  0,  1, 18,  0,  0, 14,  0,  0,  0, 34,  0,  0,  0,
+/* 0x27c0 */  27,  0,  0,  0, 76,  1,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x27d0 */ 146,  5,  0,  0,  2,  0,  0,  0,  8,  0,  0,  0,198,  5,  0,  0,
+/* 0x27e0 */  42,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,240,  5,  0,  0,
+/* 0x27f0 */   3,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,243,  5,  0,  0,
+/* 0x2800 */ 175,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,162,  6,  0,  0,
+/* 0x2810 */ 241,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,147,  7,  0,  0,
+/* 0x2820 */  11,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,  0,158,  7,  0,  0,
+/* 0x2830 */ 210,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,112,  8,  0,  0,
+/* 0x2840 */ 197,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 53,  9,  0,  0,
+/* 0x2850 */ 176,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,229,  9,  0,  0,
+/* 0x2860 */  46,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0, 19, 10,  0,  0,
+/* 0x2870 */  72,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0, 91, 10,  0,  0,
+/* 0x2880 */ 134, 10,  0,  0,  0,  0,  0,  0,102,  0,  0,  0,225, 20,  0,  0,
+/* 0x2890 */ 134, 10,  0,  0,  0,  0,  0,  0,113,  0,  0,  0,103, 31,  0,  0,
+/* 0x28a0 */  26,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  4,  0,  0,  0,
+/* 0x28b0 */   0,  0,  0,  0, 42,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28c0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x28d0 */   1,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  2,  0,  0,  0,
+/* 0x28e0 */   0,  0,  0,  0, 25,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */  51,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,
+/* 0x2900 */   7,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2910 */   0,  0,  0,  0, 69,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */  80,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,
+/* 0x2930 */  11,  0,  0,  0,  0,  0,  0,  0,102,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2940 */   0,  0,  0,  0,113,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2950 */ 124,  0,  0,  0,  4,  0,  0,  0, 87,  0,  0,  0,133,  0,  0,  0,
+/* 0x2960 */   3,  0,  0,  0,165,  0,  0,  0,140,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2970 */ 173,222,173,222,158,  0,  0,  0, 15,  0,  0,  0,173,222,173,222,
+/* 0x2980 */ 174,  0,  0,  0,  3,  0,  0,  0, 25,  0,  0,  0,181,  0,  0,  0,
+/* 0x2990 */   3,  0,  0,  0, 62,  0,  0,  0,186,  0,  0,  0,  3,  0,  0,  0,
+/* 0x29a0 */   0,  0,  0,  0,190,  0,  0,  0,  3,  0,  0,  0,169,  0,  0,  0,
+/* 0x29b0 */ 196,  0,  0,  0,  0,  0,  0,  0, 73,  2,  0,  0,207,  0,  0,  0,
+/* 0x29c0 */   3,  0,  0,  0,134,  0,  0,  0,220,  0,  0,  0,  3,  0,  0,  0,
+/* 0x29d0 */  16,  0,  0,  0,227,  0,  0,  0, 15,  0,  0,  0,173,222,173,222,
+/* 0x29e0 */ 238,  0,  0,  0,  0,  0,  0,  0,252,  1,  0,  0,252,  0,  0,  0,
+/* 0x29f0 */   3,  0,  0,  0, 14,  0,  0,  0,  4,  1,  0,  0, 15,  0,  0,  0,
+/* 0x2a00 */ 173,222,173,222, 15,  1,  0,  0,  3,  0,  0,  0, 94,  0,  0,  0,
+/* 0x2a10 */  24,  1,  0,  0,  3,  0,  0,  0,157,  0,  0,  0, 29,  1,  0,  0,
+/* 0x2a20 */   3,  0,  0,  0,142,  0,  0,  0, 38,  1,  0,  0,  3,  0,  0,  0,
+/* 0x2a30 */ 161,  0,  0,  0, 44,  1,  0,  0,  0,  0,  0,  0,106,  2,  0,  0,
+/* 0x2a40 */   0,  0,  0,  0,  8,  0,  0,  0, 56,  1,  0,  0,252,  0,  0,  0,
+/* 0x2a50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,253,  0,  0,  0,
+/* 0x2a60 */  56,  1,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a70 */   0,  0,  0,  0,227,  1,  0,  0, 56,  1,  0,  0,181,  0,  0,  0,
+/* 0x2a80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  2,  0,  0,
+/* 0x2a90 */  56,  1,  0,  0,174,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2aa0 */   0,  0,  0,  0, 47,  2,  0,  0, 56,  1,  0,  0,181,  0,  0,  0,
+/* 0x2ab0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,  2,  0,  0,
+/* 0x2ac0 */  56,  1,  0,  0,174,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ad0 */   0,  0,  0,  0,119,  2,  0,  0, 56,  1,  0,  0,238,  0,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,182,  2,  0,  0,
+/* 0x2af0 */  56,  1,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b00 */   0,  0,  0,  0,193,  2,  0,  0, 56,  1,  0,  0,174,  0,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,152,  3,  0,  0,
+/* 0x2b20 */  56,  1,  0,  0,196,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b30 */   0,  0,  0,  0,164,  3,  0,  0, 56,  1,  0,  0,181,  0,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,135,  4,  0,  0,
+/* 0x2b50 */  56,  1,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b60 */   0,  0,  0,  0, 31,  5,  0,  0, 56,  1,  0,  0,196,  0,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  5,  0,  0,
+/* 0x2b80 */  56,  1,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b90 */   0,  0,  0,  0, 70,  5,  0,  0, 56,  1,  0,  0,196,  0,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  5,  0,  0,
+/* 0x2bb0 */  56,  1,  0,  0, 15,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bc0 */   1,  0,  0,  0, 18,  0,  0,  0, 56,  1,  0,  0, 44,  1,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,199,  0,  0,  0,
+/* 0x2be0 */  56,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bf0 */   6,  0,  0,  0,102,  0,  0,  0, 56,  1,  0,  0, 42,  0,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,186,  0,  0,  0,
+/* 0x2c10 */  56,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c20 */   7,  0,  0,  0,102,  0,  0,  0, 56,  1,  0,  0, 42,  0,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,167,  0,  0,  0,
+/* 0x2c40 */  56,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c50 */   8,  0,  0,  0, 84,  0,  0,  0, 56,  1,  0,  0, 42,  0,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2c70 */  67,  1,  0,  0,140,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c80 */   9,  0,  0,  0, 20,  0,  0,  0, 67,  1,  0,  0,  4,  1,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 30,  0,  0,  0,
+/* 0x2ca0 */  67,  1,  0,  0,227,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cb0 */   9,  0,  0,  0, 42,  0,  0,  0, 67,  1,  0,  0,158,  0,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0,  0,  0,  0,  0, 83, 79, 95, 77, 65, 73, 78,  0,
+/* 0x2cd0 */  83, 79, 95, 72, 69, 65, 68,  0,112,116,114, 95, 78, 69, 88, 84,
+/* 0x2ce0 */   0, 83, 79, 95, 84, 65, 73, 76,  0, 69, 88, 80, 95, 72, 69, 65,
+/* 0x2cf0 */  68,  0, 69, 88, 80, 95, 84, 65, 73, 76,  0, 78, 82, 86, 50, 69,
+/* 0x2d00 */   0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77,
+/* 0x2d10 */  65, 95, 68, 69, 67, 48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70,
+/* 0x2d20 */  48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90,
+/* 0x2d30 */  77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x2d40 */  67, 51, 48,  0,102, 95,101,120,112, 97,110,100,  0,109,117,110,
+/* 0x2d50 */ 109, 97,112,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,
+/* 0x2d60 */ 100,106,117,115,116,  0,108,122,109, 97, 95,112,114,111,112,101,
+/* 0x2d70 */ 114,116,105,101,115,  0,109,101,109, 99,112,121,  0,109,109, 97,
+/* 0x2d80 */ 112,  0,101,111,102,  0,119,114,105,116,101,  0, 80, 70, 95,116,
+/* 0x2d90 */ 111, 95, 80, 82, 79, 84,  0,109,101,109,102,100, 95, 99,114,101,
+/* 0x2da0 */  97,116,101,  0,109,101,109,115,101,116,  0,108,122,109, 97, 95,
+/* 0x2db0 */  99, 95,108,101,110,  0,103,101,116, 95, 80, 65, 71, 69, 95, 77,
+/* 0x2dc0 */  65, 83, 75,  0,109,121, 95, 98,107,112,116,  0,108,122,109, 97,
+/* 0x2dd0 */  95,117, 95,108,101,110,  0, 80,112,114,111,116,101, 99,116,  0,
+/* 0x2de0 */ 101,120,105,116,  0,109,112,114,111,116,101, 99,116,  0, 99,108,
+/* 0x2df0 */ 111,115,101,  0,117,112,120, 95,115,111, 95,109, 97,105,110,  0,
+/* 0x2e00 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0, 82, 95, 51, 56, 54,
+/* 0x2e10 */  95, 51, 50,  0,184, 39,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
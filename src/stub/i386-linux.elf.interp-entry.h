@@ -1,5 +1,5 @@
 /* i386-linux.elf.interp-entry.h
-   created from i386-linux.elf.interp-entry.bin, 36191 (0x8d5f) bytes
+   created from i386-linux.elf.interp-entry.bin, 18093 (0x46ad) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_ELF_INTERP_ENTRY_SIZE    36191
-#define STUB_I386_LINUX_ELF_INTERP_ENTRY_ADLER32 0x2259c496
-#define STUB_I386_LINUX_ELF_INTERP_ENTRY_CRC32   0x218c1e54
+#define STUB_I386_LINUX_ELF_INTERP_ENTRY_SIZE    18093
+#define STUB_I386_LINUX_ELF_INTERP_ENTRY_ADLER32 0x177f2436
+#define STUB_I386_LINUX_ELF_INTERP_ENTRY_CRC32   0xd0c1f509
 
-unsigned char stub_i386_linux_elf_interp_entry[36191] = {
+unsigned char stub_i386_linux_elf_interp_entry[18093] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 224, 36,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -483,1819 +483,688 @@ unsigned char stub_i386_linux_elf_interp_entry[36191] = {
 /* 0x1bc0 */  10, 60,143,119,  6,128,127,254, 15,116,  5, 44,232, 60,  1,119,
 /* 0x1bd0 */ 255,131,249,  4,114,  4,139,  7, 40,208,117,255,134,196,193,192,
 /* 0x1be0 */  16,134,196, 41,248,  1,240,131,233,  4,171,131,233,  1,114,  4,
-/* 0x1bf0 */ 138,  7, 71,235, 13,131,233,  1,115,  3, 97,195,102,105,108,101,
-/* 0x1c00 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,105, 51,
-/* 0x1c10 */  56, 54, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,
-/* 0x1c20 */ 120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1c30 */  83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32,
-/* 0x1c40 */  32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,
-/* 0x1c50 */ 108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108,
-/* 0x1c60 */  97,103,115, 10, 32, 32, 48, 32, 76, 88, 80, 84, 73, 48, 48, 48,
-/* 0x1c70 */  32, 32, 32, 32, 32, 32, 48, 53, 55, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1c80 */  32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1c90 */  69, 78, 84, 83, 10, 32, 32, 49, 32, 76, 88, 80, 84, 73, 48, 52,
-/* 0x1ca0 */  48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1cb0 */  48, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1cc0 */  78, 84, 83, 10, 32, 32, 50, 32, 76, 88, 80, 84, 73, 48, 52, 49,
-/* 0x1cd0 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1ce0 */  56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1cf0 */  84, 83, 10, 32, 32, 51, 32, 76, 88, 80, 84, 73, 48, 52, 50, 32,
-/* 0x1d00 */  32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56,
-/* 0x1d10 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1d20 */  83, 10, 32, 32, 52, 32, 76, 88, 80, 84, 73, 48, 52, 51, 32, 32,
-/* 0x1d30 */  32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 98,
-/* 0x1d40 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1d50 */  10, 32, 32, 53, 32, 76, 88, 80, 84, 73, 48, 53, 48, 32, 32, 32,
-/* 0x1d60 */  32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 98,
-/* 0x1d70 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1d80 */  10, 32, 32, 54, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32, 32, 32,
-/* 0x1d90 */  32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 55,
-/* 0x1da0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1db0 */  10, 32, 32, 55, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 32, 32,
-/* 0x1dc0 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 97,
-/* 0x1dd0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1de0 */  10, 32, 32, 56, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 32, 32,
-/* 0x1df0 */  32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 99,
-/* 0x1e00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1e10 */  10, 32, 32, 57, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 32, 32,
-/* 0x1e20 */  32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 97, 50,
-/* 0x1e30 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1e40 */  10, 32, 49, 48, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 32, 32,
-/* 0x1e50 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 97,100,
-/* 0x1e60 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1e70 */  10, 32, 49, 49, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 32, 32,
-/* 0x1e80 */  32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 98, 50,
-/* 0x1e90 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1ea0 */  10, 32, 49, 50, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 32, 32,
-/* 0x1eb0 */  32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 98, 98,
-/* 0x1ec0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1ed0 */  10, 32, 49, 51, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 32, 32,
-/* 0x1ee0 */  32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 99, 56,
-/* 0x1ef0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1f00 */  10, 32, 49, 52, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 32, 32,
-/* 0x1f10 */  32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 53,
-/* 0x1f20 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1f30 */  10, 32, 49, 53, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x1f40 */  32, 32, 32, 48, 51,101, 32, 32, 48, 32, 32, 48, 32, 32, 48,101,
-/* 0x1f50 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1f60 */  83, 10, 32, 49, 54, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 32,
-/* 0x1f70 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x1f80 */  50, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1f90 */  84, 83, 10, 32, 49, 55, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32,
-/* 0x1fa0 */  32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1fb0 */  49, 50,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1fc0 */  78, 84, 83, 10, 32, 49, 56, 32, 78, 50, 66, 83, 77, 65, 53, 48,
-/* 0x1fd0 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1fe0 */  48, 49, 51,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1ff0 */  69, 78, 84, 83, 10, 32, 49, 57, 32, 78, 50, 66, 70, 65, 83, 53,
-/* 0x2000 */  48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2010 */  32, 48, 49, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2020 */  84, 69, 78, 84, 83, 10, 32, 50, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x2030 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48,
-/* 0x2040 */  32, 32, 48, 49, 52, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2050 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 49, 32, 78, 50, 66, 83, 77,
-/* 0x2060 */  65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32,
-/* 0x2070 */  48, 32, 32, 48, 49, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2080 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 50, 32, 78, 50, 66, 70,
-/* 0x2090 */  65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48,
-/* 0x20a0 */  32, 32, 48, 32, 32, 48, 49, 53, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x20b0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 51, 32, 78, 50,
-/* 0x20c0 */  66, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32,
-/* 0x20d0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 49, 32, 32, 50, 42, 42,
-/* 0x20e0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 52, 32,
-/* 0x20f0 */  78, 50, 66, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x2100 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 55, 32, 32, 50, 42, 42,
-/* 0x2110 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 53, 32,
-/* 0x2120 */  78, 50, 68, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x2130 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 55, 32, 32, 50, 42,
-/* 0x2140 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 54,
-/* 0x2150 */  32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2160 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 97, 32, 32, 50,
-/* 0x2170 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x2180 */  55, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32,
-/* 0x2190 */  48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 99, 32, 32,
-/* 0x21a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x21b0 */  50, 56, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32,
-/* 0x21c0 */  32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50, 32,
-/* 0x21d0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x21e0 */  32, 50, 57, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 32, 32, 32,
-/* 0x21f0 */  32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100,
-/* 0x2200 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2210 */  10, 32, 51, 48, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32,
-/* 0x2220 */  32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x2230 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2240 */  83, 10, 32, 51, 49, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 32,
-/* 0x2250 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2260 */  97, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2270 */  84, 83, 10, 32, 51, 50, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32,
-/* 0x2280 */  32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2290 */  49, 98, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x22a0 */  78, 84, 83, 10, 32, 51, 51, 32, 78, 50, 68, 70, 65, 83, 51, 48,
-/* 0x22b0 */  32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x22c0 */  48, 49, 99, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x22d0 */  69, 78, 84, 83, 10, 32, 51, 52, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x22e0 */  48, 32, 32, 32, 32, 32, 32, 48, 53, 50, 32, 32, 48, 32, 32, 48,
-/* 0x22f0 */  32, 32, 48, 49,100, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2300 */  78, 84, 69, 78, 84, 83, 10, 32, 51, 53, 32, 78, 50, 68, 83, 77,
-/* 0x2310 */  65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32,
-/* 0x2320 */  48, 32, 32, 48, 50, 50, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2330 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 54, 32, 78, 50, 68, 70,
-/* 0x2340 */  65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32,
-/* 0x2350 */  32, 48, 32, 32, 48, 50, 51, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2360 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 55, 32, 78, 50, 68,
-/* 0x2370 */  83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2380 */  32, 32, 48, 32, 32, 48, 50, 52, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2390 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 56, 32, 78, 50,
-/* 0x23a0 */  68, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32,
-/* 0x23b0 */  48, 32, 32, 48, 32, 32, 48, 50, 52, 52, 32, 32, 50, 42, 42, 48,
-/* 0x23c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 57, 32, 78,
-/* 0x23d0 */  50, 68, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32,
-/* 0x23e0 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 52, 55, 32, 32, 50, 42, 42,
-/* 0x23f0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 48, 32,
-/* 0x2400 */  78, 50, 68, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99,
-/* 0x2410 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 53, 48, 32, 32, 50, 42,
-/* 0x2420 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 49,
-/* 0x2430 */  32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2440 */  49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 53, 99, 32, 32,
-/* 0x2450 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2460 */  52, 50, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32,
-/* 0x2470 */  32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 53,
-/* 0x2480 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2490 */  10, 32, 52, 51, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 32, 32,
-/* 0x24a0 */  32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 98,
-/* 0x24b0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x24c0 */  10, 32, 52, 52, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32, 32, 32,
-/* 0x24d0 */  32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56,
-/* 0x24e0 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x24f0 */  83, 10, 32, 52, 53, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 32,
-/* 0x2500 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x2510 */  56,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2520 */  84, 83, 10, 32, 52, 54, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32,
-/* 0x2530 */  32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2540 */  50, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2550 */  78, 84, 83, 10, 32, 52, 55, 32, 78, 50, 69, 68, 69, 67, 49, 48,
-/* 0x2560 */  32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2570 */  48, 50, 57, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2580 */  69, 78, 84, 83, 10, 32, 52, 56, 32, 78, 50, 69, 83, 77, 65, 50,
-/* 0x2590 */  48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x25a0 */  32, 48, 50, 97, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x25b0 */  84, 69, 78, 84, 83, 10, 32, 52, 57, 32, 78, 50, 69, 70, 65, 83,
-/* 0x25c0 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48,
-/* 0x25d0 */  32, 32, 48, 50, 97, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x25e0 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 48, 32, 78, 50, 69, 68, 69,
-/* 0x25f0 */  67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32,
-/* 0x2600 */  48, 32, 32, 48, 50, 97,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2610 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 49, 32, 78, 50, 69, 83,
-/* 0x2620 */  77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32,
-/* 0x2630 */  32, 48, 32, 32, 48, 50, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2640 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 50, 32, 78, 50, 69,
-/* 0x2650 */  70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48,
-/* 0x2660 */  32, 32, 48, 32, 32, 48, 50, 99, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2670 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 51, 32, 78, 50,
-/* 0x2680 */  69, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 53,102, 32,
-/* 0x2690 */  32, 48, 32, 32, 48, 32, 32, 48, 50,100, 56, 32, 32, 50, 42, 42,
-/* 0x26a0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 52, 32,
-/* 0x26b0 */  78, 50, 69, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100,
-/* 0x26c0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 51, 55, 32, 32, 50, 42,
-/* 0x26d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 53,
-/* 0x26e0 */  32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x26f0 */ 102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 52, 32, 32, 50,
-/* 0x2700 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x2710 */  54, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2720 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 53, 51, 32, 32,
-/* 0x2730 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2740 */  53, 55, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2750 */  32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 53, 53, 32,
-/* 0x2760 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2770 */  32, 53, 56, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32, 32, 32,
-/* 0x2780 */  32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 53, 56,
-/* 0x2790 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x27a0 */  10, 32, 53, 57, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 32, 32,
-/* 0x27b0 */  32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 54,
-/* 0x27c0 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x27d0 */  83, 10, 32, 54, 48, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 32,
-/* 0x27e0 */  32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x27f0 */  51, 54,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2800 */  78, 84, 83, 10, 32, 54, 49, 32, 78, 50, 69, 70, 65, 83, 54, 49,
-/* 0x2810 */  32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2820 */  32, 48, 51, 56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2830 */  84, 69, 78, 84, 83, 10, 32, 54, 50, 32, 78, 50, 69, 68, 69, 67,
-/* 0x2840 */  54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2850 */  32, 48, 51, 57, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2860 */  84, 69, 78, 84, 83, 10, 32, 54, 51, 32, 67, 76, 49, 83, 77, 65,
-/* 0x2870 */  49, 66, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x2880 */  32, 32, 48, 51, 57, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2890 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 52, 32, 67, 76, 49, 70, 65,
-/* 0x28a0 */  83, 49, 66, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32,
-/* 0x28b0 */  48, 32, 32, 48, 51, 57,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x28c0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 53, 32, 67, 76, 49, 71,
-/* 0x28d0 */  69, 84, 49, 66, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x28e0 */  48, 32, 32, 48, 51, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x28f0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 54, 32, 67, 76, 49, 69,
-/* 0x2900 */  78, 84, 69, 82, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32,
-/* 0x2910 */  32, 48, 32, 32, 48, 51, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2920 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 55, 32, 67, 76, 49,
-/* 0x2930 */  83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2940 */  32, 32, 48, 32, 32, 48, 51, 97, 97, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2950 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 56, 32, 67, 76,
-/* 0x2960 */  49, 82, 76, 79, 65, 68, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32,
-/* 0x2970 */  48, 32, 32, 48, 32, 32, 48, 51, 97,102, 32, 32, 50, 42, 42, 48,
-/* 0x2980 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 57, 32, 67,
-/* 0x2990 */  76, 49, 87, 73, 68, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x29a0 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 98, 55, 32, 32, 50, 42, 42,
-/* 0x29b0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 48, 32,
-/* 0x29c0 */  67, 76, 49, 87, 73, 68, 48, 50, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x29d0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 98, 57, 32, 32, 50, 42,
-/* 0x29e0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 49,
-/* 0x29f0 */  32, 67, 76, 49, 87, 73, 68, 48, 51, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2a00 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 98, 98, 32, 32, 50,
-/* 0x2a10 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55,
-/* 0x2a20 */  50, 32, 67, 76, 49, 87, 73, 68, 48, 52, 32, 32, 32, 32, 32, 32,
-/* 0x2a30 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 98,100, 32, 32,
-/* 0x2a40 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2a50 */  55, 51, 32, 67, 76, 49, 87, 73, 68, 48, 53, 32, 32, 32, 32, 32,
-/* 0x2a60 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 98,102, 32,
-/* 0x2a70 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2a80 */  32, 55, 52, 32, 67, 76, 49, 87, 73, 68, 48, 54, 32, 32, 32, 32,
-/* 0x2a90 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 99, 49,
-/* 0x2aa0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2ab0 */  10, 32, 55, 53, 32, 67, 76, 49, 87, 73, 68, 48, 55, 32, 32, 32,
-/* 0x2ac0 */  32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 99,
-/* 0x2ad0 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2ae0 */  83, 10, 32, 55, 54, 32, 67, 76, 49, 87, 73, 68, 48, 56, 32, 32,
-/* 0x2af0 */  32, 32, 32, 32, 48, 49, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2b00 */  51, 99, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2b10 */  78, 84, 83, 10, 32, 55, 55, 32, 67, 76, 49, 87, 73, 68, 48, 57,
-/* 0x2b20 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2b30 */  48, 51,101, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2b40 */  69, 78, 84, 83, 10, 32, 55, 56, 32, 67, 76, 49, 87, 73, 68, 49,
-/* 0x2b50 */  48, 32, 32, 32, 32, 32, 32, 48, 49, 49, 32, 32, 48, 32, 32, 48,
-/* 0x2b60 */  32, 32, 48, 51,101, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2b70 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 57, 32, 67, 76, 49, 83, 84,
-/* 0x2b80 */  65, 82, 84, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x2b90 */  48, 32, 32, 48, 51,102, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2ba0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 48, 32, 67, 76, 49, 84,
-/* 0x2bb0 */  79, 80, 48, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32,
-/* 0x2bc0 */  32, 48, 32, 32, 48, 51,102, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2bd0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 49, 32, 67, 76, 49,
-/* 0x2be0 */  84, 79, 80, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2bf0 */  32, 32, 48, 32, 32, 48, 51,102, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2c00 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 50, 32, 67, 76,
-/* 0x2c10 */  49, 84, 79, 80, 48, 50, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x2c20 */  48, 32, 32, 48, 32, 32, 48, 51,102,100, 32, 32, 50, 42, 42, 48,
-/* 0x2c30 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 51, 32, 67,
-/* 0x2c40 */  76, 49, 84, 79, 80, 48, 51, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x2c50 */  32, 48, 32, 32, 48, 32, 32, 48, 51,102,102, 32, 32, 50, 42, 42,
-/* 0x2c60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 52, 32,
-/* 0x2c70 */  67, 76, 49, 84, 79, 80, 48, 52, 32, 32, 32, 32, 32, 32, 48, 53,
-/* 0x2c80 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 49, 32, 32, 50, 42,
-/* 0x2c90 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 53,
-/* 0x2ca0 */  32, 67, 76, 49, 84, 79, 80, 48, 53, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2cb0 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 54, 32, 32, 50,
-/* 0x2cc0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56,
-/* 0x2cd0 */  54, 32, 67, 76, 49, 84, 79, 80, 48, 54, 32, 32, 32, 32, 32, 32,
-/* 0x2ce0 */  48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 57, 32, 32,
-/* 0x2cf0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2d00 */  56, 55, 32, 67, 76, 49, 84, 79, 80, 48, 55, 32, 32, 32, 32, 32,
-/* 0x2d10 */  32, 48, 49, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 49, 48,
-/* 0x2d20 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2d30 */  10, 32, 56, 56, 32, 67, 76, 49, 79, 70, 70, 48, 49, 32, 32, 32,
-/* 0x2d40 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 50,
-/* 0x2d50 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2d60 */  83, 10, 32, 56, 57, 32, 67, 76, 49, 79, 70, 70, 48, 50, 32, 32,
-/* 0x2d70 */  32, 32, 32, 32, 48, 49, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2d80 */  52, 50, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2d90 */  78, 84, 83, 10, 32, 57, 48, 32, 67, 76, 49, 79, 70, 70, 48, 51,
-/* 0x2da0 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2db0 */  48, 52, 51, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2dc0 */  69, 78, 84, 83, 10, 32, 57, 49, 32, 67, 76, 49, 79, 70, 70, 48,
-/* 0x2dd0 */  52, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2de0 */  32, 48, 52, 51,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2df0 */  84, 69, 78, 84, 83, 10, 32, 57, 50, 32, 67, 76, 49, 76, 69, 78,
-/* 0x2e00 */  48, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48,
-/* 0x2e10 */  32, 32, 48, 52, 52, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2e20 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 51, 32, 67, 76, 49, 76, 69,
-/* 0x2e30 */  78, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2e40 */  48, 32, 32, 48, 52, 52, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2e50 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 52, 32, 67, 76, 49, 76,
-/* 0x2e60 */  69, 78, 48, 50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x2e70 */  32, 48, 32, 32, 48, 52, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2e80 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 53, 32, 67, 76, 49,
-/* 0x2e90 */  67, 79, 80, 89, 48, 32, 32, 32, 32, 32, 32, 48, 51, 51, 32, 32,
-/* 0x2ea0 */  48, 32, 32, 48, 32, 32, 48, 52, 52, 57, 32, 32, 50, 42, 42, 48,
-/* 0x2eb0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 54, 32, 67,
-/* 0x2ec0 */  76, 49, 69, 78, 68, 32, 32, 32, 32, 32, 32, 32, 32, 48, 32, 32,
-/* 0x2ed0 */  48, 32, 32, 48, 32, 32, 48, 52, 55, 99, 32, 32, 50, 42, 42, 48,
-/* 0x2ee0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 55, 32, 76,
-/* 0x2ef0 */  90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 50,101,
-/* 0x2f00 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 55, 99, 32, 32, 50, 42,
-/* 0x2f10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 56,
-/* 0x2f20 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48,
-/* 0x2f30 */  52, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 97, 97, 32, 32,
-/* 0x2f40 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2f50 */  57, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32,
-/* 0x2f60 */  32, 48, 97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,102,
-/* 0x2f70 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2f80 */  83, 10, 49, 48, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x2f90 */  32, 32, 32, 32, 48, 97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2fa0 */  48,102, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2fb0 */  69, 78, 84, 83, 10, 49, 48, 49, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2fc0 */  67, 51, 48, 32, 32, 32, 32, 48, 49, 97, 32, 32, 48, 32, 32, 48,
-/* 0x2fd0 */  32, 32, 48, 49, 57,102,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2fe0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 50, 32, 76, 88, 80, 84,
-/* 0x2ff0 */  73, 48, 57, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x3000 */  32, 48, 32, 32, 48, 49, 97, 49, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3010 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 51, 32, 76, 88,
-/* 0x3020 */  80, 84, 73, 48, 57, 49, 32, 32, 32, 32, 32, 32, 48, 49,100, 32,
-/* 0x3030 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49,100, 32, 32, 50, 42,
-/* 0x3040 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 52,
-/* 0x3050 */  32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3060 */ 101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 51, 97, 32, 32,
-/* 0x3070 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3080 */  48, 53, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 32, 32, 32, 32,
-/* 0x3090 */  32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 52, 56,
-/* 0x30a0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x30b0 */  10, 49, 48, 54, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 32, 32,
-/* 0x30c0 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x30d0 */  52,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x30e0 */  84, 83, 10, 49, 48, 55, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32,
-/* 0x30f0 */  32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3100 */  49, 97, 53, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3110 */  69, 78, 84, 83, 10, 49, 48, 56, 32, 67, 84, 66, 82, 79, 82, 48,
-/* 0x3120 */  49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3130 */  32, 48, 49, 97, 53, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3140 */  78, 84, 69, 78, 84, 83, 10, 49, 48, 57, 32, 67, 84, 66, 83, 87,
-/* 0x3150 */  65, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x3160 */  48, 32, 32, 48, 49, 97, 53, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3170 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 48, 32, 67, 65, 76,
-/* 0x3180 */  76, 84, 82, 48, 50, 32, 32, 32, 32, 32, 32, 48,101, 32, 32, 48,
-/* 0x3190 */  32, 32, 48, 32, 32, 48, 49, 97, 53,100, 32, 32, 50, 42, 42, 48,
-/* 0x31a0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 49, 32, 67,
-/* 0x31b0 */  65, 76, 76, 84, 82, 49, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x31c0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 54, 98, 32, 32, 50, 42,
-/* 0x31d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 50,
-/* 0x31e0 */  32, 67, 65, 76, 76, 84, 82, 69, 56, 32, 32, 32, 32, 32, 32, 48,
-/* 0x31f0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 55, 48, 32, 32,
-/* 0x3200 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3210 */  49, 51, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 32, 32, 32, 32,
-/* 0x3220 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 55, 50,
-/* 0x3230 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3240 */  10, 49, 49, 52, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32, 32, 32,
-/* 0x3250 */  32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3260 */  55, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3270 */  84, 83, 10, 49, 49, 53, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32,
-/* 0x3280 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3290 */  49, 97, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x32a0 */  69, 78, 84, 83, 10, 49, 49, 54, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x32b0 */  50, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x32c0 */  32, 48, 49, 97, 55,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x32d0 */  78, 84, 69, 78, 84, 83, 10, 49, 49, 55, 32, 67, 84, 66, 83, 72,
-/* 0x32e0 */  82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32,
-/* 0x32f0 */  48, 32, 32, 48, 49, 97, 55,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3300 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 56, 32, 67, 84, 66,
-/* 0x3310 */  82, 79, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x3320 */  32, 32, 48, 32, 32, 48, 49, 97, 56, 51, 32, 32, 50, 42, 42, 48,
-/* 0x3330 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 57, 32, 67,
-/* 0x3340 */  84, 66, 83, 87, 65, 49, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x3350 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56, 53, 32, 32, 50, 42,
-/* 0x3360 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 48,
-/* 0x3370 */  32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3380 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56, 97, 32, 32,
-/* 0x3390 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x33a0 */  50, 49, 32, 76, 88, 85, 78, 70, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x33b0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56,102,
-/* 0x33c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x33d0 */  10, 49, 50, 50, 32, 76, 88, 85, 78, 70, 48, 48, 50, 32, 32, 32,
-/* 0x33e0 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x33f0 */  57, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3400 */  84, 83, 10, 49, 50, 51, 32, 77, 82, 85, 66, 89, 84, 69, 48, 32,
-/* 0x3410 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3420 */  49, 97, 57, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3430 */  69, 78, 84, 83, 10, 49, 50, 52, 32, 76, 88, 77, 82, 85, 48, 48,
-/* 0x3440 */  53, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3450 */  32, 48, 49, 97, 57, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3460 */  78, 84, 69, 78, 84, 83, 10, 49, 50, 53, 32, 76, 88, 77, 82, 85,
-/* 0x3470 */  48, 48, 54, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32,
-/* 0x3480 */  48, 32, 32, 48, 49, 97, 57,100, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3490 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 54, 32, 76, 88, 77,
-/* 0x34a0 */  82, 85, 48, 48, 55, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48,
-/* 0x34b0 */  32, 32, 48, 32, 32, 48, 49, 97, 97, 52, 32, 32, 50, 42, 42, 48,
-/* 0x34c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 55, 32, 76,
-/* 0x34d0 */  88, 85, 78, 70, 48, 48, 56, 32, 32, 32, 32, 32, 32, 48, 52, 32,
-/* 0x34e0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97, 98, 32, 32, 50, 42,
-/* 0x34f0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 56,
-/* 0x3500 */  32, 76, 88, 85, 78, 70, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3510 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97,102, 32, 32,
-/* 0x3520 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3530 */  50, 57, 32, 76, 88, 74, 67, 67, 48, 49, 48, 32, 32, 32, 32, 32,
-/* 0x3540 */  32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 98, 52,
-/* 0x3550 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3560 */  10, 49, 51, 48, 32, 76, 88, 77, 82, 85, 48, 52, 53, 32, 32, 32,
-/* 0x3570 */  32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3580 */  98, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3590 */  84, 83, 10, 49, 51, 49, 32, 76, 88, 77, 82, 85, 48, 52, 54, 32,
-/* 0x35a0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x35b0 */  49, 97, 98, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x35c0 */  69, 78, 84, 83, 10, 49, 51, 50, 32, 76, 88, 74, 67, 67, 48, 50,
-/* 0x35d0 */  48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x35e0 */  32, 48, 49, 97, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x35f0 */  78, 84, 69, 78, 84, 83, 10, 49, 51, 51, 32, 76, 88, 74, 67, 67,
-/* 0x3600 */  48, 50, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x3610 */  48, 32, 32, 48, 49, 97, 98,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3620 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 52, 32, 76, 88, 74,
-/* 0x3630 */  67, 67, 48, 50, 51, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48,
-/* 0x3640 */  32, 32, 48, 32, 32, 48, 49, 97, 99, 51, 32, 32, 50, 42, 42, 48,
-/* 0x3650 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 53, 32, 76,
-/* 0x3660 */  88, 85, 78, 70, 48, 51, 55, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x3670 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 99, 97, 32, 32, 50, 42,
-/* 0x3680 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 54,
-/* 0x3690 */  32, 76, 88, 85, 78, 70, 51, 56, 54, 32, 32, 32, 32, 32, 32, 48,
-/* 0x36a0 */  49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 99, 99, 32, 32,
-/* 0x36b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x36c0 */  51, 55, 32, 76, 88, 85, 78, 70, 51, 56, 55, 32, 32, 32, 32, 32,
-/* 0x36d0 */  32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 99,100,
-/* 0x36e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x36f0 */  10, 49, 51, 56, 32, 76, 88, 85, 78, 70, 51, 56, 56, 32, 32, 32,
-/* 0x3700 */  32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3710 */ 100, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3720 */  84, 83, 10, 49, 51, 57, 32, 76, 88, 85, 78, 70, 52, 56, 54, 32,
-/* 0x3730 */  32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3740 */  49, 97,100, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3750 */  69, 78, 84, 83, 10, 49, 52, 48, 32, 76, 88, 85, 78, 70, 52, 56,
-/* 0x3760 */  55, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3770 */  32, 48, 49, 97,100,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3780 */  78, 84, 69, 78, 84, 83, 10, 49, 52, 49, 32, 76, 88, 77, 82, 85,
-/* 0x3790 */  48, 54, 53, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x37a0 */  48, 32, 32, 48, 49, 97,100,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x37b0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 50, 32, 77, 82, 85,
-/* 0x37c0 */  66, 89, 84, 69, 51, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x37d0 */  32, 32, 48, 32, 32, 48, 49, 97,101, 52, 32, 32, 50, 42, 42, 48,
-/* 0x37e0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 51, 32, 77,
-/* 0x37f0 */  82, 85, 65, 82, 66, 51, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32,
-/* 0x3800 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97,101, 54, 32, 32, 50, 42,
-/* 0x3810 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 52,
-/* 0x3820 */  32, 77, 82, 85, 66, 73, 84, 83, 51, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3830 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,101, 55, 32, 32,
-/* 0x3840 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3850 */  52, 53, 32, 77, 82, 85, 65, 82, 66, 52, 48, 32, 32, 32, 32, 32,
-/* 0x3860 */  32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,101, 57,
-/* 0x3870 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3880 */  10, 49, 52, 54, 32, 76, 88, 77, 82, 85, 48, 55, 48, 32, 32, 32,
-/* 0x3890 */  32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x38a0 */ 101,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x38b0 */  84, 83, 10, 49, 52, 55, 32, 77, 82, 85, 66, 89, 84, 69, 52, 32,
-/* 0x38c0 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x38d0 */  49, 97,102, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x38e0 */  69, 78, 84, 83, 10, 49, 52, 56, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x38f0 */  52, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3900 */  32, 48, 49, 97,102, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3910 */  78, 84, 69, 78, 84, 83, 10, 49, 52, 57, 32, 77, 82, 85, 65, 82,
-/* 0x3920 */  66, 53, 48, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32,
-/* 0x3930 */  48, 32, 32, 48, 49, 97,102, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3940 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 48, 32, 76, 88, 77,
-/* 0x3950 */  82, 85, 48, 56, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x3960 */  32, 32, 48, 32, 32, 48, 49, 98, 48, 48, 32, 32, 50, 42, 42, 48,
-/* 0x3970 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 49, 32, 77,
-/* 0x3980 */  82, 85, 66, 89, 84, 69, 53, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x3990 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 48, 51, 32, 32, 50, 42,
-/* 0x39a0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 50,
-/* 0x39b0 */  32, 77, 82, 85, 65, 82, 66, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x39c0 */  49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 48, 53, 32, 32,
-/* 0x39d0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x39e0 */  53, 51, 32, 77, 82, 85, 66, 73, 84, 83, 53, 32, 32, 32, 32, 32,
-/* 0x39f0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 48, 54,
-/* 0x3a00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3a10 */  10, 49, 53, 52, 32, 77, 82, 85, 65, 82, 66, 55, 48, 32, 32, 32,
-/* 0x3a20 */  32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98,
-/* 0x3a30 */  48, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3a40 */  84, 83, 10, 49, 53, 53, 32, 76, 88, 77, 82, 85, 48, 57, 48, 32,
-/* 0x3a50 */  32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3a60 */  49, 98, 48, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3a70 */  69, 78, 84, 83, 10, 49, 53, 54, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x3a80 */  54, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3a90 */  32, 48, 49, 98, 49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3aa0 */  78, 84, 69, 78, 84, 83, 10, 49, 53, 55, 32, 77, 82, 85, 65, 82,
-/* 0x3ab0 */  66, 56, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32,
-/* 0x3ac0 */  48, 32, 32, 48, 49, 98, 49, 57, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3ad0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 56, 32, 77, 82, 85,
-/* 0x3ae0 */  66, 73, 84, 83, 54, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x3af0 */  32, 32, 48, 32, 32, 48, 49, 98, 49, 97, 32, 32, 50, 42, 42, 48,
-/* 0x3b00 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 57, 32, 77,
-/* 0x3b10 */  82, 85, 65, 82, 66, 57, 48, 32, 32, 32, 32, 32, 32, 48, 52, 32,
-/* 0x3b20 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 49, 99, 32, 32, 50, 42,
-/* 0x3b30 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 48,
-/* 0x3b40 */  32, 76, 88, 77, 82, 85, 49, 48, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3b50 */  49, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 50, 48, 32,
-/* 0x3b60 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3b70 */  49, 54, 49, 32, 76, 88, 85, 78, 70, 48, 52, 48, 32, 32, 32, 32,
-/* 0x3b80 */  32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 51,
-/* 0x3b90 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3ba0 */  83, 10, 49, 54, 50, 32, 76, 88, 77, 82, 85, 49, 49, 48, 32, 32,
-/* 0x3bb0 */  32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3bc0 */  98, 51, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3bd0 */  78, 84, 83, 10, 49, 54, 51, 32, 76, 88, 77, 82, 85, 49, 49, 49,
-/* 0x3be0 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3bf0 */  48, 49, 98, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3c00 */  84, 69, 78, 84, 83, 10, 49, 54, 52, 32, 76, 88, 85, 78, 70, 48,
-/* 0x3c10 */  52, 49, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48,
-/* 0x3c20 */  32, 32, 48, 49, 98, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3c30 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 53, 32, 76, 88, 85, 78,
-/* 0x3c40 */  70, 48, 52, 50, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3c50 */  48, 32, 32, 48, 49, 98, 52, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3c60 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 54, 32, 76, 69, 88,
-/* 0x3c70 */  69, 67, 48, 49, 54, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x3c80 */  32, 32, 48, 32, 32, 48, 49, 98, 52, 49, 32, 32, 50, 42, 42, 48,
-/* 0x3c90 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 55, 32, 76,
-/* 0x3ca0 */  88, 77, 82, 85, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32,
-/* 0x3cb0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 52, 54, 32, 32, 50, 42,
-/* 0x3cc0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 56,
-/* 0x3cd0 */  32, 76, 88, 74, 77, 80, 65, 48, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3ce0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 52, 55, 32, 32,
-/* 0x3cf0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3d00 */  54, 57, 32, 76, 88, 67, 65, 76, 76, 66, 48, 32, 32, 32, 32, 32,
-/* 0x3d10 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 52, 57,
-/* 0x3d20 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3d30 */  10, 49, 55, 48, 32, 76, 88, 85, 78, 70, 48, 50, 49, 32, 32, 32,
-/* 0x3d40 */  32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98,
-/* 0x3d50 */  52, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3d60 */  84, 83, 10, 49, 55, 49, 32, 76, 88, 77, 82, 85, 48, 50, 50, 32,
-/* 0x3d70 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3d80 */  49, 98, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3d90 */  69, 78, 84, 83, 10, 49, 55, 50, 32, 76, 88, 74, 77, 80, 65, 48,
-/* 0x3da0 */  49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3db0 */  32, 48, 49, 98, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3dc0 */  78, 84, 69, 78, 84, 83, 10, 49, 55, 51, 32, 76, 88, 67, 65, 76,
-/* 0x3dd0 */  76, 66, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x3de0 */  48, 32, 32, 48, 49, 98, 53, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3df0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 55, 52, 32, 77, 82, 85,
-/* 0x3e00 */  66, 73, 84, 83, 49, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48,
-/* 0x3e10 */  32, 32, 48, 32, 32, 48, 49, 98, 53, 56, 32, 32, 50, 42, 42, 48,
-/* 0x3e20 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 55, 53, 32, 76,
-/* 0x3e30 */  88, 77, 82, 85, 48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x3e40 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 53, 57, 32, 32, 50, 42,
-/* 0x3e50 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 55, 54,
-/* 0x3e60 */  32, 77, 82, 85, 66, 89, 84, 69, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3e70 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 53, 98, 32, 32,
-/* 0x3e80 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3e90 */  55, 55, 32, 77, 82, 85, 65, 82, 66, 49, 48, 32, 32, 32, 32, 32,
-/* 0x3ea0 */  32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 53,100,
-/* 0x3eb0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3ec0 */  10, 49, 55, 56, 32, 76, 88, 77, 82, 85, 48, 52, 48, 32, 32, 32,
-/* 0x3ed0 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98,
-/* 0x3ee0 */  53,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3ef0 */  84, 83, 10, 49, 55, 57, 32, 76, 88, 85, 78, 70, 48, 51, 48, 32,
-/* 0x3f00 */  32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3f10 */  49, 98, 54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3f20 */  69, 78, 84, 83, 10, 49, 56, 48, 32, 76, 88, 74, 67, 67, 48, 48,
-/* 0x3f30 */  48, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3f40 */  32, 48, 49, 98, 54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3f50 */  78, 84, 69, 78, 84, 83, 10, 49, 56, 49, 32, 76, 88, 67, 74, 48,
-/* 0x3f60 */  77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x3f70 */  48, 32, 32, 48, 49, 98, 54,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3f80 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 56, 50, 32, 76, 88, 67,
-/* 0x3f90 */  74, 49, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x3fa0 */  32, 32, 48, 32, 32, 48, 49, 98, 55, 48, 32, 32, 50, 42, 42, 48,
-/* 0x3fb0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 56, 51, 32, 76,
-/* 0x3fc0 */  88, 67, 65, 76, 74, 77, 80, 32, 32, 32, 32, 32, 32, 48, 51, 32,
-/* 0x3fd0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 55, 51, 32, 32, 50, 42,
-/* 0x3fe0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 56, 52,
-/* 0x3ff0 */  32, 76, 88, 67, 65, 76, 76, 48, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4000 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 55, 54, 32, 32,
-/* 0x4010 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x4020 */  56, 53, 32, 76, 88, 67, 65, 76, 76, 48, 49, 32, 32, 32, 32, 32,
-/* 0x4030 */  32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 55, 56,
-/* 0x4040 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x4050 */  10, 49, 56, 54, 32, 76, 88, 67, 74, 50, 77, 82, 85, 32, 32, 32,
-/* 0x4060 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98,
-/* 0x4070 */  55, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4080 */  84, 83, 10, 49, 56, 55, 32, 76, 88, 67, 74, 52, 77, 82, 85, 32,
-/* 0x4090 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x40a0 */  49, 98, 55,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x40b0 */  69, 78, 84, 83, 10, 49, 56, 56, 32, 76, 88, 67, 74, 54, 77, 82,
-/* 0x40c0 */  85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x40d0 */  32, 48, 49, 98, 55,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x40e0 */  78, 84, 69, 78, 84, 83, 10, 49, 56, 57, 32, 76, 88, 67, 74, 55,
-/* 0x40f0 */  77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x4100 */  48, 32, 32, 48, 49, 98, 56, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x4110 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 57, 48, 32, 76, 88, 67,
-/* 0x4120 */  74, 56, 77, 82, 85, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48,
-/* 0x4130 */  32, 32, 48, 32, 32, 48, 49, 98, 56, 51, 32, 32, 50, 42, 42, 48,
-/* 0x4140 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 57, 49, 32, 76,
-/* 0x4150 */  88, 85, 78, 70, 48, 51, 52, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x4160 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 56, 54, 32, 32, 50, 42,
-/* 0x4170 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 57, 50,
-/* 0x4180 */  32, 76, 88, 77, 82, 85, 48, 53, 53, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4190 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 56, 98, 32, 32,
-/* 0x41a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x41b0 */  57, 51, 32, 77, 82, 85, 66, 89, 84, 69, 50, 32, 32, 32, 32, 32,
-/* 0x41c0 */  32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 56,100,
-/* 0x41d0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x41e0 */  10, 49, 57, 52, 32, 77, 82, 85, 66, 73, 84, 83, 50, 32, 32, 32,
-/* 0x41f0 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98,
-/* 0x4200 */  57, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x4210 */  84, 83, 10, 49, 57, 53, 32, 77, 82, 85, 65, 82, 66, 50, 48, 32,
-/* 0x4220 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x4230 */  49, 98, 57, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x4240 */  69, 78, 84, 83, 10, 49, 57, 54, 32, 76, 88, 77, 82, 85, 48, 53,
-/* 0x4250 */  55, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32,
-/* 0x4260 */  32, 48, 49, 98, 57, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x4270 */  78, 84, 69, 78, 84, 83, 10, 49, 57, 55, 32, 76, 88, 77, 82, 85,
-/* 0x4280 */  48, 53, 56, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32,
-/* 0x4290 */  48, 32, 32, 48, 49, 98, 97, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x42a0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 57, 56, 32, 76, 88, 85,
-/* 0x42b0 */  78, 70, 48, 51, 53, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48,
-/* 0x42c0 */  32, 32, 48, 32, 32, 48, 49, 98, 97, 51, 32, 32, 50, 42, 42, 48,
-/* 0x42d0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 57, 57, 32, 76,
-/* 0x42e0 */  88, 80, 84, 73, 49, 52, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32,
-/* 0x42f0 */  48, 32, 32, 48, 32, 32, 48, 49, 98, 97, 57, 32, 32, 50, 42, 42,
-/* 0x4300 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 50, 48, 48, 32,
-/* 0x4310 */  76, 88, 80, 84, 73, 49, 52, 49, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x4320 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 97, 57, 32, 32, 50, 42,
-/* 0x4330 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 50, 48, 49,
-/* 0x4340 */  32, 76, 88, 80, 84, 73, 49, 53, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x4350 */ 100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 97, 57, 32, 32,
-/* 0x4360 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 50,
-/* 0x4370 */  48, 50, 32, 99,116,111,107, 51, 50, 46, 48, 48, 32, 32, 32, 32,
-/* 0x4380 */  32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 98, 54,
-/* 0x4390 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x43a0 */  10, 50, 48, 51, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 32,
-/* 0x43b0 */  32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98,
-/* 0x43c0 */  98,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x43d0 */  84, 83, 10, 50, 48, 52, 32, 99,116,111,107, 51, 50, 46, 50, 48,
-/* 0x43e0 */  32, 32, 32, 32, 32, 48, 50, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x43f0 */  48, 49, 98, 99, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x4400 */  84, 69, 78, 84, 83, 10, 50, 48, 53, 32, 99,116,111,107, 51, 50,
-/* 0x4410 */  46, 51, 48, 32, 32, 32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48,
-/* 0x4420 */  32, 32, 48, 49, 98,101, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x4430 */  79, 78, 84, 69, 78, 84, 83, 10, 50, 48, 54, 32, 99,116,111,107,
-/* 0x4440 */  51, 50, 46, 52, 48, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x4450 */  32, 48, 32, 32, 48, 49, 98,102, 53, 32, 32, 50, 42, 42, 48, 32,
-/* 0x4460 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 50, 48, 55, 32, 76, 88,
-/* 0x4470 */  80, 84, 73, 49, 54, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x4480 */  48, 32, 32, 48, 32, 32, 48, 49, 98,102, 97, 32, 32, 50, 42, 42,
-/* 0x4490 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 50, 48, 56, 32,
-/* 0x44a0 */  76, 88, 80, 84, 73, 50, 48, 48, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x44b0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 98,102, 99, 32, 32, 50, 42,
-/* 0x44c0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77,
-/* 0x44d0 */  66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48,
-/* 0x44e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 80, 84,
-/* 0x44f0 */  73, 48, 48, 48, 32, 48, 32, 76, 88, 80, 84, 73, 48, 48, 48, 10,
-/* 0x4500 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4510 */  32, 76, 88, 80, 84, 73, 48, 52, 48, 32, 48, 32, 76, 88, 80, 84,
-/* 0x4520 */  73, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4530 */  32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73, 48, 52, 49, 32, 48,
-/* 0x4540 */  32, 76, 88, 80, 84, 73, 48, 52, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4550 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73,
-/* 0x4560 */  48, 52, 50, 32, 48, 32, 76, 88, 80, 84, 73, 48, 52, 50, 10, 48,
-/* 0x4570 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4580 */  76, 88, 80, 84, 73, 48, 52, 51, 32, 48, 32, 76, 88, 80, 84, 73,
-/* 0x4590 */  48, 52, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x45a0 */  32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32, 48, 32,
-/* 0x45b0 */  78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x45c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x45d0 */  49, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 48, 48,
-/* 0x45e0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x45f0 */  50, 66, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x4600 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4610 */  32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 48, 32, 78,
-/* 0x4620 */  50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4630 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 51,
-/* 0x4640 */  48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x4650 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4660 */  66, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 53,
-/* 0x4670 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4680 */ 100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 48, 32, 78, 50,
-/* 0x4690 */  66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x46a0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48,
-/* 0x46b0 */  32, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48,
-/* 0x46c0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x46d0 */  83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 49, 48,
-/* 0x46e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x46f0 */  32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 68,
-/* 0x4700 */  70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4710 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32,
-/* 0x4720 */  48, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4730 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68,
-/* 0x4740 */  69, 67, 50, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10,
-/* 0x4750 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4760 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 68, 68,
-/* 0x4770 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4780 */  32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 32, 48,
-/* 0x4790 */  32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x47a0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65,
-/* 0x47b0 */  83, 54, 49, 32, 48, 32, 78, 50, 68, 70, 65, 83, 54, 49, 10, 48,
-/* 0x47c0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x47d0 */  78, 50, 68, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 68, 68, 69,
-/* 0x47e0 */  67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x47f0 */  32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32, 48, 32,
-/* 0x4800 */  78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4810 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x4820 */  49, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 48, 48,
-/* 0x4830 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x4840 */  50, 69, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67,
-/* 0x4850 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4860 */  32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 32, 48, 32, 78,
-/* 0x4870 */  50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4880 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x4890 */  48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48,
-/* 0x48a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x48b0 */  69, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 53,
-/* 0x48c0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x48d0 */ 100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 48, 32, 78, 50,
-/* 0x48e0 */  69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x48f0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48,
-/* 0x4900 */  32, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48,
-/* 0x4910 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49,
-/* 0x4920 */  82, 76, 79, 65, 68, 32, 48, 32, 67, 76, 49, 82, 76, 79, 65, 68,
-/* 0x4930 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4940 */  32, 32, 67, 76, 49, 87, 73, 68, 48, 49, 32, 48, 32, 67, 76, 49,
-/* 0x4950 */  87, 73, 68, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4960 */  32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 48, 54, 32,
-/* 0x4970 */  48, 32, 67, 76, 49, 87, 73, 68, 48, 54, 10, 48, 48, 48, 48, 48,
-/* 0x4980 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87,
-/* 0x4990 */  73, 68, 48, 56, 32, 48, 32, 67, 76, 49, 87, 73, 68, 48, 56, 10,
-/* 0x49a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x49b0 */  32, 67, 76, 49, 87, 73, 68, 49, 48, 32, 48, 32, 67, 76, 49, 87,
-/* 0x49c0 */  73, 68, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x49d0 */  32, 32, 32,100, 32, 32, 67, 76, 49, 83, 84, 65, 82, 84, 32, 48,
-/* 0x49e0 */  32, 67, 76, 49, 83, 84, 65, 82, 84, 10, 48, 48, 48, 48, 48, 48,
-/* 0x49f0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79,
-/* 0x4a00 */  80, 48, 48, 32, 48, 32, 67, 76, 49, 84, 79, 80, 48, 48, 10, 48,
-/* 0x4a10 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4a20 */  67, 76, 49, 84, 79, 80, 48, 54, 32, 48, 32, 67, 76, 49, 84, 79,
-/* 0x4a30 */  80, 48, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4a40 */  32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 32, 48, 32,
-/* 0x4a50 */  67, 76, 49, 84, 79, 80, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a60 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 76, 69, 78,
-/* 0x4a70 */  48, 48, 32, 48, 32, 67, 76, 49, 76, 69, 78, 48, 48, 10, 48, 48,
-/* 0x4a80 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x4a90 */  76, 49, 67, 79, 80, 89, 48, 32, 48, 32, 67, 76, 49, 67, 79, 80,
-/* 0x4aa0 */  89, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4ab0 */  32,100, 32, 32, 76, 88, 80, 84, 73, 48, 57, 49, 32, 48, 32, 76,
-/* 0x4ac0 */  88, 80, 84, 73, 48, 57, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4ad0 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48,
-/* 0x4ae0 */  48, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48,
-/* 0x4af0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x4b00 */  76, 76, 84, 82, 49, 48, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x4b10 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4b20 */ 100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32, 48, 32, 67, 65,
-/* 0x4b30 */  76, 76, 84, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4b40 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51,
-/* 0x4b50 */  32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 48, 48, 48, 48,
-/* 0x4b60 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x4b70 */  78, 70, 48, 49, 48, 32, 48, 32, 76, 88, 85, 78, 70, 48, 49, 48,
-/* 0x4b80 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4b90 */  32, 32, 76, 88, 74, 67, 67, 48, 49, 48, 32, 48, 32, 76, 88, 74,
-/* 0x4ba0 */  67, 67, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4bb0 */  32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 32,
-/* 0x4bc0 */  48, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 48, 48, 48, 48, 48,
-/* 0x4bd0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x4be0 */  85, 48, 55, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 55, 48, 10,
-/* 0x4bf0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4c00 */  32, 76, 88, 77, 82, 85, 49, 48, 48, 32, 48, 32, 76, 88, 77, 82,
-/* 0x4c10 */  85, 49, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4c20 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 32, 48,
-/* 0x4c30 */  32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4c40 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70,
-/* 0x4c50 */  48, 52, 50, 32, 48, 32, 76, 88, 85, 78, 70, 48, 52, 50, 10, 48,
-/* 0x4c60 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4c70 */  76, 88, 77, 82, 85, 48, 51, 48, 32, 48, 32, 76, 88, 77, 82, 85,
-/* 0x4c80 */  48, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4c90 */  32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 48, 32, 48, 32,
-/* 0x4ca0 */  76, 88, 85, 78, 70, 48, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4cb0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 56, 77,
-/* 0x4cc0 */  82, 85, 32, 48, 32, 76, 88, 67, 74, 56, 77, 82, 85, 10, 48, 48,
-/* 0x4cd0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4ce0 */  88, 85, 78, 70, 48, 51, 52, 32, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x4cf0 */  51, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4d00 */  32,100, 32, 32, 76, 88, 80, 84, 73, 49, 52, 48, 32, 48, 32, 76,
-/* 0x4d10 */  88, 80, 84, 73, 49, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d20 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73, 49, 52,
-/* 0x4d30 */  49, 32, 48, 32, 76, 88, 80, 84, 73, 49, 52, 49, 10, 48, 48, 48,
-/* 0x4d40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,
-/* 0x4d50 */ 111,107, 51, 50, 46, 48, 48, 32, 48, 32, 99,116,111,107, 51, 50,
-/* 0x4d60 */  46, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4d70 */  32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 48,
-/* 0x4d80 */  32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4d90 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107,
-/* 0x4da0 */  51, 50, 46, 50, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 50,
-/* 0x4db0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4dc0 */ 100, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 48, 32, 99,
-/* 0x4dd0 */ 116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4de0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73, 50,
-/* 0x4df0 */  48, 48, 32, 48, 32, 76, 88, 80, 84, 73, 50, 48, 48, 10, 48, 48,
-/* 0x4e00 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4e10 */  88, 80, 84, 73, 48, 53, 48, 32, 48, 32, 76, 88, 80, 84, 73, 48,
-/* 0x4e20 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4e30 */  32,100, 32, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 48, 32, 78,
-/* 0x4e40 */  50, 66, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4e50 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 50,
-/* 0x4e60 */  48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 50, 48, 10, 48, 48, 48,
-/* 0x4e70 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4e80 */  66, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 50,
-/* 0x4e90 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4ea0 */ 100, 32, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50,
-/* 0x4eb0 */  66, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4ec0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 51, 48,
-/* 0x4ed0 */  32, 48, 32, 78, 50, 66, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48,
-/* 0x4ee0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x4ef0 */  83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x4f00 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4f10 */  32, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 66,
-/* 0x4f20 */  70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4f30 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32,
-/* 0x4f40 */  48, 32, 78, 50, 66, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4f50 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x4f60 */  65, 83, 53, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 53, 48, 10,
-/* 0x4f70 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4f80 */  32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 66, 83,
-/* 0x4f90 */  77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4fa0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32, 48,
-/* 0x4fb0 */  32, 78, 50, 66, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4fc0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65,
-/* 0x4fd0 */  83, 49, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 48, 10, 48,
-/* 0x4fe0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4ff0 */  78, 50, 68, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 68, 83, 77,
-/* 0x5000 */  65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5010 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 48, 32,
-/* 0x5020 */  78, 50, 68, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5030 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65,
-/* 0x5040 */  51, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 51, 48, 10, 48, 48,
-/* 0x5050 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x5060 */  50, 68, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x5070 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5080 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 48, 32, 78,
-/* 0x5090 */  50, 68, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x50a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 52,
-/* 0x50b0 */  48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 52, 48, 10, 48, 48, 48,
-/* 0x50c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x50d0 */  68, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 53,
-/* 0x50e0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x50f0 */ 100, 32, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50,
-/* 0x5100 */  68, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5110 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 54, 48,
-/* 0x5120 */  32, 48, 32, 78, 50, 68, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48,
-/* 0x5130 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x5140 */  70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 54, 48,
-/* 0x5150 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5160 */  32, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 69,
-/* 0x5170 */  70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5180 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32,
-/* 0x5190 */  48, 32, 78, 50, 69, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x51a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x51b0 */  65, 83, 50, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 50, 48, 10,
-/* 0x51c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x51d0 */  32, 78, 50, 69, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 69, 83,
-/* 0x51e0 */  77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x51f0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 48,
-/* 0x5200 */  32, 78, 50, 69, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5210 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77,
-/* 0x5220 */  65, 52, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 52, 48, 10, 48,
-/* 0x5230 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5240 */  78, 50, 69, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 69, 70, 65,
-/* 0x5250 */  83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5260 */  32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 48, 32,
-/* 0x5270 */  78, 50, 69, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5280 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x5290 */  53, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 53, 48, 10, 48, 48,
-/* 0x52a0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x52b0 */  50, 69, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x52c0 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x52d0 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 48, 32, 78,
-/* 0x52e0 */  50, 69, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x52f0 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 83, 77, 65, 49,
-/* 0x5300 */  66, 32, 48, 32, 67, 76, 49, 83, 77, 65, 49, 66, 10, 48, 48, 48,
-/* 0x5310 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x5320 */  49, 70, 65, 83, 49, 66, 32, 48, 32, 67, 76, 49, 70, 65, 83, 49,
-/* 0x5330 */  66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5340 */ 100, 32, 32, 67, 76, 49, 71, 69, 84, 49, 66, 32, 48, 32, 67, 76,
-/* 0x5350 */  49, 71, 69, 84, 49, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5360 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 69, 78, 84, 69, 82,
-/* 0x5370 */  32, 48, 32, 67, 76, 49, 69, 78, 84, 69, 82, 10, 48, 48, 48, 48,
-/* 0x5380 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49,
-/* 0x5390 */  83, 77, 65, 49, 48, 32, 48, 32, 67, 76, 49, 83, 77, 65, 49, 48,
-/* 0x53a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x53b0 */  32, 32, 67, 76, 49, 87, 73, 68, 48, 50, 32, 48, 32, 67, 76, 49,
-/* 0x53c0 */  87, 73, 68, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x53d0 */  32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 48, 51, 32,
-/* 0x53e0 */  48, 32, 67, 76, 49, 87, 73, 68, 48, 51, 10, 48, 48, 48, 48, 48,
-/* 0x53f0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87,
-/* 0x5400 */  73, 68, 48, 52, 32, 48, 32, 67, 76, 49, 87, 73, 68, 48, 52, 10,
-/* 0x5410 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5420 */  32, 67, 76, 49, 87, 73, 68, 48, 53, 32, 48, 32, 67, 76, 49, 87,
-/* 0x5430 */  73, 68, 48, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5440 */  32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 48, 55, 32, 48,
-/* 0x5450 */  32, 67, 76, 49, 87, 73, 68, 48, 55, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5460 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73,
-/* 0x5470 */  68, 48, 57, 32, 48, 32, 67, 76, 49, 87, 73, 68, 48, 57, 10, 48,
-/* 0x5480 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5490 */  67, 76, 49, 84, 79, 80, 48, 49, 32, 48, 32, 67, 76, 49, 84, 79,
-/* 0x54a0 */  80, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x54b0 */  32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48, 50, 32, 48, 32,
-/* 0x54c0 */  67, 76, 49, 84, 79, 80, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x54d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80,
-/* 0x54e0 */  48, 51, 32, 48, 32, 67, 76, 49, 84, 79, 80, 48, 51, 10, 48, 48,
-/* 0x54f0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x5500 */  76, 49, 84, 79, 80, 48, 52, 32, 48, 32, 67, 76, 49, 84, 79, 80,
-/* 0x5510 */  48, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5520 */  32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48, 53, 32, 48, 32, 67,
-/* 0x5530 */  76, 49, 84, 79, 80, 48, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5540 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 79, 70, 70, 48,
-/* 0x5550 */  49, 32, 48, 32, 67, 76, 49, 79, 70, 70, 48, 49, 10, 48, 48, 48,
-/* 0x5560 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x5570 */  49, 79, 70, 70, 48, 50, 32, 48, 32, 67, 76, 49, 79, 70, 70, 48,
-/* 0x5580 */  50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5590 */ 100, 32, 32, 67, 76, 49, 79, 70, 70, 48, 51, 32, 48, 32, 67, 76,
-/* 0x55a0 */  49, 79, 70, 70, 48, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x55b0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 79, 70, 70, 48, 52,
-/* 0x55c0 */  32, 48, 32, 67, 76, 49, 79, 70, 70, 48, 52, 10, 48, 48, 48, 48,
-/* 0x55d0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49,
-/* 0x55e0 */  76, 69, 78, 48, 49, 32, 48, 32, 67, 76, 49, 76, 69, 78, 48, 49,
-/* 0x55f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5600 */  32, 32, 67, 76, 49, 76, 69, 78, 48, 50, 32, 48, 32, 67, 76, 49,
-/* 0x5610 */  76, 69, 78, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5620 */  32, 32, 32, 32,100, 32, 32, 67, 76, 49, 69, 78, 68, 32, 48, 32,
-/* 0x5630 */  67, 76, 49, 69, 78, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5640 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x5650 */  48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 10,
-/* 0x5660 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5670 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90,
-/* 0x5680 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5690 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x56a0 */  69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49,
-/* 0x56b0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x56c0 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32,
-/* 0x56d0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x56e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x56f0 */  95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x5700 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5710 */  32, 32,100, 32, 32, 76, 88, 80, 84, 73, 48, 57, 48, 32, 48, 32,
-/* 0x5720 */  76, 88, 80, 84, 73, 48, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5730 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86,
-/* 0x5740 */  69, 49, 32, 48, 32, 67, 84, 67, 76, 69, 86, 69, 49, 10, 48, 48,
-/* 0x5750 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x5760 */  65, 76, 76, 84, 82, 48, 49, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x5770 */  48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5780 */  32,100, 32, 32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 48, 32, 67,
-/* 0x5790 */  84, 66, 83, 72, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x57a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 48,
-/* 0x57b0 */  49, 32, 48, 32, 67, 84, 66, 82, 79, 82, 48, 49, 10, 48, 48, 48,
-/* 0x57c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x57d0 */  66, 83, 87, 65, 48, 49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 48,
-/* 0x57e0 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x57f0 */ 100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 48, 32, 67, 65,
-/* 0x5800 */  76, 76, 84, 82, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5810 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 56,
-/* 0x5820 */  32, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 10, 48, 48, 48, 48,
-/* 0x5830 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76,
-/* 0x5840 */  76, 84, 82, 69, 57, 32, 48, 32, 67, 65, 76, 76, 84, 82, 69, 57,
-/* 0x5850 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5860 */  32, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 48, 32, 67, 84, 67,
-/* 0x5870 */  76, 69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5880 */  32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32,
-/* 0x5890 */  48, 32, 67, 65, 76, 76, 84, 82, 49, 50, 10, 48, 48, 48, 48, 48,
-/* 0x58a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83,
-/* 0x58b0 */  72, 82, 49, 49, 32, 48, 32, 67, 84, 66, 83, 72, 82, 49, 49, 10,
-/* 0x58c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x58d0 */  32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 48, 32, 67, 84, 66, 82,
-/* 0x58e0 */  79, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x58f0 */  32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 48,
-/* 0x5900 */  32, 67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5910 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70,
-/* 0x5920 */  48, 48, 48, 32, 48, 32, 76, 88, 85, 78, 70, 48, 48, 48, 10, 48,
-/* 0x5930 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5940 */  76, 88, 85, 78, 70, 48, 48, 50, 32, 48, 32, 76, 88, 85, 78, 70,
-/* 0x5950 */  48, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5960 */  32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 48, 32, 48, 32,
-/* 0x5970 */  77, 82, 85, 66, 89, 84, 69, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5980 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x5990 */  48, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48, 48, 53, 10, 48, 48,
-/* 0x59a0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x59b0 */  88, 77, 82, 85, 48, 48, 54, 32, 48, 32, 76, 88, 77, 82, 85, 48,
-/* 0x59c0 */  48, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x59d0 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 48, 55, 32, 48, 32, 76,
-/* 0x59e0 */  88, 77, 82, 85, 48, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x59f0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 48,
-/* 0x5a00 */  56, 32, 48, 32, 76, 88, 85, 78, 70, 48, 48, 56, 10, 48, 48, 48,
-/* 0x5a10 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x5a20 */  77, 82, 85, 48, 52, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48, 52,
-/* 0x5a30 */  53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5a40 */ 100, 32, 32, 76, 88, 77, 82, 85, 48, 52, 54, 32, 48, 32, 76, 88,
-/* 0x5a50 */  77, 82, 85, 48, 52, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5a60 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 48,
-/* 0x5a70 */  32, 48, 32, 76, 88, 74, 67, 67, 48, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5a80 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74,
-/* 0x5a90 */  67, 67, 48, 50, 49, 32, 48, 32, 76, 88, 74, 67, 67, 48, 50, 49,
-/* 0x5aa0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5ab0 */  32, 32, 76, 88, 74, 67, 67, 48, 50, 51, 32, 48, 32, 76, 88, 74,
-/* 0x5ac0 */  67, 67, 48, 50, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5ad0 */  32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51, 56, 54, 32,
-/* 0x5ae0 */  48, 32, 76, 88, 85, 78, 70, 51, 56, 54, 10, 48, 48, 48, 48, 48,
-/* 0x5af0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x5b00 */  70, 51, 56, 55, 32, 48, 32, 76, 88, 85, 78, 70, 51, 56, 55, 10,
-/* 0x5b10 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5b20 */  32, 76, 88, 85, 78, 70, 51, 56, 56, 32, 48, 32, 76, 88, 85, 78,
-/* 0x5b30 */  70, 51, 56, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5b40 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 52, 56, 54, 32, 48,
-/* 0x5b50 */  32, 76, 88, 85, 78, 70, 52, 56, 54, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5b60 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70,
-/* 0x5b70 */  52, 56, 55, 32, 48, 32, 76, 88, 85, 78, 70, 52, 56, 55, 10, 48,
-/* 0x5b80 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5b90 */  76, 88, 77, 82, 85, 48, 54, 53, 32, 48, 32, 76, 88, 77, 82, 85,
-/* 0x5ba0 */  48, 54, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5bb0 */  32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 51, 32, 48, 32,
-/* 0x5bc0 */  77, 82, 85, 66, 89, 84, 69, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5bd0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66,
-/* 0x5be0 */  51, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 51, 48, 10, 48, 48,
-/* 0x5bf0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77,
-/* 0x5c00 */  82, 85, 66, 73, 84, 83, 51, 32, 48, 32, 77, 82, 85, 66, 73, 84,
-/* 0x5c10 */  83, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5c20 */  32,100, 32, 32, 77, 82, 85, 65, 82, 66, 52, 48, 32, 48, 32, 77,
-/* 0x5c30 */  82, 85, 65, 82, 66, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5c40 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x5c50 */  52, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 52, 10, 48, 48, 48,
-/* 0x5c60 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x5c70 */  85, 66, 73, 84, 83, 52, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83,
-/* 0x5c80 */  52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5c90 */ 100, 32, 32, 77, 82, 85, 65, 82, 66, 53, 48, 32, 48, 32, 77, 82,
-/* 0x5ca0 */  85, 65, 82, 66, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5cb0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 56, 48,
-/* 0x5cc0 */  32, 48, 32, 76, 88, 77, 82, 85, 48, 56, 48, 10, 48, 48, 48, 48,
-/* 0x5cd0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x5ce0 */  66, 89, 84, 69, 53, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 53,
-/* 0x5cf0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5d00 */  32, 32, 77, 82, 85, 65, 82, 66, 54, 48, 32, 48, 32, 77, 82, 85,
-/* 0x5d10 */  65, 82, 66, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5d20 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 53, 32,
-/* 0x5d30 */  48, 32, 77, 82, 85, 66, 73, 84, 83, 53, 10, 48, 48, 48, 48, 48,
-/* 0x5d40 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65,
-/* 0x5d50 */  82, 66, 55, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 55, 48, 10,
-/* 0x5d60 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5d70 */  32, 76, 88, 77, 82, 85, 48, 57, 48, 32, 48, 32, 76, 88, 77, 82,
-/* 0x5d80 */  85, 48, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5d90 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 54, 32, 48,
-/* 0x5da0 */  32, 77, 82, 85, 66, 89, 84, 69, 54, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5db0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82,
-/* 0x5dc0 */  66, 56, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 56, 48, 10, 48,
-/* 0x5dd0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x5de0 */  77, 82, 85, 66, 73, 84, 83, 54, 32, 48, 32, 77, 82, 85, 66, 73,
-/* 0x5df0 */  84, 83, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5e00 */  32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 57, 48, 32, 48, 32,
-/* 0x5e10 */  77, 82, 85, 65, 82, 66, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5e20 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 49,
-/* 0x5e30 */  49, 48, 32, 48, 32, 76, 88, 77, 82, 85, 49, 49, 48, 10, 48, 48,
-/* 0x5e40 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x5e50 */  88, 77, 82, 85, 49, 49, 49, 32, 48, 32, 76, 88, 77, 82, 85, 49,
-/* 0x5e60 */  49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5e70 */  32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 49, 32, 48, 32, 76,
-/* 0x5e80 */  88, 85, 78, 70, 48, 52, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5e90 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49,
-/* 0x5ea0 */  54, 32, 48, 32, 76, 69, 88, 69, 67, 48, 49, 54, 10, 48, 48, 48,
-/* 0x5eb0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x5ec0 */  77, 82, 85, 48, 49, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 49,
-/* 0x5ed0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5ee0 */ 100, 32, 32, 76, 88, 74, 77, 80, 65, 48, 48, 32, 48, 32, 76, 88,
-/* 0x5ef0 */  74, 77, 80, 65, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5f00 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 66, 48,
-/* 0x5f10 */  32, 48, 32, 76, 88, 67, 65, 76, 76, 66, 48, 10, 48, 48, 48, 48,
-/* 0x5f20 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x5f30 */  78, 70, 48, 50, 49, 32, 48, 32, 76, 88, 85, 78, 70, 48, 50, 49,
-/* 0x5f40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5f50 */  32, 32, 76, 88, 77, 82, 85, 48, 50, 50, 32, 48, 32, 76, 88, 77,
-/* 0x5f60 */  82, 85, 48, 50, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5f70 */  32, 32, 32, 32,100, 32, 32, 76, 88, 74, 77, 80, 65, 48, 49, 32,
-/* 0x5f80 */  48, 32, 76, 88, 74, 77, 80, 65, 48, 49, 10, 48, 48, 48, 48, 48,
-/* 0x5f90 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65,
-/* 0x5fa0 */  76, 76, 66, 49, 32, 48, 32, 76, 88, 67, 65, 76, 76, 66, 49, 10,
-/* 0x5fb0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5fc0 */  32, 77, 82, 85, 66, 73, 84, 83, 49, 32, 48, 32, 77, 82, 85, 66,
-/* 0x5fd0 */  73, 84, 83, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5fe0 */  32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 49, 32, 48,
-/* 0x5ff0 */  32, 77, 82, 85, 66, 89, 84, 69, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6000 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82,
-/* 0x6010 */  66, 49, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 49, 48, 10, 48,
-/* 0x6020 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6030 */  76, 88, 77, 82, 85, 48, 52, 48, 32, 48, 32, 76, 88, 77, 82, 85,
-/* 0x6040 */  48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x6050 */  32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 48, 48, 32, 48, 32,
-/* 0x6060 */  76, 88, 74, 67, 67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6070 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 48, 77,
-/* 0x6080 */  82, 85, 32, 48, 32, 76, 88, 67, 74, 48, 77, 82, 85, 10, 48, 48,
-/* 0x6090 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x60a0 */  88, 67, 74, 49, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 49, 77,
-/* 0x60b0 */  82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x60c0 */  32,100, 32, 32, 76, 88, 67, 65, 76, 74, 77, 80, 32, 48, 32, 76,
-/* 0x60d0 */  88, 67, 65, 76, 74, 77, 80, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x60e0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 48,
-/* 0x60f0 */  48, 32, 48, 32, 76, 88, 67, 65, 76, 76, 48, 48, 10, 48, 48, 48,
-/* 0x6100 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x6110 */  67, 65, 76, 76, 48, 49, 32, 48, 32, 76, 88, 67, 65, 76, 76, 48,
-/* 0x6120 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x6130 */ 100, 32, 32, 76, 88, 67, 74, 50, 77, 82, 85, 32, 48, 32, 76, 88,
-/* 0x6140 */  67, 74, 50, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x6150 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 52, 77, 82, 85,
-/* 0x6160 */  32, 48, 32, 76, 88, 67, 74, 52, 77, 82, 85, 10, 48, 48, 48, 48,
-/* 0x6170 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67,
-/* 0x6180 */  74, 54, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 54, 77, 82, 85,
-/* 0x6190 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x61a0 */  32, 32, 76, 88, 67, 74, 55, 77, 82, 85, 32, 48, 32, 76, 88, 67,
-/* 0x61b0 */  74, 55, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x61c0 */  32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 53, 53, 32,
-/* 0x61d0 */  48, 32, 76, 88, 77, 82, 85, 48, 53, 53, 10, 48, 48, 48, 48, 48,
-/* 0x61e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66,
-/* 0x61f0 */  89, 84, 69, 50, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 50, 10,
-/* 0x6200 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x6210 */  32, 77, 82, 85, 66, 73, 84, 83, 50, 32, 48, 32, 77, 82, 85, 66,
-/* 0x6220 */  73, 84, 83, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6230 */  32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 50, 48, 32, 48,
-/* 0x6240 */  32, 77, 82, 85, 65, 82, 66, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6250 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x6260 */  48, 53, 55, 32, 48, 32, 76, 88, 77, 82, 85, 48, 53, 55, 10, 48,
-/* 0x6270 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x6280 */  76, 88, 77, 82, 85, 48, 53, 56, 32, 48, 32, 76, 88, 77, 82, 85,
-/* 0x6290 */  48, 53, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x62a0 */  32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 51, 53, 32, 48, 32,
-/* 0x62b0 */  76, 88, 85, 78, 70, 48, 51, 53, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x62c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73, 49,
-/* 0x62d0 */  53, 48, 32, 48, 32, 76, 88, 80, 84, 73, 49, 53, 48, 10, 48, 48,
-/* 0x62e0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,
-/* 0x62f0 */ 116,111,107, 51, 50, 46, 51, 48, 32, 48, 32, 99,116,111,107, 51,
-/* 0x6300 */  50, 46, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x6310 */  32, 32, 32,100, 32, 32, 76, 88, 80, 84, 73, 49, 54, 48, 32, 48,
-/* 0x6320 */  32, 76, 88, 80, 84, 73, 49, 54, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6330 */  48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 88, 80, 84, 73,
-/* 0x6340 */  48, 48, 48, 32, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48,
-/* 0x6350 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x6360 */  78, 68, 42, 32, 48, 32,108,122,109, 97, 95,115,116, 97, 99,107,
-/* 0x6370 */  95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6380 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x6390 */  32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x63a0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x63b0 */  68, 42, 32, 48, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10,
-/* 0x63c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63d0 */  32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,112,114,
-/* 0x63e0 */ 111,112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x63f0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x6400 */  48, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10,
-/* 0x6410 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6420 */  32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,114, 95,
-/* 0x6430 */  99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x6440 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 78, 77, 82,
-/* 0x6450 */  85, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6460 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 80, 84, 73,
-/* 0x6470 */  48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6480 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6490 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32,
-/* 0x64a0 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64b0 */  32, 32, 76, 88, 80, 84, 73, 49, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x64c0 */  48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x64d0 */  32, 32, 32, 32, 32, 32, 76, 88, 80, 84, 73, 49, 52, 49, 10, 48,
-/* 0x64e0 */  48, 48, 48, 48, 48, 49,100, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x64f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 80, 84, 73, 48,
-/* 0x6500 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 50, 53, 32, 82, 95, 51, 56,
-/* 0x6510 */  54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x6520 */  80, 84, 73, 50, 48, 48, 10, 48, 48, 48, 48, 48, 48, 50,101, 32,
-/* 0x6530 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6540 */  32, 32, 76, 88, 80, 84, 73, 48, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x6550 */  48, 51, 57, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x6560 */  32, 32, 32, 32, 32, 32, 76, 88, 80, 84, 73, 48, 52, 49, 10, 48,
-/* 0x6570 */  48, 48, 48, 48, 48, 52, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x6580 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 80, 84, 73, 48,
-/* 0x6590 */  52, 50, 10, 48, 48, 48, 48, 48, 48, 52,102, 32, 82, 95, 51, 56,
-/* 0x65a0 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x65b0 */  80, 84, 73, 48, 52, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x65c0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x65d0 */  78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x65e0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x65f0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6600 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6610 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10,
-/* 0x6620 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6630 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 49,
-/* 0x6640 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6650 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6660 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x6670 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6680 */  78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6690 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x66a0 */  32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70,
-/* 0x66b0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x66c0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x66d0 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x66e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83, 77, 65, 49,
-/* 0x66f0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6700 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65,
-/* 0x6710 */  83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6720 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6730 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32,
-/* 0x6740 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6750 */  32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79,
-/* 0x6760 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6770 */  79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93, 58, 10, 79,
-/* 0x6780 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6790 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x67a0 */  48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x67b0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x67c0 */  67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x67d0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x67e0 */  70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x67f0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6800 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6810 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6820 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x6830 */  48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6840 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48,
-/* 0x6850 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6860 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 68, 69, 67,
-/* 0x6870 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6880 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6890 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32, 82,
-/* 0x68a0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x68b0 */  32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x68c0 */  50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x68d0 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 10, 82,
-/* 0x68e0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x68f0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 52, 48, 93,
-/* 0x6900 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6910 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6920 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56,
-/* 0x6930 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x6940 */  66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6950 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6960 */  78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6970 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6980 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6990 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x69a0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10,
-/* 0x69b0 */  48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x69c0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x69d0 */  67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x69e0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x69f0 */  83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6a00 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a10 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6a20 */  56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x6a30 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x6a40 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6a50 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 48, 93, 58,
-/* 0x6a60 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6a70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6a80 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54,
-/* 0x6a90 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x6aa0 */  70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82,
-/* 0x6ab0 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ac0 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6ad0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6ae0 */  82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70,
-/* 0x6af0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6b00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6b10 */  48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6b20 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x6b30 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6b40 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83,
-/* 0x6b50 */  77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6b60 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6b70 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x6b80 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6b90 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x6ba0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6bb0 */  70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48, 93, 58, 10,
-/* 0x6bc0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6bd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6be0 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6bf0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x6c00 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x6c10 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x6c20 */  68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x6c30 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c40 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6c50 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6c60 */  32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 10, 82,
-/* 0x6c70 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6c80 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 50, 48, 93,
-/* 0x6c90 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6ca0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6cb0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56,
-/* 0x6cc0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x6cd0 */  68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6ce0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6cf0 */  78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6d00 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6d10 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6d20 */  48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6d30 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10,
-/* 0x6d40 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6d50 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 51,
-/* 0x6d60 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6d70 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6d80 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95,
-/* 0x6d90 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6da0 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6db0 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6dc0 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69,
-/* 0x6dd0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6de0 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51, 48, 93, 58,
-/* 0x6df0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6e00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6e10 */  69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54,
-/* 0x6e20 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x6e30 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32, 82,
-/* 0x6e40 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e50 */  32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x6e60 */  52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x6e70 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 10, 82,
-/* 0x6e80 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x6e90 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 52, 48, 93,
-/* 0x6ea0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x6eb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x6ec0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56,
-/* 0x6ed0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x6ee0 */  68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6ef0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6f00 */  78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x6f10 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f20 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x6f30 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6f40 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10,
-/* 0x6f50 */  48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6f60 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x6f70 */  67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6f80 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x6f90 */  83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6fa0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6fb0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6fc0 */  56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x6fd0 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x6fe0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6ff0 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 48, 93, 58,
-/* 0x7000 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7010 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7020 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54,
-/* 0x7030 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x7040 */  70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82,
-/* 0x7050 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7060 */  32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7070 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7080 */  82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70,
-/* 0x7090 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x70a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x70b0 */  48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x70c0 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x70d0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x70e0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83,
-/* 0x70f0 */  77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x7100 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7110 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x7120 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x7130 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x7140 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7150 */  70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48, 93, 58, 10,
-/* 0x7160 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7180 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7190 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x71a0 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x71b0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x71c0 */  69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x71d0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x71e0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x71f0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x7200 */  32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 10, 82,
-/* 0x7210 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7220 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 50, 48, 93,
-/* 0x7230 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x7240 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x7250 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56,
-/* 0x7260 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x7270 */  69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7280 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7290 */  78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x72a0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x72b0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x72c0 */  48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x72d0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10,
-/* 0x72e0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x72f0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 51,
-/* 0x7300 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x7310 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x7320 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95,
-/* 0x7330 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7340 */  78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7350 */ 101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7360 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69,
-/* 0x7370 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7380 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51, 48, 93, 58,
-/* 0x7390 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x73a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x73b0 */  69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54,
-/* 0x73c0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x73d0 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82,
-/* 0x73e0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x73f0 */  32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7400 */  51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x7410 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 10, 82,
-/* 0x7420 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7430 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 52, 48, 93,
-/* 0x7440 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x7450 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x7460 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56,
-/* 0x7470 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x7480 */  69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7490 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x74a0 */  78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x74b0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74c0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x74d0 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x74e0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10,
-/* 0x74f0 */  48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7500 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x7510 */  67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x7520 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x7530 */  83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7540 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7550 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7560 */  56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x7570 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x7580 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7590 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 48, 93, 58,
-/* 0x75a0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x75b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x75c0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54,
-/* 0x75d0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x75e0 */  70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82,
-/* 0x75f0 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7600 */  32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7610 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7620 */  82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70,
-/* 0x7630 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7640 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7650 */  48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7660 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x7670 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7680 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 69,
-/* 0x7690 */  78, 84, 69, 82, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x76a0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x76b0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x76c0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x76d0 */  32, 32, 32, 67, 76, 49, 83, 84, 65, 82, 84, 10, 10, 82, 69, 76,
-/* 0x76e0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x76f0 */  70, 79, 82, 32, 91, 67, 76, 49, 83, 77, 65, 49, 48, 93, 58, 10,
-/* 0x7700 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7710 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7720 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7730 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 82,
-/* 0x7740 */  76, 79, 65, 68, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x7750 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76,
-/* 0x7760 */  49, 87, 73, 68, 48, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x7770 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7780 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7790 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x77a0 */  32, 32, 32, 32, 32, 67, 76, 49, 87, 73, 68, 49, 48, 10, 10, 82,
-/* 0x77b0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x77c0 */  83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 87, 73, 68, 48, 53, 93,
-/* 0x77d0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x77e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x77f0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x7800 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76,
-/* 0x7810 */  49, 87, 73, 68, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7820 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7830 */  67, 76, 49, 87, 73, 68, 48, 56, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7840 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7850 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7860 */  48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7870 */  32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73, 68, 48, 54, 10,
-/* 0x7880 */  48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7890 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73,
-/* 0x78a0 */  68, 49, 48, 10, 48, 48, 48, 48, 48, 48, 49, 54, 32, 82, 95, 51,
-/* 0x78b0 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0x78c0 */  76, 49, 67, 79, 80, 89, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x78d0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x78e0 */  91, 67, 76, 49, 87, 73, 68, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x78f0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7900 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x7910 */  48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x7920 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48, 55,
-/* 0x7930 */  10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7940 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87,
-/* 0x7950 */  73, 68, 48, 56, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95,
-/* 0x7960 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7970 */  67, 76, 49, 84, 79, 80, 48, 55, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7980 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7990 */  32, 91, 67, 76, 49, 84, 79, 80, 48, 49, 93, 58, 10, 79, 70, 70,
-/* 0x79a0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x79b0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x79c0 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x79d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48,
-/* 0x79e0 */  55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x79f0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 84, 79,
-/* 0x7a00 */  80, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7a10 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7a20 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x7a30 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7a40 */  32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 10, 82, 69, 76, 79,
-/* 0x7a50 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x7a60 */  79, 82, 32, 91, 67, 76, 49, 84, 79, 80, 48, 51, 93, 58, 10, 79,
-/* 0x7a70 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x7a80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7a90 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x7aa0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 84, 79,
-/* 0x7ab0 */  80, 48, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x7ac0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49,
-/* 0x7ad0 */  84, 79, 80, 48, 52, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x7ae0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7af0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x7b00 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7b10 */  32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 10, 82, 69,
-/* 0x7b20 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7b30 */  32, 70, 79, 82, 32, 91, 67, 76, 49, 84, 79, 80, 48, 53, 93, 58,
-/* 0x7b40 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7b50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7b60 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x7b70 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49,
-/* 0x7b80 */  84, 79, 80, 48, 54, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7b90 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x7ba0 */  76, 49, 84, 79, 80, 48, 54, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x7bb0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7bc0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x7bd0 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x7be0 */  32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73, 68, 48, 49, 10, 10,
-/* 0x7bf0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x7c00 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 79, 70, 70, 48, 50,
-/* 0x7c10 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7c20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7c30 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x7c40 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0x7c50 */  76, 49, 84, 79, 80, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48,102,
-/* 0x7c60 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x7c70 */  32, 32, 32, 67, 76, 49, 67, 79, 80, 89, 48, 10, 10, 82, 69, 76,
-/* 0x7c80 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7c90 */  70, 79, 82, 32, 91, 67, 76, 49, 79, 70, 70, 48, 52, 93, 58, 10,
-/* 0x7ca0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7cb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7cc0 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7cd0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 67,
-/* 0x7ce0 */  79, 80, 89, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x7cf0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76,
-/* 0x7d00 */  49, 76, 69, 78, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x7d10 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7d20 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x7d30 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x7d40 */  32, 32, 32, 32, 32, 67, 76, 49, 76, 69, 78, 48, 48, 10, 10, 82,
-/* 0x7d50 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x7d60 */  83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 67, 79, 80, 89, 48, 93,
-/* 0x7d70 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x7d80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x7d90 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32, 82, 95, 51, 56,
-/* 0x7da0 */  54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76,
-/* 0x7db0 */  49, 84, 79, 80, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7dc0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7dd0 */  76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x7de0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7df0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7e00 */  48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x7e10 */  32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116,
-/* 0x7e20 */  97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48,
-/* 0x7e30 */  48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x7e40 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110,
-/* 0x7e50 */  10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7e60 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97,
-/* 0x7e70 */  95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 97, 32,
-/* 0x7e80 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7e90 */  32, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,
-/* 0x7ea0 */ 115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7eb0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 80, 84, 73,
-/* 0x7ec0 */  48, 57, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7ed0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7ee0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x7ef0 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x7f00 */  32, 32, 76, 88, 80, 84, 73, 48, 57, 49, 10, 10, 82, 69, 76, 79,
-/* 0x7f10 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x7f20 */  79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 48, 93, 58, 10, 79,
-/* 0x7f30 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x7f40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x7f50 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x7f60 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x7f70 */ 114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7f80 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7f90 */  32, 91, 67, 84, 67, 76, 69, 86, 69, 49, 93, 58, 10, 79, 70, 70,
-/* 0x7fa0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7fb0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7fc0 */  48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32,
-/* 0x7fd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x7fe0 */  99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x7ff0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0x8000 */  65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x8010 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x8020 */  91, 67, 65, 76, 76, 84, 82, 48, 50, 93, 58, 10, 79, 70, 70, 83,
-/* 0x8030 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8040 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x8050 */  48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x8060 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48,
-/* 0x8070 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x8080 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x8090 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x80a0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x80b0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x80c0 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x80d0 */  32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10, 10,
-/* 0x80e0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x80f0 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 49,
-/* 0x8100 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x8110 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x8120 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x8130 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0x8140 */  65, 76, 76, 84, 82, 49, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x8150 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x8160 */  91, 67, 84, 67, 76, 69, 86, 69, 50, 93, 58, 10, 79, 70, 70, 83,
-/* 0x8170 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8180 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x8190 */  48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32,
-/* 0x81a0 */  32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,
-/* 0x81b0 */ 116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56,
-/* 0x81c0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65,
-/* 0x81d0 */  76, 76, 84, 82, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x81e0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x81f0 */  67, 65, 76, 76, 84, 82, 49, 51, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x8200 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8210 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x8220 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x8230 */  32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10,
-/* 0x8240 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x8250 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 48,
-/* 0x8260 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x8270 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x8280 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x8290 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x82a0 */  76, 88, 85, 78, 70, 48, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x82b0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x82c0 */  32, 91, 76, 88, 77, 82, 85, 48, 48, 53, 93, 58, 10, 79, 70, 70,
-/* 0x82d0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x82e0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x82f0 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x8300 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 77, 82, 85, 10, 10, 82,
-/* 0x8310 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x8320 */  83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 49, 48, 93,
-/* 0x8330 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x8340 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x8350 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x8360 */  54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x8370 */  85, 78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x8380 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x8390 */  76, 88, 74, 67, 67, 48, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x83a0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x83b0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x83c0 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x83d0 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10,
-/* 0x83e0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x83f0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48, 50,
-/* 0x8400 */  49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x8410 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x8420 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x8430 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8440 */  76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8450 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8460 */  32, 91, 76, 88, 85, 78, 70, 51, 56, 56, 93, 58, 10, 79, 70, 70,
-/* 0x8470 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x8480 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x8490 */  48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x84a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52,
-/* 0x84b0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x84c0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70,
-/* 0x84d0 */  52, 56, 55, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x84e0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x84f0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x8500 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8510 */  32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69, 76, 79,
-/* 0x8520 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x8530 */  79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 54, 53, 93, 58, 10, 79,
-/* 0x8540 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x8550 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x8560 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x8570 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85,
-/* 0x8580 */  48, 55, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x8590 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77,
-/* 0x85a0 */  82, 85, 48, 55, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x85b0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x85c0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x85d0 */  52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x85e0 */  32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69,
-/* 0x85f0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x8600 */  32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 57, 48, 93, 58,
-/* 0x8610 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x8620 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x8630 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54,
-/* 0x8640 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77,
-/* 0x8650 */  82, 85, 49, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x8660 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x8670 */  88, 85, 78, 70, 48, 52, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x8680 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8690 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x86a0 */  48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x86b0 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10,
-/* 0x86c0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x86d0 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 49, 54,
-/* 0x86e0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x86f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x8700 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x8710 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x8720 */  88, 85, 78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x8730 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x8740 */  91, 76, 88, 77, 82, 85, 48, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x8750 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8760 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x8770 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x8780 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48, 51, 48,
-/* 0x8790 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x87a0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67, 48,
-/* 0x87b0 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x87c0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x87d0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82,
-/* 0x87e0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x87f0 */  32, 76, 88, 74, 67, 67, 48, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x8800 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x8810 */  82, 32, 91, 76, 88, 67, 65, 76, 76, 48, 48, 93, 58, 10, 79, 70,
-/* 0x8820 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8830 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8840 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8850 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x8860 */  51, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x8870 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74,
-/* 0x8880 */  50, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x8890 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x88a0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x88b0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x88c0 */  32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82, 69, 76,
-/* 0x88d0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x88e0 */  70, 79, 82, 32, 91, 76, 88, 67, 74, 52, 77, 82, 85, 93, 58, 10,
-/* 0x88f0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x8900 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x8910 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x8920 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78,
-/* 0x8930 */  70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x8940 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0x8950 */  67, 74, 54, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x8960 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8970 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8980 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x8990 */  32, 32, 32, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85, 10, 10, 82,
-/* 0x89a0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x89b0 */  83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 55, 77, 82, 85, 93,
-/* 0x89c0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x89d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x89e0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x89f0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x8a00 */  67, 74, 56, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x8a10 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x8a20 */  76, 88, 67, 74, 56, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x8a30 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8a40 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x8a50 */  48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x8a60 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10,
-/* 0x8a70 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x8a80 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 51,
-/* 0x8a90 */  52, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x8aa0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x8ab0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x8ac0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8ad0 */  76, 88, 85, 78, 70, 48, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x8ae0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x8af0 */  32, 91, 99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10, 79, 70,
-/* 0x8b00 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x8b10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x8b20 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8b30 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50,
-/* 0x8b40 */  46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x8b50 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,
-/* 0x8b60 */ 107, 51, 50, 46, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x8b70 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8b80 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8b90 */  48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x8ba0 */  32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10,
-/* 0x8bb0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x8bc0 */  68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 50,
-/* 0x8bd0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x8be0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x8bf0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95,
-/* 0x8c00 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8c10 */  99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8c20 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x8c30 */  32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48,
-/* 0x8c40 */  48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8c50 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50,
-/* 0x8c60 */  46, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x8c70 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,
-/* 0x8c80 */ 107, 51, 50, 46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x8c90 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8ca0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8cb0 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x8cc0 */  32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48,
-/* 0x8cd0 */  48, 48, 48, 48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x8ce0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50,
-/* 0x8cf0 */  46, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x8d00 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,
-/* 0x8d10 */ 107, 51, 50, 46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x8d20 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x8d30 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x8d40 */  48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x8d50 */  32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10
+/* 0x1bf0 */ 138,  7, 71,235, 13,131,233,  1,115,  3, 97,195,209,  0,  0,  0,
+/* 0x1c00 */ 217,  0,  0,  0,122,  0,  0,  0,233,  7,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */  52,  0,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1c20 */ 139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1c30 */ 139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1c40 */ 139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x1c50 */ 139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x1c60 */ 139,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x1c70 */ 151,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x1c80 */ 154,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,
+/* 0x1c90 */ 156,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,
+/* 0x1ca0 */ 162,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x1cb0 */ 173,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,
+/* 0x1cc0 */ 178,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,
+/* 0x1cd0 */ 187,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,
+/* 0x1ce0 */ 200,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0,
+/* 0x1cf0 */ 213,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0,
+/* 0x1d00 */ 228,  0,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0,
+/* 0x1d10 */  34,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,
+/* 0x1d20 */  47,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0,
+/* 0x1d30 */  62,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0,
+/* 0x1d40 */  64,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,
+/* 0x1d50 */  67,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0,
+/* 0x1d60 */  76,  1,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0,
+/* 0x1d70 */  88,  1,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0,
+/* 0x1d80 */ 113,  1,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0,
+/* 0x1d90 */ 135,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0,
+/* 0x1da0 */ 135,  1,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0,
+/* 0x1db0 */ 138,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0,
+/* 0x1dc0 */ 140,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0,
+/* 0x1dd0 */ 146,  1,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0,
+/* 0x1de0 */ 157,  1,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0,
+/* 0x1df0 */ 162,  1,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0,
+/* 0x1e00 */ 171,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0,
+/* 0x1e10 */ 184,  1,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0,
+/* 0x1e20 */ 197,  1,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0,
+/* 0x1e30 */ 212,  1,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,
+/* 0x1e40 */  38,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0,
+/* 0x1e50 */  51,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0,
+/* 0x1e60 */  66,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0,
+/* 0x1e70 */  68,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0,
+/* 0x1e80 */  71,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0,
+/* 0x1e90 */  80,  2,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0,
+/* 0x1ea0 */  92,  2,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0,
+/* 0x1eb0 */ 117,  2,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0,
+/* 0x1ec0 */ 139,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0,
+/* 0x1ed0 */ 139,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0,
+/* 0x1ee0 */ 142,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0,
+/* 0x1ef0 */ 144,  2,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0,
+/* 0x1f00 */ 150,  2,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0,
+/* 0x1f10 */ 161,  2,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0,
+/* 0x1f20 */ 166,  2,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0,
+/* 0x1f30 */ 175,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0,
+/* 0x1f40 */ 188,  2,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0,
+/* 0x1f50 */ 201,  2,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0,
+/* 0x1f60 */ 216,  2,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0,
+/* 0x1f70 */  55,  3,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0,
+/* 0x1f80 */  68,  3,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0,
+/* 0x1f90 */  83,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0,
+/* 0x1fa0 */  85,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0,
+/* 0x1fb0 */  88,  3,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0,
+/* 0x1fc0 */  97,  3,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0,
+/* 0x1fd0 */ 109,  3,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0, 37,  2,  0,  0,
+/* 0x1fe0 */ 134,  3,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 46,  2,  0,  0,
+/* 0x1ff0 */ 156,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,  2,  0,  0,
+/* 0x2000 */ 156,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 64,  2,  0,  0,
+/* 0x2010 */ 158,  3,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 73,  2,  0,  0,
+/* 0x2020 */ 164,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 82,  2,  0,  0,
+/* 0x2030 */ 164,  3,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 91,  2,  0,  0,
+/* 0x2040 */ 170,  3,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,100,  2,  0,  0,
+/* 0x2050 */ 175,  3,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,109,  2,  0,  0,
+/* 0x2060 */ 183,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,118,  2,  0,  0,
+/* 0x2070 */ 185,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,127,  2,  0,  0,
+/* 0x2080 */ 187,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,136,  2,  0,  0,
+/* 0x2090 */ 189,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0,
+/* 0x20a0 */ 191,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,154,  2,  0,  0,
+/* 0x20b0 */ 193,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,163,  2,  0,  0,
+/* 0x20c0 */ 195,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,172,  2,  0,  0,
+/* 0x20d0 */ 198,  3,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,181,  2,  0,  0,
+/* 0x20e0 */ 224,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,190,  2,  0,  0,
+/* 0x20f0 */ 226,  3,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,199,  2,  0,  0,
+/* 0x2100 */ 243,  3,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,208,  2,  0,  0,
+/* 0x2110 */ 248,  3,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,217,  2,  0,  0,
+/* 0x2120 */ 251,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,226,  2,  0,  0,
+/* 0x2130 */ 253,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,235,  2,  0,  0,
+/* 0x2140 */ 255,  3,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,244,  2,  0,  0,
+/* 0x2150 */   1,  4,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,253,  2,  0,  0,
+/* 0x2160 */   6,  4,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  6,  3,  0,  0,
+/* 0x2170 */   9,  4,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 15,  3,  0,  0,
+/* 0x2180 */  16,  4,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0, 24,  3,  0,  0,
+/* 0x2190 */  39,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 33,  3,  0,  0,
+/* 0x21a0 */  41,  4,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0, 42,  3,  0,  0,
+/* 0x21b0 */  59,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 51,  3,  0,  0,
+/* 0x21c0 */  61,  4,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 60,  3,  0,  0,
+/* 0x21d0 */  65,  4,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 69,  3,  0,  0,
+/* 0x21e0 */  66,  4,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 78,  3,  0,  0,
+/* 0x21f0 */  68,  4,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 87,  3,  0,  0,
+/* 0x2200 */  73,  4,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0, 96,  3,  0,  0,
+/* 0x2210 */ 124,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,103,  3,  0,  0,
+/* 0x2220 */ 124,  4,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,114,  3,  0,  0,
+/* 0x2230 */ 170,  4,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,125,  3,  0,  0,
+/* 0x2240 */ 242,  4,  0,  0,134, 10,  0,  0,  0,  0,  0,  0,136,  3,  0,  0,
+/* 0x2250 */ 120, 15,  0,  0,134, 10,  0,  0,  0,  0,  0,  0,147,  3,  0,  0,
+/* 0x2260 */ 254, 25,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,158,  3,  0,  0,
+/* 0x2270 */  24, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,167,  3,  0,  0,
+/* 0x2280 */  29, 26,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,176,  3,  0,  0,
+/* 0x2290 */  58, 26,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,185,  3,  0,  0,
+/* 0x22a0 */  72, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,194,  3,  0,  0,
+/* 0x22b0 */  77, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,203,  3,  0,  0,
+/* 0x22c0 */  82, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,212,  3,  0,  0,
+/* 0x22d0 */  86, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,221,  3,  0,  0,
+/* 0x22e0 */  88, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,230,  3,  0,  0,
+/* 0x22f0 */  93, 26,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,239,  3,  0,  0,
+/* 0x2300 */ 107, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,248,  3,  0,  0,
+/* 0x2310 */ 112, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  4,  0,  0,
+/* 0x2320 */ 114, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 10,  4,  0,  0,
+/* 0x2330 */ 116, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 19,  4,  0,  0,
+/* 0x2340 */ 120, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 28,  4,  0,  0,
+/* 0x2350 */ 125, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 37,  4,  0,  0,
+/* 0x2360 */ 127, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 46,  4,  0,  0,
+/* 0x2370 */ 131, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 55,  4,  0,  0,
+/* 0x2380 */ 133, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 64,  4,  0,  0,
+/* 0x2390 */ 138, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 73,  4,  0,  0,
+/* 0x23a0 */ 143, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 82,  4,  0,  0,
+/* 0x23b0 */ 145, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 91,  4,  0,  0,
+/* 0x23c0 */ 150, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,100,  4,  0,  0,
+/* 0x23d0 */ 152, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,109,  4,  0,  0,
+/* 0x23e0 */ 157, 26,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,118,  4,  0,  0,
+/* 0x23f0 */ 164, 26,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,127,  4,  0,  0,
+/* 0x2400 */ 171, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,136,  4,  0,  0,
+/* 0x2410 */ 175, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,145,  4,  0,  0,
+/* 0x2420 */ 180, 26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,154,  4,  0,  0,
+/* 0x2430 */ 183, 26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,163,  4,  0,  0,
+/* 0x2440 */ 186, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,172,  4,  0,  0,
+/* 0x2450 */ 188, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,181,  4,  0,  0,
+/* 0x2460 */ 190, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,190,  4,  0,  0,
+/* 0x2470 */ 195, 26,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,199,  4,  0,  0,
+/* 0x2480 */ 202, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,208,  4,  0,  0,
+/* 0x2490 */ 204, 26,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,217,  4,  0,  0,
+/* 0x24a0 */ 205, 26,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,226,  4,  0,  0,
+/* 0x24b0 */ 214, 26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,235,  4,  0,  0,
+/* 0x24c0 */ 217, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,244,  4,  0,  0,
+/* 0x24d0 */ 221, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,253,  4,  0,  0,
+/* 0x24e0 */ 223, 26,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  6,  5,  0,  0,
+/* 0x24f0 */ 228, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 15,  5,  0,  0,
+/* 0x2500 */ 230, 26,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 24,  5,  0,  0,
+/* 0x2510 */ 231, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 33,  5,  0,  0,
+/* 0x2520 */ 233, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 42,  5,  0,  0,
+/* 0x2530 */ 237, 26,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 51,  5,  0,  0,
+/* 0x2540 */ 245, 26,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 60,  5,  0,  0,
+/* 0x2550 */ 248, 26,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 69,  5,  0,  0,
+/* 0x2560 */ 250, 26,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 78,  5,  0,  0,
+/* 0x2570 */   0, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 87,  5,  0,  0,
+/* 0x2580 */   3, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 96,  5,  0,  0,
+/* 0x2590 */   5, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,105,  5,  0,  0,
+/* 0x25a0 */   6, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,114,  5,  0,  0,
+/* 0x25b0 */   8, 27,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,123,  5,  0,  0,
+/* 0x25c0 */  12, 27,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,132,  5,  0,  0,
+/* 0x25d0 */  23, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,141,  5,  0,  0,
+/* 0x25e0 */  25, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,150,  5,  0,  0,
+/* 0x25f0 */  26, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,159,  5,  0,  0,
+/* 0x2600 */  28, 27,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,168,  5,  0,  0,
+/* 0x2610 */  32, 27,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,177,  5,  0,  0,
+/* 0x2620 */  48, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,186,  5,  0,  0,
+/* 0x2630 */  53, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,195,  5,  0,  0,
+/* 0x2640 */  56, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,204,  5,  0,  0,
+/* 0x2650 */  58, 27,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,213,  5,  0,  0,
+/* 0x2660 */  65, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,222,  5,  0,  0,
+/* 0x2670 */  65, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,231,  5,  0,  0,
+/* 0x2680 */  70, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,240,  5,  0,  0,
+/* 0x2690 */  71, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,249,  5,  0,  0,
+/* 0x26a0 */  73, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  2,  6,  0,  0,
+/* 0x26b0 */  75, 27,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 11,  6,  0,  0,
+/* 0x26c0 */  81, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 20,  6,  0,  0,
+/* 0x26d0 */  84, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 29,  6,  0,  0,
+/* 0x26e0 */  86, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 38,  6,  0,  0,
+/* 0x26f0 */  88, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 47,  6,  0,  0,
+/* 0x2700 */  89, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 56,  6,  0,  0,
+/* 0x2710 */  91, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 65,  6,  0,  0,
+/* 0x2720 */  93, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 74,  6,  0,  0,
+/* 0x2730 */  94, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 83,  6,  0,  0,
+/* 0x2740 */  96, 27,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 92,  6,  0,  0,
+/* 0x2750 */ 102, 27,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,101,  6,  0,  0,
+/* 0x2760 */ 110, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,110,  6,  0,  0,
+/* 0x2770 */ 112, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,119,  6,  0,  0,
+/* 0x2780 */ 115, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,128,  6,  0,  0,
+/* 0x2790 */ 118, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,137,  6,  0,  0,
+/* 0x27a0 */ 120, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,146,  6,  0,  0,
+/* 0x27b0 */ 123, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,155,  6,  0,  0,
+/* 0x27c0 */ 125, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,164,  6,  0,  0,
+/* 0x27d0 */ 127, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,173,  6,  0,  0,
+/* 0x27e0 */ 129, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,182,  6,  0,  0,
+/* 0x27f0 */ 131, 27,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,191,  6,  0,  0,
+/* 0x2800 */ 134, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,200,  6,  0,  0,
+/* 0x2810 */ 139, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,209,  6,  0,  0,
+/* 0x2820 */ 141, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,218,  6,  0,  0,
+/* 0x2830 */ 146, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,227,  6,  0,  0,
+/* 0x2840 */ 151, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,236,  6,  0,  0,
+/* 0x2850 */ 156, 27,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,245,  6,  0,  0,
+/* 0x2860 */ 162, 27,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,254,  6,  0,  0,
+/* 0x2870 */ 163, 27,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  7,  7,  0,  0,
+/* 0x2880 */ 169, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  7,  0,  0,
+/* 0x2890 */ 169, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  7,  0,  0,
+/* 0x28a0 */ 169, 27,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 34,  7,  0,  0,
+/* 0x28b0 */ 182, 27,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 44,  7,  0,  0,
+/* 0x28c0 */ 189, 27,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0, 54,  7,  0,  0,
+/* 0x28d0 */ 203, 27,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 64,  7,  0,  0,
+/* 0x28e0 */ 235, 27,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 74,  7,  0,  0,
+/* 0x28f0 */ 245, 27,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 84,  7,  0,  0,
+/* 0x2900 */ 250, 27,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 93,  7,  0,  0,
+/* 0x2910 */ 252, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2930 */   0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2940 */  27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x2950 */   4,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  6,  0,  0,  0,
+/* 0x2960 */   0,  0,  0,  0, 72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2970 */  81,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,
+/* 0x2980 */  12,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2990 */   0,  0,  0,  0,180,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29a0 */ 207,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0,
+/* 0x29b0 */  24,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 25,  0,  0,  0,
+/* 0x29c0 */   0,  0,  0,  0,243,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29d0 */ 252,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0,
+/* 0x29e0 */  31,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0, 34,  0,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0, 95,  1,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a00 */ 122,  1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0,
+/* 0x2a10 */  43,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 44,  0,  0,  0,
+/* 0x2a20 */   0,  0,  0,  0,158,  1,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a30 */ 167,  1,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0,
+/* 0x2a40 */  50,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0, 53,  0,  0,  0,
+/* 0x2a50 */   0,  0,  0,  0, 10,  2,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a60 */  37,  2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0, 46,  2,  0,  0,
+/* 0x2a70 */  62,  0,  0,  0,  0,  0,  0,  0,100,  2,  0,  0, 68,  0,  0,  0,
+/* 0x2a80 */   0,  0,  0,  0,109,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a90 */ 154,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,172,  2,  0,  0,
+/* 0x2aa0 */  76,  0,  0,  0,  0,  0,  0,  0,190,  2,  0,  0, 78,  0,  0,  0,
+/* 0x2ab0 */   0,  0,  0,  0,199,  2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ac0 */ 208,  2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  6,  3,  0,  0,
+/* 0x2ad0 */  86,  0,  0,  0,  0,  0,  0,  0, 15,  3,  0,  0, 87,  0,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0, 60,  3,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2af0 */  87,  3,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,167,  3,  0,  0,
+/* 0x2b00 */ 103,  0,  0,  0,  0,  0,  0,  0,176,  3,  0,  0,104,  0,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0,239,  3,  0,  0,111,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b20 */  10,  4,  0,  0,114,  0,  0,  0,  0,  0,  0,  0, 64,  4,  0,  0,
+/* 0x2b30 */ 120,  0,  0,  0,  0,  0,  0,  0,136,  4,  0,  0,128,  0,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0,145,  4,  0,  0,129,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b50 */ 199,  4,  0,  0,135,  0,  0,  0,  0,  0,  0,  0, 42,  5,  0,  0,
+/* 0x2b60 */ 146,  0,  0,  0,  0,  0,  0,  0,168,  5,  0,  0,160,  0,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0,177,  5,  0,  0,161,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b80 */ 213,  5,  0,  0,165,  0,  0,  0,  0,  0,  0,  0, 47,  6,  0,  0,
+/* 0x2b90 */ 175,  0,  0,  0,  0,  0,  0,  0, 83,  6,  0,  0,179,  0,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0,182,  6,  0,  0,190,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bb0 */ 191,  6,  0,  0,191,  0,  0,  0,  0,  0,  0,  0,  7,  7,  0,  0,
+/* 0x2bc0 */ 199,  0,  0,  0,  0,  0,  0,  0, 16,  7,  0,  0,200,  0,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0, 34,  7,  0,  0,202,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2be0 */  44,  7,  0,  0,203,  0,  0,  0,  0,  0,  0,  0, 54,  7,  0,  0,
+/* 0x2bf0 */ 204,  0,  0,  0,  0,  0,  0,  0, 74,  7,  0,  0,206,  0,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0, 93,  7,  0,  0,208,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c10 */  45,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x2c20 */   7,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0, 99,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c40 */ 117,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0,
+/* 0x2c50 */  14,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0, 16,  0,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0,153,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c70 */ 162,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0,
+/* 0x2c80 */  19,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 21,  0,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0,198,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ca0 */ 234,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0,
+/* 0x2cb0 */  29,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0, 30,  0,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0, 32,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cd0 */  41,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,
+/* 0x2ce0 */  35,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0, 36,  0,  0,  0,
+/* 0x2cf0 */   0,  0,  0,  0, 77,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d00 */  86,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0,
+/* 0x2d10 */  40,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 41,  0,  0,  0,
+/* 0x2d20 */   0,  0,  0,  0,149,  1,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d30 */ 176,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0,
+/* 0x2d40 */  49,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0, 51,  0,  0,  0,
+/* 0x2d50 */   0,  0,  0,  0,212,  1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d60 */ 230,  1,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0,
+/* 0x2d70 */  55,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0, 56,  0,  0,  0,
+/* 0x2d80 */   0,  0,  0,  0,  1,  2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d90 */  19,  2,  0,  0, 59,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0,
+/* 0x2da0 */  60,  0,  0,  0,  0,  0,  0,  0, 55,  2,  0,  0, 63,  0,  0,  0,
+/* 0x2db0 */   0,  0,  0,  0, 64,  2,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2dc0 */  73,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0, 82,  2,  0,  0,
+/* 0x2dd0 */  66,  0,  0,  0,  0,  0,  0,  0, 91,  2,  0,  0, 67,  0,  0,  0,
+/* 0x2de0 */   0,  0,  0,  0,118,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2df0 */ 127,  2,  0,  0, 71,  0,  0,  0,  0,  0,  0,  0,136,  2,  0,  0,
+/* 0x2e00 */  72,  0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0, 73,  0,  0,  0,
+/* 0x2e10 */   0,  0,  0,  0,163,  2,  0,  0, 75,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e20 */ 181,  2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,217,  2,  0,  0,
+/* 0x2e30 */  81,  0,  0,  0,  0,  0,  0,  0,226,  2,  0,  0, 82,  0,  0,  0,
+/* 0x2e40 */   0,  0,  0,  0,235,  2,  0,  0, 83,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e50 */ 244,  2,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,253,  2,  0,  0,
+/* 0x2e60 */  85,  0,  0,  0,  0,  0,  0,  0, 24,  3,  0,  0, 88,  0,  0,  0,
+/* 0x2e70 */   0,  0,  0,  0, 33,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e80 */  42,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0, 51,  3,  0,  0,
+/* 0x2e90 */  91,  0,  0,  0,  0,  0,  0,  0, 69,  3,  0,  0, 93,  0,  0,  0,
+/* 0x2ea0 */   0,  0,  0,  0, 78,  3,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2eb0 */  96,  3,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,103,  3,  0,  0,
+/* 0x2ec0 */  97,  0,  0,  0,  0,  0,  0,  0,114,  3,  0,  0, 98,  0,  0,  0,
+/* 0x2ed0 */   0,  0,  0,  0,125,  3,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ee0 */ 136,  3,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,147,  3,  0,  0,
+/* 0x2ef0 */ 101,  0,  0,  0,  0,  0,  0,  0,158,  3,  0,  0,102,  0,  0,  0,
+/* 0x2f00 */   0,  0,  0,  0,185,  3,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */ 194,  3,  0,  0,106,  0,  0,  0,  0,  0,  0,  0,203,  3,  0,  0,
+/* 0x2f20 */ 107,  0,  0,  0,  0,  0,  0,  0,212,  3,  0,  0,108,  0,  0,  0,
+/* 0x2f30 */   0,  0,  0,  0,221,  3,  0,  0,109,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f40 */ 230,  3,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,248,  3,  0,  0,
+/* 0x2f50 */ 112,  0,  0,  0,  0,  0,  0,  0,  1,  4,  0,  0,113,  0,  0,  0,
+/* 0x2f60 */   0,  0,  0,  0, 19,  4,  0,  0,115,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f70 */  28,  4,  0,  0,116,  0,  0,  0,  0,  0,  0,  0, 37,  4,  0,  0,
+/* 0x2f80 */ 117,  0,  0,  0,  0,  0,  0,  0, 46,  4,  0,  0,118,  0,  0,  0,
+/* 0x2f90 */   0,  0,  0,  0, 55,  4,  0,  0,119,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fa0 */  73,  4,  0,  0,121,  0,  0,  0,  0,  0,  0,  0, 82,  4,  0,  0,
+/* 0x2fb0 */ 122,  0,  0,  0,  0,  0,  0,  0, 91,  4,  0,  0,123,  0,  0,  0,
+/* 0x2fc0 */   0,  0,  0,  0,100,  4,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fd0 */ 109,  4,  0,  0,125,  0,  0,  0,  0,  0,  0,  0,118,  4,  0,  0,
+/* 0x2fe0 */ 126,  0,  0,  0,  0,  0,  0,  0,127,  4,  0,  0,127,  0,  0,  0,
+/* 0x2ff0 */   0,  0,  0,  0,154,  4,  0,  0,130,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */ 163,  4,  0,  0,131,  0,  0,  0,  0,  0,  0,  0,172,  4,  0,  0,
+/* 0x3010 */ 132,  0,  0,  0,  0,  0,  0,  0,181,  4,  0,  0,133,  0,  0,  0,
+/* 0x3020 */   0,  0,  0,  0,190,  4,  0,  0,134,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */ 208,  4,  0,  0,136,  0,  0,  0,  0,  0,  0,  0,217,  4,  0,  0,
+/* 0x3040 */ 137,  0,  0,  0,  0,  0,  0,  0,226,  4,  0,  0,138,  0,  0,  0,
+/* 0x3050 */   0,  0,  0,  0,235,  4,  0,  0,139,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3060 */ 244,  4,  0,  0,140,  0,  0,  0,  0,  0,  0,  0,253,  4,  0,  0,
+/* 0x3070 */ 141,  0,  0,  0,  0,  0,  0,  0,  6,  5,  0,  0,142,  0,  0,  0,
+/* 0x3080 */   0,  0,  0,  0, 15,  5,  0,  0,143,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3090 */  24,  5,  0,  0,144,  0,  0,  0,  0,  0,  0,  0, 33,  5,  0,  0,
+/* 0x30a0 */ 145,  0,  0,  0,  0,  0,  0,  0, 51,  5,  0,  0,147,  0,  0,  0,
+/* 0x30b0 */   0,  0,  0,  0, 60,  5,  0,  0,148,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30c0 */  69,  5,  0,  0,149,  0,  0,  0,  0,  0,  0,  0, 78,  5,  0,  0,
+/* 0x30d0 */ 150,  0,  0,  0,  0,  0,  0,  0, 87,  5,  0,  0,151,  0,  0,  0,
+/* 0x30e0 */   0,  0,  0,  0, 96,  5,  0,  0,152,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30f0 */ 105,  5,  0,  0,153,  0,  0,  0,  0,  0,  0,  0,114,  5,  0,  0,
+/* 0x3100 */ 154,  0,  0,  0,  0,  0,  0,  0,123,  5,  0,  0,155,  0,  0,  0,
+/* 0x3110 */   0,  0,  0,  0,132,  5,  0,  0,156,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3120 */ 141,  5,  0,  0,157,  0,  0,  0,  0,  0,  0,  0,150,  5,  0,  0,
+/* 0x3130 */ 158,  0,  0,  0,  0,  0,  0,  0,159,  5,  0,  0,159,  0,  0,  0,
+/* 0x3140 */   0,  0,  0,  0,186,  5,  0,  0,162,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3150 */ 195,  5,  0,  0,163,  0,  0,  0,  0,  0,  0,  0,204,  5,  0,  0,
+/* 0x3160 */ 164,  0,  0,  0,  0,  0,  0,  0,222,  5,  0,  0,166,  0,  0,  0,
+/* 0x3170 */   0,  0,  0,  0,231,  5,  0,  0,167,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3180 */ 240,  5,  0,  0,168,  0,  0,  0,  0,  0,  0,  0,249,  5,  0,  0,
+/* 0x3190 */ 169,  0,  0,  0,  0,  0,  0,  0,  2,  6,  0,  0,170,  0,  0,  0,
+/* 0x31a0 */   0,  0,  0,  0, 11,  6,  0,  0,171,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31b0 */  20,  6,  0,  0,172,  0,  0,  0,  0,  0,  0,  0, 29,  6,  0,  0,
+/* 0x31c0 */ 173,  0,  0,  0,  0,  0,  0,  0, 38,  6,  0,  0,174,  0,  0,  0,
+/* 0x31d0 */   0,  0,  0,  0, 56,  6,  0,  0,176,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31e0 */  65,  6,  0,  0,177,  0,  0,  0,  0,  0,  0,  0, 74,  6,  0,  0,
+/* 0x31f0 */ 178,  0,  0,  0,  0,  0,  0,  0, 92,  6,  0,  0,180,  0,  0,  0,
+/* 0x3200 */   0,  0,  0,  0,101,  6,  0,  0,181,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3210 */ 110,  6,  0,  0,182,  0,  0,  0,  0,  0,  0,  0,119,  6,  0,  0,
+/* 0x3220 */ 183,  0,  0,  0,  0,  0,  0,  0,128,  6,  0,  0,184,  0,  0,  0,
+/* 0x3230 */   0,  0,  0,  0,137,  6,  0,  0,185,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3240 */ 146,  6,  0,  0,186,  0,  0,  0,  0,  0,  0,  0,155,  6,  0,  0,
+/* 0x3250 */ 187,  0,  0,  0,  0,  0,  0,  0,164,  6,  0,  0,188,  0,  0,  0,
+/* 0x3260 */   0,  0,  0,  0,173,  6,  0,  0,189,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3270 */ 200,  6,  0,  0,192,  0,  0,  0,  0,  0,  0,  0,209,  6,  0,  0,
+/* 0x3280 */ 193,  0,  0,  0,  0,  0,  0,  0,218,  6,  0,  0,194,  0,  0,  0,
+/* 0x3290 */   0,  0,  0,  0,227,  6,  0,  0,195,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32a0 */ 236,  6,  0,  0,196,  0,  0,  0,  0,  0,  0,  0,245,  6,  0,  0,
+/* 0x32b0 */ 197,  0,  0,  0,  0,  0,  0,  0,254,  6,  0,  0,198,  0,  0,  0,
+/* 0x32c0 */   0,  0,  0,  0, 25,  7,  0,  0,201,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32d0 */  64,  7,  0,  0,205,  0,  0,  0,  0,  0,  0,  0, 84,  7,  0,  0,
+/* 0x32e0 */ 207,  0,  0,  0,  0,  0,  0,  0,102,  7,  0,  0,  0,  0,  0,  0,
+/* 0x32f0 */   0,  0,  0,  0,109,  7,  0,  0,210,  0,  0,  0,173,222,173,222,
+/* 0x3300 */ 127,  7,  0,  0,210,  0,  0,  0,173,222,173,222,138,  7,  0,  0,
+/* 0x3310 */ 210,  0,  0,  0,173,222,173,222,149,  7,  0,  0,210,  0,  0,  0,
+/* 0x3320 */ 173,222,173,222,165,  7,  0,  0,210,  0,  0,  0,173,222,173,222,
+/* 0x3330 */ 179,  7,  0,  0,210,  0,  0,  0,173,222,173,222,190,  7,  0,  0,
+/* 0x3340 */ 210,  0,  0,  0,173,222,173,222,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x3350 */ 195,  7,  0,  0,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3360 */   0,  0,  0,  0, 21,  0,  0,  0,195,  7,  0,  0, 16,  7,  0,  0,
+/* 0x3370 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,
+/* 0x3380 */ 195,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3390 */   0,  0,  0,  0, 37,  0,  0,  0,204,  7,  0,  0, 93,  7,  0,  0,
+/* 0x33a0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,
+/* 0x33b0 */ 195,  7,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33c0 */   0,  0,  0,  0, 57,  0,  0,  0,195,  7,  0,  0, 18,  0,  0,  0,
+/* 0x33d0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 68,  0,  0,  0,
+/* 0x33e0 */ 195,  7,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33f0 */   0,  0,  0,  0, 79,  0,  0,  0,195,  7,  0,  0, 36,  0,  0,  0,
+/* 0x3400 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3410 */ 215,  7,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3420 */   7,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0, 81,  0,  0,  0,
+/* 0x3430 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3440 */ 215,  7,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3450 */  11,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0, 72,  0,  0,  0,
+/* 0x3460 */   0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 12,  0,  0,  0,
+/* 0x3470 */ 215,  7,  0,  0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3480 */  14,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0,108,  0,  0,  0,
+/* 0x3490 */   0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0, 14,  0,  0,  0,
+/* 0x34a0 */ 215,  7,  0,  0,108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34b0 */  15,  0,  0,  0, 17,  0,  0,  0,215,  7,  0,  0,216,  0,  0,  0,
+/* 0x34c0 */   0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0, 47,  0,  0,  0,
+/* 0x34d0 */ 215,  7,  0,  0,180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x34e0 */  16,  0,  0,  0, 12,  0,  0,  0,215,  7,  0,  0,135,  0,  0,  0,
+/* 0x34f0 */   0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3500 */ 215,  7,  0,  0,135,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3510 */  17,  0,  0,  0, 14,  0,  0,  0,215,  7,  0,  0,135,  0,  0,  0,
+/* 0x3520 */   0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,  8,  0,  0,  0,
+/* 0x3530 */ 204,  7,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3540 */  22,  0,  0,  0, 10,  0,  0,  0,215,  7,  0,  0,207,  0,  0,  0,
+/* 0x3550 */   0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0, 21,  0,  0,  0,
+/* 0x3560 */ 204,  7,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3570 */  23,  0,  0,  0, 18,  0,  0,  0,204,  7,  0,  0, 81,  0,  0,  0,
+/* 0x3580 */   0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3590 */ 215,  7,  0,  0,252,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35a0 */  26,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,252,  0,  0,  0,
+/* 0x35b0 */   0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,  1,  0,  0,  0,
+/* 0x35c0 */ 215,  7,  0,  0,225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x35d0 */  30,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0,243,  0,  0,  0,
+/* 0x35e0 */   0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 12,  0,  0,  0,
+/* 0x35f0 */ 215,  7,  0,  0, 50,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3600 */  33,  0,  0,  0,  5,  0,  0,  0,215,  7,  0,  0, 50,  1,  0,  0,
+/* 0x3610 */   0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0, 14,  0,  0,  0,
+/* 0x3620 */ 215,  7,  0,  0, 50,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3630 */  34,  0,  0,  0, 15,  0,  0,  0,215,  7,  0,  0, 23,  1,  0,  0,
+/* 0x3640 */   0,  0,  0,  0,  0,  0,  0,  0, 34,  0,  0,  0, 33,  0,  0,  0,
+/* 0x3650 */ 215,  7,  0,  0,131,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3660 */  34,  0,  0,  0, 67,  0,  0,  0,215,  7,  0,  0, 95,  1,  0,  0,
+/* 0x3670 */   0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 12,  0,  0,  0,
+/* 0x3680 */ 215,  7,  0,  0, 50,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3690 */  36,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0, 50,  1,  0,  0,
+/* 0x36a0 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0, 14,  0,  0,  0,
+/* 0x36b0 */ 215,  7,  0,  0, 50,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36c0 */  40,  0,  0,  0,  8,  0,  0,  0,204,  7,  0,  0,252,  0,  0,  0,
+/* 0x36d0 */   0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0, 10,  0,  0,  0,
+/* 0x36e0 */ 215,  7,  0,  0,122,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x36f0 */  41,  0,  0,  0, 21,  0,  0,  0,204,  7,  0,  0,252,  0,  0,  0,
+/* 0x3700 */   0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0, 18,  0,  0,  0,
+/* 0x3710 */ 204,  7,  0,  0,252,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3720 */  44,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,167,  1,  0,  0,
+/* 0x3730 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3740 */ 215,  7,  0,  0,167,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3750 */  48,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,140,  1,  0,  0,
+/* 0x3760 */   0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3770 */ 215,  7,  0,  0,158,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3780 */  51,  0,  0,  0, 12,  0,  0,  0,215,  7,  0,  0,221,  1,  0,  0,
+/* 0x3790 */   0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  5,  0,  0,  0,
+/* 0x37a0 */ 215,  7,  0,  0,221,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37b0 */  52,  0,  0,  0, 14,  0,  0,  0,215,  7,  0,  0,221,  1,  0,  0,
+/* 0x37c0 */   0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0, 15,  0,  0,  0,
+/* 0x37d0 */ 215,  7,  0,  0,194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x37e0 */  53,  0,  0,  0, 30,  0,  0,  0,215,  7,  0,  0, 10,  2,  0,  0,
+/* 0x37f0 */   0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0, 48,  0,  0,  0,
+/* 0x3800 */ 215,  7,  0,  0, 46,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3810 */  54,  0,  0,  0, 12,  0,  0,  0,215,  7,  0,  0,221,  1,  0,  0,
+/* 0x3820 */   0,  0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3830 */ 215,  7,  0,  0,221,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3840 */  55,  0,  0,  0, 14,  0,  0,  0,215,  7,  0,  0,221,  1,  0,  0,
+/* 0x3850 */   0,  0,  0,  0,  0,  0,  0,  0, 59,  0,  0,  0,  8,  0,  0,  0,
+/* 0x3860 */ 204,  7,  0,  0,167,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3870 */  60,  0,  0,  0, 10,  0,  0,  0,215,  7,  0,  0, 37,  2,  0,  0,
+/* 0x3880 */   0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0, 21,  0,  0,  0,
+/* 0x3890 */ 204,  7,  0,  0,167,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38a0 */  61,  0,  0,  0, 18,  0,  0,  0,204,  7,  0,  0,167,  1,  0,  0,
+/* 0x38b0 */   0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,  2,  0,  0,  0,
+/* 0x38c0 */ 204,  7,  0,  0,199,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x38d0 */  67,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0,100,  2,  0,  0,
+/* 0x38e0 */   0,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0,  1,  0,  0,  0,
+/* 0x38f0 */ 215,  7,  0,  0,190,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3900 */  73,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,190,  2,  0,  0,
+/* 0x3910 */   0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,  6,  0,  0,  0,
+/* 0x3920 */ 215,  7,  0,  0,154,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3930 */  76,  0,  0,  0, 16,  0,  0,  0,215,  7,  0,  0,190,  2,  0,  0,
+/* 0x3940 */   0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0, 22,  0,  0,  0,
+/* 0x3950 */ 204,  7,  0,  0, 87,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3960 */  78,  0,  0,  0,  6,  0,  0,  0,215,  7,  0,  0, 15,  3,  0,  0,
+/* 0x3970 */   0,  0,  0,  0,  0,  0,  0,  0, 78,  0,  0,  0, 10,  0,  0,  0,
+/* 0x3980 */ 215,  7,  0,  0,172,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3990 */  78,  0,  0,  0, 16,  0,  0,  0,215,  7,  0,  0, 15,  3,  0,  0,
+/* 0x39a0 */   0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  1,  0,  0,  0,
+/* 0x39b0 */ 215,  7,  0,  0, 15,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39c0 */  82,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0, 15,  3,  0,  0,
+/* 0x39d0 */   0,  0,  0,  0,  0,  0,  0,  0, 83,  0,  0,  0,  1,  0,  0,  0,
+/* 0x39e0 */ 215,  7,  0,  0, 15,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x39f0 */  84,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0, 15,  3,  0,  0,
+/* 0x3a00 */   0,  0,  0,  0,  0,  0,  0,  0, 85,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3a10 */ 215,  7,  0,  0,  6,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a20 */  86,  0,  0,  0,  3,  0,  0,  0,204,  7,  0,  0,109,  2,  0,  0,
+/* 0x3a30 */   0,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3a40 */ 215,  7,  0,  0, 15,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a50 */  89,  0,  0,  0, 15,  0,  0,  0,215,  7,  0,  0, 87,  3,  0,  0,
+/* 0x3a60 */   0,  0,  0,  0,  0,  0,  0,  0, 91,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3a70 */ 215,  7,  0,  0, 87,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3a80 */  94,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0, 60,  3,  0,  0,
+/* 0x3a90 */   0,  0,  0,  0,  0,  0,  0,  0, 95,  0,  0,  0, 33,  0,  0,  0,
+/* 0x3aa0 */ 204,  7,  0,  0,208,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ab0 */  97,  0,  0,  0,  5,  0,  0,  0,195,  7,  0,  0,109,  7,  0,  0,
+/* 0x3ac0 */   0,  0,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0, 20,  0,  0,  0,
+/* 0x3ad0 */ 195,  7,  0,  0,127,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ae0 */  97,  0,  0,  0, 30,  0,  0,  0,195,  7,  0,  0,138,  7,  0,  0,
+/* 0x3af0 */   0,  0,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0, 42,  0,  0,  0,
+/* 0x3b00 */ 195,  7,  0,  0,149,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b10 */ 102,  0,  0,  0,  1,  0,  0,  0,204,  7,  0,  0,167,  3,  0,  0,
+/* 0x3b20 */   0,  0,  0,  0,  0,  0,  0,  0,104,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3b30 */ 195,  7,  0,  0,165,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b40 */ 105,  0,  0,  0,  2,  0,  0,  0,225,  7,  0,  0,179,  7,  0,  0,
+/* 0x3b50 */   0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,  4,  0,  0,  0,
+/* 0x3b60 */ 215,  7,  0,  0,176,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3b70 */ 110,  0,  0,  0, 13,  0,  0,  0,215,  7,  0,  0,176,  3,  0,  0,
+/* 0x3b80 */   0,  0,  0,  0,  0,  0,  0,  0,111,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3b90 */ 195,  7,  0,  0,165,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ba0 */ 114,  0,  0,  0,  3,  0,  0,  0,215,  7,  0,  0, 64,  4,  0,  0,
+/* 0x3bb0 */   0,  0,  0,  0,  0,  0,  0,  0,115,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3bc0 */ 225,  7,  0,  0,179,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3bd0 */ 115,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0, 10,  4,  0,  0,
+/* 0x3be0 */   0,  0,  0,  0,  0,  0,  0,  0,120,  0,  0,  0,  4,  0,  0,  0,
+/* 0x3bf0 */ 215,  7,  0,  0,239,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c00 */ 121,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,136,  4,  0,  0,
+/* 0x3c10 */   0,  0,  0,  0,  0,  0,  0,  0,124,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3c20 */ 195,  7,  0,  0,190,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c30 */ 128,  0,  0,  0,  1,  0,  0,  0,204,  7,  0,  0,213,  5,  0,  0,
+/* 0x3c40 */   0,  0,  0,  0,  0,  0,  0,  0,132,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3c50 */ 215,  7,  0,  0,191,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c60 */ 133,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0,191,  6,  0,  0,
+/* 0x3c70 */   0,  0,  0,  0,  0,  0,  0,  0,138,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3c80 */ 215,  7,  0,  0,177,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3c90 */ 140,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,177,  5,  0,  0,
+/* 0x3ca0 */   0,  0,  0,  0,  0,  0,  0,  0,141,  0,  0,  0,  4,  0,  0,  0,
+/* 0x3cb0 */ 215,  7,  0,  0, 42,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3cc0 */ 146,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0,177,  5,  0,  0,
+/* 0x3cd0 */   0,  0,  0,  0,  0,  0,  0,  0,155,  0,  0,  0,  6,  0,  0,  0,
+/* 0x3ce0 */ 215,  7,  0,  0,168,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3cf0 */ 164,  0,  0,  0,  6,  0,  0,  0,215,  7,  0,  0,191,  6,  0,  0,
+/* 0x3d00 */   0,  0,  0,  0,  0,  0,  0,  0,166,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3d10 */ 204,  7,  0,  0,213,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d20 */ 178,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0, 47,  6,  0,  0,
+/* 0x3d30 */   0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,  7,  0,  0,  0,
+/* 0x3d40 */ 215,  7,  0,  0,145,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d50 */ 184,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,199,  4,  0,  0,
+/* 0x3d60 */   0,  0,  0,  0,  0,  0,  0,  0,186,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3d70 */ 215,  7,  0,  0,199,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3d80 */ 187,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,191,  6,  0,  0,
+/* 0x3d90 */   0,  0,  0,  0,  0,  0,  0,  0,188,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3da0 */ 215,  7,  0,  0,182,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3db0 */ 189,  0,  0,  0,  1,  0,  0,  0,215,  7,  0,  0,182,  6,  0,  0,
+/* 0x3dc0 */   0,  0,  0,  0,  0,  0,  0,  0,190,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3dd0 */ 215,  7,  0,  0,199,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3de0 */ 191,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0, 83,  6,  0,  0,
+/* 0x3df0 */   0,  0,  0,  0,  0,  0,  0,  0,202,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3e00 */ 215,  7,  0,  0, 54,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e10 */ 203,  0,  0,  0, 13,  0,  0,  0,215,  7,  0,  0, 54,  7,  0,  0,
+/* 0x3e20 */   0,  0,  0,  0,  0,  0,  0,  0,204,  0,  0,  0,  5,  0,  0,  0,
+/* 0x3e30 */ 215,  7,  0,  0, 74,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e40 */ 204,  0,  0,  0, 10,  0,  0,  0,215,  7,  0,  0, 74,  7,  0,  0,
+/* 0x3e50 */   0,  0,  0,  0,  0,  0,  0,  0,204,  0,  0,  0, 16,  0,  0,  0,
+/* 0x3e60 */ 215,  7,  0,  0, 74,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3e70 */ 205,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0, 74,  7,  0,  0,
+/* 0x3e80 */   0,  0,  0,  0,  0,  0,  0,  0,205,  0,  0,  0,  9,  0,  0,  0,
+/* 0x3e90 */ 215,  7,  0,  0, 44,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3ea0 */ 206,  0,  0,  0,  4,  0,  0,  0,215,  7,  0,  0, 34,  7,  0,  0,
+/* 0x3eb0 */   0,  0,  0,  0,  0,  0,  0,  0, 76, 88, 80, 84, 73, 48, 48, 48,
+/* 0x3ec0 */   0, 76, 88, 80, 84, 73, 48, 52, 48,  0, 76, 88, 80, 84, 73, 48,
+/* 0x3ed0 */  52, 49,  0, 76, 88, 80, 84, 73, 48, 52, 50,  0, 76, 88, 80, 84,
+/* 0x3ee0 */  73, 48, 52, 51,  0, 76, 88, 80, 84, 73, 48, 53, 48,  0, 78, 50,
+/* 0x3ef0 */  66, 83, 77, 65, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 48,  0,
+/* 0x3f00 */  78, 50, 66, 70, 65, 83, 49, 49,  0, 78, 50, 66, 68, 69, 67, 49,
+/* 0x3f10 */  48,  0, 78, 50, 66, 83, 77, 65, 50, 48,  0, 78, 50, 66, 70, 65,
+/* 0x3f20 */  83, 50, 48,  0, 78, 50, 66, 68, 69, 67, 50, 48,  0, 78, 50, 66,
+/* 0x3f30 */  83, 77, 65, 51, 48,  0, 78, 50, 66, 70, 65, 83, 51, 48,  0, 78,
+/* 0x3f40 */  50, 66, 68, 69, 67, 51, 48,  0, 78, 50, 66, 83, 77, 65, 52, 48,
+/* 0x3f50 */   0, 78, 50, 66, 70, 65, 83, 52, 48,  0, 78, 50, 66, 83, 77, 65,
+/* 0x3f60 */  53, 48,  0, 78, 50, 66, 70, 65, 83, 53, 48,  0, 78, 50, 66, 68,
+/* 0x3f70 */  69, 67, 53, 48,  0, 78, 50, 66, 83, 77, 65, 54, 48,  0, 78, 50,
+/* 0x3f80 */  66, 70, 65, 83, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 49,  0,
+/* 0x3f90 */  78, 50, 66, 68, 69, 67, 54, 48,  0, 78, 50, 68, 83, 77, 65, 49,
+/* 0x3fa0 */  48,  0, 78, 50, 68, 70, 65, 83, 49, 48,  0, 78, 50, 68, 70, 65,
+/* 0x3fb0 */  83, 49, 49,  0, 78, 50, 68, 68, 69, 67, 49, 48,  0, 78, 50, 68,
+/* 0x3fc0 */  83, 77, 65, 50, 48,  0, 78, 50, 68, 70, 65, 83, 50, 48,  0, 78,
+/* 0x3fd0 */  50, 68, 68, 69, 67, 50, 48,  0, 78, 50, 68, 83, 77, 65, 51, 48,
+/* 0x3fe0 */   0, 78, 50, 68, 70, 65, 83, 51, 48,  0, 78, 50, 68, 68, 69, 67,
+/* 0x3ff0 */  51, 48,  0, 78, 50, 68, 83, 77, 65, 52, 48,  0, 78, 50, 68, 70,
+/* 0x4000 */  65, 83, 52, 48,  0, 78, 50, 68, 83, 77, 65, 53, 48,  0, 78, 50,
+/* 0x4010 */  68, 70, 65, 83, 53, 48,  0, 78, 50, 68, 68, 69, 67, 53, 48,  0,
+/* 0x4020 */  78, 50, 68, 83, 77, 65, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54,
+/* 0x4030 */  48,  0, 78, 50, 68, 70, 65, 83, 54, 49,  0, 78, 50, 68, 68, 69,
+/* 0x4040 */  67, 54, 48,  0, 78, 50, 69, 83, 77, 65, 49, 48,  0, 78, 50, 69,
+/* 0x4050 */  70, 65, 83, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 49,  0, 78,
+/* 0x4060 */  50, 69, 68, 69, 67, 49, 48,  0, 78, 50, 69, 83, 77, 65, 50, 48,
+/* 0x4070 */   0, 78, 50, 69, 70, 65, 83, 50, 48,  0, 78, 50, 69, 68, 69, 67,
+/* 0x4080 */  50, 48,  0, 78, 50, 69, 83, 77, 65, 51, 48,  0, 78, 50, 69, 70,
+/* 0x4090 */  65, 83, 51, 48,  0, 78, 50, 69, 68, 69, 67, 51, 48,  0, 78, 50,
+/* 0x40a0 */  69, 83, 77, 65, 52, 48,  0, 78, 50, 69, 70, 65, 83, 52, 48,  0,
+/* 0x40b0 */  78, 50, 69, 83, 77, 65, 53, 48,  0, 78, 50, 69, 70, 65, 83, 53,
+/* 0x40c0 */  48,  0, 78, 50, 69, 68, 69, 67, 53, 48,  0, 78, 50, 69, 83, 77,
+/* 0x40d0 */  65, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 48,  0, 78, 50, 69,
+/* 0x40e0 */  70, 65, 83, 54, 49,  0, 78, 50, 69, 68, 69, 67, 54, 48,  0, 67,
+/* 0x40f0 */  76, 49, 83, 77, 65, 49, 66,  0, 67, 76, 49, 70, 65, 83, 49, 66,
+/* 0x4100 */   0, 67, 76, 49, 71, 69, 84, 49, 66,  0, 67, 76, 49, 69, 78, 84,
+/* 0x4110 */  69, 82,  0, 67, 76, 49, 83, 77, 65, 49, 48,  0, 67, 76, 49, 82,
+/* 0x4120 */  76, 79, 65, 68,  0, 67, 76, 49, 87, 73, 68, 48, 49,  0, 67, 76,
+/* 0x4130 */  49, 87, 73, 68, 48, 50,  0, 67, 76, 49, 87, 73, 68, 48, 51,  0,
+/* 0x4140 */  67, 76, 49, 87, 73, 68, 48, 52,  0, 67, 76, 49, 87, 73, 68, 48,
+/* 0x4150 */  53,  0, 67, 76, 49, 87, 73, 68, 48, 54,  0, 67, 76, 49, 87, 73,
+/* 0x4160 */  68, 48, 55,  0, 67, 76, 49, 87, 73, 68, 48, 56,  0, 67, 76, 49,
+/* 0x4170 */  87, 73, 68, 48, 57,  0, 67, 76, 49, 87, 73, 68, 49, 48,  0, 67,
+/* 0x4180 */  76, 49, 83, 84, 65, 82, 84,  0, 67, 76, 49, 84, 79, 80, 48, 48,
+/* 0x4190 */   0, 67, 76, 49, 84, 79, 80, 48, 49,  0, 67, 76, 49, 84, 79, 80,
+/* 0x41a0 */  48, 50,  0, 67, 76, 49, 84, 79, 80, 48, 51,  0, 67, 76, 49, 84,
+/* 0x41b0 */  79, 80, 48, 52,  0, 67, 76, 49, 84, 79, 80, 48, 53,  0, 67, 76,
+/* 0x41c0 */  49, 84, 79, 80, 48, 54,  0, 67, 76, 49, 84, 79, 80, 48, 55,  0,
+/* 0x41d0 */  67, 76, 49, 79, 70, 70, 48, 49,  0, 67, 76, 49, 79, 70, 70, 48,
+/* 0x41e0 */  50,  0, 67, 76, 49, 79, 70, 70, 48, 51,  0, 67, 76, 49, 79, 70,
+/* 0x41f0 */  70, 48, 52,  0, 67, 76, 49, 76, 69, 78, 48, 48,  0, 67, 76, 49,
+/* 0x4200 */  76, 69, 78, 48, 49,  0, 67, 76, 49, 76, 69, 78, 48, 50,  0, 67,
+/* 0x4210 */  76, 49, 67, 79, 80, 89, 48,  0, 67, 76, 49, 69, 78, 68,  0, 76,
+/* 0x4220 */  90, 77, 65, 95, 68, 69, 67, 48, 48,  0, 76, 90, 77, 65, 95, 69,
+/* 0x4230 */  76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0,
+/* 0x4240 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95,
+/* 0x4250 */  68, 69, 67, 51, 48,  0, 76, 88, 80, 84, 73, 48, 57, 48,  0, 76,
+/* 0x4260 */  88, 80, 84, 73, 48, 57, 49,  0, 67, 65, 76, 76, 84, 82, 48, 48,
+/* 0x4270 */   0, 67, 84, 67, 76, 69, 86, 69, 49,  0, 67, 65, 76, 76, 84, 82,
+/* 0x4280 */  48, 49,  0, 67, 84, 66, 83, 72, 82, 48, 49,  0, 67, 84, 66, 82,
+/* 0x4290 */  79, 82, 48, 49,  0, 67, 84, 66, 83, 87, 65, 48, 49,  0, 67, 65,
+/* 0x42a0 */  76, 76, 84, 82, 48, 50,  0, 67, 65, 76, 76, 84, 82, 49, 48,  0,
+/* 0x42b0 */  67, 65, 76, 76, 84, 82, 69, 56,  0, 67, 65, 76, 76, 84, 82, 69,
+/* 0x42c0 */  57,  0, 67, 65, 76, 76, 84, 82, 49, 49,  0, 67, 84, 67, 76, 69,
+/* 0x42d0 */  86, 69, 50,  0, 67, 65, 76, 76, 84, 82, 49, 50,  0, 67, 84, 66,
+/* 0x42e0 */  83, 72, 82, 49, 49,  0, 67, 84, 66, 82, 79, 82, 49, 49,  0, 67,
+/* 0x42f0 */  84, 66, 83, 87, 65, 49, 49,  0, 67, 65, 76, 76, 84, 82, 49, 51,
+/* 0x4300 */   0, 76, 88, 85, 78, 70, 48, 48, 48,  0, 76, 88, 85, 78, 70, 48,
+/* 0x4310 */  48, 50,  0, 77, 82, 85, 66, 89, 84, 69, 48,  0, 76, 88, 77, 82,
+/* 0x4320 */  85, 48, 48, 53,  0, 76, 88, 77, 82, 85, 48, 48, 54,  0, 76, 88,
+/* 0x4330 */  77, 82, 85, 48, 48, 55,  0, 76, 88, 85, 78, 70, 48, 48, 56,  0,
+/* 0x4340 */  76, 88, 85, 78, 70, 48, 49, 48,  0, 76, 88, 74, 67, 67, 48, 49,
+/* 0x4350 */  48,  0, 76, 88, 77, 82, 85, 48, 52, 53,  0, 76, 88, 77, 82, 85,
+/* 0x4360 */  48, 52, 54,  0, 76, 88, 74, 67, 67, 48, 50, 48,  0, 76, 88, 74,
+/* 0x4370 */  67, 67, 48, 50, 49,  0, 76, 88, 74, 67, 67, 48, 50, 51,  0, 76,
+/* 0x4380 */  88, 85, 78, 70, 48, 51, 55,  0, 76, 88, 85, 78, 70, 51, 56, 54,
+/* 0x4390 */   0, 76, 88, 85, 78, 70, 51, 56, 55,  0, 76, 88, 85, 78, 70, 51,
+/* 0x43a0 */  56, 56,  0, 76, 88, 85, 78, 70, 52, 56, 54,  0, 76, 88, 85, 78,
+/* 0x43b0 */  70, 52, 56, 55,  0, 76, 88, 77, 82, 85, 48, 54, 53,  0, 77, 82,
+/* 0x43c0 */  85, 66, 89, 84, 69, 51,  0, 77, 82, 85, 65, 82, 66, 51, 48,  0,
+/* 0x43d0 */  77, 82, 85, 66, 73, 84, 83, 51,  0, 77, 82, 85, 65, 82, 66, 52,
+/* 0x43e0 */  48,  0, 76, 88, 77, 82, 85, 48, 55, 48,  0, 77, 82, 85, 66, 89,
+/* 0x43f0 */  84, 69, 52,  0, 77, 82, 85, 66, 73, 84, 83, 52,  0, 77, 82, 85,
+/* 0x4400 */  65, 82, 66, 53, 48,  0, 76, 88, 77, 82, 85, 48, 56, 48,  0, 77,
+/* 0x4410 */  82, 85, 66, 89, 84, 69, 53,  0, 77, 82, 85, 65, 82, 66, 54, 48,
+/* 0x4420 */   0, 77, 82, 85, 66, 73, 84, 83, 53,  0, 77, 82, 85, 65, 82, 66,
+/* 0x4430 */  55, 48,  0, 76, 88, 77, 82, 85, 48, 57, 48,  0, 77, 82, 85, 66,
+/* 0x4440 */  89, 84, 69, 54,  0, 77, 82, 85, 65, 82, 66, 56, 48,  0, 77, 82,
+/* 0x4450 */  85, 66, 73, 84, 83, 54,  0, 77, 82, 85, 65, 82, 66, 57, 48,  0,
+/* 0x4460 */  76, 88, 77, 82, 85, 49, 48, 48,  0, 76, 88, 85, 78, 70, 48, 52,
+/* 0x4470 */  48,  0, 76, 88, 77, 82, 85, 49, 49, 48,  0, 76, 88, 77, 82, 85,
+/* 0x4480 */  49, 49, 49,  0, 76, 88, 85, 78, 70, 48, 52, 49,  0, 76, 88, 85,
+/* 0x4490 */  78, 70, 48, 52, 50,  0, 76, 69, 88, 69, 67, 48, 49, 54,  0, 76,
+/* 0x44a0 */  88, 77, 82, 85, 48, 49, 48,  0, 76, 88, 74, 77, 80, 65, 48, 48,
+/* 0x44b0 */   0, 76, 88, 67, 65, 76, 76, 66, 48,  0, 76, 88, 85, 78, 70, 48,
+/* 0x44c0 */  50, 49,  0, 76, 88, 77, 82, 85, 48, 50, 50,  0, 76, 88, 74, 77,
+/* 0x44d0 */  80, 65, 48, 49,  0, 76, 88, 67, 65, 76, 76, 66, 49,  0, 77, 82,
+/* 0x44e0 */  85, 66, 73, 84, 83, 49,  0, 76, 88, 77, 82, 85, 48, 51, 48,  0,
+/* 0x44f0 */  77, 82, 85, 66, 89, 84, 69, 49,  0, 77, 82, 85, 65, 82, 66, 49,
+/* 0x4500 */  48,  0, 76, 88, 77, 82, 85, 48, 52, 48,  0, 76, 88, 85, 78, 70,
+/* 0x4510 */  48, 51, 48,  0, 76, 88, 74, 67, 67, 48, 48, 48,  0, 76, 88, 67,
+/* 0x4520 */  74, 48, 77, 82, 85,  0, 76, 88, 67, 74, 49, 77, 82, 85,  0, 76,
+/* 0x4530 */  88, 67, 65, 76, 74, 77, 80,  0, 76, 88, 67, 65, 76, 76, 48, 48,
+/* 0x4540 */   0, 76, 88, 67, 65, 76, 76, 48, 49,  0, 76, 88, 67, 74, 50, 77,
+/* 0x4550 */  82, 85,  0, 76, 88, 67, 74, 52, 77, 82, 85,  0, 76, 88, 67, 74,
+/* 0x4560 */  54, 77, 82, 85,  0, 76, 88, 67, 74, 55, 77, 82, 85,  0, 76, 88,
+/* 0x4570 */  67, 74, 56, 77, 82, 85,  0, 76, 88, 85, 78, 70, 48, 51, 52,  0,
+/* 0x4580 */  76, 88, 77, 82, 85, 48, 53, 53,  0, 77, 82, 85, 66, 89, 84, 69,
+/* 0x4590 */  50,  0, 77, 82, 85, 66, 73, 84, 83, 50,  0, 77, 82, 85, 65, 82,
+/* 0x45a0 */  66, 50, 48,  0, 76, 88, 77, 82, 85, 48, 53, 55,  0, 76, 88, 77,
+/* 0x45b0 */  82, 85, 48, 53, 56,  0, 76, 88, 85, 78, 70, 48, 51, 53,  0, 76,
+/* 0x45c0 */  88, 80, 84, 73, 49, 52, 48,  0, 76, 88, 80, 84, 73, 49, 52, 49,
+/* 0x45d0 */   0, 76, 88, 80, 84, 73, 49, 53, 48,  0, 99,116,111,107, 51, 50,
+/* 0x45e0 */  46, 48, 48,  0, 99,116,111,107, 51, 50, 46, 49, 48,  0, 99,116,
+/* 0x45f0 */ 111,107, 51, 50, 46, 50, 48,  0, 99,116,111,107, 51, 50, 46, 51,
+/* 0x4600 */  48,  0, 99,116,111,107, 51, 50, 46, 52, 48,  0, 76, 88, 80, 84,
+/* 0x4610 */  73, 49, 54, 48,  0, 76, 88, 80, 84, 73, 50, 48, 48,  0, 95,115,
+/* 0x4620 */ 116, 97,114,116,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95,
+/* 0x4630 */  97,100,106,117,115,116,  0,108,122,109, 97, 95,117, 95,108,101,
+/* 0x4640 */ 110,  0,108,122,109, 97, 95, 99, 95,108,101,110,  0,108,122,109,
+/* 0x4650 */  97, 95,112,114,111,112,101,114,116,105,101,115,  0,102,105,108,
+/* 0x4660 */ 116,101,114, 95,108,101,110,103,116,104,  0,102,105,108,116,101,
+/* 0x4670 */ 114, 95, 99,116,111,  0, 78, 77, 82, 85,  0, 82, 95, 51, 56, 54,
+/* 0x4680 */  95, 51, 50,  0, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0, 82,
+/* 0x4690 */  95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51, 56, 54, 95, 56,
+/* 0x46a0 */   0,252, 27,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
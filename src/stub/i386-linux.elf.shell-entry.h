@@ -1,5 +1,5 @@
 /* i386-linux.elf.shell-entry.h
-   created from i386-linux.elf.shell-entry.bin, 24636 (0x603c) bytes
+   created from i386-linux.elf.shell-entry.bin, 13414 (0x3466) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_ELF_SHELL_ENTRY_SIZE    24636
-#define STUB_I386_LINUX_ELF_SHELL_ENTRY_ADLER32 0x11c6bed0
-#define STUB_I386_LINUX_ELF_SHELL_ENTRY_CRC32   0x83ff1e3e
+#define STUB_I386_LINUX_ELF_SHELL_ENTRY_SIZE    13414
+#define STUB_I386_LINUX_ELF_SHELL_ENTRY_ADLER32 0x63126b63
+#define STUB_I386_LINUX_ELF_SHELL_ENTRY_CRC32   0x941895ff
 
-unsigned char stub_i386_linux_elf_shell_entry[24636] = {
+unsigned char stub_i386_linux_elf_shell_entry[13414] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 168, 31,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -458,1122 +458,421 @@ unsigned char stub_i386_linux_elf_shell_entry[24636] = {
 /* 0x1a30 */  48,137, 58,137, 68, 36, 28, 97,195, 93,184,  0,  0, 64,  1,141,
 /* 0x1a40 */ 144,140,  0,  0,  0,  3, 64, 72,  5,255, 15,  0,  0, 37,  0,240,
 /* 0x1a50 */ 255,255,106,  0,106,255,106, 50,106,  3,255, 50, 80,137,227,106,
-/* 0x1a60 */  90, 88,205,128,131,196, 24,141, 88,  3,102,105,108,101, 32,102,
-/* 0x1a70 */ 111,114,109, 97,116, 32,101,108,102, 51, 50, 45,105, 51, 56, 54,
-/* 0x1a80 */  10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120, 32,
-/* 0x1a90 */  78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,105,
-/* 0x1aa0 */ 122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1ab0 */  32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,101,
-/* 0x1ac0 */  32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,103,
-/* 0x1ad0 */ 115, 10, 32, 32, 48, 32, 76, 69, 88, 69, 67, 48, 48, 48, 32, 32,
-/* 0x1ae0 */  32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x1af0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1b00 */  83, 10, 32, 32, 49, 32, 76, 69, 88, 69, 67, 48, 49, 48, 32, 32,
-/* 0x1b10 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x1b20 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1b30 */  83, 10, 32, 32, 50, 32, 78, 50, 66, 83, 77, 65, 49, 48, 32, 32,
-/* 0x1b40 */  32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,
-/* 0x1b50 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1b60 */  83, 10, 32, 32, 51, 32, 78, 50, 66, 70, 65, 83, 49, 48, 32, 32,
-/* 0x1b70 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,
-/* 0x1b80 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1b90 */  83, 10, 32, 32, 52, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 32,
-/* 0x1ba0 */  32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,
-/* 0x1bb0 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1bc0 */  83, 10, 32, 32, 53, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 32,
-/* 0x1bd0 */  32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53,
-/* 0x1be0 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1bf0 */  83, 10, 32, 32, 54, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 32,
-/* 0x1c00 */  32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53,
-/* 0x1c10 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1c20 */  83, 10, 32, 32, 55, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 32,
-/* 0x1c30 */  32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 54,
-/* 0x1c40 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1c50 */  83, 10, 32, 32, 56, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 32,
-/* 0x1c60 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 54,
-/* 0x1c70 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1c80 */  83, 10, 32, 32, 57, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 32,
-/* 0x1c90 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 55,
-/* 0x1ca0 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1cb0 */  83, 10, 32, 49, 48, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 32,
-/* 0x1cc0 */  32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 56,
-/* 0x1cd0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1ce0 */  83, 10, 32, 49, 49, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 32,
-/* 0x1cf0 */  32, 32, 32, 32, 48, 51,101, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1d00 */  57, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1d10 */  84, 83, 10, 32, 49, 50, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32,
-/* 0x1d20 */  32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1d30 */ 100, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1d40 */  84, 83, 10, 32, 49, 51, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32,
-/* 0x1d50 */  32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1d60 */ 100,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1d70 */  84, 83, 10, 32, 49, 52, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32,
-/* 0x1d80 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1d90 */ 101,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1da0 */  84, 83, 10, 32, 49, 53, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32,
-/* 0x1db0 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1dc0 */ 101,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1dd0 */  84, 83, 10, 32, 49, 54, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32,
-/* 0x1de0 */  32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1df0 */ 102, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1e00 */  84, 83, 10, 32, 49, 55, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32,
-/* 0x1e10 */  32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1e20 */ 102, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1e30 */  84, 83, 10, 32, 49, 56, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32,
-/* 0x1e40 */  32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1e50 */  48, 49, 48, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1e60 */  69, 78, 84, 83, 10, 32, 49, 57, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x1e70 */  49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48,
-/* 0x1e80 */  32, 32, 48, 49, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1e90 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 48, 32, 78, 50, 66, 68, 69,
-/* 0x1ea0 */  67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1eb0 */  32, 32, 48, 49, 51, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1ec0 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 49, 32, 78, 50, 68, 83, 77,
-/* 0x1ed0 */  65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x1ee0 */  48, 32, 32, 48, 49, 51, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1ef0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 50, 32, 78, 50, 68, 70,
-/* 0x1f00 */  65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x1f10 */  32, 48, 32, 32, 48, 49, 51, 57, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f20 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 51, 32, 78, 50, 68,
-/* 0x1f30 */  70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48,
-/* 0x1f40 */  32, 32, 48, 32, 32, 48, 49, 51, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1f50 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 52, 32, 78, 50,
-/* 0x1f60 */  68, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32,
-/* 0x1f70 */  48, 32, 32, 48, 32, 32, 48, 49, 52, 49, 32, 32, 50, 42, 42, 48,
-/* 0x1f80 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 53, 32, 78,
-/* 0x1f90 */  50, 68, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x1fa0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 52, 99, 32, 32, 50, 42, 42,
-/* 0x1fb0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 54, 32,
-/* 0x1fc0 */  78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57,
-/* 0x1fd0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 53, 49, 32, 32, 50, 42,
-/* 0x1fe0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 55,
-/* 0x1ff0 */  32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2000 */ 100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 53, 97, 32, 32, 50,
-/* 0x2010 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x2020 */  56, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2030 */  48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 54, 55, 32, 32,
-/* 0x2040 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2050 */  50, 57, 32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32,
-/* 0x2060 */  32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 52, 32,
-/* 0x2070 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2080 */  32, 51, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 32, 32, 32,
-/* 0x2090 */  32, 32, 48, 53, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56,
-/* 0x20a0 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x20b0 */  83, 10, 32, 51, 49, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 32,
-/* 0x20c0 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x20d0 */ 100, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x20e0 */  84, 83, 10, 32, 51, 50, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32,
-/* 0x20f0 */  32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2100 */  49,101, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2110 */  78, 84, 83, 10, 32, 51, 51, 32, 78, 50, 68, 83, 77, 65, 53, 48,
-/* 0x2120 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2130 */  48, 49,102, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2140 */  69, 78, 84, 83, 10, 32, 51, 52, 32, 78, 50, 68, 70, 65, 83, 53,
-/* 0x2150 */  48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2160 */  32, 48, 49,102, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2170 */  84, 69, 78, 84, 83, 10, 32, 51, 53, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2180 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48,
-/* 0x2190 */  32, 32, 48, 49,102, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x21a0 */  78, 84, 69, 78, 84, 83, 10, 32, 51, 54, 32, 78, 50, 68, 83, 77,
-/* 0x21b0 */  65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32,
-/* 0x21c0 */  48, 32, 32, 48, 49,102,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x21d0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 55, 32, 78, 50, 68, 70,
-/* 0x21e0 */  65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48,
-/* 0x21f0 */  32, 32, 48, 32, 32, 48, 50, 48, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2200 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 56, 32, 78, 50,
-/* 0x2210 */  68, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32,
-/* 0x2220 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 50, 52, 32, 32, 50, 42, 42,
-/* 0x2230 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 57, 32,
-/* 0x2240 */  78, 50, 68, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x2250 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 51, 97, 32, 32, 50, 42, 42,
-/* 0x2260 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 48, 32,
-/* 0x2270 */  78, 50, 69, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x2280 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 51, 97, 32, 32, 50, 42,
-/* 0x2290 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 49,
-/* 0x22a0 */  32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x22b0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 51,100, 32, 32, 50,
-/* 0x22c0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52,
-/* 0x22d0 */  50, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32,
-/* 0x22e0 */  48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 51,102, 32, 32,
-/* 0x22f0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2300 */  52, 51, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32,
-/* 0x2310 */  32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 52, 53, 32,
-/* 0x2320 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2330 */  32, 52, 52, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 32, 32, 32,
-/* 0x2340 */  32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 53, 48,
-/* 0x2350 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2360 */  10, 32, 52, 53, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 32, 32,
-/* 0x2370 */  32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 53,
-/* 0x2380 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2390 */  83, 10, 32, 52, 54, 32, 78, 50, 69, 68, 69, 67, 50, 48, 32, 32,
-/* 0x23a0 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x23b0 */  53,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x23c0 */  84, 83, 10, 32, 52, 55, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32,
-/* 0x23d0 */  32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x23e0 */  50, 54, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x23f0 */  78, 84, 83, 10, 32, 52, 56, 32, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x2400 */  32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2410 */  48, 50, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2420 */  69, 78, 84, 83, 10, 32, 52, 57, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x2430 */  48, 32, 32, 32, 32, 32, 32, 48, 53,102, 32, 32, 48, 32, 32, 48,
-/* 0x2440 */  32, 32, 48, 50, 56, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2450 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 48, 32, 78, 50, 69, 83, 77,
-/* 0x2460 */  65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32,
-/* 0x2470 */  48, 32, 32, 48, 50,101, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2480 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 49, 32, 78, 50, 69, 70,
-/* 0x2490 */  65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32,
-/* 0x24a0 */  32, 48, 32, 32, 48, 50,102, 51, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x24b0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 50, 32, 78, 50, 69,
-/* 0x24c0 */  83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x24d0 */  32, 32, 48, 32, 32, 48, 51, 48, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x24e0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 51, 32, 78, 50,
-/* 0x24f0 */  69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32,
-/* 0x2500 */  48, 32, 32, 48, 32, 32, 48, 51, 48, 52, 32, 32, 50, 42, 42, 48,
-/* 0x2510 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 52, 32, 78,
-/* 0x2520 */  50, 69, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32,
-/* 0x2530 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 48, 55, 32, 32, 50, 42, 42,
-/* 0x2540 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 53, 32,
-/* 0x2550 */  78, 50, 69, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99,
-/* 0x2560 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 49, 48, 32, 32, 50, 42,
-/* 0x2570 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 54,
-/* 0x2580 */  32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2590 */  49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 49, 99, 32, 32,
-/* 0x25a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x25b0 */  53, 55, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32,
-/* 0x25c0 */  32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 51, 53,
-/* 0x25d0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x25e0 */  10, 32, 53, 56, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32, 32, 32,
-/* 0x25f0 */  32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 98,
-/* 0x2600 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2610 */  10, 32, 53, 57, 32, 67, 76, 49, 83, 77, 65, 49, 66, 32, 32, 32,
-/* 0x2620 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52,
-/* 0x2630 */  98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2640 */  83, 10, 32, 54, 48, 32, 67, 76, 49, 70, 65, 83, 49, 66, 32, 32,
-/* 0x2650 */  32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2660 */  52,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2670 */  84, 83, 10, 32, 54, 49, 32, 67, 76, 49, 71, 69, 84, 49, 66, 32,
-/* 0x2680 */  32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2690 */  53, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x26a0 */  84, 83, 10, 32, 54, 50, 32, 67, 76, 49, 69, 78, 84, 69, 82, 32,
-/* 0x26b0 */  32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x26c0 */  51, 53, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x26d0 */  78, 84, 83, 10, 32, 54, 51, 32, 67, 76, 49, 83, 77, 65, 49, 48,
-/* 0x26e0 */  32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x26f0 */  48, 51, 53, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2700 */  69, 78, 84, 83, 10, 32, 54, 52, 32, 67, 76, 49, 82, 76, 79, 65,
-/* 0x2710 */  68, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2720 */  32, 48, 51, 53,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2730 */  84, 69, 78, 84, 83, 10, 32, 54, 53, 32, 67, 76, 49, 87, 73, 68,
-/* 0x2740 */  48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x2750 */  32, 32, 48, 51, 54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2760 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 54, 32, 67, 76, 49, 87, 73,
-/* 0x2770 */  68, 48, 50, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2780 */  48, 32, 32, 48, 51, 54, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2790 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 55, 32, 67, 76, 49, 87,
-/* 0x27a0 */  73, 68, 48, 51, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x27b0 */  32, 48, 32, 32, 48, 51, 54, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x27c0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 56, 32, 67, 76, 49,
-/* 0x27d0 */  87, 73, 68, 48, 52, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x27e0 */  32, 32, 48, 32, 32, 48, 51, 54, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x27f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 57, 32, 67, 76,
-/* 0x2800 */  49, 87, 73, 68, 48, 53, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x2810 */  48, 32, 32, 48, 32, 32, 48, 51, 54,101, 32, 32, 50, 42, 42, 48,
-/* 0x2820 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 48, 32, 67,
-/* 0x2830 */  76, 49, 87, 73, 68, 48, 54, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x2840 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 55, 48, 32, 32, 50, 42, 42,
-/* 0x2850 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 49, 32,
-/* 0x2860 */  67, 76, 49, 87, 73, 68, 48, 55, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x2870 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 55, 50, 32, 32, 50, 42,
-/* 0x2880 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 50,
-/* 0x2890 */  32, 67, 76, 49, 87, 73, 68, 48, 56, 32, 32, 32, 32, 32, 32, 48,
-/* 0x28a0 */  49, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 55, 53, 32, 32,
-/* 0x28b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x28c0 */  55, 51, 32, 67, 76, 49, 87, 73, 68, 48, 57, 32, 32, 32, 32, 32,
-/* 0x28d0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 56,102, 32,
-/* 0x28e0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x28f0 */  32, 55, 52, 32, 67, 76, 49, 87, 73, 68, 49, 48, 32, 32, 32, 32,
-/* 0x2900 */  32, 32, 48, 49, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 57,
-/* 0x2910 */  49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2920 */  83, 10, 32, 55, 53, 32, 67, 76, 49, 83, 84, 65, 82, 84, 32, 32,
-/* 0x2930 */  32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2940 */  97, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2950 */  84, 83, 10, 32, 55, 54, 32, 67, 76, 49, 84, 79, 80, 48, 48, 32,
-/* 0x2960 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2970 */  51, 97, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2980 */  78, 84, 83, 10, 32, 55, 55, 32, 67, 76, 49, 84, 79, 80, 48, 49,
-/* 0x2990 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x29a0 */  48, 51, 97, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x29b0 */  69, 78, 84, 83, 10, 32, 55, 56, 32, 67, 76, 49, 84, 79, 80, 48,
-/* 0x29c0 */  50, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x29d0 */  32, 48, 51, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x29e0 */  84, 69, 78, 84, 83, 10, 32, 55, 57, 32, 67, 76, 49, 84, 79, 80,
-/* 0x29f0 */  48, 51, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x2a00 */  32, 32, 48, 51, 97,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2a10 */  78, 84, 69, 78, 84, 83, 10, 32, 56, 48, 32, 67, 76, 49, 84, 79,
-/* 0x2a20 */  80, 48, 52, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x2a30 */  48, 32, 32, 48, 51, 98, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2a40 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 49, 32, 67, 76, 49, 84,
-/* 0x2a50 */  79, 80, 48, 53, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32,
-/* 0x2a60 */  32, 48, 32, 32, 48, 51, 98, 53, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2a70 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 50, 32, 67, 76, 49,
-/* 0x2a80 */  84, 79, 80, 48, 54, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48,
-/* 0x2a90 */  32, 32, 48, 32, 32, 48, 51, 98, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2aa0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 51, 32, 67, 76,
-/* 0x2ab0 */  49, 84, 79, 80, 48, 55, 32, 32, 32, 32, 32, 32, 48, 49, 55, 32,
-/* 0x2ac0 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 98,102, 32, 32, 50, 42, 42,
-/* 0x2ad0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 52, 32,
-/* 0x2ae0 */  67, 76, 49, 79, 70, 70, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x2af0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51,100, 54, 32, 32, 50, 42,
-/* 0x2b00 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 53,
-/* 0x2b10 */  32, 67, 76, 49, 79, 70, 70, 48, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2b20 */  49, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,100, 56, 32, 32,
-/* 0x2b30 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2b40 */  56, 54, 32, 67, 76, 49, 79, 70, 70, 48, 51, 32, 32, 32, 32, 32,
-/* 0x2b50 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,101, 97, 32,
-/* 0x2b60 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2b70 */  32, 56, 55, 32, 67, 76, 49, 79, 70, 70, 48, 52, 32, 32, 32, 32,
-/* 0x2b80 */  32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,101, 99,
-/* 0x2b90 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2ba0 */  10, 32, 56, 56, 32, 67, 76, 49, 76, 69, 78, 48, 48, 32, 32, 32,
-/* 0x2bb0 */  32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,102,
-/* 0x2bc0 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2bd0 */  83, 10, 32, 56, 57, 32, 67, 76, 49, 76, 69, 78, 48, 49, 32, 32,
-/* 0x2be0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2bf0 */ 102, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2c00 */  84, 83, 10, 32, 57, 48, 32, 67, 76, 49, 76, 69, 78, 48, 50, 32,
-/* 0x2c10 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2c20 */  51,102, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2c30 */  78, 84, 83, 10, 32, 57, 49, 32, 67, 76, 49, 67, 79, 80, 89, 48,
-/* 0x2c40 */  32, 32, 32, 32, 32, 32, 48, 51, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2c50 */  32, 48, 51,102, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2c60 */  84, 69, 78, 84, 83, 10, 32, 57, 50, 32, 67, 76, 49, 69, 78, 68,
-/* 0x2c70 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2c80 */  32, 48, 52, 50, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2c90 */  84, 69, 78, 84, 83, 10, 32, 57, 51, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2ca0 */  69, 67, 48, 48, 32, 32, 32, 32, 48, 50,101, 32, 32, 48, 32, 32,
-/* 0x2cb0 */  48, 32, 32, 48, 52, 50, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2cc0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 52, 32, 76, 90, 77, 65,
-/* 0x2cd0 */  95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 52, 56, 32, 32, 48,
-/* 0x2ce0 */  32, 32, 48, 32, 32, 48, 52, 53, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2cf0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 53, 32, 76, 90,
-/* 0x2d00 */  77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 97, 56, 54,
-/* 0x2d10 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 97, 49, 32, 32, 50, 42,
-/* 0x2d20 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 54,
-/* 0x2d30 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48,
-/* 0x2d40 */  97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,102, 50, 55, 32,
-/* 0x2d50 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2d60 */  32, 57, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32,
-/* 0x2d70 */  32, 32, 48, 49, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2d80 */  97,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2d90 */  84, 83, 10, 32, 57, 56, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32,
-/* 0x2da0 */  32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2db0 */  49, 57, 99, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2dc0 */  69, 78, 84, 83, 10, 32, 57, 57, 32, 67, 84, 67, 76, 69, 86, 69,
-/* 0x2dd0 */  49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2de0 */  32, 48, 49, 57,100, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2df0 */  78, 84, 69, 78, 84, 83, 10, 49, 48, 48, 32, 67, 65, 76, 76, 84,
-/* 0x2e00 */  82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x2e10 */  48, 32, 32, 48, 49, 57,100, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2e20 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 49, 32, 67, 84, 66,
-/* 0x2e30 */  83, 72, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48,
-/* 0x2e40 */  32, 32, 48, 32, 32, 48, 49, 57,100,102, 32, 32, 50, 42, 42, 48,
-/* 0x2e50 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 50, 32, 67,
-/* 0x2e60 */  84, 66, 82, 79, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x2e70 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57,101, 51, 32, 32, 50, 42,
-/* 0x2e80 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 51,
-/* 0x2e90 */  32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2ea0 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,101, 53, 32, 32,
-/* 0x2eb0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x2ec0 */  48, 52, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 32, 32, 32, 32,
-/* 0x2ed0 */  32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,101, 97,
-/* 0x2ee0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2ef0 */  10, 49, 48, 53, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 32, 32,
-/* 0x2f00 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2f10 */ 102, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2f20 */  84, 83, 10, 49, 48, 54, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32,
-/* 0x2f30 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2f40 */  49, 57,102,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2f50 */  69, 78, 84, 83, 10, 49, 48, 55, 32, 67, 65, 76, 76, 84, 82, 69,
-/* 0x2f60 */  57, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2f70 */  32, 48, 49, 57,102,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2f80 */  78, 84, 69, 78, 84, 83, 10, 49, 48, 56, 32, 67, 65, 76, 76, 84,
-/* 0x2f90 */  82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32,
-/* 0x2fa0 */  48, 32, 32, 48, 49, 97, 48, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2fb0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 57, 32, 67, 84, 67,
-/* 0x2fc0 */  76, 69, 86, 69, 50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2fd0 */  32, 32, 48, 32, 32, 48, 49, 97, 48, 53, 32, 32, 50, 42, 42, 48,
-/* 0x2fe0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 48, 32, 67,
-/* 0x2ff0 */  65, 76, 76, 84, 82, 49, 50, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x3000 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 48, 97, 32, 32, 50, 42,
-/* 0x3010 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 49,
-/* 0x3020 */  32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3030 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 48, 99, 32, 32,
-/* 0x3040 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3050 */  49, 50, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 32, 32, 32, 32,
-/* 0x3060 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 48,
-/* 0x3070 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3080 */  10, 49, 49, 51, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 32, 32,
-/* 0x3090 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x30a0 */  49, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x30b0 */  84, 83, 10, 49, 49, 52, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32,
-/* 0x30c0 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x30d0 */  49, 97, 49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x30e0 */  69, 78, 84, 83, 10, 49, 49, 53, 32, 76, 69, 88, 69, 67, 48, 49,
-/* 0x30f0 */  53, 32, 32, 32, 32, 32, 32, 48, 49, 98, 32, 32, 48, 32, 32, 48,
-/* 0x3100 */  32, 32, 48, 49, 97, 49, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3110 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 54, 32, 76, 69, 88, 69,
-/* 0x3120 */  67, 48, 49, 55, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x3130 */  32, 48, 32, 32, 48, 49, 97, 51, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3140 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 55, 32, 76, 69,
-/* 0x3150 */  88, 69, 67, 48, 50, 48, 32, 32, 32, 32, 32, 32, 48, 51, 49, 32,
-/* 0x3160 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 51, 57, 32, 32, 50, 42,
-/* 0x3170 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77,
-/* 0x3180 */  66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48,
-/* 0x3190 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83,
-/* 0x31a0 */  77, 65, 49, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10,
-/* 0x31b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x31c0 */  32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 66, 70,
-/* 0x31d0 */  65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x31e0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 48,
-/* 0x31f0 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3200 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69,
-/* 0x3210 */  67, 50, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48,
-/* 0x3220 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3230 */  78, 50, 66, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 66, 68, 69,
-/* 0x3240 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3250 */  32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 48, 32,
-/* 0x3260 */  78, 50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3270 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x3280 */  54, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48,
-/* 0x3290 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x32a0 */  50, 66, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x32b0 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x32c0 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 48, 32, 78,
-/* 0x32d0 */  50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32e0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49,
-/* 0x32f0 */  49, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48,
-/* 0x3300 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3310 */  68, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x3320 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3330 */ 100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 48, 32, 78, 50,
-/* 0x3340 */  68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3350 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x3360 */  32, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x3370 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x3380 */  68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48,
-/* 0x3390 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x33a0 */  32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 48, 32, 78, 50, 68,
-/* 0x33b0 */  70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x33c0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32,
-/* 0x33d0 */  48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x33e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83,
-/* 0x33f0 */  77, 65, 49, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10,
-/* 0x3400 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3410 */  32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 69, 70,
-/* 0x3420 */  65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3430 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 48,
-/* 0x3440 */  32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3450 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69,
-/* 0x3460 */  67, 50, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48,
-/* 0x3470 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3480 */  78, 50, 69, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 69, 68, 69,
-/* 0x3490 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x34a0 */  32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 48, 32,
-/* 0x34b0 */  78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x34c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x34d0 */  54, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48,
-/* 0x34e0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x34f0 */  50, 69, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67,
-/* 0x3500 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3510 */  32,100, 32, 32, 67, 76, 49, 82, 76, 79, 65, 68, 32, 48, 32, 67,
-/* 0x3520 */  76, 49, 82, 76, 79, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3530 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 48,
-/* 0x3540 */  49, 32, 48, 32, 67, 76, 49, 87, 73, 68, 48, 49, 10, 48, 48, 48,
-/* 0x3550 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x3560 */  49, 87, 73, 68, 48, 54, 32, 48, 32, 67, 76, 49, 87, 73, 68, 48,
-/* 0x3570 */  54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3580 */ 100, 32, 32, 67, 76, 49, 87, 73, 68, 48, 56, 32, 48, 32, 67, 76,
-/* 0x3590 */  49, 87, 73, 68, 48, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x35a0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 49, 48,
-/* 0x35b0 */  32, 48, 32, 67, 76, 49, 87, 73, 68, 49, 48, 10, 48, 48, 48, 48,
-/* 0x35c0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49,
-/* 0x35d0 */  83, 84, 65, 82, 84, 32, 48, 32, 67, 76, 49, 83, 84, 65, 82, 84,
-/* 0x35e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x35f0 */  32, 32, 67, 76, 49, 84, 79, 80, 48, 48, 32, 48, 32, 67, 76, 49,
-/* 0x3600 */  84, 79, 80, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3610 */  32, 32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48, 54, 32,
-/* 0x3620 */  48, 32, 67, 76, 49, 84, 79, 80, 48, 54, 10, 48, 48, 48, 48, 48,
-/* 0x3630 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 84,
-/* 0x3640 */  79, 80, 48, 55, 32, 48, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10,
-/* 0x3650 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3660 */  32, 67, 76, 49, 76, 69, 78, 48, 48, 32, 48, 32, 67, 76, 49, 76,
-/* 0x3670 */  69, 78, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3680 */  32, 32, 32,100, 32, 32, 67, 76, 49, 67, 79, 80, 89, 48, 32, 48,
-/* 0x3690 */  32, 67, 76, 49, 67, 79, 80, 89, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x36a0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84,
-/* 0x36b0 */  82, 48, 48, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48,
-/* 0x36c0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x36d0 */  67, 65, 76, 76, 84, 82, 49, 48, 32, 48, 32, 67, 65, 76, 76, 84,
-/* 0x36e0 */  82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x36f0 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32, 48, 32,
-/* 0x3700 */  67, 65, 76, 76, 84, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3710 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x3720 */  49, 51, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 48, 48,
-/* 0x3730 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x3740 */  69, 88, 69, 67, 48, 50, 48, 32, 48, 32, 76, 69, 88, 69, 67, 48,
-/* 0x3750 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3760 */  32,100, 32, 32, 76, 69, 88, 69, 67, 48, 48, 48, 32, 48, 32, 76,
-/* 0x3770 */  69, 88, 69, 67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3780 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49,
-/* 0x3790 */  48, 32, 48, 32, 76, 69, 88, 69, 67, 48, 49, 48, 10, 48, 48, 48,
-/* 0x37a0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x37b0 */  66, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 49,
-/* 0x37c0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x37d0 */ 100, 32, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50,
-/* 0x37e0 */  66, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x37f0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48,
-/* 0x3800 */  32, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48,
-/* 0x3810 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x3820 */  83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 51, 48,
-/* 0x3830 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3840 */  32, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 66,
-/* 0x3850 */  70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3860 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32,
-/* 0x3870 */  48, 32, 78, 50, 66, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3880 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x3890 */  65, 83, 52, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48, 10,
-/* 0x38a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x38b0 */  32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 66, 83,
-/* 0x38c0 */  77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x38d0 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 48,
-/* 0x38e0 */  32, 78, 50, 66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x38f0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77,
-/* 0x3900 */  65, 54, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 54, 48, 10, 48,
-/* 0x3910 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3920 */  78, 50, 66, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 66, 70, 65,
-/* 0x3930 */  83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3940 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 48, 32,
-/* 0x3950 */  78, 50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3960 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65,
-/* 0x3970 */  50, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 50, 48, 10, 48, 48,
-/* 0x3980 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3990 */  50, 68, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x39a0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x39b0 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 48, 32, 78,
-/* 0x39c0 */  50, 68, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39d0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 51,
-/* 0x39e0 */  48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48,
-/* 0x39f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3a00 */  68, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 52,
-/* 0x3a10 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3a20 */ 100, 32, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50,
-/* 0x3a30 */  68, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3a40 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48,
-/* 0x3a50 */  32, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48,
-/* 0x3a60 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x3a70 */  70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 53, 48,
-/* 0x3a80 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3a90 */  32, 32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 68,
-/* 0x3aa0 */  83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3ab0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32,
-/* 0x3ac0 */  48, 32, 78, 50, 68, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3ad0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x3ae0 */  65, 83, 49, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48, 10,
-/* 0x3af0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3b00 */  32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 69, 83,
-/* 0x3b10 */  77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3b20 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 48,
-/* 0x3b30 */  32, 78, 50, 69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3b40 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77,
-/* 0x3b50 */  65, 51, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 51, 48, 10, 48,
-/* 0x3b60 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3b70 */  78, 50, 69, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 69, 70, 65,
-/* 0x3b80 */  83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3b90 */  32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 48, 32,
-/* 0x3ba0 */  78, 50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3bb0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x3bc0 */  52, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 52, 48, 10, 48, 48,
-/* 0x3bd0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3be0 */  50, 69, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x3bf0 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3c00 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 48, 32, 78,
-/* 0x3c10 */  50, 69, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c20 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 54,
-/* 0x3c30 */  48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48,
-/* 0x3c40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3c50 */  69, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x3c60 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3c70 */ 100, 32, 32, 67, 76, 49, 83, 77, 65, 49, 66, 32, 48, 32, 67, 76,
-/* 0x3c80 */  49, 83, 77, 65, 49, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3c90 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 70, 65, 83, 49, 66,
-/* 0x3ca0 */  32, 48, 32, 67, 76, 49, 70, 65, 83, 49, 66, 10, 48, 48, 48, 48,
-/* 0x3cb0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49,
-/* 0x3cc0 */  71, 69, 84, 49, 66, 32, 48, 32, 67, 76, 49, 71, 69, 84, 49, 66,
-/* 0x3cd0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3ce0 */  32, 32, 67, 76, 49, 69, 78, 84, 69, 82, 32, 48, 32, 67, 76, 49,
-/* 0x3cf0 */  69, 78, 84, 69, 82, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3d00 */  32, 32, 32, 32,100, 32, 32, 67, 76, 49, 83, 77, 65, 49, 48, 32,
-/* 0x3d10 */  48, 32, 67, 76, 49, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3d20 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87,
-/* 0x3d30 */  73, 68, 48, 50, 32, 48, 32, 67, 76, 49, 87, 73, 68, 48, 50, 10,
-/* 0x3d40 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3d50 */  32, 67, 76, 49, 87, 73, 68, 48, 51, 32, 48, 32, 67, 76, 49, 87,
-/* 0x3d60 */  73, 68, 48, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3d70 */  32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 48, 52, 32, 48,
-/* 0x3d80 */  32, 67, 76, 49, 87, 73, 68, 48, 52, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3d90 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 87, 73,
-/* 0x3da0 */  68, 48, 53, 32, 48, 32, 67, 76, 49, 87, 73, 68, 48, 53, 10, 48,
-/* 0x3db0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3dc0 */  67, 76, 49, 87, 73, 68, 48, 55, 32, 48, 32, 67, 76, 49, 87, 73,
-/* 0x3dd0 */  68, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3de0 */  32, 32,100, 32, 32, 67, 76, 49, 87, 73, 68, 48, 57, 32, 48, 32,
-/* 0x3df0 */  67, 76, 49, 87, 73, 68, 48, 57, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80,
-/* 0x3e10 */  48, 49, 32, 48, 32, 67, 76, 49, 84, 79, 80, 48, 49, 10, 48, 48,
-/* 0x3e20 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x3e30 */  76, 49, 84, 79, 80, 48, 50, 32, 48, 32, 67, 76, 49, 84, 79, 80,
-/* 0x3e40 */  48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3e50 */  32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48, 51, 32, 48, 32, 67,
-/* 0x3e60 */  76, 49, 84, 79, 80, 48, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3e70 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 84, 79, 80, 48,
-/* 0x3e80 */  52, 32, 48, 32, 67, 76, 49, 84, 79, 80, 48, 52, 10, 48, 48, 48,
-/* 0x3e90 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76,
-/* 0x3ea0 */  49, 84, 79, 80, 48, 53, 32, 48, 32, 67, 76, 49, 84, 79, 80, 48,
-/* 0x3eb0 */  53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3ec0 */ 100, 32, 32, 67, 76, 49, 79, 70, 70, 48, 49, 32, 48, 32, 67, 76,
-/* 0x3ed0 */  49, 79, 70, 70, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3ee0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 79, 70, 70, 48, 50,
-/* 0x3ef0 */  32, 48, 32, 67, 76, 49, 79, 70, 70, 48, 50, 10, 48, 48, 48, 48,
-/* 0x3f00 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49,
-/* 0x3f10 */  79, 70, 70, 48, 51, 32, 48, 32, 67, 76, 49, 79, 70, 70, 48, 51,
-/* 0x3f20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3f30 */  32, 32, 67, 76, 49, 79, 70, 70, 48, 52, 32, 48, 32, 67, 76, 49,
-/* 0x3f40 */  79, 70, 70, 48, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3f50 */  32, 32, 32, 32,100, 32, 32, 67, 76, 49, 76, 69, 78, 48, 49, 32,
-/* 0x3f60 */  48, 32, 67, 76, 49, 76, 69, 78, 48, 49, 10, 48, 48, 48, 48, 48,
-/* 0x3f70 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 76, 49, 76,
-/* 0x3f80 */  69, 78, 48, 50, 32, 48, 32, 67, 76, 49, 76, 69, 78, 48, 50, 10,
-/* 0x3f90 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3fa0 */  32, 67, 76, 49, 69, 78, 68, 32, 48, 32, 67, 76, 49, 69, 78, 68,
-/* 0x3fb0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3fc0 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 48, 32, 76,
-/* 0x3fd0 */  90, 77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3fe0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3ff0 */  69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x4000 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4010 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48,
-/* 0x4020 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x4030 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x4040 */  65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x4050 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4060 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x4070 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x4080 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x4090 */  84, 67, 76, 69, 86, 69, 49, 32, 48, 32, 67, 84, 67, 76, 69, 86,
-/* 0x40a0 */  69, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x40b0 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 48, 32, 67,
-/* 0x40c0 */  65, 76, 76, 84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40d0 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 48,
-/* 0x40e0 */  49, 32, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10, 48, 48, 48,
-/* 0x40f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x4100 */  66, 82, 79, 82, 48, 49, 32, 48, 32, 67, 84, 66, 82, 79, 82, 48,
-/* 0x4110 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4120 */ 100, 32, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 48, 32, 67, 84,
-/* 0x4130 */  66, 83, 87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4140 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 50,
-/* 0x4150 */  32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 50, 10, 48, 48, 48, 48,
-/* 0x4160 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76,
-/* 0x4170 */  76, 84, 82, 69, 56, 32, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56,
-/* 0x4180 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4190 */  32, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 48, 32, 67, 65, 76,
-/* 0x41a0 */  76, 84, 82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x41b0 */  32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32,
-/* 0x41c0 */  48, 32, 67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48, 48, 48, 48,
-/* 0x41d0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x41e0 */  84, 82, 49, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 50, 10,
-/* 0x41f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4200 */  32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 48, 32, 67, 84, 66, 83,
-/* 0x4210 */  72, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4220 */  32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 48,
-/* 0x4230 */  32, 67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4240 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87,
-/* 0x4250 */  65, 49, 49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 49, 49, 10, 48,
-/* 0x4260 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4270 */  76, 69, 88, 69, 67, 48, 49, 53, 32, 48, 32, 76, 69, 88, 69, 67,
-/* 0x4280 */  48, 49, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4290 */  32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 55, 32, 48, 32,
-/* 0x42a0 */  76, 69, 88, 69, 67, 48, 49, 55, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x42b0 */  48, 32,103, 32, 32, 32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x42c0 */  48, 48, 32, 48, 32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48,
-/* 0x42d0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x42e0 */  68, 42, 32, 48, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95,
-/* 0x42f0 */  97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4300 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x4310 */ 108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48,
-/* 0x4320 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x4330 */  42, 32, 48, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48,
-/* 0x4340 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4350 */  42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,112,114,111,
-/* 0x4360 */ 112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4370 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x4380 */  32,102,105,108,116,101,114, 95,108,101,110,103,116,104, 10, 48,
-/* 0x4390 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x43a0 */  42, 85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,114, 95, 99,
-/* 0x43b0 */ 116,111, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x43c0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69,
-/* 0x43d0 */  67, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x43e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x43f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x4400 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x4410 */  32, 32, 32, 76, 69, 88, 69, 67, 48, 50, 48, 10, 10, 82, 69, 76,
-/* 0x4420 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4430 */  70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10,
-/* 0x4440 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4450 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4460 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4470 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x4480 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4490 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x44a0 */  66, 70, 65, 83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x44b0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x44c0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x44d0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x44e0 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x44f0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4500 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93,
-/* 0x4510 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4520 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4530 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x4540 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4550 */  66, 83, 77, 65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4560 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4570 */  78, 50, 66, 70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4580 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4590 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x45a0 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x45b0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10,
-/* 0x45c0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x45d0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51,
-/* 0x45e0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x45f0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x4600 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x4610 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4620 */  78, 50, 66, 68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4630 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4640 */  32, 91, 78, 50, 66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x4650 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4660 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4670 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x4680 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50,
-/* 0x4690 */  48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x46a0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x46b0 */  68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x46c0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x46d0 */  50, 66, 68, 69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x46e0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x46f0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4700 */  48, 49, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4710 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48,
-/* 0x4720 */  48, 48, 48, 48, 48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4730 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x4740 */  53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4750 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83,
-/* 0x4760 */  77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4770 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4780 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x4790 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x47a0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x47b0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x47c0 */  70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10,
-/* 0x47d0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x47e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x47f0 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4800 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x4810 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x4820 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4830 */  78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4840 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4850 */  32, 91, 78, 50, 66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x4860 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4870 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4880 */  48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x4890 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x48a0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x48b0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65,
-/* 0x48c0 */  83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x48d0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x48e0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32,
-/* 0x48f0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4900 */  32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x4910 */  48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x4920 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10,
-/* 0x4930 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4940 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49,
-/* 0x4950 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4960 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4970 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51,
-/* 0x4980 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4990 */  50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x49a0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x49b0 */  91, 78, 50, 68, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x49c0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49d0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x49e0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x49f0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48,
-/* 0x4a00 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4a10 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83,
-/* 0x4a20 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4a30 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a40 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x4a50 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a60 */  32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4a70 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4a80 */  82, 32, 91, 78, 50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70,
-/* 0x4a90 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4aa0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4ab0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4ac0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65,
-/* 0x4ad0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4ae0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70,
-/* 0x4af0 */  65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4b00 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b10 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x4b20 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x4b30 */  32, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76,
-/* 0x4b40 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4b50 */  70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10,
-/* 0x4b60 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4b70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4b80 */  10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4b90 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x4ba0 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4bb0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4bc0 */  68, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4bd0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4be0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4bf0 */  48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4c00 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x4c10 */  48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x4c20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x4c30 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4c40 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69,
-/* 0x4c50 */  67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4c60 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c70 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x4c80 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c90 */  32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4ca0 */  48, 50, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4cb0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48,
-/* 0x4cc0 */  48, 48, 48, 48, 48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4cd0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x4ce0 */  53, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4cf0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83,
-/* 0x4d00 */  77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4d10 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4d20 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x4d30 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x4d40 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x4d50 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4d60 */  70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10,
-/* 0x4d70 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4d80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4d90 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4da0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x4db0 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x4dc0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4dd0 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4de0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4df0 */  32, 91, 78, 50, 68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x4e00 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4e10 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4e20 */  48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x4e30 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x4e40 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4e50 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65,
-/* 0x4e60 */  83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4e70 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e80 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32,
-/* 0x4e90 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ea0 */  32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x4eb0 */  48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x4ec0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10,
-/* 0x4ed0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4ee0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49,
-/* 0x4ef0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4f00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4f10 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51,
-/* 0x4f20 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4f30 */  50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4f40 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4f50 */  91, 78, 50, 69, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4f60 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f70 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4f80 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x4f90 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48,
-/* 0x4fa0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4fb0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83,
-/* 0x4fc0 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4fd0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4fe0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x4ff0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5000 */  32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5010 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5020 */  82, 32, 91, 78, 50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70,
-/* 0x5030 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5050 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5060 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x5070 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5080 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70,
-/* 0x5090 */  65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x50a0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50b0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x50c0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x50d0 */  32, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76,
-/* 0x50e0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x50f0 */  70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10,
-/* 0x5100 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5110 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5120 */  10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5130 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x5140 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5150 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5160 */  69, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5170 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5180 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5190 */  48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x51a0 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x51b0 */  48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x51c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x51d0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x51e0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69,
-/* 0x51f0 */  67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5200 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5210 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32,
-/* 0x5220 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5230 */  32, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5240 */  48, 49,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5250 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48,
-/* 0x5260 */  48, 48, 48, 48, 48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5270 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x5280 */  54, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5290 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83,
-/* 0x52a0 */  77, 65, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x52b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x52c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x52d0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x52e0 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x52f0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5300 */  70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10,
-/* 0x5310 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5320 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5330 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5340 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x5350 */  69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95,
-/* 0x5360 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5370 */  78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5380 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5390 */  32, 91, 78, 50, 69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70,
-/* 0x53a0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x53b0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x53c0 */  48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x53d0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x53e0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x53f0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65,
-/* 0x5400 */  83, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5410 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5420 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32,
-/* 0x5430 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5440 */  32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x5450 */  48, 49, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x5460 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10,
-/* 0x5470 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5480 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49,
-/* 0x5490 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x54a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x54b0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51,
-/* 0x54c0 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x54d0 */  50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x54e0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x54f0 */  91, 67, 76, 49, 69, 78, 84, 69, 82, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5500 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5510 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5520 */  48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,
-/* 0x5530 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 83, 84, 65, 82, 84,
-/* 0x5540 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5550 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 83, 77, 65,
-/* 0x5560 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5570 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5580 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x5590 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x55a0 */  32, 67, 76, 49, 82, 76, 79, 65, 68, 10, 10, 82, 69, 76, 79, 67,
-/* 0x55b0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x55c0 */  82, 32, 91, 67, 76, 49, 87, 73, 68, 48, 51, 93, 58, 10, 79, 70,
-/* 0x55d0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x55e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x55f0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5600 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73, 68,
-/* 0x5610 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5620 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 87,
-/* 0x5630 */  73, 68, 48, 53, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5640 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5650 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5660 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5670 */  32, 32, 32, 67, 76, 49, 87, 73, 68, 49, 48, 10, 10, 82, 69, 76,
-/* 0x5680 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5690 */  70, 79, 82, 32, 91, 67, 76, 49, 87, 73, 68, 48, 56, 93, 58, 10,
-/* 0x56a0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x56b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x56c0 */  10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95,
-/* 0x56d0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87,
-/* 0x56e0 */  73, 68, 48, 54, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95,
-/* 0x56f0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5700 */  67, 76, 49, 87, 73, 68, 49, 48, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5710 */  54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32,
-/* 0x5720 */  32, 32, 32, 32, 67, 76, 49, 67, 79, 80, 89, 48, 10, 10, 82, 69,
-/* 0x5730 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5740 */  32, 70, 79, 82, 32, 91, 67, 76, 49, 87, 73, 68, 49, 48, 93, 58,
-/* 0x5750 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5760 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5770 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54,
-/* 0x5780 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49,
-/* 0x5790 */  84, 79, 80, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82,
-/* 0x57a0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57b0 */  32, 67, 76, 49, 87, 73, 68, 48, 56, 10, 48, 48, 48, 48, 48, 48,
-/* 0x57c0 */  49, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x57d0 */  32, 32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 10, 82,
-/* 0x57e0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x57f0 */  83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 84, 79, 80, 48, 49, 93,
-/* 0x5800 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5810 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5820 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x5830 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76,
-/* 0x5840 */  49, 84, 79, 80, 48, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5850 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5860 */  67, 76, 49, 84, 79, 80, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5870 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5880 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5890 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x58a0 */  32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10,
-/* 0x58b0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x58c0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 84, 79, 80, 48,
-/* 0x58d0 */  51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x58e0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x58f0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x5900 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5910 */  67, 76, 49, 84, 79, 80, 48, 55, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5920 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5930 */  32, 91, 67, 76, 49, 84, 79, 80, 48, 52, 93, 58, 10, 79, 70, 70,
-/* 0x5940 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5950 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5960 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5970 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48,
-/* 0x5980 */  55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5990 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 84, 79,
-/* 0x59a0 */  80, 48, 53, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x59b0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59c0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x59d0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59e0 */  32, 32, 67, 76, 49, 84, 79, 80, 48, 54, 10, 10, 82, 69, 76, 79,
-/* 0x59f0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5a00 */  79, 82, 32, 91, 67, 76, 49, 84, 79, 80, 48, 54, 93, 58, 10, 79,
-/* 0x5a10 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5a20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5a30 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5a40 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 87, 73,
-/* 0x5a50 */  68, 48, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5a60 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49,
-/* 0x5a70 */  79, 70, 70, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5a80 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a90 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5aa0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5ab0 */  32, 32, 32, 32, 67, 76, 49, 84, 79, 80, 48, 55, 10, 48, 48, 48,
-/* 0x5ac0 */  48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5ad0 */  32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 67, 79, 80, 89, 48,
-/* 0x5ae0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5af0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 79, 70, 70,
-/* 0x5b00 */  48, 52, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5b10 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b20 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x5b30 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b40 */  32, 67, 76, 49, 67, 79, 80, 89, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5b50 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5b60 */  82, 32, 91, 67, 76, 49, 76, 69, 78, 48, 50, 93, 58, 10, 79, 70,
-/* 0x5b70 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5b80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5b90 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5ba0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76, 49, 76, 69, 78,
-/* 0x5bb0 */  48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5bc0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 76, 49, 67,
-/* 0x5bd0 */  79, 80, 89, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5be0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5bf0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 50, 49,
-/* 0x5c00 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x5c10 */  32, 32, 32, 67, 76, 49, 84, 79, 80, 48, 48, 10, 10, 82, 69, 76,
-/* 0x5c20 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5c30 */  70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 93,
-/* 0x5c40 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5c50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5c60 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56,
-/* 0x5c70 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x5c80 */ 109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10,
-/* 0x5c90 */  48, 48, 48, 48, 48, 48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x5ca0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,
-/* 0x5cb0 */ 117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82,
-/* 0x5cc0 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5cd0 */  32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x5ce0 */  48, 48, 50, 97, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x5cf0 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,114,111,112,
-/* 0x5d00 */ 101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5d10 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5d20 */  67, 65, 76, 76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5d30 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d40 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5d50 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x5d60 */  32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,
-/* 0x5d70 */ 110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5d80 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84,
-/* 0x5d90 */  67, 76, 69, 86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5da0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5db0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5dc0 */  48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5dd0 */  32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10,
-/* 0x5de0 */  48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5df0 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84,
-/* 0x5e00 */  82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5e10 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76,
-/* 0x5e20 */  76, 84, 82, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5e30 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e40 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5e50 */ 100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5e60 */  32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69,
-/* 0x5e70 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5e80 */  32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58,
-/* 0x5e90 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5eb0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x5ec0 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,
-/* 0x5ed0 */ 116,101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79,
-/* 0x5ee0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5ef0 */  79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79,
-/* 0x5f00 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5f10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5f20 */  48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5f30 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84,
-/* 0x5f40 */  82, 49, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5f50 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67,
-/* 0x5f60 */  76, 69, 86, 69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5f70 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5f80 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5f90 */  50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fa0 */  32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48,
-/* 0x5fb0 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5fc0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x5fd0 */  49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5fe0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76,
-/* 0x5ff0 */  84, 82, 49, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6000 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6010 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x6020 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6030 */  32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10
+/* 0x1a60 */  90, 88,205,128,131,196, 24,141, 88,  3,118,  0,  0,  0,125,  0,
+/* 0x1a70 */   0,  0, 85,  0,  0,  0,172,  4,  0,  0,  0,  0,  0,  0, 52,  0,
+/* 0x1a80 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 57,  0,
+/* 0x1a90 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 70,  0,
+/* 0x1aa0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0, 73,  0,
+/* 0x1ab0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0, 75,  0,
+/* 0x1ac0 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0, 81,  0,
+/* 0x1ad0 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0, 92,  0,
+/* 0x1ae0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 97,  0,
+/* 0x1af0 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,106,  0,
+/* 0x1b00 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,119,  0,
+/* 0x1b10 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,132,  0,
+/* 0x1b20 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,147,  0,
+/* 0x1b30 */   0,  0, 62,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,209,  0,
+/* 0x1b40 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,222,  0,
+/* 0x1b50 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0,237,  0,
+/* 0x1b60 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0,239,  0,
+/* 0x1b70 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0,242,  0,
+/* 0x1b80 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,251,  0,
+/* 0x1b90 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0,  7,  1,
+/* 0x1ba0 */   0,  0, 25,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0, 32,  1,
+/* 0x1bb0 */   0,  0, 22,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0, 54,  1,
+/* 0x1bc0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 54,  1,
+/* 0x1bd0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,198,  0,  0,  0, 57,  1,
+/* 0x1be0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0, 59,  1,
+/* 0x1bf0 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0,216,  0,  0,  0, 65,  1,
+/* 0x1c00 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 76,  1,
+/* 0x1c10 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 81,  1,
+/* 0x1c20 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0, 90,  1,
+/* 0x1c30 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0,103,  1,
+/* 0x1c40 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  5,  1,  0,  0,116,  1,
+/* 0x1c50 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0,131,  1,
+/* 0x1c60 */   0,  0, 82,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0,213,  1,
+/* 0x1c70 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0,226,  1,
+/* 0x1c80 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0,241,  1,
+/* 0x1c90 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0,243,  1,
+/* 0x1ca0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,246,  1,
+/* 0x1cb0 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 68,  1,  0,  0,255,  1,
+/* 0x1cc0 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0, 11,  2,
+/* 0x1cd0 */   0,  0, 25,  0,  0,  0,  0,  0,  0,  0, 86,  1,  0,  0, 36,  2,
+/* 0x1ce0 */   0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0, 58,  2,
+/* 0x1cf0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 58,  2,
+/* 0x1d00 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 61,  2,
+/* 0x1d10 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,122,  1,  0,  0, 63,  2,
+/* 0x1d20 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0,131,  1,  0,  0, 69,  2,
+/* 0x1d30 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 80,  2,
+/* 0x1d40 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0, 85,  2,
+/* 0x1d50 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 94,  2,
+/* 0x1d60 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0,107,  2,
+/* 0x1d70 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0,120,  2,
+/* 0x1d80 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0,135,  2,
+/* 0x1d90 */   0,  0, 95,  0,  0,  0,  0,  0,  0,  0,194,  1,  0,  0,230,  2,
+/* 0x1da0 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0,243,  2,
+/* 0x1db0 */   0,  0, 15,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0,  2,  3,
+/* 0x1dc0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0,  4,  3,
+/* 0x1dd0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0,  7,  3,
+/* 0x1de0 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0, 16,  3,
+/* 0x1df0 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0, 28,  3,
+/* 0x1e00 */   0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 53,  3,
+/* 0x1e10 */   0,  0, 22,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0, 75,  3,
+/* 0x1e20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 75,  3,
+/* 0x1e30 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0, 77,  3,
+/* 0x1e40 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 37,  2,  0,  0, 83,  3,
+/* 0x1e50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  2,  0,  0, 83,  3,
+/* 0x1e60 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 55,  2,  0,  0, 89,  3,
+/* 0x1e70 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 64,  2,  0,  0, 94,  3,
+/* 0x1e80 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 73,  2,  0,  0,102,  3,
+/* 0x1e90 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 82,  2,  0,  0,104,  3,
+/* 0x1ea0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 91,  2,  0,  0,106,  3,
+/* 0x1eb0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,100,  2,  0,  0,108,  3,
+/* 0x1ec0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,109,  2,  0,  0,110,  3,
+/* 0x1ed0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,118,  2,  0,  0,112,  3,
+/* 0x1ee0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,127,  2,  0,  0,114,  3,
+/* 0x1ef0 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,136,  2,  0,  0,117,  3,
+/* 0x1f00 */   0,  0, 26,  0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0,143,  3,
+/* 0x1f10 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,154,  2,  0,  0,145,  3,
+/* 0x1f20 */   0,  0, 17,  0,  0,  0,  0,  0,  0,  0,163,  2,  0,  0,162,  3,
+/* 0x1f30 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,172,  2,  0,  0,167,  3,
+/* 0x1f40 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,181,  2,  0,  0,170,  3,
+/* 0x1f50 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,190,  2,  0,  0,172,  3,
+/* 0x1f60 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,199,  2,  0,  0,174,  3,
+/* 0x1f70 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,208,  2,  0,  0,176,  3,
+/* 0x1f80 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,217,  2,  0,  0,181,  3,
+/* 0x1f90 */   0,  0,  3,  0,  0,  0,  0,  0,  0,  0,226,  2,  0,  0,184,  3,
+/* 0x1fa0 */   0,  0,  7,  0,  0,  0,  0,  0,  0,  0,235,  2,  0,  0,191,  3,
+/* 0x1fb0 */   0,  0, 23,  0,  0,  0,  0,  0,  0,  0,244,  2,  0,  0,214,  3,
+/* 0x1fc0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,253,  2,  0,  0,216,  3,
+/* 0x1fd0 */   0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  6,  3,  0,  0,234,  3,
+/* 0x1fe0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 15,  3,  0,  0,236,  3,
+/* 0x1ff0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 24,  3,  0,  0,240,  3,
+/* 0x2000 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 33,  3,  0,  0,241,  3,
+/* 0x2010 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 42,  3,  0,  0,243,  3,
+/* 0x2020 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 51,  3,  0,  0,248,  3,
+/* 0x2030 */   0,  0, 51,  0,  0,  0,  0,  0,  0,  0, 60,  3,  0,  0, 43,  4,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  3,  0,  0, 43,  4,
+/* 0x2050 */   0,  0, 46,  0,  0,  0,  0,  0,  0,  0, 78,  3,  0,  0, 89,  4,
+/* 0x2060 */   0,  0, 72,  0,  0,  0,  0,  0,  0,  0, 89,  3,  0,  0,161,  4,
+/* 0x2070 */   0,  0,134, 10,  0,  0,  0,  0,  0,  0,100,  3,  0,  0, 39, 15,
+/* 0x2080 */   0,  0,134, 10,  0,  0,  0,  0,  0,  0,111,  3,  0,  0,173, 25,
+/* 0x2090 */   0,  0, 26,  0,  0,  0,  0,  0,  0,  0,122,  3,  0,  0,199, 25,
+/* 0x20a0 */   0,  0, 14,  0,  0,  0,  0,  0,  0,  0,131,  3,  0,  0,213, 25,
+/* 0x20b0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,140,  3,  0,  0,218, 25,
+/* 0x20c0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,149,  3,  0,  0,223, 25,
+/* 0x20d0 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,158,  3,  0,  0,227, 25,
+/* 0x20e0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,167,  3,  0,  0,229, 25,
+/* 0x20f0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,176,  3,  0,  0,234, 25,
+/* 0x2100 */   0,  0, 14,  0,  0,  0,  0,  0,  0,  0,185,  3,  0,  0,248, 25,
+/* 0x2110 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,194,  3,  0,  0,253, 25,
+/* 0x2120 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,203,  3,  0,  0,255, 25,
+/* 0x2130 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,212,  3,  0,  0,  1, 26,
+/* 0x2140 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,221,  3,  0,  0,  5, 26,
+/* 0x2150 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0,230,  3,  0,  0, 10, 26,
+/* 0x2160 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,239,  3,  0,  0, 12, 26,
+/* 0x2170 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0,248,  3,  0,  0, 16, 26,
+/* 0x2180 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  4,  0,  0, 18, 26,
+/* 0x2190 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 10,  4,  0,  0, 23, 26,
+/* 0x21a0 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 19,  4,  0,  0, 28, 26,
+/* 0x21b0 */   0,  0, 27,  0,  0,  0,  0,  0,  0,  0, 28,  4,  0,  0, 55, 26,
+/* 0x21c0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 37,  4,  0,  0, 57, 26,
+/* 0x21d0 */   0,  0, 49,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,
+/* 0x21e0 */   0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x21f0 */   0,  0, 45,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 72,  0,
+/* 0x2200 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 11,  0,
+/* 0x2210 */   0,  0,  0,  0,  0,  0,144,  0,  0,  0, 16,  0,  0,  0,  0,  0,
+/* 0x2220 */   0,  0,171,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,180,  0,
+/* 0x2230 */   0,  0, 20,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 21,  0,
+/* 0x2240 */   0,  0,  0,  0,  0,  0,207,  0,  0,  0, 23,  0,  0,  0,  0,  0,
+/* 0x2250 */   0,  0,216,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,243,  0,
+/* 0x2260 */   0,  0, 27,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0, 30,  0,
+/* 0x2270 */   0,  0,  0,  0,  0,  0, 59,  1,  0,  0, 35,  0,  0,  0,  0,  0,
+/* 0x2280 */   0,  0, 86,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0, 95,  1,
+/* 0x2290 */   0,  0, 39,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 40,  0,
+/* 0x22a0 */   0,  0,  0,  0,  0,  0,122,  1,  0,  0, 42,  0,  0,  0,  0,  0,
+/* 0x22b0 */   0,  0,131,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,158,  1,
+/* 0x22c0 */   0,  0, 46,  0,  0,  0,  0,  0,  0,  0,185,  1,  0,  0, 49,  0,
+/* 0x22d0 */   0,  0,  0,  0,  0,  0,230,  1,  0,  0, 54,  0,  0,  0,  0,  0,
+/* 0x22e0 */   0,  0,  1,  2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0, 10,  2,
+/* 0x22f0 */   0,  0, 58,  0,  0,  0,  0,  0,  0,  0, 64,  2,  0,  0, 64,  0,
+/* 0x2300 */   0,  0,  0,  0,  0,  0, 73,  2,  0,  0, 65,  0,  0,  0,  0,  0,
+/* 0x2310 */   0,  0,118,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,136,  2,
+/* 0x2320 */   0,  0, 72,  0,  0,  0,  0,  0,  0,  0,154,  2,  0,  0, 74,  0,
+/* 0x2330 */   0,  0,  0,  0,  0,  0,163,  2,  0,  0, 75,  0,  0,  0,  0,  0,
+/* 0x2340 */   0,  0,172,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,226,  2,
+/* 0x2350 */   0,  0, 82,  0,  0,  0,  0,  0,  0,  0,235,  2,  0,  0, 83,  0,
+/* 0x2360 */   0,  0,  0,  0,  0,  0, 24,  3,  0,  0, 88,  0,  0,  0,  0,  0,
+/* 0x2370 */   0,  0, 51,  3,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,122,  3,
+/* 0x2380 */   0,  0, 98,  0,  0,  0,  0,  0,  0,  0,185,  3,  0,  0,105,  0,
+/* 0x2390 */   0,  0,  0,  0,  0,  0,212,  3,  0,  0,108,  0,  0,  0,  0,  0,
+/* 0x23a0 */   0,  0, 10,  4,  0,  0,114,  0,  0,  0,  0,  0,  0,  0, 37,  4,
+/* 0x23b0 */   0,  0,117,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x23d0 */   0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 54,  0,
+/* 0x23e0 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  7,  0,
+/* 0x23f0 */   0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x2400 */   0,  0, 90,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,108,  0,
+/* 0x2410 */   0,  0, 12,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0, 13,  0,
+/* 0x2420 */   0,  0,  0,  0,  0,  0,126,  0,  0,  0, 14,  0,  0,  0,  0,  0,
+/* 0x2430 */   0,  0,135,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,153,  0,
+/* 0x2440 */   0,  0, 17,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0, 18,  0,
+/* 0x2450 */   0,  0,  0,  0,  0,  0,198,  0,  0,  0, 22,  0,  0,  0,  0,  0,
+/* 0x2460 */   0,  0,225,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,234,  0,
+/* 0x2470 */   0,  0, 26,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 28,  0,
+/* 0x2480 */   0,  0,  0,  0,  0,  0,  5,  1,  0,  0, 29,  0,  0,  0,  0,  0,
+/* 0x2490 */   0,  0, 23,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0, 32,  1,
+/* 0x24a0 */   0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0, 33,  0,
+/* 0x24b0 */   0,  0,  0,  0,  0,  0, 50,  1,  0,  0, 34,  0,  0,  0,  0,  0,
+/* 0x24c0 */   0,  0, 68,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 77,  1,
+/* 0x24d0 */   0,  0, 37,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 41,  0,
+/* 0x24e0 */   0,  0,  0,  0,  0,  0,140,  1,  0,  0, 44,  0,  0,  0,  0,  0,
+/* 0x24f0 */   0,  0,149,  1,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,167,  1,
+/* 0x2500 */   0,  0, 47,  0,  0,  0,  0,  0,  0,  0,176,  1,  0,  0, 48,  0,
+/* 0x2510 */   0,  0,  0,  0,  0,  0,194,  1,  0,  0, 50,  0,  0,  0,  0,  0,
+/* 0x2520 */   0,  0,203,  1,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,212,  1,
+/* 0x2530 */   0,  0, 52,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0, 53,  0,
+/* 0x2540 */   0,  0,  0,  0,  0,  0,239,  1,  0,  0, 55,  0,  0,  0,  0,  0,
+/* 0x2550 */   0,  0,248,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0, 19,  2,
+/* 0x2560 */   0,  0, 59,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0, 60,  0,
+/* 0x2570 */   0,  0,  0,  0,  0,  0, 37,  2,  0,  0, 61,  0,  0,  0,  0,  0,
+/* 0x2580 */   0,  0, 46,  2,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0, 55,  2,
+/* 0x2590 */   0,  0, 63,  0,  0,  0,  0,  0,  0,  0, 82,  2,  0,  0, 66,  0,
+/* 0x25a0 */   0,  0,  0,  0,  0,  0, 91,  2,  0,  0, 67,  0,  0,  0,  0,  0,
+/* 0x25b0 */   0,  0,100,  2,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,109,  2,
+/* 0x25c0 */   0,  0, 69,  0,  0,  0,  0,  0,  0,  0,127,  2,  0,  0, 71,  0,
+/* 0x25d0 */   0,  0,  0,  0,  0,  0,145,  2,  0,  0, 73,  0,  0,  0,  0,  0,
+/* 0x25e0 */   0,  0,181,  2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,190,  2,
+/* 0x25f0 */   0,  0, 78,  0,  0,  0,  0,  0,  0,  0,199,  2,  0,  0, 79,  0,
+/* 0x2600 */   0,  0,  0,  0,  0,  0,208,  2,  0,  0, 80,  0,  0,  0,  0,  0,
+/* 0x2610 */   0,  0,217,  2,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,244,  2,
+/* 0x2620 */   0,  0, 84,  0,  0,  0,  0,  0,  0,  0,253,  2,  0,  0, 85,  0,
+/* 0x2630 */   0,  0,  0,  0,  0,  0,  6,  3,  0,  0, 86,  0,  0,  0,  0,  0,
+/* 0x2640 */   0,  0, 15,  3,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0, 33,  3,
+/* 0x2650 */   0,  0, 89,  0,  0,  0,  0,  0,  0,  0, 42,  3,  0,  0, 90,  0,
+/* 0x2660 */   0,  0,  0,  0,  0,  0, 60,  3,  0,  0, 92,  0,  0,  0,  0,  0,
+/* 0x2670 */   0,  0, 67,  3,  0,  0, 93,  0,  0,  0,  0,  0,  0,  0, 78,  3,
+/* 0x2680 */   0,  0, 94,  0,  0,  0,  0,  0,  0,  0, 89,  3,  0,  0, 95,  0,
+/* 0x2690 */   0,  0,  0,  0,  0,  0,100,  3,  0,  0, 96,  0,  0,  0,  0,  0,
+/* 0x26a0 */   0,  0,111,  3,  0,  0, 97,  0,  0,  0,  0,  0,  0,  0,131,  3,
+/* 0x26b0 */   0,  0, 99,  0,  0,  0,  0,  0,  0,  0,140,  3,  0,  0,100,  0,
+/* 0x26c0 */   0,  0,  0,  0,  0,  0,149,  3,  0,  0,101,  0,  0,  0,  0,  0,
+/* 0x26d0 */   0,  0,158,  3,  0,  0,102,  0,  0,  0,  0,  0,  0,  0,167,  3,
+/* 0x26e0 */   0,  0,103,  0,  0,  0,  0,  0,  0,  0,176,  3,  0,  0,104,  0,
+/* 0x26f0 */   0,  0,  0,  0,  0,  0,194,  3,  0,  0,106,  0,  0,  0,  0,  0,
+/* 0x2700 */   0,  0,203,  3,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,221,  3,
+/* 0x2710 */   0,  0,109,  0,  0,  0,  0,  0,  0,  0,230,  3,  0,  0,110,  0,
+/* 0x2720 */   0,  0,  0,  0,  0,  0,239,  3,  0,  0,111,  0,  0,  0,  0,  0,
+/* 0x2730 */   0,  0,248,  3,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,  1,  4,
+/* 0x2740 */   0,  0,113,  0,  0,  0,  0,  0,  0,  0, 19,  4,  0,  0,115,  0,
+/* 0x2750 */   0,  0,  0,  0,  0,  0, 28,  4,  0,  0,116,  0,  0,  0,  0,  0,
+/* 0x2760 */   0,  0, 46,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  4,
+/* 0x2770 */   0,  0,119,  0,  0,  0,173,222,173,222, 71,  4,  0,  0,119,  0,
+/* 0x2780 */   0,  0,173,222,173,222, 82,  4,  0,  0,119,  0,  0,  0,173,222,
+/* 0x2790 */ 173,222, 93,  4,  0,  0,119,  0,  0,  0,173,222,173,222,109,  4,
+/* 0x27a0 */   0,  0,119,  0,  0,  0,173,222,173,222,123,  4,  0,  0,119,  0,
+/* 0x27b0 */   0,  0,173,222,173,222,  0,  0,  0,  0,  1,  0,  0,  0,134,  4,
+/* 0x27c0 */   0,  0, 37,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+/* 0x27d0 */   0,  0,  1,  0,  0,  0,145,  4,  0,  0, 45,  0,  0,  0,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0,145,  4,
+/* 0x27f0 */   0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,
+/* 0x2800 */   0,  0,  1,  0,  0,  0,145,  4,  0,  0, 18,  0,  0,  0,  0,  0,
+/* 0x2810 */   0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  3,  0,  0,  0,145,  4,
+/* 0x2820 */   0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x2830 */   0,  0, 12,  0,  0,  0,145,  4,  0,  0, 72,  0,  0,  0,  0,  0,
+/* 0x2840 */   0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  3,  0,  0,  0,145,  4,
+/* 0x2850 */   0,  0, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,
+/* 0x2860 */   0,  0, 14,  0,  0,  0,145,  4,  0,  0, 72,  0,  0,  0,  0,  0,
+/* 0x2870 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 17,  0,  0,  0,145,  4,
+/* 0x2880 */   0,  0,180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2890 */   0,  0, 47,  0,  0,  0,145,  4,  0,  0,144,  0,  0,  0,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 12,  0,  0,  0,145,  4,
+/* 0x28b0 */   0,  0, 99,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,
+/* 0x28c0 */   0,  0,  3,  0,  0,  0,145,  4,  0,  0, 99,  0,  0,  0,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 14,  0,  0,  0,145,  4,
+/* 0x28e0 */   0,  0, 99,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,
+/* 0x28f0 */   0,  0,  8,  0,  0,  0,134,  4,  0,  0, 45,  0,  0,  0,  0,  0,
+/* 0x2900 */   0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 10,  0,  0,  0,145,  4,
+/* 0x2910 */   0,  0,171,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,
+/* 0x2920 */   0,  0, 21,  0,  0,  0,134,  4,  0,  0, 45,  0,  0,  0,  0,  0,
+/* 0x2930 */   0,  0,  0,  0,  0,  0, 19,  0,  0,  0, 18,  0,  0,  0,134,  4,
+/* 0x2940 */   0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,
+/* 0x2950 */   0,  0,  1,  0,  0,  0,145,  4,  0,  0,216,  0,  0,  0,  0,  0,
+/* 0x2960 */   0,  0,  0,  0,  0,  0, 22,  0,  0,  0,  1,  0,  0,  0,145,  4,
+/* 0x2970 */   0,  0,216,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,
+/* 0x2980 */   0,  0,  1,  0,  0,  0,145,  4,  0,  0,189,  0,  0,  0,  0,  0,
+/* 0x2990 */   0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  3,  0,  0,  0,145,  4,
+/* 0x29a0 */   0,  0,207,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  0,
+/* 0x29b0 */   0,  0, 12,  0,  0,  0,145,  4,  0,  0, 14,  1,  0,  0,  0,  0,
+/* 0x29c0 */   0,  0,  0,  0,  0,  0, 29,  0,  0,  0,  5,  0,  0,  0,145,  4,
+/* 0x29d0 */   0,  0, 14,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,
+/* 0x29e0 */   0,  0, 14,  0,  0,  0,145,  4,  0,  0, 14,  1,  0,  0,  0,  0,
+/* 0x29f0 */   0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 15,  0,  0,  0,145,  4,
+/* 0x2a00 */   0,  0,243,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,
+/* 0x2a10 */   0,  0, 33,  0,  0,  0,145,  4,  0,  0, 95,  1,  0,  0,  0,  0,
+/* 0x2a20 */   0,  0,  0,  0,  0,  0, 30,  0,  0,  0, 67,  0,  0,  0,145,  4,
+/* 0x2a30 */   0,  0, 59,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,
+/* 0x2a40 */   0,  0, 12,  0,  0,  0,145,  4,  0,  0, 14,  1,  0,  0,  0,  0,
+/* 0x2a50 */   0,  0,  0,  0,  0,  0, 32,  0,  0,  0,  3,  0,  0,  0,145,  4,
+/* 0x2a60 */   0,  0, 14,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,
+/* 0x2a70 */   0,  0, 14,  0,  0,  0,145,  4,  0,  0, 14,  1,  0,  0,  0,  0,
+/* 0x2a80 */   0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  8,  0,  0,  0,134,  4,
+/* 0x2a90 */   0,  0,216,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  0,
+/* 0x2aa0 */   0,  0, 10,  0,  0,  0,145,  4,  0,  0, 86,  1,  0,  0,  0,  0,
+/* 0x2ab0 */   0,  0,  0,  0,  0,  0, 37,  0,  0,  0, 21,  0,  0,  0,134,  4,
+/* 0x2ac0 */   0,  0,216,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,
+/* 0x2ad0 */   0,  0, 18,  0,  0,  0,134,  4,  0,  0,216,  0,  0,  0,  0,  0,
+/* 0x2ae0 */   0,  0,  0,  0,  0,  0, 40,  0,  0,  0,  1,  0,  0,  0,145,  4,
+/* 0x2af0 */   0,  0,131,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,
+/* 0x2b00 */   0,  0,  1,  0,  0,  0,145,  4,  0,  0,131,  1,  0,  0,  0,  0,
+/* 0x2b10 */   0,  0,  0,  0,  0,  0, 44,  0,  0,  0,  1,  0,  0,  0,145,  4,
+/* 0x2b20 */   0,  0,104,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,
+/* 0x2b30 */   0,  0,  3,  0,  0,  0,145,  4,  0,  0,122,  1,  0,  0,  0,  0,
+/* 0x2b40 */   0,  0,  0,  0,  0,  0, 47,  0,  0,  0, 12,  0,  0,  0,145,  4,
+/* 0x2b50 */   0,  0,185,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  0,
+/* 0x2b60 */   0,  0,  5,  0,  0,  0,145,  4,  0,  0,185,  1,  0,  0,  0,  0,
+/* 0x2b70 */   0,  0,  0,  0,  0,  0, 48,  0,  0,  0, 14,  0,  0,  0,145,  4,
+/* 0x2b80 */   0,  0,185,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,
+/* 0x2b90 */   0,  0, 15,  0,  0,  0,145,  4,  0,  0,158,  1,  0,  0,  0,  0,
+/* 0x2ba0 */   0,  0,  0,  0,  0,  0, 49,  0,  0,  0, 30,  0,  0,  0,145,  4,
+/* 0x2bb0 */   0,  0,230,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,
+/* 0x2bc0 */   0,  0, 48,  0,  0,  0,145,  4,  0,  0, 10,  2,  0,  0,  0,  0,
+/* 0x2bd0 */   0,  0,  0,  0,  0,  0, 50,  0,  0,  0, 12,  0,  0,  0,145,  4,
+/* 0x2be0 */   0,  0,185,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,
+/* 0x2bf0 */   0,  0,  3,  0,  0,  0,145,  4,  0,  0,185,  1,  0,  0,  0,  0,
+/* 0x2c00 */   0,  0,  0,  0,  0,  0, 51,  0,  0,  0, 14,  0,  0,  0,145,  4,
+/* 0x2c10 */   0,  0,185,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,  0,
+/* 0x2c20 */   0,  0,  8,  0,  0,  0,134,  4,  0,  0,131,  1,  0,  0,  0,  0,
+/* 0x2c30 */   0,  0,  0,  0,  0,  0, 56,  0,  0,  0, 10,  0,  0,  0,145,  4,
+/* 0x2c40 */   0,  0,  1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,
+/* 0x2c50 */   0,  0, 21,  0,  0,  0,134,  4,  0,  0,131,  1,  0,  0,  0,  0,
+/* 0x2c60 */   0,  0,  0,  0,  0,  0, 57,  0,  0,  0, 18,  0,  0,  0,134,  4,
+/* 0x2c70 */   0,  0,131,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62,  0,
+/* 0x2c80 */   0,  0,  2,  0,  0,  0,134,  4,  0,  0,163,  2,  0,  0,  0,  0,
+/* 0x2c90 */   0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  3,  0,  0,  0,145,  4,
+/* 0x2ca0 */   0,  0, 64,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  0,
+/* 0x2cb0 */   0,  0,  1,  0,  0,  0,145,  4,  0,  0,154,  2,  0,  0,  0,  0,
+/* 0x2cc0 */   0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  1,  0,  0,  0,145,  4,
+/* 0x2cd0 */   0,  0,154,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,
+/* 0x2ce0 */   0,  0,  6,  0,  0,  0,145,  4,  0,  0,118,  2,  0,  0,  0,  0,
+/* 0x2cf0 */   0,  0,  0,  0,  0,  0, 72,  0,  0,  0, 16,  0,  0,  0,145,  4,
+/* 0x2d00 */   0,  0,154,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,
+/* 0x2d10 */   0,  0, 22,  0,  0,  0,134,  4,  0,  0, 51,  3,  0,  0,  0,  0,
+/* 0x2d20 */   0,  0,  0,  0,  0,  0, 74,  0,  0,  0,  6,  0,  0,  0,145,  4,
+/* 0x2d30 */   0,  0,235,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 74,  0,
+/* 0x2d40 */   0,  0, 10,  0,  0,  0,145,  4,  0,  0,136,  2,  0,  0,  0,  0,
+/* 0x2d50 */   0,  0,  0,  0,  0,  0, 74,  0,  0,  0, 16,  0,  0,  0,145,  4,
+/* 0x2d60 */   0,  0,235,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 77,  0,
+/* 0x2d70 */   0,  0,  1,  0,  0,  0,145,  4,  0,  0,235,  2,  0,  0,  0,  0,
+/* 0x2d80 */   0,  0,  0,  0,  0,  0, 78,  0,  0,  0,  1,  0,  0,  0,145,  4,
+/* 0x2d90 */   0,  0,235,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 79,  0,
+/* 0x2da0 */   0,  0,  1,  0,  0,  0,145,  4,  0,  0,235,  2,  0,  0,  0,  0,
+/* 0x2db0 */   0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  1,  0,  0,  0,145,  4,
+/* 0x2dc0 */   0,  0,235,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,
+/* 0x2dd0 */   0,  0,  1,  0,  0,  0,145,  4,  0,  0,226,  2,  0,  0,  0,  0,
+/* 0x2de0 */   0,  0,  0,  0,  0,  0, 82,  0,  0,  0,  3,  0,  0,  0,134,  4,
+/* 0x2df0 */   0,  0, 73,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,  0,
+/* 0x2e00 */   0,  0,  1,  0,  0,  0,145,  4,  0,  0,235,  2,  0,  0,  0,  0,
+/* 0x2e10 */   0,  0,  0,  0,  0,  0, 85,  0,  0,  0, 15,  0,  0,  0,145,  4,
+/* 0x2e20 */   0,  0, 51,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 87,  0,
+/* 0x2e30 */   0,  0,  3,  0,  0,  0,145,  4,  0,  0, 51,  3,  0,  0,  0,  0,
+/* 0x2e40 */   0,  0,  0,  0,  0,  0, 90,  0,  0,  0,  1,  0,  0,  0,145,  4,
+/* 0x2e50 */   0,  0, 24,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91,  0,
+/* 0x2e60 */   0,  0, 33,  0,  0,  0,134,  4,  0,  0,172,  2,  0,  0,  0,  0,
+/* 0x2e70 */   0,  0,  0,  0,  0,  0, 93,  0,  0,  0,  5,  0,  0,  0,155,  4,
+/* 0x2e80 */   0,  0, 53,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93,  0,
+/* 0x2e90 */   0,  0, 20,  0,  0,  0,155,  4,  0,  0, 71,  4,  0,  0,  0,  0,
+/* 0x2ea0 */   0,  0,  0,  0,  0,  0, 93,  0,  0,  0, 30,  0,  0,  0,155,  4,
+/* 0x2eb0 */   0,  0, 82,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 93,  0,
+/* 0x2ec0 */   0,  0, 42,  0,  0,  0,155,  4,  0,  0, 93,  4,  0,  0,  0,  0,
+/* 0x2ed0 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0,  1,  0,  0,  0,155,  4,
+/* 0x2ee0 */   0,  0,109,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 99,  0,
+/* 0x2ef0 */   0,  0,  2,  0,  0,  0,164,  4,  0,  0,123,  4,  0,  0,  0,  0,
+/* 0x2f00 */   0,  0,  0,  0,  0,  0, 99,  0,  0,  0,  4,  0,  0,  0,145,  4,
+/* 0x2f10 */   0,  0,122,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,104,  0,
+/* 0x2f20 */   0,  0, 13,  0,  0,  0,145,  4,  0,  0,122,  3,  0,  0,  0,  0,
+/* 0x2f30 */   0,  0,  0,  0,  0,  0,105,  0,  0,  0,  1,  0,  0,  0,155,  4,
+/* 0x2f40 */   0,  0,109,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,108,  0,
+/* 0x2f50 */   0,  0,  3,  0,  0,  0,145,  4,  0,  0, 10,  4,  0,  0,  0,  0,
+/* 0x2f60 */   0,  0,  0,  0,  0,  0,109,  0,  0,  0,  2,  0,  0,  0,164,  4,
+/* 0x2f70 */   0,  0,123,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,109,  0,
+/* 0x2f80 */   0,  0,  4,  0,  0,  0,145,  4,  0,  0,212,  3,  0,  0,  0,  0,
+/* 0x2f90 */   0,  0,  0,  0,  0,  0,114,  0,  0,  0,  4,  0,  0,  0,145,  4,
+/* 0x2fa0 */   0,  0,185,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76, 69,
+/* 0x2fb0 */  88, 69, 67, 48, 48, 48,  0, 76, 69, 88, 69, 67, 48, 49, 48,  0,
+/* 0x2fc0 */  78, 50, 66, 83, 77, 65, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49,
+/* 0x2fd0 */  48,  0, 78, 50, 66, 70, 65, 83, 49, 49,  0, 78, 50, 66, 68, 69,
+/* 0x2fe0 */  67, 49, 48,  0, 78, 50, 66, 83, 77, 65, 50, 48,  0, 78, 50, 66,
+/* 0x2ff0 */  70, 65, 83, 50, 48,  0, 78, 50, 66, 68, 69, 67, 50, 48,  0, 78,
+/* 0x3000 */  50, 66, 83, 77, 65, 51, 48,  0, 78, 50, 66, 70, 65, 83, 51, 48,
+/* 0x3010 */   0, 78, 50, 66, 68, 69, 67, 51, 48,  0, 78, 50, 66, 83, 77, 65,
+/* 0x3020 */  52, 48,  0, 78, 50, 66, 70, 65, 83, 52, 48,  0, 78, 50, 66, 83,
+/* 0x3030 */  77, 65, 53, 48,  0, 78, 50, 66, 70, 65, 83, 53, 48,  0, 78, 50,
+/* 0x3040 */  66, 68, 69, 67, 53, 48,  0, 78, 50, 66, 83, 77, 65, 54, 48,  0,
+/* 0x3050 */  78, 50, 66, 70, 65, 83, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54,
+/* 0x3060 */  49,  0, 78, 50, 66, 68, 69, 67, 54, 48,  0, 78, 50, 68, 83, 77,
+/* 0x3070 */  65, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 48,  0, 78, 50, 68,
+/* 0x3080 */  70, 65, 83, 49, 49,  0, 78, 50, 68, 68, 69, 67, 49, 48,  0, 78,
+/* 0x3090 */  50, 68, 83, 77, 65, 50, 48,  0, 78, 50, 68, 70, 65, 83, 50, 48,
+/* 0x30a0 */   0, 78, 50, 68, 68, 69, 67, 50, 48,  0, 78, 50, 68, 83, 77, 65,
+/* 0x30b0 */  51, 48,  0, 78, 50, 68, 70, 65, 83, 51, 48,  0, 78, 50, 68, 68,
+/* 0x30c0 */  69, 67, 51, 48,  0, 78, 50, 68, 83, 77, 65, 52, 48,  0, 78, 50,
+/* 0x30d0 */  68, 70, 65, 83, 52, 48,  0, 78, 50, 68, 83, 77, 65, 53, 48,  0,
+/* 0x30e0 */  78, 50, 68, 70, 65, 83, 53, 48,  0, 78, 50, 68, 68, 69, 67, 53,
+/* 0x30f0 */  48,  0, 78, 50, 68, 83, 77, 65, 54, 48,  0, 78, 50, 68, 70, 65,
+/* 0x3100 */  83, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 49,  0, 78, 50, 68,
+/* 0x3110 */  68, 69, 67, 54, 48,  0, 78, 50, 69, 83, 77, 65, 49, 48,  0, 78,
+/* 0x3120 */  50, 69, 70, 65, 83, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 49,
+/* 0x3130 */   0, 78, 50, 69, 68, 69, 67, 49, 48,  0, 78, 50, 69, 83, 77, 65,
+/* 0x3140 */  50, 48,  0, 78, 50, 69, 70, 65, 83, 50, 48,  0, 78, 50, 69, 68,
+/* 0x3150 */  69, 67, 50, 48,  0, 78, 50, 69, 83, 77, 65, 51, 48,  0, 78, 50,
+/* 0x3160 */  69, 70, 65, 83, 51, 48,  0, 78, 50, 69, 68, 69, 67, 51, 48,  0,
+/* 0x3170 */  78, 50, 69, 83, 77, 65, 52, 48,  0, 78, 50, 69, 70, 65, 83, 52,
+/* 0x3180 */  48,  0, 78, 50, 69, 83, 77, 65, 53, 48,  0, 78, 50, 69, 70, 65,
+/* 0x3190 */  83, 53, 48,  0, 78, 50, 69, 68, 69, 67, 53, 48,  0, 78, 50, 69,
+/* 0x31a0 */  83, 77, 65, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 48,  0, 78,
+/* 0x31b0 */  50, 69, 70, 65, 83, 54, 49,  0, 78, 50, 69, 68, 69, 67, 54, 48,
+/* 0x31c0 */   0, 67, 76, 49, 83, 77, 65, 49, 66,  0, 67, 76, 49, 70, 65, 83,
+/* 0x31d0 */  49, 66,  0, 67, 76, 49, 71, 69, 84, 49, 66,  0, 67, 76, 49, 69,
+/* 0x31e0 */  78, 84, 69, 82,  0, 67, 76, 49, 83, 77, 65, 49, 48,  0, 67, 76,
+/* 0x31f0 */  49, 82, 76, 79, 65, 68,  0, 67, 76, 49, 87, 73, 68, 48, 49,  0,
+/* 0x3200 */  67, 76, 49, 87, 73, 68, 48, 50,  0, 67, 76, 49, 87, 73, 68, 48,
+/* 0x3210 */  51,  0, 67, 76, 49, 87, 73, 68, 48, 52,  0, 67, 76, 49, 87, 73,
+/* 0x3220 */  68, 48, 53,  0, 67, 76, 49, 87, 73, 68, 48, 54,  0, 67, 76, 49,
+/* 0x3230 */  87, 73, 68, 48, 55,  0, 67, 76, 49, 87, 73, 68, 48, 56,  0, 67,
+/* 0x3240 */  76, 49, 87, 73, 68, 48, 57,  0, 67, 76, 49, 87, 73, 68, 49, 48,
+/* 0x3250 */   0, 67, 76, 49, 83, 84, 65, 82, 84,  0, 67, 76, 49, 84, 79, 80,
+/* 0x3260 */  48, 48,  0, 67, 76, 49, 84, 79, 80, 48, 49,  0, 67, 76, 49, 84,
+/* 0x3270 */  79, 80, 48, 50,  0, 67, 76, 49, 84, 79, 80, 48, 51,  0, 67, 76,
+/* 0x3280 */  49, 84, 79, 80, 48, 52,  0, 67, 76, 49, 84, 79, 80, 48, 53,  0,
+/* 0x3290 */  67, 76, 49, 84, 79, 80, 48, 54,  0, 67, 76, 49, 84, 79, 80, 48,
+/* 0x32a0 */  55,  0, 67, 76, 49, 79, 70, 70, 48, 49,  0, 67, 76, 49, 79, 70,
+/* 0x32b0 */  70, 48, 50,  0, 67, 76, 49, 79, 70, 70, 48, 51,  0, 67, 76, 49,
+/* 0x32c0 */  79, 70, 70, 48, 52,  0, 67, 76, 49, 76, 69, 78, 48, 48,  0, 67,
+/* 0x32d0 */  76, 49, 76, 69, 78, 48, 49,  0, 67, 76, 49, 76, 69, 78, 48, 50,
+/* 0x32e0 */   0, 67, 76, 49, 67, 79, 80, 89, 48,  0, 67, 76, 49, 69, 78, 68,
+/* 0x32f0 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48,  0, 76, 90, 77, 65,
+/* 0x3300 */  95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49,
+/* 0x3310 */  48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77,
+/* 0x3320 */  65, 95, 68, 69, 67, 51, 48,  0, 67, 65, 76, 76, 84, 82, 48, 48,
+/* 0x3330 */   0, 67, 84, 67, 76, 69, 86, 69, 49,  0, 67, 65, 76, 76, 84, 82,
+/* 0x3340 */  48, 49,  0, 67, 84, 66, 83, 72, 82, 48, 49,  0, 67, 84, 66, 82,
+/* 0x3350 */  79, 82, 48, 49,  0, 67, 84, 66, 83, 87, 65, 48, 49,  0, 67, 65,
+/* 0x3360 */  76, 76, 84, 82, 48, 50,  0, 67, 65, 76, 76, 84, 82, 49, 48,  0,
+/* 0x3370 */  67, 65, 76, 76, 84, 82, 69, 56,  0, 67, 65, 76, 76, 84, 82, 69,
+/* 0x3380 */  57,  0, 67, 65, 76, 76, 84, 82, 49, 49,  0, 67, 84, 67, 76, 69,
+/* 0x3390 */  86, 69, 50,  0, 67, 65, 76, 76, 84, 82, 49, 50,  0, 67, 84, 66,
+/* 0x33a0 */  83, 72, 82, 49, 49,  0, 67, 84, 66, 82, 79, 82, 49, 49,  0, 67,
+/* 0x33b0 */  84, 66, 83, 87, 65, 49, 49,  0, 67, 65, 76, 76, 84, 82, 49, 51,
+/* 0x33c0 */   0, 76, 69, 88, 69, 67, 48, 49, 53,  0, 76, 69, 88, 69, 67, 48,
+/* 0x33d0 */  49, 55,  0, 76, 69, 88, 69, 67, 48, 50, 48,  0, 95,115,116, 97,
+/* 0x33e0 */ 114,116,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,
+/* 0x33f0 */ 106,117,115,116,  0,108,122,109, 97, 95,117, 95,108,101,110,  0,
+/* 0x3400 */ 108,122,109, 97, 95, 99, 95,108,101,110,  0,108,122,109, 97, 95,
+/* 0x3410 */ 112,114,111,112,101,114,116,105,101,115,  0,102,105,108,116,101,
+/* 0x3420 */ 114, 95,108,101,110,103,116,104,  0,102,105,108,116,101,114, 95,
+/* 0x3430 */  99,116,111,  0, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0, 82,
+/* 0x3440 */  95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51, 56, 54, 95, 51,
+/* 0x3450 */  50,  0, 82, 95, 51, 56, 54, 95, 56,  0,106, 26,  0,  0, 85, 80,
+/* 0x3460 */  88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* i386-linux.kernel.vmlinuz.h
-   created from i386-linux.kernel.vmlinuz.bin, 24683 (0x606b) bytes
+   created from i386-linux.kernel.vmlinuz.bin, 13686 (0x3576) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_KERNEL_VMLINUZ_SIZE    24683
-#define STUB_I386_LINUX_KERNEL_VMLINUZ_ADLER32 0xd8c33a16
-#define STUB_I386_LINUX_KERNEL_VMLINUZ_CRC32   0x5bf3c085
+#define STUB_I386_LINUX_KERNEL_VMLINUZ_SIZE    13686
+#define STUB_I386_LINUX_KERNEL_VMLINUZ_ADLER32 0xc5eef400
+#define STUB_I386_LINUX_KERNEL_VMLINUZ_CRC32   0xc91c0a24
 
-unsigned char stub_i386_linux_kernel_vmlinuz[24683] = {
+unsigned char stub_i386_linux_kernel_vmlinuz[13686] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 216, 31,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -468,1115 +468,428 @@ unsigned char stub_i386_linux_kernel_vmlinuz[24683] = {
 /* 0x1ad0 */   8,134,196,193,192, 16,134,196, 41,248,171,235,  4, 94, 95, 49,
 /* 0x1ae0 */ 219,203, 85, 80, 88, 33,161,216,208,213,  0,  0,  0,  0,  0,  0,
 /* 0x1af0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x1b00 */   0, 45,102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,
-/* 0x1b10 */ 102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,105,111,
-/* 0x1b20 */ 110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32,
-/* 0x1b30 */  32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32,
-/* 0x1b40 */  86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32,
-/* 0x1b50 */  32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,
-/* 0x1b60 */ 103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 76, 73,
-/* 0x1b70 */  78, 85, 90, 86, 71, 65, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48,
-/* 0x1b80 */  32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1b90 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 76, 73, 78,
-/* 0x1ba0 */  85, 90, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 57, 50, 32, 32,
-/* 0x1bb0 */  48, 32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1bc0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 76, 73,
-/* 0x1bd0 */  78, 85, 90, 48, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32,
-/* 0x1be0 */  48, 32, 32, 48, 32, 32, 48, 99, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1bf0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 76, 73,
-/* 0x1c00 */  78, 85, 90, 48, 48, 53, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32,
-/* 0x1c10 */  48, 32, 32, 48, 32, 32, 48, 99, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1c20 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 76, 73,
-/* 0x1c30 */  78, 85, 90, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32,
-/* 0x1c40 */  48, 32, 32, 48, 32, 32, 48,100, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1c50 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 76, 73,
-/* 0x1c60 */  78, 85, 90, 49, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32,
-/* 0x1c70 */  48, 32, 32, 48, 32, 32, 48,100, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1c80 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 76, 73,
-/* 0x1c90 */  78, 85, 90, 49, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50,100, 32,
-/* 0x1ca0 */  32, 48, 32, 32, 48, 32, 32, 48,100, 99, 32, 32, 50, 42, 42, 48,
-/* 0x1cb0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 76,
-/* 0x1cc0 */  73, 78, 85, 90, 49, 50, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32,
-/* 0x1cd0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 48, 57, 32, 32, 50, 42, 42,
-/* 0x1ce0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32,
-/* 0x1cf0 */  76, 73, 78, 85, 90, 49, 51, 48, 32, 32, 32, 32, 32, 32, 48, 53,
-/* 0x1d00 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 49, 53, 32, 32, 50, 42,
-/* 0x1d10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57,
-/* 0x1d20 */  32, 76, 73, 78, 85, 90, 49, 52, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1d30 */  50, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 49, 97, 32, 32,
-/* 0x1d40 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1d50 */  49, 48, 32, 76, 73, 78, 85, 90, 49, 52, 49, 32, 32, 32, 32, 32,
-/* 0x1d60 */  32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 99, 32,
-/* 0x1d70 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1d80 */  32, 49, 49, 32, 76, 73, 78, 85, 90, 49, 52, 53, 32, 32, 32, 32,
-/* 0x1d90 */  32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51,102,
-/* 0x1da0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1db0 */  10, 32, 49, 50, 32, 76, 73, 78, 85, 90, 49, 53, 48, 32, 32, 32,
-/* 0x1dc0 */  32, 32, 32, 48, 50, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x1dd0 */  52, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1de0 */  84, 83, 10, 32, 49, 51, 32, 76, 90, 67, 65, 76, 76, 84, 49, 32,
-/* 0x1df0 */  32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1e00 */  49, 54, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1e10 */  78, 84, 83, 10, 32, 49, 52, 32, 76, 90, 67, 75, 76, 76, 84, 49,
-/* 0x1e20 */  32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1e30 */  48, 49, 54, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1e40 */  69, 78, 84, 83, 10, 32, 49, 53, 32, 76, 66, 90, 73, 77, 65, 71,
-/* 0x1e50 */  69, 32, 32, 32, 32, 32, 32, 48, 49,101, 32, 32, 48, 32, 32, 48,
-/* 0x1e60 */  32, 32, 48, 49, 55, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1e70 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 54, 32, 76, 90, 73, 77, 65,
-/* 0x1e80 */  71, 69, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32,
-/* 0x1e90 */  48, 32, 32, 48, 49, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1ea0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 55, 32, 76, 90, 67, 85,
-/* 0x1eb0 */  84, 80, 79, 73, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1ec0 */  48, 32, 32, 48, 49, 57,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1ed0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 56, 32, 78, 50, 66, 83,
-/* 0x1ee0 */  77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32,
-/* 0x1ef0 */  32, 48, 32, 32, 48, 49, 57,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1f00 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 57, 32, 78, 50, 66,
-/* 0x1f10 */  70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x1f20 */  32, 32, 48, 32, 32, 48, 49, 97, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1f30 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 48, 32, 78, 50,
-/* 0x1f40 */  66, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32,
-/* 0x1f50 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 52, 32, 32, 50, 42, 42, 48,
-/* 0x1f60 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 49, 32, 78,
-/* 0x1f70 */  50, 66, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32,
-/* 0x1f80 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97, 32, 32, 50, 42, 42,
-/* 0x1f90 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 50, 32,
-/* 0x1fa0 */  78, 50, 66, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53,
-/* 0x1fb0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 53, 32, 32, 50, 42,
-/* 0x1fc0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 51,
-/* 0x1fd0 */  32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1fe0 */  57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 97, 32, 32, 50,
-/* 0x1ff0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x2000 */  52, 32, 78, 50, 66, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2010 */  48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 99, 51, 32, 32,
-/* 0x2020 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2030 */  50, 53, 32, 78, 50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32,
-/* 0x2040 */  32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100, 48, 32,
-/* 0x2050 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2060 */  32, 50, 54, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 32, 32, 32,
-/* 0x2070 */  32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100,100,
-/* 0x2080 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2090 */  10, 32, 50, 55, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x20a0 */  32, 32, 32, 48, 51,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x20b0 */ 101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x20c0 */  84, 83, 10, 32, 50, 56, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32,
-/* 0x20d0 */  32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x20e0 */  50, 50, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x20f0 */  78, 84, 83, 10, 32, 50, 57, 32, 78, 50, 66, 70, 65, 83, 52, 48,
-/* 0x2100 */  32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2110 */  48, 50, 51, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2120 */  69, 78, 84, 83, 10, 32, 51, 48, 32, 78, 50, 66, 83, 77, 65, 53,
-/* 0x2130 */  48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2140 */  32, 48, 50, 52, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2150 */  84, 69, 78, 84, 83, 10, 32, 51, 49, 32, 78, 50, 66, 70, 65, 83,
-/* 0x2160 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48,
-/* 0x2170 */  32, 32, 48, 50, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2180 */  78, 84, 69, 78, 84, 83, 10, 32, 51, 50, 32, 78, 50, 66, 68, 69,
-/* 0x2190 */  67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32,
-/* 0x21a0 */  48, 32, 32, 48, 50, 52, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x21b0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 51, 32, 78, 50, 66, 83,
-/* 0x21c0 */  77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32,
-/* 0x21d0 */  32, 48, 32, 32, 48, 50, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x21e0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 52, 32, 78, 50, 66,
-/* 0x21f0 */  70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32,
-/* 0x2200 */  48, 32, 32, 48, 32, 32, 48, 50, 54, 48, 32, 32, 50, 42, 42, 48,
-/* 0x2210 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 53, 32, 78,
-/* 0x2220 */  50, 66, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54,
-/* 0x2230 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 57, 32, 32, 50, 42,
-/* 0x2240 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 54,
-/* 0x2250 */  32, 78, 50, 66, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2260 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56,102, 32, 32, 50, 42,
-/* 0x2270 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 55,
-/* 0x2280 */  32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2290 */  51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56,102, 32, 32, 50,
-/* 0x22a0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51,
-/* 0x22b0 */  56, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x22c0 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 57, 50, 32, 32,
-/* 0x22d0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x22e0 */  51, 57, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32,
-/* 0x22f0 */  32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 57, 52, 32,
-/* 0x2300 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2310 */  32, 52, 48, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x2320 */  32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 57, 97,
-/* 0x2330 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2340 */  10, 32, 52, 49, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32, 32, 32,
-/* 0x2350 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 97,
-/* 0x2360 */  53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2370 */  83, 10, 32, 52, 50, 32, 78, 50, 68, 70, 65, 83, 50, 48, 32, 32,
-/* 0x2380 */  32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x2390 */  97, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x23a0 */  84, 83, 10, 32, 52, 51, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32,
-/* 0x23b0 */  32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x23c0 */  50, 98, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x23d0 */  78, 84, 83, 10, 32, 52, 52, 32, 78, 50, 68, 83, 77, 65, 51, 48,
-/* 0x23e0 */  32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x23f0 */  48, 50, 99, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2400 */  69, 78, 84, 83, 10, 32, 52, 53, 32, 78, 50, 68, 70, 65, 83, 51,
-/* 0x2410 */  48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2420 */  32, 48, 50, 99,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2430 */  84, 69, 78, 84, 83, 10, 32, 52, 54, 32, 78, 50, 68, 68, 69, 67,
-/* 0x2440 */  51, 48, 32, 32, 32, 32, 32, 32, 48, 53, 50, 32, 32, 48, 32, 32,
-/* 0x2450 */  48, 32, 32, 48, 50,100, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2460 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 55, 32, 78, 50, 68, 83,
-/* 0x2470 */  77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32,
-/* 0x2480 */  32, 48, 32, 32, 48, 51, 50,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2490 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 56, 32, 78, 50, 68,
-/* 0x24a0 */  70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48,
-/* 0x24b0 */  32, 32, 48, 32, 32, 48, 51, 51, 98, 32, 32, 50, 42, 42, 48, 32,
-/* 0x24c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 57, 32, 78, 50,
-/* 0x24d0 */  68, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x24e0 */  48, 32, 32, 48, 32, 32, 48, 51, 52, 97, 32, 32, 50, 42, 42, 48,
-/* 0x24f0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 48, 32, 78,
-/* 0x2500 */  50, 68, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32,
-/* 0x2510 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 99, 32, 32, 50, 42, 42,
-/* 0x2520 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 49, 32,
-/* 0x2530 */  78, 50, 68, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57,
-/* 0x2540 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52,102, 32, 32, 50, 42,
-/* 0x2550 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 50,
-/* 0x2560 */  32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2570 */  99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 53, 56, 32, 32, 50,
-/* 0x2580 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x2590 */  51, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32,
-/* 0x25a0 */  48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 54, 52, 32,
-/* 0x25b0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x25c0 */  32, 53, 52, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 32, 32, 32,
-/* 0x25d0 */  32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 55,
-/* 0x25e0 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x25f0 */  83, 10, 32, 53, 53, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 32,
-/* 0x2600 */  32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 57,
-/* 0x2610 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2620 */  83, 10, 32, 53, 54, 32, 78, 50, 69, 83, 77, 65, 49, 48, 32, 32,
-/* 0x2630 */  32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2640 */  57, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2650 */  84, 83, 10, 32, 53, 55, 32, 78, 50, 69, 70, 65, 83, 49, 48, 32,
-/* 0x2660 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2670 */  51, 57, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2680 */  78, 84, 83, 10, 32, 53, 56, 32, 78, 50, 69, 70, 65, 83, 49, 49,
-/* 0x2690 */  32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x26a0 */  48, 51, 57, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x26b0 */  69, 78, 84, 83, 10, 32, 53, 57, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x26c0 */  48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32,
-/* 0x26d0 */  32, 48, 51, 57,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x26e0 */  84, 69, 78, 84, 83, 10, 32, 54, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x26f0 */  50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x2700 */  32, 32, 48, 51, 97, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2710 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 49, 32, 78, 50, 69, 70, 65,
-/* 0x2720 */  83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32,
-/* 0x2730 */  48, 32, 32, 48, 51, 97,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2740 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 50, 32, 78, 50, 69, 68,
-/* 0x2750 */  69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32,
-/* 0x2760 */  32, 48, 32, 32, 48, 51, 98, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2770 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 51, 32, 78, 50, 69,
-/* 0x2780 */  83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48,
-/* 0x2790 */  32, 32, 48, 32, 32, 48, 51, 99, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x27a0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 52, 32, 78, 50,
-/* 0x27b0 */  69, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32,
-/* 0x27c0 */  48, 32, 32, 48, 32, 32, 48, 51,100, 49, 32, 32, 50, 42, 42, 48,
-/* 0x27d0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 53, 32, 78,
-/* 0x27e0 */  50, 69, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 53,102,
-/* 0x27f0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51,101, 48, 32, 32, 50, 42,
-/* 0x2800 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 54,
-/* 0x2810 */  32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2820 */ 100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 51,102, 32, 32, 50,
-/* 0x2830 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54,
-/* 0x2840 */  55, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2850 */  48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 52, 99, 32, 32,
-/* 0x2860 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2870 */  54, 56, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2880 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 53, 98, 32,
-/* 0x2890 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x28a0 */  32, 54, 57, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 32, 32, 32,
-/* 0x28b0 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 53,100,
-/* 0x28c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x28d0 */  10, 32, 55, 48, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 32, 32,
-/* 0x28e0 */  32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 54,
-/* 0x28f0 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2900 */  83, 10, 32, 55, 49, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 32,
-/* 0x2910 */  32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,
-/* 0x2920 */  54, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2930 */  84, 83, 10, 32, 55, 50, 32, 78, 50, 69, 70, 65, 83, 54, 48, 32,
-/* 0x2940 */  32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2950 */  48, 52, 55, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2960 */  69, 78, 84, 83, 10, 32, 55, 51, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x2970 */  49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48,
-/* 0x2980 */  32, 32, 48, 52, 56,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2990 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 52, 32, 78, 50, 69, 68, 69,
-/* 0x29a0 */  67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x29b0 */  32, 32, 48, 52, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x29c0 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 53, 32, 76, 90, 77, 65, 95,
-/* 0x29d0 */  68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 50,101, 32, 32, 48, 32,
-/* 0x29e0 */  32, 48, 32, 32, 48, 52, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x29f0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 54, 32, 76, 90, 77,
-/* 0x2a00 */  65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 52, 56, 32, 32,
-/* 0x2a10 */  48, 32, 32, 48, 32, 32, 48, 52,100, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2a20 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 55, 32, 76,
-/* 0x2a30 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 97, 56,
-/* 0x2a40 */  54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 49, 97, 32, 32, 50,
-/* 0x2a50 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55,
-/* 0x2a60 */  56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32,
-/* 0x2a70 */  48, 97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,102, 97, 48,
-/* 0x2a80 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2a90 */  10, 32, 55, 57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32,
-/* 0x2aa0 */  32, 32, 32, 48, 49, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2ab0 */  97, 50, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2ac0 */  78, 84, 83, 10, 32, 56, 48, 32, 76, 90, 67, 75, 76, 76, 84, 57,
-/* 0x2ad0 */  32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2ae0 */  48, 49, 97, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2af0 */  84, 69, 78, 84, 83, 10, 32, 56, 49, 32, 99,116,111,107, 51, 50,
-/* 0x2b00 */  46, 48, 48, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48,
-/* 0x2b10 */  32, 32, 48, 49, 97, 52, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2b20 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 50, 32, 99,116,111,107,
-/* 0x2b30 */  51, 50, 46, 49, 48, 32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32,
-/* 0x2b40 */  32, 48, 32, 32, 48, 49, 97, 52, 97, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2b50 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 51, 32, 99,116,
-/* 0x2b60 */ 111,107, 51, 50, 46, 50, 48, 32, 32, 32, 32, 32, 48, 50, 48, 32,
-/* 0x2b70 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 53, 56, 32, 32, 50, 42,
-/* 0x2b80 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 52,
-/* 0x2b90 */  32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 32, 32, 32, 32, 48,
-/* 0x2ba0 */  97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 55, 56, 32, 32,
-/* 0x2bb0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2bc0 */  56, 53, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 32, 32, 32,
-/* 0x2bd0 */  32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56, 50,
-/* 0x2be0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2bf0 */  10, 32, 56, 54, 32, 76, 90, 67, 65, 76, 76, 84, 57, 32, 32, 32,
-/* 0x2c00 */  32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x2c10 */  56, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2c20 */  84, 83, 10, 32, 56, 55, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32,
-/* 0x2c30 */  32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2c40 */  49, 97, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2c50 */  69, 78, 84, 83, 10, 32, 56, 56, 32, 67, 84, 67, 76, 69, 86, 69,
-/* 0x2c60 */  49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2c70 */  32, 48, 49, 97, 57, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2c80 */  78, 84, 69, 78, 84, 83, 10, 32, 56, 57, 32, 67, 65, 76, 76, 84,
-/* 0x2c90 */  82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x2ca0 */  48, 32, 32, 48, 49, 97, 57, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2cb0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 48, 32, 67, 84, 66,
-/* 0x2cc0 */  83, 72, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48,
-/* 0x2cd0 */  32, 32, 48, 32, 32, 48, 49, 97, 97, 48, 32, 32, 50, 42, 42, 48,
-/* 0x2ce0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 49, 32, 67,
-/* 0x2cf0 */  84, 66, 82, 79, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x2d00 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97, 52, 32, 32, 50, 42,
-/* 0x2d10 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 50,
-/* 0x2d20 */  32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2d30 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97, 54, 32, 32,
-/* 0x2d40 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2d50 */  57, 51, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 32, 32, 32, 32,
-/* 0x2d60 */  32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97, 98,
-/* 0x2d70 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2d80 */  10, 32, 57, 52, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 32, 32,
-/* 0x2d90 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x2da0 */  98, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2db0 */  84, 83, 10, 32, 57, 53, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32,
-/* 0x2dc0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2dd0 */  49, 97, 98,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2de0 */  69, 78, 84, 83, 10, 32, 57, 54, 32, 67, 65, 76, 76, 84, 82, 69,
-/* 0x2df0 */  57, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2e00 */  32, 48, 49, 97, 99, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2e10 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 55, 32, 67, 65, 76, 76, 84,
-/* 0x2e20 */  82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32,
-/* 0x2e30 */  48, 32, 32, 48, 49, 97, 99, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2e40 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 56, 32, 67, 84, 67,
-/* 0x2e50 */  76, 69, 86, 69, 50, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2e60 */  32, 32, 48, 32, 32, 48, 49, 97, 99, 54, 32, 32, 50, 42, 42, 48,
-/* 0x2e70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 57, 32, 67,
-/* 0x2e80 */  65, 76, 76, 84, 82, 49, 50, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x2e90 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 99, 98, 32, 32, 50, 42,
-/* 0x2ea0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 48,
-/* 0x2eb0 */  32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2ec0 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 99,100, 32, 32,
-/* 0x2ed0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x2ee0 */  48, 49, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 32, 32, 32, 32,
-/* 0x2ef0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,100, 49,
-/* 0x2f00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2f10 */  10, 49, 48, 50, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 32, 32,
-/* 0x2f20 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x2f30 */ 100, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2f40 */  84, 83, 10, 49, 48, 51, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32,
-/* 0x2f50 */  32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2f60 */  49, 97,100, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2f70 */  69, 78, 84, 83, 10, 49, 48, 52, 32, 76, 73, 78, 85, 90, 57, 57,
-/* 0x2f80 */  48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2f90 */  32, 48, 49, 97,100,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2fa0 */  78, 84, 69, 78, 84, 83, 10, 49, 48, 53, 32, 85, 80, 88, 49, 72,
-/* 0x2fb0 */  69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 50, 48, 32, 32, 48, 32,
-/* 0x2fc0 */  32, 48, 32, 32, 48, 49, 97,101, 50, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2fd0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76,
-/* 0x2fe0 */  32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ff0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 49,
-/* 0x3000 */  48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10, 48, 48, 48,
-/* 0x3010 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3020 */  66, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 49,
-/* 0x3030 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3040 */ 100, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50,
-/* 0x3050 */  66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3060 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48,
-/* 0x3070 */  32, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x3080 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x3090 */  68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x30a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x30b0 */  32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 66,
-/* 0x30c0 */  68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x30d0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32,
-/* 0x30e0 */  48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x30f0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68,
-/* 0x3100 */  69, 67, 54, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10,
-/* 0x3110 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3120 */  32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 68, 83,
-/* 0x3130 */  77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3140 */  32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 48,
-/* 0x3150 */  32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3160 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69,
-/* 0x3170 */  67, 49, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 48,
-/* 0x3180 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3190 */  78, 50, 68, 68, 69, 67, 50, 48, 32, 48, 32, 78, 50, 68, 68, 69,
-/* 0x31a0 */  67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x31b0 */  32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 48, 32,
-/* 0x31c0 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x31d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x31e0 */  53, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 48, 48,
-/* 0x31f0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3200 */  50, 68, 70, 65, 83, 54, 49, 32, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x3210 */  54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3220 */  32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32, 48, 32, 78,
-/* 0x3230 */  50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3240 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 49,
-/* 0x3250 */  48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 48, 48, 48,
-/* 0x3260 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3270 */  69, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 49,
-/* 0x3280 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3290 */ 100, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50,
-/* 0x32a0 */  69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x32b0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 50, 48,
-/* 0x32c0 */  32, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x32d0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x32e0 */  68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x32f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3300 */  32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 69,
-/* 0x3310 */  68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3320 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32,
-/* 0x3330 */  48, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48,
-/* 0x3340 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68,
-/* 0x3350 */  69, 67, 54, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10,
-/* 0x3360 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3370 */  32, 99,116,111,107, 51, 50, 46, 48, 48, 32, 48, 32, 99,116,111,
-/* 0x3380 */ 107, 51, 50, 46, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3390 */ 108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 49,
-/* 0x33a0 */  48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 48, 48,
-/* 0x33b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,
-/* 0x33c0 */ 116,111,107, 51, 50, 46, 50, 48, 32, 48, 32, 99,116,111,107, 51,
-/* 0x33d0 */  50, 46, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x33e0 */  32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32,
-/* 0x33f0 */  48, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48,
-/* 0x3400 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76,
-/* 0x3410 */  76, 84, 82, 48, 48, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 48,
-/* 0x3420 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3430 */  32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 32, 48, 32, 67, 65, 76,
-/* 0x3440 */  76, 84, 82, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3450 */  32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 32,
-/* 0x3460 */  48, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 48, 48, 48, 48, 48,
-/* 0x3470 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x3480 */  84, 82, 49, 51, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10,
-/* 0x3490 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x34a0 */  32, 76, 73, 78, 85, 90, 86, 71, 65, 32, 48, 32, 76, 73, 78, 85,
-/* 0x34b0 */  90, 86, 71, 65, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x34c0 */  32, 32, 32,100, 32, 32, 76, 73, 78, 85, 90, 48, 48, 48, 32, 48,
-/* 0x34d0 */  32, 76, 73, 78, 85, 90, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x34e0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 90,
-/* 0x34f0 */  48, 48, 49, 32, 48, 32, 76, 73, 78, 85, 90, 48, 48, 49, 10, 48,
-/* 0x3500 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3510 */  76, 73, 78, 85, 90, 48, 48, 53, 32, 48, 32, 76, 73, 78, 85, 90,
-/* 0x3520 */  48, 48, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3530 */  32, 32,100, 32, 32, 76, 73, 78, 85, 90, 48, 49, 48, 32, 48, 32,
-/* 0x3540 */  76, 73, 78, 85, 90, 48, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3550 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 90, 49,
-/* 0x3560 */  48, 49, 32, 48, 32, 76, 73, 78, 85, 90, 49, 48, 49, 10, 48, 48,
-/* 0x3570 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x3580 */  73, 78, 85, 90, 49, 49, 48, 32, 48, 32, 76, 73, 78, 85, 90, 49,
-/* 0x3590 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x35a0 */  32,100, 32, 32, 76, 73, 78, 85, 90, 49, 50, 48, 32, 48, 32, 76,
-/* 0x35b0 */  73, 78, 85, 90, 49, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x35c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 90, 49, 51,
-/* 0x35d0 */  48, 32, 48, 32, 76, 73, 78, 85, 90, 49, 51, 48, 10, 48, 48, 48,
-/* 0x35e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73,
-/* 0x35f0 */  78, 85, 90, 49, 52, 48, 32, 48, 32, 76, 73, 78, 85, 90, 49, 52,
-/* 0x3600 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3610 */ 100, 32, 32, 76, 73, 78, 85, 90, 49, 52, 49, 32, 48, 32, 76, 73,
-/* 0x3620 */  78, 85, 90, 49, 52, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3630 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 90, 49, 52, 53,
-/* 0x3640 */  32, 48, 32, 76, 73, 78, 85, 90, 49, 52, 53, 10, 48, 48, 48, 48,
-/* 0x3650 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78,
-/* 0x3660 */  85, 90, 49, 53, 48, 32, 48, 32, 76, 73, 78, 85, 90, 49, 53, 48,
-/* 0x3670 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3680 */  32, 32, 76, 90, 67, 65, 76, 76, 84, 49, 32, 48, 32, 76, 90, 67,
-/* 0x3690 */  65, 76, 76, 84, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x36a0 */  32, 32, 32, 32,100, 32, 32, 76, 90, 67, 75, 76, 76, 84, 49, 32,
-/* 0x36b0 */  48, 32, 76, 90, 67, 75, 76, 76, 84, 49, 10, 48, 48, 48, 48, 48,
-/* 0x36c0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 66, 90, 73,
-/* 0x36d0 */  77, 65, 71, 69, 32, 48, 32, 76, 66, 90, 73, 77, 65, 71, 69, 10,
-/* 0x36e0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x36f0 */  32, 76, 90, 73, 77, 65, 71, 69, 48, 32, 48, 32, 76, 90, 73, 77,
-/* 0x3700 */  65, 71, 69, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3710 */  32, 32, 32,100, 32, 32, 76, 90, 67, 85, 84, 80, 79, 73, 32, 48,
-/* 0x3720 */  32, 76, 90, 67, 85, 84, 80, 79, 73, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3730 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65,
-/* 0x3740 */  83, 49, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 49, 48, 10, 48,
-/* 0x3750 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3760 */  78, 50, 66, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 66, 83, 77,
-/* 0x3770 */  65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3780 */  32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48, 32, 48, 32,
-/* 0x3790 */  78, 50, 66, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37a0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x37b0 */  51, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 51, 48, 10, 48, 48,
-/* 0x37c0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x37d0 */  50, 66, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x37e0 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x37f0 */  32,100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 48, 32, 78,
-/* 0x3800 */  50, 66, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3810 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 52,
-/* 0x3820 */  48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48, 10, 48, 48, 48,
-/* 0x3830 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3840 */  66, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 53,
-/* 0x3850 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3860 */ 100, 32, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50,
-/* 0x3870 */  66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3880 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 54, 48,
-/* 0x3890 */  32, 48, 32, 78, 50, 66, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48,
-/* 0x38a0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x38b0 */  70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 48,
-/* 0x38c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x38d0 */  32, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 68,
-/* 0x38e0 */  70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x38f0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 50, 48, 32,
-/* 0x3900 */  48, 32, 78, 50, 68, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3910 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70,
-/* 0x3920 */  65, 83, 50, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 50, 48, 10,
-/* 0x3930 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3940 */  32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 68, 83,
-/* 0x3950 */  77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3960 */  32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 48,
-/* 0x3970 */  32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3980 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77,
-/* 0x3990 */  65, 52, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 52, 48, 10, 48,
-/* 0x39a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x39b0 */  78, 50, 68, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 68, 70, 65,
-/* 0x39c0 */  83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x39d0 */  32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 48, 32,
-/* 0x39e0 */  78, 50, 68, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x3a00 */  53, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 53, 48, 10, 48, 48,
-/* 0x3a10 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3a20 */  50, 68, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x3a30 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3a40 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 48, 32, 78,
-/* 0x3a50 */  50, 68, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a60 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 49,
-/* 0x3a70 */  48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48, 10, 48, 48, 48,
-/* 0x3a80 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3a90 */  69, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 50,
-/* 0x3aa0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3ab0 */ 100, 32, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50,
-/* 0x3ac0 */  69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3ad0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 51, 48,
-/* 0x3ae0 */  32, 48, 32, 78, 50, 69, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48,
-/* 0x3af0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x3b00 */  70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x3b10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3b20 */  32, 32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 69,
-/* 0x3b30 */  83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3b40 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32,
-/* 0x3b50 */  48, 32, 78, 50, 69, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3b60 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83,
-/* 0x3b70 */  77, 65, 53, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 53, 48, 10,
-/* 0x3b80 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3b90 */  32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 69, 70,
-/* 0x3ba0 */  65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3bb0 */  32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 54, 48, 32, 48,
-/* 0x3bc0 */  32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3bd0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65,
-/* 0x3be0 */  83, 54, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54, 48, 10, 48,
-/* 0x3bf0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3c00 */  76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 48, 32, 76, 90, 77,
-/* 0x3c10 */  65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3c20 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x3c30 */  70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x3c40 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3c50 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76,
-/* 0x3c60 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3c70 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x3c80 */  68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x3c90 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3ca0 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48,
-/* 0x3cb0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x3cc0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 67,
-/* 0x3cd0 */  75, 76, 76, 84, 57, 32, 48, 32, 76, 90, 67, 75, 76, 76, 84, 57,
-/* 0x3ce0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3cf0 */  32, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 48, 32, 99,116,
-/* 0x3d00 */ 111,107, 51, 50, 46, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d10 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 67, 65, 76, 76, 84,
-/* 0x3d20 */  57, 32, 48, 32, 76, 90, 67, 65, 76, 76, 84, 57, 10, 48, 48, 48,
-/* 0x3d30 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x3d40 */  67, 76, 69, 86, 69, 49, 32, 48, 32, 67, 84, 67, 76, 69, 86, 69,
-/* 0x3d50 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3d60 */ 100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 48, 32, 67, 65,
-/* 0x3d70 */  76, 76, 84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3d80 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 48, 49,
-/* 0x3d90 */  32, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10, 48, 48, 48, 48,
-/* 0x3da0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66,
-/* 0x3db0 */  82, 79, 82, 48, 49, 32, 48, 32, 67, 84, 66, 82, 79, 82, 48, 49,
-/* 0x3dc0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3dd0 */  32, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 48, 32, 67, 84, 66,
-/* 0x3de0 */  83, 87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3df0 */  32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32,
-/* 0x3e00 */  48, 32, 67, 65, 76, 76, 84, 82, 48, 50, 10, 48, 48, 48, 48, 48,
-/* 0x3e10 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76,
-/* 0x3e20 */  84, 82, 69, 56, 32, 48, 32, 67, 65, 76, 76, 84, 82, 69, 56, 10,
-/* 0x3e30 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3e40 */  32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 48, 32, 67, 65, 76, 76,
-/* 0x3e50 */  84, 82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3e60 */  32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 48,
-/* 0x3e70 */  32, 67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3e80 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84,
-/* 0x3e90 */  82, 49, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 50, 10, 48,
-/* 0x3ea0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3eb0 */  67, 84, 66, 83, 72, 82, 49, 49, 32, 48, 32, 67, 84, 66, 83, 72,
-/* 0x3ec0 */  82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3ed0 */  32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32, 48, 32,
-/* 0x3ee0 */  67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ef0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65,
-/* 0x3f00 */  49, 49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 49, 49, 10, 48, 48,
-/* 0x3f10 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x3f20 */  73, 78, 85, 90, 57, 57, 48, 32, 48, 32, 76, 73, 78, 85, 90, 57,
-/* 0x3f30 */  57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3f40 */  32,100, 32, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 48, 32, 85,
-/* 0x3f50 */  80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x3f70 */  32,115,116, 97, 99,107, 95,111,102,102,115,101,116, 10, 48, 48,
-/* 0x3f80 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x3f90 */  85, 78, 68, 42, 32, 48, 32,111,114,105,103,105,110, 97,108, 95,
-/* 0x3fa0 */ 101,110,116,114,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x3fb0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 99,
-/* 0x3fc0 */ 111,109,112,114,101,115,115,101,100, 95,108,101,110,103,116,104,
-/* 0x3fd0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3fe0 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,110,101,103, 95, 99,111,
-/* 0x3ff0 */ 110,102,105,103, 95,112,104,121,115,105, 99, 97,108, 95, 97,108,
-/* 0x4000 */ 105,103,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x4010 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,111, 97,
-/* 0x4020 */ 100, 95,112,104,121,115,105, 99, 97,108, 95, 97,100,100,114,101,
-/* 0x4030 */ 115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x4040 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,117,110, 99, 95,
-/* 0x4050 */ 108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4060 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x4070 */ 100,101, 99, 95,111,102,102,115,101,116, 10, 48, 48, 48, 48, 48,
-/* 0x4080 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x4090 */  42, 32, 48, 32,117,110, 99, 95,111,102,102,115,101,116, 10, 48,
-/* 0x40a0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x40b0 */  42, 85, 78, 68, 42, 32, 48, 32,110,101,103, 95,108,101,110,103,
-/* 0x40c0 */ 116,104, 95,109,111,118, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x40d0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x40e0 */ 102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48,
-/* 0x40f0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x4100 */  42, 32, 48, 32,102,105,108,116,101,114, 95,108,101,110,103,116,
-/* 0x4110 */ 104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x4120 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,110,101,103, 95,112,
-/* 0x4130 */  97,103,101, 95,111,102,102,115,101,116, 10, 48, 48, 48, 48, 48,
-/* 0x4140 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x4150 */  42, 32, 48, 32, 99,111,112,121, 95,115,111,117,114, 99,101, 10,
-/* 0x4160 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4170 */  32, 42, 85, 78, 68, 42, 32, 48, 32, 99,111,112,121, 95,100,101,
-/* 0x4180 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x4190 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,119,111,114,100,
-/* 0x41a0 */ 115, 95,116,111, 95, 99,111,112,121, 10, 48, 48, 48, 48, 48, 48,
-/* 0x41b0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x41c0 */  32, 48, 32,115,114, 99, 95,102,111,114, 95,100,101, 99,111,109,
-/* 0x41d0 */ 112,114,101,115,115,111,114, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x41e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x41f0 */  32,100,101, 99,111,109,112,114,101,115,115,111,114, 10, 48, 48,
-/* 0x4200 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x4210 */  85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,115,116, 97, 99,
-/* 0x4220 */ 107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4230 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x4240 */  48, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48,
-/* 0x4250 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x4260 */  78, 68, 42, 32, 48, 32,108,122,109, 97, 95, 99, 95,108,101,110,
-/* 0x4270 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4280 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,112,
-/* 0x4290 */ 114,111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x42a0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x42b0 */  82, 32, 91, 76, 73, 78, 85, 90, 48, 48, 48, 93, 58, 10, 79, 70,
-/* 0x42c0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x42d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x42e0 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x42f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,115,116, 97, 99,107, 95,
-/* 0x4300 */ 111,102,102,115,101,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4310 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4320 */  76, 73, 78, 85, 90, 48, 48, 53, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4330 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4340 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4350 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x4360 */  32, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108, 95,
-/* 0x4370 */ 101,110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x4380 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x4390 */  73, 78, 85, 90, 49, 48, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x43a0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x43b0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x43c0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x43d0 */  32, 32, 32, 32, 32, 32, 99,111,109,112,114,101,115,115,101,100,
-/* 0x43e0 */  95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x43f0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4400 */  91, 76, 73, 78, 85, 90, 49, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4410 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4420 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4430 */  48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x4440 */  32, 32, 32, 32, 32, 32, 32, 32,110,101,103, 95, 99,111,110,102,
-/* 0x4450 */ 105,103, 95,112,104,121,115,105, 99, 97,108, 95, 97,108,105,103,
-/* 0x4460 */ 110, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4470 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 73, 78, 85, 90,
-/* 0x4480 */  49, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4490 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x44a0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x44b0 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x44c0 */  32, 32,108,111, 97,100, 95,112,104,121,115,105, 99, 97,108, 95,
-/* 0x44d0 */  97,100,100,114,101,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x44e0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x44f0 */  91, 76, 73, 78, 85, 90, 49, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4500 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4510 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4520 */  48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32,
-/* 0x4530 */  32, 32, 32, 32, 32, 32, 32, 32,117,110, 99, 95,108,101,110,103,
-/* 0x4540 */ 116,104, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56,
-/* 0x4550 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,100,101,
-/* 0x4560 */  99, 95,111,102,102,115,101,116, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x4570 */  53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x4580 */  32, 32, 32, 32,117,110, 99, 95,111,102,102,115,101,116, 10, 48,
-/* 0x4590 */  48, 48, 48, 48, 48, 49, 98, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x45a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,110,101,103, 95,108,101,
-/* 0x45b0 */ 110,103,116,104, 95,109,111,118, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x45c0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x45d0 */  32, 91, 76, 73, 78, 85, 90, 49, 52, 53, 93, 58, 10, 79, 70, 70,
-/* 0x45e0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x45f0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4600 */  48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32,
-/* 0x4610 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x4620 */  99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51,
-/* 0x4630 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x4640 */ 105,108,116,101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69,
-/* 0x4650 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4660 */  32, 70, 79, 82, 32, 91, 76, 73, 78, 85, 90, 49, 53, 48, 93, 58,
-/* 0x4670 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4680 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4690 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54,
-/* 0x46a0 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,111, 97,
-/* 0x46b0 */ 100, 95,112,104,121,115,105, 99, 97,108, 95, 97,100,100,114,101,
-/* 0x46c0 */ 115,115, 10, 48, 48, 48, 48, 48, 48, 49, 51, 32, 82, 95, 51, 56,
-/* 0x46d0 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,110,101,
-/* 0x46e0 */ 103, 95,112, 97,103,101, 95,111,102,102,115,101,116, 10, 10, 82,
-/* 0x46f0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4700 */  83, 32, 70, 79, 82, 32, 91, 76, 90, 67, 75, 76, 76, 84, 49, 93,
-/* 0x4710 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4720 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4730 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56,
-/* 0x4740 */  54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,
-/* 0x4750 */ 108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4760 */  52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x4770 */  32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,
-/* 0x4780 */ 104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4790 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 66, 90, 73, 77,
-/* 0x47a0 */  65, 71, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x47b0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x47c0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x47d0 */  82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x47e0 */  32, 32, 99,111,112,121, 95,115,111,117,114, 99,101, 10, 48, 48,
-/* 0x47f0 */  48, 48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x4800 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 99,111,112,121, 95,100,101,
-/* 0x4810 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 48, 98, 32, 82, 95, 51, 56,
-/* 0x4820 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,119,111,
-/* 0x4830 */ 114,100,115, 95,116,111, 95, 99,111,112,121, 10, 48, 48, 48, 48,
-/* 0x4840 */  48, 48, 49, 52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x4850 */  32, 32, 32, 32, 32, 32, 32,115,114, 99, 95,102,111,114, 95,100,
-/* 0x4860 */ 101, 99,111,109,112,114,101,115,115,111,114, 10, 48, 48, 48, 48,
-/* 0x4870 */  48, 48, 49, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32,
-/* 0x4880 */  32, 32, 32, 32, 32, 32, 32,100,101, 99,111,109,112,114,101,115,
-/* 0x4890 */ 115,111,114, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x48a0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 73,
-/* 0x48b0 */  77, 65, 71, 69, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x48c0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x48d0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x48e0 */  97, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x48f0 */  32, 32, 32, 32,115,114, 99, 95,102,111,114, 95,100,101, 99,111,
-/* 0x4900 */ 109,112,114,101,115,115,111,114, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4910 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4920 */  32, 91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x4930 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4940 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4950 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x4960 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x4970 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4980 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65,
-/* 0x4990 */  83, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x49a0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49b0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x49c0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49d0 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x49e0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x49f0 */  79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10, 79,
-/* 0x4a00 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4a10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4a20 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x4a30 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83, 77,
-/* 0x4a40 */  65, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4a50 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66,
-/* 0x4a60 */  70, 65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4a70 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a80 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4a90 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x4aa0 */  32, 32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82, 69,
-/* 0x4ab0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4ac0 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93, 58,
-/* 0x4ad0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4ae0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4af0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54,
-/* 0x4b00 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x4b10 */  68, 69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x4b20 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x4b30 */  50, 66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x4b40 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4b50 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4b60 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x4b70 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48,
-/* 0x4b80 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4b90 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x4ba0 */  50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4bb0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 68,
-/* 0x4bc0 */  69, 67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4bd0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4be0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49,
-/* 0x4bf0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x4c00 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48,
-/* 0x4c10 */  48, 48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x4c20 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10,
-/* 0x4c30 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x4c40 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 52,
-/* 0x4c50 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x4c60 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x4c70 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x4c80 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4c90 */  78, 50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4ca0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4cb0 */  32, 91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70,
-/* 0x4cc0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4cd0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4ce0 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x4cf0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51,
-/* 0x4d00 */  48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x4d10 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x4d20 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x4d30 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x4d40 */  50, 66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x4d50 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4d60 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4d70 */  48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x4d80 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10,
-/* 0x4d90 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4da0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 48,
-/* 0x4db0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4dc0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4dd0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x4de0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x4df0 */  50, 66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53,
-/* 0x4e00 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x4e10 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x4e20 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4e30 */  70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58, 10,
-/* 0x4e40 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4e50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4e60 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4e70 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x4e80 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4e90 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4ea0 */  68, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4eb0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ec0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4ed0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4ee0 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x4ef0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x4f00 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48, 93,
-/* 0x4f10 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x4f20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x4f30 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x4f40 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x4f50 */  68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4f60 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4f70 */  78, 50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4f80 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f90 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4fa0 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x4fb0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10,
-/* 0x4fc0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x4fd0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 50,
-/* 0x4fe0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x4ff0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5000 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x5010 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5020 */  78, 50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5030 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5040 */  32, 91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5050 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5060 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5070 */  48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5080 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x5090 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x50a0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65,
-/* 0x50b0 */  83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x50c0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50d0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x50e0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x50f0 */  32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5100 */  48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5110 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10,
-/* 0x5120 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5130 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x5140 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5150 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5160 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51,
-/* 0x5170 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5180 */  50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50, 49,
-/* 0x5190 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x51a0 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48,
-/* 0x51b0 */  48, 48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x51c0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10,
-/* 0x51d0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x51e0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 52,
-/* 0x51f0 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5200 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5210 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x5220 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5230 */  78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5240 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5250 */  32, 91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5260 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5270 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5280 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5290 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51,
-/* 0x52a0 */  48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x52b0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x52c0 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x52d0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x52e0 */  50, 68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x52f0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5300 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5310 */  48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x5320 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10,
-/* 0x5330 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5340 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 48,
-/* 0x5350 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5360 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5370 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x5380 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5390 */  50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53,
-/* 0x53a0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x53b0 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x53c0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x53d0 */  70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58, 10,
-/* 0x53e0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x53f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5400 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5410 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x5420 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5430 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5440 */  69, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5450 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5460 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5470 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5480 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x5490 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x54a0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48, 93,
-/* 0x54b0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x54c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x54d0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x54e0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x54f0 */  69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x5500 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x5510 */  78, 50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5520 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5530 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5540 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5550 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10,
-/* 0x5560 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5570 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 50,
-/* 0x5580 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5590 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x55a0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x55b0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x55c0 */  78, 50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x55d0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x55e0 */  32, 91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70,
-/* 0x55f0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5600 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5610 */  48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5620 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x5630 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5640 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65,
-/* 0x5650 */  83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5660 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5670 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x5680 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5690 */  32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x56a0 */  48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x56b0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10,
-/* 0x56c0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x56d0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x56e0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x56f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5700 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51,
-/* 0x5710 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5720 */  50, 69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,101,
-/* 0x5730 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5740 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48,
-/* 0x5750 */  48, 48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5760 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10,
-/* 0x5770 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5780 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 52,
-/* 0x5790 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x57a0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x57b0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x57c0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57d0 */  78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x57e0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x57f0 */  32, 91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70,
-/* 0x5800 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5810 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5820 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5830 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x5840 */  48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54,
-/* 0x5850 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x5860 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5870 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5880 */  50, 69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5890 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x58a0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x58b0 */  48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32,
-/* 0x58c0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10,
-/* 0x58d0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x58e0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 48,
-/* 0x58f0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5900 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5910 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51,
-/* 0x5920 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5930 */  50, 69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53,
-/* 0x5940 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x5950 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x5960 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5970 */  70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58, 10,
-/* 0x5980 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5990 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x59a0 */  10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x59b0 */  80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x59c0 */  69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x59d0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90,
-/* 0x59e0 */  77, 65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x59f0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a00 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5a10 */  48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x5a20 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,
-/* 0x5a30 */ 107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5a40 */  52, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x5a50 */  32, 32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48,
-/* 0x5a60 */  48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x5a70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99,
-/* 0x5a80 */  95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 97, 32, 82, 95,
-/* 0x5a90 */  51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5aa0 */ 108,122,109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10,
-/* 0x5ab0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5ac0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46,
-/* 0x5ad0 */  48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5ae0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5af0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x5b00 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b10 */  32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5b20 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5b30 */  79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48, 93, 58, 10,
-/* 0x5b40 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5b50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5b60 */  10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5b70 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x5b80 */  51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5b90 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x5ba0 */ 116,111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x5bb0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5bc0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x5bd0 */  48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5be0 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x5bf0 */  10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5c00 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x5c10 */  51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82,
-/* 0x5c20 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c30 */  32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5c40 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5c50 */  79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 51, 48, 93, 58, 10,
-/* 0x5c60 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5c70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5c80 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5c90 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x5ca0 */  51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 57, 32, 82,
-/* 0x5cb0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5cc0 */  32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5cd0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5ce0 */  79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 52, 48, 93, 58, 10,
-/* 0x5cf0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5d00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5d10 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5d20 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x5d30 */  51, 50, 46, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5d40 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67,
-/* 0x5d50 */  65, 76, 76, 84, 82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5d60 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d70 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5d80 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x5d90 */  32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,110,
-/* 0x5da0 */ 103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5db0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67,
-/* 0x5dc0 */  76, 69, 86, 69, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5dd0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5de0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5df0 */  50, 32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e00 */  32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48,
-/* 0x5e10 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5e20 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x5e30 */  48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5e40 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76,
-/* 0x5e50 */  84, 82, 48, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5e60 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e70 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,100,
-/* 0x5e80 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5e90 */  32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76,
-/* 0x5ea0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5eb0 */  70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10,
-/* 0x5ec0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5ed0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5ee0 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5ef0 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,
-/* 0x5f00 */ 101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5f10 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5f20 */  82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70,
-/* 0x5f30 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5f40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5f50 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5f60 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x5f70 */  49, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5f80 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76,
-/* 0x5f90 */  69, 86, 69, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5fa0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fb0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x5fc0 */  32, 82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fd0 */  32, 32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48,
-/* 0x5fe0 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5ff0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x6000 */  49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6010 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84,
-/* 0x6020 */  82, 49, 51, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6030 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6040 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x6050 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6060 */  32, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10
+/* 0x1b00 */   0, 45,106,  0,  0,  0,127,  0,  0,  0, 92,  0,  0,  0, 36,  5,
+/* 0x1b10 */   0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   0,  0,  9,  0,  0,  0, 52,  0,  0,  0,146,  0,  0,  0,  0,  0,
+/* 0x1b30 */   0,  0, 18,  0,  0,  0,198,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1b40 */   0,  0, 27,  0,  0,  0,203,  0,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1b50 */   0,  0, 36,  0,  0,  0,212,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1b60 */   0,  0, 45,  0,  0,  0,215,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1b70 */   0,  0, 54,  0,  0,  0,220,  0,  0,  0, 45,  0,  0,  0,  0,  0,
+/* 0x1b80 */   0,  0, 63,  0,  0,  0,  9,  1,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x1b90 */   0,  0, 72,  0,  0,  0, 21,  1,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1ba0 */   0,  0, 81,  0,  0,  0, 26,  1,  0,  0, 34,  0,  0,  0,  0,  0,
+/* 0x1bb0 */   0,  0, 90,  0,  0,  0, 60,  1,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1bc0 */   0,  0, 99,  0,  0,  0, 63,  1,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x1bd0 */   0,  0,108,  0,  0,  0, 71,  1,  0,  0, 34,  0,  0,  0,  0,  0,
+/* 0x1be0 */   0,  0,117,  0,  0,  0,105,  1,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x1bf0 */   0,  0,126,  0,  0,  0,106,  1,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x1c00 */   0,  0,135,  0,  0,  0,114,  1,  0,  0, 30,  0,  0,  0,  0,  0,
+/* 0x1c10 */   0,  0,144,  0,  0,  0,144,  1,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x1c20 */   0,  0,153,  0,  0,  0,159,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */   0,  0,162,  0,  0,  0,159,  1,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1c40 */   0,  0,171,  0,  0,  0,162,  1,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1c50 */   0,  0,180,  0,  0,  0,164,  1,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x1c60 */   0,  0,189,  0,  0,  0,170,  1,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x1c70 */   0,  0,198,  0,  0,  0,181,  1,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1c80 */   0,  0,207,  0,  0,  0,186,  1,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1c90 */   0,  0,216,  0,  0,  0,195,  1,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1ca0 */   0,  0,225,  0,  0,  0,208,  1,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1cb0 */   0,  0,234,  0,  0,  0,221,  1,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x1cc0 */   0,  0,243,  0,  0,  0,236,  1,  0,  0, 62,  0,  0,  0,  0,  0,
+/* 0x1cd0 */   0,  0,252,  0,  0,  0, 42,  2,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  5,  1,  0,  0, 55,  2,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x1cf0 */   0,  0, 14,  1,  0,  0, 70,  2,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,  0, 23,  1,  0,  0, 72,  2,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1d10 */   0,  0, 32,  1,  0,  0, 75,  2,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1d20 */   0,  0, 41,  1,  0,  0, 84,  2,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x1d30 */   0,  0, 50,  1,  0,  0, 96,  2,  0,  0, 25,  0,  0,  0,  0,  0,
+/* 0x1d40 */   0,  0, 59,  1,  0,  0,121,  2,  0,  0, 22,  0,  0,  0,  0,  0,
+/* 0x1d50 */   0,  0, 68,  1,  0,  0,143,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d60 */   0,  0, 77,  1,  0,  0,143,  2,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0,  0, 86,  1,  0,  0,146,  2,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1d80 */   0,  0, 95,  1,  0,  0,148,  2,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x1d90 */   0,  0,104,  1,  0,  0,154,  2,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x1da0 */   0,  0,113,  1,  0,  0,165,  2,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1db0 */   0,  0,122,  1,  0,  0,170,  2,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1dc0 */   0,  0,131,  1,  0,  0,179,  2,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1dd0 */   0,  0,140,  1,  0,  0,192,  2,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1de0 */   0,  0,149,  1,  0,  0,205,  2,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x1df0 */   0,  0,158,  1,  0,  0,220,  2,  0,  0, 82,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,  0,167,  1,  0,  0, 46,  3,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1e10 */   0,  0,176,  1,  0,  0, 59,  3,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x1e20 */   0,  0,185,  1,  0,  0, 74,  3,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1e30 */   0,  0,194,  1,  0,  0, 76,  3,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1e40 */   0,  0,203,  1,  0,  0, 79,  3,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1e50 */   0,  0,212,  1,  0,  0, 88,  3,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,  0,221,  1,  0,  0,100,  3,  0,  0, 25,  0,  0,  0,  0,  0,
+/* 0x1e70 */   0,  0,230,  1,  0,  0,125,  3,  0,  0, 22,  0,  0,  0,  0,  0,
+/* 0x1e80 */   0,  0,239,  1,  0,  0,147,  3,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */   0,  0,248,  1,  0,  0,147,  3,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  1,  2,  0,  0,150,  3,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1eb0 */   0,  0, 10,  2,  0,  0,152,  3,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,  0, 19,  2,  0,  0,158,  3,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,  0, 28,  2,  0,  0,169,  3,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,  0, 37,  2,  0,  0,174,  3,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1ef0 */   0,  0, 46,  2,  0,  0,183,  3,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1f00 */   0,  0, 55,  2,  0,  0,196,  3,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0,  0, 64,  2,  0,  0,209,  3,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x1f20 */   0,  0, 73,  2,  0,  0,224,  3,  0,  0, 95,  0,  0,  0,  0,  0,
+/* 0x1f30 */   0,  0, 82,  2,  0,  0, 63,  4,  0,  0, 13,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0, 91,  2,  0,  0, 76,  4,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x1f50 */   0,  0,100,  2,  0,  0, 91,  4,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1f60 */   0,  0,109,  2,  0,  0, 93,  4,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0,  0,118,  2,  0,  0, 96,  4,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1f80 */   0,  0,127,  2,  0,  0,105,  4,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x1f90 */   0,  0,136,  2,  0,  0,117,  4,  0,  0, 25,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   0,  0,145,  2,  0,  0,142,  4,  0,  0, 22,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0,  0,154,  2,  0,  0,164,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   0,  0,163,  2,  0,  0,164,  4,  0,  0, 46,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0,  0,174,  2,  0,  0,210,  4,  0,  0, 72,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,  0,185,  2,  0,  0, 26,  5,  0,  0,134, 10,  0,  0,  0,  0,
+/* 0x1ff0 */   0,  0,196,  2,  0,  0,160, 15,  0,  0,134, 10,  0,  0,  0,  0,
+/* 0x2000 */   0,  0,207,  2,  0,  0, 38, 26,  0,  0, 26,  0,  0,  0,  0,  0,
+/* 0x2010 */   0,  0,218,  2,  0,  0, 64, 26,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x2020 */   0,  0,227,  2,  0,  0, 67, 26,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2030 */   0,  0,237,  2,  0,  0, 74, 26,  0,  0, 14,  0,  0,  0,  0,  0,
+/* 0x2040 */   0,  0,247,  2,  0,  0, 88, 26,  0,  0, 32,  0,  0,  0,  0,  0,
+/* 0x2050 */   0,  0,  1,  3,  0,  0,120, 26,  0,  0, 10,  0,  0,  0,  0,  0,
+/* 0x2060 */   0,  0, 11,  3,  0,  0,130, 26,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2070 */   0,  0, 21,  3,  0,  0,135, 26,  0,  0,  1,  0,  0,  0,  0,  0,
+/* 0x2080 */   0,  0, 30,  3,  0,  0,136, 26,  0,  0, 14,  0,  0,  0,  0,  0,
+/* 0x2090 */   0,  0, 39,  3,  0,  0,150, 26,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x20a0 */   0,  0, 48,  3,  0,  0,155, 26,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x20b0 */   0,  0, 57,  3,  0,  0,160, 26,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x20c0 */   0,  0, 66,  3,  0,  0,164, 26,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x20d0 */   0,  0, 75,  3,  0,  0,166, 26,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x20e0 */   0,  0, 84,  3,  0,  0,171, 26,  0,  0, 14,  0,  0,  0,  0,  0,
+/* 0x20f0 */   0,  0, 93,  3,  0,  0,185, 26,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2100 */   0,  0,102,  3,  0,  0,190, 26,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x2110 */   0,  0,111,  3,  0,  0,192, 26,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x2120 */   0,  0,120,  3,  0,  0,194, 26,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2130 */   0,  0,129,  3,  0,  0,198, 26,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2140 */   0,  0,138,  3,  0,  0,203, 26,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x2150 */   0,  0,147,  3,  0,  0,205, 26,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x2160 */   0,  0,156,  3,  0,  0,209, 26,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x2170 */   0,  0,165,  3,  0,  0,211, 26,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2180 */   0,  0,174,  3,  0,  0,216, 26,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x2190 */   0,  0,183,  3,  0,  0,221, 26,  0,  0,  5,  0,  0,  0,  0,  0,
+/* 0x21a0 */   0,  0,192,  3,  0,  0,226, 26,  0,  0, 32,  0,  0,  0,  0,  0,
+/* 0x21b0 */   0,  0,162,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,180,  0,
+/* 0x21c0 */   0,  0, 20,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 21,  0,
+/* 0x21d0 */   0,  0,  0,  0,  0,  0,216,  0,  0,  0, 24,  0,  0,  0,  0,  0,
+/* 0x21e0 */   0,  0,243,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0, 32,  1,
+/* 0x21f0 */   0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0, 35,  0,
+/* 0x2200 */   0,  0,  0,  0,  0,  0, 68,  1,  0,  0, 36,  0,  0,  0,  0,  0,
+/* 0x2210 */   0,  0, 77,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0, 95,  1,
+/* 0x2220 */   0,  0, 39,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 40,  0,
+/* 0x2230 */   0,  0,  0,  0,  0,  0,131,  1,  0,  0, 43,  0,  0,  0,  0,  0,
+/* 0x2240 */   0,  0,158,  1,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,203,  1,
+/* 0x2250 */   0,  0, 51,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0, 54,  0,
+/* 0x2260 */   0,  0,  0,  0,  0,  0,239,  1,  0,  0, 55,  0,  0,  0,  0,  0,
+/* 0x2270 */   0,  0,248,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0, 10,  2,
+/* 0x2280 */   0,  0, 58,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 59,  0,
+/* 0x2290 */   0,  0,  0,  0,  0,  0, 46,  2,  0,  0, 62,  0,  0,  0,  0,  0,
+/* 0x22a0 */   0,  0, 73,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,118,  2,
+/* 0x22b0 */   0,  0, 70,  0,  0,  0,  0,  0,  0,  0,145,  2,  0,  0, 73,  0,
+/* 0x22c0 */   0,  0,  0,  0,  0,  0,154,  2,  0,  0, 74,  0,  0,  0,  0,  0,
+/* 0x22d0 */   0,  0,227,  2,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,237,  2,
+/* 0x22e0 */   0,  0, 82,  0,  0,  0,  0,  0,  0,  0,247,  2,  0,  0, 83,  0,
+/* 0x22f0 */   0,  0,  0,  0,  0,  0, 11,  3,  0,  0, 85,  0,  0,  0,  0,  0,
+/* 0x2300 */   0,  0, 30,  3,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0, 93,  3,
+/* 0x2310 */   0,  0, 94,  0,  0,  0,  0,  0,  0,  0,120,  3,  0,  0, 97,  0,
+/* 0x2320 */   0,  0,  0,  0,  0,  0,174,  3,  0,  0,103,  0,  0,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x2340 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,
+/* 0x2350 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x2360 */   0,  0, 36,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 45,  0,
+/* 0x2370 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  6,  0,
+/* 0x2380 */   0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x2390 */   0,  0, 72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 81,  0,
+/* 0x23a0 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0, 10,  0,
+/* 0x23b0 */   0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x23c0 */   0,  0,108,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,117,  0,
+/* 0x23d0 */   0,  0, 13,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0, 14,  0,
+/* 0x23e0 */   0,  0,  0,  0,  0,  0,135,  0,  0,  0, 15,  0,  0,  0,  0,  0,
+/* 0x23f0 */   0,  0,144,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,153,  0,
+/* 0x2400 */   0,  0, 17,  0,  0,  0,  0,  0,  0,  0,171,  0,  0,  0, 19,  0,
+/* 0x2410 */   0,  0,  0,  0,  0,  0,198,  0,  0,  0, 22,  0,  0,  0,  0,  0,
+/* 0x2420 */   0,  0,207,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,225,  0,
+/* 0x2430 */   0,  0, 25,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 26,  0,
+/* 0x2440 */   0,  0,  0,  0,  0,  0,252,  0,  0,  0, 28,  0,  0,  0,  0,  0,
+/* 0x2450 */   0,  0,  5,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0, 14,  1,
+/* 0x2460 */   0,  0, 30,  0,  0,  0,  0,  0,  0,  0, 23,  1,  0,  0, 31,  0,
+/* 0x2470 */   0,  0,  0,  0,  0,  0, 41,  1,  0,  0, 33,  0,  0,  0,  0,  0,
+/* 0x2480 */   0,  0, 50,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0, 86,  1,
+/* 0x2490 */   0,  0, 38,  0,  0,  0,  0,  0,  0,  0,113,  1,  0,  0, 41,  0,
+/* 0x24a0 */   0,  0,  0,  0,  0,  0,122,  1,  0,  0, 42,  0,  0,  0,  0,  0,
+/* 0x24b0 */   0,  0,140,  1,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,149,  1,
+/* 0x24c0 */   0,  0, 45,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 47,  0,
+/* 0x24d0 */   0,  0,  0,  0,  0,  0,176,  1,  0,  0, 48,  0,  0,  0,  0,  0,
+/* 0x24e0 */   0,  0,185,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,194,  1,
+/* 0x24f0 */   0,  0, 50,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0, 52,  0,
+/* 0x2500 */   0,  0,  0,  0,  0,  0,221,  1,  0,  0, 53,  0,  0,  0,  0,  0,
+/* 0x2510 */   0,  0,  1,  2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0, 28,  2,
+/* 0x2520 */   0,  0, 60,  0,  0,  0,  0,  0,  0,  0, 37,  2,  0,  0, 61,  0,
+/* 0x2530 */   0,  0,  0,  0,  0,  0, 55,  2,  0,  0, 63,  0,  0,  0,  0,  0,
+/* 0x2540 */   0,  0, 64,  2,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0, 82,  2,
+/* 0x2550 */   0,  0, 66,  0,  0,  0,  0,  0,  0,  0, 91,  2,  0,  0, 67,  0,
+/* 0x2560 */   0,  0,  0,  0,  0,  0,100,  2,  0,  0, 68,  0,  0,  0,  0,  0,
+/* 0x2570 */   0,  0,109,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,127,  2,
+/* 0x2580 */   0,  0, 71,  0,  0,  0,  0,  0,  0,  0,136,  2,  0,  0, 72,  0,
+/* 0x2590 */   0,  0,  0,  0,  0,  0,163,  2,  0,  0, 75,  0,  0,  0,  0,  0,
+/* 0x25a0 */   0,  0,174,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,185,  2,
+/* 0x25b0 */   0,  0, 77,  0,  0,  0,  0,  0,  0,  0,196,  2,  0,  0, 78,  0,
+/* 0x25c0 */   0,  0,  0,  0,  0,  0,207,  2,  0,  0, 79,  0,  0,  0,  0,  0,
+/* 0x25d0 */   0,  0,218,  2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  1,  3,
+/* 0x25e0 */   0,  0, 84,  0,  0,  0,  0,  0,  0,  0, 21,  3,  0,  0, 86,  0,
+/* 0x25f0 */   0,  0,  0,  0,  0,  0, 39,  3,  0,  0, 88,  0,  0,  0,  0,  0,
+/* 0x2600 */   0,  0, 48,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0, 57,  3,
+/* 0x2610 */   0,  0, 90,  0,  0,  0,  0,  0,  0,  0, 66,  3,  0,  0, 91,  0,
+/* 0x2620 */   0,  0,  0,  0,  0,  0, 75,  3,  0,  0, 92,  0,  0,  0,  0,  0,
+/* 0x2630 */   0,  0, 84,  3,  0,  0, 93,  0,  0,  0,  0,  0,  0,  0,102,  3,
+/* 0x2640 */   0,  0, 95,  0,  0,  0,  0,  0,  0,  0,111,  3,  0,  0, 96,  0,
+/* 0x2650 */   0,  0,  0,  0,  0,  0,129,  3,  0,  0, 98,  0,  0,  0,  0,  0,
+/* 0x2660 */   0,  0,138,  3,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,147,  3,
+/* 0x2670 */   0,  0,100,  0,  0,  0,  0,  0,  0,  0,156,  3,  0,  0,101,  0,
+/* 0x2680 */   0,  0,  0,  0,  0,  0,165,  3,  0,  0,102,  0,  0,  0,  0,  0,
+/* 0x2690 */   0,  0,183,  3,  0,  0,104,  0,  0,  0,  0,  0,  0,  0,192,  3,
+/* 0x26a0 */   0,  0,105,  0,  0,  0,  0,  0,  0,  0,201,  3,  0,  0,107,  0,
+/* 0x26b0 */   0,  0,173,222,173,222,214,  3,  0,  0,107,  0,  0,  0,173,222,
+/* 0x26c0 */ 173,222,229,  3,  0,  0,107,  0,  0,  0,173,222,173,222,247,  3,
+/* 0x26d0 */   0,  0,107,  0,  0,  0,173,222,173,222, 17,  4,  0,  0,107,  0,
+/* 0x26e0 */   0,  0,173,222,173,222, 39,  4,  0,  0,107,  0,  0,  0,173,222,
+/* 0x26f0 */ 173,222, 50,  4,  0,  0,107,  0,  0,  0,173,222,173,222, 61,  4,
+/* 0x2700 */   0,  0,107,  0,  0,  0,173,222,173,222, 72,  4,  0,  0,107,  0,
+/* 0x2710 */   0,  0,173,222,173,222, 87,  4,  0,  0,107,  0,  0,  0,173,222,
+/* 0x2720 */ 173,222, 98,  4,  0,  0,107,  0,  0,  0,173,222,173,222,112,  4,
+/* 0x2730 */   0,  0,107,  0,  0,  0,173,222,173,222,128,  4,  0,  0,107,  0,
+/* 0x2740 */   0,  0,173,222,173,222,140,  4,  0,  0,107,  0,  0,  0,173,222,
+/* 0x2750 */ 173,222,150,  4,  0,  0,107,  0,  0,  0,173,222,173,222,164,  4,
+/* 0x2760 */   0,  0,107,  0,  0,  0,173,222,173,222,185,  4,  0,  0,107,  0,
+/* 0x2770 */   0,  0,173,222,173,222,198,  4,  0,  0,107,  0,  0,  0,173,222,
+/* 0x2780 */ 173,222,216,  4,  0,  0,107,  0,  0,  0,173,222,173,222,227,  4,
+/* 0x2790 */   0,  0,107,  0,  0,  0,173,222,173,222,238,  4,  0,  0,107,  0,
+/* 0x27a0 */   0,  0,173,222,173,222,  1,  0,  0,  0, 14,  0,  0,  0,254,  4,
+/* 0x27b0 */   0,  0,201,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+/* 0x27c0 */   0,  0,  1,  0,  0,  0,254,  4,  0,  0,214,  3,  0,  0,  0,  0,
+/* 0x27d0 */   0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  1,  0,  0,  0,254,  4,
+/* 0x27e0 */   0,  0,229,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,
+/* 0x27f0 */   0,  0,  6,  0,  0,  0,254,  4,  0,  0,247,  3,  0,  0,  0,  0,
+/* 0x2800 */   0,  0,  0,  0,  0,  0,  8,  0,  0,  0,  1,  0,  0,  0,254,  4,
+/* 0x2810 */   0,  0, 17,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x2820 */   0,  0,  5,  0,  0,  0,254,  4,  0,  0, 39,  4,  0,  0,  0,  0,
+/* 0x2830 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 14,  0,  0,  0,254,  4,
+/* 0x2840 */   0,  0, 50,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x2850 */   0,  0, 21,  0,  0,  0,254,  4,  0,  0, 61,  4,  0,  0,  0,  0,
+/* 0x2860 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 27,  0,  0,  0,254,  4,
+/* 0x2870 */   0,  0, 72,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,
+/* 0x2880 */   0,  0,  2,  0,  0,  0,  7,  5,  0,  0, 87,  4,  0,  0,  0,  0,
+/* 0x2890 */   0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  4,  0,  0,  0,254,  4,
+/* 0x28a0 */   0,  0, 98,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,
+/* 0x28b0 */   0,  0,  6,  0,  0,  0,254,  4,  0,  0, 17,  4,  0,  0,  0,  0,
+/* 0x28c0 */   0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 19,  0,  0,  0,254,  4,
+/* 0x28d0 */   0,  0,112,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,
+/* 0x28e0 */   0,  0,  2,  0,  0,  0,  7,  5,  0,  0, 87,  4,  0,  0,  0,  0,
+/* 0x28f0 */   0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  4,  0,  0,  0,254,  4,
+/* 0x2900 */   0,  0, 98,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,
+/* 0x2910 */   0,  0,  1,  0,  0,  0,254,  4,  0,  0,128,  4,  0,  0,  0,  0,
+/* 0x2920 */   0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  6,  0,  0,  0,254,  4,
+/* 0x2930 */   0,  0,140,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,
+/* 0x2940 */   0,  0, 11,  0,  0,  0,254,  4,  0,  0,150,  4,  0,  0,  0,  0,
+/* 0x2950 */   0,  0,  0,  0,  0,  0, 15,  0,  0,  0, 20,  0,  0,  0,254,  4,
+/* 0x2960 */   0,  0,164,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,
+/* 0x2970 */   0,  0, 26,  0,  0,  0, 15,  5,  0,  0,185,  4,  0,  0,  0,  0,
+/* 0x2980 */   0,  0,  0,  0,  0,  0, 16,  0,  0,  0, 10,  0,  0,  0,254,  4,
+/* 0x2990 */   0,  0,164,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,
+/* 0x29a0 */   0,  0,  1,  0,  0,  0, 26,  5,  0,  0,189,  0,  0,  0,  0,  0,
+/* 0x29b0 */   0,  0,  0,  0,  0,  0, 19,  0,  0,  0,  1,  0,  0,  0, 26,  5,
+/* 0x29c0 */   0,  0,189,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,
+/* 0x29d0 */   0,  0,  1,  0,  0,  0, 26,  5,  0,  0,162,  0,  0,  0,  0,  0,
+/* 0x29e0 */   0,  0,  0,  0,  0,  0, 23,  0,  0,  0,  3,  0,  0,  0, 26,  5,
+/* 0x29f0 */   0,  0,180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,
+/* 0x2a00 */   0,  0, 12,  0,  0,  0, 26,  5,  0,  0,216,  0,  0,  0,  0,  0,
+/* 0x2a10 */   0,  0,  0,  0,  0,  0, 26,  0,  0,  0,  3,  0,  0,  0, 26,  5,
+/* 0x2a20 */   0,  0,216,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,
+/* 0x2a30 */   0,  0, 14,  0,  0,  0, 26,  5,  0,  0,216,  0,  0,  0,  0,  0,
+/* 0x2a40 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0, 17,  0,  0,  0, 26,  5,
+/* 0x2a50 */   0,  0, 68,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,
+/* 0x2a60 */   0,  0, 47,  0,  0,  0, 26,  5,  0,  0, 32,  1,  0,  0,  0,  0,
+/* 0x2a70 */   0,  0,  0,  0,  0,  0, 28,  0,  0,  0, 12,  0,  0,  0, 26,  5,
+/* 0x2a80 */   0,  0,243,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,
+/* 0x2a90 */   0,  0,  3,  0,  0,  0, 26,  5,  0,  0,243,  0,  0,  0,  0,  0,
+/* 0x2aa0 */   0,  0,  0,  0,  0,  0, 29,  0,  0,  0, 14,  0,  0,  0, 26,  5,
+/* 0x2ab0 */   0,  0,243,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,
+/* 0x2ac0 */   0,  0,  8,  0,  0,  0, 15,  5,  0,  0,189,  0,  0,  0,  0,  0,
+/* 0x2ad0 */   0,  0,  0,  0,  0,  0, 34,  0,  0,  0, 10,  0,  0,  0, 26,  5,
+/* 0x2ae0 */   0,  0, 59,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,  0,
+/* 0x2af0 */   0,  0, 21,  0,  0,  0, 15,  5,  0,  0,189,  0,  0,  0,  0,  0,
+/* 0x2b00 */   0,  0,  0,  0,  0,  0, 35,  0,  0,  0, 18,  0,  0,  0, 15,  5,
+/* 0x2b10 */   0,  0,189,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  0,
+/* 0x2b20 */   0,  0,  1,  0,  0,  0, 26,  5,  0,  0,104,  1,  0,  0,  0,  0,
+/* 0x2b30 */   0,  0,  0,  0,  0,  0, 38,  0,  0,  0,  1,  0,  0,  0, 26,  5,
+/* 0x2b40 */   0,  0,104,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,
+/* 0x2b50 */   0,  0,  1,  0,  0,  0, 26,  5,  0,  0, 77,  1,  0,  0,  0,  0,
+/* 0x2b60 */   0,  0,  0,  0,  0,  0, 42,  0,  0,  0,  3,  0,  0,  0, 26,  5,
+/* 0x2b70 */   0,  0, 95,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0,
+/* 0x2b80 */   0,  0, 12,  0,  0,  0, 26,  5,  0,  0,158,  1,  0,  0,  0,  0,
+/* 0x2b90 */   0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  5,  0,  0,  0, 26,  5,
+/* 0x2ba0 */   0,  0,158,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,
+/* 0x2bb0 */   0,  0, 14,  0,  0,  0, 26,  5,  0,  0,158,  1,  0,  0,  0,  0,
+/* 0x2bc0 */   0,  0,  0,  0,  0,  0, 46,  0,  0,  0, 15,  0,  0,  0, 26,  5,
+/* 0x2bd0 */   0,  0,131,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,
+/* 0x2be0 */   0,  0, 33,  0,  0,  0, 26,  5,  0,  0,239,  1,  0,  0,  0,  0,
+/* 0x2bf0 */   0,  0,  0,  0,  0,  0, 46,  0,  0,  0, 67,  0,  0,  0, 26,  5,
+/* 0x2c00 */   0,  0,203,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,
+/* 0x2c10 */   0,  0, 12,  0,  0,  0, 26,  5,  0,  0,158,  1,  0,  0,  0,  0,
+/* 0x2c20 */   0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  3,  0,  0,  0, 26,  5,
+/* 0x2c30 */   0,  0,158,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  0,
+/* 0x2c40 */   0,  0, 14,  0,  0,  0, 26,  5,  0,  0,158,  1,  0,  0,  0,  0,
+/* 0x2c50 */   0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  8,  0,  0,  0, 15,  5,
+/* 0x2c60 */   0,  0,104,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,
+/* 0x2c70 */   0,  0, 10,  0,  0,  0, 26,  5,  0,  0,230,  1,  0,  0,  0,  0,
+/* 0x2c80 */   0,  0,  0,  0,  0,  0, 53,  0,  0,  0, 21,  0,  0,  0, 15,  5,
+/* 0x2c90 */   0,  0,104,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,
+/* 0x2ca0 */   0,  0, 18,  0,  0,  0, 15,  5,  0,  0,104,  1,  0,  0,  0,  0,
+/* 0x2cb0 */   0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  1,  0,  0,  0, 26,  5,
+/* 0x2cc0 */   0,  0, 19,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,
+/* 0x2cd0 */   0,  0,  1,  0,  0,  0, 26,  5,  0,  0, 19,  2,  0,  0,  0,  0,
+/* 0x2ce0 */   0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  1,  0,  0,  0, 26,  5,
+/* 0x2cf0 */   0,  0,248,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  0,
+/* 0x2d00 */   0,  0,  3,  0,  0,  0, 26,  5,  0,  0, 10,  2,  0,  0,  0,  0,
+/* 0x2d10 */   0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 12,  0,  0,  0, 26,  5,
+/* 0x2d20 */   0,  0, 73,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,
+/* 0x2d30 */   0,  0,  5,  0,  0,  0, 26,  5,  0,  0, 73,  2,  0,  0,  0,  0,
+/* 0x2d40 */   0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 14,  0,  0,  0, 26,  5,
+/* 0x2d50 */   0,  0, 73,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  0,
+/* 0x2d60 */   0,  0, 15,  0,  0,  0, 26,  5,  0,  0, 46,  2,  0,  0,  0,  0,
+/* 0x2d70 */   0,  0,  0,  0,  0,  0, 65,  0,  0,  0, 30,  0,  0,  0, 26,  5,
+/* 0x2d80 */   0,  0,118,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  0,
+/* 0x2d90 */   0,  0, 48,  0,  0,  0, 26,  5,  0,  0,154,  2,  0,  0,  0,  0,
+/* 0x2da0 */   0,  0,  0,  0,  0,  0, 66,  0,  0,  0, 12,  0,  0,  0, 26,  5,
+/* 0x2db0 */   0,  0, 73,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  0,
+/* 0x2dc0 */   0,  0,  3,  0,  0,  0, 26,  5,  0,  0, 73,  2,  0,  0,  0,  0,
+/* 0x2dd0 */   0,  0,  0,  0,  0,  0, 67,  0,  0,  0, 14,  0,  0,  0, 26,  5,
+/* 0x2de0 */   0,  0, 73,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 71,  0,
+/* 0x2df0 */   0,  0,  8,  0,  0,  0, 15,  5,  0,  0, 19,  2,  0,  0,  0,  0,
+/* 0x2e00 */   0,  0,  0,  0,  0,  0, 72,  0,  0,  0, 10,  0,  0,  0, 26,  5,
+/* 0x2e10 */   0,  0,145,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,
+/* 0x2e20 */   0,  0, 21,  0,  0,  0, 15,  5,  0,  0, 19,  2,  0,  0,  0,  0,
+/* 0x2e30 */   0,  0,  0,  0,  0,  0, 73,  0,  0,  0, 18,  0,  0,  0, 15,  5,
+/* 0x2e40 */   0,  0, 19,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 75,  0,
+/* 0x2e50 */   0,  0,  5,  0,  0,  0,254,  4,  0,  0,198,  4,  0,  0,  0,  0,
+/* 0x2e60 */   0,  0,  0,  0,  0,  0, 75,  0,  0,  0, 20,  0,  0,  0,254,  4,
+/* 0x2e70 */   0,  0,216,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 75,  0,
+/* 0x2e80 */   0,  0, 30,  0,  0,  0,254,  4,  0,  0,227,  4,  0,  0,  0,  0,
+/* 0x2e90 */   0,  0,  0,  0,  0,  0, 75,  0,  0,  0, 42,  0,  0,  0,254,  4,
+/* 0x2ea0 */   0,  0,238,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,
+/* 0x2eb0 */   0,  0,  3,  0,  0,  0, 26,  5,  0,  0,247,  2,  0,  0,  0,  0,
+/* 0x2ec0 */   0,  0,  0,  0,  0,  0, 82,  0,  0,  0, 13,  0,  0,  0, 26,  5,
+/* 0x2ed0 */   0,  0,247,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,  0,
+/* 0x2ee0 */   0,  0,  5,  0,  0,  0, 26,  5,  0,  0, 11,  3,  0,  0,  0,  0,
+/* 0x2ef0 */   0,  0,  0,  0,  0,  0, 83,  0,  0,  0, 10,  0,  0,  0, 26,  5,
+/* 0x2f00 */   0,  0, 11,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,  0,
+/* 0x2f10 */   0,  0, 16,  0,  0,  0, 26,  5,  0,  0, 11,  3,  0,  0,  0,  0,
+/* 0x2f20 */   0,  0,  0,  0,  0,  0, 84,  0,  0,  0,  4,  0,  0,  0, 26,  5,
+/* 0x2f30 */   0,  0, 11,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 84,  0,
+/* 0x2f40 */   0,  0,  9,  0,  0,  0, 26,  5,  0,  0,237,  2,  0,  0,  0,  0,
+/* 0x2f50 */   0,  0,  0,  0,  0,  0, 85,  0,  0,  0,  4,  0,  0,  0, 26,  5,
+/* 0x2f60 */   0,  0,227,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 87,  0,
+/* 0x2f70 */   0,  0,  1,  0,  0,  0,254,  4,  0,  0, 98,  4,  0,  0,  0,  0,
+/* 0x2f80 */   0,  0,  0,  0,  0,  0, 88,  0,  0,  0,  2,  0,  0,  0,  7,  5,
+/* 0x2f90 */   0,  0, 87,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,  0,
+/* 0x2fa0 */   0,  0,  4,  0,  0,  0, 26,  5,  0,  0, 30,  3,  0,  0,  0,  0,
+/* 0x2fb0 */   0,  0,  0,  0,  0,  0, 93,  0,  0,  0, 13,  0,  0,  0, 26,  5,
+/* 0x2fc0 */   0,  0, 30,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 94,  0,
+/* 0x2fd0 */   0,  0,  1,  0,  0,  0,254,  4,  0,  0, 98,  4,  0,  0,  0,  0,
+/* 0x2fe0 */   0,  0,  0,  0,  0,  0, 97,  0,  0,  0,  3,  0,  0,  0, 26,  5,
+/* 0x2ff0 */   0,  0,174,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,  0,
+/* 0x3000 */   0,  0,  2,  0,  0,  0,  7,  5,  0,  0, 87,  4,  0,  0,  0,  0,
+/* 0x3010 */   0,  0,  0,  0,  0,  0, 98,  0,  0,  0,  4,  0,  0,  0, 26,  5,
+/* 0x3020 */   0,  0,120,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,103,  0,
+/* 0x3030 */   0,  0,  4,  0,  0,  0, 26,  5,  0,  0, 93,  3,  0,  0,  0,  0,
+/* 0x3040 */   0,  0,  0,  0,  0,  0, 76, 73, 78, 85, 90, 86, 71, 65,  0, 76,
+/* 0x3050 */  73, 78, 85, 90, 48, 48, 48,  0, 76, 73, 78, 85, 90, 48, 48, 49,
+/* 0x3060 */   0, 76, 73, 78, 85, 90, 48, 48, 53,  0, 76, 73, 78, 85, 90, 48,
+/* 0x3070 */  49, 48,  0, 76, 73, 78, 85, 90, 49, 48, 49,  0, 76, 73, 78, 85,
+/* 0x3080 */  90, 49, 49, 48,  0, 76, 73, 78, 85, 90, 49, 50, 48,  0, 76, 73,
+/* 0x3090 */  78, 85, 90, 49, 51, 48,  0, 76, 73, 78, 85, 90, 49, 52, 48,  0,
+/* 0x30a0 */  76, 73, 78, 85, 90, 49, 52, 49,  0, 76, 73, 78, 85, 90, 49, 52,
+/* 0x30b0 */  53,  0, 76, 73, 78, 85, 90, 49, 53, 48,  0, 76, 90, 67, 65, 76,
+/* 0x30c0 */  76, 84, 49,  0, 76, 90, 67, 75, 76, 76, 84, 49,  0, 76, 66, 90,
+/* 0x30d0 */  73, 77, 65, 71, 69,  0, 76, 90, 73, 77, 65, 71, 69, 48,  0, 76,
+/* 0x30e0 */  90, 67, 85, 84, 80, 79, 73,  0, 78, 50, 66, 83, 77, 65, 49, 48,
+/* 0x30f0 */   0, 78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65, 83,
+/* 0x3100 */  49, 49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66, 83,
+/* 0x3110 */  77, 65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78, 50,
+/* 0x3120 */  66, 68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,  0,
+/* 0x3130 */  78, 50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67, 51,
+/* 0x3140 */  48,  0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70, 65,
+/* 0x3150 */  83, 52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50, 66,
+/* 0x3160 */  70, 65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0, 78,
+/* 0x3170 */  50, 66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 48,
+/* 0x3180 */   0, 78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69, 67,
+/* 0x3190 */  54, 48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68, 70,
+/* 0x31a0 */  65, 83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78, 50,
+/* 0x31b0 */  68, 68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,  0,
+/* 0x31c0 */  78, 50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67, 50,
+/* 0x31d0 */  48,  0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70, 65,
+/* 0x31e0 */  83, 51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50, 68,
+/* 0x31f0 */  83, 77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0, 78,
+/* 0x3200 */  50, 68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53, 48,
+/* 0x3210 */   0, 78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77, 65,
+/* 0x3220 */  54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68, 70,
+/* 0x3230 */  65, 83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78, 50,
+/* 0x3240 */  69, 83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,  0,
+/* 0x3250 */  78, 50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67, 49,
+/* 0x3260 */  48,  0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70, 65,
+/* 0x3270 */  83, 50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50, 69,
+/* 0x3280 */  83, 77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0, 78,
+/* 0x3290 */  50, 69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52, 48,
+/* 0x32a0 */   0, 78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77, 65,
+/* 0x32b0 */  53, 48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69, 68,
+/* 0x32c0 */  69, 67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78, 50,
+/* 0x32d0 */  69, 70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,  0,
+/* 0x32e0 */  78, 50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x32f0 */  67, 48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76,
+/* 0x3300 */  90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x3310 */  69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0,
+/* 0x3320 */  76, 90, 67, 75, 76, 76, 84, 57,  0, 99,116,111,107, 51, 50, 46,
+/* 0x3330 */  48, 48,  0, 99,116,111,107, 51, 50, 46, 49, 48,  0, 99,116,111,
+/* 0x3340 */ 107, 51, 50, 46, 50, 48,  0, 99,116,111,107, 51, 50, 46, 51, 48,
+/* 0x3350 */   0, 99,116,111,107, 51, 50, 46, 52, 48,  0, 76, 90, 67, 65, 76,
+/* 0x3360 */  76, 84, 57,  0, 67, 65, 76, 76, 84, 82, 48, 48,  0, 67, 84, 67,
+/* 0x3370 */  76, 69, 86, 69, 49,  0, 67, 65, 76, 76, 84, 82, 48, 49,  0, 67,
+/* 0x3380 */  84, 66, 83, 72, 82, 48, 49,  0, 67, 84, 66, 82, 79, 82, 48, 49,
+/* 0x3390 */   0, 67, 84, 66, 83, 87, 65, 48, 49,  0, 67, 65, 76, 76, 84, 82,
+/* 0x33a0 */  48, 50,  0, 67, 65, 76, 76, 84, 82, 49, 48,  0, 67, 65, 76, 76,
+/* 0x33b0 */  84, 82, 69, 56,  0, 67, 65, 76, 76, 84, 82, 69, 57,  0, 67, 65,
+/* 0x33c0 */  76, 76, 84, 82, 49, 49,  0, 67, 84, 67, 76, 69, 86, 69, 50,  0,
+/* 0x33d0 */  67, 65, 76, 76, 84, 82, 49, 50,  0, 67, 84, 66, 83, 72, 82, 49,
+/* 0x33e0 */  49,  0, 67, 84, 66, 82, 79, 82, 49, 49,  0, 67, 84, 66, 83, 87,
+/* 0x33f0 */  65, 49, 49,  0, 67, 65, 76, 76, 84, 82, 49, 51,  0, 76, 73, 78,
+/* 0x3400 */  85, 90, 57, 57, 48,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0,115,
+/* 0x3410 */ 116, 97, 99,107, 95,111,102,102,115,101,116,  0,111,114,105,103,
+/* 0x3420 */ 105,110, 97,108, 95,101,110,116,114,121,  0, 99,111,109,112,114,
+/* 0x3430 */ 101,115,115,101,100, 95,108,101,110,103,116,104,  0,110,101,103,
+/* 0x3440 */  95, 99,111,110,102,105,103, 95,112,104,121,115,105, 99, 97,108,
+/* 0x3450 */  95, 97,108,105,103,110,  0,108,111, 97,100, 95,112,104,121,115,
+/* 0x3460 */ 105, 99, 97,108, 95, 97,100,100,114,101,115,115,  0,117,110, 99,
+/* 0x3470 */  95,108,101,110,103,116,104,  0,100,101, 99, 95,111,102,102,115,
+/* 0x3480 */ 101,116,  0,117,110, 99, 95,111,102,102,115,101,116,  0,110,101,
+/* 0x3490 */ 103, 95,108,101,110,103,116,104, 95,109,111,118,  0,102,105,108,
+/* 0x34a0 */ 116,101,114, 95, 99,116,111,  0,102,105,108,116,101,114, 95,108,
+/* 0x34b0 */ 101,110,103,116,104,  0,110,101,103, 95,112, 97,103,101, 95,111,
+/* 0x34c0 */ 102,102,115,101,116,  0, 99,111,112,121, 95,115,111,117,114, 99,
+/* 0x34d0 */ 101,  0, 99,111,112,121, 95,100,101,115,116,  0,119,111,114,100,
+/* 0x34e0 */ 115, 95,116,111, 95, 99,111,112,121,  0,115,114, 99, 95,102,111,
+/* 0x34f0 */ 114, 95,100,101, 99,111,109,112,114,101,115,115,111,114,  0,100,
+/* 0x3500 */ 101, 99,111,109,112,114,101,115,115,111,114,  0,108,122,109, 97,
+/* 0x3510 */  95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,  0,108,122,
+/* 0x3520 */ 109, 97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,
+/* 0x3530 */ 108,101,110,  0,108,122,109, 97, 95,112,114,111,112,101,114,116,
+/* 0x3540 */ 105,101,115,  0, 82, 95, 51, 56, 54, 95, 51, 50,  0, 82, 95, 51,
+/* 0x3550 */  56, 54, 95, 56,  0, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0,
+/* 0x3560 */  82, 95, 51, 56, 54, 95, 80, 67, 56,  0,  2, 27,  0,  0, 85, 80,
+/* 0x3570 */  88, 76, 78, 75, 48, 49
 };
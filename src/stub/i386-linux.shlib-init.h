@@ -1,5 +1,5 @@
 /* i386-linux.shlib-init.h
-   created from i386-linux.shlib-init.bin, 30801 (0x7851) bytes
+   created from i386-linux.shlib-init.bin, 16038 (0x3ea6) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_LINUX_SHLIB_INIT_SIZE    30801
-#define STUB_I386_LINUX_SHLIB_INIT_ADLER32 0xd04e44b0
-#define STUB_I386_LINUX_SHLIB_INIT_CRC32   0x1a3e86d7
+#define STUB_I386_LINUX_SHLIB_INIT_SIZE    16038
+#define STUB_I386_LINUX_SHLIB_INIT_ADLER32 0xa56819c2
+#define STUB_I386_LINUX_SHLIB_INIT_CRC32   0x9c290ce1
 
-unsigned char stub_i386_linux_shlib_init[30801] = {
+unsigned char stub_i386_linux_shlib_init[16038] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  88, 35,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -484,1482 +484,559 @@ unsigned char stub_i386_linux_shlib_init[30801] = {
 /* 0x1bd0 */ 137,203,137, 69,244,137, 85,248,151,150,139,117,236,131,193,  3,
 /* 0x1be0 */ 193,233,  2,243,165, 94, 89, 81, 87,131,193,  3,193,233,  2,243,
 /* 0x1bf0 */ 165,139,117,216,137,125,216,139, 78,252,243,164,150, 87,139, 78,
-/* 0x1c00 */ 252,243,164,195,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1c10 */ 101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,
-/* 0x1c20 */ 105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32,
-/* 0x1c30 */  32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32,
-/* 0x1c40 */  32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32,
-/* 0x1c50 */  32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32,
-/* 0x1c60 */  65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32,
-/* 0x1c70 */  76, 69, 88, 69, 67, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 57,
-/* 0x1c80 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42,
-/* 0x1c90 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32,
-/* 0x1ca0 */  76, 69, 88, 69, 67, 48, 48, 57, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x1cb0 */  32, 48, 32, 32, 48, 32, 32, 48, 51,100, 32, 32, 50, 42, 42, 48,
-/* 0x1cc0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 76,
-/* 0x1cd0 */  69, 88, 69, 67, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 99, 32,
-/* 0x1ce0 */  32, 48, 32, 32, 48, 32, 32, 48, 51,100, 32, 32, 50, 42, 42, 48,
-/* 0x1cf0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78,
-/* 0x1d00 */  50, 66, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32,
-/* 0x1d10 */  32, 48, 32, 32, 48, 32, 32, 48, 52, 57, 32, 32, 50, 42, 42, 48,
-/* 0x1d20 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78,
-/* 0x1d30 */  50, 66, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32,
-/* 0x1d40 */  32, 48, 32, 32, 48, 32, 32, 48, 52, 99, 32, 32, 50, 42, 42, 48,
-/* 0x1d50 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 78,
-/* 0x1d60 */  50, 66, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32,
-/* 0x1d70 */  32, 48, 32, 32, 48, 32, 32, 48, 52,101, 32, 32, 50, 42, 42, 48,
-/* 0x1d80 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 78,
-/* 0x1d90 */  50, 66, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32,
-/* 0x1da0 */  32, 48, 32, 32, 48, 32, 32, 48, 53, 52, 32, 32, 50, 42, 42, 48,
-/* 0x1db0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 78,
-/* 0x1dc0 */  50, 66, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x1dd0 */  32, 48, 32, 32, 48, 32, 32, 48, 53,102, 32, 32, 50, 42, 42, 48,
-/* 0x1de0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 78,
-/* 0x1df0 */  50, 66, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32,
-/* 0x1e00 */  32, 48, 32, 32, 48, 32, 32, 48, 54, 52, 32, 32, 50, 42, 42, 48,
-/* 0x1e10 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 78,
-/* 0x1e20 */  50, 66, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32,
-/* 0x1e30 */  32, 48, 32, 32, 48, 32, 32, 48, 54,100, 32, 32, 50, 42, 42, 48,
-/* 0x1e40 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 78,
-/* 0x1e50 */  50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32,
-/* 0x1e60 */  32, 48, 32, 32, 48, 32, 32, 48, 55, 97, 32, 32, 50, 42, 42, 48,
-/* 0x1e70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 78,
-/* 0x1e80 */  50, 66, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32,
-/* 0x1e90 */  32, 48, 32, 32, 48, 32, 32, 48, 56, 55, 32, 32, 50, 42, 42, 48,
-/* 0x1ea0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 78,
-/* 0x1eb0 */  50, 66, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 51,101,
-/* 0x1ec0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 54, 32, 32, 50, 42, 42,
-/* 0x1ed0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32,
-/* 0x1ee0 */  78, 50, 66, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100,
-/* 0x1ef0 */  32, 32, 48, 32, 32, 48, 32, 32, 48,100, 52, 32, 32, 50, 42, 42,
-/* 0x1f00 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 52, 32,
-/* 0x1f10 */  78, 50, 66, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102,
-/* 0x1f20 */  32, 32, 48, 32, 32, 48, 32, 32, 48,101, 49, 32, 32, 50, 42, 42,
-/* 0x1f30 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 53, 32,
-/* 0x1f40 */  78, 50, 66, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x1f50 */  32, 32, 48, 32, 32, 48, 32, 32, 48,102, 48, 32, 32, 50, 42, 42,
-/* 0x1f60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 54, 32,
-/* 0x1f70 */  78, 50, 66, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x1f80 */  32, 32, 48, 32, 32, 48, 32, 32, 48,102, 50, 32, 32, 50, 42, 42,
-/* 0x1f90 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 55, 32,
-/* 0x1fa0 */  78, 50, 66, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57,
-/* 0x1fb0 */  32, 32, 48, 32, 32, 48, 32, 32, 48,102, 53, 32, 32, 50, 42, 42,
-/* 0x1fc0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 56, 32,
-/* 0x1fd0 */  78, 50, 66, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48, 99,
-/* 0x1fe0 */  32, 32, 48, 32, 32, 48, 32, 32, 48,102,101, 32, 32, 50, 42, 42,
-/* 0x1ff0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 57, 32,
-/* 0x2000 */  78, 50, 66, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x2010 */  57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 48, 97, 32, 32, 50,
-/* 0x2020 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x2030 */  48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32,
-/* 0x2040 */  48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 51, 32,
-/* 0x2050 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2060 */  32, 50, 49, 32, 78, 50, 66, 68, 69, 67, 54, 48, 32, 32, 32, 32,
-/* 0x2070 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 57, 32,
-/* 0x2080 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2090 */  32, 50, 50, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 32, 32, 32,
-/* 0x20a0 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51, 57,
-/* 0x20b0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x20c0 */  10, 32, 50, 51, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 32, 32,
-/* 0x20d0 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 51,
-/* 0x20e0 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x20f0 */  83, 10, 32, 50, 52, 32, 78, 50, 68, 70, 65, 83, 49, 49, 32, 32,
-/* 0x2100 */  32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2110 */  51,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2120 */  84, 83, 10, 32, 50, 53, 32, 78, 50, 68, 68, 69, 67, 49, 48, 32,
-/* 0x2130 */  32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2140 */  49, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2150 */  78, 84, 83, 10, 32, 50, 54, 32, 78, 50, 68, 83, 77, 65, 50, 48,
-/* 0x2160 */  32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2170 */  48, 49, 52,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2180 */  69, 78, 84, 83, 10, 32, 50, 55, 32, 78, 50, 68, 70, 65, 83, 50,
-/* 0x2190 */  48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32,
-/* 0x21a0 */  32, 48, 49, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x21b0 */  84, 69, 78, 84, 83, 10, 32, 50, 56, 32, 78, 50, 68, 68, 69, 67,
-/* 0x21c0 */  50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48,
-/* 0x21d0 */  32, 32, 48, 49, 53,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x21e0 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 57, 32, 78, 50, 68, 83, 77,
-/* 0x21f0 */  65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32,
-/* 0x2200 */  48, 32, 32, 48, 49, 54, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2210 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 48, 32, 78, 50, 68, 70,
-/* 0x2220 */  65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32,
-/* 0x2230 */  32, 48, 32, 32, 48, 49, 55, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2240 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 49, 32, 78, 50, 68,
-/* 0x2250 */  68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 53, 50, 32, 32,
-/* 0x2260 */  48, 32, 32, 48, 32, 32, 48, 49, 56, 54, 32, 32, 50, 42, 42, 48,
-/* 0x2270 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 50, 32, 78,
-/* 0x2280 */  50, 68, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32,
-/* 0x2290 */  32, 48, 32, 32, 48, 32, 32, 48, 49,100, 56, 32, 32, 50, 42, 42,
-/* 0x22a0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 51, 32,
-/* 0x22b0 */  78, 50, 68, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102,
-/* 0x22c0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49,101, 53, 32, 32, 50, 42,
-/* 0x22d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 52,
-/* 0x22e0 */  32, 78, 50, 68, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x22f0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102, 52, 32, 32, 50,
-/* 0x2300 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51,
-/* 0x2310 */  53, 32, 78, 50, 68, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2320 */  48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102, 54, 32, 32,
-/* 0x2330 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2340 */  51, 54, 32, 78, 50, 68, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32,
-/* 0x2350 */  32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,102, 57, 32,
-/* 0x2360 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2370 */  32, 51, 55, 32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 32, 32, 32,
-/* 0x2380 */  32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 48, 50,
-/* 0x2390 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x23a0 */  10, 32, 51, 56, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32, 32, 32,
-/* 0x23b0 */  32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x23c0 */  48,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x23d0 */  84, 83, 10, 32, 51, 57, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32,
-/* 0x23e0 */  32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x23f0 */  48, 50, 50, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2400 */  69, 78, 84, 83, 10, 32, 52, 48, 32, 78, 50, 68, 68, 69, 67, 54,
-/* 0x2410 */  48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2420 */  48, 50, 51,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2430 */  69, 78, 84, 83, 10, 32, 52, 49, 32, 78, 50, 69, 83, 77, 65, 49,
-/* 0x2440 */  48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2450 */  32, 48, 50, 51,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2460 */  84, 69, 78, 84, 83, 10, 32, 52, 50, 32, 78, 50, 69, 70, 65, 83,
-/* 0x2470 */  49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x2480 */  32, 32, 48, 50, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2490 */  78, 84, 69, 78, 84, 83, 10, 32, 52, 51, 32, 78, 50, 69, 70, 65,
-/* 0x24a0 */  83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32,
-/* 0x24b0 */  48, 32, 32, 48, 50, 52, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x24c0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 52, 32, 78, 50, 69, 68,
-/* 0x24d0 */  69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32, 48, 32,
-/* 0x24e0 */  32, 48, 32, 32, 48, 50, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x24f0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 53, 32, 78, 50, 69,
-/* 0x2500 */  83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2510 */  32, 32, 48, 32, 32, 48, 50, 53, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2520 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 54, 32, 78, 50,
-/* 0x2530 */  69, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32,
-/* 0x2540 */  48, 32, 32, 48, 32, 32, 48, 50, 53, 56, 32, 32, 50, 42, 42, 48,
-/* 0x2550 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 55, 32, 78,
-/* 0x2560 */  50, 69, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100, 32,
-/* 0x2570 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 54, 49, 32, 32, 50, 42, 42,
-/* 0x2580 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 56, 32,
-/* 0x2590 */  78, 50, 69, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100,
-/* 0x25a0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 54,101, 32, 32, 50, 42,
-/* 0x25b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 57,
-/* 0x25c0 */  32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x25d0 */ 102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 98, 32, 32, 50,
-/* 0x25e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x25f0 */  48, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2600 */  48, 53,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 97, 32,
-/* 0x2610 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2620 */  32, 53, 49, 32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 32, 32, 32,
-/* 0x2630 */  32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,101, 57,
-/* 0x2640 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2650 */  10, 32, 53, 50, 32, 78, 50, 69, 70, 65, 83, 52, 48, 32, 32, 32,
-/* 0x2660 */  32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,102,
-/* 0x2670 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2680 */  83, 10, 32, 53, 51, 32, 78, 50, 69, 83, 77, 65, 53, 48, 32, 32,
-/* 0x2690 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x26a0 */  48, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x26b0 */  84, 83, 10, 32, 53, 52, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32,
-/* 0x26c0 */  32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x26d0 */  51, 48, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x26e0 */  78, 84, 83, 10, 32, 53, 53, 32, 78, 50, 69, 68, 69, 67, 53, 48,
-/* 0x26f0 */  32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2700 */  48, 51, 48, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2710 */  69, 78, 84, 83, 10, 32, 53, 54, 32, 78, 50, 69, 83, 77, 65, 54,
-/* 0x2720 */  48, 32, 32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2730 */  32, 48, 51, 49, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2740 */  84, 69, 78, 84, 83, 10, 32, 53, 55, 32, 78, 50, 69, 70, 65, 83,
-/* 0x2750 */  54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 57, 32, 32, 48, 32, 32,
-/* 0x2760 */  48, 32, 32, 48, 51, 49,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2770 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 56, 32, 78, 50, 69, 70,
-/* 0x2780 */  65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48,
-/* 0x2790 */  32, 32, 48, 32, 32, 48, 51, 51, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x27a0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 57, 32, 78, 50,
-/* 0x27b0 */  69, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48,
-/* 0x27c0 */  32, 32, 48, 32, 32, 48, 51, 52,101, 32, 32, 50, 42, 42, 48, 32,
-/* 0x27d0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 48, 32, 76, 90,
-/* 0x27e0 */  77, 65, 95, 68, 69, 67, 48, 48, 32, 32, 32, 32, 48, 50,101, 32,
-/* 0x27f0 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 52,101, 32, 32, 50, 42, 42,
-/* 0x2800 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 49, 32,
-/* 0x2810 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 52,
-/* 0x2820 */  56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 55, 99, 32, 32, 50,
-/* 0x2830 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54,
-/* 0x2840 */  50, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32,
-/* 0x2850 */  48, 97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 99, 52,
-/* 0x2860 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2870 */  10, 32, 54, 51, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x2880 */  32, 32, 32, 48, 97, 56, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2890 */ 101, 52, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x28a0 */  78, 84, 83, 10, 32, 54, 52, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x28b0 */  51, 48, 32, 32, 32, 32, 48, 49, 97, 32, 32, 48, 32, 32, 48, 32,
-/* 0x28c0 */  32, 48, 49, 56,100, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x28d0 */  78, 84, 69, 78, 84, 83, 10, 32, 54, 53, 32, 67, 65, 76, 76, 84,
-/* 0x28e0 */  82, 48, 48, 32, 32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32,
-/* 0x28f0 */  48, 32, 32, 48, 49, 56,101, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2900 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 54, 32, 67, 84, 67,
-/* 0x2910 */  76, 69, 86, 69, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48,
-/* 0x2920 */  32, 32, 48, 32, 32, 48, 49, 56,102, 56, 32, 32, 50, 42, 42, 48,
-/* 0x2930 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 55, 32, 67,
-/* 0x2940 */  65, 76, 76, 84, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x2950 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 56,102,100, 32, 32, 50, 42,
-/* 0x2960 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 56,
-/* 0x2970 */  32, 67, 84, 66, 83, 72, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2980 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 48, 50, 32, 32,
-/* 0x2990 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x29a0 */  54, 57, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 32, 32, 32, 32,
-/* 0x29b0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 48, 54,
-/* 0x29c0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x29d0 */  10, 32, 55, 48, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 32, 32,
-/* 0x29e0 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x29f0 */  48, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2a00 */  84, 83, 10, 32, 55, 49, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32,
-/* 0x2a10 */  32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2a20 */  49, 57, 48,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2a30 */  69, 78, 84, 83, 10, 32, 55, 50, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x2a40 */  48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2a50 */  32, 48, 49, 57, 49, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2a60 */  78, 84, 69, 78, 84, 83, 10, 32, 55, 51, 32, 67, 65, 76, 76, 84,
-/* 0x2a70 */  82, 69, 56, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2a80 */  48, 32, 32, 48, 49, 57, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2a90 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 52, 32, 67, 65, 76,
-/* 0x2aa0 */  76, 84, 82, 69, 57, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2ab0 */  32, 32, 48, 32, 32, 48, 49, 57, 50, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2ac0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 53, 32, 67,
-/* 0x2ad0 */  65, 76, 76, 84, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32,
-/* 0x2ae0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50, 52, 32, 32, 50, 42,
-/* 0x2af0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 54,
-/* 0x2b00 */  32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2b10 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50, 56, 32, 32,
-/* 0x2b20 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2b30 */  55, 55, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 32, 32, 32, 32,
-/* 0x2b40 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 50,100,
-/* 0x2b50 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2b60 */  10, 32, 55, 56, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 32, 32,
-/* 0x2b70 */  32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2b80 */  50,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2b90 */  84, 83, 10, 32, 55, 57, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32,
-/* 0x2ba0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2bb0 */  49, 57, 51, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2bc0 */  69, 78, 84, 83, 10, 32, 56, 48, 32, 67, 84, 66, 83, 87, 65, 49,
-/* 0x2bd0 */  49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2be0 */  32, 48, 49, 57, 51, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2bf0 */  78, 84, 69, 78, 84, 83, 10, 32, 56, 49, 32, 67, 65, 76, 76, 84,
-/* 0x2c00 */  82, 49, 51, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x2c10 */  48, 32, 32, 48, 49, 57, 51, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2c20 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 50, 32, 76, 69, 88,
-/* 0x2c30 */  69, 67, 48, 49, 53, 32, 32, 32, 32, 32, 32, 48, 49,100, 32, 32,
-/* 0x2c40 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 51,102, 32, 32, 50, 42, 42,
-/* 0x2c50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 51, 32,
-/* 0x2c60 */  76, 88, 85, 78, 70, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x2c70 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 99, 32, 32, 50,
-/* 0x2c80 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56,
-/* 0x2c90 */  52, 32, 76, 88, 85, 78, 70, 48, 48, 50, 32, 32, 32, 32, 32, 32,
-/* 0x2ca0 */  48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53,101, 32,
-/* 0x2cb0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2cc0 */  32, 56, 53, 32, 77, 82, 85, 66, 89, 84, 69, 48, 32, 32, 32, 32,
-/* 0x2cd0 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54,
-/* 0x2ce0 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2cf0 */  83, 10, 32, 56, 54, 32, 76, 88, 77, 82, 85, 48, 48, 53, 32, 32,
-/* 0x2d00 */  32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2d10 */  57, 54, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2d20 */  78, 84, 83, 10, 32, 56, 55, 32, 76, 88, 77, 82, 85, 48, 48, 54,
-/* 0x2d30 */  32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2d40 */  48, 49, 57, 54, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2d50 */  84, 69, 78, 84, 83, 10, 32, 56, 56, 32, 76, 88, 77, 82, 85, 48,
-/* 0x2d60 */  48, 55, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48,
-/* 0x2d70 */  32, 32, 48, 49, 57, 55, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2d80 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 57, 32, 76, 88, 85, 78,
-/* 0x2d90 */  70, 48, 48, 56, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32,
-/* 0x2da0 */  32, 48, 32, 32, 48, 49, 57, 55, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2db0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 48, 32, 76, 88,
-/* 0x2dc0 */  85, 78, 70, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32,
-/* 0x2dd0 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 55, 99, 32, 32, 50, 42, 42,
-/* 0x2de0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 49, 32,
-/* 0x2df0 */  76, 88, 74, 67, 67, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x2e00 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 49, 32, 32, 50,
-/* 0x2e10 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57,
-/* 0x2e20 */  50, 32, 76, 88, 77, 82, 85, 48, 52, 53, 32, 32, 32, 32, 32, 32,
-/* 0x2e30 */  48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 52, 32,
-/* 0x2e40 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2e50 */  32, 57, 51, 32, 76, 88, 77, 82, 85, 48, 52, 54, 32, 32, 32, 32,
-/* 0x2e60 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56,
-/* 0x2e70 */  55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2e80 */  83, 10, 32, 57, 52, 32, 76, 88, 74, 67, 67, 48, 50, 48, 32, 32,
-/* 0x2e90 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2ea0 */  57, 56, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2eb0 */  78, 84, 83, 10, 32, 57, 53, 32, 76, 88, 74, 67, 67, 48, 50, 49,
-/* 0x2ec0 */  32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2ed0 */  48, 49, 57, 56, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2ee0 */  84, 69, 78, 84, 83, 10, 32, 57, 54, 32, 76, 88, 74, 67, 67, 48,
-/* 0x2ef0 */  50, 51, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48,
-/* 0x2f00 */  32, 32, 48, 49, 57, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2f10 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 55, 32, 76, 88, 85, 78,
-/* 0x2f20 */  70, 48, 51, 55, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x2f30 */  32, 48, 32, 32, 48, 49, 57, 57, 55, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2f40 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 56, 32, 76, 88,
-/* 0x2f50 */  85, 78, 70, 51, 56, 54, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32,
-/* 0x2f60 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 57, 57, 32, 32, 50, 42, 42,
-/* 0x2f70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 57, 32,
-/* 0x2f80 */  76, 88, 85, 78, 70, 51, 56, 55, 32, 32, 32, 32, 32, 32, 48, 57,
-/* 0x2f90 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 57, 97, 32, 32, 50,
-/* 0x2fa0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48,
-/* 0x2fb0 */  48, 32, 76, 88, 85, 78, 70, 51, 56, 56, 32, 32, 32, 32, 32, 32,
-/* 0x2fc0 */  48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97, 51, 32,
-/* 0x2fd0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2fe0 */  49, 48, 49, 32, 76, 88, 85, 78, 70, 52, 56, 54, 32, 32, 32, 32,
-/* 0x2ff0 */  32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 97,
-/* 0x3000 */  54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3010 */  83, 10, 49, 48, 50, 32, 76, 88, 85, 78, 70, 52, 56, 55, 32, 32,
-/* 0x3020 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3030 */  57, 97, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3040 */  78, 84, 83, 10, 49, 48, 51, 32, 76, 88, 77, 82, 85, 48, 54, 53,
-/* 0x3050 */  32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3060 */  48, 49, 57, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3070 */  84, 69, 78, 84, 83, 10, 49, 48, 52, 32, 77, 82, 85, 66, 89, 84,
-/* 0x3080 */  69, 51, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x3090 */  32, 32, 48, 49, 57, 98, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x30a0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 53, 32, 77, 82, 85, 65,
-/* 0x30b0 */  82, 66, 51, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32,
-/* 0x30c0 */  32, 48, 32, 32, 48, 49, 57, 98, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x30d0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 54, 32, 77, 82,
-/* 0x30e0 */  85, 66, 73, 84, 83, 51, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x30f0 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 52, 32, 32, 50, 42, 42,
-/* 0x3100 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 55, 32,
-/* 0x3110 */  77, 82, 85, 65, 82, 66, 52, 48, 32, 32, 32, 32, 32, 32, 48, 52,
-/* 0x3120 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 54, 32, 32, 50,
-/* 0x3130 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48,
-/* 0x3140 */  56, 32, 76, 88, 77, 82, 85, 48, 55, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3150 */  48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98, 97, 32,
-/* 0x3160 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3170 */  49, 48, 57, 32, 77, 82, 85, 66, 89, 84, 69, 52, 32, 32, 32, 32,
-/* 0x3180 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99,
-/* 0x3190 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x31a0 */  83, 10, 49, 49, 48, 32, 77, 82, 85, 66, 73, 84, 83, 52, 32, 32,
-/* 0x31b0 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x31c0 */  57, 99, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x31d0 */  78, 84, 83, 10, 49, 49, 49, 32, 77, 82, 85, 65, 82, 66, 53, 48,
-/* 0x31e0 */  32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x31f0 */  48, 49, 57, 99, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3200 */  84, 69, 78, 84, 83, 10, 49, 49, 50, 32, 76, 88, 77, 82, 85, 48,
-/* 0x3210 */  56, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48,
-/* 0x3220 */  32, 32, 48, 49, 57, 99,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3230 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 51, 32, 77, 82, 85, 66,
-/* 0x3240 */  89, 84, 69, 53, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x3250 */  32, 48, 32, 32, 48, 49, 57,100, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3260 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 52, 32, 77, 82,
-/* 0x3270 */  85, 65, 82, 66, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32,
-/* 0x3280 */  48, 32, 32, 48, 32, 32, 48, 49, 57,100, 50, 32, 32, 50, 42, 42,
-/* 0x3290 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 53, 32,
-/* 0x32a0 */  77, 82, 85, 66, 73, 84, 83, 53, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x32b0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100, 51, 32, 32, 50,
-/* 0x32c0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49,
-/* 0x32d0 */  54, 32, 77, 82, 85, 65, 82, 66, 55, 48, 32, 32, 32, 32, 32, 32,
-/* 0x32e0 */  48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100, 53, 32,
-/* 0x32f0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3300 */  49, 49, 55, 32, 76, 88, 77, 82, 85, 48, 57, 48, 32, 32, 32, 32,
-/* 0x3310 */  32, 32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,100,
-/* 0x3320 */  57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3330 */  83, 10, 49, 49, 56, 32, 77, 82, 85, 66, 89, 84, 69, 54, 32, 32,
-/* 0x3340 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3350 */  57,101, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3360 */  78, 84, 83, 10, 49, 49, 57, 32, 77, 82, 85, 65, 82, 66, 56, 48,
-/* 0x3370 */  32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3380 */  48, 49, 57,101, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3390 */  84, 69, 78, 84, 83, 10, 49, 50, 48, 32, 77, 82, 85, 66, 73, 84,
-/* 0x33a0 */  83, 54, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48,
-/* 0x33b0 */  32, 32, 48, 49, 57,101, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x33c0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 49, 32, 77, 82, 85, 65,
-/* 0x33d0 */  82, 66, 57, 48, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32,
-/* 0x33e0 */  32, 48, 32, 32, 48, 49, 57,101, 57, 32, 32, 50, 42, 42, 48, 32,
-/* 0x33f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 50, 32, 76, 88,
-/* 0x3400 */  77, 82, 85, 49, 48, 48, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32,
-/* 0x3410 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57,101,100, 32, 32, 50, 42,
-/* 0x3420 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 51,
-/* 0x3430 */  32, 76, 88, 85, 78, 70, 48, 52, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3440 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102,100, 32, 32,
-/* 0x3450 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3460 */  50, 52, 32, 76, 88, 77, 82, 85, 49, 49, 48, 32, 32, 32, 32, 32,
-/* 0x3470 */  32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 48, 50,
-/* 0x3480 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3490 */  10, 49, 50, 53, 32, 76, 88, 77, 82, 85, 49, 49, 49, 32, 32, 32,
-/* 0x34a0 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x34b0 */  48, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x34c0 */  84, 83, 10, 49, 50, 54, 32, 76, 88, 85, 78, 70, 48, 52, 49, 32,
-/* 0x34d0 */  32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x34e0 */  49, 97, 48, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x34f0 */  69, 78, 84, 83, 10, 49, 50, 55, 32, 76, 88, 85, 78, 70, 48, 52,
-/* 0x3500 */  50, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3510 */  48, 49, 97, 48,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3520 */  84, 69, 78, 84, 83, 10, 49, 50, 56, 32, 76, 69, 88, 69, 67, 48,
-/* 0x3530 */  49, 54, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48,
-/* 0x3540 */  32, 32, 48, 49, 97, 48,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3550 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 57, 32, 76, 88, 77, 82,
-/* 0x3560 */  85, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32,
-/* 0x3570 */  32, 48, 32, 32, 48, 49, 97, 49, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3580 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 48, 32, 76, 88,
-/* 0x3590 */  74, 77, 80, 65, 48, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x35a0 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 52, 32, 32, 50, 42, 42,
-/* 0x35b0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 49, 32,
-/* 0x35c0 */  76, 88, 67, 65, 76, 76, 66, 48, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x35d0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 54, 32, 32, 50,
-/* 0x35e0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51,
-/* 0x35f0 */  50, 32, 76, 88, 85, 78, 70, 48, 50, 49, 32, 32, 32, 32, 32, 32,
-/* 0x3600 */  48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49, 56, 32,
-/* 0x3610 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3620 */  49, 51, 51, 32, 76, 88, 77, 82, 85, 48, 50, 50, 32, 32, 32, 32,
-/* 0x3630 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49,
-/* 0x3640 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3650 */  83, 10, 49, 51, 52, 32, 76, 88, 74, 77, 80, 65, 48, 49, 32, 32,
-/* 0x3660 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3670 */  97, 50, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3680 */  78, 84, 83, 10, 49, 51, 53, 32, 76, 88, 67, 65, 76, 76, 66, 49,
-/* 0x3690 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x36a0 */  48, 49, 97, 50, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x36b0 */  84, 69, 78, 84, 83, 10, 49, 51, 54, 32, 77, 82, 85, 66, 73, 84,
-/* 0x36c0 */  83, 49, 32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48,
-/* 0x36d0 */  32, 32, 48, 49, 97, 50, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x36e0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 55, 32, 76, 88, 77, 82,
-/* 0x36f0 */  85, 48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x3700 */  32, 48, 32, 32, 48, 49, 97, 50, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3710 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 56, 32, 77, 82,
-/* 0x3720 */  85, 66, 89, 84, 69, 49, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x3730 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 50, 56, 32, 32, 50, 42, 42,
-/* 0x3740 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 51, 57, 32,
-/* 0x3750 */  77, 82, 85, 65, 82, 66, 49, 48, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x3760 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 50, 97, 32, 32, 50,
-/* 0x3770 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52,
-/* 0x3780 */  48, 32, 76, 88, 77, 82, 85, 48, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3790 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 50, 98, 32,
-/* 0x37a0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x37b0 */  49, 52, 49, 32, 76, 88, 85, 78, 70, 48, 51, 48, 32, 32, 32, 32,
-/* 0x37c0 */  32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 50,
-/* 0x37d0 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x37e0 */  83, 10, 49, 52, 50, 32, 76, 88, 74, 67, 67, 48, 48, 48, 32, 32,
-/* 0x37f0 */  32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3800 */  97, 51, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3810 */  78, 84, 83, 10, 49, 52, 51, 32, 76, 88, 67, 74, 48, 77, 82, 85,
-/* 0x3820 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3830 */  48, 49, 97, 51, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3840 */  84, 69, 78, 84, 83, 10, 49, 52, 52, 32, 76, 88, 67, 74, 49, 77,
-/* 0x3850 */  82, 85, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48,
-/* 0x3860 */  32, 32, 48, 49, 97, 51,100, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3870 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 53, 32, 76, 88, 67, 65,
-/* 0x3880 */  76, 74, 77, 80, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32,
-/* 0x3890 */  32, 48, 32, 32, 48, 49, 97, 52, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x38a0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 54, 32, 76, 88,
-/* 0x38b0 */  67, 65, 76, 76, 48, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x38c0 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 52, 51, 32, 32, 50, 42, 42,
-/* 0x38d0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52, 55, 32,
-/* 0x38e0 */  76, 88, 67, 65, 76, 76, 48, 49, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x38f0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 52, 53, 32, 32, 50,
-/* 0x3900 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 52,
-/* 0x3910 */  56, 32, 76, 88, 67, 74, 50, 77, 82, 85, 32, 32, 32, 32, 32, 32,
-/* 0x3920 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 52, 56, 32,
-/* 0x3930 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3940 */  49, 52, 57, 32, 76, 88, 67, 74, 52, 77, 82, 85, 32, 32, 32, 32,
-/* 0x3950 */  32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 52,
-/* 0x3960 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3970 */  83, 10, 49, 53, 48, 32, 76, 88, 67, 74, 54, 77, 82, 85, 32, 32,
-/* 0x3980 */  32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3990 */  97, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x39a0 */  78, 84, 83, 10, 49, 53, 49, 32, 76, 88, 67, 74, 55, 77, 82, 85,
-/* 0x39b0 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x39c0 */  48, 49, 97, 52,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x39d0 */  84, 69, 78, 84, 83, 10, 49, 53, 50, 32, 76, 88, 67, 74, 56, 77,
-/* 0x39e0 */  82, 85, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48,
-/* 0x39f0 */  32, 32, 48, 49, 97, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3a00 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 51, 32, 76, 88, 85, 78,
-/* 0x3a10 */  70, 48, 51, 52, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x3a20 */  32, 48, 32, 32, 48, 49, 97, 53, 51, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3a30 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 52, 32, 76, 88,
-/* 0x3a40 */  77, 82, 85, 48, 53, 53, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32,
-/* 0x3a50 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 53, 56, 32, 32, 50, 42, 42,
-/* 0x3a60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53, 53, 32,
-/* 0x3a70 */  77, 82, 85, 66, 89, 84, 69, 50, 32, 32, 32, 32, 32, 32, 48, 53,
-/* 0x3a80 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 53, 97, 32, 32, 50,
-/* 0x3a90 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 53,
-/* 0x3aa0 */  54, 32, 77, 82, 85, 66, 73, 84, 83, 50, 32, 32, 32, 32, 32, 32,
-/* 0x3ab0 */  48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 53,102, 32,
-/* 0x3ac0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3ad0 */  49, 53, 55, 32, 77, 82, 85, 65, 82, 66, 50, 48, 32, 32, 32, 32,
-/* 0x3ae0 */  32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 54,
-/* 0x3af0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3b00 */  83, 10, 49, 53, 56, 32, 76, 88, 77, 82, 85, 48, 53, 55, 32, 32,
-/* 0x3b10 */  32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3b20 */  97, 54, 57, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3b30 */  78, 84, 83, 10, 49, 53, 57, 32, 76, 88, 77, 82, 85, 48, 53, 56,
-/* 0x3b40 */  32, 32, 32, 32, 32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3b50 */  48, 49, 97, 54,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3b60 */  84, 69, 78, 84, 83, 10, 49, 54, 48, 32, 76, 88, 85, 78, 70, 48,
-/* 0x3b70 */  51, 53, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48,
-/* 0x3b80 */  32, 32, 48, 49, 97, 55, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3b90 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 49, 32, 99,116,111,107,
-/* 0x3ba0 */  51, 50, 46, 48, 48, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32,
-/* 0x3bb0 */  32, 48, 32, 32, 48, 49, 97, 55, 54, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3bc0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 50, 32, 99,116,
-/* 0x3bd0 */ 111,107, 51, 50, 46, 49, 48, 32, 32, 32, 32, 32, 48,101, 32, 32,
-/* 0x3be0 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 55,100, 32, 32, 50, 42, 42,
-/* 0x3bf0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 51, 32,
-/* 0x3c00 */  99,116,111,107, 51, 50, 46, 50, 48, 32, 32, 32, 32, 32, 48, 50,
-/* 0x3c10 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56, 98, 32, 32,
-/* 0x3c20 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x3c30 */  54, 52, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 32, 32, 32,
-/* 0x3c40 */  32, 48, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 97, 98,
-/* 0x3c50 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3c60 */  10, 49, 54, 53, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 32,
-/* 0x3c70 */  32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3c80 */  98, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3c90 */  84, 83, 10, 49, 54, 54, 32, 76, 69, 88, 69, 67, 48, 49, 55, 32,
-/* 0x3ca0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x3cb0 */  49, 97, 98, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x3cc0 */  69, 78, 84, 83, 10, 49, 54, 55, 32, 76, 69, 88, 69, 67, 48, 50,
-/* 0x3cd0 */  48, 32, 32, 32, 32, 32, 32, 48, 49, 52, 56, 32, 32, 48, 32, 32,
-/* 0x3ce0 */  48, 32, 32, 48, 49, 97, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3cf0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 56, 32, 76, 85, 78,
-/* 0x3d00 */  77, 80, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3d10 */  32, 48, 32, 32, 48, 49, 99, 48, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3d20 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 54, 57, 32, 76, 85,
-/* 0x3d30 */  78, 77, 80, 48, 48, 49, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48,
-/* 0x3d40 */  32, 32, 48, 32, 32, 48, 49, 99, 48, 52, 32, 32, 50, 42, 42, 48,
-/* 0x3d50 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 55, 48, 32, 76,
-/* 0x3d60 */  69, 88, 69, 67, 48, 50, 53, 32, 32, 32, 32, 32, 32, 48, 32, 32,
-/* 0x3d70 */  48, 32, 32, 48, 32, 32, 48, 49, 99, 48, 52, 32, 32, 50, 42, 42,
-/* 0x3d80 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 55, 49, 32,
-/* 0x3d90 */  76, 69, 88, 69, 67, 68, 89, 78, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x3da0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 99, 48, 52, 32, 32, 50, 42,
-/* 0x3db0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77,
-/* 0x3dc0 */  66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48,
-/* 0x3dd0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83,
-/* 0x3de0 */  77, 65, 49, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 49, 48, 10,
-/* 0x3df0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3e00 */  32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 66, 70,
-/* 0x3e10 */  65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3e20 */  32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 32, 48,
-/* 0x3e30 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3e40 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69,
-/* 0x3e50 */  67, 50, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48,
-/* 0x3e60 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3e70 */  78, 50, 66, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 66, 68, 69,
-/* 0x3e80 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3e90 */  32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 48, 32,
-/* 0x3ea0 */  78, 50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3eb0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83,
-/* 0x3ec0 */  54, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10, 48, 48,
-/* 0x3ed0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3ee0 */  50, 66, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67,
-/* 0x3ef0 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3f00 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 48, 32, 78,
-/* 0x3f10 */  50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f20 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49,
-/* 0x3f30 */  49, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48, 48, 48,
-/* 0x3f40 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3f50 */  68, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x3f60 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3f70 */ 100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 48, 32, 78, 50,
-/* 0x3f80 */  68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3f90 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x3fa0 */  32, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48,
-/* 0x3fb0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x3fc0 */  68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 53, 48,
-/* 0x3fd0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3fe0 */  32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 48, 32, 78, 50, 68,
-/* 0x3ff0 */  70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4000 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 32,
-/* 0x4010 */  48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4020 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83,
-/* 0x4030 */  77, 65, 49, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10,
-/* 0x4040 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4050 */  32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50, 69, 70,
-/* 0x4060 */  65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4070 */  32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 48,
-/* 0x4080 */  32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4090 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69,
-/* 0x40a0 */  67, 50, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48, 10, 48,
-/* 0x40b0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x40c0 */  78, 50, 69, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 69, 68, 69,
-/* 0x40d0 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x40e0 */  32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32, 48, 32,
-/* 0x40f0 */  78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4100 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x4110 */  54, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10, 48, 48,
-/* 0x4120 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x4130 */  50, 69, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67,
-/* 0x4140 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4150 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 48, 32, 67,
-/* 0x4160 */  65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4170 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x4180 */  48, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 48, 48, 48,
-/* 0x4190 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x41a0 */  76, 76, 84, 82, 49, 49, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x41b0 */  49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x41c0 */ 100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 48, 32, 67, 65,
-/* 0x41d0 */  76, 76, 84, 82, 49, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x41e0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 49, 48,
-/* 0x41f0 */  32, 48, 32, 76, 88, 85, 78, 70, 48, 49, 48, 10, 48, 48, 48, 48,
-/* 0x4200 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74,
-/* 0x4210 */  67, 67, 48, 49, 48, 32, 48, 32, 76, 88, 74, 67, 67, 48, 49, 48,
-/* 0x4220 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4230 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 32, 48, 32, 76, 88, 85,
-/* 0x4240 */  78, 70, 48, 51, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4250 */  32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 55, 48, 32,
-/* 0x4260 */  48, 32, 76, 88, 77, 82, 85, 48, 55, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4270 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x4280 */  85, 49, 48, 48, 32, 48, 32, 76, 88, 77, 82, 85, 49, 48, 48, 10,
-/* 0x4290 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x42a0 */  32, 76, 88, 85, 78, 70, 48, 52, 48, 32, 48, 32, 76, 88, 85, 78,
-/* 0x42b0 */  70, 48, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x42c0 */  32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 52, 50, 32, 48,
-/* 0x42d0 */  32, 76, 88, 85, 78, 70, 48, 52, 50, 10, 48, 48, 48, 48, 48, 48,
-/* 0x42e0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x42f0 */  48, 51, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 51, 48, 10, 48,
-/* 0x4300 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4310 */  76, 88, 85, 78, 70, 48, 51, 48, 32, 48, 32, 76, 88, 85, 78, 70,
-/* 0x4320 */  48, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4330 */  32, 32,100, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85, 32, 48, 32,
-/* 0x4340 */  76, 88, 67, 74, 56, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4350 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48,
-/* 0x4360 */  51, 52, 32, 48, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 48, 48,
-/* 0x4370 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,
-/* 0x4380 */ 116,111,107, 51, 50, 46, 48, 48, 32, 48, 32, 99,116,111,107, 51,
-/* 0x4390 */  50, 46, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x43a0 */  32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 49, 48, 32,
-/* 0x43b0 */  48, 32, 99,116,111,107, 51, 50, 46, 49, 48, 10, 48, 48, 48, 48,
-/* 0x43c0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,
-/* 0x43d0 */ 107, 51, 50, 46, 50, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46,
-/* 0x43e0 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x43f0 */  32,100, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32, 48, 32,
-/* 0x4400 */  99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4410 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67,
-/* 0x4420 */  48, 50, 48, 32, 48, 32, 76, 69, 88, 69, 67, 48, 50, 48, 10, 48,
-/* 0x4430 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4440 */  76, 69, 88, 69, 67, 48, 48, 48, 32, 48, 32, 76, 69, 88, 69, 67,
-/* 0x4450 */  48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4460 */  32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 48, 57, 32, 48, 32,
-/* 0x4470 */  76, 69, 88, 69, 67, 48, 48, 57, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4480 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48,
-/* 0x4490 */  49, 48, 32, 48, 32, 76, 69, 88, 69, 67, 48, 49, 48, 10, 48, 48,
-/* 0x44a0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x44b0 */  50, 66, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83,
-/* 0x44c0 */  49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x44d0 */  32,100, 32, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 48, 32, 78,
-/* 0x44e0 */  50, 66, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x44f0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50,
-/* 0x4500 */  48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 10, 48, 48, 48,
-/* 0x4510 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4520 */  66, 83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 51,
-/* 0x4530 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4540 */ 100, 32, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50,
-/* 0x4550 */  66, 70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4560 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x4570 */  32, 48, 32, 78, 50, 66, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48,
-/* 0x4580 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x4590 */  70, 65, 83, 52, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48,
-/* 0x45a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x45b0 */  32, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 66,
-/* 0x45c0 */  83, 77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x45d0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32,
-/* 0x45e0 */  48, 32, 78, 50, 66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x45f0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83,
-/* 0x4600 */  77, 65, 54, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 54, 48, 10,
-/* 0x4610 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4620 */  32, 78, 50, 66, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 66, 70,
-/* 0x4630 */  65, 83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4640 */  32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 48,
-/* 0x4650 */  32, 78, 50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4660 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77,
-/* 0x4670 */  65, 50, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 50, 48, 10, 48,
-/* 0x4680 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4690 */  78, 50, 68, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 68, 70, 65,
-/* 0x46a0 */  83, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x46b0 */  32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 48, 32,
-/* 0x46c0 */  78, 50, 68, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x46d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83,
-/* 0x46e0 */  51, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48,
-/* 0x46f0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x4700 */  50, 68, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65,
-/* 0x4710 */  52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4720 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32, 48, 32, 78,
-/* 0x4730 */  50, 68, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4740 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53,
-/* 0x4750 */  48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48, 10, 48, 48, 48,
-/* 0x4760 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x4770 */  68, 70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 53,
-/* 0x4780 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4790 */ 100, 32, 32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50,
-/* 0x47a0 */  68, 83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x47b0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48,
-/* 0x47c0 */  32, 48, 32, 78, 50, 68, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48,
-/* 0x47d0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x47e0 */  70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48,
-/* 0x47f0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4800 */  32, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 69,
-/* 0x4810 */  83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4820 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32,
-/* 0x4830 */  48, 32, 78, 50, 69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4840 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83,
-/* 0x4850 */  77, 65, 51, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 51, 48, 10,
-/* 0x4860 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4870 */  32, 78, 50, 69, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 69, 70,
-/* 0x4880 */  65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4890 */  32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 48,
-/* 0x48a0 */  32, 78, 50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x48b0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65,
-/* 0x48c0 */  83, 52, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 52, 48, 10, 48,
-/* 0x48d0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x48e0 */  78, 50, 69, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 69, 83, 77,
-/* 0x48f0 */  65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4900 */  32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 48, 32,
-/* 0x4910 */  78, 50, 69, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4920 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65,
-/* 0x4930 */  54, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48,
-/* 0x4940 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x4950 */  50, 69, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83,
-/* 0x4960 */  54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4970 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 48,
-/* 0x4980 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48,
-/* 0x4990 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x49a0 */  65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69,
-/* 0x49b0 */  76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x49c0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x49d0 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x49e0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x49f0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65,
-/* 0x4a00 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4a10 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x4a20 */  51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10,
-/* 0x4a30 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4a40 */  32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 48, 32, 67, 84, 67, 76,
-/* 0x4a50 */  69, 86, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4a60 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 49, 32, 48,
-/* 0x4a70 */  32, 67, 65, 76, 76, 84, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4a80 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72,
-/* 0x4a90 */  82, 48, 49, 32, 48, 32, 67, 84, 66, 83, 72, 82, 48, 49, 10, 48,
-/* 0x4aa0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4ab0 */  67, 84, 66, 82, 79, 82, 48, 49, 32, 48, 32, 67, 84, 66, 82, 79,
-/* 0x4ac0 */  82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4ad0 */  32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 48, 32,
-/* 0x4ae0 */  67, 84, 66, 83, 87, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4af0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4b00 */  48, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 50, 10, 48, 48,
-/* 0x4b10 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x4b20 */  65, 76, 76, 84, 82, 69, 56, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4b30 */  69, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4b40 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 57, 32, 48, 32, 67,
-/* 0x4b50 */  65, 76, 76, 84, 82, 69, 57, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4b60 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69,
-/* 0x4b70 */  50, 32, 48, 32, 67, 84, 67, 76, 69, 86, 69, 50, 10, 48, 48, 48,
-/* 0x4b80 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65,
-/* 0x4b90 */  76, 76, 84, 82, 49, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x4ba0 */  50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4bb0 */ 100, 32, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 48, 32, 67, 84,
-/* 0x4bc0 */  66, 83, 72, 82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4bd0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 49, 49,
-/* 0x4be0 */  32, 48, 32, 67, 84, 66, 82, 79, 82, 49, 49, 10, 48, 48, 48, 48,
-/* 0x4bf0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66,
-/* 0x4c00 */  83, 87, 65, 49, 49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 49, 49,
-/* 0x4c10 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4c20 */  32, 32, 76, 69, 88, 69, 67, 48, 49, 53, 32, 48, 32, 76, 69, 88,
-/* 0x4c30 */  69, 67, 48, 49, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4c40 */  32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 48, 48, 32,
-/* 0x4c50 */  48, 32, 76, 88, 85, 78, 70, 48, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x4c60 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78,
-/* 0x4c70 */  70, 48, 48, 50, 32, 48, 32, 76, 88, 85, 78, 70, 48, 48, 50, 10,
-/* 0x4c80 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4c90 */  32, 77, 82, 85, 66, 89, 84, 69, 48, 32, 48, 32, 77, 82, 85, 66,
-/* 0x4ca0 */  89, 84, 69, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4cb0 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 48, 53, 32, 48,
-/* 0x4cc0 */  32, 76, 88, 77, 82, 85, 48, 48, 53, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4cd0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x4ce0 */  48, 48, 54, 32, 48, 32, 76, 88, 77, 82, 85, 48, 48, 54, 10, 48,
-/* 0x4cf0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4d00 */  76, 88, 77, 82, 85, 48, 48, 55, 32, 48, 32, 76, 88, 77, 82, 85,
-/* 0x4d10 */  48, 48, 55, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4d20 */  32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 48, 56, 32, 48, 32,
-/* 0x4d30 */  76, 88, 85, 78, 70, 48, 48, 56, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4d40 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4d50 */  52, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48, 52, 53, 10, 48, 48,
-/* 0x4d60 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x4d70 */  88, 77, 82, 85, 48, 52, 54, 32, 48, 32, 76, 88, 77, 82, 85, 48,
-/* 0x4d80 */  52, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4d90 */  32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50, 48, 32, 48, 32, 76,
-/* 0x4da0 */  88, 74, 67, 67, 48, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4db0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 74, 67, 67, 48, 50,
-/* 0x4dc0 */  49, 32, 48, 32, 76, 88, 74, 67, 67, 48, 50, 49, 10, 48, 48, 48,
-/* 0x4dd0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x4de0 */  74, 67, 67, 48, 50, 51, 32, 48, 32, 76, 88, 74, 67, 67, 48, 50,
-/* 0x4df0 */  51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4e00 */ 100, 32, 32, 76, 88, 85, 78, 70, 51, 56, 54, 32, 48, 32, 76, 88,
-/* 0x4e10 */  85, 78, 70, 51, 56, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4e20 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 51, 56, 55,
-/* 0x4e30 */  32, 48, 32, 76, 88, 85, 78, 70, 51, 56, 55, 10, 48, 48, 48, 48,
-/* 0x4e40 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85,
-/* 0x4e50 */  78, 70, 51, 56, 56, 32, 48, 32, 76, 88, 85, 78, 70, 51, 56, 56,
-/* 0x4e60 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x4e70 */  32, 32, 76, 88, 85, 78, 70, 52, 56, 54, 32, 48, 32, 76, 88, 85,
-/* 0x4e80 */  78, 70, 52, 56, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4e90 */  32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 52, 56, 55, 32,
-/* 0x4ea0 */  48, 32, 76, 88, 85, 78, 70, 52, 56, 55, 10, 48, 48, 48, 48, 48,
-/* 0x4eb0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x4ec0 */  85, 48, 54, 53, 32, 48, 32, 76, 88, 77, 82, 85, 48, 54, 53, 10,
-/* 0x4ed0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4ee0 */  32, 77, 82, 85, 66, 89, 84, 69, 51, 32, 48, 32, 77, 82, 85, 66,
-/* 0x4ef0 */  89, 84, 69, 51, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4f00 */  32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 51, 48, 32, 48,
-/* 0x4f10 */  32, 77, 82, 85, 65, 82, 66, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4f20 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73,
-/* 0x4f30 */  84, 83, 51, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 51, 10, 48,
-/* 0x4f40 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4f50 */  77, 82, 85, 65, 82, 66, 52, 48, 32, 48, 32, 77, 82, 85, 65, 82,
-/* 0x4f60 */  66, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4f70 */  32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 52, 32, 48, 32,
-/* 0x4f80 */  77, 82, 85, 66, 89, 84, 69, 52, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4f90 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 73, 84,
-/* 0x4fa0 */  83, 52, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 52, 10, 48, 48,
-/* 0x4fb0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77,
-/* 0x4fc0 */  82, 85, 65, 82, 66, 53, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66,
-/* 0x4fd0 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4fe0 */  32,100, 32, 32, 76, 88, 77, 82, 85, 48, 56, 48, 32, 48, 32, 76,
-/* 0x4ff0 */  88, 77, 82, 85, 48, 56, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5000 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69,
-/* 0x5010 */  53, 32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 53, 10, 48, 48, 48,
-/* 0x5020 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82,
-/* 0x5030 */  85, 65, 82, 66, 54, 48, 32, 48, 32, 77, 82, 85, 65, 82, 66, 54,
-/* 0x5040 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x5050 */ 100, 32, 32, 77, 82, 85, 66, 73, 84, 83, 53, 32, 48, 32, 77, 82,
-/* 0x5060 */  85, 66, 73, 84, 83, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5070 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 55, 48,
-/* 0x5080 */  32, 48, 32, 77, 82, 85, 65, 82, 66, 55, 48, 10, 48, 48, 48, 48,
-/* 0x5090 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77,
-/* 0x50a0 */  82, 85, 48, 57, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 57, 48,
-/* 0x50b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x50c0 */  32, 32, 77, 82, 85, 66, 89, 84, 69, 54, 32, 48, 32, 77, 82, 85,
-/* 0x50d0 */  66, 89, 84, 69, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x50e0 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 56, 48, 32,
-/* 0x50f0 */  48, 32, 77, 82, 85, 65, 82, 66, 56, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5100 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66,
-/* 0x5110 */  73, 84, 83, 54, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 54, 10,
-/* 0x5120 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5130 */  32, 77, 82, 85, 65, 82, 66, 57, 48, 32, 48, 32, 77, 82, 85, 65,
-/* 0x5140 */  82, 66, 57, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x5150 */  32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 49, 49, 48, 32, 48,
-/* 0x5160 */  32, 76, 88, 77, 82, 85, 49, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5170 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85,
-/* 0x5180 */  49, 49, 49, 32, 48, 32, 76, 88, 77, 82, 85, 49, 49, 49, 10, 48,
-/* 0x5190 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x51a0 */  76, 88, 85, 78, 70, 48, 52, 49, 32, 48, 32, 76, 88, 85, 78, 70,
-/* 0x51b0 */  48, 52, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x51c0 */  32, 32,100, 32, 32, 76, 69, 88, 69, 67, 48, 49, 54, 32, 48, 32,
-/* 0x51d0 */  76, 69, 88, 69, 67, 48, 49, 54, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x51e0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x51f0 */  49, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 49, 48, 10, 48, 48,
-/* 0x5200 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x5210 */  88, 74, 77, 80, 65, 48, 48, 32, 48, 32, 76, 88, 74, 77, 80, 65,
-/* 0x5220 */  48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5230 */  32,100, 32, 32, 76, 88, 67, 65, 76, 76, 66, 48, 32, 48, 32, 76,
-/* 0x5240 */  88, 67, 65, 76, 76, 66, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5250 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 85, 78, 70, 48, 50,
-/* 0x5260 */  49, 32, 48, 32, 76, 88, 85, 78, 70, 48, 50, 49, 10, 48, 48, 48,
-/* 0x5270 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x5280 */  77, 82, 85, 48, 50, 50, 32, 48, 32, 76, 88, 77, 82, 85, 48, 50,
-/* 0x5290 */  50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x52a0 */ 100, 32, 32, 76, 88, 74, 77, 80, 65, 48, 49, 32, 48, 32, 76, 88,
-/* 0x52b0 */  74, 77, 80, 65, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x52c0 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 66, 49,
-/* 0x52d0 */  32, 48, 32, 76, 88, 67, 65, 76, 76, 66, 49, 10, 48, 48, 48, 48,
-/* 0x52e0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x52f0 */  66, 73, 84, 83, 49, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 49,
-/* 0x5300 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5310 */  32, 32, 77, 82, 85, 66, 89, 84, 69, 49, 32, 48, 32, 77, 82, 85,
-/* 0x5320 */  66, 89, 84, 69, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5330 */  32, 32, 32, 32,100, 32, 32, 77, 82, 85, 65, 82, 66, 49, 48, 32,
-/* 0x5340 */  48, 32, 77, 82, 85, 65, 82, 66, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5350 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x5360 */  85, 48, 52, 48, 32, 48, 32, 76, 88, 77, 82, 85, 48, 52, 48, 10,
-/* 0x5370 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x5380 */  32, 76, 88, 74, 67, 67, 48, 48, 48, 32, 48, 32, 76, 88, 74, 67,
-/* 0x5390 */  67, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x53a0 */  32, 32, 32,100, 32, 32, 76, 88, 67, 74, 48, 77, 82, 85, 32, 48,
-/* 0x53b0 */  32, 76, 88, 67, 74, 48, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48,
-/* 0x53c0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 49,
-/* 0x53d0 */  77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 49, 77, 82, 85, 10, 48,
-/* 0x53e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x53f0 */  76, 88, 67, 65, 76, 74, 77, 80, 32, 48, 32, 76, 88, 67, 65, 76,
-/* 0x5400 */  74, 77, 80, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x5410 */  32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76, 48, 48, 32, 48, 32,
-/* 0x5420 */  76, 88, 67, 65, 76, 76, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5430 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 65, 76, 76,
-/* 0x5440 */  48, 49, 32, 48, 32, 76, 88, 67, 65, 76, 76, 48, 49, 10, 48, 48,
-/* 0x5450 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x5460 */  88, 67, 74, 50, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 50, 77,
-/* 0x5470 */  82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x5480 */  32,100, 32, 32, 76, 88, 67, 74, 52, 77, 82, 85, 32, 48, 32, 76,
-/* 0x5490 */  88, 67, 74, 52, 77, 82, 85, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x54a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 67, 74, 54, 77, 82,
-/* 0x54b0 */  85, 32, 48, 32, 76, 88, 67, 74, 54, 77, 82, 85, 10, 48, 48, 48,
-/* 0x54c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88,
-/* 0x54d0 */  67, 74, 55, 77, 82, 85, 32, 48, 32, 76, 88, 67, 74, 55, 77, 82,
-/* 0x54e0 */  85, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x54f0 */ 100, 32, 32, 76, 88, 77, 82, 85, 48, 53, 53, 32, 48, 32, 76, 88,
-/* 0x5500 */  77, 82, 85, 48, 53, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5510 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85, 66, 89, 84, 69, 50,
-/* 0x5520 */  32, 48, 32, 77, 82, 85, 66, 89, 84, 69, 50, 10, 48, 48, 48, 48,
-/* 0x5530 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 82, 85,
-/* 0x5540 */  66, 73, 84, 83, 50, 32, 48, 32, 77, 82, 85, 66, 73, 84, 83, 50,
-/* 0x5550 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5560 */  32, 32, 77, 82, 85, 65, 82, 66, 50, 48, 32, 48, 32, 77, 82, 85,
-/* 0x5570 */  65, 82, 66, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5580 */  32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82, 85, 48, 53, 55, 32,
-/* 0x5590 */  48, 32, 76, 88, 77, 82, 85, 48, 53, 55, 10, 48, 48, 48, 48, 48,
-/* 0x55a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 88, 77, 82,
-/* 0x55b0 */  85, 48, 53, 56, 32, 48, 32, 76, 88, 77, 82, 85, 48, 53, 56, 10,
-/* 0x55c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x55d0 */  32, 76, 88, 85, 78, 70, 48, 51, 53, 32, 48, 32, 76, 88, 85, 78,
-/* 0x55e0 */  70, 48, 51, 53, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x55f0 */  32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32,
-/* 0x5600 */  48, 32, 99,116,111,107, 51, 50, 46, 51, 48, 10, 48, 48, 48, 48,
-/* 0x5610 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88,
-/* 0x5620 */  69, 67, 48, 49, 55, 32, 48, 32, 76, 69, 88, 69, 67, 48, 49, 55,
-/* 0x5630 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x5640 */  32, 32, 76, 85, 78, 77, 80, 48, 48, 48, 32, 48, 32, 76, 85, 78,
-/* 0x5650 */  77, 80, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x5660 */  32, 32, 32, 32,100, 32, 32, 76, 85, 78, 77, 80, 48, 48, 49, 32,
-/* 0x5670 */  48, 32, 76, 85, 78, 77, 80, 48, 48, 49, 10, 48, 48, 48, 48, 48,
-/* 0x5680 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 69, 88, 69,
-/* 0x5690 */  67, 48, 50, 53, 32, 48, 32, 76, 69, 88, 69, 67, 48, 50, 53, 10,
-/* 0x56a0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x56b0 */  32, 76, 69, 88, 69, 67, 68, 89, 78, 32, 48, 32, 76, 69, 88, 69,
-/* 0x56c0 */  67, 68, 89, 78, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x56d0 */  32, 32, 32, 32, 32, 32, 76, 69, 88, 69, 67, 48, 48, 48, 32, 48,
-/* 0x56e0 */  32, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x56f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x5700 */  32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,
-/* 0x5710 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x5720 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97,
-/* 0x5730 */  95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x5740 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x5750 */ 108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48,
-/* 0x5760 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x5770 */  42, 32, 48, 32,108,122,109, 97, 95,112,114,111,112,101,114,116,
-/* 0x5780 */ 105,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x5790 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,108,
-/* 0x57a0 */ 116,101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48,
-/* 0x57b0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x57c0 */  42, 32, 48, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48,
-/* 0x57d0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x57e0 */  42, 85, 78, 68, 42, 32, 48, 32, 78, 77, 82, 85, 10, 10, 82, 69,
-/* 0x57f0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5800 */  32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48, 48, 48, 93, 58,
-/* 0x5810 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5820 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5830 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54,
-/* 0x5840 */  95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 76, 69, 88,
-/* 0x5850 */  69, 67, 48, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5860 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5870 */  50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5880 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5890 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x58a0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x58b0 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10,
-/* 0x58c0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x58d0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 49, 48,
-/* 0x58e0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x58f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5900 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x5910 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5920 */  50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5930 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5940 */  91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5950 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5960 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5970 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5980 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83, 77, 65, 49, 48,
-/* 0x5990 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x59a0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83,
-/* 0x59b0 */  50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x59c0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59d0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x59e0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59f0 */  32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67,
-/* 0x5a00 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x5a10 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70,
-/* 0x5a20 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x5a30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x5a40 */  48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5a50 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x5a60 */  50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5a70 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x5a80 */  65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5a90 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5aa0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x5ab0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x5ac0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48,
-/* 0x5ad0 */  48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x5ae0 */  32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10,
-/* 0x5af0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x5b00 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 68, 69, 67, 51,
-/* 0x5b10 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x5b20 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x5b30 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32, 82, 95,
-/* 0x5b40 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b50 */  78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x5b60 */ 102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5b70 */  32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 10, 82, 69,
-/* 0x5b80 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5b90 */  32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 52, 48, 93, 58,
-/* 0x5ba0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5bb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5bc0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54,
-/* 0x5bd0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66,
-/* 0x5be0 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5bf0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5c00 */  50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5c10 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c20 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5c30 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5c40 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 10, 48,
-/* 0x5c50 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x5c60 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67,
-/* 0x5c70 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5c80 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83,
-/* 0x5c90 */  77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5ca0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5cb0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x5cc0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x5cd0 */  32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x5ce0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x5cf0 */  70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 48, 93, 58, 10,
-/* 0x5d00 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x5d10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x5d20 */  10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5d30 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 70,
-/* 0x5d40 */  65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95,
-/* 0x5d50 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d60 */  78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x5d70 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x5d80 */  32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70,
-/* 0x5d90 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x5da0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x5db0 */  48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x5dc0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49,
-/* 0x5dd0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5de0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77,
-/* 0x5df0 */  65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5e00 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e10 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x5e20 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e30 */  32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5e40 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5e50 */  79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48, 93, 58, 10, 79,
-/* 0x5e60 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5e70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5e80 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5e90 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x5ea0 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5eb0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x5ec0 */  83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5ed0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ee0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5ef0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5f00 */  32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 10, 82, 69,
-/* 0x5f10 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5f20 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 50, 48, 93, 58,
-/* 0x5f30 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5f40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5f50 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x5f60 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x5f70 */  70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5f80 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5f90 */  50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5fa0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fb0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5fc0 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5fd0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10,
-/* 0x5fe0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5ff0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 51, 48,
-/* 0x6000 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6010 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6020 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51,
-/* 0x6030 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x6040 */  50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x6050 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6060 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x6070 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6080 */  70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51, 48, 93, 58, 10,
-/* 0x6090 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x60a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x60b0 */  10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95,
-/* 0x60c0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x60d0 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32, 82, 95,
-/* 0x60e0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x60f0 */  78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 52,
-/* 0x6100 */  51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x6110 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 10, 82, 69,
-/* 0x6120 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6130 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 52, 48, 93, 58,
-/* 0x6140 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6150 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6160 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54,
-/* 0x6170 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x6180 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6190 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x61a0 */  50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x61b0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x61c0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x61d0 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x61e0 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48,
-/* 0x61f0 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6200 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x6210 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6220 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83,
-/* 0x6230 */  77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6240 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6250 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x6260 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x6270 */  32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x6280 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6290 */  70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 48, 93, 58, 10,
-/* 0x62a0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x62b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x62c0 */  10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95,
-/* 0x62d0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 70,
-/* 0x62e0 */  65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95,
-/* 0x62f0 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6300 */  78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6310 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6320 */  32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70,
-/* 0x6330 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6340 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6350 */  48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x6360 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49,
-/* 0x6370 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6380 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77,
-/* 0x6390 */  65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x63a0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63b0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x63c0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x63d0 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x63e0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x63f0 */  79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48, 93, 58, 10, 79,
-/* 0x6400 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6410 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6420 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6430 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x6440 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6450 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x6460 */  83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6470 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6480 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6490 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x64a0 */  32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 10, 82, 69,
-/* 0x64b0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x64c0 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 50, 48, 93, 58,
-/* 0x64d0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x64e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x64f0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54,
-/* 0x6500 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x6510 */  70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6520 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x6530 */  50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6540 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6550 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6560 */  48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6570 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10,
-/* 0x6580 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6590 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x65a0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x65b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x65c0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82, 95, 51,
-/* 0x65d0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x65e0 */  50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,101,
-/* 0x65f0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6600 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76,
-/* 0x6610 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6620 */  70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51, 48, 93, 58, 10,
-/* 0x6630 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6640 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6650 */  10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6660 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x6670 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95,
-/* 0x6680 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6690 */  78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48, 48, 51,
-/* 0x66a0 */  48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x66b0 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 10, 82, 69,
-/* 0x66c0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x66d0 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 52, 48, 93, 58,
-/* 0x66e0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x66f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6700 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54,
-/* 0x6710 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x6720 */  68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6730 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x6740 */  50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6750 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6760 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6770 */  48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6780 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48,
-/* 0x6790 */  48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x67a0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67,
-/* 0x67b0 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x67c0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83,
-/* 0x67d0 */  77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x67e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x67f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56,
-/* 0x6800 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32,
-/* 0x6810 */  32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76,
-/* 0x6820 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6830 */  70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 48, 93, 58, 10,
-/* 0x6840 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6850 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6860 */  10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6870 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 70,
-/* 0x6880 */  65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82, 95,
-/* 0x6890 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x68a0 */  78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x68b0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x68c0 */  32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58, 10, 79, 70, 70,
-/* 0x68d0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x68e0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x68f0 */  48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51,
-/* 0x6900 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49,
-/* 0x6910 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6920 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95,
-/* 0x6930 */  68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6940 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6950 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6960 */  53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x6970 */  32, 32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,
-/* 0x6980 */ 100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 49, 52, 32, 82,
-/* 0x6990 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x69a0 */  32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x69b0 */  48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x69c0 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,
-/* 0x69d0 */ 110, 10, 48, 48, 48, 48, 48, 48, 50, 97, 32, 82, 95, 51, 56, 54,
-/* 0x69e0 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x69f0 */  97, 95,112,114,111,112,101,114,116,105,101,115, 10, 10, 82, 69,
-/* 0x6a00 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x6a10 */  32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 48, 93, 58,
-/* 0x6a20 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x6a30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x6a40 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x6a50 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,
-/* 0x6a60 */ 116,101,114, 95,108,101,110,103,116,104, 10, 10, 82, 69, 76, 79,
-/* 0x6a70 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6a80 */  79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 49, 93, 58, 10, 79,
-/* 0x6a90 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6aa0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6ab0 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56,
-/* 0x6ac0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,
-/* 0x6ad0 */ 114, 95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x6ae0 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6af0 */  32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6b00 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6b10 */  82, 32, 91, 67, 65, 76, 76, 84, 82, 48, 50, 93, 58, 10, 79, 70,
-/* 0x6b20 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6b30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6b40 */  48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x6b50 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82,
-/* 0x6b60 */  48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x6b70 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76,
-/* 0x6b80 */  84, 82, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6b90 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ba0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x6bb0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6bc0 */  32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104,
-/* 0x6bd0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6be0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82,
-/* 0x6bf0 */  49, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6c00 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c10 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82,
-/* 0x6c20 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c30 */  32, 67, 65, 76, 76, 84, 82, 49, 51, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6c40 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6c50 */  82, 32, 91, 67, 84, 67, 76, 69, 86, 69, 50, 93, 58, 10, 79, 70,
-/* 0x6c60 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6c70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6c80 */  48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 56, 32,
-/* 0x6c90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114,
-/* 0x6ca0 */  95, 99,116,111, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x6cb0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6cc0 */  67, 65, 76, 76, 84, 82, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6cd0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6ce0 */  32, 91, 67, 65, 76, 76, 84, 82, 49, 51, 93, 58, 10, 79, 70, 70,
-/* 0x6cf0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6d00 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6d10 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6d20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x6d30 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6d40 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70,
-/* 0x6d50 */  48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6d60 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6d70 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x6d80 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6d90 */  32, 32, 76, 88, 85, 78, 70, 48, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x6da0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6db0 */  79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 48, 53, 93, 58, 10, 79,
-/* 0x6dc0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6dd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6de0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x6df0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 77, 82, 85, 10,
-/* 0x6e00 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x6e10 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70, 48, 49,
-/* 0x6e20 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6e30 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6e40 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x6e50 */  51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6e60 */  76, 88, 85, 78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6e70 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6e80 */  32, 91, 76, 88, 74, 67, 67, 48, 50, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6e90 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6ea0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6eb0 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x6ec0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x6ed0 */  52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6ee0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67, 67,
-/* 0x6ef0 */  48, 50, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6f00 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f10 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x6f20 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6f30 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79,
-/* 0x6f40 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x6f50 */  79, 82, 32, 91, 76, 88, 85, 78, 70, 51, 56, 56, 93, 58, 10, 79,
-/* 0x6f60 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x6f70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x6f80 */  48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6f90 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70,
-/* 0x6fa0 */  48, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x6fb0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85,
-/* 0x6fc0 */  78, 70, 52, 56, 55, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x6fd0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6fe0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x6ff0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x7000 */  32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10, 82, 69,
-/* 0x7010 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x7020 */  32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 54, 53, 93, 58,
-/* 0x7030 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x7040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x7050 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 51, 56, 54,
-/* 0x7060 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77,
-/* 0x7070 */  82, 85, 48, 55, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7080 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x7090 */  88, 77, 82, 85, 48, 55, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x70a0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x70b0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x70c0 */  48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x70d0 */  32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 52, 48, 10, 10,
-/* 0x70e0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x70f0 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 77, 82, 85, 48, 57, 48,
-/* 0x7100 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x7110 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x7120 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51,
-/* 0x7130 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x7140 */  88, 77, 82, 85, 49, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x7150 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x7160 */  91, 76, 88, 85, 78, 70, 48, 52, 49, 93, 58, 10, 79, 70, 70, 83,
-/* 0x7170 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7180 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x7190 */  48, 48, 48, 48, 54, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x71a0 */  32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 52,
-/* 0x71b0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x71c0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 69, 88, 69, 67, 48,
-/* 0x71d0 */  49, 54, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x71e0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x71f0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x7200 */  95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7210 */  32, 76, 88, 85, 78, 70, 48, 52, 50, 10, 10, 82, 69, 76, 79, 67,
-/* 0x7220 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x7230 */  82, 32, 91, 76, 88, 77, 82, 85, 48, 52, 48, 93, 58, 10, 79, 70,
-/* 0x7240 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x7250 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x7260 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x7270 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 77, 82, 85, 48,
-/* 0x7280 */  51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x7290 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 74, 67,
-/* 0x72a0 */  67, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x72b0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x72c0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55,
-/* 0x72d0 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x72e0 */  32, 32, 32, 76, 88, 74, 67, 67, 48, 49, 48, 10, 10, 82, 69, 76,
-/* 0x72f0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x7300 */  70, 79, 82, 32, 91, 76, 88, 67, 65, 76, 76, 48, 48, 93, 58, 10,
-/* 0x7310 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7320 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7330 */  10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7340 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78,
-/* 0x7350 */  70, 48, 51, 55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x7360 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88,
-/* 0x7370 */  67, 74, 50, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x7380 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7390 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x73a0 */  48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x73b0 */  32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51, 55, 10, 10, 82,
-/* 0x73c0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x73d0 */  83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 52, 77, 82, 85, 93,
-/* 0x73e0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x73f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x7400 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56,
-/* 0x7410 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88,
-/* 0x7420 */  85, 78, 70, 48, 51, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x7430 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x7440 */  76, 88, 67, 74, 54, 77, 82, 85, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7450 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7460 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7470 */  48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7480 */  32, 32, 32, 32, 32, 32, 32, 76, 88, 67, 74, 56, 77, 82, 85, 10,
-/* 0x7490 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x74a0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 67, 74, 55, 77, 82,
-/* 0x74b0 */  85, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x74c0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x74d0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95,
-/* 0x74e0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x74f0 */  76, 88, 67, 74, 56, 77, 82, 85, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x7500 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x7510 */  32, 91, 76, 88, 67, 74, 56, 77, 82, 85, 93, 58, 10, 79, 70, 70,
-/* 0x7520 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x7530 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x7540 */  48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x7550 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 88, 85, 78, 70, 48, 51,
-/* 0x7560 */  55, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x7570 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 88, 85, 78, 70,
-/* 0x7580 */  48, 51, 52, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x7590 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x75a0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x75b0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x75c0 */  32, 32, 76, 88, 85, 78, 70, 48, 51, 48, 10, 10, 82, 69, 76, 79,
-/* 0x75d0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x75e0 */  79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10,
-/* 0x75f0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x7600 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x7610 */  10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7620 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x7630 */  51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7640 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x7650 */ 116,111,107, 51, 50, 46, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7660 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7670 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7680 */  48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7690 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 50, 48,
-/* 0x76a0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x76b0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51, 50,
-/* 0x76c0 */  46, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x76d0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x76e0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32,
-/* 0x76f0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7700 */  32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48,
-/* 0x7710 */  48, 48, 48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7720 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x7730 */  10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95,
-/* 0x7740 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x7750 */  51, 50, 46, 52, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x7760 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x7770 */ 116,111,107, 51, 50, 46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7780 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7790 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x77a0 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x77b0 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48,
-/* 0x77c0 */  10, 48, 48, 48, 48, 48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95,
-/* 0x77d0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107,
-/* 0x77e0 */  51, 50, 46, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x77f0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,
-/* 0x7800 */ 116,111,107, 51, 50, 46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x7810 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x7820 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x7830 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x7840 */  32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48,
-/* 0x7850 */  10
+/* 0x1c00 */ 252,243,164,195,172,  0,  0,  0,180,  0,  0,  0, 93,  0,  0,  0,
+/* 0x1c10 */ 158,  6,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,  9,  0,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c30 */   0,  0,  0,  0, 18,  0,  0,  0, 61,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0, 27,  0,  0,  0, 73,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0, 36,  0,  0,  0, 76,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1c60 */   0,  0,  0,  0, 45,  0,  0,  0, 78,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0, 54,  0,  0,  0, 84,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0, 63,  0,  0,  0, 95,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1c90 */   0,  0,  0,  0, 72,  0,  0,  0,100,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0, 81,  0,  0,  0,109,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0, 90,  0,  0,  0,122,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1cc0 */   0,  0,  0,  0, 99,  0,  0,  0,135,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,108,  0,  0,  0,150,  0,  0,  0, 62,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,117,  0,  0,  0,212,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1cf0 */   0,  0,  0,  0,126,  0,  0,  0,225,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,135,  0,  0,  0,240,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0,144,  0,  0,  0,242,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1d20 */   0,  0,  0,  0,153,  0,  0,  0,245,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0,162,  0,  0,  0,254,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0,171,  0,  0,  0, 10,  1,  0,  0, 25,  0,  0,  0,
+/* 0x1d50 */   0,  0,  0,  0,180,  0,  0,  0, 35,  1,  0,  0, 22,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,189,  0,  0,  0, 57,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0,198,  0,  0,  0, 57,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1d80 */   0,  0,  0,  0,207,  0,  0,  0, 60,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0,216,  0,  0,  0, 62,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0,225,  0,  0,  0, 68,  1,  0,  0, 11,  0,  0,  0,
+/* 0x1db0 */   0,  0,  0,  0,234,  0,  0,  0, 79,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,243,  0,  0,  0, 84,  1,  0,  0,  9,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,252,  0,  0,  0, 93,  1,  0,  0, 13,  0,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0,  5,  1,  0,  0,106,  1,  0,  0, 13,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0, 14,  1,  0,  0,119,  1,  0,  0, 15,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0, 23,  1,  0,  0,134,  1,  0,  0, 82,  0,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0, 32,  1,  0,  0,216,  1,  0,  0, 13,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0, 41,  1,  0,  0,229,  1,  0,  0, 15,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0, 50,  1,  0,  0,244,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0, 59,  1,  0,  0,246,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0, 68,  1,  0,  0,249,  1,  0,  0,  9,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0, 77,  1,  0,  0,  2,  2,  0,  0, 12,  0,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0, 86,  1,  0,  0, 14,  2,  0,  0, 25,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0, 95,  1,  0,  0, 39,  2,  0,  0, 22,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,104,  1,  0,  0, 61,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0,113,  1,  0,  0, 61,  2,  0,  0,  3,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,122,  1,  0,  0, 64,  2,  0,  0,  2,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,131,  1,  0,  0, 66,  2,  0,  0,  6,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,140,  1,  0,  0, 72,  2,  0,  0, 11,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,149,  1,  0,  0, 83,  2,  0,  0,  5,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,158,  1,  0,  0, 88,  2,  0,  0,  9,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0,167,  1,  0,  0, 97,  2,  0,  0, 13,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,176,  1,  0,  0,110,  2,  0,  0, 13,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0,185,  1,  0,  0,123,  2,  0,  0, 15,  0,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0,194,  1,  0,  0,138,  2,  0,  0, 95,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,203,  1,  0,  0,233,  2,  0,  0, 13,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0,212,  1,  0,  0,246,  2,  0,  0, 15,  0,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0,221,  1,  0,  0,  5,  3,  0,  0,  2,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,230,  1,  0,  0,  7,  3,  0,  0,  3,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,239,  1,  0,  0, 10,  3,  0,  0,  9,  0,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0,248,  1,  0,  0, 19,  3,  0,  0, 12,  0,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,  1,  2,  0,  0, 31,  3,  0,  0, 25,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0, 10,  2,  0,  0, 56,  3,  0,  0, 22,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0, 19,  2,  0,  0, 78,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0, 28,  2,  0,  0, 78,  3,  0,  0, 46,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0, 39,  2,  0,  0,124,  3,  0,  0, 72,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0, 50,  2,  0,  0,196,  3,  0,  0,134, 10,  0,  0,
+/* 0x2000 */   0,  0,  0,  0, 61,  2,  0,  0, 74, 14,  0,  0,134, 10,  0,  0,
+/* 0x2010 */   0,  0,  0,  0, 72,  2,  0,  0,208, 24,  0,  0, 26,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0, 83,  2,  0,  0,234, 24,  0,  0, 14,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0, 92,  2,  0,  0,248, 24,  0,  0,  5,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,101,  2,  0,  0,253, 24,  0,  0,  5,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,110,  2,  0,  0,  2, 25,  0,  0,  4,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,119,  2,  0,  0,  6, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,128,  2,  0,  0,  8, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,137,  2,  0,  0, 13, 25,  0,  0, 14,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0,146,  2,  0,  0, 27, 25,  0,  0,  5,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0,155,  2,  0,  0, 32, 25,  0,  0,  2,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,164,  2,  0,  0, 34, 25,  0,  0,  2,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0,173,  2,  0,  0, 36, 25,  0,  0,  4,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0,182,  2,  0,  0, 40, 25,  0,  0,  5,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0,191,  2,  0,  0, 45, 25,  0,  0,  2,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,200,  2,  0,  0, 47, 25,  0,  0,  4,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,209,  2,  0,  0, 51, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,  0,218,  2,  0,  0, 53, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,227,  2,  0,  0, 58, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,236,  2,  0,  0, 63, 25,  0,  0, 29,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,  0,245,  2,  0,  0, 92, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,254,  2,  0,  0, 94, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,  7,  3,  0,  0, 99, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  0, 16,  3,  0,  0,101, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0, 25,  3,  0,  0,106, 25,  0,  0,  7,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0, 34,  3,  0,  0,113, 25,  0,  0,  7,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0, 43,  3,  0,  0,120, 25,  0,  0,  4,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0, 52,  3,  0,  0,124, 25,  0,  0,  5,  0,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0, 61,  3,  0,  0,129, 25,  0,  0,  3,  0,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0, 70,  3,  0,  0,132, 25,  0,  0,  3,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0, 79,  3,  0,  0,135, 25,  0,  0,  2,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0, 88,  3,  0,  0,137, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0, 97,  3,  0,  0,139, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,106,  3,  0,  0,144, 25,  0,  0,  7,  0,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,115,  3,  0,  0,151, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2230 */   0,  0,  0,  0,124,  3,  0,  0,153, 25,  0,  0,  1,  0,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,133,  3,  0,  0,154, 25,  0,  0,  9,  0,  0,  0,
+/* 0x2250 */   0,  0,  0,  0,142,  3,  0,  0,163, 25,  0,  0,  3,  0,  0,  0,
+/* 0x2260 */   0,  0,  0,  0,151,  3,  0,  0,166, 25,  0,  0,  4,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0,160,  3,  0,  0,170, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2280 */   0,  0,  0,  0,169,  3,  0,  0,172, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2290 */   0,  0,  0,  0,178,  3,  0,  0,177, 25,  0,  0,  2,  0,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0,187,  3,  0,  0,179, 25,  0,  0,  1,  0,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0,196,  3,  0,  0,180, 25,  0,  0,  2,  0,  0,  0,
+/* 0x22c0 */   0,  0,  0,  0,205,  3,  0,  0,182, 25,  0,  0,  4,  0,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0,214,  3,  0,  0,186, 25,  0,  0,  8,  0,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0,223,  3,  0,  0,194, 25,  0,  0,  3,  0,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0,232,  3,  0,  0,197, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2300 */   0,  0,  0,  0,241,  3,  0,  0,199, 25,  0,  0,  6,  0,  0,  0,
+/* 0x2310 */   0,  0,  0,  0,250,  3,  0,  0,205, 25,  0,  0,  3,  0,  0,  0,
+/* 0x2320 */   0,  0,  0,  0,  3,  4,  0,  0,208, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0, 12,  4,  0,  0,210, 25,  0,  0,  1,  0,  0,  0,
+/* 0x2340 */   0,  0,  0,  0, 21,  4,  0,  0,211, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2350 */   0,  0,  0,  0, 30,  4,  0,  0,213, 25,  0,  0,  4,  0,  0,  0,
+/* 0x2360 */   0,  0,  0,  0, 39,  4,  0,  0,217, 25,  0,  0, 11,  0,  0,  0,
+/* 0x2370 */   0,  0,  0,  0, 48,  4,  0,  0,228, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2380 */   0,  0,  0,  0, 57,  4,  0,  0,230, 25,  0,  0,  1,  0,  0,  0,
+/* 0x2390 */   0,  0,  0,  0, 66,  4,  0,  0,231, 25,  0,  0,  2,  0,  0,  0,
+/* 0x23a0 */   0,  0,  0,  0, 75,  4,  0,  0,233, 25,  0,  0,  4,  0,  0,  0,
+/* 0x23b0 */   0,  0,  0,  0, 84,  4,  0,  0,237, 25,  0,  0, 16,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0, 93,  4,  0,  0,253, 25,  0,  0,  5,  0,  0,  0,
+/* 0x23d0 */   0,  0,  0,  0,102,  4,  0,  0,  2, 26,  0,  0,  3,  0,  0,  0,
+/* 0x23e0 */   0,  0,  0,  0,111,  4,  0,  0,  5, 26,  0,  0,  2,  0,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,120,  4,  0,  0,  7, 26,  0,  0,  7,  0,  0,  0,
+/* 0x2400 */   0,  0,  0,  0,129,  4,  0,  0, 14, 26,  0,  0,  0,  0,  0,  0,
+/* 0x2410 */   0,  0,  0,  0,138,  4,  0,  0, 14, 26,  0,  0,  5,  0,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,147,  4,  0,  0, 19, 26,  0,  0,  1,  0,  0,  0,
+/* 0x2430 */   0,  0,  0,  0,156,  4,  0,  0, 20, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2440 */   0,  0,  0,  0,165,  4,  0,  0, 22, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2450 */   0,  0,  0,  0,174,  4,  0,  0, 24, 26,  0,  0,  6,  0,  0,  0,
+/* 0x2460 */   0,  0,  0,  0,183,  4,  0,  0, 30, 26,  0,  0,  3,  0,  0,  0,
+/* 0x2470 */   0,  0,  0,  0,192,  4,  0,  0, 33, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,201,  4,  0,  0, 35, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2490 */   0,  0,  0,  0,210,  4,  0,  0, 37, 26,  0,  0,  1,  0,  0,  0,
+/* 0x24a0 */   0,  0,  0,  0,219,  4,  0,  0, 38, 26,  0,  0,  2,  0,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0,228,  4,  0,  0, 40, 26,  0,  0,  2,  0,  0,  0,
+/* 0x24c0 */   0,  0,  0,  0,237,  4,  0,  0, 42, 26,  0,  0,  1,  0,  0,  0,
+/* 0x24d0 */   0,  0,  0,  0,246,  4,  0,  0, 43, 26,  0,  0,  2,  0,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,255,  4,  0,  0, 45, 26,  0,  0,  6,  0,  0,  0,
+/* 0x24f0 */   0,  0,  0,  0,  8,  5,  0,  0, 51, 26,  0,  0,  8,  0,  0,  0,
+/* 0x2500 */   0,  0,  0,  0, 17,  5,  0,  0, 59, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2510 */   0,  0,  0,  0, 26,  5,  0,  0, 61, 26,  0,  0,  3,  0,  0,  0,
+/* 0x2520 */   0,  0,  0,  0, 35,  5,  0,  0, 64, 26,  0,  0,  3,  0,  0,  0,
+/* 0x2530 */   0,  0,  0,  0, 44,  5,  0,  0, 67, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2540 */   0,  0,  0,  0, 53,  5,  0,  0, 69, 26,  0,  0,  3,  0,  0,  0,
+/* 0x2550 */   0,  0,  0,  0, 62,  5,  0,  0, 72, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2560 */   0,  0,  0,  0, 71,  5,  0,  0, 74, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2570 */   0,  0,  0,  0, 80,  5,  0,  0, 76, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2580 */   0,  0,  0,  0, 89,  5,  0,  0, 78, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2590 */   0,  0,  0,  0, 98,  5,  0,  0, 80, 26,  0,  0,  3,  0,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,107,  5,  0,  0, 83, 26,  0,  0,  5,  0,  0,  0,
+/* 0x25b0 */   0,  0,  0,  0,116,  5,  0,  0, 88, 26,  0,  0,  2,  0,  0,  0,
+/* 0x25c0 */   0,  0,  0,  0,125,  5,  0,  0, 90, 26,  0,  0,  5,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,134,  5,  0,  0, 95, 26,  0,  0,  5,  0,  0,  0,
+/* 0x25e0 */   0,  0,  0,  0,143,  5,  0,  0,100, 26,  0,  0,  5,  0,  0,  0,
+/* 0x25f0 */   0,  0,  0,  0,152,  5,  0,  0,105, 26,  0,  0,  6,  0,  0,  0,
+/* 0x2600 */   0,  0,  0,  0,161,  5,  0,  0,111, 26,  0,  0,  1,  0,  0,  0,
+/* 0x2610 */   0,  0,  0,  0,170,  5,  0,  0,112, 26,  0,  0,  6,  0,  0,  0,
+/* 0x2620 */   0,  0,  0,  0,179,  5,  0,  0,118, 26,  0,  0,  7,  0,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,189,  5,  0,  0,125, 26,  0,  0, 14,  0,  0,  0,
+/* 0x2640 */   0,  0,  0,  0,199,  5,  0,  0,139, 26,  0,  0, 32,  0,  0,  0,
+/* 0x2650 */   0,  0,  0,  0,209,  5,  0,  0,171, 26,  0,  0, 10,  0,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,219,  5,  0,  0,181, 26,  0,  0,  5,  0,  0,  0,
+/* 0x2670 */   0,  0,  0,  0,229,  5,  0,  0,186, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2680 */   0,  0,  0,  0,238,  5,  0,  0,188, 26,  0,  0, 72,  1,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,247,  5,  0,  0,  4, 28,  0,  0,  0,  0,  0,  0,
+/* 0x26a0 */   0,  0,  0,  0,  0,  6,  0,  0,  4, 28,  0,  0,  0,  0,  0,  0,
+/* 0x26b0 */   0,  0,  0,  0,  9,  6,  0,  0,  4, 28,  0,  0,  0,  0,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0, 18,  6,  0,  0,  4, 28,  0,  0,  0,  0,  0,  0,
+/* 0x26d0 */   0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26e0 */  45,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x26f0 */   6,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2700 */   0,  0,  0,  0,108,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2710 */ 153,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,
+/* 0x2720 */  20,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0, 21,  0,  0,  0,
+/* 0x2730 */   0,  0,  0,  0,198,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2740 */ 216,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0,
+/* 0x2750 */  25,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 28,  0,  0,  0,
+/* 0x2760 */   0,  0,  0,  0, 23,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2770 */  68,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0,
+/* 0x2780 */  39,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2790 */   0,  0,  0,  0,113,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27a0 */ 131,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0,
+/* 0x27b0 */  44,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 47,  0,  0,  0,
+/* 0x27c0 */   0,  0,  0,  0,194,  1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27d0 */ 239,  1,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0, 10,  2,  0,  0,
+/* 0x27e0 */  58,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0, 59,  0,  0,  0,
+/* 0x27f0 */   0,  0,  0,  0, 83,  2,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2800 */ 146,  2,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,173,  2,  0,  0,
+/* 0x2810 */  75,  0,  0,  0,  0,  0,  0,  0,227,  2,  0,  0, 81,  0,  0,  0,
+/* 0x2820 */   0,  0,  0,  0, 52,  3,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2830 */  61,  3,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,115,  3,  0,  0,
+/* 0x2840 */  97,  0,  0,  0,  0,  0,  0,  0,214,  3,  0,  0,108,  0,  0,  0,
+/* 0x2850 */   0,  0,  0,  0, 84,  4,  0,  0,122,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2860 */  93,  4,  0,  0,123,  0,  0,  0,  0,  0,  0,  0,129,  4,  0,  0,
+/* 0x2870 */ 127,  0,  0,  0,  0,  0,  0,  0,219,  4,  0,  0,137,  0,  0,  0,
+/* 0x2880 */   0,  0,  0,  0,255,  4,  0,  0,141,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2890 */  98,  5,  0,  0,152,  0,  0,  0,  0,  0,  0,  0,107,  5,  0,  0,
+/* 0x28a0 */ 153,  0,  0,  0,  0,  0,  0,  0,179,  5,  0,  0,161,  0,  0,  0,
+/* 0x28b0 */   0,  0,  0,  0,189,  5,  0,  0,162,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28c0 */ 199,  5,  0,  0,163,  0,  0,  0,  0,  0,  0,  0,219,  5,  0,  0,
+/* 0x28d0 */ 165,  0,  0,  0,  0,  0,  0,  0,238,  5,  0,  0,167,  0,  0,  0,
+/* 0x28e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28f0 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2900 */   2,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2910 */   0,  0,  0,  0, 63,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2920 */  72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,
+/* 0x2930 */  10,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2940 */   0,  0,  0,  0,117,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2950 */ 126,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,135,  0,  0,  0,
+/* 0x2960 */  15,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0, 16,  0,  0,  0,
+/* 0x2970 */   0,  0,  0,  0,162,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2980 */ 171,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0,
+/* 0x2990 */  23,  0,  0,  0,  0,  0,  0,  0,234,  0,  0,  0, 26,  0,  0,  0,
+/* 0x29a0 */   0,  0,  0,  0,243,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29b0 */   5,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0, 14,  1,  0,  0,
+/* 0x29c0 */  30,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0, 32,  0,  0,  0,
+/* 0x29d0 */   0,  0,  0,  0, 41,  1,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,
+/* 0x29e0 */  50,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0,
+/* 0x29f0 */  35,  0,  0,  0,  0,  0,  0,  0, 77,  1,  0,  0, 37,  0,  0,  0,
+/* 0x2a00 */   0,  0,  0,  0, 86,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a10 */ 122,  1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0,
+/* 0x2a20 */  45,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 46,  0,  0,  0,
+/* 0x2a30 */   0,  0,  0,  0,176,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a40 */ 185,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0,
+/* 0x2a50 */  51,  0,  0,  0,  0,  0,  0,  0,212,  1,  0,  0, 52,  0,  0,  0,
+/* 0x2a60 */   0,  0,  0,  0,221,  1,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a70 */ 230,  1,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,248,  1,  0,  0,
+/* 0x2a80 */  56,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0, 57,  0,  0,  0,
+/* 0x2a90 */   0,  0,  0,  0, 28,  2,  0,  0, 60,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2aa0 */  39,  2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0, 50,  2,  0,  0,
+/* 0x2ab0 */  62,  0,  0,  0,  0,  0,  0,  0, 61,  2,  0,  0, 63,  0,  0,  0,
+/* 0x2ac0 */   0,  0,  0,  0, 72,  2,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ad0 */  92,  2,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,101,  2,  0,  0,
+/* 0x2ae0 */  67,  0,  0,  0,  0,  0,  0,  0,110,  2,  0,  0, 68,  0,  0,  0,
+/* 0x2af0 */   0,  0,  0,  0,119,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b00 */ 128,  2,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,137,  2,  0,  0,
+/* 0x2b10 */  71,  0,  0,  0,  0,  0,  0,  0,155,  2,  0,  0, 73,  0,  0,  0,
+/* 0x2b20 */   0,  0,  0,  0,164,  2,  0,  0, 74,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b30 */ 182,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,191,  2,  0,  0,
+/* 0x2b40 */  77,  0,  0,  0,  0,  0,  0,  0,200,  2,  0,  0, 78,  0,  0,  0,
+/* 0x2b50 */   0,  0,  0,  0,209,  2,  0,  0, 79,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b60 */ 218,  2,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,236,  2,  0,  0,
+/* 0x2b70 */  82,  0,  0,  0,  0,  0,  0,  0,245,  2,  0,  0, 83,  0,  0,  0,
+/* 0x2b80 */   0,  0,  0,  0,254,  2,  0,  0, 84,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b90 */   7,  3,  0,  0, 85,  0,  0,  0,  0,  0,  0,  0, 16,  3,  0,  0,
+/* 0x2ba0 */  86,  0,  0,  0,  0,  0,  0,  0, 25,  3,  0,  0, 87,  0,  0,  0,
+/* 0x2bb0 */   0,  0,  0,  0, 34,  3,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bc0 */  43,  3,  0,  0, 89,  0,  0,  0,  0,  0,  0,  0, 70,  3,  0,  0,
+/* 0x2bd0 */  92,  0,  0,  0,  0,  0,  0,  0, 79,  3,  0,  0, 93,  0,  0,  0,
+/* 0x2be0 */   0,  0,  0,  0, 88,  3,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bf0 */  97,  3,  0,  0, 95,  0,  0,  0,  0,  0,  0,  0,106,  3,  0,  0,
+/* 0x2c00 */  96,  0,  0,  0,  0,  0,  0,  0,124,  3,  0,  0, 98,  0,  0,  0,
+/* 0x2c10 */   0,  0,  0,  0,133,  3,  0,  0, 99,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c20 */ 142,  3,  0,  0,100,  0,  0,  0,  0,  0,  0,  0,151,  3,  0,  0,
+/* 0x2c30 */ 101,  0,  0,  0,  0,  0,  0,  0,160,  3,  0,  0,102,  0,  0,  0,
+/* 0x2c40 */   0,  0,  0,  0,169,  3,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c50 */ 178,  3,  0,  0,104,  0,  0,  0,  0,  0,  0,  0,187,  3,  0,  0,
+/* 0x2c60 */ 105,  0,  0,  0,  0,  0,  0,  0,196,  3,  0,  0,106,  0,  0,  0,
+/* 0x2c70 */   0,  0,  0,  0,205,  3,  0,  0,107,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c80 */ 223,  3,  0,  0,109,  0,  0,  0,  0,  0,  0,  0,232,  3,  0,  0,
+/* 0x2c90 */ 110,  0,  0,  0,  0,  0,  0,  0,241,  3,  0,  0,111,  0,  0,  0,
+/* 0x2ca0 */   0,  0,  0,  0,250,  3,  0,  0,112,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cb0 */   3,  4,  0,  0,113,  0,  0,  0,  0,  0,  0,  0, 12,  4,  0,  0,
+/* 0x2cc0 */ 114,  0,  0,  0,  0,  0,  0,  0, 21,  4,  0,  0,115,  0,  0,  0,
+/* 0x2cd0 */   0,  0,  0,  0, 30,  4,  0,  0,116,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ce0 */  39,  4,  0,  0,117,  0,  0,  0,  0,  0,  0,  0, 48,  4,  0,  0,
+/* 0x2cf0 */ 118,  0,  0,  0,  0,  0,  0,  0, 57,  4,  0,  0,119,  0,  0,  0,
+/* 0x2d00 */   0,  0,  0,  0, 66,  4,  0,  0,120,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d10 */  75,  4,  0,  0,121,  0,  0,  0,  0,  0,  0,  0,102,  4,  0,  0,
+/* 0x2d20 */ 124,  0,  0,  0,  0,  0,  0,  0,111,  4,  0,  0,125,  0,  0,  0,
+/* 0x2d30 */   0,  0,  0,  0,120,  4,  0,  0,126,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d40 */ 138,  4,  0,  0,128,  0,  0,  0,  0,  0,  0,  0,147,  4,  0,  0,
+/* 0x2d50 */ 129,  0,  0,  0,  0,  0,  0,  0,156,  4,  0,  0,130,  0,  0,  0,
+/* 0x2d60 */   0,  0,  0,  0,165,  4,  0,  0,131,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d70 */ 174,  4,  0,  0,132,  0,  0,  0,  0,  0,  0,  0,183,  4,  0,  0,
+/* 0x2d80 */ 133,  0,  0,  0,  0,  0,  0,  0,192,  4,  0,  0,134,  0,  0,  0,
+/* 0x2d90 */   0,  0,  0,  0,201,  4,  0,  0,135,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2da0 */ 210,  4,  0,  0,136,  0,  0,  0,  0,  0,  0,  0,228,  4,  0,  0,
+/* 0x2db0 */ 138,  0,  0,  0,  0,  0,  0,  0,237,  4,  0,  0,139,  0,  0,  0,
+/* 0x2dc0 */   0,  0,  0,  0,246,  4,  0,  0,140,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2dd0 */   8,  5,  0,  0,142,  0,  0,  0,  0,  0,  0,  0, 17,  5,  0,  0,
+/* 0x2de0 */ 143,  0,  0,  0,  0,  0,  0,  0, 26,  5,  0,  0,144,  0,  0,  0,
+/* 0x2df0 */   0,  0,  0,  0, 35,  5,  0,  0,145,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e00 */  44,  5,  0,  0,146,  0,  0,  0,  0,  0,  0,  0, 53,  5,  0,  0,
+/* 0x2e10 */ 147,  0,  0,  0,  0,  0,  0,  0, 62,  5,  0,  0,148,  0,  0,  0,
+/* 0x2e20 */   0,  0,  0,  0, 71,  5,  0,  0,149,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e30 */  80,  5,  0,  0,150,  0,  0,  0,  0,  0,  0,  0, 89,  5,  0,  0,
+/* 0x2e40 */ 151,  0,  0,  0,  0,  0,  0,  0,116,  5,  0,  0,154,  0,  0,  0,
+/* 0x2e50 */   0,  0,  0,  0,125,  5,  0,  0,155,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e60 */ 134,  5,  0,  0,156,  0,  0,  0,  0,  0,  0,  0,143,  5,  0,  0,
+/* 0x2e70 */ 157,  0,  0,  0,  0,  0,  0,  0,152,  5,  0,  0,158,  0,  0,  0,
+/* 0x2e80 */   0,  0,  0,  0,161,  5,  0,  0,159,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e90 */ 170,  5,  0,  0,160,  0,  0,  0,  0,  0,  0,  0,209,  5,  0,  0,
+/* 0x2ea0 */ 164,  0,  0,  0,  0,  0,  0,  0,229,  5,  0,  0,166,  0,  0,  0,
+/* 0x2eb0 */   0,  0,  0,  0,247,  5,  0,  0,168,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ec0 */   0,  6,  0,  0,169,  0,  0,  0,  0,  0,  0,  0,  9,  6,  0,  0,
+/* 0x2ed0 */ 170,  0,  0,  0,  0,  0,  0,  0, 18,  6,  0,  0,171,  0,  0,  0,
+/* 0x2ee0 */   0,  0,  0,  0, 27,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ef0 */  34,  6,  0,  0,173,  0,  0,  0,173,222,173,222, 52,  6,  0,  0,
+/* 0x2f00 */ 173,  0,  0,  0,173,222,173,222, 63,  6,  0,  0,173,  0,  0,  0,
+/* 0x2f10 */ 173,222,173,222, 74,  6,  0,  0,173,  0,  0,  0,173,222,173,222,
+/* 0x2f20 */  90,  6,  0,  0,173,  0,  0,  0,173,222,173,222,104,  6,  0,  0,
+/* 0x2f30 */ 173,  0,  0,  0,173,222,173,222,115,  6,  0,  0,173,  0,  0,  0,
+/* 0x2f40 */ 173,222,173,222,  0,  0,  0,  0,  5,  0,  0,  0,120,  6,  0,  0,
+/* 0x2f50 */ 238,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2f60 */   1,  0,  0,  0,131,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f70 */   0,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x2f80 */  54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2f90 */   1,  0,  0,  0,131,  6,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fa0 */   0,  0,  0,  0,  8,  0,  0,  0,  3,  0,  0,  0,131,  6,  0,  0,
+/* 0x2fb0 */  45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x2fc0 */  12,  0,  0,  0,131,  6,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fd0 */   0,  0,  0,  0, 11,  0,  0,  0,  3,  0,  0,  0,131,  6,  0,  0,
+/* 0x2fe0 */  81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2ff0 */  14,  0,  0,  0,131,  6,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */   0,  0,  0,  0, 12,  0,  0,  0, 17,  0,  0,  0,131,  6,  0,  0,
+/* 0x3010 */ 189,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x3020 */  47,  0,  0,  0,131,  6,  0,  0,153,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */   0,  0,  0,  0, 13,  0,  0,  0, 12,  0,  0,  0,131,  6,  0,  0,
+/* 0x3040 */ 108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,
+/* 0x3050 */   3,  0,  0,  0,131,  6,  0,  0,108,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3060 */   0,  0,  0,  0, 14,  0,  0,  0, 14,  0,  0,  0,131,  6,  0,  0,
+/* 0x3070 */ 108,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x3080 */   8,  0,  0,  0,120,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3090 */   0,  0,  0,  0, 19,  0,  0,  0, 10,  0,  0,  0,131,  6,  0,  0,
+/* 0x30a0 */ 180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,
+/* 0x30b0 */  21,  0,  0,  0,120,  6,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30c0 */   0,  0,  0,  0, 20,  0,  0,  0, 18,  0,  0,  0,120,  6,  0,  0,
+/* 0x30d0 */  54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,
+/* 0x30e0 */   1,  0,  0,  0,131,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30f0 */   0,  0,  0,  0, 23,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3100 */ 225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
+/* 0x3110 */   1,  0,  0,  0,131,  6,  0,  0,198,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3120 */   0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,131,  6,  0,  0,
+/* 0x3130 */ 216,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,
+/* 0x3140 */  12,  0,  0,  0,131,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3150 */   0,  0,  0,  0, 30,  0,  0,  0,  5,  0,  0,  0,131,  6,  0,  0,
+/* 0x3160 */  23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x3170 */  14,  0,  0,  0,131,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3180 */   0,  0,  0,  0, 31,  0,  0,  0, 15,  0,  0,  0,131,  6,  0,  0,
+/* 0x3190 */ 252,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,
+/* 0x31a0 */  33,  0,  0,  0,131,  6,  0,  0,104,  1,  0,  0,  0,  0,  0,  0,
+/* 0x31b0 */   0,  0,  0,  0, 31,  0,  0,  0, 67,  0,  0,  0,131,  6,  0,  0,
+/* 0x31c0 */  68,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,
+/* 0x31d0 */  12,  0,  0,  0,131,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,
+/* 0x31e0 */   0,  0,  0,  0, 33,  0,  0,  0,  3,  0,  0,  0,131,  6,  0,  0,
+/* 0x31f0 */  23,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x3200 */  14,  0,  0,  0,131,  6,  0,  0, 23,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3210 */   0,  0,  0,  0, 37,  0,  0,  0,  8,  0,  0,  0,120,  6,  0,  0,
+/* 0x3220 */ 225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,
+/* 0x3230 */  10,  0,  0,  0,131,  6,  0,  0, 95,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3240 */   0,  0,  0,  0, 38,  0,  0,  0, 21,  0,  0,  0,120,  6,  0,  0,
+/* 0x3250 */ 225,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,
+/* 0x3260 */  18,  0,  0,  0,120,  6,  0,  0,225,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3270 */   0,  0,  0,  0, 41,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3280 */ 140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,
+/* 0x3290 */   1,  0,  0,  0,131,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,  0,
+/* 0x32a0 */   0,  0,  0,  0, 45,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x32b0 */ 113,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,
+/* 0x32c0 */   3,  0,  0,  0,131,  6,  0,  0,131,  1,  0,  0,  0,  0,  0,  0,
+/* 0x32d0 */   0,  0,  0,  0, 48,  0,  0,  0, 12,  0,  0,  0,131,  6,  0,  0,
+/* 0x32e0 */ 194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,
+/* 0x32f0 */   5,  0,  0,  0,131,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3300 */   0,  0,  0,  0, 49,  0,  0,  0, 14,  0,  0,  0,131,  6,  0,  0,
+/* 0x3310 */ 194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,
+/* 0x3320 */  15,  0,  0,  0,131,  6,  0,  0,167,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3330 */   0,  0,  0,  0, 50,  0,  0,  0, 30,  0,  0,  0,131,  6,  0,  0,
+/* 0x3340 */ 239,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,
+/* 0x3350 */  48,  0,  0,  0,131,  6,  0,  0, 19,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3360 */   0,  0,  0,  0, 51,  0,  0,  0, 12,  0,  0,  0,131,  6,  0,  0,
+/* 0x3370 */ 194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x3380 */   3,  0,  0,  0,131,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3390 */   0,  0,  0,  0, 52,  0,  0,  0, 14,  0,  0,  0,131,  6,  0,  0,
+/* 0x33a0 */ 194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,
+/* 0x33b0 */   8,  0,  0,  0,120,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,  0,
+/* 0x33c0 */   0,  0,  0,  0, 57,  0,  0,  0, 10,  0,  0,  0,131,  6,  0,  0,
+/* 0x33d0 */  10,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,
+/* 0x33e0 */  21,  0,  0,  0,120,  6,  0,  0,140,  1,  0,  0,  0,  0,  0,  0,
+/* 0x33f0 */   0,  0,  0,  0, 58,  0,  0,  0, 18,  0,  0,  0,120,  6,  0,  0,
+/* 0x3400 */ 140,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,
+/* 0x3410 */   5,  0,  0,  0,141,  6,  0,  0, 34,  6,  0,  0,  0,  0,  0,  0,
+/* 0x3420 */   0,  0,  0,  0, 60,  0,  0,  0, 20,  0,  0,  0,141,  6,  0,  0,
+/* 0x3430 */  52,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,
+/* 0x3440 */  30,  0,  0,  0,141,  6,  0,  0, 63,  6,  0,  0,  0,  0,  0,  0,
+/* 0x3450 */   0,  0,  0,  0, 60,  0,  0,  0, 42,  0,  0,  0,141,  6,  0,  0,
+/* 0x3460 */  74,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,
+/* 0x3470 */   1,  0,  0,  0,141,  6,  0,  0, 90,  6,  0,  0,  0,  0,  0,  0,
+/* 0x3480 */   0,  0,  0,  0, 66,  0,  0,  0,  2,  0,  0,  0,150,  6,  0,  0,
+/* 0x3490 */ 104,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,
+/* 0x34a0 */   4,  0,  0,  0,131,  6,  0,  0, 83,  2,  0,  0,  0,  0,  0,  0,
+/* 0x34b0 */   0,  0,  0,  0, 71,  0,  0,  0, 13,  0,  0,  0,131,  6,  0,  0,
+/* 0x34c0 */  83,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 72,  0,  0,  0,
+/* 0x34d0 */   1,  0,  0,  0,141,  6,  0,  0, 90,  6,  0,  0,  0,  0,  0,  0,
+/* 0x34e0 */   0,  0,  0,  0, 75,  0,  0,  0,  3,  0,  0,  0,131,  6,  0,  0,
+/* 0x34f0 */ 227,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,
+/* 0x3500 */   2,  0,  0,  0,150,  6,  0,  0,104,  6,  0,  0,  0,  0,  0,  0,
+/* 0x3510 */   0,  0,  0,  0, 76,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x3520 */ 173,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81,  0,  0,  0,
+/* 0x3530 */   4,  0,  0,  0,131,  6,  0,  0,146,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3540 */   0,  0,  0,  0, 83,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3550 */  52,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0,
+/* 0x3560 */   1,  0,  0,  0,141,  6,  0,  0,115,  6,  0,  0,  0,  0,  0,  0,
+/* 0x3570 */   0,  0,  0,  0, 90,  0,  0,  0,  1,  0,  0,  0,120,  6,  0,  0,
+/* 0x3580 */ 129,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 94,  0,  0,  0,
+/* 0x3590 */   1,  0,  0,  0,131,  6,  0,  0,107,  5,  0,  0,  0,  0,  0,  0,
+/* 0x35a0 */   0,  0,  0,  0, 95,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x35b0 */ 107,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0,
+/* 0x35c0 */   2,  0,  0,  0,131,  6,  0,  0, 93,  4,  0,  0,  0,  0,  0,  0,
+/* 0x35d0 */   0,  0,  0,  0,102,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x35e0 */  93,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,103,  0,  0,  0,
+/* 0x35f0 */   4,  0,  0,  0,131,  6,  0,  0,214,  3,  0,  0,  0,  0,  0,  0,
+/* 0x3600 */   0,  0,  0,  0,108,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x3610 */  93,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,
+/* 0x3620 */   6,  0,  0,  0,131,  6,  0,  0, 84,  4,  0,  0,  0,  0,  0,  0,
+/* 0x3630 */   0,  0,  0,  0,126,  0,  0,  0,  6,  0,  0,  0,131,  6,  0,  0,
+/* 0x3640 */ 107,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,
+/* 0x3650 */   1,  0,  0,  0,120,  6,  0,  0,129,  4,  0,  0,  0,  0,  0,  0,
+/* 0x3660 */   0,  0,  0,  0,140,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3670 */ 219,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,142,  0,  0,  0,
+/* 0x3680 */   7,  0,  0,  0,131,  6,  0,  0, 61,  3,  0,  0,  0,  0,  0,  0,
+/* 0x3690 */   0,  0,  0,  0,146,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x36a0 */ 115,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,148,  0,  0,  0,
+/* 0x36b0 */   1,  0,  0,  0,131,  6,  0,  0,115,  3,  0,  0,  0,  0,  0,  0,
+/* 0x36c0 */   0,  0,  0,  0,149,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x36d0 */ 107,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,150,  0,  0,  0,
+/* 0x36e0 */   1,  0,  0,  0,131,  6,  0,  0, 98,  5,  0,  0,  0,  0,  0,  0,
+/* 0x36f0 */   0,  0,  0,  0,151,  0,  0,  0,  1,  0,  0,  0,131,  6,  0,  0,
+/* 0x3700 */  98,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,152,  0,  0,  0,
+/* 0x3710 */   2,  0,  0,  0,131,  6,  0,  0,115,  3,  0,  0,  0,  0,  0,  0,
+/* 0x3720 */   0,  0,  0,  0,153,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x3730 */ 255,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,161,  0,  0,  0,
+/* 0x3740 */   3,  0,  0,  0,131,  6,  0,  0,199,  5,  0,  0,  0,  0,  0,  0,
+/* 0x3750 */   0,  0,  0,  0,162,  0,  0,  0, 13,  0,  0,  0,131,  6,  0,  0,
+/* 0x3760 */ 199,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0,
+/* 0x3770 */   5,  0,  0,  0,131,  6,  0,  0,219,  5,  0,  0,  0,  0,  0,  0,
+/* 0x3780 */   0,  0,  0,  0,163,  0,  0,  0, 10,  0,  0,  0,131,  6,  0,  0,
+/* 0x3790 */ 219,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,163,  0,  0,  0,
+/* 0x37a0 */  16,  0,  0,  0,131,  6,  0,  0,219,  5,  0,  0,  0,  0,  0,  0,
+/* 0x37b0 */   0,  0,  0,  0,164,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x37c0 */ 219,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,164,  0,  0,  0,
+/* 0x37d0 */   9,  0,  0,  0,131,  6,  0,  0,189,  5,  0,  0,  0,  0,  0,  0,
+/* 0x37e0 */   0,  0,  0,  0,165,  0,  0,  0,  4,  0,  0,  0,131,  6,  0,  0,
+/* 0x37f0 */ 179,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76, 69, 88, 69,
+/* 0x3800 */  67, 48, 48, 48,  0, 76, 69, 88, 69, 67, 48, 48, 57,  0, 76, 69,
+/* 0x3810 */  88, 69, 67, 48, 49, 48,  0, 78, 50, 66, 83, 77, 65, 49, 48,  0,
+/* 0x3820 */  78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70, 65, 83, 49,
+/* 0x3830 */  49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50, 66, 83, 77,
+/* 0x3840 */  65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0, 78, 50, 66,
+/* 0x3850 */  68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51, 48,  0, 78,
+/* 0x3860 */  50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69, 67, 51, 48,
+/* 0x3870 */   0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66, 70, 65, 83,
+/* 0x3880 */  52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78, 50, 66, 70,
+/* 0x3890 */  65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,  0, 78, 50,
+/* 0x38a0 */  66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 48,  0,
+/* 0x38b0 */  78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68, 69, 67, 54,
+/* 0x38c0 */  48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50, 68, 70, 65,
+/* 0x38d0 */  83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0, 78, 50, 68,
+/* 0x38e0 */  68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50, 48,  0, 78,
+/* 0x38f0 */  50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69, 67, 50, 48,
+/* 0x3900 */   0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x3910 */  51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78, 50, 68, 83,
+/* 0x3920 */  77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,  0, 78, 50,
+/* 0x3930 */  68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83, 53, 48,  0,
+/* 0x3940 */  78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83, 77, 65, 54,
+/* 0x3950 */  48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50, 68, 70, 65,
+/* 0x3960 */  83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0, 78, 50, 69,
+/* 0x3970 */  83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49, 48,  0, 78,
+/* 0x3980 */  50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69, 67, 49, 48,
+/* 0x3990 */   0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69, 70, 65, 83,
+/* 0x39a0 */  50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78, 50, 69, 83,
+/* 0x39b0 */  77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,  0, 78, 50,
+/* 0x39c0 */  69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65, 52, 48,  0,
+/* 0x39d0 */  78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83, 77, 65, 53,
+/* 0x39e0 */  48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50, 69, 68, 69,
+/* 0x39f0 */  67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0, 78, 50, 69,
+/* 0x3a00 */  70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54, 49,  0, 78,
+/* 0x3a10 */  50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x3a20 */  48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x3a30 */  77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x3a40 */  67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 67,
+/* 0x3a50 */  65, 76, 76, 84, 82, 48, 48,  0, 67, 84, 67, 76, 69, 86, 69, 49,
+/* 0x3a60 */   0, 67, 65, 76, 76, 84, 82, 48, 49,  0, 67, 84, 66, 83, 72, 82,
+/* 0x3a70 */  48, 49,  0, 67, 84, 66, 82, 79, 82, 48, 49,  0, 67, 84, 66, 83,
+/* 0x3a80 */  87, 65, 48, 49,  0, 67, 65, 76, 76, 84, 82, 48, 50,  0, 67, 65,
+/* 0x3a90 */  76, 76, 84, 82, 49, 48,  0, 67, 65, 76, 76, 84, 82, 69, 56,  0,
+/* 0x3aa0 */  67, 65, 76, 76, 84, 82, 69, 57,  0, 67, 65, 76, 76, 84, 82, 49,
+/* 0x3ab0 */  49,  0, 67, 84, 67, 76, 69, 86, 69, 50,  0, 67, 65, 76, 76, 84,
+/* 0x3ac0 */  82, 49, 50,  0, 67, 84, 66, 83, 72, 82, 49, 49,  0, 67, 84, 66,
+/* 0x3ad0 */  82, 79, 82, 49, 49,  0, 67, 84, 66, 83, 87, 65, 49, 49,  0, 67,
+/* 0x3ae0 */  65, 76, 76, 84, 82, 49, 51,  0, 76, 69, 88, 69, 67, 48, 49, 53,
+/* 0x3af0 */   0, 76, 88, 85, 78, 70, 48, 48, 48,  0, 76, 88, 85, 78, 70, 48,
+/* 0x3b00 */  48, 50,  0, 77, 82, 85, 66, 89, 84, 69, 48,  0, 76, 88, 77, 82,
+/* 0x3b10 */  85, 48, 48, 53,  0, 76, 88, 77, 82, 85, 48, 48, 54,  0, 76, 88,
+/* 0x3b20 */  77, 82, 85, 48, 48, 55,  0, 76, 88, 85, 78, 70, 48, 48, 56,  0,
+/* 0x3b30 */  76, 88, 85, 78, 70, 48, 49, 48,  0, 76, 88, 74, 67, 67, 48, 49,
+/* 0x3b40 */  48,  0, 76, 88, 77, 82, 85, 48, 52, 53,  0, 76, 88, 77, 82, 85,
+/* 0x3b50 */  48, 52, 54,  0, 76, 88, 74, 67, 67, 48, 50, 48,  0, 76, 88, 74,
+/* 0x3b60 */  67, 67, 48, 50, 49,  0, 76, 88, 74, 67, 67, 48, 50, 51,  0, 76,
+/* 0x3b70 */  88, 85, 78, 70, 48, 51, 55,  0, 76, 88, 85, 78, 70, 51, 56, 54,
+/* 0x3b80 */   0, 76, 88, 85, 78, 70, 51, 56, 55,  0, 76, 88, 85, 78, 70, 51,
+/* 0x3b90 */  56, 56,  0, 76, 88, 85, 78, 70, 52, 56, 54,  0, 76, 88, 85, 78,
+/* 0x3ba0 */  70, 52, 56, 55,  0, 76, 88, 77, 82, 85, 48, 54, 53,  0, 77, 82,
+/* 0x3bb0 */  85, 66, 89, 84, 69, 51,  0, 77, 82, 85, 65, 82, 66, 51, 48,  0,
+/* 0x3bc0 */  77, 82, 85, 66, 73, 84, 83, 51,  0, 77, 82, 85, 65, 82, 66, 52,
+/* 0x3bd0 */  48,  0, 76, 88, 77, 82, 85, 48, 55, 48,  0, 77, 82, 85, 66, 89,
+/* 0x3be0 */  84, 69, 52,  0, 77, 82, 85, 66, 73, 84, 83, 52,  0, 77, 82, 85,
+/* 0x3bf0 */  65, 82, 66, 53, 48,  0, 76, 88, 77, 82, 85, 48, 56, 48,  0, 77,
+/* 0x3c00 */  82, 85, 66, 89, 84, 69, 53,  0, 77, 82, 85, 65, 82, 66, 54, 48,
+/* 0x3c10 */   0, 77, 82, 85, 66, 73, 84, 83, 53,  0, 77, 82, 85, 65, 82, 66,
+/* 0x3c20 */  55, 48,  0, 76, 88, 77, 82, 85, 48, 57, 48,  0, 77, 82, 85, 66,
+/* 0x3c30 */  89, 84, 69, 54,  0, 77, 82, 85, 65, 82, 66, 56, 48,  0, 77, 82,
+/* 0x3c40 */  85, 66, 73, 84, 83, 54,  0, 77, 82, 85, 65, 82, 66, 57, 48,  0,
+/* 0x3c50 */  76, 88, 77, 82, 85, 49, 48, 48,  0, 76, 88, 85, 78, 70, 48, 52,
+/* 0x3c60 */  48,  0, 76, 88, 77, 82, 85, 49, 49, 48,  0, 76, 88, 77, 82, 85,
+/* 0x3c70 */  49, 49, 49,  0, 76, 88, 85, 78, 70, 48, 52, 49,  0, 76, 88, 85,
+/* 0x3c80 */  78, 70, 48, 52, 50,  0, 76, 69, 88, 69, 67, 48, 49, 54,  0, 76,
+/* 0x3c90 */  88, 77, 82, 85, 48, 49, 48,  0, 76, 88, 74, 77, 80, 65, 48, 48,
+/* 0x3ca0 */   0, 76, 88, 67, 65, 76, 76, 66, 48,  0, 76, 88, 85, 78, 70, 48,
+/* 0x3cb0 */  50, 49,  0, 76, 88, 77, 82, 85, 48, 50, 50,  0, 76, 88, 74, 77,
+/* 0x3cc0 */  80, 65, 48, 49,  0, 76, 88, 67, 65, 76, 76, 66, 49,  0, 77, 82,
+/* 0x3cd0 */  85, 66, 73, 84, 83, 49,  0, 76, 88, 77, 82, 85, 48, 51, 48,  0,
+/* 0x3ce0 */  77, 82, 85, 66, 89, 84, 69, 49,  0, 77, 82, 85, 65, 82, 66, 49,
+/* 0x3cf0 */  48,  0, 76, 88, 77, 82, 85, 48, 52, 48,  0, 76, 88, 85, 78, 70,
+/* 0x3d00 */  48, 51, 48,  0, 76, 88, 74, 67, 67, 48, 48, 48,  0, 76, 88, 67,
+/* 0x3d10 */  74, 48, 77, 82, 85,  0, 76, 88, 67, 74, 49, 77, 82, 85,  0, 76,
+/* 0x3d20 */  88, 67, 65, 76, 74, 77, 80,  0, 76, 88, 67, 65, 76, 76, 48, 48,
+/* 0x3d30 */   0, 76, 88, 67, 65, 76, 76, 48, 49,  0, 76, 88, 67, 74, 50, 77,
+/* 0x3d40 */  82, 85,  0, 76, 88, 67, 74, 52, 77, 82, 85,  0, 76, 88, 67, 74,
+/* 0x3d50 */  54, 77, 82, 85,  0, 76, 88, 67, 74, 55, 77, 82, 85,  0, 76, 88,
+/* 0x3d60 */  67, 74, 56, 77, 82, 85,  0, 76, 88, 85, 78, 70, 48, 51, 52,  0,
+/* 0x3d70 */  76, 88, 77, 82, 85, 48, 53, 53,  0, 77, 82, 85, 66, 89, 84, 69,
+/* 0x3d80 */  50,  0, 77, 82, 85, 66, 73, 84, 83, 50,  0, 77, 82, 85, 65, 82,
+/* 0x3d90 */  66, 50, 48,  0, 76, 88, 77, 82, 85, 48, 53, 55,  0, 76, 88, 77,
+/* 0x3da0 */  82, 85, 48, 53, 56,  0, 76, 88, 85, 78, 70, 48, 51, 53,  0, 99,
+/* 0x3db0 */ 116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,107, 51, 50, 46,
+/* 0x3dc0 */  49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,  0, 99,116,111,
+/* 0x3dd0 */ 107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51, 50, 46, 52, 48,
+/* 0x3de0 */   0, 76, 69, 88, 69, 67, 48, 49, 55,  0, 76, 69, 88, 69, 67, 48,
+/* 0x3df0 */  50, 48,  0, 76, 85, 78, 77, 80, 48, 48, 48,  0, 76, 85, 78, 77,
+/* 0x3e00 */  80, 48, 48, 49,  0, 76, 69, 88, 69, 67, 48, 50, 53,  0, 76, 69,
+/* 0x3e10 */  88, 69, 67, 68, 89, 78,  0, 95,115,116, 97,114,116,  0,108,122,
+/* 0x3e20 */ 109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,115,116,  0,
+/* 0x3e30 */ 108,122,109, 97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95,
+/* 0x3e40 */  99, 95,108,101,110,  0,108,122,109, 97, 95,112,114,111,112,101,
+/* 0x3e50 */ 114,116,105,101,115,  0,102,105,108,116,101,114, 95,108,101,110,
+/* 0x3e60 */ 103,116,104,  0,102,105,108,116,101,114, 95, 99,116,111,  0, 78,
+/* 0x3e70 */  77, 82, 85,  0, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50,  0, 82,
+/* 0x3e80 */  95, 51, 56, 54, 95, 80, 67, 56,  0, 82, 95, 51, 56, 54, 95, 51,
+/* 0x3e90 */  50,  0, 82, 95, 51, 56, 54, 95, 56,  0,  4, 28,  0,  0, 85, 80,
+/* 0x3ea0 */  88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* i386-win32.pe.h
-   created from i386-win32.pe.bin, 27890 (0x6cf2) bytes
+   created from i386-win32.pe.bin, 14937 (0x3a59) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_I386_WIN32_PE_SIZE    27890
-#define STUB_I386_WIN32_PE_ADLER32 0xc149ed7a
-#define STUB_I386_WIN32_PE_CRC32   0x0a7a4370
+#define STUB_I386_WIN32_PE_SIZE    14937
+#define STUB_I386_WIN32_PE_ADLER32 0x53f37918
+#define STUB_I386_WIN32_PE_CRC32   0x3db2a7ad
 
-unsigned char stub_i386_win32_pe[27890] = {
+unsigned char stub_i386_win32_pe[14937] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  3,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 208, 32,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -470,1314 +470,504 @@ unsigned char stub_i386_win32_pe[27890] = {
 /* 0x1af0 */ 192,116, 13,106,  3, 89,255,116, 36, 16,226,250,255,208,235,238,
 /* 0x1b00 */  94,194, 12,  0, 85, 80, 88, 33,161,216,208,213,  0,  0,  0,  0,
 /* 0x1b10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x1b20 */   0,  0,  0, 45,102,105,108,101, 32,102,111,114,109, 97,116, 32,
-/* 0x1b30 */ 101,108,102, 51, 50, 45,105, 51, 56, 54, 10, 10, 83,101, 99,116,
-/* 0x1b40 */ 105,111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32,
-/* 0x1b50 */  32, 32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32,
-/* 0x1b60 */  32, 32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32,
-/* 0x1b70 */  32, 32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32,
-/* 0x1b80 */  65,108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32,
-/* 0x1b90 */  80, 69, 73, 83, 68, 76, 76, 49, 32, 32, 32, 32, 32, 32, 48, 98,
-/* 0x1ba0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42,
-/* 0x1bb0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32,
-/* 0x1bc0 */  80, 69, 77, 65, 73, 78, 48, 49, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x1bd0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51,102, 32, 32, 50, 42, 42,
-/* 0x1be0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32,
-/* 0x1bf0 */  80, 69, 83, 79, 67, 82, 69, 76, 32, 32, 32, 32, 32, 32, 48, 53,
-/* 0x1c00 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42,
-/* 0x1c10 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32,
-/* 0x1c20 */  80, 69, 83, 79, 67, 80, 73, 67, 32, 32, 32, 32, 32, 32, 48, 99,
-/* 0x1c30 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 53, 32, 32, 50, 42, 42,
-/* 0x1c40 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32,
-/* 0x1c50 */  80, 69, 83, 79, 85, 78, 67, 48, 32, 32, 32, 32, 32, 32, 48, 54,
-/* 0x1c60 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 49, 32, 32, 50, 42, 42,
-/* 0x1c70 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32,
-/* 0x1c80 */  80, 69, 73, 67, 79, 78, 83, 49, 32, 32, 32, 32, 32, 32, 48, 55,
-/* 0x1c90 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 53, 55, 32, 32, 50, 42, 42,
-/* 0x1ca0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32,
-/* 0x1cb0 */  80, 69, 73, 67, 79, 78, 83, 50, 32, 32, 32, 32, 32, 32, 48, 57,
-/* 0x1cc0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 53,101, 32, 32, 50, 42, 42,
-/* 0x1cd0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32,
-/* 0x1ce0 */  80, 69, 84, 76, 83, 72, 65, 75, 32, 32, 32, 32, 32, 32, 48,102,
-/* 0x1cf0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 54, 55, 32, 32, 50, 42, 42,
-/* 0x1d00 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32,
-/* 0x1d10 */  80, 69, 77, 65, 73, 78, 48, 50, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x1d20 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 55, 54, 32, 32, 50, 42, 42,
-/* 0x1d30 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32,
-/* 0x1d40 */  80, 69, 77, 65, 73, 78, 48, 51, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x1d50 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 55, 55, 32, 32, 50, 42, 42,
-/* 0x1d60 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32,
-/* 0x1d70 */  78, 50, 66, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x1d80 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 55, 97, 32, 32, 50, 42, 42,
-/* 0x1d90 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32,
-/* 0x1da0 */  78, 50, 66, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x1db0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 55,100, 32, 32, 50, 42, 42,
-/* 0x1dc0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32,
-/* 0x1dd0 */  78, 50, 66, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54,
-/* 0x1de0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 55,102, 32, 32, 50, 42, 42,
-/* 0x1df0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32,
-/* 0x1e00 */  78, 50, 66, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98,
-/* 0x1e10 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 56, 53, 32, 32, 50, 42, 42,
-/* 0x1e20 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 52, 32,
-/* 0x1e30 */  78, 50, 66, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53,
-/* 0x1e40 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 48, 32, 32, 50, 42, 42,
-/* 0x1e50 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 53, 32,
-/* 0x1e60 */  78, 50, 66, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 55,
-/* 0x1e70 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 53, 32, 32, 50, 42, 42,
-/* 0x1e80 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 54, 32,
-/* 0x1e90 */  78, 50, 66, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,100,
-/* 0x1ea0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 99, 32, 32, 50, 42, 42,
-/* 0x1eb0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 55, 32,
-/* 0x1ec0 */  78, 50, 66, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32, 48,100,
-/* 0x1ed0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 97, 57, 32, 32, 50, 42, 42,
-/* 0x1ee0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 56, 32,
-/* 0x1ef0 */  78, 50, 66, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32, 32, 48,102,
-/* 0x1f00 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 98, 54, 32, 32, 50, 42, 42,
-/* 0x1f10 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 57, 32,
-/* 0x1f20 */  78, 50, 66, 68, 69, 67, 51, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x1f30 */ 101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 99, 53, 32, 32, 50, 42,
-/* 0x1f40 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 48,
-/* 0x1f50 */  32, 78, 50, 66, 83, 77, 65, 52, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1f60 */ 100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 48, 51, 32, 32, 50,
-/* 0x1f70 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x1f80 */  49, 32, 78, 50, 66, 70, 65, 83, 52, 48, 32, 32, 32, 32, 32, 32,
-/* 0x1f90 */  48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 49, 48, 32, 32,
-/* 0x1fa0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1fb0 */  50, 50, 32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 32, 32, 32, 32,
-/* 0x1fc0 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 49,102, 32,
-/* 0x1fd0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1fe0 */  32, 50, 51, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 32, 32, 32,
-/* 0x1ff0 */  32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 49,
-/* 0x2000 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2010 */  10, 32, 50, 52, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32, 32, 32,
-/* 0x2020 */  32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50,
-/* 0x2030 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2040 */  83, 10, 32, 50, 53, 32, 78, 50, 66, 83, 77, 65, 54, 48, 32, 32,
-/* 0x2050 */  32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2060 */  50,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2070 */  84, 83, 10, 32, 50, 54, 32, 78, 50, 66, 70, 65, 83, 54, 48, 32,
-/* 0x2080 */  32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2090 */  48, 49, 51, 98, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x20a0 */  69, 78, 84, 83, 10, 32, 50, 55, 32, 78, 50, 66, 70, 65, 83, 54,
-/* 0x20b0 */  49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48,
-/* 0x20c0 */  32, 32, 48, 49, 53, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x20d0 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 56, 32, 78, 50, 66, 68, 69,
-/* 0x20e0 */  67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x20f0 */  32, 32, 48, 49, 54, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2100 */  78, 84, 69, 78, 84, 83, 10, 32, 50, 57, 32, 78, 50, 68, 83, 77,
-/* 0x2110 */  65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32,
-/* 0x2120 */  48, 32, 32, 48, 49, 54, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2130 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 48, 32, 78, 50, 68, 70,
-/* 0x2140 */  65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32,
-/* 0x2150 */  32, 48, 32, 32, 48, 49, 54, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2160 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 49, 32, 78, 50, 68,
-/* 0x2170 */  70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48,
-/* 0x2180 */  32, 32, 48, 32, 32, 48, 49, 54, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2190 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 50, 32, 78, 50,
-/* 0x21a0 */  68, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32, 32, 48, 98, 32, 32,
-/* 0x21b0 */  48, 32, 32, 48, 32, 32, 48, 49, 55, 50, 32, 32, 50, 42, 42, 48,
-/* 0x21c0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 51, 32, 78,
-/* 0x21d0 */  50, 68, 83, 77, 65, 50, 48, 32, 32, 32, 32, 32, 32, 48, 53, 32,
-/* 0x21e0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 55,100, 32, 32, 50, 42, 42,
-/* 0x21f0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 52, 32,
-/* 0x2200 */  78, 50, 68, 70, 65, 83, 50, 48, 32, 32, 32, 32, 32, 32, 48, 55,
-/* 0x2210 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 50, 32, 32, 50, 42,
-/* 0x2220 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 53,
-/* 0x2230 */  32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2240 */ 100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 57, 32, 32, 50,
-/* 0x2250 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51,
-/* 0x2260 */  54, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2270 */  48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54, 32, 32,
-/* 0x2280 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2290 */  51, 55, 32, 78, 50, 68, 70, 65, 83, 51, 48, 32, 32, 32, 32, 32,
-/* 0x22a0 */  32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 51, 32,
-/* 0x22b0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x22c0 */  32, 51, 56, 32, 78, 50, 68, 68, 69, 67, 51, 48, 32, 32, 32, 32,
-/* 0x22d0 */  32, 32, 48, 53, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98,
-/* 0x22e0 */  50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x22f0 */  83, 10, 32, 51, 57, 32, 78, 50, 68, 83, 77, 65, 52, 48, 32, 32,
-/* 0x2300 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x2310 */  48, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2320 */  84, 83, 10, 32, 52, 48, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32,
-/* 0x2330 */  32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2340 */  50, 49, 49, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2350 */  78, 84, 83, 10, 32, 52, 49, 32, 78, 50, 68, 83, 77, 65, 53, 48,
-/* 0x2360 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2370 */  48, 50, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2380 */  69, 78, 84, 83, 10, 32, 52, 50, 32, 78, 50, 68, 70, 65, 83, 53,
-/* 0x2390 */  48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32, 32, 48, 32,
-/* 0x23a0 */  32, 48, 50, 50, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x23b0 */  84, 69, 78, 84, 83, 10, 32, 52, 51, 32, 78, 50, 68, 68, 69, 67,
-/* 0x23c0 */  53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32, 32, 48, 32, 32, 48,
-/* 0x23d0 */  32, 32, 48, 50, 50, 53, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x23e0 */  78, 84, 69, 78, 84, 83, 10, 32, 52, 52, 32, 78, 50, 68, 83, 77,
-/* 0x23f0 */  65, 54, 48, 32, 32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32,
-/* 0x2400 */  48, 32, 32, 48, 50, 50,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2410 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 53, 32, 78, 50, 68, 70,
-/* 0x2420 */  65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32, 32, 48,
-/* 0x2430 */  32, 32, 48, 32, 32, 48, 50, 51, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2440 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 54, 32, 78, 50,
-/* 0x2450 */  68, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32, 32, 48, 49, 54, 32,
-/* 0x2460 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 53, 50, 32, 32, 50, 42, 42,
-/* 0x2470 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 55, 32,
-/* 0x2480 */  78, 50, 68, 68, 69, 67, 54, 48, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x2490 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 54, 56, 32, 32, 50, 42, 42,
-/* 0x24a0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 56, 32,
-/* 0x24b0 */  78, 50, 69, 83, 77, 65, 49, 48, 32, 32, 32, 32, 32, 32, 48, 51,
-/* 0x24c0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 54, 56, 32, 32, 50, 42,
-/* 0x24d0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 57,
-/* 0x24e0 */  32, 78, 50, 69, 70, 65, 83, 49, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x24f0 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 54, 98, 32, 32, 50,
-/* 0x2500 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53,
-/* 0x2510 */  48, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 32, 32, 32, 32, 32,
-/* 0x2520 */  48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 54,100, 32, 32,
-/* 0x2530 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2540 */  53, 49, 32, 78, 50, 69, 68, 69, 67, 49, 48, 32, 32, 32, 32, 32,
-/* 0x2550 */  32, 48, 98, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55, 51, 32,
-/* 0x2560 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2570 */  32, 53, 50, 32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 32, 32, 32,
-/* 0x2580 */  32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 55,101,
-/* 0x2590 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x25a0 */  10, 32, 53, 51, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 32, 32,
-/* 0x25b0 */  32, 32, 32, 48, 55, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56,
-/* 0x25c0 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x25d0 */  83, 10, 32, 53, 52, 32, 78, 50, 69, 68, 69, 67, 50, 48, 32, 32,
-/* 0x25e0 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,
-/* 0x25f0 */  56, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2600 */  84, 83, 10, 32, 53, 53, 32, 78, 50, 69, 83, 77, 65, 51, 48, 32,
-/* 0x2610 */  32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2620 */  50, 57, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2630 */  78, 84, 83, 10, 32, 53, 54, 32, 78, 50, 69, 70, 65, 83, 51, 48,
-/* 0x2640 */  32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2650 */  48, 50, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2660 */  69, 78, 84, 83, 10, 32, 53, 55, 32, 78, 50, 69, 68, 69, 67, 51,
-/* 0x2670 */  48, 32, 32, 32, 32, 32, 32, 48, 53,102, 32, 32, 48, 32, 32, 48,
-/* 0x2680 */  32, 32, 48, 50, 98, 51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2690 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 56, 32, 78, 50, 69, 83, 77,
-/* 0x26a0 */  65, 52, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32,
-/* 0x26b0 */  48, 32, 32, 48, 51, 49, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x26c0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 57, 32, 78, 50, 69, 70,
-/* 0x26d0 */  65, 83, 52, 48, 32, 32, 32, 32, 32, 32, 48,102, 32, 32, 48, 32,
-/* 0x26e0 */  32, 48, 32, 32, 48, 51, 49,102, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x26f0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 48, 32, 78, 50, 69,
-/* 0x2700 */  83, 77, 65, 53, 48, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2710 */  32, 32, 48, 32, 32, 48, 51, 50,101, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2720 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 49, 32, 78, 50,
-/* 0x2730 */  69, 70, 65, 83, 53, 48, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32,
-/* 0x2740 */  48, 32, 32, 48, 32, 32, 48, 51, 51, 48, 32, 32, 50, 42, 42, 48,
-/* 0x2750 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 50, 32, 78,
-/* 0x2760 */  50, 69, 68, 69, 67, 53, 48, 32, 32, 32, 32, 32, 32, 48, 57, 32,
-/* 0x2770 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 51, 51, 32, 32, 50, 42, 42,
-/* 0x2780 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 51, 32,
-/* 0x2790 */  78, 50, 69, 83, 77, 65, 54, 48, 32, 32, 32, 32, 32, 32, 48,101,
-/* 0x27a0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 51, 99, 32, 32, 50, 42,
-/* 0x27b0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 54, 52,
-/* 0x27c0 */  32, 78, 50, 69, 70, 65, 83, 54, 48, 32, 32, 32, 32, 32, 32, 48,
-/* 0x27d0 */  49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 52, 97, 32, 32,
-/* 0x27e0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x27f0 */  54, 53, 32, 78, 50, 69, 70, 65, 83, 54, 49, 32, 32, 32, 32, 32,
-/* 0x2800 */  32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 54, 48,
-/* 0x2810 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2820 */  10, 32, 54, 54, 32, 78, 50, 69, 68, 69, 67, 54, 48, 32, 32, 32,
-/* 0x2830 */  32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 55, 54,
-/* 0x2840 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2850 */  10, 32, 54, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32,
-/* 0x2860 */  32, 32, 32, 48, 50,101, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2870 */  55, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2880 */  84, 83, 10, 32, 54, 56, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48,
-/* 0x2890 */  48, 32, 32, 32, 32, 48, 52, 56, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x28a0 */  48, 51, 97, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x28b0 */  69, 78, 84, 83, 10, 32, 54, 57, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x28c0 */  67, 49, 48, 32, 32, 32, 32, 48, 97, 56, 54, 32, 32, 48, 32, 32,
-/* 0x28d0 */  48, 32, 32, 48, 51,101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x28e0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 48, 32, 76, 90, 77, 65,
-/* 0x28f0 */  95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 97, 56, 54, 32, 32,
-/* 0x2900 */  48, 32, 32, 48, 32, 32, 48,101, 55, 50, 32, 32, 50, 42, 42, 48,
-/* 0x2910 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 49, 32, 76,
-/* 0x2920 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 49, 97,
-/* 0x2930 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56,102, 56, 32, 32, 50,
-/* 0x2940 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55,
-/* 0x2950 */  50, 32, 80, 69, 77, 65, 73, 78, 49, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2960 */  48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 49, 50, 32,
-/* 0x2970 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2980 */  32, 55, 51, 32, 80, 69, 84, 76, 83, 72, 65, 75, 50, 32, 32, 32,
-/* 0x2990 */  32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 49,
-/* 0x29a0 */  51, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x29b0 */  83, 10, 32, 55, 52, 32, 80, 69, 67, 84, 84, 80, 79, 83, 32, 32,
-/* 0x29c0 */  32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x29d0 */  57, 49, 55, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x29e0 */  78, 84, 83, 10, 32, 55, 53, 32, 80, 69, 67, 84, 84, 78, 85, 76,
-/* 0x29f0 */  32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2a00 */  48, 49, 57, 49,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2a10 */  84, 69, 78, 84, 83, 10, 32, 55, 54, 32, 67, 65, 76, 76, 84, 82,
-/* 0x2a20 */  48, 48, 32, 32, 32, 32, 32, 32, 48,101, 32, 32, 48, 32, 32, 48,
-/* 0x2a30 */  32, 32, 48, 49, 57, 49,102, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2a40 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 55, 32, 67, 84, 67, 76,
-/* 0x2a50 */  69, 86, 69, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32,
-/* 0x2a60 */  32, 48, 32, 32, 48, 49, 57, 50,100, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2a70 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 56, 32, 67, 65,
-/* 0x2a80 */  76, 76, 84, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32,
-/* 0x2a90 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 50, 32, 32, 50, 42, 42,
-/* 0x2aa0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 55, 57, 32,
-/* 0x2ab0 */  67, 84, 66, 83, 72, 82, 48, 49, 32, 32, 32, 32, 32, 32, 48, 52,
-/* 0x2ac0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 55, 32, 32, 50,
-/* 0x2ad0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56,
-/* 0x2ae0 */  48, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 32, 32, 32, 32, 32,
-/* 0x2af0 */  48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51, 98, 32,
-/* 0x2b00 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2b10 */  32, 56, 49, 32, 67, 84, 66, 83, 87, 65, 48, 49, 32, 32, 32, 32,
-/* 0x2b20 */  32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 51,
-/* 0x2b30 */ 100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2b40 */  83, 10, 32, 56, 50, 32, 67, 65, 76, 76, 84, 82, 48, 50, 32, 32,
-/* 0x2b50 */  32, 32, 32, 32, 48, 49, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2b60 */  49, 57, 52, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2b70 */  69, 78, 84, 83, 10, 32, 56, 51, 32, 67, 65, 76, 76, 84, 82, 49,
-/* 0x2b80 */  48, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2b90 */  32, 48, 49, 57, 53, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2ba0 */  78, 84, 69, 78, 84, 83, 10, 32, 56, 52, 32, 67, 65, 76, 76, 84,
-/* 0x2bb0 */  82, 69, 56, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2bc0 */  48, 32, 32, 48, 49, 57, 53, 55, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2bd0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 53, 32, 67, 65, 76,
-/* 0x2be0 */  76, 84, 82, 69, 57, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48,
-/* 0x2bf0 */  32, 32, 48, 32, 32, 48, 49, 57, 53, 57, 32, 32, 50, 42, 42, 48,
-/* 0x2c00 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 54, 32, 67,
-/* 0x2c10 */  65, 76, 76, 84, 82, 49, 49, 32, 32, 32, 32, 32, 32, 48, 52, 32,
-/* 0x2c20 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53, 98, 32, 32, 50, 42,
-/* 0x2c30 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 56, 55,
-/* 0x2c40 */  32, 67, 84, 67, 76, 69, 86, 69, 50, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2c50 */  53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 53,102, 32, 32,
-/* 0x2c60 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2c70 */  56, 56, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 32, 32, 32, 32,
-/* 0x2c80 */  32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 54, 52,
-/* 0x2c90 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2ca0 */  10, 32, 56, 57, 32, 67, 84, 66, 83, 72, 82, 49, 49, 32, 32, 32,
-/* 0x2cb0 */  32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,
-/* 0x2cc0 */  54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2cd0 */  84, 83, 10, 32, 57, 48, 32, 67, 84, 66, 82, 79, 82, 49, 49, 32,
-/* 0x2ce0 */  32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2cf0 */  49, 57, 54, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2d00 */  69, 78, 84, 83, 10, 32, 57, 49, 32, 67, 84, 66, 83, 87, 65, 49,
-/* 0x2d10 */  49, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2d20 */  32, 48, 49, 57, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2d30 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 50, 32, 67, 65, 76, 76, 84,
-/* 0x2d40 */  82, 49, 51, 32, 32, 32, 32, 32, 32, 48, 55, 32, 32, 48, 32, 32,
-/* 0x2d50 */  48, 32, 32, 48, 49, 57, 55, 49, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2d60 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 51, 32, 99,116,111,
-/* 0x2d70 */ 107, 51, 50, 46, 48, 48, 32, 32, 32, 32, 32, 48, 97, 32, 32, 48,
-/* 0x2d80 */  32, 32, 48, 32, 32, 48, 49, 57, 55, 56, 32, 32, 50, 42, 42, 48,
-/* 0x2d90 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 52, 32, 99,
-/* 0x2da0 */ 116,111,107, 51, 50, 46, 49, 48, 32, 32, 32, 32, 32, 48,101, 32,
-/* 0x2db0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 50, 32, 32, 50, 42,
-/* 0x2dc0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 57, 53,
-/* 0x2dd0 */  32, 99,116,111,107, 51, 50, 46, 50, 48, 32, 32, 32, 32, 32, 48,
-/* 0x2de0 */  50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 57, 48, 32,
-/* 0x2df0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2e00 */  32, 57, 54, 32, 99,116,111,107, 51, 50, 46, 51, 48, 32, 32, 32,
-/* 0x2e10 */  32, 32, 48, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 98,
-/* 0x2e20 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2e30 */  83, 10, 32, 57, 55, 32, 99,116,111,107, 51, 50, 46, 52, 48, 32,
-/* 0x2e40 */  32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2e50 */  57, 98, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2e60 */  78, 84, 83, 10, 32, 57, 56, 32, 80, 69, 73, 77, 80, 79, 82, 84,
-/* 0x2e70 */  32, 32, 32, 32, 32, 32, 48, 50, 99, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2e80 */  32, 48, 49, 57, 98,102, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2e90 */  78, 84, 69, 78, 84, 83, 10, 32, 57, 57, 32, 80, 69, 73, 66, 89,
-/* 0x2ea0 */  79, 82, 68, 32, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x2eb0 */  48, 32, 32, 48, 49, 57,101, 98, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2ec0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 48, 32, 80, 69, 75,
-/* 0x2ed0 */  51, 50, 79, 82, 68, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32, 32,
-/* 0x2ee0 */  48, 32, 32, 48, 32, 32, 48, 49, 57,101,100, 32, 32, 50, 42, 42,
-/* 0x2ef0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 49, 32,
-/* 0x2f00 */  80, 69, 73, 77, 79, 82, 68, 49, 32, 32, 32, 32, 32, 32, 48, 55,
-/* 0x2f10 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102,100, 32, 32, 50,
-/* 0x2f20 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48,
-/* 0x2f30 */  50, 32, 80, 69, 73, 77, 80, 79, 82, 50, 32, 32, 32, 32, 32, 32,
-/* 0x2f40 */  48, 49, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 48, 52,
-/* 0x2f50 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2f60 */  10, 49, 48, 51, 32, 80, 69, 73, 69, 82, 68, 76, 76, 32, 32, 32,
-/* 0x2f70 */  32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x2f80 */  49, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2f90 */  84, 83, 10, 49, 48, 52, 32, 80, 69, 73, 69, 82, 69, 88, 69, 32,
-/* 0x2fa0 */  32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2fb0 */  49, 97, 50, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2fc0 */  69, 78, 84, 83, 10, 49, 48, 53, 32, 80, 69, 73, 77, 68, 79, 78,
-/* 0x2fd0 */  69, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2fe0 */  48, 49, 97, 50, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2ff0 */  84, 69, 78, 84, 83, 10, 49, 48, 54, 32, 80, 69, 82, 69, 76, 79,
-/* 0x3000 */  67, 49, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48,
-/* 0x3010 */  32, 32, 48, 49, 97, 50, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x3020 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 55, 32, 80, 69, 82, 69,
-/* 0x3030 */  76, 79, 67, 50, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32, 48, 32,
-/* 0x3040 */  32, 48, 32, 32, 48, 49, 97, 50, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x3050 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 56, 32, 80, 69,
-/* 0x3060 */  82, 69, 76, 79, 67, 51, 32, 32, 32, 32, 32, 32, 48, 51, 32, 32,
-/* 0x3070 */  48, 32, 32, 48, 32, 32, 48, 49, 97, 50,102, 32, 32, 50, 42, 42,
-/* 0x3080 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 48, 57, 32,
-/* 0x3090 */  82, 69, 76, 79, 67, 51, 50, 48, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x30a0 */  57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 51, 50, 32, 32,
-/* 0x30b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49,
-/* 0x30c0 */  49, 48, 32, 82, 69, 76, 51, 50, 66, 73, 71, 32, 32, 32, 32, 32,
-/* 0x30d0 */  32, 48, 57, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 53, 98,
-/* 0x30e0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x30f0 */  10, 49, 49, 49, 32, 82, 69, 76, 79, 67, 51, 50, 74, 32, 32, 32,
-/* 0x3100 */  32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97,
-/* 0x3110 */  54, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x3120 */  84, 83, 10, 49, 49, 50, 32, 82, 69, 76, 51, 50, 69, 78, 68, 32,
-/* 0x3130 */  32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x3140 */  97, 54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x3150 */  78, 84, 83, 10, 49, 49, 51, 32, 80, 69, 82, 76, 79, 72, 73, 48,
-/* 0x3160 */  32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x3170 */  48, 49, 97, 54, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x3180 */  84, 69, 78, 84, 83, 10, 49, 49, 52, 32, 80, 69, 82, 69, 76, 76,
-/* 0x3190 */  79, 48, 32, 32, 32, 32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48,
-/* 0x31a0 */  32, 32, 48, 49, 97, 54,101, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x31b0 */  79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 53, 32, 80, 69, 82, 69,
-/* 0x31c0 */  76, 72, 73, 48, 32, 32, 32, 32, 32, 32, 48,100, 32, 32, 48, 32,
-/* 0x31d0 */  32, 48, 32, 32, 48, 49, 97, 55, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x31e0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 54, 32, 80, 69,
-/* 0x31f0 */  68, 69, 80, 72, 65, 75, 32, 32, 32, 32, 32, 32, 48, 50,102, 32,
-/* 0x3200 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 56, 53, 32, 32, 50, 42,
-/* 0x3210 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 49, 55,
-/* 0x3220 */  32, 80, 69, 84, 76, 83, 67, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x3230 */  49, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 98, 52, 32,
-/* 0x3240 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x3250 */  49, 49, 56, 32, 80, 69, 77, 65, 73, 78, 50, 48, 32, 32, 32, 32,
-/* 0x3260 */  32, 32, 48, 49, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 99,
-/* 0x3270 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x3280 */  83, 10, 49, 49, 57, 32, 67, 76, 69, 65, 82, 83, 84, 65, 67, 75,
-/* 0x3290 */  32, 32, 32, 32, 48,100, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x32a0 */  97, 99,100, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x32b0 */  78, 84, 83, 10, 49, 50, 48, 32, 80, 69, 77, 65, 73, 78, 50, 49,
-/* 0x32c0 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x32d0 */  49, 97,100, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x32e0 */  69, 78, 84, 83, 10, 49, 50, 49, 32, 80, 69, 82, 69, 84, 85, 82,
-/* 0x32f0 */  78, 32, 32, 32, 32, 32, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32,
-/* 0x3300 */  32, 48, 49, 97,100, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x3310 */  78, 84, 69, 78, 84, 83, 10, 49, 50, 50, 32, 80, 69, 68, 79, 74,
-/* 0x3320 */  85, 77, 80, 32, 32, 32, 32, 32, 32, 48, 53, 32, 32, 48, 32, 32,
-/* 0x3330 */  48, 32, 32, 48, 49, 97,101, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x3340 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 51, 32, 80, 69, 84,
-/* 0x3350 */  76, 83, 67, 50, 32, 32, 32, 32, 32, 32, 32, 48, 49,102, 32, 32,
-/* 0x3360 */  48, 32, 32, 48, 32, 32, 48, 49, 97,101, 53, 32, 32, 50, 42, 42,
-/* 0x3370 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 49, 50, 52, 32,
-/* 0x3380 */  85, 80, 88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x3390 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 48, 52, 32, 32,
-/* 0x33a0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83,
-/* 0x33b0 */  89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48,
-/* 0x33c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x33d0 */  66, 83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 49,
-/* 0x33e0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x33f0 */ 100, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50,
-/* 0x3400 */  66, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3410 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x3420 */  32, 48, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3430 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x3440 */  68, 69, 67, 50, 48, 32, 48, 32, 78, 50, 66, 68, 69, 67, 50, 48,
-/* 0x3450 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3460 */  32, 32, 78, 50, 66, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 66,
-/* 0x3470 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3480 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 32,
-/* 0x3490 */  48, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x34a0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x34b0 */  65, 83, 54, 49, 32, 48, 32, 78, 50, 66, 70, 65, 83, 54, 49, 10,
-/* 0x34c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x34d0 */  32, 78, 50, 66, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 66, 68,
-/* 0x34e0 */  69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x34f0 */  32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 32, 48,
-/* 0x3500 */  32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3510 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65,
-/* 0x3520 */  83, 49, 49, 32, 48, 32, 78, 50, 68, 70, 65, 83, 49, 49, 10, 48,
-/* 0x3530 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3540 */  78, 50, 68, 68, 69, 67, 49, 48, 32, 48, 32, 78, 50, 68, 68, 69,
-/* 0x3550 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3560 */  32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 50, 48, 32, 48, 32,
-/* 0x3570 */  78, 50, 68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3580 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67,
-/* 0x3590 */  51, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x35a0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x35b0 */  50, 68, 68, 69, 67, 53, 48, 32, 48, 32, 78, 50, 68, 68, 69, 67,
-/* 0x35c0 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x35d0 */  32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 49, 32, 48, 32, 78,
-/* 0x35e0 */  50, 68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x35f0 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 68, 69, 67, 54,
-/* 0x3600 */  48, 32, 48, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48,
-/* 0x3610 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3620 */  69, 83, 77, 65, 49, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 49,
-/* 0x3630 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3640 */ 100, 32, 32, 78, 50, 69, 70, 65, 83, 49, 49, 32, 48, 32, 78, 50,
-/* 0x3650 */  69, 70, 65, 83, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3660 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48,
-/* 0x3670 */  32, 48, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x3680 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69,
-/* 0x3690 */  68, 69, 67, 50, 48, 32, 48, 32, 78, 50, 69, 68, 69, 67, 50, 48,
-/* 0x36a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x36b0 */  32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 32, 48, 32, 78, 50, 69,
-/* 0x36c0 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x36d0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 32,
-/* 0x36e0 */  48, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x36f0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x3700 */  65, 83, 54, 49, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54, 49, 10,
-/* 0x3710 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3720 */  32, 78, 50, 69, 68, 69, 67, 54, 48, 32, 48, 32, 78, 50, 69, 68,
-/* 0x3730 */  69, 67, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3740 */  32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 32, 48,
-/* 0x3750 */  32, 67, 65, 76, 76, 84, 82, 48, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3760 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84,
-/* 0x3770 */  82, 49, 48, 32, 48, 32, 67, 65, 76, 76, 84, 82, 49, 48, 10, 48,
-/* 0x3780 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3790 */  67, 65, 76, 76, 84, 82, 49, 49, 32, 48, 32, 67, 65, 76, 76, 84,
-/* 0x37a0 */  82, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x37b0 */  32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51, 32, 48, 32,
-/* 0x37c0 */  67, 65, 76, 76, 84, 82, 49, 51, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x37d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50,
-/* 0x37e0 */  46, 48, 48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10,
-/* 0x37f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3800 */  32, 99,116,111,107, 51, 50, 46, 49, 48, 32, 48, 32, 99,116,111,
-/* 0x3810 */ 107, 51, 50, 46, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3820 */ 108, 32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 50,
-/* 0x3830 */  48, 32, 48, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 48, 48,
-/* 0x3840 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,
-/* 0x3850 */ 116,111,107, 51, 50, 46, 52, 48, 32, 48, 32, 99,116,111,107, 51,
-/* 0x3860 */  50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3870 */  32, 32, 32,100, 32, 32, 80, 69, 73, 77, 80, 79, 82, 84, 32, 48,
-/* 0x3880 */  32, 80, 69, 73, 77, 80, 79, 82, 84, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3890 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 77, 79,
-/* 0x38a0 */  82, 68, 49, 32, 48, 32, 80, 69, 73, 77, 79, 82, 68, 49, 10, 48,
-/* 0x38b0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x38c0 */  80, 69, 73, 77, 80, 79, 82, 50, 32, 48, 32, 80, 69, 73, 77, 80,
-/* 0x38d0 */  79, 82, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x38e0 */  32, 32,100, 32, 32, 80, 69, 73, 77, 68, 79, 78, 69, 32, 48, 32,
-/* 0x38f0 */  80, 69, 73, 77, 68, 79, 78, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3900 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 82, 69, 76, 79, 67, 51,
-/* 0x3910 */  50, 48, 32, 48, 32, 82, 69, 76, 79, 67, 51, 50, 48, 10, 48, 48,
-/* 0x3920 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 82,
-/* 0x3930 */  69, 76, 79, 67, 51, 50, 74, 32, 48, 32, 82, 69, 76, 79, 67, 51,
-/* 0x3940 */  50, 74, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3950 */  32,100, 32, 32, 80, 69, 77, 65, 73, 78, 50, 49, 32, 48, 32, 80,
-/* 0x3960 */  69, 77, 65, 73, 78, 50, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3970 */  32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 84, 76, 83, 67, 50,
-/* 0x3980 */  32, 48, 32, 80, 69, 84, 76, 83, 67, 50, 10, 48, 48, 48, 48, 48,
-/* 0x3990 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 83,
-/* 0x39a0 */  68, 76, 76, 49, 32, 48, 32, 80, 69, 73, 83, 68, 76, 76, 49, 10,
-/* 0x39b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x39c0 */  32, 80, 69, 77, 65, 73, 78, 48, 49, 32, 48, 32, 80, 69, 77, 65,
-/* 0x39d0 */  73, 78, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x39e0 */  32, 32, 32,100, 32, 32, 80, 69, 83, 79, 67, 82, 69, 76, 32, 48,
-/* 0x39f0 */  32, 80, 69, 83, 79, 67, 82, 69, 76, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3a00 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 83, 79, 67,
-/* 0x3a10 */  80, 73, 67, 32, 48, 32, 80, 69, 83, 79, 67, 80, 73, 67, 10, 48,
-/* 0x3a20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3a30 */  80, 69, 83, 79, 85, 78, 67, 48, 32, 48, 32, 80, 69, 83, 79, 85,
-/* 0x3a40 */  78, 67, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3a50 */  32, 32,100, 32, 32, 80, 69, 73, 67, 79, 78, 83, 49, 32, 48, 32,
-/* 0x3a60 */  80, 69, 73, 67, 79, 78, 83, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3a70 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 67, 79, 78,
-/* 0x3a80 */  83, 50, 32, 48, 32, 80, 69, 73, 67, 79, 78, 83, 50, 10, 48, 48,
-/* 0x3a90 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80,
-/* 0x3aa0 */  69, 84, 76, 83, 72, 65, 75, 32, 48, 32, 80, 69, 84, 76, 83, 72,
-/* 0x3ab0 */  65, 75, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3ac0 */  32,100, 32, 32, 80, 69, 77, 65, 73, 78, 48, 50, 32, 48, 32, 80,
-/* 0x3ad0 */  69, 77, 65, 73, 78, 48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3ae0 */  32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 77, 65, 73, 78, 48,
-/* 0x3af0 */  51, 32, 48, 32, 80, 69, 77, 65, 73, 78, 48, 51, 10, 48, 48, 48,
-/* 0x3b00 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3b10 */  66, 70, 65, 83, 49, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 49,
-/* 0x3b20 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3b30 */ 100, 32, 32, 78, 50, 66, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50,
-/* 0x3b40 */  66, 83, 77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3b50 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 50, 48,
-/* 0x3b60 */  32, 48, 32, 78, 50, 66, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48,
-/* 0x3b70 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66,
-/* 0x3b80 */  83, 77, 65, 51, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 51, 48,
-/* 0x3b90 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3ba0 */  32, 32, 78, 50, 66, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 66,
-/* 0x3bb0 */  70, 65, 83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3bc0 */  32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77, 65, 52, 48, 32,
-/* 0x3bd0 */  48, 32, 78, 50, 66, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3be0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 70,
-/* 0x3bf0 */  65, 83, 52, 48, 32, 48, 32, 78, 50, 66, 70, 65, 83, 52, 48, 10,
-/* 0x3c00 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3c10 */  32, 78, 50, 66, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 66, 83,
-/* 0x3c20 */  77, 65, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3c30 */  32, 32, 32,100, 32, 32, 78, 50, 66, 70, 65, 83, 53, 48, 32, 48,
-/* 0x3c40 */  32, 78, 50, 66, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3c50 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 66, 83, 77,
-/* 0x3c60 */  65, 54, 48, 32, 48, 32, 78, 50, 66, 83, 77, 65, 54, 48, 10, 48,
-/* 0x3c70 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3c80 */  78, 50, 66, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 66, 70, 65,
-/* 0x3c90 */  83, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3ca0 */  32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 49, 48, 32, 48, 32,
-/* 0x3cb0 */  78, 50, 68, 70, 65, 83, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3cc0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65,
-/* 0x3cd0 */  50, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 50, 48, 10, 48, 48,
-/* 0x3ce0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3cf0 */  50, 68, 70, 65, 83, 50, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83,
-/* 0x3d00 */  50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3d10 */  32,100, 32, 32, 78, 50, 68, 83, 77, 65, 51, 48, 32, 48, 32, 78,
-/* 0x3d20 */  50, 68, 83, 77, 65, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3d30 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 51,
-/* 0x3d40 */  48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 51, 48, 10, 48, 48, 48,
-/* 0x3d50 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3d60 */  68, 83, 77, 65, 52, 48, 32, 48, 32, 78, 50, 68, 83, 77, 65, 52,
-/* 0x3d70 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3d80 */ 100, 32, 32, 78, 50, 68, 70, 65, 83, 52, 48, 32, 48, 32, 78, 50,
-/* 0x3d90 */  68, 70, 65, 83, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3da0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68, 83, 77, 65, 53, 48,
-/* 0x3db0 */  32, 48, 32, 78, 50, 68, 83, 77, 65, 53, 48, 10, 48, 48, 48, 48,
-/* 0x3dc0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 68,
-/* 0x3dd0 */  70, 65, 83, 53, 48, 32, 48, 32, 78, 50, 68, 70, 65, 83, 53, 48,
-/* 0x3de0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3df0 */  32, 32, 78, 50, 68, 83, 77, 65, 54, 48, 32, 48, 32, 78, 50, 68,
-/* 0x3e00 */  83, 77, 65, 54, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3e10 */  32, 32, 32, 32,100, 32, 32, 78, 50, 68, 70, 65, 83, 54, 48, 32,
-/* 0x3e20 */  48, 32, 78, 50, 68, 70, 65, 83, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3e30 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70,
-/* 0x3e40 */  65, 83, 49, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 49, 48, 10,
-/* 0x3e50 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3e60 */  32, 78, 50, 69, 83, 77, 65, 50, 48, 32, 48, 32, 78, 50, 69, 83,
-/* 0x3e70 */  77, 65, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x3e80 */  32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83, 50, 48, 32, 48,
-/* 0x3e90 */  32, 78, 50, 69, 70, 65, 83, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3ea0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77,
-/* 0x3eb0 */  65, 51, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 51, 48, 10, 48,
-/* 0x3ec0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3ed0 */  78, 50, 69, 70, 65, 83, 51, 48, 32, 48, 32, 78, 50, 69, 70, 65,
-/* 0x3ee0 */  83, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3ef0 */  32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 52, 48, 32, 48, 32,
-/* 0x3f00 */  78, 50, 69, 83, 77, 65, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f10 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 70, 65, 83,
-/* 0x3f20 */  52, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 52, 48, 10, 48, 48,
-/* 0x3f30 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x3f40 */  50, 69, 83, 77, 65, 53, 48, 32, 48, 32, 78, 50, 69, 83, 77, 65,
-/* 0x3f50 */  53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3f60 */  32,100, 32, 32, 78, 50, 69, 70, 65, 83, 53, 48, 32, 48, 32, 78,
-/* 0x3f70 */  50, 69, 70, 65, 83, 53, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f80 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 50, 69, 83, 77, 65, 54,
-/* 0x3f90 */  48, 32, 48, 32, 78, 50, 69, 83, 77, 65, 54, 48, 10, 48, 48, 48,
-/* 0x3fa0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 50,
-/* 0x3fb0 */  69, 70, 65, 83, 54, 48, 32, 48, 32, 78, 50, 69, 70, 65, 83, 54,
-/* 0x3fc0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3fd0 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 32, 48, 32,
-/* 0x3fe0 */  76, 90, 77, 65, 95, 68, 69, 67, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x3ff0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x4000 */  95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76,
-/* 0x4010 */  70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4020 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32,
-/* 0x4030 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x4040 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x4050 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x4060 */  68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4070 */  32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x4080 */  48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48,
-/* 0x4090 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x40a0 */  80, 69, 77, 65, 73, 78, 49, 48, 32, 48, 32, 80, 69, 77, 65, 73,
-/* 0x40b0 */  78, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x40c0 */  32, 32,100, 32, 32, 80, 69, 84, 76, 83, 72, 65, 75, 50, 32, 48,
-/* 0x40d0 */  32, 80, 69, 84, 76, 83, 72, 65, 75, 50, 10, 48, 48, 48, 48, 48,
-/* 0x40e0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 67, 84,
-/* 0x40f0 */  84, 80, 79, 83, 32, 48, 32, 80, 69, 67, 84, 84, 80, 79, 83, 10,
-/* 0x4100 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4110 */  32, 80, 69, 67, 84, 84, 78, 85, 76, 32, 48, 32, 80, 69, 67, 84,
-/* 0x4120 */  84, 78, 85, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4130 */  32, 32, 32,100, 32, 32, 67, 84, 67, 76, 69, 86, 69, 49, 32, 48,
-/* 0x4140 */  32, 67, 84, 67, 76, 69, 86, 69, 49, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4150 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84,
-/* 0x4160 */  82, 48, 49, 32, 48, 32, 67, 65, 76, 76, 84, 82, 48, 49, 10, 48,
-/* 0x4170 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4180 */  67, 84, 66, 83, 72, 82, 48, 49, 32, 48, 32, 67, 84, 66, 83, 72,
-/* 0x4190 */  82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x41a0 */  32, 32,100, 32, 32, 67, 84, 66, 82, 79, 82, 48, 49, 32, 48, 32,
-/* 0x41b0 */  67, 84, 66, 82, 79, 82, 48, 49, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x41c0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 87, 65,
-/* 0x41d0 */  48, 49, 32, 48, 32, 67, 84, 66, 83, 87, 65, 48, 49, 10, 48, 48,
-/* 0x41e0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x41f0 */  65, 76, 76, 84, 82, 48, 50, 32, 48, 32, 67, 65, 76, 76, 84, 82,
-/* 0x4200 */  48, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x4210 */  32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69, 56, 32, 48, 32, 67,
-/* 0x4220 */  65, 76, 76, 84, 82, 69, 56, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4230 */  32,108, 32, 32, 32, 32,100, 32, 32, 67, 65, 76, 76, 84, 82, 69,
-/* 0x4240 */  57, 32, 48, 32, 67, 65, 76, 76, 84, 82, 69, 57, 10, 48, 48, 48,
-/* 0x4250 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84,
-/* 0x4260 */  67, 76, 69, 86, 69, 50, 32, 48, 32, 67, 84, 67, 76, 69, 86, 69,
-/* 0x4270 */  50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4280 */ 100, 32, 32, 67, 65, 76, 76, 84, 82, 49, 50, 32, 48, 32, 67, 65,
-/* 0x4290 */  76, 76, 84, 82, 49, 50, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x42a0 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66, 83, 72, 82, 49, 49,
-/* 0x42b0 */  32, 48, 32, 67, 84, 66, 83, 72, 82, 49, 49, 10, 48, 48, 48, 48,
-/* 0x42c0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 84, 66,
-/* 0x42d0 */  82, 79, 82, 49, 49, 32, 48, 32, 67, 84, 66, 82, 79, 82, 49, 49,
-/* 0x42e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x42f0 */  32, 32, 67, 84, 66, 83, 87, 65, 49, 49, 32, 48, 32, 67, 84, 66,
-/* 0x4300 */  83, 87, 65, 49, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x4310 */  32, 32, 32, 32,100, 32, 32, 99,116,111,107, 51, 50, 46, 51, 48,
-/* 0x4320 */  32, 48, 32, 99,116,111,107, 51, 50, 46, 51, 48, 10, 48, 48, 48,
-/* 0x4330 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x4340 */  73, 66, 89, 79, 82, 68, 32, 48, 32, 80, 69, 73, 66, 89, 79, 82,
-/* 0x4350 */  68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x4360 */ 100, 32, 32, 80, 69, 75, 51, 50, 79, 82, 68, 32, 48, 32, 80, 69,
-/* 0x4370 */  75, 51, 50, 79, 82, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4380 */ 108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73, 69, 82, 68, 76, 76,
-/* 0x4390 */  32, 48, 32, 80, 69, 73, 69, 82, 68, 76, 76, 10, 48, 48, 48, 48,
-/* 0x43a0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 73,
-/* 0x43b0 */  69, 82, 69, 88, 69, 32, 48, 32, 80, 69, 73, 69, 82, 69, 88, 69,
-/* 0x43c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x43d0 */  32, 32, 80, 69, 82, 69, 76, 79, 67, 49, 32, 48, 32, 80, 69, 82,
-/* 0x43e0 */  69, 76, 79, 67, 49, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x43f0 */  32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69, 76, 79, 67, 50, 32,
-/* 0x4400 */  48, 32, 80, 69, 82, 69, 76, 79, 67, 50, 10, 48, 48, 48, 48, 48,
-/* 0x4410 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 69,
-/* 0x4420 */  76, 79, 67, 51, 32, 48, 32, 80, 69, 82, 69, 76, 79, 67, 51, 10,
-/* 0x4430 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x4440 */  32, 82, 69, 76, 51, 50, 66, 73, 71, 32, 48, 32, 82, 69, 76, 51,
-/* 0x4450 */  50, 66, 73, 71, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x4460 */  32, 32, 32,100, 32, 32, 82, 69, 76, 51, 50, 69, 78, 68, 32, 48,
-/* 0x4470 */  32, 82, 69, 76, 51, 50, 69, 78, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4480 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 82, 76, 79,
-/* 0x4490 */  72, 73, 48, 32, 48, 32, 80, 69, 82, 76, 79, 72, 73, 48, 10, 48,
-/* 0x44a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x44b0 */  80, 69, 82, 69, 76, 76, 79, 48, 32, 48, 32, 80, 69, 82, 69, 76,
-/* 0x44c0 */  76, 79, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x44d0 */  32, 32,100, 32, 32, 80, 69, 82, 69, 76, 72, 73, 48, 32, 48, 32,
-/* 0x44e0 */  80, 69, 82, 69, 76, 72, 73, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x44f0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69, 68, 69, 80, 72,
-/* 0x4500 */  65, 75, 32, 48, 32, 80, 69, 68, 69, 80, 72, 65, 75, 10, 48, 48,
-/* 0x4510 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80,
-/* 0x4520 */  69, 84, 76, 83, 67, 32, 48, 32, 80, 69, 84, 76, 83, 67, 10, 48,
-/* 0x4530 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x4540 */  80, 69, 77, 65, 73, 78, 50, 48, 32, 48, 32, 80, 69, 77, 65, 73,
-/* 0x4550 */  78, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x4560 */  32, 32,100, 32, 32, 67, 76, 69, 65, 82, 83, 84, 65, 67, 75, 32,
-/* 0x4570 */  48, 32, 67, 76, 69, 65, 82, 83, 84, 65, 67, 75, 10, 48, 48, 48,
-/* 0x4580 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 80, 69,
-/* 0x4590 */  82, 69, 84, 85, 82, 78, 32, 48, 32, 80, 69, 82, 69, 84, 85, 82,
-/* 0x45a0 */  78, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x45b0 */ 100, 32, 32, 80, 69, 68, 79, 74, 85, 77, 80, 32, 48, 32, 80, 69,
-/* 0x45c0 */  68, 79, 74, 85, 77, 80, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x45d0 */ 108, 32, 32, 32, 32,100, 32, 32, 85, 80, 88, 49, 72, 69, 65, 68,
-/* 0x45e0 */  32, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10, 48, 48, 48, 48,
-/* 0x45f0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x4600 */  68, 42, 32, 48, 32,115,116, 97,114,116, 95,111,102, 95, 99,111,
-/* 0x4610 */ 109,112,114,101,115,115,101,100, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4620 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x4630 */  48, 32,115,116, 97,114,116, 95,111,102, 95,117,110, 99,111,109,
-/* 0x4640 */ 112,114,101,115,115,101,100, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4650 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x4660 */  32,105, 99,111,110, 95,111,102,102,115,101,116, 10, 48, 48, 48,
-/* 0x4670 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x4680 */  78, 68, 42, 32, 48, 32,105, 99,111,110, 95,100,101,108,116, 97,
-/* 0x4690 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x46a0 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,116,108,115, 95, 97,100,
-/* 0x46b0 */ 100,114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x46c0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,116,
-/* 0x46d0 */ 108,115, 95,118, 97,108,117,101, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x46e0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x46f0 */  48, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,
-/* 0x4700 */ 117,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x4710 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109,
-/* 0x4720 */  97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4730 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x4740 */  32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48,
-/* 0x4750 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x4760 */  68, 42, 32, 48, 32,108,122,109, 97, 95,112,114,111,112,101,114,
-/* 0x4770 */ 116,105,101,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x4780 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,
-/* 0x4790 */ 108,116,101,114, 95, 98,117,102,102,101,114, 95,115,116, 97,114,
-/* 0x47a0 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x47b0 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,
-/* 0x47c0 */ 114, 95,108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x47d0 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x47e0 */  48, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48,
-/* 0x47f0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x4800 */  78, 68, 42, 32, 48, 32, 99,111,109,112,114,101,115,115,101,100,
-/* 0x4810 */  95,105,109,112,111,114,116,115, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4820 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x4830 */  48, 32,115,116, 97,114,116, 95,111,102, 95,105,109,112,111,114,
-/* 0x4840 */ 116,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x4850 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 76,111, 97,100,
-/* 0x4860 */  76,105, 98,114, 97,114,121, 65, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4870 */  48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32,
-/* 0x4880 */  48, 32,107,101,114,110,101,108, 51, 50, 95,111,114,100,105,110,
-/* 0x4890 */  97,108,115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x48a0 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 71,101,116,
-/* 0x48b0 */  80,114,111, 99, 65,100,100,114,101,115,115, 10, 48, 48, 48, 48,
-/* 0x48c0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x48d0 */  68, 42, 32, 48, 32, 69,120,105,116, 80,114,111, 99,101,115,115,
-/* 0x48e0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x48f0 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,115,116, 97,114,116, 95,
-/* 0x4900 */ 111,102, 95,114,101,108,111, 99,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4910 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x4920 */  32, 48, 32,114,101,108,111, 99, 95,100,101,108,116, 10, 48, 48,
-/* 0x4930 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x4940 */  85, 78, 68, 42, 32, 48, 32, 86,105,114,116,117, 97,108, 80,114,
-/* 0x4950 */ 111,116,101, 99,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x4960 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,118,
-/* 0x4970 */ 112, 95, 98, 97,115,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4980 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x4990 */ 118,112, 95,115,105,122,101, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x49a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x49b0 */  32,115,119,114,105, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x49c0 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,116,
-/* 0x49d0 */ 108,115, 95,109,111,100,117,108,101, 95, 98, 97,115,101, 10, 48,
-/* 0x49e0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49f0 */  42, 85, 78, 68, 42, 32, 48, 32,111,114,105,103,105,110, 97,108,
-/* 0x4a00 */  95,101,110,116,114,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x4a10 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x4a20 */ 116,108,115, 95, 99, 97,108,108, 98, 97, 99,107,115, 95,112,116,
-/* 0x4a30 */ 114, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x4a40 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 73, 83, 68,
-/* 0x4a50 */  76, 76, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x4a60 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4a70 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32,
-/* 0x4a80 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x4a90 */  32, 32, 80, 69, 77, 65, 73, 78, 50, 49, 10, 10, 82, 69, 76, 79,
-/* 0x4aa0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4ab0 */  79, 82, 32, 91, 80, 69, 83, 79, 67, 82, 69, 76, 93, 58, 10, 79,
-/* 0x4ac0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x4ad0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x4ae0 */  48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x4af0 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,115,116, 97,114,116,
-/* 0x4b00 */  95,111,102, 95, 99,111,109,112,114,101,115,115,101,100, 10, 10,
-/* 0x4b10 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x4b20 */  68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 83, 79, 67, 80, 73, 67,
-/* 0x4b30 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x4b40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x4b50 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51,
-/* 0x4b60 */  56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,115,
-/* 0x4b70 */ 116, 97,114,116, 95,111,102, 95, 99,111,109,112,114,101,115,115,
-/* 0x4b80 */ 101,100, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4b90 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 83, 79,
-/* 0x4ba0 */  85, 78, 67, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4bb0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4bc0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x4bd0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4be0 */  32, 32, 32,115,116, 97,114,116, 95,111,102, 95,117,110, 99,111,
-/* 0x4bf0 */ 109,112,114,101,115,115,101,100, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4c00 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4c10 */  32, 91, 80, 69, 73, 67, 79, 78, 83, 49, 93, 58, 10, 79, 70, 70,
-/* 0x4c20 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x4c30 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x4c40 */  48, 48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x4c50 */  32, 32, 32, 32, 32, 32, 32, 32, 32,105, 99,111,110, 95,111,102,
-/* 0x4c60 */ 102,115,101,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4c70 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69,
-/* 0x4c80 */  73, 67, 79, 78, 83, 50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4c90 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4ca0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4cb0 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x4cc0 */  32, 32, 32, 32, 32,105, 99,111,110, 95,111,102,102,115,101,116,
-/* 0x4cd0 */  10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4ce0 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,105, 99,111,110,
-/* 0x4cf0 */  95,100,101,108,116, 97, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x4d00 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x4d10 */  80, 69, 84, 76, 83, 72, 65, 75, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4d20 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4d30 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4d40 */  48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x4d50 */  32, 32, 32, 32, 32, 32, 32,116,108,115, 95, 97,100,100,114,101,
-/* 0x4d60 */ 115,115, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56,
-/* 0x4d70 */  54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,116,108,
-/* 0x4d80 */ 115, 95,118, 97,108,117,101, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x4d90 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x4da0 */  91, 78, 50, 66, 83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4db0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4dc0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4dd0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x4de0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48,
-/* 0x4df0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4e00 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83,
-/* 0x4e10 */  49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x4e20 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e30 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82,
-/* 0x4e40 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4e50 */  32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4e60 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4e70 */  82, 32, 91, 78, 50, 66, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70,
-/* 0x4e80 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4e90 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4ea0 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67,
-/* 0x4eb0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 83, 77, 65,
-/* 0x4ec0 */  49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4ed0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70,
-/* 0x4ee0 */  65, 83, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4ef0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4f00 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x4f10 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x4f20 */  32, 32, 32, 78, 50, 66, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76,
-/* 0x4f30 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4f40 */  70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 51, 48, 93, 58, 10,
-/* 0x4f50 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4f60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4f70 */  10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95,
-/* 0x4f80 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x4f90 */  69, 67, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4fa0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x4fb0 */  66, 70, 65, 83, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x4fc0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4fd0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4fe0 */  48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x4ff0 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x5000 */  48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56,
-/* 0x5010 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 50,
-/* 0x5020 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x5030 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 68, 69,
-/* 0x5040 */  67, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x5050 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5060 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 49, 32,
-/* 0x5070 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5080 */  32, 32, 78, 50, 66, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5090 */  48, 50,102, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x50a0 */  32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 53, 48, 10, 10,
-/* 0x50b0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x50c0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 83, 77, 65, 52, 48,
-/* 0x50d0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x50e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x50f0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x5100 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5110 */  50, 66, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5120 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5130 */  91, 78, 50, 66, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5140 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5150 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5160 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5170 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 51, 48,
-/* 0x5180 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5190 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68,
-/* 0x51a0 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x51b0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x51c0 */  66, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x51d0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x51e0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x51f0 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x5200 */  32, 32, 32, 32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x5210 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5220 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 48, 93,
-/* 0x5230 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5240 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5250 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 51, 56,
-/* 0x5260 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5270 */  66, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32,
-/* 0x5280 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x5290 */  32, 32, 78, 50, 66, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x52a0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x52b0 */  79, 82, 32, 91, 78, 50, 66, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x52c0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x52d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x52e0 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x52f0 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 66, 68, 69,
-/* 0x5300 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5310 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68,
-/* 0x5320 */  83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x5330 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5340 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x5350 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5360 */  32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x5370 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5380 */  32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 49, 48, 93, 58,
-/* 0x5390 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x53a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x53b0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x53c0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68,
-/* 0x53d0 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x53e0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x53f0 */  50, 68, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5400 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5410 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5420 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5430 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 83, 77, 65, 49, 48, 10, 10,
-/* 0x5440 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5450 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 50, 48,
-/* 0x5460 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5470 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5480 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x5490 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x54a0 */  50, 68, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x54b0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x54c0 */  91, 78, 50, 68, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x54d0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x54e0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x54f0 */  48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5500 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x5510 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5520 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83,
-/* 0x5530 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5540 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5550 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0x5560 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5570 */  32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5580 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5590 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x55a0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x55b0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 68, 69, 67, 51, 48, 93,
-/* 0x55c0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x55d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x55e0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56,
-/* 0x55f0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5600 */  68, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 50, 49, 32,
-/* 0x5610 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5620 */  32, 32, 78, 50, 68, 68, 69, 67, 54, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5630 */  48, 52, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5640 */  32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 53, 48, 10, 10,
-/* 0x5650 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5660 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 83, 77, 65, 52, 48,
-/* 0x5670 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5680 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5690 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x56a0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x56b0 */  50, 68, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x56c0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x56d0 */  91, 78, 50, 68, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x56e0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x56f0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5700 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5710 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 51, 48,
-/* 0x5720 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5730 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68,
-/* 0x5740 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5750 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5760 */  68, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5770 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5780 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5790 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x57a0 */  32, 32, 32, 32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x57b0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x57c0 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 48, 93,
-/* 0x57d0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x57e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x57f0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 51, 56,
-/* 0x5800 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5810 */  68, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32,
-/* 0x5820 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x5830 */  32, 32, 78, 50, 68, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5840 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5850 */  79, 82, 32, 91, 78, 50, 68, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x5860 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5870 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5880 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5890 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 68, 68, 69,
-/* 0x58a0 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x58b0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69,
-/* 0x58c0 */  83, 77, 65, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x58d0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x58e0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x58f0 */  49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32,
-/* 0x5900 */  32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69,
-/* 0x5910 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x5920 */  32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 49, 48, 93, 58,
-/* 0x5930 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x5940 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x5950 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54,
-/* 0x5960 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69,
-/* 0x5970 */  68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x5980 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x5990 */  50, 69, 83, 77, 65, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x59a0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x59b0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x59c0 */  48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x59d0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 83, 77, 65, 49, 48, 10, 10,
-/* 0x59e0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x59f0 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 50, 48,
-/* 0x5a00 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5a10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5a20 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 51,
-/* 0x5a30 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5a40 */  50, 69, 70, 65, 83, 49, 49, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5a50 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5a60 */  91, 78, 50, 69, 83, 77, 65, 51, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5a70 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5a80 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5a90 */  48, 48, 48, 48, 99, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5aa0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x5ab0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x5ac0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83,
-/* 0x5ad0 */  51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x5ae0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5af0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 53, 32, 82,
-/* 0x5b00 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5b10 */  32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5b20 */  48,101, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32,
-/* 0x5b30 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48, 10, 10, 82,
-/* 0x5b40 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5b50 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 68, 69, 67, 51, 48, 93,
-/* 0x5b60 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5b70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5b80 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56,
-/* 0x5b90 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5ba0 */  69, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 49,101, 32,
-/* 0x5bb0 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5bc0 */  32, 32, 78, 50, 69, 68, 69, 67, 53, 48, 10, 48, 48, 48, 48, 48,
-/* 0x5bd0 */  48, 51, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x5be0 */  32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 54, 48, 10, 10,
-/* 0x5bf0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5c00 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 83, 77, 65, 52, 48,
-/* 0x5c10 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5c20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5c30 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 51,
-/* 0x5c40 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x5c50 */  50, 69, 68, 69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x5c60 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x5c70 */  91, 78, 50, 69, 70, 65, 83, 52, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x5c80 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5c90 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x5ca0 */  48, 48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x5cb0 */  32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 51, 48,
-/* 0x5cc0 */  10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 51, 56, 54, 95,
-/* 0x5cd0 */  80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68,
-/* 0x5ce0 */  69, 67, 51, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x5cf0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 50,
-/* 0x5d00 */  69, 83, 77, 65, 54, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x5d10 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5d20 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x5d30 */  48, 97, 32, 82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32,
-/* 0x5d40 */  32, 32, 32, 32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82,
-/* 0x5d50 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x5d60 */  83, 32, 70, 79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 48, 93,
-/* 0x5d70 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x5d80 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x5d90 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32, 82, 95, 51, 56,
-/* 0x5da0 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50,
-/* 0x5db0 */  69, 70, 65, 83, 54, 49, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32,
-/* 0x5dc0 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x5dd0 */  32, 32, 78, 50, 69, 68, 69, 67, 49, 48, 10, 10, 82, 69, 76, 79,
-/* 0x5de0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x5df0 */  79, 82, 32, 91, 78, 50, 69, 70, 65, 83, 54, 49, 93, 58, 10, 79,
-/* 0x5e00 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x5e10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x5e20 */  48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x5e30 */  67, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 78, 50, 69, 68, 69,
-/* 0x5e40 */  67, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x5e50 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77,
-/* 0x5e60 */  65, 95, 68, 69, 67, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x5e70 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5e80 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x5e90 */  48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x5ea0 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,107,
-/* 0x5eb0 */  95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48, 49, 52,
-/* 0x5ec0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5ed0 */  32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48,
-/* 0x5ee0 */  48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x5ef0 */  32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99, 95,
-/* 0x5f00 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 97, 32, 82, 95, 51,
-/* 0x5f10 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x5f20 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 10,
-/* 0x5f30 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x5f40 */  68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 67, 84, 84, 80, 79, 83,
-/* 0x5f50 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x5f60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x5f70 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51,
-/* 0x5f80 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x5f90 */ 105,108,116,101,114, 95, 98,117,102,102,101,114, 95,115,116, 97,
-/* 0x5fa0 */ 114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x5fb0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76,
-/* 0x5fc0 */  84, 82, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x5fd0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x5fe0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49,
-/* 0x5ff0 */  32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6000 */  32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,116,104,
-/* 0x6010 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6020 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86,
-/* 0x6030 */  69, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6040 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6050 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82,
-/* 0x6060 */  95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6070 */  32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48,
-/* 0x6080 */  48, 48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x6090 */  32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 48, 48, 10,
-/* 0x60a0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x60b0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 48,
-/* 0x60c0 */  50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x60d0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x60e0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95,
-/* 0x60f0 */  51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6100 */  67, 65, 76, 76, 84, 82, 48, 48, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x6110 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x6120 */  32, 91, 67, 65, 76, 76, 84, 82, 49, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6130 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6140 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6150 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x6160 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x6170 */ 108,101,110,103,116,104, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x6180 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x6190 */  67, 65, 76, 76, 84, 82, 49, 49, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x61a0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x61b0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x61c0 */  48, 48, 48, 51, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32,
-/* 0x61d0 */  32, 32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 51, 10,
-/* 0x61e0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x61f0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 67, 84, 67, 76, 69, 86, 69,
-/* 0x6200 */  50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6210 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6220 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95,
-/* 0x6230 */  51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6240 */ 102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48, 48, 48,
-/* 0x6250 */  48, 48, 52, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6260 */  32, 32, 32, 32, 32, 32, 67, 65, 76, 76, 84, 82, 49, 49, 10, 10,
-/* 0x6270 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6280 */  68, 83, 32, 70, 79, 82, 32, 91, 67, 65, 76, 76, 84, 82, 49, 51,
-/* 0x6290 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x62a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x62b0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95, 51,
-/* 0x62c0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67,
-/* 0x62d0 */  65, 76, 76, 84, 82, 49, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x62e0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x62f0 */  91, 99,116,111,107, 51, 50, 46, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x6300 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x6310 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x6320 */  48, 48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x6330 */  32, 32, 32, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95,
-/* 0x6340 */ 108,101,110,103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32,
-/* 0x6350 */  82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6360 */  32, 32, 99,116,111,107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76,
-/* 0x6370 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6380 */  70, 79, 82, 32, 91, 99,116,111,107, 51, 50, 46, 49, 48, 93, 58,
-/* 0x6390 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x63a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x63b0 */  69, 10, 48, 48, 48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54,
-/* 0x63c0 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,
-/* 0x63d0 */ 107, 51, 50, 46, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x63e0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x63f0 */  99,116,111,107, 51, 50, 46, 50, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6400 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6410 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6420 */  48, 48, 48, 48, 53, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6430 */  32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52,
-/* 0x6440 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82, 95, 51, 56, 54,
-/* 0x6450 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,
-/* 0x6460 */ 107, 51, 50, 46, 52, 48, 10, 48, 48, 48, 48, 48, 48, 48,101, 32,
-/* 0x6470 */  82, 95, 51, 56, 54, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6480 */  32, 32,102,105,108,116,101,114, 95, 99,116,111, 10, 48, 48, 48,
-/* 0x6490 */  48, 48, 48, 49, 48, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x64a0 */  32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 52,
-/* 0x64b0 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x64c0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51,
-/* 0x64d0 */  50, 46, 51, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x64e0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x64f0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x6500 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x6510 */  32, 32, 32, 99,116,111,107, 51, 50, 46, 52, 48, 10, 48, 48, 48,
-/* 0x6520 */  48, 48, 48, 48, 57, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6530 */  32, 32, 32, 32, 32, 32, 32, 32, 99,116,111,107, 51, 50, 46, 49,
-/* 0x6540 */  48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6550 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,116,111,107, 51,
-/* 0x6560 */  50, 46, 52, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x6570 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6580 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x6590 */  32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x65a0 */  32, 32, 32, 99,116,111,107, 51, 50, 46, 48, 48, 10, 10, 82, 69,
-/* 0x65b0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x65c0 */  32, 70, 79, 82, 32, 91, 80, 69, 73, 77, 80, 79, 82, 84, 93, 58,
-/* 0x65d0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x65e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x65f0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54,
-/* 0x6600 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,111,109,
-/* 0x6610 */ 112,114,101,115,115,101,100, 95,105,109,112,111,114,116,115, 10,
-/* 0x6620 */  48, 48, 48, 48, 48, 48, 48, 98, 32, 82, 95, 51, 56, 54, 95, 80,
-/* 0x6630 */  67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 80, 69, 73, 77, 68,
-/* 0x6640 */  79, 78, 69, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 51,
-/* 0x6650 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,115,
-/* 0x6660 */ 116, 97,114,116, 95,111,102, 95,105,109,112,111,114,116,115, 10,
-/* 0x6670 */  48, 48, 48, 48, 48, 48, 49,101, 32, 82, 95, 51, 56, 54, 95, 51,
-/* 0x6680 */  50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,111, 97,100, 76,
-/* 0x6690 */ 105, 98,114, 97,114,121, 65, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x66a0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x66b0 */  91, 80, 69, 73, 66, 89, 79, 82, 68, 93, 58, 10, 79, 70, 70, 83,
-/* 0x66c0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x66d0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x66e0 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x66f0 */  32, 32, 32, 32, 32, 32, 32, 32, 80, 69, 73, 77, 79, 82, 68, 49,
-/* 0x6700 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6710 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 75, 51, 50, 79,
-/* 0x6720 */  82, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6730 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6740 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 97, 32, 82,
-/* 0x6750 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6760 */  32,107,101,114,110,101,108, 51, 50, 95,111,114,100,105,110, 97,
-/* 0x6770 */ 108,115, 10, 48, 48, 48, 48, 48, 48, 48,102, 32, 82, 95, 51, 56,
-/* 0x6780 */  54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 80, 69,
-/* 0x6790 */  73, 77, 80, 79, 82, 50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x67a0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x67b0 */  80, 69, 73, 77, 80, 79, 82, 50, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x67c0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x67d0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x67e0 */  48, 48, 48, 55, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32,
-/* 0x67f0 */  32, 32, 32, 32, 32, 32, 32, 71,101,116, 80,114,111, 99, 65,100,
-/* 0x6800 */ 100,114,101,115,115, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82,
-/* 0x6810 */  95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6820 */  32, 80, 69, 73, 77, 80, 79, 82, 84, 10, 10, 82, 69, 76, 79, 67,
-/* 0x6830 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x6840 */  82, 32, 91, 80, 69, 73, 69, 82, 69, 88, 69, 93, 58, 10, 79, 70,
-/* 0x6850 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x6860 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x6870 */  48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x6880 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 69,120,105,116, 80,114,
-/* 0x6890 */ 111, 99,101,115,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x68a0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80,
-/* 0x68b0 */  69, 82, 69, 76, 79, 67, 49, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x68c0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x68d0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x68e0 */  48, 48, 50, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x68f0 */  32, 32, 32, 32, 32, 32,115,116, 97,114,116, 95,111,102, 95,114,
-/* 0x6900 */ 101,108,111, 99,115, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x6910 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 82,
-/* 0x6920 */  69, 76, 79, 67, 51, 50, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x6930 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6940 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x6950 */  48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32, 32, 32,
-/* 0x6960 */  32, 32, 32, 32, 32, 32, 82, 69, 76, 79, 67, 51, 50, 74, 10, 10,
-/* 0x6970 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x6980 */  68, 83, 32, 70, 79, 82, 32, 91, 82, 69, 76, 51, 50, 66, 73, 71,
-/* 0x6990 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x69a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x69b0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 51,
-/* 0x69c0 */  56, 54, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32, 82,
-/* 0x69d0 */  69, 76, 79, 67, 51, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x69e0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x69f0 */  91, 82, 69, 76, 79, 67, 51, 50, 74, 93, 58, 10, 79, 70, 70, 83,
-/* 0x6a00 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a10 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x6a20 */  48, 48, 48, 48, 49, 32, 82, 95, 51, 56, 54, 95, 80, 67, 56, 32,
-/* 0x6a30 */  32, 32, 32, 32, 32, 32, 32, 32, 82, 69, 76, 79, 67, 51, 50, 48,
-/* 0x6a40 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6a50 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 82, 76, 79, 72,
-/* 0x6a60 */  73, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x6a70 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6a80 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x6a90 */  95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6aa0 */  32,114,101,108,111, 99, 95,100,101,108,116, 10, 10, 82, 69, 76,
-/* 0x6ab0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x6ac0 */  70, 79, 82, 32, 91, 80, 69, 68, 69, 80, 72, 65, 75, 93, 58, 10,
-/* 0x6ad0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x6ae0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x6af0 */  10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6b00 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,105,114,116,
-/* 0x6b10 */ 117, 97,108, 80,114,111,116,101, 99,116, 10, 48, 48, 48, 48, 48,
-/* 0x6b20 */  48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32, 32, 32, 32,
-/* 0x6b30 */  32, 32, 32, 32, 32, 32,118,112, 95, 98, 97,115,101, 10, 48, 48,
-/* 0x6b40 */  48, 48, 48, 48, 48,100, 32, 82, 95, 51, 56, 54, 95, 51, 50, 32,
-/* 0x6b50 */  32, 32, 32, 32, 32, 32, 32, 32, 32,118,112, 95,115,105,122,101,
-/* 0x6b60 */  10, 48, 48, 48, 48, 48, 48, 49, 98, 32, 82, 95, 51, 56, 54, 95,
-/* 0x6b70 */  51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,115,119,114,105,
-/* 0x6b80 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6b90 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 84, 76, 83, 67,
-/* 0x6ba0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x6bb0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x6bc0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 51,
-/* 0x6bd0 */  56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,116,
-/* 0x6be0 */ 108,115, 95,109,111,100,117,108,101, 95, 98, 97,115,101, 10, 48,
-/* 0x6bf0 */  48, 48, 48, 48, 48, 48, 56, 32, 82, 95, 51, 56, 54, 95, 51, 50,
-/* 0x6c00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 80, 69, 84, 76, 83, 67,
-/* 0x6c10 */  50, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x6c20 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 68, 79, 74,
-/* 0x6c30 */  85, 77, 80, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x6c40 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6c50 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 49, 32,
-/* 0x6c60 */  82, 95, 51, 56, 54, 95, 80, 67, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x6c70 */  32, 32,111,114,105,103,105,110, 97,108, 95,101,110,116,114,121,
-/* 0x6c80 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x6c90 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 80, 69, 84, 76, 83, 67,
-/* 0x6ca0 */  50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x6cb0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x6cc0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95,
-/* 0x6cd0 */  51, 56, 54, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x6ce0 */ 116,108,115, 95, 99, 97,108,108, 98, 97, 99,107,115, 95,112,116,
-/* 0x6cf0 */ 114, 10
+/* 0x1b20 */   0,  0,  0, 45,125,  0,  0,  0,153,  0,  0,  0,106,  0,  0,  0,
+/* 0x1b30 */  45,  6,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1b40 */   0,  0,  0,  0,  9,  0,  0,  0, 63,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1b50 */   0,  0,  0,  0, 18,  0,  0,  0, 64,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1b60 */   0,  0,  0,  0, 27,  0,  0,  0, 69,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1b70 */   0,  0,  0,  0, 36,  0,  0,  0, 81,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1b80 */   0,  0,  0,  0, 45,  0,  0,  0, 87,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1b90 */   0,  0,  0,  0, 54,  0,  0,  0, 94,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1ba0 */   0,  0,  0,  0, 63,  0,  0,  0,103,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1bb0 */   0,  0,  0,  0, 72,  0,  0,  0,118,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1bc0 */   0,  0,  0,  0, 81,  0,  0,  0,119,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1bd0 */   0,  0,  0,  0, 90,  0,  0,  0,122,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1be0 */   0,  0,  0,  0, 99,  0,  0,  0,125,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1bf0 */   0,  0,  0,  0,108,  0,  0,  0,127,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1c00 */   0,  0,  0,  0,117,  0,  0,  0,133,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1c10 */   0,  0,  0,  0,126,  0,  0,  0,144,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1c20 */   0,  0,  0,  0,135,  0,  0,  0,149,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1c30 */   0,  0,  0,  0,144,  0,  0,  0,156,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1c40 */   0,  0,  0,  0,153,  0,  0,  0,169,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1c50 */   0,  0,  0,  0,162,  0,  0,  0,182,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1c60 */   0,  0,  0,  0,171,  0,  0,  0,197,  0,  0,  0, 62,  0,  0,  0,
+/* 0x1c70 */   0,  0,  0,  0,180,  0,  0,  0,  3,  1,  0,  0, 13,  0,  0,  0,
+/* 0x1c80 */   0,  0,  0,  0,189,  0,  0,  0, 16,  1,  0,  0, 15,  0,  0,  0,
+/* 0x1c90 */   0,  0,  0,  0,198,  0,  0,  0, 31,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1ca0 */   0,  0,  0,  0,207,  0,  0,  0, 33,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1cb0 */   0,  0,  0,  0,216,  0,  0,  0, 36,  1,  0,  0,  9,  0,  0,  0,
+/* 0x1cc0 */   0,  0,  0,  0,225,  0,  0,  0, 45,  1,  0,  0, 14,  0,  0,  0,
+/* 0x1cd0 */   0,  0,  0,  0,234,  0,  0,  0, 59,  1,  0,  0, 22,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  0,  0,243,  0,  0,  0, 81,  1,  0,  0, 22,  0,  0,  0,
+/* 0x1cf0 */   0,  0,  0,  0,252,  0,  0,  0,103,  1,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,  0,  0,  0,  5,  1,  0,  0,103,  1,  0,  0,  3,  0,  0,  0,
+/* 0x1d10 */   0,  0,  0,  0, 14,  1,  0,  0,106,  1,  0,  0,  2,  0,  0,  0,
+/* 0x1d20 */   0,  0,  0,  0, 23,  1,  0,  0,108,  1,  0,  0,  6,  0,  0,  0,
+/* 0x1d30 */   0,  0,  0,  0, 32,  1,  0,  0,114,  1,  0,  0, 11,  0,  0,  0,
+/* 0x1d40 */   0,  0,  0,  0, 41,  1,  0,  0,125,  1,  0,  0,  5,  0,  0,  0,
+/* 0x1d50 */   0,  0,  0,  0, 50,  1,  0,  0,130,  1,  0,  0,  7,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0, 59,  1,  0,  0,137,  1,  0,  0, 13,  0,  0,  0,
+/* 0x1d70 */   0,  0,  0,  0, 68,  1,  0,  0,150,  1,  0,  0, 13,  0,  0,  0,
+/* 0x1d80 */   0,  0,  0,  0, 77,  1,  0,  0,163,  1,  0,  0, 15,  0,  0,  0,
+/* 0x1d90 */   0,  0,  0,  0, 86,  1,  0,  0,178,  1,  0,  0, 82,  0,  0,  0,
+/* 0x1da0 */   0,  0,  0,  0, 95,  1,  0,  0,  4,  2,  0,  0, 13,  0,  0,  0,
+/* 0x1db0 */   0,  0,  0,  0,104,  1,  0,  0, 17,  2,  0,  0, 15,  0,  0,  0,
+/* 0x1dc0 */   0,  0,  0,  0,113,  1,  0,  0, 32,  2,  0,  0,  2,  0,  0,  0,
+/* 0x1dd0 */   0,  0,  0,  0,122,  1,  0,  0, 34,  2,  0,  0,  3,  0,  0,  0,
+/* 0x1de0 */   0,  0,  0,  0,131,  1,  0,  0, 37,  2,  0,  0,  9,  0,  0,  0,
+/* 0x1df0 */   0,  0,  0,  0,140,  1,  0,  0, 46,  2,  0,  0, 14,  0,  0,  0,
+/* 0x1e00 */   0,  0,  0,  0,149,  1,  0,  0, 60,  2,  0,  0, 22,  0,  0,  0,
+/* 0x1e10 */   0,  0,  0,  0,158,  1,  0,  0, 82,  2,  0,  0, 22,  0,  0,  0,
+/* 0x1e20 */   0,  0,  0,  0,167,  1,  0,  0,104,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1e30 */   0,  0,  0,  0,176,  1,  0,  0,104,  2,  0,  0,  3,  0,  0,  0,
+/* 0x1e40 */   0,  0,  0,  0,185,  1,  0,  0,107,  2,  0,  0,  2,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,194,  1,  0,  0,109,  2,  0,  0,  6,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,203,  1,  0,  0,115,  2,  0,  0, 11,  0,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0,212,  1,  0,  0,126,  2,  0,  0,  5,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0,221,  1,  0,  0,131,  2,  0,  0,  7,  0,  0,  0,
+/* 0x1e90 */   0,  0,  0,  0,230,  1,  0,  0,138,  2,  0,  0, 13,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0,239,  1,  0,  0,151,  2,  0,  0, 13,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0,248,  1,  0,  0,164,  2,  0,  0, 15,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  1,  2,  0,  0,179,  2,  0,  0, 95,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0, 10,  2,  0,  0, 18,  3,  0,  0, 13,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0, 19,  2,  0,  0, 31,  3,  0,  0, 15,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0, 28,  2,  0,  0, 46,  3,  0,  0,  2,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0, 37,  2,  0,  0, 48,  3,  0,  0,  3,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0, 46,  2,  0,  0, 51,  3,  0,  0,  9,  0,  0,  0,
+/* 0x1f20 */   0,  0,  0,  0, 55,  2,  0,  0, 60,  3,  0,  0, 14,  0,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0, 64,  2,  0,  0, 74,  3,  0,  0, 22,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0, 73,  2,  0,  0, 96,  3,  0,  0, 22,  0,  0,  0,
+/* 0x1f50 */   0,  0,  0,  0, 82,  2,  0,  0,118,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0, 91,  2,  0,  0,118,  3,  0,  0, 46,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,102,  2,  0,  0,164,  3,  0,  0, 72,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,113,  2,  0,  0,236,  3,  0,  0,134, 10,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0,124,  2,  0,  0,114, 14,  0,  0,134, 10,  0,  0,
+/* 0x1fa0 */   0,  0,  0,  0,135,  2,  0,  0,248, 24,  0,  0, 26,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,146,  2,  0,  0, 18, 25,  0,  0,  1,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0,155,  2,  0,  0, 19, 25,  0,  0,  4,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0,165,  2,  0,  0, 23, 25,  0,  0,  6,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,174,  2,  0,  0, 29, 25,  0,  0,  2,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0,183,  2,  0,  0, 31, 25,  0,  0, 14,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0,192,  2,  0,  0, 45, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,201,  2,  0,  0, 50, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0,210,  2,  0,  0, 55, 25,  0,  0,  4,  0,  0,  0,
+/* 0x2030 */   0,  0,  0,  0,219,  2,  0,  0, 59, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,228,  2,  0,  0, 61, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,237,  2,  0,  0, 66, 25,  0,  0, 16,  0,  0,  0,
+/* 0x2060 */   0,  0,  0,  0,246,  2,  0,  0, 82, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2070 */   0,  0,  0,  0,255,  2,  0,  0, 87, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,  8,  3,  0,  0, 89, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2090 */   0,  0,  0,  0, 17,  3,  0,  0, 91, 25,  0,  0,  4,  0,  0,  0,
+/* 0x20a0 */   0,  0,  0,  0, 26,  3,  0,  0, 95, 25,  0,  0,  5,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0, 35,  3,  0,  0,100, 25,  0,  0,  2,  0,  0,  0,
+/* 0x20c0 */   0,  0,  0,  0, 44,  3,  0,  0,102, 25,  0,  0,  4,  0,  0,  0,
+/* 0x20d0 */   0,  0,  0,  0, 53,  3,  0,  0,106, 25,  0,  0,  2,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0, 62,  3,  0,  0,108, 25,  0,  0,  5,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0, 71,  3,  0,  0,113, 25,  0,  0,  7,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0, 80,  3,  0,  0,120, 25,  0,  0, 10,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,  0, 90,  3,  0,  0,130, 25,  0,  0, 14,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0,100,  3,  0,  0,144, 25,  0,  0, 32,  0,  0,  0,
+/* 0x2130 */   0,  0,  0,  0,110,  3,  0,  0,176, 25,  0,  0, 10,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,  0,120,  3,  0,  0,186, 25,  0,  0,  5,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0,130,  3,  0,  0,191, 25,  0,  0, 44,  0,  0,  0,
+/* 0x2160 */   0,  0,  0,  0,139,  3,  0,  0,235, 25,  0,  0,  2,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  0,148,  3,  0,  0,237, 25,  0,  0, 16,  0,  0,  0,
+/* 0x2180 */   0,  0,  0,  0,157,  3,  0,  0,253, 25,  0,  0,  7,  0,  0,  0,
+/* 0x2190 */   0,  0,  0,  0,166,  3,  0,  0,  4, 26,  0,  0, 22,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0,175,  3,  0,  0, 26, 26,  0,  0,  6,  0,  0,  0,
+/* 0x21b0 */   0,  0,  0,  0,184,  3,  0,  0, 32, 26,  0,  0,  6,  0,  0,  0,
+/* 0x21c0 */   0,  0,  0,  0,193,  3,  0,  0, 38, 26,  0,  0,  0,  0,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0,202,  3,  0,  0, 38, 26,  0,  0,  6,  0,  0,  0,
+/* 0x21e0 */   0,  0,  0,  0,211,  3,  0,  0, 44, 26,  0,  0,  3,  0,  0,  0,
+/* 0x21f0 */   0,  0,  0,  0,220,  3,  0,  0, 47, 26,  0,  0,  3,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0,229,  3,  0,  0, 50, 26,  0,  0, 41,  0,  0,  0,
+/* 0x2210 */   0,  0,  0,  0,238,  3,  0,  0, 91, 26,  0,  0,  9,  0,  0,  0,
+/* 0x2220 */   0,  0,  0,  0,247,  3,  0,  0,100, 26,  0,  0,  2,  0,  0,  0,
+/* 0x2230 */   0,  0,  0,  0,  0,  4,  0,  0,102, 26,  0,  0,  0,  0,  0,  0,
+/* 0x2240 */   0,  0,  0,  0,  9,  4,  0,  0,102, 26,  0,  0,  8,  0,  0,  0,
+/* 0x2250 */   0,  0,  0,  0, 18,  4,  0,  0,110, 26,  0,  0, 10,  0,  0,  0,
+/* 0x2260 */   0,  0,  0,  0, 27,  4,  0,  0,120, 26,  0,  0, 13,  0,  0,  0,
+/* 0x2270 */   0,  0,  0,  0, 36,  4,  0,  0,133, 26,  0,  0, 47,  0,  0,  0,
+/* 0x2280 */   0,  0,  0,  0, 45,  4,  0,  0,180, 26,  0,  0, 24,  0,  0,  0,
+/* 0x2290 */   0,  0,  0,  0, 52,  4,  0,  0,204, 26,  0,  0,  1,  0,  0,  0,
+/* 0x22a0 */   0,  0,  0,  0, 61,  4,  0,  0,205, 26,  0,  0, 13,  0,  0,  0,
+/* 0x22b0 */   0,  0,  0,  0, 72,  4,  0,  0,218, 26,  0,  0,  0,  0,  0,  0,
+/* 0x22c0 */   0,  0,  0,  0, 81,  4,  0,  0,218, 26,  0,  0,  6,  0,  0,  0,
+/* 0x22d0 */   0,  0,  0,  0, 90,  4,  0,  0,224, 26,  0,  0,  5,  0,  0,  0,
+/* 0x22e0 */   0,  0,  0,  0, 99,  4,  0,  0,229, 26,  0,  0, 31,  0,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0,107,  4,  0,  0,  4, 27,  0,  0, 32,  0,  0,  0,
+/* 0x2300 */   0,  0,  0,  0, 90,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2310 */ 108,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,
+/* 0x2320 */  13,  0,  0,  0,  0,  0,  0,  0,144,  0,  0,  0, 16,  0,  0,  0,
+/* 0x2330 */   0,  0,  0,  0,171,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2340 */ 216,  0,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,243,  0,  0,  0,
+/* 0x2350 */  27,  0,  0,  0,  0,  0,  0,  0,252,  0,  0,  0, 28,  0,  0,  0,
+/* 0x2360 */   0,  0,  0,  0,  5,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2370 */  23,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0, 32,  1,  0,  0,
+/* 0x2380 */  32,  0,  0,  0,  0,  0,  0,  0, 59,  1,  0,  0, 35,  0,  0,  0,
+/* 0x2390 */   0,  0,  0,  0, 86,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23a0 */ 131,  1,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0,
+/* 0x23b0 */  46,  0,  0,  0,  0,  0,  0,  0,167,  1,  0,  0, 47,  0,  0,  0,
+/* 0x23c0 */   0,  0,  0,  0,176,  1,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,
+/* 0x23d0 */ 194,  1,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,203,  1,  0,  0,
+/* 0x23e0 */  51,  0,  0,  0,  0,  0,  0,  0,230,  1,  0,  0, 54,  0,  0,  0,
+/* 0x23f0 */   0,  0,  0,  0,  1,  2,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2400 */  46,  2,  0,  0, 62,  0,  0,  0,  0,  0,  0,  0, 73,  2,  0,  0,
+/* 0x2410 */  65,  0,  0,  0,  0,  0,  0,  0, 82,  2,  0,  0, 66,  0,  0,  0,
+/* 0x2420 */   0,  0,  0,  0,183,  2,  0,  0, 76,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2430 */ 246,  2,  0,  0, 83,  0,  0,  0,  0,  0,  0,  0, 17,  3,  0,  0,
+/* 0x2440 */  86,  0,  0,  0,  0,  0,  0,  0, 71,  3,  0,  0, 92,  0,  0,  0,
+/* 0x2450 */   0,  0,  0,  0, 80,  3,  0,  0, 93,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2460 */  90,  3,  0,  0, 94,  0,  0,  0,  0,  0,  0,  0,100,  3,  0,  0,
+/* 0x2470 */  95,  0,  0,  0,  0,  0,  0,  0,120,  3,  0,  0, 97,  0,  0,  0,
+/* 0x2480 */   0,  0,  0,  0,130,  3,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2490 */ 157,  3,  0,  0,101,  0,  0,  0,  0,  0,  0,  0,166,  3,  0,  0,
+/* 0x24a0 */ 102,  0,  0,  0,  0,  0,  0,  0,193,  3,  0,  0,105,  0,  0,  0,
+/* 0x24b0 */   0,  0,  0,  0,229,  3,  0,  0,109,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24c0 */ 247,  3,  0,  0,111,  0,  0,  0,  0,  0,  0,  0, 72,  4,  0,  0,
+/* 0x24d0 */ 120,  0,  0,  0,  0,  0,  0,  0, 99,  4,  0,  0,123,  0,  0,  0,
+/* 0x24e0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x24f0 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2500 */   2,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2510 */   0,  0,  0,  0, 36,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2520 */  45,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x2530 */   6,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2540 */   0,  0,  0,  0, 72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2550 */  81,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,
+/* 0x2560 */  11,  0,  0,  0,  0,  0,  0,  0,126,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2570 */   0,  0,  0,  0,135,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2580 */ 153,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,162,  0,  0,  0,
+/* 0x2590 */  18,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0, 20,  0,  0,  0,
+/* 0x25a0 */   0,  0,  0,  0,189,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25b0 */ 198,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,207,  0,  0,  0,
+/* 0x25c0 */  23,  0,  0,  0,  0,  0,  0,  0,225,  0,  0,  0, 25,  0,  0,  0,
+/* 0x25d0 */   0,  0,  0,  0,234,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
+/* 0x25e0 */  14,  1,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0, 41,  1,  0,  0,
+/* 0x25f0 */  33,  0,  0,  0,  0,  0,  0,  0, 50,  1,  0,  0, 34,  0,  0,  0,
+/* 0x2600 */   0,  0,  0,  0, 68,  1,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2610 */  77,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0, 95,  1,  0,  0,
+/* 0x2620 */  39,  0,  0,  0,  0,  0,  0,  0,104,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2630 */   0,  0,  0,  0,113,  1,  0,  0, 41,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2640 */ 122,  1,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0,
+/* 0x2650 */  44,  0,  0,  0,  0,  0,  0,  0,149,  1,  0,  0, 45,  0,  0,  0,
+/* 0x2660 */   0,  0,  0,  0,185,  1,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2670 */ 212,  1,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,221,  1,  0,  0,
+/* 0x2680 */  53,  0,  0,  0,  0,  0,  0,  0,239,  1,  0,  0, 55,  0,  0,  0,
+/* 0x2690 */   0,  0,  0,  0,248,  1,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26a0 */  10,  2,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0, 19,  2,  0,  0,
+/* 0x26b0 */  59,  0,  0,  0,  0,  0,  0,  0, 28,  2,  0,  0, 60,  0,  0,  0,
+/* 0x26c0 */   0,  0,  0,  0, 37,  2,  0,  0, 61,  0,  0,  0,  0,  0,  0,  0,
+/* 0x26d0 */  55,  2,  0,  0, 63,  0,  0,  0,  0,  0,  0,  0, 64,  2,  0,  0,
+/* 0x26e0 */  64,  0,  0,  0,  0,  0,  0,  0, 91,  2,  0,  0, 67,  0,  0,  0,
+/* 0x26f0 */   0,  0,  0,  0,102,  2,  0,  0, 68,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2700 */ 113,  2,  0,  0, 69,  0,  0,  0,  0,  0,  0,  0,124,  2,  0,  0,
+/* 0x2710 */  70,  0,  0,  0,  0,  0,  0,  0,135,  2,  0,  0, 71,  0,  0,  0,
+/* 0x2720 */   0,  0,  0,  0,146,  2,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2730 */ 155,  2,  0,  0, 73,  0,  0,  0,  0,  0,  0,  0,165,  2,  0,  0,
+/* 0x2740 */  74,  0,  0,  0,  0,  0,  0,  0,174,  2,  0,  0, 75,  0,  0,  0,
+/* 0x2750 */   0,  0,  0,  0,192,  2,  0,  0, 77,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2760 */ 201,  2,  0,  0, 78,  0,  0,  0,  0,  0,  0,  0,210,  2,  0,  0,
+/* 0x2770 */  79,  0,  0,  0,  0,  0,  0,  0,219,  2,  0,  0, 80,  0,  0,  0,
+/* 0x2780 */   0,  0,  0,  0,228,  2,  0,  0, 81,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2790 */ 237,  2,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0,255,  2,  0,  0,
+/* 0x27a0 */  84,  0,  0,  0,  0,  0,  0,  0,  8,  3,  0,  0, 85,  0,  0,  0,
+/* 0x27b0 */   0,  0,  0,  0, 26,  3,  0,  0, 87,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27c0 */  35,  3,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0, 44,  3,  0,  0,
+/* 0x27d0 */  89,  0,  0,  0,  0,  0,  0,  0, 53,  3,  0,  0, 90,  0,  0,  0,
+/* 0x27e0 */   0,  0,  0,  0, 62,  3,  0,  0, 91,  0,  0,  0,  0,  0,  0,  0,
+/* 0x27f0 */ 110,  3,  0,  0, 96,  0,  0,  0,  0,  0,  0,  0,139,  3,  0,  0,
+/* 0x2800 */  99,  0,  0,  0,  0,  0,  0,  0,148,  3,  0,  0,100,  0,  0,  0,
+/* 0x2810 */   0,  0,  0,  0,175,  3,  0,  0,103,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2820 */ 184,  3,  0,  0,104,  0,  0,  0,  0,  0,  0,  0,202,  3,  0,  0,
+/* 0x2830 */ 106,  0,  0,  0,  0,  0,  0,  0,211,  3,  0,  0,107,  0,  0,  0,
+/* 0x2840 */   0,  0,  0,  0,220,  3,  0,  0,108,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2850 */ 238,  3,  0,  0,110,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
+/* 0x2860 */ 112,  0,  0,  0,  0,  0,  0,  0,  9,  4,  0,  0,113,  0,  0,  0,
+/* 0x2870 */   0,  0,  0,  0, 18,  4,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2880 */  27,  4,  0,  0,115,  0,  0,  0,  0,  0,  0,  0, 36,  4,  0,  0,
+/* 0x2890 */ 116,  0,  0,  0,  0,  0,  0,  0, 45,  4,  0,  0,117,  0,  0,  0,
+/* 0x28a0 */   0,  0,  0,  0, 52,  4,  0,  0,118,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28b0 */  61,  4,  0,  0,119,  0,  0,  0,  0,  0,  0,  0, 81,  4,  0,  0,
+/* 0x28c0 */ 121,  0,  0,  0,  0,  0,  0,  0, 90,  4,  0,  0,122,  0,  0,  0,
+/* 0x28d0 */   0,  0,  0,  0,107,  4,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,
+/* 0x28e0 */ 116,  4,  0,  0,126,  0,  0,  0,173,222,173,222,136,  4,  0,  0,
+/* 0x28f0 */ 126,  0,  0,  0,173,222,173,222,158,  4,  0,  0,126,  0,  0,  0,
+/* 0x2900 */ 173,222,173,222,170,  4,  0,  0,126,  0,  0,  0,173,222,173,222,
+/* 0x2910 */ 181,  4,  0,  0,126,  0,  0,  0,173,222,173,222,193,  4,  0,  0,
+/* 0x2920 */ 126,  0,  0,  0,173,222,173,222,203,  4,  0,  0,126,  0,  0,  0,
+/* 0x2930 */ 173,222,173,222,221,  4,  0,  0,126,  0,  0,  0,173,222,173,222,
+/* 0x2940 */ 232,  4,  0,  0,126,  0,  0,  0,173,222,173,222,243,  4,  0,  0,
+/* 0x2950 */ 126,  0,  0,  0,173,222,173,222,  3,  5,  0,  0,126,  0,  0,  0,
+/* 0x2960 */ 173,222,173,222, 23,  5,  0,  0,126,  0,  0,  0,173,222,173,222,
+/* 0x2970 */  37,  5,  0,  0,126,  0,  0,  0,173,222,173,222, 48,  5,  0,  0,
+/* 0x2980 */ 126,  0,  0,  0,173,222,173,222, 67,  5,  0,  0,126,  0,  0,  0,
+/* 0x2990 */ 173,222,173,222, 84,  5,  0,  0,126,  0,  0,  0,173,222,173,222,
+/* 0x29a0 */  97,  5,  0,  0,126,  0,  0,  0,173,222,173,222,115,  5,  0,  0,
+/* 0x29b0 */ 126,  0,  0,  0,173,222,173,222,130,  5,  0,  0,126,  0,  0,  0,
+/* 0x29c0 */ 173,222,173,222,142,  5,  0,  0,126,  0,  0,  0,173,222,173,222,
+/* 0x29d0 */ 158,  5,  0,  0,126,  0,  0,  0,173,222,173,222,169,  5,  0,  0,
+/* 0x29e0 */ 126,  0,  0,  0,173,222,173,222,184,  5,  0,  0,126,  0,  0,  0,
+/* 0x29f0 */ 173,222,173,222,192,  5,  0,  0,126,  0,  0,  0,173,222,173,222,
+/* 0x2a00 */ 200,  5,  0,  0,126,  0,  0,  0,173,222,173,222,205,  5,  0,  0,
+/* 0x2a10 */ 126,  0,  0,  0,173,222,173,222,221,  5,  0,  0,126,  0,  0,  0,
+/* 0x2a20 */ 173,222,173,222,236,  5,  0,  0,126,  0,  0,  0,173,222,173,222,
+/* 0x2a30 */   0,  0,  0,  0,  7,  0,  0,  0,254,  5,  0,  0, 72,  4,  0,  0,
+/* 0x2a40 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2a50 */   9,  6,  0,  0,116,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a60 */   3,  0,  0,  0,  8,  0,  0,  0,254,  5,  0,  0,116,  4,  0,  0,
+/* 0x2a70 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2a80 */   9,  6,  0,  0,136,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2a90 */   5,  0,  0,  0,  3,  0,  0,  0,  9,  6,  0,  0,158,  4,  0,  0,
+/* 0x2aa0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2ab0 */   9,  6,  0,  0,158,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ac0 */   6,  0,  0,  0,  7,  0,  0,  0, 18,  6,  0,  0,170,  4,  0,  0,
+/* 0x2ad0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2ae0 */   9,  6,  0,  0,181,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2af0 */   7,  0,  0,  0, 10,  0,  0,  0,  9,  6,  0,  0,193,  4,  0,  0,
+/* 0x2b00 */   0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2b10 */  27,  6,  0,  0,117,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b20 */  11,  0,  0,  0,  1,  0,  0,  0, 27,  6,  0,  0,117,  0,  0,  0,
+/* 0x2b30 */   0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2b40 */  27,  6,  0,  0, 90,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b50 */  15,  0,  0,  0,  1,  0,  0,  0, 27,  6,  0,  0,108,  0,  0,  0,
+/* 0x2b60 */   0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2b70 */  27,  6,  0,  0,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b80 */  18,  0,  0,  0,  3,  0,  0,  0, 27,  6,  0,  0,144,  0,  0,  0,
+/* 0x2b90 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2ba0 */  27,  6,  0,  0,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bb0 */  19,  0,  0,  0, 17,  0,  0,  0, 27,  6,  0,  0,252,  0,  0,  0,
+/* 0x2bc0 */   0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0, 47,  0,  0,  0,
+/* 0x2bd0 */  27,  6,  0,  0,216,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2be0 */  20,  0,  0,  0, 12,  0,  0,  0, 27,  6,  0,  0,171,  0,  0,  0,
+/* 0x2bf0 */   0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2c00 */  27,  6,  0,  0,171,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c10 */  21,  0,  0,  0, 14,  0,  0,  0, 27,  6,  0,  0,171,  0,  0,  0,
+/* 0x2c20 */   0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0, 10,  0,  0,  0,
+/* 0x2c30 */ 254,  5,  0,  0,117,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c40 */  26,  0,  0,  0,  7,  0,  0,  0, 27,  6,  0,  0,243,  0,  0,  0,
+/* 0x2c50 */   0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2c60 */ 254,  5,  0,  0,117,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c70 */  27,  0,  0,  0, 18,  0,  0,  0,254,  5,  0,  0,117,  0,  0,  0,
+/* 0x2c80 */   0,  0,  0,  0,  0,  0,  0,  0, 29,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2c90 */  27,  6,  0,  0, 32,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ca0 */  30,  0,  0,  0,  1,  0,  0,  0, 27,  6,  0,  0, 32,  1,  0,  0,
+/* 0x2cb0 */   0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2cc0 */  27,  6,  0,  0,  5,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2cd0 */  34,  0,  0,  0,  1,  0,  0,  0, 27,  6,  0,  0, 23,  1,  0,  0,
+/* 0x2ce0 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2cf0 */  27,  6,  0,  0, 86,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d00 */  37,  0,  0,  0,  5,  0,  0,  0, 27,  6,  0,  0, 86,  1,  0,  0,
+/* 0x2d10 */   0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2d20 */  27,  6,  0,  0, 86,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d30 */  38,  0,  0,  0, 15,  0,  0,  0, 27,  6,  0,  0, 59,  1,  0,  0,
+/* 0x2d40 */   0,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0, 33,  0,  0,  0,
+/* 0x2d50 */  27,  6,  0,  0,167,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d60 */  38,  0,  0,  0, 67,  0,  0,  0, 27,  6,  0,  0,131,  1,  0,  0,
+/* 0x2d70 */   0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2d80 */  27,  6,  0,  0, 86,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d90 */  40,  0,  0,  0,  3,  0,  0,  0, 27,  6,  0,  0, 86,  1,  0,  0,
+/* 0x2da0 */   0,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2db0 */  27,  6,  0,  0, 86,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2dc0 */  44,  0,  0,  0, 10,  0,  0,  0,254,  5,  0,  0, 32,  1,  0,  0,
+/* 0x2dd0 */   0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2de0 */  27,  6,  0,  0,158,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2df0 */  45,  0,  0,  0, 18,  0,  0,  0,254,  5,  0,  0, 32,  1,  0,  0,
+/* 0x2e00 */   0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2e10 */ 254,  5,  0,  0, 32,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e20 */  48,  0,  0,  0,  1,  0,  0,  0, 27,  6,  0,  0,203,  1,  0,  0,
+/* 0x2e30 */   0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2e40 */  27,  6,  0,  0,203,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e50 */  52,  0,  0,  0,  1,  0,  0,  0, 27,  6,  0,  0,176,  1,  0,  0,
+/* 0x2e60 */   0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2e70 */  27,  6,  0,  0,194,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2e80 */  55,  0,  0,  0, 12,  0,  0,  0, 27,  6,  0,  0,  1,  2,  0,  0,
+/* 0x2e90 */   0,  0,  0,  0,  0,  0,  0,  0, 56,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2ea0 */  27,  6,  0,  0,  1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2eb0 */  56,  0,  0,  0, 14,  0,  0,  0, 27,  6,  0,  0,  1,  2,  0,  0,
+/* 0x2ec0 */   0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2ed0 */  27,  6,  0,  0,230,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ee0 */  57,  0,  0,  0, 30,  0,  0,  0, 27,  6,  0,  0, 46,  2,  0,  0,
+/* 0x2ef0 */   0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0, 48,  0,  0,  0,
+/* 0x2f00 */  27,  6,  0,  0, 82,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */  58,  0,  0,  0, 12,  0,  0,  0, 27,  6,  0,  0,  1,  2,  0,  0,
+/* 0x2f20 */   0,  0,  0,  0,  0,  0,  0,  0, 59,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2f30 */  27,  6,  0,  0,  1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f40 */  59,  0,  0,  0, 14,  0,  0,  0, 27,  6,  0,  0,  1,  2,  0,  0,
+/* 0x2f50 */   0,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 10,  0,  0,  0,
+/* 0x2f60 */ 254,  5,  0,  0,203,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2f70 */  64,  0,  0,  0,  7,  0,  0,  0, 27,  6,  0,  0, 73,  2,  0,  0,
+/* 0x2f80 */   0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2f90 */ 254,  5,  0,  0,203,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fa0 */  65,  0,  0,  0, 18,  0,  0,  0,254,  5,  0,  0,203,  1,  0,  0,
+/* 0x2fb0 */   0,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2fc0 */   9,  6,  0,  0,203,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2fd0 */  67,  0,  0,  0, 20,  0,  0,  0,  9,  6,  0,  0,221,  4,  0,  0,
+/* 0x2fe0 */   0,  0,  0,  0,  0,  0,  0,  0, 67,  0,  0,  0, 30,  0,  0,  0,
+/* 0x2ff0 */   9,  6,  0,  0,232,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */  67,  0,  0,  0, 42,  0,  0,  0,  9,  6,  0,  0,243,  4,  0,  0,
+/* 0x3010 */   0,  0,  0,  0,  0,  0,  0,  0, 74,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3020 */   9,  6,  0,  0,  3,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */  76,  0,  0,  0,  1,  0,  0,  0,  9,  6,  0,  0, 23,  5,  0,  0,
+/* 0x3040 */   0,  0,  0,  0,  0,  0,  0,  0, 77,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3050 */  37,  6,  0,  0, 37,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3060 */  77,  0,  0,  0,  4,  0,  0,  0, 27,  6,  0,  0,183,  2,  0,  0,
+/* 0x3070 */   0,  0,  0,  0,  0,  0,  0,  0, 82,  0,  0,  0, 15,  0,  0,  0,
+/* 0x3080 */  27,  6,  0,  0,183,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3090 */  83,  0,  0,  0,  1,  0,  0,  0,  9,  6,  0,  0, 23,  5,  0,  0,
+/* 0x30a0 */   0,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0,  3,  0,  0,  0,
+/* 0x30b0 */  27,  6,  0,  0, 71,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30c0 */  87,  0,  0,  0,  2,  0,  0,  0, 37,  6,  0,  0, 37,  5,  0,  0,
+/* 0x30d0 */   0,  0,  0,  0,  0,  0,  0,  0, 87,  0,  0,  0,  4,  0,  0,  0,
+/* 0x30e0 */  27,  6,  0,  0, 17,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x30f0 */  92,  0,  0,  0,  6,  0,  0,  0, 27,  6,  0,  0,246,  2,  0,  0,
+/* 0x3100 */   0,  0,  0,  0,  0,  0,  0,  0, 93,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3110 */   9,  6,  0,  0, 23,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3120 */  93,  0,  0,  0,  6,  0,  0,  0, 27,  6,  0,  0,100,  3,  0,  0,
+/* 0x3130 */   0,  0,  0,  0,  0,  0,  0,  0, 94,  0,  0,  0, 13,  0,  0,  0,
+/* 0x3140 */  27,  6,  0,  0,100,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3150 */  95,  0,  0,  0,  5,  0,  0,  0, 27,  6,  0,  0,120,  3,  0,  0,
+/* 0x3160 */   0,  0,  0,  0,  0,  0,  0,  0, 95,  0,  0,  0, 10,  0,  0,  0,
+/* 0x3170 */  27,  6,  0,  0,120,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3180 */  95,  0,  0,  0, 14,  0,  0,  0, 37,  6,  0,  0, 37,  5,  0,  0,
+/* 0x3190 */   0,  0,  0,  0,  0,  0,  0,  0, 95,  0,  0,  0, 16,  0,  0,  0,
+/* 0x31a0 */  27,  6,  0,  0,120,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31b0 */  96,  0,  0,  0,  4,  0,  0,  0, 27,  6,  0,  0,120,  3,  0,  0,
+/* 0x31c0 */   0,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,  9,  0,  0,  0,
+/* 0x31d0 */  27,  6,  0,  0, 90,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x31e0 */  97,  0,  0,  0,  4,  0,  0,  0, 27,  6,  0,  0, 80,  3,  0,  0,
+/* 0x31f0 */   0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,  2,  0,  0,  0,
+/* 0x3200 */   9,  6,  0,  0, 48,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3210 */  98,  0,  0,  0, 11,  0,  0,  0, 27,  6,  0,  0,193,  3,  0,  0,
+/* 0x3220 */   0,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0, 18,  0,  0,  0,
+/* 0x3230 */   9,  6,  0,  0, 67,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3240 */  98,  0,  0,  0, 30,  0,  0,  0,  9,  6,  0,  0, 84,  5,  0,  0,
+/* 0x3250 */   0,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,  1,  0,  0,  0,
+/* 0x3260 */  27,  6,  0,  0,157,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3270 */ 100,  0,  0,  0, 10,  0,  0,  0,  9,  6,  0,  0, 97,  5,  0,  0,
+/* 0x3280 */   0,  0,  0,  0,  0,  0,  0,  0,100,  0,  0,  0, 15,  0,  0,  0,
+/* 0x3290 */  27,  6,  0,  0,166,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32a0 */ 102,  0,  0,  0,  7,  0,  0,  0,  9,  6,  0,  0,115,  5,  0,  0,
+/* 0x32b0 */   0,  0,  0,  0,  0,  0,  0,  0,102,  0,  0,  0, 21,  0,  0,  0,
+/* 0x32c0 */  27,  6,  0,  0,130,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x32d0 */ 104,  0,  0,  0,  2,  0,  0,  0,  9,  6,  0,  0,130,  5,  0,  0,
+/* 0x32e0 */   0,  0,  0,  0,  0,  0,  0,  0,106,  0,  0,  0,  2,  0,  0,  0,
+/* 0x32f0 */   9,  6,  0,  0,142,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3300 */ 109,  0,  0,  0,  8,  0,  0,  0, 27,  6,  0,  0,247,  3,  0,  0,
+/* 0x3310 */   0,  0,  0,  0,  0,  0,  0,  0,110,  0,  0,  0,  3,  0,  0,  0,
+/* 0x3320 */  27,  6,  0,  0,229,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3330 */ 111,  0,  0,  0,  1,  0,  0,  0, 27,  6,  0,  0,229,  3,  0,  0,
+/* 0x3340 */   0,  0,  0,  0,  0,  0,  0,  0,113,  0,  0,  0,  4,  0,  0,  0,
+/* 0x3350 */   9,  6,  0,  0,158,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3360 */ 116,  0,  0,  0,  2,  0,  0,  0,  9,  6,  0,  0,169,  5,  0,  0,
+/* 0x3370 */   0,  0,  0,  0,  0,  0,  0,  0,116,  0,  0,  0,  8,  0,  0,  0,
+/* 0x3380 */   9,  6,  0,  0,184,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3390 */ 116,  0,  0,  0, 13,  0,  0,  0,  9,  6,  0,  0,192,  5,  0,  0,
+/* 0x33a0 */   0,  0,  0,  0,  0,  0,  0,  0,116,  0,  0,  0, 27,  0,  0,  0,
+/* 0x33b0 */   9,  6,  0,  0,200,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33c0 */ 117,  0,  0,  0,  2,  0,  0,  0,  9,  6,  0,  0,205,  5,  0,  0,
+/* 0x33d0 */   0,  0,  0,  0,  0,  0,  0,  0,117,  0,  0,  0,  8,  0,  0,  0,
+/* 0x33e0 */   9,  6,  0,  0, 99,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x33f0 */ 122,  0,  0,  0,  1,  0,  0,  0,254,  5,  0,  0,221,  5,  0,  0,
+/* 0x3400 */   0,  0,  0,  0,  0,  0,  0,  0,123,  0,  0,  0,  4,  0,  0,  0,
+/* 0x3410 */   9,  6,  0,  0,236,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x3420 */  80, 69, 73, 83, 68, 76, 76, 49,  0, 80, 69, 77, 65, 73, 78, 48,
+/* 0x3430 */  49,  0, 80, 69, 83, 79, 67, 82, 69, 76,  0, 80, 69, 83, 79, 67,
+/* 0x3440 */  80, 73, 67,  0, 80, 69, 83, 79, 85, 78, 67, 48,  0, 80, 69, 73,
+/* 0x3450 */  67, 79, 78, 83, 49,  0, 80, 69, 73, 67, 79, 78, 83, 50,  0, 80,
+/* 0x3460 */  69, 84, 76, 83, 72, 65, 75,  0, 80, 69, 77, 65, 73, 78, 48, 50,
+/* 0x3470 */   0, 80, 69, 77, 65, 73, 78, 48, 51,  0, 78, 50, 66, 83, 77, 65,
+/* 0x3480 */  49, 48,  0, 78, 50, 66, 70, 65, 83, 49, 48,  0, 78, 50, 66, 70,
+/* 0x3490 */  65, 83, 49, 49,  0, 78, 50, 66, 68, 69, 67, 49, 48,  0, 78, 50,
+/* 0x34a0 */  66, 83, 77, 65, 50, 48,  0, 78, 50, 66, 70, 65, 83, 50, 48,  0,
+/* 0x34b0 */  78, 50, 66, 68, 69, 67, 50, 48,  0, 78, 50, 66, 83, 77, 65, 51,
+/* 0x34c0 */  48,  0, 78, 50, 66, 70, 65, 83, 51, 48,  0, 78, 50, 66, 68, 69,
+/* 0x34d0 */  67, 51, 48,  0, 78, 50, 66, 83, 77, 65, 52, 48,  0, 78, 50, 66,
+/* 0x34e0 */  70, 65, 83, 52, 48,  0, 78, 50, 66, 83, 77, 65, 53, 48,  0, 78,
+/* 0x34f0 */  50, 66, 70, 65, 83, 53, 48,  0, 78, 50, 66, 68, 69, 67, 53, 48,
+/* 0x3500 */   0, 78, 50, 66, 83, 77, 65, 54, 48,  0, 78, 50, 66, 70, 65, 83,
+/* 0x3510 */  54, 48,  0, 78, 50, 66, 70, 65, 83, 54, 49,  0, 78, 50, 66, 68,
+/* 0x3520 */  69, 67, 54, 48,  0, 78, 50, 68, 83, 77, 65, 49, 48,  0, 78, 50,
+/* 0x3530 */  68, 70, 65, 83, 49, 48,  0, 78, 50, 68, 70, 65, 83, 49, 49,  0,
+/* 0x3540 */  78, 50, 68, 68, 69, 67, 49, 48,  0, 78, 50, 68, 83, 77, 65, 50,
+/* 0x3550 */  48,  0, 78, 50, 68, 70, 65, 83, 50, 48,  0, 78, 50, 68, 68, 69,
+/* 0x3560 */  67, 50, 48,  0, 78, 50, 68, 83, 77, 65, 51, 48,  0, 78, 50, 68,
+/* 0x3570 */  70, 65, 83, 51, 48,  0, 78, 50, 68, 68, 69, 67, 51, 48,  0, 78,
+/* 0x3580 */  50, 68, 83, 77, 65, 52, 48,  0, 78, 50, 68, 70, 65, 83, 52, 48,
+/* 0x3590 */   0, 78, 50, 68, 83, 77, 65, 53, 48,  0, 78, 50, 68, 70, 65, 83,
+/* 0x35a0 */  53, 48,  0, 78, 50, 68, 68, 69, 67, 53, 48,  0, 78, 50, 68, 83,
+/* 0x35b0 */  77, 65, 54, 48,  0, 78, 50, 68, 70, 65, 83, 54, 48,  0, 78, 50,
+/* 0x35c0 */  68, 70, 65, 83, 54, 49,  0, 78, 50, 68, 68, 69, 67, 54, 48,  0,
+/* 0x35d0 */  78, 50, 69, 83, 77, 65, 49, 48,  0, 78, 50, 69, 70, 65, 83, 49,
+/* 0x35e0 */  48,  0, 78, 50, 69, 70, 65, 83, 49, 49,  0, 78, 50, 69, 68, 69,
+/* 0x35f0 */  67, 49, 48,  0, 78, 50, 69, 83, 77, 65, 50, 48,  0, 78, 50, 69,
+/* 0x3600 */  70, 65, 83, 50, 48,  0, 78, 50, 69, 68, 69, 67, 50, 48,  0, 78,
+/* 0x3610 */  50, 69, 83, 77, 65, 51, 48,  0, 78, 50, 69, 70, 65, 83, 51, 48,
+/* 0x3620 */   0, 78, 50, 69, 68, 69, 67, 51, 48,  0, 78, 50, 69, 83, 77, 65,
+/* 0x3630 */  52, 48,  0, 78, 50, 69, 70, 65, 83, 52, 48,  0, 78, 50, 69, 83,
+/* 0x3640 */  77, 65, 53, 48,  0, 78, 50, 69, 70, 65, 83, 53, 48,  0, 78, 50,
+/* 0x3650 */  69, 68, 69, 67, 53, 48,  0, 78, 50, 69, 83, 77, 65, 54, 48,  0,
+/* 0x3660 */  78, 50, 69, 70, 65, 83, 54, 48,  0, 78, 50, 69, 70, 65, 83, 54,
+/* 0x3670 */  49,  0, 78, 50, 69, 68, 69, 67, 54, 48,  0, 76, 90, 77, 65, 95,
+/* 0x3680 */  68, 69, 67, 48, 48,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
+/* 0x3690 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65,
+/* 0x36a0 */  95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51,
+/* 0x36b0 */  48,  0, 80, 69, 77, 65, 73, 78, 49, 48,  0, 80, 69, 84, 76, 83,
+/* 0x36c0 */  72, 65, 75, 50,  0, 80, 69, 67, 84, 84, 80, 79, 83,  0, 80, 69,
+/* 0x36d0 */  67, 84, 84, 78, 85, 76,  0, 67, 65, 76, 76, 84, 82, 48, 48,  0,
+/* 0x36e0 */  67, 84, 67, 76, 69, 86, 69, 49,  0, 67, 65, 76, 76, 84, 82, 48,
+/* 0x36f0 */  49,  0, 67, 84, 66, 83, 72, 82, 48, 49,  0, 67, 84, 66, 82, 79,
+/* 0x3700 */  82, 48, 49,  0, 67, 84, 66, 83, 87, 65, 48, 49,  0, 67, 65, 76,
+/* 0x3710 */  76, 84, 82, 48, 50,  0, 67, 65, 76, 76, 84, 82, 49, 48,  0, 67,
+/* 0x3720 */  65, 76, 76, 84, 82, 69, 56,  0, 67, 65, 76, 76, 84, 82, 69, 57,
+/* 0x3730 */   0, 67, 65, 76, 76, 84, 82, 49, 49,  0, 67, 84, 67, 76, 69, 86,
+/* 0x3740 */  69, 50,  0, 67, 65, 76, 76, 84, 82, 49, 50,  0, 67, 84, 66, 83,
+/* 0x3750 */  72, 82, 49, 49,  0, 67, 84, 66, 82, 79, 82, 49, 49,  0, 67, 84,
+/* 0x3760 */  66, 83, 87, 65, 49, 49,  0, 67, 65, 76, 76, 84, 82, 49, 51,  0,
+/* 0x3770 */  99,116,111,107, 51, 50, 46, 48, 48,  0, 99,116,111,107, 51, 50,
+/* 0x3780 */  46, 49, 48,  0, 99,116,111,107, 51, 50, 46, 50, 48,  0, 99,116,
+/* 0x3790 */ 111,107, 51, 50, 46, 51, 48,  0, 99,116,111,107, 51, 50, 46, 52,
+/* 0x37a0 */  48,  0, 80, 69, 73, 77, 80, 79, 82, 84,  0, 80, 69, 73, 66, 89,
+/* 0x37b0 */  79, 82, 68,  0, 80, 69, 75, 51, 50, 79, 82, 68,  0, 80, 69, 73,
+/* 0x37c0 */  77, 79, 82, 68, 49,  0, 80, 69, 73, 77, 80, 79, 82, 50,  0, 80,
+/* 0x37d0 */  69, 73, 69, 82, 68, 76, 76,  0, 80, 69, 73, 69, 82, 69, 88, 69,
+/* 0x37e0 */   0, 80, 69, 73, 77, 68, 79, 78, 69,  0, 80, 69, 82, 69, 76, 79,
+/* 0x37f0 */  67, 49,  0, 80, 69, 82, 69, 76, 79, 67, 50,  0, 80, 69, 82, 69,
+/* 0x3800 */  76, 79, 67, 51,  0, 82, 69, 76, 79, 67, 51, 50, 48,  0, 82, 69,
+/* 0x3810 */  76, 51, 50, 66, 73, 71,  0, 82, 69, 76, 79, 67, 51, 50, 74,  0,
+/* 0x3820 */  82, 69, 76, 51, 50, 69, 78, 68,  0, 80, 69, 82, 76, 79, 72, 73,
+/* 0x3830 */  48,  0, 80, 69, 82, 69, 76, 76, 79, 48,  0, 80, 69, 82, 69, 76,
+/* 0x3840 */  72, 73, 48,  0, 80, 69, 68, 69, 80, 72, 65, 75,  0, 80, 69, 84,
+/* 0x3850 */  76, 83, 67,  0, 80, 69, 77, 65, 73, 78, 50, 48,  0, 67, 76, 69,
+/* 0x3860 */  65, 82, 83, 84, 65, 67, 75,  0, 80, 69, 77, 65, 73, 78, 50, 49,
+/* 0x3870 */   0, 80, 69, 82, 69, 84, 85, 82, 78,  0, 80, 69, 68, 79, 74, 85,
+/* 0x3880 */  77, 80,  0, 80, 69, 84, 76, 83, 67, 50,  0, 85, 80, 88, 49, 72,
+/* 0x3890 */  69, 65, 68,  0,115,116, 97,114,116, 95,111,102, 95, 99,111,109,
+/* 0x38a0 */ 112,114,101,115,115,101,100,  0,115,116, 97,114,116, 95,111,102,
+/* 0x38b0 */  95,117,110, 99,111,109,112,114,101,115,115,101,100,  0,105, 99,
+/* 0x38c0 */ 111,110, 95,111,102,102,115,101,116,  0,105, 99,111,110, 95,100,
+/* 0x38d0 */ 101,108,116, 97,  0,116,108,115, 95, 97,100,100,114,101,115,115,
+/* 0x38e0 */   0,116,108,115, 95,118, 97,108,117,101,  0,108,122,109, 97, 95,
+/* 0x38f0 */ 115,116, 97, 99,107, 95, 97,100,106,117,115,116,  0,108,122,109,
+/* 0x3900 */  97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,
+/* 0x3910 */ 101,110,  0,108,122,109, 97, 95,112,114,111,112,101,114,116,105,
+/* 0x3920 */ 101,115,  0,102,105,108,116,101,114, 95, 98,117,102,102,101,114,
+/* 0x3930 */  95,115,116, 97,114,116,  0,102,105,108,116,101,114, 95,108,101,
+/* 0x3940 */ 110,103,116,104,  0,102,105,108,116,101,114, 95, 99,116,111,  0,
+/* 0x3950 */  99,111,109,112,114,101,115,115,101,100, 95,105,109,112,111,114,
+/* 0x3960 */ 116,115,  0,115,116, 97,114,116, 95,111,102, 95,105,109,112,111,
+/* 0x3970 */ 114,116,115,  0, 76,111, 97,100, 76,105, 98,114, 97,114,121, 65,
+/* 0x3980 */   0,107,101,114,110,101,108, 51, 50, 95,111,114,100,105,110, 97,
+/* 0x3990 */ 108,115,  0, 71,101,116, 80,114,111, 99, 65,100,100,114,101,115,
+/* 0x39a0 */ 115,  0, 69,120,105,116, 80,114,111, 99,101,115,115,  0,115,116,
+/* 0x39b0 */  97,114,116, 95,111,102, 95,114,101,108,111, 99,115,  0,114,101,
+/* 0x39c0 */ 108,111, 99, 95,100,101,108,116,  0, 86,105,114,116,117, 97,108,
+/* 0x39d0 */  80,114,111,116,101, 99,116,  0,118,112, 95, 98, 97,115,101,  0,
+/* 0x39e0 */ 118,112, 95,115,105,122,101,  0,115,119,114,105,  0,116,108,115,
+/* 0x39f0 */  95,109,111,100,117,108,101, 95, 98, 97,115,101,  0,111,114,105,
+/* 0x3a00 */ 103,105,110, 97,108, 95,101,110,116,114,121,  0,116,108,115, 95,
+/* 0x3a10 */  99, 97,108,108, 98, 97, 99,107,115, 95,112,116,114,  0, 82, 95,
+/* 0x3a20 */  51, 56, 54, 95, 80, 67, 51, 50,  0, 82, 95, 51, 56, 54, 95, 51,
+/* 0x3a30 */  50,  0, 82, 95, 51, 56, 54, 95, 49, 54,  0, 82, 95, 51, 56, 54,
+/* 0x3a40 */  95, 80, 67, 56,  0, 82, 95, 51, 56, 54, 95, 56,  0, 36, 27,  0,
+/* 0x3a50 */   0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* m68k-atari.tos.h
-   created from m68k-atari.tos.bin, 16638 (0x40fe) bytes
+   created from m68k-atari.tos.bin, 10378 (0x288a) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_M68K_ATARI_TOS_SIZE    16638
-#define STUB_M68K_ATARI_TOS_ADLER32 0x36537f3a
-#define STUB_M68K_ATARI_TOS_CRC32   0x331cf3d7
+#define STUB_M68K_ATARI_TOS_SIZE    10378
+#define STUB_M68K_ATARI_TOS_ADLER32 0x0bd86729
+#define STUB_M68K_ATARI_TOS_CRC32   0xccd9498d
 
-unsigned char stub_m68k_atari_tos[16638] = {
+unsigned char stub_m68k_atari_tos[10378] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0,  4,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 26,152,  1,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -407,673 +407,282 @@ unsigned char stub_m68k_atari_tos[16638] = {
 /* 0x1700 */  67,233,  0,254, 96,242,124,  0, 60, 60,  0,  0, 44, 60,  0,  0,
 /* 0x1710 */   0,  0, 78,215, 65,239,  0,  4, 50, 24, 48, 24,192,216,194,208,
 /* 0x1720 */ 208, 65, 72, 64, 66, 64, 50, 47,  0,  6,194,208,208,129, 78,117,
-/* 0x1730 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51,
-/* 0x1740 */  50, 45,109, 54, 56,107, 10, 10, 83,101, 99,116,105,111,110,115,
-/* 0x1750 */  58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32,
-/* 0x1760 */  32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77,
-/* 0x1770 */  65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32,
-/* 0x1780 */  32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110,
-/* 0x1790 */  32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32,101,110,116,114,
-/* 0x17a0 */ 121, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 51, 54, 32, 32, 48,
-/* 0x17b0 */  32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x17c0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32,115,101,116,
-/* 0x17d0 */  95,117,112, 50, 49, 95, 97, 54, 46,119, 32, 48, 52, 32, 32, 48,
-/* 0x17e0 */  32, 32, 48, 32, 32, 48, 54, 97, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x17f0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32,115,101,116,
-/* 0x1800 */  95,117,112, 50, 49, 95,100, 52, 46,119, 32, 48, 54, 32, 32, 48,
-/* 0x1810 */  32, 32, 48, 32, 32, 48, 54,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1820 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32,115,101,116,
-/* 0x1830 */  95,117,112, 50, 49, 95,100, 52, 46,108, 32, 48, 56, 32, 32, 48,
-/* 0x1840 */  32, 32, 48, 32, 32, 48, 55, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1850 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32,108,111,111,
-/* 0x1860 */ 112, 49, 95,115,101,116, 95, 99,111,117,110,116, 46, 98, 32, 48,
-/* 0x1870 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 55, 99, 32, 32, 50, 42,
-/* 0x1880 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53,
-/* 0x1890 */  32,108,111,111,112, 49, 95,115,101,116, 95, 99,111,117,110,116,
-/* 0x18a0 */  46,119, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 55,101,
-/* 0x18b0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x18c0 */  10, 32, 32, 54, 32,108,111,111,112, 49, 95,115,101,116, 95, 99,
-/* 0x18d0 */ 111,117,110,116, 46,108, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32,
-/* 0x18e0 */  32, 48, 56, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x18f0 */  69, 78, 84, 83, 10, 32, 32, 55, 32,108,111,111,112, 49, 95,108,
-/* 0x1900 */  97, 98,101,108, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1910 */  48, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1920 */  78, 84, 83, 10, 32, 32, 56, 32,108,111,111,112, 49, 46,102, 97,
-/* 0x1930 */ 115,116, 32, 32, 32, 32, 48, 50, 97, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1940 */  32, 48, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1950 */  69, 78, 84, 83, 10, 32, 32, 57, 32,108,111,111,112, 49, 46,115,
-/* 0x1960 */ 109, 97,108,108, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1970 */  32, 48, 98, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1980 */  69, 78, 84, 83, 10, 32, 49, 48, 32,108,111,111,112, 49, 95,115,
-/* 0x1990 */ 117, 98,113,108, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x19a0 */  32, 48, 98, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x19b0 */  69, 78, 84, 83, 10, 32, 49, 49, 32,108,111,111,112, 49, 95,115,
-/* 0x19c0 */ 117, 98,113,119, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x19d0 */  32, 48, 98, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x19e0 */  69, 78, 84, 83, 10, 32, 49, 50, 32,108,111,111,112, 49, 95,100,
-/* 0x19f0 */  98,114, 97, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1a00 */  32, 48, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1a10 */  69, 78, 84, 83, 10, 32, 49, 51, 32,108,111,111,112, 50, 46,102,
-/* 0x1a20 */  97,115,116, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1a30 */  32, 48, 99, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1a40 */  69, 78, 84, 83, 10, 32, 49, 52, 32,108,111,111,112, 50, 46,115,
-/* 0x1a50 */ 109, 97,108,108, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1a60 */  48, 99, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1a70 */  78, 84, 83, 10, 32, 49, 53, 32, 99,111,112,121, 95,116,111, 95,
-/* 0x1a80 */ 115,116, 97, 99,107, 32, 48, 49, 54, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1a90 */  32, 48, 99, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1aa0 */  69, 78, 84, 83, 10, 32, 49, 54, 32,110,114,118, 50, 98, 46,105,
-/* 0x1ab0 */ 110,105,116, 32, 32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1ac0 */  32, 48,100,101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1ad0 */  69, 78, 84, 83, 10, 32, 49, 55, 32,110,114,118, 50,100, 46,105,
-/* 0x1ae0 */ 110,105,116, 32, 32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1af0 */  32, 48,101, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1b00 */  69, 78, 84, 83, 10, 32, 49, 56, 32,110,114,118, 50,101, 46,105,
-/* 0x1b10 */ 110,105,116, 32, 32, 32, 32, 48, 97, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1b20 */  32, 48,102, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1b30 */  69, 78, 84, 83, 10, 32, 49, 57, 32,106,109,112, 95,100,101, 99,
-/* 0x1b40 */ 111,109,112,114,101,115,115,111,114, 95, 97, 54, 46,119, 32, 48,
-/* 0x1b50 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48,102, 99, 32, 32, 50, 42,
-/* 0x1b60 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 48,
-/* 0x1b70 */  32,106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,111,
-/* 0x1b80 */ 114, 95,100, 52, 46,119, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1b90 */  32, 48, 49, 48, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1ba0 */  84, 69, 78, 84, 83, 10, 32, 50, 49, 32,106,109,112, 95,100,101,
-/* 0x1bb0 */  99,111,109,112,114,101,115,115,111,114, 95, 97, 54, 46,119, 50,
-/* 0x1bc0 */  32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 48, 54, 32,
-/* 0x1bd0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1be0 */  32, 50, 50, 32,106,109,112, 95,100,101, 99,111,109,112,114,101,
-/* 0x1bf0 */ 115,115,111,114, 95,100, 52, 46,108, 32, 48, 97, 32, 32, 48, 32,
-/* 0x1c00 */  32, 48, 32, 32, 48, 49, 48,101, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1c10 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 51, 32, 99,111,100,
-/* 0x1c20 */ 101, 95,111,110, 95,115,116, 97, 99,107, 32, 48, 32, 32, 48, 32,
-/* 0x1c30 */  32, 48, 32, 32, 48, 49, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1c40 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 52, 32, 99,108,101,
-/* 0x1c50 */  97,114, 95,100,105,114,116,121, 95, 98,115,115, 32, 48, 32, 32,
-/* 0x1c60 */  48, 32, 32, 48, 32, 32, 48, 49, 49, 56, 32, 32, 50, 42, 42, 48,
-/* 0x1c70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 53, 32,108,
-/* 0x1c80 */ 111,111,112, 51, 95,108, 97, 98,101,108, 32, 32, 32, 48, 32, 32,
-/* 0x1c90 */  48, 32, 32, 48, 32, 32, 48, 49, 49, 56, 32, 32, 50, 42, 42, 48,
-/* 0x1ca0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 54, 32,108,
-/* 0x1cb0 */ 111,111,112, 51, 46,115,109, 97,108,108, 32, 32, 32, 48, 50, 32,
-/* 0x1cc0 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 49, 56, 32, 32, 50, 42, 42,
-/* 0x1cd0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 55, 32,
-/* 0x1ce0 */ 108,111,111,112, 51, 46,102, 97,115,116, 32, 32, 32, 32, 48, 56,
-/* 0x1cf0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 49, 97, 32, 32, 50, 42,
-/* 0x1d00 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 56,
-/* 0x1d10 */  32,108,111,111,112, 51, 95,115,117, 98,113,108, 32, 32, 32, 48,
-/* 0x1d20 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 50, 32, 32, 50,
-/* 0x1d30 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50,
-/* 0x1d40 */  57, 32,108,111,111,112, 51, 95,115,117, 98,113,119, 32, 32, 32,
-/* 0x1d50 */  48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 54, 32, 32,
-/* 0x1d60 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1d70 */  51, 48, 32,108,111,111,112, 51, 95,100, 98,114, 97, 32, 32, 32,
-/* 0x1d80 */  32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 97, 32,
-/* 0x1d90 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1da0 */  32, 51, 49, 32,102,108,117,115,104, 95, 99, 97, 99,104,101, 32,
-/* 0x1db0 */  32, 32, 48, 55, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50,
-/* 0x1dc0 */ 101, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1dd0 */  83, 10, 32, 51, 50, 32,114,101,115,116,111,114,101, 95,115,116,
-/* 0x1de0 */  97, 99,107, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x1df0 */  97, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1e00 */  84, 83, 10, 32, 51, 51, 32, 99,108,101, 97,114, 95,100,105,114,
-/* 0x1e10 */ 116,121, 95,115,116, 97, 99,107, 32, 48, 99, 32, 32, 48, 32, 32,
-/* 0x1e20 */  48, 32, 32, 48, 49, 97, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1e30 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 52, 32,115,116, 97,114,
-/* 0x1e40 */ 116, 95,112,114,111,103,114, 97,109, 32, 48, 99, 32, 32, 48, 32,
-/* 0x1e50 */  32, 48, 32, 32, 48, 49, 98, 54, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e60 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 53, 32, 85, 80, 88,
-/* 0x1e70 */  49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 50, 48, 32, 32,
-/* 0x1e80 */  48, 32, 32, 48, 32, 32, 48, 49, 99, 50, 32, 32, 50, 42, 42, 48,
-/* 0x1e90 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 54, 32, 67,
-/* 0x1ea0 */  85, 84, 80, 79, 73, 78, 84, 32, 32, 32, 32, 32, 32, 48, 32, 32,
-/* 0x1eb0 */  48, 32, 32, 48, 32, 32, 48, 49,101, 50, 32, 32, 50, 42, 42, 48,
-/* 0x1ec0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 55, 32,110,
-/* 0x1ed0 */ 114,118, 50, 98, 95, 56, 46,102, 97,115,116, 32, 32, 48, 55, 99,
-/* 0x1ee0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49,101, 50, 32, 32, 50, 42,
-/* 0x1ef0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 56,
-/* 0x1f00 */  32,110,114,118, 50,100, 95, 56, 46,102, 97,115,116, 32, 32, 48,
-/* 0x1f10 */  57, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 53,101, 32, 32,
-/* 0x1f20 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1f30 */  51, 57, 32,110,114,118, 50,101, 95, 56, 46,102, 97,115,116, 32,
-/* 0x1f40 */  32, 48, 57, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,101,101,
-/* 0x1f50 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1f60 */  10, 32, 52, 48, 32,110,114,118, 50, 98, 95, 56, 46,115,109, 97,
-/* 0x1f70 */ 108,108, 32, 48, 55, 54, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x1f80 */  56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1f90 */  84, 83, 10, 32, 52, 49, 32,110,114,118, 50,100, 95, 56, 46,115,
-/* 0x1fa0 */ 109, 97,108,108, 32, 48, 56, 97, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1fb0 */  48, 51,102, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1fc0 */  69, 78, 84, 83, 10, 32, 52, 50, 32,110,114,118, 50,101, 95, 56,
-/* 0x1fd0 */  46,115,109, 97,108,108, 32, 48, 57, 50, 32, 32, 48, 32, 32, 48,
-/* 0x1fe0 */  32, 32, 48, 52, 56, 54, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1ff0 */  78, 84, 69, 78, 84, 83, 10, 32, 52, 51, 32,108,122,109, 97, 46,
-/* 0x2000 */ 105,110,105,116, 32, 32, 32, 32, 32, 48, 50,101, 32, 32, 48, 32,
-/* 0x2010 */  32, 48, 32, 32, 48, 53, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2020 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 52, 32,108,122,109,
-/* 0x2030 */  97, 46,102, 97,115,116, 32, 32, 32, 32, 32, 48, 56, 99, 97, 32,
-/* 0x2040 */  32, 48, 32, 32, 48, 32, 32, 48, 53, 52, 54, 32, 32, 50, 42, 42,
-/* 0x2050 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 53, 32,
-/* 0x2060 */ 108,122,109, 97, 46,115,109, 97,108,108, 32, 32, 32, 32, 48, 56,
-/* 0x2070 */  99, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 49, 48, 32, 32,
-/* 0x2080 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2090 */  52, 54, 32,108,122,109, 97, 46,102,105,110,105,115,104, 32, 32,
-/* 0x20a0 */  32, 48, 49, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 54,100,
-/* 0x20b0 */  97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x20c0 */  83, 10, 32, 52, 55, 32,114,101,108,111, 99, 32, 32, 32, 32, 32,
-/* 0x20d0 */  32, 32, 32, 32, 48, 49, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x20e0 */  49, 54,101, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x20f0 */  69, 78, 84, 83, 10, 32, 52, 56, 32,108,111,111,112, 51, 95,115,
-/* 0x2100 */ 101,116, 95, 99,111,117,110,116, 46, 98, 32, 48, 50, 32, 32, 48,
-/* 0x2110 */  32, 32, 48, 32, 32, 48, 49, 55, 48, 54, 32, 32, 50, 42, 42, 48,
-/* 0x2120 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 52, 57, 32,108,
-/* 0x2130 */ 111,111,112, 51, 95,115,101,116, 95, 99,111,117,110,116, 46,119,
-/* 0x2140 */  32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 48, 56,
-/* 0x2150 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2160 */  10, 32, 53, 48, 32,108,111,111,112, 51, 95,115,101,116, 95, 99,
-/* 0x2170 */ 111,117,110,116, 46,108, 32, 48, 54, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2180 */  32, 48, 49, 55, 48, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2190 */  78, 84, 69, 78, 84, 83, 10, 32, 53, 49, 32,106,109,112, 95,115,
-/* 0x21a0 */ 116, 97, 99,107, 32, 32, 32, 32, 32, 48, 50, 32, 32, 48, 32, 32,
-/* 0x21b0 */  48, 32, 32, 48, 49, 55, 49, 50, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x21c0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 53, 50, 32, 95, 95,109,
-/* 0x21d0 */ 117,108,115,105, 51, 32, 32, 32, 32, 32, 32, 48, 49, 99, 32, 32,
-/* 0x21e0 */  48, 32, 32, 48, 32, 32, 48, 49, 55, 49, 52, 32, 32, 50, 42, 42,
-/* 0x21f0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66,
-/* 0x2200 */  79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2210 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112, 49,
-/* 0x2220 */  95,108, 97, 98,101,108, 32, 48, 32,108,111,111,112, 49, 95,108,
-/* 0x2230 */  97, 98,101,108, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2240 */  32, 32, 32,100, 32, 32,102,108,117,115,104, 95, 99, 97, 99,104,
-/* 0x2250 */ 101, 32, 48, 32,102,108,117,115,104, 95, 99, 97, 99,104,101, 10,
-/* 0x2260 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2270 */  32,108,111,111,112, 51, 95,108, 97, 98,101,108, 32, 48, 32,108,
-/* 0x2280 */ 111,111,112, 51, 95,108, 97, 98,101,108, 10, 48, 48, 48, 48, 48,
-/* 0x2290 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 95, 95,109,117,
-/* 0x22a0 */ 108,115,105, 51, 32, 48, 32, 95, 95,109,117,108,115,105, 51, 10,
-/* 0x22b0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x22c0 */  32,101,110,116,114,121, 32, 48, 32,101,110,116,114,121, 10, 48,
-/* 0x22d0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x22e0 */ 115,101,116, 95,117,112, 50, 49, 95, 97, 54, 46,119, 32, 48, 32,
-/* 0x22f0 */ 115,101,116, 95,117,112, 50, 49, 95, 97, 54, 46,119, 10, 48, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,115,
-/* 0x2310 */ 101,116, 95,117,112, 50, 49, 95,100, 52, 46,119, 32, 48, 32,115,
-/* 0x2320 */ 101,116, 95,117,112, 50, 49, 95,100, 52, 46,119, 10, 48, 48, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,115,101,
-/* 0x2340 */ 116, 95,117,112, 50, 49, 95,100, 52, 46,108, 32, 48, 32,115,101,
-/* 0x2350 */ 116, 95,117,112, 50, 49, 95,100, 52, 46,108, 10, 48, 48, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,
-/* 0x2370 */ 112, 49, 95,115,101,116, 95, 99,111,117,110,116, 46, 98, 32, 48,
-/* 0x2380 */  32,108,111,111,112, 49, 95,115,101,116, 95, 99,111,117,110,116,
-/* 0x2390 */  46, 98, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x23a0 */  32,100, 32, 32,108,111,111,112, 49, 95,115,101,116, 95, 99,111,
-/* 0x23b0 */ 117,110,116, 46,119, 32, 48, 32,108,111,111,112, 49, 95,115,101,
-/* 0x23c0 */ 116, 95, 99,111,117,110,116, 46,119, 10, 48, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112, 49,
-/* 0x23e0 */  95,115,101,116, 95, 99,111,117,110,116, 46,108, 32, 48, 32,108,
-/* 0x23f0 */ 111,111,112, 49, 95,115,101,116, 95, 99,111,117,110,116, 46,108,
-/* 0x2400 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2410 */  32, 32,108,111,111,112, 49, 46,102, 97,115,116, 32, 48, 32,108,
-/* 0x2420 */ 111,111,112, 49, 46,102, 97,115,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2430 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112, 49,
-/* 0x2440 */  46,115,109, 97,108,108, 32, 48, 32,108,111,111,112, 49, 46,115,
-/* 0x2450 */ 109, 97,108,108, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2460 */  32, 32, 32,100, 32, 32,108,111,111,112, 49, 95,115,117, 98,113,
-/* 0x2470 */ 108, 32, 48, 32,108,111,111,112, 49, 95,115,117, 98,113,108, 10,
-/* 0x2480 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2490 */  32,108,111,111,112, 49, 95,115,117, 98,113,119, 32, 48, 32,108,
-/* 0x24a0 */ 111,111,112, 49, 95,115,117, 98,113,119, 10, 48, 48, 48, 48, 48,
-/* 0x24b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112,
-/* 0x24c0 */  49, 95,100, 98,114, 97, 32, 48, 32,108,111,111,112, 49, 95,100,
-/* 0x24d0 */  98,114, 97, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x24e0 */  32, 32,100, 32, 32,108,111,111,112, 50, 46,102, 97,115,116, 32,
-/* 0x24f0 */  48, 32,108,111,111,112, 50, 46,102, 97,115,116, 10, 48, 48, 48,
-/* 0x2500 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,
-/* 0x2510 */ 111,112, 50, 46,115,109, 97,108,108, 32, 48, 32,108,111,111,112,
-/* 0x2520 */  50, 46,115,109, 97,108,108, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2530 */  32,108, 32, 32, 32, 32,100, 32, 32, 99,111,112,121, 95,116,111,
-/* 0x2540 */  95,115,116, 97, 99,107, 32, 48, 32, 99,111,112,121, 95,116,111,
-/* 0x2550 */  95,115,116, 97, 99,107, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2560 */ 108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50, 98, 46,105,110,
-/* 0x2570 */ 105,116, 32, 48, 32,110,114,118, 50, 98, 46,105,110,105,116, 10,
-/* 0x2580 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2590 */  32,110,114,118, 50,100, 46,105,110,105,116, 32, 48, 32,110,114,
-/* 0x25a0 */ 118, 50,100, 46,105,110,105,116, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,101, 46,
-/* 0x25c0 */ 105,110,105,116, 32, 48, 32,110,114,118, 50,101, 46,105,110,105,
-/* 0x25d0 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x25e0 */ 100, 32, 32,106,109,112, 95,100,101, 99,111,109,112,114,101,115,
-/* 0x25f0 */ 115,111,114, 95, 97, 54, 46,119, 32, 48, 32,106,109,112, 95,100,
-/* 0x2600 */ 101, 99,111,109,112,114,101,115,115,111,114, 95, 97, 54, 46,119,
-/* 0x2610 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2620 */  32, 32,106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x2630 */ 111,114, 95,100, 52, 46,119, 32, 48, 32,106,109,112, 95,100,101,
-/* 0x2640 */  99,111,109,112,114,101,115,115,111,114, 95,100, 52, 46,119, 10,
-/* 0x2650 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2660 */  32,106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,111,
-/* 0x2670 */ 114, 95, 97, 54, 46,119, 50, 32, 48, 32,106,109,112, 95,100,101,
-/* 0x2680 */  99,111,109,112,114,101,115,115,111,114, 95, 97, 54, 46,119, 50,
-/* 0x2690 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x26a0 */  32, 32,106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,
-/* 0x26b0 */ 111,114, 95,100, 52, 46,108, 32, 48, 32,106,109,112, 95,100,101,
-/* 0x26c0 */  99,111,109,112,114,101,115,115,111,114, 95,100, 52, 46,108, 10,
-/* 0x26d0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x26e0 */  32, 99,111,100,101, 95,111,110, 95,115,116, 97, 99,107, 32, 48,
-/* 0x26f0 */  32, 99,111,100,101, 95,111,110, 95,115,116, 97, 99,107, 10, 48,
-/* 0x2700 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2710 */  99,108,101, 97,114, 95,100,105,114,116,121, 95, 98,115,115, 32,
-/* 0x2720 */  48, 32, 99,108,101, 97,114, 95,100,105,114,116,121, 95, 98,115,
-/* 0x2730 */ 115, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2740 */ 100, 32, 32,108,111,111,112, 51, 46,115,109, 97,108,108, 32, 48,
-/* 0x2750 */  32,108,111,111,112, 51, 46,115,109, 97,108,108, 10, 48, 48, 48,
-/* 0x2760 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,
-/* 0x2770 */ 111,112, 51, 46,102, 97,115,116, 32, 48, 32,108,111,111,112, 51,
-/* 0x2780 */  46,102, 97,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2790 */  32, 32, 32, 32,100, 32, 32,108,111,111,112, 51, 95,115,117, 98,
-/* 0x27a0 */ 113,108, 32, 48, 32,108,111,111,112, 51, 95,115,117, 98,113,108,
-/* 0x27b0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x27c0 */  32, 32,108,111,111,112, 51, 95,115,117, 98,113,119, 32, 48, 32,
-/* 0x27d0 */ 108,111,111,112, 51, 95,115,117, 98,113,119, 10, 48, 48, 48, 48,
-/* 0x27e0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,
-/* 0x27f0 */ 112, 51, 95,100, 98,114, 97, 32, 48, 32,108,111,111,112, 51, 95,
-/* 0x2800 */ 100, 98,114, 97, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2810 */  32, 32, 32,100, 32, 32,114,101,115,116,111,114,101, 95,115,116,
-/* 0x2820 */  97, 99,107, 32, 48, 32,114,101,115,116,111,114,101, 95,115,116,
-/* 0x2830 */  97, 99,107, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2840 */  32, 32,100, 32, 32, 99,108,101, 97,114, 95,100,105,114,116,121,
-/* 0x2850 */  95,115,116, 97, 99,107, 32, 48, 32, 99,108,101, 97,114, 95,100,
-/* 0x2860 */ 105,114,116,121, 95,115,116, 97, 99,107, 10, 48, 48, 48, 48, 48,
-/* 0x2870 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,115,116, 97,114,
-/* 0x2880 */ 116, 95,112,114,111,103,114, 97,109, 32, 48, 32,115,116, 97,114,
-/* 0x2890 */ 116, 95,112,114,111,103,114, 97,109, 10, 48, 48, 48, 48, 48, 48,
-/* 0x28a0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85, 80, 88, 49, 72,
-/* 0x28b0 */  69, 65, 68, 32, 48, 32, 85, 80, 88, 49, 72, 69, 65, 68, 10, 48,
-/* 0x28c0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x28d0 */  67, 85, 84, 80, 79, 73, 78, 84, 32, 48, 32, 67, 85, 84, 80, 79,
-/* 0x28e0 */  73, 78, 84, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x28f0 */  32, 32,100, 32, 32,110,114,118, 50, 98, 95, 56, 46,102, 97,115,
-/* 0x2900 */ 116, 32, 48, 32,110,114,118, 50, 98, 95, 56, 46,102, 97,115,116,
-/* 0x2910 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2920 */  32, 32,110,114,118, 50,100, 95, 56, 46,102, 97,115,116, 32, 48,
-/* 0x2930 */  32,110,114,118, 50,100, 95, 56, 46,102, 97,115,116, 10, 48, 48,
-/* 0x2940 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,
-/* 0x2950 */ 114,118, 50,101, 95, 56, 46,102, 97,115,116, 32, 48, 32,110,114,
-/* 0x2960 */ 118, 50,101, 95, 56, 46,102, 97,115,116, 10, 48, 48, 48, 48, 48,
-/* 0x2970 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,
-/* 0x2980 */  98, 95, 56, 46,115,109, 97,108,108, 32, 48, 32,110,114,118, 50,
-/* 0x2990 */  98, 95, 56, 46,115,109, 97,108,108, 10, 48, 48, 48, 48, 48, 48,
-/* 0x29a0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,100,
-/* 0x29b0 */  95, 56, 46,115,109, 97,108,108, 32, 48, 32,110,114,118, 50,100,
-/* 0x29c0 */  95, 56, 46,115,109, 97,108,108, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x29d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,101, 95,
-/* 0x29e0 */  56, 46,115,109, 97,108,108, 32, 48, 32,110,114,118, 50,101, 95,
-/* 0x29f0 */  56, 46,115,109, 97,108,108, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2a00 */  32,108, 32, 32, 32, 32,100, 32, 32,108,122,109, 97, 46,105,110,
-/* 0x2a10 */ 105,116, 32, 48, 32,108,122,109, 97, 46,105,110,105,116, 10, 48,
-/* 0x2a20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2a30 */ 108,122,109, 97, 46,102, 97,115,116, 32, 48, 32,108,122,109, 97,
-/* 0x2a40 */  46,102, 97,115,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2a50 */  32, 32, 32, 32,100, 32, 32,108,122,109, 97, 46,115,109, 97,108,
-/* 0x2a60 */ 108, 32, 48, 32,108,122,109, 97, 46,115,109, 97,108,108, 10, 48,
-/* 0x2a70 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2a80 */ 108,122,109, 97, 46,102,105,110,105,115,104, 32, 48, 32,108,122,
-/* 0x2a90 */ 109, 97, 46,102,105,110,105,115,104, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2aa0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,114,101,108,111, 99,
-/* 0x2ab0 */  32, 48, 32,114,101,108,111, 99, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2ac0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32,108,111,111,112, 51, 95,
-/* 0x2ad0 */ 115,101,116, 95, 99,111,117,110,116, 46, 98, 32, 48, 32,108,111,
-/* 0x2ae0 */ 111,112, 51, 95,115,101,116, 95, 99,111,117,110,116, 46, 98, 10,
-/* 0x2af0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2b00 */  32,108,111,111,112, 51, 95,115,101,116, 95, 99,111,117,110,116,
-/* 0x2b10 */  46,119, 32, 48, 32,108,111,111,112, 51, 95,115,101,116, 95, 99,
-/* 0x2b20 */ 111,117,110,116, 46,119, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2b30 */ 108, 32, 32, 32, 32,100, 32, 32,108,111,111,112, 51, 95,115,101,
-/* 0x2b40 */ 116, 95, 99,111,117,110,116, 46,108, 32, 48, 32,108,111,111,112,
-/* 0x2b50 */  51, 95,115,101,116, 95, 99,111,117,110,116, 46,108, 10, 48, 48,
-/* 0x2b60 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,106,
-/* 0x2b70 */ 109,112, 95,115,116, 97, 99,107, 32, 48, 32,106,109,112, 95,115,
-/* 0x2b80 */ 116, 97, 99,107, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x2b90 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,111,114,
-/* 0x2ba0 */ 105,103, 95,112, 95,116,108,101,110, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2bb0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x2bc0 */  32, 48, 32,111,114,105,103, 95,112, 95,100,108,101,110, 10, 48,
-/* 0x2bd0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2be0 */  42, 85, 78, 68, 42, 32, 48, 32,111,114,105,103, 95,112, 95, 98,
-/* 0x2bf0 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32,
-/* 0x2c00 */  32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,117,112, 50,
-/* 0x2c10 */  49, 95, 97, 54, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x2c20 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,117,112,
-/* 0x2c30 */  50, 49, 95,100, 52, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32,
-/* 0x2c40 */  32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,
-/* 0x2c50 */ 111,111,112, 49, 95, 99,111,117,110,116, 10, 48, 48, 48, 48, 48,
-/* 0x2c60 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x2c70 */  42, 32, 48, 32,108,111,111,112, 50, 95, 99,111,117,110,116, 10,
-/* 0x2c80 */  48, 48, 48, 48, 48, 48, 48, 99, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x2c90 */  32,115,116, 97,114,116, 95,112,114,111,103,114, 97,109, 32, 48,
-/* 0x2ca0 */  32, 99,111,100,101, 95,111,110, 95,115,116, 97, 99,107, 95,101,
-/* 0x2cb0 */ 110,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x2cc0 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 99,111,112,121,
-/* 0x2cd0 */  95,116,111, 95,115,116, 97, 99,107, 95,108,101,110, 10, 48, 48,
-/* 0x2ce0 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x2cf0 */  85, 78, 68, 42, 32, 48, 32,102,108,117,115,104, 95, 99, 97, 99,
-/* 0x2d00 */ 104,101, 95,114,116,115, 95,111,102,102,115,101,116, 10, 48, 48,
-/* 0x2d10 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x2d20 */  85, 78, 68, 42, 32, 48, 32,117,112, 51, 49, 95, 97, 54, 10, 48,
-/* 0x2d30 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d40 */  42, 85, 78, 68, 42, 32, 48, 32,117,112, 51, 49, 95,100, 52, 10,
-/* 0x2d50 */  48, 48, 48, 48, 48, 48, 55, 54, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x2d60 */  32,102,108,117,115,104, 95, 99, 97, 99,104,101, 32, 48, 32,102,
-/* 0x2d70 */ 108,117,115,104, 95, 99, 97, 99,104,101, 95,114,116,115, 10, 48,
-/* 0x2d80 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2d90 */  42, 85, 78, 68, 42, 32, 48, 32, 99,108,101, 97,114, 95,100,105,
-/* 0x2da0 */ 114,116,121, 95,115,116, 97, 99,107, 95,108,101,110, 10, 48, 48,
-/* 0x2db0 */  48, 48, 48, 48, 48, 54, 32,103, 32, 32, 32, 32, 32, 32, 32, 99,
-/* 0x2dc0 */ 108,101, 97,114, 95,100,105,114,116,121, 95,115,116, 97, 99,107,
-/* 0x2dd0 */  32, 48, 32, 99,108,101, 97,114, 95,100,105,114,116,121, 95,115,
-/* 0x2de0 */ 116, 97, 99,107, 95,108,111,111,112, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2df0 */  48, 50, 32,103, 32, 32, 32, 32, 32, 32, 32,110,114,118, 50, 98,
-/* 0x2e00 */  95, 56, 46,102, 97,115,116, 32, 48, 32,110,114,118, 50, 98, 95,
-/* 0x2e10 */  56, 95,102, 97,115,116, 95,100,101, 99,111,109,112,114, 95,115,
-/* 0x2e20 */ 116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32,103, 32,
-/* 0x2e30 */  32, 32, 32, 32, 32, 32,110,114,118, 50,100, 95, 56, 46,102, 97,
-/* 0x2e40 */ 115,116, 32, 48, 32,110,114,118, 50,100, 95, 56, 95,102, 97,115,
-/* 0x2e50 */ 116, 95,100,101, 99,111,109,112,114, 95,115,116, 97,114,116, 10,
-/* 0x2e60 */  48, 48, 48, 48, 48, 48, 48, 50, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x2e70 */  32,110,114,118, 50,101, 95, 56, 46,102, 97,115,116, 32, 48, 32,
-/* 0x2e80 */ 110,114,118, 50,101, 95, 56, 95,102, 97,115,116, 95,100,101, 99,
-/* 0x2e90 */ 111,109,112,114, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48,
-/* 0x2ea0 */  48, 48, 50, 32,103, 32, 32, 32, 32, 32, 32, 32,110,114,118, 50,
-/* 0x2eb0 */  98, 95, 56, 46,115,109, 97,108,108, 32, 48, 32,110,114,118, 50,
-/* 0x2ec0 */  98, 95, 56, 95,115,109, 97,108,108, 95,100,101, 99,111,109,112,
-/* 0x2ed0 */ 114, 95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x2ee0 */  32,103, 32, 32, 32, 32, 32, 32, 32,110,114,118, 50,100, 95, 56,
-/* 0x2ef0 */  46,115,109, 97,108,108, 32, 48, 32,110,114,118, 50,100, 95, 56,
-/* 0x2f00 */  95,115,109, 97,108,108, 95,100,101, 99,111,109,112,114, 95,115,
-/* 0x2f10 */ 116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32,103, 32,
-/* 0x2f20 */  32, 32, 32, 32, 32, 32,110,114,118, 50,101, 95, 56, 46,115,109,
-/* 0x2f30 */  97,108,108, 32, 48, 32,110,114,118, 50,101, 95, 56, 95,115,109,
-/* 0x2f40 */  97,108,108, 95,100,101, 99,111,109,112,114, 95,115,116, 97,114,
-/* 0x2f50 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2f60 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,
-/* 0x2f70 */ 115,116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48,
-/* 0x2f80 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x2f90 */  78, 68, 42, 32, 48, 32,108,122,109, 97, 95,117, 95,108,101,110,
-/* 0x2fa0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2fb0 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95, 99,
-/* 0x2fc0 */  95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32,
-/* 0x2fd0 */  32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,
-/* 0x2fe0 */ 109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 48, 48,
-/* 0x2ff0 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x3000 */  85, 78, 68, 42, 32, 48, 32,108,111,111,112, 51, 95, 99,111,117,
-/* 0x3010 */ 110,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x3020 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,101,110,116,114,
-/* 0x3030 */ 121, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x3040 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x3050 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 99, 32, 82, 95,
-/* 0x3060 */  54, 56, 75, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3070 */ 111,114,105,103, 95,112, 95,116,108,101,110, 10, 48, 48, 48, 48,
-/* 0x3080 */  48, 48, 50, 54, 32, 82, 95, 54, 56, 75, 95, 51, 50, 32, 32, 32,
-/* 0x3090 */  32, 32, 32, 32, 32, 32, 32,111,114,105,103, 95,112, 95,100,108,
-/* 0x30a0 */ 101,110, 10, 48, 48, 48, 48, 48, 48, 51, 50, 32, 82, 95, 54, 56,
-/* 0x30b0 */  75, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,111,114,
-/* 0x30c0 */ 105,103, 95,112, 95, 98,108,101,110, 10, 10, 82, 69, 76, 79, 67,
-/* 0x30d0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x30e0 */  82, 32, 91,115,101,116, 95,117,112, 50, 49, 95, 97, 54, 46,119,
-/* 0x30f0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3100 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3110 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 54,
-/* 0x3120 */  56, 75, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,117,
-/* 0x3130 */ 112, 50, 49, 95, 97, 54, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x3140 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x3150 */ 115,101,116, 95,117,112, 50, 49, 95,100, 52, 46,119, 93, 58, 10,
-/* 0x3160 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x3170 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x3180 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 54, 56, 75, 95,
-/* 0x3190 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,117,112, 50, 49,
-/* 0x31a0 */  95,100, 52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x31b0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,115,101,116,
-/* 0x31c0 */  95,117,112, 50, 49, 95,100, 52, 46,108, 93, 58, 10, 79, 70, 70,
-/* 0x31d0 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x31e0 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x31f0 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 54, 56, 75, 95, 51, 50, 32,
-/* 0x3200 */  32, 32, 32, 32, 32, 32, 32, 32, 32,117,112, 50, 49, 95,100, 52,
-/* 0x3210 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3220 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,112, 49, 95,
-/* 0x3230 */ 115,101,116, 95, 99,111,117,110,116, 46, 98, 93, 58, 10, 79, 70,
-/* 0x3240 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x3250 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x3260 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 54, 56, 75, 95, 56, 32,
-/* 0x3270 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,111,111,112, 49, 95,
-/* 0x3280 */  99,111,117,110,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x3290 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,
-/* 0x32a0 */ 111,111,112, 49, 95,115,101,116, 95, 99,111,117,110,116, 46,119,
-/* 0x32b0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x32c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x32d0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 54,
-/* 0x32e0 */  56, 75, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x32f0 */ 111,111,112, 49, 95, 99,111,117,110,116, 10, 10, 82, 69, 76, 79,
-/* 0x3300 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x3310 */  79, 82, 32, 91,108,111,111,112, 49, 95,115,101,116, 95, 99,111,
-/* 0x3320 */ 117,110,116, 46,108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3330 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3340 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3350 */  50, 32, 82, 95, 54, 56, 75, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x3360 */  32, 32, 32, 32,108,111,111,112, 49, 95, 99,111,117,110,116, 10,
-/* 0x3370 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x3380 */  82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,112, 49, 95,115,
-/* 0x3390 */ 117, 98,113,108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x33a0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x33b0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51,
-/* 0x33c0 */  32, 82, 95, 54, 56, 75, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32,
-/* 0x33d0 */  32, 32, 32,108,111,111,112, 49, 95,108, 97, 98,101,108, 43, 48,
-/* 0x33e0 */ 120,102,102,102,102,102,102,102,102, 10, 10, 82, 69, 76, 79, 67,
-/* 0x33f0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x3400 */  82, 32, 91,108,111,111,112, 49, 95,115,117, 98,113,119, 93, 58,
-/* 0x3410 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x3420 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x3430 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 54, 56, 75,
-/* 0x3440 */  95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,111,111,
-/* 0x3450 */ 112, 49, 95,108, 97, 98,101,108, 43, 48,120,102,102,102,102,102,
-/* 0x3460 */ 102,102,102, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x3470 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,
-/* 0x3480 */ 112, 49, 95,100, 98,114, 97, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x3490 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x34a0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x34b0 */  48, 48, 50, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32,
-/* 0x34c0 */  32, 32, 32, 32, 32, 32,108,111,111,112, 49, 95,108, 97, 98,101,
-/* 0x34d0 */ 108, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x34e0 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,112, 50,
-/* 0x34f0 */  46,102, 97,115,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3500 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3510 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3520 */  49, 32, 82, 95, 54, 56, 75, 95, 56, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3530 */  32, 32, 32, 32,108,111,111,112, 50, 95, 99,111,117,110,116, 10,
-/* 0x3540 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x3550 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 99,111,112,121, 95,116,111,
-/* 0x3560 */  95,115,116, 97, 99,107, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x3570 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3580 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3590 */  48, 50, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x35a0 */  32, 32, 32, 32, 32, 99,111,100,101, 95,111,110, 95,115,116, 97,
-/* 0x35b0 */  99,107, 95,101,110,100, 10, 48, 48, 48, 48, 48, 48, 48, 55, 32,
-/* 0x35c0 */  82, 95, 54, 56, 75, 95, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x35d0 */  32, 32, 99,111,112,121, 95,116,111, 95,115,116, 97, 99,107, 95,
-/* 0x35e0 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 49, 50, 32, 82, 95, 54,
-/* 0x35f0 */  56, 75, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,102,
-/* 0x3600 */ 108,117,115,104, 95, 99, 97, 99,104,101, 95,114,116,115, 95,111,
-/* 0x3610 */ 102,102,115,101,116, 10, 48, 48, 48, 48, 48, 48, 49, 53, 32, 82,
-/* 0x3620 */  95, 54, 56, 75, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3630 */  32,102,108,117,115,104, 95, 99, 97, 99,104,101, 43, 48,120,102,
-/* 0x3640 */ 102,102,102,102,102,102,102, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x3650 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x3660 */  91,106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,111,
-/* 0x3670 */ 114, 95, 97, 54, 46,119, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x3680 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3690 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x36a0 */  48, 50, 32, 82, 95, 54, 56, 75, 95, 49, 54, 32, 32, 32, 32, 32,
-/* 0x36b0 */  32, 32, 32, 32, 32,117,112, 51, 49, 95, 97, 54, 10, 10, 82, 69,
-/* 0x36c0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x36d0 */  32, 70, 79, 82, 32, 91,106,109,112, 95,100,101, 99,111,109,112,
-/* 0x36e0 */ 114,101,115,115,111,114, 95,100, 52, 46,119, 93, 58, 10, 79, 70,
-/* 0x36f0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x3700 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x3710 */  48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 54, 56, 75, 95, 49, 54,
-/* 0x3720 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,117,112, 51, 49, 95,100,
-/* 0x3730 */  52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x3740 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,106,109,112, 95,100,
-/* 0x3750 */ 101, 99,111,109,112,114,101,115,115,111,114, 95, 97, 54, 46,119,
-/* 0x3760 */  50, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x3770 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x3780 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 54, 32, 82, 95,
-/* 0x3790 */  54, 56, 75, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x37a0 */ 117,112, 51, 49, 95, 97, 54, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x37b0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x37c0 */  91,106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,111,
-/* 0x37d0 */ 114, 95,100, 52, 46,108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x37e0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x37f0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3800 */  48, 52, 32, 82, 95, 54, 56, 75, 95, 51, 50, 32, 32, 32, 32, 32,
-/* 0x3810 */  32, 32, 32, 32, 32,117,112, 51, 49, 95,100, 52, 10, 10, 82, 69,
-/* 0x3820 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x3830 */  32, 70, 79, 82, 32, 91,108,111,111,112, 51, 95,115,117, 98,113,
-/* 0x3840 */ 108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x3850 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x3860 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 51, 32, 82, 95,
-/* 0x3870 */  54, 56, 75, 95, 80, 67, 56, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3880 */ 108,111,111,112, 51, 95,108, 97, 98,101,108, 43, 48,120,102,102,
-/* 0x3890 */ 102,102,102,102,102,102, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x38a0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x38b0 */ 108,111,111,112, 51, 95,115,117, 98,113,119, 93, 58, 10, 79, 70,
-/* 0x38c0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x38d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x38e0 */  48, 48, 48, 48, 48, 48, 51, 32, 82, 95, 54, 56, 75, 95, 80, 67,
-/* 0x38f0 */  56, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,111,111,112, 51, 95,
-/* 0x3900 */ 108, 97, 98,101,108, 43, 48,120,102,102,102,102,102,102,102,102,
-/* 0x3910 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3920 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,112, 51, 95,
-/* 0x3930 */ 100, 98,114, 97, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x3940 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3950 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50,
-/* 0x3960 */  32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x3970 */  32, 32, 32,108,111,111,112, 51, 95,108, 97, 98,101,108, 10, 10,
-/* 0x3980 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x3990 */  68, 83, 32, 70, 79, 82, 32, 91,114,101,115,116,111,114,101, 95,
-/* 0x39a0 */ 115,116, 97, 99,107, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x39b0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x39c0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x39d0 */  50, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32,
-/* 0x39e0 */  32, 32, 32, 32, 99,111,100,101, 95,111,110, 95,115,116, 97, 99,
-/* 0x39f0 */ 107, 95,101,110,100, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x3a00 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x3a10 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,108,101, 97,114, 95,
-/* 0x3a20 */ 100,105,114,116,121, 95,115,116, 97, 99,107, 93, 58, 10, 79, 70,
-/* 0x3a30 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x3a40 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x3a50 */  48, 48, 48, 48, 48, 48, 49, 32, 82, 95, 54, 56, 75, 95, 56, 32,
-/* 0x3a60 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,108,101, 97,114, 95,
-/* 0x3a70 */ 100,105,114,116,121, 95,115,116, 97, 99,107, 95,108,101,110, 10,
-/* 0x3a80 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x3a90 */  82, 68, 83, 32, 70, 79, 82, 32, 91,108,122,109, 97, 46,105,110,
-/* 0x3aa0 */ 105,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x3ab0 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ac0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82,
-/* 0x3ad0 */  95, 54, 56, 75, 95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ae0 */  32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,106,117,
-/* 0x3af0 */ 115,116, 10, 48, 48, 48, 48, 48, 48, 48,101, 32, 82, 95, 54, 56,
-/* 0x3b00 */  75, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,
-/* 0x3b10 */ 109, 97, 95,117, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49,
-/* 0x3b20 */  97, 32, 82, 95, 54, 56, 75, 95, 51, 50, 32, 32, 32, 32, 32, 32,
-/* 0x3b30 */  32, 32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48,
-/* 0x3b40 */  48, 48, 48, 48, 48, 50, 56, 32, 82, 95, 54, 56, 75, 95, 51, 50,
-/* 0x3b50 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,
-/* 0x3b60 */ 114,111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79, 67,
-/* 0x3b70 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x3b80 */  82, 32, 91,108,122,109, 97, 46,102, 97,115,116, 93, 58, 10, 79,
-/* 0x3b90 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x3ba0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x3bb0 */  48, 48, 48, 48, 48, 49, 48, 56, 32, 82, 95, 54, 56, 75, 95, 80,
-/* 0x3bc0 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,
-/* 0x3bd0 */ 115,105, 51, 10, 48, 48, 48, 48, 48, 49, 99, 97, 32, 82, 95, 54,
-/* 0x3be0 */  56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95,
-/* 0x3bf0 */  95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 50, 52, 50,
-/* 0x3c00 */  32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x3c10 */  32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48,
-/* 0x3c20 */  48, 50,102,101, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32,
-/* 0x3c30 */  32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10,
-/* 0x3c40 */  48, 48, 48, 48, 48, 51, 56, 50, 32, 82, 95, 54, 56, 75, 95, 80,
-/* 0x3c50 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,
-/* 0x3c60 */ 115,105, 51, 10, 48, 48, 48, 48, 48, 51,100,101, 32, 82, 95, 54,
-/* 0x3c70 */  56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95,
-/* 0x3c80 */  95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 52, 56, 50,
-/* 0x3c90 */  32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x3ca0 */  32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48,
-/* 0x3cb0 */  48, 52,100, 97, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32,
-/* 0x3cc0 */  32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10,
-/* 0x3cd0 */  48, 48, 48, 48, 48, 53, 55, 56, 32, 82, 95, 54, 56, 75, 95, 80,
-/* 0x3ce0 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,
-/* 0x3cf0 */ 115,105, 51, 10, 48, 48, 48, 48, 48, 53,101, 48, 32, 82, 95, 54,
-/* 0x3d00 */  56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95,
-/* 0x3d10 */  95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 54, 54, 99,
-/* 0x3d20 */  32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x3d30 */  32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48,
-/* 0x3d40 */  48, 55, 48, 56, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32,
-/* 0x3d50 */  32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10,
-/* 0x3d60 */  48, 48, 48, 48, 48, 55,102, 56, 32, 82, 95, 54, 56, 75, 95, 80,
-/* 0x3d70 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,
-/* 0x3d80 */ 115,105, 51, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x3d90 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,122,109,
-/* 0x3da0 */  97, 46,115,109, 97,108,108, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x3db0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3dc0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x3dd0 */  49, 48, 56, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32,
-/* 0x3de0 */  32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48,
-/* 0x3df0 */  48, 48, 48, 48, 49, 99, 97, 32, 82, 95, 54, 56, 75, 95, 80, 67,
-/* 0x3e00 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,
-/* 0x3e10 */ 105, 51, 10, 48, 48, 48, 48, 48, 50, 52, 50, 32, 82, 95, 54, 56,
-/* 0x3e20 */  75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,
-/* 0x3e30 */ 109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 50,102,101, 32,
-/* 0x3e40 */  82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x3e50 */  32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48,
-/* 0x3e60 */  51, 56, 50, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32,
-/* 0x3e70 */  32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48,
-/* 0x3e80 */  48, 48, 48, 48, 51,100,101, 32, 82, 95, 54, 56, 75, 95, 80, 67,
-/* 0x3e90 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,
-/* 0x3ea0 */ 105, 51, 10, 48, 48, 48, 48, 48, 52, 56, 50, 32, 82, 95, 54, 56,
-/* 0x3eb0 */  75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,
-/* 0x3ec0 */ 109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 52,100, 97, 32,
-/* 0x3ed0 */  82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x3ee0 */  32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48,
-/* 0x3ef0 */  53, 55, 56, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32,
-/* 0x3f00 */  32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 48,
-/* 0x3f10 */  48, 48, 48, 48, 53,101, 48, 32, 82, 95, 54, 56, 75, 95, 80, 67,
-/* 0x3f20 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,
-/* 0x3f30 */ 105, 51, 10, 48, 48, 48, 48, 48, 54, 54, 99, 32, 82, 95, 54, 56,
-/* 0x3f40 */  75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,
-/* 0x3f50 */ 109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48, 55, 48, 56, 32,
-/* 0x3f60 */  82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32,
-/* 0x3f70 */  32, 32, 95, 95,109,117,108,115,105, 51, 10, 48, 48, 48, 48, 48,
-/* 0x3f80 */  55,102, 56, 32, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54, 32, 32,
-/* 0x3f90 */  32, 32, 32, 32, 32, 32, 95, 95,109,117,108,115,105, 51, 10, 10,
-/* 0x3fa0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x3fb0 */  68, 83, 32, 70, 79, 82, 32, 91,108,111,111,112, 51, 95,115,101,
-/* 0x3fc0 */ 116, 95, 99,111,117,110,116, 46, 98, 93, 58, 10, 79, 70, 70, 83,
-/* 0x3fd0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3fe0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x3ff0 */  48, 48, 48, 48, 49, 32, 82, 95, 54, 56, 75, 95, 56, 32, 32, 32,
-/* 0x4000 */  32, 32, 32, 32, 32, 32, 32, 32,108,111,111,112, 51, 95, 99,111,
-/* 0x4010 */ 117,110,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x4020 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,111,111,
-/* 0x4030 */ 112, 51, 95,115,101,116, 95, 99,111,117,110,116, 46,119, 93, 58,
-/* 0x4040 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4050 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4060 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32, 82, 95, 54, 56, 75,
-/* 0x4070 */  95, 49, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,108,111,111,
-/* 0x4080 */ 112, 51, 95, 99,111,117,110,116, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4090 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x40a0 */  32, 91,108,111,111,112, 51, 95,115,101,116, 95, 99,111,117,110,
-/* 0x40b0 */ 116, 46,108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x40c0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x40d0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 50, 32,
-/* 0x40e0 */  82, 95, 54, 56, 75, 95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x40f0 */  32, 32,108,111,111,112, 51, 95, 99,111,117,110,116, 10
+/* 0x1730 */  53,  0,  0,  0, 79,  0,  0,  0, 59,  0,  0,  0,178,  4,  0,  0,
+/* 0x1740 */   0,  0,  0,  0, 52,  0,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1750 */   6,  0,  0,  0,106,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1760 */  20,  0,  0,  0,110,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1770 */  34,  0,  0,  0,116,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1780 */  48,  0,  0,  0,124,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1790 */  66,  0,  0,  0,126,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17a0 */  84,  0,  0,  0,130,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17b0 */ 102,  0,  0,  0,136,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17c0 */ 114,  0,  0,  0,136,  0,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17d0 */ 125,  0,  0,  0,178,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17e0 */ 137,  0,  0,  0,180,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x17f0 */ 149,  0,  0,  0,184,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1800 */ 161,  0,  0,  0,188,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1810 */ 172,  0,  0,  0,192,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1820 */ 183,  0,  0,  0,200,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1830 */ 195,  0,  0,  0,200,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1840 */ 209,  0,  0,  0,222,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1850 */ 220,  0,  0,  0,232,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1860 */ 231,  0,  0,  0,242,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1870 */ 242,  0,  0,  0,252,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1880 */   8,  1,  0,  0,  0,  1,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1890 */  30,  1,  0,  0,  6,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18a0 */  53,  1,  0,  0, 14,  1,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18b0 */  75,  1,  0,  0, 24,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18c0 */  89,  1,  0,  0, 24,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18d0 */ 105,  1,  0,  0, 24,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18e0 */ 117,  1,  0,  0, 24,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x18f0 */ 129,  1,  0,  0, 26,  1,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1900 */ 140,  1,  0,  0, 34,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1910 */ 152,  1,  0,  0, 38,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1920 */ 164,  1,  0,  0, 42,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1930 */ 175,  1,  0,  0, 46,  1,  0,  0,120,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1940 */ 187,  1,  0,  0,166,  1,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1950 */ 201,  1,  0,  0,170,  1,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1960 */ 219,  1,  0,  0,182,  1,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */ 233,  1,  0,  0,194,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1980 */ 242,  1,  0,  0,226,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1990 */ 251,  1,  0,  0,226,  1,  0,  0,124,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */   8,  2,  0,  0, 94,  2,  0,  0,144,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19b0 */  21,  2,  0,  0,238,  2,  0,  0,152,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19c0 */  34,  2,  0,  0,134,  3,  0,  0,118,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */  48,  2,  0,  0,252,  3,  0,  0,138,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19e0 */  62,  2,  0,  0,134,  4,  0,  0,146,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19f0 */  76,  2,  0,  0, 24,  5,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */  86,  2,  0,  0, 70,  5,  0,  0,202,  8,  0,  0,  0,  0,  0,  0,
+/* 0x1a10 */  96,  2,  0,  0, 16, 14,  0,  0,202,  8,  0,  0,  0,  0,  0,  0,
+/* 0x1a20 */ 107,  2,  0,  0,218, 22,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */ 119,  2,  0,  0,236, 22,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a40 */ 125,  2,  0,  0,  6, 23,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */ 143,  2,  0,  0,  8, 23,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */ 161,  2,  0,  0, 12, 23,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a70 */ 179,  2,  0,  0, 18, 23,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */ 189,  2,  0,  0, 20, 23,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */ 102,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,175,  1,  0,  0,
+/* 0x1aa0 */  31,  0,  0,  0,  0,  0,  0,  0,105,  1,  0,  0, 25,  0,  0,  0,
+/* 0x1ab0 */   0,  0,  0,  0,189,  2,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1ad0 */   1,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1ae0 */   0,  0,  0,  0, 34,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */  48,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,
+/* 0x1b00 */   5,  0,  0,  0,  0,  0,  0,  0, 84,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1b10 */   0,  0,  0,  0,114,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */ 125,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,137,  0,  0,  0,
+/* 0x1b30 */  10,  0,  0,  0,  0,  0,  0,  0,149,  0,  0,  0, 11,  0,  0,  0,
+/* 0x1b40 */   0,  0,  0,  0,161,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b50 */ 172,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,183,  0,  0,  0,
+/* 0x1b60 */  14,  0,  0,  0,  0,  0,  0,  0,195,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1b70 */   0,  0,  0,  0,209,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b80 */ 220,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,231,  0,  0,  0,
+/* 0x1b90 */  18,  0,  0,  0,  0,  0,  0,  0,242,  0,  0,  0, 19,  0,  0,  0,
+/* 0x1ba0 */   0,  0,  0,  0,  8,  1,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1bb0 */  30,  1,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0, 53,  1,  0,  0,
+/* 0x1bc0 */  22,  0,  0,  0,  0,  0,  0,  0, 75,  1,  0,  0, 23,  0,  0,  0,
+/* 0x1bd0 */   0,  0,  0,  0, 89,  1,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1be0 */ 117,  1,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,129,  1,  0,  0,
+/* 0x1bf0 */  27,  0,  0,  0,  0,  0,  0,  0,140,  1,  0,  0, 28,  0,  0,  0,
+/* 0x1c00 */   0,  0,  0,  0,152,  1,  0,  0, 29,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c10 */ 164,  1,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,187,  1,  0,  0,
+/* 0x1c20 */  32,  0,  0,  0,  0,  0,  0,  0,201,  1,  0,  0, 33,  0,  0,  0,
+/* 0x1c30 */   0,  0,  0,  0,219,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c40 */ 233,  1,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0,242,  1,  0,  0,
+/* 0x1c50 */  36,  0,  0,  0,  0,  0,  0,  0,251,  1,  0,  0, 37,  0,  0,  0,
+/* 0x1c60 */   0,  0,  0,  0,  8,  2,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c70 */  21,  2,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0, 34,  2,  0,  0,
+/* 0x1c80 */  40,  0,  0,  0,  0,  0,  0,  0, 48,  2,  0,  0, 41,  0,  0,  0,
+/* 0x1c90 */   0,  0,  0,  0, 62,  2,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ca0 */  76,  2,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0, 86,  2,  0,  0,
+/* 0x1cb0 */  44,  0,  0,  0,  0,  0,  0,  0, 96,  2,  0,  0, 45,  0,  0,  0,
+/* 0x1cc0 */   0,  0,  0,  0,107,  2,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1cd0 */ 119,  2,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,125,  2,  0,  0,
+/* 0x1ce0 */  48,  0,  0,  0,  0,  0,  0,  0,143,  2,  0,  0, 49,  0,  0,  0,
+/* 0x1cf0 */   0,  0,  0,  0,161,  2,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */ 179,  2,  0,  0, 51,  0,  0,  0,  0,  0,  0,  0,198,  2,  0,  0,
+/* 0x1d10 */  54,  0,  0,  0,173,222,173,222,210,  2,  0,  0, 54,  0,  0,  0,
+/* 0x1d20 */ 173,222,173,222,222,  2,  0,  0, 54,  0,  0,  0,173,222,173,222,
+/* 0x1d30 */ 234,  2,  0,  0, 54,  0,  0,  0,173,222,173,222,242,  2,  0,  0,
+/* 0x1d40 */  54,  0,  0,  0,173,222,173,222,250,  2,  0,  0, 54,  0,  0,  0,
+/* 0x1d50 */ 173,222,173,222,  6,  3,  0,  0, 54,  0,  0,  0,173,222,173,222,
+/* 0x1d60 */  18,  3,  0,  0, 34,  0,  0,  0, 12,  0,  0,  0, 36,  3,  0,  0,
+/* 0x1d70 */  54,  0,  0,  0,173,222,173,222, 54,  3,  0,  0, 54,  0,  0,  0,
+/* 0x1d80 */ 173,222,173,222, 77,  3,  0,  0, 54,  0,  0,  0,173,222,173,222,
+/* 0x1d90 */  85,  3,  0,  0, 54,  0,  0,  0,173,222,173,222, 93,  3,  0,  0,
+/* 0x1da0 */  31,  0,  0,  0,118,  0,  0,  0,109,  3,  0,  0, 54,  0,  0,  0,
+/* 0x1db0 */ 173,222,173,222,131,  3,  0,  0, 33,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1dc0 */ 154,  3,  0,  0, 37,  0,  0,  0,  2,  0,  0,  0,181,  3,  0,  0,
+/* 0x1dd0 */  38,  0,  0,  0,  2,  0,  0,  0,208,  3,  0,  0, 39,  0,  0,  0,
+/* 0x1de0 */   2,  0,  0,  0,235,  3,  0,  0, 40,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1df0 */   7,  4,  0,  0, 41,  0,  0,  0,  2,  0,  0,  0, 35,  4,  0,  0,
+/* 0x1e00 */  42,  0,  0,  0,  2,  0,  0,  0, 63,  4,  0,  0, 54,  0,  0,  0,
+/* 0x1e10 */ 173,222,173,222, 81,  4,  0,  0, 54,  0,  0,  0,173,222,173,222,
+/* 0x1e20 */  92,  4,  0,  0, 54,  0,  0,  0,173,222,173,222,103,  4,  0,  0,
+/* 0x1e30 */  54,  0,  0,  0,173,222,173,222,119,  4,  0,  0, 54,  0,  0,  0,
+/* 0x1e40 */ 173,222,173,222,  0,  0,  0,  0, 28,  0,  0,  0,131,  4,  0,  0,
+/* 0x1e50 */ 198,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */  38,  0,  0,  0,131,  4,  0,  0,210,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1e70 */   0,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,131,  4,  0,  0,
+/* 0x1e80 */ 222,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1e90 */   2,  0,  0,  0,140,  4,  0,  0,234,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0,  2,  0,  0,  0,  4,  0,  0,  0,140,  4,  0,  0,
+/* 0x1eb0 */ 242,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1ec0 */   4,  0,  0,  0,131,  4,  0,  0,242,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0,149,  4,  0,  0,
+/* 0x1ee0 */ 250,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1ef0 */   2,  0,  0,  0,140,  4,  0,  0,250,  2,  0,  0,  0,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0,  6,  0,  0,  0,  2,  0,  0,  0,131,  4,  0,  0,
+/* 0x1f10 */ 250,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1f20 */   3,  0,  0,  0,157,  4,  0,  0,102,  0,  0,  0,255,255,255,255,
+/* 0x1f30 */   0,  0,  0,  0, 11,  0,  0,  0,  3,  0,  0,  0,157,  4,  0,  0,
+/* 0x1f40 */ 102,  0,  0,  0,255,255,255,255,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1f50 */   2,  0,  0,  0,167,  4,  0,  0,102,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0, 13,  0,  0,  0,  1,  0,  0,  0,149,  4,  0,  0,
+/* 0x1f70 */   6,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f80 */   2,  0,  0,  0,167,  4,  0,  0, 18,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0, 15,  0,  0,  0,  7,  0,  0,  0,149,  4,  0,  0,
+/* 0x1fa0 */  36,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1fb0 */  18,  0,  0,  0,140,  4,  0,  0, 54,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0, 15,  0,  0,  0, 21,  0,  0,  0,157,  4,  0,  0,
+/* 0x1fd0 */ 175,  1,  0,  0,255,255,255,255,  0,  0,  0,  0, 19,  0,  0,  0,
+/* 0x1fe0 */   2,  0,  0,  0,140,  4,  0,  0, 77,  3,  0,  0,  0,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0, 20,  0,  0,  0,  4,  0,  0,  0,140,  4,  0,  0,
+/* 0x2000 */  85,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,
+/* 0x2010 */   6,  0,  0,  0,140,  4,  0,  0, 77,  3,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0, 22,  0,  0,  0,  4,  0,  0,  0,131,  4,  0,  0,
+/* 0x2030 */  85,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,  0,
+/* 0x2040 */   3,  0,  0,  0,157,  4,  0,  0,105,  1,  0,  0,255,255,255,255,
+/* 0x2050 */   0,  0,  0,  0, 29,  0,  0,  0,  3,  0,  0,  0,157,  4,  0,  0,
+/* 0x2060 */ 105,  1,  0,  0,255,255,255,255,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x2070 */   2,  0,  0,  0,167,  4,  0,  0,105,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0, 32,  0,  0,  0,  2,  0,  0,  0,167,  4,  0,  0,
+/* 0x2090 */  18,  3,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,
+/* 0x20a0 */   1,  0,  0,  0,149,  4,  0,  0,109,  3,  0,  0,  0,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0, 43,  0,  0,  0,  4,  0,  0,  0,140,  4,  0,  0,
+/* 0x20c0 */  63,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,  0,  0,  0,
+/* 0x20d0 */  14,  0,  0,  0,131,  4,  0,  0, 81,  4,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0, 43,  0,  0,  0, 26,  0,  0,  0,131,  4,  0,  0,
+/* 0x20f0 */  92,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43,  0,  0,  0,
+/* 0x2100 */  40,  0,  0,  0,131,  4,  0,  0,103,  4,  0,  0,  0,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,  0, 44,  0,  0,  0,  8,  1,  0,  0,167,  4,  0,  0,
+/* 0x2120 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,
+/* 0x2130 */ 202,  1,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,  0, 44,  0,  0,  0, 66,  2,  0,  0,167,  4,  0,  0,
+/* 0x2150 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,
+/* 0x2160 */ 254,  2,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  0, 44,  0,  0,  0,130,  3,  0,  0,167,  4,  0,  0,
+/* 0x2180 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,
+/* 0x2190 */ 222,  3,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0, 44,  0,  0,  0,130,  4,  0,  0,167,  4,  0,  0,
+/* 0x21b0 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,
+/* 0x21c0 */ 218,  4,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0, 44,  0,  0,  0,120,  5,  0,  0,167,  4,  0,  0,
+/* 0x21e0 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,
+/* 0x21f0 */ 224,  5,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2200 */   0,  0,  0,  0, 44,  0,  0,  0,108,  6,  0,  0,167,  4,  0,  0,
+/* 0x2210 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,
+/* 0x2220 */   8,  7,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2230 */   0,  0,  0,  0, 44,  0,  0,  0,248,  7,  0,  0,167,  4,  0,  0,
+/* 0x2240 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x2250 */   8,  1,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2260 */   0,  0,  0,  0, 45,  0,  0,  0,202,  1,  0,  0,167,  4,  0,  0,
+/* 0x2270 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x2280 */  66,  2,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2290 */   0,  0,  0,  0, 45,  0,  0,  0,254,  2,  0,  0,167,  4,  0,  0,
+/* 0x22a0 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x22b0 */ 130,  3,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x22c0 */   0,  0,  0,  0, 45,  0,  0,  0,222,  3,  0,  0,167,  4,  0,  0,
+/* 0x22d0 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x22e0 */ 130,  4,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x22f0 */   0,  0,  0,  0, 45,  0,  0,  0,218,  4,  0,  0,167,  4,  0,  0,
+/* 0x2300 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x2310 */ 120,  5,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2320 */   0,  0,  0,  0, 45,  0,  0,  0,224,  5,  0,  0,167,  4,  0,  0,
+/* 0x2330 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x2340 */ 108,  6,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2350 */   0,  0,  0,  0, 45,  0,  0,  0,  8,  7,  0,  0,167,  4,  0,  0,
+/* 0x2360 */ 189,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+/* 0x2370 */ 248,  7,  0,  0,167,  4,  0,  0,189,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2380 */   0,  0,  0,  0, 48,  0,  0,  0,  1,  0,  0,  0,149,  4,  0,  0,
+/* 0x2390 */ 119,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,
+/* 0x23a0 */   2,  0,  0,  0,140,  4,  0,  0,119,  4,  0,  0,  0,  0,  0,  0,
+/* 0x23b0 */   0,  0,  0,  0, 50,  0,  0,  0,  2,  0,  0,  0,131,  4,  0,  0,
+/* 0x23c0 */ 119,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,101,110,116,114,
+/* 0x23d0 */ 121,  0,115,101,116, 95,117,112, 50, 49, 95, 97, 54, 46,119,  0,
+/* 0x23e0 */ 115,101,116, 95,117,112, 50, 49, 95,100, 52, 46,119,  0,115,101,
+/* 0x23f0 */ 116, 95,117,112, 50, 49, 95,100, 52, 46,108,  0,108,111,111,112,
+/* 0x2400 */  49, 95,115,101,116, 95, 99,111,117,110,116, 46, 98,  0,108,111,
+/* 0x2410 */ 111,112, 49, 95,115,101,116, 95, 99,111,117,110,116, 46,119,  0,
+/* 0x2420 */ 108,111,111,112, 49, 95,115,101,116, 95, 99,111,117,110,116, 46,
+/* 0x2430 */ 108,  0,108,111,111,112, 49, 95,108, 97, 98,101,108,  0,108,111,
+/* 0x2440 */ 111,112, 49, 46,102, 97,115,116,  0,108,111,111,112, 49, 46,115,
+/* 0x2450 */ 109, 97,108,108,  0,108,111,111,112, 49, 95,115,117, 98,113,108,
+/* 0x2460 */   0,108,111,111,112, 49, 95,115,117, 98,113,119,  0,108,111,111,
+/* 0x2470 */ 112, 49, 95,100, 98,114, 97,  0,108,111,111,112, 50, 46,102, 97,
+/* 0x2480 */ 115,116,  0,108,111,111,112, 50, 46,115,109, 97,108,108,  0, 99,
+/* 0x2490 */ 111,112,121, 95,116,111, 95,115,116, 97, 99,107,  0,110,114,118,
+/* 0x24a0 */  50, 98, 46,105,110,105,116,  0,110,114,118, 50,100, 46,105,110,
+/* 0x24b0 */ 105,116,  0,110,114,118, 50,101, 46,105,110,105,116,  0,106,109,
+/* 0x24c0 */ 112, 95,100,101, 99,111,109,112,114,101,115,115,111,114, 95, 97,
+/* 0x24d0 */  54, 46,119,  0,106,109,112, 95,100,101, 99,111,109,112,114,101,
+/* 0x24e0 */ 115,115,111,114, 95,100, 52, 46,119,  0,106,109,112, 95,100,101,
+/* 0x24f0 */  99,111,109,112,114,101,115,115,111,114, 95, 97, 54, 46,119, 50,
+/* 0x2500 */   0,106,109,112, 95,100,101, 99,111,109,112,114,101,115,115,111,
+/* 0x2510 */ 114, 95,100, 52, 46,108,  0, 99,111,100,101, 95,111,110, 95,115,
+/* 0x2520 */ 116, 97, 99,107,  0, 99,108,101, 97,114, 95,100,105,114,116,121,
+/* 0x2530 */  95, 98,115,115,  0,108,111,111,112, 51, 95,108, 97, 98,101,108,
+/* 0x2540 */   0,108,111,111,112, 51, 46,115,109, 97,108,108,  0,108,111,111,
+/* 0x2550 */ 112, 51, 46,102, 97,115,116,  0,108,111,111,112, 51, 95,115,117,
+/* 0x2560 */  98,113,108,  0,108,111,111,112, 51, 95,115,117, 98,113,119,  0,
+/* 0x2570 */ 108,111,111,112, 51, 95,100, 98,114, 97,  0,102,108,117,115,104,
+/* 0x2580 */  95, 99, 97, 99,104,101,  0,114,101,115,116,111,114,101, 95,115,
+/* 0x2590 */ 116, 97, 99,107,  0, 99,108,101, 97,114, 95,100,105,114,116,121,
+/* 0x25a0 */  95,115,116, 97, 99,107,  0,115,116, 97,114,116, 95,112,114,111,
+/* 0x25b0 */ 103,114, 97,109,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0, 67, 85,
+/* 0x25c0 */  84, 80, 79, 73, 78, 84,  0,110,114,118, 50, 98, 95, 56, 46,102,
+/* 0x25d0 */  97,115,116,  0,110,114,118, 50,100, 95, 56, 46,102, 97,115,116,
+/* 0x25e0 */   0,110,114,118, 50,101, 95, 56, 46,102, 97,115,116,  0,110,114,
+/* 0x25f0 */ 118, 50, 98, 95, 56, 46,115,109, 97,108,108,  0,110,114,118, 50,
+/* 0x2600 */ 100, 95, 56, 46,115,109, 97,108,108,  0,110,114,118, 50,101, 95,
+/* 0x2610 */  56, 46,115,109, 97,108,108,  0,108,122,109, 97, 46,105,110,105,
+/* 0x2620 */ 116,  0,108,122,109, 97, 46,102, 97,115,116,  0,108,122,109, 97,
+/* 0x2630 */  46,115,109, 97,108,108,  0,108,122,109, 97, 46,102,105,110,105,
+/* 0x2640 */ 115,104,  0,114,101,108,111, 99,  0,108,111,111,112, 51, 95,115,
+/* 0x2650 */ 101,116, 95, 99,111,117,110,116, 46, 98,  0,108,111,111,112, 51,
+/* 0x2660 */  95,115,101,116, 95, 99,111,117,110,116, 46,119,  0,108,111,111,
+/* 0x2670 */ 112, 51, 95,115,101,116, 95, 99,111,117,110,116, 46,108,  0,106,
+/* 0x2680 */ 109,112, 95,115,116, 97, 99,107,  0, 95, 95,109,117,108,115,105,
+/* 0x2690 */  51,  0,111,114,105,103, 95,112, 95,116,108,101,110,  0,111,114,
+/* 0x26a0 */ 105,103, 95,112, 95,100,108,101,110,  0,111,114,105,103, 95,112,
+/* 0x26b0 */  95, 98,108,101,110,  0,117,112, 50, 49, 95, 97, 54,  0,117,112,
+/* 0x26c0 */  50, 49, 95,100, 52,  0,108,111,111,112, 49, 95, 99,111,117,110,
+/* 0x26d0 */ 116,  0,108,111,111,112, 50, 95, 99,111,117,110,116,  0, 99,111,
+/* 0x26e0 */ 100,101, 95,111,110, 95,115,116, 97, 99,107, 95,101,110,100,  0,
+/* 0x26f0 */  99,111,112,121, 95,116,111, 95,115,116, 97, 99,107, 95,108,101,
+/* 0x2700 */ 110,  0,102,108,117,115,104, 95, 99, 97, 99,104,101, 95,114,116,
+/* 0x2710 */ 115, 95,111,102,102,115,101,116,  0,117,112, 51, 49, 95, 97, 54,
+/* 0x2720 */   0,117,112, 51, 49, 95,100, 52,  0,102,108,117,115,104, 95, 99,
+/* 0x2730 */  97, 99,104,101, 95,114,116,115,  0, 99,108,101, 97,114, 95,100,
+/* 0x2740 */ 105,114,116,121, 95,115,116, 97, 99,107, 95,108,101,110,  0, 99,
+/* 0x2750 */ 108,101, 97,114, 95,100,105,114,116,121, 95,115,116, 97, 99,107,
+/* 0x2760 */  95,108,111,111,112,  0,110,114,118, 50, 98, 95, 56, 95,102, 97,
+/* 0x2770 */ 115,116, 95,100,101, 99,111,109,112,114, 95,115,116, 97,114,116,
+/* 0x2780 */   0,110,114,118, 50,100, 95, 56, 95,102, 97,115,116, 95,100,101,
+/* 0x2790 */  99,111,109,112,114, 95,115,116, 97,114,116,  0,110,114,118, 50,
+/* 0x27a0 */ 101, 95, 56, 95,102, 97,115,116, 95,100,101, 99,111,109,112,114,
+/* 0x27b0 */  95,115,116, 97,114,116,  0,110,114,118, 50, 98, 95, 56, 95,115,
+/* 0x27c0 */ 109, 97,108,108, 95,100,101, 99,111,109,112,114, 95,115,116, 97,
+/* 0x27d0 */ 114,116,  0,110,114,118, 50,100, 95, 56, 95,115,109, 97,108,108,
+/* 0x27e0 */  95,100,101, 99,111,109,112,114, 95,115,116, 97,114,116,  0,110,
+/* 0x27f0 */ 114,118, 50,101, 95, 56, 95,115,109, 97,108,108, 95,100,101, 99,
+/* 0x2800 */ 111,109,112,114, 95,115,116, 97,114,116,  0,108,122,109, 97, 95,
+/* 0x2810 */ 115,116, 97, 99,107, 95, 97,100,106,117,115,116,  0,108,122,109,
+/* 0x2820 */  97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95, 99, 95,108,
+/* 0x2830 */ 101,110,  0,108,122,109, 97, 95,112,114,111,112,101,114,116,105,
+/* 0x2840 */ 101,115,  0,108,111,111,112, 51, 95, 99,111,117,110,116,  0, 82,
+/* 0x2850 */  95, 54, 56, 75, 95, 51, 50,  0, 82, 95, 54, 56, 75, 95, 49, 54,
+/* 0x2860 */   0, 82, 95, 54, 56, 75, 95, 56,  0, 82, 95, 54, 56, 75, 95, 80,
+/* 0x2870 */  67, 56,  0, 82, 95, 54, 56, 75, 95, 80, 67, 49, 54,  0, 48, 23,
+/* 0x2880 */   0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* mips.r3000-linux.elf-entry.h
-   created from mips.r3000-linux.elf-entry.bin, 9076 (0x2374) bytes
+   created from mips.r3000-linux.elf-entry.bin, 7845 (0x1ea5) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_SIZE    9076
-#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_ADLER32 0xb22c8dd0
-#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_CRC32   0x8721673b
+#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_SIZE    7845
+#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_ADLER32 0x34c725c6
+#define STUB_MIPS_R3000_LINUX_ELF_ENTRY_CRC32   0xde2c68fb
 
-unsigned char stub_mips_r3000_linux_elf_entry[9076] = {
+unsigned char stub_mips_r3000_linux_elf_entry[7845] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0,  8,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 28,132,  0,  0,  0,  1,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -481,127 +481,50 @@ unsigned char stub_mips_r3000_linux_elf_entry[9076] = {
 /* 0x1ba0 */   0,  8, 36,  8,  0,  6,  4, 17,255,249,  3,160, 32, 33,  4, 17,
 /* 0x1bb0 */ 255,247,  2,192, 32, 33,140,131,  0,  0, 36,132,  0,  8, 16,104,
 /* 0x1bc0 */   0,  3,140,130,255,252, 20, 96,255,251, 36,  2, 16,  0,  0,  2,
-/* 0x1bd0 */ 224, 34,  4, 17,255,191, 39,244,  0,  4,  0,  0,  0,  0,102,105,
-/* 0x1be0 */ 108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,
-/* 0x1bf0 */  98,105,103,109,105,112,115, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x1c00 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x1c10 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1c20 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1c30 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1c40 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70,
-/* 0x1c50 */  77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48,
-/* 0x1c60 */  32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1c70 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86,
-/* 0x1c80 */  50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 53, 52, 32,
-/* 0x1c90 */  32, 48, 32, 32, 48, 32, 32, 48, 51, 99, 32, 32, 50, 42, 42, 48,
-/* 0x1ca0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 78,
-/* 0x1cb0 */  82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 52,
-/* 0x1cc0 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 48, 32, 32, 50,
-/* 0x1cd0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x1ce0 */  51, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1cf0 */  48, 49, 50, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,100, 52,
-/* 0x1d00 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1d10 */  10, 32, 32, 52, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32,
-/* 0x1d20 */  32, 32, 32, 48, 57, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x1d30 */ 102, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1d40 */  84, 83, 10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x1d50 */  48, 32, 32, 32, 32, 48, 97,100, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1d60 */  32, 48, 52, 57, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1d70 */  84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1d80 */  69, 67, 49, 48, 32, 32, 32, 32, 48, 97,100, 56, 32, 32, 48, 32,
-/* 0x1d90 */  32, 48, 32, 32, 48,102, 55, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1da0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 76, 90, 77,
-/* 0x1db0 */  65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 52, 32, 32, 48,
-/* 0x1dc0 */  32, 32, 48, 32, 32, 48, 49, 97, 52, 56, 32, 32, 50, 42, 42, 48,
-/* 0x1dd0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 78,
-/* 0x1de0 */  82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 49, 48,
-/* 0x1df0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 52, 99, 32, 32, 50,
-/* 0x1e00 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x1e10 */  57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32,
-/* 0x1e20 */  48, 49, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 53, 99,
-/* 0x1e30 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1e40 */  10, 32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32,
-/* 0x1e50 */  32, 32, 32, 48, 50, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x1e60 */  97, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1e70 */  78, 84, 83, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x1e80 */  32, 32, 32, 32, 32, 32, 48, 50, 97, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1e90 */  32, 48, 49, 97, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1ea0 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65,
-/* 0x1eb0 */  73, 78, 90, 32, 32, 32, 32, 32, 32, 48, 49, 50, 52, 32, 32, 48,
-/* 0x1ec0 */  32, 32, 48, 32, 32, 48, 49, 97, 98, 97, 32, 32, 50, 42, 42, 48,
-/* 0x1ed0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79,
-/* 0x1ee0 */  76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ef0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65,
-/* 0x1f00 */  73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48,
-/* 0x1f10 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x1f20 */  76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1f30 */  78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1f40 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 69,
-/* 0x1f50 */  76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f60 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48,
-/* 0x1f70 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1f80 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32,
-/* 0x1f90 */  78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1fa0 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78,
-/* 0x1fb0 */  82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1fc0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
-/* 0x1fd0 */  32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48,
-/* 0x1fe0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x1ff0 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65,
-/* 0x2000 */  95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2010 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2020 */  49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10,
-/* 0x2030 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2040 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90,
-/* 0x2050 */  77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2060 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69,
-/* 0x2070 */  65, 68, 32, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48,
-/* 0x2080 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x2090 */  70, 76, 85, 83, 72, 32, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48,
-/* 0x20a0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x20b0 */  69, 76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65,
-/* 0x20c0 */  73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32,
-/* 0x20d0 */  32, 32, 32, 79, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32,
-/* 0x20e0 */  95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x20f0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x2100 */  79, 95, 66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x2110 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x2120 */  91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2130 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2140 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2150 */  48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x2160 */  54, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x2170 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2180 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93,
-/* 0x2190 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x21a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x21b0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 77, 73,
-/* 0x21c0 */  80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x21d0 */  86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x21e0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x21f0 */  78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x2200 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2210 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55,
-/* 0x2220 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x2230 */  32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69,
-/* 0x2240 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2250 */  32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70,
-/* 0x2260 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x2270 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x2280 */  48, 48, 48, 48, 48, 54, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80,
-/* 0x2290 */  67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65,
-/* 0x22a0 */  73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x22b0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77,
-/* 0x22c0 */  65, 73, 78, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x22d0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22e0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x22f0 */  32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32,
-/* 0x2300 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76,
-/* 0x2310 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x2320 */  70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10,
-/* 0x2330 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2340 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2350 */  10, 48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95, 77, 73, 80, 83,
-/* 0x2360 */  95, 51, 50, 32, 32, 32, 32, 32, 32, 32, 32, 32, 79, 95, 66, 73,
-/* 0x2370 */  78, 70, 79, 10
+/* 0x1bd0 */ 224, 34,  4, 17,255,191, 39,244,  0,  4,  0,  0,  0,  0, 13,  0,
+/* 0x1be0 */   0,  0, 15,  0,  0,  0,  6,  0,  0,  0,151,  0,  0,  0,  0,  0,
+/* 0x1bf0 */   0,  0, 52,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x1c00 */   0,  0, 60,  0,  0,  0, 84,  1,  0,  0,  0,  0,  0,  0, 15,  0,
+/* 0x1c10 */   0,  0,144,  1,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0, 21,  0,
+/* 0x1c20 */   0,  0,212,  2,  0,  0, 40,  1,  0,  0,  0,  0,  0,  0, 27,  0,
+/* 0x1c30 */   0,  0,252,  3,  0,  0,156,  0,  0,  0,  0,  0,  0,  0, 38,  0,
+/* 0x1c40 */   0,  0,152,  4,  0,  0,216, 10,  0,  0,  0,  0,  0,  0, 49,  0,
+/* 0x1c50 */   0,  0,112, 15,  0,  0,216, 10,  0,  0,  0,  0,  0,  0, 60,  0,
+/* 0x1c60 */   0,  0, 72, 26,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 71,  0,
+/* 0x1c70 */   0,  0, 76, 26,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x1c80 */   0,  0, 92, 26,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x1c90 */   0,  0,108, 26,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 96,  0,
+/* 0x1ca0 */   0,  0,144, 26,  0,  0, 42,  0,  0,  0,  0,  0,  0,  0,105,  0,
+/* 0x1cb0 */   0,  0,186, 26,  0,  0, 36,  1,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x1cc0 */   0,  0,  9,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 12,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 15,  0,
+/* 0x1cf0 */   0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,  3,  0,
+/* 0x1d00 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+/* 0x1d10 */   0,  0, 38,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 49,  0,
+/* 0x1d20 */   0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  7,  0,
+/* 0x1d30 */   0,  0,  0,  0,  0,  0, 71,  0,  0,  0,  8,  0,  0,  0,  0,  0,
+/* 0x1d40 */   0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 96,  0,
+/* 0x1d50 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,  0,  0,
+/* 0x1d60 */   0,  0,  0,  0,  0,  0,121,  0,  0,  0, 14,  0,  0,  0,173,222,
+/* 0x1d70 */ 173,222,  0,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,105,  0,
+/* 0x1d80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,124,  0,
+/* 0x1d90 */   0,  0,129,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */   0,  0,  2,  0,  0,  0,124,  0,  0,  0,129,  0,  0,  0, 80,  0,
+/* 0x1db0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,100,  0,
+/* 0x1dc0 */   0,  0,129,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1dd0 */   0,  0, 11,  0,  0,  0,  4,  0,  0,  0,129,  0,  0,  0,105,  0,
+/* 0x1de0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 32,  1,
+/* 0x1df0 */   0,  0,141,  0,  0,  0,121,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e00 */   0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86, 50, 69,
+/* 0x1e10 */   0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77,
+/* 0x1e20 */  65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67,
+/* 0x1e30 */  50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90,
+/* 0x1e40 */  77, 65, 95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 72, 69, 65,
+/* 0x1e50 */  68,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83,
+/* 0x1e60 */  72,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65,
+/* 0x1e70 */  73, 78, 90,  0, 95,115,116, 97,114,116,  0, 79, 95, 66, 73, 78,
+/* 0x1e80 */  70, 79,  0, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54,  0, 82,
+/* 0x1e90 */  95, 77, 73, 80, 83, 95, 51, 50,  0,222, 27,  0,  0, 85, 80, 88,
+/* 0x1ea0 */  76, 78, 75, 48, 49
 };
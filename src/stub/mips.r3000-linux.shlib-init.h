@@ -1,5 +1,5 @@
 /* mips.r3000-linux.shlib-init.h
-   created from mips.r3000-linux.shlib-init.bin, 9517 (0x252d) bytes
+   created from mips.r3000-linux.shlib-init.bin, 8436 (0x20f4) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_SIZE    9517
-#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_ADLER32 0xa6bb1270
-#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_CRC32   0x3f34e1d4
+#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_SIZE    8436
+#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_ADLER32 0x39f5cc8f
+#define STUB_MIPS_R3000_LINUX_SHLIB_INIT_CRC32   0x459afd37
 
-unsigned char stub_mips_r3000_linux_shlib_init[9517] = {
+unsigned char stub_mips_r3000_linux_shlib_init[8436] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0,  8,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 30,220,  0,  0,  0,  1,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -519,116 +519,49 @@ unsigned char stub_mips_r3000_linux_shlib_init[9517] = {
 /* 0x1e00 */ 175,164,  0, 20,  0,128, 40, 33,  0,192, 32, 33, 36,  6,  0,  0,
 /* 0x1e10 */  36,  2, 16, 51,  0,  0,  0, 12,143,185,  0, 20,  3, 32,  0,  8,
 /* 0x1e20 */   0,  0,  0,  0,140,231,255,248,  0,  7, 60,  0,  0,  7, 60,  2,
-/* 0x1e30 */  36,231,255,255,  3,224,  0,  8,  0,199, 48, 33,102,105,108,101,
-/* 0x1e40 */  32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45, 98,105,
-/* 0x1e50 */ 103,109,105,112,115, 10, 10, 83,101, 99,116,105,111,110,115, 58,
-/* 0x1e60 */  10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e70 */  32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65,
-/* 0x1e80 */  32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32,
-/* 0x1e90 */  32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32,
-/* 0x1ea0 */  32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65,
-/* 0x1eb0 */  73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 99, 52, 32, 32, 48, 32,
-/* 0x1ec0 */  32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1ed0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86, 50,
-/* 0x1ee0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 53, 52, 32, 32,
-/* 0x1ef0 */  48, 32, 32, 48, 32, 32, 48,102, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1f00 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 78, 82,
-/* 0x1f10 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 52, 52,
-/* 0x1f20 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 52, 99, 32, 32, 50, 42,
-/* 0x1f30 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51,
-/* 0x1f40 */  32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1f50 */  49, 50, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 57, 48, 32,
-/* 0x1f60 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1f70 */  32, 32, 52, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32,
-/* 0x1f80 */  32, 32, 48, 57, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 98,
-/* 0x1f90 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1fa0 */  83, 10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x1fb0 */  32, 32, 32, 32, 48, 97,100, 56, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1fc0 */  48, 53, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1fd0 */  69, 78, 84, 83, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1fe0 */  67, 49, 48, 32, 32, 32, 32, 48, 97,100, 56, 32, 32, 48, 32, 32,
-/* 0x1ff0 */  48, 32, 32, 48, 49, 48, 50, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2000 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 76, 90, 77,
-/* 0x2010 */  65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 52, 32, 32, 48,
-/* 0x2020 */  32, 32, 48, 32, 32, 48, 49, 98, 48, 52, 32, 32, 50, 42, 42, 48,
-/* 0x2030 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 78,
-/* 0x2040 */  82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 49, 48,
-/* 0x2050 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 48, 56, 32, 32, 50,
-/* 0x2060 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x2070 */  57, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32,
-/* 0x2080 */  48, 49, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 98, 49, 56,
-/* 0x2090 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x20a0 */  10, 32, 49, 48, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32,
-/* 0x20b0 */  32, 32, 32, 48, 50, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x20c0 */  98, 50, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x20d0 */  78, 84, 83, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89,
-/* 0x20e0 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x20f0 */  49, 98, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2100 */  69, 78, 84, 83, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2110 */  90, 32, 32, 32, 32, 32, 32, 48, 50,102, 48, 32, 32, 48, 32, 32,
-/* 0x2120 */  48, 32, 32, 48, 49, 98, 52, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2130 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32,
-/* 0x2140 */  84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2150 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2160 */  32, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48,
-/* 0x2170 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70,
-/* 0x2180 */  77, 65, 73, 78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x2190 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x21a0 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 69, 76, 70,
-/* 0x21b0 */  77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x21c0 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78,
-/* 0x21d0 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x21e0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82,
-/* 0x21f0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2200 */  32, 32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86,
-/* 0x2210 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2220 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48,
-/* 0x2230 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x2250 */  65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2260 */  69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2270 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x2280 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x2290 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x22a0 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65,
-/* 0x22b0 */  95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x22c0 */ 108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68,
-/* 0x22d0 */  32, 48, 32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48,
-/* 0x22e0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76,
-/* 0x22f0 */  85, 83, 72, 32, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48, 48, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x2310 */  70, 77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2320 */  89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32,
-/* 0x2330 */  32, 79, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 95,115,
-/* 0x2340 */ 116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32,
-/* 0x2350 */  32, 32, 32, 32, 79, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 48,
-/* 0x2360 */  32,101,110,100, 95,100,101, 99,111,109,112,114,101,115,115, 10,
-/* 0x2370 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2380 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2390 */  88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x23a0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x23b0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 56, 32, 82, 95,
-/* 0x23c0 */  77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x23d0 */  95,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 50, 48, 32,
-/* 0x23e0 */  82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32,
-/* 0x23f0 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79,
-/* 0x2400 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2410 */  79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2420 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2430 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2440 */  48, 48, 48, 55, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x2450 */  54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2460 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2470 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93,
-/* 0x2480 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2490 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x24a0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 77, 73,
-/* 0x24b0 */  80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82,
-/* 0x24c0 */  86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x24d0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x24e0 */  78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x24f0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2500 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 54,
-/* 0x2510 */  52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x2520 */  32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10
+/* 0x1e30 */  36,231,255,255,  3,224,  0,  8,  0,199, 48, 33, 13,  0,  0,  0,
+/* 0x1e40 */  15,  0,  0,  0,  5,  0,  0,  0,160,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e50 */  52,  0,  0,  0,196,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1e60 */ 248,  0,  0,  0, 84,  1,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1e70 */  76,  2,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,
+/* 0x1e80 */ 144,  3,  0,  0, 40,  1,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1e90 */ 184,  4,  0,  0,156,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,
+/* 0x1ea0 */  84,  5,  0,  0,216, 10,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,
+/* 0x1eb0 */  44, 16,  0,  0,216, 10,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,
+/* 0x1ec0 */   4, 27,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 71,  0,  0,  0,
+/* 0x1ed0 */   8, 27,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,
+/* 0x1ee0 */  24, 27,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x1ef0 */  40, 27,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,
+/* 0x1f00 */  76, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,
+/* 0x1f10 */  76, 27,  0,  0,240,  2,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,
+/* 0x1f20 */   9,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1f50 */   2,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1f60 */   0,  0,  0,  0, 27,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */  38,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,
+/* 0x1f80 */   6,  0,  0,  0,  0,  0,  0,  0, 60,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0, 71,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,
+/* 0x1fb0 */  11,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0,121,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   0,  0,  0,  0, 24,  0,  0,  0,136,  0,  0,  0,114,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,
+/* 0x1ff0 */ 136,  0,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */   1,  0,  0,  0,124,  0,  0,  0,148,  0,  0,  0, 80,  0,  0,  0,
+/* 0x2010 */   0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,124,  0,  0,  0,
+/* 0x2020 */ 148,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */   3,  0,  0,  0,100,  0,  0,  0,148,  0,  0,  0, 80,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,
+/* 0x2050 */   0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86,
+/* 0x2060 */  50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x2070 */  77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x2080 */  67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78,
+/* 0x2090 */  82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65, 73, 76,
+/* 0x20a0 */   0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77, 65, 73, 78, 89,
+/* 0x20b0 */   0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,
+/* 0x20c0 */   0,101,110,100, 95,100,101, 99,111,109,112,114,101,115,115,  0,
+/* 0x20d0 */  82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54,  0, 82, 95, 77, 73,
+/* 0x20e0 */  80, 83, 95, 80, 67, 49, 54,  0, 60, 30,  0,  0, 85, 80, 88, 76,
+/* 0x20f0 */  78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* mipsel.r3000-linux.elf-entry.h
-   created from mipsel.r3000-linux.elf-entry.bin, 8959 (0x22ff) bytes
+   created from mipsel.r3000-linux.elf-entry.bin, 7725 (0x1e2d) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_SIZE    8959
-#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_ADLER32 0xf6597710
-#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_CRC32   0xa9dce212
+#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_SIZE    7725
+#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_ADLER32 0x3a710de6
+#define STUB_MIPSEL_R3000_LINUX_ELF_ENTRY_CRC32   0xdca316b2
 
-unsigned char stub_mipsel_r3000_linux_elf_entry[8959] = {
+unsigned char stub_mipsel_r3000_linux_elf_entry[7725] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  8,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */  12, 28,  0,  0,  1,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -474,126 +474,49 @@ unsigned char stub_mipsel_r3000_linux_elf_entry[8959] = {
 /* 0x1b30 */  17,  4, 33, 32,160,  3,247,255, 17,  4, 33, 32,192,  2,  0,  0,
 /* 0x1b40 */ 131,140,  8,  0,132, 36,  3,  0,104, 16,252,255,130,140,251,255,
 /* 0x1b50 */  96, 20,  0, 16,  2, 36, 34,224,  2,  0,191,255, 17,  4,  4,  0,
-/* 0x1b60 */ 244, 39,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,109, 97,
-/* 0x1b70 */ 116, 32,101,108,102, 51, 50, 45,108,105,116,116,108,101,109,105,
-/* 0x1b80 */ 112,115, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,
-/* 0x1b90 */ 120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ba0 */  83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32,
-/* 0x1bb0 */  32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,
-/* 0x1bc0 */ 108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108,
-/* 0x1bd0 */  97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88,
-/* 0x1be0 */  32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1bf0 */  48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1c00 */  78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86, 50, 69, 32, 32, 32,
-/* 0x1c10 */  32, 32, 32, 32, 32, 32, 48, 49, 50, 99, 32, 32, 48, 32, 32, 48,
-/* 0x1c20 */  32, 32, 48, 51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1c30 */  84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 78, 82, 86, 50, 68, 32,
-/* 0x1c40 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 49, 99, 32, 32, 48, 32,
-/* 0x1c50 */  32, 48, 32, 32, 48, 49, 54, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1c60 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78, 82, 86,
-/* 0x1c70 */  50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 48, 48, 32,
-/* 0x1c80 */  32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 52, 32, 32, 50, 42, 42,
-/* 0x1c90 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32,
-/* 0x1ca0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 57,
-/* 0x1cb0 */  99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 56, 52, 32, 32, 50,
-/* 0x1cc0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x1cd0 */  53, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32,
-/* 0x1ce0 */  48, 97,100, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 50, 48,
-/* 0x1cf0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1d00 */  10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32,
-/* 0x1d10 */  32, 32, 32, 48, 97,100, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1d20 */ 101,102, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1d30 */  78, 84, 83, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1d40 */  51, 48, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1d50 */  48, 49, 57,100, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1d60 */  84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 78, 82, 86, 95, 72, 69,
-/* 0x1d70 */  65, 68, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32, 32, 48, 32, 32,
-/* 0x1d80 */  48, 32, 32, 48, 49, 57,100, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1d90 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 78, 82, 86,
-/* 0x1da0 */  95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 49, 48, 32, 32,
-/* 0x1db0 */  48, 32, 32, 48, 32, 32, 48, 49, 57,101, 52, 32, 32, 50, 42, 42,
-/* 0x1dc0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32,
-/* 0x1dd0 */  67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x1de0 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57,102, 52, 32, 32,
-/* 0x1df0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1e00 */  49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32,
-/* 0x1e10 */  32, 48, 50, 97, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 49,
-/* 0x1e20 */  56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1e30 */  83, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32,
-/* 0x1e40 */  32, 32, 32, 32, 48, 49, 50, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1e50 */  48, 49, 97, 52, 50, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1e60 */  84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66,
-/* 0x1e70 */  76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1e80 */  32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x1e90 */  78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1ea0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1eb0 */  78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48,
-/* 0x1ec0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x1ed0 */  76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x1ee0 */  78, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1ef0 */  32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50,
-/* 0x1f00 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1f10 */ 100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82, 86, 50, 68,
-/* 0x1f20 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1f30 */  32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1f50 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90,
-/* 0x1f60 */  77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1f70 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1f80 */  69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x1f90 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1fa0 */ 100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32,
-/* 0x1fb0 */  76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x1fd0 */  95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1fe0 */  67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1ff0 */  32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 48, 32,
-/* 0x2000 */  78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2010 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72,
-/* 0x2020 */  32, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2030 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65,
-/* 0x2040 */  73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 79, 32,
-/* 0x2060 */  69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 95,115,116, 97,114,
-/* 0x2070 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x2080 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 79, 95, 66, 73, 78,
-/* 0x2090 */  70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x20a0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77,
-/* 0x20b0 */  65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x20c0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20d0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20e0 */  32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32,
-/* 0x20f0 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76,
-/* 0x2100 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x2110 */  70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70,
-/* 0x2120 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2130 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2140 */  48, 48, 48, 48, 55, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67,
-/* 0x2150 */  49, 54, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73,
-/* 0x2160 */  76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x2170 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68,
-/* 0x2180 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2190 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x21a0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95, 77,
-/* 0x21b0 */  73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 78,
-/* 0x21c0 */  82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x21d0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x21e0 */  91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x21f0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2200 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2210 */  54, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32,
-/* 0x2220 */  32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82,
-/* 0x2230 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x2240 */  83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 89, 93,
-/* 0x2250 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2260 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2270 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 77, 73,
-/* 0x2280 */  80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32, 69, 76,
-/* 0x2290 */  70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x22a0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x22b0 */  69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x22c0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x22d0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x22e0 */  48, 49, 50, 48, 32, 82, 95, 77, 73, 80, 83, 95, 51, 50, 32, 32,
-/* 0x22f0 */  32, 32, 32, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x1b60 */ 244, 39,  0,  0,  0,  0, 13,  0,  0,  0, 15,  0,  0,  0,  6,  0,
+/* 0x1b70 */   0,  0,151,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,  8,  0,
+/* 0x1b80 */   0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 60,  0,  0,  0, 44,  1,
+/* 0x1b90 */   0,  0,  0,  0,  0,  0, 15,  0,  0,  0,104,  1,  0,  0, 28,  1,
+/* 0x1ba0 */   0,  0,  0,  0,  0,  0, 21,  0,  0,  0,132,  2,  0,  0,  0,  1,
+/* 0x1bb0 */   0,  0,  0,  0,  0,  0, 27,  0,  0,  0,132,  3,  0,  0,156,  0,
+/* 0x1bc0 */   0,  0,  0,  0,  0,  0, 38,  0,  0,  0, 32,  4,  0,  0,216, 10,
+/* 0x1bd0 */   0,  0,  0,  0,  0,  0, 49,  0,  0,  0,248, 14,  0,  0,216, 10,
+/* 0x1be0 */   0,  0,  0,  0,  0,  0, 60,  0,  0,  0,208, 25,  0,  0,  4,  0,
+/* 0x1bf0 */   0,  0,  0,  0,  0,  0, 71,  0,  0,  0,212, 25,  0,  0, 16,  0,
+/* 0x1c00 */   0,  0,  0,  0,  0,  0, 80,  0,  0,  0,228, 25,  0,  0, 16,  0,
+/* 0x1c10 */   0,  0,  0,  0,  0,  0, 89,  0,  0,  0,244, 25,  0,  0, 36,  0,
+/* 0x1c20 */   0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 24, 26,  0,  0, 42,  0,
+/* 0x1c30 */   0,  0,  0,  0,  0,  0,105,  0,  0,  0, 66, 26,  0,  0, 36,  1,
+/* 0x1c40 */   0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,  0,  0,
+/* 0x1c50 */   0,  0,105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1c60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,
+/* 0x1c70 */   0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+/* 0x1c80 */   0,  0, 21,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 27,  0,
+/* 0x1c90 */   0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 38,  0,  0,  0,  5,  0,
+/* 0x1ca0 */   0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  6,  0,  0,  0,  0,  0,
+/* 0x1cb0 */   0,  0, 60,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 71,  0,
+/* 0x1cc0 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0, 10,  0,
+/* 0x1cd0 */   0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x1ce0 */   0,  0,114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,121,  0,
+/* 0x1cf0 */   0,  0, 14,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,
+/* 0x1d00 */   0,  0,129,  0,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d10 */   0,  0,  1,  0,  0,  0,124,  0,  0,  0,129,  0,  0,  0, 80,  0,
+/* 0x1d20 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,124,  0,
+/* 0x1d30 */   0,  0,129,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d40 */   0,  0,  3,  0,  0,  0,100,  0,  0,  0,129,  0,  0,  0, 80,  0,
+/* 0x1d50 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  4,  0,
+/* 0x1d60 */   0,  0,129,  0,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */   0,  0, 12,  0,  0,  0, 32,  1,  0,  0,141,  0,  0,  0,121,  0,
+/* 0x1d80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73,
+/* 0x1d90 */  78, 88,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78,
+/* 0x1da0 */  82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0,
+/* 0x1db0 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95,
+/* 0x1dc0 */  68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
+/* 0x1dd0 */   0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 95, 84, 65,
+/* 0x1de0 */  73, 76,  0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77, 65, 73,
+/* 0x1df0 */  78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,
+/* 0x1e00 */ 114,116,  0, 79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 77, 73, 80,
+/* 0x1e10 */  83, 95, 80, 67, 49, 54,  0, 82, 95, 77, 73, 80, 83, 95, 51, 50,
+/* 0x1e20 */   0,102, 27,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* mipsel.r3000-ps1.h
-   created from mipsel.r3000-ps1.bin, 19509 (0x4c35) bytes
+   created from mipsel.r3000-ps1.bin, 14149 (0x3745) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_MIPSEL_R3000_PS1_SIZE    19509
-#define STUB_MIPSEL_R3000_PS1_ADLER32 0x9eaaf272
-#define STUB_MIPSEL_R3000_PS1_CRC32   0x57ee82f3
+#define STUB_MIPSEL_R3000_PS1_SIZE    14149
+#define STUB_MIPSEL_R3000_PS1_ADLER32 0x982dca37
+#define STUB_MIPSEL_R3000_PS1_CRC32   0xd10742fb
 
-unsigned char stub_mipsel_r3000_ps1[19509] = {
+unsigned char stub_mipsel_r3000_ps1[14149] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0,  8,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */ 152, 42,  0,  0,  1,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,  0,
@@ -679,581 +679,246 @@ unsigned char stub_mipsel_r3000_ps1[19509] = {
 /* 0x2800 */  36,  0,179,143, 32,  0,178,143, 28,  0,177,143, 24,  0,176,143,
 /* 0x2810 */   8,  0,224,  3, 56,  0,189, 39, 85, 80, 88, 33,161,216,208,213,
 /* 0x2820 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x2830 */   0,  0,  0,  0,  0,  0,  0, 45,102,105,108,101, 32,102,111,114,
-/* 0x2840 */ 109, 97,116, 32,101,108,102, 51, 50, 45,108,105,116,116,108,101,
-/* 0x2850 */ 109,105,112,115, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10,
-/* 0x2860 */  73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2870 */  32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32,
-/* 0x2880 */  32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2890 */  70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32,
-/* 0x28a0 */  70,108, 97,103,115, 10, 32, 32, 48, 32, 99,100, 98, 46,115,116,
-/* 0x28b0 */  97,114,116, 32, 32, 32, 32, 32, 48, 49, 52, 32, 32, 48, 32, 32,
-/* 0x28c0 */  48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x28d0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 99,100, 98, 46,101,
-/* 0x28e0 */ 110,116,114,121, 32, 32, 32, 32, 32, 48, 49, 99, 32, 32, 48, 32,
-/* 0x28f0 */  32, 48, 32, 32, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2900 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 99,100, 98, 46,
-/* 0x2910 */ 115,116, 97,114,116, 46,108,122,109, 97, 32, 48, 49, 56, 32, 32,
-/* 0x2920 */  48, 32, 32, 48, 32, 32, 48, 54, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2930 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 99,100,
-/* 0x2940 */  98, 46,101,110,116,114,121, 46,108,122,109, 97, 32, 48, 50, 48,
-/* 0x2950 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 55, 99, 32, 32, 50, 42, 42,
-/* 0x2960 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32,
-/* 0x2970 */  99,100, 98, 46,108,122,109, 97, 46, 99,112,114, 32, 32, 48, 56,
-/* 0x2980 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 57, 99, 32, 32, 50, 42, 42,
-/* 0x2990 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32,
-/* 0x29a0 */  99,100, 98, 46,100,101, 99, 46,112,116,114, 32, 32, 32, 48, 56,
-/* 0x29b0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 97, 52, 32, 32, 50, 42, 42,
-/* 0x29c0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32,
-/* 0x29d0 */  99,100, 98, 46,100,101, 99, 46,112,116,114, 46,104,105, 32, 48,
-/* 0x29e0 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 97, 99, 32, 32, 50, 42,
-/* 0x29f0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55,
-/* 0x2a00 */  32, 99,100, 98, 46,101,120,105,116, 32, 32, 32, 32, 32, 32, 48,
-/* 0x2a10 */  50, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 98, 48, 32, 32, 50,
-/* 0x2a20 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x2a30 */  56, 32, 99,111,110, 46,115,116, 97,114,116, 32, 32, 32, 32, 32,
-/* 0x2a40 */  48, 51, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,100, 56, 32, 32,
-/* 0x2a50 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2a60 */  32, 57, 32, 99,111,110, 46,109, 99,112,121, 32, 32, 32, 32, 32,
-/* 0x2a70 */  32, 48, 49, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 48, 56,
-/* 0x2a80 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2a90 */  10, 32, 49, 48, 32,108,122,109, 97, 46,112,114,101,112, 32, 32,
-/* 0x2aa0 */  32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50,
-/* 0x2ab0 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2ac0 */  83, 10, 32, 49, 49, 32, 99,111,110, 46,112, 97,100, 99,100, 32,
-/* 0x2ad0 */  32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x2ae0 */  50, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2af0 */  84, 83, 10, 32, 49, 50, 32,100,101, 99, 46,112,116,114, 32, 32,
-/* 0x2b00 */  32, 32, 32, 32, 32, 48, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2b10 */  49, 50, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2b20 */  78, 84, 83, 10, 32, 49, 51, 32,100,101, 99, 46,112,116,114, 46,
-/* 0x2b30 */ 104,105, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2b40 */  48, 49, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2b50 */  69, 78, 84, 83, 10, 32, 49, 52, 32, 99,111,110, 46,101,110,116,
-/* 0x2b60 */ 114,121, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2b70 */  48, 49, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2b80 */  69, 78, 84, 83, 10, 32, 49, 53, 32, 99,111,110, 46,101,120,105,
-/* 0x2b90 */ 116, 32, 32, 32, 32, 32, 32, 48, 50, 99, 32, 32, 48, 32, 32, 48,
-/* 0x2ba0 */  32, 32, 48, 49, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2bb0 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 54, 32, 98,115,115, 46, 99,
-/* 0x2bc0 */ 100, 98, 46,115,116, 97,114,116, 46,108,122,109, 97, 32, 48, 49,
-/* 0x2bd0 */  99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 54, 99, 32, 32, 50,
-/* 0x2be0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x2bf0 */  55, 32, 98,115,115, 46, 99,100, 98, 46,101,110,116,114,121, 46,
-/* 0x2c00 */ 108,122,109, 97, 32, 48, 50, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2c10 */  48, 49, 56, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2c20 */  69, 78, 84, 83, 10, 32, 49, 56, 32, 98,115,115, 46, 99,111,110,
-/* 0x2c30 */  46,115,116, 97,114,116, 32, 48, 51, 56, 32, 32, 48, 32, 32, 48,
-/* 0x2c40 */  32, 32, 48, 49, 97, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2c50 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 57, 32, 98,115,115, 46,101,
-/* 0x2c60 */ 120,105,116, 32, 32, 32, 32, 32, 32, 48, 50, 99, 32, 32, 48, 32,
-/* 0x2c70 */  32, 48, 32, 32, 48, 49,101, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2c80 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 48, 32,109,101,109,
-/* 0x2c90 */ 115,101,116, 46,115,104,111,114,116, 32, 32, 48, 49, 52, 32, 32,
-/* 0x2ca0 */  48, 32, 32, 48, 32, 32, 48, 50, 49, 48, 32, 32, 50, 42, 42, 48,
-/* 0x2cb0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 49, 32,109,
-/* 0x2cc0 */ 101,109,115,101,116, 46,108,111,110,103, 32, 32, 32, 48, 49, 56,
-/* 0x2cd0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 50, 52, 32, 32, 50, 42,
-/* 0x2ce0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 50,
-/* 0x2cf0 */  32,110,114,118, 50, 98, 46, 56, 98,105,116, 32, 32, 32, 32, 48,
-/* 0x2d00 */  49,101, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 51, 99, 32,
-/* 0x2d10 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x2d20 */  32, 50, 51, 32,110,114,118, 50,100, 46, 56, 98,105,116, 32, 32,
-/* 0x2d30 */  32, 32, 48, 50, 50, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,
-/* 0x2d40 */  50, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2d50 */  84, 83, 10, 32, 50, 52, 32,110,114,118, 50,101, 46, 56, 98,105,
-/* 0x2d60 */ 116, 32, 32, 32, 32, 48, 50, 53, 48, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2d70 */  32, 48, 54, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2d80 */  84, 69, 78, 84, 83, 10, 32, 50, 53, 32,110,114,118, 50, 98, 46,
-/* 0x2d90 */  51, 50, 98,105,116, 32, 32, 32, 48, 49,101, 99, 32, 32, 48, 32,
-/* 0x2da0 */  32, 48, 32, 32, 48, 56, 97, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2db0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 54, 32,110,114,118,
-/* 0x2dc0 */  50,100, 46, 51, 50, 98,105,116, 32, 32, 32, 48, 50, 50, 56, 32,
-/* 0x2dd0 */  32, 48, 32, 32, 48, 32, 32, 48, 97, 56, 99, 32, 32, 50, 42, 42,
-/* 0x2de0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 50, 55, 32,
-/* 0x2df0 */ 110,114,118, 50,101, 46, 51, 50, 98,105,116, 32, 32, 32, 48, 50,
-/* 0x2e00 */  53, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 99, 98, 52, 32, 32,
-/* 0x2e10 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2e20 */  50, 56, 32, 56, 98,105,116, 46,115,117, 98, 32, 32, 32, 32, 32,
-/* 0x2e30 */  32, 48, 50, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,102, 48, 52,
-/* 0x2e40 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2e50 */  10, 32, 50, 57, 32, 51, 50, 98,105,116, 46,115,117, 98, 32, 32,
-/* 0x2e60 */  32, 32, 32, 48, 50, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48,102,
-/* 0x2e70 */  50, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2e80 */  84, 83, 10, 32, 51, 48, 32,110,114,118, 50, 98, 46,115,109, 97,
-/* 0x2e90 */ 108,108, 32, 32, 32, 48,100, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2ea0 */  48,102, 53, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x2eb0 */  69, 78, 84, 83, 10, 32, 51, 49, 32,110,114,118, 50,100, 46,115,
-/* 0x2ec0 */ 109, 97,108,108, 32, 32, 32, 48,102, 48, 32, 32, 48, 32, 32, 48,
-/* 0x2ed0 */  32, 32, 48, 49, 48, 50, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2ee0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 50, 32,110,114,118, 50,
-/* 0x2ef0 */ 101, 46,115,109, 97,108,108, 32, 32, 32, 48, 49, 48, 48, 32, 32,
-/* 0x2f00 */  48, 32, 32, 48, 32, 32, 48, 49, 49, 49, 56, 32, 32, 50, 42, 42,
-/* 0x2f10 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 51, 32,
-/* 0x2f20 */ 110,114,118, 46,100,111,110,101, 32, 32, 32, 32, 32, 32, 48, 32,
-/* 0x2f30 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 50, 49, 56, 32, 32, 50, 42,
-/* 0x2f40 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 52,
-/* 0x2f50 */  32,100,101, 99,111,109,112,114,101,115,115,111,114, 46,115,116,
-/* 0x2f60 */  97,114,116, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 50,
-/* 0x2f70 */  49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2f80 */  84, 83, 10, 32, 51, 53, 32,108,122,109, 97, 46,105,110,105,116,
-/* 0x2f90 */  32, 32, 32, 32, 32, 48, 53, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x2fa0 */  48, 49, 50, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2fb0 */  84, 69, 78, 84, 83, 10, 32, 51, 54, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2fc0 */  69, 67, 49, 48, 32, 32, 32, 32, 48, 97,100, 56, 32, 32, 48, 32,
-/* 0x2fd0 */  32, 48, 32, 32, 48, 49, 50, 54, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2fe0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51, 55, 32, 76, 90,
-/* 0x2ff0 */  77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 97,100, 56,
-/* 0x3000 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100, 52, 48, 32, 32, 50,
-/* 0x3010 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 51,
-/* 0x3020 */  56, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32,
-/* 0x3030 */  48, 50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 56, 49, 56,
-/* 0x3040 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x3050 */  10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48,
-/* 0x3060 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x3070 */ 110,114,118, 46,100,111,110,101, 32, 48, 32,110,114,118, 46,100,
-/* 0x3080 */ 111,110,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3090 */  32, 32,100, 32, 32,100,101, 99,111,109,112,114,101,115,115,111,
-/* 0x30a0 */ 114, 46,115,116, 97,114,116, 32, 48, 32,100,101, 99,111,109,112,
-/* 0x30b0 */ 114,101,115,115,111,114, 46,115,116, 97,114,116, 10, 48, 48, 48,
-/* 0x30c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,100,
-/* 0x30d0 */  98, 46,115,116, 97,114,116, 32, 48, 32, 99,100, 98, 46,115,116,
-/* 0x30e0 */  97,114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x30f0 */  32, 32,100, 32, 32, 99,100, 98, 46,101,110,116,114,121, 32, 48,
-/* 0x3100 */  32, 99,100, 98, 46,101,110,116,114,121, 10, 48, 48, 48, 48, 48,
-/* 0x3110 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,100, 98, 46,
-/* 0x3120 */ 115,116, 97,114,116, 46,108,122,109, 97, 32, 48, 32, 99,100, 98,
-/* 0x3130 */  46,115,116, 97,114,116, 46,108,122,109, 97, 10, 48, 48, 48, 48,
-/* 0x3140 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,100, 98,
-/* 0x3150 */  46,101,110,116,114,121, 46,108,122,109, 97, 32, 48, 32, 99,100,
-/* 0x3160 */  98, 46,101,110,116,114,121, 46,108,122,109, 97, 10, 48, 48, 48,
-/* 0x3170 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,100,
-/* 0x3180 */  98, 46,108,122,109, 97, 46, 99,112,114, 32, 48, 32, 99,100, 98,
-/* 0x3190 */  46,108,122,109, 97, 46, 99,112,114, 10, 48, 48, 48, 48, 48, 48,
-/* 0x31a0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,100, 98, 46,100,
-/* 0x31b0 */ 101, 99, 46,112,116,114, 32, 48, 32, 99,100, 98, 46,100,101, 99,
-/* 0x31c0 */  46,112,116,114, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x31d0 */  32, 32, 32,100, 32, 32, 99,100, 98, 46,100,101, 99, 46,112,116,
-/* 0x31e0 */ 114, 46,104,105, 32, 48, 32, 99,100, 98, 46,100,101, 99, 46,112,
-/* 0x31f0 */ 116,114, 46,104,105, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3200 */  32, 32, 32, 32,100, 32, 32, 99,100, 98, 46,101,120,105,116, 32,
-/* 0x3210 */  48, 32, 99,100, 98, 46,101,120,105,116, 10, 48, 48, 48, 48, 48,
-/* 0x3220 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,111,110, 46,
-/* 0x3230 */ 115,116, 97,114,116, 32, 48, 32, 99,111,110, 46,115,116, 97,114,
-/* 0x3240 */ 116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x3250 */ 100, 32, 32, 99,111,110, 46,109, 99,112,121, 32, 48, 32, 99,111,
-/* 0x3260 */ 110, 46,109, 99,112,121, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3270 */ 108, 32, 32, 32, 32,100, 32, 32,108,122,109, 97, 46,112,114,101,
-/* 0x3280 */ 112, 32, 48, 32,108,122,109, 97, 46,112,114,101,112, 10, 48, 48,
-/* 0x3290 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 99,
-/* 0x32a0 */ 111,110, 46,112, 97,100, 99,100, 32, 48, 32, 99,111,110, 46,112,
-/* 0x32b0 */  97,100, 99,100, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x32c0 */  32, 32, 32,100, 32, 32,100,101, 99, 46,112,116,114, 32, 48, 32,
-/* 0x32d0 */ 100,101, 99, 46,112,116,114, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x32e0 */  32,108, 32, 32, 32, 32,100, 32, 32,100,101, 99, 46,112,116,114,
-/* 0x32f0 */  46,104,105, 32, 48, 32,100,101, 99, 46,112,116,114, 46,104,105,
-/* 0x3300 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3310 */  32, 32, 99,111,110, 46,101,110,116,114,121, 32, 48, 32, 99,111,
-/* 0x3320 */ 110, 46,101,110,116,114,121, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3330 */  32,108, 32, 32, 32, 32,100, 32, 32, 99,111,110, 46,101,120,105,
-/* 0x3340 */ 116, 32, 48, 32, 99,111,110, 46,101,120,105,116, 10, 48, 48, 48,
-/* 0x3350 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 98,115,
-/* 0x3360 */ 115, 46, 99,100, 98, 46,115,116, 97,114,116, 46,108,122,109, 97,
-/* 0x3370 */  32, 48, 32, 98,115,115, 46, 99,100, 98, 46,115,116, 97,114,116,
-/* 0x3380 */  46,108,122,109, 97, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x3390 */  32, 32, 32, 32,100, 32, 32, 98,115,115, 46, 99,100, 98, 46,101,
-/* 0x33a0 */ 110,116,114,121, 46,108,122,109, 97, 32, 48, 32, 98,115,115, 46,
-/* 0x33b0 */  99,100, 98, 46,101,110,116,114,121, 46,108,122,109, 97, 10, 48,
-/* 0x33c0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x33d0 */  98,115,115, 46, 99,111,110, 46,115,116, 97,114,116, 32, 48, 32,
-/* 0x33e0 */  98,115,115, 46, 99,111,110, 46,115,116, 97,114,116, 10, 48, 48,
-/* 0x33f0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 98,
-/* 0x3400 */ 115,115, 46,101,120,105,116, 32, 48, 32, 98,115,115, 46,101,120,
-/* 0x3410 */ 105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x3420 */  32,100, 32, 32,109,101,109,115,101,116, 46,115,104,111,114,116,
-/* 0x3430 */  32, 48, 32,109,101,109,115,101,116, 46,115,104,111,114,116, 10,
-/* 0x3440 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x3450 */  32,109,101,109,115,101,116, 46,108,111,110,103, 32, 48, 32,109,
-/* 0x3460 */ 101,109,115,101,116, 46,108,111,110,103, 10, 48, 48, 48, 48, 48,
-/* 0x3470 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,
-/* 0x3480 */  98, 46, 56, 98,105,116, 32, 48, 32,110,114,118, 50, 98, 46, 56,
-/* 0x3490 */  98,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x34a0 */  32, 32,100, 32, 32,110,114,118, 50,100, 46, 56, 98,105,116, 32,
-/* 0x34b0 */  48, 32,110,114,118, 50,100, 46, 56, 98,105,116, 10, 48, 48, 48,
-/* 0x34c0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,
-/* 0x34d0 */ 118, 50,101, 46, 56, 98,105,116, 32, 48, 32,110,114,118, 50,101,
-/* 0x34e0 */  46, 56, 98,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x34f0 */  32, 32, 32, 32,100, 32, 32,110,114,118, 50, 98, 46, 51, 50, 98,
-/* 0x3500 */ 105,116, 32, 48, 32,110,114,118, 50, 98, 46, 51, 50, 98,105,116,
-/* 0x3510 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x3520 */  32, 32,110,114,118, 50,100, 46, 51, 50, 98,105,116, 32, 48, 32,
-/* 0x3530 */ 110,114,118, 50,100, 46, 51, 50, 98,105,116, 10, 48, 48, 48, 48,
-/* 0x3540 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118,
-/* 0x3550 */  50,101, 46, 51, 50, 98,105,116, 32, 48, 32,110,114,118, 50,101,
-/* 0x3560 */  46, 51, 50, 98,105,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x3570 */ 108, 32, 32, 32, 32,100, 32, 32, 56, 98,105,116, 46,115,117, 98,
-/* 0x3580 */  32, 48, 32, 56, 98,105,116, 46,115,117, 98, 10, 48, 48, 48, 48,
-/* 0x3590 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 51, 50, 98,
-/* 0x35a0 */ 105,116, 46,115,117, 98, 32, 48, 32, 51, 50, 98,105,116, 46,115,
-/* 0x35b0 */ 117, 98, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x35c0 */  32,100, 32, 32,110,114,118, 50, 98, 46,115,109, 97,108,108, 32,
-/* 0x35d0 */  48, 32,110,114,118, 50, 98, 46,115,109, 97,108,108, 10, 48, 48,
-/* 0x35e0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,110,
-/* 0x35f0 */ 114,118, 50,100, 46,115,109, 97,108,108, 32, 48, 32,110,114,118,
-/* 0x3600 */  50,100, 46,115,109, 97,108,108, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3610 */  48, 32,108, 32, 32, 32, 32,100, 32, 32,110,114,118, 50,101, 46,
-/* 0x3620 */ 115,109, 97,108,108, 32, 48, 32,110,114,118, 50,101, 46,115,109,
-/* 0x3630 */  97,108,108, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3640 */  32, 32,100, 32, 32,108,122,109, 97, 46,105,110,105,116, 32, 48,
-/* 0x3650 */  32,108,122,109, 97, 46,105,110,105,116, 10, 48, 48, 48, 48, 48,
-/* 0x3660 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65,
-/* 0x3670 */  95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x3680 */  67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x3690 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x36a0 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x36b0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 85, 80,
-/* 0x36c0 */  88, 49, 72, 69, 65, 68, 32, 48, 32, 85, 80, 88, 49, 72, 69, 65,
-/* 0x36d0 */  68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x36e0 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 80, 83, 86, 82, 10,
-/* 0x36f0 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3700 */  32, 42, 85, 78, 68, 42, 32, 48, 32, 67, 80, 68, 79, 10, 48, 48,
-/* 0x3710 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x3720 */  85, 78, 68, 42, 32, 48, 32,108,100,114, 95,115,122, 10, 48, 48,
-/* 0x3730 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x3740 */  85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95, 99,112,114, 10,
-/* 0x3750 */  48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3760 */  32, 42, 85, 78, 68, 42, 32, 48, 32, 68, 69, 67, 79, 10, 48, 48,
-/* 0x3770 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x3780 */  85, 78, 68, 42, 32, 48, 32,101,110,116,114,121, 10, 48, 48, 48,
-/* 0x3790 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x37a0 */  78, 68, 42, 32, 48, 32, 68, 67, 82, 84, 10, 48, 48, 48, 48, 48,
-/* 0x37b0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68,
-/* 0x37c0 */  42, 32, 48, 32,108,122,109, 97, 95,105,110,105,116, 95,111,102,
-/* 0x37d0 */ 102, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x37e0 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 80, 65, 68, 10, 48,
-/* 0x37f0 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3800 */  42, 85, 78, 68, 42, 32, 48, 32,119,114,107,109,101,109, 10, 48,
-/* 0x3810 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3820 */  42, 85, 78, 68, 42, 32, 48, 32, 83, 67, 10, 48, 48, 48, 48, 48,
-/* 0x3830 */  48, 49, 52, 32,103, 32, 32, 32, 32, 32, 79, 32, 56, 98,105,116,
-/* 0x3840 */  46,115,117, 98, 32, 48, 32,103, 98, 56, 95,101, 10, 48, 48, 48,
-/* 0x3850 */  48, 48, 48, 49, 99, 32,103, 32, 32, 32, 32, 32, 79, 32, 51, 50,
-/* 0x3860 */  98,105,116, 46,115,117, 98, 32, 48, 32,103, 98, 51, 50, 95,101,
-/* 0x3870 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3880 */  32, 32, 42, 85, 78, 68, 42, 32, 48, 32,103, 98, 95,101, 10, 48,
-/* 0x3890 */  48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x38a0 */  42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,115,116, 97,
-/* 0x38b0 */  99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48, 48, 48,
-/* 0x38c0 */  48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42,
-/* 0x38d0 */  32, 48, 32,108,122,109, 97, 95, 99, 95,108,101,110, 10, 48, 48,
-/* 0x38e0 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x38f0 */  85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,117, 95,108,101,
-/* 0x3900 */ 110, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32,
-/* 0x3910 */  32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,108,122,109, 97, 95,
-/* 0x3920 */ 112,114,111,112,101,114,116,105,101,115, 10, 10, 82, 69, 76, 79,
-/* 0x3930 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x3940 */  79, 82, 32, 91, 99,100, 98, 46,115,116, 97,114,116, 93, 58, 10,
-/* 0x3950 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x3960 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x3970 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83,
-/* 0x3980 */  95, 72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32, 80, 83, 86, 82,
-/* 0x3990 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 77, 73, 80, 83,
-/* 0x39a0 */  95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 80, 83, 86, 82,
-/* 0x39b0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x39c0 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,100, 98, 46,101,110,
-/* 0x39d0 */ 116,114,121, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x39e0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x39f0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 49, 52, 32,
-/* 0x3a00 */  82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32, 32,
-/* 0x3a10 */  32, 32, 67, 80, 68, 79, 10, 48, 48, 48, 48, 48, 48, 49, 56, 32,
-/* 0x3a20 */  82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32,
-/* 0x3a30 */  32, 32, 67, 80, 68, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x3a40 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x3a50 */  99,100, 98, 46,115,116, 97,114,116, 46,108,122,109, 97, 93, 58,
-/* 0x3a60 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x3a70 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x3a80 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80,
-/* 0x3a90 */  83, 95, 72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32, 80, 83, 86,
-/* 0x3aa0 */  82, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 77, 73, 80,
-/* 0x3ab0 */  83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 80, 83, 86,
-/* 0x3ac0 */  82, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95, 77, 73, 80,
-/* 0x3ad0 */  83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,100,114,
-/* 0x3ae0 */  95,115,122, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x3af0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,100, 98,
-/* 0x3b00 */  46,101,110,116,114,121, 46,108,122,109, 97, 93, 58, 10, 79, 70,
-/* 0x3b10 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x3b20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x3b30 */  48, 48, 48, 48, 48, 49, 56, 32, 82, 95, 77, 73, 80, 83, 95, 76,
-/* 0x3b40 */  79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99,
-/* 0x3b50 */ 112,114, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x3b60 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,100, 98, 46,
-/* 0x3b70 */ 108,122,109, 97, 46, 99,112,114, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x3b80 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3b90 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x3ba0 */  48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54,
-/* 0x3bb0 */  32, 32, 32, 32, 32, 32, 32, 67, 80, 68, 79, 10, 48, 48, 48, 48,
-/* 0x3bc0 */  48, 48, 48, 52, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54,
-/* 0x3bd0 */  32, 32, 32, 32, 32, 32, 32, 67, 80, 68, 79, 10, 10, 82, 69, 76,
-/* 0x3be0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x3bf0 */  70, 79, 82, 32, 91, 99,100, 98, 46,100,101, 99, 46,112,116,114,
-/* 0x3c00 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3c10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3c20 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77,
-/* 0x3c30 */  73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68,
-/* 0x3c40 */  69, 67, 79, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 77,
-/* 0x3c50 */  73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68,
-/* 0x3c60 */  69, 67, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x3c70 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,100, 98,
-/* 0x3c80 */  46,100,101, 99, 46,112,116,114, 46,104,105, 93, 58, 10, 79, 70,
-/* 0x3c90 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x3ca0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x3cb0 */  48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 72,
-/* 0x3cc0 */  73, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68, 69, 67, 79, 10, 10,
-/* 0x3cd0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x3ce0 */  68, 83, 32, 70, 79, 82, 32, 91, 99,100, 98, 46,101,120,105,116,
-/* 0x3cf0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x3d00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x3d10 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 50, 48, 32, 82, 95, 77,
-/* 0x3d20 */  73, 80, 83, 95, 50, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32,101,
-/* 0x3d30 */ 110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x3d40 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,111,
-/* 0x3d50 */ 110, 46,115,116, 97,114,116, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x3d60 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3d70 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x3d80 */  48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32,
-/* 0x3d90 */  32, 32, 32, 32, 32, 32,108,100,114, 95,115,122, 10, 48, 48, 48,
-/* 0x3da0 */  48, 48, 48, 50, 56, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49,
-/* 0x3db0 */  54, 32, 32, 32, 32, 32, 32, 32, 68, 67, 82, 84, 10, 48, 48, 48,
-/* 0x3dc0 */  48, 48, 48, 50, 99, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49,
-/* 0x3dd0 */  54, 32, 32, 32, 32, 32, 32, 32, 68, 67, 82, 84, 10, 10, 82, 69,
-/* 0x3de0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x3df0 */  32, 70, 79, 82, 32, 91, 99,111,110, 46,109, 99,112,121, 93, 58,
-/* 0x3e00 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x3e10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x3e20 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80,
-/* 0x3e30 */  83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,100,114,
-/* 0x3e40 */  95,115,122, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x3e50 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,108,122,109,
-/* 0x3e60 */  97, 46,112,114,101,112, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x3e70 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3e80 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x3e90 */  48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32,
-/* 0x3ea0 */  32, 32, 32, 32, 32,108,122,109, 97, 95,105,110,105,116, 95,111,
-/* 0x3eb0 */ 102,102, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x3ec0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,111,110, 46,
-/* 0x3ed0 */ 112, 97,100, 99,100, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x3ee0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3ef0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x3f00 */  48, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32,
-/* 0x3f10 */  32, 32, 32, 32, 80, 65, 68, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x3f20 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x3f30 */  91,100,101, 99, 46,112,116,114, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x3f40 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x3f50 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x3f60 */  48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54,
-/* 0x3f70 */  32, 32, 32, 32, 32, 32, 32, 68, 69, 67, 79, 10, 48, 48, 48, 48,
-/* 0x3f80 */  48, 48, 48, 56, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54,
-/* 0x3f90 */  32, 32, 32, 32, 32, 32, 32, 68, 69, 67, 79, 10, 10, 82, 69, 76,
-/* 0x3fa0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x3fb0 */  70, 79, 82, 32, 91,100,101, 99, 46,112,116,114, 46,104,105, 93,
-/* 0x3fc0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x3fd0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x3fe0 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 77, 73,
-/* 0x3ff0 */  80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32, 68, 69,
-/* 0x4000 */  67, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x4010 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 99,111,110, 46,
-/* 0x4020 */ 101,120,105,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x4030 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4040 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 50, 52,
-/* 0x4050 */  32, 82, 95, 77, 73, 80, 83, 95, 50, 54, 32, 32, 32, 32, 32, 32,
-/* 0x4060 */  32, 32, 32,101,110,116,114,121, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4070 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4080 */  32, 91, 98,115,115, 46, 99,100, 98, 46,115,116, 97,114,116, 46,
-/* 0x4090 */ 108,122,109, 97, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x40a0 */  84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x40b0 */  32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x40c0 */  32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32,
-/* 0x40d0 */  32, 32, 32, 80, 83, 86, 82, 10, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x40e0 */  32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32,
-/* 0x40f0 */  32, 32, 32, 80, 83, 86, 82, 10, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x4100 */  32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32,
-/* 0x4110 */  32, 32, 32,119,114,107,109,101,109, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4120 */  49, 48, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32,
-/* 0x4130 */  32, 32, 32, 32, 32,119,114,107,109,101,109, 10, 10, 82, 69, 76,
-/* 0x4140 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x4150 */  70, 79, 82, 32, 91, 98,115,115, 46, 99,100, 98, 46,101,110,116,
-/* 0x4160 */ 114,121, 46,108,122,109, 97, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x4170 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4180 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x4190 */  48, 49, 99, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32,
-/* 0x41a0 */  32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99,112,114, 10, 10,
-/* 0x41b0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x41c0 */  68, 83, 32, 70, 79, 82, 32, 91, 98,115,115, 46, 99,111,110, 46,
-/* 0x41d0 */ 115,116, 97,114,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x41e0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x41f0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x4200 */  48, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32,
-/* 0x4210 */  32, 32, 32, 32,119,114,107,109,101,109, 10, 48, 48, 48, 48, 48,
-/* 0x4220 */  48, 48, 52, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32,
-/* 0x4230 */  32, 32, 32, 32, 32, 32,119,114,107,109,101,109, 10, 48, 48, 48,
-/* 0x4240 */  48, 48, 48, 51, 48, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49,
-/* 0x4250 */  54, 32, 32, 32, 32, 32, 32, 32, 68, 67, 82, 84, 10, 48, 48, 48,
-/* 0x4260 */  48, 48, 48, 51, 52, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49,
-/* 0x4270 */  54, 32, 32, 32, 32, 32, 32, 32, 68, 67, 82, 84, 10, 10, 82, 69,
-/* 0x4280 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4290 */  32, 70, 79, 82, 32, 91, 98,115,115, 46,101,120,105,116, 93, 58,
-/* 0x42a0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x42b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x42c0 */  69, 10, 48, 48, 48, 48, 48, 48, 50, 52, 32, 82, 95, 77, 73, 80,
-/* 0x42d0 */  83, 95, 50, 54, 32, 32, 32, 32, 32, 32, 32, 32, 32,101,110,116,
-/* 0x42e0 */ 114,121, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x42f0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,109,101,109,115,
-/* 0x4300 */ 101,116, 46,115,104,111,114,116, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x4310 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4320 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x4330 */  48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54,
-/* 0x4340 */  32, 32, 32, 32, 32, 32, 32, 83, 67, 10, 10, 82, 69, 76, 79, 67,
-/* 0x4350 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x4360 */  82, 32, 91,109,101,109,115,101,116, 46,108,111,110,103, 93, 58,
-/* 0x4370 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4380 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4390 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80,
-/* 0x43a0 */  83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32, 83, 67, 10,
-/* 0x43b0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x43c0 */  82, 68, 83, 32, 70, 79, 82, 32, 91,110,114,118, 50, 98, 46, 56,
-/* 0x43d0 */  98,105,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x43e0 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x43f0 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 99, 52, 32,
-/* 0x4400 */  82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32,
-/* 0x4410 */  32, 32,110,114,118, 46,100,111,110,101, 10, 10, 82, 69, 76, 79,
-/* 0x4420 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x4430 */  79, 82, 32, 91,110,114,118, 50,100, 46, 56, 98,105,116, 93, 58,
-/* 0x4440 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x4450 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x4460 */  69, 10, 48, 48, 48, 48, 48, 49, 49, 99, 32, 82, 95, 77, 73, 80,
-/* 0x4470 */  83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,110,114,118,
-/* 0x4480 */  46,100,111,110,101, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x4490 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,110,
-/* 0x44a0 */ 114,118, 50,101, 46, 56, 98,105,116, 93, 58, 10, 79, 70, 70, 83,
-/* 0x44b0 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x44c0 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x44d0 */  48, 48, 49, 49, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x44e0 */  54, 32, 32, 32, 32, 32, 32, 32,110,114,118, 46,100,111,110,101,
-/* 0x44f0 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4500 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91,110,114,118, 50, 98, 46,
-/* 0x4510 */  51, 50, 98,105,116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x4520 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4530 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 99,
-/* 0x4540 */  52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4550 */  32, 32, 32, 32,110,114,118, 46,100,111,110,101, 10, 10, 82, 69,
-/* 0x4560 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4570 */  32, 70, 79, 82, 32, 91,110,114,118, 50,100, 46, 51, 50, 98,105,
-/* 0x4580 */ 116, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x4590 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x45a0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 49, 49, 99, 32, 82, 95,
-/* 0x45b0 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x45c0 */ 110,114,118, 46,100,111,110,101, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x45d0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x45e0 */  32, 91,110,114,118, 50,101, 46, 51, 50, 98,105,116, 93, 58, 10,
-/* 0x45f0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x4600 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x4610 */  10, 48, 48, 48, 48, 48, 49, 49, 99, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4620 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,110,114,118, 46,
-/* 0x4630 */ 100,111,110,101, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x4640 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,110,114,
-/* 0x4650 */ 118, 50, 98, 46,115,109, 97,108,108, 93, 58, 10, 79, 70, 70, 83,
-/* 0x4660 */  69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4670 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x4680 */  48, 48, 48, 48, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x4690 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x46a0 */  48, 48, 48, 50, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x46b0 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x46c0 */  48, 48, 48, 51, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x46d0 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x46e0 */  48, 48, 48, 54, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x46f0 */  54, 32, 32, 32, 32, 32, 32, 32,110,114,118, 46,100,111,110,101,
-/* 0x4700 */  10, 48, 48, 48, 48, 48, 48, 54, 99, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4710 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101,
-/* 0x4720 */  10, 48, 48, 48, 48, 48, 48, 55, 56, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4730 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101,
-/* 0x4740 */  10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4750 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101,
-/* 0x4760 */  10, 48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95, 77, 73, 80, 83,
-/* 0x4770 */  95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101,
-/* 0x4780 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x4790 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91,110,114,118, 50,100, 46,
-/* 0x47a0 */ 115,109, 97,108,108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x47b0 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x47c0 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x47d0 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x47e0 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 50,
-/* 0x47f0 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4800 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 51,
-/* 0x4810 */  52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4820 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 52,
-/* 0x4830 */  52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4840 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 53,
-/* 0x4850 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4860 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 55,
-/* 0x4870 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4880 */  32, 32, 32, 32,110,114,118, 46,100,111,110,101, 10, 48, 48, 48,
-/* 0x4890 */  48, 48, 48, 57, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x48a0 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x48b0 */  48, 48, 48, 97, 99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x48c0 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48,
-/* 0x48d0 */  48, 48, 48, 98, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49,
-/* 0x48e0 */  54, 32, 32, 32, 32, 32, 32, 32,103, 98, 95,101, 10, 10, 82, 69,
-/* 0x48f0 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x4900 */  32, 70, 79, 82, 32, 91,110,114,118, 50,101, 46,115,109, 97,108,
-/* 0x4910 */ 108, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x4920 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x4930 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 99, 32, 82, 95,
-/* 0x4940 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4950 */ 103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 50, 99, 32, 82, 95,
-/* 0x4960 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4970 */ 103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 51, 52, 32, 82, 95,
-/* 0x4980 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x4990 */ 103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 52, 52, 32, 82, 95,
-/* 0x49a0 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49b0 */ 103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 53, 99, 32, 82, 95,
-/* 0x49c0 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49d0 */ 103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 55, 99, 32, 82, 95,
-/* 0x49e0 */  77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32, 32, 32, 32, 32,
-/* 0x49f0 */ 110,114,118, 46,100,111,110,101, 10, 48, 48, 48, 48, 48, 48, 57,
-/* 0x4a00 */  52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4a10 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 97,
-/* 0x4a20 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4a30 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 98,
-/* 0x4a40 */  99, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4a50 */  32, 32, 32, 32,103, 98, 95,101, 10, 48, 48, 48, 48, 48, 48, 99,
-/* 0x4a60 */  52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32, 32,
-/* 0x4a70 */  32, 32, 32, 32,103, 98, 95,101, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x4a80 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x4a90 */  32, 91,108,122,109, 97, 46,105,110,105,116, 93, 58, 10, 79, 70,
-/* 0x4aa0 */  70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x4ab0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x4ac0 */  48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 77, 73, 80, 83, 95, 76,
-/* 0x4ad0 */  79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,115,
-/* 0x4ae0 */ 116, 97, 99,107, 95, 97,100,106,117,115,116, 10, 48, 48, 48, 48,
-/* 0x4af0 */  48, 48, 48, 99, 32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54,
-/* 0x4b00 */  32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95, 99, 95,108,101,
-/* 0x4b10 */ 110, 10, 48, 48, 48, 48, 48, 48, 49, 48, 32, 82, 95, 77, 73, 80,
-/* 0x4b20 */  83, 95, 76, 79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,109,
-/* 0x4b30 */  97, 95, 99, 95,108,101,110, 10, 48, 48, 48, 48, 48, 48, 49, 52,
-/* 0x4b40 */  32, 82, 95, 77, 73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32,
-/* 0x4b50 */  32, 32, 32,108,122,109, 97, 95,117, 95,108,101,110, 10, 48, 48,
-/* 0x4b60 */  48, 48, 48, 48, 49, 56, 32, 82, 95, 77, 73, 80, 83, 95, 76, 79,
-/* 0x4b70 */  49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,117, 95,
-/* 0x4b80 */ 108,101,110, 10, 48, 48, 48, 48, 48, 48, 50, 52, 32, 82, 95, 77,
-/* 0x4b90 */  73, 80, 83, 95, 72, 73, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,
-/* 0x4ba0 */ 122,109, 97, 95,112,114,111,112,101,114,116,105,101,115, 10, 48,
-/* 0x4bb0 */  48, 48, 48, 48, 48, 50, 56, 32, 82, 95, 77, 73, 80, 83, 95, 76,
-/* 0x4bc0 */  79, 49, 54, 32, 32, 32, 32, 32, 32, 32,108,122,109, 97, 95,112,
-/* 0x4bd0 */ 114,111,112,101,114,116,105,101,115, 10, 48, 48, 48, 48, 48, 48,
-/* 0x4be0 */  51, 52, 32, 82, 95, 77, 73, 80, 83, 95, 80, 67, 49, 54, 32, 32,
-/* 0x4bf0 */  32, 32, 32, 32, 32,100,101, 99,111,109,112,114,101,115,115,111,
-/* 0x4c00 */ 114, 46,115,116, 97,114,116, 10, 48, 48, 48, 48, 48, 48, 52, 52,
-/* 0x4c10 */  32, 82, 95, 77, 73, 80, 83, 95, 76, 79, 49, 54, 32, 32, 32, 32,
-/* 0x4c20 */  32, 32, 32,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,
-/* 0x4c30 */ 106,117,115,116, 10
+/* 0x2830 */   0,  0,  0,  0,  0,  0,  0, 45, 39,  0,  0,  0, 57,  0,  0,  0,
+/* 0x2840 */  78,  0,  0,  0,133,  2,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x2850 */  20,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 72,  0,  0,  0,
+/* 0x2860 */  28,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,100,  0,  0,  0,
+/* 0x2870 */  24,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,124,  0,  0,  0,
+/* 0x2880 */  32,  0,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,156,  0,  0,  0,
+/* 0x2890 */   8,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,164,  0,  0,  0,
+/* 0x28a0 */   8,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,172,  0,  0,  0,
+/* 0x28b0 */   4,  0,  0,  0,  0,  0,  0,  0, 90,  0,  0,  0,176,  0,  0,  0,
+/* 0x28c0 */  40,  0,  0,  0,  0,  0,  0,  0, 99,  0,  0,  0,216,  0,  0,  0,
+/* 0x28d0 */  48,  0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,  8,  1,  0,  0,
+/* 0x28e0 */  28,  0,  0,  0,  0,  0,  0,  0,118,  0,  0,  0, 36,  1,  0,  0,
+/* 0x28f0 */   4,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0, 40,  1,  0,  0,
+/* 0x2900 */   4,  0,  0,  0,  0,  0,  0,  0,138,  0,  0,  0, 44,  1,  0,  0,
+/* 0x2910 */  12,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,  0, 56,  1,  0,  0,
+/* 0x2920 */   8,  0,  0,  0,  0,  0,  0,  0,157,  0,  0,  0, 64,  1,  0,  0,
+/* 0x2930 */   0,  0,  0,  0,  0,  0,  0,  0,167,  0,  0,  0, 64,  1,  0,  0,
+/* 0x2940 */  44,  0,  0,  0,  0,  0,  0,  0,176,  0,  0,  0,108,  1,  0,  0,
+/* 0x2950 */  28,  0,  0,  0,  0,  0,  0,  0,195,  0,  0,  0,136,  1,  0,  0,
+/* 0x2960 */  36,  0,  0,  0,  0,  0,  0,  0,214,  0,  0,  0,172,  1,  0,  0,
+/* 0x2970 */  56,  0,  0,  0,  0,  0,  0,  0,228,  0,  0,  0,228,  1,  0,  0,
+/* 0x2980 */  44,  0,  0,  0,  0,  0,  0,  0,237,  0,  0,  0, 16,  2,  0,  0,
+/* 0x2990 */  20,  0,  0,  0,  0,  0,  0,  0,250,  0,  0,  0, 36,  2,  0,  0,
+/* 0x29a0 */  24,  0,  0,  0,  0,  0,  0,  0,  6,  1,  0,  0, 60,  2,  0,  0,
+/* 0x29b0 */ 236,  1,  0,  0,  0,  0,  0,  0, 17,  1,  0,  0, 40,  4,  0,  0,
+/* 0x29c0 */  40,  2,  0,  0,  0,  0,  0,  0, 28,  1,  0,  0, 80,  6,  0,  0,
+/* 0x29d0 */  80,  2,  0,  0,  0,  0,  0,  0, 39,  1,  0,  0,160,  8,  0,  0,
+/* 0x29e0 */ 236,  1,  0,  0,  0,  0,  0,  0, 51,  1,  0,  0,140, 10,  0,  0,
+/* 0x29f0 */  40,  2,  0,  0,  0,  0,  0,  0, 63,  1,  0,  0,180, 12,  0,  0,
+/* 0x2a00 */  80,  2,  0,  0,  0,  0,  0,  0, 75,  1,  0,  0,  4, 15,  0,  0,
+/* 0x2a10 */  36,  0,  0,  0,  0,  0,  0,  0, 84,  1,  0,  0, 40, 15,  0,  0,
+/* 0x2a20 */  44,  0,  0,  0,  0,  0,  0,  0, 94,  1,  0,  0, 84, 15,  0,  0,
+/* 0x2a30 */ 212,  0,  0,  0,  0,  0,  0,  0,106,  1,  0,  0, 40, 16,  0,  0,
+/* 0x2a40 */ 240,  0,  0,  0,  0,  0,  0,  0,118,  1,  0,  0, 24, 17,  0,  0,
+/* 0x2a50 */   0,  1,  0,  0,  0,  0,  0,  0,130,  1,  0,  0, 24, 18,  0,  0,
+/* 0x2a60 */   0,  0,  0,  0,  0,  0,  0,  0,139,  1,  0,  0, 24, 18,  0,  0,
+/* 0x2a70 */   0,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0, 24, 18,  0,  0,
+/* 0x2a80 */  80,  0,  0,  0,  0,  0,  0,  0,168,  1,  0,  0,104, 18,  0,  0,
+/* 0x2a90 */ 216, 10,  0,  0,  0,  0,  0,  0,179,  1,  0,  0, 64, 29,  0,  0,
+/* 0x2aa0 */ 216, 10,  0,  0,  0,  0,  0,  0,190,  1,  0,  0, 24, 40,  0,  0,
+/* 0x2ab0 */  32,  0,  0,  0,  0,  0,  0,  0,130,  1,  0,  0, 33,  0,  0,  0,
+/* 0x2ac0 */   0,  0,  0,  0,139,  1,  0,  0, 34,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2ad0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x2ae0 */   1,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2af0 */   0,  0,  0,  0, 35,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b00 */  50,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x2b10 */   5,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,  6,  0,  0,  0,
+/* 0x2b20 */   0,  0,  0,  0, 90,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b30 */  99,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,109,  0,  0,  0,
+/* 0x2b40 */   9,  0,  0,  0,  0,  0,  0,  0,118,  0,  0,  0, 10,  0,  0,  0,
+/* 0x2b50 */   0,  0,  0,  0,128,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b60 */ 138,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,146,  0,  0,  0,
+/* 0x2b70 */  13,  0,  0,  0,  0,  0,  0,  0,157,  0,  0,  0, 14,  0,  0,  0,
+/* 0x2b80 */   0,  0,  0,  0,167,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2b90 */ 176,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,195,  0,  0,  0,
+/* 0x2ba0 */  17,  0,  0,  0,  0,  0,  0,  0,214,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2bb0 */   0,  0,  0,  0,228,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bc0 */ 237,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,250,  0,  0,  0,
+/* 0x2bd0 */  21,  0,  0,  0,  0,  0,  0,  0,  6,  1,  0,  0, 22,  0,  0,  0,
+/* 0x2be0 */   0,  0,  0,  0, 17,  1,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2bf0 */  28,  1,  0,  0, 24,  0,  0,  0,  0,  0,  0,  0, 39,  1,  0,  0,
+/* 0x2c00 */  25,  0,  0,  0,  0,  0,  0,  0, 51,  1,  0,  0, 26,  0,  0,  0,
+/* 0x2c10 */   0,  0,  0,  0, 63,  1,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c20 */  75,  1,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 84,  1,  0,  0,
+/* 0x2c30 */  29,  0,  0,  0,  0,  0,  0,  0, 94,  1,  0,  0, 30,  0,  0,  0,
+/* 0x2c40 */   0,  0,  0,  0,106,  1,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c50 */ 118,  1,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,158,  1,  0,  0,
+/* 0x2c60 */  35,  0,  0,  0,  0,  0,  0,  0,168,  1,  0,  0, 36,  0,  0,  0,
+/* 0x2c70 */   0,  0,  0,  0,179,  1,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2c80 */ 190,  1,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0,199,  1,  0,  0,
+/* 0x2c90 */  40,  0,  0,  0,173,222,173,222,204,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2ca0 */ 173,222,173,222,209,  1,  0,  0, 40,  0,  0,  0,173,222,173,222,
+/* 0x2cb0 */ 216,  1,  0,  0, 40,  0,  0,  0,173,222,173,222,225,  1,  0,  0,
+/* 0x2cc0 */  40,  0,  0,  0,173,222,173,222,230,  1,  0,  0, 40,  0,  0,  0,
+/* 0x2cd0 */ 173,222,173,222,236,  1,  0,  0, 40,  0,  0,  0,173,222,173,222,
+/* 0x2ce0 */ 241,  1,  0,  0, 40,  0,  0,  0,173,222,173,222,255,  1,  0,  0,
+/* 0x2cf0 */  40,  0,  0,  0,173,222,173,222,  3,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2d00 */ 173,222,173,222, 10,  2,  0,  0, 40,  0,  0,  0,173,222,173,222,
+/* 0x2d10 */  13,  2,  0,  0, 28,  0,  0,  0, 20,  0,  0,  0, 19,  2,  0,  0,
+/* 0x2d20 */  29,  0,  0,  0, 28,  0,  0,  0, 26,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2d30 */ 173,222,173,222, 31,  2,  0,  0, 40,  0,  0,  0,173,222,173,222,
+/* 0x2d40 */  49,  2,  0,  0, 40,  0,  0,  0,173,222,173,222, 60,  2,  0,  0,
+/* 0x2d50 */  40,  0,  0,  0,173,222,173,222, 71,  2,  0,  0, 40,  0,  0,  0,
+/* 0x2d60 */ 173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0, 87,  2,  0,  0,
+/* 0x2d70 */ 199,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2d80 */   4,  0,  0,  0, 99,  2,  0,  0,199,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2d90 */   0,  0,  0,  0,  1,  0,  0,  0, 20,  0,  0,  0, 87,  2,  0,  0,
+/* 0x2da0 */ 204,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x2db0 */  24,  0,  0,  0, 99,  2,  0,  0,204,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2dc0 */   0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 87,  2,  0,  0,
+/* 0x2dd0 */ 199,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x2de0 */   4,  0,  0,  0, 99,  2,  0,  0,199,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2df0 */   0,  0,  0,  0,  2,  0,  0,  0, 12,  0,  0,  0, 99,  2,  0,  0,
+/* 0x2e00 */ 209,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2e10 */  24,  0,  0,  0, 99,  2,  0,  0,216,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2e20 */   0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 87,  2,  0,  0,
+/* 0x2e30 */ 204,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2e40 */   4,  0,  0,  0, 99,  2,  0,  0,204,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2e50 */   0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 87,  2,  0,  0,
+/* 0x2e60 */ 225,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2e70 */   4,  0,  0,  0, 99,  2,  0,  0,225,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2e80 */   0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 87,  2,  0,  0,
+/* 0x2e90 */ 225,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,
+/* 0x2ea0 */  32,  0,  0,  0,111,  2,  0,  0,230,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2eb0 */   0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 99,  2,  0,  0,
+/* 0x2ec0 */ 209,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2ed0 */  40,  0,  0,  0, 87,  2,  0,  0,236,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2ee0 */   0,  0,  0,  0,  8,  0,  0,  0, 44,  0,  0,  0, 99,  2,  0,  0,
+/* 0x2ef0 */ 236,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x2f00 */   0,  0,  0,  0, 99,  2,  0,  0,209,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2f10 */   0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 99,  2,  0,  0,
+/* 0x2f20 */ 241,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2f30 */   0,  0,  0,  0, 99,  2,  0,  0,255,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2f40 */   0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0, 87,  2,  0,  0,
+/* 0x2f50 */ 225,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x2f60 */   8,  0,  0,  0, 99,  2,  0,  0,225,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2f70 */   0,  0,  0,  0, 13,  0,  0,  0,  4,  0,  0,  0, 87,  2,  0,  0,
+/* 0x2f80 */ 225,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2f90 */  36,  0,  0,  0,111,  2,  0,  0,230,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2fa0 */   0,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0, 87,  2,  0,  0,
+/* 0x2fb0 */ 199,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,
+/* 0x2fc0 */   4,  0,  0,  0, 99,  2,  0,  0,199,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2fd0 */   0,  0,  0,  0, 16,  0,  0,  0, 12,  0,  0,  0, 87,  2,  0,  0,
+/* 0x2fe0 */   3,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,
+/* 0x2ff0 */  16,  0,  0,  0, 99,  2,  0,  0,  3,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3000 */   0,  0,  0,  0, 17,  0,  0,  0, 28,  0,  0,  0, 99,  2,  0,  0,
+/* 0x3010 */ 216,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x3020 */   0,  0,  0,  0, 87,  2,  0,  0,  3,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3030 */   0,  0,  0,  0, 18,  0,  0,  0,  4,  0,  0,  0, 99,  2,  0,  0,
+/* 0x3040 */   3,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x3050 */  48,  0,  0,  0, 87,  2,  0,  0,236,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3060 */   0,  0,  0,  0, 18,  0,  0,  0, 52,  0,  0,  0, 99,  2,  0,  0,
+/* 0x3070 */ 236,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,
+/* 0x3080 */  36,  0,  0,  0,111,  2,  0,  0,230,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3090 */   0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0, 99,  2,  0,  0,
+/* 0x30a0 */  10,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,
+/* 0x30b0 */   0,  0,  0,  0, 99,  2,  0,  0, 10,  2,  0,  0,  0,  0,  0,  0,
+/* 0x30c0 */   0,  0,  0,  0, 22,  0,  0,  0,196,  0,  0,  0,121,  2,  0,  0,
+/* 0x30d0 */ 130,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,
+/* 0x30e0 */  28,  1,  0,  0,121,  2,  0,  0,130,  1,  0,  0,  0,  0,  0,  0,
+/* 0x30f0 */   0,  0,  0,  0, 24,  0,  0,  0, 28,  1,  0,  0,121,  2,  0,  0,
+/* 0x3100 */ 130,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,
+/* 0x3110 */ 196,  0,  0,  0,121,  2,  0,  0,130,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3120 */   0,  0,  0,  0, 26,  0,  0,  0, 28,  1,  0,  0,121,  2,  0,  0,
+/* 0x3130 */ 130,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x3140 */  28,  1,  0,  0,121,  2,  0,  0,130,  1,  0,  0,  0,  0,  0,  0,
+/* 0x3150 */   0,  0,  0,  0, 30,  0,  0,  0, 12,  0,  0,  0,121,  2,  0,  0,
+/* 0x3160 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x3170 */  44,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3180 */   0,  0,  0,  0, 30,  0,  0,  0, 52,  0,  0,  0,121,  2,  0,  0,
+/* 0x3190 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x31a0 */ 100,  0,  0,  0,121,  2,  0,  0,130,  1,  0,  0,  0,  0,  0,  0,
+/* 0x31b0 */   0,  0,  0,  0, 30,  0,  0,  0,108,  0,  0,  0,121,  2,  0,  0,
+/* 0x31c0 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x31d0 */ 120,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x31e0 */   0,  0,  0,  0, 30,  0,  0,  0,144,  0,  0,  0,121,  2,  0,  0,
+/* 0x31f0 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x3200 */ 152,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3210 */   0,  0,  0,  0, 31,  0,  0,  0, 12,  0,  0,  0,121,  2,  0,  0,
+/* 0x3220 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,
+/* 0x3230 */  44,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3240 */   0,  0,  0,  0, 31,  0,  0,  0, 52,  0,  0,  0,121,  2,  0,  0,
+/* 0x3250 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,
+/* 0x3260 */  68,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3270 */   0,  0,  0,  0, 31,  0,  0,  0, 92,  0,  0,  0,121,  2,  0,  0,
+/* 0x3280 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,
+/* 0x3290 */ 124,  0,  0,  0,121,  2,  0,  0,130,  1,  0,  0,  0,  0,  0,  0,
+/* 0x32a0 */   0,  0,  0,  0, 31,  0,  0,  0,148,  0,  0,  0,121,  2,  0,  0,
+/* 0x32b0 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,
+/* 0x32c0 */ 172,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x32d0 */   0,  0,  0,  0, 31,  0,  0,  0,180,  0,  0,  0,121,  2,  0,  0,
+/* 0x32e0 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,
+/* 0x32f0 */  12,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3300 */   0,  0,  0,  0, 32,  0,  0,  0, 44,  0,  0,  0,121,  2,  0,  0,
+/* 0x3310 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,
+/* 0x3320 */  52,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3330 */   0,  0,  0,  0, 32,  0,  0,  0, 68,  0,  0,  0,121,  2,  0,  0,
+/* 0x3340 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,
+/* 0x3350 */  92,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3360 */   0,  0,  0,  0, 32,  0,  0,  0,124,  0,  0,  0,121,  2,  0,  0,
+/* 0x3370 */ 130,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,
+/* 0x3380 */ 148,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3390 */   0,  0,  0,  0, 32,  0,  0,  0,172,  0,  0,  0,121,  2,  0,  0,
+/* 0x33a0 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,
+/* 0x33b0 */ 188,  0,  0,  0,121,  2,  0,  0, 26,  2,  0,  0,  0,  0,  0,  0,
+/* 0x33c0 */   0,  0,  0,  0, 32,  0,  0,  0,196,  0,  0,  0,121,  2,  0,  0,
+/* 0x33d0 */  26,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,
+/* 0x33e0 */   0,  0,  0,  0, 99,  2,  0,  0, 31,  2,  0,  0,  0,  0,  0,  0,
+/* 0x33f0 */   0,  0,  0,  0, 35,  0,  0,  0, 12,  0,  0,  0, 87,  2,  0,  0,
+/* 0x3400 */  49,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,
+/* 0x3410 */  16,  0,  0,  0, 99,  2,  0,  0, 49,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3420 */   0,  0,  0,  0, 35,  0,  0,  0, 20,  0,  0,  0, 87,  2,  0,  0,
+/* 0x3430 */  60,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,
+/* 0x3440 */  24,  0,  0,  0, 99,  2,  0,  0, 60,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3450 */   0,  0,  0,  0, 35,  0,  0,  0, 36,  0,  0,  0, 87,  2,  0,  0,
+/* 0x3460 */  71,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,
+/* 0x3470 */  40,  0,  0,  0, 99,  2,  0,  0, 71,  2,  0,  0,  0,  0,  0,  0,
+/* 0x3480 */   0,  0,  0,  0, 35,  0,  0,  0, 52,  0,  0,  0,121,  2,  0,  0,
+/* 0x3490 */ 139,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,
+/* 0x34a0 */  68,  0,  0,  0, 99,  2,  0,  0, 31,  2,  0,  0,  0,  0,  0,  0,
+/* 0x34b0 */   0,  0,  0,  0, 99,100, 98, 46,115,116, 97,114,116,  0, 99,100,
+/* 0x34c0 */  98, 46,101,110,116,114,121,  0, 99,100, 98, 46,115,116, 97,114,
+/* 0x34d0 */ 116, 46,108,122,109, 97,  0, 99,100, 98, 46,101,110,116,114,121,
+/* 0x34e0 */  46,108,122,109, 97,  0, 99,100, 98, 46,108,122,109, 97, 46, 99,
+/* 0x34f0 */ 112,114,  0, 99,100, 98, 46,100,101, 99, 46,112,116,114,  0, 99,
+/* 0x3500 */ 100, 98, 46,100,101, 99, 46,112,116,114, 46,104,105,  0, 99,100,
+/* 0x3510 */  98, 46,101,120,105,116,  0, 99,111,110, 46,115,116, 97,114,116,
+/* 0x3520 */   0, 99,111,110, 46,109, 99,112,121,  0,108,122,109, 97, 46,112,
+/* 0x3530 */ 114,101,112,  0, 99,111,110, 46,112, 97,100, 99,100,  0,100,101,
+/* 0x3540 */  99, 46,112,116,114,  0,100,101, 99, 46,112,116,114, 46,104,105,
+/* 0x3550 */   0, 99,111,110, 46,101,110,116,114,121,  0, 99,111,110, 46,101,
+/* 0x3560 */ 120,105,116,  0, 98,115,115, 46, 99,100, 98, 46,115,116, 97,114,
+/* 0x3570 */ 116, 46,108,122,109, 97,  0, 98,115,115, 46, 99,100, 98, 46,101,
+/* 0x3580 */ 110,116,114,121, 46,108,122,109, 97,  0, 98,115,115, 46, 99,111,
+/* 0x3590 */ 110, 46,115,116, 97,114,116,  0, 98,115,115, 46,101,120,105,116,
+/* 0x35a0 */   0,109,101,109,115,101,116, 46,115,104,111,114,116,  0,109,101,
+/* 0x35b0 */ 109,115,101,116, 46,108,111,110,103,  0,110,114,118, 50, 98, 46,
+/* 0x35c0 */  56, 98,105,116,  0,110,114,118, 50,100, 46, 56, 98,105,116,  0,
+/* 0x35d0 */ 110,114,118, 50,101, 46, 56, 98,105,116,  0,110,114,118, 50, 98,
+/* 0x35e0 */  46, 51, 50, 98,105,116,  0,110,114,118, 50,100, 46, 51, 50, 98,
+/* 0x35f0 */ 105,116,  0,110,114,118, 50,101, 46, 51, 50, 98,105,116,  0, 56,
+/* 0x3600 */  98,105,116, 46,115,117, 98,  0, 51, 50, 98,105,116, 46,115,117,
+/* 0x3610 */  98,  0,110,114,118, 50, 98, 46,115,109, 97,108,108,  0,110,114,
+/* 0x3620 */ 118, 50,100, 46,115,109, 97,108,108,  0,110,114,118, 50,101, 46,
+/* 0x3630 */ 115,109, 97,108,108,  0,110,114,118, 46,100,111,110,101,  0,100,
+/* 0x3640 */ 101, 99,111,109,112,114,101,115,115,111,114, 46,115,116, 97,114,
+/* 0x3650 */ 116,  0,108,122,109, 97, 46,105,110,105,116,  0, 76, 90, 77, 65,
+/* 0x3660 */  95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50,
+/* 0x3670 */  48,  0, 85, 80, 88, 49, 72, 69, 65, 68,  0, 80, 83, 86, 82,  0,
+/* 0x3680 */  67, 80, 68, 79,  0,108,100,114, 95,115,122,  0,108,122,109, 97,
+/* 0x3690 */  95, 99,112,114,  0, 68, 69, 67, 79,  0,101,110,116,114,121,  0,
+/* 0x36a0 */  68, 67, 82, 84,  0,108,122,109, 97, 95,105,110,105,116, 95,111,
+/* 0x36b0 */ 102,102,  0, 80, 65, 68,  0,119,114,107,109,101,109,  0, 83, 67,
+/* 0x36c0 */   0,103, 98, 56, 95,101,  0,103, 98, 51, 50, 95,101,  0,103, 98,
+/* 0x36d0 */  95,101,  0,108,122,109, 97, 95,115,116, 97, 99,107, 95, 97,100,
+/* 0x36e0 */ 106,117,115,116,  0,108,122,109, 97, 95, 99, 95,108,101,110,  0,
+/* 0x36f0 */ 108,122,109, 97, 95,117, 95,108,101,110,  0,108,122,109, 97, 95,
+/* 0x3700 */ 112,114,111,112,101,114,116,105,101,115,  0, 82, 95, 77, 73, 80,
+/* 0x3710 */  83, 95, 72, 73, 49, 54,  0, 82, 95, 77, 73, 80, 83, 95, 76, 79,
+/* 0x3720 */  49, 54,  0, 82, 95, 77, 73, 80, 83, 95, 50, 54,  0, 82, 95, 77,
+/* 0x3730 */  73, 80, 83, 95, 80, 67, 49, 54,  0, 56, 40,  0,  0, 85, 80, 88,
+/* 0x3740 */  76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* powerpc-darwin.macho-entry.h
-   created from powerpc-darwin.macho-entry.bin, 8280 (0x2058) bytes
+   created from powerpc-darwin.macho-entry.bin, 7025 (0x1b71) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC_DARWIN_MACHO_ENTRY_SIZE    8280
-#define STUB_POWERPC_DARWIN_MACHO_ENTRY_ADLER32 0x11fc94d3
-#define STUB_POWERPC_DARWIN_MACHO_ENTRY_CRC32   0xdb0ea63b
+#define STUB_POWERPC_DARWIN_MACHO_ENTRY_SIZE    7025
+#define STUB_POWERPC_DARWIN_MACHO_ENTRY_ADLER32 0xa9ae25f6
+#define STUB_POWERPC_DARWIN_MACHO_ENTRY_CRC32   0xb36ce346
 
-unsigned char stub_powerpc_darwin_macho_entry[8280] = {
+unsigned char stub_powerpc_darwin_macho_entry[7025] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 20,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 25, 68,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -428,130 +428,52 @@ unsigned char stub_powerpc_darwin_macho_entry[8280] = {
 /* 0x1850 */  56, 99,  0,192,140,  5,255,255,156,  3,255,255, 66,  0,255,248,
 /* 0x1860 */ 127,233,  3,166, 56,172,  0,128,144,193,255,252, 56,193,255,252,
 /* 0x1870 */ 148, 33,255,232, 78,128,  4, 32,127,232,  2,166, 75,255,255,181,
-/* 0x1880 */  72,  0,  0,128,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x1890 */ 109, 97,116, 32,101,108,102, 51, 50, 45,112,111,119,101,114,112,
-/* 0x18a0 */  99, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120,
-/* 0x18b0 */  32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x18c0 */ 105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32,
-/* 0x18d0 */  32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,
-/* 0x18e0 */ 101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,
-/* 0x18f0 */ 103,115, 10, 32, 32, 48, 32, 80, 80, 67, 51, 50, 66, 88, 88, 32,
-/* 0x1900 */  32, 32, 32, 32, 32, 48, 54, 56, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1910 */  48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1920 */  78, 84, 83, 10, 32, 32, 49, 32, 77, 65, 67, 77, 65, 73, 78, 88,
-/* 0x1930 */  32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1940 */  48, 57, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1950 */  78, 84, 83, 10, 32, 32, 50, 32, 77, 65, 67, 72, 95, 85, 78, 67,
-/* 0x1960 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1970 */  97, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1980 */  84, 83, 10, 32, 32, 51, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32,
-/* 0x1990 */  32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 97,
-/* 0x19a0 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x19b0 */  83, 10, 32, 32, 52, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32,
-/* 0x19c0 */  32, 32, 32, 32, 48, 49, 52, 56, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x19d0 */  48, 97, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x19e0 */  78, 84, 83, 10, 32, 32, 53, 32, 78, 82, 86, 50, 68, 32, 32, 32,
-/* 0x19f0 */  32, 32, 32, 32, 32, 32, 48, 49, 50, 99, 32, 32, 48, 32, 32, 48,
-/* 0x1a00 */  32, 32, 48, 49,101, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1a10 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 78, 82, 86, 50, 66,
-/* 0x1a20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48,102, 48, 32, 32, 48, 32,
-/* 0x1a30 */  32, 48, 32, 32, 48, 51, 49, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1a40 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 76, 90, 77,
-/* 0x1a50 */  65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 57, 48, 32, 32,
-/* 0x1a60 */  48, 32, 32, 48, 32, 32, 48, 52, 48, 52, 32, 32, 50, 42, 42, 48,
-/* 0x1a70 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 76,
-/* 0x1a80 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 57, 57,
-/* 0x1a90 */  99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 57, 52, 32, 32, 50,
-/* 0x1aa0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x1ab0 */  57, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32,
-/* 0x1ac0 */  48, 57, 57, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48,101, 51, 48,
-/* 0x1ad0 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1ae0 */  10, 32, 49, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32,
-/* 0x1af0 */  32, 32, 32, 48, 50, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x1b00 */  55, 99, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1b10 */  78, 84, 83, 10, 32, 49, 49, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x1b20 */  32, 32, 32, 32, 32, 32, 48, 49, 99, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1b30 */  32, 48, 49, 55,102, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1b40 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 67, 70, 76, 85, 83,
-/* 0x1b50 */  72, 32, 32, 32, 32, 32, 32, 32, 32, 48, 50, 48, 32, 32, 48, 32,
-/* 0x1b60 */  32, 48, 32, 32, 48, 49, 56, 48, 99, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1b70 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32, 77, 65,
-/* 0x1b80 */  67, 72, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 48, 52, 32, 32,
-/* 0x1b90 */  48, 32, 32, 48, 32, 32, 48, 49, 56, 50, 99, 32, 32, 50, 42, 42,
-/* 0x1ba0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 52, 32,
-/* 0x1bb0 */  77, 65, 67, 72, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32, 48, 53,
-/* 0x1bc0 */  56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 51, 48, 32, 32,
-/* 0x1bd0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83,
-/* 0x1be0 */  89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48,
-/* 0x1bf0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x1c00 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x1c10 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1c20 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32,
-/* 0x1c30 */  48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48,
-/* 0x1c40 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 72,
-/* 0x1c50 */  77, 65, 73, 78, 90, 32, 48, 32, 77, 65, 67, 72, 77, 65, 73, 78,
-/* 0x1c60 */  90, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1c70 */ 100, 32, 32, 80, 80, 67, 51, 50, 66, 88, 88, 32, 48, 32, 80, 80,
-/* 0x1c80 */  67, 51, 50, 66, 88, 88, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c90 */ 108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 77, 65, 73, 78, 88,
-/* 0x1ca0 */  32, 48, 32, 77, 65, 67, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48,
-/* 0x1cb0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67,
-/* 0x1cc0 */  72, 95, 85, 78, 67, 32, 48, 32, 77, 65, 67, 72, 95, 85, 78, 67,
-/* 0x1cd0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1ce0 */  32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86,
-/* 0x1cf0 */  95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x1d00 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78,
-/* 0x1d10 */  82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1d20 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82,
-/* 0x1d30 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1d40 */  32, 32,100, 32, 32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86,
-/* 0x1d50 */  50, 66, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1d60 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48,
-/* 0x1d70 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48,
-/* 0x1d80 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77,
-/* 0x1d90 */  65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1da0 */  69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1db0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x1dc0 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x1dd0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67,
-/* 0x1de0 */  70, 76, 85, 83, 72, 32, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48,
-/* 0x1df0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1e00 */  77, 65, 67, 72, 77, 65, 73, 78, 89, 32, 48, 32, 77, 65, 67, 72,
-/* 0x1e10 */  77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,103,
-/* 0x1e20 */  32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 77, 65, 73, 78, 88, 32,
-/* 0x1e30 */  48, 32, 95,115,116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x1e40 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x1e50 */  32, 91, 77, 65, 67, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70,
-/* 0x1e60 */  83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x1e70 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x1e80 */  48, 48, 48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76,
-/* 0x1e90 */  50, 52, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 72, 77, 65, 73,
-/* 0x1ea0 */  78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 52, 56, 10, 10, 82,
-/* 0x1eb0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x1ec0 */  83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79,
-/* 0x1ed0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x1ee0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x1ef0 */  48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 80, 80, 67, 95, 82,
-/* 0x1f00 */  69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84,
-/* 0x1f10 */  65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x1f20 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x1f30 */  50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x1f40 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1f50 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82,
-/* 0x1f60 */  95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1f70 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67,
-/* 0x1f80 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1f90 */  82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x1fa0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1fb0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x1fc0 */  48, 48, 57, 48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52,
-/* 0x1fd0 */  32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10,
-/* 0x1fe0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x1ff0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76,
-/* 0x2000 */  70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x2010 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2020 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 52, 32,
-/* 0x2030 */  82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32,
-/* 0x2040 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120, 48,
-/* 0x2050 */  48, 48, 48, 48, 48, 50, 52, 10
+/* 0x1880 */  72,  0,  0,128,  0,  0,  0,  0, 15,  0,  0,  0, 16,  0,  0,  0,
+/* 0x1890 */   5,  0,  0,  0,165,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x18a0 */ 104,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,156,  0,  0,  0,
+/* 0x18b0 */   4,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,160,  0,  0,  0,
+/* 0x18c0 */   0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,160,  0,  0,  0,
+/* 0x18d0 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,160,  0,  0,  0,
+/* 0x18e0 */  72,  1,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,232,  1,  0,  0,
+/* 0x18f0 */  44,  1,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0, 20,  3,  0,  0,
+/* 0x1900 */ 240,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  4,  4,  0,  0,
+/* 0x1910 */ 144,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,148,  4,  0,  0,
+/* 0x1920 */ 156,  9,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0, 48, 14,  0,  0,
+/* 0x1930 */ 156,  9,  0,  0,  0,  0,  0,  0, 87,  0,  0,  0,204, 23,  0,  0,
+/* 0x1940 */  36,  0,  0,  0,  0,  0,  0,  0, 98,  0,  0,  0,240, 23,  0,  0,
+/* 0x1950 */  28,  0,  0,  0,  0,  0,  0,  0,107,  0,  0,  0, 12, 24,  0,  0,
+/* 0x1960 */  32,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0, 44, 24,  0,  0,
+/* 0x1970 */   4,  0,  0,  0,  0,  0,  0,  0,124,  0,  0,  0, 48, 24,  0,  0,
+/* 0x1980 */  88,  0,  0,  0,  0,  0,  0,  0, 87,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1990 */   0,  0,  0,  0, 98,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */ 124,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19b0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x19c0 */   0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */  27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x19e0 */   4,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,  5,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0,  0, 48,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */  54,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,
+/* 0x1a10 */   8,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1a20 */   0,  0,  0,  0,107,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a30 */ 114,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,134,  0,  0,  0,
+/* 0x1a40 */   1,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */ 141,  0,  0,  0,124,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a60 */   4,  0,  0,  0,180,  0,  0,  0,153,  0,  0,  0, 98,  0,  0,  0,
+/* 0x1a70 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,180,  0,  0,  0,
+/* 0x1a80 */ 153,  0,  0,  0, 98,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a90 */   6,  0,  0,  0,144,  0,  0,  0,153,  0,  0,  0, 98,  0,  0,  0,
+/* 0x1aa0 */   0,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1ab0 */ 153,  0,  0,  0, 87,  0,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */  80, 80, 67, 51, 50, 66, 88, 88,  0, 77, 65, 67, 77, 65, 73, 78,
+/* 0x1ad0 */  88,  0, 77, 65, 67, 72, 95, 85, 78, 67,  0, 78, 82, 86, 95, 72,
+/* 0x1ae0 */  69, 65, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0,
+/* 0x1af0 */  78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,
+/* 0x1b00 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65,
+/* 0x1b10 */  95, 68, 69, 67, 50, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51,
+/* 0x1b20 */  48,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83,
+/* 0x1b30 */  72,  0, 77, 65, 67, 72, 77, 65, 73, 78, 89,  0, 77, 65, 67, 72,
+/* 0x1b40 */  77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0, 82, 95, 80,
+/* 0x1b50 */  80, 67, 95, 82, 69, 76, 50, 52,  0, 82, 95, 80, 80, 67, 95, 82,
+/* 0x1b60 */  69, 76, 49, 52,  0,136, 24,  0,  0, 85, 80, 88, 76, 78, 75, 48,
+/* 0x1b70 */  49
 };
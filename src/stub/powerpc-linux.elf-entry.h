@@ -1,5 +1,5 @@
 /* powerpc-linux.elf-entry.h
-   created from powerpc-linux.elf-entry.bin, 8467 (0x2113) bytes
+   created from powerpc-linux.elf-entry.bin, 7148 (0x1bec) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC_LINUX_ELF_ENTRY_SIZE    8467
-#define STUB_POWERPC_LINUX_ELF_ENTRY_ADLER32 0xd5b7c5b3
-#define STUB_POWERPC_LINUX_ELF_ENTRY_CRC32   0x5bf11174
+#define STUB_POWERPC_LINUX_ELF_ENTRY_SIZE    7148
+#define STUB_POWERPC_LINUX_ELF_ENTRY_ADLER32 0x5ea747e7
+#define STUB_POWERPC_LINUX_ELF_ENTRY_CRC32   0x2f87e178
 
-unsigned char stub_powerpc_linux_elf_entry[8467] = {
+unsigned char stub_powerpc_linux_elf_entry[7148] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 20,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 25,176,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -435,135 +435,52 @@ unsigned char stub_powerpc_linux_elf_entry[8467] = {
 /* 0x18c0 */   2,166, 56, 97,  0,144, 75,255,255,221, 75,255,255,217,124,122,
 /* 0x18d0 */  27,120,128,  3,  0,  0,128,131,  0,  4, 56, 99,  0,  8, 47,128,
 /* 0x18e0 */   0,  6, 65,158,  0, 16, 44,  0,  0,  0, 64,130,255,232, 56,128,
-/* 0x18f0 */  16,  0,127,196,  0,208, 75,255,255,  5,  0,  0,  0,  0,102,105,
-/* 0x1900 */ 108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 51, 50, 45,
-/* 0x1910 */ 112,111,119,101,114,112, 99, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x1920 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x1930 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1940 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32, 32, 32,
-/* 0x1950 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1960 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70,
-/* 0x1970 */  77, 65, 73, 78, 88, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48,
-/* 0x1980 */  32, 32, 48, 32, 32, 48, 51, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1990 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86,
-/* 0x19a0 */  95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32,
-/* 0x19b0 */  32, 48, 32, 32, 48, 51, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x19c0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 78, 82, 86, 50,
-/* 0x19d0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 52, 56, 32, 32,
-/* 0x19e0 */  48, 32, 32, 48, 32, 32, 48, 51, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x19f0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78, 82,
-/* 0x1a00 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 50, 99,
-/* 0x1a10 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 56, 48, 32, 32, 50, 42,
-/* 0x1a20 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52,
-/* 0x1a30 */  32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1a40 */ 102, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50, 97, 99, 32, 32,
-/* 0x1a50 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1a60 */  32, 53, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32,
-/* 0x1a70 */  32, 48, 57, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51, 57, 99,
-/* 0x1a80 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1a90 */  10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32,
-/* 0x1aa0 */  32, 32, 32, 48, 57, 57, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1ab0 */  52, 50, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1ac0 */  78, 84, 83, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1ad0 */  50, 48, 32, 32, 32, 32, 48, 57, 57, 99, 32, 32, 48, 32, 32, 48,
-/* 0x1ae0 */  32, 32, 48,100, 99, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1af0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95,
-/* 0x1b00 */  68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 50, 52, 32, 32, 48, 32,
-/* 0x1b10 */  32, 48, 32, 32, 48, 49, 55, 54, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1b20 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 78, 82,
-/* 0x1b30 */  86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 49, 99, 32,
-/* 0x1b40 */  32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 56, 56, 32, 32, 50, 42,
-/* 0x1b50 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48,
-/* 0x1b60 */  32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1b70 */  50, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55, 97, 52, 32,
-/* 0x1b80 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1b90 */  32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32,
-/* 0x1ba0 */  32, 32, 48, 49, 50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 55,
-/* 0x1bb0 */  99, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1bc0 */  84, 83, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32,
-/* 0x1bd0 */  32, 32, 32, 32, 32, 48, 49, 50, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1be0 */  32, 48, 49, 55,100, 97, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1bf0 */  78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65,
-/* 0x1c00 */  66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x1c10 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x1c20 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 10, 48, 48,
-/* 0x1c30 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x1c40 */  82, 86, 95, 84, 65, 73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65,
-/* 0x1c50 */  73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x1c60 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 48, 32, 69,
-/* 0x1c70 */  76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c80 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1c90 */  88, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x1cb0 */  86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x1cc0 */  68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1cd0 */ 100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69,
-/* 0x1ce0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1cf0 */  32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10,
-/* 0x1d00 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1d10 */  32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x1d20 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1d30 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77,
-/* 0x1d40 */  65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d50 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x1d60 */  67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x1d70 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x1d80 */  32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76,
-/* 0x1d90 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1da0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83,
-/* 0x1db0 */  72, 32, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48,
-/* 0x1dc0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x1dd0 */  65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 89, 10,
-/* 0x1de0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x1df0 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32, 95,115,116, 97,
-/* 0x1e00 */ 114,116, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32,
-/* 0x1e10 */  32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32, 79, 95, 66, 73,
-/* 0x1e20 */  78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x1e30 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70,
-/* 0x1e40 */  77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x1e50 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e60 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1e70 */  48, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52, 32, 32, 32,
-/* 0x1e80 */  32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,120, 48,
-/* 0x1e90 */  48, 48, 48, 48, 48,100, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x1ea0 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x1eb0 */  91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x1ec0 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ed0 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1ee0 */  98, 52, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32,
-/* 0x1ef0 */  32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82,
-/* 0x1f00 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x1f10 */  83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79,
-/* 0x1f20 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x1f30 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x1f40 */  48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 80, 80, 67, 95, 82,
-/* 0x1f50 */  69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84,
-/* 0x1f60 */  65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x1f70 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x1f80 */  50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89,
-/* 0x1f90 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1fa0 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82,
-/* 0x1fb0 */  95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32,
-/* 0x1fc0 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67,
-/* 0x1fd0 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x1fe0 */  82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10,
-/* 0x1ff0 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2000 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2010 */  10, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 95,
-/* 0x2020 */  82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65,
-/* 0x2030 */  95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48, 50,
-/* 0x2040 */  52, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x2050 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65,
-/* 0x2060 */  73, 78, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x2070 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2080 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2090 */  82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52, 32, 32, 32, 32, 32,
-/* 0x20a0 */  32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10, 82, 69, 76, 79,
-/* 0x20b0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x20c0 */  79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79,
-/* 0x20d0 */  70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x20e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x20f0 */  48, 48, 48, 48, 48, 49, 50, 48, 32, 82, 95, 80, 80, 67, 95, 65,
-/* 0x2100 */  68, 68, 82, 51, 50, 32, 32, 32, 32, 32, 32, 79, 95, 66, 73, 78,
-/* 0x2110 */  70, 79, 10
+/* 0x18f0 */  16,  0,127,196,  0,208, 75,255,255,  5,  0,  0,  0,  0, 13,  0,
+/* 0x1900 */   0,  0, 15,  0,  0,  0,  7,  0,  0,  0,166,  0,  0,  0,  0,  0,
+/* 0x1910 */   0,  0, 52,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x1920 */   0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,
+/* 0x1930 */   0,  0, 56,  0,  0,  0, 72,  1,  0,  0,  0,  0,  0,  0, 24,  0,
+/* 0x1940 */   0,  0,128,  1,  0,  0, 44,  1,  0,  0,  0,  0,  0,  0, 30,  0,
+/* 0x1950 */   0,  0,172,  2,  0,  0,240,  0,  0,  0,  0,  0,  0,  0, 36,  0,
+/* 0x1960 */   0,  0,156,  3,  0,  0,144,  0,  0,  0,  0,  0,  0,  0, 47,  0,
+/* 0x1970 */   0,  0, 44,  4,  0,  0,156,  9,  0,  0,  0,  0,  0,  0, 58,  0,
+/* 0x1980 */   0,  0,200, 13,  0,  0,156,  9,  0,  0,  0,  0,  0,  0, 69,  0,
+/* 0x1990 */   0,  0,100, 23,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 80,  0,
+/* 0x19a0 */   0,  0,136, 23,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 89,  0,
+/* 0x19b0 */   0,  0,164, 23,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 96,  0,
+/* 0x19c0 */   0,  0,200, 23,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,105,  0,
+/* 0x19d0 */   0,  0,218, 23,  0,  0, 36,  1,  0,  0,  0,  0,  0,  0, 69,  0,
+/* 0x19e0 */   0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  9,  0,
+/* 0x19f0 */   0,  0,  0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,  0,  0,
+/* 0x1a00 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,
+/* 0x1a10 */   0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,
+/* 0x1a20 */   0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,  0,  0,
+/* 0x1a30 */   0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 36,  0,
+/* 0x1a40 */   0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  6,  0,
+/* 0x1a50 */   0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,  0,  0,
+/* 0x1a60 */   0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 96,  0,
+/* 0x1a70 */   0,  0, 11,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0,  0,  0,121,  0,  0,  0, 14,  0,  0,  0,173,222,
+/* 0x1a90 */ 173,222,  0,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,105,  0,
+/* 0x1aa0 */   0,  0,220,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,180,  0,
+/* 0x1ab0 */   0,  0,141,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ac0 */   0,  0,  3,  0,  0,  0,180,  0,  0,  0,141,  0,  0,  0, 80,  0,
+/* 0x1ad0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,144,  0,
+/* 0x1ae0 */   0,  0,141,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1af0 */   0,  0,  5,  0,  0,  0,  4,  0,  0,  0,141,  0,  0,  0, 69,  0,
+/* 0x1b00 */   0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,  0,  0,
+/* 0x1b10 */   0,  0,129,  0,  0,  0,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1b20 */   0,  0, 12,  0,  0,  0, 32,  1,  0,  0,153,  0,  0,  0,121,  0,
+/* 0x1b30 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 69, 76, 70, 77, 65, 73,
+/* 0x1b40 */  78, 88,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82, 86, 50,
+/* 0x1b50 */  69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0, 76, 90,
+/* 0x1b60 */  77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x1b70 */  67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 76,
+/* 0x1b80 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 78, 82, 86, 95, 84, 65,
+/* 0x1b90 */  73, 76,  0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77, 65, 73,
+/* 0x1ba0 */  78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,116, 97,
+/* 0x1bb0 */ 114,116,  0, 79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 80, 80, 67,
+/* 0x1bc0 */  95, 82, 69, 76, 50, 52,  0, 82, 95, 80, 80, 67, 95, 82, 69, 76,
+/* 0x1bd0 */  49, 52,  0, 82, 95, 80, 80, 67, 95, 65, 68, 68, 82, 51, 50,  0,
+/* 0x1be0 */ 254, 24,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
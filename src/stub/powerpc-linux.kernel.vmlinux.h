@@ -1,5 +1,5 @@
 /* powerpc-linux.kernel.vmlinux.h
-   created from powerpc-linux.kernel.vmlinux.bin, 8429 (0x20ed) bytes
+   created from powerpc-linux.kernel.vmlinux.bin, 7086 (0x1bae) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_SIZE    8429
-#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_ADLER32 0xa0409e95
-#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_CRC32   0xbcf7db31
+#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_SIZE    7086
+#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_ADLER32 0xf6781244
+#define STUB_POWERPC_LINUX_KERNEL_VMLINUX_CRC32   0xe079894d
 
-unsigned char stub_powerpc_linux_kernel_vmlinux[8429] = {
+unsigned char stub_powerpc_linux_kernel_vmlinux[7086] = {
 /* 0x0000 */ 127, 69, 76, 70,  1,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 20,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0, 25, 20,  0,  0,  0,  0,  0, 52,  0,  0,  0,  0,  0, 40,
@@ -425,142 +425,58 @@ unsigned char stub_powerpc_linux_kernel_vmlinux[8429] = {
 /* 0x1820 */ 128, 33,  0,  0,124,165, 58, 20,128,  1,  0,  8, 56,165,255,255,
 /* 0x1830 */ 128, 33,  0,  0,124,  8,  3,166, 85, 80, 88, 33,161,216,208,213,
 /* 0x1840 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x1850 */   0,  0,  0,  0,  0,  0,  0, 45,102,105,108,101, 32,102,111,114,
-/* 0x1860 */ 109, 97,116, 32,101,108,102, 51, 50, 45,112,111,119,101,114,112,
-/* 0x1870 */  99, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120,
-/* 0x1880 */  32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x1890 */ 105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32,
-/* 0x18a0 */  32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 70,105,108,
-/* 0x18b0 */ 101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,
-/* 0x18c0 */ 103,115, 10, 32, 32, 48, 32, 76, 73, 78, 85, 88, 48, 48, 48, 32,
-/* 0x18d0 */  32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x18e0 */  51, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x18f0 */  84, 83, 10, 32, 32, 49, 32, 76, 73, 78, 85, 88, 48, 49, 48, 32,
-/* 0x1900 */  32, 32, 32, 32, 32, 48, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1910 */  51, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1920 */  84, 83, 10, 32, 32, 50, 32, 76, 73, 78, 85, 88, 48, 50, 48, 32,
-/* 0x1930 */  32, 32, 32, 32, 32, 48, 54, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1940 */  48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1950 */  78, 84, 83, 10, 32, 32, 51, 32, 76, 73, 78, 85, 88, 48, 51, 48,
-/* 0x1960 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1970 */  97, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1980 */  84, 83, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32,
-/* 0x1990 */  32, 32, 32, 32, 32, 48,102, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x19a0 */  48, 97, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x19b0 */  78, 84, 83, 10, 32, 32, 53, 32, 78, 82, 86, 50, 68, 32, 32, 32,
-/* 0x19c0 */  32, 32, 32, 32, 32, 32, 48, 49, 50, 99, 32, 32, 48, 32, 32, 48,
-/* 0x19d0 */  32, 32, 48, 49, 57, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x19e0 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 78, 82, 86, 50, 69,
-/* 0x19f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 52, 56, 32, 32, 48,
-/* 0x1a00 */  32, 32, 48, 32, 32, 48, 50, 99, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1a10 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55, 32, 78, 82,
-/* 0x1a20 */  86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 49, 99, 32,
-/* 0x1a30 */  32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 99, 32, 32, 50, 42, 42,
-/* 0x1a40 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32,
-/* 0x1a50 */  67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32, 32, 32, 48, 50,
-/* 0x1a60 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 50, 56, 32, 32, 50,
-/* 0x1a70 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32,
-/* 0x1a80 */  57, 32, 76, 90, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1a90 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 52, 99, 32, 32, 50,
-/* 0x1aa0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x1ab0 */  48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32,
-/* 0x1ac0 */  48, 57, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 52, 99, 32,
-/* 0x1ad0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1ae0 */  32, 49, 49, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32,
-/* 0x1af0 */  32, 32, 48, 57, 57, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,
-/* 0x1b00 */ 100, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1b10 */  84, 83, 10, 32, 49, 50, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x1b20 */  48, 32, 32, 32, 32, 48, 57, 57, 99, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1b30 */  32, 48,101, 55, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1b40 */  84, 69, 78, 84, 83, 10, 32, 49, 51, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1b50 */  69, 67, 51, 48, 32, 32, 32, 32, 48, 50, 52, 32, 32, 48, 32, 32,
-/* 0x1b60 */  48, 32, 32, 48, 49, 56, 49, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1b70 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 52, 32, 85, 80, 88,
-/* 0x1b80 */  49, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 50, 48, 32, 32,
-/* 0x1b90 */  48, 32, 32, 48, 32, 32, 48, 49, 56, 51, 56, 32, 32, 50, 42, 42,
-/* 0x1ba0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66,
-/* 0x1bb0 */  79, 76, 32, 84, 65, 66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1bc0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88,
-/* 0x1bd0 */  48, 50, 48, 32, 48, 32, 76, 73, 78, 85, 88, 48, 50, 48, 10, 48,
-/* 0x1be0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x1bf0 */  76, 73, 78, 85, 88, 48, 51, 48, 32, 48, 32, 76, 73, 78, 85, 88,
-/* 0x1c00 */  48, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x1c10 */  32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 48, 32,
-/* 0x1c20 */  78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1c30 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1c40 */  69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x1c50 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1c60 */ 100, 32, 32, 76, 73, 78, 85, 88, 48, 48, 48, 32, 48, 32, 76, 73,
-/* 0x1c70 */  78, 85, 88, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1c80 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88, 48, 49, 48,
-/* 0x1c90 */  32, 48, 32, 76, 73, 78, 85, 88, 48, 49, 48, 10, 48, 48, 48, 48,
-/* 0x1ca0 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x1cb0 */  50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x1cc0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x1cd0 */  68, 32, 48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1ce0 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69,
-/* 0x1cf0 */  32, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d00 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72,
-/* 0x1d10 */  32, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48, 48,
-/* 0x1d20 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 32,
-/* 0x1d30 */  48, 32, 76, 90, 77, 65, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1d40 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x1d50 */  48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10,
-/* 0x1d60 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x1d70 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90,
-/* 0x1d80 */  77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x1d90 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x1da0 */  69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x1db0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x1dc0 */ 100, 32, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 48, 32, 85, 80,
-/* 0x1dd0 */  88, 49, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1de0 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x1df0 */ 102,105,108,116,101,114, 95,108,101,110,103,116,104, 10, 48, 48,
-/* 0x1e00 */  48, 48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42,
-/* 0x1e10 */  85, 78, 68, 42, 32, 48, 32,102,105,108,116,101,114, 95, 99,116,
-/* 0x1e20 */ 111, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69,
-/* 0x1e30 */  67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 73, 78, 85, 88,
-/* 0x1e40 */  48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84,
-/* 0x1e50 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1e60 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x1e70 */  82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52, 32, 32, 32, 32, 32,
-/* 0x1e80 */  32, 32, 76, 73, 78, 85, 88, 48, 51, 48, 10, 48, 48, 48, 48, 48,
-/* 0x1e90 */  48, 48, 52, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 50, 52, 32,
-/* 0x1ea0 */  32, 32, 32, 32, 32, 32, 76, 73, 78, 85, 88, 48, 50, 48, 10, 10,
-/* 0x1eb0 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x1ec0 */  68, 83, 32, 70, 79, 82, 32, 91, 76, 73, 78, 85, 88, 48, 49, 48,
-/* 0x1ed0 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69,
-/* 0x1ee0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x1ef0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 80,
-/* 0x1f00 */  80, 67, 95, 65, 68, 68, 82, 51, 50, 32, 32, 32, 32, 32, 32,102,
-/* 0x1f10 */ 105,108,116,101,114, 95,108,101,110,103,116,104, 10, 48, 48, 48,
-/* 0x1f20 */  48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 95, 65, 68, 68, 82,
-/* 0x1f30 */  51, 50, 32, 32, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,
-/* 0x1f40 */ 116,111, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x1f50 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50,
-/* 0x1f60 */  66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80,
-/* 0x1f70 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1f80 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 57, 48, 32, 82, 95,
-/* 0x1f90 */  80, 80, 67, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1fa0 */  78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x1fb0 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x1fc0 */  32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x1fd0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1fe0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x1ff0 */  48, 98, 52, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52, 32,
-/* 0x2000 */  32, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10,
-/* 0x2010 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2020 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10,
-/* 0x2030 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x2040 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2050 */  10, 48, 48, 48, 48, 48, 48, 98, 52, 32, 82, 95, 80, 80, 67, 95,
-/* 0x2060 */  82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 32, 32, 78, 82, 86, 95,
-/* 0x2070 */  84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2080 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90,
-/* 0x2090 */  77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x20a0 */  84, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x20b0 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x20c0 */  48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49, 52,
-/* 0x20d0 */  32, 32, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x20e0 */  48, 43, 48,120, 48, 48, 48, 48, 48, 48, 50, 52, 10
+/* 0x1850 */   0,  0,  0,  0,  0,  0,  0, 45, 15,  0,  0,  0, 17,  0,  0,  0,
+/* 0x1860 */   8,  0,  0,  0,190,  0,  0,  0,  0,  0,  0,  0, 52,  0,  0,  0,
+/* 0x1870 */   8,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 60,  0,  0,  0,
+/* 0x1880 */   8,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1890 */ 100,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,168,  0,  0,  0,
+/* 0x18a0 */   0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,168,  0,  0,  0,
+/* 0x18b0 */ 240,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,152,  1,  0,  0,
+/* 0x18c0 */  44,  1,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,196,  2,  0,  0,
+/* 0x18d0 */  72,  1,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0, 12,  4,  0,  0,
+/* 0x18e0 */  28,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0, 40,  4,  0,  0,
+/* 0x18f0 */  36,  0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0, 76,  4,  0,  0,
+/* 0x1900 */   0,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0, 76,  4,  0,  0,
+/* 0x1910 */ 144,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0,220,  4,  0,  0,
+/* 0x1920 */ 156,  9,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0,120, 14,  0,  0,
+/* 0x1930 */ 156,  9,  0,  0,  0,  0,  0,  0,108,  0,  0,  0, 20, 24,  0,  0,
+/* 0x1940 */  36,  0,  0,  0,  0,  0,  0,  0,119,  0,  0,  0, 56, 24,  0,  0,
+/* 0x1950 */  32,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1960 */   0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1970 */  54,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,
+/* 0x1980 */  13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1990 */   0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19a0 */  36,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,
+/* 0x19b0 */   5,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  6,  0,  0,  0,
+/* 0x19c0 */   0,  0,  0,  0, 63,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x19d0 */  70,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,
+/* 0x19e0 */  10,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0, 11,  0,  0,  0,
+/* 0x19f0 */   0,  0,  0,  0, 97,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a00 */ 119,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,
+/* 0x1a10 */  16,  0,  0,  0,173,222,173,222,142,  0,  0,  0, 16,  0,  0,  0,
+/* 0x1a20 */ 173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,153,  0,  0,  0,
+/* 0x1a30 */  27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a40 */   4,  0,  0,  0,153,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a50 */   0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,165,  0,  0,  0,
+/* 0x1a60 */ 128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1a70 */   4,  0,  0,  0,165,  0,  0,  0,142,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1a80 */   0,  0,  0,  0,  4,  0,  0,  0,144,  0,  0,  0,178,  0,  0,  0,
+/* 0x1a90 */  54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1aa0 */ 180,  0,  0,  0,178,  0,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ab0 */   0,  0,  0,  0,  6,  0,  0,  0,180,  0,  0,  0,178,  0,  0,  0,
+/* 0x1ac0 */  54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,
+/* 0x1ad0 */   4,  0,  0,  0,178,  0,  0,  0,108,  0,  0,  0, 36,  0,  0,  0,
+/* 0x1ae0 */   0,  0,  0,  0, 76, 73, 78, 85, 88, 48, 48, 48,  0, 76, 73, 78,
+/* 0x1af0 */  85, 88, 48, 49, 48,  0, 76, 73, 78, 85, 88, 48, 50, 48,  0, 76,
+/* 0x1b00 */  73, 78, 85, 88, 48, 51, 48,  0, 78, 82, 86, 50, 66,  0, 78, 82,
+/* 0x1b10 */  86, 50, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 95, 84, 65,
+/* 0x1b20 */  73, 76,  0, 67, 70, 76, 85, 83, 72,  0, 76, 90, 77, 65,  0, 76,
+/* 0x1b30 */  90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x1b40 */  69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0,
+/* 0x1b50 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 85, 80, 88, 49, 72,
+/* 0x1b60 */  69, 65, 68,  0,102,105,108,116,101,114, 95,108,101,110,103,116,
+/* 0x1b70 */ 104,  0,102,105,108,116,101,114, 95, 99,116,111,  0, 82, 95, 80,
+/* 0x1b80 */  80, 67, 95, 82, 69, 76, 50, 52,  0, 82, 95, 80, 80, 67, 95, 65,
+/* 0x1b90 */  68, 68, 82, 51, 50,  0, 82, 95, 80, 80, 67, 95, 82, 69, 76, 49,
+/* 0x1ba0 */  52,  0, 88, 24,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
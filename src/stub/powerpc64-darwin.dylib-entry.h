@@ -1,5 +1,5 @@
 /* powerpc64-darwin.dylib-entry.h
-   created from powerpc64-darwin.dylib-entry.bin, 10225 (0x27f1) bytes
+   created from powerpc64-darwin.dylib-entry.bin, 8849 (0x2291) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC64_DARWIN_DYLIB_ENTRY_SIZE    10225
-#define STUB_POWERPC64_DARWIN_DYLIB_ENTRY_ADLER32 0xac2304d7
-#define STUB_POWERPC64_DARWIN_DYLIB_ENTRY_CRC32   0x09bab5ff
+#define STUB_POWERPC64_DARWIN_DYLIB_ENTRY_SIZE    8849
+#define STUB_POWERPC64_DARWIN_DYLIB_ENTRY_ADLER32 0x545e8e3a
+#define STUB_POWERPC64_DARWIN_DYLIB_ENTRY_CRC32   0x2ef2ef6b
 
-unsigned char stub_powerpc64_darwin_dylib_entry[10225] = {
+unsigned char stub_powerpc64_darwin_dylib_entry[8849] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 21,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,128,
@@ -547,133 +547,47 @@ unsigned char stub_powerpc64_darwin_dylib_entry[10225] = {
 /* 0x1fc0 */ 125, 99, 88, 80,125,107, 58, 20, 81, 96,  1,186,144,  3,  0,  0,
 /* 0x1fd0 */  79, 64,  0, 32,132,  3,  0,  4, 84, 11, 85,190,124, 11, 40, 64,
 /* 0x1fe0 */  65,194,255,220, 67, 32,255,240, 78,128,  0, 32, 75,255,253, 28,
-/* 0x1ff0 */ 102,105,108,101, 32,102,111,114,109, 97,116, 32,101,108,102, 54,
-/* 0x2000 */  52, 45,112,111,119,101,114,112, 99, 10, 10, 83,101, 99,116,105,
-/* 0x2010 */ 111,110,115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32,
-/* 0x2020 */  32, 32, 32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32,
-/* 0x2030 */  32, 86, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2040 */  32, 32, 32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2050 */  32, 32, 32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,
-/* 0x2060 */ 108,103,110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 77,
-/* 0x2070 */  65, 67, 79, 83, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 56, 32,
-/* 0x2080 */  32, 48, 32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48,
-/* 0x2090 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 78,
-/* 0x20a0 */  82, 86, 95, 72, 69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 32, 32,
-/* 0x20b0 */  48, 32, 32, 48, 32, 32, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32,
-/* 0x20c0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 78, 82,
-/* 0x20d0 */  86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 53, 52,
-/* 0x20e0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 56, 32, 32, 50, 42, 42,
-/* 0x20f0 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32,
-/* 0x2100 */  78, 82, 86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x2110 */  52, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 57, 99, 32, 32,
-/* 0x2120 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2130 */  32, 52, 32, 78, 82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2140 */  32, 48,102, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,101, 48,
-/* 0x2150 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x2160 */  10, 32, 32, 53, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32,
-/* 0x2170 */  32, 32, 32, 48, 57, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,
-/* 0x2180 */ 100, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x2190 */  84, 83, 10, 32, 32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x21a0 */  48, 32, 32, 32, 32, 48, 50, 56, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x21b0 */  48, 52, 54, 99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x21c0 */  69, 78, 84, 83, 10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x21d0 */  67, 49, 48, 32, 32, 32, 32, 48, 98, 99, 48, 32, 32, 48, 32, 32,
-/* 0x21e0 */  48, 32, 32, 48, 52, 57, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x21f0 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 56, 32, 76, 90, 77, 65,
-/* 0x2200 */  95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 99, 55, 52, 32, 32,
-/* 0x2210 */  48, 32, 32, 48, 32, 32, 48, 49, 48, 53, 52, 32, 32, 50, 42, 42,
-/* 0x2220 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32,
-/* 0x2230 */  78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x2240 */  99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 99, 99, 56, 32, 32,
-/* 0x2250 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2260 */  49, 48, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2270 */  32, 48, 50, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 99,101,
-/* 0x2280 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2290 */  83, 10, 32, 49, 49, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32,
-/* 0x22a0 */  32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100,
-/* 0x22b0 */  48, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x22c0 */  84, 83, 10, 32, 49, 50, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32,
-/* 0x22d0 */  32, 32, 32, 32, 32, 48, 50,101, 56, 32, 32, 48, 32, 32, 48, 32,
-/* 0x22e0 */  32, 48, 49,100, 48, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x22f0 */  78, 84, 69, 78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65,
-/* 0x2300 */  66, 76, 69, 58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x2320 */  77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x2330 */  68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2340 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x2350 */  82, 86, 95, 84, 65, 73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65,
-/* 0x2360 */  73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2370 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77,
-/* 0x2380 */  65, 73, 78, 90, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x2390 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 77, 65, 67, 79, 83, 48, 48,
-/* 0x23b0 */  48, 32, 48, 32, 77, 65, 67, 79, 83, 48, 48, 48, 10, 48, 48, 48,
-/* 0x23c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x23d0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 48,
-/* 0x23e0 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48,
-/* 0x23f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2400 */ 100, 32, 32, 78, 82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69,
-/* 0x2410 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2420 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32,
-/* 0x2430 */  48, 32, 78, 82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2440 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2450 */  32, 78, 82, 86, 50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48,
-/* 0x2460 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2470 */ 108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2480 */  48, 48, 32, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10,
-/* 0x2490 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24a0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x24b0 */  67, 49, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x24c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x24e0 */  69, 67, 50, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x24f0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2500 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83,
-/* 0x2510 */  72, 32, 48, 32, 67, 70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48,
-/* 0x2520 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2530 */  32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69,
-/* 0x2540 */  76, 70, 77, 65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2550 */  48, 48, 48, 48, 48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32,
-/* 0x2560 */  32, 77, 65, 67, 79, 83, 48, 48, 48, 32, 48, 32, 95,115,116, 97,
-/* 0x2570 */ 114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x2580 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 77, 65, 67, 79,
-/* 0x2590 */  83, 48, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x25a0 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x25b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x25c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x25d0 */  32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 50, 52, 32, 32,
-/* 0x25e0 */  32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 43, 48,120, 48, 48,
-/* 0x25f0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50,101, 52, 10, 10,
-/* 0x2600 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2610 */  68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10,
-/* 0x2620 */  79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2630 */  32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2640 */  32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2650 */  48, 48, 48, 48, 48, 48, 48, 99, 48, 32, 82, 95, 80, 80, 67, 54,
-/* 0x2660 */  52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95,
-/* 0x2670 */  84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x2680 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x2690 */  86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x26a0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x26b0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x26c0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 99, 99, 32,
-/* 0x26d0 */  82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32,
-/* 0x26e0 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79,
-/* 0x26f0 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2700 */  79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2710 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x2720 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2730 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2740 */  48, 48, 48, 57, 56, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69,
-/* 0x2750 */  76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2760 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2770 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69,
-/* 0x2780 */  76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2790 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x27a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x27b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52,
-/* 0x27c0 */  32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32,
-/* 0x27d0 */  32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120,
-/* 0x27e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 56,
-/* 0x27f0 */  10
+/* 0x1ff0 */  13,  0,  0,  0, 14,  0,  0,  0,  5,  0,  0,  0,149,  0,  0,  0,
+/* 0x2000 */   0,  0,  0,  0, 64,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2010 */   9,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2020 */  18,  0,  0,  0, 72,  0,  0,  0, 84,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */  24,  0,  0,  0,156,  1,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0,
+/* 0x2040 */  30,  0,  0,  0,224,  2,  0,  0,248,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2050 */  36,  0,  0,  0,216,  3,  0,  0,148,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */  47,  0,  0,  0,108,  4,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2070 */  58,  0,  0,  0,148,  4,  0,  0,192, 11,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */  69,  0,  0,  0, 84, 16,  0,  0,116, 12,  0,  0,  0,  0,  0,  0,
+/* 0x2090 */  80,  0,  0,  0,200, 28,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20a0 */  89,  0,  0,  0,228, 28,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20b0 */  96,  0,  0,  0,  8, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20c0 */ 105,  0,  0,  0,  8, 29,  0,  0,232,  2,  0,  0,  0,  0,  0,  0,
+/* 0x20d0 */  47,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,
+/* 0x20e0 */   9,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,
+/* 0x20f0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2100 */   9,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x2110 */   2,  0,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2120 */   0,  0,  0,  0, 30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2130 */  36,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,
+/* 0x2140 */   7,  0,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,
+/* 0x2150 */   0,  0,  0,  0, 89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2160 */  96,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,
+/* 0x2170 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x2180 */ 121,  0,  0,  0,105,  0,  0,  0,228,  2,  0,  0,  0,  0,  0,  0,
+/* 0x2190 */   2,  0,  0,  0,192,  0,  0,  0,135,  0,  0,  0, 80,  0,  0,  0,
+/* 0x21a0 */   0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,204,  0,  0,  0,
+/* 0x21b0 */ 135,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21c0 */   4,  0,  0,  0,152,  0,  0,  0,135,  0,  0,  0, 80,  0,  0,  0,
+/* 0x21d0 */   0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  4,  0,  0,  0,
+/* 0x21e0 */ 135,  0,  0,  0, 47,  0,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,
+/* 0x21f0 */  77, 65, 67, 79, 83, 48, 48, 48,  0, 78, 82, 86, 95, 72, 69, 65,
+/* 0x2200 */  68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82,
+/* 0x2210 */  86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76,
+/* 0x2220 */  90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76, 90, 77, 65, 95, 68,
+/* 0x2230 */  69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0,
+/* 0x2240 */  78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0,
+/* 0x2250 */  69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78,
+/* 0x2260 */  90,  0, 95,115,116, 97,114,116,  0, 82, 95, 80, 80, 67, 54, 52,
+/* 0x2270 */  95, 82, 69, 76, 50, 52,  0, 82, 95, 80, 80, 67, 54, 52, 95, 82,
+/* 0x2280 */  69, 76, 49, 52,  0,240, 31,  0,  0, 85, 80, 88, 76, 78, 75, 48,
+/* 0x2290 */  49
 };
@@ -1,5 +1,5 @@
 /* powerpc64-darwin.macho-entry.h
-   created from powerpc64-darwin.macho-entry.bin, 9564 (0x255c) bytes
+   created from powerpc64-darwin.macho-entry.bin, 8189 (0x1ffd) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC64_DARWIN_MACHO_ENTRY_SIZE    9564
-#define STUB_POWERPC64_DARWIN_MACHO_ENTRY_ADLER32 0xe057f4cd
-#define STUB_POWERPC64_DARWIN_MACHO_ENTRY_CRC32   0x985279e9
+#define STUB_POWERPC64_DARWIN_MACHO_ENTRY_SIZE    8189
+#define STUB_POWERPC64_DARWIN_MACHO_ENTRY_ADLER32 0x9feb7d22
+#define STUB_POWERPC64_DARWIN_MACHO_ENTRY_CRC32   0x67bc0c37
 
-unsigned char stub_powerpc64_darwin_macho_entry[9564] = {
+unsigned char stub_powerpc64_darwin_macho_entry[8189] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 21,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,240,
@@ -505,133 +505,47 @@ unsigned char stub_powerpc64_darwin_macho_entry[9564] = {
 /* 0x1d20 */ 124,102, 90, 20, 56, 99,  0,192,140,  5,255,255,156,  3,255,255,
 /* 0x1d30 */  67, 32,255,248,127,233,  3,166, 56,171,  0,128,248,193,255,248,
 /* 0x1d40 */  56,193,255,248,248, 33,255,113, 78,128,  4, 32,127,232,  2,166,
-/* 0x1d50 */  75,255,255,181, 72,  0,  0,128,  0,  0,  0,  0,102,105,108,101,
-/* 0x1d60 */  32,102,111,114,109, 97,116, 32,101,108,102, 54, 52, 45,112,111,
-/* 0x1d70 */ 119,101,114,112, 99, 10, 10, 83,101, 99,116,105,111,110,115, 58,
-/* 0x1d80 */  10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1d90 */  32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65,
-/* 0x1da0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76,
-/* 0x1db0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1dc0 */  32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32,
-/* 0x1dd0 */  32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 77, 65, 67, 79, 83,
-/* 0x1de0 */  48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32,
-/* 0x1df0 */  48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x1e00 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72,
-/* 0x1e10 */  69, 65, 68, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1e20 */  32, 32, 48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1e30 */  84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32,
-/* 0x1e40 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 53, 52, 32, 32, 48, 32,
-/* 0x1e50 */  32, 48, 32, 32, 48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1e60 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78, 82, 86, 50,
-/* 0x1e70 */  68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 52, 52, 32, 32,
-/* 0x1e80 */  48, 32, 32, 48, 32, 32, 48, 49, 57, 56, 32, 32, 50, 42, 42, 48,
-/* 0x1e90 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78,
-/* 0x1ea0 */  82, 86, 50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,102, 56,
-/* 0x1eb0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 50,100, 99, 32, 32, 50, 42,
-/* 0x1ec0 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53,
-/* 0x1ed0 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48,
-/* 0x1ee0 */  57, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 51,100, 52, 32, 32,
-/* 0x1ef0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x1f00 */  32, 54, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32,
-/* 0x1f10 */  32, 48, 50, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 54, 56,
-/* 0x1f20 */  32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83,
-/* 0x1f30 */  10, 32, 32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32,
-/* 0x1f40 */  32, 32, 32, 48, 98, 99, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1f50 */  52, 57, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1f60 */  78, 84, 83, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x1f70 */  50, 48, 32, 32, 32, 32, 48, 99, 55, 52, 32, 32, 48, 32, 32, 48,
-/* 0x1f80 */  32, 32, 48, 49, 48, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x1f90 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 78, 82, 86, 95,
-/* 0x1fa0 */  84, 65, 73, 76, 32, 32, 32, 32, 32, 32, 48, 49, 99, 32, 32, 48,
-/* 0x1fb0 */  32, 32, 48, 32, 32, 48, 49, 99, 99, 52, 32, 32, 50, 42, 42, 48,
-/* 0x1fc0 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 67,
-/* 0x1fd0 */  70, 76, 85, 83, 72, 32, 32, 32, 32, 32, 32, 32, 32, 48, 50, 52,
-/* 0x1fe0 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 99,101, 48, 32, 32, 50,
-/* 0x1ff0 */  42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49,
-/* 0x2000 */  49, 32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32,
-/* 0x2010 */  48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100, 48, 52, 32, 32,
-/* 0x2020 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2030 */  49, 50, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32,
-/* 0x2040 */  32, 48, 53, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100, 48,
-/* 0x2050 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x2060 */  83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10,
-/* 0x2070 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2080 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2090 */  67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,
-/* 0x20a0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x20b0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84, 65,
-/* 0x20c0 */  73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48, 48,
-/* 0x20d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x20e0 */  32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32,
-/* 0x20f0 */  48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48, 48,
-/* 0x2100 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2110 */  32,100, 32, 32, 77, 65, 67, 79, 83, 48, 48, 48, 32, 48, 32, 77,
-/* 0x2120 */  65, 67, 79, 83, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2130 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2140 */  32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86, 95,
-/* 0x2150 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2160 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x2170 */  86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48,
-/* 0x2180 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2190 */  32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82, 86,
-/* 0x21a0 */  50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21b0 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50,
-/* 0x21c0 */  66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x21e0 */ 100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32,
-/* 0x21f0 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2210 */  32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48,
-/* 0x2220 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48,
-/* 0x2230 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2240 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32,
-/* 0x2250 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48,
-/* 0x2260 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2270 */  32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72, 32, 48, 32, 67,
-/* 0x2280 */  70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2290 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69,
-/* 0x22a0 */  76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x22b0 */  78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22c0 */  48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 77, 65, 67, 79,
-/* 0x22d0 */  83, 48, 48, 48, 32, 48, 32, 95,115,116, 97,114,116, 10, 10, 82,
-/* 0x22e0 */  69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68,
-/* 0x22f0 */  83, 32, 70, 79, 82, 32, 91, 77, 65, 67, 79, 83, 48, 48, 48, 93,
-/* 0x2300 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2310 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2320 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2330 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95, 80, 80,
-/* 0x2340 */  67, 54, 52, 95, 82, 69, 76, 50, 52, 32, 32, 32, 32, 32, 69, 76,
-/* 0x2350 */  70, 77, 65, 73, 78, 90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2360 */  48, 48, 48, 48, 48, 48, 48, 52, 56, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2370 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2380 */  82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2390 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x23a0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x23b0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23c0 */  48, 48, 99, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76,
-/* 0x23d0 */  49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10,
-/* 0x23e0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x23f0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58,
-/* 0x2400 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2410 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2420 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2430 */  48, 48, 48, 48, 48, 48, 48, 48, 99, 99, 32, 82, 95, 80, 80, 67,
-/* 0x2440 */  54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2450 */  95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2460 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78,
-/* 0x2470 */  82, 86, 50, 66, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32,
-/* 0x2480 */  32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32,
-/* 0x2490 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10,
-/* 0x24a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 56,
-/* 0x24b0 */  32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32,
-/* 0x24c0 */  32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76,
-/* 0x24d0 */  79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32,
-/* 0x24e0 */  70, 79, 82, 32, 91, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93,
-/* 0x24f0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2500 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2510 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2520 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80,
-/* 0x2530 */  67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 76, 90,
-/* 0x2540 */  77, 65, 95, 68, 69, 67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48,
-/* 0x2550 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 50, 56, 10
+/* 0x1d50 */  75,255,255,181, 72,  0,  0,128,  0,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1d60 */  14,  0,  0,  0,  5,  0,  0,  0,149,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1d70 */  64,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1d80 */  68,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1d90 */  68,  0,  0,  0, 84,  1,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,
+/* 0x1da0 */ 152,  1,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x1db0 */ 220,  2,  0,  0,248,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x1dc0 */ 212,  3,  0,  0,148,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,
+/* 0x1dd0 */ 104,  4,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,
+/* 0x1de0 */ 144,  4,  0,  0,192, 11,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0,
+/* 0x1df0 */  80, 16,  0,  0,116, 12,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,
+/* 0x1e00 */ 196, 28,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x1e10 */ 224, 28,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,
+/* 0x1e20 */   4, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0,
+/* 0x1e30 */   4, 29,  0,  0, 88,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,
+/* 0x1e40 */   6,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1e50 */   0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e60 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1e70 */   1,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1e80 */   0,  0,  0,  0, 24,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1e90 */  30,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x1ea0 */   5,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,
+/* 0x1eb0 */   0,  0,  0,  0, 69,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */  89,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,
+/* 0x1ed0 */  11,  0,  0,  0,  0,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,121,  0,  0,  0,
+/* 0x1ef0 */ 105,  0,  0,  0, 72,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x1f00 */ 192,  0,  0,  0,135,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */   0,  0,  0,  0,  3,  0,  0,  0,204,  0,  0,  0,135,  0,  0,  0,
+/* 0x1f20 */  80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x1f30 */ 152,  0,  0,  0,135,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */   0,  0,  0,  0,  5,  0,  0,  0,  4,  0,  0,  0,135,  0,  0,  0,
+/* 0x1f50 */  47,  0,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0, 77, 65, 67, 79,
+/* 0x1f60 */  83, 48, 48, 48,  0, 78, 82, 86, 95, 72, 69, 65, 68,  0, 78, 82,
+/* 0x1f70 */  86, 50, 69,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 66,  0,
+/* 0x1f80 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90, 77, 65, 95,
+/* 0x1f90 */  68, 69, 67, 51, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
+/* 0x1fa0 */   0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 78, 82, 86, 95,
+/* 0x1fb0 */  84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0, 69, 76, 70, 77,
+/* 0x1fc0 */  65, 73, 78, 89,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0, 95,115,
+/* 0x1fd0 */ 116, 97,114,116,  0, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76,
+/* 0x1fe0 */  50, 52,  0, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52,
+/* 0x1ff0 */   0, 92, 29,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* powerpc64-linux.elf-entry.h
-   created from powerpc64-linux.elf-entry.bin, 10480 (0x28f0) bytes
+   created from powerpc64-linux.elf-entry.bin, 8737 (0x2221) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC64_LINUX_ELF_ENTRY_SIZE    10480
-#define STUB_POWERPC64_LINUX_ELF_ENTRY_ADLER32 0x17dce92d
-#define STUB_POWERPC64_LINUX_ELF_ENTRY_CRC32   0x4d8ca754
+#define STUB_POWERPC64_LINUX_ELF_ENTRY_SIZE    8737
+#define STUB_POWERPC64_LINUX_ELF_ENTRY_ADLER32 0x3d441161
+#define STUB_POWERPC64_LINUX_ELF_ENTRY_CRC32   0xe67dca2b
 
-unsigned char stub_powerpc64_linux_elf_entry[10480] = {
+unsigned char stub_powerpc64_linux_elf_entry[8737] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   0,  1,  0, 21,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34, 24,
@@ -528,167 +528,59 @@ unsigned char stub_powerpc64_linux_elf_entry[10480] = {
 /* 0x1e90 */  75,255,255,105, 75,255,255,101,124,122, 27,120,232,  3,  0,  0,
 /* 0x1ea0 */ 232,131,  0,  8, 56, 99,  0, 16, 47,160,  0,  6, 65,222,  0, 16,
 /* 0x1eb0 */  44, 32,  0,  0, 64,226,255,232, 60,128,  0,  1,127,196,  0,208,
-/* 0x1ec0 */  75,255,254,145,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x1ed0 */ 109, 97,116, 32,101,108,102, 54, 52, 45,112,111,119,101,114,112,
-/* 0x1ee0 */  99, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,100,120,
-/* 0x1ef0 */  32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 83,
-/* 0x1f00 */ 105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32, 32, 32,
-/* 0x1f10 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65, 32, 32,
-/* 0x1f20 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,105,108,
-/* 0x1f30 */ 101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,108, 97,
-/* 0x1f40 */ 103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32,
-/* 0x1f50 */  32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1f60 */  52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x1f70 */  84, 83, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32,
-/* 0x1f80 */  32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52,
-/* 0x1f90 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1fa0 */  83, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32,
-/* 0x1fb0 */  32, 32, 32, 32, 48, 49, 53, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1fc0 */  48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1fd0 */  78, 84, 83, 10, 32, 32, 51, 32, 78, 82, 86, 50, 68, 32, 32, 32,
-/* 0x1fe0 */  32, 32, 32, 32, 32, 32, 48, 49, 52, 52, 32, 32, 48, 32, 32, 48,
-/* 0x1ff0 */  32, 32, 48, 49, 57, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2000 */  78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78, 82, 86, 50, 66,
-/* 0x2010 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 48,102, 56, 32, 32, 48, 32,
-/* 0x2020 */  32, 48, 32, 32, 48, 50,100, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2030 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 76, 90, 77,
-/* 0x2040 */  65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 57, 52, 32, 32,
-/* 0x2050 */  48, 32, 32, 48, 32, 32, 48, 51,100, 52, 32, 32, 50, 42, 42, 48,
-/* 0x2060 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54, 32, 76,
-/* 0x2070 */  90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48, 50, 56,
-/* 0x2080 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 54, 56, 32, 32, 50, 42,
-/* 0x2090 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 55,
-/* 0x20a0 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48,
-/* 0x20b0 */  98, 99, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 57, 48, 32,
-/* 0x20c0 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x20d0 */  32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32,
-/* 0x20e0 */  32, 32, 48, 99, 55, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x20f0 */  48, 53, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2100 */  78, 84, 83, 10, 32, 32, 57, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2110 */  32, 32, 32, 32, 32, 32, 48, 49, 99, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2120 */  32, 48, 49, 99, 99, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79,
-/* 0x2130 */  78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 67, 70, 76, 85, 83,
-/* 0x2140 */  72, 32, 32, 32, 32, 32, 32, 32, 32, 48, 50, 52, 32, 32, 48, 32,
-/* 0x2150 */  32, 48, 32, 32, 48, 49, 99,101, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x2160 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 69, 76,
-/* 0x2170 */  70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 49, 50, 32,
-/* 0x2180 */  32, 48, 32, 32, 48, 32, 32, 48, 49,100, 48, 52, 32, 32, 50, 42,
-/* 0x2190 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50,
-/* 0x21a0 */  32, 69, 76, 70, 77, 65, 73, 78, 90,101, 32, 32, 32, 32, 32, 48,
-/* 0x21b0 */  49, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100, 49, 56, 32,
-/* 0x21c0 */  32, 50, 42, 42, 51, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x21d0 */  32, 49, 51, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32,
-/* 0x21e0 */  32, 32, 48, 49, 57, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,
-/* 0x21f0 */ 100, 51, 48, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69,
-/* 0x2200 */  78, 84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69,
-/* 0x2210 */  58, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2220 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95,
-/* 0x2230 */  68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x2240 */  51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2250 */  48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95,
-/* 0x2260 */  84, 65, 73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10,
-/* 0x2270 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2280 */  32,108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2290 */  90, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48,
-/* 0x22a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x22b0 */  32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48,
-/* 0x22c0 */  32, 69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48,
-/* 0x22d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x22e0 */ 100, 32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82,
-/* 0x22f0 */  86, 95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2300 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2310 */  78, 82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48,
-/* 0x2320 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x2330 */  32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78,
-/* 0x2340 */  82, 86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2350 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82,
-/* 0x2360 */  86, 50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48,
-/* 0x2370 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2380 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32,
-/* 0x2390 */  48, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48,
-/* 0x23a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x23b0 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48,
-/* 0x23c0 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48,
-/* 0x23d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x23e0 */  32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50,
-/* 0x23f0 */  48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48,
-/* 0x2400 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2410 */ 108, 32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72, 32, 48,
-/* 0x2420 */  32, 67, 70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2430 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2440 */  32, 69, 76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77,
-/* 0x2450 */  65, 73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2460 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 69, 76,
-/* 0x2470 */  70, 77, 65, 73, 78, 90,101, 32, 48, 32, 69, 76, 70, 77, 65, 73,
-/* 0x2480 */  78, 90,101, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2490 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x24a0 */  77, 65, 73, 78, 88, 32, 48, 32, 95,115,116, 97,114,116, 10, 48,
-/* 0x24b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x24c0 */ 103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x24d0 */ 101, 32, 48, 32,101,110,116,114,121, 95,100,101,115, 99,114, 10,
-/* 0x24e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48,
-/* 0x2500 */  32, 79, 95, 66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65,
-/* 0x2510 */  84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82,
-/* 0x2520 */  32, 91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70,
-/* 0x2530 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x2540 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2550 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2560 */  48, 48, 48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82,
-/* 0x2570 */  69, 76, 50, 52, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2580 */  90, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2590 */  48, 48,100, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x25a0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82,
-/* 0x25b0 */  86, 50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32,
-/* 0x25c0 */  32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32,
-/* 0x25d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48,
-/* 0x25e0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 99, 48, 32,
-/* 0x25f0 */  82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32,
-/* 0x2600 */  32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79,
-/* 0x2610 */  67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70,
-/* 0x2620 */  79, 82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2630 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x2640 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2650 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2660 */  48, 48, 48, 99, 99, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69,
-/* 0x2670 */  76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76,
-/* 0x2680 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2690 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93,
-/* 0x26a0 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26b0 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x26c0 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x26d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95, 80, 80,
-/* 0x26e0 */  67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82,
-/* 0x26f0 */  86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2700 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x2710 */  76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70,
-/* 0x2720 */  83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89,
-/* 0x2730 */  80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2740 */  86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2750 */  48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82,
-/* 0x2760 */  69, 76, 49, 52, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69,
-/* 0x2770 */  67, 51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2780 */  48, 48, 48, 48, 50, 56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x2790 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x27a0 */  69, 76, 70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x27b0 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x27c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x27d0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x27e0 */  48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76,
-/* 0x27f0 */  50, 52, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10,
-/* 0x2800 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2810 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78,
-/* 0x2820 */  90,101, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x2830 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2840 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2850 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82,
-/* 0x2860 */  95, 80, 80, 67, 54, 52, 95, 65, 68, 68, 82, 54, 52, 32, 32, 32,
-/* 0x2870 */  32, 95,115,116, 97,114,116, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x2880 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x2890 */  91, 69, 76, 70, 77, 65, 73, 78, 90, 93, 58, 10, 79, 70, 70, 83,
-/* 0x28a0 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x28b0 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x28c0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x28d0 */  48, 48, 49, 57, 52, 32, 82, 95, 80, 80, 67, 54, 52, 95, 65, 68,
-/* 0x28e0 */  68, 82, 51, 50, 32, 32, 32, 32, 79, 95, 66, 73, 78, 70, 79, 10
+/* 0x1ec0 */  75,255,254,145,  0,  0,  0,  0, 14,  0,  0,  0, 17,  0,  0,  0,
+/* 0x1ed0 */   8,  0,  0,  0,209,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,
+/* 0x1ee0 */   4,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1ef0 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1f00 */  84,  1,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,152,  1,  0,  0,
+/* 0x1f10 */  68,  1,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,220,  2,  0,  0,
+/* 0x1f20 */ 248,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,212,  3,  0,  0,
+/* 0x1f30 */ 148,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,104,  4,  0,  0,
+/* 0x1f40 */  40,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,144,  4,  0,  0,
+/* 0x1f50 */ 192, 11,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 80, 16,  0,  0,
+/* 0x1f60 */ 116, 12,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,196, 28,  0,  0,
+/* 0x1f70 */  28,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,224, 28,  0,  0,
+/* 0x1f80 */  36,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,  4, 29,  0,  0,
+/* 0x1f90 */  18,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 24, 29,  0,  0,
+/* 0x1fa0 */  24,  0,  0,  0,  3,  0,  0,  0,115,  0,  0,  0, 48, 29,  0,  0,
+/* 0x1fb0 */ 152,  1,  0,  0,  2,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */ 115,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */  24,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x2010 */   4,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */  69,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x2040 */  10,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2060 */ 124,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,131,  0,  0,  0,
+/* 0x2070 */  12,  0,  0,  0,  0,  0,  0,  0,143,  0,  0,  0, 15,  0,  0,  0,
+/* 0x2080 */ 173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,151,  0,  0,  0,
+/* 0x2090 */ 115,  0,  0,  0,220,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+/* 0x20a0 */ 192,  0,  0,  0,165,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0,  3,  0,  0,  0,204,  0,  0,  0,165,  0,  0,  0,
+/* 0x20c0 */  80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+/* 0x20d0 */ 152,  0,  0,  0,165,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0,  5,  0,  0,  0,  4,  0,  0,  0,165,  0,  0,  0,
+/* 0x20f0 */  47,  0,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2100 */   0,  0,  0,  0,151,  0,  0,  0,115,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2110 */   0,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,179,  0,  0,  0,
+/* 0x2120 */ 124,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,
+/* 0x2130 */ 148,  1,  0,  0,194,  0,  0,  0,143,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2140 */   0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86,
+/* 0x2150 */  95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50,
+/* 0x2160 */  68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70,
+/* 0x2170 */  48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76, 90,
+/* 0x2180 */  77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x2190 */  67, 50, 48,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76,
+/* 0x21a0 */  85, 83, 72,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70,
+/* 0x21b0 */  77, 65, 73, 78, 90,101,  0, 69, 76, 70, 77, 65, 73, 78, 90,  0,
+/* 0x21c0 */  95,115,116, 97,114,116,  0,101,110,116,114,121, 95,100,101,115,
+/* 0x21d0 */  99,114,  0, 79, 95, 66, 73, 78, 70, 79,  0, 82, 95, 80, 80, 67,
+/* 0x21e0 */  54, 52, 95, 82, 69, 76, 50, 52,  0, 82, 95, 80, 80, 67, 54, 52,
+/* 0x21f0 */  95, 82, 69, 76, 49, 52,  0, 82, 95, 80, 80, 67, 54, 52, 95, 65,
+/* 0x2200 */  68, 68, 82, 54, 52,  0, 82, 95, 80, 80, 67, 54, 52, 95, 65, 68,
+/* 0x2210 */  68, 82, 51, 50,  0,200, 30,  0,  0, 85, 80, 88, 76, 78, 75, 48,
+/* 0x2220 */  49
 };
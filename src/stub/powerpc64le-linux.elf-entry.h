@@ -1,5 +1,5 @@
 /* powerpc64le-linux.elf-entry.h
-   created from powerpc64le-linux.elf-entry.bin, 10183 (0x27c7) bytes
+   created from powerpc64le-linux.elf-entry.bin, 8604 (0x219c) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_SIZE    10183
-#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_ADLER32 0x9a03ac5f
-#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_CRC32   0x0b4eb11a
+#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_SIZE    8604
+#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_ADLER32 0x79530192
+#define STUB_POWERPC64LE_LINUX_ELF_ENTRY_CRC32   0xc6bbb14c
 
-unsigned char stub_powerpc64le_linux_elf_entry[10183] = {
+unsigned char stub_powerpc64le_linux_elf_entry[8604] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 21,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0,144, 33,  0,  0,  0,  0,  0,  0,
@@ -526,151 +526,52 @@ unsigned char stub_powerpc64le_linux_elf_entry[10183] = {
 /* 0x1e70 */ 105,255,255, 75,101,255,255, 75,120, 27,122,124,  0,  0,  3,232,
 /* 0x1e80 */   8,  0,131,232, 16,  0, 99, 56,  6,  0,160, 47, 16,  0,222, 65,
 /* 0x1e90 */   0,  0, 32, 44,232,255,226, 64,  1,  0,128, 60,208,  0,196,127,
-/* 0x1ea0 */ 145,254,255, 75,  0,  0,  0,  0,102,105,108,101, 32,102,111,114,
-/* 0x1eb0 */ 109, 97,116, 32,101,108,102, 54, 52, 45,112,111,119,101,114,112,
-/* 0x1ec0 */  99,108,101, 10, 10, 83,101, 99,116,105,111,110,115, 58, 10, 73,
-/* 0x1ed0 */ 100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1ee0 */  32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86, 77, 65, 32, 32,
-/* 0x1ef0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 76, 77, 65,
-/* 0x1f00 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 70,
-/* 0x1f10 */ 105,108,101, 32,111,102,102, 32, 32, 65,108,103,110, 32, 32, 70,
-/* 0x1f20 */ 108, 97,103,115, 10, 32, 32, 48, 32, 69, 76, 70, 77, 65, 73, 78,
-/* 0x1f30 */  88, 32, 32, 32, 32, 32, 32, 48, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x1f40 */  32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84,
-/* 0x1f50 */  69, 78, 84, 83, 10, 32, 32, 49, 32, 78, 82, 86, 95, 72, 69, 65,
-/* 0x1f60 */  68, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x1f70 */  48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1f80 */  78, 84, 83, 10, 32, 32, 50, 32, 78, 82, 86, 50, 69, 32, 32, 32,
-/* 0x1f90 */  32, 32, 32, 32, 32, 32, 48, 49, 53, 52, 32, 32, 48, 32, 32, 48,
-/* 0x1fa0 */  32, 32, 48, 52, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x1fb0 */  84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 78, 82, 86, 50, 68, 32,
-/* 0x1fc0 */  32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 52, 52, 32, 32, 48, 32,
-/* 0x1fd0 */  32, 48, 32, 32, 48, 49, 57, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1fe0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78, 82, 86,
-/* 0x1ff0 */  50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,102, 56, 32, 32,
-/* 0x2000 */  48, 32, 32, 48, 32, 32, 48, 50,100, 99, 32, 32, 50, 42, 42, 48,
-/* 0x2010 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 76,
-/* 0x2020 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 32, 32, 32, 48, 57, 52,
-/* 0x2030 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 51,100, 52, 32, 32, 50, 42,
-/* 0x2040 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54,
-/* 0x2050 */  32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 32, 32, 32, 48,
-/* 0x2060 */  50, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 54, 56, 32, 32,
-/* 0x2070 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2080 */  32, 55, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 32, 32,
-/* 0x2090 */  32, 48, 98, 98, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 57,
-/* 0x20a0 */  48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x20b0 */  83, 10, 32, 32, 56, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x20c0 */  32, 32, 32, 32, 48, 99, 55, 52, 32, 32, 48, 32, 32, 48, 32, 32,
-/* 0x20d0 */  48, 49, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x20e0 */  84, 69, 78, 84, 83, 10, 32, 32, 57, 32, 78, 82, 86, 95, 84, 65,
-/* 0x20f0 */  73, 76, 32, 32, 32, 32, 32, 32, 48, 49, 99, 32, 32, 48, 32, 32,
-/* 0x2100 */  48, 32, 32, 48, 49, 99, 98, 99, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x2110 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 48, 32, 67, 70, 76,
-/* 0x2120 */  85, 83, 72, 32, 32, 32, 32, 32, 32, 32, 32, 48, 50, 52, 32, 32,
-/* 0x2130 */  48, 32, 32, 48, 32, 32, 48, 49, 99,100, 56, 32, 32, 50, 42, 42,
-/* 0x2140 */  48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 49, 32,
-/* 0x2150 */  69, 76, 70, 77, 65, 73, 78, 89, 32, 32, 32, 32, 32, 32, 48, 49,
-/* 0x2160 */  50, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 99,102, 99, 32, 32,
-/* 0x2170 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x2180 */  49, 50, 32, 69, 76, 70, 77, 65, 73, 78, 90, 32, 32, 32, 32, 32,
-/* 0x2190 */  32, 48, 49, 57, 56, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100,
-/* 0x21a0 */  49, 48, 32, 32, 50, 42, 42, 50, 32, 32, 67, 79, 78, 84, 69, 78,
-/* 0x21b0 */  84, 83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58,
-/* 0x21c0 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21d0 */  48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68,
-/* 0x21e0 */  69, 67, 51, 48, 32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51,
-/* 0x21f0 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2200 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 95, 84,
-/* 0x2210 */  65, 73, 76, 32, 48, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 48,
-/* 0x2220 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2230 */ 108, 32, 32, 32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x2240 */  32, 48, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 48, 48, 48, 48,
-/* 0x2250 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2260 */  32, 32,100, 32, 32, 69, 76, 70, 77, 65, 73, 78, 88, 32, 48, 32,
-/* 0x2270 */  69, 76, 70, 77, 65, 73, 78, 88, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2280 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2290 */  32, 32, 78, 82, 86, 95, 72, 69, 65, 68, 32, 48, 32, 78, 82, 86,
-/* 0x22a0 */  95, 72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22b0 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78,
-/* 0x22c0 */  82, 86, 50, 69, 32, 48, 32, 78, 82, 86, 50, 69, 10, 48, 48, 48,
-/* 0x22d0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x22e0 */  32, 32, 32,100, 32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82,
-/* 0x22f0 */  86, 50, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2300 */  48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86,
-/* 0x2310 */  50, 66, 32, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48,
-/* 0x2320 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32,
-/* 0x2330 */  32,100, 32, 32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 32, 48,
-/* 0x2340 */  32, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48, 10, 48, 48, 48, 48,
-/* 0x2350 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32,
-/* 0x2360 */  32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 32,
-/* 0x2370 */  48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 49, 48, 10, 48, 48, 48,
-/* 0x2380 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2390 */  32, 32, 32,100, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,
-/* 0x23a0 */  32, 48, 32, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 10, 48, 48,
-/* 0x23b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108,
-/* 0x23c0 */  32, 32, 32, 32,100, 32, 32, 67, 70, 76, 85, 83, 72, 32, 48, 32,
-/* 0x23d0 */  67, 70, 76, 85, 83, 72, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23e0 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x23f0 */  69, 76, 70, 77, 65, 73, 78, 89, 32, 48, 32, 69, 76, 70, 77, 65,
-/* 0x2400 */  73, 78, 89, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2410 */  48, 48, 48, 48, 32,103, 32, 32, 32, 32, 32, 32, 32, 69, 76, 70,
-/* 0x2420 */  77, 65, 73, 78, 88, 32, 48, 32, 95,115,116, 97,114,116, 10, 48,
-/* 0x2430 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,
-/* 0x2440 */  32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78, 68, 42, 32, 48, 32,
-/* 0x2450 */  79, 95, 66, 73, 78, 70, 79, 10, 10, 82, 69, 76, 79, 67, 65, 84,
-/* 0x2460 */  73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32,
-/* 0x2470 */  91, 69, 76, 70, 77, 65, 73, 78, 88, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2480 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x2490 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x24a0 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24b0 */  48, 48, 48, 48, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69,
-/* 0x24c0 */  76, 50, 52, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x24d0 */  43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24e0 */  48,100, 99, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32,
-/* 0x24f0 */  82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86,
-/* 0x2500 */  50, 69, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32,
-/* 0x2510 */  32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32,
-/* 0x2520 */  32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48,
-/* 0x2530 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 99, 48, 32, 82,
-/* 0x2540 */  95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32,
-/* 0x2550 */  32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67,
-/* 0x2560 */  65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79,
-/* 0x2570 */  82, 32, 91, 78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69,
-/* 0x2580 */  84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69,
-/* 0x2590 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65,
-/* 0x25a0 */  76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x25b0 */  48, 48, 99, 99, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76,
-/* 0x25c0 */  49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10,
-/* 0x25d0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x25e0 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93, 58,
-/* 0x25f0 */  10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2600 */  32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2610 */  32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2620 */  48, 48, 48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95, 80, 80, 67,
-/* 0x2630 */  54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86,
-/* 0x2640 */  95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x2650 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76,
-/* 0x2660 */  90, 77, 65, 95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83,
-/* 0x2670 */  69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80,
-/* 0x2680 */  69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86,
-/* 0x2690 */  65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26a0 */  48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69,
-/* 0x26b0 */  76, 49, 52, 32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67,
-/* 0x26c0 */  51, 48, 43, 48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x26d0 */  48, 48, 48, 50, 56, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79,
-/* 0x26e0 */  78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 69,
-/* 0x26f0 */  76, 70, 77, 65, 73, 78, 89, 93, 58, 10, 79, 70, 70, 83, 69, 84,
-/* 0x2700 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32,
-/* 0x2710 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76,
-/* 0x2720 */  85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2730 */  48, 48, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 50,
-/* 0x2740 */  52, 32, 32, 32, 32, 32, 69, 76, 70, 77, 65, 73, 78, 90, 10, 10,
-/* 0x2750 */  82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82,
-/* 0x2760 */  68, 83, 32, 70, 79, 82, 32, 91, 69, 76, 70, 77, 65, 73, 78, 90,
-/* 0x2770 */  93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2780 */  32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2790 */  32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48,
-/* 0x27a0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 57, 52, 32, 82, 95, 80,
-/* 0x27b0 */  80, 67, 54, 52, 95, 65, 68, 68, 82, 51, 50, 32, 32, 32, 32, 79,
-/* 0x27c0 */  95, 66, 73, 78, 70, 79, 10
+/* 0x1ea0 */ 145,254,255, 75,  0,  0,  0,  0, 13,  0,  0,  0, 15,  0,  0,  0,
+/* 0x1eb0 */   7,  0,  0,  0,172,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,
+/* 0x1ec0 */   4,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0, 68,  0,  0,  0,
+/* 0x1ee0 */  84,  1,  0,  0,  0,  0,  0,  0, 24,  0,  0,  0,152,  1,  0,  0,
+/* 0x1ef0 */  68,  1,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,220,  2,  0,  0,
+/* 0x1f00 */ 248,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,212,  3,  0,  0,
+/* 0x1f10 */ 148,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,104,  4,  0,  0,
+/* 0x1f20 */  40,  0,  0,  0,  0,  0,  0,  0, 58,  0,  0,  0,144,  4,  0,  0,
+/* 0x1f30 */ 184, 11,  0,  0,  0,  0,  0,  0, 69,  0,  0,  0, 72, 16,  0,  0,
+/* 0x1f40 */ 116, 12,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,188, 28,  0,  0,
+/* 0x1f50 */  28,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,216, 28,  0,  0,
+/* 0x1f60 */  36,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0,252, 28,  0,  0,
+/* 0x1f70 */  18,  0,  0,  0,  0,  0,  0,  0,105,  0,  0,  0, 16, 29,  0,  0,
+/* 0x1f80 */ 152,  1,  0,  0,  2,  0,  0,  0, 47,  0,  0,  0,  6,  0,  0,  0,
+/* 0x1f90 */   0,  0,  0,  0, 80,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */ 105,  0,  0,  0, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1fc0 */   0,  0,  0,  0, 18,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */  24,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,
+/* 0x1fe0 */   4,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  5,  0,  0,  0,
+/* 0x1ff0 */   0,  0,  0,  0, 58,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */  69,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 89,  0,  0,  0,
+/* 0x2010 */  10,  0,  0,  0,  0,  0,  0,  0, 96,  0,  0,  0, 11,  0,  0,  0,
+/* 0x2020 */   0,  0,  0,  0,114,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2030 */ 121,  0,  0,  0, 14,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,
+/* 0x2040 */   0,  0,  0,  0,129,  0,  0,  0,105,  0,  0,  0,220,  0,  0,  0,
+/* 0x2050 */   0,  0,  0,  0,  2,  0,  0,  0,192,  0,  0,  0,143,  0,  0,  0,
+/* 0x2060 */  80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+/* 0x2070 */ 204,  0,  0,  0,143,  0,  0,  0, 80,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2080 */   0,  0,  0,  0,  4,  0,  0,  0,152,  0,  0,  0,143,  0,  0,  0,
+/* 0x2090 */  80,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,
+/* 0x20a0 */   4,  0,  0,  0,143,  0,  0,  0, 47,  0,  0,  0, 40,  0,  0,  0,
+/* 0x20b0 */   0,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,129,  0,  0,  0,
+/* 0x20c0 */ 105,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0,
+/* 0x20d0 */ 148,  1,  0,  0,157,  0,  0,  0,121,  0,  0,  0,  0,  0,  0,  0,
+/* 0x20e0 */   0,  0,  0,  0, 69, 76, 70, 77, 65, 73, 78, 88,  0, 78, 82, 86,
+/* 0x20f0 */  95, 72, 69, 65, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82, 86, 50,
+/* 0x2100 */  68,  0, 78, 82, 86, 50, 66,  0, 76, 90, 77, 65, 95, 69, 76, 70,
+/* 0x2110 */  48, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48,  0, 76, 90,
+/* 0x2120 */  77, 65, 95, 68, 69, 67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x2130 */  67, 50, 48,  0, 78, 82, 86, 95, 84, 65, 73, 76,  0, 67, 70, 76,
+/* 0x2140 */  85, 83, 72,  0, 69, 76, 70, 77, 65, 73, 78, 89,  0, 69, 76, 70,
+/* 0x2150 */  77, 65, 73, 78, 90,  0, 95,115,116, 97,114,116,  0, 79, 95, 66,
+/* 0x2160 */  73, 78, 70, 79,  0, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76,
+/* 0x2170 */  50, 52,  0, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52,
+/* 0x2180 */   0, 82, 95, 80, 80, 67, 54, 52, 95, 65, 68, 68, 82, 51, 50,  0,
+/* 0x2190 */ 168, 30,  0,  0, 85, 80, 88, 76, 78, 75, 48, 49
 };
@@ -1,5 +1,5 @@
 /* powerpc64le-linux.kernel.vmlinux.h
-   created from powerpc64le-linux.kernel.vmlinux.bin, 10035 (0x2733) bytes
+   created from powerpc64le-linux.kernel.vmlinux.bin, 8424 (0x20e8) bytes
 
    This file is part of the UPX executable compressor.
 
@@ -31,11 +31,11 @@
  */
 
 
-#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_SIZE    10035
-#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_ADLER32 0xd2824cf1
-#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_CRC32   0x38edae70
+#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_SIZE    8424
+#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_ADLER32 0xe24e92ed
+#define STUB_POWERPC64LE_LINUX_KERNEL_VMLINUX_CRC32   0x49768ab3
 
-unsigned char stub_powerpc64le_linux_kernel_vmlinux[10035] = {
+unsigned char stub_powerpc64le_linux_kernel_vmlinux[8424] = {
 /* 0x0000 */ 127, 69, 76, 70,  2,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0010 */   1,  0, 21,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
 /* 0x0020 */   0,  0,  0,  0,  0,  0,  0,  0, 72, 30,  0,  0,  0,  0,  0,  0,
@@ -508,160 +508,59 @@ unsigned char stub_powerpc64le_linux_kernel_vmlinux[10035] = {
 /* 0x1d50 */  32,  0,156,123, 32,  0, 74,121,152,254,255, 75,  0,  0,192, 58,
 /* 0x1d60 */  12,253,255, 75,  0,  0,  0,  0,  0,  0,  0,  0, 85, 80, 88, 33,
 /* 0x1d70 */ 161,216,208,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-/* 0x1d80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45,102,105,108,101,
-/* 0x1d90 */  32,102,111,114,109, 97,116, 32,101,108,102, 54, 52, 45,112,111,
-/* 0x1da0 */ 119,101,114,112, 99,108,101, 10, 10, 83,101, 99,116,105,111,110,
-/* 0x1db0 */ 115, 58, 10, 73,100,120, 32, 78, 97,109,101, 32, 32, 32, 32, 32,
-/* 0x1dc0 */  32, 32, 32, 32, 32, 83,105,122,101, 32, 32, 32, 32, 32, 32, 86,
-/* 0x1dd0 */  77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1de0 */  32, 76, 77, 65, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x1df0 */  32, 32, 32, 70,105,108,101, 32,111,102,102, 32, 32, 65,108,103,
-/* 0x1e00 */ 110, 32, 32, 70,108, 97,103,115, 10, 32, 32, 48, 32, 76, 73, 78,
-/* 0x1e10 */  85, 88, 48, 48, 48, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48,
-/* 0x1e20 */  32, 32, 48, 32, 32, 48, 52, 48, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e30 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 49, 32, 76, 73, 78,
-/* 0x1e40 */  85, 88, 48, 49, 48, 32, 32, 32, 32, 32, 32, 48, 56, 32, 32, 48,
-/* 0x1e50 */  32, 32, 48, 32, 32, 48, 52, 56, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1e60 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 50, 32, 76, 73, 78,
-/* 0x1e70 */  85, 88, 48, 50, 48, 32, 32, 32, 32, 32, 32, 48, 54, 52, 32, 32,
-/* 0x1e80 */  48, 32, 32, 48, 32, 32, 48, 53, 48, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1e90 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 51, 32, 76, 73,
-/* 0x1ea0 */  78, 85, 88, 48, 51, 48, 32, 32, 32, 32, 32, 32, 48, 32, 32, 48,
-/* 0x1eb0 */  32, 32, 48, 32, 32, 48, 98, 52, 32, 32, 50, 42, 42, 48, 32, 32,
-/* 0x1ec0 */  67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 52, 32, 78, 82, 86,
-/* 0x1ed0 */  50, 66, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,102, 56, 32, 32,
-/* 0x1ee0 */  48, 32, 32, 48, 32, 32, 48, 98, 52, 32, 32, 50, 42, 42, 48, 32,
-/* 0x1ef0 */  32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 53, 32, 78, 82,
-/* 0x1f00 */  86, 50, 68, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 49, 52, 52,
-/* 0x1f10 */  32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 97, 99, 32, 32, 50, 42,
-/* 0x1f20 */  42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 32, 54,
-/* 0x1f30 */  32, 78, 82, 86, 50, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48,
-/* 0x1f40 */  49, 53, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 50,102, 48, 32,
-/* 0x1f50 */  32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10,
-/* 0x1f60 */  32, 32, 55, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 32, 32, 32,
-/* 0x1f70 */  32, 32, 48, 49, 99, 32, 32, 48, 32, 32, 48, 32, 32, 48, 52, 52,
-/* 0x1f80 */  52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x1f90 */  83, 10, 32, 32, 56, 32, 67, 70, 76, 85, 83, 72, 32, 32, 32, 32,
-/* 0x1fa0 */  32, 32, 32, 32, 48, 50, 52, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1fb0 */  52, 54, 48, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1fc0 */  78, 84, 83, 10, 32, 32, 57, 32, 76, 90, 77, 65, 32, 32, 32, 32,
-/* 0x1fd0 */  32, 32, 32, 32, 32, 32, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48,
-/* 0x1fe0 */  52, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69,
-/* 0x1ff0 */  78, 84, 83, 10, 32, 49, 48, 32, 76, 90, 77, 65, 95, 69, 76, 70,
-/* 0x2000 */  48, 48, 32, 32, 32, 32, 48, 57, 52, 32, 32, 48, 32, 32, 48, 32,
-/* 0x2010 */  32, 48, 52, 56, 52, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78,
-/* 0x2020 */  84, 69, 78, 84, 83, 10, 32, 49, 49, 32, 76, 90, 77, 65, 95, 68,
-/* 0x2030 */  69, 67, 51, 48, 32, 32, 32, 32, 48, 50, 56, 32, 32, 48, 32, 32,
-/* 0x2040 */  48, 32, 32, 48, 53, 49, 56, 32, 32, 50, 42, 42, 48, 32, 32, 67,
-/* 0x2050 */  79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 50, 32, 76, 90, 77, 65,
-/* 0x2060 */  95, 68, 69, 67, 49, 48, 32, 32, 32, 32, 48, 98, 98, 56, 32, 32,
-/* 0x2070 */  48, 32, 32, 48, 32, 32, 48, 53, 52, 48, 32, 32, 50, 42, 42, 48,
-/* 0x2080 */  32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32, 49, 51, 32, 76,
-/* 0x2090 */  90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 32, 32, 32, 48, 99, 55,
-/* 0x20a0 */  52, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49, 48,102, 56, 32, 32,
-/* 0x20b0 */  50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84, 83, 10, 32,
-/* 0x20c0 */  49, 52, 32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 32, 32, 32, 32,
-/* 0x20d0 */  32, 48, 50, 48, 32, 32, 48, 32, 32, 48, 32, 32, 48, 49,100, 54,
-/* 0x20e0 */  99, 32, 32, 50, 42, 42, 48, 32, 32, 67, 79, 78, 84, 69, 78, 84,
-/* 0x20f0 */  83, 10, 83, 89, 77, 66, 79, 76, 32, 84, 65, 66, 76, 69, 58, 10,
-/* 0x2100 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2110 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88, 48, 50,
-/* 0x2120 */  48, 32, 48, 32, 76, 73, 78, 85, 88, 48, 50, 48, 10, 48, 48, 48,
-/* 0x2130 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32,
-/* 0x2140 */  32, 32, 32,100, 32, 32, 76, 73, 78, 85, 88, 48, 51, 48, 32, 48,
-/* 0x2150 */  32, 76, 73, 78, 85, 88, 48, 51, 48, 10, 48, 48, 48, 48, 48, 48,
-/* 0x2160 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,
-/* 0x2170 */ 100, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 32, 48, 32, 78, 82,
-/* 0x2180 */  86, 95, 84, 65, 73, 76, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2190 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x21a0 */  76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 32, 48, 32, 76, 90, 77,
-/* 0x21b0 */  65, 95, 68, 69, 67, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21c0 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x21d0 */  32, 76, 73, 78, 85, 88, 48, 48, 48, 32, 48, 32, 76, 73, 78, 85,
-/* 0x21e0 */  88, 48, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x21f0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 73,
-/* 0x2200 */  78, 85, 88, 48, 49, 48, 32, 48, 32, 76, 73, 78, 85, 88, 48, 49,
-/* 0x2210 */  48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2220 */  48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 66,
-/* 0x2230 */  32, 48, 32, 78, 82, 86, 50, 66, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2240 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100,
-/* 0x2250 */  32, 32, 78, 82, 86, 50, 68, 32, 48, 32, 78, 82, 86, 50, 68, 10,
-/* 0x2260 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2270 */  32,108, 32, 32, 32, 32,100, 32, 32, 78, 82, 86, 50, 69, 32, 48,
-/* 0x2280 */  32, 78, 82, 86, 50, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2290 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x22a0 */  67, 70, 76, 85, 83, 72, 32, 48, 32, 67, 70, 76, 85, 83, 72, 10,
-/* 0x22b0 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22c0 */  32,108, 32, 32, 32, 32,100, 32, 32, 76, 90, 77, 65, 32, 48, 32,
-/* 0x22d0 */  76, 90, 77, 65, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x22e0 */  48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76, 90,
-/* 0x22f0 */  77, 65, 95, 69, 76, 70, 48, 48, 32, 48, 32, 76, 90, 77, 65, 95,
-/* 0x2300 */  69, 76, 70, 48, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2310 */  48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32, 76,
-/* 0x2320 */  90, 77, 65, 95, 68, 69, 67, 49, 48, 32, 48, 32, 76, 90, 77, 65,
-/* 0x2330 */  95, 68, 69, 67, 49, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2340 */  48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32, 32,
-/* 0x2350 */  76, 90, 77, 65, 95, 68, 69, 67, 50, 48, 32, 48, 32, 76, 90, 77,
-/* 0x2360 */  65, 95, 68, 69, 67, 50, 48, 10, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2370 */  48, 48, 48, 48, 48, 48, 48, 48, 32,108, 32, 32, 32, 32,100, 32,
-/* 0x2380 */  32, 85, 80, 88, 49, 72, 69, 65, 68, 32, 48, 32, 85, 80, 88, 49,
-/* 0x2390 */  72, 69, 65, 68, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23a0 */  48, 48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85,
-/* 0x23b0 */  78, 68, 42, 32, 48, 32,102,105,108,116,101,114, 95,108,101,110,
-/* 0x23c0 */ 103,116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x23d0 */  48, 48, 48, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32, 42, 85, 78,
-/* 0x23e0 */  68, 42, 32, 48, 32,102,105,108,116,101,114, 95, 99,116,111, 10,
-/* 0x23f0 */  10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79,
-/* 0x2400 */  82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 73, 78, 85, 88, 48, 48,
-/* 0x2410 */  48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32,
-/* 0x2420 */  32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2430 */  32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48,
-/* 0x2440 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 32, 82, 95,
-/* 0x2450 */  80, 80, 67, 54, 52, 95, 82, 69, 76, 50, 52, 32, 32, 32, 32, 32,
-/* 0x2460 */  76, 73, 78, 85, 88, 48, 51, 48, 10, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2470 */  48, 48, 48, 48, 48, 48, 48, 48, 52, 32, 82, 95, 80, 80, 67, 54,
-/* 0x2480 */  52, 95, 82, 69, 76, 50, 52, 32, 32, 32, 32, 32, 76, 73, 78, 85,
-/* 0x2490 */  88, 48, 50, 48, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78,
-/* 0x24a0 */  32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 73,
-/* 0x24b0 */  78, 85, 88, 48, 49, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x24c0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x24d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x24e0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x24f0 */  48, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95, 65, 68, 68, 82, 51,
-/* 0x2500 */  50, 32, 32, 32, 32,102,105,108,116,101,114, 95,108,101,110,103,
-/* 0x2510 */ 116,104, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2520 */  48, 48, 52, 32, 82, 95, 80, 80, 67, 54, 52, 95, 65, 68, 68, 82,
-/* 0x2530 */  51, 50, 32, 32, 32, 32,102,105,108,116,101,114, 95, 99,116,111,
-/* 0x2540 */  10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67,
-/* 0x2550 */  79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 66, 93,
-/* 0x2560 */  58, 10, 79, 70, 70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2570 */  32, 32, 32, 84, 89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2580 */  32, 32, 32, 32, 32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48,
-/* 0x2590 */  48, 48, 48, 48, 48, 48, 48, 48, 48, 57, 56, 32, 82, 95, 80, 80,
-/* 0x25a0 */  67, 54, 52, 95, 82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82,
-/* 0x25b0 */  86, 95, 84, 65, 73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73,
-/* 0x25c0 */  79, 78, 32, 82, 69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91,
-/* 0x25d0 */  78, 82, 86, 50, 68, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32, 32,
-/* 0x25e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32, 32,
-/* 0x25f0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85, 69,
-/* 0x2600 */  10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 99,
-/* 0x2610 */  99, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52, 32,
-/* 0x2620 */  32, 32, 32, 32, 78, 82, 86, 95, 84, 65, 73, 76, 10, 10, 82, 69,
-/* 0x2630 */  76, 79, 67, 65, 84, 73, 79, 78, 32, 82, 69, 67, 79, 82, 68, 83,
-/* 0x2640 */  32, 70, 79, 82, 32, 91, 78, 82, 86, 50, 69, 93, 58, 10, 79, 70,
-/* 0x2650 */  70, 83, 69, 84, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84,
-/* 0x2660 */  89, 80, 69, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-/* 0x2670 */  32, 86, 65, 76, 85, 69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2680 */  48, 48, 48, 48, 48, 99, 48, 32, 82, 95, 80, 80, 67, 54, 52, 95,
-/* 0x2690 */  82, 69, 76, 49, 52, 32, 32, 32, 32, 32, 78, 82, 86, 95, 84, 65,
-/* 0x26a0 */  73, 76, 10, 10, 82, 69, 76, 79, 67, 65, 84, 73, 79, 78, 32, 82,
-/* 0x26b0 */  69, 67, 79, 82, 68, 83, 32, 70, 79, 82, 32, 91, 76, 90, 77, 65,
-/* 0x26c0 */  95, 69, 76, 70, 48, 48, 93, 58, 10, 79, 70, 70, 83, 69, 84, 32,
-/* 0x26d0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 84, 89, 80, 69, 32, 32,
-/* 0x26e0 */  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 86, 65, 76, 85,
-/* 0x26f0 */  69, 10, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2700 */  48, 52, 32, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52,
-/* 0x2710 */  32, 32, 32, 32, 32, 76, 90, 77, 65, 95, 68, 69, 67, 51, 48, 43,
-/* 0x2720 */  48,120, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-/* 0x2730 */  50, 56, 10
+/* 0x1d80 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45, 15,  0,  0,  0,
+/* 0x1d90 */  17,  0,  0,  0,  8,  0,  0,  0,196,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1da0 */  64,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,
+/* 0x1db0 */  72,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1dc0 */  80,  0,  0,  0,100,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,
+/* 0x1dd0 */ 180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,
+/* 0x1de0 */ 180,  0,  0,  0,248,  0,  0,  0,  0,  0,  0,  0, 42,  0,  0,  0,
+/* 0x1df0 */ 172,  1,  0,  0, 68,  1,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,
+/* 0x1e00 */ 240,  2,  0,  0, 84,  1,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,
+/* 0x1e10 */  68,  4,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,
+/* 0x1e20 */  96,  4,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,
+/* 0x1e30 */ 132,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 75,  0,  0,  0,
+/* 0x1e40 */ 132,  4,  0,  0,148,  0,  0,  0,  0,  0,  0,  0, 86,  0,  0,  0,
+/* 0x1e50 */  24,  5,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0,
+/* 0x1e60 */  64,  5,  0,  0,184, 11,  0,  0,  0,  0,  0,  0,108,  0,  0,  0,
+/* 0x1e70 */ 248, 16,  0,  0,116, 12,  0,  0,  0,  0,  0,  0,119,  0,  0,  0,
+/* 0x1e80 */ 108, 29,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1e90 */   2,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  3,  0,  0,  0,
+/* 0x1ea0 */   0,  0,  0,  0, 54,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1eb0 */  86,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ec0 */   0,  0,  0,  0,  0,  0,  0,  0,  9,  0,  0,  0,  1,  0,  0,  0,
+/* 0x1ed0 */   0,  0,  0,  0, 36,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1ee0 */  42,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,
+/* 0x1ef0 */   6,  0,  0,  0,  0,  0,  0,  0, 63,  0,  0,  0,  8,  0,  0,  0,
+/* 0x1f00 */   0,  0,  0,  0, 70,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f10 */  75,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 97,  0,  0,  0,
+/* 0x1f20 */  12,  0,  0,  0,  0,  0,  0,  0,108,  0,  0,  0, 13,  0,  0,  0,
+/* 0x1f30 */   0,  0,  0,  0,119,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f40 */ 128,  0,  0,  0, 16,  0,  0,  0,173,222,173,222,142,  0,  0,  0,
+/* 0x1f50 */  16,  0,  0,  0,173,222,173,222,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f60 */ 153,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f70 */   0,  0,  0,  0,  4,  0,  0,  0,153,  0,  0,  0, 18,  0,  0,  0,
+/* 0x1f80 */   0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1f90 */ 167,  0,  0,  0,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fa0 */   1,  0,  0,  0,  4,  0,  0,  0,167,  0,  0,  0,142,  0,  0,  0,
+/* 0x1fb0 */   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,152,  0,  0,  0,
+/* 0x1fc0 */ 182,  0,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x1fd0 */   5,  0,  0,  0,204,  0,  0,  0,182,  0,  0,  0, 54,  0,  0,  0,
+/* 0x1fe0 */   0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,192,  0,  0,  0,
+/* 0x1ff0 */ 182,  0,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/* 0x2000 */  10,  0,  0,  0,  4,  0,  0,  0,182,  0,  0,  0, 86,  0,  0,  0,
+/* 0x2010 */  40,  0,  0,  0,  0,  0,  0,  0, 76, 73, 78, 85, 88, 48, 48, 48,
+/* 0x2020 */   0, 76, 73, 78, 85, 88, 48, 49, 48,  0, 76, 73, 78, 85, 88, 48,
+/* 0x2030 */  50, 48,  0, 76, 73, 78, 85, 88, 48, 51, 48,  0, 78, 82, 86, 50,
+/* 0x2040 */  66,  0, 78, 82, 86, 50, 68,  0, 78, 82, 86, 50, 69,  0, 78, 82,
+/* 0x2050 */  86, 95, 84, 65, 73, 76,  0, 67, 70, 76, 85, 83, 72,  0, 76, 90,
+/* 0x2060 */  77, 65,  0, 76, 90, 77, 65, 95, 69, 76, 70, 48, 48,  0, 76, 90,
+/* 0x2070 */  77, 65, 95, 68, 69, 67, 51, 48,  0, 76, 90, 77, 65, 95, 68, 69,
+/* 0x2080 */  67, 49, 48,  0, 76, 90, 77, 65, 95, 68, 69, 67, 50, 48,  0, 85,
+/* 0x2090 */  80, 88, 49, 72, 69, 65, 68,  0,102,105,108,116,101,114, 95,108,
+/* 0x20a0 */ 101,110,103,116,104,  0,102,105,108,116,101,114, 95, 99,116,111,
+/* 0x20b0 */   0, 82, 95, 80, 80, 67, 54, 52, 95, 82, 69, 76, 50, 52,  0, 82,
+/* 0x20c0 */  95, 80, 80, 67, 54, 52, 95, 65, 68, 68, 82, 51, 50,  0, 82, 95,
+/* 0x20d0 */  80, 80, 67, 54, 52, 95, 82, 69, 76, 49, 52,  0,140, 29,  0,  0,
+/* 0x20e0 */  85, 80, 88, 76, 78, 75, 48, 49
 };
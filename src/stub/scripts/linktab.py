@@ -0,0 +1,202 @@
+#! /usr/bin/env python2
+## vim:set ts=4 sw=4 et: -*- coding: utf-8 -*-
+#
+#  linktab.py -- convert an "objdump -htr" listing into ElfLinker tables
+#
+#  This file is part of the UPX executable compressor.
+#
+#  Copyright (C) 1996-2023 Markus Franz Xaver Johannes Oberhumer
+#  All Rights Reserved.
+#
+#  UPX and the UCL library are free software; you can redistribute them
+#  and/or modify them under the terms of the GNU General Public License as
+#  published by the Free Software Foundation; either version 2 of
+#  the License, or (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program; see the file COPYING.
+#  If not, write to the Free Software Foundation, Inc.,
+#  59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+#
+#  Markus F.X.J. Oberhumer              Laszlo Molnar
+#  <markus@oberhumer.com>               <ezerotven+github@gmail.com>
+#
+
+
+import getopt, os, re, struct, sys
+
+
+class opts:
+    dry_run = 0
+    verbose = 0
+
+
+# /***********************************************************************
+# // parse the listing - this must match the sscanf() formats of
+# // ElfLinker::preprocessSections/Symbols/Relocations in src/linker.cpp
+# ************************************************************************/
+
+HEX = r"(?:0[xX])?([0-9a-fA-F]+)(?![0-9a-fA-F])"
+RE_SECTION = re.compile(r"\s*[-+]?\d+(?!\d)\s*(\S+)\s*" + HEX + r"\s*" + HEX + r"\s*" + HEX +
+                        r"\s*" + HEX + r"\s*2\*\*([-+]?\d+)")
+RE_SYMBOL_ABS = re.compile(r"\s*" + HEX + r"\s*g\s*\*ABS\*\s*" + HEX + r"\s*(\S+)")
+RE_SYMBOL_HEAD = re.compile(r"\s*" + HEX)
+RE_SYMBOL_TAIL = re.compile(r"\s*(\S+)\s*" + HEX + r"\s*(\S+)")
+RE_RELOC_SECTION = re.compile(r"RELOCATION\s*RECORDS\s*FOR\s*\[([^\]]+)")
+RE_RELOC = re.compile(r"\s*" + HEX + r"\s*(\S+)\s*(\S+)")
+
+
+def u32(s):
+    return int(s, 16) & 0xffffffff
+
+
+def parse_listing(d):
+    sections, symbols, relocs = [], [], []
+    if len(d) <= len("Sections:\nSYMBOL TABLE:\nRELOCATION RECORDS FOR "):
+        return sections, symbols, relocs
+    psections = d.find("Sections:\n")
+    assert psections >= 0, "no sections"
+    psymbols = d.find("SYMBOL TABLE:\n", psections)
+    prelocs = d.find("RELOCATION RECORDS FOR ", psymbols if psymbols >= 0 else psections)
+    eof = len(d)
+    end = psymbols if psymbols >= 0 else (prelocs if prelocs >= 0 else eof)
+    for l in d[psections:end].split("\n"):
+        m = RE_SECTION.match(l)
+        if m:
+            sections.append((m.group(1), u32(m.group(2)), u32(m.group(5)), int(m.group(6))))
+    section_names = [s[0] for s in sections] + ["*ABS*", "*UND*"]
+    if psymbols >= 0:
+        for l in d[psymbols:(prelocs if prelocs >= 0 else eof)].split("\n"):
+            m = RE_SYMBOL_ABS.match(l)
+            if m:
+                assert u32(m.group(2)) == 0, l
+                symbols.append((m.group(3), "*ABS*", u32(m.group(1))))
+                continue
+            m = RE_SYMBOL_HEAD.match(l)
+            if not m or len(l) < m.end() + 8:
+                continue
+            t = RE_SYMBOL_TAIL.match(l, m.end() + 8)
+            if t:
+                section, offset = t.group(1), u32(m.group(1))
+                if section == "*UND*":
+                    offset = 0xdeaddead
+                assert section != "*ABS*", l
+                assert section in section_names, ("unknown section", l)
+                symbols.append((t.group(3), section, offset))
+    if prelocs >= 0:
+        symbol_names = set([s[0] for s in symbols])
+        section = None
+        for l in d[prelocs:].split("\n"):
+            m = RE_RELOC_SECTION.match(l)
+            if m:
+                section = m.group(1)
+                assert section in section_names, ("unknown section", l)
+            m = RE_RELOC.match(l)
+            if not m:
+                continue
+            offset, rtype, symbol = u32(m.group(1)), m.group(2)[:99], m.group(3)
+            add = 0
+            p = symbol.find("+0x")
+            if p < 0:
+                p = symbol.find("-0x")
+            if p >= 0:
+                sign, v = symbol[p], symbol[p+3:]
+                symbol = symbol[:p]
+                assert len(v) in [8, 16], l
+                add = int(v, 16)
+                if sign == "-":
+                    add = (0 - add) & 0xffffffffffffffff
+            if section is not None:
+                assert symbol in symbol_names, ("unknown symbol", l)
+                relocs.append((section, offset, rtype, symbol, add))
+    return sections, symbols, relocs
+
+
+# /***********************************************************************
+# // write the tables
+#
+# All values are little endian. The tables follow the object file, and
+# a trailer at the very end of the stub locates them:
+#   LE32 nsections, nsymbols, nrelocations, strings_size
+#   sections:    LE32 name, offset, size, p2align
+#   symbols:     LE32 name, section, offset
+#   relocations: LE32 section, offset, type, symbol; LE64 add
+#   strings:     NUL terminated
+#   trailer:     LE32 tables_offset; "UPXLNK01"
+# Names are offsets into the strings, sections are indices where
+# nsections and nsections+1 denote "*ABS*" and "*UND*".
+# ************************************************************************/
+
+MAGIC = "UPXLNK01"
+
+
+def encode_tables(sections, symbols, relocs, tables_offset):
+    strings, string_pos = [], {}
+    def s(name):
+        if name not in string_pos:
+            string_pos[name] = sum(map(len, strings))
+            strings.append(name + "\0")
+        return string_pos[name]
+    section_index = {"*ABS*": len(sections), "*UND*": len(sections) + 1}
+    for i in range(len(sections) - 1, -1, -1):
+        section_index[sections[i][0]] = i
+    t = []
+    for name, size, offset, p2align in sections:
+        assert offset + size <= tables_offset, (name, offset, size)
+        t.append(struct.pack("<IIII", s(name), offset, size, p2align & 0xffffffff))
+    for name, section, offset in symbols:
+        t.append(struct.pack("<III", s(name), section_index[section], offset))
+    for section, offset, rtype, symbol, add in relocs:
+        t.append(struct.pack("<IIIIQ", section_index[section], offset, s(rtype), s(symbol), add))
+    strings = "".join(strings)
+    head = struct.pack("<IIII", len(sections), len(symbols), len(relocs), len(strings))
+    return head + b"".join(t) + strings.encode("latin-1") + \
+           struct.pack("<I", tables_offset) + MAGIC.encode("latin-1")
+
+
+def convert(listing, tables_offset):
+    sections, symbols, relocs = parse_listing(listing)
+    if opts.verbose > 0:
+        print("linktab: %d sections, %d symbols, %d relocations" %
+              (len(sections), len(symbols), len(relocs)))
+    return encode_tables(sections, symbols, relocs, tables_offset)
+
+
+# /***********************************************************************
+# // main
+# ************************************************************************/
+
+def main(argv):
+    try: assert 0
+    except AssertionError: pass
+    else: raise Exception("fatal error - assertions not enabled")
+    shortopts, longopts = "qv", [
+        "dry-run", "quiet", "verbose"
+    ]
+    xopts, args = getopt.gnu_getopt(argv[1:], shortopts, longopts)
+    for opt, optarg in xopts:
+        if 0: pass
+        elif opt in ["-q", "--quiet"]: opts.verbose = opts.verbose - 1
+        elif opt in ["-v", "--verbose"]: opts.verbose = opts.verbose + 1
+        elif opt in ["--dry-run"]: opts.dry_run = opts.dry_run + 1
+        else: assert 0, ("getopt problem:", opt, optarg, xopts, args)
+    # usage: linktab.py file.dump file.bin
+    #   append the tables parsed from file.dump to file.bin
+    assert len(args) == 2, "need a listing and an object file"
+    listing = open(args[0], "rb").read().decode("latin-1")
+    fp = open(args[1], "rb" if opts.dry_run else "r+b")
+    fp.seek(0, 2)
+    odata = convert(listing, fp.tell())
+    if not opts.dry_run:
+        fp.write(odata)
+    fp.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -25,14 +25,15 @@
    <markus@oberhumer.com>               <ezerotven+github@gmail.com>
  */
 
-// INFO: not thread-safe; assumes a single UiPacker instance that
-// is exclusively called from main thread
+// INFO: the totals may get updated from several do_files() worker threads,
+// but each UiPacker instance must only be used by a single thread
 
 #include "conf.h"
 #include "file.h"
 #include "packer.h"
 #include "ui.h"
 #include "console/screen.h"
+#include <chrono>
 
 #if 1 && (USE_SCREEN)
 #define UI_USE_SCREEN 1
@@ -85,10 +86,14 @@ upx_uint64_t UiPacker::total_c_len = 0;
 upx_uint64_t UiPacker::total_u_len = 0;
 upx_uint64_t UiPacker::total_fc_len = 0;
 upx_uint64_t UiPacker::total_fu_len = 0;
-unsigned UiPacker::update_c_len = 0;
-unsigned UiPacker::update_u_len = 0;
-unsigned UiPacker::update_fc_len = 0;
-unsigned UiPacker::update_fu_len = 0;
+upx_thread_local unsigned UiPacker::update_c_len = 0;
+upx_thread_local unsigned UiPacker::update_u_len = 0;
+upx_thread_local unsigned UiPacker::update_fc_len = 0;
+upx_thread_local unsigned UiPacker::update_fu_len = 0;
+
+#if WITH_THREADS
+static std::mutex totals_mutex;
+#endif
 
 /*************************************************************************
 // constants
@@ -127,7 +132,7 @@ static void init_global_constants(void) noexcept {
 static const char *mkline(upx_uint64_t fu_len, upx_uint64_t fc_len, upx_uint64_t u_len,
                           upx_uint64_t c_len, const char *format_name, const char *filename,
                           bool decompress = false) {
-    static char buf[2048];
+    static upx_thread_local char buf[2048];
     char r[7 + 1];
     char fn[15 + 1];
     const char *f;
@@ -164,6 +169,8 @@ UiPacker::UiPacker(const Packer *p_) : ui_pass(0), ui_total_passes(0), p(p_), s(
     s = new State;
     memset(s, 0, sizeof(*s));
     s->msg_buf[0] = '\r';
+    if (opt->stats)
+        stats = new UiStats;
 
 #if defined(UI_USE_SCREEN)
     // FIXME - ugly hack
@@ -180,12 +187,17 @@ UiPacker::UiPacker(const Packer *p_) : ui_pass(0), ui_total_passes(0), p(p_), s(
         s->mode = M_CB_TERM;
     else
         s->mode = M_CB_SCREEN;
+    // no progress display when the output is captured
+    if (printCaptureActive() && s->mode > M_INFO)
+        s->mode = M_INFO;
 }
 
 UiPacker::~UiPacker() noexcept {
     cb.reset();
     delete s;
     s = nullptr;
+    delete stats;
+    stats = nullptr;
 }
 
 /*************************************************************************
@@ -296,6 +308,16 @@ void UiPacker::finalCallback(unsigned u_len, unsigned c_len) {
     doCallback(u_len, c_len);
 }
 
+// report a compression pass that already has been done without callbacks
+void UiPacker::passCallback(unsigned u_len, unsigned c_len) {
+    if (ui_pass >= 0)
+        ui_pass++;
+    startCallback(u_len, 0, ui_pass, ui_total_passes);
+    firstCallback();
+    finalCallback(u_len, c_len);
+    endCallback();
+}
+
 /*************************************************************************
 // end callback
 **************************************************************************/
@@ -445,12 +467,13 @@ void UiPacker::doCallback(unsigned isize, unsigned osize) {
 **************************************************************************/
 
 void UiPacker::uiPackStart(const OutputFile *fo) {
-    total_files++;
+    addTotalFile();
     UNUSED(fo);
 }
 
 void UiPacker::uiPackEnd(const OutputFile *fo) {
     uiUpdate(fo->st_size());
+    printStats("compress");
 
     if (s->mode == M_QUIET)
         return;
@@ -481,12 +504,13 @@ void UiPacker::uiPackTotal() {
 **************************************************************************/
 
 void UiPacker::uiUnpackStart(const OutputFile *fo) {
-    total_files++;
+    addTotalFile();
     UNUSED(fo);
 }
 
 void UiPacker::uiUnpackEnd(const OutputFile *fo) {
     uiUpdate(-1, fo->getBytesWritten());
+    printStats("decompress");
 
     if (s->mode == M_QUIET)
         return;
@@ -511,7 +535,7 @@ void UiPacker::uiUnpackTotal() {
 // list
 **************************************************************************/
 
-void UiPacker::uiListStart() { total_files++; }
+void UiPacker::uiListStart() { addTotalFile(); }
 
 void UiPacker::uiList() {
     const char *name = p->fi->getName();
@@ -540,7 +564,7 @@ void UiPacker::uiListTotal(bool decompress) {
 **************************************************************************/
 
 void UiPacker::uiTestStart() {
-    total_files++;
+    addTotalFile();
 
     if (opt->verbose >= 1) {
         con_fprintf(stdout, "testing %s ", p->fi->getName());
@@ -550,6 +574,7 @@ void UiPacker::uiTestStart() {
 }
 
 void UiPacker::uiTestEnd() {
+    printStats("test");
     if (opt->verbose >= 1) {
         con_fprintf(stdout, "[OK]\n");
         fflush(stdout);
@@ -565,7 +590,7 @@ void UiPacker::uiTestTotal() { uiFooter("Tested"); }
 **************************************************************************/
 
 bool UiPacker::uiFileInfoStart() {
-    total_files++;
+    addTotalFile();
 
     int fg = con_fg(stdout, FG_CYAN);
     con_fprintf(stdout, "%s [%s, %s]\n", p->fi->getName(), p->getFullName(opt), p->getName());
@@ -628,7 +653,17 @@ void UiPacker::uiUpdate(upx_off_t fc_len, upx_off_t fu_len) {
     update_u_len = p->ph.u_len;
 }
 
+void UiPacker::addTotalFile() {
+#if WITH_THREADS
+    std::lock_guard<std::mutex> lock(totals_mutex);
+#endif
+    total_files++;
+}
+
 void UiPacker::uiConfirmUpdate() {
+#if WITH_THREADS
+    std::lock_guard<std::mutex> lock(totals_mutex);
+#endif
     total_files_done++;
     total_fc_len += update_fc_len;
     total_fu_len += update_fu_len;
@@ -636,4 +671,219 @@ void UiPacker::uiConfirmUpdate() {
     total_u_len += update_u_len;
 }
 
+/*************************************************************************
+// stats
+**************************************************************************/
+
+void UiPacker::printStats(const char *cmd) {
+    if (stats == nullptr)
+        return;
+#if WITH_THREADS
+    static std::mutex print_mutex; // several files may finish at the same time
+    std::lock_guard<std::mutex> lock(print_mutex);
+#endif
+    stats->print(stderr, p->fi->getName(), p->getFullName(opt), cmd);
+}
+
+static double stats_wall_time() noexcept {
+    typedef std::chrono::steady_clock clock;
+    return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+}
+
+// the cpu time of the calling thread, so that the times of the worker
+// threads add up to the total cpu time
+static double stats_cpu_time() noexcept {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+    return double(clock()) / CLOCKS_PER_SEC;
+}
+
+UiStats::UiStats() noexcept { memset(phases, 0, sizeof(phases)); }
+
+UiStats::~UiStats() noexcept { delete[] trials; }
+
+UiStats::Timer::Timer(bool enabled) noexcept {
+    if (enabled) {
+        wall0 = stats_wall_time();
+        cpu0 = stats_cpu_time();
+    }
+}
+
+void UiStats::Timer::stop(UiStats *stats, int phase, upx_uint64_t bytes,
+                          unsigned count) const noexcept {
+    if (stats != nullptr)
+        stats->add(phase, stats_wall_time() - wall0, stats_cpu_time() - cpu0, bytes, count);
+}
+
+void UiStats::add(int phase, double wall, double cpu, upx_uint64_t bytes,
+                  unsigned count) noexcept {
+    assert(phase >= 0 && phase < PH_COUNT);
+#if WITH_THREADS
+    std::lock_guard<std::mutex> lock(mutex);
+#endif
+    Phase &ph = phases[phase];
+    ph.count += count;
+    ph.bytes += bytes;
+    ph.wall += wall;
+    ph.cpu += cpu;
+}
+
+void UiStats::addTrial(const Timer &t, int method, int filter, int level, unsigned u_len,
+                       unsigned c_len) noexcept {
+    const double wall = stats_wall_time() - t.wall0;
+    const double cpu = stats_cpu_time() - t.cpu0;
+    add(PH_COMPRESS, wall, cpu, u_len, 1);
+#if WITH_THREADS
+    std::lock_guard<std::mutex> lock(mutex);
+#endif
+    if (ntrials == trials_capacity) {
+        // keep the record bounded for huge multi-block files
+        const unsigned new_capacity = trials_capacity ? 2 * trials_capacity : 64;
+        Trial *const new_trials = new_capacity <= 65536 ? new (std::nothrow) Trial[new_capacity]
+                                                        : nullptr;
+        if (new_trials == nullptr) {
+            trials_dropped++;
+            return;
+        }
+        if (ntrials)
+            memcpy(new_trials, trials, sizeof(Trial) * ntrials);
+        delete[] trials;
+        trials = new_trials;
+        trials_capacity = new_capacity;
+    }
+    Trial &tr = trials[ntrials++];
+    tr.method = method;
+    tr.filter = filter;
+    tr.level = level;
+    tr.u_len = u_len;
+    tr.c_len = c_len;
+    tr.wall = wall;
+    tr.cpu = cpu;
+}
+
+unsigned UiStats::getCount(int phase) const noexcept {
+    assert(phase >= 0 && phase < PH_COUNT);
+#if WITH_THREADS
+    std::lock_guard<std::mutex> lock(mutex);
+#endif
+    return phases[phase].count;
+}
+
+upx_uint64_t UiStats::getBytes(int phase) const noexcept {
+    assert(phase >= 0 && phase < PH_COUNT);
+#if WITH_THREADS
+    std::lock_guard<std::mutex> lock(mutex);
+#endif
+    return phases[phase].bytes;
+}
+
+void UiStats::print(FILE *f, const char *iname, const char *format, const char *cmd) const {
+    static const char *const phase_names[PH_COUNT] = {
+        "detect", "compress", "overlap", "verify", "decompress", "loader", "relocate", "write",
+        "gate"};
+#if WITH_THREADS
+    std::lock_guard<std::mutex> lock(mutex);
+#endif
+    if (opt->stats == 2) {
+        // one JSON object per line
+        fprintf(f, "{\"file\":\"");
+        for (const char *n = iname; *n; n++) {
+            const unsigned char c = (unsigned char) *n;
+            if (c == '"' || c == '\\')
+                fprintf(f, "\\%c", c);
+            else if (c < 0x20)
+                fprintf(f, "\\u%04x", c);
+            else
+                fputc(c, f);
+        }
+        fprintf(f, "\",\"format\":\"%s\",\"cmd\":\"%s\",\"phases\":{", format, cmd);
+        for (int i = 0; i < PH_COUNT; i++)
+            fprintf(f, "%s\"%s\":{\"count\":%u,\"bytes\":%llu,\"wall\":%.6f,\"cpu\":%.6f}",
+                    i ? "," : "", phase_names[i], phases[i].count,
+                    (unsigned long long) phases[i].bytes, phases[i].wall, phases[i].cpu);
+        fprintf(f, "},\"trials\":[");
+        for (unsigned i = 0; i < ntrials; i++) {
+            const Trial &tr = trials[i];
+            fprintf(f,
+                    "%s{\"method\":%d,\"filter\":%d,\"level\":%d,\"u_len\":%u,\"c_len\":%u,"
+                    "\"wall\":%.6f,\"cpu\":%.6f}",
+                    i ? "," : "", tr.method, tr.filter, tr.level, tr.u_len, tr.c_len, tr.wall,
+                    tr.cpu);
+        }
+        fprintf(f, "],\"trials_dropped\":%u}\n", trials_dropped);
+    } else {
+        fprintf(f, "\nstats: %s [%s, %s]\n", iname, format, cmd);
+        fprintf(f, "  %-10s %8s %12s %10s %10s\n", "phase", "count", "bytes", "wall", "cpu");
+        for (int i = 0; i < PH_COUNT; i++)
+            fprintf(f, "  %-10s %8u %12llu %10.6f %10.6f\n", phase_names[i], phases[i].count,
+                    (unsigned long long) phases[i].bytes, phases[i].wall, phases[i].cpu);
+        if (ntrials)
+            fprintf(f, "  %-6s %6s %5s %10s %10s %10s %10s\n", "method", "filter", "level",
+                    "u_len", "c_len", "wall", "cpu");
+        for (unsigned i = 0; i < ntrials; i++) {
+            const Trial &tr = trials[i];
+            fprintf(f, "  %6d %#6x %5d %10u %10u %10.6f %10.6f\n", tr.method, tr.filter,
+                    tr.level, tr.u_len, tr.c_len, tr.wall, tr.cpu);
+        }
+        if (trials_dropped)
+            fprintf(f, "  (%u more trials not recorded)\n", trials_dropped);
+    }
+    fflush(f);
+}
+
+/*************************************************************************
+// test
+**************************************************************************/
+
+TEST_CASE("UiStats") {
+    Options *const saved_opt = opt;
+    Options local_options;
+    opt = &local_options;
+    opt->reset();
+    opt->stats = 2; // json
+    UiStats stats;
+    stats.add(UiStats::PH_LOADER, 0.5, 0.25, 0, 1);
+    stats.add(UiStats::PH_LOADER, 0.5, 0.25, 0, 2);
+    stats.add(UiStats::PH_WRITE, 0, 0, 1000, 1);
+    {
+        UiStats::Scope timer(&stats, UiStats::PH_GATE, 4096);
+        timer.count = 3;
+    }
+    { UiStats::Scope timer(nullptr, UiStats::PH_GATE, 4096); } // disabled
+    const UiStats::Timer t;
+    stats.addTrial(t, M_LZMA, 0x49, 9, 1000, 400);
+
+    char line[4096] = {};
+    FILE *f = tmpfile();
+    CHECK(f != nullptr);
+    if (f != nullptr) {
+        stats.print(f, "a\"b\\c\n", "linux/amd64", "pack");
+        rewind(f);
+        if (fgets(line, sizeof(line), f) == nullptr)
+            line[0] = 0;
+        fclose(f);
+    }
+    opt = saved_opt;
+
+    CHECK(stats.getCount(UiStats::PH_LOADER) == 3);
+    CHECK(stats.getBytes(UiStats::PH_WRITE) == 1000);
+    CHECK(stats.getCount(UiStats::PH_COMPRESS) == 1);
+    CHECK(strstr(line, "{\"file\":\"a\\\"b\\\\c\\u000a\",\"format\":\"linux/amd64\","
+                       "\"cmd\":\"pack\",\"phases\":{\"detect\":{\"count\":0,") == line);
+    CHECK(strstr(line, "\"loader\":{\"count\":3,\"bytes\":0,\"wall\":1.000000,"
+                       "\"cpu\":0.500000}") != nullptr);
+    CHECK(strstr(line, "\"write\":{\"count\":1,\"bytes\":1000,") != nullptr);
+    CHECK(strstr(line, "\"gate\":{\"count\":3,\"bytes\":4096,") != nullptr);
+    CHECK(strstr(line, "\"compress\":{\"count\":1,\"bytes\":1000,") != nullptr); // addTrial()
+    char trial[128];
+    snprintf(trial, sizeof(trial),
+             "\"trials\":[{\"method\":%d,\"filter\":73,\"level\":9,\"u_len\":1000,\"c_len\":400,",
+             M_LZMA);
+    CHECK(strstr(line, trial) != nullptr);
+    CHECK(strstr(line, "],\"trials_dropped\":0}\n") != nullptr);
+}
+
 /* vim:set ts=4 sw=4 et: */
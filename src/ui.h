@@ -30,6 +30,86 @@
 class OutputFile;
 class Packer;
 
+/*************************************************************************
+// per-file phase timings and counters for option "--stats"
+//
+// Unlike class UiPacker this may get used from several threads, as the
+// compression trials of a single file may run concurrently.
+**************************************************************************/
+
+class UiStats final {
+public:
+    UiStats() noexcept;
+    ~UiStats() noexcept;
+
+    enum {
+        PH_DETECT,     // format detection
+        PH_COMPRESS,   // compression trials
+        PH_OVERLAP,    // overlap analysis
+        PH_VERIFY,     // verification decompressions
+        PH_DECOMPRESS, // decompression when unpacking or testing
+        PH_LOADER,     // buildLoader()
+        PH_RELOCATE,   // relocateLoader()
+        PH_WRITE,      // output writes
+        PH_GATE,       // entropy gate; counts the blocks and bytes stored right away
+        PH_COUNT
+    };
+
+    // wall and thread cpu time since construction; does nothing if !enabled
+    class Timer {
+    public:
+        explicit Timer(bool enabled = true) noexcept;
+        void stop(UiStats *stats, int phase, upx_uint64_t bytes, unsigned count = 1) const noexcept;
+
+    protected:
+        double wall0 = 0;
+        double cpu0 = 0;
+        friend class UiStats;
+    };
+    // stops the timer at the end of the scope
+    class Scope final : public Timer {
+    public:
+        Scope(UiStats *s, int ph, upx_uint64_t b = 0) noexcept
+            : Timer(s != nullptr), stats(s), phase(ph), bytes(b) {}
+        ~Scope() noexcept { stop(stats, phase, bytes, count); }
+        UiStats *const stats;
+        const int phase;
+        upx_uint64_t bytes;
+        unsigned count = 1;
+    };
+
+    void add(int phase, double wall, double cpu, upx_uint64_t bytes, unsigned count) noexcept;
+    void addTrial(const Timer &t, int method, int filter, int level, unsigned u_len,
+                  unsigned c_len) noexcept;
+    void print(FILE *f, const char *iname, const char *format, const char *cmd) const;
+    // the totals of a phase
+    unsigned getCount(int phase) const noexcept;
+    upx_uint64_t getBytes(int phase) const noexcept;
+
+private:
+    struct Phase {
+        unsigned count;
+        upx_uint64_t bytes;
+        double wall, cpu;
+    };
+    struct Trial {
+        int method, filter, level;
+        unsigned u_len, c_len;
+        double wall, cpu;
+    };
+    Phase phases[PH_COUNT];
+    Trial *trials = nullptr;
+    unsigned ntrials = 0;
+    unsigned trials_capacity = 0;
+    unsigned trials_dropped = 0;
+#if WITH_THREADS
+    mutable std::mutex mutex;
+#endif
+
+    UiStats(const UiStats &) = delete;
+    UiStats &operator=(const UiStats &) = delete;
+};
+
 /*************************************************************************
 //
 **************************************************************************/
@@ -64,6 +144,7 @@ public:
     virtual void startCallback(unsigned u_len, unsigned step, int pass, int total_passes);
     virtual void firstCallback();
     virtual void finalCallback(unsigned u_len, unsigned c_len);
+    virtual void passCallback(unsigned u_len, unsigned c_len);
     virtual void endCallback();
     virtual void endCallback(bool done);
     virtual upx_callback_t *getCallback() { return &cb; }
@@ -82,8 +163,12 @@ public:
     int ui_pass;
     int ui_total_passes;
 
+    // nullptr unless option "--stats" is given
+    UiStats *stats = nullptr;
+
 protected:
     virtual void printInfo(int nl = 0);
+    virtual void printStats(const char *cmd);
     const Packer *p = nullptr;
 
     // callback
@@ -100,10 +185,11 @@ protected:
     static upx_uint64_t total_u_len;
     static upx_uint64_t total_fc_len;
     static upx_uint64_t total_fu_len;
-    static unsigned update_c_len;
-    static unsigned update_u_len;
-    static unsigned update_fc_len;
-    static unsigned update_fu_len;
+    static upx_thread_local unsigned update_c_len;
+    static upx_thread_local unsigned update_u_len;
+    static upx_thread_local unsigned update_fc_len;
+    static upx_thread_local unsigned update_fu_len;
+    static void addTotalFile();
 };
 
 /* vim:set ts=4 sw=4 et: */
@@ -171,6 +171,73 @@ void MemBuffer::fill(unsigned off, unsigned len, int value) {
         memset(ptr + off, value, len);
 }
 
+/*************************************************************************
+// per-thread pool of large blocks
+//
+// Only used together with the simple mcheck (i.e. not under ASAN or
+// valgrind), which leaves room to store the block capacity in the
+// header in front of the buffer.
+**************************************************************************/
+
+namespace {
+struct MemBufferPool final {
+    static constexpr size_t MIN_BYTES = 64 * 1024;          // don't pool small blocks
+    static constexpr size_t MAX_BYTES = 512 * 1024 * 1024; // limit cached memory
+    static constexpr unsigned MAX_BLOCKS = 8;
+    byte *blocks[MAX_BLOCKS] = {}; // malloc() pointers
+    size_t capacity[MAX_BLOCKS] = {};
+    unsigned nblocks = 0;
+    size_t cached_bytes = 0;
+
+    ~MemBufferPool() noexcept { release(); }
+    void release() noexcept {
+        for (unsigned i = 0; i < nblocks; i++)
+            ::free(blocks[i]);
+        nblocks = 0;
+        cached_bytes = 0;
+    }
+    // best fit, but don't waste more than half of a block
+    byte *get(size_t bytes, size_t *cap) noexcept {
+        unsigned best = nblocks;
+        for (unsigned i = 0; i < nblocks; i++)
+            if (capacity[i] >= bytes && capacity[i] / 2 <= bytes &&
+                (best == nblocks || capacity[i] < capacity[best]))
+                best = i;
+        if (best == nblocks)
+            return nullptr;
+        byte *p = blocks[best];
+        *cap = capacity[best];
+        cached_bytes -= capacity[best];
+        nblocks -= 1;
+        blocks[best] = blocks[nblocks];
+        capacity[best] = capacity[nblocks];
+        return p;
+    }
+    bool put(byte *p, size_t cap) noexcept {
+        if (cap < MIN_BYTES || nblocks >= MAX_BLOCKS || cached_bytes + cap > MAX_BYTES)
+            return false;
+        blocks[nblocks] = p;
+        capacity[nblocks] = cap;
+        nblocks += 1;
+        cached_bytes += cap;
+        return true;
+    }
+};
+} // namespace
+
+static upx_thread_local MemBufferPool mem_buffer_pool;
+
+/*static*/ void MemBuffer::releasePool() noexcept { mem_buffer_pool.release(); }
+
+/*static*/ void MemBuffer::printStats(FILE *f) {
+    fprintf(f, "MemBuffer: %u allocs (%u from pool), %u deallocs, %llu bytes, %llu active\n",
+            (unsigned) stats.global_alloc_counter, (unsigned) stats.global_pool_hit_counter,
+            (unsigned) stats.global_dealloc_counter, (upx_uint64_t) stats.global_total_bytes,
+            (upx_uint64_t) stats.global_total_active_bytes);
+    fprintf(f, "MemBuffer: %llu bytes served from pool\n",
+            (upx_uint64_t) stats.global_pool_hit_bytes);
+}
+
 /*************************************************************************
 //
 **************************************************************************/
@@ -202,9 +269,18 @@ void MemBuffer::alloc(upx_uint64_t bytes) {
     assert(bytes > 0);
     debug_set(debug.last_return_address_alloc, upx_return_address());
     size_t malloc_bytes = mem_size(1, bytes); // check size
-    if (use_simple_mcheck())
+    size_t capacity = malloc_bytes;
+    byte *p = nullptr;
+    if (use_simple_mcheck()) {
+        p = mem_buffer_pool.get(capacity, &capacity);
+        if (p != nullptr) {
+            stats.global_pool_hit_counter += 1;
+            stats.global_pool_hit_bytes += bytes;
+        }
         malloc_bytes += 32;
-    byte *p = (byte *) ::malloc(malloc_bytes);
+    }
+    if (!p)
+        p = (byte *) ::malloc(malloc_bytes);
     NO_printf("MemBuffer::alloc %llu: %p\n", bytes, p);
     if (!p)
         throwOutOfMemoryException();
@@ -212,6 +288,7 @@ void MemBuffer::alloc(upx_uint64_t bytes) {
     if (use_simple_mcheck()) {
         p += 16;
         // store magic constants to detect buffer overruns
+        set_ne32(p - 12, ACC_ICONV(unsigned, capacity));
         set_ne32(p - 8, size_in_bytes);
         set_ne32(p - 4, MAGIC1(p));
         set_ne32(p + size_in_bytes, MAGIC2(p));
@@ -238,13 +315,16 @@ void MemBuffer::dealloc() noexcept {
         stats.global_total_active_bytes -= size_in_bytes;
         if (use_simple_mcheck()) {
             byte *p = (byte *) ptr;
+            const size_t capacity = get_ne32(p - 12);
             // clear magic constants
+            set_ne32(p - 12, 0);
             set_ne32(p - 8, 0);
             set_ne32(p - 4, 0);
             set_ne32(p + size_in_bytes, 0);
             set_ne32(p + size_in_bytes + 4, 0);
             //
-            ::free(p - 16);
+            if (!mem_buffer_pool.put(p - 16, capacity))
+                ::free(p - 16);
         } else {
             ::free(ptr);
         }
@@ -290,6 +370,26 @@ TEST_CASE("MemBuffer core") {
     }
 }
 
+TEST_CASE("MemBuffer pool") {
+    MemBuffer::releasePool();
+    const upx_uint32_t hits = MemBuffer::getStats().global_pool_hit_counter;
+    MemBuffer mb(256 * 1024);
+    mb.clear();
+    void *p = mb.getVoidPtr();
+    mb.dealloc();
+    mb.alloc(200 * 1024); // reuses the pooled block
+    mb.checkState();
+    if (use_simple_mcheck()) {
+        CHECK(mb.getVoidPtr() == p);
+        CHECK(MemBuffer::getStats().global_pool_hit_counter == hits + 1);
+    }
+    mb.dealloc();
+    mb.alloc(64 * 1024); // too small for the pooled block
+    CHECK(mb.getVoidPtr() != p);
+    mb.dealloc();
+    MemBuffer::releasePool();
+}
+
 TEST_CASE("MemBuffer global overloads") {
     MemBuffer mb(1);
     MemBuffer mb4(4);
@@ -167,8 +167,11 @@ public:
         return (pointer) subref_impl(errfmt, skip, take);
     }
 
-private:
-    void *subref_impl(const char *errfmt, size_t skip, size_t take);
+    // Large blocks are not returned to the heap on dealloc() but kept in
+    // a small per-thread pool, so that repeated compression trials reuse
+    // the same memory. releasePool() frees the pool of the calling thread;
+    // it is called after each file.
+    static void releasePool() noexcept;
 
     // static debug stats
     struct Stats {
@@ -176,7 +179,15 @@ private:
         upx_std_atomic(upx_uint32_t) global_dealloc_counter;
         upx_std_atomic(upx_uint64_t) global_total_bytes;
         upx_std_atomic(upx_uint64_t) global_total_active_bytes;
+        upx_std_atomic(upx_uint32_t) global_pool_hit_counter; // allocs served by the pool
+        upx_std_atomic(upx_uint64_t) global_pool_hit_bytes;
     };
+    static const Stats &getStats() noexcept { return stats; }
+    static void printStats(FILE *f);
+
+private:
+    void *subref_impl(const char *errfmt, size_t skip, size_t take);
+
     static Stats stats;
 #if DEBUG
     // debugging aid
@@ -27,6 +27,7 @@
 
 #include "../headers.h"
 #include <algorithm>
+#include <cmath>
 #include "../conf.h"
 
 #define ACC_WANT_ACC_INCI_H 1
@@ -341,6 +342,194 @@ TEST_CASE("upx_stable_sort") {
 #endif // C++20
 #endif // DEBUG
 
+/*************************************************************************
+// threads
+**************************************************************************/
+
+unsigned upx_get_nthreads(int threads) {
+#if WITH_THREADS
+    if (threads <= 0) {
+        threads = (int) std::thread::hardware_concurrency();
+        if (threads <= 0)
+            threads = 1;
+    }
+    return UPX_MIN((unsigned) threads, 256u);
+#else
+    UNUSED(threads);
+    return 1;
+#endif
+}
+
+upx_uint64_t upx_get_memory_budget(upx_uint64_t default_budget) {
+    if (opt->memory_limit == 0)
+        return default_budget;
+    return UPX_MIN(default_budget, upx_uint64_t(opt->memory_limit) * 1024 * 1024);
+}
+
+void upx_parallel_for(unsigned n, unsigned nthreads, upx_parallel_func_t func, void *user) {
+    if (nthreads > n)
+        nthreads = n;
+#if WITH_THREADS
+    if (nthreads > 1) {
+        std::atomic<unsigned> next(0);
+        Options *const caller_opt = opt; // opt is thread-local
+        auto worker = [&]() {
+            opt = caller_opt;
+            for (;;) {
+                unsigned i = next.fetch_add(1);
+                if (i >= n)
+                    break;
+                func(user, i);
+            }
+        };
+        // the calling thread also acts as a worker
+        std::thread *threads = new std::thread[nthreads - 1];
+        unsigned started = 0;
+        try {
+            for (; started < nthreads - 1; started++)
+                threads[started] = std::thread(worker);
+        } catch (const std::exception &) {
+            // could not create more threads - just continue with fewer
+        }
+        worker();
+        for (unsigned t = 0; t < started; t++)
+            threads[t].join();
+        delete[] threads;
+        return;
+    }
+#endif
+    for (unsigned i = 0; i < n; i++)
+        func(user, i);
+}
+
+void upx_parallel_pipeline(unsigned n, unsigned nthreads, unsigned window,
+                           upx_parallel_func_t produce, upx_parallel_func_t work,
+                           upx_parallel_func_t consume, void *user) {
+    if (window > n)
+        window = n;
+    if (nthreads > window)
+        nthreads = window;
+#if WITH_THREADS
+    if (nthreads > 1) {
+        std::mutex mutex;
+        std::condition_variable cond;
+        unsigned queued = 0;  // jobs handed to the workers
+        unsigned started = 0; // jobs taken by a worker
+        bool stop = false;
+        bool *const done = new bool[window];
+        Options *const caller_opt = opt; // opt is thread-local
+        auto worker = [&]() {
+            opt = caller_opt;
+            std::unique_lock<std::mutex> lock(mutex);
+            for (;;) {
+                cond.wait(lock, [&]() { return stop || started < queued; });
+                if (stop)
+                    break;
+                unsigned i = started++;
+                lock.unlock();
+                work(user, i);
+                lock.lock();
+                done[i % window] = true;
+                cond.notify_all();
+            }
+        };
+        // the calling thread produces and consumes, so all nthreads are workers
+        std::thread *threads = new std::thread[nthreads];
+        unsigned nstarted = 0;
+        try {
+            for (; nstarted < nthreads; nstarted++)
+                threads[nstarted] = std::thread(worker);
+        } catch (const std::exception &) {
+            // could not create more threads - just continue with fewer
+        }
+        auto join_all = [&]() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            cond.notify_all();
+            for (unsigned t = 0; t < nstarted; t++)
+                threads[t].join();
+            delete[] threads;
+            delete[] done;
+        };
+        if (nstarted > 0) {
+            try {
+                for (unsigned i = 0; i < n; i++) {
+                    // read ahead as far as the window allows
+                    while (queued < n && queued < i + window) {
+                        produce(user, queued);
+                        std::lock_guard<std::mutex> lock(mutex);
+                        done[queued % window] = false;
+                        queued++;
+                        cond.notify_all();
+                    }
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        cond.wait(lock, [&]() { return done[i % window]; });
+                    }
+                    consume(user, i);
+                }
+            } catch (...) {
+                join_all();
+                throw;
+            }
+            join_all();
+            return;
+        }
+        join_all();
+    }
+#else
+    UNUSED(nthreads);
+#endif
+    for (unsigned i = 0; i < n; i++) {
+        produce(user, i);
+        work(user, i);
+        consume(user, i);
+    }
+}
+
+TEST_CASE("upx_parallel_for") {
+    unsigned a[100];
+    memset(a, 0, sizeof(a));
+    auto f = [&](unsigned i) { a[i] += i + 1; };
+    upx_parallel_for(100, 4, f);
+    upx_parallel_for(100, 1, f);
+    upx_parallel_for(0, 4, f);
+    bool ok = true;
+    for (unsigned i = 0; i < 100; i++)
+        ok &= (a[i] == 2 * (i + 1));
+    CHECK(ok);
+    CHECK(upx_get_nthreads(1) == 1);
+    CHECK(upx_get_nthreads(0) >= 1);
+    const unsigned saved_limit = opt->memory_limit;
+    opt->memory_limit = 0;
+    CHECK(upx_get_memory_budget(12345) == 12345);
+    opt->memory_limit = 2;
+    CHECK(upx_get_memory_budget(12345) == 12345);
+    CHECK(upx_get_memory_budget(1u << 30) == 2 * 1024 * 1024);
+    opt->memory_limit = saved_limit;
+}
+
+TEST_CASE("upx_parallel_pipeline") {
+    unsigned slots[4];
+    unsigned next = 0;
+    bool ok = true;
+    auto produce = [&](unsigned i) { slots[i % 4] = i; };
+    auto work = [&](unsigned i) { slots[i % 4] = 3 * slots[i % 4] + 1; };
+    auto consume = [&](unsigned i) {
+        ok &= (i == next++);
+        ok &= (slots[i % 4] == 3 * i + 1);
+    };
+    upx_parallel_pipeline(100, 3, 4, produce, work, consume);
+    CHECK(ok);
+    CHECK(next == 100);
+    next = 0;
+    upx_parallel_pipeline(10, 1, 4, produce, work, consume);
+    CHECK(ok);
+    CHECK(next == 10);
+}
+
 /*************************************************************************
 // qsort() util
 **************************************************************************/
@@ -753,6 +942,62 @@ bool makebakname(char *ofilename, size_t size, const char *ifilename, bool force
     return false;
 }
 
+/*************************************************************************
+// return the order-0 entropy of buf[] in bits per byte, i.e. 0.0 .. 8.0
+**************************************************************************/
+
+// The histogram cycles through four tables, so that neighbouring bytes
+// (and thus runs of the same byte) never wait on the same counter.
+double upx_byte_entropy(const byte *buf, unsigned len) {
+    if (len == 0)
+        return 0;
+    unsigned counts[4][256];
+    memset(counts, 0, sizeof(counts));
+    unsigned i = 0;
+    for (; i + 8 <= len; i += 8) {
+        const upx_uint64_t v = get_le64(buf + i);
+        counts[0][v & 0xff] += 1;
+        counts[1][(v >> 8) & 0xff] += 1;
+        counts[2][(v >> 16) & 0xff] += 1;
+        counts[3][(v >> 24) & 0xff] += 1;
+        counts[0][(v >> 32) & 0xff] += 1;
+        counts[1][(v >> 40) & 0xff] += 1;
+        counts[2][(v >> 48) & 0xff] += 1;
+        counts[3][v >> 56] += 1;
+    }
+    for (; i < len; i++)
+        counts[i & 3][buf[i]] += 1;
+    double sum = 0;
+    for (unsigned b = 0; b < 256; b++) {
+        const unsigned n = counts[0][b] + counts[1][b] + counts[2][b] + counts[3][b];
+        if (n != 0)
+            sum += n * std::log2(double(n));
+    }
+    return std::log2(double(len)) - sum / len;
+}
+
+TEST_CASE("upx_byte_entropy") {
+    byte buf[4096 + 3];
+    memset(buf, 0, sizeof(buf));
+    CHECK(upx_byte_entropy(buf, 0) == 0);
+    CHECK(upx_byte_entropy(buf, sizeof(buf)) == 0);
+    for (unsigned i = 0; i < sizeof(buf); i++)
+        buf[i] = (byte) (i & 1);
+    CHECK(upx_byte_entropy(buf, 4096) == 1);
+    for (unsigned i = 0; i < sizeof(buf); i++)
+        buf[i] = (byte) i;
+    CHECK(upx_byte_entropy(buf, 256) == 8);
+    CHECK(upx_byte_entropy(buf, 4096) == 8);
+    CHECK(upx_byte_entropy(buf + 3, 4096) == 8);
+    upx_uint32_t x = 1;
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        x = x * 1103515245 + 12345;
+        buf[i] = (byte) (x >> 24);
+    }
+    const double e = upx_byte_entropy(buf, sizeof(buf));
+    CHECK((e > 7.9 && e < 8));
+}
+
 /*************************************************************************
 // return compression ratio, where 100% == 1000*1000 == 1e6
 **************************************************************************/
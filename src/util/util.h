@@ -138,6 +138,51 @@ void upx_memswap(void *a, void *b, size_t n);
 void upx_stable_sort(void *array, size_t n, size_t element_size,
                      int (*compare)(const void *, const void *));
 
+/*************************************************************************
+// threads
+**************************************************************************/
+
+// number of worker threads to use for opt->threads; 0 means number of CPUs
+unsigned upx_get_nthreads(int threads);
+
+// memory budget in bytes for work buffers: default_budget, lowered to
+// opt->memory_limit if that is set
+upx_uint64_t upx_get_memory_budget(upx_uint64_t default_budget);
+
+// call func(user, i) for all i in [0, n) using up to nthreads threads;
+// tasks are started in increasing order. func must not throw.
+typedef void (*upx_parallel_func_t)(void *user, unsigned i);
+void upx_parallel_for(unsigned n, unsigned nthreads, upx_parallel_func_t func, void *user);
+
+template <class F>
+inline void upx_parallel_for(unsigned n, unsigned nthreads, F &f) {
+    upx_parallel_for(
+        n, nthreads, [](void *user, unsigned i) { (*static_cast<F *>(user))(i); }, &f);
+}
+
+// Pipeline for n jobs: the calling thread runs produce(user, i) and later
+// consume(user, i) strictly in order, while work(user, i) runs on up to
+// nthreads worker threads. At most window jobs are in flight, so job i can
+// reuse the slot (i % window). work must not throw; exceptions thrown by
+// produce or consume are propagated after the workers have been stopped.
+void upx_parallel_pipeline(unsigned n, unsigned nthreads, unsigned window,
+                           upx_parallel_func_t produce, upx_parallel_func_t work,
+                           upx_parallel_func_t consume, void *user);
+
+template <class P, class W, class C>
+inline void upx_parallel_pipeline(unsigned n, unsigned nthreads, unsigned window, P &produce,
+                                  W &work, C &consume) {
+    struct Funcs {
+        P *p;
+        W *w;
+        C *c;
+    } funcs = {&produce, &work, &consume};
+    upx_parallel_pipeline(
+        n, nthreads, window, [](void *user, unsigned i) { (*static_cast<Funcs *>(user)->p)(i); },
+        [](void *user, unsigned i) { (*static_cast<Funcs *>(user)->w)(i); },
+        [](void *user, unsigned i) { (*static_cast<Funcs *>(user)->c)(i); }, &funcs);
+}
+
 /*************************************************************************
 // misc. support functions
 **************************************************************************/
@@ -163,6 +208,7 @@ bool maketempname(char *ofilename, size_t size, const char *ifilename, const cha
 bool makebakname(char *ofilename, size_t size, const char *ifilename, bool force = true);
 
 unsigned get_ratio(upx_uint64_t u_len, upx_uint64_t c_len);
+double upx_byte_entropy(const byte *buf, unsigned len);
 bool set_method_name(char *buf, size_t size, int method, int level);
 void center_string(char *buf, size_t size, const char *s);
 
@@ -263,6 +263,149 @@ static void unlink_ofile(char *oname) {
     }
 }
 
+// process one file; returns -1 on fatal errors
+static int do_one_file_catch(const char *iname) {
+    char oname[ACC_FN_PATH_MAX + 1];
+    oname[0] = 0;
+
+    // the memory pool is per-file scratch space
+    struct ReleasePool {
+        ~ReleasePool() noexcept { MemBuffer::releasePool(); }
+    } release_pool;
+    try {
+        do_one_file(iname, oname);
+    } catch (const Exception &e) {
+        unlink_ofile(oname);
+        if (opt->verbose >= 1 || (opt->verbose >= 0 && !e.isWarning()))
+            printErr(iname, &e);
+        main_set_exit_code(e.isWarning() ? EXIT_WARN : EXIT_ERROR);
+        // this is not fatal, continue processing more files
+    } catch (const Error &e) {
+        unlink_ofile(oname);
+        printErr(iname, &e);
+        main_set_exit_code(EXIT_ERROR);
+        return -1; // fatal error
+    } catch (std::bad_alloc *e) {
+        unlink_ofile(oname);
+        printErr(iname, "out of memory");
+        UNUSED(e);
+        // delete e;
+        main_set_exit_code(EXIT_ERROR);
+        return -1; // fatal error
+    } catch (const std::bad_alloc &) {
+        unlink_ofile(oname);
+        printErr(iname, "out of memory");
+        main_set_exit_code(EXIT_ERROR);
+        return -1; // fatal error
+    } catch (std::exception *e) {
+        unlink_ofile(oname);
+        printUnhandledException(iname, e);
+        // delete e;
+        main_set_exit_code(EXIT_ERROR);
+        return -1; // fatal error
+    } catch (const std::exception &e) {
+        unlink_ofile(oname);
+        printUnhandledException(iname, &e);
+        main_set_exit_code(EXIT_ERROR);
+        return -1; // fatal error
+    } catch (...) {
+        unlink_ofile(oname);
+        printUnhandledException(iname, nullptr);
+        main_set_exit_code(EXIT_ERROR);
+        return -1; // fatal error
+    }
+    return 0;
+}
+
+#if WITH_THREADS
+// Process independent files concurrently. Each worker thread uses its own
+// copy of the options (and class PackMaster makes another per-file copy),
+// and the output of each file is captured and then printed by the main
+// thread in commandline order, so that nothing gets interleaved.
+namespace {
+struct FileJob final {
+    const char *iname = nullptr;
+    PrintCapture *capture = nullptr;
+    int r = 0; // -1 on fatal error
+    bool done = false;
+};
+} // namespace
+
+static int do_files_parallel(int i, int argc, char *argv[], unsigned nthreads) {
+    const unsigned njobs = argc - i;
+    Options job_options = *opt; // struct copy
+    job_options.threads = 1;    // files are the unit of parallelism here
+    std::mutex job_mutex;
+    std::condition_variable job_cond;
+    unsigned next_job = 0;
+    bool stop = false; // set on fatal errors
+
+    FileJob *const jobs = new FileJob[njobs];
+    for (unsigned j = 0; j < njobs; j++)
+        jobs[j].iname = argv[i + j];
+
+    auto worker = [&]() {
+        Options local_options = job_options; // struct copy
+        opt = &local_options;
+        for (;;) {
+            unsigned j;
+            {
+                std::lock_guard<std::mutex> lock(job_mutex);
+                if (stop || next_job >= njobs)
+                    break;
+                j = next_job++;
+            }
+            FileJob &job = jobs[j];
+            job.capture = printCaptureBegin();
+            infoHeader();
+            job.r = do_one_file_catch(job.iname);
+            printCaptureEnd();
+            {
+                std::lock_guard<std::mutex> lock(job_mutex);
+                job.done = true;
+                if (job.r < 0)
+                    stop = true;
+            }
+            job_cond.notify_all();
+        }
+    };
+
+    nthreads = UPX_MIN(nthreads, njobs);
+    std::thread *threads = new std::thread[nthreads];
+    unsigned started = 0;
+    try {
+        for (; started < nthreads; started++)
+            threads[started] = std::thread(worker);
+    } catch (const std::exception &) {
+        // could not create more threads - just continue with fewer
+    }
+    if (started == 0)
+        worker(); // process all files in the main thread
+
+    // print the output of each file in order
+    int r = 0;
+    for (unsigned j = 0; j < njobs; j++) {
+        FileJob &job = jobs[j];
+        {
+            std::unique_lock<std::mutex> lock(job_mutex);
+            job_cond.wait(lock, [&]() { return job.done || (stop && j >= next_job); });
+        }
+        if (!job.done) // not started because of a fatal error
+            break;
+        printCaptureFlush(job.capture);
+        job.capture = nullptr;
+        if (job.r < 0)
+            r = -1;
+    }
+
+    for (unsigned t = 0; t < started; t++)
+        threads[t].join();
+    delete[] threads;
+    delete[] jobs;
+    return r;
+}
+#endif
+
 int do_files(int i, int argc, char *argv[]) {
     upx_compiler_sanity_check();
     if (opt->verbose >= 1) {
@@ -270,56 +413,18 @@ int do_files(int i, int argc, char *argv[]) {
         UiPacker::uiHeader();
     }
 
-    for (; i < argc; i++) {
-        infoHeader();
-
-        const char *iname = argv[i];
-        char oname[ACC_FN_PATH_MAX + 1];
-        oname[0] = 0;
-
-        try {
-            do_one_file(iname, oname);
-        } catch (const Exception &e) {
-            unlink_ofile(oname);
-            if (opt->verbose >= 1 || (opt->verbose >= 0 && !e.isWarning()))
-                printErr(iname, &e);
-            main_set_exit_code(e.isWarning() ? EXIT_WARN : EXIT_ERROR);
-            // this is not fatal, continue processing more files
-        } catch (const Error &e) {
-            unlink_ofile(oname);
-            printErr(iname, &e);
-            main_set_exit_code(EXIT_ERROR);
-            return -1; // fatal error
-        } catch (std::bad_alloc *e) {
-            unlink_ofile(oname);
-            printErr(iname, "out of memory");
-            UNUSED(e);
-            // delete e;
-            main_set_exit_code(EXIT_ERROR);
-            return -1; // fatal error
-        } catch (const std::bad_alloc &) {
-            unlink_ofile(oname);
-            printErr(iname, "out of memory");
-            main_set_exit_code(EXIT_ERROR);
-            return -1; // fatal error
-        } catch (std::exception *e) {
-            unlink_ofile(oname);
-            printUnhandledException(iname, e);
-            // delete e;
-            main_set_exit_code(EXIT_ERROR);
-            return -1; // fatal error
-        } catch (const std::exception &e) {
-            unlink_ofile(oname);
-            printUnhandledException(iname, &e);
-            main_set_exit_code(EXIT_ERROR);
-            return -1; // fatal error
-        } catch (...) {
-            unlink_ofile(oname);
-            printUnhandledException(iname, nullptr);
-            main_set_exit_code(EXIT_ERROR);
+#if WITH_THREADS
+    const unsigned nthreads = upx_get_nthreads(opt->threads);
+    if (nthreads > 1 && argc - i > 1 && !opt->to_stdout && !opt->output_name) {
+        if (do_files_parallel(i, argc, argv, nthreads) < 0)
             return -1; // fatal error
+    } else
+#endif
+        for (; i < argc; i++) {
+            infoHeader();
+            if (do_one_file_catch(argv[i]) < 0)
+                return -1; // fatal error
         }
-    }
 
     if (opt->cmd == CMD_COMPRESS)
         UiPacker::uiPackTotal();
@@ -331,6 +436,8 @@ int do_files(int i, int argc, char *argv[]) {
         UiPacker::uiTestTotal();
     else if (opt->cmd == CMD_FILEINFO)
         UiPacker::uiFileInfoTotal();
+    if (opt->debug.debug_level)
+        MemBuffer::printStats(stderr);
     return 0;
 }
 